@@ -0,0 +1,309 @@
+// Asynchronous file I/O.
+//
+// A process that calls aiosetup() gets a page of submission
+// and completion rings (see aio.h) mapped at UAIO.  aiowait()
+// moves new submissions onto a queue served by NAIOTHREAD
+// kernel threads, which run filepread() and filepwrite() on
+// the process's behalf and post the results to its completion
+// ring.  Each request names its own file offset, so requests
+// in flight together on one file do not depend on the order
+// the threads happen to run them in.  (A pipe has no offset:
+// requests on one run in whatever order the threads take.)
+// An fsync waits for the requests submitted before it on the
+// same open file.  The threads (a workqueue) have their own
+// page tables, so they move data through a bounce page with
+// copyin() and copyout() on the process's page table.
+//
+// Because the threads write into the process's memory, a
+// process waits for its requests to finish before its memory
+// can change under them: in exit(), exec() and a shrinking
+// sbrk().  A request blocked forever (say, reading a pipe
+// nobody will write) therefore holds up those calls too.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "workqueue.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+#include "x86.h"
+#include "date.h"
+#include "upage.h"
+#include "aio.h"
+
+#define NAIOTHREAD 4
+
+struct aioreq {
+  struct aioctx *ctx;
+  struct aiosqe sqe;       // Copied out of the ring
+  struct file *f;          // Reference held until completion
+  struct work work;        // On aiowq
+  struct aioreq *next;     // On ctx->free
+  int busy;                // Submitted and not yet completed
+  uint seq;                // Order of submission
+};
+
+// Per-process state, in its own page.
+struct aioctx {
+  struct spinlock lock;
+  struct proc *proc;
+  struct aioring *ring;    // Kernel address of the UAIO page
+  uint sqhead;             // Private copies of the kernel's
+  uint cqtail;             //   ring indices
+  uint cqhead;             // Last cqhead seen from the process
+  int inflight;            // Requests not yet completed
+  uint nsubmit;            // Requests ever submitted
+  struct aioreq *free;
+  struct aioreq req[NAIOCQ];
+};
+
+struct workqueue aiowq;
+
+// Post a completion.  Caller must hold ctx->lock.
+static void
+aiopost(struct aioctx *ctx, uint tag, int ret)
+{
+  struct aiocqe *cqe;
+
+  cqe = &ctx->ring->cq[ctx->cqtail % NAIOCQ];
+  cqe->tag = tag;
+  cqe->ret = ret;
+  ctx->cqtail++;
+  ctx->ring->cqtail = ctx->cqtail;
+  wakeup(ctx);
+}
+
+// Wait until the requests submitted on the same open file
+// before r have completed.  filepwrite() commits its
+// transactions before returning, so they are then on disk.
+static int
+aiosync(struct aioreq *r)
+{
+  struct aioctx *ctx = r->ctx;
+  struct aioreq *q;
+
+  acquire(&ctx->lock);
+  for(q = ctx->req; q < &ctx->req[NAIOCQ]; ){
+    if(q->busy && q->f == r->f && (int)(r->seq - q->seq) > 0){
+      sleep(ctx, &ctx->lock);
+      q = ctx->req;
+    } else
+      q++;
+  }
+  release(&ctx->lock);
+  return 0;
+}
+
+// Carry out one request, in an I/O thread.
+static int
+aiodo(struct aioreq *r, char *buf)
+{
+  pde_t *pgdir = r->ctx->proc->pgdir;
+  uint addr = r->sqe.addr;
+  uint off = r->sqe.off;
+  int n, m, done;
+
+  if(r->sqe.op == AIO_FSYNC)
+    return aiosync(r);
+
+  for(done = 0; done < r->sqe.n; done += n){
+    m = r->sqe.n - done;
+    if(m > PGSIZE)
+      m = PGSIZE;
+    if(r->sqe.op == AIO_READ){
+      if((n = filepread(r->f, buf, m, off + done)) < 0)
+        return -1;
+      if(copyout(pgdir, addr + done, buf, n) < 0)
+        return -1;
+    } else {
+      if(copyin(pgdir, buf, addr + done, m) < 0)
+        return -1;
+      if((n = filepwrite(r->f, buf, m, off + done)) < 0)
+        return -1;
+    }
+    if(n < m)
+      return done + n;
+  }
+  return done;
+}
+
+// Work function for aiowq.
+static void
+aiorun(void *arg)
+{
+  struct aioreq *r = arg;
+  struct aioctx *ctx = r->ctx;
+  char *buf;
+  int ret;
+
+  ret = -1;
+  if((buf = kalloc()) != 0){
+    ret = aiodo(r, buf);
+    kfree(buf);
+  }
+  fileclose(r->f);
+
+  acquire(&ctx->lock);
+  aiopost(ctx, r->sqe.tag, ret);
+  r->busy = 0;
+  r->next = ctx->free;
+  ctx->free = r;
+  ctx->inflight--;
+  release(&ctx->lock);
+}
+
+void
+aioinit(void)
+{
+  wqinit(&aiowq, "aio", NAIOTHREAD);
+}
+
+// Give the current process a pair of rings at UAIO.
+int
+aiosetup(void)
+{
+  struct proc *curproc = myproc();
+  struct aioctx *ctx;
+  char *ring;
+  int i;
+
+  if(curproc->aio)
+    return -1;
+  if((ctx = (struct aioctx*)kalloc()) == 0)
+    return -1;
+  if((ring = kalloc()) == 0){
+    kfree((char*)ctx);
+    return -1;
+  }
+  memset(ctx, 0, sizeof(*ctx));
+  memset(ring, 0, PGSIZE);
+  // The page belongs to ctx, not the page table: aioexit() frees it.
+  if(mappages(curproc->pgdir, (char*)UAIO, PGSIZE, V2P(ring),
+              PTE_W|PTE_U|PTE_SHARED) < 0){
+    kfree(ring);
+    kfree((char*)ctx);
+    return -1;
+  }
+  initlock(&ctx->lock, "aio");
+  ctx->proc = curproc;
+  ctx->ring = (struct aioring*)ring;
+  for(i = 0; i < NAIOCQ; i++){
+    ctx->req[i].ctx = ctx;
+    ctx->req[i].work.fn = aiorun;
+    ctx->req[i].work.arg = &ctx->req[i];
+    ctx->req[i].next = ctx->free;
+    ctx->free = &ctx->req[i];
+  }
+  curproc->aio = ctx;
+  return UAIO;
+}
+
+// Number of completions the process has not consumed yet.
+// The process may write anything to ring->cqhead; a value that
+// does not lie between the last one seen and cqtail is ignored.
+// Caller must hold ctx->lock.
+static uint
+aiopending(struct aioctx *ctx)
+{
+  uint h;
+
+  h = ctx->ring->cqhead;
+  if(h - ctx->cqhead <= ctx->cqtail - ctx->cqhead)
+    ctx->cqhead = h;
+  return ctx->cqtail - ctx->cqhead;
+}
+
+// Check a submission against the process's memory.
+static int
+aiobad(struct proc *p, struct aiosqe *sqe)
+{
+  if(sqe->fd < 0 || sqe->fd >= NOFILE || p->ofile[sqe->fd] == 0)
+    return 1;
+  if(sqe->op == AIO_FSYNC)
+    return 0;
+  if(sqe->op != AIO_READ && sqe->op != AIO_WRITE)
+    return 1;
+  return sqe->n < 0 || sqe->addr >= p->sz || sqe->n > p->sz - sqe->addr;
+}
+
+// Submit everything new in the submission ring, then wait
+// until at least min completions are waiting to be consumed,
+// or no more can arrive.  Returns the number waiting.
+int
+aiowait(int min)
+{
+  struct proc *curproc = myproc();
+  struct aioctx *ctx = curproc->aio;
+  struct aioring *ring;
+  struct aioreq *r;
+  int n;
+
+  if(ctx == 0)
+    return -1;
+  ring = ctx->ring;
+  acquire(&ctx->lock);
+  while(ctx->sqhead != ring->sqtail && ctx->free != 0 &&
+        ctx->inflight + aiopending(ctx) < NAIOCQ){
+    r = ctx->free;
+    r->sqe = ring->sq[ctx->sqhead % NAIOSQ];
+    ctx->sqhead++;
+    ring->sqhead = ctx->sqhead;
+
+    if(aiobad(curproc, &r->sqe)){
+      aiopost(ctx, r->sqe.tag, -1);
+      continue;
+    }
+    ctx->free = r->next;
+    ctx->inflight++;
+    r->busy = 1;
+    r->seq = ctx->nsubmit++;
+    r->f = filedup(curproc->ofile[r->sqe.fd]);
+    queuework(&aiowq, &r->work);
+  }
+
+  while((n = aiopending(ctx)) < min && ctx->inflight > 0){
+    if(curproc->killed){
+      release(&ctx->lock);
+      return -1;
+    }
+    sleep(ctx, &ctx->lock);
+  }
+  release(&ctx->lock);
+  return n;
+}
+
+// Wait for the current process's requests to finish.
+void
+aiodrain(void)
+{
+  struct aioctx *ctx = myproc()->aio;
+
+  if(ctx == 0)
+    return;
+  acquire(&ctx->lock);
+  while(ctx->inflight > 0)
+    sleep(ctx, &ctx->lock);
+  release(&ctx->lock);
+}
+
+// Tear down the current process's rings, in exit() or
+// once exec() has replaced the page table that mapped them.
+void
+aioexit(void)
+{
+  struct proc *curproc = myproc();
+  struct aioctx *ctx = curproc->aio;
+
+  if(ctx == 0)
+    return;
+  aiodrain();
+  curproc->aio = 0;
+  freelock(&ctx->lock);
+  kfree((char*)ctx->ring);
+  kfree((char*)ctx);
+}
@@ -0,0 +1,37 @@
+// Asynchronous I/O rings, shared between a process and the
+// kernel in the page that aiosetup() maps at UAIO.
+//
+// The process fills sq[sqtail % NAIOSQ] and bumps sqtail; the
+// next aiowait() hands every new entry to the kernel's I/O
+// threads.  Each finished request adds an entry at cqtail,
+// which the process consumes by advancing cqhead.
+
+#define NAIOSQ  64   // submission ring entries
+#define NAIOCQ  64   // completion ring entries; also max in flight
+
+#define AIO_READ   1
+#define AIO_WRITE  2
+#define AIO_FSYNC  3
+
+struct aiosqe {
+  int op;         // AIO_READ, AIO_WRITE or AIO_FSYNC
+  int fd;         // File descriptor
+  uint addr;      // User buffer
+  int n;          // Bytes to transfer
+  uint off;       // File offset; the file's own offset is left alone
+  uint tag;       // Copied to the completion
+};
+
+struct aiocqe {
+  uint tag;       // From the submission
+  int ret;        // What read/write/fsync would have returned
+};
+
+struct aioring {
+  volatile uint sqhead;   // Written by the kernel
+  volatile uint sqtail;   // Written by the process
+  volatile uint cqhead;   // Written by the process
+  volatile uint cqtail;   // Written by the kernel
+  struct aiosqe sq[NAIOSQ];
+  struct aiocqe cq[NAIOCQ];
+};
@@ -0,0 +1,1920 @@
+
+_aiotest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fcntl.h"
+#include "aio.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 30             	sub    $0x30,%esp
+  struct aioring *r;
+  struct aiosqe *sqe;
+  static char wbuf[4][512], rbuf[4][512];
+  int fd, i, j, n, got, total, nwrite;
+
+  printf(1, "aio test\n");
+  14:	68 28 0e 00 00       	push   $0xe28
+  19:	6a 01                	push   $0x1
+  1b:	e8 e0 0a 00 00       	call   b00 <printf>
+  if((r = aiosetup()) == (struct aioring*)-1){
+  20:	e8 53 09 00 00       	call   978 <aiosetup>
+  25:	83 c4 10             	add    $0x10,%esp
+  28:	83 f8 ff             	cmp    $0xffffffff,%eax
+  2b:	0f 84 ce 00 00 00    	je     ff <main+0xff>
+  31:	89 c7                	mov    %eax,%edi
+    printf(1, "aiosetup failed\n");
+    exit();
+  }
+  if(aiosetup() != (struct aioring*)-1){
+  33:	e8 40 09 00 00       	call   978 <aiosetup>
+  38:	83 f8 ff             	cmp    $0xffffffff,%eax
+  3b:	74 13                	je     50 <main+0x50>
+    printf(1, "second aiosetup succeeded\n");
+  3d:	50                   	push   %eax
+  3e:	50                   	push   %eax
+  3f:	68 43 0e 00 00       	push   $0xe43
+  44:	6a 01                	push   $0x1
+  46:	e8 b5 0a 00 00       	call   b00 <printf>
+    exit();
+  4b:	e8 19 06 00 00       	call   669 <exit>
+  }
+  fd = open("aiofile", O_CREATE|O_RDWR);
+  50:	50                   	push   %eax
+  51:	50                   	push   %eax
+  52:	68 02 02 00 00       	push   $0x202
+  57:	68 5e 0e 00 00       	push   $0xe5e
+  5c:	e8 f0 06 00 00       	call   751 <open>
+  if(fd < 0){
+  61:	83 c4 10             	add    $0x10,%esp
+  fd = open("aiofile", O_CREATE|O_RDWR);
+  64:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+  67:	85 c0                	test   %eax,%eax
+  69:	0f 88 a3 00 00 00    	js     112 <main+0x112>
+  6f:	bb c0 1a 00 00       	mov    $0x1ac0,%ebx
+  74:	be 61 00 00 00       	mov    $0x61,%esi
+    exit();
+  }
+  // Writes of blocks 0-3, one to a bad fd (tag 4), then
+  // an fsync (tag 5) that must wait for the writes.
+  for(i = 0; i < 4; i++)
+    memset(wbuf[i], 'a' + i, 512);
+  79:	50                   	push   %eax
+  7a:	68 00 02 00 00       	push   $0x200
+  7f:	56                   	push   %esi
+  for(i = 0; i < 4; i++)
+  80:	83 c6 01             	add    $0x1,%esi
+    memset(wbuf[i], 'a' + i, 512);
+  83:	53                   	push   %ebx
+  for(i = 0; i < 4; i++)
+  84:	81 c3 00 02 00 00    	add    $0x200,%ebx
+    memset(wbuf[i], 'a' + i, 512);
+  8a:	e8 a1 03 00 00       	call   430 <memset>
+  for(i = 0; i < 4; i++)
+  8f:	83 c4 10             	add    $0x10,%esp
+  92:	83 fe 65             	cmp    $0x65,%esi
+  95:	75 e2                	jne    79 <main+0x79>
+  for(i = 0; i < 6; i++){
+  97:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  9a:	31 d2                	xor    %edx,%edx
+  9c:	eb 4d                	jmp    eb <main+0xeb>
+  9e:	66 90                	xchg   %ax,%ax
+    sqe = &r->sq[r->sqtail % NAIOSQ];
+    sqe->op = i < 5 ? AIO_WRITE : AIO_FSYNC;
+    sqe->fd = i != 4 ? fd : 99;
+  a0:	83 fa 04             	cmp    $0x4,%edx
+  a3:	b9 63 00 00 00       	mov    $0x63,%ecx
+  a8:	be 02 00 00 00       	mov    $0x2,%esi
+  ad:	0f 45 cb             	cmovne %ebx,%ecx
+    sqe->op = i < 5 ? AIO_WRITE : AIO_FSYNC;
+  b0:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  b3:	8d 04 c7             	lea    (%edi,%eax,8),%eax
+    sqe->fd = i != 4 ? fd : 99;
+  b6:	89 48 14             	mov    %ecx,0x14(%eax)
+    sqe->addr = (uint)wbuf[i%4];
+  b9:	89 d1                	mov    %edx,%ecx
+  bb:	83 e1 03             	and    $0x3,%ecx
+    sqe->op = i < 5 ? AIO_WRITE : AIO_FSYNC;
+  be:	89 70 10             	mov    %esi,0x10(%eax)
+  c1:	c1 e1 09             	shl    $0x9,%ecx
+    sqe->n = 512;
+    sqe->off = (i%4) * 512;
+    sqe->tag = i;
+  c4:	89 50 24             	mov    %edx,0x24(%eax)
+  for(i = 0; i < 6; i++){
+  c7:	83 c2 01             	add    $0x1,%edx
+    sqe->addr = (uint)wbuf[i%4];
+  ca:	8d b1 c0 1a 00 00    	lea    0x1ac0(%ecx),%esi
+    sqe->n = 512;
+  d0:	c7 40 1c 00 02 00 00 	movl   $0x200,0x1c(%eax)
+    sqe->addr = (uint)wbuf[i%4];
+  d7:	89 70 18             	mov    %esi,0x18(%eax)
+    sqe->off = (i%4) * 512;
+  da:	89 48 20             	mov    %ecx,0x20(%eax)
+    r->sqtail++;
+  dd:	8b 47 04             	mov    0x4(%edi),%eax
+  e0:	83 c0 01             	add    $0x1,%eax
+  e3:	89 47 04             	mov    %eax,0x4(%edi)
+  for(i = 0; i < 6; i++){
+  e6:	83 fa 06             	cmp    $0x6,%edx
+  e9:	74 3a                	je     125 <main+0x125>
+    sqe = &r->sq[r->sqtail % NAIOSQ];
+  eb:	8b 47 04             	mov    0x4(%edi),%eax
+  ee:	83 e0 3f             	and    $0x3f,%eax
+    sqe->op = i < 5 ? AIO_WRITE : AIO_FSYNC;
+  f1:	83 fa 05             	cmp    $0x5,%edx
+  f4:	75 aa                	jne    a0 <main+0xa0>
+  f6:	89 d9                	mov    %ebx,%ecx
+  f8:	be 03 00 00 00       	mov    $0x3,%esi
+  fd:	eb b1                	jmp    b0 <main+0xb0>
+    printf(1, "aiosetup failed\n");
+  ff:	50                   	push   %eax
+ 100:	50                   	push   %eax
+ 101:	68 32 0e 00 00       	push   $0xe32
+ 106:	6a 01                	push   $0x1
+ 108:	e8 f3 09 00 00       	call   b00 <printf>
+    exit();
+ 10d:	e8 57 05 00 00       	call   669 <exit>
+    printf(1, "aio test: create failed\n");
+ 112:	50                   	push   %eax
+ 113:	50                   	push   %eax
+ 114:	68 66 0e 00 00       	push   $0xe66
+ 119:	6a 01                	push   $0x1
+ 11b:	e8 e0 09 00 00       	call   b00 <printf>
+    exit();
+ 120:	e8 44 05 00 00       	call   669 <exit>
+  }
+  total = 0;
+ 125:	31 f6                	xor    %esi,%esi
+ 127:	89 75 dc             	mov    %esi,-0x24(%ebp)
+ 12a:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  nwrite = 0;
+  for(got = 0; got < 6; got += n){
+ 12d:	31 f6                	xor    %esi,%esi
+    n = aiowait(1);
+ 12f:	83 ec 0c             	sub    $0xc,%esp
+ 132:	6a 01                	push   $0x1
+ 134:	e8 5c 08 00 00       	call   995 <aiowait>
+    for(j = 0; j < n; j++){
+ 139:	83 c4 10             	add    $0x10,%esp
+    n = aiowait(1);
+ 13c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    for(j = 0; j < n; j++){
+ 13f:	85 c0                	test   %eax,%eax
+ 141:	0f 8e b6 00 00 00    	jle    1fd <main+0x1fd>
+ 147:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 14a:	31 c0                	xor    %eax,%eax
+ 14c:	eb 19                	jmp    167 <main+0x167>
+ 14e:	66 90                	xchg   %ax,%ax
+      }
+      if(cqe->tag == 5 && nwrite != 4){
+        printf(1, "aio fsync finished before the writes\n");
+        exit();
+      }
+      if(cqe->tag < 4){
+ 150:	83 fa 03             	cmp    $0x3,%edx
+ 153:	77 0a                	ja     15f <main+0x15f>
+        nwrite++;
+        total += cqe->ret;
+ 155:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+        nwrite++;
+ 158:	83 45 dc 01          	addl   $0x1,-0x24(%ebp)
+        total += cqe->ret;
+ 15c:	01 75 d8             	add    %esi,-0x28(%ebp)
+    for(j = 0; j < n; j++){
+ 15f:	83 c0 01             	add    $0x1,%eax
+ 162:	39 45 e0             	cmp    %eax,-0x20(%ebp)
+ 165:	74 60                	je     1c7 <main+0x1c7>
+      struct aiocqe *cqe = &r->cq[(r->cqhead + j) % NAIOCQ];
+ 167:	8b 4f 08             	mov    0x8(%edi),%ecx
+ 16a:	01 c1                	add    %eax,%ecx
+ 16c:	83 e1 3f             	and    $0x3f,%ecx
+      if((cqe->tag == 4) != (cqe->ret == -1)){
+ 16f:	81 c1 c2 00 00 00    	add    $0xc2,%ecx
+ 175:	8b 14 cf             	mov    (%edi,%ecx,8),%edx
+ 178:	8b 4c cf 04          	mov    0x4(%edi,%ecx,8),%ecx
+ 17c:	83 fa 04             	cmp    $0x4,%edx
+ 17f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 182:	0f 94 c3             	sete   %bl
+ 185:	83 f9 ff             	cmp    $0xffffffff,%ecx
+ 188:	89 de                	mov    %ebx,%esi
+ 18a:	0f 94 c3             	sete   %bl
+ 18d:	89 f1                	mov    %esi,%ecx
+ 18f:	38 d9                	cmp    %bl,%cl
+ 191:	75 1e                	jne    1b1 <main+0x1b1>
+      if(cqe->tag == 5 && nwrite != 4){
+ 193:	83 fa 05             	cmp    $0x5,%edx
+ 196:	75 b8                	jne    150 <main+0x150>
+ 198:	83 7d dc 04          	cmpl   $0x4,-0x24(%ebp)
+ 19c:	74 c1                	je     15f <main+0x15f>
+        printf(1, "aio fsync finished before the writes\n");
+ 19e:	53                   	push   %ebx
+ 19f:	53                   	push   %ebx
+ 1a0:	68 04 0f 00 00       	push   $0xf04
+ 1a5:	6a 01                	push   $0x1
+ 1a7:	e8 54 09 00 00       	call   b00 <printf>
+        exit();
+ 1ac:	e8 b8 04 00 00       	call   669 <exit>
+        printf(1, "aio write %d returned %d\n", cqe->tag, cqe->ret);
+ 1b1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 1b4:	51                   	push   %ecx
+ 1b5:	52                   	push   %edx
+ 1b6:	68 7f 0e 00 00       	push   $0xe7f
+ 1bb:	6a 01                	push   $0x1
+ 1bd:	e8 3e 09 00 00       	call   b00 <printf>
+        exit();
+ 1c2:	e8 a2 04 00 00       	call   669 <exit>
+      }
+    }
+    r->cqhead += n;
+ 1c7:	8b 47 08             	mov    0x8(%edi),%eax
+ 1ca:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+ 1cd:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 1d0:	01 d8                	add    %ebx,%eax
+  for(got = 0; got < 6; got += n){
+ 1d2:	01 de                	add    %ebx,%esi
+    r->cqhead += n;
+ 1d4:	89 47 08             	mov    %eax,0x8(%edi)
+  for(got = 0; got < 6; got += n){
+ 1d7:	83 fe 05             	cmp    $0x5,%esi
+ 1da:	0f 8e 4f ff ff ff    	jle    12f <main+0x12f>
+  }
+  if(total != sizeof(wbuf)){
+ 1e0:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 1e3:	3d 00 08 00 00       	cmp    $0x800,%eax
+ 1e8:	74 25                	je     20f <main+0x20f>
+    printf(1, "aio wrote %d bytes\n", total);
+ 1ea:	51                   	push   %ecx
+ 1eb:	50                   	push   %eax
+ 1ec:	68 99 0e 00 00       	push   $0xe99
+ 1f1:	6a 01                	push   $0x1
+ 1f3:	e8 08 09 00 00       	call   b00 <printf>
+    exit();
+ 1f8:	e8 6c 04 00 00       	call   669 <exit>
+    r->cqhead += n;
+ 1fd:	8b 47 08             	mov    0x8(%edi),%eax
+ 200:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+ 203:	01 d8                	add    %ebx,%eax
+  for(got = 0; got < 6; got += n){
+ 205:	01 de                	add    %ebx,%esi
+    r->cqhead += n;
+ 207:	89 47 08             	mov    %eax,0x8(%edi)
+  for(got = 0; got < 6; got += n){
+ 20a:	e9 20 ff ff ff       	jmp    12f <main+0x12f>
+  }
+  close(fd);
+ 20f:	83 ec 0c             	sub    $0xc,%esp
+ 212:	ff 75 d0             	push   -0x30(%ebp)
+ 215:	e8 e0 04 00 00       	call   6fa <close>
+
+  // Read the blocks back, last first.
+  fd = open("aiofile", O_RDONLY);
+ 21a:	58                   	pop    %eax
+ 21b:	5a                   	pop    %edx
+ 21c:	6a 00                	push   $0x0
+ 21e:	68 5e 0e 00 00       	push   $0xe5e
+ 223:	e8 29 05 00 00       	call   751 <open>
+ 228:	83 c4 10             	add    $0x10,%esp
+  for(i = 3; i >= 0; i--){
+ 22b:	ba 03 00 00 00       	mov    $0x3,%edx
+  fd = open("aiofile", O_RDONLY);
+ 230:	89 c3                	mov    %eax,%ebx
+    sqe = &r->sq[r->sqtail % NAIOSQ];
+ 232:	8b 47 04             	mov    0x4(%edi),%eax
+ 235:	89 d1                	mov    %edx,%ecx
+ 237:	c1 e1 09             	shl    $0x9,%ecx
+ 23a:	83 e0 3f             	and    $0x3f,%eax
+    sqe->op = AIO_READ;
+    sqe->fd = fd;
+    sqe->addr = (uint)rbuf[i];
+ 23d:	8d b1 c0 12 00 00    	lea    0x12c0(%ecx),%esi
+    sqe->op = AIO_READ;
+ 243:	6b c0 18             	imul   $0x18,%eax,%eax
+ 246:	01 f8                	add    %edi,%eax
+ 248:	c7 40 10 01 00 00 00 	movl   $0x1,0x10(%eax)
+    sqe->fd = fd;
+ 24f:	89 58 14             	mov    %ebx,0x14(%eax)
+    sqe->addr = (uint)rbuf[i];
+ 252:	89 70 18             	mov    %esi,0x18(%eax)
+    sqe->n = 512;
+ 255:	c7 40 1c 00 02 00 00 	movl   $0x200,0x1c(%eax)
+    sqe->off = i * 512;
+ 25c:	89 48 20             	mov    %ecx,0x20(%eax)
+    sqe->tag = i;
+ 25f:	89 50 24             	mov    %edx,0x24(%eax)
+    r->sqtail++;
+ 262:	8b 47 04             	mov    0x4(%edi),%eax
+ 265:	83 c0 01             	add    $0x1,%eax
+ 268:	89 47 04             	mov    %eax,0x4(%edi)
+  for(i = 3; i >= 0; i--){
+ 26b:	83 ea 01             	sub    $0x1,%edx
+ 26e:	73 c2                	jae    232 <main+0x232>
+  }
+  if(aiowait(4) != 4){
+ 270:	83 ec 0c             	sub    $0xc,%esp
+ 273:	6a 04                	push   $0x4
+ 275:	e8 1b 07 00 00       	call   995 <aiowait>
+ 27a:	83 c4 10             	add    $0x10,%esp
+    printf(1, "aiowait(4) came back early\n");
+    exit();
+  }
+  for(j = 0; j < 4; j++)
+ 27d:	31 d2                	xor    %edx,%edx
+  if(aiowait(4) != 4){
+ 27f:	83 f8 04             	cmp    $0x4,%eax
+ 282:	74 13                	je     297 <main+0x297>
+    printf(1, "aiowait(4) came back early\n");
+ 284:	50                   	push   %eax
+ 285:	50                   	push   %eax
+ 286:	68 ad 0e 00 00       	push   $0xead
+ 28b:	6a 01                	push   $0x1
+ 28d:	e8 6e 08 00 00       	call   b00 <printf>
+    exit();
+ 292:	e8 d2 03 00 00       	call   669 <exit>
+    if(r->cq[(r->cqhead + j) % NAIOCQ].ret != 512){
+ 297:	8b 47 08             	mov    0x8(%edi),%eax
+ 29a:	01 d0                	add    %edx,%eax
+ 29c:	83 e0 3f             	and    $0x3f,%eax
+ 29f:	81 bc c7 14 06 00 00 	cmpl   $0x200,0x614(%edi,%eax,8)
+ 2a6:	00 02 00 00 
+ 2aa:	75 45                	jne    2f1 <main+0x2f1>
+  for(j = 0; j < 4; j++)
+ 2ac:	83 c2 01             	add    $0x1,%edx
+ 2af:	83 fa 04             	cmp    $0x4,%edx
+ 2b2:	75 e3                	jne    297 <main+0x297>
+      printf(1, "aio read short\n");
+      exit();
+    }
+  r->cqhead += 4;
+ 2b4:	8b 47 08             	mov    0x8(%edi),%eax
+ 2b7:	83 c0 04             	add    $0x4,%eax
+ 2ba:	89 47 08             	mov    %eax,0x8(%edi)
+  for(i = 0; i < sizeof(rbuf); i++)
+ 2bd:	31 c0                	xor    %eax,%eax
+ 2bf:	eb 0a                	jmp    2cb <main+0x2cb>
+ 2c1:	83 c0 01             	add    $0x1,%eax
+ 2c4:	3d 00 08 00 00       	cmp    $0x800,%eax
+ 2c9:	74 39                	je     304 <main+0x304>
+    if(rbuf[i/512][i%512] != 'a' + i/512){
+ 2cb:	89 c2                	mov    %eax,%edx
+ 2cd:	0f be b0 c0 12 00 00 	movsbl 0x12c0(%eax),%esi
+ 2d4:	c1 fa 09             	sar    $0x9,%edx
+ 2d7:	8d 4a 61             	lea    0x61(%edx),%ecx
+ 2da:	39 ce                	cmp    %ecx,%esi
+ 2dc:	74 e3                	je     2c1 <main+0x2c1>
+      printf(1, "aio read wrong data in block %d\n", i/512);
+ 2de:	57                   	push   %edi
+ 2df:	52                   	push   %edx
+ 2e0:	68 2c 0f 00 00       	push   $0xf2c
+ 2e5:	6a 01                	push   $0x1
+ 2e7:	e8 14 08 00 00       	call   b00 <printf>
+      exit();
+ 2ec:	e8 78 03 00 00       	call   669 <exit>
+      printf(1, "aio read short\n");
+ 2f1:	50                   	push   %eax
+ 2f2:	50                   	push   %eax
+ 2f3:	68 c9 0e 00 00       	push   $0xec9
+ 2f8:	6a 01                	push   $0x1
+ 2fa:	e8 01 08 00 00       	call   b00 <printf>
+      exit();
+ 2ff:	e8 65 03 00 00       	call   669 <exit>
+    }
+
+  // The requests must not have moved the file's own offset.
+  if(read(fd, rbuf[1], 512) != 512 || rbuf[1][0] != 'a'){
+ 304:	56                   	push   %esi
+ 305:	68 00 02 00 00       	push   $0x200
+ 30a:	68 c0 14 00 00       	push   $0x14c0
+ 30f:	53                   	push   %ebx
+ 310:	e8 ab 03 00 00       	call   6c0 <read>
+ 315:	83 c4 10             	add    $0x10,%esp
+ 318:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 31d:	75 09                	jne    328 <main+0x328>
+ 31f:	80 3d c0 14 00 00 61 	cmpb   $0x61,0x14c0
+ 326:	74 13                	je     33b <main+0x33b>
+    printf(1, "aio moved the file offset\n");
+ 328:	51                   	push   %ecx
+ 329:	51                   	push   %ecx
+ 32a:	68 d9 0e 00 00       	push   $0xed9
+ 32f:	6a 01                	push   $0x1
+ 331:	e8 ca 07 00 00       	call   b00 <printf>
+    exit();
+ 336:	e8 2e 03 00 00       	call   669 <exit>
+  }
+  close(fd);
+ 33b:	83 ec 0c             	sub    $0xc,%esp
+ 33e:	53                   	push   %ebx
+ 33f:	e8 b6 03 00 00       	call   6fa <close>
+  unlink("aiofile");
+ 344:	c7 04 24 5e 0e 00 00 	movl   $0xe5e,(%esp)
+ 34b:	e8 3b 04 00 00       	call   78b <unlink>
+  printf(1, "aio test OK\n");
+ 350:	58                   	pop    %eax
+ 351:	5a                   	pop    %edx
+ 352:	68 f4 0e 00 00       	push   $0xef4
+ 357:	6a 01                	push   $0x1
+ 359:	e8 a2 07 00 00       	call   b00 <printf>
+  exit();
+ 35e:	e8 06 03 00 00       	call   669 <exit>
+ 363:	66 90                	xchg   %ax,%ax
+ 365:	66 90                	xchg   %ax,%ax
+ 367:	66 90                	xchg   %ax,%ax
+ 369:	66 90                	xchg   %ax,%ax
+ 36b:	66 90                	xchg   %ax,%ax
+ 36d:	66 90                	xchg   %ax,%ax
+ 36f:	90                   	nop
+
+00000370 <strcpy>:
+#include "date.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 370:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 371:	31 c0                	xor    %eax,%eax
+{
+ 373:	89 e5                	mov    %esp,%ebp
+ 375:	53                   	push   %ebx
+ 376:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 379:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 37c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 380:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 384:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 387:	83 c0 01             	add    $0x1,%eax
+ 38a:	84 d2                	test   %dl,%dl
+ 38c:	75 f2                	jne    380 <strcpy+0x10>
+    ;
+  return os;
+}
+ 38e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 391:	89 c8                	mov    %ecx,%eax
+ 393:	c9                   	leave
+ 394:	c3                   	ret
+ 395:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	53                   	push   %ebx
+ 3a4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 3aa:	0f b6 02             	movzbl (%edx),%eax
+ 3ad:	84 c0                	test   %al,%al
+ 3af:	75 17                	jne    3c8 <strcmp+0x28>
+ 3b1:	eb 3a                	jmp    3ed <strcmp+0x4d>
+ 3b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3b7:	90                   	nop
+ 3b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 3bc:	83 c2 01             	add    $0x1,%edx
+ 3bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 3c2:	84 c0                	test   %al,%al
+ 3c4:	74 1a                	je     3e0 <strcmp+0x40>
+    p++, q++;
+ 3c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 3c8:	0f b6 19             	movzbl (%ecx),%ebx
+ 3cb:	38 c3                	cmp    %al,%bl
+ 3cd:	74 e9                	je     3b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 3cf:	29 d8                	sub    %ebx,%eax
+}
+ 3d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3d4:	c9                   	leave
+ 3d5:	c3                   	ret
+ 3d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 3e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 3e4:	31 c0                	xor    %eax,%eax
+ 3e6:	29 d8                	sub    %ebx,%eax
+}
+ 3e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3eb:	c9                   	leave
+ 3ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 3ed:	0f b6 19             	movzbl (%ecx),%ebx
+ 3f0:	31 c0                	xor    %eax,%eax
+ 3f2:	eb db                	jmp    3cf <strcmp+0x2f>
+ 3f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ff:	90                   	nop
+
+00000400 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 406:	80 3a 00             	cmpb   $0x0,(%edx)
+ 409:	74 15                	je     420 <strlen+0x20>
+ 40b:	31 c0                	xor    %eax,%eax
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+ 410:	83 c0 01             	add    $0x1,%eax
+ 413:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 417:	89 c1                	mov    %eax,%ecx
+ 419:	75 f5                	jne    410 <strlen+0x10>
+    ;
+  return n;
+}
+ 41b:	89 c8                	mov    %ecx,%eax
+ 41d:	5d                   	pop    %ebp
+ 41e:	c3                   	ret
+ 41f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 420:	31 c9                	xor    %ecx,%ecx
+}
+ 422:	5d                   	pop    %ebp
+ 423:	89 c8                	mov    %ecx,%eax
+ 425:	c3                   	ret
+ 426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000430 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	57                   	push   %edi
+ 434:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 437:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 43a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 43d:	89 d7                	mov    %edx,%edi
+ 43f:	fc                   	cld
+ 440:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 442:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 445:	89 d0                	mov    %edx,%eax
+ 447:	c9                   	leave
+ 448:	c3                   	ret
+ 449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000450 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	8b 45 08             	mov    0x8(%ebp),%eax
+ 456:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 45a:	0f b6 10             	movzbl (%eax),%edx
+ 45d:	84 d2                	test   %dl,%dl
+ 45f:	75 12                	jne    473 <strchr+0x23>
+ 461:	eb 1d                	jmp    480 <strchr+0x30>
+ 463:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 467:	90                   	nop
+ 468:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 46c:	83 c0 01             	add    $0x1,%eax
+ 46f:	84 d2                	test   %dl,%dl
+ 471:	74 0d                	je     480 <strchr+0x30>
+    if(*s == c)
+ 473:	38 d1                	cmp    %dl,%cl
+ 475:	75 f1                	jne    468 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 477:	5d                   	pop    %ebp
+ 478:	c3                   	ret
+ 479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 480:	31 c0                	xor    %eax,%eax
+}
+ 482:	5d                   	pop    %ebp
+ 483:	c3                   	ret
+ 484:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 48f:	90                   	nop
+
+00000490 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 495:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 498:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 499:	31 db                	xor    %ebx,%ebx
+{
+ 49b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 49e:	eb 27                	jmp    4c7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 4a0:	83 ec 04             	sub    $0x4,%esp
+ 4a3:	6a 01                	push   $0x1
+ 4a5:	56                   	push   %esi
+ 4a6:	6a 00                	push   $0x0
+ 4a8:	e8 13 02 00 00       	call   6c0 <read>
+    if(cc < 1)
+ 4ad:	83 c4 10             	add    $0x10,%esp
+ 4b0:	85 c0                	test   %eax,%eax
+ 4b2:	7e 1d                	jle    4d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 4b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 4b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 4bf:	3c 0a                	cmp    $0xa,%al
+ 4c1:	74 10                	je     4d3 <gets+0x43>
+ 4c3:	3c 0d                	cmp    $0xd,%al
+ 4c5:	74 0c                	je     4d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 4c7:	89 df                	mov    %ebx,%edi
+ 4c9:	83 c3 01             	add    $0x1,%ebx
+ 4cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 4cf:	7c cf                	jl     4a0 <gets+0x10>
+ 4d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 4d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 4da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4dd:	5b                   	pop    %ebx
+ 4de:	5e                   	pop    %esi
+ 4df:	5f                   	pop    %edi
+ 4e0:	5d                   	pop    %ebp
+ 4e1:	c3                   	ret
+ 4e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	56                   	push   %esi
+ 4f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4f5:	83 ec 08             	sub    $0x8,%esp
+ 4f8:	6a 00                	push   $0x0
+ 4fa:	ff 75 08             	push   0x8(%ebp)
+ 4fd:	e8 4f 02 00 00       	call   751 <open>
+  if(fd < 0)
+ 502:	83 c4 10             	add    $0x10,%esp
+ 505:	85 c0                	test   %eax,%eax
+ 507:	78 27                	js     530 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 509:	83 ec 08             	sub    $0x8,%esp
+ 50c:	ff 75 0c             	push   0xc(%ebp)
+ 50f:	89 c3                	mov    %eax,%ebx
+ 511:	50                   	push   %eax
+ 512:	e8 91 02 00 00       	call   7a8 <fstat>
+  close(fd);
+ 517:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 51a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 51c:	e8 d9 01 00 00       	call   6fa <close>
+  return r;
+ 521:	83 c4 10             	add    $0x10,%esp
+}
+ 524:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 527:	89 f0                	mov    %esi,%eax
+ 529:	5b                   	pop    %ebx
+ 52a:	5e                   	pop    %esi
+ 52b:	5d                   	pop    %ebp
+ 52c:	c3                   	ret
+ 52d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 530:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 535:	eb ed                	jmp    524 <stat+0x34>
+ 537:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53e:	66 90                	xchg   %ax,%ax
+
+00000540 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	53                   	push   %ebx
+ 544:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 547:	0f be 02             	movsbl (%edx),%eax
+ 54a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 54d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 550:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 555:	77 1e                	ja     575 <atoi+0x35>
+ 557:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 560:	83 c2 01             	add    $0x1,%edx
+ 563:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 566:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 56a:	0f be 02             	movsbl (%edx),%eax
+ 56d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 570:	80 fb 09             	cmp    $0x9,%bl
+ 573:	76 eb                	jbe    560 <atoi+0x20>
+  return n;
+}
+ 575:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 578:	89 c8                	mov    %ecx,%eax
+ 57a:	c9                   	leave
+ 57b:	c3                   	ret
+ 57c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000580 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	57                   	push   %edi
+ 584:	56                   	push   %esi
+ 585:	8b 45 10             	mov    0x10(%ebp),%eax
+ 588:	8b 55 08             	mov    0x8(%ebp),%edx
+ 58b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 58e:	85 c0                	test   %eax,%eax
+ 590:	7e 13                	jle    5a5 <memmove+0x25>
+ 592:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 594:	89 d7                	mov    %edx,%edi
+ 596:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 5a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 5a1:	39 f8                	cmp    %edi,%eax
+ 5a3:	75 fb                	jne    5a0 <memmove+0x20>
+  return vdst;
+}
+ 5a5:	5e                   	pop    %esi
+ 5a6:	89 d0                	mov    %edx,%eax
+ 5a8:	5f                   	pop    %edi
+ 5a9:	5d                   	pop    %ebp
+ 5aa:	c3                   	ret
+ 5ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5af:	90                   	nop
+
+000005b0 <ugetpid>:
+// getpid() without a system call, from the page at UPROC.
+int
+ugetpid(void)
+{
+  return ((struct uproc*)UPROC)->pid;
+}
+ 5b0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+ 5b5:	c3                   	ret
+ 5b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005c0 <uclocktime>:
+
+// clocktime() without a system call, from the page at UCLOCK.
+int
+uclocktime(struct timespec *ts)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	57                   	push   %edi
+ 5c4:	56                   	push   %esi
+ 5c5:	53                   	push   %ebx
+ 5c6:	83 ec 1c             	sub    $0x1c,%esp
+  struct uclock *c = (struct uclock*)UCLOCK;
+
+  if(c->tscmult == 0)
+ 5c9:	8b 0d 08 f0 ff 7f    	mov    0x7ffff008,%ecx
+{
+ 5cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(c->tscmult == 0)
+ 5d2:	85 c9                	test   %ecx,%ecx
+ 5d4:	74 6a                	je     640 <uclocktime+0x80>
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+ 5d6:	0f 31                	rdtsc
+static inline void
+uclockread(struct uclock *c, uint64 tsc, struct timespec *ts)
+{
+  uint64 d, ns;
+
+  d = tsc - c->tscbase;
+ 5d8:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 5de:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+ 5e4:	89 c6                	mov    %eax,%esi
+  if((long long)d < 0)  // another CPU's TSC is a little behind
+ 5e6:	85 d2                	test   %edx,%edx
+ 5e8:	78 46                	js     630 <uclocktime+0x70>
+    d = 0;
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 5ea:	89 d0                	mov    %edx,%eax
+ 5ec:	f7 e1                	mul    %ecx
+ 5ee:	0f a4 c2 08          	shld   $0x8,%eax,%edx
+ 5f2:	c1 e0 08             	shl    $0x8,%eax
+ 5f5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+ 5f8:	89 f0                	mov    %esi,%eax
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 5fa:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+ 5fd:	f7 e1                	mul    %ecx
+ 5ff:	0f ac d0 18          	shrd   $0x18,%edx,%eax
+ 603:	c1 ea 18             	shr    $0x18,%edx
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 606:	03 45 e0             	add    -0x20(%ebp),%eax
+ 609:	13 55 e4             	adc    -0x1c(%ebp),%edx
+// linked with libgcc, so it cannot use 64-bit '/' or '%'.
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+  asm("divl %4" : "=a" (q), "=d" (r) : "a" ((uint)n), "d" ((uint)(n>>32)), "rm" (d));
+ 60c:	89 c7                	mov    %eax,%edi
+ 60e:	89 f8                	mov    %edi,%eax
+ 610:	b9 00 ca 9a 3b       	mov    $0x3b9aca00,%ecx
+ 615:	f7 f1                	div    %ecx
+  ts->sec = divl(ns, 1000000000, &ts->nsec);
+ 617:	89 03                	mov    %eax,(%ebx)
+    return clocktime(ts);
+  uclockread(c, rdtsc(), ts);
+  return 0;
+}
+ 619:	31 c0                	xor    %eax,%eax
+  *rem = r;
+ 61b:	89 53 04             	mov    %edx,0x4(%ebx)
+ 61e:	83 c4 1c             	add    $0x1c,%esp
+ 621:	5b                   	pop    %ebx
+ 622:	5e                   	pop    %esi
+ 623:	5f                   	pop    %edi
+ 624:	5d                   	pop    %ebp
+ 625:	c3                   	ret
+ 626:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 62d:	8d 76 00             	lea    0x0(%esi),%esi
+ 630:	31 d2                	xor    %edx,%edx
+ 632:	31 ff                	xor    %edi,%edi
+ 634:	eb d8                	jmp    60e <uclocktime+0x4e>
+ 636:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 63d:	8d 76 00             	lea    0x0(%esi),%esi
+ 640:	83 c4 1c             	add    $0x1c,%esp
+ 643:	5b                   	pop    %ebx
+ 644:	5e                   	pop    %esi
+ 645:	5f                   	pop    %edi
+ 646:	5d                   	pop    %ebp
+    return clocktime(ts);
+ 647:	e9 f2 02 00 00       	jmp    93e <clocktime>
+
+0000064c <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+ 64c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 651:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 658:	00 00 00 
+ 65b:	74 09                	je     666 <fork+0x1a>
+ 65d:	89 e1                	mov    %esp,%ecx
+ 65f:	ba 68 06 00 00       	mov    $0x668,%edx
+ 664:	0f 34                	sysenter
+ 666:	cd 40                	int    $0x40
+ 668:	c3                   	ret
+
+00000669 <exit>:
+SYSCALL(exit)
+ 669:	b8 02 00 00 00       	mov    $0x2,%eax
+ 66e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 675:	00 00 00 
+ 678:	74 09                	je     683 <exit+0x1a>
+ 67a:	89 e1                	mov    %esp,%ecx
+ 67c:	ba 85 06 00 00       	mov    $0x685,%edx
+ 681:	0f 34                	sysenter
+ 683:	cd 40                	int    $0x40
+ 685:	c3                   	ret
+
+00000686 <wait>:
+SYSCALL(wait)
+ 686:	b8 03 00 00 00       	mov    $0x3,%eax
+ 68b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 692:	00 00 00 
+ 695:	74 09                	je     6a0 <wait+0x1a>
+ 697:	89 e1                	mov    %esp,%ecx
+ 699:	ba a2 06 00 00       	mov    $0x6a2,%edx
+ 69e:	0f 34                	sysenter
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <pipe>:
+SYSCALL(pipe)
+ 6a3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 6a8:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6af:	00 00 00 
+ 6b2:	74 09                	je     6bd <pipe+0x1a>
+ 6b4:	89 e1                	mov    %esp,%ecx
+ 6b6:	ba bf 06 00 00       	mov    $0x6bf,%edx
+ 6bb:	0f 34                	sysenter
+ 6bd:	cd 40                	int    $0x40
+ 6bf:	c3                   	ret
+
+000006c0 <read>:
+SYSCALL(read)
+ 6c0:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6c5:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6cc:	00 00 00 
+ 6cf:	74 09                	je     6da <read+0x1a>
+ 6d1:	89 e1                	mov    %esp,%ecx
+ 6d3:	ba dc 06 00 00       	mov    $0x6dc,%edx
+ 6d8:	0f 34                	sysenter
+ 6da:	cd 40                	int    $0x40
+ 6dc:	c3                   	ret
+
+000006dd <write>:
+SYSCALL(write)
+ 6dd:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6e2:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6e9:	00 00 00 
+ 6ec:	74 09                	je     6f7 <write+0x1a>
+ 6ee:	89 e1                	mov    %esp,%ecx
+ 6f0:	ba f9 06 00 00       	mov    $0x6f9,%edx
+ 6f5:	0f 34                	sysenter
+ 6f7:	cd 40                	int    $0x40
+ 6f9:	c3                   	ret
+
+000006fa <close>:
+SYSCALL(close)
+ 6fa:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6ff:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 706:	00 00 00 
+ 709:	74 09                	je     714 <close+0x1a>
+ 70b:	89 e1                	mov    %esp,%ecx
+ 70d:	ba 16 07 00 00       	mov    $0x716,%edx
+ 712:	0f 34                	sysenter
+ 714:	cd 40                	int    $0x40
+ 716:	c3                   	ret
+
+00000717 <kill>:
+SYSCALL(kill)
+ 717:	b8 06 00 00 00       	mov    $0x6,%eax
+ 71c:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 723:	00 00 00 
+ 726:	74 09                	je     731 <kill+0x1a>
+ 728:	89 e1                	mov    %esp,%ecx
+ 72a:	ba 33 07 00 00       	mov    $0x733,%edx
+ 72f:	0f 34                	sysenter
+ 731:	cd 40                	int    $0x40
+ 733:	c3                   	ret
+
+00000734 <exec>:
+SYSCALL(exec)
+ 734:	b8 07 00 00 00       	mov    $0x7,%eax
+ 739:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 740:	00 00 00 
+ 743:	74 09                	je     74e <exec+0x1a>
+ 745:	89 e1                	mov    %esp,%ecx
+ 747:	ba 50 07 00 00       	mov    $0x750,%edx
+ 74c:	0f 34                	sysenter
+ 74e:	cd 40                	int    $0x40
+ 750:	c3                   	ret
+
+00000751 <open>:
+SYSCALL(open)
+ 751:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 756:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 75d:	00 00 00 
+ 760:	74 09                	je     76b <open+0x1a>
+ 762:	89 e1                	mov    %esp,%ecx
+ 764:	ba 6d 07 00 00       	mov    $0x76d,%edx
+ 769:	0f 34                	sysenter
+ 76b:	cd 40                	int    $0x40
+ 76d:	c3                   	ret
+
+0000076e <mknod>:
+SYSCALL(mknod)
+ 76e:	b8 11 00 00 00       	mov    $0x11,%eax
+ 773:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 77a:	00 00 00 
+ 77d:	74 09                	je     788 <mknod+0x1a>
+ 77f:	89 e1                	mov    %esp,%ecx
+ 781:	ba 8a 07 00 00       	mov    $0x78a,%edx
+ 786:	0f 34                	sysenter
+ 788:	cd 40                	int    $0x40
+ 78a:	c3                   	ret
+
+0000078b <unlink>:
+SYSCALL(unlink)
+ 78b:	b8 12 00 00 00       	mov    $0x12,%eax
+ 790:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 797:	00 00 00 
+ 79a:	74 09                	je     7a5 <unlink+0x1a>
+ 79c:	89 e1                	mov    %esp,%ecx
+ 79e:	ba a7 07 00 00       	mov    $0x7a7,%edx
+ 7a3:	0f 34                	sysenter
+ 7a5:	cd 40                	int    $0x40
+ 7a7:	c3                   	ret
+
+000007a8 <fstat>:
+SYSCALL(fstat)
+ 7a8:	b8 08 00 00 00       	mov    $0x8,%eax
+ 7ad:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 7b4:	00 00 00 
+ 7b7:	74 09                	je     7c2 <fstat+0x1a>
+ 7b9:	89 e1                	mov    %esp,%ecx
+ 7bb:	ba c4 07 00 00       	mov    $0x7c4,%edx
+ 7c0:	0f 34                	sysenter
+ 7c2:	cd 40                	int    $0x40
+ 7c4:	c3                   	ret
+
+000007c5 <link>:
+SYSCALL(link)
+ 7c5:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7ca:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 7d1:	00 00 00 
+ 7d4:	74 09                	je     7df <link+0x1a>
+ 7d6:	89 e1                	mov    %esp,%ecx
+ 7d8:	ba e1 07 00 00       	mov    $0x7e1,%edx
+ 7dd:	0f 34                	sysenter
+ 7df:	cd 40                	int    $0x40
+ 7e1:	c3                   	ret
+
+000007e2 <mkdir>:
+SYSCALL(mkdir)
+ 7e2:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7e7:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 7ee:	00 00 00 
+ 7f1:	74 09                	je     7fc <mkdir+0x1a>
+ 7f3:	89 e1                	mov    %esp,%ecx
+ 7f5:	ba fe 07 00 00       	mov    $0x7fe,%edx
+ 7fa:	0f 34                	sysenter
+ 7fc:	cd 40                	int    $0x40
+ 7fe:	c3                   	ret
+
+000007ff <chdir>:
+SYSCALL(chdir)
+ 7ff:	b8 09 00 00 00       	mov    $0x9,%eax
+ 804:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 80b:	00 00 00 
+ 80e:	74 09                	je     819 <chdir+0x1a>
+ 810:	89 e1                	mov    %esp,%ecx
+ 812:	ba 1b 08 00 00       	mov    $0x81b,%edx
+ 817:	0f 34                	sysenter
+ 819:	cd 40                	int    $0x40
+ 81b:	c3                   	ret
+
+0000081c <dup>:
+SYSCALL(dup)
+ 81c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 821:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 828:	00 00 00 
+ 82b:	74 09                	je     836 <dup+0x1a>
+ 82d:	89 e1                	mov    %esp,%ecx
+ 82f:	ba 38 08 00 00       	mov    $0x838,%edx
+ 834:	0f 34                	sysenter
+ 836:	cd 40                	int    $0x40
+ 838:	c3                   	ret
+
+00000839 <getpid>:
+SYSCALL(getpid)
+ 839:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 83e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 845:	00 00 00 
+ 848:	74 09                	je     853 <getpid+0x1a>
+ 84a:	89 e1                	mov    %esp,%ecx
+ 84c:	ba 55 08 00 00       	mov    $0x855,%edx
+ 851:	0f 34                	sysenter
+ 853:	cd 40                	int    $0x40
+ 855:	c3                   	ret
+
+00000856 <sbrk>:
+SYSCALL(sbrk)
+ 856:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 85b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 862:	00 00 00 
+ 865:	74 09                	je     870 <sbrk+0x1a>
+ 867:	89 e1                	mov    %esp,%ecx
+ 869:	ba 72 08 00 00       	mov    $0x872,%edx
+ 86e:	0f 34                	sysenter
+ 870:	cd 40                	int    $0x40
+ 872:	c3                   	ret
+
+00000873 <sleep>:
+SYSCALL(sleep)
+ 873:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 878:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 87f:	00 00 00 
+ 882:	74 09                	je     88d <sleep+0x1a>
+ 884:	89 e1                	mov    %esp,%ecx
+ 886:	ba 8f 08 00 00       	mov    $0x88f,%edx
+ 88b:	0f 34                	sysenter
+ 88d:	cd 40                	int    $0x40
+ 88f:	c3                   	ret
+
+00000890 <uptime>:
+SYSCALL(uptime)
+ 890:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 895:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 89c:	00 00 00 
+ 89f:	74 09                	je     8aa <uptime+0x1a>
+ 8a1:	89 e1                	mov    %esp,%ecx
+ 8a3:	ba ac 08 00 00       	mov    $0x8ac,%edx
+ 8a8:	0f 34                	sysenter
+ 8aa:	cd 40                	int    $0x40
+ 8ac:	c3                   	ret
+
+000008ad <swapread>:
+SYSCALL(swapread)
+ 8ad:	b8 16 00 00 00       	mov    $0x16,%eax
+ 8b2:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 8b9:	00 00 00 
+ 8bc:	74 09                	je     8c7 <swapread+0x1a>
+ 8be:	89 e1                	mov    %esp,%ecx
+ 8c0:	ba c9 08 00 00       	mov    $0x8c9,%edx
+ 8c5:	0f 34                	sysenter
+ 8c7:	cd 40                	int    $0x40
+ 8c9:	c3                   	ret
+
+000008ca <swapwrite>:
+SYSCALL(swapwrite)
+ 8ca:	b8 17 00 00 00       	mov    $0x17,%eax
+ 8cf:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 8d6:	00 00 00 
+ 8d9:	74 09                	je     8e4 <swapwrite+0x1a>
+ 8db:	89 e1                	mov    %esp,%ecx
+ 8dd:	ba e6 08 00 00       	mov    $0x8e6,%edx
+ 8e2:	0f 34                	sysenter
+ 8e4:	cd 40                	int    $0x40
+ 8e6:	c3                   	ret
+
+000008e7 <setaffinity>:
+SYSCALL(setaffinity)
+ 8e7:	b8 18 00 00 00       	mov    $0x18,%eax
+ 8ec:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 8f3:	00 00 00 
+ 8f6:	74 09                	je     901 <setaffinity+0x1a>
+ 8f8:	89 e1                	mov    %esp,%ecx
+ 8fa:	ba 03 09 00 00       	mov    $0x903,%edx
+ 8ff:	0f 34                	sysenter
+ 901:	cd 40                	int    $0x40
+ 903:	c3                   	ret
+
+00000904 <getaffinity>:
+SYSCALL(getaffinity)
+ 904:	b8 19 00 00 00       	mov    $0x19,%eax
+ 909:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 910:	00 00 00 
+ 913:	74 09                	je     91e <getaffinity+0x1a>
+ 915:	89 e1                	mov    %esp,%ecx
+ 917:	ba 20 09 00 00       	mov    $0x920,%edx
+ 91c:	0f 34                	sysenter
+ 91e:	cd 40                	int    $0x40
+ 920:	c3                   	ret
+
+00000921 <nanosleep>:
+SYSCALL(nanosleep)
+ 921:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 926:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 92d:	00 00 00 
+ 930:	74 09                	je     93b <nanosleep+0x1a>
+ 932:	89 e1                	mov    %esp,%ecx
+ 934:	ba 3d 09 00 00       	mov    $0x93d,%edx
+ 939:	0f 34                	sysenter
+ 93b:	cd 40                	int    $0x40
+ 93d:	c3                   	ret
+
+0000093e <clocktime>:
+SYSCALL(clocktime)
+ 93e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 943:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 94a:	00 00 00 
+ 94d:	74 09                	je     958 <clocktime+0x1a>
+ 94f:	89 e1                	mov    %esp,%ecx
+ 951:	ba 5a 09 00 00       	mov    $0x95a,%edx
+ 956:	0f 34                	sysenter
+ 958:	cd 40                	int    $0x40
+ 95a:	c3                   	ret
+
+0000095b <batch>:
+SYSCALL(batch)
+ 95b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 960:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 967:	00 00 00 
+ 96a:	74 09                	je     975 <batch+0x1a>
+ 96c:	89 e1                	mov    %esp,%ecx
+ 96e:	ba 77 09 00 00       	mov    $0x977,%edx
+ 973:	0f 34                	sysenter
+ 975:	cd 40                	int    $0x40
+ 977:	c3                   	ret
+
+00000978 <aiosetup>:
+SYSCALL(aiosetup)
+ 978:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 97d:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 984:	00 00 00 
+ 987:	74 09                	je     992 <aiosetup+0x1a>
+ 989:	89 e1                	mov    %esp,%ecx
+ 98b:	ba 94 09 00 00       	mov    $0x994,%edx
+ 990:	0f 34                	sysenter
+ 992:	cd 40                	int    $0x40
+ 994:	c3                   	ret
+
+00000995 <aiowait>:
+SYSCALL(aiowait)
+ 995:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 99a:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 9a1:	00 00 00 
+ 9a4:	74 09                	je     9af <aiowait+0x1a>
+ 9a6:	89 e1                	mov    %esp,%ecx
+ 9a8:	ba b1 09 00 00       	mov    $0x9b1,%edx
+ 9ad:	0f 34                	sysenter
+ 9af:	cd 40                	int    $0x40
+ 9b1:	c3                   	ret
+
+000009b2 <spawn>:
+SYSCALL(spawn)
+ 9b2:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 9b7:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 9be:	00 00 00 
+ 9c1:	74 09                	je     9cc <spawn+0x1a>
+ 9c3:	89 e1                	mov    %esp,%ecx
+ 9c5:	ba ce 09 00 00       	mov    $0x9ce,%edx
+ 9ca:	0f 34                	sysenter
+ 9cc:	cd 40                	int    $0x40
+ 9ce:	c3                   	ret
+
+000009cf <getprocinfo>:
+SYSCALL(getprocinfo)
+ 9cf:	b8 20 00 00 00       	mov    $0x20,%eax
+ 9d4:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 9db:	00 00 00 
+ 9de:	74 09                	je     9e9 <getprocinfo+0x1a>
+ 9e0:	89 e1                	mov    %esp,%ecx
+ 9e2:	ba eb 09 00 00       	mov    $0x9eb,%edx
+ 9e7:	0f 34                	sysenter
+ 9e9:	cd 40                	int    $0x40
+ 9eb:	c3                   	ret
+
+000009ec <getlockstat>:
+SYSCALL(getlockstat)
+ 9ec:	b8 21 00 00 00       	mov    $0x21,%eax
+ 9f1:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 9f8:	00 00 00 
+ 9fb:	74 09                	je     a06 <getlockstat+0x1a>
+ 9fd:	89 e1                	mov    %esp,%ecx
+ 9ff:	ba 08 0a 00 00       	mov    $0xa08,%edx
+ a04:	0f 34                	sysenter
+ a06:	cd 40                	int    $0x40
+ a08:	c3                   	ret
+
+00000a09 <lockprof>:
+SYSCALL(lockprof)
+ a09:	b8 22 00 00 00       	mov    $0x22,%eax
+ a0e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ a15:	00 00 00 
+ a18:	74 09                	je     a23 <lockprof+0x1a>
+ a1a:	89 e1                	mov    %esp,%ecx
+ a1c:	ba 25 0a 00 00       	mov    $0xa25,%edx
+ a21:	0f 34                	sysenter
+ a23:	cd 40                	int    $0x40
+ a25:	c3                   	ret
+
+00000a26 <getlockprof>:
+SYSCALL(getlockprof)
+ a26:	b8 23 00 00 00       	mov    $0x23,%eax
+ a2b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ a32:	00 00 00 
+ a35:	74 09                	je     a40 <getlockprof+0x1a>
+ a37:	89 e1                	mov    %esp,%ecx
+ a39:	ba 42 0a 00 00       	mov    $0xa42,%edx
+ a3e:	0f 34                	sysenter
+ a40:	cd 40                	int    $0x40
+ a42:	c3                   	ret
+
+00000a43 <diskstat>:
+SYSCALL(diskstat)
+ a43:	b8 24 00 00 00       	mov    $0x24,%eax
+ a48:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ a4f:	00 00 00 
+ a52:	74 09                	je     a5d <diskstat+0x1a>
+ a54:	89 e1                	mov    %esp,%ecx
+ a56:	ba 5f 0a 00 00       	mov    $0xa5f,%edx
+ a5b:	0f 34                	sysenter
+ a5d:	cd 40                	int    $0x40
+ a5f:	c3                   	ret
+
+00000a60 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ a60:	55                   	push   %ebp
+ a61:	89 e5                	mov    %esp,%ebp
+ a63:	57                   	push   %edi
+ a64:	56                   	push   %esi
+ a65:	53                   	push   %ebx
+ a66:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ a68:	89 d1                	mov    %edx,%ecx
+{
+ a6a:	83 ec 3c             	sub    $0x3c,%esp
+ a6d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ a70:	85 d2                	test   %edx,%edx
+ a72:	0f 89 80 00 00 00    	jns    af8 <printint+0x98>
+ a78:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ a7c:	74 7a                	je     af8 <printint+0x98>
+    x = -xx;
+ a7e:	f7 d9                	neg    %ecx
+    neg = 1;
+ a80:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ a85:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ a88:	31 f6                	xor    %esi,%esi
+ a8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ a90:	89 c8                	mov    %ecx,%eax
+ a92:	31 d2                	xor    %edx,%edx
+ a94:	89 f7                	mov    %esi,%edi
+ a96:	f7 f3                	div    %ebx
+ a98:	8d 76 01             	lea    0x1(%esi),%esi
+ a9b:	0f b6 92 ac 0f 00 00 	movzbl 0xfac(%edx),%edx
+ aa2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ aa6:	89 ca                	mov    %ecx,%edx
+ aa8:	89 c1                	mov    %eax,%ecx
+ aaa:	39 da                	cmp    %ebx,%edx
+ aac:	73 e2                	jae    a90 <printint+0x30>
+  if(neg)
+ aae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ ab1:	85 c0                	test   %eax,%eax
+ ab3:	74 07                	je     abc <printint+0x5c>
+    buf[i++] = '-';
+ ab5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ aba:	89 f7                	mov    %esi,%edi
+ abc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ abf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ ac2:	01 df                	add    %ebx,%edi
+ ac4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ ac8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ acb:	83 ec 04             	sub    $0x4,%esp
+ ace:	88 45 d7             	mov    %al,-0x29(%ebp)
+ ad1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ ad4:	6a 01                	push   $0x1
+ ad6:	50                   	push   %eax
+ ad7:	56                   	push   %esi
+ ad8:	e8 00 fc ff ff       	call   6dd <write>
+  while(--i >= 0)
+ add:	89 f8                	mov    %edi,%eax
+ adf:	83 c4 10             	add    $0x10,%esp
+ ae2:	83 ef 01             	sub    $0x1,%edi
+ ae5:	39 d8                	cmp    %ebx,%eax
+ ae7:	75 df                	jne    ac8 <printint+0x68>
+}
+ ae9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ aec:	5b                   	pop    %ebx
+ aed:	5e                   	pop    %esi
+ aee:	5f                   	pop    %edi
+ aef:	5d                   	pop    %ebp
+ af0:	c3                   	ret
+ af1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ af8:	31 c0                	xor    %eax,%eax
+ afa:	eb 89                	jmp    a85 <printint+0x25>
+ afc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b00 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ b00:	55                   	push   %ebp
+ b01:	89 e5                	mov    %esp,%ebp
+ b03:	57                   	push   %edi
+ b04:	56                   	push   %esi
+ b05:	53                   	push   %ebx
+ b06:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ b09:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ b0c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ b0f:	0f b6 1e             	movzbl (%esi),%ebx
+ b12:	83 c6 01             	add    $0x1,%esi
+ b15:	84 db                	test   %bl,%bl
+ b17:	74 67                	je     b80 <printf+0x80>
+ b19:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ b1c:	31 d2                	xor    %edx,%edx
+ b1e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ b21:	eb 34                	jmp    b57 <printf+0x57>
+ b23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b27:	90                   	nop
+ b28:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ b2b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ b30:	83 f8 25             	cmp    $0x25,%eax
+ b33:	74 18                	je     b4d <printf+0x4d>
+  write(fd, &c, 1);
+ b35:	83 ec 04             	sub    $0x4,%esp
+ b38:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ b3b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b3e:	6a 01                	push   $0x1
+ b40:	50                   	push   %eax
+ b41:	57                   	push   %edi
+ b42:	e8 96 fb ff ff       	call   6dd <write>
+ b47:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ b4a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ b4d:	0f b6 1e             	movzbl (%esi),%ebx
+ b50:	83 c6 01             	add    $0x1,%esi
+ b53:	84 db                	test   %bl,%bl
+ b55:	74 29                	je     b80 <printf+0x80>
+    c = fmt[i] & 0xff;
+ b57:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ b5a:	85 d2                	test   %edx,%edx
+ b5c:	74 ca                	je     b28 <printf+0x28>
+      }
+    } else if(state == '%'){
+ b5e:	83 fa 25             	cmp    $0x25,%edx
+ b61:	75 ea                	jne    b4d <printf+0x4d>
+      if(c == 'd'){
+ b63:	83 f8 25             	cmp    $0x25,%eax
+ b66:	0f 84 24 01 00 00    	je     c90 <printf+0x190>
+ b6c:	83 e8 63             	sub    $0x63,%eax
+ b6f:	83 f8 15             	cmp    $0x15,%eax
+ b72:	77 1c                	ja     b90 <printf+0x90>
+ b74:	ff 24 85 54 0f 00 00 	jmp    *0xf54(,%eax,4)
+ b7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b7f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ b80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b83:	5b                   	pop    %ebx
+ b84:	5e                   	pop    %esi
+ b85:	5f                   	pop    %edi
+ b86:	5d                   	pop    %ebp
+ b87:	c3                   	ret
+ b88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b8f:	90                   	nop
+  write(fd, &c, 1);
+ b90:	83 ec 04             	sub    $0x4,%esp
+ b93:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b96:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ b9a:	6a 01                	push   $0x1
+ b9c:	52                   	push   %edx
+ b9d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ ba0:	57                   	push   %edi
+ ba1:	e8 37 fb ff ff       	call   6dd <write>
+ ba6:	83 c4 0c             	add    $0xc,%esp
+ ba9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ bac:	6a 01                	push   $0x1
+ bae:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ bb1:	52                   	push   %edx
+ bb2:	57                   	push   %edi
+ bb3:	e8 25 fb ff ff       	call   6dd <write>
+        putc(fd, c);
+ bb8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ bbb:	31 d2                	xor    %edx,%edx
+ bbd:	eb 8e                	jmp    b4d <printf+0x4d>
+ bbf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ bc0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ bc3:	83 ec 0c             	sub    $0xc,%esp
+ bc6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ bcb:	8b 13                	mov    (%ebx),%edx
+ bcd:	6a 00                	push   $0x0
+ bcf:	89 f8                	mov    %edi,%eax
+        ap++;
+ bd1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ bd4:	e8 87 fe ff ff       	call   a60 <printint>
+        ap++;
+ bd9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ bdc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ bdf:	31 d2                	xor    %edx,%edx
+ be1:	e9 67 ff ff ff       	jmp    b4d <printf+0x4d>
+ be6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bed:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ bf0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ bf3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ bf5:	83 c0 04             	add    $0x4,%eax
+ bf8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ bfb:	85 db                	test   %ebx,%ebx
+ bfd:	0f 84 9d 00 00 00    	je     ca0 <printf+0x1a0>
+        while(*s != 0){
+ c03:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ c06:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ c08:	84 c0                	test   %al,%al
+ c0a:	0f 84 3d ff ff ff    	je     b4d <printf+0x4d>
+ c10:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ c13:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ c16:	89 de                	mov    %ebx,%esi
+ c18:	89 d3                	mov    %edx,%ebx
+ c1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ c20:	83 ec 04             	sub    $0x4,%esp
+ c23:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ c26:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ c29:	6a 01                	push   $0x1
+ c2b:	53                   	push   %ebx
+ c2c:	57                   	push   %edi
+ c2d:	e8 ab fa ff ff       	call   6dd <write>
+        while(*s != 0){
+ c32:	0f b6 06             	movzbl (%esi),%eax
+ c35:	83 c4 10             	add    $0x10,%esp
+ c38:	84 c0                	test   %al,%al
+ c3a:	75 e4                	jne    c20 <printf+0x120>
+      state = 0;
+ c3c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ c3f:	31 d2                	xor    %edx,%edx
+ c41:	e9 07 ff ff ff       	jmp    b4d <printf+0x4d>
+ c46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c4d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ c50:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ c53:	83 ec 0c             	sub    $0xc,%esp
+ c56:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ c5b:	8b 13                	mov    (%ebx),%edx
+ c5d:	6a 01                	push   $0x1
+ c5f:	e9 6b ff ff ff       	jmp    bcf <printf+0xcf>
+ c64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ c68:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ c6b:	83 ec 04             	sub    $0x4,%esp
+ c6e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ c71:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ c73:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ c76:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ c79:	6a 01                	push   $0x1
+ c7b:	52                   	push   %edx
+ c7c:	57                   	push   %edi
+ c7d:	e8 5b fa ff ff       	call   6dd <write>
+        ap++;
+ c82:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ c85:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ c88:	31 d2                	xor    %edx,%edx
+ c8a:	e9 be fe ff ff       	jmp    b4d <printf+0x4d>
+ c8f:	90                   	nop
+  write(fd, &c, 1);
+ c90:	83 ec 04             	sub    $0x4,%esp
+ c93:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ c96:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ c99:	6a 01                	push   $0x1
+ c9b:	e9 11 ff ff ff       	jmp    bb1 <printf+0xb1>
+ ca0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ ca5:	bb 4d 0f 00 00       	mov    $0xf4d,%ebx
+ caa:	e9 61 ff ff ff       	jmp    c10 <printf+0x110>
+ caf:	90                   	nop
+
+00000cb0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ cb0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cb1:	a1 c0 22 00 00       	mov    0x22c0,%eax
+{
+ cb6:	89 e5                	mov    %esp,%ebp
+ cb8:	57                   	push   %edi
+ cb9:	56                   	push   %esi
+ cba:	53                   	push   %ebx
+ cbb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ cbe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cc8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cca:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ccc:	39 ca                	cmp    %ecx,%edx
+ cce:	73 30                	jae    d00 <free+0x50>
+ cd0:	39 c1                	cmp    %eax,%ecx
+ cd2:	72 04                	jb     cd8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cd4:	39 c2                	cmp    %eax,%edx
+ cd6:	72 f0                	jb     cc8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ cd8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ cdb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ cde:	39 f8                	cmp    %edi,%eax
+ ce0:	74 2e                	je     d10 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ce2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ ce5:	8b 42 04             	mov    0x4(%edx),%eax
+ ce8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ ceb:	39 f1                	cmp    %esi,%ecx
+ ced:	74 38                	je     d27 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ cef:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ cf1:	5b                   	pop    %ebx
+  freep = p;
+ cf2:	89 15 c0 22 00 00    	mov    %edx,0x22c0
+}
+ cf8:	5e                   	pop    %esi
+ cf9:	5f                   	pop    %edi
+ cfa:	5d                   	pop    %ebp
+ cfb:	c3                   	ret
+ cfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d00:	39 c1                	cmp    %eax,%ecx
+ d02:	72 d0                	jb     cd4 <free+0x24>
+ d04:	eb c2                	jmp    cc8 <free+0x18>
+ d06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d0d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ d10:	03 70 04             	add    0x4(%eax),%esi
+ d13:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d16:	8b 02                	mov    (%edx),%eax
+ d18:	8b 00                	mov    (%eax),%eax
+ d1a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ d1d:	8b 42 04             	mov    0x4(%edx),%eax
+ d20:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d23:	39 f1                	cmp    %esi,%ecx
+ d25:	75 c8                	jne    cef <free+0x3f>
+    p->s.size += bp->s.size;
+ d27:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ d2a:	89 15 c0 22 00 00    	mov    %edx,0x22c0
+    p->s.size += bp->s.size;
+ d30:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ d33:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ d36:	89 0a                	mov    %ecx,(%edx)
+}
+ d38:	5b                   	pop    %ebx
+ d39:	5e                   	pop    %esi
+ d3a:	5f                   	pop    %edi
+ d3b:	5d                   	pop    %ebp
+ d3c:	c3                   	ret
+ d3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d40 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ d40:	55                   	push   %ebp
+ d41:	89 e5                	mov    %esp,%ebp
+ d43:	57                   	push   %edi
+ d44:	56                   	push   %esi
+ d45:	53                   	push   %ebx
+ d46:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d49:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ d4c:	8b 15 c0 22 00 00    	mov    0x22c0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d52:	8d 78 07             	lea    0x7(%eax),%edi
+ d55:	c1 ef 03             	shr    $0x3,%edi
+ d58:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ d5b:	85 d2                	test   %edx,%edx
+ d5d:	0f 84 8d 00 00 00    	je     df0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d63:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d65:	8b 48 04             	mov    0x4(%eax),%ecx
+ d68:	39 f9                	cmp    %edi,%ecx
+ d6a:	73 64                	jae    dd0 <malloc+0x90>
+  if(nu < 4096)
+ d6c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ d71:	39 df                	cmp    %ebx,%edi
+ d73:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ d76:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ d7d:	eb 0a                	jmp    d89 <malloc+0x49>
+ d7f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d80:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d82:	8b 48 04             	mov    0x4(%eax),%ecx
+ d85:	39 f9                	cmp    %edi,%ecx
+ d87:	73 47                	jae    dd0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ d89:	89 c2                	mov    %eax,%edx
+ d8b:	39 05 c0 22 00 00    	cmp    %eax,0x22c0
+ d91:	75 ed                	jne    d80 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ d93:	83 ec 0c             	sub    $0xc,%esp
+ d96:	56                   	push   %esi
+ d97:	e8 ba fa ff ff       	call   856 <sbrk>
+  if(p == (char*)-1)
+ d9c:	83 c4 10             	add    $0x10,%esp
+ d9f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ da2:	74 1c                	je     dc0 <malloc+0x80>
+  hp->s.size = nu;
+ da4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ da7:	83 ec 0c             	sub    $0xc,%esp
+ daa:	83 c0 08             	add    $0x8,%eax
+ dad:	50                   	push   %eax
+ dae:	e8 fd fe ff ff       	call   cb0 <free>
+  return freep;
+ db3:	8b 15 c0 22 00 00    	mov    0x22c0,%edx
+      if((p = morecore(nunits)) == 0)
+ db9:	83 c4 10             	add    $0x10,%esp
+ dbc:	85 d2                	test   %edx,%edx
+ dbe:	75 c0                	jne    d80 <malloc+0x40>
+        return 0;
+  }
+}
+ dc0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ dc3:	31 c0                	xor    %eax,%eax
+}
+ dc5:	5b                   	pop    %ebx
+ dc6:	5e                   	pop    %esi
+ dc7:	5f                   	pop    %edi
+ dc8:	5d                   	pop    %ebp
+ dc9:	c3                   	ret
+ dca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ dd0:	39 cf                	cmp    %ecx,%edi
+ dd2:	74 4c                	je     e20 <malloc+0xe0>
+        p->s.size -= nunits;
+ dd4:	29 f9                	sub    %edi,%ecx
+ dd6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ dd9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ ddc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ ddf:	89 15 c0 22 00 00    	mov    %edx,0x22c0
+}
+ de5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ de8:	83 c0 08             	add    $0x8,%eax
+}
+ deb:	5b                   	pop    %ebx
+ dec:	5e                   	pop    %esi
+ ded:	5f                   	pop    %edi
+ dee:	5d                   	pop    %ebp
+ def:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ df0:	c7 05 c0 22 00 00 c4 	movl   $0x22c4,0x22c0
+ df7:	22 00 00 
+    base.s.size = 0;
+ dfa:	b8 c4 22 00 00       	mov    $0x22c4,%eax
+    base.s.ptr = freep = prevp = &base;
+ dff:	c7 05 c4 22 00 00 c4 	movl   $0x22c4,0x22c4
+ e06:	22 00 00 
+    base.s.size = 0;
+ e09:	c7 05 c8 22 00 00 00 	movl   $0x0,0x22c8
+ e10:	00 00 00 
+    if(p->s.size >= nunits){
+ e13:	e9 54 ff ff ff       	jmp    d6c <malloc+0x2c>
+ e18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e1f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ e20:	8b 08                	mov    (%eax),%ecx
+ e22:	89 0a                	mov    %ecx,(%edx)
+ e24:	eb b9                	jmp    ddf <malloc+0x9f>
@@ -0,0 +1,112 @@
+// Test asynchronous I/O: queue writes, an fsync and reads on
+// the aio rings and collect all their completions.  Each block
+// has its own contents, so that data landing at the wrong
+// offset shows up.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "aio.h"
+
+int
+main(void)
+{
+  struct aioring *r;
+  struct aiosqe *sqe;
+  static char wbuf[4][512], rbuf[4][512];
+  int fd, i, j, n, got, total, nwrite;
+
+  printf(1, "aio test\n");
+  if((r = aiosetup()) == (struct aioring*)-1){
+    printf(1, "aiosetup failed\n");
+    exit();
+  }
+  if(aiosetup() != (struct aioring*)-1){
+    printf(1, "second aiosetup succeeded\n");
+    exit();
+  }
+  fd = open("aiofile", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(1, "aio test: create failed\n");
+    exit();
+  }
+  // Writes of blocks 0-3, one to a bad fd (tag 4), then
+  // an fsync (tag 5) that must wait for the writes.
+  for(i = 0; i < 4; i++)
+    memset(wbuf[i], 'a' + i, 512);
+  for(i = 0; i < 6; i++){
+    sqe = &r->sq[r->sqtail % NAIOSQ];
+    sqe->op = i < 5 ? AIO_WRITE : AIO_FSYNC;
+    sqe->fd = i != 4 ? fd : 99;
+    sqe->addr = (uint)wbuf[i%4];
+    sqe->n = 512;
+    sqe->off = (i%4) * 512;
+    sqe->tag = i;
+    r->sqtail++;
+  }
+  total = 0;
+  nwrite = 0;
+  for(got = 0; got < 6; got += n){
+    n = aiowait(1);
+    for(j = 0; j < n; j++){
+      struct aiocqe *cqe = &r->cq[(r->cqhead + j) % NAIOCQ];
+      if((cqe->tag == 4) != (cqe->ret == -1)){
+        printf(1, "aio write %d returned %d\n", cqe->tag, cqe->ret);
+        exit();
+      }
+      if(cqe->tag == 5 && nwrite != 4){
+        printf(1, "aio fsync finished before the writes\n");
+        exit();
+      }
+      if(cqe->tag < 4){
+        nwrite++;
+        total += cqe->ret;
+      }
+    }
+    r->cqhead += n;
+  }
+  if(total != sizeof(wbuf)){
+    printf(1, "aio wrote %d bytes\n", total);
+    exit();
+  }
+  close(fd);
+
+  // Read the blocks back, last first.
+  fd = open("aiofile", O_RDONLY);
+  for(i = 3; i >= 0; i--){
+    sqe = &r->sq[r->sqtail % NAIOSQ];
+    sqe->op = AIO_READ;
+    sqe->fd = fd;
+    sqe->addr = (uint)rbuf[i];
+    sqe->n = 512;
+    sqe->off = i * 512;
+    sqe->tag = i;
+    r->sqtail++;
+  }
+  if(aiowait(4) != 4){
+    printf(1, "aiowait(4) came back early\n");
+    exit();
+  }
+  for(j = 0; j < 4; j++)
+    if(r->cq[(r->cqhead + j) % NAIOCQ].ret != 512){
+      printf(1, "aio read short\n");
+      exit();
+    }
+  r->cqhead += 4;
+  for(i = 0; i < sizeof(rbuf); i++)
+    if(rbuf[i/512][i%512] != 'a' + i/512){
+      printf(1, "aio read wrong data in block %d\n", i/512);
+      exit();
+    }
+
+  // The requests must not have moved the file's own offset.
+  if(read(fd, rbuf[1], 512) != 512 || rbuf[1][0] != 'a'){
+    printf(1, "aio moved the file offset\n");
+    exit();
+  }
+  close(fd);
+  unlink("aiofile");
+  printf(1, "aio test OK\n");
+  exit();
+}
@@ -1,13 +1,29 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a hash table of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
 //
+// Each hash bucket has its own lock, so lookups of different
+// blocks on different CPUs do not contend.  Buffers are
+// recycled by the clock algorithm rather than from an LRU list,
+// so that a hit or a release only has to set a flag.
+//
+// NBUF buffers are always there.  Beyond those the cache grows
+// a page of buffers at a time from kalloc(), up to NBUFPAGE
+// pages, while more than BUFRESERVE pages are free.  When
+// kalloc() runs out it calls bshrink() to take back a page
+// whose buffers are all idle.
+//
 // Interface:
 // * To get a buffer for a particular disk block, call bread.
+// * Or call bread_async to start reading it, do something
+//     else, and call bwait before looking at the data.
+// * To hint that a block will be read soon, call breadahead.
 // * After changing buffer data, call bwrite to write it to disk.
+// * Or call bwrite_async on several buffers and then bwait on
+//     each, so that the disk driver can merge adjacent blocks.
 // * When done with the buffer, call brelse.
 // * Do not use the buffer after calling brelse.
 // * Only one process at a time can use a buffer,
@@ -17,128 +33,493 @@
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+// * B_ASYNC: the buffer is being read ahead; biodone releases it.
+//
+// The disk drivers only start requests.  They call biodone,
+// usually from an interrupt, when a request finishes.  Every
+// disk request is timed there, for diskstat().
 
 #include "types.h"
 #include "defs.h"
+#include "x86.h"
 #include "param.h"
+#include "mmu.h"
+#include "proc.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "diskstat.h"
+
+#define NBUCKET 509  // hash buckets; prime
+#define NODEV   (~0U)  // dev of a buffer that has never held a block
+
+struct bucket {
+  struct spinlock lock;   // Guards the chain and its bufs' refcnt
+  struct buf *head;       // Through hnext
+};
+
+// A page of buffers from kalloc() starts with this header.
+struct bufpage {
+  struct bufpage *next;
+};
+
+#define BPP ((PGSIZE - sizeof(struct bufpage)) / sizeof(struct buf))
+#define pagebufs(pg) ((struct buf*)((pg) + 1))
 
 struct {
-  struct spinlock lock;
+  struct bucket bucket[NBUCKET];
+  struct spinlock evictlock;  // Serializes misses; guards the rest below
+  struct spinlock iolock;  // Guards B_VALID and B_DIRTY for bwait()
   struct buf buf[NBUF];
-
-  // Linked list of all buffers, through prev/next.
-  // head.next is most recently used.
-  struct buf head;
+  struct bufpage *pages;   // Pages of buffers from kalloc()
+  int npage;
+  int nbuf;                // Buffers in all
+  struct buf *spare;       // Never-used buffers, through hnext
+  struct buf *hand;        // Clock hand, on the anext ring of all buffers
+  uint nmiss;              // Hits are counted in struct cpu
 } bcache;
 
+static struct bucket*
+bucketfor(uint dev, uint blockno)
+{
+  return &bcache.bucket[(dev*31 + blockno) % NBUCKET];
+}
+
+// Add b to the cache as a spare.  Caller must hold evictlock.
+static void
+addbuf(struct buf *b)
+{
+  initsleeplock(&b->lock, "buffer");
+  b->dev = NODEV;
+  b->flags = 0;
+  b->refcnt = 0;
+  b->used = 0;
+  b->hnext = bcache.spare;
+  bcache.spare = b;
+  if(bcache.hand == 0){
+    b->anext = b->aprev = b;
+    bcache.hand = b;
+  } else {
+    b->anext = bcache.hand;
+    b->aprev = bcache.hand->aprev;
+    b->aprev->anext = b;
+    bcache.hand->aprev = b;
+  }
+  bcache.nbuf++;
+}
+
+// Take b off the ring of all buffers.  Caller must hold evictlock.
+static void
+removebuf(struct buf *b)
+{
+  if(bcache.hand == b)
+    bcache.hand = b->anext;
+  b->aprev->anext = b->anext;
+  b->anext->aprev = b->aprev;
+  bcache.nbuf--;
+}
+
 void
 binit(void)
 {
   struct buf *b;
+  struct bucket *bk;
 
-  initlock(&bcache.lock, "bcache");
+  for(bk = bcache.bucket; bk < bcache.bucket+NBUCKET; bk++)
+    initlock(&bk->lock, "bcache");
+  initlock(&bcache.evictlock, "bevict");
+  initlock(&bcache.iolock, "bio");
 
-//PAGEBREAK!
-  // Create linked list of buffers
-  bcache.head.prev = &bcache.head;
-  bcache.head.next = &bcache.head;
-  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+  acquire(&bcache.evictlock);
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++)
+    addbuf(b);
+  release(&bcache.evictlock);
+}
+
+// Find the buf for block blockno on dev in its bucket.
+// Caller must hold bk->lock.
+static struct buf*
+bfind(struct bucket *bk, uint dev, uint blockno)
+{
+  struct buf *b;
+
+  for(b = bk->head; b; b = b->hnext)
+    if(b->dev == dev && b->blockno == blockno)
+      return b;
+  return 0;
+}
+
+// Choose an unused buffer to recycle by the clock algorithm:
+// sweep the buffers, skipping those recently used (and
+// clearing their used flag) until one is found that was not.
+// Take it out of its bucket.  Caller must hold evictlock.
+// Returns 0 if none is found within n steps of the hand.
+static struct buf*
+bvictim(int n)
+{
+  struct buf *b, **pp;
+  struct bucket *bk;
+  int i;
+
+  for(i = 0; i < n; i++){
+    b = bcache.hand;
+    bcache.hand = b->anext;
+    if(b->dev == NODEV)
+      continue;
+    bk = bucketfor(b->dev, b->blockno);
+    acquire(&bk->lock);
+    // Even if refcnt==0, B_DIRTY indicates a buffer is in use
+    // because log.c has modified it but not yet committed it.
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0){
+      if(b->used)
+        b->used = 0;
+      else {
+        for(pp = &bk->head; *pp != b; pp = &(*pp)->hnext)
+          ;
+        *pp = b->hnext;
+        release(&bk->lock);
+        return b;
+      }
+    }
+    release(&bk->lock);
   }
+  return 0;
 }
 
 // Look through buffer cache for block on device dev.
 // If not found, allocate a buffer.
 // In either case, return locked buffer.
+// For readahead (ra set), return 0 instead if the block is
+// already cached or no idle buffer turns up within NBUF/2
+// steps of the clock hand, so that readahead cannot use up
+// the buffers others need.
+//
+// A hit takes only the block's bucket lock.  Misses are
+// serialized by evictlock, so that two processes cannot both
+// bring in the same block.
 static struct buf*
-bget(uint dev, uint blockno)
+bget(uint dev, uint blockno, int ra)
 {
+  struct bucket *bk;
+  struct bufpage *pg;
   struct buf *b;
+  int i;
 
-  acquire(&bcache.lock);
+  bk = bucketfor(dev, blockno);
+  acquire(&bk->lock);
+  if((b = bfind(bk, dev, blockno)) != 0)
+    goto found;
+  release(&bk->lock);
 
-  // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
-    if(b->dev == dev && b->blockno == blockno){
-      b->refcnt++;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
-    }
+  // Grow the cache rather than recycle while memory is plentiful.
+  // kalloc() may call bshrink(), so not while holding evictlock.
+  // The unlocked tests are only hints.
+  pg = 0;
+  if(bcache.spare == 0 && bcache.npage < NBUFPAGE && kfreepages() > BUFRESERVE)
+    pg = (struct bufpage*)kalloc();
+
+  acquire(&bcache.evictlock);
+  if(pg){
+    pg->next = bcache.pages;
+    bcache.pages = pg;
+    bcache.npage++;
+    for(i = 0; i < BPP; i++)
+      addbuf(&pagebufs(pg)[i]);
+  }
+  acquire(&bk->lock);
+  if((b = bfind(bk, dev, blockno)) != 0){
+    release(&bcache.evictlock);
+    goto found;
   }
+  release(&bk->lock);
 
-  // Not cached; recycle an unused buffer.
-  // Even if refcnt==0, B_DIRTY indicates a buffer is in use
-  // because log.c has modified it but not yet committed it.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = 0;
-      b->refcnt = 1;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
+  // Not cached; use a spare or recycle an unused buffer.
+  if((b = bcache.spare) != 0)
+    bcache.spare = b->hnext;
+  else if((b = bvictim(ra ? NBUF/2 : 2*bcache.nbuf)) == 0){
+    if(ra){
+      release(&bcache.evictlock);
+      return 0;
     }
+    panic("bget: no buffers");
   }
-  panic("bget: no buffers");
+  acquire(&bk->lock);
+  b->dev = dev;
+  b->blockno = blockno;
+  b->flags = 0;
+  b->refcnt = ra ? 2 : 1;  // breadahead() keeps a reference of its own
+  b->used = 1;
+  b->hnext = bk->head;
+  bk->head = b;
+  release(&bk->lock);
+  if(!ra)
+    bcache.nmiss++;
+  release(&bcache.evictlock);
+  acquiresleep(&b->lock);
+  return b;
+
+found:
+  if(ra){
+    release(&bk->lock);
+    return 0;
+  }
+  mycpu()->nbhit++;
+  b->refcnt++;
+  b->used = 1;
+  release(&bk->lock);
+  acquiresleep(&b->lock);
+  return b;
 }
 
-// Return a locked buf with the contents of the indicated block.
+struct diskstat diskstat;
+
+// Count a request that took t TSC cycles.
+static void
+diskdone(int write, uint64 t)
+{
+  uint us, rem, perus;
+  int i;
+
+  xadd(write ? &diskstat.nwrite : &diskstat.nread, 1);
+  perus = tscperiod / (1000000/HZ);
+  if(perus == 0 || (t >> 32) >= perus)
+    return;
+  us = divl(t, perus, &rem);
+  xadd(&diskstat.latency, us);
+  if(us > diskstat.maxlatency)  // racy, but only a statistic
+    diskstat.maxlatency = us;
+  for(i = 0; us > 1 && i < NDISKHIST-1; i++)
+    us >>= 1;
+  xadd(&diskstat.hist[i], 1);
+}
+
+// Start reading or writing b on whichever device holds its disk.
+static void
+bstart(struct buf *b)
+{
+  b->qtime = rdtsc();
+  if(b->dev == ROOTDEV && virtioready())
+    virtiorw(b);
+  else
+    iderw(b);
+}
+
+static void brelease(struct buf*);
+static void bunref(struct buf*);
+
+// Called by the disk drivers when the request for b is done.
+void
+biodone(struct buf *b)
+{
+  int write, async;
+  uint64 t;
+
+  t = rdtsc() - b->qtime;
+  write = b->flags & B_DIRTY;
+  acquire(&bcache.iolock);
+  async = b->flags & B_ASYNC;
+  b->flags |= B_VALID;
+  b->flags &= ~(B_DIRTY|B_ASYNC);
+  wakeup(b);
+  release(&bcache.iolock);
+  diskdone(write, t);
+
+  // Nobody is waiting for a readahead buffer; release it on
+  // behalf of the process that started it.
+  if(async)
+    brelease(b);
+}
+
+// Wait for the request started on b to finish.
+void
+bwait(struct buf *b)
+{
+  acquire(&bcache.iolock);
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID)
+    sleep(b, &bcache.iolock);
+  release(&bcache.iolock);
+}
+
+// Return a locked buf for the indicated block, whose
+// contents may still be arriving; call bwait() first.
 struct buf*
-bread(uint dev, uint blockno)
+bread_async(uint dev, uint blockno)
 {
   struct buf *b;
 
-  b = bget(dev, blockno);
+  b = bget(dev, blockno, 0);
   if((b->flags & B_VALID) == 0) {
-    iderw(b);
+    if(myproc())
+      myproc()->nbread++;
+    bstart(b);
   }
   return b;
 }
 
-// Write b's contents to disk.  Must be locked.
+// Return a locked buf with the contents of the indicated block.
+struct buf*
+bread(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  b = bread_async(dev, blockno);
+  bwait(b);
+  return b;
+}
+
+// Start reading the indicated block into the cache, if it is
+// not there already, without waiting for it.
 void
-bwrite(struct buf *b)
+breadahead(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  if((b = bget(dev, blockno, 1)) == 0)
+    return;
+  if(myproc())
+    myproc()->nbread++;
+  b->flags |= B_ASYNC;
+  bstart(b);
+  // biodone() releases b, perhaps already has; until then
+  // nobody should spin waiting for this process to.  The
+  // extra reference from bget() keeps b from being recycled.
+  disownsleep(&b->lock);
+  bunref(b);
+}
+
+// Start writing b's contents to disk; call bwait() before
+// releasing it.  Must be locked.
+void
+bwrite_async(struct buf *b)
 {
   if(!holdingsleep(&b->lock))
     panic("bwrite");
   b->flags |= B_DIRTY;
-  iderw(b);
+  if(myproc())
+    myproc()->nbwrite++;
+  bstart(b);
+}
+
+// Write b's contents to disk.  Must be locked.
+void
+bwrite(struct buf *b)
+{
+  bwrite_async(b);
+  bwait(b);
 }
 
 // Release a locked buffer.
-// Move to the head of the MRU list.
 void
 brelse(struct buf *b)
 {
   if(!holdingsleep(&b->lock))
     panic("brelse");
+  brelease(b);
+}
 
+static void
+brelease(struct buf *b)
+{
   releasesleep(&b->lock);
+  bunref(b);
+}
+
+static void
+bunref(struct buf *b)
+{
+  struct bucket *bk;
 
-  acquire(&bcache.lock);
+  bk = bucketfor(b->dev, b->blockno);
+  acquire(&bk->lock);
   b->refcnt--;
-  if (b->refcnt == 0) {
-    // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+  release(&bk->lock);
+}
+
+//PAGEBREAK!
+// Give a page of buffers back to kalloc(), if one has
+// no buffer in use.  Called by kalloc() when it runs out
+// of memory, so the caller must not hold evictlock.
+// Returns 1 if a page was freed.
+int
+bshrink(void)
+{
+  struct bufpage *pg, **pp;
+  struct buf *b, **bp;
+  struct bucket *bk;
+  int i, idle;
+
+  acquire(&bcache.evictlock);
+  for(pp = &bcache.pages; (pg = *pp) != 0; pp = &pg->next){
+    // Take the page's buffers out of their buckets, so that no
+    // hit can find them, as long as each turns out to be idle.
+    // Only a miss could put a block back, and those wait for
+    // evictlock.
+    b = pagebufs(pg);
+    for(i = 0; i < BPP; i++){
+      if(b[i].dev == NODEV)
+        continue;
+      bk = bucketfor(b[i].dev, b[i].blockno);
+      acquire(&bk->lock);
+      idle = b[i].refcnt == 0 && (b[i].flags & B_DIRTY) == 0;
+      if(idle){
+        for(bp = &bk->head; *bp != &b[i]; bp = &(*bp)->hnext)
+          ;
+        *bp = b[i].hnext;
+      }
+      release(&bk->lock);
+      if(!idle)
+        break;
+    }
+
+    if(i < BPP){
+      // Some buffer is busy; put back the ones taken out.
+      while(--i >= 0){
+        if(b[i].dev == NODEV)
+          continue;
+        bk = bucketfor(b[i].dev, b[i].blockno);
+        acquire(&bk->lock);
+        b[i].hnext = bk->head;
+        bk->head = &b[i];
+        release(&bk->lock);
+      }
+      continue;
+    }
+
+    for(bp = &bcache.spare; *bp; ){
+      if((char*)*bp >= (char*)pg && (char*)*bp < (char*)pg + PGSIZE)
+        *bp = (*bp)->hnext;
+      else
+        bp = &(*bp)->hnext;
+    }
+    for(i = 0; i < BPP; i++){
+      removebuf(&b[i]);
+      freelock(&b[i].lock.lk);
+    }
+    *pp = pg->next;
+    bcache.npage--;
+    release(&bcache.evictlock);
+    kfree((char*)pg);
+    return 1;
   }
-  
-  release(&bcache.lock);
+  release(&bcache.evictlock);
+  return 0;
 }
+
+// Copy the disk and buffer cache statistics to st.
+void
+getdiskstat(struct diskstat *st)
+{
+  int i;
+
+  *st = diskstat;
+  st->nhit = 0;
+  for(i = 0; i < ncpu; i++)
+    st->nhit += cpus[i].nbhit;
+  st->nmiss = bcache.nmiss;
+  st->nbuf = bcache.nbuf;
+}
+
 //PAGEBREAK!
 // Blank page.
 
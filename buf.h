@@ -4,11 +4,15 @@ struct buf {
   uint blockno;
   struct sleeplock lock;
   uint refcnt;
-  struct buf *prev; // LRU cache list
-  struct buf *next;
+  int used;          // Used since the clock hand passed?
+  struct buf *hnext; // hash bucket chain, or spare list
+  struct buf *anext; // ring of all buffers, for the clock
+  struct buf *aprev;
   struct buf *qnext; // disk queue
+  uint64 qtime;      // TSC when queued for the disk
   uchar data[BSIZE];
 };
 #define B_VALID 0x2  // buffer has been read from disk
 #define B_DIRTY 0x4  // buffer needs to be written to disk
+#define B_ASYNC 0x8  // buffer is being read ahead
 
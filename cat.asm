@@ -0,0 +1,1625 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 01 00 00 00       	mov    $0x1,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7f 26                	jg     4f <main+0x4f>
+  29:	eb 52                	jmp    7d <main+0x7d>
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+  30:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 1; i < argc; i++){
+  33:	83 c6 01             	add    $0x1,%esi
+  36:	83 c3 04             	add    $0x4,%ebx
+    cat(fd);
+  39:	50                   	push   %eax
+  3a:	e8 51 00 00 00       	call   90 <cat>
+    close(fd);
+  3f:	89 3c 24             	mov    %edi,(%esp)
+  42:	e8 53 04 00 00       	call   49a <close>
+  for(i = 1; i < argc; i++){
+  47:	83 c4 10             	add    $0x10,%esp
+  4a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  4d:	74 29                	je     78 <main+0x78>
+    if((fd = open(argv[i], 0)) < 0){
+  4f:	83 ec 08             	sub    $0x8,%esp
+  52:	6a 00                	push   $0x0
+  54:	ff 33                	push   (%ebx)
+  56:	e8 96 04 00 00       	call   4f1 <open>
+  5b:	83 c4 10             	add    $0x10,%esp
+  5e:	89 c7                	mov    %eax,%edi
+  60:	85 c0                	test   %eax,%eax
+  62:	79 cc                	jns    30 <main+0x30>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  64:	50                   	push   %eax
+  65:	ff 33                	push   (%ebx)
+  67:	68 eb 0b 00 00       	push   $0xbeb
+  6c:	6a 01                	push   $0x1
+  6e:	e8 2d 08 00 00       	call   8a0 <printf>
+      exit();
+  73:	e8 91 03 00 00       	call   409 <exit>
+  }
+  exit();
+  78:	e8 8c 03 00 00       	call   409 <exit>
+    cat(0);
+  7d:	83 ec 0c             	sub    $0xc,%esp
+  80:	6a 00                	push   $0x0
+  82:	e8 09 00 00 00       	call   90 <cat>
+    exit();
+  87:	e8 7d 03 00 00       	call   409 <exit>
+  8c:	66 90                	xchg   %ax,%ax
+  8e:	66 90                	xchg   %ax,%ax
+
+00000090 <cat>:
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	56                   	push   %esi
+  94:	53                   	push   %ebx
+  95:	8b 75 08             	mov    0x8(%ebp),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  98:	eb 1d                	jmp    b7 <cat+0x27>
+  9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if (write(1, buf, n) != n) {
+  a0:	83 ec 04             	sub    $0x4,%esp
+  a3:	53                   	push   %ebx
+  a4:	68 a0 0f 00 00       	push   $0xfa0
+  a9:	6a 01                	push   $0x1
+  ab:	e8 cd 03 00 00       	call   47d <write>
+  b0:	83 c4 10             	add    $0x10,%esp
+  b3:	39 d8                	cmp    %ebx,%eax
+  b5:	75 25                	jne    dc <cat+0x4c>
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  b7:	83 ec 04             	sub    $0x4,%esp
+  ba:	68 00 02 00 00       	push   $0x200
+  bf:	68 a0 0f 00 00       	push   $0xfa0
+  c4:	56                   	push   %esi
+  c5:	e8 96 03 00 00       	call   460 <read>
+  ca:	83 c4 10             	add    $0x10,%esp
+  cd:	89 c3                	mov    %eax,%ebx
+  cf:	85 c0                	test   %eax,%eax
+  d1:	7f cd                	jg     a0 <cat+0x10>
+  if(n < 0){
+  d3:	75 1b                	jne    f0 <cat+0x60>
+}
+  d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  d8:	5b                   	pop    %ebx
+  d9:	5e                   	pop    %esi
+  da:	5d                   	pop    %ebp
+  db:	c3                   	ret
+      printf(1, "cat: write error\n");
+  dc:	83 ec 08             	sub    $0x8,%esp
+  df:	68 c8 0b 00 00       	push   $0xbc8
+  e4:	6a 01                	push   $0x1
+  e6:	e8 b5 07 00 00       	call   8a0 <printf>
+      exit();
+  eb:	e8 19 03 00 00       	call   409 <exit>
+    printf(1, "cat: read error\n");
+  f0:	50                   	push   %eax
+  f1:	50                   	push   %eax
+  f2:	68 da 0b 00 00       	push   $0xbda
+  f7:	6a 01                	push   $0x1
+  f9:	e8 a2 07 00 00       	call   8a0 <printf>
+    exit();
+  fe:	e8 06 03 00 00       	call   409 <exit>
+ 103:	66 90                	xchg   %ax,%ax
+ 105:	66 90                	xchg   %ax,%ax
+ 107:	66 90                	xchg   %ax,%ax
+ 109:	66 90                	xchg   %ax,%ax
+ 10b:	66 90                	xchg   %ax,%ax
+ 10d:	66 90                	xchg   %ax,%ax
+ 10f:	90                   	nop
+
+00000110 <strcpy>:
+#include "date.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 110:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 111:	31 c0                	xor    %eax,%eax
+{
+ 113:	89 e5                	mov    %esp,%ebp
+ 115:	53                   	push   %ebx
+ 116:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 119:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 11c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 120:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 124:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 127:	83 c0 01             	add    $0x1,%eax
+ 12a:	84 d2                	test   %dl,%dl
+ 12c:	75 f2                	jne    120 <strcpy+0x10>
+    ;
+  return os;
+}
+ 12e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 131:	89 c8                	mov    %ecx,%eax
+ 133:	c9                   	leave
+ 134:	c3                   	ret
+ 135:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000140 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	53                   	push   %ebx
+ 144:	8b 55 08             	mov    0x8(%ebp),%edx
+ 147:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 14a:	0f b6 02             	movzbl (%edx),%eax
+ 14d:	84 c0                	test   %al,%al
+ 14f:	75 17                	jne    168 <strcmp+0x28>
+ 151:	eb 3a                	jmp    18d <strcmp+0x4d>
+ 153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 157:	90                   	nop
+ 158:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 15c:	83 c2 01             	add    $0x1,%edx
+ 15f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 162:	84 c0                	test   %al,%al
+ 164:	74 1a                	je     180 <strcmp+0x40>
+    p++, q++;
+ 166:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 168:	0f b6 19             	movzbl (%ecx),%ebx
+ 16b:	38 c3                	cmp    %al,%bl
+ 16d:	74 e9                	je     158 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 16f:	29 d8                	sub    %ebx,%eax
+}
+ 171:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 174:	c9                   	leave
+ 175:	c3                   	ret
+ 176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 180:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 184:	31 c0                	xor    %eax,%eax
+ 186:	29 d8                	sub    %ebx,%eax
+}
+ 188:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 18b:	c9                   	leave
+ 18c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 18d:	0f b6 19             	movzbl (%ecx),%ebx
+ 190:	31 c0                	xor    %eax,%eax
+ 192:	eb db                	jmp    16f <strcmp+0x2f>
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1a6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1a9:	74 15                	je     1c0 <strlen+0x20>
+ 1ab:	31 c0                	xor    %eax,%eax
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+ 1b0:	83 c0 01             	add    $0x1,%eax
+ 1b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1b7:	89 c1                	mov    %eax,%ecx
+ 1b9:	75 f5                	jne    1b0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1bb:	89 c8                	mov    %ecx,%eax
+ 1bd:	5d                   	pop    %ebp
+ 1be:	c3                   	ret
+ 1bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1c0:	31 c9                	xor    %ecx,%ecx
+}
+ 1c2:	5d                   	pop    %ebp
+ 1c3:	89 c8                	mov    %ecx,%eax
+ 1c5:	c3                   	ret
+ 1c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	57                   	push   %edi
+ 1d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1da:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1dd:	89 d7                	mov    %edx,%edi
+ 1df:	fc                   	cld
+ 1e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1e5:	89 d0                	mov    %edx,%eax
+ 1e7:	c9                   	leave
+ 1e8:	c3                   	ret
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1fa:	0f b6 10             	movzbl (%eax),%edx
+ 1fd:	84 d2                	test   %dl,%dl
+ 1ff:	75 12                	jne    213 <strchr+0x23>
+ 201:	eb 1d                	jmp    220 <strchr+0x30>
+ 203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 207:	90                   	nop
+ 208:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 20c:	83 c0 01             	add    $0x1,%eax
+ 20f:	84 d2                	test   %dl,%dl
+ 211:	74 0d                	je     220 <strchr+0x30>
+    if(*s == c)
+ 213:	38 d1                	cmp    %dl,%cl
+ 215:	75 f1                	jne    208 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 217:	5d                   	pop    %ebp
+ 218:	c3                   	ret
+ 219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 220:	31 c0                	xor    %eax,%eax
+}
+ 222:	5d                   	pop    %ebp
+ 223:	c3                   	ret
+ 224:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 22f:	90                   	nop
+
+00000230 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	57                   	push   %edi
+ 234:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 235:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 238:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 239:	31 db                	xor    %ebx,%ebx
+{
+ 23b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 23e:	eb 27                	jmp    267 <gets+0x37>
+    cc = read(0, &c, 1);
+ 240:	83 ec 04             	sub    $0x4,%esp
+ 243:	6a 01                	push   $0x1
+ 245:	56                   	push   %esi
+ 246:	6a 00                	push   $0x0
+ 248:	e8 13 02 00 00       	call   460 <read>
+    if(cc < 1)
+ 24d:	83 c4 10             	add    $0x10,%esp
+ 250:	85 c0                	test   %eax,%eax
+ 252:	7e 1d                	jle    271 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 254:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 258:	8b 55 08             	mov    0x8(%ebp),%edx
+ 25b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 25f:	3c 0a                	cmp    $0xa,%al
+ 261:	74 10                	je     273 <gets+0x43>
+ 263:	3c 0d                	cmp    $0xd,%al
+ 265:	74 0c                	je     273 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 267:	89 df                	mov    %ebx,%edi
+ 269:	83 c3 01             	add    $0x1,%ebx
+ 26c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 26f:	7c cf                	jl     240 <gets+0x10>
+ 271:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 273:	8b 45 08             	mov    0x8(%ebp),%eax
+ 276:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 27a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 27d:	5b                   	pop    %ebx
+ 27e:	5e                   	pop    %esi
+ 27f:	5f                   	pop    %edi
+ 280:	5d                   	pop    %ebp
+ 281:	c3                   	ret
+ 282:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	56                   	push   %esi
+ 294:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 295:	83 ec 08             	sub    $0x8,%esp
+ 298:	6a 00                	push   $0x0
+ 29a:	ff 75 08             	push   0x8(%ebp)
+ 29d:	e8 4f 02 00 00       	call   4f1 <open>
+  if(fd < 0)
+ 2a2:	83 c4 10             	add    $0x10,%esp
+ 2a5:	85 c0                	test   %eax,%eax
+ 2a7:	78 27                	js     2d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2a9:	83 ec 08             	sub    $0x8,%esp
+ 2ac:	ff 75 0c             	push   0xc(%ebp)
+ 2af:	89 c3                	mov    %eax,%ebx
+ 2b1:	50                   	push   %eax
+ 2b2:	e8 91 02 00 00       	call   548 <fstat>
+  close(fd);
+ 2b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2bc:	e8 d9 01 00 00       	call   49a <close>
+  return r;
+ 2c1:	83 c4 10             	add    $0x10,%esp
+}
+ 2c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2c7:	89 f0                	mov    %esi,%eax
+ 2c9:	5b                   	pop    %ebx
+ 2ca:	5e                   	pop    %esi
+ 2cb:	5d                   	pop    %ebp
+ 2cc:	c3                   	ret
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2d5:	eb ed                	jmp    2c4 <stat+0x34>
+ 2d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2de:	66 90                	xchg   %ax,%ax
+
+000002e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	53                   	push   %ebx
+ 2e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2e7:	0f be 02             	movsbl (%edx),%eax
+ 2ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2f5:	77 1e                	ja     315 <atoi+0x35>
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 300:	83 c2 01             	add    $0x1,%edx
+ 303:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 306:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 30a:	0f be 02             	movsbl (%edx),%eax
+ 30d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 310:	80 fb 09             	cmp    $0x9,%bl
+ 313:	76 eb                	jbe    300 <atoi+0x20>
+  return n;
+}
+ 315:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 318:	89 c8                	mov    %ecx,%eax
+ 31a:	c9                   	leave
+ 31b:	c3                   	ret
+ 31c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000320 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	57                   	push   %edi
+ 324:	56                   	push   %esi
+ 325:	8b 45 10             	mov    0x10(%ebp),%eax
+ 328:	8b 55 08             	mov    0x8(%ebp),%edx
+ 32b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 32e:	85 c0                	test   %eax,%eax
+ 330:	7e 13                	jle    345 <memmove+0x25>
+ 332:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 334:	89 d7                	mov    %edx,%edi
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 340:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 341:	39 f8                	cmp    %edi,%eax
+ 343:	75 fb                	jne    340 <memmove+0x20>
+  return vdst;
+}
+ 345:	5e                   	pop    %esi
+ 346:	89 d0                	mov    %edx,%eax
+ 348:	5f                   	pop    %edi
+ 349:	5d                   	pop    %ebp
+ 34a:	c3                   	ret
+ 34b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 34f:	90                   	nop
+
+00000350 <ugetpid>:
+// getpid() without a system call, from the page at UPROC.
+int
+ugetpid(void)
+{
+  return ((struct uproc*)UPROC)->pid;
+}
+ 350:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+ 355:	c3                   	ret
+ 356:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000360 <uclocktime>:
+
+// clocktime() without a system call, from the page at UCLOCK.
+int
+uclocktime(struct timespec *ts)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	57                   	push   %edi
+ 364:	56                   	push   %esi
+ 365:	53                   	push   %ebx
+ 366:	83 ec 1c             	sub    $0x1c,%esp
+  struct uclock *c = (struct uclock*)UCLOCK;
+
+  if(c->tscmult == 0)
+ 369:	8b 0d 08 f0 ff 7f    	mov    0x7ffff008,%ecx
+{
+ 36f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(c->tscmult == 0)
+ 372:	85 c9                	test   %ecx,%ecx
+ 374:	74 6a                	je     3e0 <uclocktime+0x80>
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+ 376:	0f 31                	rdtsc
+static inline void
+uclockread(struct uclock *c, uint64 tsc, struct timespec *ts)
+{
+  uint64 d, ns;
+
+  d = tsc - c->tscbase;
+ 378:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 37e:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+ 384:	89 c6                	mov    %eax,%esi
+  if((long long)d < 0)  // another CPU's TSC is a little behind
+ 386:	85 d2                	test   %edx,%edx
+ 388:	78 46                	js     3d0 <uclocktime+0x70>
+    d = 0;
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 38a:	89 d0                	mov    %edx,%eax
+ 38c:	f7 e1                	mul    %ecx
+ 38e:	0f a4 c2 08          	shld   $0x8,%eax,%edx
+ 392:	c1 e0 08             	shl    $0x8,%eax
+ 395:	89 45 e0             	mov    %eax,-0x20(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+ 398:	89 f0                	mov    %esi,%eax
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 39a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+ 39d:	f7 e1                	mul    %ecx
+ 39f:	0f ac d0 18          	shrd   $0x18,%edx,%eax
+ 3a3:	c1 ea 18             	shr    $0x18,%edx
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 3a6:	03 45 e0             	add    -0x20(%ebp),%eax
+ 3a9:	13 55 e4             	adc    -0x1c(%ebp),%edx
+// linked with libgcc, so it cannot use 64-bit '/' or '%'.
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+  asm("divl %4" : "=a" (q), "=d" (r) : "a" ((uint)n), "d" ((uint)(n>>32)), "rm" (d));
+ 3ac:	89 c7                	mov    %eax,%edi
+ 3ae:	89 f8                	mov    %edi,%eax
+ 3b0:	b9 00 ca 9a 3b       	mov    $0x3b9aca00,%ecx
+ 3b5:	f7 f1                	div    %ecx
+  ts->sec = divl(ns, 1000000000, &ts->nsec);
+ 3b7:	89 03                	mov    %eax,(%ebx)
+    return clocktime(ts);
+  uclockread(c, rdtsc(), ts);
+  return 0;
+}
+ 3b9:	31 c0                	xor    %eax,%eax
+  *rem = r;
+ 3bb:	89 53 04             	mov    %edx,0x4(%ebx)
+ 3be:	83 c4 1c             	add    $0x1c,%esp
+ 3c1:	5b                   	pop    %ebx
+ 3c2:	5e                   	pop    %esi
+ 3c3:	5f                   	pop    %edi
+ 3c4:	5d                   	pop    %ebp
+ 3c5:	c3                   	ret
+ 3c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cd:	8d 76 00             	lea    0x0(%esi),%esi
+ 3d0:	31 d2                	xor    %edx,%edx
+ 3d2:	31 ff                	xor    %edi,%edi
+ 3d4:	eb d8                	jmp    3ae <uclocktime+0x4e>
+ 3d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 3e0:	83 c4 1c             	add    $0x1c,%esp
+ 3e3:	5b                   	pop    %ebx
+ 3e4:	5e                   	pop    %esi
+ 3e5:	5f                   	pop    %edi
+ 3e6:	5d                   	pop    %ebp
+    return clocktime(ts);
+ 3e7:	e9 f2 02 00 00       	jmp    6de <clocktime>
+
+000003ec <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+ 3ec:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3f1:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 3f8:	00 00 00 
+ 3fb:	74 09                	je     406 <fork+0x1a>
+ 3fd:	89 e1                	mov    %esp,%ecx
+ 3ff:	ba 08 04 00 00       	mov    $0x408,%edx
+ 404:	0f 34                	sysenter
+ 406:	cd 40                	int    $0x40
+ 408:	c3                   	ret
+
+00000409 <exit>:
+SYSCALL(exit)
+ 409:	b8 02 00 00 00       	mov    $0x2,%eax
+ 40e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 415:	00 00 00 
+ 418:	74 09                	je     423 <exit+0x1a>
+ 41a:	89 e1                	mov    %esp,%ecx
+ 41c:	ba 25 04 00 00       	mov    $0x425,%edx
+ 421:	0f 34                	sysenter
+ 423:	cd 40                	int    $0x40
+ 425:	c3                   	ret
+
+00000426 <wait>:
+SYSCALL(wait)
+ 426:	b8 03 00 00 00       	mov    $0x3,%eax
+ 42b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 432:	00 00 00 
+ 435:	74 09                	je     440 <wait+0x1a>
+ 437:	89 e1                	mov    %esp,%ecx
+ 439:	ba 42 04 00 00       	mov    $0x442,%edx
+ 43e:	0f 34                	sysenter
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <pipe>:
+SYSCALL(pipe)
+ 443:	b8 04 00 00 00       	mov    $0x4,%eax
+ 448:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 44f:	00 00 00 
+ 452:	74 09                	je     45d <pipe+0x1a>
+ 454:	89 e1                	mov    %esp,%ecx
+ 456:	ba 5f 04 00 00       	mov    $0x45f,%edx
+ 45b:	0f 34                	sysenter
+ 45d:	cd 40                	int    $0x40
+ 45f:	c3                   	ret
+
+00000460 <read>:
+SYSCALL(read)
+ 460:	b8 05 00 00 00       	mov    $0x5,%eax
+ 465:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 46c:	00 00 00 
+ 46f:	74 09                	je     47a <read+0x1a>
+ 471:	89 e1                	mov    %esp,%ecx
+ 473:	ba 7c 04 00 00       	mov    $0x47c,%edx
+ 478:	0f 34                	sysenter
+ 47a:	cd 40                	int    $0x40
+ 47c:	c3                   	ret
+
+0000047d <write>:
+SYSCALL(write)
+ 47d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 482:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 489:	00 00 00 
+ 48c:	74 09                	je     497 <write+0x1a>
+ 48e:	89 e1                	mov    %esp,%ecx
+ 490:	ba 99 04 00 00       	mov    $0x499,%edx
+ 495:	0f 34                	sysenter
+ 497:	cd 40                	int    $0x40
+ 499:	c3                   	ret
+
+0000049a <close>:
+SYSCALL(close)
+ 49a:	b8 15 00 00 00       	mov    $0x15,%eax
+ 49f:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4a6:	00 00 00 
+ 4a9:	74 09                	je     4b4 <close+0x1a>
+ 4ab:	89 e1                	mov    %esp,%ecx
+ 4ad:	ba b6 04 00 00       	mov    $0x4b6,%edx
+ 4b2:	0f 34                	sysenter
+ 4b4:	cd 40                	int    $0x40
+ 4b6:	c3                   	ret
+
+000004b7 <kill>:
+SYSCALL(kill)
+ 4b7:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4bc:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4c3:	00 00 00 
+ 4c6:	74 09                	je     4d1 <kill+0x1a>
+ 4c8:	89 e1                	mov    %esp,%ecx
+ 4ca:	ba d3 04 00 00       	mov    $0x4d3,%edx
+ 4cf:	0f 34                	sysenter
+ 4d1:	cd 40                	int    $0x40
+ 4d3:	c3                   	ret
+
+000004d4 <exec>:
+SYSCALL(exec)
+ 4d4:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4d9:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4e0:	00 00 00 
+ 4e3:	74 09                	je     4ee <exec+0x1a>
+ 4e5:	89 e1                	mov    %esp,%ecx
+ 4e7:	ba f0 04 00 00       	mov    $0x4f0,%edx
+ 4ec:	0f 34                	sysenter
+ 4ee:	cd 40                	int    $0x40
+ 4f0:	c3                   	ret
+
+000004f1 <open>:
+SYSCALL(open)
+ 4f1:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4f6:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4fd:	00 00 00 
+ 500:	74 09                	je     50b <open+0x1a>
+ 502:	89 e1                	mov    %esp,%ecx
+ 504:	ba 0d 05 00 00       	mov    $0x50d,%edx
+ 509:	0f 34                	sysenter
+ 50b:	cd 40                	int    $0x40
+ 50d:	c3                   	ret
+
+0000050e <mknod>:
+SYSCALL(mknod)
+ 50e:	b8 11 00 00 00       	mov    $0x11,%eax
+ 513:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 51a:	00 00 00 
+ 51d:	74 09                	je     528 <mknod+0x1a>
+ 51f:	89 e1                	mov    %esp,%ecx
+ 521:	ba 2a 05 00 00       	mov    $0x52a,%edx
+ 526:	0f 34                	sysenter
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <unlink>:
+SYSCALL(unlink)
+ 52b:	b8 12 00 00 00       	mov    $0x12,%eax
+ 530:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 537:	00 00 00 
+ 53a:	74 09                	je     545 <unlink+0x1a>
+ 53c:	89 e1                	mov    %esp,%ecx
+ 53e:	ba 47 05 00 00       	mov    $0x547,%edx
+ 543:	0f 34                	sysenter
+ 545:	cd 40                	int    $0x40
+ 547:	c3                   	ret
+
+00000548 <fstat>:
+SYSCALL(fstat)
+ 548:	b8 08 00 00 00       	mov    $0x8,%eax
+ 54d:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 554:	00 00 00 
+ 557:	74 09                	je     562 <fstat+0x1a>
+ 559:	89 e1                	mov    %esp,%ecx
+ 55b:	ba 64 05 00 00       	mov    $0x564,%edx
+ 560:	0f 34                	sysenter
+ 562:	cd 40                	int    $0x40
+ 564:	c3                   	ret
+
+00000565 <link>:
+SYSCALL(link)
+ 565:	b8 13 00 00 00       	mov    $0x13,%eax
+ 56a:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 571:	00 00 00 
+ 574:	74 09                	je     57f <link+0x1a>
+ 576:	89 e1                	mov    %esp,%ecx
+ 578:	ba 81 05 00 00       	mov    $0x581,%edx
+ 57d:	0f 34                	sysenter
+ 57f:	cd 40                	int    $0x40
+ 581:	c3                   	ret
+
+00000582 <mkdir>:
+SYSCALL(mkdir)
+ 582:	b8 14 00 00 00       	mov    $0x14,%eax
+ 587:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 58e:	00 00 00 
+ 591:	74 09                	je     59c <mkdir+0x1a>
+ 593:	89 e1                	mov    %esp,%ecx
+ 595:	ba 9e 05 00 00       	mov    $0x59e,%edx
+ 59a:	0f 34                	sysenter
+ 59c:	cd 40                	int    $0x40
+ 59e:	c3                   	ret
+
+0000059f <chdir>:
+SYSCALL(chdir)
+ 59f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5a4:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5ab:	00 00 00 
+ 5ae:	74 09                	je     5b9 <chdir+0x1a>
+ 5b0:	89 e1                	mov    %esp,%ecx
+ 5b2:	ba bb 05 00 00       	mov    $0x5bb,%edx
+ 5b7:	0f 34                	sysenter
+ 5b9:	cd 40                	int    $0x40
+ 5bb:	c3                   	ret
+
+000005bc <dup>:
+SYSCALL(dup)
+ 5bc:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5c1:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5c8:	00 00 00 
+ 5cb:	74 09                	je     5d6 <dup+0x1a>
+ 5cd:	89 e1                	mov    %esp,%ecx
+ 5cf:	ba d8 05 00 00       	mov    $0x5d8,%edx
+ 5d4:	0f 34                	sysenter
+ 5d6:	cd 40                	int    $0x40
+ 5d8:	c3                   	ret
+
+000005d9 <getpid>:
+SYSCALL(getpid)
+ 5d9:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5de:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5e5:	00 00 00 
+ 5e8:	74 09                	je     5f3 <getpid+0x1a>
+ 5ea:	89 e1                	mov    %esp,%ecx
+ 5ec:	ba f5 05 00 00       	mov    $0x5f5,%edx
+ 5f1:	0f 34                	sysenter
+ 5f3:	cd 40                	int    $0x40
+ 5f5:	c3                   	ret
+
+000005f6 <sbrk>:
+SYSCALL(sbrk)
+ 5f6:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5fb:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 602:	00 00 00 
+ 605:	74 09                	je     610 <sbrk+0x1a>
+ 607:	89 e1                	mov    %esp,%ecx
+ 609:	ba 12 06 00 00       	mov    $0x612,%edx
+ 60e:	0f 34                	sysenter
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <sleep>:
+SYSCALL(sleep)
+ 613:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 618:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 61f:	00 00 00 
+ 622:	74 09                	je     62d <sleep+0x1a>
+ 624:	89 e1                	mov    %esp,%ecx
+ 626:	ba 2f 06 00 00       	mov    $0x62f,%edx
+ 62b:	0f 34                	sysenter
+ 62d:	cd 40                	int    $0x40
+ 62f:	c3                   	ret
+
+00000630 <uptime>:
+SYSCALL(uptime)
+ 630:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 635:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 63c:	00 00 00 
+ 63f:	74 09                	je     64a <uptime+0x1a>
+ 641:	89 e1                	mov    %esp,%ecx
+ 643:	ba 4c 06 00 00       	mov    $0x64c,%edx
+ 648:	0f 34                	sysenter
+ 64a:	cd 40                	int    $0x40
+ 64c:	c3                   	ret
+
+0000064d <swapread>:
+SYSCALL(swapread)
+ 64d:	b8 16 00 00 00       	mov    $0x16,%eax
+ 652:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 659:	00 00 00 
+ 65c:	74 09                	je     667 <swapread+0x1a>
+ 65e:	89 e1                	mov    %esp,%ecx
+ 660:	ba 69 06 00 00       	mov    $0x669,%edx
+ 665:	0f 34                	sysenter
+ 667:	cd 40                	int    $0x40
+ 669:	c3                   	ret
+
+0000066a <swapwrite>:
+SYSCALL(swapwrite)
+ 66a:	b8 17 00 00 00       	mov    $0x17,%eax
+ 66f:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 676:	00 00 00 
+ 679:	74 09                	je     684 <swapwrite+0x1a>
+ 67b:	89 e1                	mov    %esp,%ecx
+ 67d:	ba 86 06 00 00       	mov    $0x686,%edx
+ 682:	0f 34                	sysenter
+ 684:	cd 40                	int    $0x40
+ 686:	c3                   	ret
+
+00000687 <setaffinity>:
+SYSCALL(setaffinity)
+ 687:	b8 18 00 00 00       	mov    $0x18,%eax
+ 68c:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 693:	00 00 00 
+ 696:	74 09                	je     6a1 <setaffinity+0x1a>
+ 698:	89 e1                	mov    %esp,%ecx
+ 69a:	ba a3 06 00 00       	mov    $0x6a3,%edx
+ 69f:	0f 34                	sysenter
+ 6a1:	cd 40                	int    $0x40
+ 6a3:	c3                   	ret
+
+000006a4 <getaffinity>:
+SYSCALL(getaffinity)
+ 6a4:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6a9:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6b0:	00 00 00 
+ 6b3:	74 09                	je     6be <getaffinity+0x1a>
+ 6b5:	89 e1                	mov    %esp,%ecx
+ 6b7:	ba c0 06 00 00       	mov    $0x6c0,%edx
+ 6bc:	0f 34                	sysenter
+ 6be:	cd 40                	int    $0x40
+ 6c0:	c3                   	ret
+
+000006c1 <nanosleep>:
+SYSCALL(nanosleep)
+ 6c1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6c6:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6cd:	00 00 00 
+ 6d0:	74 09                	je     6db <nanosleep+0x1a>
+ 6d2:	89 e1                	mov    %esp,%ecx
+ 6d4:	ba dd 06 00 00       	mov    $0x6dd,%edx
+ 6d9:	0f 34                	sysenter
+ 6db:	cd 40                	int    $0x40
+ 6dd:	c3                   	ret
+
+000006de <clocktime>:
+SYSCALL(clocktime)
+ 6de:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6e3:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6ea:	00 00 00 
+ 6ed:	74 09                	je     6f8 <clocktime+0x1a>
+ 6ef:	89 e1                	mov    %esp,%ecx
+ 6f1:	ba fa 06 00 00       	mov    $0x6fa,%edx
+ 6f6:	0f 34                	sysenter
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <batch>:
+SYSCALL(batch)
+ 6fb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 700:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 707:	00 00 00 
+ 70a:	74 09                	je     715 <batch+0x1a>
+ 70c:	89 e1                	mov    %esp,%ecx
+ 70e:	ba 17 07 00 00       	mov    $0x717,%edx
+ 713:	0f 34                	sysenter
+ 715:	cd 40                	int    $0x40
+ 717:	c3                   	ret
+
+00000718 <aiosetup>:
+SYSCALL(aiosetup)
+ 718:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 71d:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 724:	00 00 00 
+ 727:	74 09                	je     732 <aiosetup+0x1a>
+ 729:	89 e1                	mov    %esp,%ecx
+ 72b:	ba 34 07 00 00       	mov    $0x734,%edx
+ 730:	0f 34                	sysenter
+ 732:	cd 40                	int    $0x40
+ 734:	c3                   	ret
+
+00000735 <aiowait>:
+SYSCALL(aiowait)
+ 735:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 73a:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 741:	00 00 00 
+ 744:	74 09                	je     74f <aiowait+0x1a>
+ 746:	89 e1                	mov    %esp,%ecx
+ 748:	ba 51 07 00 00       	mov    $0x751,%edx
+ 74d:	0f 34                	sysenter
+ 74f:	cd 40                	int    $0x40
+ 751:	c3                   	ret
+
+00000752 <spawn>:
+SYSCALL(spawn)
+ 752:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 757:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 75e:	00 00 00 
+ 761:	74 09                	je     76c <spawn+0x1a>
+ 763:	89 e1                	mov    %esp,%ecx
+ 765:	ba 6e 07 00 00       	mov    $0x76e,%edx
+ 76a:	0f 34                	sysenter
+ 76c:	cd 40                	int    $0x40
+ 76e:	c3                   	ret
+
+0000076f <getprocinfo>:
+SYSCALL(getprocinfo)
+ 76f:	b8 20 00 00 00       	mov    $0x20,%eax
+ 774:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 77b:	00 00 00 
+ 77e:	74 09                	je     789 <getprocinfo+0x1a>
+ 780:	89 e1                	mov    %esp,%ecx
+ 782:	ba 8b 07 00 00       	mov    $0x78b,%edx
+ 787:	0f 34                	sysenter
+ 789:	cd 40                	int    $0x40
+ 78b:	c3                   	ret
+
+0000078c <getlockstat>:
+SYSCALL(getlockstat)
+ 78c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 791:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 798:	00 00 00 
+ 79b:	74 09                	je     7a6 <getlockstat+0x1a>
+ 79d:	89 e1                	mov    %esp,%ecx
+ 79f:	ba a8 07 00 00       	mov    $0x7a8,%edx
+ 7a4:	0f 34                	sysenter
+ 7a6:	cd 40                	int    $0x40
+ 7a8:	c3                   	ret
+
+000007a9 <lockprof>:
+SYSCALL(lockprof)
+ 7a9:	b8 22 00 00 00       	mov    $0x22,%eax
+ 7ae:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 7b5:	00 00 00 
+ 7b8:	74 09                	je     7c3 <lockprof+0x1a>
+ 7ba:	89 e1                	mov    %esp,%ecx
+ 7bc:	ba c5 07 00 00       	mov    $0x7c5,%edx
+ 7c1:	0f 34                	sysenter
+ 7c3:	cd 40                	int    $0x40
+ 7c5:	c3                   	ret
+
+000007c6 <getlockprof>:
+SYSCALL(getlockprof)
+ 7c6:	b8 23 00 00 00       	mov    $0x23,%eax
+ 7cb:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 7d2:	00 00 00 
+ 7d5:	74 09                	je     7e0 <getlockprof+0x1a>
+ 7d7:	89 e1                	mov    %esp,%ecx
+ 7d9:	ba e2 07 00 00       	mov    $0x7e2,%edx
+ 7de:	0f 34                	sysenter
+ 7e0:	cd 40                	int    $0x40
+ 7e2:	c3                   	ret
+
+000007e3 <diskstat>:
+SYSCALL(diskstat)
+ 7e3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 7e8:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 7ef:	00 00 00 
+ 7f2:	74 09                	je     7fd <diskstat+0x1a>
+ 7f4:	89 e1                	mov    %esp,%ecx
+ 7f6:	ba ff 07 00 00       	mov    $0x7ff,%edx
+ 7fb:	0f 34                	sysenter
+ 7fd:	cd 40                	int    $0x40
+ 7ff:	c3                   	ret
+
+00000800 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 800:	55                   	push   %ebp
+ 801:	89 e5                	mov    %esp,%ebp
+ 803:	57                   	push   %edi
+ 804:	56                   	push   %esi
+ 805:	53                   	push   %ebx
+ 806:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 808:	89 d1                	mov    %edx,%ecx
+{
+ 80a:	83 ec 3c             	sub    $0x3c,%esp
+ 80d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 810:	85 d2                	test   %edx,%edx
+ 812:	0f 89 80 00 00 00    	jns    898 <printint+0x98>
+ 818:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 81c:	74 7a                	je     898 <printint+0x98>
+    x = -xx;
+ 81e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 820:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 825:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 828:	31 f6                	xor    %esi,%esi
+ 82a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 830:	89 c8                	mov    %ecx,%eax
+ 832:	31 d2                	xor    %edx,%edx
+ 834:	89 f7                	mov    %esi,%edi
+ 836:	f7 f3                	div    %ebx
+ 838:	8d 76 01             	lea    0x1(%esi),%esi
+ 83b:	0f b6 92 60 0c 00 00 	movzbl 0xc60(%edx),%edx
+ 842:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 846:	89 ca                	mov    %ecx,%edx
+ 848:	89 c1                	mov    %eax,%ecx
+ 84a:	39 da                	cmp    %ebx,%edx
+ 84c:	73 e2                	jae    830 <printint+0x30>
+  if(neg)
+ 84e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 851:	85 c0                	test   %eax,%eax
+ 853:	74 07                	je     85c <printint+0x5c>
+    buf[i++] = '-';
+ 855:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 85a:	89 f7                	mov    %esi,%edi
+ 85c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 85f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 862:	01 df                	add    %ebx,%edi
+ 864:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 868:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 86b:	83 ec 04             	sub    $0x4,%esp
+ 86e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 871:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 874:	6a 01                	push   $0x1
+ 876:	50                   	push   %eax
+ 877:	56                   	push   %esi
+ 878:	e8 00 fc ff ff       	call   47d <write>
+  while(--i >= 0)
+ 87d:	89 f8                	mov    %edi,%eax
+ 87f:	83 c4 10             	add    $0x10,%esp
+ 882:	83 ef 01             	sub    $0x1,%edi
+ 885:	39 d8                	cmp    %ebx,%eax
+ 887:	75 df                	jne    868 <printint+0x68>
+}
+ 889:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 88c:	5b                   	pop    %ebx
+ 88d:	5e                   	pop    %esi
+ 88e:	5f                   	pop    %edi
+ 88f:	5d                   	pop    %ebp
+ 890:	c3                   	ret
+ 891:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 898:	31 c0                	xor    %eax,%eax
+ 89a:	eb 89                	jmp    825 <printint+0x25>
+ 89c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008a0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 8a0:	55                   	push   %ebp
+ 8a1:	89 e5                	mov    %esp,%ebp
+ 8a3:	57                   	push   %edi
+ 8a4:	56                   	push   %esi
+ 8a5:	53                   	push   %ebx
+ 8a6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 8a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 8ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 8af:	0f b6 1e             	movzbl (%esi),%ebx
+ 8b2:	83 c6 01             	add    $0x1,%esi
+ 8b5:	84 db                	test   %bl,%bl
+ 8b7:	74 67                	je     920 <printf+0x80>
+ 8b9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 8bc:	31 d2                	xor    %edx,%edx
+ 8be:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 8c1:	eb 34                	jmp    8f7 <printf+0x57>
+ 8c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8c7:	90                   	nop
+ 8c8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 8cb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 8d0:	83 f8 25             	cmp    $0x25,%eax
+ 8d3:	74 18                	je     8ed <printf+0x4d>
+  write(fd, &c, 1);
+ 8d5:	83 ec 04             	sub    $0x4,%esp
+ 8d8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 8db:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8de:	6a 01                	push   $0x1
+ 8e0:	50                   	push   %eax
+ 8e1:	57                   	push   %edi
+ 8e2:	e8 96 fb ff ff       	call   47d <write>
+ 8e7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 8ea:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 8ed:	0f b6 1e             	movzbl (%esi),%ebx
+ 8f0:	83 c6 01             	add    $0x1,%esi
+ 8f3:	84 db                	test   %bl,%bl
+ 8f5:	74 29                	je     920 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 8f7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 8fa:	85 d2                	test   %edx,%edx
+ 8fc:	74 ca                	je     8c8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 8fe:	83 fa 25             	cmp    $0x25,%edx
+ 901:	75 ea                	jne    8ed <printf+0x4d>
+      if(c == 'd'){
+ 903:	83 f8 25             	cmp    $0x25,%eax
+ 906:	0f 84 24 01 00 00    	je     a30 <printf+0x190>
+ 90c:	83 e8 63             	sub    $0x63,%eax
+ 90f:	83 f8 15             	cmp    $0x15,%eax
+ 912:	77 1c                	ja     930 <printf+0x90>
+ 914:	ff 24 85 08 0c 00 00 	jmp    *0xc08(,%eax,4)
+ 91b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 91f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 920:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 923:	5b                   	pop    %ebx
+ 924:	5e                   	pop    %esi
+ 925:	5f                   	pop    %edi
+ 926:	5d                   	pop    %ebp
+ 927:	c3                   	ret
+ 928:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 92f:	90                   	nop
+  write(fd, &c, 1);
+ 930:	83 ec 04             	sub    $0x4,%esp
+ 933:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 936:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 93a:	6a 01                	push   $0x1
+ 93c:	52                   	push   %edx
+ 93d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 940:	57                   	push   %edi
+ 941:	e8 37 fb ff ff       	call   47d <write>
+ 946:	83 c4 0c             	add    $0xc,%esp
+ 949:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 94c:	6a 01                	push   $0x1
+ 94e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 951:	52                   	push   %edx
+ 952:	57                   	push   %edi
+ 953:	e8 25 fb ff ff       	call   47d <write>
+        putc(fd, c);
+ 958:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 95b:	31 d2                	xor    %edx,%edx
+ 95d:	eb 8e                	jmp    8ed <printf+0x4d>
+ 95f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 960:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 963:	83 ec 0c             	sub    $0xc,%esp
+ 966:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 96b:	8b 13                	mov    (%ebx),%edx
+ 96d:	6a 00                	push   $0x0
+ 96f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 971:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 974:	e8 87 fe ff ff       	call   800 <printint>
+        ap++;
+ 979:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 97c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 97f:	31 d2                	xor    %edx,%edx
+ 981:	e9 67 ff ff ff       	jmp    8ed <printf+0x4d>
+ 986:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 98d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 990:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 993:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 995:	83 c0 04             	add    $0x4,%eax
+ 998:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 99b:	85 db                	test   %ebx,%ebx
+ 99d:	0f 84 9d 00 00 00    	je     a40 <printf+0x1a0>
+        while(*s != 0){
+ 9a3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 9a6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 9a8:	84 c0                	test   %al,%al
+ 9aa:	0f 84 3d ff ff ff    	je     8ed <printf+0x4d>
+ 9b0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9b3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 9b6:	89 de                	mov    %ebx,%esi
+ 9b8:	89 d3                	mov    %edx,%ebx
+ 9ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 9c0:	83 ec 04             	sub    $0x4,%esp
+ 9c3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 9c6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 9c9:	6a 01                	push   $0x1
+ 9cb:	53                   	push   %ebx
+ 9cc:	57                   	push   %edi
+ 9cd:	e8 ab fa ff ff       	call   47d <write>
+        while(*s != 0){
+ 9d2:	0f b6 06             	movzbl (%esi),%eax
+ 9d5:	83 c4 10             	add    $0x10,%esp
+ 9d8:	84 c0                	test   %al,%al
+ 9da:	75 e4                	jne    9c0 <printf+0x120>
+      state = 0;
+ 9dc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 9df:	31 d2                	xor    %edx,%edx
+ 9e1:	e9 07 ff ff ff       	jmp    8ed <printf+0x4d>
+ 9e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ed:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 9f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 9f3:	83 ec 0c             	sub    $0xc,%esp
+ 9f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 9fb:	8b 13                	mov    (%ebx),%edx
+ 9fd:	6a 01                	push   $0x1
+ 9ff:	e9 6b ff ff ff       	jmp    96f <printf+0xcf>
+ a04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ a08:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ a0b:	83 ec 04             	sub    $0x4,%esp
+ a0e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ a11:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ a13:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ a16:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ a19:	6a 01                	push   $0x1
+ a1b:	52                   	push   %edx
+ a1c:	57                   	push   %edi
+ a1d:	e8 5b fa ff ff       	call   47d <write>
+        ap++;
+ a22:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a25:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a28:	31 d2                	xor    %edx,%edx
+ a2a:	e9 be fe ff ff       	jmp    8ed <printf+0x4d>
+ a2f:	90                   	nop
+  write(fd, &c, 1);
+ a30:	83 ec 04             	sub    $0x4,%esp
+ a33:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a36:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a39:	6a 01                	push   $0x1
+ a3b:	e9 11 ff ff ff       	jmp    951 <printf+0xb1>
+ a40:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ a45:	bb 00 0c 00 00       	mov    $0xc00,%ebx
+ a4a:	e9 61 ff ff ff       	jmp    9b0 <printf+0x110>
+ a4f:	90                   	nop
+
+00000a50 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ a50:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a51:	a1 a0 11 00 00       	mov    0x11a0,%eax
+{
+ a56:	89 e5                	mov    %esp,%ebp
+ a58:	57                   	push   %edi
+ a59:	56                   	push   %esi
+ a5a:	53                   	push   %ebx
+ a5b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ a5e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a68:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a6a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a6c:	39 ca                	cmp    %ecx,%edx
+ a6e:	73 30                	jae    aa0 <free+0x50>
+ a70:	39 c1                	cmp    %eax,%ecx
+ a72:	72 04                	jb     a78 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a74:	39 c2                	cmp    %eax,%edx
+ a76:	72 f0                	jb     a68 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a78:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ a7b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ a7e:	39 f8                	cmp    %edi,%eax
+ a80:	74 2e                	je     ab0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a82:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a85:	8b 42 04             	mov    0x4(%edx),%eax
+ a88:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a8b:	39 f1                	cmp    %esi,%ecx
+ a8d:	74 38                	je     ac7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a8f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a91:	5b                   	pop    %ebx
+  freep = p;
+ a92:	89 15 a0 11 00 00    	mov    %edx,0x11a0
+}
+ a98:	5e                   	pop    %esi
+ a99:	5f                   	pop    %edi
+ a9a:	5d                   	pop    %ebp
+ a9b:	c3                   	ret
+ a9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ aa0:	39 c1                	cmp    %eax,%ecx
+ aa2:	72 d0                	jb     a74 <free+0x24>
+ aa4:	eb c2                	jmp    a68 <free+0x18>
+ aa6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aad:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ ab0:	03 70 04             	add    0x4(%eax),%esi
+ ab3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ab6:	8b 02                	mov    (%edx),%eax
+ ab8:	8b 00                	mov    (%eax),%eax
+ aba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ abd:	8b 42 04             	mov    0x4(%edx),%eax
+ ac0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ ac3:	39 f1                	cmp    %esi,%ecx
+ ac5:	75 c8                	jne    a8f <free+0x3f>
+    p->s.size += bp->s.size;
+ ac7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ aca:	89 15 a0 11 00 00    	mov    %edx,0x11a0
+    p->s.size += bp->s.size;
+ ad0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ ad3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ ad6:	89 0a                	mov    %ecx,(%edx)
+}
+ ad8:	5b                   	pop    %ebx
+ ad9:	5e                   	pop    %esi
+ ada:	5f                   	pop    %edi
+ adb:	5d                   	pop    %ebp
+ adc:	c3                   	ret
+ add:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ae0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ ae0:	55                   	push   %ebp
+ ae1:	89 e5                	mov    %esp,%ebp
+ ae3:	57                   	push   %edi
+ ae4:	56                   	push   %esi
+ ae5:	53                   	push   %ebx
+ ae6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ae9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ aec:	8b 15 a0 11 00 00    	mov    0x11a0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ af2:	8d 78 07             	lea    0x7(%eax),%edi
+ af5:	c1 ef 03             	shr    $0x3,%edi
+ af8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ afb:	85 d2                	test   %edx,%edx
+ afd:	0f 84 8d 00 00 00    	je     b90 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b03:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b05:	8b 48 04             	mov    0x4(%eax),%ecx
+ b08:	39 f9                	cmp    %edi,%ecx
+ b0a:	73 64                	jae    b70 <malloc+0x90>
+  if(nu < 4096)
+ b0c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ b11:	39 df                	cmp    %ebx,%edi
+ b13:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ b16:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ b1d:	eb 0a                	jmp    b29 <malloc+0x49>
+ b1f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b20:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b22:	8b 48 04             	mov    0x4(%eax),%ecx
+ b25:	39 f9                	cmp    %edi,%ecx
+ b27:	73 47                	jae    b70 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ b29:	89 c2                	mov    %eax,%edx
+ b2b:	39 05 a0 11 00 00    	cmp    %eax,0x11a0
+ b31:	75 ed                	jne    b20 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ b33:	83 ec 0c             	sub    $0xc,%esp
+ b36:	56                   	push   %esi
+ b37:	e8 ba fa ff ff       	call   5f6 <sbrk>
+  if(p == (char*)-1)
+ b3c:	83 c4 10             	add    $0x10,%esp
+ b3f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b42:	74 1c                	je     b60 <malloc+0x80>
+  hp->s.size = nu;
+ b44:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ b47:	83 ec 0c             	sub    $0xc,%esp
+ b4a:	83 c0 08             	add    $0x8,%eax
+ b4d:	50                   	push   %eax
+ b4e:	e8 fd fe ff ff       	call   a50 <free>
+  return freep;
+ b53:	8b 15 a0 11 00 00    	mov    0x11a0,%edx
+      if((p = morecore(nunits)) == 0)
+ b59:	83 c4 10             	add    $0x10,%esp
+ b5c:	85 d2                	test   %edx,%edx
+ b5e:	75 c0                	jne    b20 <malloc+0x40>
+        return 0;
+  }
+}
+ b60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b63:	31 c0                	xor    %eax,%eax
+}
+ b65:	5b                   	pop    %ebx
+ b66:	5e                   	pop    %esi
+ b67:	5f                   	pop    %edi
+ b68:	5d                   	pop    %ebp
+ b69:	c3                   	ret
+ b6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ b70:	39 cf                	cmp    %ecx,%edi
+ b72:	74 4c                	je     bc0 <malloc+0xe0>
+        p->s.size -= nunits;
+ b74:	29 f9                	sub    %edi,%ecx
+ b76:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ b79:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ b7c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ b7f:	89 15 a0 11 00 00    	mov    %edx,0x11a0
+}
+ b85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ b88:	83 c0 08             	add    $0x8,%eax
+}
+ b8b:	5b                   	pop    %ebx
+ b8c:	5e                   	pop    %esi
+ b8d:	5f                   	pop    %edi
+ b8e:	5d                   	pop    %ebp
+ b8f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ b90:	c7 05 a0 11 00 00 a4 	movl   $0x11a4,0x11a0
+ b97:	11 00 00 
+    base.s.size = 0;
+ b9a:	b8 a4 11 00 00       	mov    $0x11a4,%eax
+    base.s.ptr = freep = prevp = &base;
+ b9f:	c7 05 a4 11 00 00 a4 	movl   $0x11a4,0x11a4
+ ba6:	11 00 00 
+    base.s.size = 0;
+ ba9:	c7 05 a8 11 00 00 00 	movl   $0x0,0x11a8
+ bb0:	00 00 00 
+    if(p->s.size >= nunits){
+ bb3:	e9 54 ff ff ff       	jmp    b0c <malloc+0x2c>
+ bb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bbf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ bc0:	8b 08                	mov    (%eax),%ecx
+ bc2:	89 0a                	mov    %ecx,(%edx)
+ bc4:	eb b9                	jmp    b7f <malloc+0x9f>
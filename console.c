@@ -7,6 +7,7 @@
 #include "param.h"
 #include "traps.h"
 #include "spinlock.h"
+#include "workqueue.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "file.h"
@@ -188,17 +189,26 @@ struct {
 
 #define C(x)  ((x)-'@')  // Control-x
 
+static void
+procdumpwork(void *arg)
+{
+  procdump();
+}
+
+// ^P prints the process listing from a kernel thread, since
+// procdump() is slow and takes cons.lock itself.
+static struct work dumpwork = { procdumpwork };
+
 void
 consoleintr(int (*getc)(void))
 {
-  int c, doprocdump = 0;
+  int c;
 
   acquire(&cons.lock);
   while((c = getc()) >= 0){
     switch(c){
     case C('P'):  // Process listing.
-      // procdump() locks cons.lock indirectly; invoke later
-      doprocdump = 1;
+      queuework(&syswq, &dumpwork);
       break;
     case C('U'):  // Kill line.
       while(input.e != input.w &&
@@ -227,9 +237,6 @@ consoleintr(int (*getc)(void))
     }
   }
   release(&cons.lock);
-  if(doprocdump) {
-    procdump();  // now call procdump() wo. cons.lock held
-  }
 }
 
 int
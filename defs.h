@@ -1,20 +1,44 @@
+struct aioctx;
 struct buf;
 struct context;
+struct diskstat;
 struct file;
 struct inode;
+struct locksite;
+struct lockstat;
+struct pcidev;
 struct pipe;
 struct proc;
+struct procinfo;
 struct rtcdate;
 struct spinlock;
 struct sleeplock;
 struct stat;
 struct superblock;
+struct timespec;
+struct work;
+struct workqueue;
+
+// aio.c
+void            aiodrain(void);
+void            aioexit(void);
+void            aioinit(void);
+int             aiosetup(void);
+int             aiowait(int);
 
 // bio.c
 void            binit(void);
+void            biodone(struct buf*);
 struct buf*     bread(uint, uint);
+struct buf*     bread_async(uint, uint);
+void            breadahead(uint, uint);
 void            brelse(struct buf*);
+int             bshrink(void);
+void            bwait(struct buf*);
 void            bwrite(struct buf*);
+void            bwrite_async(struct buf*);
+extern struct diskstat diskstat;
+void            getdiskstat(struct diskstat*);
 
 // console.c
 void            consoleinit(void);
@@ -24,6 +48,8 @@ void            panic(char*) __attribute__((noreturn));
 
 // exec.c
 int             exec(char*, char**);
+pde_t*          loadimage(char*, char**, int, uint*, uint*, uint*);
+char*           progname(char*);
 
 // file.c
 struct file*    filealloc(void);
@@ -31,6 +57,8 @@ void            fileclose(struct file*);
 struct file*    filedup(struct file*);
 void            fileinit(void);
 int             fileread(struct file*, char*, int n);
+int             filepread(struct file*, char*, int n, uint off);
+int             filepwrite(struct file*, char*, int n, uint off);
 int             filestat(struct file*, struct stat*);
 int             filewrite(struct file*, char*, int n);
 
@@ -42,6 +70,7 @@ struct inode*   ialloc(uint, short);
 struct inode*   idup(struct inode*);
 void            iinit(int dev);
 void            ilock(struct inode*);
+void            ilockshared(struct inode*);
 void            iput(struct inode*);
 void            iunlock(struct inode*);
 void            iunlockput(struct inode*);
@@ -50,9 +79,18 @@ int             namecmp(const char*, const char*);
 struct inode*   namei(char*);
 struct inode*   nameiparent(char*, char*);
 int             readi(struct inode*, char*, uint, uint);
+void            ireadahead(struct inode*, uint, uint);
 void            stati(struct inode*, struct stat*);
 int             writei(struct inode*, char*, uint, uint);
 
+// pci.c
+void            pciinit(void);
+struct pcidev*  pcifind(int, int);
+struct pcidev*  pcifindid(int, int);
+void            pcibusmaster(struct pcidev*);
+uint            pciread(struct pcidev*, int);
+void            pciwrite(struct pcidev*, int, uint);
+
 // ide.c
 void            ideinit(void);
 void            ideintr(void);
@@ -66,6 +104,7 @@ void            ioapicinit(void);
 // kalloc.c
 char*           kalloc(void);
 void            kfree(char*);
+int             kfreepages(void);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
 
@@ -76,8 +115,13 @@ void            kbdintr(void);
 void            cmostime(struct rtcdate *r);
 int             lapicid(void);
 extern volatile uint*    lapic;
+extern uint     lapicperiod;
+extern uint     tscperiod;
+void            lapicarm(uint);
+uint            lapiccount(void);
 void            lapiceoi(void);
 void            lapicinit(void);
+void            lapicipi(int, int);
 void            lapicstartap(uchar, uint);
 void            microdelay(int);
 
@@ -106,18 +150,24 @@ int             pipewrite(struct pipe*, char*, int);
 int             cpuid(void);
 void            exit(void);
 int             fork(void);
+int             getaffinity(int);
 int             growproc(int);
 int             kill(int);
+struct proc*    kthread_create(void(*)(void*), void*, char*);
 struct cpu*     mycpu(void);
 struct proc*    myproc();
 void            pinit(void);
 void            procdump(void);
 void            scheduler(void) __attribute__((noreturn));
 void            sched(void);
+int             setaffinity(int, uint);
+int             spawn(char*, char**, int*, int);
+int             getprocinfo(struct procinfo*, int);
 void            setproc(struct proc*);
 void            sleep(void*, struct spinlock*);
 void            userinit(void);
 int             wait(void);
+void            wakeproc(struct proc*, void*);
 void            wakeup(void*);
 void            yield(void);
 
@@ -129,12 +179,19 @@ void            acquire(struct spinlock*);
 void            getcallerpcs(void*, uint*);
 int             holding(struct spinlock*);
 void            initlock(struct spinlock*, char*);
+void            freelock(struct spinlock*);
 void            release(struct spinlock*);
 void            pushcli(void);
 void            popcli(void);
+int             getlockprof(struct locksite*, int);
+int             getlockstat(struct lockstat*, int);
+void            lockprof(int);
 
 // sleeplock.c
 void            acquiresleep(struct sleeplock*);
+void            acquiresleepshared(struct sleeplock*);
+void            disownsleep(struct sleeplock*);
+int             lockedsleep(struct sleeplock*);
 void            releasesleep(struct sleeplock*);
 int             holdingsleep(struct sleeplock*);
 void            initsleeplock(struct sleeplock*, char*);
@@ -157,7 +214,11 @@ int             fetchstr(uint, char**);
 void            syscall(void);
 
 // timer.c
+void            clockread(struct timespec*);
+int             hrsleep(uint);
 void            timerinit(void);
+int             timerintr(void);
+int             tsleep(uint);
 
 // trap.c
 void            idtinit(void);
@@ -170,6 +231,13 @@ void            uartinit(void);
 void            uartintr(void);
 void            uartputc(int);
 
+// virtio.c
+extern int      virtioirq;
+void            virtioinit(void);
+void            virtiointr(void);
+int             virtioready(void);
+void            virtiorw(struct buf*);
+
 // vm.c
 void            seginit(void);
 void            kvmalloc(void);
@@ -179,10 +247,13 @@ int             allocuvm(pde_t*, uint, uint);
 int             deallocuvm(pde_t*, uint, uint);
 void            freevm(pde_t*);
 void            inituvm(pde_t*, char*, uint);
+int             mappages(pde_t*, void*, uint, uint, int);
+int             mapupages(pde_t*, int);
 int             loaduvm(pde_t*, char*, struct inode*, uint, uint);
 pde_t*          copyuvm(pde_t*, uint);
 void            switchuvm(struct proc*);
 void            switchkvm(void);
+int             copyin(pde_t*, void*, uint, uint);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
 
@@ -190,5 +261,10 @@ void            clearpteu(pde_t *pgdir, char *uva);
 void swapread(char* ptr, int blkno);
 void swapwrite(char* ptr, int blkno);
 
+// workqueue.c
+void            queuework(struct workqueue*, struct work*);
+extern struct workqueue syswq;
+void            wqinit(struct workqueue*, char*, int);
+
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
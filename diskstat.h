@@ -0,0 +1,19 @@
+// Disk request and buffer cache statistics, as returned
+// by diskstat().
+
+#define NDISKHIST 24  // log2 latency histogram buckets
+
+struct diskstat {
+  uint nread;        // Blocks read
+  uint nwrite;       // Blocks written
+  uint ncmd;         // Commands the disk drivers issued for them
+  uint latency;      // Sum of request latencies in microseconds (wraps)
+  uint maxlatency;   // Longest request latency in microseconds
+  // Bucket i counts requests that took 2^i to 2^(i+1)-1
+  // microseconds; the first also counts 0 and the last
+  // everything longer.
+  uint hist[NDISKHIST];
+  uint nhit;         // Buffer cache lookups that found the block
+  uint nmiss;        // And that did not
+  uint nbuf;         // Buffers in the cache now
+};
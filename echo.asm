@@ -0,0 +1,1539 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  for(i = 1; i < argc; i++)
+  19:	83 fe 01             	cmp    $0x1,%esi
+  1c:	7e 47                	jle    65 <main+0x65>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  1e:	8b 47 04             	mov    0x4(%edi),%eax
+  21:	83 fe 02             	cmp    $0x2,%esi
+  24:	74 2a                	je     50 <main+0x50>
+  26:	bb 02 00 00 00       	mov    $0x2,%ebx
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  30:	68 28 0b 00 00       	push   $0xb28
+  35:	83 c3 01             	add    $0x1,%ebx
+  38:	50                   	push   %eax
+  39:	68 2a 0b 00 00       	push   $0xb2a
+  3e:	6a 01                	push   $0x1
+  40:	e8 bb 07 00 00       	call   800 <printf>
+  45:	8b 44 9f fc          	mov    -0x4(%edi,%ebx,4),%eax
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 f3                	cmp    %esi,%ebx
+  4e:	75 e0                	jne    30 <main+0x30>
+  50:	68 2f 0b 00 00       	push   $0xb2f
+  55:	50                   	push   %eax
+  56:	68 2a 0b 00 00       	push   $0xb2a
+  5b:	6a 01                	push   $0x1
+  5d:	e8 9e 07 00 00       	call   800 <printf>
+  62:	83 c4 10             	add    $0x10,%esp
+  exit();
+  65:	e8 ff 02 00 00       	call   369 <exit>
+  6a:	66 90                	xchg   %ax,%ax
+  6c:	66 90                	xchg   %ax,%ax
+  6e:	66 90                	xchg   %ax,%ax
+
+00000070 <strcpy>:
+#include "date.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  70:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  71:	31 c0                	xor    %eax,%eax
+{
+  73:	89 e5                	mov    %esp,%ebp
+  75:	53                   	push   %ebx
+  76:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  80:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  84:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  87:	83 c0 01             	add    $0x1,%eax
+  8a:	84 d2                	test   %dl,%dl
+  8c:	75 f2                	jne    80 <strcpy+0x10>
+    ;
+  return os;
+}
+  8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  91:	89 c8                	mov    %ecx,%eax
+  93:	c9                   	leave
+  94:	c3                   	ret
+  95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  a0:	55                   	push   %ebp
+  a1:	89 e5                	mov    %esp,%ebp
+  a3:	53                   	push   %ebx
+  a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  aa:	0f b6 02             	movzbl (%edx),%eax
+  ad:	84 c0                	test   %al,%al
+  af:	75 17                	jne    c8 <strcmp+0x28>
+  b1:	eb 3a                	jmp    ed <strcmp+0x4d>
+  b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  b7:	90                   	nop
+  b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  bc:	83 c2 01             	add    $0x1,%edx
+  bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  c2:	84 c0                	test   %al,%al
+  c4:	74 1a                	je     e0 <strcmp+0x40>
+    p++, q++;
+  c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  c8:	0f b6 19             	movzbl (%ecx),%ebx
+  cb:	38 c3                	cmp    %al,%bl
+  cd:	74 e9                	je     b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  cf:	29 d8                	sub    %ebx,%eax
+}
+  d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  d4:	c9                   	leave
+  d5:	c3                   	ret
+  d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  e4:	31 c0                	xor    %eax,%eax
+  e6:	29 d8                	sub    %ebx,%eax
+}
+  e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  eb:	c9                   	leave
+  ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  ed:	0f b6 19             	movzbl (%ecx),%ebx
+  f0:	31 c0                	xor    %eax,%eax
+  f2:	eb db                	jmp    cf <strcmp+0x2f>
+  f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ff:	90                   	nop
+
+00000100 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 106:	80 3a 00             	cmpb   $0x0,(%edx)
+ 109:	74 15                	je     120 <strlen+0x20>
+ 10b:	31 c0                	xor    %eax,%eax
+ 10d:	8d 76 00             	lea    0x0(%esi),%esi
+ 110:	83 c0 01             	add    $0x1,%eax
+ 113:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 117:	89 c1                	mov    %eax,%ecx
+ 119:	75 f5                	jne    110 <strlen+0x10>
+    ;
+  return n;
+}
+ 11b:	89 c8                	mov    %ecx,%eax
+ 11d:	5d                   	pop    %ebp
+ 11e:	c3                   	ret
+ 11f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 120:	31 c9                	xor    %ecx,%ecx
+}
+ 122:	5d                   	pop    %ebp
+ 123:	89 c8                	mov    %ecx,%eax
+ 125:	c3                   	ret
+ 126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000130 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	57                   	push   %edi
+ 134:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 137:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 13a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 13d:	89 d7                	mov    %edx,%edi
+ 13f:	fc                   	cld
+ 140:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 142:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 145:	89 d0                	mov    %edx,%eax
+ 147:	c9                   	leave
+ 148:	c3                   	ret
+ 149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	8b 45 08             	mov    0x8(%ebp),%eax
+ 156:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 15a:	0f b6 10             	movzbl (%eax),%edx
+ 15d:	84 d2                	test   %dl,%dl
+ 15f:	75 12                	jne    173 <strchr+0x23>
+ 161:	eb 1d                	jmp    180 <strchr+0x30>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 16c:	83 c0 01             	add    $0x1,%eax
+ 16f:	84 d2                	test   %dl,%dl
+ 171:	74 0d                	je     180 <strchr+0x30>
+    if(*s == c)
+ 173:	38 d1                	cmp    %dl,%cl
+ 175:	75 f1                	jne    168 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 177:	5d                   	pop    %ebp
+ 178:	c3                   	ret
+ 179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 180:	31 c0                	xor    %eax,%eax
+}
+ 182:	5d                   	pop    %ebp
+ 183:	c3                   	ret
+ 184:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 18f:	90                   	nop
+
+00000190 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	57                   	push   %edi
+ 194:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 195:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 198:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 199:	31 db                	xor    %ebx,%ebx
+{
+ 19b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 19e:	eb 27                	jmp    1c7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1a0:	83 ec 04             	sub    $0x4,%esp
+ 1a3:	6a 01                	push   $0x1
+ 1a5:	56                   	push   %esi
+ 1a6:	6a 00                	push   $0x0
+ 1a8:	e8 13 02 00 00       	call   3c0 <read>
+    if(cc < 1)
+ 1ad:	83 c4 10             	add    $0x10,%esp
+ 1b0:	85 c0                	test   %eax,%eax
+ 1b2:	7e 1d                	jle    1d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1bf:	3c 0a                	cmp    $0xa,%al
+ 1c1:	74 10                	je     1d3 <gets+0x43>
+ 1c3:	3c 0d                	cmp    $0xd,%al
+ 1c5:	74 0c                	je     1d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1c7:	89 df                	mov    %ebx,%edi
+ 1c9:	83 c3 01             	add    $0x1,%ebx
+ 1cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1cf:	7c cf                	jl     1a0 <gets+0x10>
+ 1d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1dd:	5b                   	pop    %ebx
+ 1de:	5e                   	pop    %esi
+ 1df:	5f                   	pop    %edi
+ 1e0:	5d                   	pop    %ebp
+ 1e1:	c3                   	ret
+ 1e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	56                   	push   %esi
+ 1f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1f5:	83 ec 08             	sub    $0x8,%esp
+ 1f8:	6a 00                	push   $0x0
+ 1fa:	ff 75 08             	push   0x8(%ebp)
+ 1fd:	e8 4f 02 00 00       	call   451 <open>
+  if(fd < 0)
+ 202:	83 c4 10             	add    $0x10,%esp
+ 205:	85 c0                	test   %eax,%eax
+ 207:	78 27                	js     230 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 209:	83 ec 08             	sub    $0x8,%esp
+ 20c:	ff 75 0c             	push   0xc(%ebp)
+ 20f:	89 c3                	mov    %eax,%ebx
+ 211:	50                   	push   %eax
+ 212:	e8 91 02 00 00       	call   4a8 <fstat>
+  close(fd);
+ 217:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 21a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 21c:	e8 d9 01 00 00       	call   3fa <close>
+  return r;
+ 221:	83 c4 10             	add    $0x10,%esp
+}
+ 224:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 227:	89 f0                	mov    %esi,%eax
+ 229:	5b                   	pop    %ebx
+ 22a:	5e                   	pop    %esi
+ 22b:	5d                   	pop    %ebp
+ 22c:	c3                   	ret
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 230:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 235:	eb ed                	jmp    224 <stat+0x34>
+ 237:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23e:	66 90                	xchg   %ax,%ax
+
+00000240 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	53                   	push   %ebx
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 247:	0f be 02             	movsbl (%edx),%eax
+ 24a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 24d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 250:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 255:	77 1e                	ja     275 <atoi+0x35>
+ 257:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 260:	83 c2 01             	add    $0x1,%edx
+ 263:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 266:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 26a:	0f be 02             	movsbl (%edx),%eax
+ 26d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 270:	80 fb 09             	cmp    $0x9,%bl
+ 273:	76 eb                	jbe    260 <atoi+0x20>
+  return n;
+}
+ 275:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 278:	89 c8                	mov    %ecx,%eax
+ 27a:	c9                   	leave
+ 27b:	c3                   	ret
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+ 284:	56                   	push   %esi
+ 285:	8b 45 10             	mov    0x10(%ebp),%eax
+ 288:	8b 55 08             	mov    0x8(%ebp),%edx
+ 28b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 28e:	85 c0                	test   %eax,%eax
+ 290:	7e 13                	jle    2a5 <memmove+0x25>
+ 292:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 294:	89 d7                	mov    %edx,%edi
+ 296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2a1:	39 f8                	cmp    %edi,%eax
+ 2a3:	75 fb                	jne    2a0 <memmove+0x20>
+  return vdst;
+}
+ 2a5:	5e                   	pop    %esi
+ 2a6:	89 d0                	mov    %edx,%eax
+ 2a8:	5f                   	pop    %edi
+ 2a9:	5d                   	pop    %ebp
+ 2aa:	c3                   	ret
+ 2ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2af:	90                   	nop
+
+000002b0 <ugetpid>:
+// getpid() without a system call, from the page at UPROC.
+int
+ugetpid(void)
+{
+  return ((struct uproc*)UPROC)->pid;
+}
+ 2b0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+ 2b5:	c3                   	ret
+ 2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002c0 <uclocktime>:
+
+// clocktime() without a system call, from the page at UCLOCK.
+int
+uclocktime(struct timespec *ts)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	57                   	push   %edi
+ 2c4:	56                   	push   %esi
+ 2c5:	53                   	push   %ebx
+ 2c6:	83 ec 1c             	sub    $0x1c,%esp
+  struct uclock *c = (struct uclock*)UCLOCK;
+
+  if(c->tscmult == 0)
+ 2c9:	8b 0d 08 f0 ff 7f    	mov    0x7ffff008,%ecx
+{
+ 2cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(c->tscmult == 0)
+ 2d2:	85 c9                	test   %ecx,%ecx
+ 2d4:	74 6a                	je     340 <uclocktime+0x80>
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+ 2d6:	0f 31                	rdtsc
+static inline void
+uclockread(struct uclock *c, uint64 tsc, struct timespec *ts)
+{
+  uint64 d, ns;
+
+  d = tsc - c->tscbase;
+ 2d8:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 2de:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+ 2e4:	89 c6                	mov    %eax,%esi
+  if((long long)d < 0)  // another CPU's TSC is a little behind
+ 2e6:	85 d2                	test   %edx,%edx
+ 2e8:	78 46                	js     330 <uclocktime+0x70>
+    d = 0;
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 2ea:	89 d0                	mov    %edx,%eax
+ 2ec:	f7 e1                	mul    %ecx
+ 2ee:	0f a4 c2 08          	shld   $0x8,%eax,%edx
+ 2f2:	c1 e0 08             	shl    $0x8,%eax
+ 2f5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+ 2f8:	89 f0                	mov    %esi,%eax
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 2fa:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+ 2fd:	f7 e1                	mul    %ecx
+ 2ff:	0f ac d0 18          	shrd   $0x18,%edx,%eax
+ 303:	c1 ea 18             	shr    $0x18,%edx
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 306:	03 45 e0             	add    -0x20(%ebp),%eax
+ 309:	13 55 e4             	adc    -0x1c(%ebp),%edx
+// linked with libgcc, so it cannot use 64-bit '/' or '%'.
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+  asm("divl %4" : "=a" (q), "=d" (r) : "a" ((uint)n), "d" ((uint)(n>>32)), "rm" (d));
+ 30c:	89 c7                	mov    %eax,%edi
+ 30e:	89 f8                	mov    %edi,%eax
+ 310:	b9 00 ca 9a 3b       	mov    $0x3b9aca00,%ecx
+ 315:	f7 f1                	div    %ecx
+  ts->sec = divl(ns, 1000000000, &ts->nsec);
+ 317:	89 03                	mov    %eax,(%ebx)
+    return clocktime(ts);
+  uclockread(c, rdtsc(), ts);
+  return 0;
+}
+ 319:	31 c0                	xor    %eax,%eax
+  *rem = r;
+ 31b:	89 53 04             	mov    %edx,0x4(%ebx)
+ 31e:	83 c4 1c             	add    $0x1c,%esp
+ 321:	5b                   	pop    %ebx
+ 322:	5e                   	pop    %esi
+ 323:	5f                   	pop    %edi
+ 324:	5d                   	pop    %ebp
+ 325:	c3                   	ret
+ 326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+ 330:	31 d2                	xor    %edx,%edx
+ 332:	31 ff                	xor    %edi,%edi
+ 334:	eb d8                	jmp    30e <uclocktime+0x4e>
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+ 340:	83 c4 1c             	add    $0x1c,%esp
+ 343:	5b                   	pop    %ebx
+ 344:	5e                   	pop    %esi
+ 345:	5f                   	pop    %edi
+ 346:	5d                   	pop    %ebp
+    return clocktime(ts);
+ 347:	e9 f2 02 00 00       	jmp    63e <clocktime>
+
+0000034c <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+ 34c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 351:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 358:	00 00 00 
+ 35b:	74 09                	je     366 <fork+0x1a>
+ 35d:	89 e1                	mov    %esp,%ecx
+ 35f:	ba 68 03 00 00       	mov    $0x368,%edx
+ 364:	0f 34                	sysenter
+ 366:	cd 40                	int    $0x40
+ 368:	c3                   	ret
+
+00000369 <exit>:
+SYSCALL(exit)
+ 369:	b8 02 00 00 00       	mov    $0x2,%eax
+ 36e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 375:	00 00 00 
+ 378:	74 09                	je     383 <exit+0x1a>
+ 37a:	89 e1                	mov    %esp,%ecx
+ 37c:	ba 85 03 00 00       	mov    $0x385,%edx
+ 381:	0f 34                	sysenter
+ 383:	cd 40                	int    $0x40
+ 385:	c3                   	ret
+
+00000386 <wait>:
+SYSCALL(wait)
+ 386:	b8 03 00 00 00       	mov    $0x3,%eax
+ 38b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 392:	00 00 00 
+ 395:	74 09                	je     3a0 <wait+0x1a>
+ 397:	89 e1                	mov    %esp,%ecx
+ 399:	ba a2 03 00 00       	mov    $0x3a2,%edx
+ 39e:	0f 34                	sysenter
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <pipe>:
+SYSCALL(pipe)
+ 3a3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3a8:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 3af:	00 00 00 
+ 3b2:	74 09                	je     3bd <pipe+0x1a>
+ 3b4:	89 e1                	mov    %esp,%ecx
+ 3b6:	ba bf 03 00 00       	mov    $0x3bf,%edx
+ 3bb:	0f 34                	sysenter
+ 3bd:	cd 40                	int    $0x40
+ 3bf:	c3                   	ret
+
+000003c0 <read>:
+SYSCALL(read)
+ 3c0:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3c5:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 3cc:	00 00 00 
+ 3cf:	74 09                	je     3da <read+0x1a>
+ 3d1:	89 e1                	mov    %esp,%ecx
+ 3d3:	ba dc 03 00 00       	mov    $0x3dc,%edx
+ 3d8:	0f 34                	sysenter
+ 3da:	cd 40                	int    $0x40
+ 3dc:	c3                   	ret
+
+000003dd <write>:
+SYSCALL(write)
+ 3dd:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3e2:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 3e9:	00 00 00 
+ 3ec:	74 09                	je     3f7 <write+0x1a>
+ 3ee:	89 e1                	mov    %esp,%ecx
+ 3f0:	ba f9 03 00 00       	mov    $0x3f9,%edx
+ 3f5:	0f 34                	sysenter
+ 3f7:	cd 40                	int    $0x40
+ 3f9:	c3                   	ret
+
+000003fa <close>:
+SYSCALL(close)
+ 3fa:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3ff:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 406:	00 00 00 
+ 409:	74 09                	je     414 <close+0x1a>
+ 40b:	89 e1                	mov    %esp,%ecx
+ 40d:	ba 16 04 00 00       	mov    $0x416,%edx
+ 412:	0f 34                	sysenter
+ 414:	cd 40                	int    $0x40
+ 416:	c3                   	ret
+
+00000417 <kill>:
+SYSCALL(kill)
+ 417:	b8 06 00 00 00       	mov    $0x6,%eax
+ 41c:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 423:	00 00 00 
+ 426:	74 09                	je     431 <kill+0x1a>
+ 428:	89 e1                	mov    %esp,%ecx
+ 42a:	ba 33 04 00 00       	mov    $0x433,%edx
+ 42f:	0f 34                	sysenter
+ 431:	cd 40                	int    $0x40
+ 433:	c3                   	ret
+
+00000434 <exec>:
+SYSCALL(exec)
+ 434:	b8 07 00 00 00       	mov    $0x7,%eax
+ 439:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 440:	00 00 00 
+ 443:	74 09                	je     44e <exec+0x1a>
+ 445:	89 e1                	mov    %esp,%ecx
+ 447:	ba 50 04 00 00       	mov    $0x450,%edx
+ 44c:	0f 34                	sysenter
+ 44e:	cd 40                	int    $0x40
+ 450:	c3                   	ret
+
+00000451 <open>:
+SYSCALL(open)
+ 451:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 456:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 45d:	00 00 00 
+ 460:	74 09                	je     46b <open+0x1a>
+ 462:	89 e1                	mov    %esp,%ecx
+ 464:	ba 6d 04 00 00       	mov    $0x46d,%edx
+ 469:	0f 34                	sysenter
+ 46b:	cd 40                	int    $0x40
+ 46d:	c3                   	ret
+
+0000046e <mknod>:
+SYSCALL(mknod)
+ 46e:	b8 11 00 00 00       	mov    $0x11,%eax
+ 473:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 47a:	00 00 00 
+ 47d:	74 09                	je     488 <mknod+0x1a>
+ 47f:	89 e1                	mov    %esp,%ecx
+ 481:	ba 8a 04 00 00       	mov    $0x48a,%edx
+ 486:	0f 34                	sysenter
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <unlink>:
+SYSCALL(unlink)
+ 48b:	b8 12 00 00 00       	mov    $0x12,%eax
+ 490:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 497:	00 00 00 
+ 49a:	74 09                	je     4a5 <unlink+0x1a>
+ 49c:	89 e1                	mov    %esp,%ecx
+ 49e:	ba a7 04 00 00       	mov    $0x4a7,%edx
+ 4a3:	0f 34                	sysenter
+ 4a5:	cd 40                	int    $0x40
+ 4a7:	c3                   	ret
+
+000004a8 <fstat>:
+SYSCALL(fstat)
+ 4a8:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4ad:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4b4:	00 00 00 
+ 4b7:	74 09                	je     4c2 <fstat+0x1a>
+ 4b9:	89 e1                	mov    %esp,%ecx
+ 4bb:	ba c4 04 00 00       	mov    $0x4c4,%edx
+ 4c0:	0f 34                	sysenter
+ 4c2:	cd 40                	int    $0x40
+ 4c4:	c3                   	ret
+
+000004c5 <link>:
+SYSCALL(link)
+ 4c5:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4ca:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4d1:	00 00 00 
+ 4d4:	74 09                	je     4df <link+0x1a>
+ 4d6:	89 e1                	mov    %esp,%ecx
+ 4d8:	ba e1 04 00 00       	mov    $0x4e1,%edx
+ 4dd:	0f 34                	sysenter
+ 4df:	cd 40                	int    $0x40
+ 4e1:	c3                   	ret
+
+000004e2 <mkdir>:
+SYSCALL(mkdir)
+ 4e2:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4e7:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4ee:	00 00 00 
+ 4f1:	74 09                	je     4fc <mkdir+0x1a>
+ 4f3:	89 e1                	mov    %esp,%ecx
+ 4f5:	ba fe 04 00 00       	mov    $0x4fe,%edx
+ 4fa:	0f 34                	sysenter
+ 4fc:	cd 40                	int    $0x40
+ 4fe:	c3                   	ret
+
+000004ff <chdir>:
+SYSCALL(chdir)
+ 4ff:	b8 09 00 00 00       	mov    $0x9,%eax
+ 504:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 50b:	00 00 00 
+ 50e:	74 09                	je     519 <chdir+0x1a>
+ 510:	89 e1                	mov    %esp,%ecx
+ 512:	ba 1b 05 00 00       	mov    $0x51b,%edx
+ 517:	0f 34                	sysenter
+ 519:	cd 40                	int    $0x40
+ 51b:	c3                   	ret
+
+0000051c <dup>:
+SYSCALL(dup)
+ 51c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 521:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 528:	00 00 00 
+ 52b:	74 09                	je     536 <dup+0x1a>
+ 52d:	89 e1                	mov    %esp,%ecx
+ 52f:	ba 38 05 00 00       	mov    $0x538,%edx
+ 534:	0f 34                	sysenter
+ 536:	cd 40                	int    $0x40
+ 538:	c3                   	ret
+
+00000539 <getpid>:
+SYSCALL(getpid)
+ 539:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 53e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 545:	00 00 00 
+ 548:	74 09                	je     553 <getpid+0x1a>
+ 54a:	89 e1                	mov    %esp,%ecx
+ 54c:	ba 55 05 00 00       	mov    $0x555,%edx
+ 551:	0f 34                	sysenter
+ 553:	cd 40                	int    $0x40
+ 555:	c3                   	ret
+
+00000556 <sbrk>:
+SYSCALL(sbrk)
+ 556:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 55b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 562:	00 00 00 
+ 565:	74 09                	je     570 <sbrk+0x1a>
+ 567:	89 e1                	mov    %esp,%ecx
+ 569:	ba 72 05 00 00       	mov    $0x572,%edx
+ 56e:	0f 34                	sysenter
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <sleep>:
+SYSCALL(sleep)
+ 573:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 578:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 57f:	00 00 00 
+ 582:	74 09                	je     58d <sleep+0x1a>
+ 584:	89 e1                	mov    %esp,%ecx
+ 586:	ba 8f 05 00 00       	mov    $0x58f,%edx
+ 58b:	0f 34                	sysenter
+ 58d:	cd 40                	int    $0x40
+ 58f:	c3                   	ret
+
+00000590 <uptime>:
+SYSCALL(uptime)
+ 590:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 595:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 59c:	00 00 00 
+ 59f:	74 09                	je     5aa <uptime+0x1a>
+ 5a1:	89 e1                	mov    %esp,%ecx
+ 5a3:	ba ac 05 00 00       	mov    $0x5ac,%edx
+ 5a8:	0f 34                	sysenter
+ 5aa:	cd 40                	int    $0x40
+ 5ac:	c3                   	ret
+
+000005ad <swapread>:
+SYSCALL(swapread)
+ 5ad:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5b2:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5b9:	00 00 00 
+ 5bc:	74 09                	je     5c7 <swapread+0x1a>
+ 5be:	89 e1                	mov    %esp,%ecx
+ 5c0:	ba c9 05 00 00       	mov    $0x5c9,%edx
+ 5c5:	0f 34                	sysenter
+ 5c7:	cd 40                	int    $0x40
+ 5c9:	c3                   	ret
+
+000005ca <swapwrite>:
+SYSCALL(swapwrite)
+ 5ca:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5cf:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5d6:	00 00 00 
+ 5d9:	74 09                	je     5e4 <swapwrite+0x1a>
+ 5db:	89 e1                	mov    %esp,%ecx
+ 5dd:	ba e6 05 00 00       	mov    $0x5e6,%edx
+ 5e2:	0f 34                	sysenter
+ 5e4:	cd 40                	int    $0x40
+ 5e6:	c3                   	ret
+
+000005e7 <setaffinity>:
+SYSCALL(setaffinity)
+ 5e7:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5ec:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5f3:	00 00 00 
+ 5f6:	74 09                	je     601 <setaffinity+0x1a>
+ 5f8:	89 e1                	mov    %esp,%ecx
+ 5fa:	ba 03 06 00 00       	mov    $0x603,%edx
+ 5ff:	0f 34                	sysenter
+ 601:	cd 40                	int    $0x40
+ 603:	c3                   	ret
+
+00000604 <getaffinity>:
+SYSCALL(getaffinity)
+ 604:	b8 19 00 00 00       	mov    $0x19,%eax
+ 609:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 610:	00 00 00 
+ 613:	74 09                	je     61e <getaffinity+0x1a>
+ 615:	89 e1                	mov    %esp,%ecx
+ 617:	ba 20 06 00 00       	mov    $0x620,%edx
+ 61c:	0f 34                	sysenter
+ 61e:	cd 40                	int    $0x40
+ 620:	c3                   	ret
+
+00000621 <nanosleep>:
+SYSCALL(nanosleep)
+ 621:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 626:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 62d:	00 00 00 
+ 630:	74 09                	je     63b <nanosleep+0x1a>
+ 632:	89 e1                	mov    %esp,%ecx
+ 634:	ba 3d 06 00 00       	mov    $0x63d,%edx
+ 639:	0f 34                	sysenter
+ 63b:	cd 40                	int    $0x40
+ 63d:	c3                   	ret
+
+0000063e <clocktime>:
+SYSCALL(clocktime)
+ 63e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 643:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 64a:	00 00 00 
+ 64d:	74 09                	je     658 <clocktime+0x1a>
+ 64f:	89 e1                	mov    %esp,%ecx
+ 651:	ba 5a 06 00 00       	mov    $0x65a,%edx
+ 656:	0f 34                	sysenter
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <batch>:
+SYSCALL(batch)
+ 65b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 660:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 667:	00 00 00 
+ 66a:	74 09                	je     675 <batch+0x1a>
+ 66c:	89 e1                	mov    %esp,%ecx
+ 66e:	ba 77 06 00 00       	mov    $0x677,%edx
+ 673:	0f 34                	sysenter
+ 675:	cd 40                	int    $0x40
+ 677:	c3                   	ret
+
+00000678 <aiosetup>:
+SYSCALL(aiosetup)
+ 678:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 67d:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 684:	00 00 00 
+ 687:	74 09                	je     692 <aiosetup+0x1a>
+ 689:	89 e1                	mov    %esp,%ecx
+ 68b:	ba 94 06 00 00       	mov    $0x694,%edx
+ 690:	0f 34                	sysenter
+ 692:	cd 40                	int    $0x40
+ 694:	c3                   	ret
+
+00000695 <aiowait>:
+SYSCALL(aiowait)
+ 695:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 69a:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6a1:	00 00 00 
+ 6a4:	74 09                	je     6af <aiowait+0x1a>
+ 6a6:	89 e1                	mov    %esp,%ecx
+ 6a8:	ba b1 06 00 00       	mov    $0x6b1,%edx
+ 6ad:	0f 34                	sysenter
+ 6af:	cd 40                	int    $0x40
+ 6b1:	c3                   	ret
+
+000006b2 <spawn>:
+SYSCALL(spawn)
+ 6b2:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6b7:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6be:	00 00 00 
+ 6c1:	74 09                	je     6cc <spawn+0x1a>
+ 6c3:	89 e1                	mov    %esp,%ecx
+ 6c5:	ba ce 06 00 00       	mov    $0x6ce,%edx
+ 6ca:	0f 34                	sysenter
+ 6cc:	cd 40                	int    $0x40
+ 6ce:	c3                   	ret
+
+000006cf <getprocinfo>:
+SYSCALL(getprocinfo)
+ 6cf:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6d4:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6db:	00 00 00 
+ 6de:	74 09                	je     6e9 <getprocinfo+0x1a>
+ 6e0:	89 e1                	mov    %esp,%ecx
+ 6e2:	ba eb 06 00 00       	mov    $0x6eb,%edx
+ 6e7:	0f 34                	sysenter
+ 6e9:	cd 40                	int    $0x40
+ 6eb:	c3                   	ret
+
+000006ec <getlockstat>:
+SYSCALL(getlockstat)
+ 6ec:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6f1:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6f8:	00 00 00 
+ 6fb:	74 09                	je     706 <getlockstat+0x1a>
+ 6fd:	89 e1                	mov    %esp,%ecx
+ 6ff:	ba 08 07 00 00       	mov    $0x708,%edx
+ 704:	0f 34                	sysenter
+ 706:	cd 40                	int    $0x40
+ 708:	c3                   	ret
+
+00000709 <lockprof>:
+SYSCALL(lockprof)
+ 709:	b8 22 00 00 00       	mov    $0x22,%eax
+ 70e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 715:	00 00 00 
+ 718:	74 09                	je     723 <lockprof+0x1a>
+ 71a:	89 e1                	mov    %esp,%ecx
+ 71c:	ba 25 07 00 00       	mov    $0x725,%edx
+ 721:	0f 34                	sysenter
+ 723:	cd 40                	int    $0x40
+ 725:	c3                   	ret
+
+00000726 <getlockprof>:
+SYSCALL(getlockprof)
+ 726:	b8 23 00 00 00       	mov    $0x23,%eax
+ 72b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 732:	00 00 00 
+ 735:	74 09                	je     740 <getlockprof+0x1a>
+ 737:	89 e1                	mov    %esp,%ecx
+ 739:	ba 42 07 00 00       	mov    $0x742,%edx
+ 73e:	0f 34                	sysenter
+ 740:	cd 40                	int    $0x40
+ 742:	c3                   	ret
+
+00000743 <diskstat>:
+SYSCALL(diskstat)
+ 743:	b8 24 00 00 00       	mov    $0x24,%eax
+ 748:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 74f:	00 00 00 
+ 752:	74 09                	je     75d <diskstat+0x1a>
+ 754:	89 e1                	mov    %esp,%ecx
+ 756:	ba 5f 07 00 00       	mov    $0x75f,%edx
+ 75b:	0f 34                	sysenter
+ 75d:	cd 40                	int    $0x40
+ 75f:	c3                   	ret
+
+00000760 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 760:	55                   	push   %ebp
+ 761:	89 e5                	mov    %esp,%ebp
+ 763:	57                   	push   %edi
+ 764:	56                   	push   %esi
+ 765:	53                   	push   %ebx
+ 766:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 768:	89 d1                	mov    %edx,%ecx
+{
+ 76a:	83 ec 3c             	sub    $0x3c,%esp
+ 76d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 770:	85 d2                	test   %edx,%edx
+ 772:	0f 89 80 00 00 00    	jns    7f8 <printint+0x98>
+ 778:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 77c:	74 7a                	je     7f8 <printint+0x98>
+    x = -xx;
+ 77e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 780:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 785:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 788:	31 f6                	xor    %esi,%esi
+ 78a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 790:	89 c8                	mov    %ecx,%eax
+ 792:	31 d2                	xor    %edx,%edx
+ 794:	89 f7                	mov    %esi,%edi
+ 796:	f7 f3                	div    %ebx
+ 798:	8d 76 01             	lea    0x1(%esi),%esi
+ 79b:	0f b6 92 90 0b 00 00 	movzbl 0xb90(%edx),%edx
+ 7a2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 7a6:	89 ca                	mov    %ecx,%edx
+ 7a8:	89 c1                	mov    %eax,%ecx
+ 7aa:	39 da                	cmp    %ebx,%edx
+ 7ac:	73 e2                	jae    790 <printint+0x30>
+  if(neg)
+ 7ae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 7b1:	85 c0                	test   %eax,%eax
+ 7b3:	74 07                	je     7bc <printint+0x5c>
+    buf[i++] = '-';
+ 7b5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 7ba:	89 f7                	mov    %esi,%edi
+ 7bc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 7bf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 7c2:	01 df                	add    %ebx,%edi
+ 7c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 7c8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 7cb:	83 ec 04             	sub    $0x4,%esp
+ 7ce:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 7d1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 7d4:	6a 01                	push   $0x1
+ 7d6:	50                   	push   %eax
+ 7d7:	56                   	push   %esi
+ 7d8:	e8 00 fc ff ff       	call   3dd <write>
+  while(--i >= 0)
+ 7dd:	89 f8                	mov    %edi,%eax
+ 7df:	83 c4 10             	add    $0x10,%esp
+ 7e2:	83 ef 01             	sub    $0x1,%edi
+ 7e5:	39 d8                	cmp    %ebx,%eax
+ 7e7:	75 df                	jne    7c8 <printint+0x68>
+}
+ 7e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7ec:	5b                   	pop    %ebx
+ 7ed:	5e                   	pop    %esi
+ 7ee:	5f                   	pop    %edi
+ 7ef:	5d                   	pop    %ebp
+ 7f0:	c3                   	ret
+ 7f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 7f8:	31 c0                	xor    %eax,%eax
+ 7fa:	eb 89                	jmp    785 <printint+0x25>
+ 7fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000800 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 800:	55                   	push   %ebp
+ 801:	89 e5                	mov    %esp,%ebp
+ 803:	57                   	push   %edi
+ 804:	56                   	push   %esi
+ 805:	53                   	push   %ebx
+ 806:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 809:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 80c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 80f:	0f b6 1e             	movzbl (%esi),%ebx
+ 812:	83 c6 01             	add    $0x1,%esi
+ 815:	84 db                	test   %bl,%bl
+ 817:	74 67                	je     880 <printf+0x80>
+ 819:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 81c:	31 d2                	xor    %edx,%edx
+ 81e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 821:	eb 34                	jmp    857 <printf+0x57>
+ 823:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 827:	90                   	nop
+ 828:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 82b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 830:	83 f8 25             	cmp    $0x25,%eax
+ 833:	74 18                	je     84d <printf+0x4d>
+  write(fd, &c, 1);
+ 835:	83 ec 04             	sub    $0x4,%esp
+ 838:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 83b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 83e:	6a 01                	push   $0x1
+ 840:	50                   	push   %eax
+ 841:	57                   	push   %edi
+ 842:	e8 96 fb ff ff       	call   3dd <write>
+ 847:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 84a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 84d:	0f b6 1e             	movzbl (%esi),%ebx
+ 850:	83 c6 01             	add    $0x1,%esi
+ 853:	84 db                	test   %bl,%bl
+ 855:	74 29                	je     880 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 857:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 85a:	85 d2                	test   %edx,%edx
+ 85c:	74 ca                	je     828 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 85e:	83 fa 25             	cmp    $0x25,%edx
+ 861:	75 ea                	jne    84d <printf+0x4d>
+      if(c == 'd'){
+ 863:	83 f8 25             	cmp    $0x25,%eax
+ 866:	0f 84 24 01 00 00    	je     990 <printf+0x190>
+ 86c:	83 e8 63             	sub    $0x63,%eax
+ 86f:	83 f8 15             	cmp    $0x15,%eax
+ 872:	77 1c                	ja     890 <printf+0x90>
+ 874:	ff 24 85 38 0b 00 00 	jmp    *0xb38(,%eax,4)
+ 87b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 87f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 880:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 883:	5b                   	pop    %ebx
+ 884:	5e                   	pop    %esi
+ 885:	5f                   	pop    %edi
+ 886:	5d                   	pop    %ebp
+ 887:	c3                   	ret
+ 888:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 88f:	90                   	nop
+  write(fd, &c, 1);
+ 890:	83 ec 04             	sub    $0x4,%esp
+ 893:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 896:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 89a:	6a 01                	push   $0x1
+ 89c:	52                   	push   %edx
+ 89d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 8a0:	57                   	push   %edi
+ 8a1:	e8 37 fb ff ff       	call   3dd <write>
+ 8a6:	83 c4 0c             	add    $0xc,%esp
+ 8a9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8ac:	6a 01                	push   $0x1
+ 8ae:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 8b1:	52                   	push   %edx
+ 8b2:	57                   	push   %edi
+ 8b3:	e8 25 fb ff ff       	call   3dd <write>
+        putc(fd, c);
+ 8b8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8bb:	31 d2                	xor    %edx,%edx
+ 8bd:	eb 8e                	jmp    84d <printf+0x4d>
+ 8bf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 8c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8c3:	83 ec 0c             	sub    $0xc,%esp
+ 8c6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 8cb:	8b 13                	mov    (%ebx),%edx
+ 8cd:	6a 00                	push   $0x0
+ 8cf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 8d1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 8d4:	e8 87 fe ff ff       	call   760 <printint>
+        ap++;
+ 8d9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8dc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8df:	31 d2                	xor    %edx,%edx
+ 8e1:	e9 67 ff ff ff       	jmp    84d <printf+0x4d>
+ 8e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ed:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 8f0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 8f3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 8f5:	83 c0 04             	add    $0x4,%eax
+ 8f8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 8fb:	85 db                	test   %ebx,%ebx
+ 8fd:	0f 84 9d 00 00 00    	je     9a0 <printf+0x1a0>
+        while(*s != 0){
+ 903:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 906:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 908:	84 c0                	test   %al,%al
+ 90a:	0f 84 3d ff ff ff    	je     84d <printf+0x4d>
+ 910:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 913:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 916:	89 de                	mov    %ebx,%esi
+ 918:	89 d3                	mov    %edx,%ebx
+ 91a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 920:	83 ec 04             	sub    $0x4,%esp
+ 923:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 926:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 929:	6a 01                	push   $0x1
+ 92b:	53                   	push   %ebx
+ 92c:	57                   	push   %edi
+ 92d:	e8 ab fa ff ff       	call   3dd <write>
+        while(*s != 0){
+ 932:	0f b6 06             	movzbl (%esi),%eax
+ 935:	83 c4 10             	add    $0x10,%esp
+ 938:	84 c0                	test   %al,%al
+ 93a:	75 e4                	jne    920 <printf+0x120>
+      state = 0;
+ 93c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 93f:	31 d2                	xor    %edx,%edx
+ 941:	e9 07 ff ff ff       	jmp    84d <printf+0x4d>
+ 946:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 94d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 950:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 953:	83 ec 0c             	sub    $0xc,%esp
+ 956:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 95b:	8b 13                	mov    (%ebx),%edx
+ 95d:	6a 01                	push   $0x1
+ 95f:	e9 6b ff ff ff       	jmp    8cf <printf+0xcf>
+ 964:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 968:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 96b:	83 ec 04             	sub    $0x4,%esp
+ 96e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 971:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 973:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 976:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 979:	6a 01                	push   $0x1
+ 97b:	52                   	push   %edx
+ 97c:	57                   	push   %edi
+ 97d:	e8 5b fa ff ff       	call   3dd <write>
+        ap++;
+ 982:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 985:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 988:	31 d2                	xor    %edx,%edx
+ 98a:	e9 be fe ff ff       	jmp    84d <printf+0x4d>
+ 98f:	90                   	nop
+  write(fd, &c, 1);
+ 990:	83 ec 04             	sub    $0x4,%esp
+ 993:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 996:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 999:	6a 01                	push   $0x1
+ 99b:	e9 11 ff ff ff       	jmp    8b1 <printf+0xb1>
+ 9a0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 9a5:	bb 31 0b 00 00       	mov    $0xb31,%ebx
+ 9aa:	e9 61 ff ff ff       	jmp    910 <printf+0x110>
+ 9af:	90                   	nop
+
+000009b0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 9b0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9b1:	a1 88 0e 00 00       	mov    0xe88,%eax
+{
+ 9b6:	89 e5                	mov    %esp,%ebp
+ 9b8:	57                   	push   %edi
+ 9b9:	56                   	push   %esi
+ 9ba:	53                   	push   %ebx
+ 9bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 9be:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9c8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9ca:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9cc:	39 ca                	cmp    %ecx,%edx
+ 9ce:	73 30                	jae    a00 <free+0x50>
+ 9d0:	39 c1                	cmp    %eax,%ecx
+ 9d2:	72 04                	jb     9d8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9d4:	39 c2                	cmp    %eax,%edx
+ 9d6:	72 f0                	jb     9c8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 9d8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 9db:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 9de:	39 f8                	cmp    %edi,%eax
+ 9e0:	74 2e                	je     a10 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9e2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 9e5:	8b 42 04             	mov    0x4(%edx),%eax
+ 9e8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9eb:	39 f1                	cmp    %esi,%ecx
+ 9ed:	74 38                	je     a27 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 9ef:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 9f1:	5b                   	pop    %ebx
+  freep = p;
+ 9f2:	89 15 88 0e 00 00    	mov    %edx,0xe88
+}
+ 9f8:	5e                   	pop    %esi
+ 9f9:	5f                   	pop    %edi
+ 9fa:	5d                   	pop    %ebp
+ 9fb:	c3                   	ret
+ 9fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a00:	39 c1                	cmp    %eax,%ecx
+ a02:	72 d0                	jb     9d4 <free+0x24>
+ a04:	eb c2                	jmp    9c8 <free+0x18>
+ a06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a0d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ a10:	03 70 04             	add    0x4(%eax),%esi
+ a13:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a16:	8b 02                	mov    (%edx),%eax
+ a18:	8b 00                	mov    (%eax),%eax
+ a1a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ a1d:	8b 42 04             	mov    0x4(%edx),%eax
+ a20:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a23:	39 f1                	cmp    %esi,%ecx
+ a25:	75 c8                	jne    9ef <free+0x3f>
+    p->s.size += bp->s.size;
+ a27:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ a2a:	89 15 88 0e 00 00    	mov    %edx,0xe88
+    p->s.size += bp->s.size;
+ a30:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a33:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ a36:	89 0a                	mov    %ecx,(%edx)
+}
+ a38:	5b                   	pop    %ebx
+ a39:	5e                   	pop    %esi
+ a3a:	5f                   	pop    %edi
+ a3b:	5d                   	pop    %ebp
+ a3c:	c3                   	ret
+ a3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a40 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a40:	55                   	push   %ebp
+ a41:	89 e5                	mov    %esp,%ebp
+ a43:	57                   	push   %edi
+ a44:	56                   	push   %esi
+ a45:	53                   	push   %ebx
+ a46:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a49:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ a4c:	8b 15 88 0e 00 00    	mov    0xe88,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a52:	8d 78 07             	lea    0x7(%eax),%edi
+ a55:	c1 ef 03             	shr    $0x3,%edi
+ a58:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a5b:	85 d2                	test   %edx,%edx
+ a5d:	0f 84 8d 00 00 00    	je     af0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a63:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a65:	8b 48 04             	mov    0x4(%eax),%ecx
+ a68:	39 f9                	cmp    %edi,%ecx
+ a6a:	73 64                	jae    ad0 <malloc+0x90>
+  if(nu < 4096)
+ a6c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a71:	39 df                	cmp    %ebx,%edi
+ a73:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a76:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a7d:	eb 0a                	jmp    a89 <malloc+0x49>
+ a7f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a80:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a82:	8b 48 04             	mov    0x4(%eax),%ecx
+ a85:	39 f9                	cmp    %edi,%ecx
+ a87:	73 47                	jae    ad0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ a89:	89 c2                	mov    %eax,%edx
+ a8b:	39 05 88 0e 00 00    	cmp    %eax,0xe88
+ a91:	75 ed                	jne    a80 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ a93:	83 ec 0c             	sub    $0xc,%esp
+ a96:	56                   	push   %esi
+ a97:	e8 ba fa ff ff       	call   556 <sbrk>
+  if(p == (char*)-1)
+ a9c:	83 c4 10             	add    $0x10,%esp
+ a9f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ aa2:	74 1c                	je     ac0 <malloc+0x80>
+  hp->s.size = nu;
+ aa4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ aa7:	83 ec 0c             	sub    $0xc,%esp
+ aaa:	83 c0 08             	add    $0x8,%eax
+ aad:	50                   	push   %eax
+ aae:	e8 fd fe ff ff       	call   9b0 <free>
+  return freep;
+ ab3:	8b 15 88 0e 00 00    	mov    0xe88,%edx
+      if((p = morecore(nunits)) == 0)
+ ab9:	83 c4 10             	add    $0x10,%esp
+ abc:	85 d2                	test   %edx,%edx
+ abe:	75 c0                	jne    a80 <malloc+0x40>
+        return 0;
+  }
+}
+ ac0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ ac3:	31 c0                	xor    %eax,%eax
+}
+ ac5:	5b                   	pop    %ebx
+ ac6:	5e                   	pop    %esi
+ ac7:	5f                   	pop    %edi
+ ac8:	5d                   	pop    %ebp
+ ac9:	c3                   	ret
+ aca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ ad0:	39 cf                	cmp    %ecx,%edi
+ ad2:	74 4c                	je     b20 <malloc+0xe0>
+        p->s.size -= nunits;
+ ad4:	29 f9                	sub    %edi,%ecx
+ ad6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ ad9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ adc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ adf:	89 15 88 0e 00 00    	mov    %edx,0xe88
+}
+ ae5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ ae8:	83 c0 08             	add    $0x8,%eax
+}
+ aeb:	5b                   	pop    %ebx
+ aec:	5e                   	pop    %esi
+ aed:	5f                   	pop    %edi
+ aee:	5d                   	pop    %ebp
+ aef:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ af0:	c7 05 88 0e 00 00 8c 	movl   $0xe8c,0xe88
+ af7:	0e 00 00 
+    base.s.size = 0;
+ afa:	b8 8c 0e 00 00       	mov    $0xe8c,%eax
+    base.s.ptr = freep = prevp = &base;
+ aff:	c7 05 8c 0e 00 00 8c 	movl   $0xe8c,0xe8c
+ b06:	0e 00 00 
+    base.s.size = 0;
+ b09:	c7 05 90 0e 00 00 00 	movl   $0x0,0xe90
+ b10:	00 00 00 
+    if(p->s.size >= nunits){
+ b13:	e9 54 ff ff ff       	jmp    a6c <malloc+0x2c>
+ b18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b1f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ b20:	8b 08                	mov    (%eax),%ecx
+ b22:	89 0a                	mov    %ecx,(%edx)
+ b24:	eb b9                	jmp    adf <malloc+0x9f>
@@ -7,26 +7,27 @@
 #include "x86.h"
 #include "elf.h"
 
-int
-exec(char *path, char **argv)
+// Load the program at path into a new page table for process
+// pid, with argv on its stack.  Returns the page table and sets
+// *szp, *eipp and *espp for the new image, or returns 0.
+pde_t*
+loadimage(char *path, char **argv, int pid, uint *szp, uint *eipp, uint *espp)
 {
-  char *s, *last;
   int i, off;
   uint argc, sz, sp, ustack[3+MAXARG+1];
   struct elfhdr elf;
   struct inode *ip;
   struct proghdr ph;
-  pde_t *pgdir, *oldpgdir;
-  struct proc *curproc = myproc();
+  pde_t *pgdir;
 
   begin_op();
 
   if((ip = namei(path)) == 0){
     end_op();
     cprintf("exec: fail\n");
-    return -1;
+    return 0;
   }
-  ilock(ip);
+  ilockshared(ip);
   pgdir = 0;
 
   // Check ELF header
@@ -37,6 +38,8 @@ exec(char *path, char **argv)
 
   if((pgdir = setupkvm()) == 0)
     goto bad;
+  if(mapupages(pgdir, pid) < 0)
+    goto bad;
 
   // Load program into memory.
   sz = 0;
@@ -87,28 +90,55 @@ exec(char *path, char **argv)
   if(copyout(pgdir, sp, ustack, (3+argc+1)*4) < 0)
     goto bad;
 
-  // Save program name for debugging.
+  *szp = sz;
+  *eipp = elf.entry;  // main
+  *espp = sp;
+  return pgdir;
+
+ bad:
+  if(pgdir)
+    freevm(pgdir);
+  if(ip){
+    iunlockput(ip);
+    end_op();
+  }
+  return 0;
+}
+
+// The last element of path, for naming a process.
+char*
+progname(char *path)
+{
+  char *s, *last;
+
   for(last=s=path; *s; s++)
     if(*s == '/')
       last = s+1;
-  safestrcpy(curproc->name, last, sizeof(curproc->name));
+  return last;
+}
+
+int
+exec(char *path, char **argv)
+{
+  uint sz, eip, esp;
+  pde_t *pgdir, *oldpgdir;
+  struct proc *curproc = myproc();
+
+  aiodrain();  // I/O threads must be done with the old image
+  if((pgdir = loadimage(path, argv, curproc->pid, &sz, &eip, &esp)) == 0)
+    return -1;
+
+  // Save program name for debugging.
+  safestrcpy(curproc->name, progname(path), sizeof(curproc->name));
 
   // Commit to the user image.
   oldpgdir = curproc->pgdir;
   curproc->pgdir = pgdir;
   curproc->sz = sz;
-  curproc->tf->eip = elf.entry;  // main
-  curproc->tf->esp = sp;
+  curproc->tf->eip = eip;
+  curproc->tf->esp = esp;
   switchuvm(curproc);
+  aioexit();
   freevm(oldpgdir);
   return 0;
-
- bad:
-  if(pgdir)
-    freevm(pgdir);
-  if(ip){
-    iunlockput(ip);
-    end_op();
-  }
-  return -1;
 }
@@ -10,6 +10,8 @@
 #include "sleeplock.h"
 #include "file.h"
 
+#define RAMAX 8  // Most blocks to read ahead
+
 struct devsw devsw[NDEV];
 struct {
   struct spinlock lock;
@@ -103,55 +105,110 @@ fileread(struct file *f, char *addr, int n)
   if(f->type == FD_PIPE)
     return piperead(f->pipe, addr, n);
   if(f->type == FD_INODE){
-    ilock(f->ip);
+    // Readers may share the inode, but not f->off.  Only this
+    // process can add a reference to f while it is in here.
+    if(f->ref == 1)
+      ilockshared(f->ip);
+    else
+      ilock(f->ip);
+    // While reads follow one another, fetch this read's blocks
+    // and a growing window after them all at once.
+    if(f->off == f->raend && n > 0){
+      f->ra = f->ra ? f->ra*2 : 2;
+      if(f->ra > RAMAX)
+        f->ra = RAMAX;
+      ireadahead(f->ip, f->off, n + f->ra*BSIZE);
+    } else
+      f->ra = 0;
     if((r = readi(f->ip, addr, f->off, n)) > 0)
       f->off += r;
+    f->raend = f->off;
     iunlock(f->ip);
     return r;
   }
   panic("fileread");
 }
 
+// Read from file f at offset off, leaving f->off alone.
+// A pipe has no offset; it reads as fileread() would.
+int
+filepread(struct file *f, char *addr, int n, uint off)
+{
+  int r;
+
+  if(f->readable == 0)
+    return -1;
+  if(f->type == FD_PIPE)
+    return piperead(f->pipe, addr, n);
+  if(f->type == FD_INODE){
+    ilockshared(f->ip);
+    r = readi(f->ip, addr, off, n);
+    iunlock(f->ip);
+    return r;
+  }
+  panic("filepread");
+}
+
+// Write n bytes at *off in f's inode, advancing *off.
+static int
+inodewrite(struct file *f, char *addr, int n, uint *off)
+{
+  int r;
+
+  // write a few blocks at a time to avoid exceeding
+  // the maximum log transaction size, including
+  // i-node, indirect block, allocation blocks,
+  // and 2 blocks of slop for non-aligned writes.
+  // this really belongs lower down, since writei()
+  // might be writing a device like the console.
+  int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
+  int i = 0;
+  while(i < n){
+    int n1 = n - i;
+    if(n1 > max)
+      n1 = max;
+
+    begin_op();
+    ilock(f->ip);
+    if ((r = writei(f->ip, addr + i, *off, n1)) > 0)
+      *off += r;
+    iunlock(f->ip);
+    end_op();
+
+    if(r < 0)
+      break;
+    if(r != n1)
+      panic("short filewrite");
+    i += r;
+  }
+  return i == n ? n : -1;
+}
+
 //PAGEBREAK!
 // Write to file f.
 int
 filewrite(struct file *f, char *addr, int n)
 {
-  int r;
-
   if(f->writable == 0)
     return -1;
   if(f->type == FD_PIPE)
     return pipewrite(f->pipe, addr, n);
-  if(f->type == FD_INODE){
-    // write a few blocks at a time to avoid exceeding
-    // the maximum log transaction size, including
-    // i-node, indirect block, allocation blocks,
-    // and 2 blocks of slop for non-aligned writes.
-    // this really belongs lower down, since writei()
-    // might be writing a device like the console.
-    int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
-    int i = 0;
-    while(i < n){
-      int n1 = n - i;
-      if(n1 > max)
-        n1 = max;
-
-      begin_op();
-      ilock(f->ip);
-      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
-        f->off += r;
-      iunlock(f->ip);
-      end_op();
-
-      if(r < 0)
-        break;
-      if(r != n1)
-        panic("short filewrite");
-      i += r;
-    }
-    return i == n ? n : -1;
-  }
+  if(f->type == FD_INODE)
+    return inodewrite(f, addr, n, &f->off);
   panic("filewrite");
 }
 
+// Write to file f at offset off, leaving f->off alone.
+// A pipe has no offset; it writes as filewrite() would.
+int
+filepwrite(struct file *f, char *addr, int n, uint off)
+{
+  if(f->writable == 0)
+    return -1;
+  if(f->type == FD_PIPE)
+    return pipewrite(f->pipe, addr, n);
+  if(f->type == FD_INODE)
+    return inodewrite(f, addr, n, &off);
+  panic("filepwrite");
+}
+
@@ -6,6 +6,8 @@ struct file {
   struct pipe *pipe;
   struct inode *ip;
   uint off;
+  uint raend;        // Where the last read ended
+  uint ra;           // Blocks to read ahead while reads are sequential
 };
 
 
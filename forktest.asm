@@ -0,0 +1,1067 @@
+
+_forktest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "fork test OK\n");
+}
+
+int
+main(void)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 e4 f0             	and    $0xfffffff0,%esp
+  forktest();
+   6:	e8 35 00 00 00       	call   40 <forktest>
+  exit();
+   b:	e8 09 04 00 00       	call   419 <exit>
+
+00000010 <printf>:
+{
+  10:	55                   	push   %ebp
+  11:	89 e5                	mov    %esp,%ebp
+  13:	53                   	push   %ebx
+  14:	83 ec 10             	sub    $0x10,%esp
+  17:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  write(fd, s, strlen(s));
+  1a:	53                   	push   %ebx
+  1b:	e8 90 01 00 00       	call   1b0 <strlen>
+  20:	83 c4 0c             	add    $0xc,%esp
+  23:	50                   	push   %eax
+  24:	53                   	push   %ebx
+  25:	ff 75 08             	push   0x8(%ebp)
+  28:	e8 60 04 00 00       	call   48d <write>
+}
+  2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  30:	83 c4 10             	add    $0x10,%esp
+  33:	c9                   	leave
+  34:	c3                   	ret
+  35:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000040 <forktest>:
+{
+  40:	55                   	push   %ebp
+  41:	89 e5                	mov    %esp,%ebp
+  43:	53                   	push   %ebx
+  for(n=0; n<N; n++){
+  44:	31 db                	xor    %ebx,%ebx
+{
+  46:	83 ec 10             	sub    $0x10,%esp
+  write(fd, s, strlen(s));
+  49:	68 10 08 00 00       	push   $0x810
+  4e:	e8 5d 01 00 00       	call   1b0 <strlen>
+  53:	83 c4 0c             	add    $0xc,%esp
+  56:	50                   	push   %eax
+  57:	68 10 08 00 00       	push   $0x810
+  5c:	6a 01                	push   $0x1
+  5e:	e8 2a 04 00 00       	call   48d <write>
+  63:	83 c4 10             	add    $0x10,%esp
+  66:	eb 19                	jmp    81 <forktest+0x41>
+  68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6f:	90                   	nop
+    if(pid == 0)
+  70:	74 5b                	je     cd <forktest+0x8d>
+  for(n=0; n<N; n++){
+  72:	83 c3 01             	add    $0x1,%ebx
+  75:	81 fb 64 10 00 00    	cmp    $0x1064,%ebx
+  7b:	0f 84 86 00 00 00    	je     107 <forktest+0xc7>
+    pid = fork();
+  81:	e8 76 03 00 00       	call   3fc <fork>
+    if(pid < 0)
+  86:	85 c0                	test   %eax,%eax
+  88:	79 e6                	jns    70 <forktest+0x30>
+  for(; n > 0; n--){
+  8a:	85 db                	test   %ebx,%ebx
+  8c:	74 10                	je     9e <forktest+0x5e>
+  8e:	66 90                	xchg   %ax,%ax
+    if(wait() < 0){
+  90:	e8 a1 03 00 00       	call   436 <wait>
+  95:	85 c0                	test   %eax,%eax
+  97:	78 39                	js     d2 <forktest+0x92>
+  for(; n > 0; n--){
+  99:	83 eb 01             	sub    $0x1,%ebx
+  9c:	75 f2                	jne    90 <forktest+0x50>
+  if(wait() != -1){
+  9e:	e8 93 03 00 00       	call   436 <wait>
+  a3:	83 f8 ff             	cmp    $0xffffffff,%eax
+  a6:	75 4c                	jne    f4 <forktest+0xb4>
+  write(fd, s, strlen(s));
+  a8:	83 ec 0c             	sub    $0xc,%esp
+  ab:	68 42 08 00 00       	push   $0x842
+  b0:	e8 fb 00 00 00       	call   1b0 <strlen>
+  b5:	83 c4 0c             	add    $0xc,%esp
+  b8:	50                   	push   %eax
+  b9:	68 42 08 00 00       	push   $0x842
+  be:	6a 01                	push   $0x1
+  c0:	e8 c8 03 00 00       	call   48d <write>
+}
+  c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  c8:	83 c4 10             	add    $0x10,%esp
+  cb:	c9                   	leave
+  cc:	c3                   	ret
+      exit();
+  cd:	e8 47 03 00 00       	call   419 <exit>
+  write(fd, s, strlen(s));
+  d2:	83 ec 0c             	sub    $0xc,%esp
+  d5:	68 1b 08 00 00       	push   $0x81b
+  da:	e8 d1 00 00 00       	call   1b0 <strlen>
+  df:	83 c4 0c             	add    $0xc,%esp
+  e2:	50                   	push   %eax
+  e3:	68 1b 08 00 00       	push   $0x81b
+  e8:	6a 01                	push   $0x1
+  ea:	e8 9e 03 00 00       	call   48d <write>
+      exit();
+  ef:	e8 25 03 00 00       	call   419 <exit>
+    printf(1, "wait got too many\n");
+  f4:	50                   	push   %eax
+  f5:	50                   	push   %eax
+  f6:	68 2f 08 00 00       	push   $0x82f
+  fb:	6a 01                	push   $0x1
+  fd:	e8 0e ff ff ff       	call   10 <printf>
+    exit();
+ 102:	e8 12 03 00 00       	call   419 <exit>
+    printf(1, "fork claimed to work N times!\n", N);
+ 107:	52                   	push   %edx
+ 108:	68 64 10 00 00       	push   $0x1064
+ 10d:	68 50 08 00 00       	push   $0x850
+ 112:	6a 01                	push   $0x1
+ 114:	e8 f7 fe ff ff       	call   10 <printf>
+    exit();
+ 119:	e8 fb 02 00 00       	call   419 <exit>
+ 11e:	66 90                	xchg   %ax,%ax
+
+00000120 <strcpy>:
+#include "date.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 120:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 121:	31 c0                	xor    %eax,%eax
+{
+ 123:	89 e5                	mov    %esp,%ebp
+ 125:	53                   	push   %ebx
+ 126:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 129:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 130:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 134:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 137:	83 c0 01             	add    $0x1,%eax
+ 13a:	84 d2                	test   %dl,%dl
+ 13c:	75 f2                	jne    130 <strcpy+0x10>
+    ;
+  return os;
+}
+ 13e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 141:	89 c8                	mov    %ecx,%eax
+ 143:	c9                   	leave
+ 144:	c3                   	ret
+ 145:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	53                   	push   %ebx
+ 154:	8b 55 08             	mov    0x8(%ebp),%edx
+ 157:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 15a:	0f b6 02             	movzbl (%edx),%eax
+ 15d:	84 c0                	test   %al,%al
+ 15f:	75 17                	jne    178 <strcmp+0x28>
+ 161:	eb 3a                	jmp    19d <strcmp+0x4d>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 16c:	83 c2 01             	add    $0x1,%edx
+ 16f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 172:	84 c0                	test   %al,%al
+ 174:	74 1a                	je     190 <strcmp+0x40>
+    p++, q++;
+ 176:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 178:	0f b6 19             	movzbl (%ecx),%ebx
+ 17b:	38 c3                	cmp    %al,%bl
+ 17d:	74 e9                	je     168 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 17f:	29 d8                	sub    %ebx,%eax
+}
+ 181:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 184:	c9                   	leave
+ 185:	c3                   	ret
+ 186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 190:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 194:	31 c0                	xor    %eax,%eax
+ 196:	29 d8                	sub    %ebx,%eax
+}
+ 198:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 19b:	c9                   	leave
+ 19c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 19d:	0f b6 19             	movzbl (%ecx),%ebx
+ 1a0:	31 c0                	xor    %eax,%eax
+ 1a2:	eb db                	jmp    17f <strcmp+0x2f>
+ 1a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1af:	90                   	nop
+
+000001b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1b6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1b9:	74 15                	je     1d0 <strlen+0x20>
+ 1bb:	31 c0                	xor    %eax,%eax
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1c0:	83 c0 01             	add    $0x1,%eax
+ 1c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1c7:	89 c1                	mov    %eax,%ecx
+ 1c9:	75 f5                	jne    1c0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1cb:	89 c8                	mov    %ecx,%eax
+ 1cd:	5d                   	pop    %ebp
+ 1ce:	c3                   	ret
+ 1cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1d0:	31 c9                	xor    %ecx,%ecx
+}
+ 1d2:	5d                   	pop    %ebp
+ 1d3:	89 c8                	mov    %ecx,%eax
+ 1d5:	c3                   	ret
+ 1d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ed:	89 d7                	mov    %edx,%edi
+ 1ef:	fc                   	cld
+ 1f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1f5:	89 d0                	mov    %edx,%eax
+ 1f7:	c9                   	leave
+ 1f8:	c3                   	ret
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	8b 45 08             	mov    0x8(%ebp),%eax
+ 206:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 20a:	0f b6 10             	movzbl (%eax),%edx
+ 20d:	84 d2                	test   %dl,%dl
+ 20f:	75 12                	jne    223 <strchr+0x23>
+ 211:	eb 1d                	jmp    230 <strchr+0x30>
+ 213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 217:	90                   	nop
+ 218:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 21c:	83 c0 01             	add    $0x1,%eax
+ 21f:	84 d2                	test   %dl,%dl
+ 221:	74 0d                	je     230 <strchr+0x30>
+    if(*s == c)
+ 223:	38 d1                	cmp    %dl,%cl
+ 225:	75 f1                	jne    218 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 227:	5d                   	pop    %ebp
+ 228:	c3                   	ret
+ 229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 230:	31 c0                	xor    %eax,%eax
+}
+ 232:	5d                   	pop    %ebp
+ 233:	c3                   	ret
+ 234:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 23f:	90                   	nop
+
+00000240 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 245:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 248:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 249:	31 db                	xor    %ebx,%ebx
+{
+ 24b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 24e:	eb 27                	jmp    277 <gets+0x37>
+    cc = read(0, &c, 1);
+ 250:	83 ec 04             	sub    $0x4,%esp
+ 253:	6a 01                	push   $0x1
+ 255:	56                   	push   %esi
+ 256:	6a 00                	push   $0x0
+ 258:	e8 13 02 00 00       	call   470 <read>
+    if(cc < 1)
+ 25d:	83 c4 10             	add    $0x10,%esp
+ 260:	85 c0                	test   %eax,%eax
+ 262:	7e 1d                	jle    281 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 264:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 268:	8b 55 08             	mov    0x8(%ebp),%edx
+ 26b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 26f:	3c 0a                	cmp    $0xa,%al
+ 271:	74 10                	je     283 <gets+0x43>
+ 273:	3c 0d                	cmp    $0xd,%al
+ 275:	74 0c                	je     283 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 277:	89 df                	mov    %ebx,%edi
+ 279:	83 c3 01             	add    $0x1,%ebx
+ 27c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 27f:	7c cf                	jl     250 <gets+0x10>
+ 281:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 283:	8b 45 08             	mov    0x8(%ebp),%eax
+ 286:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 28a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 28d:	5b                   	pop    %ebx
+ 28e:	5e                   	pop    %esi
+ 28f:	5f                   	pop    %edi
+ 290:	5d                   	pop    %ebp
+ 291:	c3                   	ret
+ 292:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	56                   	push   %esi
+ 2a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2a5:	83 ec 08             	sub    $0x8,%esp
+ 2a8:	6a 00                	push   $0x0
+ 2aa:	ff 75 08             	push   0x8(%ebp)
+ 2ad:	e8 4f 02 00 00       	call   501 <open>
+  if(fd < 0)
+ 2b2:	83 c4 10             	add    $0x10,%esp
+ 2b5:	85 c0                	test   %eax,%eax
+ 2b7:	78 27                	js     2e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2b9:	83 ec 08             	sub    $0x8,%esp
+ 2bc:	ff 75 0c             	push   0xc(%ebp)
+ 2bf:	89 c3                	mov    %eax,%ebx
+ 2c1:	50                   	push   %eax
+ 2c2:	e8 91 02 00 00       	call   558 <fstat>
+  close(fd);
+ 2c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2cc:	e8 d9 01 00 00       	call   4aa <close>
+  return r;
+ 2d1:	83 c4 10             	add    $0x10,%esp
+}
+ 2d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2d7:	89 f0                	mov    %esi,%eax
+ 2d9:	5b                   	pop    %ebx
+ 2da:	5e                   	pop    %esi
+ 2db:	5d                   	pop    %ebp
+ 2dc:	c3                   	ret
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2e5:	eb ed                	jmp    2d4 <stat+0x34>
+ 2e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ee:	66 90                	xchg   %ax,%ax
+
+000002f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	53                   	push   %ebx
+ 2f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2f7:	0f be 02             	movsbl (%edx),%eax
+ 2fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 300:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 305:	77 1e                	ja     325 <atoi+0x35>
+ 307:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 310:	83 c2 01             	add    $0x1,%edx
+ 313:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 316:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 31a:	0f be 02             	movsbl (%edx),%eax
+ 31d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 320:	80 fb 09             	cmp    $0x9,%bl
+ 323:	76 eb                	jbe    310 <atoi+0x20>
+  return n;
+}
+ 325:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 328:	89 c8                	mov    %ecx,%eax
+ 32a:	c9                   	leave
+ 32b:	c3                   	ret
+ 32c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	57                   	push   %edi
+ 334:	56                   	push   %esi
+ 335:	8b 45 10             	mov    0x10(%ebp),%eax
+ 338:	8b 55 08             	mov    0x8(%ebp),%edx
+ 33b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 33e:	85 c0                	test   %eax,%eax
+ 340:	7e 13                	jle    355 <memmove+0x25>
+ 342:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 344:	89 d7                	mov    %edx,%edi
+ 346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 350:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 351:	39 f8                	cmp    %edi,%eax
+ 353:	75 fb                	jne    350 <memmove+0x20>
+  return vdst;
+}
+ 355:	5e                   	pop    %esi
+ 356:	89 d0                	mov    %edx,%eax
+ 358:	5f                   	pop    %edi
+ 359:	5d                   	pop    %ebp
+ 35a:	c3                   	ret
+ 35b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 35f:	90                   	nop
+
+00000360 <ugetpid>:
+// getpid() without a system call, from the page at UPROC.
+int
+ugetpid(void)
+{
+  return ((struct uproc*)UPROC)->pid;
+}
+ 360:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+ 365:	c3                   	ret
+ 366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000370 <uclocktime>:
+
+// clocktime() without a system call, from the page at UCLOCK.
+int
+uclocktime(struct timespec *ts)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	57                   	push   %edi
+ 374:	56                   	push   %esi
+ 375:	53                   	push   %ebx
+ 376:	83 ec 1c             	sub    $0x1c,%esp
+  struct uclock *c = (struct uclock*)UCLOCK;
+
+  if(c->tscmult == 0)
+ 379:	8b 0d 08 f0 ff 7f    	mov    0x7ffff008,%ecx
+{
+ 37f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(c->tscmult == 0)
+ 382:	85 c9                	test   %ecx,%ecx
+ 384:	74 6a                	je     3f0 <uclocktime+0x80>
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+ 386:	0f 31                	rdtsc
+static inline void
+uclockread(struct uclock *c, uint64 tsc, struct timespec *ts)
+{
+  uint64 d, ns;
+
+  d = tsc - c->tscbase;
+ 388:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 38e:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+ 394:	89 c6                	mov    %eax,%esi
+  if((long long)d < 0)  // another CPU's TSC is a little behind
+ 396:	85 d2                	test   %edx,%edx
+ 398:	78 46                	js     3e0 <uclocktime+0x70>
+    d = 0;
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 39a:	89 d0                	mov    %edx,%eax
+ 39c:	f7 e1                	mul    %ecx
+ 39e:	0f a4 c2 08          	shld   $0x8,%eax,%edx
+ 3a2:	c1 e0 08             	shl    $0x8,%eax
+ 3a5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+ 3a8:	89 f0                	mov    %esi,%eax
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 3aa:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+ 3ad:	f7 e1                	mul    %ecx
+ 3af:	0f ac d0 18          	shrd   $0x18,%edx,%eax
+ 3b3:	c1 ea 18             	shr    $0x18,%edx
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 3b6:	03 45 e0             	add    -0x20(%ebp),%eax
+ 3b9:	13 55 e4             	adc    -0x1c(%ebp),%edx
+// linked with libgcc, so it cannot use 64-bit '/' or '%'.
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+  asm("divl %4" : "=a" (q), "=d" (r) : "a" ((uint)n), "d" ((uint)(n>>32)), "rm" (d));
+ 3bc:	89 c7                	mov    %eax,%edi
+ 3be:	89 f8                	mov    %edi,%eax
+ 3c0:	b9 00 ca 9a 3b       	mov    $0x3b9aca00,%ecx
+ 3c5:	f7 f1                	div    %ecx
+  ts->sec = divl(ns, 1000000000, &ts->nsec);
+ 3c7:	89 03                	mov    %eax,(%ebx)
+    return clocktime(ts);
+  uclockread(c, rdtsc(), ts);
+  return 0;
+}
+ 3c9:	31 c0                	xor    %eax,%eax
+  *rem = r;
+ 3cb:	89 53 04             	mov    %edx,0x4(%ebx)
+ 3ce:	83 c4 1c             	add    $0x1c,%esp
+ 3d1:	5b                   	pop    %ebx
+ 3d2:	5e                   	pop    %esi
+ 3d3:	5f                   	pop    %edi
+ 3d4:	5d                   	pop    %ebp
+ 3d5:	c3                   	ret
+ 3d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 3e0:	31 d2                	xor    %edx,%edx
+ 3e2:	31 ff                	xor    %edi,%edi
+ 3e4:	eb d8                	jmp    3be <uclocktime+0x4e>
+ 3e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 3f0:	83 c4 1c             	add    $0x1c,%esp
+ 3f3:	5b                   	pop    %ebx
+ 3f4:	5e                   	pop    %esi
+ 3f5:	5f                   	pop    %edi
+ 3f6:	5d                   	pop    %ebp
+    return clocktime(ts);
+ 3f7:	e9 f2 02 00 00       	jmp    6ee <clocktime>
+
+000003fc <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+ 3fc:	b8 01 00 00 00       	mov    $0x1,%eax
+ 401:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 408:	00 00 00 
+ 40b:	74 09                	je     416 <fork+0x1a>
+ 40d:	89 e1                	mov    %esp,%ecx
+ 40f:	ba 18 04 00 00       	mov    $0x418,%edx
+ 414:	0f 34                	sysenter
+ 416:	cd 40                	int    $0x40
+ 418:	c3                   	ret
+
+00000419 <exit>:
+SYSCALL(exit)
+ 419:	b8 02 00 00 00       	mov    $0x2,%eax
+ 41e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 425:	00 00 00 
+ 428:	74 09                	je     433 <exit+0x1a>
+ 42a:	89 e1                	mov    %esp,%ecx
+ 42c:	ba 35 04 00 00       	mov    $0x435,%edx
+ 431:	0f 34                	sysenter
+ 433:	cd 40                	int    $0x40
+ 435:	c3                   	ret
+
+00000436 <wait>:
+SYSCALL(wait)
+ 436:	b8 03 00 00 00       	mov    $0x3,%eax
+ 43b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 442:	00 00 00 
+ 445:	74 09                	je     450 <wait+0x1a>
+ 447:	89 e1                	mov    %esp,%ecx
+ 449:	ba 52 04 00 00       	mov    $0x452,%edx
+ 44e:	0f 34                	sysenter
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <pipe>:
+SYSCALL(pipe)
+ 453:	b8 04 00 00 00       	mov    $0x4,%eax
+ 458:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 45f:	00 00 00 
+ 462:	74 09                	je     46d <pipe+0x1a>
+ 464:	89 e1                	mov    %esp,%ecx
+ 466:	ba 6f 04 00 00       	mov    $0x46f,%edx
+ 46b:	0f 34                	sysenter
+ 46d:	cd 40                	int    $0x40
+ 46f:	c3                   	ret
+
+00000470 <read>:
+SYSCALL(read)
+ 470:	b8 05 00 00 00       	mov    $0x5,%eax
+ 475:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 47c:	00 00 00 
+ 47f:	74 09                	je     48a <read+0x1a>
+ 481:	89 e1                	mov    %esp,%ecx
+ 483:	ba 8c 04 00 00       	mov    $0x48c,%edx
+ 488:	0f 34                	sysenter
+ 48a:	cd 40                	int    $0x40
+ 48c:	c3                   	ret
+
+0000048d <write>:
+SYSCALL(write)
+ 48d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 492:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 499:	00 00 00 
+ 49c:	74 09                	je     4a7 <write+0x1a>
+ 49e:	89 e1                	mov    %esp,%ecx
+ 4a0:	ba a9 04 00 00       	mov    $0x4a9,%edx
+ 4a5:	0f 34                	sysenter
+ 4a7:	cd 40                	int    $0x40
+ 4a9:	c3                   	ret
+
+000004aa <close>:
+SYSCALL(close)
+ 4aa:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4af:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4b6:	00 00 00 
+ 4b9:	74 09                	je     4c4 <close+0x1a>
+ 4bb:	89 e1                	mov    %esp,%ecx
+ 4bd:	ba c6 04 00 00       	mov    $0x4c6,%edx
+ 4c2:	0f 34                	sysenter
+ 4c4:	cd 40                	int    $0x40
+ 4c6:	c3                   	ret
+
+000004c7 <kill>:
+SYSCALL(kill)
+ 4c7:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4cc:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4d3:	00 00 00 
+ 4d6:	74 09                	je     4e1 <kill+0x1a>
+ 4d8:	89 e1                	mov    %esp,%ecx
+ 4da:	ba e3 04 00 00       	mov    $0x4e3,%edx
+ 4df:	0f 34                	sysenter
+ 4e1:	cd 40                	int    $0x40
+ 4e3:	c3                   	ret
+
+000004e4 <exec>:
+SYSCALL(exec)
+ 4e4:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4e9:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4f0:	00 00 00 
+ 4f3:	74 09                	je     4fe <exec+0x1a>
+ 4f5:	89 e1                	mov    %esp,%ecx
+ 4f7:	ba 00 05 00 00       	mov    $0x500,%edx
+ 4fc:	0f 34                	sysenter
+ 4fe:	cd 40                	int    $0x40
+ 500:	c3                   	ret
+
+00000501 <open>:
+SYSCALL(open)
+ 501:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 506:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 50d:	00 00 00 
+ 510:	74 09                	je     51b <open+0x1a>
+ 512:	89 e1                	mov    %esp,%ecx
+ 514:	ba 1d 05 00 00       	mov    $0x51d,%edx
+ 519:	0f 34                	sysenter
+ 51b:	cd 40                	int    $0x40
+ 51d:	c3                   	ret
+
+0000051e <mknod>:
+SYSCALL(mknod)
+ 51e:	b8 11 00 00 00       	mov    $0x11,%eax
+ 523:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 52a:	00 00 00 
+ 52d:	74 09                	je     538 <mknod+0x1a>
+ 52f:	89 e1                	mov    %esp,%ecx
+ 531:	ba 3a 05 00 00       	mov    $0x53a,%edx
+ 536:	0f 34                	sysenter
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <unlink>:
+SYSCALL(unlink)
+ 53b:	b8 12 00 00 00       	mov    $0x12,%eax
+ 540:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 547:	00 00 00 
+ 54a:	74 09                	je     555 <unlink+0x1a>
+ 54c:	89 e1                	mov    %esp,%ecx
+ 54e:	ba 57 05 00 00       	mov    $0x557,%edx
+ 553:	0f 34                	sysenter
+ 555:	cd 40                	int    $0x40
+ 557:	c3                   	ret
+
+00000558 <fstat>:
+SYSCALL(fstat)
+ 558:	b8 08 00 00 00       	mov    $0x8,%eax
+ 55d:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 564:	00 00 00 
+ 567:	74 09                	je     572 <fstat+0x1a>
+ 569:	89 e1                	mov    %esp,%ecx
+ 56b:	ba 74 05 00 00       	mov    $0x574,%edx
+ 570:	0f 34                	sysenter
+ 572:	cd 40                	int    $0x40
+ 574:	c3                   	ret
+
+00000575 <link>:
+SYSCALL(link)
+ 575:	b8 13 00 00 00       	mov    $0x13,%eax
+ 57a:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 581:	00 00 00 
+ 584:	74 09                	je     58f <link+0x1a>
+ 586:	89 e1                	mov    %esp,%ecx
+ 588:	ba 91 05 00 00       	mov    $0x591,%edx
+ 58d:	0f 34                	sysenter
+ 58f:	cd 40                	int    $0x40
+ 591:	c3                   	ret
+
+00000592 <mkdir>:
+SYSCALL(mkdir)
+ 592:	b8 14 00 00 00       	mov    $0x14,%eax
+ 597:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 59e:	00 00 00 
+ 5a1:	74 09                	je     5ac <mkdir+0x1a>
+ 5a3:	89 e1                	mov    %esp,%ecx
+ 5a5:	ba ae 05 00 00       	mov    $0x5ae,%edx
+ 5aa:	0f 34                	sysenter
+ 5ac:	cd 40                	int    $0x40
+ 5ae:	c3                   	ret
+
+000005af <chdir>:
+SYSCALL(chdir)
+ 5af:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5b4:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5bb:	00 00 00 
+ 5be:	74 09                	je     5c9 <chdir+0x1a>
+ 5c0:	89 e1                	mov    %esp,%ecx
+ 5c2:	ba cb 05 00 00       	mov    $0x5cb,%edx
+ 5c7:	0f 34                	sysenter
+ 5c9:	cd 40                	int    $0x40
+ 5cb:	c3                   	ret
+
+000005cc <dup>:
+SYSCALL(dup)
+ 5cc:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5d1:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5d8:	00 00 00 
+ 5db:	74 09                	je     5e6 <dup+0x1a>
+ 5dd:	89 e1                	mov    %esp,%ecx
+ 5df:	ba e8 05 00 00       	mov    $0x5e8,%edx
+ 5e4:	0f 34                	sysenter
+ 5e6:	cd 40                	int    $0x40
+ 5e8:	c3                   	ret
+
+000005e9 <getpid>:
+SYSCALL(getpid)
+ 5e9:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5ee:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5f5:	00 00 00 
+ 5f8:	74 09                	je     603 <getpid+0x1a>
+ 5fa:	89 e1                	mov    %esp,%ecx
+ 5fc:	ba 05 06 00 00       	mov    $0x605,%edx
+ 601:	0f 34                	sysenter
+ 603:	cd 40                	int    $0x40
+ 605:	c3                   	ret
+
+00000606 <sbrk>:
+SYSCALL(sbrk)
+ 606:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 60b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 612:	00 00 00 
+ 615:	74 09                	je     620 <sbrk+0x1a>
+ 617:	89 e1                	mov    %esp,%ecx
+ 619:	ba 22 06 00 00       	mov    $0x622,%edx
+ 61e:	0f 34                	sysenter
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <sleep>:
+SYSCALL(sleep)
+ 623:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 628:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 62f:	00 00 00 
+ 632:	74 09                	je     63d <sleep+0x1a>
+ 634:	89 e1                	mov    %esp,%ecx
+ 636:	ba 3f 06 00 00       	mov    $0x63f,%edx
+ 63b:	0f 34                	sysenter
+ 63d:	cd 40                	int    $0x40
+ 63f:	c3                   	ret
+
+00000640 <uptime>:
+SYSCALL(uptime)
+ 640:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 645:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 64c:	00 00 00 
+ 64f:	74 09                	je     65a <uptime+0x1a>
+ 651:	89 e1                	mov    %esp,%ecx
+ 653:	ba 5c 06 00 00       	mov    $0x65c,%edx
+ 658:	0f 34                	sysenter
+ 65a:	cd 40                	int    $0x40
+ 65c:	c3                   	ret
+
+0000065d <swapread>:
+SYSCALL(swapread)
+ 65d:	b8 16 00 00 00       	mov    $0x16,%eax
+ 662:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 669:	00 00 00 
+ 66c:	74 09                	je     677 <swapread+0x1a>
+ 66e:	89 e1                	mov    %esp,%ecx
+ 670:	ba 79 06 00 00       	mov    $0x679,%edx
+ 675:	0f 34                	sysenter
+ 677:	cd 40                	int    $0x40
+ 679:	c3                   	ret
+
+0000067a <swapwrite>:
+SYSCALL(swapwrite)
+ 67a:	b8 17 00 00 00       	mov    $0x17,%eax
+ 67f:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 686:	00 00 00 
+ 689:	74 09                	je     694 <swapwrite+0x1a>
+ 68b:	89 e1                	mov    %esp,%ecx
+ 68d:	ba 96 06 00 00       	mov    $0x696,%edx
+ 692:	0f 34                	sysenter
+ 694:	cd 40                	int    $0x40
+ 696:	c3                   	ret
+
+00000697 <setaffinity>:
+SYSCALL(setaffinity)
+ 697:	b8 18 00 00 00       	mov    $0x18,%eax
+ 69c:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6a3:	00 00 00 
+ 6a6:	74 09                	je     6b1 <setaffinity+0x1a>
+ 6a8:	89 e1                	mov    %esp,%ecx
+ 6aa:	ba b3 06 00 00       	mov    $0x6b3,%edx
+ 6af:	0f 34                	sysenter
+ 6b1:	cd 40                	int    $0x40
+ 6b3:	c3                   	ret
+
+000006b4 <getaffinity>:
+SYSCALL(getaffinity)
+ 6b4:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6b9:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6c0:	00 00 00 
+ 6c3:	74 09                	je     6ce <getaffinity+0x1a>
+ 6c5:	89 e1                	mov    %esp,%ecx
+ 6c7:	ba d0 06 00 00       	mov    $0x6d0,%edx
+ 6cc:	0f 34                	sysenter
+ 6ce:	cd 40                	int    $0x40
+ 6d0:	c3                   	ret
+
+000006d1 <nanosleep>:
+SYSCALL(nanosleep)
+ 6d1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6d6:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6dd:	00 00 00 
+ 6e0:	74 09                	je     6eb <nanosleep+0x1a>
+ 6e2:	89 e1                	mov    %esp,%ecx
+ 6e4:	ba ed 06 00 00       	mov    $0x6ed,%edx
+ 6e9:	0f 34                	sysenter
+ 6eb:	cd 40                	int    $0x40
+ 6ed:	c3                   	ret
+
+000006ee <clocktime>:
+SYSCALL(clocktime)
+ 6ee:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6f3:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6fa:	00 00 00 
+ 6fd:	74 09                	je     708 <clocktime+0x1a>
+ 6ff:	89 e1                	mov    %esp,%ecx
+ 701:	ba 0a 07 00 00       	mov    $0x70a,%edx
+ 706:	0f 34                	sysenter
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <batch>:
+SYSCALL(batch)
+ 70b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 710:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 717:	00 00 00 
+ 71a:	74 09                	je     725 <batch+0x1a>
+ 71c:	89 e1                	mov    %esp,%ecx
+ 71e:	ba 27 07 00 00       	mov    $0x727,%edx
+ 723:	0f 34                	sysenter
+ 725:	cd 40                	int    $0x40
+ 727:	c3                   	ret
+
+00000728 <aiosetup>:
+SYSCALL(aiosetup)
+ 728:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 72d:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 734:	00 00 00 
+ 737:	74 09                	je     742 <aiosetup+0x1a>
+ 739:	89 e1                	mov    %esp,%ecx
+ 73b:	ba 44 07 00 00       	mov    $0x744,%edx
+ 740:	0f 34                	sysenter
+ 742:	cd 40                	int    $0x40
+ 744:	c3                   	ret
+
+00000745 <aiowait>:
+SYSCALL(aiowait)
+ 745:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 74a:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 751:	00 00 00 
+ 754:	74 09                	je     75f <aiowait+0x1a>
+ 756:	89 e1                	mov    %esp,%ecx
+ 758:	ba 61 07 00 00       	mov    $0x761,%edx
+ 75d:	0f 34                	sysenter
+ 75f:	cd 40                	int    $0x40
+ 761:	c3                   	ret
+
+00000762 <spawn>:
+SYSCALL(spawn)
+ 762:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 767:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 76e:	00 00 00 
+ 771:	74 09                	je     77c <spawn+0x1a>
+ 773:	89 e1                	mov    %esp,%ecx
+ 775:	ba 7e 07 00 00       	mov    $0x77e,%edx
+ 77a:	0f 34                	sysenter
+ 77c:	cd 40                	int    $0x40
+ 77e:	c3                   	ret
+
+0000077f <getprocinfo>:
+SYSCALL(getprocinfo)
+ 77f:	b8 20 00 00 00       	mov    $0x20,%eax
+ 784:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 78b:	00 00 00 
+ 78e:	74 09                	je     799 <getprocinfo+0x1a>
+ 790:	89 e1                	mov    %esp,%ecx
+ 792:	ba 9b 07 00 00       	mov    $0x79b,%edx
+ 797:	0f 34                	sysenter
+ 799:	cd 40                	int    $0x40
+ 79b:	c3                   	ret
+
+0000079c <getlockstat>:
+SYSCALL(getlockstat)
+ 79c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 7a1:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 7a8:	00 00 00 
+ 7ab:	74 09                	je     7b6 <getlockstat+0x1a>
+ 7ad:	89 e1                	mov    %esp,%ecx
+ 7af:	ba b8 07 00 00       	mov    $0x7b8,%edx
+ 7b4:	0f 34                	sysenter
+ 7b6:	cd 40                	int    $0x40
+ 7b8:	c3                   	ret
+
+000007b9 <lockprof>:
+SYSCALL(lockprof)
+ 7b9:	b8 22 00 00 00       	mov    $0x22,%eax
+ 7be:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 7c5:	00 00 00 
+ 7c8:	74 09                	je     7d3 <lockprof+0x1a>
+ 7ca:	89 e1                	mov    %esp,%ecx
+ 7cc:	ba d5 07 00 00       	mov    $0x7d5,%edx
+ 7d1:	0f 34                	sysenter
+ 7d3:	cd 40                	int    $0x40
+ 7d5:	c3                   	ret
+
+000007d6 <getlockprof>:
+SYSCALL(getlockprof)
+ 7d6:	b8 23 00 00 00       	mov    $0x23,%eax
+ 7db:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 7e2:	00 00 00 
+ 7e5:	74 09                	je     7f0 <getlockprof+0x1a>
+ 7e7:	89 e1                	mov    %esp,%ecx
+ 7e9:	ba f2 07 00 00       	mov    $0x7f2,%edx
+ 7ee:	0f 34                	sysenter
+ 7f0:	cd 40                	int    $0x40
+ 7f2:	c3                   	ret
+
+000007f3 <diskstat>:
+SYSCALL(diskstat)
+ 7f3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 7f8:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 7ff:	00 00 00 
+ 802:	74 09                	je     80d <diskstat+0x1a>
+ 804:	89 e1                	mov    %esp,%ecx
+ 806:	ba 0f 08 00 00       	mov    $0x80f,%edx
+ 80b:	0f 34                	sysenter
+ 80d:	cd 40                	int    $0x40
+ 80f:	c3                   	ret
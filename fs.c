@@ -311,11 +311,28 @@ ilock(struct inode *ip)
   }
 }
 
+// Lock the given inode shared, for a caller that only
+// reads it with readi(), dirlookup() or stati().  If the
+// inode must first be read from disk, this locks it
+// exclusively instead; iunlock() releases either.
+void
+ilockshared(struct inode *ip)
+{
+  if(ip == 0 || ip->ref < 1)
+    panic("ilockshared");
+
+  acquiresleepshared(&ip->lock);
+  if(ip->valid == 0){
+    releasesleep(&ip->lock);
+    ilock(ip);
+  }
+}
+
 // Unlock the given inode.
 void
 iunlock(struct inode *ip)
 {
-  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+  if(ip == 0 || !lockedsleep(&ip->lock) || ip->ref < 1)
     panic("iunlock");
 
   releasesleep(&ip->lock);
@@ -446,6 +463,23 @@ stati(struct inode *ip, struct stat *st)
   st->size = ip->size;
 }
 
+// Start reading the blocks that hold bytes [off, off+n)
+// of ip into the buffer cache, without waiting for them.
+// Caller must hold ip->lock.
+void
+ireadahead(struct inode *ip, uint off, uint n)
+{
+  uint bn, end;
+
+  if(ip->type == T_DEV || off >= ip->size)
+    return;
+  if(n > ip->size - off)
+    n = ip->size - off;
+  end = (off + n + BSIZE - 1) / BSIZE;
+  for(bn = off/BSIZE; bn < end; bn++)
+    breadahead(ip->dev, bmap(ip, bn));
+}
+
 //PAGEBREAK!
 // Read data from inode.
 // Caller must hold ip->lock.
@@ -632,7 +666,7 @@ namex(char *path, int nameiparent, char *name)
     ip = idup(myproc()->cwd);
 
   while((path = skipelem(path, name)) != 0){
-    ilock(ip);
+    ilockshared(ip);
     if(ip->type != T_DIR){
       iunlockput(ip);
       return 0;
@@ -689,17 +723,22 @@ void swapread(char* ptr, int blkno)
 
 void swapwrite(char* ptr, int blkno)
 {
-	struct buf* bp;
+	struct buf* bp[8];
 	int i;
 
 	if ( blkno < 0 || blkno >= SWAPMAX )
 		panic("swapread: blkno exceed range");
 
+	// Start all eight writes before waiting, so the disk
+	// driver can do them as one command.
 	for ( i=0; i < 8; ++i ) {
-		bp = bread(0, blkno + SWAPBASE + i);
-		memmove(bp->data, ptr + i * BSIZE, BSIZE);
-		bwrite(bp);
-		brelse(bp);
+		bp[i] = bread(0, blkno + SWAPBASE + i);
+		memmove(bp[i]->data, ptr + i * BSIZE, BSIZE);
+		bwrite_async(bp[i]);
+	}
+	for ( i=0; i < 8; ++i ) {
+		bwait(bp[i]);
+		brelse(bp[i]);
 	}
 }
 
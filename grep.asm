@@ -0,0 +1,1973 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 01                	mov    (%ecx),%eax
+  16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  19:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int fd, i;
+  char *pattern;
+
+  if(argc <= 1){
+  1c:	83 f8 01             	cmp    $0x1,%eax
+  1f:	7e 6f                	jle    90 <main+0x90>
+    printf(2, "usage: grep pattern [file ...]\n");
+    exit();
+  }
+  pattern = argv[1];
+  21:	8b 43 04             	mov    0x4(%ebx),%eax
+  24:	83 c3 08             	add    $0x8,%ebx
+
+  if(argc <= 2){
+  27:	83 7d e4 02          	cmpl   $0x2,-0x1c(%ebp)
+    grep(pattern, 0);
+    exit();
+  }
+
+  for(i = 2; i < argc; i++){
+  2b:	be 02 00 00 00       	mov    $0x2,%esi
+  pattern = argv[1];
+  30:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(argc <= 2){
+  33:	75 2d                	jne    62 <main+0x62>
+  35:	eb 6c                	jmp    a3 <main+0xa3>
+  37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  3e:	66 90                	xchg   %ax,%ax
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      exit();
+    }
+    grep(pattern, fd);
+  40:	83 ec 08             	sub    $0x8,%esp
+  for(i = 2; i < argc; i++){
+  43:	83 c6 01             	add    $0x1,%esi
+  46:	83 c3 04             	add    $0x4,%ebx
+    grep(pattern, fd);
+  49:	50                   	push   %eax
+  4a:	ff 75 e0             	push   -0x20(%ebp)
+  4d:	e8 9e 01 00 00       	call   1f0 <grep>
+    close(fd);
+  52:	89 3c 24             	mov    %edi,(%esp)
+  55:	e8 d0 06 00 00       	call   72a <close>
+  for(i = 2; i < argc; i++){
+  5a:	83 c4 10             	add    $0x10,%esp
+  5d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  60:	7e 29                	jle    8b <main+0x8b>
+    if((fd = open(argv[i], 0)) < 0){
+  62:	83 ec 08             	sub    $0x8,%esp
+  65:	6a 00                	push   $0x0
+  67:	ff 33                	push   (%ebx)
+  69:	e8 13 07 00 00       	call   781 <open>
+  6e:	83 c4 10             	add    $0x10,%esp
+  71:	89 c7                	mov    %eax,%edi
+  73:	85 c0                	test   %eax,%eax
+  75:	79 c9                	jns    40 <main+0x40>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+  77:	50                   	push   %eax
+  78:	ff 33                	push   (%ebx)
+  7a:	68 78 0e 00 00       	push   $0xe78
+  7f:	6a 01                	push   $0x1
+  81:	e8 aa 0a 00 00       	call   b30 <printf>
+      exit();
+  86:	e8 0e 06 00 00       	call   699 <exit>
+  }
+  exit();
+  8b:	e8 09 06 00 00       	call   699 <exit>
+    printf(2, "usage: grep pattern [file ...]\n");
+  90:	51                   	push   %ecx
+  91:	51                   	push   %ecx
+  92:	68 58 0e 00 00       	push   $0xe58
+  97:	6a 02                	push   $0x2
+  99:	e8 92 0a 00 00       	call   b30 <printf>
+    exit();
+  9e:	e8 f6 05 00 00       	call   699 <exit>
+    grep(pattern, 0);
+  a3:	52                   	push   %edx
+  a4:	52                   	push   %edx
+  a5:	6a 00                	push   $0x0
+  a7:	50                   	push   %eax
+  a8:	e8 43 01 00 00       	call   1f0 <grep>
+    exit();
+  ad:	e8 e7 05 00 00       	call   699 <exit>
+  b2:	66 90                	xchg   %ax,%ax
+  b4:	66 90                	xchg   %ax,%ax
+  b6:	66 90                	xchg   %ax,%ax
+  b8:	66 90                	xchg   %ax,%ax
+  ba:	66 90                	xchg   %ax,%ax
+  bc:	66 90                	xchg   %ax,%ax
+  be:	66 90                	xchg   %ax,%ax
+
+000000c0 <matchhere>:
+  return 0;
+}
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	57                   	push   %edi
+  c4:	56                   	push   %esi
+  c5:	53                   	push   %ebx
+  c6:	83 ec 0c             	sub    $0xc,%esp
+  c9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(re[0] == '\0')
+  cf:	0f b6 0f             	movzbl (%edi),%ecx
+  d2:	84 c9                	test   %cl,%cl
+  d4:	0f 84 96 00 00 00    	je     170 <matchhere+0xb0>
+    return 1;
+  if(re[1] == '*')
+  da:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+  de:	3c 2a                	cmp    $0x2a,%al
+  e0:	74 2d                	je     10f <matchhere+0x4f>
+  e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return matchstar(re[0], re+2, text);
+  if(re[0] == '$' && re[1] == '\0')
+    return *text == '\0';
+  e8:	0f b6 33             	movzbl (%ebx),%esi
+  if(re[0] == '$' && re[1] == '\0')
+  eb:	80 f9 24             	cmp    $0x24,%cl
+  ee:	74 50                	je     140 <matchhere+0x80>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+  f0:	89 f2                	mov    %esi,%edx
+  f2:	84 d2                	test   %dl,%dl
+  f4:	74 6e                	je     164 <matchhere+0xa4>
+  f6:	80 f9 2e             	cmp    $0x2e,%cl
+  f9:	75 65                	jne    160 <matchhere+0xa0>
+    return matchhere(re+1, text+1);
+  fb:	83 c3 01             	add    $0x1,%ebx
+  fe:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 101:	84 c0                	test   %al,%al
+ 103:	74 6b                	je     170 <matchhere+0xb0>
+ 105:	89 c1                	mov    %eax,%ecx
+  if(re[1] == '*')
+ 107:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+ 10b:	3c 2a                	cmp    $0x2a,%al
+ 10d:	75 d9                	jne    e8 <matchhere+0x28>
+    return matchstar(re[0], re+2, text);
+ 10f:	8d 77 02             	lea    0x2(%edi),%esi
+ 112:	0f be f9             	movsbl %cl,%edi
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+ 115:	8d 76 00             	lea    0x0(%esi),%esi
+{
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+ 118:	83 ec 08             	sub    $0x8,%esp
+ 11b:	53                   	push   %ebx
+ 11c:	56                   	push   %esi
+ 11d:	e8 9e ff ff ff       	call   c0 <matchhere>
+ 122:	83 c4 10             	add    $0x10,%esp
+ 125:	85 c0                	test   %eax,%eax
+ 127:	75 47                	jne    170 <matchhere+0xb0>
+      return 1;
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 129:	0f be 13             	movsbl (%ebx),%edx
+ 12c:	84 d2                	test   %dl,%dl
+ 12e:	74 45                	je     175 <matchhere+0xb5>
+ 130:	83 c3 01             	add    $0x1,%ebx
+ 133:	39 fa                	cmp    %edi,%edx
+ 135:	74 e1                	je     118 <matchhere+0x58>
+ 137:	83 ff 2e             	cmp    $0x2e,%edi
+ 13a:	74 dc                	je     118 <matchhere+0x58>
+ 13c:	eb 37                	jmp    175 <matchhere+0xb5>
+ 13e:	66 90                	xchg   %ax,%ax
+  if(re[0] == '$' && re[1] == '\0')
+ 140:	84 c0                	test   %al,%al
+ 142:	74 39                	je     17d <matchhere+0xbd>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 144:	89 f2                	mov    %esi,%edx
+ 146:	84 d2                	test   %dl,%dl
+ 148:	74 1a                	je     164 <matchhere+0xa4>
+ 14a:	80 fa 24             	cmp    $0x24,%dl
+ 14d:	75 15                	jne    164 <matchhere+0xa4>
+    return matchhere(re+1, text+1);
+ 14f:	83 c3 01             	add    $0x1,%ebx
+ 152:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 155:	89 c1                	mov    %eax,%ecx
+ 157:	eb ae                	jmp    107 <matchhere+0x47>
+ 159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 160:	38 ca                	cmp    %cl,%dl
+ 162:	74 97                	je     fb <matchhere+0x3b>
+}
+ 164:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+ 167:	31 c0                	xor    %eax,%eax
+}
+ 169:	5b                   	pop    %ebx
+ 16a:	5e                   	pop    %esi
+ 16b:	5f                   	pop    %edi
+ 16c:	5d                   	pop    %ebp
+ 16d:	c3                   	ret
+ 16e:	66 90                	xchg   %ax,%ax
+    return 1;
+ 170:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 175:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 178:	5b                   	pop    %ebx
+ 179:	5e                   	pop    %esi
+ 17a:	5f                   	pop    %edi
+ 17b:	5d                   	pop    %ebp
+ 17c:	c3                   	ret
+    return *text == '\0';
+ 17d:	89 f0                	mov    %esi,%eax
+ 17f:	84 c0                	test   %al,%al
+ 181:	0f 94 c0             	sete   %al
+ 184:	0f b6 c0             	movzbl %al,%eax
+ 187:	eb ec                	jmp    175 <matchhere+0xb5>
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000190 <match>:
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	56                   	push   %esi
+ 194:	53                   	push   %ebx
+ 195:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 198:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(re[0] == '^')
+ 19b:	80 3b 5e             	cmpb   $0x5e,(%ebx)
+ 19e:	75 11                	jne    1b1 <match+0x21>
+ 1a0:	eb 2e                	jmp    1d0 <match+0x40>
+ 1a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  }while(*text++ != '\0');
+ 1a8:	83 c6 01             	add    $0x1,%esi
+ 1ab:	80 7e ff 00          	cmpb   $0x0,-0x1(%esi)
+ 1af:	74 16                	je     1c7 <match+0x37>
+    if(matchhere(re, text))
+ 1b1:	83 ec 08             	sub    $0x8,%esp
+ 1b4:	56                   	push   %esi
+ 1b5:	53                   	push   %ebx
+ 1b6:	e8 05 ff ff ff       	call   c0 <matchhere>
+ 1bb:	83 c4 10             	add    $0x10,%esp
+ 1be:	85 c0                	test   %eax,%eax
+ 1c0:	74 e6                	je     1a8 <match+0x18>
+      return 1;
+ 1c2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 1c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1ca:	5b                   	pop    %ebx
+ 1cb:	5e                   	pop    %esi
+ 1cc:	5d                   	pop    %ebp
+ 1cd:	c3                   	ret
+ 1ce:	66 90                	xchg   %ax,%ax
+    return matchhere(re+1, text);
+ 1d0:	83 c3 01             	add    $0x1,%ebx
+ 1d3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 1d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1d9:	5b                   	pop    %ebx
+ 1da:	5e                   	pop    %esi
+ 1db:	5d                   	pop    %ebp
+    return matchhere(re+1, text);
+ 1dc:	e9 df fe ff ff       	jmp    c0 <matchhere>
+ 1e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ef:	90                   	nop
+
+000001f0 <grep>:
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	57                   	push   %edi
+  m = 0;
+ 1f4:	31 ff                	xor    %edi,%edi
+{
+ 1f6:	56                   	push   %esi
+ 1f7:	53                   	push   %ebx
+ 1f8:	83 ec 1c             	sub    $0x1c,%esp
+ 1fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 1fe:	89 7d e0             	mov    %edi,-0x20(%ebp)
+    return matchhere(re+1, text);
+ 201:	8d 43 01             	lea    0x1(%ebx),%eax
+ 204:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+ 210:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 213:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+ 218:	83 ec 04             	sub    $0x4,%esp
+ 21b:	29 c8                	sub    %ecx,%eax
+ 21d:	50                   	push   %eax
+ 21e:	8d 81 e0 12 00 00    	lea    0x12e0(%ecx),%eax
+ 224:	50                   	push   %eax
+ 225:	ff 75 0c             	push   0xc(%ebp)
+ 228:	e8 c3 04 00 00       	call   6f0 <read>
+ 22d:	83 c4 10             	add    $0x10,%esp
+ 230:	85 c0                	test   %eax,%eax
+ 232:	0f 8e fd 00 00 00    	jle    335 <grep+0x145>
+    m += n;
+ 238:	01 45 e0             	add    %eax,-0x20(%ebp)
+ 23b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    buf[m] = '\0';
+ 23e:	bf e0 12 00 00       	mov    $0x12e0,%edi
+ 243:	89 de                	mov    %ebx,%esi
+ 245:	c6 81 e0 12 00 00 00 	movb   $0x0,0x12e0(%ecx)
+    while((q = strchr(p, '\n')) != 0){
+ 24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 250:	83 ec 08             	sub    $0x8,%esp
+ 253:	6a 0a                	push   $0xa
+ 255:	57                   	push   %edi
+ 256:	e8 25 02 00 00       	call   480 <strchr>
+ 25b:	83 c4 10             	add    $0x10,%esp
+ 25e:	89 c2                	mov    %eax,%edx
+ 260:	85 c0                	test   %eax,%eax
+ 262:	0f 84 88 00 00 00    	je     2f0 <grep+0x100>
+      *q = 0;
+ 268:	c6 02 00             	movb   $0x0,(%edx)
+  if(re[0] == '^')
+ 26b:	80 3e 5e             	cmpb   $0x5e,(%esi)
+ 26e:	74 58                	je     2c8 <grep+0xd8>
+ 270:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 273:	89 d3                	mov    %edx,%ebx
+ 275:	eb 12                	jmp    289 <grep+0x99>
+ 277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27e:	66 90                	xchg   %ax,%ax
+  }while(*text++ != '\0');
+ 280:	83 c7 01             	add    $0x1,%edi
+ 283:	80 7f ff 00          	cmpb   $0x0,-0x1(%edi)
+ 287:	74 37                	je     2c0 <grep+0xd0>
+    if(matchhere(re, text))
+ 289:	83 ec 08             	sub    $0x8,%esp
+ 28c:	57                   	push   %edi
+ 28d:	56                   	push   %esi
+ 28e:	e8 2d fe ff ff       	call   c0 <matchhere>
+ 293:	83 c4 10             	add    $0x10,%esp
+ 296:	85 c0                	test   %eax,%eax
+ 298:	74 e6                	je     280 <grep+0x90>
+        write(1, p, q+1 - p);
+ 29a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 29d:	89 da                	mov    %ebx,%edx
+ 29f:	8d 5b 01             	lea    0x1(%ebx),%ebx
+ 2a2:	89 d8                	mov    %ebx,%eax
+ 2a4:	83 ec 04             	sub    $0x4,%esp
+        *q = '\n';
+ 2a7:	c6 02 0a             	movb   $0xa,(%edx)
+        write(1, p, q+1 - p);
+ 2aa:	29 f8                	sub    %edi,%eax
+ 2ac:	50                   	push   %eax
+ 2ad:	57                   	push   %edi
+ 2ae:	89 df                	mov    %ebx,%edi
+ 2b0:	6a 01                	push   $0x1
+ 2b2:	e8 56 04 00 00       	call   70d <write>
+ 2b7:	83 c4 10             	add    $0x10,%esp
+ 2ba:	eb 94                	jmp    250 <grep+0x60>
+ 2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2c0:	8d 7b 01             	lea    0x1(%ebx),%edi
+      p = q+1;
+ 2c3:	eb 8b                	jmp    250 <grep+0x60>
+ 2c5:	8d 76 00             	lea    0x0(%esi),%esi
+    return matchhere(re+1, text);
+ 2c8:	83 ec 08             	sub    $0x8,%esp
+ 2cb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 2ce:	57                   	push   %edi
+ 2cf:	ff 75 dc             	push   -0x24(%ebp)
+ 2d2:	e8 e9 fd ff ff       	call   c0 <matchhere>
+        write(1, p, q+1 - p);
+ 2d7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    return matchhere(re+1, text);
+ 2da:	83 c4 10             	add    $0x10,%esp
+        write(1, p, q+1 - p);
+ 2dd:	8d 5a 01             	lea    0x1(%edx),%ebx
+      if(match(pattern, p)){
+ 2e0:	85 c0                	test   %eax,%eax
+ 2e2:	75 be                	jne    2a2 <grep+0xb2>
+        write(1, p, q+1 - p);
+ 2e4:	89 df                	mov    %ebx,%edi
+ 2e6:	e9 65 ff ff ff       	jmp    250 <grep+0x60>
+ 2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+    if(p == buf)
+ 2f0:	89 f3                	mov    %esi,%ebx
+ 2f2:	81 ff e0 12 00 00    	cmp    $0x12e0,%edi
+ 2f8:	74 2f                	je     329 <grep+0x139>
+    if(m > 0){
+ 2fa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 2fd:	85 c0                	test   %eax,%eax
+ 2ff:	0f 8e 0b ff ff ff    	jle    210 <grep+0x20>
+      m -= p - buf;
+ 305:	89 f8                	mov    %edi,%eax
+      memmove(buf, p, m);
+ 307:	83 ec 04             	sub    $0x4,%esp
+      m -= p - buf;
+ 30a:	2d e0 12 00 00       	sub    $0x12e0,%eax
+ 30f:	29 45 e0             	sub    %eax,-0x20(%ebp)
+ 312:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      memmove(buf, p, m);
+ 315:	51                   	push   %ecx
+ 316:	57                   	push   %edi
+ 317:	68 e0 12 00 00       	push   $0x12e0
+ 31c:	e8 8f 02 00 00       	call   5b0 <memmove>
+ 321:	83 c4 10             	add    $0x10,%esp
+ 324:	e9 e7 fe ff ff       	jmp    210 <grep+0x20>
+      m = 0;
+ 329:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+ 330:	e9 db fe ff ff       	jmp    210 <grep+0x20>
+}
+ 335:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 338:	5b                   	pop    %ebx
+ 339:	5e                   	pop    %esi
+ 33a:	5f                   	pop    %edi
+ 33b:	5d                   	pop    %ebp
+ 33c:	c3                   	ret
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <matchstar>:
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	56                   	push   %esi
+ 345:	53                   	push   %ebx
+ 346:	83 ec 0c             	sub    $0xc,%esp
+ 349:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 34c:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 34f:	8b 7d 10             	mov    0x10(%ebp),%edi
+ 352:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(matchhere(re, text))
+ 358:	83 ec 08             	sub    $0x8,%esp
+ 35b:	57                   	push   %edi
+ 35c:	56                   	push   %esi
+ 35d:	e8 5e fd ff ff       	call   c0 <matchhere>
+ 362:	83 c4 10             	add    $0x10,%esp
+ 365:	85 c0                	test   %eax,%eax
+ 367:	75 1f                	jne    388 <matchstar+0x48>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 369:	0f be 17             	movsbl (%edi),%edx
+ 36c:	84 d2                	test   %dl,%dl
+ 36e:	74 0c                	je     37c <matchstar+0x3c>
+ 370:	83 c7 01             	add    $0x1,%edi
+ 373:	39 da                	cmp    %ebx,%edx
+ 375:	74 e1                	je     358 <matchstar+0x18>
+ 377:	83 fb 2e             	cmp    $0x2e,%ebx
+ 37a:	74 dc                	je     358 <matchstar+0x18>
+}
+ 37c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 37f:	5b                   	pop    %ebx
+ 380:	5e                   	pop    %esi
+ 381:	5f                   	pop    %edi
+ 382:	5d                   	pop    %ebp
+ 383:	c3                   	ret
+ 384:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 388:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 1;
+ 38b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 390:	5b                   	pop    %ebx
+ 391:	5e                   	pop    %esi
+ 392:	5f                   	pop    %edi
+ 393:	5d                   	pop    %ebp
+ 394:	c3                   	ret
+ 395:	66 90                	xchg   %ax,%ax
+ 397:	66 90                	xchg   %ax,%ax
+ 399:	66 90                	xchg   %ax,%ax
+ 39b:	66 90                	xchg   %ax,%ax
+ 39d:	66 90                	xchg   %ax,%ax
+ 39f:	90                   	nop
+
+000003a0 <strcpy>:
+#include "date.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 3a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 3a1:	31 c0                	xor    %eax,%eax
+{
+ 3a3:	89 e5                	mov    %esp,%ebp
+ 3a5:	53                   	push   %ebx
+ 3a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 3b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 3b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 3b7:	83 c0 01             	add    $0x1,%eax
+ 3ba:	84 d2                	test   %dl,%dl
+ 3bc:	75 f2                	jne    3b0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 3be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3c1:	89 c8                	mov    %ecx,%eax
+ 3c3:	c9                   	leave
+ 3c4:	c3                   	ret
+ 3c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	53                   	push   %ebx
+ 3d4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 3da:	0f b6 02             	movzbl (%edx),%eax
+ 3dd:	84 c0                	test   %al,%al
+ 3df:	75 17                	jne    3f8 <strcmp+0x28>
+ 3e1:	eb 3a                	jmp    41d <strcmp+0x4d>
+ 3e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3e7:	90                   	nop
+ 3e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 3ec:	83 c2 01             	add    $0x1,%edx
+ 3ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 3f2:	84 c0                	test   %al,%al
+ 3f4:	74 1a                	je     410 <strcmp+0x40>
+    p++, q++;
+ 3f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 3f8:	0f b6 19             	movzbl (%ecx),%ebx
+ 3fb:	38 c3                	cmp    %al,%bl
+ 3fd:	74 e9                	je     3e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 3ff:	29 d8                	sub    %ebx,%eax
+}
+ 401:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 404:	c9                   	leave
+ 405:	c3                   	ret
+ 406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 410:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 414:	31 c0                	xor    %eax,%eax
+ 416:	29 d8                	sub    %ebx,%eax
+}
+ 418:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 41b:	c9                   	leave
+ 41c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 41d:	0f b6 19             	movzbl (%ecx),%ebx
+ 420:	31 c0                	xor    %eax,%eax
+ 422:	eb db                	jmp    3ff <strcmp+0x2f>
+ 424:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 42f:	90                   	nop
+
+00000430 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 436:	80 3a 00             	cmpb   $0x0,(%edx)
+ 439:	74 15                	je     450 <strlen+0x20>
+ 43b:	31 c0                	xor    %eax,%eax
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+ 440:	83 c0 01             	add    $0x1,%eax
+ 443:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 447:	89 c1                	mov    %eax,%ecx
+ 449:	75 f5                	jne    440 <strlen+0x10>
+    ;
+  return n;
+}
+ 44b:	89 c8                	mov    %ecx,%eax
+ 44d:	5d                   	pop    %ebp
+ 44e:	c3                   	ret
+ 44f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 450:	31 c9                	xor    %ecx,%ecx
+}
+ 452:	5d                   	pop    %ebp
+ 453:	89 c8                	mov    %ecx,%eax
+ 455:	c3                   	ret
+ 456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000460 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 467:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 46a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 46d:	89 d7                	mov    %edx,%edi
+ 46f:	fc                   	cld
+ 470:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 472:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 475:	89 d0                	mov    %edx,%eax
+ 477:	c9                   	leave
+ 478:	c3                   	ret
+ 479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	8b 45 08             	mov    0x8(%ebp),%eax
+ 486:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 48a:	0f b6 10             	movzbl (%eax),%edx
+ 48d:	84 d2                	test   %dl,%dl
+ 48f:	75 12                	jne    4a3 <strchr+0x23>
+ 491:	eb 1d                	jmp    4b0 <strchr+0x30>
+ 493:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 497:	90                   	nop
+ 498:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 49c:	83 c0 01             	add    $0x1,%eax
+ 49f:	84 d2                	test   %dl,%dl
+ 4a1:	74 0d                	je     4b0 <strchr+0x30>
+    if(*s == c)
+ 4a3:	38 d1                	cmp    %dl,%cl
+ 4a5:	75 f1                	jne    498 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 4a7:	5d                   	pop    %ebp
+ 4a8:	c3                   	ret
+ 4a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 4b0:	31 c0                	xor    %eax,%eax
+}
+ 4b2:	5d                   	pop    %ebp
+ 4b3:	c3                   	ret
+ 4b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4bf:	90                   	nop
+
+000004c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	57                   	push   %edi
+ 4c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 4c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 4c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 4c9:	31 db                	xor    %ebx,%ebx
+{
+ 4cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 4ce:	eb 27                	jmp    4f7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 4d0:	83 ec 04             	sub    $0x4,%esp
+ 4d3:	6a 01                	push   $0x1
+ 4d5:	56                   	push   %esi
+ 4d6:	6a 00                	push   $0x0
+ 4d8:	e8 13 02 00 00       	call   6f0 <read>
+    if(cc < 1)
+ 4dd:	83 c4 10             	add    $0x10,%esp
+ 4e0:	85 c0                	test   %eax,%eax
+ 4e2:	7e 1d                	jle    501 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 4e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 4e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 4ef:	3c 0a                	cmp    $0xa,%al
+ 4f1:	74 10                	je     503 <gets+0x43>
+ 4f3:	3c 0d                	cmp    $0xd,%al
+ 4f5:	74 0c                	je     503 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 4f7:	89 df                	mov    %ebx,%edi
+ 4f9:	83 c3 01             	add    $0x1,%ebx
+ 4fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 4ff:	7c cf                	jl     4d0 <gets+0x10>
+ 501:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 503:	8b 45 08             	mov    0x8(%ebp),%eax
+ 506:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 50a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 50d:	5b                   	pop    %ebx
+ 50e:	5e                   	pop    %esi
+ 50f:	5f                   	pop    %edi
+ 510:	5d                   	pop    %ebp
+ 511:	c3                   	ret
+ 512:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 519:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	56                   	push   %esi
+ 524:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 525:	83 ec 08             	sub    $0x8,%esp
+ 528:	6a 00                	push   $0x0
+ 52a:	ff 75 08             	push   0x8(%ebp)
+ 52d:	e8 4f 02 00 00       	call   781 <open>
+  if(fd < 0)
+ 532:	83 c4 10             	add    $0x10,%esp
+ 535:	85 c0                	test   %eax,%eax
+ 537:	78 27                	js     560 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 539:	83 ec 08             	sub    $0x8,%esp
+ 53c:	ff 75 0c             	push   0xc(%ebp)
+ 53f:	89 c3                	mov    %eax,%ebx
+ 541:	50                   	push   %eax
+ 542:	e8 91 02 00 00       	call   7d8 <fstat>
+  close(fd);
+ 547:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 54a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 54c:	e8 d9 01 00 00       	call   72a <close>
+  return r;
+ 551:	83 c4 10             	add    $0x10,%esp
+}
+ 554:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 557:	89 f0                	mov    %esi,%eax
+ 559:	5b                   	pop    %ebx
+ 55a:	5e                   	pop    %esi
+ 55b:	5d                   	pop    %ebp
+ 55c:	c3                   	ret
+ 55d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 560:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 565:	eb ed                	jmp    554 <stat+0x34>
+ 567:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56e:	66 90                	xchg   %ax,%ax
+
+00000570 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	53                   	push   %ebx
+ 574:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 577:	0f be 02             	movsbl (%edx),%eax
+ 57a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 57d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 580:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 585:	77 1e                	ja     5a5 <atoi+0x35>
+ 587:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 590:	83 c2 01             	add    $0x1,%edx
+ 593:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 596:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 59a:	0f be 02             	movsbl (%edx),%eax
+ 59d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 5a0:	80 fb 09             	cmp    $0x9,%bl
+ 5a3:	76 eb                	jbe    590 <atoi+0x20>
+  return n;
+}
+ 5a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5a8:	89 c8                	mov    %ecx,%eax
+ 5aa:	c9                   	leave
+ 5ab:	c3                   	ret
+ 5ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	56                   	push   %esi
+ 5b5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 5be:	85 c0                	test   %eax,%eax
+ 5c0:	7e 13                	jle    5d5 <memmove+0x25>
+ 5c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 5c4:	89 d7                	mov    %edx,%edi
+ 5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 5d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 5d1:	39 f8                	cmp    %edi,%eax
+ 5d3:	75 fb                	jne    5d0 <memmove+0x20>
+  return vdst;
+}
+ 5d5:	5e                   	pop    %esi
+ 5d6:	89 d0                	mov    %edx,%eax
+ 5d8:	5f                   	pop    %edi
+ 5d9:	5d                   	pop    %ebp
+ 5da:	c3                   	ret
+ 5db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5df:	90                   	nop
+
+000005e0 <ugetpid>:
+// getpid() without a system call, from the page at UPROC.
+int
+ugetpid(void)
+{
+  return ((struct uproc*)UPROC)->pid;
+}
+ 5e0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+ 5e5:	c3                   	ret
+ 5e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005f0 <uclocktime>:
+
+// clocktime() without a system call, from the page at UCLOCK.
+int
+uclocktime(struct timespec *ts)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	57                   	push   %edi
+ 5f4:	56                   	push   %esi
+ 5f5:	53                   	push   %ebx
+ 5f6:	83 ec 1c             	sub    $0x1c,%esp
+  struct uclock *c = (struct uclock*)UCLOCK;
+
+  if(c->tscmult == 0)
+ 5f9:	8b 0d 08 f0 ff 7f    	mov    0x7ffff008,%ecx
+{
+ 5ff:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(c->tscmult == 0)
+ 602:	85 c9                	test   %ecx,%ecx
+ 604:	74 6a                	je     670 <uclocktime+0x80>
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+ 606:	0f 31                	rdtsc
+static inline void
+uclockread(struct uclock *c, uint64 tsc, struct timespec *ts)
+{
+  uint64 d, ns;
+
+  d = tsc - c->tscbase;
+ 608:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 60e:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+ 614:	89 c6                	mov    %eax,%esi
+  if((long long)d < 0)  // another CPU's TSC is a little behind
+ 616:	85 d2                	test   %edx,%edx
+ 618:	78 46                	js     660 <uclocktime+0x70>
+    d = 0;
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 61a:	89 d0                	mov    %edx,%eax
+ 61c:	f7 e1                	mul    %ecx
+ 61e:	0f a4 c2 08          	shld   $0x8,%eax,%edx
+ 622:	c1 e0 08             	shl    $0x8,%eax
+ 625:	89 45 e0             	mov    %eax,-0x20(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+ 628:	89 f0                	mov    %esi,%eax
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 62a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+ 62d:	f7 e1                	mul    %ecx
+ 62f:	0f ac d0 18          	shrd   $0x18,%edx,%eax
+ 633:	c1 ea 18             	shr    $0x18,%edx
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 636:	03 45 e0             	add    -0x20(%ebp),%eax
+ 639:	13 55 e4             	adc    -0x1c(%ebp),%edx
+// linked with libgcc, so it cannot use 64-bit '/' or '%'.
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+  asm("divl %4" : "=a" (q), "=d" (r) : "a" ((uint)n), "d" ((uint)(n>>32)), "rm" (d));
+ 63c:	89 c7                	mov    %eax,%edi
+ 63e:	89 f8                	mov    %edi,%eax
+ 640:	b9 00 ca 9a 3b       	mov    $0x3b9aca00,%ecx
+ 645:	f7 f1                	div    %ecx
+  ts->sec = divl(ns, 1000000000, &ts->nsec);
+ 647:	89 03                	mov    %eax,(%ebx)
+    return clocktime(ts);
+  uclockread(c, rdtsc(), ts);
+  return 0;
+}
+ 649:	31 c0                	xor    %eax,%eax
+  *rem = r;
+ 64b:	89 53 04             	mov    %edx,0x4(%ebx)
+ 64e:	83 c4 1c             	add    $0x1c,%esp
+ 651:	5b                   	pop    %ebx
+ 652:	5e                   	pop    %esi
+ 653:	5f                   	pop    %edi
+ 654:	5d                   	pop    %ebp
+ 655:	c3                   	ret
+ 656:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 65d:	8d 76 00             	lea    0x0(%esi),%esi
+ 660:	31 d2                	xor    %edx,%edx
+ 662:	31 ff                	xor    %edi,%edi
+ 664:	eb d8                	jmp    63e <uclocktime+0x4e>
+ 666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 66d:	8d 76 00             	lea    0x0(%esi),%esi
+ 670:	83 c4 1c             	add    $0x1c,%esp
+ 673:	5b                   	pop    %ebx
+ 674:	5e                   	pop    %esi
+ 675:	5f                   	pop    %edi
+ 676:	5d                   	pop    %ebp
+    return clocktime(ts);
+ 677:	e9 f2 02 00 00       	jmp    96e <clocktime>
+
+0000067c <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+ 67c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 681:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 688:	00 00 00 
+ 68b:	74 09                	je     696 <fork+0x1a>
+ 68d:	89 e1                	mov    %esp,%ecx
+ 68f:	ba 98 06 00 00       	mov    $0x698,%edx
+ 694:	0f 34                	sysenter
+ 696:	cd 40                	int    $0x40
+ 698:	c3                   	ret
+
+00000699 <exit>:
+SYSCALL(exit)
+ 699:	b8 02 00 00 00       	mov    $0x2,%eax
+ 69e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6a5:	00 00 00 
+ 6a8:	74 09                	je     6b3 <exit+0x1a>
+ 6aa:	89 e1                	mov    %esp,%ecx
+ 6ac:	ba b5 06 00 00       	mov    $0x6b5,%edx
+ 6b1:	0f 34                	sysenter
+ 6b3:	cd 40                	int    $0x40
+ 6b5:	c3                   	ret
+
+000006b6 <wait>:
+SYSCALL(wait)
+ 6b6:	b8 03 00 00 00       	mov    $0x3,%eax
+ 6bb:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6c2:	00 00 00 
+ 6c5:	74 09                	je     6d0 <wait+0x1a>
+ 6c7:	89 e1                	mov    %esp,%ecx
+ 6c9:	ba d2 06 00 00       	mov    $0x6d2,%edx
+ 6ce:	0f 34                	sysenter
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <pipe>:
+SYSCALL(pipe)
+ 6d3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 6d8:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6df:	00 00 00 
+ 6e2:	74 09                	je     6ed <pipe+0x1a>
+ 6e4:	89 e1                	mov    %esp,%ecx
+ 6e6:	ba ef 06 00 00       	mov    $0x6ef,%edx
+ 6eb:	0f 34                	sysenter
+ 6ed:	cd 40                	int    $0x40
+ 6ef:	c3                   	ret
+
+000006f0 <read>:
+SYSCALL(read)
+ 6f0:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6f5:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6fc:	00 00 00 
+ 6ff:	74 09                	je     70a <read+0x1a>
+ 701:	89 e1                	mov    %esp,%ecx
+ 703:	ba 0c 07 00 00       	mov    $0x70c,%edx
+ 708:	0f 34                	sysenter
+ 70a:	cd 40                	int    $0x40
+ 70c:	c3                   	ret
+
+0000070d <write>:
+SYSCALL(write)
+ 70d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 712:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 719:	00 00 00 
+ 71c:	74 09                	je     727 <write+0x1a>
+ 71e:	89 e1                	mov    %esp,%ecx
+ 720:	ba 29 07 00 00       	mov    $0x729,%edx
+ 725:	0f 34                	sysenter
+ 727:	cd 40                	int    $0x40
+ 729:	c3                   	ret
+
+0000072a <close>:
+SYSCALL(close)
+ 72a:	b8 15 00 00 00       	mov    $0x15,%eax
+ 72f:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 736:	00 00 00 
+ 739:	74 09                	je     744 <close+0x1a>
+ 73b:	89 e1                	mov    %esp,%ecx
+ 73d:	ba 46 07 00 00       	mov    $0x746,%edx
+ 742:	0f 34                	sysenter
+ 744:	cd 40                	int    $0x40
+ 746:	c3                   	ret
+
+00000747 <kill>:
+SYSCALL(kill)
+ 747:	b8 06 00 00 00       	mov    $0x6,%eax
+ 74c:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 753:	00 00 00 
+ 756:	74 09                	je     761 <kill+0x1a>
+ 758:	89 e1                	mov    %esp,%ecx
+ 75a:	ba 63 07 00 00       	mov    $0x763,%edx
+ 75f:	0f 34                	sysenter
+ 761:	cd 40                	int    $0x40
+ 763:	c3                   	ret
+
+00000764 <exec>:
+SYSCALL(exec)
+ 764:	b8 07 00 00 00       	mov    $0x7,%eax
+ 769:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 770:	00 00 00 
+ 773:	74 09                	je     77e <exec+0x1a>
+ 775:	89 e1                	mov    %esp,%ecx
+ 777:	ba 80 07 00 00       	mov    $0x780,%edx
+ 77c:	0f 34                	sysenter
+ 77e:	cd 40                	int    $0x40
+ 780:	c3                   	ret
+
+00000781 <open>:
+SYSCALL(open)
+ 781:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 786:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 78d:	00 00 00 
+ 790:	74 09                	je     79b <open+0x1a>
+ 792:	89 e1                	mov    %esp,%ecx
+ 794:	ba 9d 07 00 00       	mov    $0x79d,%edx
+ 799:	0f 34                	sysenter
+ 79b:	cd 40                	int    $0x40
+ 79d:	c3                   	ret
+
+0000079e <mknod>:
+SYSCALL(mknod)
+ 79e:	b8 11 00 00 00       	mov    $0x11,%eax
+ 7a3:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 7aa:	00 00 00 
+ 7ad:	74 09                	je     7b8 <mknod+0x1a>
+ 7af:	89 e1                	mov    %esp,%ecx
+ 7b1:	ba ba 07 00 00       	mov    $0x7ba,%edx
+ 7b6:	0f 34                	sysenter
+ 7b8:	cd 40                	int    $0x40
+ 7ba:	c3                   	ret
+
+000007bb <unlink>:
+SYSCALL(unlink)
+ 7bb:	b8 12 00 00 00       	mov    $0x12,%eax
+ 7c0:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 7c7:	00 00 00 
+ 7ca:	74 09                	je     7d5 <unlink+0x1a>
+ 7cc:	89 e1                	mov    %esp,%ecx
+ 7ce:	ba d7 07 00 00       	mov    $0x7d7,%edx
+ 7d3:	0f 34                	sysenter
+ 7d5:	cd 40                	int    $0x40
+ 7d7:	c3                   	ret
+
+000007d8 <fstat>:
+SYSCALL(fstat)
+ 7d8:	b8 08 00 00 00       	mov    $0x8,%eax
+ 7dd:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 7e4:	00 00 00 
+ 7e7:	74 09                	je     7f2 <fstat+0x1a>
+ 7e9:	89 e1                	mov    %esp,%ecx
+ 7eb:	ba f4 07 00 00       	mov    $0x7f4,%edx
+ 7f0:	0f 34                	sysenter
+ 7f2:	cd 40                	int    $0x40
+ 7f4:	c3                   	ret
+
+000007f5 <link>:
+SYSCALL(link)
+ 7f5:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7fa:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 801:	00 00 00 
+ 804:	74 09                	je     80f <link+0x1a>
+ 806:	89 e1                	mov    %esp,%ecx
+ 808:	ba 11 08 00 00       	mov    $0x811,%edx
+ 80d:	0f 34                	sysenter
+ 80f:	cd 40                	int    $0x40
+ 811:	c3                   	ret
+
+00000812 <mkdir>:
+SYSCALL(mkdir)
+ 812:	b8 14 00 00 00       	mov    $0x14,%eax
+ 817:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 81e:	00 00 00 
+ 821:	74 09                	je     82c <mkdir+0x1a>
+ 823:	89 e1                	mov    %esp,%ecx
+ 825:	ba 2e 08 00 00       	mov    $0x82e,%edx
+ 82a:	0f 34                	sysenter
+ 82c:	cd 40                	int    $0x40
+ 82e:	c3                   	ret
+
+0000082f <chdir>:
+SYSCALL(chdir)
+ 82f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 834:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 83b:	00 00 00 
+ 83e:	74 09                	je     849 <chdir+0x1a>
+ 840:	89 e1                	mov    %esp,%ecx
+ 842:	ba 4b 08 00 00       	mov    $0x84b,%edx
+ 847:	0f 34                	sysenter
+ 849:	cd 40                	int    $0x40
+ 84b:	c3                   	ret
+
+0000084c <dup>:
+SYSCALL(dup)
+ 84c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 851:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 858:	00 00 00 
+ 85b:	74 09                	je     866 <dup+0x1a>
+ 85d:	89 e1                	mov    %esp,%ecx
+ 85f:	ba 68 08 00 00       	mov    $0x868,%edx
+ 864:	0f 34                	sysenter
+ 866:	cd 40                	int    $0x40
+ 868:	c3                   	ret
+
+00000869 <getpid>:
+SYSCALL(getpid)
+ 869:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 86e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 875:	00 00 00 
+ 878:	74 09                	je     883 <getpid+0x1a>
+ 87a:	89 e1                	mov    %esp,%ecx
+ 87c:	ba 85 08 00 00       	mov    $0x885,%edx
+ 881:	0f 34                	sysenter
+ 883:	cd 40                	int    $0x40
+ 885:	c3                   	ret
+
+00000886 <sbrk>:
+SYSCALL(sbrk)
+ 886:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 88b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 892:	00 00 00 
+ 895:	74 09                	je     8a0 <sbrk+0x1a>
+ 897:	89 e1                	mov    %esp,%ecx
+ 899:	ba a2 08 00 00       	mov    $0x8a2,%edx
+ 89e:	0f 34                	sysenter
+ 8a0:	cd 40                	int    $0x40
+ 8a2:	c3                   	ret
+
+000008a3 <sleep>:
+SYSCALL(sleep)
+ 8a3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 8a8:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 8af:	00 00 00 
+ 8b2:	74 09                	je     8bd <sleep+0x1a>
+ 8b4:	89 e1                	mov    %esp,%ecx
+ 8b6:	ba bf 08 00 00       	mov    $0x8bf,%edx
+ 8bb:	0f 34                	sysenter
+ 8bd:	cd 40                	int    $0x40
+ 8bf:	c3                   	ret
+
+000008c0 <uptime>:
+SYSCALL(uptime)
+ 8c0:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 8c5:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 8cc:	00 00 00 
+ 8cf:	74 09                	je     8da <uptime+0x1a>
+ 8d1:	89 e1                	mov    %esp,%ecx
+ 8d3:	ba dc 08 00 00       	mov    $0x8dc,%edx
+ 8d8:	0f 34                	sysenter
+ 8da:	cd 40                	int    $0x40
+ 8dc:	c3                   	ret
+
+000008dd <swapread>:
+SYSCALL(swapread)
+ 8dd:	b8 16 00 00 00       	mov    $0x16,%eax
+ 8e2:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 8e9:	00 00 00 
+ 8ec:	74 09                	je     8f7 <swapread+0x1a>
+ 8ee:	89 e1                	mov    %esp,%ecx
+ 8f0:	ba f9 08 00 00       	mov    $0x8f9,%edx
+ 8f5:	0f 34                	sysenter
+ 8f7:	cd 40                	int    $0x40
+ 8f9:	c3                   	ret
+
+000008fa <swapwrite>:
+SYSCALL(swapwrite)
+ 8fa:	b8 17 00 00 00       	mov    $0x17,%eax
+ 8ff:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 906:	00 00 00 
+ 909:	74 09                	je     914 <swapwrite+0x1a>
+ 90b:	89 e1                	mov    %esp,%ecx
+ 90d:	ba 16 09 00 00       	mov    $0x916,%edx
+ 912:	0f 34                	sysenter
+ 914:	cd 40                	int    $0x40
+ 916:	c3                   	ret
+
+00000917 <setaffinity>:
+SYSCALL(setaffinity)
+ 917:	b8 18 00 00 00       	mov    $0x18,%eax
+ 91c:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 923:	00 00 00 
+ 926:	74 09                	je     931 <setaffinity+0x1a>
+ 928:	89 e1                	mov    %esp,%ecx
+ 92a:	ba 33 09 00 00       	mov    $0x933,%edx
+ 92f:	0f 34                	sysenter
+ 931:	cd 40                	int    $0x40
+ 933:	c3                   	ret
+
+00000934 <getaffinity>:
+SYSCALL(getaffinity)
+ 934:	b8 19 00 00 00       	mov    $0x19,%eax
+ 939:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 940:	00 00 00 
+ 943:	74 09                	je     94e <getaffinity+0x1a>
+ 945:	89 e1                	mov    %esp,%ecx
+ 947:	ba 50 09 00 00       	mov    $0x950,%edx
+ 94c:	0f 34                	sysenter
+ 94e:	cd 40                	int    $0x40
+ 950:	c3                   	ret
+
+00000951 <nanosleep>:
+SYSCALL(nanosleep)
+ 951:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 956:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 95d:	00 00 00 
+ 960:	74 09                	je     96b <nanosleep+0x1a>
+ 962:	89 e1                	mov    %esp,%ecx
+ 964:	ba 6d 09 00 00       	mov    $0x96d,%edx
+ 969:	0f 34                	sysenter
+ 96b:	cd 40                	int    $0x40
+ 96d:	c3                   	ret
+
+0000096e <clocktime>:
+SYSCALL(clocktime)
+ 96e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 973:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 97a:	00 00 00 
+ 97d:	74 09                	je     988 <clocktime+0x1a>
+ 97f:	89 e1                	mov    %esp,%ecx
+ 981:	ba 8a 09 00 00       	mov    $0x98a,%edx
+ 986:	0f 34                	sysenter
+ 988:	cd 40                	int    $0x40
+ 98a:	c3                   	ret
+
+0000098b <batch>:
+SYSCALL(batch)
+ 98b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 990:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 997:	00 00 00 
+ 99a:	74 09                	je     9a5 <batch+0x1a>
+ 99c:	89 e1                	mov    %esp,%ecx
+ 99e:	ba a7 09 00 00       	mov    $0x9a7,%edx
+ 9a3:	0f 34                	sysenter
+ 9a5:	cd 40                	int    $0x40
+ 9a7:	c3                   	ret
+
+000009a8 <aiosetup>:
+SYSCALL(aiosetup)
+ 9a8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 9ad:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 9b4:	00 00 00 
+ 9b7:	74 09                	je     9c2 <aiosetup+0x1a>
+ 9b9:	89 e1                	mov    %esp,%ecx
+ 9bb:	ba c4 09 00 00       	mov    $0x9c4,%edx
+ 9c0:	0f 34                	sysenter
+ 9c2:	cd 40                	int    $0x40
+ 9c4:	c3                   	ret
+
+000009c5 <aiowait>:
+SYSCALL(aiowait)
+ 9c5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 9ca:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 9d1:	00 00 00 
+ 9d4:	74 09                	je     9df <aiowait+0x1a>
+ 9d6:	89 e1                	mov    %esp,%ecx
+ 9d8:	ba e1 09 00 00       	mov    $0x9e1,%edx
+ 9dd:	0f 34                	sysenter
+ 9df:	cd 40                	int    $0x40
+ 9e1:	c3                   	ret
+
+000009e2 <spawn>:
+SYSCALL(spawn)
+ 9e2:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 9e7:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 9ee:	00 00 00 
+ 9f1:	74 09                	je     9fc <spawn+0x1a>
+ 9f3:	89 e1                	mov    %esp,%ecx
+ 9f5:	ba fe 09 00 00       	mov    $0x9fe,%edx
+ 9fa:	0f 34                	sysenter
+ 9fc:	cd 40                	int    $0x40
+ 9fe:	c3                   	ret
+
+000009ff <getprocinfo>:
+SYSCALL(getprocinfo)
+ 9ff:	b8 20 00 00 00       	mov    $0x20,%eax
+ a04:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ a0b:	00 00 00 
+ a0e:	74 09                	je     a19 <getprocinfo+0x1a>
+ a10:	89 e1                	mov    %esp,%ecx
+ a12:	ba 1b 0a 00 00       	mov    $0xa1b,%edx
+ a17:	0f 34                	sysenter
+ a19:	cd 40                	int    $0x40
+ a1b:	c3                   	ret
+
+00000a1c <getlockstat>:
+SYSCALL(getlockstat)
+ a1c:	b8 21 00 00 00       	mov    $0x21,%eax
+ a21:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ a28:	00 00 00 
+ a2b:	74 09                	je     a36 <getlockstat+0x1a>
+ a2d:	89 e1                	mov    %esp,%ecx
+ a2f:	ba 38 0a 00 00       	mov    $0xa38,%edx
+ a34:	0f 34                	sysenter
+ a36:	cd 40                	int    $0x40
+ a38:	c3                   	ret
+
+00000a39 <lockprof>:
+SYSCALL(lockprof)
+ a39:	b8 22 00 00 00       	mov    $0x22,%eax
+ a3e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ a45:	00 00 00 
+ a48:	74 09                	je     a53 <lockprof+0x1a>
+ a4a:	89 e1                	mov    %esp,%ecx
+ a4c:	ba 55 0a 00 00       	mov    $0xa55,%edx
+ a51:	0f 34                	sysenter
+ a53:	cd 40                	int    $0x40
+ a55:	c3                   	ret
+
+00000a56 <getlockprof>:
+SYSCALL(getlockprof)
+ a56:	b8 23 00 00 00       	mov    $0x23,%eax
+ a5b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ a62:	00 00 00 
+ a65:	74 09                	je     a70 <getlockprof+0x1a>
+ a67:	89 e1                	mov    %esp,%ecx
+ a69:	ba 72 0a 00 00       	mov    $0xa72,%edx
+ a6e:	0f 34                	sysenter
+ a70:	cd 40                	int    $0x40
+ a72:	c3                   	ret
+
+00000a73 <diskstat>:
+SYSCALL(diskstat)
+ a73:	b8 24 00 00 00       	mov    $0x24,%eax
+ a78:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ a7f:	00 00 00 
+ a82:	74 09                	je     a8d <diskstat+0x1a>
+ a84:	89 e1                	mov    %esp,%ecx
+ a86:	ba 8f 0a 00 00       	mov    $0xa8f,%edx
+ a8b:	0f 34                	sysenter
+ a8d:	cd 40                	int    $0x40
+ a8f:	c3                   	ret
+
+00000a90 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ a90:	55                   	push   %ebp
+ a91:	89 e5                	mov    %esp,%ebp
+ a93:	57                   	push   %edi
+ a94:	56                   	push   %esi
+ a95:	53                   	push   %ebx
+ a96:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ a98:	89 d1                	mov    %edx,%ecx
+{
+ a9a:	83 ec 3c             	sub    $0x3c,%esp
+ a9d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ aa0:	85 d2                	test   %edx,%edx
+ aa2:	0f 89 80 00 00 00    	jns    b28 <printint+0x98>
+ aa8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ aac:	74 7a                	je     b28 <printint+0x98>
+    x = -xx;
+ aae:	f7 d9                	neg    %ecx
+    neg = 1;
+ ab0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ ab5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ ab8:	31 f6                	xor    %esi,%esi
+ aba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ ac0:	89 c8                	mov    %ecx,%eax
+ ac2:	31 d2                	xor    %edx,%edx
+ ac4:	89 f7                	mov    %esi,%edi
+ ac6:	f7 f3                	div    %ebx
+ ac8:	8d 76 01             	lea    0x1(%esi),%esi
+ acb:	0f b6 92 f0 0e 00 00 	movzbl 0xef0(%edx),%edx
+ ad2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ ad6:	89 ca                	mov    %ecx,%edx
+ ad8:	89 c1                	mov    %eax,%ecx
+ ada:	39 da                	cmp    %ebx,%edx
+ adc:	73 e2                	jae    ac0 <printint+0x30>
+  if(neg)
+ ade:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ ae1:	85 c0                	test   %eax,%eax
+ ae3:	74 07                	je     aec <printint+0x5c>
+    buf[i++] = '-';
+ ae5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ aea:	89 f7                	mov    %esi,%edi
+ aec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ aef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ af2:	01 df                	add    %ebx,%edi
+ af4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ af8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ afb:	83 ec 04             	sub    $0x4,%esp
+ afe:	88 45 d7             	mov    %al,-0x29(%ebp)
+ b01:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ b04:	6a 01                	push   $0x1
+ b06:	50                   	push   %eax
+ b07:	56                   	push   %esi
+ b08:	e8 00 fc ff ff       	call   70d <write>
+  while(--i >= 0)
+ b0d:	89 f8                	mov    %edi,%eax
+ b0f:	83 c4 10             	add    $0x10,%esp
+ b12:	83 ef 01             	sub    $0x1,%edi
+ b15:	39 d8                	cmp    %ebx,%eax
+ b17:	75 df                	jne    af8 <printint+0x68>
+}
+ b19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b1c:	5b                   	pop    %ebx
+ b1d:	5e                   	pop    %esi
+ b1e:	5f                   	pop    %edi
+ b1f:	5d                   	pop    %ebp
+ b20:	c3                   	ret
+ b21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ b28:	31 c0                	xor    %eax,%eax
+ b2a:	eb 89                	jmp    ab5 <printint+0x25>
+ b2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b30 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ b30:	55                   	push   %ebp
+ b31:	89 e5                	mov    %esp,%ebp
+ b33:	57                   	push   %edi
+ b34:	56                   	push   %esi
+ b35:	53                   	push   %ebx
+ b36:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ b39:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ b3c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ b3f:	0f b6 1e             	movzbl (%esi),%ebx
+ b42:	83 c6 01             	add    $0x1,%esi
+ b45:	84 db                	test   %bl,%bl
+ b47:	74 67                	je     bb0 <printf+0x80>
+ b49:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ b4c:	31 d2                	xor    %edx,%edx
+ b4e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ b51:	eb 34                	jmp    b87 <printf+0x57>
+ b53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b57:	90                   	nop
+ b58:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ b5b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ b60:	83 f8 25             	cmp    $0x25,%eax
+ b63:	74 18                	je     b7d <printf+0x4d>
+  write(fd, &c, 1);
+ b65:	83 ec 04             	sub    $0x4,%esp
+ b68:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ b6b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b6e:	6a 01                	push   $0x1
+ b70:	50                   	push   %eax
+ b71:	57                   	push   %edi
+ b72:	e8 96 fb ff ff       	call   70d <write>
+ b77:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ b7a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ b7d:	0f b6 1e             	movzbl (%esi),%ebx
+ b80:	83 c6 01             	add    $0x1,%esi
+ b83:	84 db                	test   %bl,%bl
+ b85:	74 29                	je     bb0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ b87:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ b8a:	85 d2                	test   %edx,%edx
+ b8c:	74 ca                	je     b58 <printf+0x28>
+      }
+    } else if(state == '%'){
+ b8e:	83 fa 25             	cmp    $0x25,%edx
+ b91:	75 ea                	jne    b7d <printf+0x4d>
+      if(c == 'd'){
+ b93:	83 f8 25             	cmp    $0x25,%eax
+ b96:	0f 84 24 01 00 00    	je     cc0 <printf+0x190>
+ b9c:	83 e8 63             	sub    $0x63,%eax
+ b9f:	83 f8 15             	cmp    $0x15,%eax
+ ba2:	77 1c                	ja     bc0 <printf+0x90>
+ ba4:	ff 24 85 98 0e 00 00 	jmp    *0xe98(,%eax,4)
+ bab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ baf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ bb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ bb3:	5b                   	pop    %ebx
+ bb4:	5e                   	pop    %esi
+ bb5:	5f                   	pop    %edi
+ bb6:	5d                   	pop    %ebp
+ bb7:	c3                   	ret
+ bb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bbf:	90                   	nop
+  write(fd, &c, 1);
+ bc0:	83 ec 04             	sub    $0x4,%esp
+ bc3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ bc6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ bca:	6a 01                	push   $0x1
+ bcc:	52                   	push   %edx
+ bcd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ bd0:	57                   	push   %edi
+ bd1:	e8 37 fb ff ff       	call   70d <write>
+ bd6:	83 c4 0c             	add    $0xc,%esp
+ bd9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ bdc:	6a 01                	push   $0x1
+ bde:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ be1:	52                   	push   %edx
+ be2:	57                   	push   %edi
+ be3:	e8 25 fb ff ff       	call   70d <write>
+        putc(fd, c);
+ be8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ beb:	31 d2                	xor    %edx,%edx
+ bed:	eb 8e                	jmp    b7d <printf+0x4d>
+ bef:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ bf0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ bf3:	83 ec 0c             	sub    $0xc,%esp
+ bf6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ bfb:	8b 13                	mov    (%ebx),%edx
+ bfd:	6a 00                	push   $0x0
+ bff:	89 f8                	mov    %edi,%eax
+        ap++;
+ c01:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ c04:	e8 87 fe ff ff       	call   a90 <printint>
+        ap++;
+ c09:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ c0c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ c0f:	31 d2                	xor    %edx,%edx
+ c11:	e9 67 ff ff ff       	jmp    b7d <printf+0x4d>
+ c16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c1d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ c20:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ c23:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ c25:	83 c0 04             	add    $0x4,%eax
+ c28:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ c2b:	85 db                	test   %ebx,%ebx
+ c2d:	0f 84 9d 00 00 00    	je     cd0 <printf+0x1a0>
+        while(*s != 0){
+ c33:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ c36:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ c38:	84 c0                	test   %al,%al
+ c3a:	0f 84 3d ff ff ff    	je     b7d <printf+0x4d>
+ c40:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ c43:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ c46:	89 de                	mov    %ebx,%esi
+ c48:	89 d3                	mov    %edx,%ebx
+ c4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ c50:	83 ec 04             	sub    $0x4,%esp
+ c53:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ c56:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ c59:	6a 01                	push   $0x1
+ c5b:	53                   	push   %ebx
+ c5c:	57                   	push   %edi
+ c5d:	e8 ab fa ff ff       	call   70d <write>
+        while(*s != 0){
+ c62:	0f b6 06             	movzbl (%esi),%eax
+ c65:	83 c4 10             	add    $0x10,%esp
+ c68:	84 c0                	test   %al,%al
+ c6a:	75 e4                	jne    c50 <printf+0x120>
+      state = 0;
+ c6c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ c6f:	31 d2                	xor    %edx,%edx
+ c71:	e9 07 ff ff ff       	jmp    b7d <printf+0x4d>
+ c76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c7d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ c80:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ c83:	83 ec 0c             	sub    $0xc,%esp
+ c86:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ c8b:	8b 13                	mov    (%ebx),%edx
+ c8d:	6a 01                	push   $0x1
+ c8f:	e9 6b ff ff ff       	jmp    bff <printf+0xcf>
+ c94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ c98:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ c9b:	83 ec 04             	sub    $0x4,%esp
+ c9e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ ca1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ ca3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ ca6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ ca9:	6a 01                	push   $0x1
+ cab:	52                   	push   %edx
+ cac:	57                   	push   %edi
+ cad:	e8 5b fa ff ff       	call   70d <write>
+        ap++;
+ cb2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ cb5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ cb8:	31 d2                	xor    %edx,%edx
+ cba:	e9 be fe ff ff       	jmp    b7d <printf+0x4d>
+ cbf:	90                   	nop
+  write(fd, &c, 1);
+ cc0:	83 ec 04             	sub    $0x4,%esp
+ cc3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ cc6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ cc9:	6a 01                	push   $0x1
+ ccb:	e9 11 ff ff ff       	jmp    be1 <printf+0xb1>
+ cd0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ cd5:	bb 8e 0e 00 00       	mov    $0xe8e,%ebx
+ cda:	e9 61 ff ff ff       	jmp    c40 <printf+0x110>
+ cdf:	90                   	nop
+
+00000ce0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ ce0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ce1:	a1 e0 16 00 00       	mov    0x16e0,%eax
+{
+ ce6:	89 e5                	mov    %esp,%ebp
+ ce8:	57                   	push   %edi
+ ce9:	56                   	push   %esi
+ cea:	53                   	push   %ebx
+ ceb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ cee:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cf1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cf8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cfa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cfc:	39 ca                	cmp    %ecx,%edx
+ cfe:	73 30                	jae    d30 <free+0x50>
+ d00:	39 c1                	cmp    %eax,%ecx
+ d02:	72 04                	jb     d08 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d04:	39 c2                	cmp    %eax,%edx
+ d06:	72 f0                	jb     cf8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ d08:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ d0b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ d0e:	39 f8                	cmp    %edi,%eax
+ d10:	74 2e                	je     d40 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d12:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ d15:	8b 42 04             	mov    0x4(%edx),%eax
+ d18:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d1b:	39 f1                	cmp    %esi,%ecx
+ d1d:	74 38                	je     d57 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ d1f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ d21:	5b                   	pop    %ebx
+  freep = p;
+ d22:	89 15 e0 16 00 00    	mov    %edx,0x16e0
+}
+ d28:	5e                   	pop    %esi
+ d29:	5f                   	pop    %edi
+ d2a:	5d                   	pop    %ebp
+ d2b:	c3                   	ret
+ d2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d30:	39 c1                	cmp    %eax,%ecx
+ d32:	72 d0                	jb     d04 <free+0x24>
+ d34:	eb c2                	jmp    cf8 <free+0x18>
+ d36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d3d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ d40:	03 70 04             	add    0x4(%eax),%esi
+ d43:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d46:	8b 02                	mov    (%edx),%eax
+ d48:	8b 00                	mov    (%eax),%eax
+ d4a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ d4d:	8b 42 04             	mov    0x4(%edx),%eax
+ d50:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d53:	39 f1                	cmp    %esi,%ecx
+ d55:	75 c8                	jne    d1f <free+0x3f>
+    p->s.size += bp->s.size;
+ d57:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ d5a:	89 15 e0 16 00 00    	mov    %edx,0x16e0
+    p->s.size += bp->s.size;
+ d60:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ d63:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ d66:	89 0a                	mov    %ecx,(%edx)
+}
+ d68:	5b                   	pop    %ebx
+ d69:	5e                   	pop    %esi
+ d6a:	5f                   	pop    %edi
+ d6b:	5d                   	pop    %ebp
+ d6c:	c3                   	ret
+ d6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d70 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ d70:	55                   	push   %ebp
+ d71:	89 e5                	mov    %esp,%ebp
+ d73:	57                   	push   %edi
+ d74:	56                   	push   %esi
+ d75:	53                   	push   %ebx
+ d76:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d79:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ d7c:	8b 15 e0 16 00 00    	mov    0x16e0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d82:	8d 78 07             	lea    0x7(%eax),%edi
+ d85:	c1 ef 03             	shr    $0x3,%edi
+ d88:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ d8b:	85 d2                	test   %edx,%edx
+ d8d:	0f 84 8d 00 00 00    	je     e20 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d93:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d95:	8b 48 04             	mov    0x4(%eax),%ecx
+ d98:	39 f9                	cmp    %edi,%ecx
+ d9a:	73 64                	jae    e00 <malloc+0x90>
+  if(nu < 4096)
+ d9c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ da1:	39 df                	cmp    %ebx,%edi
+ da3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ da6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ dad:	eb 0a                	jmp    db9 <malloc+0x49>
+ daf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ db0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ db2:	8b 48 04             	mov    0x4(%eax),%ecx
+ db5:	39 f9                	cmp    %edi,%ecx
+ db7:	73 47                	jae    e00 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ db9:	89 c2                	mov    %eax,%edx
+ dbb:	39 05 e0 16 00 00    	cmp    %eax,0x16e0
+ dc1:	75 ed                	jne    db0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ dc3:	83 ec 0c             	sub    $0xc,%esp
+ dc6:	56                   	push   %esi
+ dc7:	e8 ba fa ff ff       	call   886 <sbrk>
+  if(p == (char*)-1)
+ dcc:	83 c4 10             	add    $0x10,%esp
+ dcf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ dd2:	74 1c                	je     df0 <malloc+0x80>
+  hp->s.size = nu;
+ dd4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ dd7:	83 ec 0c             	sub    $0xc,%esp
+ dda:	83 c0 08             	add    $0x8,%eax
+ ddd:	50                   	push   %eax
+ dde:	e8 fd fe ff ff       	call   ce0 <free>
+  return freep;
+ de3:	8b 15 e0 16 00 00    	mov    0x16e0,%edx
+      if((p = morecore(nunits)) == 0)
+ de9:	83 c4 10             	add    $0x10,%esp
+ dec:	85 d2                	test   %edx,%edx
+ dee:	75 c0                	jne    db0 <malloc+0x40>
+        return 0;
+  }
+}
+ df0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ df3:	31 c0                	xor    %eax,%eax
+}
+ df5:	5b                   	pop    %ebx
+ df6:	5e                   	pop    %esi
+ df7:	5f                   	pop    %edi
+ df8:	5d                   	pop    %ebp
+ df9:	c3                   	ret
+ dfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ e00:	39 cf                	cmp    %ecx,%edi
+ e02:	74 4c                	je     e50 <malloc+0xe0>
+        p->s.size -= nunits;
+ e04:	29 f9                	sub    %edi,%ecx
+ e06:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ e09:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ e0c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ e0f:	89 15 e0 16 00 00    	mov    %edx,0x16e0
+}
+ e15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ e18:	83 c0 08             	add    $0x8,%eax
+}
+ e1b:	5b                   	pop    %ebx
+ e1c:	5e                   	pop    %esi
+ e1d:	5f                   	pop    %edi
+ e1e:	5d                   	pop    %ebp
+ e1f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ e20:	c7 05 e0 16 00 00 e4 	movl   $0x16e4,0x16e0
+ e27:	16 00 00 
+    base.s.size = 0;
+ e2a:	b8 e4 16 00 00       	mov    $0x16e4,%eax
+    base.s.ptr = freep = prevp = &base;
+ e2f:	c7 05 e4 16 00 00 e4 	movl   $0x16e4,0x16e4
+ e36:	16 00 00 
+    base.s.size = 0;
+ e39:	c7 05 e8 16 00 00 00 	movl   $0x0,0x16e8
+ e40:	00 00 00 
+    if(p->s.size >= nunits){
+ e43:	e9 54 ff ff ff       	jmp    d9c <malloc+0x2c>
+ e48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e4f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ e50:	8b 08                	mov    (%eax),%ecx
+ e52:	89 0a                	mov    %ecx,(%edx)
+ e54:	eb b9                	jmp    e0f <malloc+0x9f>
@@ -1,4 +1,20 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// IDE driver.
+//
+// If the IDE controller is a PCI bus-master controller (such
+// as the PIIX in QEMU), transfers are done by DMA: idestart()
+// points the controller at a table of physical regions and
+// the data moves without the CPU.  Otherwise, or if a DMA
+// transfer fails, the driver falls back to programmed I/O,
+// copying each sector through the data port.
+//
+// Requests wait in a queue sorted by disk and block, and are
+// served in one-way (C-SCAN) sweeps: the next command starts
+// at the first request at or past where the previous command
+// ended, wrapping to the lowest when the sweep runs out.  A
+// request that has waited longer than IDEDEADLINE ticks is
+// served next regardless.  A command carries a run of
+// adjacent requests in the same direction, as one DMA
+// transfer or one READ/WRITE MULTIPLE.
 
 #include "types.h"
 #include "defs.h"
@@ -12,6 +28,8 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "pci.h"
+#include "diskstat.h"
 
 #define SECTOR_SIZE   512
 #define IDE_BSY       0x80
@@ -23,16 +41,48 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_SETMUL 0xc6
+#define IDE_CMD_RDDMA 0xc8
+#define IDE_CMD_WRDMA 0xca
 
-// idequeue points to the buf now being read/written to the disk.
-// idequeue->qnext points to the next buf to be processed.
-// You must hold idelock while manipulating queue.
+#define IDEMAXBATCH   16      // Most blocks in one command
+#define IDEDEADLINE   (HZ/2)  // Ticks before a request jumps the sweep
+
+// Bus-master registers, at the I/O base in PCI BAR 4.
+// The primary channel's come first.
+#define BM_CMD        0
+#define BM_STATUS     2
+#define BM_PRDT       4  // Physical address of the PRD table
+#define BM_CMD_START  0x1
+#define BM_CMD_READ   0x8  // Transfer from disk to memory
+#define BM_ST_ERR     0x2
+#define BM_ST_INTR    0x4
+
+// Physical region descriptor: one piece of a DMA transfer.
+// A piece may not cross a 64KB boundary.
+struct prd {
+  uint addr;
+  ushort len;        // Bytes; 0 means 64KB
+  ushort flags;
+};
+#define PRD_EOT       0x8000  // Last entry in the table
+#define NPRD          (2*IDEMAXBATCH)  // A block crosses at most one boundary
+
+// idequeue holds the waiting requests, sorted by disk and block.
+// idebatch is the run of adjacent bufs, linked by qnext, that
+// the disk is now working on.
+// You must hold idelock while manipulating either.
 
 static struct spinlock idelock;
 static struct buf *idequeue;
+static struct buf *idebatch;
+static uint sweepdev, sweepblock;  // Where the last command ended
 
 static int havedisk1;
-static void idestart(struct buf*);
+static int idemult;    // Sectors per PIO interrupt (SET MULTIPLE)
+static ushort bmbase;  // Bus-master I/O base, or 0 for PIO
+static struct prd prdt[NPRD] __attribute__((aligned(16)));
+static void idestart(struct buf*, int);
 
 // Wait for IDE disk to become ready.
 static int
@@ -47,9 +97,22 @@ idewait(int checkerr)
   return 0;
 }
 
+// Have disk dev transfer n sectors per PIO interrupt
+// in READ/WRITE MULTIPLE.
+static int
+idesetmult(int dev, int n)
+{
+  idewait(0);
+  outb(0x1f6, 0xe0 | ((dev&1)<<4));
+  outb(0x1f2, n);
+  outb(0x1f7, IDE_CMD_SETMUL);
+  return idewait(1);
+}
+
 void
 ideinit(void)
 {
+  struct pcidev *d;
   int i;
 
   initlock(&idelock, "ide");
@@ -65,80 +128,219 @@ ideinit(void)
     }
   }
 
+  // Without multiple mode, PIO moves one sector per command.
+  idemult = IDEMAXBATCH*(BSIZE/SECTOR_SIZE);
+  if(idesetmult(0, idemult) < 0 || (havedisk1 && idesetmult(1, idemult) < 0))
+    idemult = 1;
+  if(idemult == 1 && BSIZE/SECTOR_SIZE > 1)
+    panic("ideinit: no multiple mode");
+
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
+
+  // Use DMA if there is a bus-master IDE controller.
+  if((d = pcifind(0x01, 0x01)) != 0 && (d->progif & 0x80) &&
+     (d->bar[4] & PCI_BAR_IO)){
+    bmbase = d->bar[4] & PCI_BAR_IOMASK;
+    pcibusmaster(d);
+  }
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Fill in prdt to describe the data of the bufs in list b.
 static void
-idestart(struct buf *b)
+prdinit(struct buf *b)
 {
+  uint pa, m, n;
+  int i;
+
+  i = 0;
+  for(; b; b = b->qnext){
+    pa = V2P(b->data);
+    for(n = BSIZE; n > 0; i++){
+      if(i == NPRD)
+        panic("prdinit");
+      m = 0x10000 - (pa & 0xffff);
+      if(m > n)
+        m = n;
+      prdt[i].addr = pa;
+      prdt[i].len = m;
+      prdt[i].flags = 0;
+      pa += m;
+      n -= m;
+    }
+  }
+  prdt[i-1].flags = PRD_EOT;
+}
+
+// Start the command for the n adjacent bufs in list b.
+// Caller must hold idelock.
+static void
+idestart(struct buf *b, int n)
+{
+  struct buf *p;
+
   if(b == 0)
     panic("idestart");
-  if(b->blockno >= FSSIZE)
+  if(b->blockno + n > FSSIZE)
     panic("incorrect blockno");
   int sector_per_block =  BSIZE/SECTOR_SIZE;
   int sector = b->blockno * sector_per_block;
-  int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
-  int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+  int nsector = n * sector_per_block;
+  int read_cmd = (idemult == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
+  int write_cmd = (idemult == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
 
-  if (sector_per_block > 7) panic("idestart");
+  if (nsector > 255 || (!bmbase && nsector > idemult)) panic("idestart");
 
+  xadd(&diskstat.ncmd, 1);
   idewait(0);
+  if(bmbase){
+    prdinit(b);
+    outb(bmbase+BM_CMD, 0);
+    outl(bmbase+BM_PRDT, V2P(prdt));
+    outb(bmbase+BM_STATUS, BM_ST_ERR|BM_ST_INTR);  // clear
+  }
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, nsector);  // number of sectors
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
-  if(b->flags & B_DIRTY){
+  if(bmbase && (b->flags & B_DIRTY)){
+    outb(0x1f7, IDE_CMD_WRDMA);
+    outb(bmbase+BM_CMD, BM_CMD_START);
+  } else if(bmbase){
+    outb(0x1f7, IDE_CMD_RDDMA);
+    outb(bmbase+BM_CMD, BM_CMD_READ|BM_CMD_START);
+  } else if(b->flags & B_DIRTY){
     outb(0x1f7, write_cmd);
-    outsl(0x1f0, b->data, BSIZE/4);
+    for(p = b; p; p = p->qnext)
+      outsl(0x1f0, p->data, BSIZE/4);
   } else {
     outb(0x1f7, read_cmd);
   }
 }
 
+// Does a come before b on the disks?
+static int
+before(struct buf *a, uint dev, uint blockno)
+{
+  return a->dev < dev || (a->dev == dev && a->blockno < blockno);
+}
+
+// Add b to idequeue in order.
+static void
+idequeueadd(struct buf *b)
+{
+  struct buf **pp;
+
+  for(pp=&idequeue; *pp && before(*pp, b->dev, b->blockno); pp=&(*pp)->qnext)  //DOC:insert-queue
+    ;
+  b->qnext = *pp;
+  *pp = b;
+}
+
+// Take the next run of requests off idequeue and start
+// the disk on it.  Caller must hold idelock.
+static void
+idenext(void)
+{
+  struct buf **pp, **oldest, *b, *e;
+  int n, max;
+
+  if(idebatch != 0 || idequeue == 0)
+    return;
+
+  // Continue the sweep, unless a request is overdue.
+  oldest = &idequeue;
+  for(pp = &idequeue; *pp; pp = &(*pp)->qnext)
+    if((*pp)->qtime < (*oldest)->qtime)
+      oldest = pp;
+  if(tscperiod && rdtsc() - (*oldest)->qtime > (uint64)tscperiod*IDEDEADLINE)
+    pp = oldest;
+  else {
+    for(pp = &idequeue; *pp; pp = &(*pp)->qnext)
+      if(!before(*pp, sweepdev, sweepblock))
+        break;
+    if(*pp == 0)
+      pp = &idequeue;  // wrap around
+  }
+
+  // Merge the adjacent requests that follow in the same direction.
+  max = bmbase ? IDEMAXBATCH : idemult/(BSIZE/SECTOR_SIZE);
+  b = e = *pp;
+  for(n = 1; n < max && e->qnext; n++){
+    if(e->qnext->dev != b->dev || e->qnext->blockno != e->blockno+1 ||
+       (e->qnext->flags & B_DIRTY) != (b->flags & B_DIRTY))
+      break;
+    e = e->qnext;
+  }
+  *pp = e->qnext;
+  e->qnext = 0;
+  idebatch = b;
+  sweepdev = e->dev;
+  sweepblock = e->blockno + 1;
+  idestart(b, n);
+}
+
 // Interrupt handler.
 void
 ideintr(void)
 {
-  struct buf *b;
+  struct buf *b, *next;
+  uchar st;
 
-  // First queued buffer is the active request.
+  // idebatch is the active command.
   acquire(&idelock);
 
-  if((b = idequeue) == 0){
+  if((b = idebatch) == 0){
     release(&idelock);
     return;
   }
-  idequeue = b->qnext;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE/4);
+  if(bmbase){
+    // The data is already in place; stop the controller.
+    st = inb(bmbase+BM_STATUS);
+    outb(bmbase+BM_CMD, 0);
+    outb(bmbase+BM_STATUS, BM_ST_ERR|BM_ST_INTR);
+    if((st & BM_ST_ERR) || idewait(1) < 0){
+      cprintf("ide: DMA failed, using PIO\n");
+      bmbase = 0;
+      // PIO may move fewer blocks per command; sort them out again.
+      idebatch = 0;
+      for(; b; b = next){
+        next = b->qnext;
+        idequeueadd(b);
+      }
+      idenext();
+      release(&idelock);
+      return;
+    }
+  } else if(!(b->flags & B_DIRTY) && idewait(1) >= 0){
+    // Read data if needed.
+    for(next = b; next; next = next->qnext)
+      insl(0x1f0, next->data, BSIZE/4);
+  }
+  idebatch = 0;
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+  // Tell bio.c these bufs are done.
+  for(; b; b = next){
+    next = b->qnext;
+    biodone(b);
+  }
 
-  // Start disk on next buf in queue.
-  if(idequeue != 0)
-    idestart(idequeue);
+  // Start disk on next run in queue.
+  idenext();
 
   release(&idelock);
 }
 
 //PAGEBREAK!
-// Sync buf with disk.
-// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
-// Else if B_VALID is not set, read buf from disk, set B_VALID.
+// Start syncing buf with disk, and return.
+// If B_DIRTY is set, write buf to disk; else read it.
+// ideintr() calls biodone(b) when it is done.
 void
 iderw(struct buf *b)
 {
-  struct buf **pp;
-
   if(!holdingsleep(&b->lock))
     panic("iderw: buf not locked");
   if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
@@ -148,21 +350,10 @@ iderw(struct buf *b)
 
   acquire(&idelock);  //DOC:acquire-lock
 
-  // Append b to idequeue.
-  b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
-    ;
-  *pp = b;
+  idequeueadd(b);
 
   // Start disk if necessary.
-  if(idequeue == b)
-    idestart(b);
-
-  // Wait for request to finish.
-  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
-    sleep(b, &idelock);
-  }
-
+  idenext();
 
   release(&idelock);
 }
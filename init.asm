@@ -0,0 +1,1601 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+   f:	83 ec 08             	sub    $0x8,%esp
+  12:	6a 02                	push   $0x2
+  14:	68 a8 0b 00 00       	push   $0xba8
+  19:	e8 b3 04 00 00       	call   4d1 <open>
+  1e:	83 c4 10             	add    $0x10,%esp
+  21:	85 c0                	test   %eax,%eax
+  23:	0f 88 9f 00 00 00    	js     c8 <main+0xc8>
+    mknod("console", 1, 1);
+    open("console", O_RDWR);
+  }
+  dup(0);  // stdout
+  29:	83 ec 0c             	sub    $0xc,%esp
+  2c:	6a 00                	push   $0x0
+  2e:	e8 69 05 00 00       	call   59c <dup>
+  dup(0);  // stderr
+  33:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  3a:	e8 5d 05 00 00       	call   59c <dup>
+  3f:	83 c4 10             	add    $0x10,%esp
+  42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+  48:	83 ec 08             	sub    $0x8,%esp
+  4b:	68 b0 0b 00 00       	push   $0xbb0
+  50:	6a 01                	push   $0x1
+  52:	e8 29 08 00 00       	call   880 <printf>
+    pid = fork();
+  57:	e8 70 03 00 00       	call   3cc <fork>
+    if(pid < 0){
+  5c:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+  5f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+  61:	85 c0                	test   %eax,%eax
+  63:	78 2c                	js     91 <main+0x91>
+      printf(1, "init: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+  65:	74 3d                	je     a4 <main+0xa4>
+  67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6e:	66 90                	xchg   %ax,%ax
+      exec("sh", argv);
+      printf(1, "init: exec sh failed\n");
+      exit();
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+  70:	e8 91 03 00 00       	call   406 <wait>
+  75:	85 c0                	test   %eax,%eax
+  77:	78 cf                	js     48 <main+0x48>
+  79:	39 c3                	cmp    %eax,%ebx
+  7b:	74 cb                	je     48 <main+0x48>
+      printf(1, "zombie!\n");
+  7d:	83 ec 08             	sub    $0x8,%esp
+  80:	68 ef 0b 00 00       	push   $0xbef
+  85:	6a 01                	push   $0x1
+  87:	e8 f4 07 00 00       	call   880 <printf>
+  8c:	83 c4 10             	add    $0x10,%esp
+  8f:	eb df                	jmp    70 <main+0x70>
+      printf(1, "init: fork failed\n");
+  91:	53                   	push   %ebx
+  92:	53                   	push   %ebx
+  93:	68 c3 0b 00 00       	push   $0xbc3
+  98:	6a 01                	push   $0x1
+  9a:	e8 e1 07 00 00       	call   880 <printf>
+      exit();
+  9f:	e8 45 03 00 00       	call   3e9 <exit>
+      exec("sh", argv);
+  a4:	50                   	push   %eax
+  a5:	50                   	push   %eax
+  a6:	68 48 0f 00 00       	push   $0xf48
+  ab:	68 d6 0b 00 00       	push   $0xbd6
+  b0:	e8 ff 03 00 00       	call   4b4 <exec>
+      printf(1, "init: exec sh failed\n");
+  b5:	5a                   	pop    %edx
+  b6:	59                   	pop    %ecx
+  b7:	68 d9 0b 00 00       	push   $0xbd9
+  bc:	6a 01                	push   $0x1
+  be:	e8 bd 07 00 00       	call   880 <printf>
+      exit();
+  c3:	e8 21 03 00 00       	call   3e9 <exit>
+    mknod("console", 1, 1);
+  c8:	50                   	push   %eax
+  c9:	6a 01                	push   $0x1
+  cb:	6a 01                	push   $0x1
+  cd:	68 a8 0b 00 00       	push   $0xba8
+  d2:	e8 17 04 00 00       	call   4ee <mknod>
+    open("console", O_RDWR);
+  d7:	58                   	pop    %eax
+  d8:	5a                   	pop    %edx
+  d9:	6a 02                	push   $0x2
+  db:	68 a8 0b 00 00       	push   $0xba8
+  e0:	e8 ec 03 00 00       	call   4d1 <open>
+  e5:	83 c4 10             	add    $0x10,%esp
+  e8:	e9 3c ff ff ff       	jmp    29 <main+0x29>
+  ed:	66 90                	xchg   %ax,%ax
+  ef:	90                   	nop
+
+000000f0 <strcpy>:
+#include "date.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  f1:	31 c0                	xor    %eax,%eax
+{
+  f3:	89 e5                	mov    %esp,%ebp
+  f5:	53                   	push   %ebx
+  f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 100:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 104:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 107:	83 c0 01             	add    $0x1,%eax
+ 10a:	84 d2                	test   %dl,%dl
+ 10c:	75 f2                	jne    100 <strcpy+0x10>
+    ;
+  return os;
+}
+ 10e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 111:	89 c8                	mov    %ecx,%eax
+ 113:	c9                   	leave
+ 114:	c3                   	ret
+ 115:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000120 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	53                   	push   %ebx
+ 124:	8b 55 08             	mov    0x8(%ebp),%edx
+ 127:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 12a:	0f b6 02             	movzbl (%edx),%eax
+ 12d:	84 c0                	test   %al,%al
+ 12f:	75 17                	jne    148 <strcmp+0x28>
+ 131:	eb 3a                	jmp    16d <strcmp+0x4d>
+ 133:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 137:	90                   	nop
+ 138:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 13c:	83 c2 01             	add    $0x1,%edx
+ 13f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 142:	84 c0                	test   %al,%al
+ 144:	74 1a                	je     160 <strcmp+0x40>
+    p++, q++;
+ 146:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 148:	0f b6 19             	movzbl (%ecx),%ebx
+ 14b:	38 c3                	cmp    %al,%bl
+ 14d:	74 e9                	je     138 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 14f:	29 d8                	sub    %ebx,%eax
+}
+ 151:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 154:	c9                   	leave
+ 155:	c3                   	ret
+ 156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 160:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 164:	31 c0                	xor    %eax,%eax
+ 166:	29 d8                	sub    %ebx,%eax
+}
+ 168:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 16b:	c9                   	leave
+ 16c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 16d:	0f b6 19             	movzbl (%ecx),%ebx
+ 170:	31 c0                	xor    %eax,%eax
+ 172:	eb db                	jmp    14f <strcmp+0x2f>
+ 174:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 17f:	90                   	nop
+
+00000180 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 186:	80 3a 00             	cmpb   $0x0,(%edx)
+ 189:	74 15                	je     1a0 <strlen+0x20>
+ 18b:	31 c0                	xor    %eax,%eax
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+ 190:	83 c0 01             	add    $0x1,%eax
+ 193:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 197:	89 c1                	mov    %eax,%ecx
+ 199:	75 f5                	jne    190 <strlen+0x10>
+    ;
+  return n;
+}
+ 19b:	89 c8                	mov    %ecx,%eax
+ 19d:	5d                   	pop    %ebp
+ 19e:	c3                   	ret
+ 19f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1a0:	31 c9                	xor    %ecx,%ecx
+}
+ 1a2:	5d                   	pop    %ebp
+ 1a3:	89 c8                	mov    %ecx,%eax
+ 1a5:	c3                   	ret
+ 1a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	57                   	push   %edi
+ 1b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1bd:	89 d7                	mov    %edx,%edi
+ 1bf:	fc                   	cld
+ 1c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1c5:	89 d0                	mov    %edx,%eax
+ 1c7:	c9                   	leave
+ 1c8:	c3                   	ret
+ 1c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1da:	0f b6 10             	movzbl (%eax),%edx
+ 1dd:	84 d2                	test   %dl,%dl
+ 1df:	75 12                	jne    1f3 <strchr+0x23>
+ 1e1:	eb 1d                	jmp    200 <strchr+0x30>
+ 1e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1e7:	90                   	nop
+ 1e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1ec:	83 c0 01             	add    $0x1,%eax
+ 1ef:	84 d2                	test   %dl,%dl
+ 1f1:	74 0d                	je     200 <strchr+0x30>
+    if(*s == c)
+ 1f3:	38 d1                	cmp    %dl,%cl
+ 1f5:	75 f1                	jne    1e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1f7:	5d                   	pop    %ebp
+ 1f8:	c3                   	ret
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 200:	31 c0                	xor    %eax,%eax
+}
+ 202:	5d                   	pop    %ebp
+ 203:	c3                   	ret
+ 204:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 20f:	90                   	nop
+
+00000210 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	57                   	push   %edi
+ 214:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 215:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 218:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 219:	31 db                	xor    %ebx,%ebx
+{
+ 21b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 21e:	eb 27                	jmp    247 <gets+0x37>
+    cc = read(0, &c, 1);
+ 220:	83 ec 04             	sub    $0x4,%esp
+ 223:	6a 01                	push   $0x1
+ 225:	56                   	push   %esi
+ 226:	6a 00                	push   $0x0
+ 228:	e8 13 02 00 00       	call   440 <read>
+    if(cc < 1)
+ 22d:	83 c4 10             	add    $0x10,%esp
+ 230:	85 c0                	test   %eax,%eax
+ 232:	7e 1d                	jle    251 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 234:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 238:	8b 55 08             	mov    0x8(%ebp),%edx
+ 23b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 23f:	3c 0a                	cmp    $0xa,%al
+ 241:	74 10                	je     253 <gets+0x43>
+ 243:	3c 0d                	cmp    $0xd,%al
+ 245:	74 0c                	je     253 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 247:	89 df                	mov    %ebx,%edi
+ 249:	83 c3 01             	add    $0x1,%ebx
+ 24c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 24f:	7c cf                	jl     220 <gets+0x10>
+ 251:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 253:	8b 45 08             	mov    0x8(%ebp),%eax
+ 256:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 25a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 25d:	5b                   	pop    %ebx
+ 25e:	5e                   	pop    %esi
+ 25f:	5f                   	pop    %edi
+ 260:	5d                   	pop    %ebp
+ 261:	c3                   	ret
+ 262:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 269:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000270 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	56                   	push   %esi
+ 274:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 275:	83 ec 08             	sub    $0x8,%esp
+ 278:	6a 00                	push   $0x0
+ 27a:	ff 75 08             	push   0x8(%ebp)
+ 27d:	e8 4f 02 00 00       	call   4d1 <open>
+  if(fd < 0)
+ 282:	83 c4 10             	add    $0x10,%esp
+ 285:	85 c0                	test   %eax,%eax
+ 287:	78 27                	js     2b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 289:	83 ec 08             	sub    $0x8,%esp
+ 28c:	ff 75 0c             	push   0xc(%ebp)
+ 28f:	89 c3                	mov    %eax,%ebx
+ 291:	50                   	push   %eax
+ 292:	e8 91 02 00 00       	call   528 <fstat>
+  close(fd);
+ 297:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 29a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 29c:	e8 d9 01 00 00       	call   47a <close>
+  return r;
+ 2a1:	83 c4 10             	add    $0x10,%esp
+}
+ 2a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2a7:	89 f0                	mov    %esi,%eax
+ 2a9:	5b                   	pop    %ebx
+ 2aa:	5e                   	pop    %esi
+ 2ab:	5d                   	pop    %ebp
+ 2ac:	c3                   	ret
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2b5:	eb ed                	jmp    2a4 <stat+0x34>
+ 2b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2be:	66 90                	xchg   %ax,%ax
+
+000002c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	53                   	push   %ebx
+ 2c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2c7:	0f be 02             	movsbl (%edx),%eax
+ 2ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2d5:	77 1e                	ja     2f5 <atoi+0x35>
+ 2d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 2e0:	83 c2 01             	add    $0x1,%edx
+ 2e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 2e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 2ea:	0f be 02             	movsbl (%edx),%eax
+ 2ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2f0:	80 fb 09             	cmp    $0x9,%bl
+ 2f3:	76 eb                	jbe    2e0 <atoi+0x20>
+  return n;
+}
+ 2f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2f8:	89 c8                	mov    %ecx,%eax
+ 2fa:	c9                   	leave
+ 2fb:	c3                   	ret
+ 2fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	57                   	push   %edi
+ 304:	56                   	push   %esi
+ 305:	8b 45 10             	mov    0x10(%ebp),%eax
+ 308:	8b 55 08             	mov    0x8(%ebp),%edx
+ 30b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 30e:	85 c0                	test   %eax,%eax
+ 310:	7e 13                	jle    325 <memmove+0x25>
+ 312:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 314:	89 d7                	mov    %edx,%edi
+ 316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 320:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 321:	39 f8                	cmp    %edi,%eax
+ 323:	75 fb                	jne    320 <memmove+0x20>
+  return vdst;
+}
+ 325:	5e                   	pop    %esi
+ 326:	89 d0                	mov    %edx,%eax
+ 328:	5f                   	pop    %edi
+ 329:	5d                   	pop    %ebp
+ 32a:	c3                   	ret
+ 32b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 32f:	90                   	nop
+
+00000330 <ugetpid>:
+// getpid() without a system call, from the page at UPROC.
+int
+ugetpid(void)
+{
+  return ((struct uproc*)UPROC)->pid;
+}
+ 330:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+ 335:	c3                   	ret
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <uclocktime>:
+
+// clocktime() without a system call, from the page at UCLOCK.
+int
+uclocktime(struct timespec *ts)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	56                   	push   %esi
+ 345:	53                   	push   %ebx
+ 346:	83 ec 1c             	sub    $0x1c,%esp
+  struct uclock *c = (struct uclock*)UCLOCK;
+
+  if(c->tscmult == 0)
+ 349:	8b 0d 08 f0 ff 7f    	mov    0x7ffff008,%ecx
+{
+ 34f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(c->tscmult == 0)
+ 352:	85 c9                	test   %ecx,%ecx
+ 354:	74 6a                	je     3c0 <uclocktime+0x80>
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+ 356:	0f 31                	rdtsc
+static inline void
+uclockread(struct uclock *c, uint64 tsc, struct timespec *ts)
+{
+  uint64 d, ns;
+
+  d = tsc - c->tscbase;
+ 358:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 35e:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+ 364:	89 c6                	mov    %eax,%esi
+  if((long long)d < 0)  // another CPU's TSC is a little behind
+ 366:	85 d2                	test   %edx,%edx
+ 368:	78 46                	js     3b0 <uclocktime+0x70>
+    d = 0;
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 36a:	89 d0                	mov    %edx,%eax
+ 36c:	f7 e1                	mul    %ecx
+ 36e:	0f a4 c2 08          	shld   $0x8,%eax,%edx
+ 372:	c1 e0 08             	shl    $0x8,%eax
+ 375:	89 45 e0             	mov    %eax,-0x20(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+ 378:	89 f0                	mov    %esi,%eax
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 37a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+ 37d:	f7 e1                	mul    %ecx
+ 37f:	0f ac d0 18          	shrd   $0x18,%edx,%eax
+ 383:	c1 ea 18             	shr    $0x18,%edx
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 386:	03 45 e0             	add    -0x20(%ebp),%eax
+ 389:	13 55 e4             	adc    -0x1c(%ebp),%edx
+// linked with libgcc, so it cannot use 64-bit '/' or '%'.
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+  asm("divl %4" : "=a" (q), "=d" (r) : "a" ((uint)n), "d" ((uint)(n>>32)), "rm" (d));
+ 38c:	89 c7                	mov    %eax,%edi
+ 38e:	89 f8                	mov    %edi,%eax
+ 390:	b9 00 ca 9a 3b       	mov    $0x3b9aca00,%ecx
+ 395:	f7 f1                	div    %ecx
+  ts->sec = divl(ns, 1000000000, &ts->nsec);
+ 397:	89 03                	mov    %eax,(%ebx)
+    return clocktime(ts);
+  uclockread(c, rdtsc(), ts);
+  return 0;
+}
+ 399:	31 c0                	xor    %eax,%eax
+  *rem = r;
+ 39b:	89 53 04             	mov    %edx,0x4(%ebx)
+ 39e:	83 c4 1c             	add    $0x1c,%esp
+ 3a1:	5b                   	pop    %ebx
+ 3a2:	5e                   	pop    %esi
+ 3a3:	5f                   	pop    %edi
+ 3a4:	5d                   	pop    %ebp
+ 3a5:	c3                   	ret
+ 3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+ 3b0:	31 d2                	xor    %edx,%edx
+ 3b2:	31 ff                	xor    %edi,%edi
+ 3b4:	eb d8                	jmp    38e <uclocktime+0x4e>
+ 3b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 3c0:	83 c4 1c             	add    $0x1c,%esp
+ 3c3:	5b                   	pop    %ebx
+ 3c4:	5e                   	pop    %esi
+ 3c5:	5f                   	pop    %edi
+ 3c6:	5d                   	pop    %ebp
+    return clocktime(ts);
+ 3c7:	e9 f2 02 00 00       	jmp    6be <clocktime>
+
+000003cc <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+ 3cc:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3d1:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 3d8:	00 00 00 
+ 3db:	74 09                	je     3e6 <fork+0x1a>
+ 3dd:	89 e1                	mov    %esp,%ecx
+ 3df:	ba e8 03 00 00       	mov    $0x3e8,%edx
+ 3e4:	0f 34                	sysenter
+ 3e6:	cd 40                	int    $0x40
+ 3e8:	c3                   	ret
+
+000003e9 <exit>:
+SYSCALL(exit)
+ 3e9:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3ee:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 3f5:	00 00 00 
+ 3f8:	74 09                	je     403 <exit+0x1a>
+ 3fa:	89 e1                	mov    %esp,%ecx
+ 3fc:	ba 05 04 00 00       	mov    $0x405,%edx
+ 401:	0f 34                	sysenter
+ 403:	cd 40                	int    $0x40
+ 405:	c3                   	ret
+
+00000406 <wait>:
+SYSCALL(wait)
+ 406:	b8 03 00 00 00       	mov    $0x3,%eax
+ 40b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 412:	00 00 00 
+ 415:	74 09                	je     420 <wait+0x1a>
+ 417:	89 e1                	mov    %esp,%ecx
+ 419:	ba 22 04 00 00       	mov    $0x422,%edx
+ 41e:	0f 34                	sysenter
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <pipe>:
+SYSCALL(pipe)
+ 423:	b8 04 00 00 00       	mov    $0x4,%eax
+ 428:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 42f:	00 00 00 
+ 432:	74 09                	je     43d <pipe+0x1a>
+ 434:	89 e1                	mov    %esp,%ecx
+ 436:	ba 3f 04 00 00       	mov    $0x43f,%edx
+ 43b:	0f 34                	sysenter
+ 43d:	cd 40                	int    $0x40
+ 43f:	c3                   	ret
+
+00000440 <read>:
+SYSCALL(read)
+ 440:	b8 05 00 00 00       	mov    $0x5,%eax
+ 445:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 44c:	00 00 00 
+ 44f:	74 09                	je     45a <read+0x1a>
+ 451:	89 e1                	mov    %esp,%ecx
+ 453:	ba 5c 04 00 00       	mov    $0x45c,%edx
+ 458:	0f 34                	sysenter
+ 45a:	cd 40                	int    $0x40
+ 45c:	c3                   	ret
+
+0000045d <write>:
+SYSCALL(write)
+ 45d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 462:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 469:	00 00 00 
+ 46c:	74 09                	je     477 <write+0x1a>
+ 46e:	89 e1                	mov    %esp,%ecx
+ 470:	ba 79 04 00 00       	mov    $0x479,%edx
+ 475:	0f 34                	sysenter
+ 477:	cd 40                	int    $0x40
+ 479:	c3                   	ret
+
+0000047a <close>:
+SYSCALL(close)
+ 47a:	b8 15 00 00 00       	mov    $0x15,%eax
+ 47f:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 486:	00 00 00 
+ 489:	74 09                	je     494 <close+0x1a>
+ 48b:	89 e1                	mov    %esp,%ecx
+ 48d:	ba 96 04 00 00       	mov    $0x496,%edx
+ 492:	0f 34                	sysenter
+ 494:	cd 40                	int    $0x40
+ 496:	c3                   	ret
+
+00000497 <kill>:
+SYSCALL(kill)
+ 497:	b8 06 00 00 00       	mov    $0x6,%eax
+ 49c:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4a3:	00 00 00 
+ 4a6:	74 09                	je     4b1 <kill+0x1a>
+ 4a8:	89 e1                	mov    %esp,%ecx
+ 4aa:	ba b3 04 00 00       	mov    $0x4b3,%edx
+ 4af:	0f 34                	sysenter
+ 4b1:	cd 40                	int    $0x40
+ 4b3:	c3                   	ret
+
+000004b4 <exec>:
+SYSCALL(exec)
+ 4b4:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4b9:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4c0:	00 00 00 
+ 4c3:	74 09                	je     4ce <exec+0x1a>
+ 4c5:	89 e1                	mov    %esp,%ecx
+ 4c7:	ba d0 04 00 00       	mov    $0x4d0,%edx
+ 4cc:	0f 34                	sysenter
+ 4ce:	cd 40                	int    $0x40
+ 4d0:	c3                   	ret
+
+000004d1 <open>:
+SYSCALL(open)
+ 4d1:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4d6:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4dd:	00 00 00 
+ 4e0:	74 09                	je     4eb <open+0x1a>
+ 4e2:	89 e1                	mov    %esp,%ecx
+ 4e4:	ba ed 04 00 00       	mov    $0x4ed,%edx
+ 4e9:	0f 34                	sysenter
+ 4eb:	cd 40                	int    $0x40
+ 4ed:	c3                   	ret
+
+000004ee <mknod>:
+SYSCALL(mknod)
+ 4ee:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4f3:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4fa:	00 00 00 
+ 4fd:	74 09                	je     508 <mknod+0x1a>
+ 4ff:	89 e1                	mov    %esp,%ecx
+ 501:	ba 0a 05 00 00       	mov    $0x50a,%edx
+ 506:	0f 34                	sysenter
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <unlink>:
+SYSCALL(unlink)
+ 50b:	b8 12 00 00 00       	mov    $0x12,%eax
+ 510:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 517:	00 00 00 
+ 51a:	74 09                	je     525 <unlink+0x1a>
+ 51c:	89 e1                	mov    %esp,%ecx
+ 51e:	ba 27 05 00 00       	mov    $0x527,%edx
+ 523:	0f 34                	sysenter
+ 525:	cd 40                	int    $0x40
+ 527:	c3                   	ret
+
+00000528 <fstat>:
+SYSCALL(fstat)
+ 528:	b8 08 00 00 00       	mov    $0x8,%eax
+ 52d:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 534:	00 00 00 
+ 537:	74 09                	je     542 <fstat+0x1a>
+ 539:	89 e1                	mov    %esp,%ecx
+ 53b:	ba 44 05 00 00       	mov    $0x544,%edx
+ 540:	0f 34                	sysenter
+ 542:	cd 40                	int    $0x40
+ 544:	c3                   	ret
+
+00000545 <link>:
+SYSCALL(link)
+ 545:	b8 13 00 00 00       	mov    $0x13,%eax
+ 54a:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 551:	00 00 00 
+ 554:	74 09                	je     55f <link+0x1a>
+ 556:	89 e1                	mov    %esp,%ecx
+ 558:	ba 61 05 00 00       	mov    $0x561,%edx
+ 55d:	0f 34                	sysenter
+ 55f:	cd 40                	int    $0x40
+ 561:	c3                   	ret
+
+00000562 <mkdir>:
+SYSCALL(mkdir)
+ 562:	b8 14 00 00 00       	mov    $0x14,%eax
+ 567:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 56e:	00 00 00 
+ 571:	74 09                	je     57c <mkdir+0x1a>
+ 573:	89 e1                	mov    %esp,%ecx
+ 575:	ba 7e 05 00 00       	mov    $0x57e,%edx
+ 57a:	0f 34                	sysenter
+ 57c:	cd 40                	int    $0x40
+ 57e:	c3                   	ret
+
+0000057f <chdir>:
+SYSCALL(chdir)
+ 57f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 584:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 58b:	00 00 00 
+ 58e:	74 09                	je     599 <chdir+0x1a>
+ 590:	89 e1                	mov    %esp,%ecx
+ 592:	ba 9b 05 00 00       	mov    $0x59b,%edx
+ 597:	0f 34                	sysenter
+ 599:	cd 40                	int    $0x40
+ 59b:	c3                   	ret
+
+0000059c <dup>:
+SYSCALL(dup)
+ 59c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5a1:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5a8:	00 00 00 
+ 5ab:	74 09                	je     5b6 <dup+0x1a>
+ 5ad:	89 e1                	mov    %esp,%ecx
+ 5af:	ba b8 05 00 00       	mov    $0x5b8,%edx
+ 5b4:	0f 34                	sysenter
+ 5b6:	cd 40                	int    $0x40
+ 5b8:	c3                   	ret
+
+000005b9 <getpid>:
+SYSCALL(getpid)
+ 5b9:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5be:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5c5:	00 00 00 
+ 5c8:	74 09                	je     5d3 <getpid+0x1a>
+ 5ca:	89 e1                	mov    %esp,%ecx
+ 5cc:	ba d5 05 00 00       	mov    $0x5d5,%edx
+ 5d1:	0f 34                	sysenter
+ 5d3:	cd 40                	int    $0x40
+ 5d5:	c3                   	ret
+
+000005d6 <sbrk>:
+SYSCALL(sbrk)
+ 5d6:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5db:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5e2:	00 00 00 
+ 5e5:	74 09                	je     5f0 <sbrk+0x1a>
+ 5e7:	89 e1                	mov    %esp,%ecx
+ 5e9:	ba f2 05 00 00       	mov    $0x5f2,%edx
+ 5ee:	0f 34                	sysenter
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <sleep>:
+SYSCALL(sleep)
+ 5f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5f8:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5ff:	00 00 00 
+ 602:	74 09                	je     60d <sleep+0x1a>
+ 604:	89 e1                	mov    %esp,%ecx
+ 606:	ba 0f 06 00 00       	mov    $0x60f,%edx
+ 60b:	0f 34                	sysenter
+ 60d:	cd 40                	int    $0x40
+ 60f:	c3                   	ret
+
+00000610 <uptime>:
+SYSCALL(uptime)
+ 610:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 615:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 61c:	00 00 00 
+ 61f:	74 09                	je     62a <uptime+0x1a>
+ 621:	89 e1                	mov    %esp,%ecx
+ 623:	ba 2c 06 00 00       	mov    $0x62c,%edx
+ 628:	0f 34                	sysenter
+ 62a:	cd 40                	int    $0x40
+ 62c:	c3                   	ret
+
+0000062d <swapread>:
+SYSCALL(swapread)
+ 62d:	b8 16 00 00 00       	mov    $0x16,%eax
+ 632:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 639:	00 00 00 
+ 63c:	74 09                	je     647 <swapread+0x1a>
+ 63e:	89 e1                	mov    %esp,%ecx
+ 640:	ba 49 06 00 00       	mov    $0x649,%edx
+ 645:	0f 34                	sysenter
+ 647:	cd 40                	int    $0x40
+ 649:	c3                   	ret
+
+0000064a <swapwrite>:
+SYSCALL(swapwrite)
+ 64a:	b8 17 00 00 00       	mov    $0x17,%eax
+ 64f:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 656:	00 00 00 
+ 659:	74 09                	je     664 <swapwrite+0x1a>
+ 65b:	89 e1                	mov    %esp,%ecx
+ 65d:	ba 66 06 00 00       	mov    $0x666,%edx
+ 662:	0f 34                	sysenter
+ 664:	cd 40                	int    $0x40
+ 666:	c3                   	ret
+
+00000667 <setaffinity>:
+SYSCALL(setaffinity)
+ 667:	b8 18 00 00 00       	mov    $0x18,%eax
+ 66c:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 673:	00 00 00 
+ 676:	74 09                	je     681 <setaffinity+0x1a>
+ 678:	89 e1                	mov    %esp,%ecx
+ 67a:	ba 83 06 00 00       	mov    $0x683,%edx
+ 67f:	0f 34                	sysenter
+ 681:	cd 40                	int    $0x40
+ 683:	c3                   	ret
+
+00000684 <getaffinity>:
+SYSCALL(getaffinity)
+ 684:	b8 19 00 00 00       	mov    $0x19,%eax
+ 689:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 690:	00 00 00 
+ 693:	74 09                	je     69e <getaffinity+0x1a>
+ 695:	89 e1                	mov    %esp,%ecx
+ 697:	ba a0 06 00 00       	mov    $0x6a0,%edx
+ 69c:	0f 34                	sysenter
+ 69e:	cd 40                	int    $0x40
+ 6a0:	c3                   	ret
+
+000006a1 <nanosleep>:
+SYSCALL(nanosleep)
+ 6a1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6a6:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6ad:	00 00 00 
+ 6b0:	74 09                	je     6bb <nanosleep+0x1a>
+ 6b2:	89 e1                	mov    %esp,%ecx
+ 6b4:	ba bd 06 00 00       	mov    $0x6bd,%edx
+ 6b9:	0f 34                	sysenter
+ 6bb:	cd 40                	int    $0x40
+ 6bd:	c3                   	ret
+
+000006be <clocktime>:
+SYSCALL(clocktime)
+ 6be:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6c3:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6ca:	00 00 00 
+ 6cd:	74 09                	je     6d8 <clocktime+0x1a>
+ 6cf:	89 e1                	mov    %esp,%ecx
+ 6d1:	ba da 06 00 00       	mov    $0x6da,%edx
+ 6d6:	0f 34                	sysenter
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <batch>:
+SYSCALL(batch)
+ 6db:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6e0:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6e7:	00 00 00 
+ 6ea:	74 09                	je     6f5 <batch+0x1a>
+ 6ec:	89 e1                	mov    %esp,%ecx
+ 6ee:	ba f7 06 00 00       	mov    $0x6f7,%edx
+ 6f3:	0f 34                	sysenter
+ 6f5:	cd 40                	int    $0x40
+ 6f7:	c3                   	ret
+
+000006f8 <aiosetup>:
+SYSCALL(aiosetup)
+ 6f8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6fd:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 704:	00 00 00 
+ 707:	74 09                	je     712 <aiosetup+0x1a>
+ 709:	89 e1                	mov    %esp,%ecx
+ 70b:	ba 14 07 00 00       	mov    $0x714,%edx
+ 710:	0f 34                	sysenter
+ 712:	cd 40                	int    $0x40
+ 714:	c3                   	ret
+
+00000715 <aiowait>:
+SYSCALL(aiowait)
+ 715:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 71a:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 721:	00 00 00 
+ 724:	74 09                	je     72f <aiowait+0x1a>
+ 726:	89 e1                	mov    %esp,%ecx
+ 728:	ba 31 07 00 00       	mov    $0x731,%edx
+ 72d:	0f 34                	sysenter
+ 72f:	cd 40                	int    $0x40
+ 731:	c3                   	ret
+
+00000732 <spawn>:
+SYSCALL(spawn)
+ 732:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 737:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 73e:	00 00 00 
+ 741:	74 09                	je     74c <spawn+0x1a>
+ 743:	89 e1                	mov    %esp,%ecx
+ 745:	ba 4e 07 00 00       	mov    $0x74e,%edx
+ 74a:	0f 34                	sysenter
+ 74c:	cd 40                	int    $0x40
+ 74e:	c3                   	ret
+
+0000074f <getprocinfo>:
+SYSCALL(getprocinfo)
+ 74f:	b8 20 00 00 00       	mov    $0x20,%eax
+ 754:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 75b:	00 00 00 
+ 75e:	74 09                	je     769 <getprocinfo+0x1a>
+ 760:	89 e1                	mov    %esp,%ecx
+ 762:	ba 6b 07 00 00       	mov    $0x76b,%edx
+ 767:	0f 34                	sysenter
+ 769:	cd 40                	int    $0x40
+ 76b:	c3                   	ret
+
+0000076c <getlockstat>:
+SYSCALL(getlockstat)
+ 76c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 771:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 778:	00 00 00 
+ 77b:	74 09                	je     786 <getlockstat+0x1a>
+ 77d:	89 e1                	mov    %esp,%ecx
+ 77f:	ba 88 07 00 00       	mov    $0x788,%edx
+ 784:	0f 34                	sysenter
+ 786:	cd 40                	int    $0x40
+ 788:	c3                   	ret
+
+00000789 <lockprof>:
+SYSCALL(lockprof)
+ 789:	b8 22 00 00 00       	mov    $0x22,%eax
+ 78e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 795:	00 00 00 
+ 798:	74 09                	je     7a3 <lockprof+0x1a>
+ 79a:	89 e1                	mov    %esp,%ecx
+ 79c:	ba a5 07 00 00       	mov    $0x7a5,%edx
+ 7a1:	0f 34                	sysenter
+ 7a3:	cd 40                	int    $0x40
+ 7a5:	c3                   	ret
+
+000007a6 <getlockprof>:
+SYSCALL(getlockprof)
+ 7a6:	b8 23 00 00 00       	mov    $0x23,%eax
+ 7ab:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 7b2:	00 00 00 
+ 7b5:	74 09                	je     7c0 <getlockprof+0x1a>
+ 7b7:	89 e1                	mov    %esp,%ecx
+ 7b9:	ba c2 07 00 00       	mov    $0x7c2,%edx
+ 7be:	0f 34                	sysenter
+ 7c0:	cd 40                	int    $0x40
+ 7c2:	c3                   	ret
+
+000007c3 <diskstat>:
+SYSCALL(diskstat)
+ 7c3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 7c8:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 7cf:	00 00 00 
+ 7d2:	74 09                	je     7dd <diskstat+0x1a>
+ 7d4:	89 e1                	mov    %esp,%ecx
+ 7d6:	ba df 07 00 00       	mov    $0x7df,%edx
+ 7db:	0f 34                	sysenter
+ 7dd:	cd 40                	int    $0x40
+ 7df:	c3                   	ret
+
+000007e0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 7e0:	55                   	push   %ebp
+ 7e1:	89 e5                	mov    %esp,%ebp
+ 7e3:	57                   	push   %edi
+ 7e4:	56                   	push   %esi
+ 7e5:	53                   	push   %ebx
+ 7e6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 7e8:	89 d1                	mov    %edx,%ecx
+{
+ 7ea:	83 ec 3c             	sub    $0x3c,%esp
+ 7ed:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 7f0:	85 d2                	test   %edx,%edx
+ 7f2:	0f 89 80 00 00 00    	jns    878 <printint+0x98>
+ 7f8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 7fc:	74 7a                	je     878 <printint+0x98>
+    x = -xx;
+ 7fe:	f7 d9                	neg    %ecx
+    neg = 1;
+ 800:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 805:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 808:	31 f6                	xor    %esi,%esi
+ 80a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 810:	89 c8                	mov    %ecx,%eax
+ 812:	31 d2                	xor    %edx,%edx
+ 814:	89 f7                	mov    %esi,%edi
+ 816:	f7 f3                	div    %ebx
+ 818:	8d 76 01             	lea    0x1(%esi),%esi
+ 81b:	0f b6 92 58 0c 00 00 	movzbl 0xc58(%edx),%edx
+ 822:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 826:	89 ca                	mov    %ecx,%edx
+ 828:	89 c1                	mov    %eax,%ecx
+ 82a:	39 da                	cmp    %ebx,%edx
+ 82c:	73 e2                	jae    810 <printint+0x30>
+  if(neg)
+ 82e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 831:	85 c0                	test   %eax,%eax
+ 833:	74 07                	je     83c <printint+0x5c>
+    buf[i++] = '-';
+ 835:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 83a:	89 f7                	mov    %esi,%edi
+ 83c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 83f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 842:	01 df                	add    %ebx,%edi
+ 844:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 848:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 84b:	83 ec 04             	sub    $0x4,%esp
+ 84e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 851:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 854:	6a 01                	push   $0x1
+ 856:	50                   	push   %eax
+ 857:	56                   	push   %esi
+ 858:	e8 00 fc ff ff       	call   45d <write>
+  while(--i >= 0)
+ 85d:	89 f8                	mov    %edi,%eax
+ 85f:	83 c4 10             	add    $0x10,%esp
+ 862:	83 ef 01             	sub    $0x1,%edi
+ 865:	39 d8                	cmp    %ebx,%eax
+ 867:	75 df                	jne    848 <printint+0x68>
+}
+ 869:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 86c:	5b                   	pop    %ebx
+ 86d:	5e                   	pop    %esi
+ 86e:	5f                   	pop    %edi
+ 86f:	5d                   	pop    %ebp
+ 870:	c3                   	ret
+ 871:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 878:	31 c0                	xor    %eax,%eax
+ 87a:	eb 89                	jmp    805 <printint+0x25>
+ 87c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000880 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 880:	55                   	push   %ebp
+ 881:	89 e5                	mov    %esp,%ebp
+ 883:	57                   	push   %edi
+ 884:	56                   	push   %esi
+ 885:	53                   	push   %ebx
+ 886:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 889:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 88c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 88f:	0f b6 1e             	movzbl (%esi),%ebx
+ 892:	83 c6 01             	add    $0x1,%esi
+ 895:	84 db                	test   %bl,%bl
+ 897:	74 67                	je     900 <printf+0x80>
+ 899:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 89c:	31 d2                	xor    %edx,%edx
+ 89e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 8a1:	eb 34                	jmp    8d7 <printf+0x57>
+ 8a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8a7:	90                   	nop
+ 8a8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 8ab:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 8b0:	83 f8 25             	cmp    $0x25,%eax
+ 8b3:	74 18                	je     8cd <printf+0x4d>
+  write(fd, &c, 1);
+ 8b5:	83 ec 04             	sub    $0x4,%esp
+ 8b8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 8bb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8be:	6a 01                	push   $0x1
+ 8c0:	50                   	push   %eax
+ 8c1:	57                   	push   %edi
+ 8c2:	e8 96 fb ff ff       	call   45d <write>
+ 8c7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 8ca:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 8cd:	0f b6 1e             	movzbl (%esi),%ebx
+ 8d0:	83 c6 01             	add    $0x1,%esi
+ 8d3:	84 db                	test   %bl,%bl
+ 8d5:	74 29                	je     900 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 8d7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 8da:	85 d2                	test   %edx,%edx
+ 8dc:	74 ca                	je     8a8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 8de:	83 fa 25             	cmp    $0x25,%edx
+ 8e1:	75 ea                	jne    8cd <printf+0x4d>
+      if(c == 'd'){
+ 8e3:	83 f8 25             	cmp    $0x25,%eax
+ 8e6:	0f 84 24 01 00 00    	je     a10 <printf+0x190>
+ 8ec:	83 e8 63             	sub    $0x63,%eax
+ 8ef:	83 f8 15             	cmp    $0x15,%eax
+ 8f2:	77 1c                	ja     910 <printf+0x90>
+ 8f4:	ff 24 85 00 0c 00 00 	jmp    *0xc00(,%eax,4)
+ 8fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8ff:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 900:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 903:	5b                   	pop    %ebx
+ 904:	5e                   	pop    %esi
+ 905:	5f                   	pop    %edi
+ 906:	5d                   	pop    %ebp
+ 907:	c3                   	ret
+ 908:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90f:	90                   	nop
+  write(fd, &c, 1);
+ 910:	83 ec 04             	sub    $0x4,%esp
+ 913:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 916:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 91a:	6a 01                	push   $0x1
+ 91c:	52                   	push   %edx
+ 91d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 920:	57                   	push   %edi
+ 921:	e8 37 fb ff ff       	call   45d <write>
+ 926:	83 c4 0c             	add    $0xc,%esp
+ 929:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 92c:	6a 01                	push   $0x1
+ 92e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 931:	52                   	push   %edx
+ 932:	57                   	push   %edi
+ 933:	e8 25 fb ff ff       	call   45d <write>
+        putc(fd, c);
+ 938:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 93b:	31 d2                	xor    %edx,%edx
+ 93d:	eb 8e                	jmp    8cd <printf+0x4d>
+ 93f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 940:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 943:	83 ec 0c             	sub    $0xc,%esp
+ 946:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 94b:	8b 13                	mov    (%ebx),%edx
+ 94d:	6a 00                	push   $0x0
+ 94f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 951:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 954:	e8 87 fe ff ff       	call   7e0 <printint>
+        ap++;
+ 959:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 95c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 95f:	31 d2                	xor    %edx,%edx
+ 961:	e9 67 ff ff ff       	jmp    8cd <printf+0x4d>
+ 966:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 96d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 970:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 973:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 975:	83 c0 04             	add    $0x4,%eax
+ 978:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 97b:	85 db                	test   %ebx,%ebx
+ 97d:	0f 84 9d 00 00 00    	je     a20 <printf+0x1a0>
+        while(*s != 0){
+ 983:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 986:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 988:	84 c0                	test   %al,%al
+ 98a:	0f 84 3d ff ff ff    	je     8cd <printf+0x4d>
+ 990:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 993:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 996:	89 de                	mov    %ebx,%esi
+ 998:	89 d3                	mov    %edx,%ebx
+ 99a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 9a0:	83 ec 04             	sub    $0x4,%esp
+ 9a3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 9a6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 9a9:	6a 01                	push   $0x1
+ 9ab:	53                   	push   %ebx
+ 9ac:	57                   	push   %edi
+ 9ad:	e8 ab fa ff ff       	call   45d <write>
+        while(*s != 0){
+ 9b2:	0f b6 06             	movzbl (%esi),%eax
+ 9b5:	83 c4 10             	add    $0x10,%esp
+ 9b8:	84 c0                	test   %al,%al
+ 9ba:	75 e4                	jne    9a0 <printf+0x120>
+      state = 0;
+ 9bc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 9bf:	31 d2                	xor    %edx,%edx
+ 9c1:	e9 07 ff ff ff       	jmp    8cd <printf+0x4d>
+ 9c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9cd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 9d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 9d3:	83 ec 0c             	sub    $0xc,%esp
+ 9d6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 9db:	8b 13                	mov    (%ebx),%edx
+ 9dd:	6a 01                	push   $0x1
+ 9df:	e9 6b ff ff ff       	jmp    94f <printf+0xcf>
+ 9e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 9e8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 9eb:	83 ec 04             	sub    $0x4,%esp
+ 9ee:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 9f1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 9f3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 9f6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 9f9:	6a 01                	push   $0x1
+ 9fb:	52                   	push   %edx
+ 9fc:	57                   	push   %edi
+ 9fd:	e8 5b fa ff ff       	call   45d <write>
+        ap++;
+ a02:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a05:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a08:	31 d2                	xor    %edx,%edx
+ a0a:	e9 be fe ff ff       	jmp    8cd <printf+0x4d>
+ a0f:	90                   	nop
+  write(fd, &c, 1);
+ a10:	83 ec 04             	sub    $0x4,%esp
+ a13:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a16:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a19:	6a 01                	push   $0x1
+ a1b:	e9 11 ff ff ff       	jmp    931 <printf+0xb1>
+ a20:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ a25:	bb f8 0b 00 00       	mov    $0xbf8,%ebx
+ a2a:	e9 61 ff ff ff       	jmp    990 <printf+0x110>
+ a2f:	90                   	nop
+
+00000a30 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ a30:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a31:	a1 50 0f 00 00       	mov    0xf50,%eax
+{
+ a36:	89 e5                	mov    %esp,%ebp
+ a38:	57                   	push   %edi
+ a39:	56                   	push   %esi
+ a3a:	53                   	push   %ebx
+ a3b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ a3e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a48:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a4a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a4c:	39 ca                	cmp    %ecx,%edx
+ a4e:	73 30                	jae    a80 <free+0x50>
+ a50:	39 c1                	cmp    %eax,%ecx
+ a52:	72 04                	jb     a58 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a54:	39 c2                	cmp    %eax,%edx
+ a56:	72 f0                	jb     a48 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a58:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ a5b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ a5e:	39 f8                	cmp    %edi,%eax
+ a60:	74 2e                	je     a90 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a62:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a65:	8b 42 04             	mov    0x4(%edx),%eax
+ a68:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a6b:	39 f1                	cmp    %esi,%ecx
+ a6d:	74 38                	je     aa7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a6f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a71:	5b                   	pop    %ebx
+  freep = p;
+ a72:	89 15 50 0f 00 00    	mov    %edx,0xf50
+}
+ a78:	5e                   	pop    %esi
+ a79:	5f                   	pop    %edi
+ a7a:	5d                   	pop    %ebp
+ a7b:	c3                   	ret
+ a7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a80:	39 c1                	cmp    %eax,%ecx
+ a82:	72 d0                	jb     a54 <free+0x24>
+ a84:	eb c2                	jmp    a48 <free+0x18>
+ a86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a8d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ a90:	03 70 04             	add    0x4(%eax),%esi
+ a93:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a96:	8b 02                	mov    (%edx),%eax
+ a98:	8b 00                	mov    (%eax),%eax
+ a9a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ a9d:	8b 42 04             	mov    0x4(%edx),%eax
+ aa0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ aa3:	39 f1                	cmp    %esi,%ecx
+ aa5:	75 c8                	jne    a6f <free+0x3f>
+    p->s.size += bp->s.size;
+ aa7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ aaa:	89 15 50 0f 00 00    	mov    %edx,0xf50
+    p->s.size += bp->s.size;
+ ab0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ ab3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ ab6:	89 0a                	mov    %ecx,(%edx)
+}
+ ab8:	5b                   	pop    %ebx
+ ab9:	5e                   	pop    %esi
+ aba:	5f                   	pop    %edi
+ abb:	5d                   	pop    %ebp
+ abc:	c3                   	ret
+ abd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ac0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ ac0:	55                   	push   %ebp
+ ac1:	89 e5                	mov    %esp,%ebp
+ ac3:	57                   	push   %edi
+ ac4:	56                   	push   %esi
+ ac5:	53                   	push   %ebx
+ ac6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ac9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ acc:	8b 15 50 0f 00 00    	mov    0xf50,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ad2:	8d 78 07             	lea    0x7(%eax),%edi
+ ad5:	c1 ef 03             	shr    $0x3,%edi
+ ad8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ adb:	85 d2                	test   %edx,%edx
+ add:	0f 84 8d 00 00 00    	je     b70 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ae3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ae5:	8b 48 04             	mov    0x4(%eax),%ecx
+ ae8:	39 f9                	cmp    %edi,%ecx
+ aea:	73 64                	jae    b50 <malloc+0x90>
+  if(nu < 4096)
+ aec:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ af1:	39 df                	cmp    %ebx,%edi
+ af3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ af6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ afd:	eb 0a                	jmp    b09 <malloc+0x49>
+ aff:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b00:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b02:	8b 48 04             	mov    0x4(%eax),%ecx
+ b05:	39 f9                	cmp    %edi,%ecx
+ b07:	73 47                	jae    b50 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ b09:	89 c2                	mov    %eax,%edx
+ b0b:	39 05 50 0f 00 00    	cmp    %eax,0xf50
+ b11:	75 ed                	jne    b00 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ b13:	83 ec 0c             	sub    $0xc,%esp
+ b16:	56                   	push   %esi
+ b17:	e8 ba fa ff ff       	call   5d6 <sbrk>
+  if(p == (char*)-1)
+ b1c:	83 c4 10             	add    $0x10,%esp
+ b1f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b22:	74 1c                	je     b40 <malloc+0x80>
+  hp->s.size = nu;
+ b24:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ b27:	83 ec 0c             	sub    $0xc,%esp
+ b2a:	83 c0 08             	add    $0x8,%eax
+ b2d:	50                   	push   %eax
+ b2e:	e8 fd fe ff ff       	call   a30 <free>
+  return freep;
+ b33:	8b 15 50 0f 00 00    	mov    0xf50,%edx
+      if((p = morecore(nunits)) == 0)
+ b39:	83 c4 10             	add    $0x10,%esp
+ b3c:	85 d2                	test   %edx,%edx
+ b3e:	75 c0                	jne    b00 <malloc+0x40>
+        return 0;
+  }
+}
+ b40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b43:	31 c0                	xor    %eax,%eax
+}
+ b45:	5b                   	pop    %ebx
+ b46:	5e                   	pop    %esi
+ b47:	5f                   	pop    %edi
+ b48:	5d                   	pop    %ebp
+ b49:	c3                   	ret
+ b4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ b50:	39 cf                	cmp    %ecx,%edi
+ b52:	74 4c                	je     ba0 <malloc+0xe0>
+        p->s.size -= nunits;
+ b54:	29 f9                	sub    %edi,%ecx
+ b56:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ b59:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ b5c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ b5f:	89 15 50 0f 00 00    	mov    %edx,0xf50
+}
+ b65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ b68:	83 c0 08             	add    $0x8,%eax
+}
+ b6b:	5b                   	pop    %ebx
+ b6c:	5e                   	pop    %esi
+ b6d:	5f                   	pop    %edi
+ b6e:	5d                   	pop    %ebp
+ b6f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ b70:	c7 05 50 0f 00 00 54 	movl   $0xf54,0xf50
+ b77:	0f 00 00 
+    base.s.size = 0;
+ b7a:	b8 54 0f 00 00       	mov    $0xf54,%eax
+    base.s.ptr = freep = prevp = &base;
+ b7f:	c7 05 54 0f 00 00 54 	movl   $0xf54,0xf54
+ b86:	0f 00 00 
+    base.s.size = 0;
+ b89:	c7 05 58 0f 00 00 00 	movl   $0x0,0xf58
+ b90:	00 00 00 
+    if(p->s.size >= nunits){
+ b93:	e9 54 ff ff ff       	jmp    aec <malloc+0x2c>
+ b98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b9f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ ba0:	8b 08                	mov    (%eax),%ecx
+ ba2:	89 0a                	mov    %ecx,(%edx)
+ ba4:	eb b9                	jmp    b5f <malloc+0x9f>
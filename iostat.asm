@@ -0,0 +1,1706 @@
+
+_iostat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+struct diskstat old, cur;
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  int i, pid, top;
+  uint n;
+
+  if(argc > 1){
+  14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  17:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc > 1){
+  1a:	7e 49                	jle    65 <main+0x65>
+    diskstat(&old);
+  1c:	83 ec 0c             	sub    $0xc,%esp
+  1f:	68 40 11 00 00       	push   $0x1140
+  24:	e8 9a 08 00 00       	call   8c3 <diskstat>
+    pid = fork();
+  29:	e8 9e 04 00 00       	call   4cc <fork>
+    if(pid < 0){
+  2e:	83 c4 10             	add    $0x10,%esp
+  31:	85 c0                	test   %eax,%eax
+  33:	0f 88 9f 01 00 00    	js     1d8 <main+0x1d8>
+      printf(2, "iostat: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+  39:	75 25                	jne    60 <main+0x60>
+      exec(argv[1], argv+1);
+  3b:	8d 43 04             	lea    0x4(%ebx),%eax
+  3e:	51                   	push   %ecx
+  3f:	51                   	push   %ecx
+  40:	50                   	push   %eax
+  41:	ff 73 04             	push   0x4(%ebx)
+  44:	e8 6b 05 00 00       	call   5b4 <exec>
+      printf(2, "iostat: exec %s failed\n", argv[1]);
+  49:	83 c4 0c             	add    $0xc,%esp
+  4c:	ff 73 04             	push   0x4(%ebx)
+  4f:	68 bd 0c 00 00       	push   $0xcbd
+  54:	6a 02                	push   $0x2
+  56:	e8 25 09 00 00       	call   980 <printf>
+      exit();
+  5b:	e8 89 04 00 00       	call   4e9 <exit>
+    }
+    wait();
+  60:	e8 a1 04 00 00       	call   506 <wait>
+  }
+  diskstat(&cur);
+  65:	83 ec 0c             	sub    $0xc,%esp
+  68:	68 c0 10 00 00       	push   $0x10c0
+  6d:	e8 51 08 00 00       	call   8c3 <diskstat>
+
+  // maxlatency is since boot either way.
+  cur.nread -= old.nread;
+  72:	8b 0d c0 10 00 00    	mov    0x10c0,%ecx
+  cur.nwrite -= old.nwrite;
+  cur.ncmd -= old.ncmd;
+  cur.latency -= old.latency;
+  78:	83 c4 10             	add    $0x10,%esp
+  cur.nwrite -= old.nwrite;
+  7b:	8b 1d c4 10 00 00    	mov    0x10c4,%ebx
+  cur.ncmd -= old.ncmd;
+  81:	8b 35 c8 10 00 00    	mov    0x10c8,%esi
+  cur.nread -= old.nread;
+  87:	2b 0d 40 11 00 00    	sub    0x1140,%ecx
+  cur.nwrite -= old.nwrite;
+  8d:	2b 1d 44 11 00 00    	sub    0x1144,%ebx
+  cur.ncmd -= old.ncmd;
+  93:	2b 35 48 11 00 00    	sub    0x1148,%esi
+  cur.nread -= old.nread;
+  99:	89 0d c0 10 00 00    	mov    %ecx,0x10c0
+  cur.nwrite -= old.nwrite;
+  9f:	89 1d c4 10 00 00    	mov    %ebx,0x10c4
+  cur.latency -= old.latency;
+  a5:	a1 cc 10 00 00       	mov    0x10cc,%eax
+  cur.ncmd -= old.ncmd;
+  aa:	89 35 c8 10 00 00    	mov    %esi,0x10c8
+  cur.latency -= old.latency;
+  b0:	2b 05 4c 11 00 00    	sub    0x114c,%eax
+  b6:	a3 cc 10 00 00       	mov    %eax,0x10cc
+  for(i = 0; i < NDISKHIST; i++)
+  bb:	31 c0                	xor    %eax,%eax
+  bd:	8d 76 00             	lea    0x0(%esi),%esi
+    cur.hist[i] -= old.hist[i];
+  c0:	8b 14 85 d4 10 00 00 	mov    0x10d4(,%eax,4),%edx
+  c7:	2b 14 85 54 11 00 00 	sub    0x1154(,%eax,4),%edx
+  ce:	89 14 85 d4 10 00 00 	mov    %edx,0x10d4(,%eax,4)
+  for(i = 0; i < NDISKHIST; i++)
+  d5:	83 c0 01             	add    $0x1,%eax
+  d8:	83 f8 18             	cmp    $0x18,%eax
+  db:	75 e3                	jne    c0 <main+0xc0>
+  cur.nhit -= old.nhit;
+  cur.nmiss -= old.nmiss;
+
+  n = cur.nread + cur.nwrite;
+  printf(1, "reads %d writes %d commands %d\n", cur.nread, cur.nwrite, cur.ncmd);
+  dd:	83 ec 0c             	sub    $0xc,%esp
+  cur.nhit -= old.nhit;
+  e0:	a1 34 11 00 00       	mov    0x1134,%eax
+  e5:	2b 05 b4 11 00 00    	sub    0x11b4,%eax
+  n = cur.nread + cur.nwrite;
+  eb:	8d 3c 19             	lea    (%ecx,%ebx,1),%edi
+  printf(1, "reads %d writes %d commands %d\n", cur.nread, cur.nwrite, cur.ncmd);
+  ee:	56                   	push   %esi
+  ef:	53                   	push   %ebx
+  f0:	51                   	push   %ecx
+  f1:	68 04 0d 00 00       	push   $0xd04
+  f6:	6a 01                	push   $0x1
+  cur.nhit -= old.nhit;
+  f8:	a3 34 11 00 00       	mov    %eax,0x1134
+  cur.nmiss -= old.nmiss;
+  fd:	a1 38 11 00 00       	mov    0x1138,%eax
+ 102:	2b 05 b8 11 00 00    	sub    0x11b8,%eax
+ 108:	a3 38 11 00 00       	mov    %eax,0x1138
+  printf(1, "reads %d writes %d commands %d\n", cur.nread, cur.nwrite, cur.ncmd);
+ 10d:	e8 6e 08 00 00       	call   980 <printf>
+  printf(1, "latency avg %d us, max %d us\n", n ? cur.latency / n : 0, cur.maxlatency);
+ 112:	8b 0d d0 10 00 00    	mov    0x10d0,%ecx
+ 118:	83 c4 20             	add    $0x20,%esp
+ 11b:	85 ff                	test   %edi,%edi
+ 11d:	0f 85 a5 00 00 00    	jne    1c8 <main+0x1c8>
+ 123:	51                   	push   %ecx
+ 124:	57                   	push   %edi
+ 125:	68 d5 0c 00 00       	push   $0xcd5
+ 12a:	6a 01                	push   $0x1
+ 12c:	e8 4f 08 00 00       	call   980 <printf>
+ 131:	83 c4 10             	add    $0x10,%esp
+  for(top = NDISKHIST-1; top > 0 && cur.hist[top] == 0; top--)
+ 134:	b8 17 00 00 00       	mov    $0x17,%eax
+ 139:	eb 0a                	jmp    145 <main+0x145>
+ 13b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 13f:	90                   	nop
+ 140:	83 e8 01             	sub    $0x1,%eax
+ 143:	74 0b                	je     150 <main+0x150>
+ 145:	8b 14 85 d4 10 00 00 	mov    0x10d4(,%eax,4),%edx
+ 14c:	85 d2                	test   %edx,%edx
+ 14e:	74 f0                	je     140 <main+0x140>
+    ;
+  for(i = 0; i <= top; i++)
+ 150:	8d 58 01             	lea    0x1(%eax),%ebx
+    printf(1, "  >= %d us: %d\n", i ? 1 << i : 0, cur.hist[i]);
+ 153:	8b 15 d4 10 00 00    	mov    0x10d4,%edx
+ 159:	31 f6                	xor    %esi,%esi
+ 15b:	31 c0                	xor    %eax,%eax
+ 15d:	bf 01 00 00 00       	mov    $0x1,%edi
+ 162:	eb 11                	jmp    175 <main+0x175>
+ 164:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 168:	89 f8                	mov    %edi,%eax
+ 16a:	89 f1                	mov    %esi,%ecx
+ 16c:	8b 14 b5 d4 10 00 00 	mov    0x10d4(,%esi,4),%edx
+ 173:	d3 e0                	shl    %cl,%eax
+ 175:	52                   	push   %edx
+  for(i = 0; i <= top; i++)
+ 176:	83 c6 01             	add    $0x1,%esi
+    printf(1, "  >= %d us: %d\n", i ? 1 << i : 0, cur.hist[i]);
+ 179:	50                   	push   %eax
+ 17a:	68 f3 0c 00 00       	push   $0xcf3
+ 17f:	6a 01                	push   $0x1
+ 181:	e8 fa 07 00 00       	call   980 <printf>
+  for(i = 0; i <= top; i++)
+ 186:	83 c4 10             	add    $0x10,%esp
+ 189:	39 de                	cmp    %ebx,%esi
+ 18b:	75 db                	jne    168 <main+0x168>
+  n = cur.nhit + cur.nmiss;
+ 18d:	8b 0d 34 11 00 00    	mov    0x1134,%ecx
+ 193:	8b 1d 38 11 00 00    	mov    0x1138,%ebx
+  printf(1, "cache hits %d misses %d (%d%%), %d buffers\n",
+ 199:	8b 3d 3c 11 00 00    	mov    0x113c,%edi
+ 19f:	89 ce                	mov    %ecx,%esi
+ 1a1:	01 de                	add    %ebx,%esi
+ 1a3:	74 09                	je     1ae <main+0x1ae>
+    cur.nhit, cur.nmiss, n ? cur.nhit * 100 / n : 0, cur.nbuf);
+ 1a5:	6b c1 64             	imul   $0x64,%ecx,%eax
+  printf(1, "cache hits %d misses %d (%d%%), %d buffers\n",
+ 1a8:	31 d2                	xor    %edx,%edx
+ 1aa:	f7 f6                	div    %esi
+ 1ac:	89 c6                	mov    %eax,%esi
+ 1ae:	50                   	push   %eax
+ 1af:	50                   	push   %eax
+ 1b0:	57                   	push   %edi
+ 1b1:	56                   	push   %esi
+ 1b2:	53                   	push   %ebx
+ 1b3:	51                   	push   %ecx
+ 1b4:	68 24 0d 00 00       	push   $0xd24
+ 1b9:	6a 01                	push   $0x1
+ 1bb:	e8 c0 07 00 00       	call   980 <printf>
+  exit();
+ 1c0:	83 c4 20             	add    $0x20,%esp
+ 1c3:	e8 21 03 00 00       	call   4e9 <exit>
+  printf(1, "latency avg %d us, max %d us\n", n ? cur.latency / n : 0, cur.maxlatency);
+ 1c8:	a1 cc 10 00 00       	mov    0x10cc,%eax
+ 1cd:	31 d2                	xor    %edx,%edx
+ 1cf:	f7 f7                	div    %edi
+ 1d1:	89 c7                	mov    %eax,%edi
+ 1d3:	e9 4b ff ff ff       	jmp    123 <main+0x123>
+      printf(2, "iostat: fork failed\n");
+ 1d8:	53                   	push   %ebx
+ 1d9:	53                   	push   %ebx
+ 1da:	68 a8 0c 00 00       	push   $0xca8
+ 1df:	6a 02                	push   $0x2
+ 1e1:	e8 9a 07 00 00       	call   980 <printf>
+      exit();
+ 1e6:	e8 fe 02 00 00       	call   4e9 <exit>
+ 1eb:	66 90                	xchg   %ax,%ax
+ 1ed:	66 90                	xchg   %ax,%ax
+ 1ef:	90                   	nop
+
+000001f0 <strcpy>:
+#include "date.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1f1:	31 c0                	xor    %eax,%eax
+{
+ 1f3:	89 e5                	mov    %esp,%ebp
+ 1f5:	53                   	push   %ebx
+ 1f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 200:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 204:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 207:	83 c0 01             	add    $0x1,%eax
+ 20a:	84 d2                	test   %dl,%dl
+ 20c:	75 f2                	jne    200 <strcpy+0x10>
+    ;
+  return os;
+}
+ 20e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 211:	89 c8                	mov    %ecx,%eax
+ 213:	c9                   	leave
+ 214:	c3                   	ret
+ 215:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000220 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	53                   	push   %ebx
+ 224:	8b 55 08             	mov    0x8(%ebp),%edx
+ 227:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 22a:	0f b6 02             	movzbl (%edx),%eax
+ 22d:	84 c0                	test   %al,%al
+ 22f:	75 17                	jne    248 <strcmp+0x28>
+ 231:	eb 3a                	jmp    26d <strcmp+0x4d>
+ 233:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 237:	90                   	nop
+ 238:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 23c:	83 c2 01             	add    $0x1,%edx
+ 23f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 242:	84 c0                	test   %al,%al
+ 244:	74 1a                	je     260 <strcmp+0x40>
+    p++, q++;
+ 246:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 248:	0f b6 19             	movzbl (%ecx),%ebx
+ 24b:	38 c3                	cmp    %al,%bl
+ 24d:	74 e9                	je     238 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 24f:	29 d8                	sub    %ebx,%eax
+}
+ 251:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 254:	c9                   	leave
+ 255:	c3                   	ret
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 260:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 264:	31 c0                	xor    %eax,%eax
+ 266:	29 d8                	sub    %ebx,%eax
+}
+ 268:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 26b:	c9                   	leave
+ 26c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 26d:	0f b6 19             	movzbl (%ecx),%ebx
+ 270:	31 c0                	xor    %eax,%eax
+ 272:	eb db                	jmp    24f <strcmp+0x2f>
+ 274:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 27f:	90                   	nop
+
+00000280 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 286:	80 3a 00             	cmpb   $0x0,(%edx)
+ 289:	74 15                	je     2a0 <strlen+0x20>
+ 28b:	31 c0                	xor    %eax,%eax
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+ 290:	83 c0 01             	add    $0x1,%eax
+ 293:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 297:	89 c1                	mov    %eax,%ecx
+ 299:	75 f5                	jne    290 <strlen+0x10>
+    ;
+  return n;
+}
+ 29b:	89 c8                	mov    %ecx,%eax
+ 29d:	5d                   	pop    %ebp
+ 29e:	c3                   	ret
+ 29f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 2a0:	31 c9                	xor    %ecx,%ecx
+}
+ 2a2:	5d                   	pop    %ebp
+ 2a3:	89 c8                	mov    %ecx,%eax
+ 2a5:	c3                   	ret
+ 2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	57                   	push   %edi
+ 2b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2bd:	89 d7                	mov    %edx,%edi
+ 2bf:	fc                   	cld
+ 2c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2c5:	89 d0                	mov    %edx,%eax
+ 2c7:	c9                   	leave
+ 2c8:	c3                   	ret
+ 2c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2da:	0f b6 10             	movzbl (%eax),%edx
+ 2dd:	84 d2                	test   %dl,%dl
+ 2df:	75 12                	jne    2f3 <strchr+0x23>
+ 2e1:	eb 1d                	jmp    300 <strchr+0x30>
+ 2e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2e7:	90                   	nop
+ 2e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2ec:	83 c0 01             	add    $0x1,%eax
+ 2ef:	84 d2                	test   %dl,%dl
+ 2f1:	74 0d                	je     300 <strchr+0x30>
+    if(*s == c)
+ 2f3:	38 d1                	cmp    %dl,%cl
+ 2f5:	75 f1                	jne    2e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2f7:	5d                   	pop    %ebp
+ 2f8:	c3                   	ret
+ 2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 300:	31 c0                	xor    %eax,%eax
+}
+ 302:	5d                   	pop    %ebp
+ 303:	c3                   	ret
+ 304:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 30f:	90                   	nop
+
+00000310 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	57                   	push   %edi
+ 314:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 315:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 318:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 319:	31 db                	xor    %ebx,%ebx
+{
+ 31b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 31e:	eb 27                	jmp    347 <gets+0x37>
+    cc = read(0, &c, 1);
+ 320:	83 ec 04             	sub    $0x4,%esp
+ 323:	6a 01                	push   $0x1
+ 325:	56                   	push   %esi
+ 326:	6a 00                	push   $0x0
+ 328:	e8 13 02 00 00       	call   540 <read>
+    if(cc < 1)
+ 32d:	83 c4 10             	add    $0x10,%esp
+ 330:	85 c0                	test   %eax,%eax
+ 332:	7e 1d                	jle    351 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 334:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 338:	8b 55 08             	mov    0x8(%ebp),%edx
+ 33b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 33f:	3c 0a                	cmp    $0xa,%al
+ 341:	74 10                	je     353 <gets+0x43>
+ 343:	3c 0d                	cmp    $0xd,%al
+ 345:	74 0c                	je     353 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 347:	89 df                	mov    %ebx,%edi
+ 349:	83 c3 01             	add    $0x1,%ebx
+ 34c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 34f:	7c cf                	jl     320 <gets+0x10>
+ 351:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 353:	8b 45 08             	mov    0x8(%ebp),%eax
+ 356:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 35a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 35d:	5b                   	pop    %ebx
+ 35e:	5e                   	pop    %esi
+ 35f:	5f                   	pop    %edi
+ 360:	5d                   	pop    %ebp
+ 361:	c3                   	ret
+ 362:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 369:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	56                   	push   %esi
+ 374:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 375:	83 ec 08             	sub    $0x8,%esp
+ 378:	6a 00                	push   $0x0
+ 37a:	ff 75 08             	push   0x8(%ebp)
+ 37d:	e8 4f 02 00 00       	call   5d1 <open>
+  if(fd < 0)
+ 382:	83 c4 10             	add    $0x10,%esp
+ 385:	85 c0                	test   %eax,%eax
+ 387:	78 27                	js     3b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 389:	83 ec 08             	sub    $0x8,%esp
+ 38c:	ff 75 0c             	push   0xc(%ebp)
+ 38f:	89 c3                	mov    %eax,%ebx
+ 391:	50                   	push   %eax
+ 392:	e8 91 02 00 00       	call   628 <fstat>
+  close(fd);
+ 397:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 39a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 39c:	e8 d9 01 00 00       	call   57a <close>
+  return r;
+ 3a1:	83 c4 10             	add    $0x10,%esp
+}
+ 3a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3a7:	89 f0                	mov    %esi,%eax
+ 3a9:	5b                   	pop    %ebx
+ 3aa:	5e                   	pop    %esi
+ 3ab:	5d                   	pop    %ebp
+ 3ac:	c3                   	ret
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3b5:	eb ed                	jmp    3a4 <stat+0x34>
+ 3b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3be:	66 90                	xchg   %ax,%ax
+
+000003c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	53                   	push   %ebx
+ 3c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3c7:	0f be 02             	movsbl (%edx),%eax
+ 3ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3d5:	77 1e                	ja     3f5 <atoi+0x35>
+ 3d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3e0:	83 c2 01             	add    $0x1,%edx
+ 3e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3ea:	0f be 02             	movsbl (%edx),%eax
+ 3ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3f0:	80 fb 09             	cmp    $0x9,%bl
+ 3f3:	76 eb                	jbe    3e0 <atoi+0x20>
+  return n;
+}
+ 3f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3f8:	89 c8                	mov    %ecx,%eax
+ 3fa:	c9                   	leave
+ 3fb:	c3                   	ret
+ 3fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000400 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	56                   	push   %esi
+ 405:	8b 45 10             	mov    0x10(%ebp),%eax
+ 408:	8b 55 08             	mov    0x8(%ebp),%edx
+ 40b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 40e:	85 c0                	test   %eax,%eax
+ 410:	7e 13                	jle    425 <memmove+0x25>
+ 412:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 414:	89 d7                	mov    %edx,%edi
+ 416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 420:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 421:	39 f8                	cmp    %edi,%eax
+ 423:	75 fb                	jne    420 <memmove+0x20>
+  return vdst;
+}
+ 425:	5e                   	pop    %esi
+ 426:	89 d0                	mov    %edx,%eax
+ 428:	5f                   	pop    %edi
+ 429:	5d                   	pop    %ebp
+ 42a:	c3                   	ret
+ 42b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 42f:	90                   	nop
+
+00000430 <ugetpid>:
+// getpid() without a system call, from the page at UPROC.
+int
+ugetpid(void)
+{
+  return ((struct uproc*)UPROC)->pid;
+}
+ 430:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+ 435:	c3                   	ret
+ 436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000440 <uclocktime>:
+
+// clocktime() without a system call, from the page at UCLOCK.
+int
+uclocktime(struct timespec *ts)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	57                   	push   %edi
+ 444:	56                   	push   %esi
+ 445:	53                   	push   %ebx
+ 446:	83 ec 1c             	sub    $0x1c,%esp
+  struct uclock *c = (struct uclock*)UCLOCK;
+
+  if(c->tscmult == 0)
+ 449:	8b 0d 08 f0 ff 7f    	mov    0x7ffff008,%ecx
+{
+ 44f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(c->tscmult == 0)
+ 452:	85 c9                	test   %ecx,%ecx
+ 454:	74 6a                	je     4c0 <uclocktime+0x80>
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+ 456:	0f 31                	rdtsc
+static inline void
+uclockread(struct uclock *c, uint64 tsc, struct timespec *ts)
+{
+  uint64 d, ns;
+
+  d = tsc - c->tscbase;
+ 458:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 45e:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+ 464:	89 c6                	mov    %eax,%esi
+  if((long long)d < 0)  // another CPU's TSC is a little behind
+ 466:	85 d2                	test   %edx,%edx
+ 468:	78 46                	js     4b0 <uclocktime+0x70>
+    d = 0;
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 46a:	89 d0                	mov    %edx,%eax
+ 46c:	f7 e1                	mul    %ecx
+ 46e:	0f a4 c2 08          	shld   $0x8,%eax,%edx
+ 472:	c1 e0 08             	shl    $0x8,%eax
+ 475:	89 45 e0             	mov    %eax,-0x20(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+ 478:	89 f0                	mov    %esi,%eax
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 47a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+ 47d:	f7 e1                	mul    %ecx
+ 47f:	0f ac d0 18          	shrd   $0x18,%edx,%eax
+ 483:	c1 ea 18             	shr    $0x18,%edx
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 486:	03 45 e0             	add    -0x20(%ebp),%eax
+ 489:	13 55 e4             	adc    -0x1c(%ebp),%edx
+// linked with libgcc, so it cannot use 64-bit '/' or '%'.
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+  asm("divl %4" : "=a" (q), "=d" (r) : "a" ((uint)n), "d" ((uint)(n>>32)), "rm" (d));
+ 48c:	89 c7                	mov    %eax,%edi
+ 48e:	89 f8                	mov    %edi,%eax
+ 490:	b9 00 ca 9a 3b       	mov    $0x3b9aca00,%ecx
+ 495:	f7 f1                	div    %ecx
+  ts->sec = divl(ns, 1000000000, &ts->nsec);
+ 497:	89 03                	mov    %eax,(%ebx)
+    return clocktime(ts);
+  uclockread(c, rdtsc(), ts);
+  return 0;
+}
+ 499:	31 c0                	xor    %eax,%eax
+  *rem = r;
+ 49b:	89 53 04             	mov    %edx,0x4(%ebx)
+ 49e:	83 c4 1c             	add    $0x1c,%esp
+ 4a1:	5b                   	pop    %ebx
+ 4a2:	5e                   	pop    %esi
+ 4a3:	5f                   	pop    %edi
+ 4a4:	5d                   	pop    %ebp
+ 4a5:	c3                   	ret
+ 4a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ad:	8d 76 00             	lea    0x0(%esi),%esi
+ 4b0:	31 d2                	xor    %edx,%edx
+ 4b2:	31 ff                	xor    %edi,%edi
+ 4b4:	eb d8                	jmp    48e <uclocktime+0x4e>
+ 4b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 4c0:	83 c4 1c             	add    $0x1c,%esp
+ 4c3:	5b                   	pop    %ebx
+ 4c4:	5e                   	pop    %esi
+ 4c5:	5f                   	pop    %edi
+ 4c6:	5d                   	pop    %ebp
+    return clocktime(ts);
+ 4c7:	e9 f2 02 00 00       	jmp    7be <clocktime>
+
+000004cc <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+ 4cc:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4d1:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4d8:	00 00 00 
+ 4db:	74 09                	je     4e6 <fork+0x1a>
+ 4dd:	89 e1                	mov    %esp,%ecx
+ 4df:	ba e8 04 00 00       	mov    $0x4e8,%edx
+ 4e4:	0f 34                	sysenter
+ 4e6:	cd 40                	int    $0x40
+ 4e8:	c3                   	ret
+
+000004e9 <exit>:
+SYSCALL(exit)
+ 4e9:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4ee:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4f5:	00 00 00 
+ 4f8:	74 09                	je     503 <exit+0x1a>
+ 4fa:	89 e1                	mov    %esp,%ecx
+ 4fc:	ba 05 05 00 00       	mov    $0x505,%edx
+ 501:	0f 34                	sysenter
+ 503:	cd 40                	int    $0x40
+ 505:	c3                   	ret
+
+00000506 <wait>:
+SYSCALL(wait)
+ 506:	b8 03 00 00 00       	mov    $0x3,%eax
+ 50b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 512:	00 00 00 
+ 515:	74 09                	je     520 <wait+0x1a>
+ 517:	89 e1                	mov    %esp,%ecx
+ 519:	ba 22 05 00 00       	mov    $0x522,%edx
+ 51e:	0f 34                	sysenter
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <pipe>:
+SYSCALL(pipe)
+ 523:	b8 04 00 00 00       	mov    $0x4,%eax
+ 528:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 52f:	00 00 00 
+ 532:	74 09                	je     53d <pipe+0x1a>
+ 534:	89 e1                	mov    %esp,%ecx
+ 536:	ba 3f 05 00 00       	mov    $0x53f,%edx
+ 53b:	0f 34                	sysenter
+ 53d:	cd 40                	int    $0x40
+ 53f:	c3                   	ret
+
+00000540 <read>:
+SYSCALL(read)
+ 540:	b8 05 00 00 00       	mov    $0x5,%eax
+ 545:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 54c:	00 00 00 
+ 54f:	74 09                	je     55a <read+0x1a>
+ 551:	89 e1                	mov    %esp,%ecx
+ 553:	ba 5c 05 00 00       	mov    $0x55c,%edx
+ 558:	0f 34                	sysenter
+ 55a:	cd 40                	int    $0x40
+ 55c:	c3                   	ret
+
+0000055d <write>:
+SYSCALL(write)
+ 55d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 562:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 569:	00 00 00 
+ 56c:	74 09                	je     577 <write+0x1a>
+ 56e:	89 e1                	mov    %esp,%ecx
+ 570:	ba 79 05 00 00       	mov    $0x579,%edx
+ 575:	0f 34                	sysenter
+ 577:	cd 40                	int    $0x40
+ 579:	c3                   	ret
+
+0000057a <close>:
+SYSCALL(close)
+ 57a:	b8 15 00 00 00       	mov    $0x15,%eax
+ 57f:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 586:	00 00 00 
+ 589:	74 09                	je     594 <close+0x1a>
+ 58b:	89 e1                	mov    %esp,%ecx
+ 58d:	ba 96 05 00 00       	mov    $0x596,%edx
+ 592:	0f 34                	sysenter
+ 594:	cd 40                	int    $0x40
+ 596:	c3                   	ret
+
+00000597 <kill>:
+SYSCALL(kill)
+ 597:	b8 06 00 00 00       	mov    $0x6,%eax
+ 59c:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5a3:	00 00 00 
+ 5a6:	74 09                	je     5b1 <kill+0x1a>
+ 5a8:	89 e1                	mov    %esp,%ecx
+ 5aa:	ba b3 05 00 00       	mov    $0x5b3,%edx
+ 5af:	0f 34                	sysenter
+ 5b1:	cd 40                	int    $0x40
+ 5b3:	c3                   	ret
+
+000005b4 <exec>:
+SYSCALL(exec)
+ 5b4:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5b9:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5c0:	00 00 00 
+ 5c3:	74 09                	je     5ce <exec+0x1a>
+ 5c5:	89 e1                	mov    %esp,%ecx
+ 5c7:	ba d0 05 00 00       	mov    $0x5d0,%edx
+ 5cc:	0f 34                	sysenter
+ 5ce:	cd 40                	int    $0x40
+ 5d0:	c3                   	ret
+
+000005d1 <open>:
+SYSCALL(open)
+ 5d1:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5d6:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5dd:	00 00 00 
+ 5e0:	74 09                	je     5eb <open+0x1a>
+ 5e2:	89 e1                	mov    %esp,%ecx
+ 5e4:	ba ed 05 00 00       	mov    $0x5ed,%edx
+ 5e9:	0f 34                	sysenter
+ 5eb:	cd 40                	int    $0x40
+ 5ed:	c3                   	ret
+
+000005ee <mknod>:
+SYSCALL(mknod)
+ 5ee:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5f3:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5fa:	00 00 00 
+ 5fd:	74 09                	je     608 <mknod+0x1a>
+ 5ff:	89 e1                	mov    %esp,%ecx
+ 601:	ba 0a 06 00 00       	mov    $0x60a,%edx
+ 606:	0f 34                	sysenter
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <unlink>:
+SYSCALL(unlink)
+ 60b:	b8 12 00 00 00       	mov    $0x12,%eax
+ 610:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 617:	00 00 00 
+ 61a:	74 09                	je     625 <unlink+0x1a>
+ 61c:	89 e1                	mov    %esp,%ecx
+ 61e:	ba 27 06 00 00       	mov    $0x627,%edx
+ 623:	0f 34                	sysenter
+ 625:	cd 40                	int    $0x40
+ 627:	c3                   	ret
+
+00000628 <fstat>:
+SYSCALL(fstat)
+ 628:	b8 08 00 00 00       	mov    $0x8,%eax
+ 62d:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 634:	00 00 00 
+ 637:	74 09                	je     642 <fstat+0x1a>
+ 639:	89 e1                	mov    %esp,%ecx
+ 63b:	ba 44 06 00 00       	mov    $0x644,%edx
+ 640:	0f 34                	sysenter
+ 642:	cd 40                	int    $0x40
+ 644:	c3                   	ret
+
+00000645 <link>:
+SYSCALL(link)
+ 645:	b8 13 00 00 00       	mov    $0x13,%eax
+ 64a:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 651:	00 00 00 
+ 654:	74 09                	je     65f <link+0x1a>
+ 656:	89 e1                	mov    %esp,%ecx
+ 658:	ba 61 06 00 00       	mov    $0x661,%edx
+ 65d:	0f 34                	sysenter
+ 65f:	cd 40                	int    $0x40
+ 661:	c3                   	ret
+
+00000662 <mkdir>:
+SYSCALL(mkdir)
+ 662:	b8 14 00 00 00       	mov    $0x14,%eax
+ 667:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 66e:	00 00 00 
+ 671:	74 09                	je     67c <mkdir+0x1a>
+ 673:	89 e1                	mov    %esp,%ecx
+ 675:	ba 7e 06 00 00       	mov    $0x67e,%edx
+ 67a:	0f 34                	sysenter
+ 67c:	cd 40                	int    $0x40
+ 67e:	c3                   	ret
+
+0000067f <chdir>:
+SYSCALL(chdir)
+ 67f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 684:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 68b:	00 00 00 
+ 68e:	74 09                	je     699 <chdir+0x1a>
+ 690:	89 e1                	mov    %esp,%ecx
+ 692:	ba 9b 06 00 00       	mov    $0x69b,%edx
+ 697:	0f 34                	sysenter
+ 699:	cd 40                	int    $0x40
+ 69b:	c3                   	ret
+
+0000069c <dup>:
+SYSCALL(dup)
+ 69c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6a1:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6a8:	00 00 00 
+ 6ab:	74 09                	je     6b6 <dup+0x1a>
+ 6ad:	89 e1                	mov    %esp,%ecx
+ 6af:	ba b8 06 00 00       	mov    $0x6b8,%edx
+ 6b4:	0f 34                	sysenter
+ 6b6:	cd 40                	int    $0x40
+ 6b8:	c3                   	ret
+
+000006b9 <getpid>:
+SYSCALL(getpid)
+ 6b9:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6be:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6c5:	00 00 00 
+ 6c8:	74 09                	je     6d3 <getpid+0x1a>
+ 6ca:	89 e1                	mov    %esp,%ecx
+ 6cc:	ba d5 06 00 00       	mov    $0x6d5,%edx
+ 6d1:	0f 34                	sysenter
+ 6d3:	cd 40                	int    $0x40
+ 6d5:	c3                   	ret
+
+000006d6 <sbrk>:
+SYSCALL(sbrk)
+ 6d6:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6db:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6e2:	00 00 00 
+ 6e5:	74 09                	je     6f0 <sbrk+0x1a>
+ 6e7:	89 e1                	mov    %esp,%ecx
+ 6e9:	ba f2 06 00 00       	mov    $0x6f2,%edx
+ 6ee:	0f 34                	sysenter
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <sleep>:
+SYSCALL(sleep)
+ 6f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6f8:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6ff:	00 00 00 
+ 702:	74 09                	je     70d <sleep+0x1a>
+ 704:	89 e1                	mov    %esp,%ecx
+ 706:	ba 0f 07 00 00       	mov    $0x70f,%edx
+ 70b:	0f 34                	sysenter
+ 70d:	cd 40                	int    $0x40
+ 70f:	c3                   	ret
+
+00000710 <uptime>:
+SYSCALL(uptime)
+ 710:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 715:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 71c:	00 00 00 
+ 71f:	74 09                	je     72a <uptime+0x1a>
+ 721:	89 e1                	mov    %esp,%ecx
+ 723:	ba 2c 07 00 00       	mov    $0x72c,%edx
+ 728:	0f 34                	sysenter
+ 72a:	cd 40                	int    $0x40
+ 72c:	c3                   	ret
+
+0000072d <swapread>:
+SYSCALL(swapread)
+ 72d:	b8 16 00 00 00       	mov    $0x16,%eax
+ 732:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 739:	00 00 00 
+ 73c:	74 09                	je     747 <swapread+0x1a>
+ 73e:	89 e1                	mov    %esp,%ecx
+ 740:	ba 49 07 00 00       	mov    $0x749,%edx
+ 745:	0f 34                	sysenter
+ 747:	cd 40                	int    $0x40
+ 749:	c3                   	ret
+
+0000074a <swapwrite>:
+SYSCALL(swapwrite)
+ 74a:	b8 17 00 00 00       	mov    $0x17,%eax
+ 74f:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 756:	00 00 00 
+ 759:	74 09                	je     764 <swapwrite+0x1a>
+ 75b:	89 e1                	mov    %esp,%ecx
+ 75d:	ba 66 07 00 00       	mov    $0x766,%edx
+ 762:	0f 34                	sysenter
+ 764:	cd 40                	int    $0x40
+ 766:	c3                   	ret
+
+00000767 <setaffinity>:
+SYSCALL(setaffinity)
+ 767:	b8 18 00 00 00       	mov    $0x18,%eax
+ 76c:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 773:	00 00 00 
+ 776:	74 09                	je     781 <setaffinity+0x1a>
+ 778:	89 e1                	mov    %esp,%ecx
+ 77a:	ba 83 07 00 00       	mov    $0x783,%edx
+ 77f:	0f 34                	sysenter
+ 781:	cd 40                	int    $0x40
+ 783:	c3                   	ret
+
+00000784 <getaffinity>:
+SYSCALL(getaffinity)
+ 784:	b8 19 00 00 00       	mov    $0x19,%eax
+ 789:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 790:	00 00 00 
+ 793:	74 09                	je     79e <getaffinity+0x1a>
+ 795:	89 e1                	mov    %esp,%ecx
+ 797:	ba a0 07 00 00       	mov    $0x7a0,%edx
+ 79c:	0f 34                	sysenter
+ 79e:	cd 40                	int    $0x40
+ 7a0:	c3                   	ret
+
+000007a1 <nanosleep>:
+SYSCALL(nanosleep)
+ 7a1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 7a6:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 7ad:	00 00 00 
+ 7b0:	74 09                	je     7bb <nanosleep+0x1a>
+ 7b2:	89 e1                	mov    %esp,%ecx
+ 7b4:	ba bd 07 00 00       	mov    $0x7bd,%edx
+ 7b9:	0f 34                	sysenter
+ 7bb:	cd 40                	int    $0x40
+ 7bd:	c3                   	ret
+
+000007be <clocktime>:
+SYSCALL(clocktime)
+ 7be:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 7c3:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 7ca:	00 00 00 
+ 7cd:	74 09                	je     7d8 <clocktime+0x1a>
+ 7cf:	89 e1                	mov    %esp,%ecx
+ 7d1:	ba da 07 00 00       	mov    $0x7da,%edx
+ 7d6:	0f 34                	sysenter
+ 7d8:	cd 40                	int    $0x40
+ 7da:	c3                   	ret
+
+000007db <batch>:
+SYSCALL(batch)
+ 7db:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 7e0:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 7e7:	00 00 00 
+ 7ea:	74 09                	je     7f5 <batch+0x1a>
+ 7ec:	89 e1                	mov    %esp,%ecx
+ 7ee:	ba f7 07 00 00       	mov    $0x7f7,%edx
+ 7f3:	0f 34                	sysenter
+ 7f5:	cd 40                	int    $0x40
+ 7f7:	c3                   	ret
+
+000007f8 <aiosetup>:
+SYSCALL(aiosetup)
+ 7f8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 7fd:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 804:	00 00 00 
+ 807:	74 09                	je     812 <aiosetup+0x1a>
+ 809:	89 e1                	mov    %esp,%ecx
+ 80b:	ba 14 08 00 00       	mov    $0x814,%edx
+ 810:	0f 34                	sysenter
+ 812:	cd 40                	int    $0x40
+ 814:	c3                   	ret
+
+00000815 <aiowait>:
+SYSCALL(aiowait)
+ 815:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 81a:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 821:	00 00 00 
+ 824:	74 09                	je     82f <aiowait+0x1a>
+ 826:	89 e1                	mov    %esp,%ecx
+ 828:	ba 31 08 00 00       	mov    $0x831,%edx
+ 82d:	0f 34                	sysenter
+ 82f:	cd 40                	int    $0x40
+ 831:	c3                   	ret
+
+00000832 <spawn>:
+SYSCALL(spawn)
+ 832:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 837:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 83e:	00 00 00 
+ 841:	74 09                	je     84c <spawn+0x1a>
+ 843:	89 e1                	mov    %esp,%ecx
+ 845:	ba 4e 08 00 00       	mov    $0x84e,%edx
+ 84a:	0f 34                	sysenter
+ 84c:	cd 40                	int    $0x40
+ 84e:	c3                   	ret
+
+0000084f <getprocinfo>:
+SYSCALL(getprocinfo)
+ 84f:	b8 20 00 00 00       	mov    $0x20,%eax
+ 854:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 85b:	00 00 00 
+ 85e:	74 09                	je     869 <getprocinfo+0x1a>
+ 860:	89 e1                	mov    %esp,%ecx
+ 862:	ba 6b 08 00 00       	mov    $0x86b,%edx
+ 867:	0f 34                	sysenter
+ 869:	cd 40                	int    $0x40
+ 86b:	c3                   	ret
+
+0000086c <getlockstat>:
+SYSCALL(getlockstat)
+ 86c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 871:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 878:	00 00 00 
+ 87b:	74 09                	je     886 <getlockstat+0x1a>
+ 87d:	89 e1                	mov    %esp,%ecx
+ 87f:	ba 88 08 00 00       	mov    $0x888,%edx
+ 884:	0f 34                	sysenter
+ 886:	cd 40                	int    $0x40
+ 888:	c3                   	ret
+
+00000889 <lockprof>:
+SYSCALL(lockprof)
+ 889:	b8 22 00 00 00       	mov    $0x22,%eax
+ 88e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 895:	00 00 00 
+ 898:	74 09                	je     8a3 <lockprof+0x1a>
+ 89a:	89 e1                	mov    %esp,%ecx
+ 89c:	ba a5 08 00 00       	mov    $0x8a5,%edx
+ 8a1:	0f 34                	sysenter
+ 8a3:	cd 40                	int    $0x40
+ 8a5:	c3                   	ret
+
+000008a6 <getlockprof>:
+SYSCALL(getlockprof)
+ 8a6:	b8 23 00 00 00       	mov    $0x23,%eax
+ 8ab:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 8b2:	00 00 00 
+ 8b5:	74 09                	je     8c0 <getlockprof+0x1a>
+ 8b7:	89 e1                	mov    %esp,%ecx
+ 8b9:	ba c2 08 00 00       	mov    $0x8c2,%edx
+ 8be:	0f 34                	sysenter
+ 8c0:	cd 40                	int    $0x40
+ 8c2:	c3                   	ret
+
+000008c3 <diskstat>:
+SYSCALL(diskstat)
+ 8c3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 8c8:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 8cf:	00 00 00 
+ 8d2:	74 09                	je     8dd <diskstat+0x1a>
+ 8d4:	89 e1                	mov    %esp,%ecx
+ 8d6:	ba df 08 00 00       	mov    $0x8df,%edx
+ 8db:	0f 34                	sysenter
+ 8dd:	cd 40                	int    $0x40
+ 8df:	c3                   	ret
+
+000008e0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 8e0:	55                   	push   %ebp
+ 8e1:	89 e5                	mov    %esp,%ebp
+ 8e3:	57                   	push   %edi
+ 8e4:	56                   	push   %esi
+ 8e5:	53                   	push   %ebx
+ 8e6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 8e8:	89 d1                	mov    %edx,%ecx
+{
+ 8ea:	83 ec 3c             	sub    $0x3c,%esp
+ 8ed:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 8f0:	85 d2                	test   %edx,%edx
+ 8f2:	0f 89 80 00 00 00    	jns    978 <printint+0x98>
+ 8f8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 8fc:	74 7a                	je     978 <printint+0x98>
+    x = -xx;
+ 8fe:	f7 d9                	neg    %ecx
+    neg = 1;
+ 900:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 905:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 908:	31 f6                	xor    %esi,%esi
+ 90a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 910:	89 c8                	mov    %ecx,%eax
+ 912:	31 d2                	xor    %edx,%edx
+ 914:	89 f7                	mov    %esi,%edi
+ 916:	f7 f3                	div    %ebx
+ 918:	8d 76 01             	lea    0x1(%esi),%esi
+ 91b:	0f b6 92 b0 0d 00 00 	movzbl 0xdb0(%edx),%edx
+ 922:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 926:	89 ca                	mov    %ecx,%edx
+ 928:	89 c1                	mov    %eax,%ecx
+ 92a:	39 da                	cmp    %ebx,%edx
+ 92c:	73 e2                	jae    910 <printint+0x30>
+  if(neg)
+ 92e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 931:	85 c0                	test   %eax,%eax
+ 933:	74 07                	je     93c <printint+0x5c>
+    buf[i++] = '-';
+ 935:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 93a:	89 f7                	mov    %esi,%edi
+ 93c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 93f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 942:	01 df                	add    %ebx,%edi
+ 944:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 948:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 94b:	83 ec 04             	sub    $0x4,%esp
+ 94e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 951:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 954:	6a 01                	push   $0x1
+ 956:	50                   	push   %eax
+ 957:	56                   	push   %esi
+ 958:	e8 00 fc ff ff       	call   55d <write>
+  while(--i >= 0)
+ 95d:	89 f8                	mov    %edi,%eax
+ 95f:	83 c4 10             	add    $0x10,%esp
+ 962:	83 ef 01             	sub    $0x1,%edi
+ 965:	39 d8                	cmp    %ebx,%eax
+ 967:	75 df                	jne    948 <printint+0x68>
+}
+ 969:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 96c:	5b                   	pop    %ebx
+ 96d:	5e                   	pop    %esi
+ 96e:	5f                   	pop    %edi
+ 96f:	5d                   	pop    %ebp
+ 970:	c3                   	ret
+ 971:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 978:	31 c0                	xor    %eax,%eax
+ 97a:	eb 89                	jmp    905 <printint+0x25>
+ 97c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000980 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 980:	55                   	push   %ebp
+ 981:	89 e5                	mov    %esp,%ebp
+ 983:	57                   	push   %edi
+ 984:	56                   	push   %esi
+ 985:	53                   	push   %ebx
+ 986:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 989:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 98c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 98f:	0f b6 1e             	movzbl (%esi),%ebx
+ 992:	83 c6 01             	add    $0x1,%esi
+ 995:	84 db                	test   %bl,%bl
+ 997:	74 67                	je     a00 <printf+0x80>
+ 999:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 99c:	31 d2                	xor    %edx,%edx
+ 99e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 9a1:	eb 34                	jmp    9d7 <printf+0x57>
+ 9a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9a7:	90                   	nop
+ 9a8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 9ab:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 9b0:	83 f8 25             	cmp    $0x25,%eax
+ 9b3:	74 18                	je     9cd <printf+0x4d>
+  write(fd, &c, 1);
+ 9b5:	83 ec 04             	sub    $0x4,%esp
+ 9b8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 9bb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9be:	6a 01                	push   $0x1
+ 9c0:	50                   	push   %eax
+ 9c1:	57                   	push   %edi
+ 9c2:	e8 96 fb ff ff       	call   55d <write>
+ 9c7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 9ca:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 9cd:	0f b6 1e             	movzbl (%esi),%ebx
+ 9d0:	83 c6 01             	add    $0x1,%esi
+ 9d3:	84 db                	test   %bl,%bl
+ 9d5:	74 29                	je     a00 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 9d7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 9da:	85 d2                	test   %edx,%edx
+ 9dc:	74 ca                	je     9a8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 9de:	83 fa 25             	cmp    $0x25,%edx
+ 9e1:	75 ea                	jne    9cd <printf+0x4d>
+      if(c == 'd'){
+ 9e3:	83 f8 25             	cmp    $0x25,%eax
+ 9e6:	0f 84 24 01 00 00    	je     b10 <printf+0x190>
+ 9ec:	83 e8 63             	sub    $0x63,%eax
+ 9ef:	83 f8 15             	cmp    $0x15,%eax
+ 9f2:	77 1c                	ja     a10 <printf+0x90>
+ 9f4:	ff 24 85 58 0d 00 00 	jmp    *0xd58(,%eax,4)
+ 9fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9ff:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ a00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a03:	5b                   	pop    %ebx
+ a04:	5e                   	pop    %esi
+ a05:	5f                   	pop    %edi
+ a06:	5d                   	pop    %ebp
+ a07:	c3                   	ret
+ a08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a0f:	90                   	nop
+  write(fd, &c, 1);
+ a10:	83 ec 04             	sub    $0x4,%esp
+ a13:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a16:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ a1a:	6a 01                	push   $0x1
+ a1c:	52                   	push   %edx
+ a1d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ a20:	57                   	push   %edi
+ a21:	e8 37 fb ff ff       	call   55d <write>
+ a26:	83 c4 0c             	add    $0xc,%esp
+ a29:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a2c:	6a 01                	push   $0x1
+ a2e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ a31:	52                   	push   %edx
+ a32:	57                   	push   %edi
+ a33:	e8 25 fb ff ff       	call   55d <write>
+        putc(fd, c);
+ a38:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a3b:	31 d2                	xor    %edx,%edx
+ a3d:	eb 8e                	jmp    9cd <printf+0x4d>
+ a3f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ a40:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a43:	83 ec 0c             	sub    $0xc,%esp
+ a46:	b9 10 00 00 00       	mov    $0x10,%ecx
+ a4b:	8b 13                	mov    (%ebx),%edx
+ a4d:	6a 00                	push   $0x0
+ a4f:	89 f8                	mov    %edi,%eax
+        ap++;
+ a51:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ a54:	e8 87 fe ff ff       	call   8e0 <printint>
+        ap++;
+ a59:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a5c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a5f:	31 d2                	xor    %edx,%edx
+ a61:	e9 67 ff ff ff       	jmp    9cd <printf+0x4d>
+ a66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a6d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ a70:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ a73:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ a75:	83 c0 04             	add    $0x4,%eax
+ a78:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ a7b:	85 db                	test   %ebx,%ebx
+ a7d:	0f 84 9d 00 00 00    	je     b20 <printf+0x1a0>
+        while(*s != 0){
+ a83:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ a86:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ a88:	84 c0                	test   %al,%al
+ a8a:	0f 84 3d ff ff ff    	je     9cd <printf+0x4d>
+ a90:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a93:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ a96:	89 de                	mov    %ebx,%esi
+ a98:	89 d3                	mov    %edx,%ebx
+ a9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ aa0:	83 ec 04             	sub    $0x4,%esp
+ aa3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ aa6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ aa9:	6a 01                	push   $0x1
+ aab:	53                   	push   %ebx
+ aac:	57                   	push   %edi
+ aad:	e8 ab fa ff ff       	call   55d <write>
+        while(*s != 0){
+ ab2:	0f b6 06             	movzbl (%esi),%eax
+ ab5:	83 c4 10             	add    $0x10,%esp
+ ab8:	84 c0                	test   %al,%al
+ aba:	75 e4                	jne    aa0 <printf+0x120>
+      state = 0;
+ abc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ abf:	31 d2                	xor    %edx,%edx
+ ac1:	e9 07 ff ff ff       	jmp    9cd <printf+0x4d>
+ ac6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ acd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ ad0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ ad3:	83 ec 0c             	sub    $0xc,%esp
+ ad6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ adb:	8b 13                	mov    (%ebx),%edx
+ add:	6a 01                	push   $0x1
+ adf:	e9 6b ff ff ff       	jmp    a4f <printf+0xcf>
+ ae4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ ae8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ aeb:	83 ec 04             	sub    $0x4,%esp
+ aee:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ af1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ af3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ af6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ af9:	6a 01                	push   $0x1
+ afb:	52                   	push   %edx
+ afc:	57                   	push   %edi
+ afd:	e8 5b fa ff ff       	call   55d <write>
+        ap++;
+ b02:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ b05:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b08:	31 d2                	xor    %edx,%edx
+ b0a:	e9 be fe ff ff       	jmp    9cd <printf+0x4d>
+ b0f:	90                   	nop
+  write(fd, &c, 1);
+ b10:	83 ec 04             	sub    $0x4,%esp
+ b13:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b16:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b19:	6a 01                	push   $0x1
+ b1b:	e9 11 ff ff ff       	jmp    a31 <printf+0xb1>
+ b20:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ b25:	bb 50 0d 00 00       	mov    $0xd50,%ebx
+ b2a:	e9 61 ff ff ff       	jmp    a90 <printf+0x110>
+ b2f:	90                   	nop
+
+00000b30 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b30:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b31:	a1 c0 11 00 00       	mov    0x11c0,%eax
+{
+ b36:	89 e5                	mov    %esp,%ebp
+ b38:	57                   	push   %edi
+ b39:	56                   	push   %esi
+ b3a:	53                   	push   %ebx
+ b3b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ b3e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b48:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b4a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b4c:	39 ca                	cmp    %ecx,%edx
+ b4e:	73 30                	jae    b80 <free+0x50>
+ b50:	39 c1                	cmp    %eax,%ecx
+ b52:	72 04                	jb     b58 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b54:	39 c2                	cmp    %eax,%edx
+ b56:	72 f0                	jb     b48 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b58:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ b5b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ b5e:	39 f8                	cmp    %edi,%eax
+ b60:	74 2e                	je     b90 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b62:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ b65:	8b 42 04             	mov    0x4(%edx),%eax
+ b68:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b6b:	39 f1                	cmp    %esi,%ecx
+ b6d:	74 38                	je     ba7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ b6f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ b71:	5b                   	pop    %ebx
+  freep = p;
+ b72:	89 15 c0 11 00 00    	mov    %edx,0x11c0
+}
+ b78:	5e                   	pop    %esi
+ b79:	5f                   	pop    %edi
+ b7a:	5d                   	pop    %ebp
+ b7b:	c3                   	ret
+ b7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b80:	39 c1                	cmp    %eax,%ecx
+ b82:	72 d0                	jb     b54 <free+0x24>
+ b84:	eb c2                	jmp    b48 <free+0x18>
+ b86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b8d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ b90:	03 70 04             	add    0x4(%eax),%esi
+ b93:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b96:	8b 02                	mov    (%edx),%eax
+ b98:	8b 00                	mov    (%eax),%eax
+ b9a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ b9d:	8b 42 04             	mov    0x4(%edx),%eax
+ ba0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ ba3:	39 f1                	cmp    %esi,%ecx
+ ba5:	75 c8                	jne    b6f <free+0x3f>
+    p->s.size += bp->s.size;
+ ba7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ baa:	89 15 c0 11 00 00    	mov    %edx,0x11c0
+    p->s.size += bp->s.size;
+ bb0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ bb3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ bb6:	89 0a                	mov    %ecx,(%edx)
+}
+ bb8:	5b                   	pop    %ebx
+ bb9:	5e                   	pop    %esi
+ bba:	5f                   	pop    %edi
+ bbb:	5d                   	pop    %ebp
+ bbc:	c3                   	ret
+ bbd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000bc0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ bc0:	55                   	push   %ebp
+ bc1:	89 e5                	mov    %esp,%ebp
+ bc3:	57                   	push   %edi
+ bc4:	56                   	push   %esi
+ bc5:	53                   	push   %ebx
+ bc6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ bc9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ bcc:	8b 15 c0 11 00 00    	mov    0x11c0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ bd2:	8d 78 07             	lea    0x7(%eax),%edi
+ bd5:	c1 ef 03             	shr    $0x3,%edi
+ bd8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ bdb:	85 d2                	test   %edx,%edx
+ bdd:	0f 84 8d 00 00 00    	je     c70 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ be3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ be5:	8b 48 04             	mov    0x4(%eax),%ecx
+ be8:	39 f9                	cmp    %edi,%ecx
+ bea:	73 64                	jae    c50 <malloc+0x90>
+  if(nu < 4096)
+ bec:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ bf1:	39 df                	cmp    %ebx,%edi
+ bf3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ bf6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ bfd:	eb 0a                	jmp    c09 <malloc+0x49>
+ bff:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c00:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ c02:	8b 48 04             	mov    0x4(%eax),%ecx
+ c05:	39 f9                	cmp    %edi,%ecx
+ c07:	73 47                	jae    c50 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ c09:	89 c2                	mov    %eax,%edx
+ c0b:	39 05 c0 11 00 00    	cmp    %eax,0x11c0
+ c11:	75 ed                	jne    c00 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ c13:	83 ec 0c             	sub    $0xc,%esp
+ c16:	56                   	push   %esi
+ c17:	e8 ba fa ff ff       	call   6d6 <sbrk>
+  if(p == (char*)-1)
+ c1c:	83 c4 10             	add    $0x10,%esp
+ c1f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ c22:	74 1c                	je     c40 <malloc+0x80>
+  hp->s.size = nu;
+ c24:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ c27:	83 ec 0c             	sub    $0xc,%esp
+ c2a:	83 c0 08             	add    $0x8,%eax
+ c2d:	50                   	push   %eax
+ c2e:	e8 fd fe ff ff       	call   b30 <free>
+  return freep;
+ c33:	8b 15 c0 11 00 00    	mov    0x11c0,%edx
+      if((p = morecore(nunits)) == 0)
+ c39:	83 c4 10             	add    $0x10,%esp
+ c3c:	85 d2                	test   %edx,%edx
+ c3e:	75 c0                	jne    c00 <malloc+0x40>
+        return 0;
+  }
+}
+ c40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ c43:	31 c0                	xor    %eax,%eax
+}
+ c45:	5b                   	pop    %ebx
+ c46:	5e                   	pop    %esi
+ c47:	5f                   	pop    %edi
+ c48:	5d                   	pop    %ebp
+ c49:	c3                   	ret
+ c4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ c50:	39 cf                	cmp    %ecx,%edi
+ c52:	74 4c                	je     ca0 <malloc+0xe0>
+        p->s.size -= nunits;
+ c54:	29 f9                	sub    %edi,%ecx
+ c56:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ c59:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ c5c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ c5f:	89 15 c0 11 00 00    	mov    %edx,0x11c0
+}
+ c65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ c68:	83 c0 08             	add    $0x8,%eax
+}
+ c6b:	5b                   	pop    %ebx
+ c6c:	5e                   	pop    %esi
+ c6d:	5f                   	pop    %edi
+ c6e:	5d                   	pop    %ebp
+ c6f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ c70:	c7 05 c0 11 00 00 c4 	movl   $0x11c4,0x11c0
+ c77:	11 00 00 
+    base.s.size = 0;
+ c7a:	b8 c4 11 00 00       	mov    $0x11c4,%eax
+    base.s.ptr = freep = prevp = &base;
+ c7f:	c7 05 c4 11 00 00 c4 	movl   $0x11c4,0x11c4
+ c86:	11 00 00 
+    base.s.size = 0;
+ c89:	c7 05 c8 11 00 00 00 	movl   $0x0,0x11c8
+ c90:	00 00 00 
+    if(p->s.size >= nunits){
+ c93:	e9 54 ff ff ff       	jmp    bec <malloc+0x2c>
+ c98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c9f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ ca0:	8b 08                	mov    (%eax),%ecx
+ ca2:	89 0a                	mov    %ecx,(%edx)
+ ca4:	eb b9                	jmp    c5f <malloc+0x9f>
@@ -0,0 +1,57 @@
+// Show disk request counts and latencies, and buffer cache hits.
+//
+// usage: iostat [command [arg ...]]
+//
+// With no arguments, prints the totals since boot.  Otherwise
+// runs the command and prints what changed while it ran.
+
+#include "types.h"
+#include "user.h"
+#include "diskstat.h"
+
+struct diskstat old, cur;
+
+int
+main(int argc, char *argv[])
+{
+  int i, pid, top;
+  uint n;
+
+  if(argc > 1){
+    diskstat(&old);
+    pid = fork();
+    if(pid < 0){
+      printf(2, "iostat: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      exec(argv[1], argv+1);
+      printf(2, "iostat: exec %s failed\n", argv[1]);
+      exit();
+    }
+    wait();
+  }
+  diskstat(&cur);
+
+  // maxlatency is since boot either way.
+  cur.nread -= old.nread;
+  cur.nwrite -= old.nwrite;
+  cur.ncmd -= old.ncmd;
+  cur.latency -= old.latency;
+  for(i = 0; i < NDISKHIST; i++)
+    cur.hist[i] -= old.hist[i];
+  cur.nhit -= old.nhit;
+  cur.nmiss -= old.nmiss;
+
+  n = cur.nread + cur.nwrite;
+  printf(1, "reads %d writes %d commands %d\n", cur.nread, cur.nwrite, cur.ncmd);
+  printf(1, "latency avg %d us, max %d us\n", n ? cur.latency / n : 0, cur.maxlatency);
+  for(top = NDISKHIST-1; top > 0 && cur.hist[top] == 0; top--)
+    ;
+  for(i = 0; i <= top; i++)
+    printf(1, "  >= %d us: %d\n", i ? 1 << i : 0, cur.hist[i]);
+  n = cur.nhit + cur.nmiss;
+  printf(1, "cache hits %d misses %d (%d%%), %d buffers\n",
+    cur.nhit, cur.nmiss, n ? cur.nhit * 100 / n : 0, cur.nbuf);
+  exit();
+}
@@ -0,0 +1,23843 @@
+
+kernelmemfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+80100000 <multiboot_header>:
+80100000:	02 b0 ad 1b 00 00    	add    0x1bad(%eax),%dh
+80100006:	00 00                	add    %al,(%eax)
+80100008:	fe 4f 52             	decb   0x52(%edi)
+8010000b:	e4                   	.byte 0xe4
+
+8010000c <entry>:
+
+# Entering xv6 on boot processor, with paging off.
+.globl entry
+entry:
+  # Turn on page size extension for 4Mbyte pages
+  movl    %cr4, %eax
+8010000c:	0f 20 e0             	mov    %cr4,%eax
+  orl     $(CR4_PSE), %eax
+8010000f:	83 c8 10             	or     $0x10,%eax
+  movl    %eax, %cr4
+80100012:	0f 22 e0             	mov    %eax,%cr4
+  # Set page directory
+  movl    $(V2P_WO(entrypgdir)), %eax
+80100015:	b8 00 e0 10 00       	mov    $0x10e000,%eax
+  movl    %eax, %cr3
+8010001a:	0f 22 d8             	mov    %eax,%cr3
+  # Turn on paging.
+  movl    %cr0, %eax
+8010001d:	0f 20 c0             	mov    %cr0,%eax
+  orl     $(CR0_PG|CR0_WP), %eax
+80100020:	0d 00 00 01 80       	or     $0x80010000,%eax
+  movl    %eax, %cr0
+80100025:	0f 22 c0             	mov    %eax,%cr0
+
+  # Set up the stack pointer.
+  movl $(stack + KSTACKSIZE), %esp
+80100028:	bc f0 49 1c 80       	mov    $0x801c49f0,%esp
+
+  # Jump to main(), and switch to executing at
+  # high addresses. The indirect call is needed because
+  # the assembler produces a PC-relative instruction
+  # for a direct jump.
+  mov $main, %eax
+8010002d:	b8 20 47 10 80       	mov    $0x80104720,%eax
+  jmp *%eax
+80100032:	ff e0                	jmp    *%eax
+80100034:	66 90                	xchg   %ax,%ax
+80100036:	66 90                	xchg   %ax,%ax
+80100038:	66 90                	xchg   %ax,%ax
+8010003a:	66 90                	xchg   %ax,%ax
+8010003c:	66 90                	xchg   %ax,%ax
+8010003e:	66 90                	xchg   %ax,%ax
+
+80100040 <aiorun>:
+}
+
+// Work function for aiowq.
+static void
+aiorun(void *arg)
+{
+80100040:	55                   	push   %ebp
+80100041:	89 e5                	mov    %esp,%ebp
+80100043:	57                   	push   %edi
+80100044:	56                   	push   %esi
+80100045:	be ff ff ff ff       	mov    $0xffffffff,%esi
+8010004a:	53                   	push   %ebx
+8010004b:	83 ec 2c             	sub    $0x2c,%esp
+8010004e:	8b 55 08             	mov    0x8(%ebp),%edx
+  struct aioreq *r = arg;
+  struct aioctx *ctx = r->ctx;
+80100051:	89 55 e0             	mov    %edx,-0x20(%ebp)
+80100054:	8b 3a                	mov    (%edx),%edi
+  char *buf;
+  int ret;
+
+  ret = -1;
+  if((buf = kalloc()) != 0){
+80100056:	e8 65 3a 00 00       	call   80103ac0 <kalloc>
+8010005b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+8010005e:	85 c0                	test   %eax,%eax
+80100060:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80100063:	0f 84 f5 00 00 00    	je     8010015e <aiorun+0x11e>
+  pde_t *pgdir = r->ctx->proc->pgdir;
+80100069:	8b 1a                	mov    (%edx),%ebx
+  if(r->sqe.op == AIO_FSYNC)
+8010006b:	8b 4a 04             	mov    0x4(%edx),%ecx
+  pde_t *pgdir = r->ctx->proc->pgdir;
+8010006e:	8b 43 60             	mov    0x60(%ebx),%eax
+80100071:	8b 40 04             	mov    0x4(%eax),%eax
+80100074:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  uint addr = r->sqe.addr;
+80100077:	8b 42 0c             	mov    0xc(%edx),%eax
+8010007a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  uint off = r->sqe.off;
+8010007d:	8b 42 14             	mov    0x14(%edx),%eax
+80100080:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  if(r->sqe.op == AIO_FSYNC)
+80100083:	83 f9 03             	cmp    $0x3,%ecx
+80100086:	0f 84 54 01 00 00    	je     801001e0 <aiorun+0x1a0>
+  for(done = 0; done < r->sqe.n; done += n){
+8010008c:	8b 5a 10             	mov    0x10(%edx),%ebx
+8010008f:	85 db                	test   %ebx,%ebx
+80100091:	0f 8e bb 01 00 00    	jle    80100252 <aiorun+0x212>
+80100097:	89 7d d0             	mov    %edi,-0x30(%ebp)
+8010009a:	31 f6                	xor    %esi,%esi
+8010009c:	89 d7                	mov    %edx,%edi
+8010009e:	89 ca                	mov    %ecx,%edx
+801000a0:	eb 52                	jmp    801000f4 <aiorun+0xb4>
+801000a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(copyin(pgdir, buf, addr + done, m) < 0)
+801000a8:	53                   	push   %ebx
+801000a9:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801000ac:	01 f0                	add    %esi,%eax
+801000ae:	50                   	push   %eax
+801000af:	ff 75 e4             	push   -0x1c(%ebp)
+801000b2:	ff 75 e0             	push   -0x20(%ebp)
+801000b5:	e8 66 b2 00 00       	call   8010b320 <copyin>
+801000ba:	83 c4 10             	add    $0x10,%esp
+801000bd:	85 c0                	test   %eax,%eax
+801000bf:	78 7f                	js     80100140 <aiorun+0x100>
+      if((n = filepwrite(r->f, buf, m, off + done)) < 0)
+801000c1:	8b 45 d8             	mov    -0x28(%ebp),%eax
+801000c4:	01 f0                	add    %esi,%eax
+801000c6:	50                   	push   %eax
+801000c7:	53                   	push   %ebx
+801000c8:	ff 75 e4             	push   -0x1c(%ebp)
+801000cb:	ff 77 1c             	push   0x1c(%edi)
+801000ce:	e8 cd 24 00 00       	call   801025a0 <filepwrite>
+801000d3:	83 c4 10             	add    $0x10,%esp
+801000d6:	89 c2                	mov    %eax,%edx
+801000d8:	85 c0                	test   %eax,%eax
+801000da:	78 64                	js     80100140 <aiorun+0x100>
+      return done + n;
+801000dc:	01 d6                	add    %edx,%esi
+    if(n < m)
+801000de:	39 d3                	cmp    %edx,%ebx
+801000e0:	0f 8f ea 00 00 00    	jg     801001d0 <aiorun+0x190>
+  for(done = 0; done < r->sqe.n; done += n){
+801000e6:	8b 5f 10             	mov    0x10(%edi),%ebx
+801000e9:	39 f3                	cmp    %esi,%ebx
+801000eb:	0f 8e df 00 00 00    	jle    801001d0 <aiorun+0x190>
+    if(r->sqe.op == AIO_READ){
+801000f1:	8b 57 04             	mov    0x4(%edi),%edx
+    m = r->sqe.n - done;
+801000f4:	29 f3                	sub    %esi,%ebx
+    if(m > PGSIZE)
+801000f6:	b8 00 10 00 00       	mov    $0x1000,%eax
+801000fb:	39 c3                	cmp    %eax,%ebx
+801000fd:	0f 4f d8             	cmovg  %eax,%ebx
+    if(r->sqe.op == AIO_READ){
+80100100:	83 fa 01             	cmp    $0x1,%edx
+80100103:	75 a3                	jne    801000a8 <aiorun+0x68>
+      if((n = filepread(r->f, buf, m, off + done)) < 0)
+80100105:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80100108:	01 f0                	add    %esi,%eax
+8010010a:	50                   	push   %eax
+8010010b:	53                   	push   %ebx
+8010010c:	ff 75 e4             	push   -0x1c(%ebp)
+8010010f:	ff 77 1c             	push   0x1c(%edi)
+80100112:	e8 89 23 00 00       	call   801024a0 <filepread>
+80100117:	83 c4 10             	add    $0x10,%esp
+8010011a:	85 c0                	test   %eax,%eax
+8010011c:	78 22                	js     80100140 <aiorun+0x100>
+      if(copyout(pgdir, addr + done, buf, n) < 0)
+8010011e:	50                   	push   %eax
+8010011f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+80100122:	ff 75 e4             	push   -0x1c(%ebp)
+80100125:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80100128:	01 f0                	add    %esi,%eax
+8010012a:	50                   	push   %eax
+8010012b:	ff 75 e0             	push   -0x20(%ebp)
+8010012e:	e8 2d b1 00 00       	call   8010b260 <copyout>
+80100133:	83 c4 10             	add    $0x10,%esp
+80100136:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+80100139:	85 c0                	test   %eax,%eax
+8010013b:	79 9f                	jns    801000dc <aiorun+0x9c>
+8010013d:	8d 76 00             	lea    0x0(%esi),%esi
+80100140:	89 fa                	mov    %edi,%edx
+80100142:	8b 7d d0             	mov    -0x30(%ebp),%edi
+        return -1;
+80100145:	be ff ff ff ff       	mov    $0xffffffff,%esi
+8010014a:	89 55 e0             	mov    %edx,-0x20(%ebp)
+    ret = aiodo(r, buf);
+    kfree(buf);
+8010014d:	83 ec 0c             	sub    $0xc,%esp
+80100150:	ff 75 e4             	push   -0x1c(%ebp)
+80100153:	e8 98 37 00 00       	call   801038f0 <kfree>
+80100158:	8b 55 e0             	mov    -0x20(%ebp),%edx
+8010015b:	83 c4 10             	add    $0x10,%esp
+  }
+  fileclose(r->f);
+8010015e:	83 ec 0c             	sub    $0xc,%esp
+80100161:	ff 72 1c             	push   0x1c(%edx)
+80100164:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80100167:	e8 e4 20 00 00       	call   80102250 <fileclose>
+
+  acquire(&ctx->lock);
+8010016c:	89 3c 24             	mov    %edi,(%esp)
+8010016f:	e8 fc 6e 00 00       	call   80107070 <acquire>
+  cqe = &ctx->ring->cq[ctx->cqtail % NAIOCQ];
+80100174:	8b 47 6c             	mov    0x6c(%edi),%eax
+  aiopost(ctx, r->sqe.tag, ret);
+80100177:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  cqe = &ctx->ring->cq[ctx->cqtail % NAIOCQ];
+8010017a:	8b 4f 64             	mov    0x64(%edi),%ecx
+  aiopost(ctx, r->sqe.tag, ret);
+8010017d:	8b 5a 18             	mov    0x18(%edx),%ebx
+  cqe = &ctx->ring->cq[ctx->cqtail % NAIOCQ];
+80100180:	83 e0 3f             	and    $0x3f,%eax
+  cqe->tag = tag;
+80100183:	05 c2 00 00 00       	add    $0xc2,%eax
+80100188:	89 1c c1             	mov    %ebx,(%ecx,%eax,8)
+  cqe->ret = ret;
+8010018b:	89 74 c1 04          	mov    %esi,0x4(%ecx,%eax,8)
+  ctx->cqtail++;
+8010018f:	8b 47 6c             	mov    0x6c(%edi),%eax
+  ctx->ring->cqtail = ctx->cqtail;
+80100192:	8b 4f 64             	mov    0x64(%edi),%ecx
+  ctx->cqtail++;
+80100195:	83 c0 01             	add    $0x1,%eax
+80100198:	89 47 6c             	mov    %eax,0x6c(%edi)
+  ctx->ring->cqtail = ctx->cqtail;
+8010019b:	89 41 0c             	mov    %eax,0xc(%ecx)
+  wakeup(ctx);
+8010019e:	89 3c 24             	mov    %edi,(%esp)
+801001a1:	e8 4a 5f 00 00       	call   801060f0 <wakeup>
+  r->busy = 0;
+801001a6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  r->next = ctx->free;
+  ctx->free = r;
+  ctx->inflight--;
+  release(&ctx->lock);
+801001a9:	83 c4 10             	add    $0x10,%esp
+  r->busy = 0;
+801001ac:	c7 42 34 00 00 00 00 	movl   $0x0,0x34(%edx)
+  r->next = ctx->free;
+801001b3:	8b 47 7c             	mov    0x7c(%edi),%eax
+801001b6:	89 42 30             	mov    %eax,0x30(%edx)
+  ctx->inflight--;
+801001b9:	83 6f 74 01          	subl   $0x1,0x74(%edi)
+  ctx->free = r;
+801001bd:	89 57 7c             	mov    %edx,0x7c(%edi)
+  release(&ctx->lock);
+801001c0:	89 7d 08             	mov    %edi,0x8(%ebp)
+}
+801001c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801001c6:	5b                   	pop    %ebx
+801001c7:	5e                   	pop    %esi
+801001c8:	5f                   	pop    %edi
+801001c9:	5d                   	pop    %ebp
+  release(&ctx->lock);
+801001ca:	e9 31 6d 00 00       	jmp    80106f00 <release>
+801001cf:	90                   	nop
+801001d0:	89 fa                	mov    %edi,%edx
+801001d2:	8b 7d d0             	mov    -0x30(%ebp),%edi
+801001d5:	e9 70 ff ff ff       	jmp    8010014a <aiorun+0x10a>
+801001da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  acquire(&ctx->lock);
+801001e0:	83 ec 0c             	sub    $0xc,%esp
+801001e3:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  for(q = ctx->req; q < &ctx->req[NAIOCQ]; ){
+801001e6:	8d b3 80 0f 00 00    	lea    0xf80(%ebx),%esi
+  acquire(&ctx->lock);
+801001ec:	53                   	push   %ebx
+801001ed:	e8 7e 6e 00 00       	call   80107070 <acquire>
+  for(q = ctx->req; q < &ctx->req[NAIOCQ]; ){
+801001f2:	8d 83 80 00 00 00    	lea    0x80(%ebx),%eax
+801001f8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+801001fb:	83 c4 10             	add    $0x10,%esp
+801001fe:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80100201:	eb 0c                	jmp    8010020f <aiorun+0x1cf>
+80100203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100207:	90                   	nop
+      q++;
+80100208:	83 c0 3c             	add    $0x3c,%eax
+  for(q = ctx->req; q < &ctx->req[NAIOCQ]; ){
+8010020b:	39 f0                	cmp    %esi,%eax
+8010020d:	73 31                	jae    80100240 <aiorun+0x200>
+    if(q->busy && q->f == r->f && (int)(r->seq - q->seq) > 0){
+8010020f:	8b 48 34             	mov    0x34(%eax),%ecx
+80100212:	85 c9                	test   %ecx,%ecx
+80100214:	74 f2                	je     80100208 <aiorun+0x1c8>
+80100216:	8b 4a 1c             	mov    0x1c(%edx),%ecx
+80100219:	39 48 1c             	cmp    %ecx,0x1c(%eax)
+8010021c:	75 ea                	jne    80100208 <aiorun+0x1c8>
+8010021e:	8b 4a 38             	mov    0x38(%edx),%ecx
+80100221:	2b 48 38             	sub    0x38(%eax),%ecx
+80100224:	85 c9                	test   %ecx,%ecx
+80100226:	7e e0                	jle    80100208 <aiorun+0x1c8>
+      sleep(ctx, &ctx->lock);
+80100228:	83 ec 08             	sub    $0x8,%esp
+8010022b:	89 55 e0             	mov    %edx,-0x20(%ebp)
+8010022e:	53                   	push   %ebx
+8010022f:	53                   	push   %ebx
+80100230:	e8 0b 5e 00 00       	call   80106040 <sleep>
+      q = ctx->req;
+80100235:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80100238:	8b 55 e0             	mov    -0x20(%ebp),%edx
+8010023b:	83 c4 10             	add    $0x10,%esp
+8010023e:	eb cb                	jmp    8010020b <aiorun+0x1cb>
+  release(&ctx->lock);
+80100240:	83 ec 0c             	sub    $0xc,%esp
+80100243:	89 55 e0             	mov    %edx,-0x20(%ebp)
+80100246:	53                   	push   %ebx
+80100247:	e8 b4 6c 00 00       	call   80106f00 <release>
+    return aiosync(r);
+8010024c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+8010024f:	83 c4 10             	add    $0x10,%esp
+80100252:	31 f6                	xor    %esi,%esi
+80100254:	e9 f1 fe ff ff       	jmp    8010014a <aiorun+0x10a>
+80100259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80100260 <aioinit>:
+
+void
+aioinit(void)
+{
+80100260:	55                   	push   %ebp
+80100261:	89 e5                	mov    %esp,%ebp
+80100263:	83 ec 0c             	sub    $0xc,%esp
+  wqinit(&aiowq, "aio", NAIOTHREAD);
+80100266:	6a 04                	push   $0x4
+80100268:	68 40 b6 10 80       	push   $0x8010b640
+8010026d:	68 00 d0 18 80       	push   $0x8018d000
+80100272:	e8 e9 b1 00 00       	call   8010b460 <wqinit>
+}
+80100277:	83 c4 10             	add    $0x10,%esp
+8010027a:	c9                   	leave
+8010027b:	c3                   	ret
+8010027c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80100280 <aiosetup>:
+
+// Give the current process a pair of rings at UAIO.
+int
+aiosetup(void)
+{
+80100280:	55                   	push   %ebp
+80100281:	89 e5                	mov    %esp,%ebp
+80100283:	57                   	push   %edi
+80100284:	56                   	push   %esi
+80100285:	53                   	push   %ebx
+80100286:	83 ec 0c             	sub    $0xc,%esp
+  struct proc *curproc = myproc();
+80100289:	e8 62 53 00 00       	call   801055f0 <myproc>
+  struct aioctx *ctx;
+  char *ring;
+  int i;
+
+  if(curproc->aio)
+8010028e:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+80100294:	85 d2                	test   %edx,%edx
+80100296:	0f 85 de 00 00 00    	jne    8010037a <aiosetup+0xfa>
+8010029c:	89 c3                	mov    %eax,%ebx
+    return -1;
+  if((ctx = (struct aioctx*)kalloc()) == 0)
+8010029e:	e8 1d 38 00 00       	call   80103ac0 <kalloc>
+801002a3:	89 c6                	mov    %eax,%esi
+801002a5:	85 c0                	test   %eax,%eax
+801002a7:	0f 84 cd 00 00 00    	je     8010037a <aiosetup+0xfa>
+    return -1;
+  if((ring = kalloc()) == 0){
+801002ad:	e8 0e 38 00 00       	call   80103ac0 <kalloc>
+801002b2:	89 c7                	mov    %eax,%edi
+801002b4:	85 c0                	test   %eax,%eax
+801002b6:	0f 84 c5 00 00 00    	je     80100381 <aiosetup+0x101>
+    kfree((char*)ctx);
+    return -1;
+  }
+  memset(ctx, 0, sizeof(*ctx));
+801002bc:	83 ec 04             	sub    $0x4,%esp
+801002bf:	68 80 0f 00 00       	push   $0xf80
+801002c4:	6a 00                	push   $0x0
+801002c6:	56                   	push   %esi
+801002c7:	e8 f4 70 00 00       	call   801073c0 <memset>
+  memset(ring, 0, PGSIZE);
+801002cc:	83 c4 0c             	add    $0xc,%esp
+801002cf:	68 00 10 00 00       	push   $0x1000
+801002d4:	6a 00                	push   $0x0
+801002d6:	57                   	push   %edi
+801002d7:	e8 e4 70 00 00       	call   801073c0 <memset>
+  // The page belongs to ctx, not the page table: aioexit() frees it.
+  if(mappages(curproc->pgdir, (char*)UAIO, PGSIZE, V2P(ring),
+801002dc:	8d 87 00 00 00 80    	lea    -0x80000000(%edi),%eax
+801002e2:	c7 04 24 06 02 00 00 	movl   $0x206,(%esp)
+801002e9:	50                   	push   %eax
+801002ea:	68 00 10 00 00       	push   $0x1000
+801002ef:	68 00 d0 ff 7f       	push   $0x7fffd000
+801002f4:	ff 73 04             	push   0x4(%ebx)
+801002f7:	e8 14 a7 00 00       	call   8010aa10 <mappages>
+801002fc:	83 c4 20             	add    $0x20,%esp
+801002ff:	85 c0                	test   %eax,%eax
+80100301:	78 63                	js     80100366 <aiosetup+0xe6>
+              PTE_W|PTE_U|PTE_SHARED) < 0){
+    kfree(ring);
+    kfree((char*)ctx);
+    return -1;
+  }
+  initlock(&ctx->lock, "aio");
+80100303:	83 ec 08             	sub    $0x8,%esp
+80100306:	68 40 b6 10 80       	push   $0x8010b640
+8010030b:	56                   	push   %esi
+8010030c:	e8 4f 66 00 00       	call   80106960 <initlock>
+  ctx->proc = curproc;
+80100311:	89 5e 60             	mov    %ebx,0x60(%esi)
+  ctx->ring = (struct aioring*)ring;
+80100314:	8b 56 7c             	mov    0x7c(%esi),%edx
+80100317:	83 c4 10             	add    $0x10,%esp
+8010031a:	89 7e 64             	mov    %edi,0x64(%esi)
+  for(i = 0; i < NAIOCQ; i++){
+8010031d:	8d 86 80 00 00 00    	lea    0x80(%esi),%eax
+80100323:	8d be 80 0f 00 00    	lea    0xf80(%esi),%edi
+80100329:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    ctx->req[i].ctx = ctx;
+80100330:	89 d1                	mov    %edx,%ecx
+80100332:	89 30                	mov    %esi,(%eax)
+    ctx->req[i].work.fn = aiorun;
+80100334:	89 c2                	mov    %eax,%edx
+80100336:	c7 40 20 40 00 10 80 	movl   $0x80100040,0x20(%eax)
+    ctx->req[i].work.arg = &ctx->req[i];
+8010033d:	89 40 24             	mov    %eax,0x24(%eax)
+  for(i = 0; i < NAIOCQ; i++){
+80100340:	83 c0 3c             	add    $0x3c,%eax
+    ctx->req[i].next = ctx->free;
+80100343:	89 48 f4             	mov    %ecx,-0xc(%eax)
+  for(i = 0; i < NAIOCQ; i++){
+80100346:	39 f8                	cmp    %edi,%eax
+80100348:	75 e6                	jne    80100330 <aiosetup+0xb0>
+    ctx->req[i].work.arg = &ctx->req[i];
+8010034a:	8d 86 44 0f 00 00    	lea    0xf44(%esi),%eax
+80100350:	89 46 7c             	mov    %eax,0x7c(%esi)
+    ctx->free = &ctx->req[i];
+  }
+  curproc->aio = ctx;
+  return UAIO;
+80100353:	b8 00 d0 ff 7f       	mov    $0x7fffd000,%eax
+  curproc->aio = ctx;
+80100358:	89 b3 a8 00 00 00    	mov    %esi,0xa8(%ebx)
+}
+8010035e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100361:	5b                   	pop    %ebx
+80100362:	5e                   	pop    %esi
+80100363:	5f                   	pop    %edi
+80100364:	5d                   	pop    %ebp
+80100365:	c3                   	ret
+    kfree(ring);
+80100366:	83 ec 0c             	sub    $0xc,%esp
+80100369:	57                   	push   %edi
+8010036a:	e8 81 35 00 00       	call   801038f0 <kfree>
+    kfree((char*)ctx);
+8010036f:	89 34 24             	mov    %esi,(%esp)
+80100372:	e8 79 35 00 00       	call   801038f0 <kfree>
+    return -1;
+80100377:	83 c4 10             	add    $0x10,%esp
+    return -1;
+8010037a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010037f:	eb dd                	jmp    8010035e <aiosetup+0xde>
+    kfree((char*)ctx);
+80100381:	83 ec 0c             	sub    $0xc,%esp
+80100384:	56                   	push   %esi
+80100385:	e8 66 35 00 00       	call   801038f0 <kfree>
+    return -1;
+8010038a:	83 c4 10             	add    $0x10,%esp
+8010038d:	eb eb                	jmp    8010037a <aiosetup+0xfa>
+8010038f:	90                   	nop
+
+80100390 <aiowait>:
+// Submit everything new in the submission ring, then wait
+// until at least min completions are waiting to be consumed,
+// or no more can arrive.  Returns the number waiting.
+int
+aiowait(int min)
+{
+80100390:	55                   	push   %ebp
+80100391:	89 e5                	mov    %esp,%ebp
+80100393:	57                   	push   %edi
+80100394:	56                   	push   %esi
+80100395:	53                   	push   %ebx
+80100396:	83 ec 2c             	sub    $0x2c,%esp
+80100399:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct proc *curproc = myproc();
+8010039c:	e8 4f 52 00 00       	call   801055f0 <myproc>
+  struct aioctx *ctx = curproc->aio;
+801003a1:	8b 98 a8 00 00 00    	mov    0xa8(%eax),%ebx
+  struct proc *curproc = myproc();
+801003a7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  struct aioring *ring;
+  struct aioreq *r;
+  int n;
+
+  if(ctx == 0)
+801003aa:	85 db                	test   %ebx,%ebx
+801003ac:	0f 84 2a 02 00 00    	je     801005dc <aiowait+0x24c>
+    return -1;
+  ring = ctx->ring;
+801003b2:	8b 7b 64             	mov    0x64(%ebx),%edi
+  acquire(&ctx->lock);
+801003b5:	83 ec 0c             	sub    $0xc,%esp
+  ring = ctx->ring;
+801003b8:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  acquire(&ctx->lock);
+801003bb:	53                   	push   %ebx
+801003bc:	e8 af 6c 00 00       	call   80107070 <acquire>
+  while(ctx->sqhead != ring->sqtail && ctx->free != 0 &&
+801003c1:	8b 4b 68             	mov    0x68(%ebx),%ecx
+801003c4:	8b 47 04             	mov    0x4(%edi),%eax
+801003c7:	83 c4 10             	add    $0x10,%esp
+801003ca:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+801003cd:	39 c1                	cmp    %eax,%ecx
+801003cf:	0f 84 27 02 00 00    	je     801005fc <aiowait+0x26c>
+801003d5:	89 75 08             	mov    %esi,0x8(%ebp)
+801003d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801003df:	90                   	nop
+  if(h - ctx->cqhead <= ctx->cqtail - ctx->cqhead)
+801003e0:	8b 4b 6c             	mov    0x6c(%ebx),%ecx
+801003e3:	8b 7b 70             	mov    0x70(%ebx),%edi
+  h = ctx->ring->cqhead;
+801003e6:	8b 53 64             	mov    0x64(%ebx),%edx
+  while(ctx->sqhead != ring->sqtail && ctx->free != 0 &&
+801003e9:	8b 73 7c             	mov    0x7c(%ebx),%esi
+  if(h - ctx->cqhead <= ctx->cqtail - ctx->cqhead)
+801003ec:	89 c8                	mov    %ecx,%eax
+801003ee:	29 f8                	sub    %edi,%eax
+  h = ctx->ring->cqhead;
+801003f0:	89 55 d0             	mov    %edx,-0x30(%ebp)
+  if(h - ctx->cqhead <= ctx->cqtail - ctx->cqhead)
+801003f3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  while(ctx->sqhead != ring->sqtail && ctx->free != 0 &&
+801003f6:	85 f6                	test   %esi,%esi
+801003f8:	0f 84 c2 01 00 00    	je     801005c0 <aiowait+0x230>
+        ctx->inflight + aiopending(ctx) < NAIOCQ){
+801003fe:	8b 43 74             	mov    0x74(%ebx),%eax
+  h = ctx->ring->cqhead;
+80100401:	8b 52 08             	mov    0x8(%edx),%edx
+        ctx->inflight + aiopending(ctx) < NAIOCQ){
+80100404:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  if(h - ctx->cqhead <= ctx->cqtail - ctx->cqhead)
+80100407:	89 d0                	mov    %edx,%eax
+80100409:	29 f8                	sub    %edi,%eax
+8010040b:	39 45 d8             	cmp    %eax,-0x28(%ebp)
+8010040e:	72 05                	jb     80100415 <aiowait+0x85>
+    ctx->cqhead = h;
+80100410:	89 53 70             	mov    %edx,0x70(%ebx)
+80100413:	89 d7                	mov    %edx,%edi
+        ctx->inflight + aiopending(ctx) < NAIOCQ){
+80100415:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80100418:	01 c8                	add    %ecx,%eax
+8010041a:	29 f8                	sub    %edi,%eax
+  while(ctx->sqhead != ring->sqtail && ctx->free != 0 &&
+8010041c:	83 f8 3f             	cmp    $0x3f,%eax
+8010041f:	0f 87 cb 01 00 00    	ja     801005f0 <aiowait+0x260>
+    r = ctx->free;
+    r->sqe = ring->sq[ctx->sqhead % NAIOSQ];
+80100425:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80100428:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+8010042b:	83 e0 3f             	and    $0x3f,%eax
+8010042e:	8d 04 40             	lea    (%eax,%eax,2),%eax
+80100431:	8d 14 c1             	lea    (%ecx,%eax,8),%edx
+80100434:	8d 42 10             	lea    0x10(%edx),%eax
+80100437:	8b 52 10             	mov    0x10(%edx),%edx
+8010043a:	89 56 04             	mov    %edx,0x4(%esi)
+8010043d:	8b 50 04             	mov    0x4(%eax),%edx
+80100440:	89 56 08             	mov    %edx,0x8(%esi)
+80100443:	8b 50 08             	mov    0x8(%eax),%edx
+80100446:	89 56 0c             	mov    %edx,0xc(%esi)
+80100449:	8b 50 0c             	mov    0xc(%eax),%edx
+8010044c:	89 56 10             	mov    %edx,0x10(%esi)
+8010044f:	8b 50 10             	mov    0x10(%eax),%edx
+80100452:	89 56 14             	mov    %edx,0x14(%esi)
+80100455:	8b 40 14             	mov    0x14(%eax),%eax
+80100458:	89 46 18             	mov    %eax,0x18(%esi)
+    ctx->sqhead++;
+8010045b:	8b 43 68             	mov    0x68(%ebx),%eax
+8010045e:	83 c0 01             	add    $0x1,%eax
+80100461:	89 43 68             	mov    %eax,0x68(%ebx)
+    ring->sqhead = ctx->sqhead;
+80100464:	89 01                	mov    %eax,(%ecx)
+  if(sqe->fd < 0 || sqe->fd >= NOFILE || p->ofile[sqe->fd] == 0)
+80100466:	8b 46 08             	mov    0x8(%esi),%eax
+80100469:	83 f8 0f             	cmp    $0xf,%eax
+8010046c:	77 42                	ja     801004b0 <aiowait+0x120>
+8010046e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80100471:	8b 44 87 30          	mov    0x30(%edi,%eax,4),%eax
+80100475:	85 c0                	test   %eax,%eax
+80100477:	74 37                	je     801004b0 <aiowait+0x120>
+  if(sqe->op == AIO_FSYNC)
+80100479:	8b 46 04             	mov    0x4(%esi),%eax
+8010047c:	83 f8 03             	cmp    $0x3,%eax
+8010047f:	0f 84 eb 00 00 00    	je     80100570 <aiowait+0x1e0>
+  if(sqe->op != AIO_READ && sqe->op != AIO_WRITE)
+80100485:	83 e8 01             	sub    $0x1,%eax
+80100488:	83 f8 01             	cmp    $0x1,%eax
+8010048b:	77 23                	ja     801004b0 <aiowait+0x120>
+  return sqe->n < 0 || sqe->addr >= p->sz || sqe->n > p->sz - sqe->addr;
+8010048d:	8b 46 10             	mov    0x10(%esi),%eax
+80100490:	85 c0                	test   %eax,%eax
+80100492:	78 1c                	js     801004b0 <aiowait+0x120>
+80100494:	8b 4e 0c             	mov    0xc(%esi),%ecx
+80100497:	8b 17                	mov    (%edi),%edx
+80100499:	39 d1                	cmp    %edx,%ecx
+8010049b:	73 13                	jae    801004b0 <aiowait+0x120>
+8010049d:	29 ca                	sub    %ecx,%edx
+8010049f:	39 c2                	cmp    %eax,%edx
+801004a1:	0f 83 c9 00 00 00    	jae    80100570 <aiowait+0x1e0>
+801004a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801004ae:	66 90                	xchg   %ax,%ax
+  cqe = &ctx->ring->cq[ctx->cqtail % NAIOCQ];
+801004b0:	8b 43 6c             	mov    0x6c(%ebx),%eax
+
+    if(aiobad(curproc, &r->sqe)){
+      aiopost(ctx, r->sqe.tag, -1);
+801004b3:	8b 4e 18             	mov    0x18(%esi),%ecx
+  wakeup(ctx);
+801004b6:	83 ec 0c             	sub    $0xc,%esp
+  cqe = &ctx->ring->cq[ctx->cqtail % NAIOCQ];
+801004b9:	8b 53 64             	mov    0x64(%ebx),%edx
+801004bc:	83 e0 3f             	and    $0x3f,%eax
+  cqe->tag = tag;
+801004bf:	05 c2 00 00 00       	add    $0xc2,%eax
+801004c4:	89 0c c2             	mov    %ecx,(%edx,%eax,8)
+  cqe->ret = ret;
+801004c7:	c7 44 c2 04 ff ff ff 	movl   $0xffffffff,0x4(%edx,%eax,8)
+801004ce:	ff 
+  ctx->cqtail++;
+801004cf:	8b 43 6c             	mov    0x6c(%ebx),%eax
+  ctx->ring->cqtail = ctx->cqtail;
+801004d2:	8b 53 64             	mov    0x64(%ebx),%edx
+  ctx->cqtail++;
+801004d5:	83 c0 01             	add    $0x1,%eax
+801004d8:	89 43 6c             	mov    %eax,0x6c(%ebx)
+  ctx->ring->cqtail = ctx->cqtail;
+801004db:	89 42 0c             	mov    %eax,0xc(%edx)
+  wakeup(ctx);
+801004de:	53                   	push   %ebx
+801004df:	e8 0c 5c 00 00       	call   801060f0 <wakeup>
+      continue;
+801004e4:	83 c4 10             	add    $0x10,%esp
+  while(ctx->sqhead != ring->sqtail && ctx->free != 0 &&
+801004e7:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801004ea:	8b 7b 68             	mov    0x68(%ebx),%edi
+801004ed:	8b 40 04             	mov    0x4(%eax),%eax
+801004f0:	89 7d e0             	mov    %edi,-0x20(%ebp)
+801004f3:	39 c7                	cmp    %eax,%edi
+801004f5:	0f 85 e5 fe ff ff    	jne    801003e0 <aiowait+0x50>
+  h = ctx->ring->cqhead;
+801004fb:	8b 4b 64             	mov    0x64(%ebx),%ecx
+  if(h - ctx->cqhead <= ctx->cqtail - ctx->cqhead)
+801004fe:	8b 7b 70             	mov    0x70(%ebx),%edi
+80100501:	8b 73 6c             	mov    0x6c(%ebx),%esi
+80100504:	eb 35                	jmp    8010053b <aiowait+0x1ab>
+80100506:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010050d:	8d 76 00             	lea    0x0(%esi),%esi
+    r->seq = ctx->nsubmit++;
+    r->f = filedup(curproc->ofile[r->sqe.fd]);
+    queuework(&aiowq, &r->work);
+  }
+
+  while((n = aiopending(ctx)) < min && ctx->inflight > 0){
+80100510:	8b 53 74             	mov    0x74(%ebx),%edx
+80100513:	85 d2                	test   %edx,%edx
+80100515:	7e 3f                	jle    80100556 <aiowait+0x1c6>
+    if(curproc->killed){
+80100517:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010051a:	8b 48 2c             	mov    0x2c(%eax),%ecx
+8010051d:	85 c9                	test   %ecx,%ecx
+8010051f:	0f 85 ab 00 00 00    	jne    801005d0 <aiowait+0x240>
+      release(&ctx->lock);
+      return -1;
+    }
+    sleep(ctx, &ctx->lock);
+80100525:	83 ec 08             	sub    $0x8,%esp
+80100528:	53                   	push   %ebx
+80100529:	53                   	push   %ebx
+8010052a:	e8 11 5b 00 00       	call   80106040 <sleep>
+  h = ctx->ring->cqhead;
+8010052f:	8b 4b 64             	mov    0x64(%ebx),%ecx
+  if(h - ctx->cqhead <= ctx->cqtail - ctx->cqhead)
+80100532:	8b 7b 70             	mov    0x70(%ebx),%edi
+80100535:	83 c4 10             	add    $0x10,%esp
+80100538:	8b 73 6c             	mov    0x6c(%ebx),%esi
+  h = ctx->ring->cqhead;
+8010053b:	8b 51 08             	mov    0x8(%ecx),%edx
+  if(h - ctx->cqhead <= ctx->cqtail - ctx->cqhead)
+8010053e:	89 f0                	mov    %esi,%eax
+80100540:	29 f8                	sub    %edi,%eax
+80100542:	89 d1                	mov    %edx,%ecx
+80100544:	29 f9                	sub    %edi,%ecx
+80100546:	39 c8                	cmp    %ecx,%eax
+80100548:	72 07                	jb     80100551 <aiowait+0x1c1>
+    ctx->cqhead = h;
+8010054a:	89 53 70             	mov    %edx,0x70(%ebx)
+  return ctx->cqtail - ctx->cqhead;
+8010054d:	89 f0                	mov    %esi,%eax
+8010054f:	29 d0                	sub    %edx,%eax
+  while((n = aiopending(ctx)) < min && ctx->inflight > 0){
+80100551:	3b 45 08             	cmp    0x8(%ebp),%eax
+80100554:	7c ba                	jl     80100510 <aiowait+0x180>
+  }
+  release(&ctx->lock);
+80100556:	83 ec 0c             	sub    $0xc,%esp
+80100559:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010055c:	53                   	push   %ebx
+8010055d:	e8 9e 69 00 00       	call   80106f00 <release>
+  return n;
+80100562:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80100565:	83 c4 10             	add    $0x10,%esp
+}
+80100568:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010056b:	5b                   	pop    %ebx
+8010056c:	5e                   	pop    %esi
+8010056d:	5f                   	pop    %edi
+8010056e:	5d                   	pop    %ebp
+8010056f:	c3                   	ret
+    ctx->free = r->next;
+80100570:	8b 46 30             	mov    0x30(%esi),%eax
+    ctx->inflight++;
+80100573:	83 43 74 01          	addl   $0x1,0x74(%ebx)
+    r->f = filedup(curproc->ofile[r->sqe.fd]);
+80100577:	83 ec 0c             	sub    $0xc,%esp
+    queuework(&aiowq, &r->work);
+8010057a:	83 c6 20             	add    $0x20,%esi
+    r->f = filedup(curproc->ofile[r->sqe.fd]);
+8010057d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    ctx->free = r->next;
+80100580:	89 43 7c             	mov    %eax,0x7c(%ebx)
+    r->busy = 1;
+80100583:	c7 46 14 01 00 00 00 	movl   $0x1,0x14(%esi)
+    r->seq = ctx->nsubmit++;
+8010058a:	8b 43 78             	mov    0x78(%ebx),%eax
+8010058d:	8d 50 01             	lea    0x1(%eax),%edx
+80100590:	89 53 78             	mov    %edx,0x78(%ebx)
+80100593:	89 46 18             	mov    %eax,0x18(%esi)
+    r->f = filedup(curproc->ofile[r->sqe.fd]);
+80100596:	8b 46 e8             	mov    -0x18(%esi),%eax
+80100599:	ff 74 87 30          	push   0x30(%edi,%eax,4)
+8010059d:	e8 5e 1c 00 00       	call   80102200 <filedup>
+801005a2:	89 46 fc             	mov    %eax,-0x4(%esi)
+    queuework(&aiowq, &r->work);
+801005a5:	5f                   	pop    %edi
+801005a6:	58                   	pop    %eax
+801005a7:	56                   	push   %esi
+801005a8:	68 00 d0 18 80       	push   $0x8018d000
+801005ad:	e8 1e af 00 00       	call   8010b4d0 <queuework>
+801005b2:	83 c4 10             	add    $0x10,%esp
+801005b5:	e9 2d ff ff ff       	jmp    801004e7 <aiowait+0x157>
+801005ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+801005c0:	89 ce                	mov    %ecx,%esi
+801005c2:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+801005c5:	e9 71 ff ff ff       	jmp    8010053b <aiowait+0x1ab>
+801005ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      release(&ctx->lock);
+801005d0:	83 ec 0c             	sub    $0xc,%esp
+801005d3:	53                   	push   %ebx
+801005d4:	e8 27 69 00 00       	call   80106f00 <release>
+      return -1;
+801005d9:	83 c4 10             	add    $0x10,%esp
+}
+801005dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return -1;
+801005df:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801005e4:	5b                   	pop    %ebx
+801005e5:	5e                   	pop    %esi
+801005e6:	5f                   	pop    %edi
+801005e7:	5d                   	pop    %ebp
+801005e8:	c3                   	ret
+801005e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801005f0:	89 c8                	mov    %ecx,%eax
+801005f2:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+801005f5:	89 c6                	mov    %eax,%esi
+801005f7:	e9 3f ff ff ff       	jmp    8010053b <aiowait+0x1ab>
+  if(h - ctx->cqhead <= ctx->cqtail - ctx->cqhead)
+801005fc:	8b 43 6c             	mov    0x6c(%ebx),%eax
+  h = ctx->ring->cqhead;
+801005ff:	8b 4b 64             	mov    0x64(%ebx),%ecx
+80100602:	89 75 08             	mov    %esi,0x8(%ebp)
+  if(h - ctx->cqhead <= ctx->cqtail - ctx->cqhead)
+80100605:	8b 7b 70             	mov    0x70(%ebx),%edi
+80100608:	89 c6                	mov    %eax,%esi
+8010060a:	e9 2c ff ff ff       	jmp    8010053b <aiowait+0x1ab>
+8010060f:	90                   	nop
+
+80100610 <aiodrain>:
+
+// Wait for the current process's requests to finish.
+void
+aiodrain(void)
+{
+80100610:	55                   	push   %ebp
+80100611:	89 e5                	mov    %esp,%ebp
+80100613:	53                   	push   %ebx
+80100614:	83 ec 04             	sub    $0x4,%esp
+  struct aioctx *ctx = myproc()->aio;
+80100617:	e8 d4 4f 00 00       	call   801055f0 <myproc>
+8010061c:	8b 98 a8 00 00 00    	mov    0xa8(%eax),%ebx
+
+  if(ctx == 0)
+80100622:	85 db                	test   %ebx,%ebx
+80100624:	74 3a                	je     80100660 <aiodrain+0x50>
+    return;
+  acquire(&ctx->lock);
+80100626:	83 ec 0c             	sub    $0xc,%esp
+80100629:	53                   	push   %ebx
+8010062a:	e8 41 6a 00 00       	call   80107070 <acquire>
+  while(ctx->inflight > 0)
+8010062f:	8b 53 74             	mov    0x74(%ebx),%edx
+80100632:	83 c4 10             	add    $0x10,%esp
+80100635:	85 d2                	test   %edx,%edx
+80100637:	7e 1b                	jle    80100654 <aiodrain+0x44>
+80100639:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    sleep(ctx, &ctx->lock);
+80100640:	83 ec 08             	sub    $0x8,%esp
+80100643:	53                   	push   %ebx
+80100644:	53                   	push   %ebx
+80100645:	e8 f6 59 00 00       	call   80106040 <sleep>
+  while(ctx->inflight > 0)
+8010064a:	8b 43 74             	mov    0x74(%ebx),%eax
+8010064d:	83 c4 10             	add    $0x10,%esp
+80100650:	85 c0                	test   %eax,%eax
+80100652:	7f ec                	jg     80100640 <aiodrain+0x30>
+  release(&ctx->lock);
+80100654:	83 ec 0c             	sub    $0xc,%esp
+80100657:	53                   	push   %ebx
+80100658:	e8 a3 68 00 00       	call   80106f00 <release>
+8010065d:	83 c4 10             	add    $0x10,%esp
+}
+80100660:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100663:	c9                   	leave
+80100664:	c3                   	ret
+80100665:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010066c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80100670 <aioexit>:
+
+// Tear down the current process's rings, in exit() or
+// once exec() has replaced the page table that mapped them.
+void
+aioexit(void)
+{
+80100670:	55                   	push   %ebp
+80100671:	89 e5                	mov    %esp,%ebp
+80100673:	57                   	push   %edi
+80100674:	56                   	push   %esi
+80100675:	53                   	push   %ebx
+80100676:	83 ec 0c             	sub    $0xc,%esp
+  struct proc *curproc = myproc();
+80100679:	e8 72 4f 00 00       	call   801055f0 <myproc>
+  struct aioctx *ctx = curproc->aio;
+8010067e:	8b b8 a8 00 00 00    	mov    0xa8(%eax),%edi
+
+  if(ctx == 0)
+80100684:	85 ff                	test   %edi,%edi
+80100686:	74 6f                	je     801006f7 <aioexit+0x87>
+80100688:	89 c6                	mov    %eax,%esi
+  struct aioctx *ctx = myproc()->aio;
+8010068a:	e8 61 4f 00 00       	call   801055f0 <myproc>
+8010068f:	8b 98 a8 00 00 00    	mov    0xa8(%eax),%ebx
+  if(ctx == 0)
+80100695:	85 db                	test   %ebx,%ebx
+80100697:	74 37                	je     801006d0 <aioexit+0x60>
+  acquire(&ctx->lock);
+80100699:	83 ec 0c             	sub    $0xc,%esp
+8010069c:	53                   	push   %ebx
+8010069d:	e8 ce 69 00 00       	call   80107070 <acquire>
+  while(ctx->inflight > 0)
+801006a2:	8b 4b 74             	mov    0x74(%ebx),%ecx
+801006a5:	83 c4 10             	add    $0x10,%esp
+801006a8:	85 c9                	test   %ecx,%ecx
+801006aa:	7e 18                	jle    801006c4 <aioexit+0x54>
+801006ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    sleep(ctx, &ctx->lock);
+801006b0:	83 ec 08             	sub    $0x8,%esp
+801006b3:	53                   	push   %ebx
+801006b4:	53                   	push   %ebx
+801006b5:	e8 86 59 00 00       	call   80106040 <sleep>
+  while(ctx->inflight > 0)
+801006ba:	8b 53 74             	mov    0x74(%ebx),%edx
+801006bd:	83 c4 10             	add    $0x10,%esp
+801006c0:	85 d2                	test   %edx,%edx
+801006c2:	7f ec                	jg     801006b0 <aioexit+0x40>
+  release(&ctx->lock);
+801006c4:	83 ec 0c             	sub    $0xc,%esp
+801006c7:	53                   	push   %ebx
+801006c8:	e8 33 68 00 00       	call   80106f00 <release>
+801006cd:	83 c4 10             	add    $0x10,%esp
+    return;
+  aiodrain();
+  curproc->aio = 0;
+801006d0:	c7 86 a8 00 00 00 00 	movl   $0x0,0xa8(%esi)
+801006d7:	00 00 00 
+  freelock(&ctx->lock);
+801006da:	83 ec 0c             	sub    $0xc,%esp
+801006dd:	57                   	push   %edi
+801006de:	e8 dd 63 00 00       	call   80106ac0 <freelock>
+  kfree((char*)ctx->ring);
+801006e3:	58                   	pop    %eax
+801006e4:	ff 77 64             	push   0x64(%edi)
+801006e7:	e8 04 32 00 00       	call   801038f0 <kfree>
+  kfree((char*)ctx);
+801006ec:	89 3c 24             	mov    %edi,(%esp)
+801006ef:	e8 fc 31 00 00       	call   801038f0 <kfree>
+801006f4:	83 c4 10             	add    $0x10,%esp
+}
+801006f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801006fa:	5b                   	pop    %ebx
+801006fb:	5e                   	pop    %esi
+801006fc:	5f                   	pop    %edi
+801006fd:	5d                   	pop    %ebp
+801006fe:	c3                   	ret
+801006ff:	90                   	nop
+
+80100700 <addbuf>:
+}
+
+// Add b to the cache as a spare.  Caller must hold evictlock.
+static void
+addbuf(struct buf *b)
+{
+80100700:	55                   	push   %ebp
+80100701:	89 e5                	mov    %esp,%ebp
+80100703:	53                   	push   %ebx
+80100704:	89 c3                	mov    %eax,%ebx
+  initsleeplock(&b->lock, "buffer");
+80100706:	83 c0 0c             	add    $0xc,%eax
+{
+80100709:	83 ec 0c             	sub    $0xc,%esp
+  initsleeplock(&b->lock, "buffer");
+8010070c:	68 44 b6 10 80       	push   $0x8010b644
+80100711:	50                   	push   %eax
+80100712:	e8 49 5e 00 00       	call   80106560 <initsleeplock>
+  b->dev = NODEV;
+80100717:	c7 43 04 ff ff ff ff 	movl   $0xffffffff,0x4(%ebx)
+  b->flags = 0;
+  b->refcnt = 0;
+  b->used = 0;
+  b->hnext = bcache.spare;
+  bcache.spare = b;
+  if(bcache.hand == 0){
+8010071e:	83 c4 10             	add    $0x10,%esp
+  b->flags = 0;
+80100721:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  b->refcnt = 0;
+80100727:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+8010072e:	00 00 00 
+  b->used = 0;
+80100731:	c7 83 8c 00 00 00 00 	movl   $0x0,0x8c(%ebx)
+80100738:	00 00 00 
+  b->hnext = bcache.spare;
+8010073b:	a1 e0 02 1a 80       	mov    0x801a02e0,%eax
+80100740:	89 83 90 00 00 00    	mov    %eax,0x90(%ebx)
+  if(bcache.hand == 0){
+80100746:	a1 e4 02 1a 80       	mov    0x801a02e4,%eax
+  bcache.spare = b;
+8010074b:	89 1d e0 02 1a 80    	mov    %ebx,0x801a02e0
+  if(bcache.hand == 0){
+80100751:	85 c0                	test   %eax,%eax
+80100753:	74 33                	je     80100788 <addbuf+0x88>
+    b->anext = b->aprev = b;
+    bcache.hand = b;
+  } else {
+    b->anext = bcache.hand;
+80100755:	89 83 94 00 00 00    	mov    %eax,0x94(%ebx)
+    b->aprev = bcache.hand->aprev;
+8010075b:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+80100761:	89 83 98 00 00 00    	mov    %eax,0x98(%ebx)
+    b->aprev->anext = b;
+80100767:	89 98 94 00 00 00    	mov    %ebx,0x94(%eax)
+    bcache.hand->aprev = b;
+8010076d:	a1 e4 02 1a 80       	mov    0x801a02e4,%eax
+80100772:	89 98 98 00 00 00    	mov    %ebx,0x98(%eax)
+  }
+  bcache.nbuf++;
+80100778:	83 05 dc 02 1a 80 01 	addl   $0x1,0x801a02dc
+}
+8010077f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100782:	c9                   	leave
+80100783:	c3                   	ret
+80100784:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    b->anext = b->aprev = b;
+80100788:	89 9b 98 00 00 00    	mov    %ebx,0x98(%ebx)
+8010078e:	89 9b 94 00 00 00    	mov    %ebx,0x94(%ebx)
+    bcache.hand = b;
+80100794:	89 1d e4 02 1a 80    	mov    %ebx,0x801a02e4
+  bcache.nbuf++;
+8010079a:	83 05 dc 02 1a 80 01 	addl   $0x1,0x801a02dc
+}
+801007a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801007a4:	c9                   	leave
+801007a5:	c3                   	ret
+801007a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801007ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+801007b0 <bget>:
+// A hit takes only the block's bucket lock.  Misses are
+// serialized by evictlock, so that two processes cannot both
+// bring in the same block.
+static struct buf*
+bget(uint dev, uint blockno, int ra)
+{
+801007b0:	55                   	push   %ebp
+801007b1:	89 e5                	mov    %esp,%ebp
+801007b3:	57                   	push   %edi
+801007b4:	89 d7                	mov    %edx,%edi
+801007b6:	56                   	push   %esi
+801007b7:	89 c6                	mov    %eax,%esi
+801007b9:	53                   	push   %ebx
+801007ba:	83 ec 38             	sub    $0x38,%esp
+801007bd:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  return &bcache.bucket[(dev*31 + blockno) % NBUCKET];
+801007c0:	89 c1                	mov    %eax,%ecx
+801007c2:	c1 e1 05             	shl    $0x5,%ecx
+801007c5:	29 c1                	sub    %eax,%ecx
+801007c7:	b8 b3 21 c1 80       	mov    $0x80c121b3,%eax
+801007cc:	01 d1                	add    %edx,%ecx
+801007ce:	f7 e1                	mul    %ecx
+801007d0:	c1 ea 08             	shr    $0x8,%edx
+801007d3:	69 c2 fd 01 00 00    	imul   $0x1fd,%edx,%eax
+801007d9:	29 c1                	sub    %eax,%ecx
+  struct bufpage *pg;
+  struct buf *b;
+  int i;
+
+  bk = bucketfor(dev, blockno);
+  acquire(&bk->lock);
+801007db:	6b c1 64             	imul   $0x64,%ecx,%eax
+  return &bcache.bucket[(dev*31 + blockno) % NBUCKET];
+801007de:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  acquire(&bk->lock);
+801007e1:	05 00 d1 18 80       	add    $0x8018d100,%eax
+801007e6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801007e9:	89 c3                	mov    %eax,%ebx
+801007eb:	50                   	push   %eax
+801007ec:	e8 7f 68 00 00       	call   80107070 <acquire>
+  for(b = bk->head; b; b = b->hnext)
+801007f1:	8b 5b 60             	mov    0x60(%ebx),%ebx
+801007f4:	83 c4 10             	add    $0x10,%esp
+801007f7:	85 db                	test   %ebx,%ebx
+801007f9:	75 0f                	jne    8010080a <bget+0x5a>
+801007fb:	eb 63                	jmp    80100860 <bget+0xb0>
+801007fd:	8d 76 00             	lea    0x0(%esi),%esi
+80100800:	8b 9b 90 00 00 00    	mov    0x90(%ebx),%ebx
+80100806:	85 db                	test   %ebx,%ebx
+80100808:	74 56                	je     80100860 <bget+0xb0>
+    if(b->dev == dev && b->blockno == blockno)
+8010080a:	3b 73 04             	cmp    0x4(%ebx),%esi
+8010080d:	75 f1                	jne    80100800 <bget+0x50>
+8010080f:	3b 7b 08             	cmp    0x8(%ebx),%edi
+80100812:	75 ec                	jne    80100800 <bget+0x50>
+  release(&bcache.evictlock);
+  acquiresleep(&b->lock);
+  return b;
+
+found:
+  if(ra){
+80100814:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80100817:	85 c0                	test   %eax,%eax
+80100819:	0f 85 c1 00 00 00    	jne    801008e0 <bget+0x130>
+    release(&bk->lock);
+    return 0;
+  }
+  mycpu()->nbhit++;
+8010081f:	e8 bc 4d 00 00       	call   801055e0 <mycpu>
+  b->refcnt++;
+  b->used = 1;
+  release(&bk->lock);
+80100824:	83 ec 0c             	sub    $0xc,%esp
+  mycpu()->nbhit++;
+80100827:	83 80 c0 00 00 00 01 	addl   $0x1,0xc0(%eax)
+  b->used = 1;
+8010082e:	c7 83 8c 00 00 00 01 	movl   $0x1,0x8c(%ebx)
+80100835:	00 00 00 
+  b->refcnt++;
+80100838:	83 83 88 00 00 00 01 	addl   $0x1,0x88(%ebx)
+  release(&bk->lock);
+8010083f:	ff 75 e4             	push   -0x1c(%ebp)
+80100842:	e8 b9 66 00 00       	call   80106f00 <release>
+  acquiresleep(&b->lock);
+80100847:	8d 43 0c             	lea    0xc(%ebx),%eax
+8010084a:	89 04 24             	mov    %eax,(%esp)
+8010084d:	e8 5e 5d 00 00       	call   801065b0 <acquiresleep>
+  return b;
+80100852:	83 c4 10             	add    $0x10,%esp
+}
+80100855:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100858:	89 d8                	mov    %ebx,%eax
+8010085a:	5b                   	pop    %ebx
+8010085b:	5e                   	pop    %esi
+8010085c:	5f                   	pop    %edi
+8010085d:	5d                   	pop    %ebp
+8010085e:	c3                   	ret
+8010085f:	90                   	nop
+  release(&bk->lock);
+80100860:	83 ec 0c             	sub    $0xc,%esp
+80100863:	ff 75 e4             	push   -0x1c(%ebp)
+80100866:	e8 95 66 00 00       	call   80106f00 <release>
+  if(bcache.spare == 0 && bcache.npage < NBUFPAGE && kfreepages() > BUFRESERVE)
+8010086b:	a1 e0 02 1a 80       	mov    0x801a02e0,%eax
+80100870:	83 c4 10             	add    $0x10,%esp
+80100873:	85 c0                	test   %eax,%eax
+80100875:	0f 84 13 01 00 00    	je     8010098e <bget+0x1de>
+  acquire(&bcache.evictlock);
+8010087b:	83 ec 0c             	sub    $0xc,%esp
+8010087e:	68 d4 97 19 80       	push   $0x801997d4
+80100883:	e8 e8 67 00 00       	call   80107070 <acquire>
+80100888:	83 c4 10             	add    $0x10,%esp
+  acquire(&bk->lock);
+8010088b:	83 ec 0c             	sub    $0xc,%esp
+8010088e:	ff 75 e4             	push   -0x1c(%ebp)
+80100891:	e8 da 67 00 00       	call   80107070 <acquire>
+  for(b = bk->head; b; b = b->hnext)
+80100896:	6b 45 dc 64          	imul   $0x64,-0x24(%ebp),%eax
+8010089a:	83 c4 10             	add    $0x10,%esp
+8010089d:	8b 98 60 d1 18 80    	mov    -0x7fe72ea0(%eax),%ebx
+801008a3:	85 db                	test   %ebx,%ebx
+801008a5:	75 13                	jne    801008ba <bget+0x10a>
+801008a7:	eb 57                	jmp    80100900 <bget+0x150>
+801008a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801008b0:	8b 9b 90 00 00 00    	mov    0x90(%ebx),%ebx
+801008b6:	85 db                	test   %ebx,%ebx
+801008b8:	74 46                	je     80100900 <bget+0x150>
+    if(b->dev == dev && b->blockno == blockno)
+801008ba:	3b 73 04             	cmp    0x4(%ebx),%esi
+801008bd:	75 f1                	jne    801008b0 <bget+0x100>
+801008bf:	3b 7b 08             	cmp    0x8(%ebx),%edi
+801008c2:	75 ec                	jne    801008b0 <bget+0x100>
+    release(&bcache.evictlock);
+801008c4:	83 ec 0c             	sub    $0xc,%esp
+801008c7:	68 d4 97 19 80       	push   $0x801997d4
+801008cc:	e8 2f 66 00 00       	call   80106f00 <release>
+  if(ra){
+801008d1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    goto found;
+801008d4:	83 c4 10             	add    $0x10,%esp
+  if(ra){
+801008d7:	85 c0                	test   %eax,%eax
+801008d9:	0f 84 40 ff ff ff    	je     8010081f <bget+0x6f>
+801008df:	90                   	nop
+    release(&bk->lock);
+801008e0:	83 ec 0c             	sub    $0xc,%esp
+801008e3:	ff 75 e4             	push   -0x1c(%ebp)
+      return 0;
+801008e6:	31 db                	xor    %ebx,%ebx
+    release(&bk->lock);
+801008e8:	e8 13 66 00 00       	call   80106f00 <release>
+    return 0;
+801008ed:	83 c4 10             	add    $0x10,%esp
+}
+801008f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801008f3:	89 d8                	mov    %ebx,%eax
+801008f5:	5b                   	pop    %ebx
+801008f6:	5e                   	pop    %esi
+801008f7:	5f                   	pop    %edi
+801008f8:	5d                   	pop    %ebp
+801008f9:	c3                   	ret
+801008fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  release(&bk->lock);
+80100900:	83 ec 0c             	sub    $0xc,%esp
+80100903:	ff 75 e4             	push   -0x1c(%ebp)
+80100906:	e8 f5 65 00 00       	call   80106f00 <release>
+  if((b = bcache.spare) != 0)
+8010090b:	8b 1d e0 02 1a 80    	mov    0x801a02e0,%ebx
+80100911:	83 c4 10             	add    $0x10,%esp
+80100914:	85 db                	test   %ebx,%ebx
+80100916:	0f 84 f5 00 00 00    	je     80100a11 <bget+0x261>
+    bcache.spare = b->hnext;
+8010091c:	8b 83 90 00 00 00    	mov    0x90(%ebx),%eax
+80100922:	a3 e0 02 1a 80       	mov    %eax,0x801a02e0
+  acquire(&bk->lock);
+80100927:	83 ec 0c             	sub    $0xc,%esp
+8010092a:	ff 75 e4             	push   -0x1c(%ebp)
+8010092d:	e8 3e 67 00 00       	call   80107070 <acquire>
+  b->blockno = blockno;
+80100932:	89 7b 08             	mov    %edi,0x8(%ebx)
+  b->refcnt = ra ? 2 : 1;  // breadahead() keeps a reference of its own
+80100935:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  b->dev = dev;
+80100938:	89 73 04             	mov    %esi,0x4(%ebx)
+  b->refcnt = ra ? 2 : 1;  // breadahead() keeps a reference of its own
+8010093b:	8d 47 01             	lea    0x1(%edi),%eax
+  b->flags = 0;
+8010093e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  b->refcnt = ra ? 2 : 1;  // breadahead() keeps a reference of its own
+80100944:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  b->hnext = bk->head;
+8010094a:	6b 45 dc 64          	imul   $0x64,-0x24(%ebp),%eax
+  b->used = 1;
+8010094e:	c7 83 8c 00 00 00 01 	movl   $0x1,0x8c(%ebx)
+80100955:	00 00 00 
+  b->hnext = bk->head;
+80100958:	8b 90 60 d1 18 80    	mov    -0x7fe72ea0(%eax),%edx
+8010095e:	89 93 90 00 00 00    	mov    %edx,0x90(%ebx)
+  bk->head = b;
+80100964:	89 98 60 d1 18 80    	mov    %ebx,-0x7fe72ea0(%eax)
+  release(&bk->lock);
+8010096a:	5a                   	pop    %edx
+8010096b:	ff 75 e4             	push   -0x1c(%ebp)
+8010096e:	e8 8d 65 00 00       	call   80106f00 <release>
+  if(!ra)
+80100973:	83 c4 10             	add    $0x10,%esp
+80100976:	85 ff                	test   %edi,%edi
+80100978:	75 07                	jne    80100981 <bget+0x1d1>
+    bcache.nmiss++;
+8010097a:	83 05 e8 02 1a 80 01 	addl   $0x1,0x801a02e8
+  release(&bcache.evictlock);
+80100981:	83 ec 0c             	sub    $0xc,%esp
+80100984:	68 d4 97 19 80       	push   $0x801997d4
+80100989:	e9 b4 fe ff ff       	jmp    80100842 <bget+0x92>
+  if(bcache.spare == 0 && bcache.npage < NBUFPAGE && kfreepages() > BUFRESERVE)
+8010098e:	81 3d d8 02 1a 80 ff 	cmpl   $0x7ff,0x801a02d8
+80100995:	07 00 00 
+80100998:	0f 8f dd fe ff ff    	jg     8010087b <bget+0xcb>
+8010099e:	e8 ed 31 00 00       	call   80103b90 <kfreepages>
+801009a3:	3d 00 04 00 00       	cmp    $0x400,%eax
+801009a8:	0f 8e cd fe ff ff    	jle    8010087b <bget+0xcb>
+    pg = (struct bufpage*)kalloc();
+801009ae:	e8 0d 31 00 00       	call   80103ac0 <kalloc>
+  acquire(&bcache.evictlock);
+801009b3:	83 ec 0c             	sub    $0xc,%esp
+    pg = (struct bufpage*)kalloc();
+801009b6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  acquire(&bcache.evictlock);
+801009b9:	68 d4 97 19 80       	push   $0x801997d4
+801009be:	e8 ad 66 00 00       	call   80107070 <acquire>
+  if(pg){
+801009c3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+801009c6:	83 c4 10             	add    $0x10,%esp
+801009c9:	85 d2                	test   %edx,%edx
+801009cb:	0f 84 ba fe ff ff    	je     8010088b <bget+0xdb>
+    pg->next = bcache.pages;
+801009d1:	a1 d4 02 1a 80       	mov    0x801a02d4,%eax
+801009d6:	8d 5a 04             	lea    0x4(%edx),%ebx
+801009d9:	89 75 d8             	mov    %esi,-0x28(%ebp)
+801009dc:	89 de                	mov    %ebx,%esi
+801009de:	89 02                	mov    %eax,(%edx)
+    bcache.pages = pg;
+801009e0:	8d 82 f4 0f 00 00    	lea    0xff4(%edx),%eax
+    bcache.npage++;
+801009e6:	83 05 d8 02 1a 80 01 	addl   $0x1,0x801a02d8
+801009ed:	89 c3                	mov    %eax,%ebx
+    bcache.pages = pg;
+801009ef:	89 15 d4 02 1a 80    	mov    %edx,0x801a02d4
+    for(i = 0; i < BPP; i++)
+801009f5:	8d 76 00             	lea    0x0(%esi),%esi
+      addbuf(&pagebufs(pg)[i]);
+801009f8:	89 f0                	mov    %esi,%eax
+    for(i = 0; i < BPP; i++)
+801009fa:	81 c6 a8 02 00 00    	add    $0x2a8,%esi
+      addbuf(&pagebufs(pg)[i]);
+80100a00:	e8 fb fc ff ff       	call   80100700 <addbuf>
+    for(i = 0; i < BPP; i++)
+80100a05:	39 f3                	cmp    %esi,%ebx
+80100a07:	75 ef                	jne    801009f8 <bget+0x248>
+80100a09:	8b 75 d8             	mov    -0x28(%ebp),%esi
+80100a0c:	e9 7a fe ff ff       	jmp    8010088b <bget+0xdb>
+  else if((b = bvictim(ra ? NBUF/2 : 2*bcache.nbuf)) == 0){
+80100a11:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80100a14:	85 c0                	test   %eax,%eax
+80100a16:	0f 85 cf 00 00 00    	jne    80100aeb <bget+0x33b>
+80100a1c:	a1 dc 02 1a 80       	mov    0x801a02dc,%eax
+80100a21:	01 c0                	add    %eax,%eax
+80100a23:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  for(i = 0; i < n; i++){
+80100a26:	85 c0                	test   %eax,%eax
+80100a28:	0f 8e 0b 01 00 00    	jle    80100b39 <bget+0x389>
+  return &bcache.bucket[(dev*31 + blockno) % NBUCKET];
+80100a2e:	89 7d cc             	mov    %edi,-0x34(%ebp)
+  for(i = 0; i < n; i++){
+80100a31:	31 c0                	xor    %eax,%eax
+  return &bcache.bucket[(dev*31 + blockno) % NBUCKET];
+80100a33:	89 75 d0             	mov    %esi,-0x30(%ebp)
+80100a36:	89 c6                	mov    %eax,%esi
+80100a38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100a3f:	90                   	nop
+    b = bcache.hand;
+80100a40:	8b 1d e4 02 1a 80    	mov    0x801a02e4,%ebx
+    bcache.hand = b->anext;
+80100a46:	8b 83 94 00 00 00    	mov    0x94(%ebx),%eax
+80100a4c:	a3 e4 02 1a 80       	mov    %eax,0x801a02e4
+    if(b->dev == NODEV)
+80100a51:	8b 43 04             	mov    0x4(%ebx),%eax
+80100a54:	83 f8 ff             	cmp    $0xffffffff,%eax
+80100a57:	74 68                	je     80100ac1 <bget+0x311>
+  return &bcache.bucket[(dev*31 + blockno) % NBUCKET];
+80100a59:	89 c1                	mov    %eax,%ecx
+    acquire(&bk->lock);
+80100a5b:	83 ec 0c             	sub    $0xc,%esp
+  return &bcache.bucket[(dev*31 + blockno) % NBUCKET];
+80100a5e:	c1 e1 05             	shl    $0x5,%ecx
+80100a61:	29 c1                	sub    %eax,%ecx
+80100a63:	b8 b3 21 c1 80       	mov    $0x80c121b3,%eax
+80100a68:	03 4b 08             	add    0x8(%ebx),%ecx
+80100a6b:	f7 e1                	mul    %ecx
+80100a6d:	c1 ea 08             	shr    $0x8,%edx
+80100a70:	69 c2 fd 01 00 00    	imul   $0x1fd,%edx,%eax
+80100a76:	89 ca                	mov    %ecx,%edx
+80100a78:	29 c2                	sub    %eax,%edx
+    acquire(&bk->lock);
+80100a7a:	6b fa 64             	imul   $0x64,%edx,%edi
+80100a7d:	8d 8f 00 d1 18 80    	lea    -0x7fe72f00(%edi),%ecx
+80100a83:	51                   	push   %ecx
+80100a84:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+80100a87:	e8 e4 65 00 00       	call   80107070 <acquire>
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0){
+80100a8c:	8b 83 88 00 00 00    	mov    0x88(%ebx),%eax
+80100a92:	83 c4 10             	add    $0x10,%esp
+80100a95:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+80100a98:	85 c0                	test   %eax,%eax
+80100a9a:	75 19                	jne    80100ab5 <bget+0x305>
+80100a9c:	f6 03 04             	testb  $0x4,(%ebx)
+80100a9f:	75 14                	jne    80100ab5 <bget+0x305>
+      if(b->used)
+80100aa1:	8b 83 8c 00 00 00    	mov    0x8c(%ebx),%eax
+80100aa7:	85 c0                	test   %eax,%eax
+80100aa9:	74 4c                	je     80100af7 <bget+0x347>
+        b->used = 0;
+80100aab:	c7 83 8c 00 00 00 00 	movl   $0x0,0x8c(%ebx)
+80100ab2:	00 00 00 
+    release(&bk->lock);
+80100ab5:	83 ec 0c             	sub    $0xc,%esp
+80100ab8:	51                   	push   %ecx
+80100ab9:	e8 42 64 00 00       	call   80106f00 <release>
+80100abe:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++){
+80100ac1:	83 c6 01             	add    $0x1,%esi
+80100ac4:	39 75 d4             	cmp    %esi,-0x2c(%ebp)
+80100ac7:	0f 8f 73 ff ff ff    	jg     80100a40 <bget+0x290>
+    if(ra){
+80100acd:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80100ad0:	85 c9                	test   %ecx,%ecx
+80100ad2:	74 65                	je     80100b39 <bget+0x389>
+      release(&bcache.evictlock);
+80100ad4:	83 ec 0c             	sub    $0xc,%esp
+      return 0;
+80100ad7:	31 db                	xor    %ebx,%ebx
+      release(&bcache.evictlock);
+80100ad9:	68 d4 97 19 80       	push   $0x801997d4
+80100ade:	e8 1d 64 00 00       	call   80106f00 <release>
+      return 0;
+80100ae3:	83 c4 10             	add    $0x10,%esp
+80100ae6:	e9 05 fe ff ff       	jmp    801008f0 <bget+0x140>
+  else if((b = bvictim(ra ? NBUF/2 : 2*bcache.nbuf)) == 0){
+80100aeb:	c7 45 d4 14 00 00 00 	movl   $0x14,-0x2c(%ebp)
+80100af2:	e9 37 ff ff ff       	jmp    80100a2e <bget+0x27e>
+        for(pp = &bk->head; *pp != b; pp = &(*pp)->hnext)
+80100af7:	8b 41 60             	mov    0x60(%ecx),%eax
+80100afa:	89 fa                	mov    %edi,%edx
+80100afc:	8b 75 d0             	mov    -0x30(%ebp),%esi
+80100aff:	8b 7d cc             	mov    -0x34(%ebp),%edi
+80100b02:	39 c3                	cmp    %eax,%ebx
+80100b04:	74 2b                	je     80100b31 <bget+0x381>
+80100b06:	89 c2                	mov    %eax,%edx
+80100b08:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+80100b0e:	39 c3                	cmp    %eax,%ebx
+80100b10:	75 f4                	jne    80100b06 <bget+0x356>
+80100b12:	81 c2 90 00 00 00    	add    $0x90,%edx
+        *pp = b->hnext;
+80100b18:	8b 83 90 00 00 00    	mov    0x90(%ebx),%eax
+        release(&bk->lock);
+80100b1e:	83 ec 0c             	sub    $0xc,%esp
+        *pp = b->hnext;
+80100b21:	89 02                	mov    %eax,(%edx)
+        release(&bk->lock);
+80100b23:	51                   	push   %ecx
+80100b24:	e8 d7 63 00 00       	call   80106f00 <release>
+80100b29:	83 c4 10             	add    $0x10,%esp
+80100b2c:	e9 f6 fd ff ff       	jmp    80100927 <bget+0x177>
+        for(pp = &bk->head; *pp != b; pp = &(*pp)->hnext)
+80100b31:	81 c2 60 d1 18 80    	add    $0x8018d160,%edx
+80100b37:	eb df                	jmp    80100b18 <bget+0x368>
+    panic("bget: no buffers");
+80100b39:	83 ec 0c             	sub    $0xc,%esp
+80100b3c:	68 4b b6 10 80       	push   $0x8010b64b
+80100b41:	e8 7a 09 00 00       	call   801014c0 <panic>
+80100b46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100b4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80100b50 <binit>:
+{
+80100b50:	55                   	push   %ebp
+80100b51:	89 e5                	mov    %esp,%ebp
+80100b53:	53                   	push   %ebx
+  for(bk = bcache.bucket; bk < bcache.bucket+NBUCKET; bk++)
+80100b54:	bb 00 d1 18 80       	mov    $0x8018d100,%ebx
+{
+80100b59:	83 ec 04             	sub    $0x4,%esp
+80100b5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    initlock(&bk->lock, "bcache");
+80100b60:	83 ec 08             	sub    $0x8,%esp
+80100b63:	68 5c b6 10 80       	push   $0x8010b65c
+80100b68:	53                   	push   %ebx
+  for(bk = bcache.bucket; bk < bcache.bucket+NBUCKET; bk++)
+80100b69:	83 c3 64             	add    $0x64,%ebx
+    initlock(&bk->lock, "bcache");
+80100b6c:	e8 ef 5d 00 00       	call   80106960 <initlock>
+  for(bk = bcache.bucket; bk < bcache.bucket+NBUCKET; bk++)
+80100b71:	83 c4 10             	add    $0x10,%esp
+80100b74:	81 fb d4 97 19 80    	cmp    $0x801997d4,%ebx
+80100b7a:	75 e4                	jne    80100b60 <binit+0x10>
+  initlock(&bcache.evictlock, "bevict");
+80100b7c:	83 ec 08             	sub    $0x8,%esp
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++)
+80100b7f:	bb 94 98 19 80       	mov    $0x80199894,%ebx
+  initlock(&bcache.evictlock, "bevict");
+80100b84:	68 63 b6 10 80       	push   $0x8010b663
+80100b89:	68 d4 97 19 80       	push   $0x801997d4
+80100b8e:	e8 cd 5d 00 00       	call   80106960 <initlock>
+  initlock(&bcache.iolock, "bio");
+80100b93:	58                   	pop    %eax
+80100b94:	5a                   	pop    %edx
+80100b95:	68 6a b6 10 80       	push   $0x8010b66a
+80100b9a:	68 34 98 19 80       	push   $0x80199834
+80100b9f:	e8 bc 5d 00 00       	call   80106960 <initlock>
+  acquire(&bcache.evictlock);
+80100ba4:	c7 04 24 d4 97 19 80 	movl   $0x801997d4,(%esp)
+80100bab:	e8 c0 64 00 00       	call   80107070 <acquire>
+80100bb0:	83 c4 10             	add    $0x10,%esp
+80100bb3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100bb7:	90                   	nop
+    addbuf(b);
+80100bb8:	89 d8                	mov    %ebx,%eax
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++)
+80100bba:	81 c3 a8 02 00 00    	add    $0x2a8,%ebx
+    addbuf(b);
+80100bc0:	e8 3b fb ff ff       	call   80100700 <addbuf>
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++)
+80100bc5:	81 fb d4 02 1a 80    	cmp    $0x801a02d4,%ebx
+80100bcb:	75 eb                	jne    80100bb8 <binit+0x68>
+  release(&bcache.evictlock);
+80100bcd:	83 ec 0c             	sub    $0xc,%esp
+80100bd0:	68 d4 97 19 80       	push   $0x801997d4
+80100bd5:	e8 26 63 00 00       	call   80106f00 <release>
+}
+80100bda:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100bdd:	83 c4 10             	add    $0x10,%esp
+80100be0:	c9                   	leave
+80100be1:	c3                   	ret
+80100be2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100be9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80100bf0 <biodone>:
+static void bunref(struct buf*);
+
+// Called by the disk drivers when the request for b is done.
+void
+biodone(struct buf *b)
+{
+80100bf0:	55                   	push   %ebp
+80100bf1:	89 e5                	mov    %esp,%ebp
+80100bf3:	57                   	push   %edi
+80100bf4:	56                   	push   %esi
+80100bf5:	53                   	push   %ebx
+80100bf6:	83 ec 28             	sub    $0x28,%esp
+80100bf9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+80100bfc:	0f 31                	rdtsc
+  int write, async;
+  uint64 t;
+
+  t = rdtsc() - b->qtime;
+  write = b->flags & B_DIRTY;
+80100bfe:	8b 0b                	mov    (%ebx),%ecx
+80100c00:	89 c6                	mov    %eax,%esi
+80100c02:	89 d7                	mov    %edx,%edi
+  t = rdtsc() - b->qtime;
+80100c04:	8b 83 a0 00 00 00    	mov    0xa0(%ebx),%eax
+80100c0a:	8b 93 a4 00 00 00    	mov    0xa4(%ebx),%edx
+  write = b->flags & B_DIRTY;
+80100c10:	83 e1 04             	and    $0x4,%ecx
+  t = rdtsc() - b->qtime;
+80100c13:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  write = b->flags & B_DIRTY;
+80100c16:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  t = rdtsc() - b->qtime;
+80100c19:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  acquire(&bcache.iolock);
+80100c1c:	68 34 98 19 80       	push   $0x80199834
+80100c21:	e8 4a 64 00 00       	call   80107070 <acquire>
+  async = b->flags & B_ASYNC;
+80100c26:	8b 03                	mov    (%ebx),%eax
+80100c28:	89 c2                	mov    %eax,%edx
+  b->flags |= B_VALID;
+  b->flags &= ~(B_DIRTY|B_ASYNC);
+80100c2a:	83 e0 f3             	and    $0xfffffff3,%eax
+  async = b->flags & B_ASYNC;
+80100c2d:	83 e2 08             	and    $0x8,%edx
+  b->flags &= ~(B_DIRTY|B_ASYNC);
+80100c30:	83 c8 02             	or     $0x2,%eax
+  async = b->flags & B_ASYNC;
+80100c33:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  b->flags &= ~(B_DIRTY|B_ASYNC);
+80100c36:	89 03                	mov    %eax,(%ebx)
+  wakeup(b);
+80100c38:	89 1c 24             	mov    %ebx,(%esp)
+80100c3b:	e8 b0 54 00 00       	call   801060f0 <wakeup>
+  release(&bcache.iolock);
+80100c40:	c7 04 24 34 98 19 80 	movl   $0x80199834,(%esp)
+80100c47:	e8 b4 62 00 00       	call   80106f00 <release>
+  xadd(write ? &diskstat.nwrite : &diskstat.nread, 1);
+80100c4c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80100c4f:	83 c4 10             	add    $0x10,%esp
+80100c52:	b8 80 d0 18 80       	mov    $0x8018d080,%eax
+80100c57:	85 d2                	test   %edx,%edx
+80100c59:	ba 84 d0 18 80       	mov    $0x8018d084,%edx
+80100c5e:	0f 45 c2             	cmovne %edx,%eax
+
+// Atomically add val to *addr; return the old value.
+static inline uint
+xadd(volatile uint *addr, uint val)
+{
+  asm volatile("lock; xaddl %0, %1" :
+80100c61:	ba 01 00 00 00       	mov    $0x1,%edx
+80100c66:	f0 0f c1 10          	lock xadd %edx,(%eax)
+  perus = tscperiod / (1000000/HZ);
+80100c6a:	8b 0d 30 3a 1a 80    	mov    0x801a3a30,%ecx
+  if(perus == 0 || (t >> 32) >= perus)
+80100c70:	81 f9 0f 27 00 00    	cmp    $0x270f,%ecx
+80100c76:	76 6d                	jbe    80100ce5 <biodone+0xf5>
+  perus = tscperiod / (1000000/HZ);
+80100c78:	b8 59 17 b7 d1       	mov    $0xd1b71759,%eax
+  t = rdtsc() - b->qtime;
+80100c7d:	2b 75 d8             	sub    -0x28(%ebp),%esi
+80100c80:	1b 7d dc             	sbb    -0x24(%ebp),%edi
+  perus = tscperiod / (1000000/HZ);
+80100c83:	f7 e1                	mul    %ecx
+80100c85:	89 d1                	mov    %edx,%ecx
+80100c87:	c1 e9 0d             	shr    $0xd,%ecx
+  if(perus == 0 || (t >> 32) >= perus)
+80100c8a:	39 cf                	cmp    %ecx,%edi
+80100c8c:	73 57                	jae    80100ce5 <biodone+0xf5>
+  asm("divl %4" : "=a" (q), "=d" (r) : "a" ((uint)n), "d" ((uint)(n>>32)), "rm" (d));
+80100c8e:	89 f0                	mov    %esi,%eax
+80100c90:	89 fa                	mov    %edi,%edx
+80100c92:	f7 f1                	div    %ecx
+80100c94:	89 c2                	mov    %eax,%edx
+  asm volatile("lock; xaddl %0, %1" :
+80100c96:	89 c1                	mov    %eax,%ecx
+80100c98:	f0 0f c1 0d 8c d0 18 	lock xadd %ecx,0x8018d08c
+80100c9f:	80 
+  if(us > diskstat.maxlatency)  // racy, but only a statistic
+80100ca0:	39 05 90 d0 18 80    	cmp    %eax,0x8018d090
+80100ca6:	73 05                	jae    80100cad <biodone+0xbd>
+    diskstat.maxlatency = us;
+80100ca8:	a3 90 d0 18 80       	mov    %eax,0x8018d090
+  for(i = 0; us > 1 && i < NDISKHIST-1; i++)
+80100cad:	83 f8 01             	cmp    $0x1,%eax
+80100cb0:	0f 86 9a 00 00 00    	jbe    80100d50 <biodone+0x160>
+80100cb6:	31 c0                	xor    %eax,%eax
+80100cb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100cbf:	90                   	nop
+    us >>= 1;
+80100cc0:	d1 ea                	shr    %edx
+  for(i = 0; us > 1 && i < NDISKHIST-1; i++)
+80100cc2:	89 c1                	mov    %eax,%ecx
+80100cc4:	83 c0 01             	add    $0x1,%eax
+80100cc7:	83 fa 01             	cmp    $0x1,%edx
+80100cca:	76 05                	jbe    80100cd1 <biodone+0xe1>
+80100ccc:	83 f8 16             	cmp    $0x16,%eax
+80100ccf:	7e ef                	jle    80100cc0 <biodone+0xd0>
+80100cd1:	8d 14 8d 18 00 00 00 	lea    0x18(,%ecx,4),%edx
+80100cd8:	b8 01 00 00 00       	mov    $0x1,%eax
+80100cdd:	f0 0f c1 82 80 d0 18 	lock xadd %eax,-0x7fe72f80(%edx)
+80100ce4:	80 
+  diskdone(write, t);
+
+  // Nobody is waiting for a readahead buffer; release it on
+  // behalf of the process that started it.
+  if(async)
+80100ce5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80100ce8:	85 c0                	test   %eax,%eax
+80100cea:	75 0c                	jne    80100cf8 <biodone+0x108>
+    brelease(b);
+}
+80100cec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100cef:	5b                   	pop    %ebx
+80100cf0:	5e                   	pop    %esi
+80100cf1:	5f                   	pop    %edi
+80100cf2:	5d                   	pop    %ebp
+80100cf3:	c3                   	ret
+80100cf4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+
+static void
+brelease(struct buf *b)
+{
+  releasesleep(&b->lock);
+80100cf8:	83 ec 0c             	sub    $0xc,%esp
+80100cfb:	8d 43 0c             	lea    0xc(%ebx),%eax
+80100cfe:	50                   	push   %eax
+80100cff:	e8 8c 5a 00 00       	call   80106790 <releasesleep>
+  return &bcache.bucket[(dev*31 + blockno) % NBUCKET];
+80100d04:	8b 43 04             	mov    0x4(%ebx),%eax
+80100d07:	89 c1                	mov    %eax,%ecx
+80100d09:	c1 e1 05             	shl    $0x5,%ecx
+80100d0c:	29 c1                	sub    %eax,%ecx
+80100d0e:	b8 b3 21 c1 80       	mov    $0x80c121b3,%eax
+80100d13:	03 4b 08             	add    0x8(%ebx),%ecx
+80100d16:	f7 e1                	mul    %ecx
+80100d18:	c1 ea 08             	shr    $0x8,%edx
+80100d1b:	69 d2 fd 01 00 00    	imul   $0x1fd,%edx,%edx
+80100d21:	29 d1                	sub    %edx,%ecx
+bunref(struct buf *b)
+{
+  struct bucket *bk;
+
+  bk = bucketfor(b->dev, b->blockno);
+  acquire(&bk->lock);
+80100d23:	6b f1 64             	imul   $0x64,%ecx,%esi
+80100d26:	81 c6 00 d1 18 80    	add    $0x8018d100,%esi
+80100d2c:	89 34 24             	mov    %esi,(%esp)
+80100d2f:	e8 3c 63 00 00       	call   80107070 <acquire>
+  b->refcnt--;
+80100d34:	83 ab 88 00 00 00 01 	subl   $0x1,0x88(%ebx)
+  release(&bk->lock);
+80100d3b:	83 c4 10             	add    $0x10,%esp
+80100d3e:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+80100d41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100d44:	5b                   	pop    %ebx
+80100d45:	5e                   	pop    %esi
+80100d46:	5f                   	pop    %edi
+80100d47:	5d                   	pop    %ebp
+  release(&bk->lock);
+80100d48:	e9 b3 61 00 00       	jmp    80106f00 <release>
+80100d4d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; us > 1 && i < NDISKHIST-1; i++)
+80100d50:	ba 14 00 00 00       	mov    $0x14,%edx
+80100d55:	eb 81                	jmp    80100cd8 <biodone+0xe8>
+80100d57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100d5e:	66 90                	xchg   %ax,%ax
+
+80100d60 <bwait>:
+{
+80100d60:	55                   	push   %ebp
+80100d61:	89 e5                	mov    %esp,%ebp
+80100d63:	53                   	push   %ebx
+80100d64:	83 ec 10             	sub    $0x10,%esp
+80100d67:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&bcache.iolock);
+80100d6a:	68 34 98 19 80       	push   $0x80199834
+80100d6f:	e8 fc 62 00 00       	call   80107070 <acquire>
+80100d74:	eb 18                	jmp    80100d8e <bwait+0x2e>
+80100d76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100d7d:	8d 76 00             	lea    0x0(%esi),%esi
+    sleep(b, &bcache.iolock);
+80100d80:	83 ec 08             	sub    $0x8,%esp
+80100d83:	68 34 98 19 80       	push   $0x80199834
+80100d88:	53                   	push   %ebx
+80100d89:	e8 b2 52 00 00       	call   80106040 <sleep>
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID)
+80100d8e:	8b 03                	mov    (%ebx),%eax
+80100d90:	83 c4 10             	add    $0x10,%esp
+80100d93:	83 e0 06             	and    $0x6,%eax
+80100d96:	83 f8 02             	cmp    $0x2,%eax
+80100d99:	75 e5                	jne    80100d80 <bwait+0x20>
+  release(&bcache.iolock);
+80100d9b:	c7 45 08 34 98 19 80 	movl   $0x80199834,0x8(%ebp)
+}
+80100da2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100da5:	c9                   	leave
+  release(&bcache.iolock);
+80100da6:	e9 55 61 00 00       	jmp    80106f00 <release>
+80100dab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100daf:	90                   	nop
+
+80100db0 <bread_async>:
+{
+80100db0:	55                   	push   %ebp
+  b = bget(dev, blockno, 0);
+80100db1:	31 c9                	xor    %ecx,%ecx
+{
+80100db3:	89 e5                	mov    %esp,%ebp
+80100db5:	53                   	push   %ebx
+80100db6:	83 ec 04             	sub    $0x4,%esp
+  b = bget(dev, blockno, 0);
+80100db9:	8b 55 0c             	mov    0xc(%ebp),%edx
+80100dbc:	8b 45 08             	mov    0x8(%ebp),%eax
+80100dbf:	e8 ec f9 ff ff       	call   801007b0 <bget>
+80100dc4:	89 c3                	mov    %eax,%ebx
+  if((b->flags & B_VALID) == 0) {
+80100dc6:	f6 00 02             	testb  $0x2,(%eax)
+80100dc9:	74 0d                	je     80100dd8 <bread_async+0x28>
+}
+80100dcb:	89 d8                	mov    %ebx,%eax
+80100dcd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100dd0:	c9                   	leave
+80100dd1:	c3                   	ret
+80100dd2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(myproc())
+80100dd8:	e8 13 48 00 00       	call   801055f0 <myproc>
+80100ddd:	85 c0                	test   %eax,%eax
+80100ddf:	74 0c                	je     80100ded <bread_async+0x3d>
+      myproc()->nbread++;
+80100de1:	e8 0a 48 00 00       	call   801055f0 <myproc>
+80100de6:	83 80 bc 00 00 00 01 	addl   $0x1,0xbc(%eax)
+  asm volatile("rdtsc" : "=A" (tsc));
+80100ded:	0f 31                	rdtsc
+  if(b->dev == ROOTDEV && virtioready())
+80100def:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+  b->qtime = rdtsc();
+80100df3:	89 83 a0 00 00 00    	mov    %eax,0xa0(%ebx)
+80100df9:	89 93 a4 00 00 00    	mov    %edx,0xa4(%ebx)
+  if(b->dev == ROOTDEV && virtioready())
+80100dff:	74 17                	je     80100e18 <bread_async+0x68>
+    iderw(b);
+80100e01:	83 ec 0c             	sub    $0xc,%esp
+80100e04:	53                   	push   %ebx
+80100e05:	e8 66 a7 00 00       	call   8010b570 <iderw>
+}
+80100e0a:	89 d8                	mov    %ebx,%eax
+    iderw(b);
+80100e0c:	83 c4 10             	add    $0x10,%esp
+}
+80100e0f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100e12:	c9                   	leave
+80100e13:	c3                   	ret
+80100e14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(b->dev == ROOTDEV && virtioready())
+80100e18:	e8 13 96 00 00       	call   8010a430 <virtioready>
+80100e1d:	85 c0                	test   %eax,%eax
+80100e1f:	74 e0                	je     80100e01 <bread_async+0x51>
+    virtiorw(b);
+80100e21:	83 ec 0c             	sub    $0xc,%esp
+80100e24:	53                   	push   %ebx
+80100e25:	e8 16 96 00 00       	call   8010a440 <virtiorw>
+80100e2a:	83 c4 10             	add    $0x10,%esp
+80100e2d:	eb 9c                	jmp    80100dcb <bread_async+0x1b>
+80100e2f:	90                   	nop
+
+80100e30 <bread>:
+{
+80100e30:	55                   	push   %ebp
+80100e31:	89 e5                	mov    %esp,%ebp
+80100e33:	53                   	push   %ebx
+80100e34:	83 ec 0c             	sub    $0xc,%esp
+  b = bread_async(dev, blockno);
+80100e37:	ff 75 0c             	push   0xc(%ebp)
+80100e3a:	ff 75 08             	push   0x8(%ebp)
+80100e3d:	e8 6e ff ff ff       	call   80100db0 <bread_async>
+  acquire(&bcache.iolock);
+80100e42:	c7 04 24 34 98 19 80 	movl   $0x80199834,(%esp)
+  b = bread_async(dev, blockno);
+80100e49:	89 c3                	mov    %eax,%ebx
+  acquire(&bcache.iolock);
+80100e4b:	e8 20 62 00 00       	call   80107070 <acquire>
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID)
+80100e50:	8b 03                	mov    (%ebx),%eax
+80100e52:	83 c4 10             	add    $0x10,%esp
+80100e55:	83 e0 06             	and    $0x6,%eax
+80100e58:	83 f8 02             	cmp    $0x2,%eax
+80100e5b:	74 1e                	je     80100e7b <bread+0x4b>
+80100e5d:	8d 76 00             	lea    0x0(%esi),%esi
+    sleep(b, &bcache.iolock);
+80100e60:	83 ec 08             	sub    $0x8,%esp
+80100e63:	68 34 98 19 80       	push   $0x80199834
+80100e68:	53                   	push   %ebx
+80100e69:	e8 d2 51 00 00       	call   80106040 <sleep>
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID)
+80100e6e:	8b 13                	mov    (%ebx),%edx
+80100e70:	83 c4 10             	add    $0x10,%esp
+80100e73:	83 e2 06             	and    $0x6,%edx
+80100e76:	83 fa 02             	cmp    $0x2,%edx
+80100e79:	75 e5                	jne    80100e60 <bread+0x30>
+  release(&bcache.iolock);
+80100e7b:	83 ec 0c             	sub    $0xc,%esp
+80100e7e:	68 34 98 19 80       	push   $0x80199834
+80100e83:	e8 78 60 00 00       	call   80106f00 <release>
+}
+80100e88:	89 d8                	mov    %ebx,%eax
+80100e8a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100e8d:	c9                   	leave
+80100e8e:	c3                   	ret
+80100e8f:	90                   	nop
+
+80100e90 <breadahead>:
+{
+80100e90:	55                   	push   %ebp
+  if((b = bget(dev, blockno, 1)) == 0)
+80100e91:	b9 01 00 00 00       	mov    $0x1,%ecx
+{
+80100e96:	89 e5                	mov    %esp,%ebp
+80100e98:	56                   	push   %esi
+80100e99:	53                   	push   %ebx
+  if((b = bget(dev, blockno, 1)) == 0)
+80100e9a:	8b 55 0c             	mov    0xc(%ebp),%edx
+80100e9d:	8b 45 08             	mov    0x8(%ebp),%eax
+80100ea0:	e8 0b f9 ff ff       	call   801007b0 <bget>
+80100ea5:	85 c0                	test   %eax,%eax
+80100ea7:	0f 84 b3 00 00 00    	je     80100f60 <breadahead+0xd0>
+80100ead:	89 c3                	mov    %eax,%ebx
+  if(myproc())
+80100eaf:	e8 3c 47 00 00       	call   801055f0 <myproc>
+80100eb4:	85 c0                	test   %eax,%eax
+80100eb6:	74 0c                	je     80100ec4 <breadahead+0x34>
+    myproc()->nbread++;
+80100eb8:	e8 33 47 00 00       	call   801055f0 <myproc>
+80100ebd:	83 80 bc 00 00 00 01 	addl   $0x1,0xbc(%eax)
+  b->flags |= B_ASYNC;
+80100ec4:	83 0b 08             	orl    $0x8,(%ebx)
+80100ec7:	0f 31                	rdtsc
+  if(b->dev == ROOTDEV && virtioready())
+80100ec9:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+  b->qtime = rdtsc();
+80100ecd:	89 83 a0 00 00 00    	mov    %eax,0xa0(%ebx)
+80100ed3:	89 93 a4 00 00 00    	mov    %edx,0xa4(%ebx)
+  if(b->dev == ROOTDEV && virtioready())
+80100ed9:	74 65                	je     80100f40 <breadahead+0xb0>
+    iderw(b);
+80100edb:	83 ec 0c             	sub    $0xc,%esp
+80100ede:	53                   	push   %ebx
+80100edf:	e8 8c a6 00 00       	call   8010b570 <iderw>
+80100ee4:	83 c4 10             	add    $0x10,%esp
+  disownsleep(&b->lock);
+80100ee7:	83 ec 0c             	sub    $0xc,%esp
+80100eea:	8d 43 0c             	lea    0xc(%ebx),%eax
+80100eed:	50                   	push   %eax
+80100eee:	e8 6d 59 00 00       	call   80106860 <disownsleep>
+  return &bcache.bucket[(dev*31 + blockno) % NBUCKET];
+80100ef3:	8b 43 04             	mov    0x4(%ebx),%eax
+80100ef6:	89 c1                	mov    %eax,%ecx
+80100ef8:	c1 e1 05             	shl    $0x5,%ecx
+80100efb:	29 c1                	sub    %eax,%ecx
+80100efd:	b8 b3 21 c1 80       	mov    $0x80c121b3,%eax
+80100f02:	03 4b 08             	add    0x8(%ebx),%ecx
+80100f05:	f7 e1                	mul    %ecx
+80100f07:	c1 ea 08             	shr    $0x8,%edx
+80100f0a:	69 d2 fd 01 00 00    	imul   $0x1fd,%edx,%edx
+80100f10:	29 d1                	sub    %edx,%ecx
+  acquire(&bk->lock);
+80100f12:	6b f1 64             	imul   $0x64,%ecx,%esi
+80100f15:	81 c6 00 d1 18 80    	add    $0x8018d100,%esi
+80100f1b:	89 34 24             	mov    %esi,(%esp)
+80100f1e:	e8 4d 61 00 00       	call   80107070 <acquire>
+  b->refcnt--;
+80100f23:	83 ab 88 00 00 00 01 	subl   $0x1,0x88(%ebx)
+  release(&bk->lock);
+80100f2a:	83 c4 10             	add    $0x10,%esp
+80100f2d:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+80100f30:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80100f33:	5b                   	pop    %ebx
+80100f34:	5e                   	pop    %esi
+80100f35:	5d                   	pop    %ebp
+  release(&bk->lock);
+80100f36:	e9 c5 5f 00 00       	jmp    80106f00 <release>
+80100f3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100f3f:	90                   	nop
+  if(b->dev == ROOTDEV && virtioready())
+80100f40:	e8 eb 94 00 00       	call   8010a430 <virtioready>
+80100f45:	85 c0                	test   %eax,%eax
+80100f47:	74 92                	je     80100edb <breadahead+0x4b>
+    virtiorw(b);
+80100f49:	83 ec 0c             	sub    $0xc,%esp
+80100f4c:	53                   	push   %ebx
+80100f4d:	e8 ee 94 00 00       	call   8010a440 <virtiorw>
+80100f52:	83 c4 10             	add    $0x10,%esp
+80100f55:	eb 90                	jmp    80100ee7 <breadahead+0x57>
+80100f57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100f5e:	66 90                	xchg   %ax,%ax
+}
+80100f60:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80100f63:	5b                   	pop    %ebx
+80100f64:	5e                   	pop    %esi
+80100f65:	5d                   	pop    %ebp
+80100f66:	c3                   	ret
+80100f67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100f6e:	66 90                	xchg   %ax,%ax
+
+80100f70 <bwrite_async>:
+{
+80100f70:	55                   	push   %ebp
+80100f71:	89 e5                	mov    %esp,%ebp
+80100f73:	53                   	push   %ebx
+80100f74:	83 ec 10             	sub    $0x10,%esp
+80100f77:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holdingsleep(&b->lock))
+80100f7a:	8d 43 0c             	lea    0xc(%ebx),%eax
+80100f7d:	50                   	push   %eax
+80100f7e:	e8 2d 59 00 00       	call   801068b0 <holdingsleep>
+80100f83:	83 c4 10             	add    $0x10,%esp
+80100f86:	85 c0                	test   %eax,%eax
+80100f88:	74 53                	je     80100fdd <bwrite_async+0x6d>
+  b->flags |= B_DIRTY;
+80100f8a:	83 0b 04             	orl    $0x4,(%ebx)
+  if(myproc())
+80100f8d:	e8 5e 46 00 00       	call   801055f0 <myproc>
+80100f92:	85 c0                	test   %eax,%eax
+80100f94:	74 0c                	je     80100fa2 <bwrite_async+0x32>
+    myproc()->nbwrite++;
+80100f96:	e8 55 46 00 00       	call   801055f0 <myproc>
+80100f9b:	83 80 c0 00 00 00 01 	addl   $0x1,0xc0(%eax)
+80100fa2:	0f 31                	rdtsc
+  if(b->dev == ROOTDEV && virtioready())
+80100fa4:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+  b->qtime = rdtsc();
+80100fa8:	89 83 a0 00 00 00    	mov    %eax,0xa0(%ebx)
+80100fae:	89 93 a4 00 00 00    	mov    %edx,0xa4(%ebx)
+  if(b->dev == ROOTDEV && virtioready())
+80100fb4:	74 12                	je     80100fc8 <bwrite_async+0x58>
+    iderw(b);
+80100fb6:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+80100fb9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100fbc:	c9                   	leave
+    iderw(b);
+80100fbd:	e9 ae a5 00 00       	jmp    8010b570 <iderw>
+80100fc2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(b->dev == ROOTDEV && virtioready())
+80100fc8:	e8 63 94 00 00       	call   8010a430 <virtioready>
+80100fcd:	85 c0                	test   %eax,%eax
+80100fcf:	74 e5                	je     80100fb6 <bwrite_async+0x46>
+    virtiorw(b);
+80100fd1:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+80100fd4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100fd7:	c9                   	leave
+    virtiorw(b);
+80100fd8:	e9 63 94 00 00       	jmp    8010a440 <virtiorw>
+    panic("bwrite");
+80100fdd:	83 ec 0c             	sub    $0xc,%esp
+80100fe0:	68 6e b6 10 80       	push   $0x8010b66e
+80100fe5:	e8 d6 04 00 00       	call   801014c0 <panic>
+80100fea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80100ff0 <bwrite>:
+{
+80100ff0:	55                   	push   %ebp
+80100ff1:	89 e5                	mov    %esp,%ebp
+80100ff3:	53                   	push   %ebx
+80100ff4:	83 ec 10             	sub    $0x10,%esp
+80100ff7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bwrite_async(b);
+80100ffa:	53                   	push   %ebx
+80100ffb:	e8 70 ff ff ff       	call   80100f70 <bwrite_async>
+  acquire(&bcache.iolock);
+80101000:	c7 04 24 34 98 19 80 	movl   $0x80199834,(%esp)
+80101007:	e8 64 60 00 00       	call   80107070 <acquire>
+8010100c:	eb 10                	jmp    8010101e <bwrite+0x2e>
+8010100e:	66 90                	xchg   %ax,%ax
+    sleep(b, &bcache.iolock);
+80101010:	83 ec 08             	sub    $0x8,%esp
+80101013:	68 34 98 19 80       	push   $0x80199834
+80101018:	53                   	push   %ebx
+80101019:	e8 22 50 00 00       	call   80106040 <sleep>
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID)
+8010101e:	8b 03                	mov    (%ebx),%eax
+80101020:	83 c4 10             	add    $0x10,%esp
+80101023:	83 e0 06             	and    $0x6,%eax
+80101026:	83 f8 02             	cmp    $0x2,%eax
+80101029:	75 e5                	jne    80101010 <bwrite+0x20>
+  release(&bcache.iolock);
+8010102b:	c7 45 08 34 98 19 80 	movl   $0x80199834,0x8(%ebp)
+}
+80101032:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101035:	c9                   	leave
+  release(&bcache.iolock);
+80101036:	e9 c5 5e 00 00       	jmp    80106f00 <release>
+8010103b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010103f:	90                   	nop
+
+80101040 <brelse>:
+{
+80101040:	55                   	push   %ebp
+80101041:	89 e5                	mov    %esp,%ebp
+80101043:	56                   	push   %esi
+80101044:	53                   	push   %ebx
+80101045:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(!holdingsleep(&b->lock))
+80101048:	8d 5e 0c             	lea    0xc(%esi),%ebx
+8010104b:	83 ec 0c             	sub    $0xc,%esp
+8010104e:	53                   	push   %ebx
+8010104f:	e8 5c 58 00 00       	call   801068b0 <holdingsleep>
+80101054:	83 c4 10             	add    $0x10,%esp
+80101057:	85 c0                	test   %eax,%eax
+80101059:	74 51                	je     801010ac <brelse+0x6c>
+  releasesleep(&b->lock);
+8010105b:	83 ec 0c             	sub    $0xc,%esp
+8010105e:	53                   	push   %ebx
+8010105f:	e8 2c 57 00 00       	call   80106790 <releasesleep>
+  return &bcache.bucket[(dev*31 + blockno) % NBUCKET];
+80101064:	8b 46 04             	mov    0x4(%esi),%eax
+80101067:	89 c1                	mov    %eax,%ecx
+80101069:	c1 e1 05             	shl    $0x5,%ecx
+8010106c:	29 c1                	sub    %eax,%ecx
+8010106e:	b8 b3 21 c1 80       	mov    $0x80c121b3,%eax
+80101073:	03 4e 08             	add    0x8(%esi),%ecx
+80101076:	f7 e1                	mul    %ecx
+80101078:	c1 ea 08             	shr    $0x8,%edx
+8010107b:	69 d2 fd 01 00 00    	imul   $0x1fd,%edx,%edx
+80101081:	29 d1                	sub    %edx,%ecx
+  acquire(&bk->lock);
+80101083:	6b d9 64             	imul   $0x64,%ecx,%ebx
+80101086:	81 c3 00 d1 18 80    	add    $0x8018d100,%ebx
+8010108c:	89 1c 24             	mov    %ebx,(%esp)
+8010108f:	e8 dc 5f 00 00       	call   80107070 <acquire>
+  b->refcnt--;
+80101094:	83 ae 88 00 00 00 01 	subl   $0x1,0x88(%esi)
+  release(&bk->lock);
+8010109b:	83 c4 10             	add    $0x10,%esp
+8010109e:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+801010a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801010a4:	5b                   	pop    %ebx
+801010a5:	5e                   	pop    %esi
+801010a6:	5d                   	pop    %ebp
+  release(&bk->lock);
+801010a7:	e9 54 5e 00 00       	jmp    80106f00 <release>
+    panic("brelse");
+801010ac:	83 ec 0c             	sub    $0xc,%esp
+801010af:	68 75 b6 10 80       	push   $0x8010b675
+801010b4:	e8 07 04 00 00       	call   801014c0 <panic>
+801010b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801010c0 <bshrink>:
+// no buffer in use.  Called by kalloc() when it runs out
+// of memory, so the caller must not hold evictlock.
+// Returns 1 if a page was freed.
+int
+bshrink(void)
+{
+801010c0:	55                   	push   %ebp
+801010c1:	89 e5                	mov    %esp,%ebp
+801010c3:	57                   	push   %edi
+801010c4:	56                   	push   %esi
+801010c5:	53                   	push   %ebx
+801010c6:	83 ec 28             	sub    $0x28,%esp
+  struct bufpage *pg, **pp;
+  struct buf *b, **bp;
+  struct bucket *bk;
+  int i, idle;
+
+  acquire(&bcache.evictlock);
+801010c9:	68 d4 97 19 80       	push   $0x801997d4
+801010ce:	e8 9d 5f 00 00       	call   80107070 <acquire>
+  for(pp = &bcache.pages; (pg = *pp) != 0; pp = &pg->next){
+801010d3:	a1 d4 02 1a 80       	mov    0x801a02d4,%eax
+801010d8:	83 c4 10             	add    $0x10,%esp
+801010db:	85 c0                	test   %eax,%eax
+801010dd:	0f 84 fb 01 00 00    	je     801012de <bshrink+0x21e>
+801010e3:	c7 45 d8 d4 02 1a 80 	movl   $0x801a02d4,-0x28(%ebp)
+  return &bcache.bucket[(dev*31 + blockno) % NBUCKET];
+801010ea:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    // Take the page's buffers out of their buckets, so that no
+    // hit can find them, as long as each turns out to be idle.
+    // Only a miss could put a block back, and those wait for
+    // evictlock.
+    b = pagebufs(pg);
+801010ed:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    for(i = 0; i < BPP; i++){
+801010f0:	31 db                	xor    %ebx,%ebx
+    b = pagebufs(pg);
+801010f2:	83 c0 04             	add    $0x4,%eax
+    for(i = 0; i < BPP; i++){
+801010f5:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    b = pagebufs(pg);
+801010f8:	89 c6                	mov    %eax,%esi
+801010fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(b[i].dev == NODEV)
+80101100:	8b 46 04             	mov    0x4(%esi),%eax
+80101103:	83 f8 ff             	cmp    $0xffffffff,%eax
+80101106:	0f 84 82 00 00 00    	je     8010118e <bshrink+0xce>
+  return &bcache.bucket[(dev*31 + blockno) % NBUCKET];
+8010110c:	89 c1                	mov    %eax,%ecx
+        continue;
+      bk = bucketfor(b[i].dev, b[i].blockno);
+      acquire(&bk->lock);
+8010110e:	83 ec 0c             	sub    $0xc,%esp
+  return &bcache.bucket[(dev*31 + blockno) % NBUCKET];
+80101111:	c1 e1 05             	shl    $0x5,%ecx
+80101114:	29 c1                	sub    %eax,%ecx
+80101116:	b8 b3 21 c1 80       	mov    $0x80c121b3,%eax
+8010111b:	03 4e 08             	add    0x8(%esi),%ecx
+8010111e:	f7 e1                	mul    %ecx
+80101120:	c1 ea 08             	shr    $0x8,%edx
+80101123:	69 c2 fd 01 00 00    	imul   $0x1fd,%edx,%eax
+80101129:	29 c1                	sub    %eax,%ecx
+      acquire(&bk->lock);
+8010112b:	6b d1 64             	imul   $0x64,%ecx,%edx
+8010112e:	8d ba 00 d1 18 80    	lea    -0x7fe72f00(%edx),%edi
+80101134:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80101137:	57                   	push   %edi
+80101138:	e8 33 5f 00 00       	call   80107070 <acquire>
+      idle = b[i].refcnt == 0 && (b[i].flags & B_DIRTY) == 0;
+8010113d:	8b 86 88 00 00 00    	mov    0x88(%esi),%eax
+80101143:	83 c4 10             	add    $0x10,%esp
+80101146:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80101149:	85 c0                	test   %eax,%eax
+8010114b:	0f 85 ff 00 00 00    	jne    80101250 <bshrink+0x190>
+80101151:	f6 06 04             	testb  $0x4,(%esi)
+80101154:	0f 85 f6 00 00 00    	jne    80101250 <bshrink+0x190>
+      if(idle){
+        for(bp = &bk->head; *bp != &b[i]; bp = &(*bp)->hnext)
+8010115a:	8b 47 60             	mov    0x60(%edi),%eax
+8010115d:	39 f0                	cmp    %esi,%eax
+8010115f:	0f 84 db 01 00 00    	je     80101340 <bshrink+0x280>
+80101165:	8d 76 00             	lea    0x0(%esi),%esi
+80101168:	89 c2                	mov    %eax,%edx
+8010116a:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+80101170:	39 f0                	cmp    %esi,%eax
+80101172:	75 f4                	jne    80101168 <bshrink+0xa8>
+80101174:	81 c2 90 00 00 00    	add    $0x90,%edx
+          ;
+        *bp = b[i].hnext;
+8010117a:	8b 86 90 00 00 00    	mov    0x90(%esi),%eax
+      }
+      release(&bk->lock);
+80101180:	83 ec 0c             	sub    $0xc,%esp
+        *bp = b[i].hnext;
+80101183:	89 02                	mov    %eax,(%edx)
+      release(&bk->lock);
+80101185:	57                   	push   %edi
+80101186:	e8 75 5d 00 00       	call   80106f00 <release>
+8010118b:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < BPP; i++){
+8010118e:	83 c3 01             	add    $0x1,%ebx
+80101191:	81 c6 a8 02 00 00    	add    $0x2a8,%esi
+80101197:	83 fb 06             	cmp    $0x6,%ebx
+8010119a:	0f 85 60 ff ff ff    	jne    80101100 <bshrink+0x40>
+801011a0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+        release(&bk->lock);
+      }
+      continue;
+    }
+
+    for(bp = &bcache.spare; *bp; ){
+801011a3:	8b 7d dc             	mov    -0x24(%ebp),%edi
+801011a6:	bb e0 02 1a 80       	mov    $0x801a02e0,%ebx
+801011ab:	8b 15 e0 02 1a 80    	mov    0x801a02e0,%edx
+      if((char*)*bp >= (char*)pg && (char*)*bp < (char*)pg + PGSIZE)
+801011b1:	8d b0 00 10 00 00    	lea    0x1000(%eax),%esi
+801011b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801011be:	66 90                	xchg   %ax,%ax
+    for(bp = &bcache.spare; *bp; ){
+801011c0:	85 d2                	test   %edx,%edx
+801011c2:	74 16                	je     801011da <bshrink+0x11a>
+      if((char*)*bp >= (char*)pg && (char*)*bp < (char*)pg + PGSIZE)
+801011c4:	89 d1                	mov    %edx,%ecx
+        *bp = (*bp)->hnext;
+801011c6:	8b 92 90 00 00 00    	mov    0x90(%edx),%edx
+      if((char*)*bp >= (char*)pg && (char*)*bp < (char*)pg + PGSIZE)
+801011cc:	39 c1                	cmp    %eax,%ecx
+801011ce:	72 70                	jb     80101240 <bshrink+0x180>
+801011d0:	39 f1                	cmp    %esi,%ecx
+801011d2:	73 6c                	jae    80101240 <bshrink+0x180>
+        *bp = (*bp)->hnext;
+801011d4:	89 13                	mov    %edx,(%ebx)
+    for(bp = &bcache.spare; *bp; ){
+801011d6:	85 d2                	test   %edx,%edx
+801011d8:	75 ea                	jne    801011c4 <bshrink+0x104>
+      else
+        bp = &(*bp)->hnext;
+    }
+    for(i = 0; i < BPP; i++){
+801011da:	8d 9f f0 0f 00 00    	lea    0xff0(%edi),%ebx
+801011e0:	89 c6                	mov    %eax,%esi
+801011e2:	eb 46                	jmp    8010122a <bshrink+0x16a>
+801011e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  b->aprev->anext = b->anext;
+801011e8:	8b 97 98 00 00 00    	mov    0x98(%edi),%edx
+801011ee:	8b 87 94 00 00 00    	mov    0x94(%edi),%eax
+      removebuf(&b[i]);
+      freelock(&b[i].lock.lk);
+801011f4:	83 ec 0c             	sub    $0xc,%esp
+  b->aprev->anext = b->anext;
+801011f7:	89 82 94 00 00 00    	mov    %eax,0x94(%edx)
+  b->anext->aprev = b->aprev;
+801011fd:	8b 97 98 00 00 00    	mov    0x98(%edi),%edx
+80101203:	89 90 98 00 00 00    	mov    %edx,0x98(%eax)
+      freelock(&b[i].lock.lk);
+80101209:	8d 47 14             	lea    0x14(%edi),%eax
+    for(i = 0; i < BPP; i++){
+8010120c:	81 c7 a8 02 00 00    	add    $0x2a8,%edi
+  bcache.nbuf--;
+80101212:	83 2d dc 02 1a 80 01 	subl   $0x1,0x801a02dc
+      freelock(&b[i].lock.lk);
+80101219:	50                   	push   %eax
+8010121a:	e8 a1 58 00 00       	call   80106ac0 <freelock>
+    for(i = 0; i < BPP; i++){
+8010121f:	83 c4 10             	add    $0x10,%esp
+80101222:	39 df                	cmp    %ebx,%edi
+80101224:	0f 84 d6 00 00 00    	je     80101300 <bshrink+0x240>
+  if(bcache.hand == b)
+8010122a:	3b 3d e4 02 1a 80    	cmp    0x801a02e4,%edi
+80101230:	75 b6                	jne    801011e8 <bshrink+0x128>
+    bcache.hand = b->anext;
+80101232:	8b 87 94 00 00 00    	mov    0x94(%edi),%eax
+80101238:	a3 e4 02 1a 80       	mov    %eax,0x801a02e4
+8010123d:	eb a9                	jmp    801011e8 <bshrink+0x128>
+8010123f:	90                   	nop
+        bp = &(*bp)->hnext;
+80101240:	8d 99 90 00 00 00    	lea    0x90(%ecx),%ebx
+    for(bp = &bcache.spare; *bp; ){
+80101246:	e9 75 ff ff ff       	jmp    801011c0 <bshrink+0x100>
+8010124b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010124f:	90                   	nop
+      release(&bk->lock);
+80101250:	83 ec 0c             	sub    $0xc,%esp
+80101253:	57                   	push   %edi
+      while(--i >= 0){
+80101254:	8d 7b ff             	lea    -0x1(%ebx),%edi
+      release(&bk->lock);
+80101257:	e8 a4 5c 00 00       	call   80106f00 <release>
+8010125c:	83 c4 10             	add    $0x10,%esp
+      while(--i >= 0){
+8010125f:	85 db                	test   %ebx,%ebx
+80101261:	74 68                	je     801012cb <bshrink+0x20b>
+80101263:	69 c7 a8 02 00 00    	imul   $0x2a8,%edi,%eax
+80101269:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+8010126c:	8d 5c 03 04          	lea    0x4(%ebx,%eax,1),%ebx
+        if(b[i].dev == NODEV)
+80101270:	8b 43 04             	mov    0x4(%ebx),%eax
+80101273:	83 f8 ff             	cmp    $0xffffffff,%eax
+80101276:	74 45                	je     801012bd <bshrink+0x1fd>
+  return &bcache.bucket[(dev*31 + blockno) % NBUCKET];
+80101278:	89 c1                	mov    %eax,%ecx
+        acquire(&bk->lock);
+8010127a:	83 ec 0c             	sub    $0xc,%esp
+  return &bcache.bucket[(dev*31 + blockno) % NBUCKET];
+8010127d:	c1 e1 05             	shl    $0x5,%ecx
+80101280:	29 c1                	sub    %eax,%ecx
+80101282:	b8 b3 21 c1 80       	mov    $0x80c121b3,%eax
+80101287:	03 4b 08             	add    0x8(%ebx),%ecx
+8010128a:	f7 e1                	mul    %ecx
+8010128c:	c1 ea 08             	shr    $0x8,%edx
+8010128f:	69 c2 fd 01 00 00    	imul   $0x1fd,%edx,%eax
+80101295:	29 c1                	sub    %eax,%ecx
+        acquire(&bk->lock);
+80101297:	6b d1 64             	imul   $0x64,%ecx,%edx
+8010129a:	8d b2 00 d1 18 80    	lea    -0x7fe72f00(%edx),%esi
+801012a0:	56                   	push   %esi
+801012a1:	e8 ca 5d 00 00       	call   80107070 <acquire>
+        b[i].hnext = bk->head;
+801012a6:	8b 46 60             	mov    0x60(%esi),%eax
+801012a9:	89 83 90 00 00 00    	mov    %eax,0x90(%ebx)
+        bk->head = &b[i];
+801012af:	89 5e 60             	mov    %ebx,0x60(%esi)
+        release(&bk->lock);
+801012b2:	89 34 24             	mov    %esi,(%esp)
+801012b5:	e8 46 5c 00 00       	call   80106f00 <release>
+801012ba:	83 c4 10             	add    $0x10,%esp
+      while(--i >= 0){
+801012bd:	83 ef 01             	sub    $0x1,%edi
+801012c0:	81 eb a8 02 00 00    	sub    $0x2a8,%ebx
+801012c6:	83 ff ff             	cmp    $0xffffffff,%edi
+801012c9:	75 a5                	jne    80101270 <bshrink+0x1b0>
+  for(pp = &bcache.pages; (pg = *pp) != 0; pp = &pg->next){
+801012cb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801012ce:	89 45 d8             	mov    %eax,-0x28(%ebp)
+801012d1:	8b 00                	mov    (%eax),%eax
+801012d3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801012d6:	85 c0                	test   %eax,%eax
+801012d8:	0f 85 0f fe ff ff    	jne    801010ed <bshrink+0x2d>
+    bcache.npage--;
+    release(&bcache.evictlock);
+    kfree((char*)pg);
+    return 1;
+  }
+  release(&bcache.evictlock);
+801012de:	83 ec 0c             	sub    $0xc,%esp
+801012e1:	68 d4 97 19 80       	push   $0x801997d4
+801012e6:	e8 15 5c 00 00       	call   80106f00 <release>
+  return 0;
+801012eb:	83 c4 10             	add    $0x10,%esp
+}
+801012ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+801012f1:	31 c0                	xor    %eax,%eax
+}
+801012f3:	5b                   	pop    %ebx
+801012f4:	5e                   	pop    %esi
+801012f5:	5f                   	pop    %edi
+801012f6:	5d                   	pop    %ebp
+801012f7:	c3                   	ret
+801012f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801012ff:	90                   	nop
+    *pp = pg->next;
+80101300:	8b 16                	mov    (%esi),%edx
+80101302:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    release(&bcache.evictlock);
+80101305:	83 ec 0c             	sub    $0xc,%esp
+    *pp = pg->next;
+80101308:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+8010130b:	89 10                	mov    %edx,(%eax)
+    bcache.npage--;
+8010130d:	83 2d d8 02 1a 80 01 	subl   $0x1,0x801a02d8
+    release(&bcache.evictlock);
+80101314:	68 d4 97 19 80       	push   $0x801997d4
+80101319:	e8 e2 5b 00 00       	call   80106f00 <release>
+    kfree((char*)pg);
+8010131e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101321:	89 04 24             	mov    %eax,(%esp)
+80101324:	e8 c7 25 00 00       	call   801038f0 <kfree>
+    return 1;
+80101329:	83 c4 10             	add    $0x10,%esp
+}
+8010132c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 1;
+8010132f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+80101334:	5b                   	pop    %ebx
+80101335:	5e                   	pop    %esi
+80101336:	5f                   	pop    %edi
+80101337:	5d                   	pop    %ebp
+80101338:	c3                   	ret
+80101339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        for(bp = &bk->head; *bp != &b[i]; bp = &(*bp)->hnext)
+80101340:	81 c2 60 d1 18 80    	add    $0x8018d160,%edx
+80101346:	e9 2f fe ff ff       	jmp    8010117a <bshrink+0xba>
+8010134b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010134f:	90                   	nop
+
+80101350 <getdiskstat>:
+
+// Copy the disk and buffer cache statistics to st.
+void
+getdiskstat(struct diskstat *st)
+{
+80101350:	55                   	push   %ebp
+  int i;
+
+  *st = diskstat;
+80101351:	b9 20 00 00 00       	mov    $0x20,%ecx
+{
+80101356:	89 e5                	mov    %esp,%ebp
+80101358:	57                   	push   %edi
+80101359:	56                   	push   %esi
+  *st = diskstat;
+8010135a:	be 80 d0 18 80       	mov    $0x8018d080,%esi
+{
+8010135f:	53                   	push   %ebx
+80101360:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  *st = diskstat;
+80101363:	89 df                	mov    %ebx,%edi
+80101365:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  st->nhit = 0;
+  for(i = 0; i < ncpu; i++)
+80101367:	8b 0d 44 3b 1a 80    	mov    0x801a3b44,%ecx
+  st->nhit = 0;
+8010136d:	c7 43 74 00 00 00 00 	movl   $0x0,0x74(%ebx)
+  for(i = 0; i < ncpu; i++)
+80101374:	85 c9                	test   %ecx,%ecx
+80101376:	7e 22                	jle    8010139a <getdiskstat+0x4a>
+80101378:	69 c9 c4 00 00 00    	imul   $0xc4,%ecx,%ecx
+8010137e:	31 c0                	xor    %eax,%eax
+80101380:	31 d2                	xor    %edx,%edx
+80101382:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    st->nhit += cpus[i].nbhit;
+80101388:	03 90 20 3c 1a 80    	add    -0x7fe5c3e0(%eax),%edx
+  for(i = 0; i < ncpu; i++)
+8010138e:	05 c4 00 00 00       	add    $0xc4,%eax
+    st->nhit += cpus[i].nbhit;
+80101393:	89 53 74             	mov    %edx,0x74(%ebx)
+  for(i = 0; i < ncpu; i++)
+80101396:	39 c1                	cmp    %eax,%ecx
+80101398:	75 ee                	jne    80101388 <getdiskstat+0x38>
+  st->nmiss = bcache.nmiss;
+8010139a:	a1 e8 02 1a 80       	mov    0x801a02e8,%eax
+8010139f:	89 43 78             	mov    %eax,0x78(%ebx)
+  st->nbuf = bcache.nbuf;
+801013a2:	a1 dc 02 1a 80       	mov    0x801a02dc,%eax
+801013a7:	89 43 7c             	mov    %eax,0x7c(%ebx)
+}
+801013aa:	5b                   	pop    %ebx
+801013ab:	5e                   	pop    %esi
+801013ac:	5f                   	pop    %edi
+801013ad:	5d                   	pop    %ebp
+801013ae:	c3                   	ret
+801013af:	90                   	nop
+
+801013b0 <procdumpwork>:
+#define C(x)  ((x)-'@')  // Control-x
+
+static void
+procdumpwork(void *arg)
+{
+  procdump();
+801013b0:	e9 db 50 00 00       	jmp    80106490 <procdump>
+801013b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801013bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801013c0 <consoleread>:
+  release(&cons.lock);
+}
+
+int
+consoleread(struct inode *ip, char *dst, int n)
+{
+801013c0:	55                   	push   %ebp
+801013c1:	89 e5                	mov    %esp,%ebp
+801013c3:	57                   	push   %edi
+801013c4:	56                   	push   %esi
+801013c5:	53                   	push   %ebx
+801013c6:	83 ec 18             	sub    $0x18,%esp
+801013c9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+801013cc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  uint target;
+  int c;
+
+  iunlock(ip);
+801013cf:	ff 75 08             	push   0x8(%ebp)
+  target = n;
+801013d2:	89 df                	mov    %ebx,%edi
+  iunlock(ip);
+801013d4:	e8 67 19 00 00       	call   80102d40 <iunlock>
+  acquire(&cons.lock);
+801013d9:	c7 04 24 a0 03 1a 80 	movl   $0x801a03a0,(%esp)
+801013e0:	e8 8b 5c 00 00       	call   80107070 <acquire>
+  while(n > 0){
+801013e5:	83 c4 10             	add    $0x10,%esp
+801013e8:	85 db                	test   %ebx,%ebx
+801013ea:	0f 8e 94 00 00 00    	jle    80101484 <consoleread+0xc4>
+    while(input.r == input.w){
+801013f0:	a1 80 03 1a 80       	mov    0x801a0380,%eax
+801013f5:	39 05 84 03 1a 80    	cmp    %eax,0x801a0384
+801013fb:	74 25                	je     80101422 <consoleread+0x62>
+801013fd:	eb 59                	jmp    80101458 <consoleread+0x98>
+801013ff:	90                   	nop
+      if(myproc()->killed){
+        release(&cons.lock);
+        ilock(ip);
+        return -1;
+      }
+      sleep(&input.r, &cons.lock);
+80101400:	83 ec 08             	sub    $0x8,%esp
+80101403:	68 a0 03 1a 80       	push   $0x801a03a0
+80101408:	68 80 03 1a 80       	push   $0x801a0380
+8010140d:	e8 2e 4c 00 00       	call   80106040 <sleep>
+    while(input.r == input.w){
+80101412:	a1 80 03 1a 80       	mov    0x801a0380,%eax
+80101417:	83 c4 10             	add    $0x10,%esp
+8010141a:	3b 05 84 03 1a 80    	cmp    0x801a0384,%eax
+80101420:	75 36                	jne    80101458 <consoleread+0x98>
+      if(myproc()->killed){
+80101422:	e8 c9 41 00 00       	call   801055f0 <myproc>
+80101427:	8b 48 2c             	mov    0x2c(%eax),%ecx
+8010142a:	85 c9                	test   %ecx,%ecx
+8010142c:	74 d2                	je     80101400 <consoleread+0x40>
+        release(&cons.lock);
+8010142e:	83 ec 0c             	sub    $0xc,%esp
+80101431:	68 a0 03 1a 80       	push   $0x801a03a0
+80101436:	e8 c5 5a 00 00       	call   80106f00 <release>
+        ilock(ip);
+8010143b:	5a                   	pop    %edx
+8010143c:	ff 75 08             	push   0x8(%ebp)
+8010143f:	e8 ac 17 00 00       	call   80102bf0 <ilock>
+        return -1;
+80101444:	83 c4 10             	add    $0x10,%esp
+  }
+  release(&cons.lock);
+  ilock(ip);
+
+  return target - n;
+}
+80101447:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return -1;
+8010144a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010144f:	5b                   	pop    %ebx
+80101450:	5e                   	pop    %esi
+80101451:	5f                   	pop    %edi
+80101452:	5d                   	pop    %ebp
+80101453:	c3                   	ret
+80101454:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = input.buf[input.r++ % INPUT_BUF];
+80101458:	8d 50 01             	lea    0x1(%eax),%edx
+8010145b:	89 15 80 03 1a 80    	mov    %edx,0x801a0380
+80101461:	89 c2                	mov    %eax,%edx
+80101463:	83 e2 7f             	and    $0x7f,%edx
+80101466:	0f be 8a 00 03 1a 80 	movsbl -0x7fe5fd00(%edx),%ecx
+    if(c == C('D')){  // EOF
+8010146d:	80 f9 04             	cmp    $0x4,%cl
+80101470:	74 37                	je     801014a9 <consoleread+0xe9>
+    *dst++ = c;
+80101472:	83 c6 01             	add    $0x1,%esi
+    --n;
+80101475:	83 eb 01             	sub    $0x1,%ebx
+    *dst++ = c;
+80101478:	88 4e ff             	mov    %cl,-0x1(%esi)
+    if(c == '\n')
+8010147b:	83 f9 0a             	cmp    $0xa,%ecx
+8010147e:	0f 85 64 ff ff ff    	jne    801013e8 <consoleread+0x28>
+  release(&cons.lock);
+80101484:	83 ec 0c             	sub    $0xc,%esp
+80101487:	68 a0 03 1a 80       	push   $0x801a03a0
+8010148c:	e8 6f 5a 00 00       	call   80106f00 <release>
+  ilock(ip);
+80101491:	58                   	pop    %eax
+80101492:	ff 75 08             	push   0x8(%ebp)
+80101495:	e8 56 17 00 00       	call   80102bf0 <ilock>
+  return target - n;
+8010149a:	89 f8                	mov    %edi,%eax
+8010149c:	83 c4 10             	add    $0x10,%esp
+}
+8010149f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return target - n;
+801014a2:	29 d8                	sub    %ebx,%eax
+}
+801014a4:	5b                   	pop    %ebx
+801014a5:	5e                   	pop    %esi
+801014a6:	5f                   	pop    %edi
+801014a7:	5d                   	pop    %ebp
+801014a8:	c3                   	ret
+      if(n < target){
+801014a9:	39 fb                	cmp    %edi,%ebx
+801014ab:	73 d7                	jae    80101484 <consoleread+0xc4>
+        input.r--;
+801014ad:	a3 80 03 1a 80       	mov    %eax,0x801a0380
+801014b2:	eb d0                	jmp    80101484 <consoleread+0xc4>
+801014b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801014bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801014bf:	90                   	nop
+
+801014c0 <panic>:
+{
+801014c0:	55                   	push   %ebp
+801014c1:	89 e5                	mov    %esp,%ebp
+801014c3:	56                   	push   %esi
+801014c4:	53                   	push   %ebx
+801014c5:	83 ec 30             	sub    $0x30,%esp
+  asm volatile("cli");
+801014c8:	fa                   	cli
+  cons.locking = 0;
+801014c9:	c7 05 00 04 1a 80 00 	movl   $0x0,0x801a0400
+801014d0:	00 00 00 
+  getcallerpcs(&s, pcs);
+801014d3:	8d 5d d0             	lea    -0x30(%ebp),%ebx
+801014d6:	8d 75 f8             	lea    -0x8(%ebp),%esi
+  cprintf("lapicid %d: panic: ", lapicid());
+801014d9:	e8 72 29 00 00       	call   80103e50 <lapicid>
+801014de:	83 ec 08             	sub    $0x8,%esp
+801014e1:	50                   	push   %eax
+801014e2:	68 7c b6 10 80       	push   $0x8010b67c
+801014e7:	e8 04 03 00 00       	call   801017f0 <cprintf>
+  cprintf(s);
+801014ec:	58                   	pop    %eax
+801014ed:	ff 75 08             	push   0x8(%ebp)
+801014f0:	e8 fb 02 00 00       	call   801017f0 <cprintf>
+  cprintf("\n");
+801014f5:	c7 04 24 0d c0 10 80 	movl   $0x8010c00d,(%esp)
+801014fc:	e8 ef 02 00 00       	call   801017f0 <cprintf>
+  getcallerpcs(&s, pcs);
+80101501:	8d 45 08             	lea    0x8(%ebp),%eax
+80101504:	5a                   	pop    %edx
+80101505:	59                   	pop    %ecx
+80101506:	53                   	push   %ebx
+80101507:	50                   	push   %eax
+80101508:	e8 53 56 00 00       	call   80106b60 <getcallerpcs>
+  for(i=0; i<10; i++)
+8010150d:	83 c4 10             	add    $0x10,%esp
+    cprintf(" %p", pcs[i]);
+80101510:	83 ec 08             	sub    $0x8,%esp
+80101513:	ff 33                	push   (%ebx)
+  for(i=0; i<10; i++)
+80101515:	83 c3 04             	add    $0x4,%ebx
+    cprintf(" %p", pcs[i]);
+80101518:	68 90 b6 10 80       	push   $0x8010b690
+8010151d:	e8 ce 02 00 00       	call   801017f0 <cprintf>
+  for(i=0; i<10; i++)
+80101522:	83 c4 10             	add    $0x10,%esp
+80101525:	39 f3                	cmp    %esi,%ebx
+80101527:	75 e7                	jne    80101510 <panic+0x50>
+  panicked = 1; // freeze other CPU
+80101529:	c7 05 04 04 1a 80 01 	movl   $0x1,0x801a0404
+80101530:	00 00 00 
+  for(;;)
+80101533:	eb fe                	jmp    80101533 <panic+0x73>
+80101535:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010153c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101540 <consputc.part.0>:
+consputc(int c)
+80101540:	55                   	push   %ebp
+80101541:	89 e5                	mov    %esp,%ebp
+80101543:	57                   	push   %edi
+80101544:	56                   	push   %esi
+80101545:	53                   	push   %ebx
+80101546:	83 ec 1c             	sub    $0x1c,%esp
+  if(c == BACKSPACE){
+80101549:	3d 00 01 00 00       	cmp    $0x100,%eax
+8010154e:	0f 84 cc 00 00 00    	je     80101620 <consputc.part.0+0xe0>
+    uartputc(c);
+80101554:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80101557:	bf d4 03 00 00       	mov    $0x3d4,%edi
+8010155c:	89 c3                	mov    %eax,%ebx
+8010155e:	50                   	push   %eax
+8010155f:	e8 8c 82 00 00       	call   801097f0 <uartputc>
+80101564:	b8 0e 00 00 00       	mov    $0xe,%eax
+80101569:	89 fa                	mov    %edi,%edx
+8010156b:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010156c:	be d5 03 00 00       	mov    $0x3d5,%esi
+80101571:	89 f2                	mov    %esi,%edx
+80101573:	ec                   	in     (%dx),%al
+  pos = inb(CRTPORT+1) << 8;
+80101574:	0f b6 c8             	movzbl %al,%ecx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80101577:	89 fa                	mov    %edi,%edx
+80101579:	b8 0f 00 00 00       	mov    $0xf,%eax
+8010157e:	c1 e1 08             	shl    $0x8,%ecx
+80101581:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80101582:	89 f2                	mov    %esi,%edx
+80101584:	ec                   	in     (%dx),%al
+  pos |= inb(CRTPORT+1);
+80101585:	0f b6 c0             	movzbl %al,%eax
+  if(c == '\n')
+80101588:	83 c4 10             	add    $0x10,%esp
+  pos |= inb(CRTPORT+1);
+8010158b:	09 c8                	or     %ecx,%eax
+  if(c == '\n')
+8010158d:	83 fb 0a             	cmp    $0xa,%ebx
+80101590:	75 76                	jne    80101608 <consputc.part.0+0xc8>
+    pos += 80 - pos%80;
+80101592:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+80101597:	f7 e2                	mul    %edx
+80101599:	c1 ea 06             	shr    $0x6,%edx
+8010159c:	8d 04 92             	lea    (%edx,%edx,4),%eax
+8010159f:	c1 e0 04             	shl    $0x4,%eax
+801015a2:	8d 70 50             	lea    0x50(%eax),%esi
+  if(pos < 0 || pos > 25*80)
+801015a5:	81 fe d0 07 00 00    	cmp    $0x7d0,%esi
+801015ab:	0f 8f 2f 01 00 00    	jg     801016e0 <consputc.part.0+0x1a0>
+  if((pos/80) >= 24){  // Scroll up.
+801015b1:	81 fe 7f 07 00 00    	cmp    $0x77f,%esi
+801015b7:	0f 8f c3 00 00 00    	jg     80101680 <consputc.part.0+0x140>
+  outb(CRTPORT+1, pos>>8);
+801015bd:	89 f0                	mov    %esi,%eax
+  crt[pos] = ' ' | 0x0700;
+801015bf:	8d b4 36 00 80 0b 80 	lea    -0x7ff48000(%esi,%esi,1),%esi
+  outb(CRTPORT+1, pos);
+801015c6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  outb(CRTPORT+1, pos>>8);
+801015c9:	0f b6 fc             	movzbl %ah,%edi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801015cc:	bb d4 03 00 00       	mov    $0x3d4,%ebx
+801015d1:	b8 0e 00 00 00       	mov    $0xe,%eax
+801015d6:	89 da                	mov    %ebx,%edx
+801015d8:	ee                   	out    %al,(%dx)
+801015d9:	b9 d5 03 00 00       	mov    $0x3d5,%ecx
+801015de:	89 f8                	mov    %edi,%eax
+801015e0:	89 ca                	mov    %ecx,%edx
+801015e2:	ee                   	out    %al,(%dx)
+801015e3:	b8 0f 00 00 00       	mov    $0xf,%eax
+801015e8:	89 da                	mov    %ebx,%edx
+801015ea:	ee                   	out    %al,(%dx)
+801015eb:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+801015ef:	89 ca                	mov    %ecx,%edx
+801015f1:	ee                   	out    %al,(%dx)
+  crt[pos] = ' ' | 0x0700;
+801015f2:	b8 20 07 00 00       	mov    $0x720,%eax
+801015f7:	66 89 06             	mov    %ax,(%esi)
+}
+801015fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801015fd:	5b                   	pop    %ebx
+801015fe:	5e                   	pop    %esi
+801015ff:	5f                   	pop    %edi
+80101600:	5d                   	pop    %ebp
+80101601:	c3                   	ret
+80101602:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    crt[pos++] = (c&0xff) | 0x0700;  // black on white
+80101608:	0f b6 db             	movzbl %bl,%ebx
+8010160b:	8d 70 01             	lea    0x1(%eax),%esi
+8010160e:	80 cf 07             	or     $0x7,%bh
+80101611:	66 89 9c 00 00 80 0b 	mov    %bx,-0x7ff48000(%eax,%eax,1)
+80101618:	80 
+80101619:	eb 8a                	jmp    801015a5 <consputc.part.0+0x65>
+8010161b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010161f:	90                   	nop
+    uartputc('\b'); uartputc(' '); uartputc('\b');
+80101620:	83 ec 0c             	sub    $0xc,%esp
+80101623:	be d4 03 00 00       	mov    $0x3d4,%esi
+80101628:	6a 08                	push   $0x8
+8010162a:	e8 c1 81 00 00       	call   801097f0 <uartputc>
+8010162f:	c7 04 24 20 00 00 00 	movl   $0x20,(%esp)
+80101636:	e8 b5 81 00 00       	call   801097f0 <uartputc>
+8010163b:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+80101642:	e8 a9 81 00 00       	call   801097f0 <uartputc>
+80101647:	b8 0e 00 00 00       	mov    $0xe,%eax
+8010164c:	89 f2                	mov    %esi,%edx
+8010164e:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010164f:	bb d5 03 00 00       	mov    $0x3d5,%ebx
+80101654:	89 da                	mov    %ebx,%edx
+80101656:	ec                   	in     (%dx),%al
+  pos = inb(CRTPORT+1) << 8;
+80101657:	0f b6 c8             	movzbl %al,%ecx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010165a:	89 f2                	mov    %esi,%edx
+8010165c:	b8 0f 00 00 00       	mov    $0xf,%eax
+80101661:	c1 e1 08             	shl    $0x8,%ecx
+80101664:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80101665:	89 da                	mov    %ebx,%edx
+80101667:	ec                   	in     (%dx),%al
+  pos |= inb(CRTPORT+1);
+80101668:	0f b6 f0             	movzbl %al,%esi
+    if(pos > 0) --pos;
+8010166b:	83 c4 10             	add    $0x10,%esp
+8010166e:	09 ce                	or     %ecx,%esi
+80101670:	74 5e                	je     801016d0 <consputc.part.0+0x190>
+80101672:	83 ee 01             	sub    $0x1,%esi
+80101675:	e9 2b ff ff ff       	jmp    801015a5 <consputc.part.0+0x65>
+8010167a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    memmove(crt, crt+80, sizeof(crt[0])*23*80);
+80101680:	83 ec 04             	sub    $0x4,%esp
+    pos -= 80;
+80101683:	8d 5e b0             	lea    -0x50(%esi),%ebx
+    memset(crt+pos, 0, sizeof(crt[0])*(24*80 - pos));
+80101686:	8d b4 36 60 7f 0b 80 	lea    -0x7ff480a0(%esi,%esi,1),%esi
+  outb(CRTPORT+1, pos);
+8010168d:	bf 07 00 00 00       	mov    $0x7,%edi
+    memmove(crt, crt+80, sizeof(crt[0])*23*80);
+80101692:	68 60 0e 00 00       	push   $0xe60
+80101697:	68 a0 80 0b 80       	push   $0x800b80a0
+8010169c:	68 00 80 0b 80       	push   $0x800b8000
+801016a1:	e8 aa 5d 00 00       	call   80107450 <memmove>
+    memset(crt+pos, 0, sizeof(crt[0])*(24*80 - pos));
+801016a6:	b8 80 07 00 00       	mov    $0x780,%eax
+801016ab:	83 c4 0c             	add    $0xc,%esp
+801016ae:	29 d8                	sub    %ebx,%eax
+801016b0:	01 c0                	add    %eax,%eax
+801016b2:	50                   	push   %eax
+801016b3:	6a 00                	push   $0x0
+801016b5:	56                   	push   %esi
+801016b6:	e8 05 5d 00 00       	call   801073c0 <memset>
+  outb(CRTPORT+1, pos);
+801016bb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+801016be:	83 c4 10             	add    $0x10,%esp
+801016c1:	e9 06 ff ff ff       	jmp    801015cc <consputc.part.0+0x8c>
+801016c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801016cd:	8d 76 00             	lea    0x0(%esi),%esi
+801016d0:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+801016d4:	be 00 80 0b 80       	mov    $0x800b8000,%esi
+801016d9:	31 ff                	xor    %edi,%edi
+801016db:	e9 ec fe ff ff       	jmp    801015cc <consputc.part.0+0x8c>
+    panic("pos under/overflow");
+801016e0:	83 ec 0c             	sub    $0xc,%esp
+801016e3:	68 94 b6 10 80       	push   $0x8010b694
+801016e8:	e8 d3 fd ff ff       	call   801014c0 <panic>
+801016ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+801016f0 <consolewrite>:
+
+int
+consolewrite(struct inode *ip, char *buf, int n)
+{
+801016f0:	55                   	push   %ebp
+801016f1:	89 e5                	mov    %esp,%ebp
+801016f3:	57                   	push   %edi
+801016f4:	56                   	push   %esi
+801016f5:	53                   	push   %ebx
+801016f6:	83 ec 18             	sub    $0x18,%esp
+801016f9:	8b 75 10             	mov    0x10(%ebp),%esi
+  int i;
+
+  iunlock(ip);
+801016fc:	ff 75 08             	push   0x8(%ebp)
+801016ff:	e8 3c 16 00 00       	call   80102d40 <iunlock>
+  acquire(&cons.lock);
+80101704:	c7 04 24 a0 03 1a 80 	movl   $0x801a03a0,(%esp)
+8010170b:	e8 60 59 00 00       	call   80107070 <acquire>
+  for(i = 0; i < n; i++)
+80101710:	83 c4 10             	add    $0x10,%esp
+80101713:	85 f6                	test   %esi,%esi
+80101715:	7e 25                	jle    8010173c <consolewrite+0x4c>
+80101717:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+8010171a:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+  if(panicked){
+8010171d:	8b 15 04 04 1a 80    	mov    0x801a0404,%edx
+    consputc(buf[i] & 0xff);
+80101723:	0f b6 03             	movzbl (%ebx),%eax
+  if(panicked){
+80101726:	85 d2                	test   %edx,%edx
+80101728:	74 06                	je     80101730 <consolewrite+0x40>
+  asm volatile("cli");
+8010172a:	fa                   	cli
+    for(;;)
+8010172b:	eb fe                	jmp    8010172b <consolewrite+0x3b>
+8010172d:	8d 76 00             	lea    0x0(%esi),%esi
+80101730:	e8 0b fe ff ff       	call   80101540 <consputc.part.0>
+  for(i = 0; i < n; i++)
+80101735:	83 c3 01             	add    $0x1,%ebx
+80101738:	39 df                	cmp    %ebx,%edi
+8010173a:	75 e1                	jne    8010171d <consolewrite+0x2d>
+  release(&cons.lock);
+8010173c:	83 ec 0c             	sub    $0xc,%esp
+8010173f:	68 a0 03 1a 80       	push   $0x801a03a0
+80101744:	e8 b7 57 00 00       	call   80106f00 <release>
+  ilock(ip);
+80101749:	58                   	pop    %eax
+8010174a:	ff 75 08             	push   0x8(%ebp)
+8010174d:	e8 9e 14 00 00       	call   80102bf0 <ilock>
+
+  return n;
+}
+80101752:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101755:	89 f0                	mov    %esi,%eax
+80101757:	5b                   	pop    %ebx
+80101758:	5e                   	pop    %esi
+80101759:	5f                   	pop    %edi
+8010175a:	5d                   	pop    %ebp
+8010175b:	c3                   	ret
+8010175c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101760 <printint>:
+{
+80101760:	55                   	push   %ebp
+80101761:	89 e5                	mov    %esp,%ebp
+80101763:	57                   	push   %edi
+80101764:	56                   	push   %esi
+80101765:	89 c6                	mov    %eax,%esi
+80101767:	53                   	push   %ebx
+80101768:	89 d3                	mov    %edx,%ebx
+8010176a:	83 ec 2c             	sub    $0x2c,%esp
+  if(sign && (sign = xx < 0))
+8010176d:	85 c9                	test   %ecx,%ecx
+8010176f:	74 04                	je     80101775 <printint+0x15>
+80101771:	85 c0                	test   %eax,%eax
+80101773:	78 63                	js     801017d8 <printint+0x78>
+    x = xx;
+80101775:	89 f1                	mov    %esi,%ecx
+80101777:	31 c0                	xor    %eax,%eax
+  i = 0;
+80101779:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+8010177c:	31 f6                	xor    %esi,%esi
+8010177e:	66 90                	xchg   %ax,%ax
+    buf[i++] = digits[x % base];
+80101780:	89 c8                	mov    %ecx,%eax
+80101782:	31 d2                	xor    %edx,%edx
+80101784:	89 f7                	mov    %esi,%edi
+80101786:	f7 f3                	div    %ebx
+80101788:	8d 76 01             	lea    0x1(%esi),%esi
+8010178b:	0f b6 92 c0 b6 10 80 	movzbl -0x7fef4940(%edx),%edx
+80101792:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+80101796:	89 ca                	mov    %ecx,%edx
+80101798:	89 c1                	mov    %eax,%ecx
+8010179a:	39 da                	cmp    %ebx,%edx
+8010179c:	73 e2                	jae    80101780 <printint+0x20>
+  if(sign)
+8010179e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+801017a1:	85 c0                	test   %eax,%eax
+801017a3:	74 07                	je     801017ac <printint+0x4c>
+    buf[i++] = '-';
+801017a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+801017aa:	89 f7                	mov    %esi,%edi
+801017ac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+801017af:	01 df                	add    %ebx,%edi
+  if(panicked){
+801017b1:	8b 15 04 04 1a 80    	mov    0x801a0404,%edx
+    consputc(buf[i]);
+801017b7:	0f be 07             	movsbl (%edi),%eax
+  if(panicked){
+801017ba:	85 d2                	test   %edx,%edx
+801017bc:	74 0a                	je     801017c8 <printint+0x68>
+801017be:	fa                   	cli
+    for(;;)
+801017bf:	eb fe                	jmp    801017bf <printint+0x5f>
+801017c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801017c8:	e8 73 fd ff ff       	call   80101540 <consputc.part.0>
+  while(--i >= 0)
+801017cd:	8d 47 ff             	lea    -0x1(%edi),%eax
+801017d0:	39 df                	cmp    %ebx,%edi
+801017d2:	74 0c                	je     801017e0 <printint+0x80>
+801017d4:	89 c7                	mov    %eax,%edi
+801017d6:	eb d9                	jmp    801017b1 <printint+0x51>
+801017d8:	89 c8                	mov    %ecx,%eax
+    x = -xx;
+801017da:	89 f1                	mov    %esi,%ecx
+801017dc:	f7 d9                	neg    %ecx
+801017de:	eb 99                	jmp    80101779 <printint+0x19>
+}
+801017e0:	83 c4 2c             	add    $0x2c,%esp
+801017e3:	5b                   	pop    %ebx
+801017e4:	5e                   	pop    %esi
+801017e5:	5f                   	pop    %edi
+801017e6:	5d                   	pop    %ebp
+801017e7:	c3                   	ret
+801017e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801017ef:	90                   	nop
+
+801017f0 <cprintf>:
+{
+801017f0:	55                   	push   %ebp
+801017f1:	89 e5                	mov    %esp,%ebp
+801017f3:	57                   	push   %edi
+801017f4:	56                   	push   %esi
+801017f5:	53                   	push   %ebx
+801017f6:	83 ec 1c             	sub    $0x1c,%esp
+  locking = cons.locking;
+801017f9:	8b 3d 00 04 1a 80    	mov    0x801a0400,%edi
+  if (fmt == 0)
+801017ff:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(locking)
+80101802:	85 ff                	test   %edi,%edi
+80101804:	0f 85 36 01 00 00    	jne    80101940 <cprintf+0x150>
+  if (fmt == 0)
+8010180a:	85 f6                	test   %esi,%esi
+8010180c:	0f 84 e0 01 00 00    	je     801019f2 <cprintf+0x202>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80101812:	0f b6 06             	movzbl (%esi),%eax
+80101815:	85 c0                	test   %eax,%eax
+80101817:	74 6b                	je     80101884 <cprintf+0x94>
+  argp = (uint*)(void*)(&fmt + 1);
+80101819:	8d 55 0c             	lea    0xc(%ebp),%edx
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+8010181c:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+8010181f:	31 db                	xor    %ebx,%ebx
+80101821:	89 d7                	mov    %edx,%edi
+    if(c != '%'){
+80101823:	83 f8 25             	cmp    $0x25,%eax
+80101826:	0f 85 dc 00 00 00    	jne    80101908 <cprintf+0x118>
+    c = fmt[++i] & 0xff;
+8010182c:	83 c3 01             	add    $0x1,%ebx
+8010182f:	0f b6 0c 1e          	movzbl (%esi,%ebx,1),%ecx
+    if(c == 0)
+80101833:	85 c9                	test   %ecx,%ecx
+80101835:	74 42                	je     80101879 <cprintf+0x89>
+    switch(c){
+80101837:	83 f9 70             	cmp    $0x70,%ecx
+8010183a:	0f 84 99 00 00 00    	je     801018d9 <cprintf+0xe9>
+80101840:	7f 4e                	jg     80101890 <cprintf+0xa0>
+80101842:	83 f9 25             	cmp    $0x25,%ecx
+80101845:	0f 84 cd 00 00 00    	je     80101918 <cprintf+0x128>
+8010184b:	83 f9 64             	cmp    $0x64,%ecx
+8010184e:	0f 85 24 01 00 00    	jne    80101978 <cprintf+0x188>
+      printint(*argp++, 10, 1);
+80101854:	8d 47 04             	lea    0x4(%edi),%eax
+80101857:	b9 01 00 00 00       	mov    $0x1,%ecx
+8010185c:	ba 0a 00 00 00       	mov    $0xa,%edx
+80101861:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80101864:	8b 07                	mov    (%edi),%eax
+80101866:	e8 f5 fe ff ff       	call   80101760 <printint>
+8010186b:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+8010186e:	83 c3 01             	add    $0x1,%ebx
+80101871:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+80101875:	85 c0                	test   %eax,%eax
+80101877:	75 aa                	jne    80101823 <cprintf+0x33>
+80101879:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  if(locking)
+8010187c:	85 ff                	test   %edi,%edi
+8010187e:	0f 85 df 00 00 00    	jne    80101963 <cprintf+0x173>
+}
+80101884:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101887:	5b                   	pop    %ebx
+80101888:	5e                   	pop    %esi
+80101889:	5f                   	pop    %edi
+8010188a:	5d                   	pop    %ebp
+8010188b:	c3                   	ret
+8010188c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+80101890:	83 f9 73             	cmp    $0x73,%ecx
+80101893:	75 3b                	jne    801018d0 <cprintf+0xe0>
+      if((s = (char*)*argp++) == 0)
+80101895:	8b 17                	mov    (%edi),%edx
+80101897:	8d 47 04             	lea    0x4(%edi),%eax
+8010189a:	85 d2                	test   %edx,%edx
+8010189c:	0f 85 0e 01 00 00    	jne    801019b0 <cprintf+0x1c0>
+801018a2:	b9 28 00 00 00       	mov    $0x28,%ecx
+        s = "(null)";
+801018a7:	bf a7 b6 10 80       	mov    $0x8010b6a7,%edi
+801018ac:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+801018af:	89 fb                	mov    %edi,%ebx
+801018b1:	89 f7                	mov    %esi,%edi
+801018b3:	89 c6                	mov    %eax,%esi
+801018b5:	0f be c1             	movsbl %cl,%eax
+  if(panicked){
+801018b8:	8b 15 04 04 1a 80    	mov    0x801a0404,%edx
+801018be:	85 d2                	test   %edx,%edx
+801018c0:	0f 84 fe 00 00 00    	je     801019c4 <cprintf+0x1d4>
+801018c6:	fa                   	cli
+    for(;;)
+801018c7:	eb fe                	jmp    801018c7 <cprintf+0xd7>
+801018c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+801018d0:	83 f9 78             	cmp    $0x78,%ecx
+801018d3:	0f 85 9f 00 00 00    	jne    80101978 <cprintf+0x188>
+      printint(*argp++, 16, 0);
+801018d9:	8d 47 04             	lea    0x4(%edi),%eax
+801018dc:	31 c9                	xor    %ecx,%ecx
+801018de:	ba 10 00 00 00       	mov    $0x10,%edx
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+801018e3:	83 c3 01             	add    $0x1,%ebx
+      printint(*argp++, 16, 0);
+801018e6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801018e9:	8b 07                	mov    (%edi),%eax
+801018eb:	e8 70 fe ff ff       	call   80101760 <printint>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+801018f0:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+      printint(*argp++, 16, 0);
+801018f4:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+801018f7:	85 c0                	test   %eax,%eax
+801018f9:	0f 85 24 ff ff ff    	jne    80101823 <cprintf+0x33>
+801018ff:	e9 75 ff ff ff       	jmp    80101879 <cprintf+0x89>
+80101904:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(panicked){
+80101908:	8b 0d 04 04 1a 80    	mov    0x801a0404,%ecx
+8010190e:	85 c9                	test   %ecx,%ecx
+80101910:	74 15                	je     80101927 <cprintf+0x137>
+80101912:	fa                   	cli
+    for(;;)
+80101913:	eb fe                	jmp    80101913 <cprintf+0x123>
+80101915:	8d 76 00             	lea    0x0(%esi),%esi
+  if(panicked){
+80101918:	8b 0d 04 04 1a 80    	mov    0x801a0404,%ecx
+8010191e:	85 c9                	test   %ecx,%ecx
+80101920:	75 7e                	jne    801019a0 <cprintf+0x1b0>
+80101922:	b8 25 00 00 00       	mov    $0x25,%eax
+80101927:	e8 14 fc ff ff       	call   80101540 <consputc.part.0>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+8010192c:	83 c3 01             	add    $0x1,%ebx
+8010192f:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+80101933:	85 c0                	test   %eax,%eax
+80101935:	0f 85 e8 fe ff ff    	jne    80101823 <cprintf+0x33>
+8010193b:	e9 39 ff ff ff       	jmp    80101879 <cprintf+0x89>
+    acquire(&cons.lock);
+80101940:	83 ec 0c             	sub    $0xc,%esp
+80101943:	68 a0 03 1a 80       	push   $0x801a03a0
+80101948:	e8 23 57 00 00       	call   80107070 <acquire>
+  if (fmt == 0)
+8010194d:	83 c4 10             	add    $0x10,%esp
+80101950:	85 f6                	test   %esi,%esi
+80101952:	0f 84 9a 00 00 00    	je     801019f2 <cprintf+0x202>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80101958:	0f b6 06             	movzbl (%esi),%eax
+8010195b:	85 c0                	test   %eax,%eax
+8010195d:	0f 85 b6 fe ff ff    	jne    80101819 <cprintf+0x29>
+    release(&cons.lock);
+80101963:	83 ec 0c             	sub    $0xc,%esp
+80101966:	68 a0 03 1a 80       	push   $0x801a03a0
+8010196b:	e8 90 55 00 00       	call   80106f00 <release>
+80101970:	83 c4 10             	add    $0x10,%esp
+80101973:	e9 0c ff ff ff       	jmp    80101884 <cprintf+0x94>
+  if(panicked){
+80101978:	8b 15 04 04 1a 80    	mov    0x801a0404,%edx
+8010197e:	85 d2                	test   %edx,%edx
+80101980:	75 26                	jne    801019a8 <cprintf+0x1b8>
+80101982:	b8 25 00 00 00       	mov    $0x25,%eax
+80101987:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+8010198a:	e8 b1 fb ff ff       	call   80101540 <consputc.part.0>
+8010198f:	a1 04 04 1a 80       	mov    0x801a0404,%eax
+80101994:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80101997:	85 c0                	test   %eax,%eax
+80101999:	74 4b                	je     801019e6 <cprintf+0x1f6>
+8010199b:	fa                   	cli
+    for(;;)
+8010199c:	eb fe                	jmp    8010199c <cprintf+0x1ac>
+8010199e:	66 90                	xchg   %ax,%ax
+801019a0:	fa                   	cli
+801019a1:	eb fe                	jmp    801019a1 <cprintf+0x1b1>
+801019a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801019a7:	90                   	nop
+801019a8:	fa                   	cli
+801019a9:	eb fe                	jmp    801019a9 <cprintf+0x1b9>
+801019ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801019af:	90                   	nop
+      for(; *s; s++)
+801019b0:	0f b6 0a             	movzbl (%edx),%ecx
+      if((s = (char*)*argp++) == 0)
+801019b3:	89 d7                	mov    %edx,%edi
+      for(; *s; s++)
+801019b5:	84 c9                	test   %cl,%cl
+801019b7:	0f 85 ef fe ff ff    	jne    801018ac <cprintf+0xbc>
+      if((s = (char*)*argp++) == 0)
+801019bd:	89 c7                	mov    %eax,%edi
+801019bf:	e9 aa fe ff ff       	jmp    8010186e <cprintf+0x7e>
+801019c4:	e8 77 fb ff ff       	call   80101540 <consputc.part.0>
+      for(; *s; s++)
+801019c9:	0f be 43 01          	movsbl 0x1(%ebx),%eax
+801019cd:	83 c3 01             	add    $0x1,%ebx
+801019d0:	84 c0                	test   %al,%al
+801019d2:	0f 85 e0 fe ff ff    	jne    801018b8 <cprintf+0xc8>
+      if((s = (char*)*argp++) == 0)
+801019d8:	89 f0                	mov    %esi,%eax
+801019da:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+801019dd:	89 fe                	mov    %edi,%esi
+801019df:	89 c7                	mov    %eax,%edi
+801019e1:	e9 88 fe ff ff       	jmp    8010186e <cprintf+0x7e>
+801019e6:	89 c8                	mov    %ecx,%eax
+801019e8:	e8 53 fb ff ff       	call   80101540 <consputc.part.0>
+801019ed:	e9 7c fe ff ff       	jmp    8010186e <cprintf+0x7e>
+    panic("null fmt");
+801019f2:	83 ec 0c             	sub    $0xc,%esp
+801019f5:	68 ae b6 10 80       	push   $0x8010b6ae
+801019fa:	e8 c1 fa ff ff       	call   801014c0 <panic>
+801019ff:	90                   	nop
+
+80101a00 <consoleintr>:
+{
+80101a00:	55                   	push   %ebp
+80101a01:	89 e5                	mov    %esp,%ebp
+80101a03:	56                   	push   %esi
+80101a04:	53                   	push   %ebx
+80101a05:	8b 75 08             	mov    0x8(%ebp),%esi
+  acquire(&cons.lock);
+80101a08:	83 ec 0c             	sub    $0xc,%esp
+80101a0b:	68 a0 03 1a 80       	push   $0x801a03a0
+80101a10:	e8 5b 56 00 00       	call   80107070 <acquire>
+  while((c = getc()) >= 0){
+80101a15:	83 c4 10             	add    $0x10,%esp
+80101a18:	ff d6                	call   *%esi
+80101a1a:	89 c3                	mov    %eax,%ebx
+80101a1c:	85 c0                	test   %eax,%eax
+80101a1e:	78 3a                	js     80101a5a <consoleintr+0x5a>
+    switch(c){
+80101a20:	83 fb 15             	cmp    $0x15,%ebx
+80101a23:	0f 84 df 00 00 00    	je     80101b08 <consoleintr+0x108>
+80101a29:	7f 45                	jg     80101a70 <consoleintr+0x70>
+80101a2b:	83 fb 08             	cmp    $0x8,%ebx
+80101a2e:	0f 84 ac 00 00 00    	je     80101ae0 <consoleintr+0xe0>
+80101a34:	83 fb 10             	cmp    $0x10,%ebx
+80101a37:	0f 85 2e 01 00 00    	jne    80101b6b <consoleintr+0x16b>
+      queuework(&syswq, &dumpwork);
+80101a3d:	83 ec 08             	sub    $0x8,%esp
+80101a40:	68 00 d0 10 80       	push   $0x8010d000
+80101a45:	68 80 39 1c 80       	push   $0x801c3980
+80101a4a:	e8 81 9a 00 00       	call   8010b4d0 <queuework>
+      break;
+80101a4f:	83 c4 10             	add    $0x10,%esp
+  while((c = getc()) >= 0){
+80101a52:	ff d6                	call   *%esi
+80101a54:	89 c3                	mov    %eax,%ebx
+80101a56:	85 c0                	test   %eax,%eax
+80101a58:	79 c6                	jns    80101a20 <consoleintr+0x20>
+  release(&cons.lock);
+80101a5a:	c7 45 08 a0 03 1a 80 	movl   $0x801a03a0,0x8(%ebp)
+}
+80101a61:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101a64:	5b                   	pop    %ebx
+80101a65:	5e                   	pop    %esi
+80101a66:	5d                   	pop    %ebp
+  release(&cons.lock);
+80101a67:	e9 94 54 00 00       	jmp    80106f00 <release>
+80101a6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+80101a70:	83 fb 7f             	cmp    $0x7f,%ebx
+80101a73:	74 6b                	je     80101ae0 <consoleintr+0xe0>
+      if(c != 0 && input.e-input.r < INPUT_BUF){
+80101a75:	a1 88 03 1a 80       	mov    0x801a0388,%eax
+80101a7a:	89 c2                	mov    %eax,%edx
+80101a7c:	2b 15 80 03 1a 80    	sub    0x801a0380,%edx
+80101a82:	83 fa 7f             	cmp    $0x7f,%edx
+80101a85:	77 91                	ja     80101a18 <consoleintr+0x18>
+  if(panicked){
+80101a87:	8b 15 04 04 1a 80    	mov    0x801a0404,%edx
+        input.buf[input.e++ % INPUT_BUF] = c;
+80101a8d:	8d 48 01             	lea    0x1(%eax),%ecx
+80101a90:	83 e0 7f             	and    $0x7f,%eax
+80101a93:	89 0d 88 03 1a 80    	mov    %ecx,0x801a0388
+80101a99:	88 98 00 03 1a 80    	mov    %bl,-0x7fe5fd00(%eax)
+  if(panicked){
+80101a9f:	85 d2                	test   %edx,%edx
+80101aa1:	0f 85 31 01 00 00    	jne    80101bd8 <consoleintr+0x1d8>
+80101aa7:	89 d8                	mov    %ebx,%eax
+80101aa9:	e8 92 fa ff ff       	call   80101540 <consputc.part.0>
+        if(c == '\n' || c == C('D') || input.e == input.r+INPUT_BUF){
+80101aae:	83 fb 0a             	cmp    $0xa,%ebx
+80101ab1:	0f 84 02 01 00 00    	je     80101bb9 <consoleintr+0x1b9>
+80101ab7:	83 fb 04             	cmp    $0x4,%ebx
+80101aba:	0f 84 f9 00 00 00    	je     80101bb9 <consoleintr+0x1b9>
+80101ac0:	a1 80 03 1a 80       	mov    0x801a0380,%eax
+80101ac5:	83 e8 80             	sub    $0xffffff80,%eax
+80101ac8:	39 05 88 03 1a 80    	cmp    %eax,0x801a0388
+80101ace:	0f 85 44 ff ff ff    	jne    80101a18 <consoleintr+0x18>
+80101ad4:	e9 e5 00 00 00       	jmp    80101bbe <consoleintr+0x1be>
+80101ad9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(input.e != input.w){
+80101ae0:	a1 88 03 1a 80       	mov    0x801a0388,%eax
+80101ae5:	3b 05 84 03 1a 80    	cmp    0x801a0384,%eax
+80101aeb:	0f 84 27 ff ff ff    	je     80101a18 <consoleintr+0x18>
+        input.e--;
+80101af1:	83 e8 01             	sub    $0x1,%eax
+80101af4:	a3 88 03 1a 80       	mov    %eax,0x801a0388
+  if(panicked){
+80101af9:	a1 04 04 1a 80       	mov    0x801a0404,%eax
+80101afe:	85 c0                	test   %eax,%eax
+80101b00:	74 5a                	je     80101b5c <consoleintr+0x15c>
+80101b02:	fa                   	cli
+    for(;;)
+80101b03:	eb fe                	jmp    80101b03 <consoleintr+0x103>
+80101b05:	8d 76 00             	lea    0x0(%esi),%esi
+      while(input.e != input.w &&
+80101b08:	a1 88 03 1a 80       	mov    0x801a0388,%eax
+80101b0d:	39 05 84 03 1a 80    	cmp    %eax,0x801a0384
+80101b13:	0f 84 ff fe ff ff    	je     80101a18 <consoleintr+0x18>
+            input.buf[(input.e-1) % INPUT_BUF] != '\n'){
+80101b19:	83 e8 01             	sub    $0x1,%eax
+80101b1c:	89 c2                	mov    %eax,%edx
+80101b1e:	83 e2 7f             	and    $0x7f,%edx
+      while(input.e != input.w &&
+80101b21:	80 ba 00 03 1a 80 0a 	cmpb   $0xa,-0x7fe5fd00(%edx)
+80101b28:	0f 84 ea fe ff ff    	je     80101a18 <consoleintr+0x18>
+  if(panicked){
+80101b2e:	8b 15 04 04 1a 80    	mov    0x801a0404,%edx
+        input.e--;
+80101b34:	a3 88 03 1a 80       	mov    %eax,0x801a0388
+  if(panicked){
+80101b39:	85 d2                	test   %edx,%edx
+80101b3b:	74 03                	je     80101b40 <consoleintr+0x140>
+80101b3d:	fa                   	cli
+    for(;;)
+80101b3e:	eb fe                	jmp    80101b3e <consoleintr+0x13e>
+80101b40:	b8 00 01 00 00       	mov    $0x100,%eax
+80101b45:	e8 f6 f9 ff ff       	call   80101540 <consputc.part.0>
+      while(input.e != input.w &&
+80101b4a:	a1 88 03 1a 80       	mov    0x801a0388,%eax
+80101b4f:	3b 05 84 03 1a 80    	cmp    0x801a0384,%eax
+80101b55:	75 c2                	jne    80101b19 <consoleintr+0x119>
+80101b57:	e9 bc fe ff ff       	jmp    80101a18 <consoleintr+0x18>
+80101b5c:	b8 00 01 00 00       	mov    $0x100,%eax
+80101b61:	e8 da f9 ff ff       	call   80101540 <consputc.part.0>
+80101b66:	e9 ad fe ff ff       	jmp    80101a18 <consoleintr+0x18>
+      if(c != 0 && input.e-input.r < INPUT_BUF){
+80101b6b:	85 db                	test   %ebx,%ebx
+80101b6d:	0f 84 a5 fe ff ff    	je     80101a18 <consoleintr+0x18>
+80101b73:	a1 88 03 1a 80       	mov    0x801a0388,%eax
+80101b78:	89 c2                	mov    %eax,%edx
+80101b7a:	2b 15 80 03 1a 80    	sub    0x801a0380,%edx
+80101b80:	83 fa 7f             	cmp    $0x7f,%edx
+80101b83:	0f 87 8f fe ff ff    	ja     80101a18 <consoleintr+0x18>
+        input.buf[input.e++ % INPUT_BUF] = c;
+80101b89:	8d 48 01             	lea    0x1(%eax),%ecx
+  if(panicked){
+80101b8c:	8b 15 04 04 1a 80    	mov    0x801a0404,%edx
+        input.buf[input.e++ % INPUT_BUF] = c;
+80101b92:	83 e0 7f             	and    $0x7f,%eax
+        c = (c == '\r') ? '\n' : c;
+80101b95:	83 fb 0d             	cmp    $0xd,%ebx
+80101b98:	0f 85 f5 fe ff ff    	jne    80101a93 <consoleintr+0x93>
+        input.buf[input.e++ % INPUT_BUF] = c;
+80101b9e:	89 0d 88 03 1a 80    	mov    %ecx,0x801a0388
+80101ba4:	c6 80 00 03 1a 80 0a 	movb   $0xa,-0x7fe5fd00(%eax)
+  if(panicked){
+80101bab:	85 d2                	test   %edx,%edx
+80101bad:	75 29                	jne    80101bd8 <consoleintr+0x1d8>
+80101baf:	b8 0a 00 00 00       	mov    $0xa,%eax
+80101bb4:	e8 87 f9 ff ff       	call   80101540 <consputc.part.0>
+          input.w = input.e;
+80101bb9:	a1 88 03 1a 80       	mov    0x801a0388,%eax
+          wakeup(&input.r);
+80101bbe:	83 ec 0c             	sub    $0xc,%esp
+          input.w = input.e;
+80101bc1:	a3 84 03 1a 80       	mov    %eax,0x801a0384
+          wakeup(&input.r);
+80101bc6:	68 80 03 1a 80       	push   $0x801a0380
+80101bcb:	e8 20 45 00 00       	call   801060f0 <wakeup>
+80101bd0:	83 c4 10             	add    $0x10,%esp
+80101bd3:	e9 40 fe ff ff       	jmp    80101a18 <consoleintr+0x18>
+80101bd8:	fa                   	cli
+    for(;;)
+80101bd9:	eb fe                	jmp    80101bd9 <consoleintr+0x1d9>
+80101bdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101bdf:	90                   	nop
+
+80101be0 <consoleinit>:
+
+void
+consoleinit(void)
+{
+80101be0:	55                   	push   %ebp
+80101be1:	89 e5                	mov    %esp,%ebp
+80101be3:	83 ec 10             	sub    $0x10,%esp
+  initlock(&cons.lock, "console");
+80101be6:	68 b7 b6 10 80       	push   $0x8010b6b7
+80101beb:	68 a0 03 1a 80       	push   $0x801a03a0
+80101bf0:	e8 6b 4d 00 00       	call   80106960 <initlock>
+
+  devsw[CONSOLE].write = consolewrite;
+80101bf5:	c7 05 0c 11 1a 80 f0 	movl   $0x801016f0,0x801a110c
+80101bfc:	16 10 80 
+  devsw[CONSOLE].read = consoleread;
+80101bff:	c7 05 08 11 1a 80 c0 	movl   $0x801013c0,0x801a1108
+80101c06:	13 10 80 
+  cons.locking = 1;
+80101c09:	c7 05 00 04 1a 80 01 	movl   $0x1,0x801a0400
+80101c10:	00 00 00 
+
+  ioapicenable(IRQ_KBD, 0);
+80101c13:	58                   	pop    %eax
+80101c14:	5a                   	pop    %edx
+80101c15:	6a 00                	push   $0x0
+80101c17:	6a 01                	push   $0x1
+80101c19:	e8 92 1c 00 00       	call   801038b0 <ioapicenable>
+}
+80101c1e:	83 c4 10             	add    $0x10,%esp
+80101c21:	c9                   	leave
+80101c22:	c3                   	ret
+80101c23:	66 90                	xchg   %ax,%ax
+80101c25:	66 90                	xchg   %ax,%ax
+80101c27:	66 90                	xchg   %ax,%ax
+80101c29:	66 90                	xchg   %ax,%ax
+80101c2b:	66 90                	xchg   %ax,%ax
+80101c2d:	66 90                	xchg   %ax,%ax
+80101c2f:	90                   	nop
+
+80101c30 <loadimage>:
+// Load the program at path into a new page table for process
+// pid, with argv on its stack.  Returns the page table and sets
+// *szp, *eipp and *espp for the new image, or returns 0.
+pde_t*
+loadimage(char *path, char **argv, int pid, uint *szp, uint *eipp, uint *espp)
+{
+80101c30:	55                   	push   %ebp
+80101c31:	89 e5                	mov    %esp,%ebp
+80101c33:	57                   	push   %edi
+80101c34:	56                   	push   %esi
+80101c35:	53                   	push   %ebx
+80101c36:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+  struct elfhdr elf;
+  struct inode *ip;
+  struct proghdr ph;
+  pde_t *pgdir;
+
+  begin_op();
+80101c3c:	e8 7f 27 00 00       	call   801043c0 <begin_op>
+
+  if((ip = namei(path)) == 0){
+80101c41:	83 ec 0c             	sub    $0xc,%esp
+80101c44:	ff 75 08             	push   0x8(%ebp)
+80101c47:	e8 54 1a 00 00       	call   801036a0 <namei>
+80101c4c:	83 c4 10             	add    $0x10,%esp
+80101c4f:	85 c0                	test   %eax,%eax
+80101c51:	0f 84 69 01 00 00    	je     80101dc0 <loadimage+0x190>
+    end_op();
+    cprintf("exec: fail\n");
+    return 0;
+  }
+  ilockshared(ip);
+80101c57:	83 ec 0c             	sub    $0xc,%esp
+80101c5a:	89 c3                	mov    %eax,%ebx
+80101c5c:	50                   	push   %eax
+80101c5d:	e8 7e 10 00 00       	call   80102ce0 <ilockshared>
+  pgdir = 0;
+
+  // Check ELF header
+  if(readi(ip, (char*)&elf, 0, sizeof(elf)) != sizeof(elf))
+80101c62:	8d 85 24 ff ff ff    	lea    -0xdc(%ebp),%eax
+80101c68:	6a 34                	push   $0x34
+80101c6a:	6a 00                	push   $0x0
+80101c6c:	50                   	push   %eax
+80101c6d:	53                   	push   %ebx
+80101c6e:	e8 9d 13 00 00       	call   80103010 <readi>
+80101c73:	83 c4 20             	add    $0x20,%esp
+80101c76:	83 f8 34             	cmp    $0x34,%eax
+80101c79:	0f 85 1d 01 00 00    	jne    80101d9c <loadimage+0x16c>
+    goto bad;
+  if(elf.magic != ELF_MAGIC)
+80101c7f:	81 bd 24 ff ff ff 7f 	cmpl   $0x464c457f,-0xdc(%ebp)
+80101c86:	45 4c 46 
+80101c89:	0f 85 0d 01 00 00    	jne    80101d9c <loadimage+0x16c>
+    goto bad;
+
+  if((pgdir = setupkvm()) == 0)
+80101c8f:	e8 2c 93 00 00       	call   8010afc0 <setupkvm>
+80101c94:	85 c0                	test   %eax,%eax
+80101c96:	0f 84 00 01 00 00    	je     80101d9c <loadimage+0x16c>
+    goto bad;
+  if(mapupages(pgdir, pid) < 0)
+80101c9c:	83 ec 08             	sub    $0x8,%esp
+80101c9f:	ff 75 10             	push   0x10(%ebp)
+80101ca2:	50                   	push   %eax
+80101ca3:	89 85 f4 fe ff ff    	mov    %eax,-0x10c(%ebp)
+80101ca9:	e8 f2 8f 00 00       	call   8010aca0 <mapupages>
+80101cae:	83 c4 10             	add    $0x10,%esp
+80101cb1:	8b 95 f4 fe ff ff    	mov    -0x10c(%ebp),%edx
+80101cb7:	85 c0                	test   %eax,%eax
+80101cb9:	0f 88 31 02 00 00    	js     80101ef0 <loadimage+0x2c0>
+    goto bad;
+
+  // Load program into memory.
+  sz = 0;
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80101cbf:	66 83 bd 50 ff ff ff 	cmpw   $0x0,-0xb0(%ebp)
+80101cc6:	00 
+80101cc7:	8b bd 40 ff ff ff    	mov    -0xc0(%ebp),%edi
+80101ccd:	0f 84 b6 02 00 00    	je     80101f89 <loadimage+0x359>
+  sz = 0;
+80101cd3:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+80101cda:	00 00 00 
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80101cdd:	31 f6                	xor    %esi,%esi
+80101cdf:	e9 8a 00 00 00       	jmp    80101d6e <loadimage+0x13e>
+80101ce4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
+      goto bad;
+    if(ph.type != ELF_PROG_LOAD)
+80101ce8:	83 bd 04 ff ff ff 01 	cmpl   $0x1,-0xfc(%ebp)
+80101cef:	75 6c                	jne    80101d5d <loadimage+0x12d>
+      continue;
+    if(ph.memsz < ph.filesz)
+80101cf1:	8b 85 18 ff ff ff    	mov    -0xe8(%ebp),%eax
+80101cf7:	3b 85 14 ff ff ff    	cmp    -0xec(%ebp),%eax
+80101cfd:	0f 82 87 00 00 00    	jb     80101d8a <loadimage+0x15a>
+      goto bad;
+    if(ph.vaddr + ph.memsz < ph.vaddr)
+80101d03:	03 85 0c ff ff ff    	add    -0xf4(%ebp),%eax
+80101d09:	72 7f                	jb     80101d8a <loadimage+0x15a>
+      goto bad;
+    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+80101d0b:	83 ec 04             	sub    $0x4,%esp
+80101d0e:	50                   	push   %eax
+80101d0f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+80101d15:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80101d1b:	e8 e0 90 00 00       	call   8010ae00 <allocuvm>
+80101d20:	83 c4 10             	add    $0x10,%esp
+80101d23:	89 85 f0 fe ff ff    	mov    %eax,-0x110(%ebp)
+80101d29:	85 c0                	test   %eax,%eax
+80101d2b:	74 5d                	je     80101d8a <loadimage+0x15a>
+      goto bad;
+    if(ph.vaddr % PGSIZE != 0)
+80101d2d:	8b 85 0c ff ff ff    	mov    -0xf4(%ebp),%eax
+80101d33:	a9 ff 0f 00 00       	test   $0xfff,%eax
+80101d38:	75 50                	jne    80101d8a <loadimage+0x15a>
+      goto bad;
+    if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
+80101d3a:	83 ec 0c             	sub    $0xc,%esp
+80101d3d:	ff b5 14 ff ff ff    	push   -0xec(%ebp)
+80101d43:	ff b5 08 ff ff ff    	push   -0xf8(%ebp)
+80101d49:	53                   	push   %ebx
+80101d4a:	50                   	push   %eax
+80101d4b:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80101d51:	e8 da 8f 00 00       	call   8010ad30 <loaduvm>
+80101d56:	83 c4 20             	add    $0x20,%esp
+80101d59:	85 c0                	test   %eax,%eax
+80101d5b:	78 2d                	js     80101d8a <loadimage+0x15a>
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80101d5d:	0f b7 85 50 ff ff ff 	movzwl -0xb0(%ebp),%eax
+80101d64:	83 c6 01             	add    $0x1,%esi
+80101d67:	83 c7 20             	add    $0x20,%edi
+80101d6a:	39 f0                	cmp    %esi,%eax
+80101d6c:	7e 72                	jle    80101de0 <loadimage+0x1b0>
+    if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
+80101d6e:	8d 85 04 ff ff ff    	lea    -0xfc(%ebp),%eax
+80101d74:	6a 20                	push   $0x20
+80101d76:	57                   	push   %edi
+80101d77:	50                   	push   %eax
+80101d78:	53                   	push   %ebx
+80101d79:	e8 92 12 00 00       	call   80103010 <readi>
+80101d7e:	83 c4 10             	add    $0x10,%esp
+80101d81:	83 f8 20             	cmp    $0x20,%eax
+80101d84:	0f 84 5e ff ff ff    	je     80101ce8 <loadimage+0xb8>
+  *espp = sp;
+  return pgdir;
+
+ bad:
+  if(pgdir)
+    freevm(pgdir);
+80101d8a:	8b 95 f4 fe ff ff    	mov    -0x10c(%ebp),%edx
+80101d90:	83 ec 0c             	sub    $0xc,%esp
+80101d93:	52                   	push   %edx
+80101d94:	e8 a7 91 00 00       	call   8010af40 <freevm>
+  if(ip){
+80101d99:	83 c4 10             	add    $0x10,%esp
+    iunlockput(ip);
+80101d9c:	83 ec 0c             	sub    $0xc,%esp
+80101d9f:	53                   	push   %ebx
+80101da0:	e8 6b 11 00 00       	call   80102f10 <iunlockput>
+    end_op();
+80101da5:	e8 86 26 00 00       	call   80104430 <end_op>
+80101daa:	83 c4 10             	add    $0x10,%esp
+    return 0;
+80101dad:	31 d2                	xor    %edx,%edx
+  }
+  return 0;
+}
+80101daf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101db2:	89 d0                	mov    %edx,%eax
+80101db4:	5b                   	pop    %ebx
+80101db5:	5e                   	pop    %esi
+80101db6:	5f                   	pop    %edi
+80101db7:	5d                   	pop    %ebp
+80101db8:	c3                   	ret
+80101db9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    end_op();
+80101dc0:	e8 6b 26 00 00       	call   80104430 <end_op>
+    cprintf("exec: fail\n");
+80101dc5:	83 ec 0c             	sub    $0xc,%esp
+80101dc8:	68 d1 b6 10 80       	push   $0x8010b6d1
+80101dcd:	e8 1e fa ff ff       	call   801017f0 <cprintf>
+    return 0;
+80101dd2:	83 c4 10             	add    $0x10,%esp
+80101dd5:	eb d6                	jmp    80101dad <loadimage+0x17d>
+80101dd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101dde:	66 90                	xchg   %ax,%ax
+  sz = PGROUNDUP(sz);
+80101de0:	8b bd f0 fe ff ff    	mov    -0x110(%ebp),%edi
+80101de6:	8b 95 f4 fe ff ff    	mov    -0x10c(%ebp),%edx
+80101dec:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+80101df2:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+80101df8:	8d b7 00 20 00 00    	lea    0x2000(%edi),%esi
+  iunlockput(ip);
+80101dfe:	83 ec 0c             	sub    $0xc,%esp
+80101e01:	89 95 f4 fe ff ff    	mov    %edx,-0x10c(%ebp)
+80101e07:	53                   	push   %ebx
+80101e08:	e8 03 11 00 00       	call   80102f10 <iunlockput>
+  end_op();
+80101e0d:	e8 1e 26 00 00       	call   80104430 <end_op>
+  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+80101e12:	83 c4 0c             	add    $0xc,%esp
+80101e15:	56                   	push   %esi
+80101e16:	57                   	push   %edi
+80101e17:	8b 95 f4 fe ff ff    	mov    -0x10c(%ebp),%edx
+80101e1d:	52                   	push   %edx
+80101e1e:	e8 dd 8f 00 00       	call   8010ae00 <allocuvm>
+80101e23:	83 c4 10             	add    $0x10,%esp
+80101e26:	8b 95 f4 fe ff ff    	mov    -0x10c(%ebp),%edx
+80101e2c:	85 c0                	test   %eax,%eax
+80101e2e:	89 85 f0 fe ff ff    	mov    %eax,-0x110(%ebp)
+80101e34:	89 c3                	mov    %eax,%ebx
+80101e36:	0f 84 9d 00 00 00    	je     80101ed9 <loadimage+0x2a9>
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+80101e3c:	83 ec 08             	sub    $0x8,%esp
+80101e3f:	8d 80 00 e0 ff ff    	lea    -0x2000(%eax),%eax
+  for(argc = 0; argv[argc]; argc++) {
+80101e45:	31 f6                	xor    %esi,%esi
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+80101e47:	50                   	push   %eax
+80101e48:	52                   	push   %edx
+80101e49:	e8 42 92 00 00       	call   8010b090 <clearpteu>
+  for(argc = 0; argv[argc]; argc++) {
+80101e4e:	8b 45 0c             	mov    0xc(%ebp),%eax
+80101e51:	83 c4 10             	add    $0x10,%esp
+80101e54:	8b 95 f4 fe ff ff    	mov    -0x10c(%ebp),%edx
+80101e5a:	8b 08                	mov    (%eax),%ecx
+80101e5c:	85 c9                	test   %ecx,%ecx
+80101e5e:	0f 84 31 01 00 00    	je     80101f95 <loadimage+0x365>
+80101e64:	89 95 f4 fe ff ff    	mov    %edx,-0x10c(%ebp)
+80101e6a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+80101e6d:	eb 1f                	jmp    80101e8e <loadimage+0x25e>
+80101e6f:	90                   	nop
+80101e70:	8d 46 01             	lea    0x1(%esi),%eax
+    ustack[3+argc] = sp;
+80101e73:	89 9c b5 64 ff ff ff 	mov    %ebx,-0x9c(%ebp,%esi,4)
+80101e7a:	8d 95 58 ff ff ff    	lea    -0xa8(%ebp),%edx
+  for(argc = 0; argv[argc]; argc++) {
+80101e80:	8b 0c 87             	mov    (%edi,%eax,4),%ecx
+80101e83:	85 c9                	test   %ecx,%ecx
+80101e85:	74 7a                	je     80101f01 <loadimage+0x2d1>
+    if(argc >= MAXARG)
+80101e87:	83 f8 20             	cmp    $0x20,%eax
+80101e8a:	74 36                	je     80101ec2 <loadimage+0x292>
+  for(argc = 0; argv[argc]; argc++) {
+80101e8c:	89 c6                	mov    %eax,%esi
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+80101e8e:	83 ec 0c             	sub    $0xc,%esp
+80101e91:	51                   	push   %ecx
+80101e92:	e8 19 57 00 00       	call   801075b0 <strlen>
+80101e97:	29 c3                	sub    %eax,%ebx
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+80101e99:	58                   	pop    %eax
+80101e9a:	ff 34 b7             	push   (%edi,%esi,4)
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+80101e9d:	83 eb 01             	sub    $0x1,%ebx
+80101ea0:	83 e3 fc             	and    $0xfffffffc,%ebx
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+80101ea3:	e8 08 57 00 00       	call   801075b0 <strlen>
+80101ea8:	83 c0 01             	add    $0x1,%eax
+80101eab:	50                   	push   %eax
+80101eac:	ff 34 b7             	push   (%edi,%esi,4)
+80101eaf:	53                   	push   %ebx
+80101eb0:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80101eb6:	e8 a5 93 00 00       	call   8010b260 <copyout>
+80101ebb:	83 c4 20             	add    $0x20,%esp
+80101ebe:	85 c0                	test   %eax,%eax
+80101ec0:	79 ae                	jns    80101e70 <loadimage+0x240>
+    freevm(pgdir);
+80101ec2:	8b 95 f4 fe ff ff    	mov    -0x10c(%ebp),%edx
+80101ec8:	83 ec 0c             	sub    $0xc,%esp
+80101ecb:	52                   	push   %edx
+80101ecc:	e8 6f 90 00 00       	call   8010af40 <freevm>
+80101ed1:	83 c4 10             	add    $0x10,%esp
+80101ed4:	e9 d4 fe ff ff       	jmp    80101dad <loadimage+0x17d>
+80101ed9:	83 ec 0c             	sub    $0xc,%esp
+80101edc:	52                   	push   %edx
+80101edd:	e8 5e 90 00 00       	call   8010af40 <freevm>
+80101ee2:	83 c4 10             	add    $0x10,%esp
+80101ee5:	e9 c3 fe ff ff       	jmp    80101dad <loadimage+0x17d>
+80101eea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80101ef0:	83 ec 0c             	sub    $0xc,%esp
+80101ef3:	52                   	push   %edx
+80101ef4:	e8 47 90 00 00       	call   8010af40 <freevm>
+80101ef9:	83 c4 10             	add    $0x10,%esp
+80101efc:	e9 9b fe ff ff       	jmp    80101d9c <loadimage+0x16c>
+  ustack[3+argc] = 0;
+80101f01:	89 d7                	mov    %edx,%edi
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+80101f03:	8d 0c b5 08 00 00 00 	lea    0x8(,%esi,4),%ecx
+  ustack[3+argc] = 0;
+80101f0a:	8b 95 f4 fe ff ff    	mov    -0x10c(%ebp),%edx
+80101f10:	89 85 ec fe ff ff    	mov    %eax,-0x114(%ebp)
+80101f16:	8d 46 04             	lea    0x4(%esi),%eax
+  sp -= (3+argc+1) * 4;
+80101f19:	8d 71 0c             	lea    0xc(%ecx),%esi
+  ustack[3+argc] = 0;
+80101f1c:	c7 84 85 58 ff ff ff 	movl   $0x0,-0xa8(%ebp,%eax,4)
+80101f23:	00 00 00 00 
+  ustack[1] = argc;
+80101f27:	8b 85 ec fe ff ff    	mov    -0x114(%ebp),%eax
+  ustack[0] = 0xffffffff;  // fake return PC
+80101f2d:	c7 85 58 ff ff ff ff 	movl   $0xffffffff,-0xa8(%ebp)
+80101f34:	ff ff ff 
+  ustack[1] = argc;
+80101f37:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+80101f3d:	89 d8                	mov    %ebx,%eax
+  sp -= (3+argc+1) * 4;
+80101f3f:	29 f3                	sub    %esi,%ebx
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+80101f41:	29 c8                	sub    %ecx,%eax
+80101f43:	89 85 60 ff ff ff    	mov    %eax,-0xa0(%ebp)
+  if(copyout(pgdir, sp, ustack, (3+argc+1)*4) < 0)
+80101f49:	56                   	push   %esi
+80101f4a:	57                   	push   %edi
+80101f4b:	53                   	push   %ebx
+80101f4c:	52                   	push   %edx
+80101f4d:	89 95 f4 fe ff ff    	mov    %edx,-0x10c(%ebp)
+80101f53:	e8 08 93 00 00       	call   8010b260 <copyout>
+80101f58:	83 c4 10             	add    $0x10,%esp
+80101f5b:	8b 95 f4 fe ff ff    	mov    -0x10c(%ebp),%edx
+80101f61:	85 c0                	test   %eax,%eax
+80101f63:	0f 88 70 ff ff ff    	js     80101ed9 <loadimage+0x2a9>
+  *szp = sz;
+80101f69:	8b 45 14             	mov    0x14(%ebp),%eax
+80101f6c:	8b 8d f0 fe ff ff    	mov    -0x110(%ebp),%ecx
+80101f72:	89 08                	mov    %ecx,(%eax)
+  *eipp = elf.entry;  // main
+80101f74:	8b 45 18             	mov    0x18(%ebp),%eax
+80101f77:	8b 8d 3c ff ff ff    	mov    -0xc4(%ebp),%ecx
+80101f7d:	89 08                	mov    %ecx,(%eax)
+  *espp = sp;
+80101f7f:	8b 45 1c             	mov    0x1c(%ebp),%eax
+80101f82:	89 18                	mov    %ebx,(%eax)
+  return pgdir;
+80101f84:	e9 26 fe ff ff       	jmp    80101daf <loadimage+0x17f>
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80101f89:	be 00 20 00 00       	mov    $0x2000,%esi
+80101f8e:	31 ff                	xor    %edi,%edi
+80101f90:	e9 69 fe ff ff       	jmp    80101dfe <loadimage+0x1ce>
+  for(argc = 0; argv[argc]; argc++) {
+80101f95:	be 10 00 00 00       	mov    $0x10,%esi
+80101f9a:	b9 04 00 00 00       	mov    $0x4,%ecx
+80101f9f:	b8 03 00 00 00       	mov    $0x3,%eax
+80101fa4:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+80101fab:	00 00 00 
+80101fae:	8d bd 58 ff ff ff    	lea    -0xa8(%ebp),%edi
+80101fb4:	e9 63 ff ff ff       	jmp    80101f1c <loadimage+0x2ec>
+80101fb9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80101fc0 <progname>:
+
+// The last element of path, for naming a process.
+char*
+progname(char *path)
+{
+80101fc0:	55                   	push   %ebp
+80101fc1:	89 e5                	mov    %esp,%ebp
+80101fc3:	8b 45 08             	mov    0x8(%ebp),%eax
+  char *s, *last;
+
+  for(last=s=path; *s; s++)
+80101fc6:	0f b6 10             	movzbl (%eax),%edx
+80101fc9:	89 c1                	mov    %eax,%ecx
+80101fcb:	84 d2                	test   %dl,%dl
+80101fcd:	74 11                	je     80101fe0 <progname+0x20>
+80101fcf:	90                   	nop
+    if(*s == '/')
+      last = s+1;
+80101fd0:	83 c0 01             	add    $0x1,%eax
+80101fd3:	80 fa 2f             	cmp    $0x2f,%dl
+  for(last=s=path; *s; s++)
+80101fd6:	0f b6 10             	movzbl (%eax),%edx
+      last = s+1;
+80101fd9:	0f 44 c8             	cmove  %eax,%ecx
+  for(last=s=path; *s; s++)
+80101fdc:	84 d2                	test   %dl,%dl
+80101fde:	75 f0                	jne    80101fd0 <progname+0x10>
+  return last;
+}
+80101fe0:	89 c8                	mov    %ecx,%eax
+80101fe2:	5d                   	pop    %ebp
+80101fe3:	c3                   	ret
+80101fe4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101feb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101fef:	90                   	nop
+
+80101ff0 <exec>:
+
+int
+exec(char *path, char **argv)
+{
+80101ff0:	55                   	push   %ebp
+80101ff1:	89 e5                	mov    %esp,%ebp
+80101ff3:	57                   	push   %edi
+80101ff4:	56                   	push   %esi
+80101ff5:	53                   	push   %ebx
+80101ff6:	83 ec 1c             	sub    $0x1c,%esp
+80101ff9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint sz, eip, esp;
+  pde_t *pgdir, *oldpgdir;
+  struct proc *curproc = myproc();
+80101ffc:	e8 ef 35 00 00       	call   801055f0 <myproc>
+80102001:	89 c6                	mov    %eax,%esi
+
+  aiodrain();  // I/O threads must be done with the old image
+80102003:	e8 08 e6 ff ff       	call   80100610 <aiodrain>
+  if((pgdir = loadimage(path, argv, curproc->pid, &sz, &eip, &esp)) == 0)
+80102008:	83 ec 08             	sub    $0x8,%esp
+8010200b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+8010200e:	50                   	push   %eax
+8010200f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+80102012:	50                   	push   %eax
+80102013:	8d 45 dc             	lea    -0x24(%ebp),%eax
+80102016:	50                   	push   %eax
+80102017:	ff 76 10             	push   0x10(%esi)
+8010201a:	ff 75 0c             	push   0xc(%ebp)
+8010201d:	53                   	push   %ebx
+8010201e:	e8 0d fc ff ff       	call   80101c30 <loadimage>
+80102023:	83 c4 20             	add    $0x20,%esp
+80102026:	85 c0                	test   %eax,%eax
+80102028:	74 6b                	je     80102095 <exec+0xa5>
+8010202a:	89 c7                	mov    %eax,%edi
+  for(last=s=path; *s; s++)
+8010202c:	0f b6 03             	movzbl (%ebx),%eax
+8010202f:	89 da                	mov    %ebx,%edx
+80102031:	84 c0                	test   %al,%al
+80102033:	74 12                	je     80102047 <exec+0x57>
+80102035:	8d 76 00             	lea    0x0(%esi),%esi
+      last = s+1;
+80102038:	83 c3 01             	add    $0x1,%ebx
+8010203b:	3c 2f                	cmp    $0x2f,%al
+  for(last=s=path; *s; s++)
+8010203d:	0f b6 03             	movzbl (%ebx),%eax
+      last = s+1;
+80102040:	0f 44 d3             	cmove  %ebx,%edx
+  for(last=s=path; *s; s++)
+80102043:	84 c0                	test   %al,%al
+80102045:	75 f1                	jne    80102038 <exec+0x48>
+    return -1;
+
+  // Save program name for debugging.
+  safestrcpy(curproc->name, progname(path), sizeof(curproc->name));
+80102047:	83 ec 04             	sub    $0x4,%esp
+8010204a:	8d 46 74             	lea    0x74(%esi),%eax
+8010204d:	6a 10                	push   $0x10
+8010204f:	52                   	push   %edx
+80102050:	50                   	push   %eax
+80102051:	e8 1a 55 00 00       	call   80107570 <safestrcpy>
+
+  // Commit to the user image.
+  oldpgdir = curproc->pgdir;
+  curproc->pgdir = pgdir;
+  curproc->sz = sz;
+80102056:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  curproc->tf->eip = eip;
+80102059:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  oldpgdir = curproc->pgdir;
+8010205c:	8b 5e 04             	mov    0x4(%esi),%ebx
+  curproc->pgdir = pgdir;
+8010205f:	89 7e 04             	mov    %edi,0x4(%esi)
+  curproc->sz = sz;
+80102062:	89 06                	mov    %eax,(%esi)
+  curproc->tf->eip = eip;
+80102064:	8b 46 20             	mov    0x20(%esi),%eax
+80102067:	89 50 38             	mov    %edx,0x38(%eax)
+  curproc->tf->esp = esp;
+8010206a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010206d:	8b 46 20             	mov    0x20(%esi),%eax
+80102070:	89 50 44             	mov    %edx,0x44(%eax)
+  switchuvm(curproc);
+80102073:	89 34 24             	mov    %esi,(%esp)
+80102076:	e8 95 8a 00 00       	call   8010ab10 <switchuvm>
+  aioexit();
+8010207b:	e8 f0 e5 ff ff       	call   80100670 <aioexit>
+  freevm(oldpgdir);
+80102080:	89 1c 24             	mov    %ebx,(%esp)
+80102083:	e8 b8 8e 00 00       	call   8010af40 <freevm>
+  return 0;
+80102088:	83 c4 10             	add    $0x10,%esp
+8010208b:	31 c0                	xor    %eax,%eax
+}
+8010208d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102090:	5b                   	pop    %ebx
+80102091:	5e                   	pop    %esi
+80102092:	5f                   	pop    %edi
+80102093:	5d                   	pop    %ebp
+80102094:	c3                   	ret
+    return -1;
+80102095:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010209a:	eb f1                	jmp    8010208d <exec+0x9d>
+8010209c:	66 90                	xchg   %ax,%ax
+8010209e:	66 90                	xchg   %ax,%ax
+
+801020a0 <inodewrite>:
+}
+
+// Write n bytes at *off in f's inode, advancing *off.
+static int
+inodewrite(struct file *f, char *addr, int n, uint *off)
+{
+801020a0:	55                   	push   %ebp
+801020a1:	89 e5                	mov    %esp,%ebp
+801020a3:	57                   	push   %edi
+801020a4:	89 c7                	mov    %eax,%edi
+801020a6:	56                   	push   %esi
+801020a7:	53                   	push   %ebx
+  // i-node, indirect block, allocation blocks,
+  // and 2 blocks of slop for non-aligned writes.
+  // this really belongs lower down, since writei()
+  // might be writing a device like the console.
+  int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
+  int i = 0;
+801020a8:	31 db                	xor    %ebx,%ebx
+{
+801020aa:	83 ec 1c             	sub    $0x1c,%esp
+801020ad:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  while(i < n){
+801020b0:	85 c9                	test   %ecx,%ecx
+801020b2:	0f 8e 98 00 00 00    	jle    80102150 <inodewrite+0xb0>
+  int i = 0;
+801020b8:	89 55 dc             	mov    %edx,-0x24(%ebp)
+801020bb:	eb 2c                	jmp    801020e9 <inodewrite+0x49>
+801020bd:	8d 76 00             	lea    0x0(%esi),%esi
+      n1 = max;
+
+    begin_op();
+    ilock(f->ip);
+    if ((r = writei(f->ip, addr + i, *off, n1)) > 0)
+      *off += r;
+801020c0:	8b 55 08             	mov    0x8(%ebp),%edx
+801020c3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    iunlock(f->ip);
+801020c6:	83 ec 0c             	sub    $0xc,%esp
+      *off += r;
+801020c9:	01 02                	add    %eax,(%edx)
+    iunlock(f->ip);
+801020cb:	ff 77 10             	push   0x10(%edi)
+801020ce:	e8 6d 0c 00 00       	call   80102d40 <iunlock>
+    end_op();
+801020d3:	e8 58 23 00 00       	call   80104430 <end_op>
+
+    if(r < 0)
+      break;
+    if(r != n1)
+801020d8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801020db:	83 c4 10             	add    $0x10,%esp
+801020de:	39 c6                	cmp    %eax,%esi
+801020e0:	75 5e                	jne    80102140 <inodewrite+0xa0>
+      panic("short filewrite");
+    i += r;
+801020e2:	01 f3                	add    %esi,%ebx
+  while(i < n){
+801020e4:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+801020e7:	7e 67                	jle    80102150 <inodewrite+0xb0>
+    int n1 = n - i;
+801020e9:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    if(n1 > max)
+801020ec:	b8 00 06 00 00       	mov    $0x600,%eax
+    int n1 = n - i;
+801020f1:	29 de                	sub    %ebx,%esi
+    if(n1 > max)
+801020f3:	39 c6                	cmp    %eax,%esi
+801020f5:	0f 4f f0             	cmovg  %eax,%esi
+    begin_op();
+801020f8:	e8 c3 22 00 00       	call   801043c0 <begin_op>
+    ilock(f->ip);
+801020fd:	83 ec 0c             	sub    $0xc,%esp
+80102100:	ff 77 10             	push   0x10(%edi)
+80102103:	e8 e8 0a 00 00       	call   80102bf0 <ilock>
+    if ((r = writei(f->ip, addr + i, *off, n1)) > 0)
+80102108:	56                   	push   %esi
+80102109:	8b 45 08             	mov    0x8(%ebp),%eax
+8010210c:	ff 30                	push   (%eax)
+8010210e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80102111:	01 d8                	add    %ebx,%eax
+80102113:	50                   	push   %eax
+80102114:	ff 77 10             	push   0x10(%edi)
+80102117:	e8 04 10 00 00       	call   80103120 <writei>
+8010211c:	83 c4 20             	add    $0x20,%esp
+8010211f:	85 c0                	test   %eax,%eax
+80102121:	7f 9d                	jg     801020c0 <inodewrite+0x20>
+    iunlock(f->ip);
+80102123:	83 ec 0c             	sub    $0xc,%esp
+80102126:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80102129:	ff 77 10             	push   0x10(%edi)
+8010212c:	e8 0f 0c 00 00       	call   80102d40 <iunlock>
+    end_op();
+80102131:	e8 fa 22 00 00       	call   80104430 <end_op>
+    if(r < 0)
+80102136:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80102139:	83 c4 10             	add    $0x10,%esp
+8010213c:	85 c9                	test   %ecx,%ecx
+8010213e:	75 10                	jne    80102150 <inodewrite+0xb0>
+      panic("short filewrite");
+80102140:	83 ec 0c             	sub    $0xc,%esp
+80102143:	68 dd b6 10 80       	push   $0x8010b6dd
+80102148:	e8 73 f3 ff ff       	call   801014c0 <panic>
+8010214d:	8d 76 00             	lea    0x0(%esi),%esi
+  }
+  return i == n ? n : -1;
+80102150:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+80102153:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80102158:	0f 45 d8             	cmovne %eax,%ebx
+}
+8010215b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010215e:	89 d8                	mov    %ebx,%eax
+80102160:	5b                   	pop    %ebx
+80102161:	5e                   	pop    %esi
+80102162:	5f                   	pop    %edi
+80102163:	5d                   	pop    %ebp
+80102164:	c3                   	ret
+80102165:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010216c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80102170 <fileinit>:
+{
+80102170:	55                   	push   %ebp
+80102171:	89 e5                	mov    %esp,%ebp
+80102173:	83 ec 10             	sub    $0x10,%esp
+  initlock(&ftable.lock, "ftable");
+80102176:	68 ed b6 10 80       	push   $0x8010b6ed
+8010217b:	68 20 04 1a 80       	push   $0x801a0420
+80102180:	e8 db 47 00 00       	call   80106960 <initlock>
+}
+80102185:	83 c4 10             	add    $0x10,%esp
+80102188:	c9                   	leave
+80102189:	c3                   	ret
+8010218a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80102190 <filealloc>:
+{
+80102190:	55                   	push   %ebp
+80102191:	89 e5                	mov    %esp,%ebp
+80102193:	53                   	push   %ebx
+  for(f = ftable.file; f < ftable.file + NFILE; f++){
+80102194:	bb 80 04 1a 80       	mov    $0x801a0480,%ebx
+{
+80102199:	83 ec 10             	sub    $0x10,%esp
+  acquire(&ftable.lock);
+8010219c:	68 20 04 1a 80       	push   $0x801a0420
+801021a1:	e8 ca 4e 00 00       	call   80107070 <acquire>
+801021a6:	83 c4 10             	add    $0x10,%esp
+801021a9:	eb 10                	jmp    801021bb <filealloc+0x2b>
+801021ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801021af:	90                   	nop
+  for(f = ftable.file; f < ftable.file + NFILE; f++){
+801021b0:	83 c3 20             	add    $0x20,%ebx
+801021b3:	81 fb 00 11 1a 80    	cmp    $0x801a1100,%ebx
+801021b9:	74 25                	je     801021e0 <filealloc+0x50>
+    if(f->ref == 0){
+801021bb:	8b 43 04             	mov    0x4(%ebx),%eax
+801021be:	85 c0                	test   %eax,%eax
+801021c0:	75 ee                	jne    801021b0 <filealloc+0x20>
+      release(&ftable.lock);
+801021c2:	83 ec 0c             	sub    $0xc,%esp
+      f->ref = 1;
+801021c5:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+      release(&ftable.lock);
+801021cc:	68 20 04 1a 80       	push   $0x801a0420
+801021d1:	e8 2a 4d 00 00       	call   80106f00 <release>
+}
+801021d6:	89 d8                	mov    %ebx,%eax
+      return f;
+801021d8:	83 c4 10             	add    $0x10,%esp
+}
+801021db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801021de:	c9                   	leave
+801021df:	c3                   	ret
+  release(&ftable.lock);
+801021e0:	83 ec 0c             	sub    $0xc,%esp
+  return 0;
+801021e3:	31 db                	xor    %ebx,%ebx
+  release(&ftable.lock);
+801021e5:	68 20 04 1a 80       	push   $0x801a0420
+801021ea:	e8 11 4d 00 00       	call   80106f00 <release>
+}
+801021ef:	89 d8                	mov    %ebx,%eax
+  return 0;
+801021f1:	83 c4 10             	add    $0x10,%esp
+}
+801021f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801021f7:	c9                   	leave
+801021f8:	c3                   	ret
+801021f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80102200 <filedup>:
+{
+80102200:	55                   	push   %ebp
+80102201:	89 e5                	mov    %esp,%ebp
+80102203:	53                   	push   %ebx
+80102204:	83 ec 10             	sub    $0x10,%esp
+80102207:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&ftable.lock);
+8010220a:	68 20 04 1a 80       	push   $0x801a0420
+8010220f:	e8 5c 4e 00 00       	call   80107070 <acquire>
+  if(f->ref < 1)
+80102214:	8b 43 04             	mov    0x4(%ebx),%eax
+80102217:	83 c4 10             	add    $0x10,%esp
+8010221a:	85 c0                	test   %eax,%eax
+8010221c:	7e 1a                	jle    80102238 <filedup+0x38>
+  f->ref++;
+8010221e:	83 c0 01             	add    $0x1,%eax
+  release(&ftable.lock);
+80102221:	83 ec 0c             	sub    $0xc,%esp
+  f->ref++;
+80102224:	89 43 04             	mov    %eax,0x4(%ebx)
+  release(&ftable.lock);
+80102227:	68 20 04 1a 80       	push   $0x801a0420
+8010222c:	e8 cf 4c 00 00       	call   80106f00 <release>
+}
+80102231:	89 d8                	mov    %ebx,%eax
+80102233:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102236:	c9                   	leave
+80102237:	c3                   	ret
+    panic("filedup");
+80102238:	83 ec 0c             	sub    $0xc,%esp
+8010223b:	68 f4 b6 10 80       	push   $0x8010b6f4
+80102240:	e8 7b f2 ff ff       	call   801014c0 <panic>
+80102245:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010224c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80102250 <fileclose>:
+{
+80102250:	55                   	push   %ebp
+80102251:	89 e5                	mov    %esp,%ebp
+80102253:	57                   	push   %edi
+80102254:	56                   	push   %esi
+80102255:	53                   	push   %ebx
+80102256:	83 ec 28             	sub    $0x28,%esp
+80102259:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&ftable.lock);
+8010225c:	68 20 04 1a 80       	push   $0x801a0420
+80102261:	e8 0a 4e 00 00       	call   80107070 <acquire>
+  if(f->ref < 1)
+80102266:	8b 53 04             	mov    0x4(%ebx),%edx
+80102269:	83 c4 10             	add    $0x10,%esp
+8010226c:	85 d2                	test   %edx,%edx
+8010226e:	0f 8e a5 00 00 00    	jle    80102319 <fileclose+0xc9>
+  if(--f->ref > 0){
+80102274:	83 ea 01             	sub    $0x1,%edx
+80102277:	89 53 04             	mov    %edx,0x4(%ebx)
+8010227a:	75 44                	jne    801022c0 <fileclose+0x70>
+  ff = *f;
+8010227c:	0f b6 43 09          	movzbl 0x9(%ebx),%eax
+  release(&ftable.lock);
+80102280:	83 ec 0c             	sub    $0xc,%esp
+  ff = *f;
+80102283:	8b 3b                	mov    (%ebx),%edi
+  f->type = FD_NONE;
+80102285:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  ff = *f;
+8010228b:	8b 73 0c             	mov    0xc(%ebx),%esi
+8010228e:	88 45 e7             	mov    %al,-0x19(%ebp)
+80102291:	8b 43 10             	mov    0x10(%ebx),%eax
+80102294:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  release(&ftable.lock);
+80102297:	68 20 04 1a 80       	push   $0x801a0420
+8010229c:	e8 5f 4c 00 00       	call   80106f00 <release>
+  if(ff.type == FD_PIPE)
+801022a1:	83 c4 10             	add    $0x10,%esp
+801022a4:	83 ff 01             	cmp    $0x1,%edi
+801022a7:	74 57                	je     80102300 <fileclose+0xb0>
+  else if(ff.type == FD_INODE){
+801022a9:	83 ff 02             	cmp    $0x2,%edi
+801022ac:	74 2a                	je     801022d8 <fileclose+0x88>
+}
+801022ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801022b1:	5b                   	pop    %ebx
+801022b2:	5e                   	pop    %esi
+801022b3:	5f                   	pop    %edi
+801022b4:	5d                   	pop    %ebp
+801022b5:	c3                   	ret
+801022b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801022bd:	8d 76 00             	lea    0x0(%esi),%esi
+    release(&ftable.lock);
+801022c0:	c7 45 08 20 04 1a 80 	movl   $0x801a0420,0x8(%ebp)
+}
+801022c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801022ca:	5b                   	pop    %ebx
+801022cb:	5e                   	pop    %esi
+801022cc:	5f                   	pop    %edi
+801022cd:	5d                   	pop    %ebp
+    release(&ftable.lock);
+801022ce:	e9 2d 4c 00 00       	jmp    80106f00 <release>
+801022d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801022d7:	90                   	nop
+    begin_op();
+801022d8:	e8 e3 20 00 00       	call   801043c0 <begin_op>
+    iput(ff.ip);
+801022dd:	83 ec 0c             	sub    $0xc,%esp
+801022e0:	ff 75 e0             	push   -0x20(%ebp)
+801022e3:	e8 a8 0a 00 00       	call   80102d90 <iput>
+    end_op();
+801022e8:	83 c4 10             	add    $0x10,%esp
+}
+801022eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801022ee:	5b                   	pop    %ebx
+801022ef:	5e                   	pop    %esi
+801022f0:	5f                   	pop    %edi
+801022f1:	5d                   	pop    %ebp
+    end_op();
+801022f2:	e9 39 21 00 00       	jmp    80104430 <end_op>
+801022f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801022fe:	66 90                	xchg   %ax,%ax
+    pipeclose(ff.pipe, ff.writable);
+80102300:	0f be 5d e7          	movsbl -0x19(%ebp),%ebx
+80102304:	83 ec 08             	sub    $0x8,%esp
+80102307:	53                   	push   %ebx
+80102308:	56                   	push   %esi
+80102309:	e8 42 2c 00 00       	call   80104f50 <pipeclose>
+8010230e:	83 c4 10             	add    $0x10,%esp
+}
+80102311:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102314:	5b                   	pop    %ebx
+80102315:	5e                   	pop    %esi
+80102316:	5f                   	pop    %edi
+80102317:	5d                   	pop    %ebp
+80102318:	c3                   	ret
+    panic("fileclose");
+80102319:	83 ec 0c             	sub    $0xc,%esp
+8010231c:	68 fc b6 10 80       	push   $0x8010b6fc
+80102321:	e8 9a f1 ff ff       	call   801014c0 <panic>
+80102326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010232d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80102330 <filestat>:
+{
+80102330:	55                   	push   %ebp
+80102331:	89 e5                	mov    %esp,%ebp
+80102333:	53                   	push   %ebx
+80102334:	83 ec 04             	sub    $0x4,%esp
+80102337:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->type == FD_INODE){
+8010233a:	83 3b 02             	cmpl   $0x2,(%ebx)
+8010233d:	75 31                	jne    80102370 <filestat+0x40>
+    ilock(f->ip);
+8010233f:	83 ec 0c             	sub    $0xc,%esp
+80102342:	ff 73 10             	push   0x10(%ebx)
+80102345:	e8 a6 08 00 00       	call   80102bf0 <ilock>
+    stati(f->ip, st);
+8010234a:	58                   	pop    %eax
+8010234b:	5a                   	pop    %edx
+8010234c:	ff 75 0c             	push   0xc(%ebp)
+8010234f:	ff 73 10             	push   0x10(%ebx)
+80102352:	e8 09 0c 00 00       	call   80102f60 <stati>
+    iunlock(f->ip);
+80102357:	59                   	pop    %ecx
+80102358:	ff 73 10             	push   0x10(%ebx)
+8010235b:	e8 e0 09 00 00       	call   80102d40 <iunlock>
+}
+80102360:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+80102363:	83 c4 10             	add    $0x10,%esp
+80102366:	31 c0                	xor    %eax,%eax
+}
+80102368:	c9                   	leave
+80102369:	c3                   	ret
+8010236a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80102370:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return -1;
+80102373:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80102378:	c9                   	leave
+80102379:	c3                   	ret
+8010237a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80102380 <fileread>:
+{
+80102380:	55                   	push   %ebp
+80102381:	89 e5                	mov    %esp,%ebp
+80102383:	57                   	push   %edi
+80102384:	56                   	push   %esi
+80102385:	53                   	push   %ebx
+80102386:	83 ec 1c             	sub    $0x1c,%esp
+80102389:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010238c:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010238f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(f->readable == 0)
+80102392:	80 7b 08 00          	cmpb   $0x0,0x8(%ebx)
+{
+80102396:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(f->readable == 0)
+80102399:	0f 84 e9 00 00 00    	je     80102488 <fileread+0x108>
+  if(f->type == FD_PIPE)
+8010239f:	8b 33                	mov    (%ebx),%esi
+801023a1:	83 fe 01             	cmp    $0x1,%esi
+801023a4:	0f 84 c6 00 00 00    	je     80102470 <fileread+0xf0>
+  if(f->type == FD_INODE){
+801023aa:	83 fe 02             	cmp    $0x2,%esi
+801023ad:	0f 85 df 00 00 00    	jne    80102492 <fileread+0x112>
+    if(f->ref == 1)
+801023b3:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+      ilockshared(f->ip);
+801023b7:	8b 43 10             	mov    0x10(%ebx),%eax
+    if(f->ref == 1)
+801023ba:	74 64                	je     80102420 <fileread+0xa0>
+      ilock(f->ip);
+801023bc:	83 ec 0c             	sub    $0xc,%esp
+801023bf:	50                   	push   %eax
+801023c0:	e8 2b 08 00 00       	call   80102bf0 <ilock>
+801023c5:	83 c4 10             	add    $0x10,%esp
+    if(f->off == f->raend && n > 0){
+801023c8:	8b 43 14             	mov    0x14(%ebx),%eax
+801023cb:	39 43 18             	cmp    %eax,0x18(%ebx)
+801023ce:	75 04                	jne    801023d4 <fileread+0x54>
+801023d0:	85 ff                	test   %edi,%edi
+801023d2:	7f 5c                	jg     80102430 <fileread+0xb0>
+      f->ra = 0;
+801023d4:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+    if((r = readi(f->ip, addr, f->off, n)) > 0)
+801023db:	57                   	push   %edi
+801023dc:	50                   	push   %eax
+801023dd:	ff 75 e4             	push   -0x1c(%ebp)
+801023e0:	ff 73 10             	push   0x10(%ebx)
+801023e3:	e8 28 0c 00 00       	call   80103010 <readi>
+801023e8:	83 c4 10             	add    $0x10,%esp
+801023eb:	89 c6                	mov    %eax,%esi
+801023ed:	85 c0                	test   %eax,%eax
+801023ef:	7e 27                	jle    80102418 <fileread+0x98>
+      f->off += r;
+801023f1:	8b 43 14             	mov    0x14(%ebx),%eax
+801023f4:	01 f0                	add    %esi,%eax
+801023f6:	89 43 14             	mov    %eax,0x14(%ebx)
+    iunlock(f->ip);
+801023f9:	83 ec 0c             	sub    $0xc,%esp
+    f->raend = f->off;
+801023fc:	89 43 18             	mov    %eax,0x18(%ebx)
+    iunlock(f->ip);
+801023ff:	ff 73 10             	push   0x10(%ebx)
+80102402:	e8 39 09 00 00       	call   80102d40 <iunlock>
+    return r;
+80102407:	83 c4 10             	add    $0x10,%esp
+}
+8010240a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010240d:	89 f0                	mov    %esi,%eax
+8010240f:	5b                   	pop    %ebx
+80102410:	5e                   	pop    %esi
+80102411:	5f                   	pop    %edi
+80102412:	5d                   	pop    %ebp
+80102413:	c3                   	ret
+80102414:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      f->off += r;
+80102418:	8b 43 14             	mov    0x14(%ebx),%eax
+8010241b:	eb dc                	jmp    801023f9 <fileread+0x79>
+8010241d:	8d 76 00             	lea    0x0(%esi),%esi
+      ilockshared(f->ip);
+80102420:	83 ec 0c             	sub    $0xc,%esp
+80102423:	50                   	push   %eax
+80102424:	e8 b7 08 00 00       	call   80102ce0 <ilockshared>
+80102429:	83 c4 10             	add    $0x10,%esp
+8010242c:	eb 9a                	jmp    801023c8 <fileread+0x48>
+8010242e:	66 90                	xchg   %ax,%ax
+      f->ra = f->ra ? f->ra*2 : 2;
+80102430:	8b 53 1c             	mov    0x1c(%ebx),%edx
+80102433:	b9 00 04 00 00       	mov    $0x400,%ecx
+80102438:	85 d2                	test   %edx,%edx
+8010243a:	74 17                	je     80102453 <fileread+0xd3>
+8010243c:	8d 34 12             	lea    (%edx,%edx,1),%esi
+      ireadahead(f->ip, f->off, n + f->ra*BSIZE);
+8010243f:	c1 e2 0a             	shl    $0xa,%edx
+80102442:	89 d1                	mov    %edx,%ecx
+      if(f->ra > RAMAX)
+80102444:	83 fe 08             	cmp    $0x8,%esi
+80102447:	76 0a                	jbe    80102453 <fileread+0xd3>
+80102449:	be 08 00 00 00       	mov    $0x8,%esi
+8010244e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+      ireadahead(f->ip, f->off, n + f->ra*BSIZE);
+80102453:	83 ec 04             	sub    $0x4,%esp
+80102456:	01 f9                	add    %edi,%ecx
+      f->ra = f->ra ? f->ra*2 : 2;
+80102458:	89 73 1c             	mov    %esi,0x1c(%ebx)
+      ireadahead(f->ip, f->off, n + f->ra*BSIZE);
+8010245b:	51                   	push   %ecx
+8010245c:	50                   	push   %eax
+8010245d:	ff 73 10             	push   0x10(%ebx)
+80102460:	e8 3b 0b 00 00       	call   80102fa0 <ireadahead>
+    if((r = readi(f->ip, addr, f->off, n)) > 0)
+80102465:	8b 43 14             	mov    0x14(%ebx),%eax
+      ireadahead(f->ip, f->off, n + f->ra*BSIZE);
+80102468:	83 c4 10             	add    $0x10,%esp
+8010246b:	e9 6b ff ff ff       	jmp    801023db <fileread+0x5b>
+    return piperead(f->pipe, addr, n);
+80102470:	8b 43 0c             	mov    0xc(%ebx),%eax
+80102473:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+80102476:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102479:	5b                   	pop    %ebx
+8010247a:	5e                   	pop    %esi
+8010247b:	5f                   	pop    %edi
+8010247c:	5d                   	pop    %ebp
+    return piperead(f->pipe, addr, n);
+8010247d:	e9 9e 2c 00 00       	jmp    80105120 <piperead>
+80102482:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+80102488:	be ff ff ff ff       	mov    $0xffffffff,%esi
+8010248d:	e9 78 ff ff ff       	jmp    8010240a <fileread+0x8a>
+  panic("fileread");
+80102492:	83 ec 0c             	sub    $0xc,%esp
+80102495:	68 06 b7 10 80       	push   $0x8010b706
+8010249a:	e8 21 f0 ff ff       	call   801014c0 <panic>
+8010249f:	90                   	nop
+
+801024a0 <filepread>:
+{
+801024a0:	55                   	push   %ebp
+801024a1:	89 e5                	mov    %esp,%ebp
+801024a3:	57                   	push   %edi
+801024a4:	56                   	push   %esi
+801024a5:	53                   	push   %ebx
+801024a6:	83 ec 1c             	sub    $0x1c,%esp
+801024a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801024ac:	8b 75 0c             	mov    0xc(%ebp),%esi
+801024af:	8b 55 10             	mov    0x10(%ebp),%edx
+801024b2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  if(f->readable == 0)
+801024b5:	80 7b 08 00          	cmpb   $0x0,0x8(%ebx)
+801024b9:	74 5d                	je     80102518 <filepread+0x78>
+  if(f->type == FD_PIPE)
+801024bb:	8b 03                	mov    (%ebx),%eax
+801024bd:	83 f8 01             	cmp    $0x1,%eax
+801024c0:	74 3e                	je     80102500 <filepread+0x60>
+801024c2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  if(f->type == FD_INODE){
+801024c5:	83 f8 02             	cmp    $0x2,%eax
+801024c8:	75 55                	jne    8010251f <filepread+0x7f>
+    ilockshared(f->ip);
+801024ca:	83 ec 0c             	sub    $0xc,%esp
+801024cd:	ff 73 10             	push   0x10(%ebx)
+801024d0:	e8 0b 08 00 00       	call   80102ce0 <ilockshared>
+    r = readi(f->ip, addr, off, n);
+801024d5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801024d8:	52                   	push   %edx
+801024d9:	57                   	push   %edi
+801024da:	56                   	push   %esi
+801024db:	ff 73 10             	push   0x10(%ebx)
+801024de:	e8 2d 0b 00 00       	call   80103010 <readi>
+    iunlock(f->ip);
+801024e3:	83 c4 14             	add    $0x14,%esp
+801024e6:	ff 73 10             	push   0x10(%ebx)
+    r = readi(f->ip, addr, off, n);
+801024e9:	89 c6                	mov    %eax,%esi
+    iunlock(f->ip);
+801024eb:	e8 50 08 00 00       	call   80102d40 <iunlock>
+    return r;
+801024f0:	83 c4 10             	add    $0x10,%esp
+}
+801024f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801024f6:	89 f0                	mov    %esi,%eax
+801024f8:	5b                   	pop    %ebx
+801024f9:	5e                   	pop    %esi
+801024fa:	5f                   	pop    %edi
+801024fb:	5d                   	pop    %ebp
+801024fc:	c3                   	ret
+801024fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return piperead(f->pipe, addr, n);
+80102500:	8b 43 0c             	mov    0xc(%ebx),%eax
+80102503:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+80102506:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102509:	5b                   	pop    %ebx
+8010250a:	5e                   	pop    %esi
+8010250b:	5f                   	pop    %edi
+8010250c:	5d                   	pop    %ebp
+    return piperead(f->pipe, addr, n);
+8010250d:	e9 0e 2c 00 00       	jmp    80105120 <piperead>
+80102512:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+80102518:	be ff ff ff ff       	mov    $0xffffffff,%esi
+8010251d:	eb d4                	jmp    801024f3 <filepread+0x53>
+  panic("filepread");
+8010251f:	83 ec 0c             	sub    $0xc,%esp
+80102522:	68 0f b7 10 80       	push   $0x8010b70f
+80102527:	e8 94 ef ff ff       	call   801014c0 <panic>
+8010252c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80102530 <filewrite>:
+
+//PAGEBREAK!
+// Write to file f.
+int
+filewrite(struct file *f, char *addr, int n)
+{
+80102530:	55                   	push   %ebp
+80102531:	89 e5                	mov    %esp,%ebp
+80102533:	53                   	push   %ebx
+80102534:	83 ec 04             	sub    $0x4,%esp
+80102537:	8b 45 08             	mov    0x8(%ebp),%eax
+8010253a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+8010253d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  if(f->writable == 0)
+80102540:	80 78 09 00          	cmpb   $0x0,0x9(%eax)
+80102544:	74 3a                	je     80102580 <filewrite+0x50>
+    return -1;
+  if(f->type == FD_PIPE)
+80102546:	8b 10                	mov    (%eax),%edx
+80102548:	83 fa 01             	cmp    $0x1,%edx
+8010254b:	74 1b                	je     80102568 <filewrite+0x38>
+    return pipewrite(f->pipe, addr, n);
+  if(f->type == FD_INODE)
+8010254d:	83 fa 02             	cmp    $0x2,%edx
+80102550:	75 38                	jne    8010258a <filewrite+0x5a>
+    return inodewrite(f, addr, n, &f->off);
+80102552:	8d 50 14             	lea    0x14(%eax),%edx
+80102555:	89 55 08             	mov    %edx,0x8(%ebp)
+80102558:	89 da                	mov    %ebx,%edx
+  panic("filewrite");
+}
+8010255a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010255d:	c9                   	leave
+    return inodewrite(f, addr, n, &f->off);
+8010255e:	e9 3d fb ff ff       	jmp    801020a0 <inodewrite>
+80102563:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102567:	90                   	nop
+    return pipewrite(f->pipe, addr, n);
+80102568:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+8010256b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return pipewrite(f->pipe, addr, n);
+8010256e:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+80102571:	c9                   	leave
+    return pipewrite(f->pipe, addr, n);
+80102572:	e9 89 2a 00 00       	jmp    80105000 <pipewrite>
+80102577:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010257e:	66 90                	xchg   %ax,%ax
+}
+80102580:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102583:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80102588:	c9                   	leave
+80102589:	c3                   	ret
+  panic("filewrite");
+8010258a:	83 ec 0c             	sub    $0xc,%esp
+8010258d:	68 e3 b6 10 80       	push   $0x8010b6e3
+80102592:	e8 29 ef ff ff       	call   801014c0 <panic>
+80102597:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010259e:	66 90                	xchg   %ax,%ax
+
+801025a0 <filepwrite>:
+
+// Write to file f at offset off, leaving f->off alone.
+// A pipe has no offset; it writes as filewrite() would.
+int
+filepwrite(struct file *f, char *addr, int n, uint off)
+{
+801025a0:	55                   	push   %ebp
+801025a1:	89 e5                	mov    %esp,%ebp
+801025a3:	53                   	push   %ebx
+801025a4:	83 ec 04             	sub    $0x4,%esp
+801025a7:	8b 45 08             	mov    0x8(%ebp),%eax
+801025aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+801025ad:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  if(f->writable == 0)
+801025b0:	80 78 09 00          	cmpb   $0x0,0x9(%eax)
+801025b4:	74 42                	je     801025f8 <filepwrite+0x58>
+    return -1;
+  if(f->type == FD_PIPE)
+801025b6:	8b 18                	mov    (%eax),%ebx
+801025b8:	83 fb 01             	cmp    $0x1,%ebx
+801025bb:	74 23                	je     801025e0 <filepwrite+0x40>
+    return pipewrite(f->pipe, addr, n);
+  if(f->type == FD_INODE)
+801025bd:	83 fb 02             	cmp    $0x2,%ebx
+801025c0:	75 3d                	jne    801025ff <filepwrite+0x5f>
+    return inodewrite(f, addr, n, &off);
+801025c2:	83 ec 0c             	sub    $0xc,%esp
+801025c5:	8d 5d 14             	lea    0x14(%ebp),%ebx
+801025c8:	53                   	push   %ebx
+801025c9:	e8 d2 fa ff ff       	call   801020a0 <inodewrite>
+801025ce:	83 c4 10             	add    $0x10,%esp
+  panic("filepwrite");
+}
+801025d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801025d4:	c9                   	leave
+801025d5:	c3                   	ret
+801025d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801025dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return pipewrite(f->pipe, addr, n);
+801025e0:	83 ec 04             	sub    $0x4,%esp
+801025e3:	51                   	push   %ecx
+801025e4:	52                   	push   %edx
+801025e5:	ff 70 0c             	push   0xc(%eax)
+801025e8:	e8 13 2a 00 00       	call   80105000 <pipewrite>
+}
+801025ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return pipewrite(f->pipe, addr, n);
+801025f0:	83 c4 10             	add    $0x10,%esp
+}
+801025f3:	c9                   	leave
+801025f4:	c3                   	ret
+801025f5:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+801025f8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801025fd:	eb d2                	jmp    801025d1 <filepwrite+0x31>
+  panic("filepwrite");
+801025ff:	83 ec 0c             	sub    $0xc,%esp
+80102602:	68 19 b7 10 80       	push   $0x8010b719
+80102607:	e8 b4 ee ff ff       	call   801014c0 <panic>
+8010260c:	66 90                	xchg   %ax,%ax
+8010260e:	66 90                	xchg   %ax,%ax
+
+80102610 <balloc>:
+// Blocks.
+
+// Allocate a zeroed disk block.
+static uint
+balloc(uint dev)
+{
+80102610:	55                   	push   %ebp
+80102611:	89 e5                	mov    %esp,%ebp
+80102613:	57                   	push   %edi
+80102614:	56                   	push   %esi
+80102615:	53                   	push   %ebx
+80102616:	83 ec 1c             	sub    $0x1c,%esp
+  int b, bi, m;
+  struct buf *bp;
+
+  bp = 0;
+  for(b = 0; b < sb.size; b += BPB){
+80102619:	8b 0d 98 39 1a 80    	mov    0x801a3998,%ecx
+{
+8010261f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  for(b = 0; b < sb.size; b += BPB){
+80102622:	85 c9                	test   %ecx,%ecx
+80102624:	0f 84 8f 00 00 00    	je     801026b9 <balloc+0xa9>
+8010262a:	31 ff                	xor    %edi,%edi
+    bp = bread(dev, BBLOCK(b, sb));
+8010262c:	89 f8                	mov    %edi,%eax
+8010262e:	83 ec 08             	sub    $0x8,%esp
+80102631:	89 fe                	mov    %edi,%esi
+80102633:	c1 f8 0c             	sar    $0xc,%eax
+80102636:	03 05 b0 39 1a 80    	add    0x801a39b0,%eax
+8010263c:	50                   	push   %eax
+8010263d:	ff 75 dc             	push   -0x24(%ebp)
+80102640:	e8 eb e7 ff ff       	call   80100e30 <bread>
+80102645:	89 7d d8             	mov    %edi,-0x28(%ebp)
+80102648:	83 c4 10             	add    $0x10,%esp
+8010264b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
+8010264e:	a1 98 39 1a 80       	mov    0x801a3998,%eax
+80102653:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80102656:	31 c0                	xor    %eax,%eax
+80102658:	eb 35                	jmp    8010268f <balloc+0x7f>
+8010265a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      m = 1 << (bi % 8);
+80102660:	89 c1                	mov    %eax,%ecx
+80102662:	bb 01 00 00 00       	mov    $0x1,%ebx
+      if((bp->data[bi/8] & m) == 0){  // Is block free?
+80102667:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      m = 1 << (bi % 8);
+8010266a:	83 e1 07             	and    $0x7,%ecx
+8010266d:	d3 e3                	shl    %cl,%ebx
+      if((bp->data[bi/8] & m) == 0){  // Is block free?
+8010266f:	89 c1                	mov    %eax,%ecx
+80102671:	c1 f9 03             	sar    $0x3,%ecx
+80102674:	0f b6 bc 0f a8 00 00 	movzbl 0xa8(%edi,%ecx,1),%edi
+8010267b:	00 
+8010267c:	89 fa                	mov    %edi,%edx
+8010267e:	85 df                	test   %ebx,%edi
+80102680:	74 4e                	je     801026d0 <balloc+0xc0>
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
+80102682:	83 c0 01             	add    $0x1,%eax
+80102685:	83 c6 01             	add    $0x1,%esi
+80102688:	3d 00 10 00 00       	cmp    $0x1000,%eax
+8010268d:	74 07                	je     80102696 <balloc+0x86>
+8010268f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+80102692:	39 d6                	cmp    %edx,%esi
+80102694:	72 ca                	jb     80102660 <balloc+0x50>
+        brelse(bp);
+        bzero(dev, b + bi);
+        return b + bi;
+      }
+    }
+    brelse(bp);
+80102696:	8b 7d d8             	mov    -0x28(%ebp),%edi
+80102699:	83 ec 0c             	sub    $0xc,%esp
+8010269c:	ff 75 e4             	push   -0x1c(%ebp)
+  for(b = 0; b < sb.size; b += BPB){
+8010269f:	81 c7 00 10 00 00    	add    $0x1000,%edi
+    brelse(bp);
+801026a5:	e8 96 e9 ff ff       	call   80101040 <brelse>
+  for(b = 0; b < sb.size; b += BPB){
+801026aa:	83 c4 10             	add    $0x10,%esp
+801026ad:	3b 3d 98 39 1a 80    	cmp    0x801a3998,%edi
+801026b3:	0f 82 73 ff ff ff    	jb     8010262c <balloc+0x1c>
+  }
+  panic("balloc: out of blocks");
+801026b9:	83 ec 0c             	sub    $0xc,%esp
+801026bc:	68 24 b7 10 80       	push   $0x8010b724
+801026c1:	e8 fa ed ff ff       	call   801014c0 <panic>
+801026c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801026cd:	8d 76 00             	lea    0x0(%esi),%esi
+        bp->data[bi/8] |= m;  // Mark block in use.
+801026d0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+        log_write(bp);
+801026d3:	83 ec 0c             	sub    $0xc,%esp
+        bp->data[bi/8] |= m;  // Mark block in use.
+801026d6:	09 da                	or     %ebx,%edx
+801026d8:	88 94 0f a8 00 00 00 	mov    %dl,0xa8(%edi,%ecx,1)
+        log_write(bp);
+801026df:	57                   	push   %edi
+801026e0:	e8 1b 1f 00 00       	call   80104600 <log_write>
+        brelse(bp);
+801026e5:	89 3c 24             	mov    %edi,(%esp)
+801026e8:	e8 53 e9 ff ff       	call   80101040 <brelse>
+  bp = bread(dev, bno);
+801026ed:	58                   	pop    %eax
+801026ee:	5a                   	pop    %edx
+801026ef:	56                   	push   %esi
+801026f0:	ff 75 dc             	push   -0x24(%ebp)
+801026f3:	e8 38 e7 ff ff       	call   80100e30 <bread>
+  memset(bp->data, 0, BSIZE);
+801026f8:	83 c4 0c             	add    $0xc,%esp
+  bp = bread(dev, bno);
+801026fb:	89 c3                	mov    %eax,%ebx
+  memset(bp->data, 0, BSIZE);
+801026fd:	8d 80 a8 00 00 00    	lea    0xa8(%eax),%eax
+80102703:	68 00 02 00 00       	push   $0x200
+80102708:	6a 00                	push   $0x0
+8010270a:	50                   	push   %eax
+8010270b:	e8 b0 4c 00 00       	call   801073c0 <memset>
+  log_write(bp);
+80102710:	89 1c 24             	mov    %ebx,(%esp)
+80102713:	e8 e8 1e 00 00       	call   80104600 <log_write>
+  brelse(bp);
+80102718:	89 1c 24             	mov    %ebx,(%esp)
+8010271b:	e8 20 e9 ff ff       	call   80101040 <brelse>
+}
+80102720:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102723:	89 f0                	mov    %esi,%eax
+80102725:	5b                   	pop    %ebx
+80102726:	5e                   	pop    %esi
+80102727:	5f                   	pop    %edi
+80102728:	5d                   	pop    %ebp
+80102729:	c3                   	ret
+8010272a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80102730 <iget>:
+// Find the inode with number inum on device dev
+// and return the in-memory copy. Does not lock
+// the inode and does not read it from disk.
+static struct inode*
+iget(uint dev, uint inum)
+{
+80102730:	55                   	push   %ebp
+80102731:	89 e5                	mov    %esp,%ebp
+80102733:	57                   	push   %edi
+  struct inode *ip, *empty;
+
+  acquire(&icache.lock);
+
+  // Is the inode already cached?
+  empty = 0;
+80102734:	31 ff                	xor    %edi,%edi
+{
+80102736:	56                   	push   %esi
+80102737:	89 c6                	mov    %eax,%esi
+80102739:	53                   	push   %ebx
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+8010273a:	bb c0 11 1a 80       	mov    $0x801a11c0,%ebx
+{
+8010273f:	83 ec 28             	sub    $0x28,%esp
+80102742:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  acquire(&icache.lock);
+80102745:	68 60 11 1a 80       	push   $0x801a1160
+8010274a:	e8 21 49 00 00       	call   80107070 <acquire>
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+8010274f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  acquire(&icache.lock);
+80102752:	83 c4 10             	add    $0x10,%esp
+80102755:	eb 1b                	jmp    80102772 <iget+0x42>
+80102757:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010275e:	66 90                	xchg   %ax,%ax
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+80102760:	39 33                	cmp    %esi,(%ebx)
+80102762:	74 6c                	je     801027d0 <iget+0xa0>
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+80102764:	81 c3 cc 00 00 00    	add    $0xcc,%ebx
+8010276a:	81 fb 98 39 1a 80    	cmp    $0x801a3998,%ebx
+80102770:	74 26                	je     80102798 <iget+0x68>
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+80102772:	8b 43 08             	mov    0x8(%ebx),%eax
+80102775:	85 c0                	test   %eax,%eax
+80102777:	7f e7                	jg     80102760 <iget+0x30>
+      ip->ref++;
+      release(&icache.lock);
+      return ip;
+    }
+    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
+80102779:	85 ff                	test   %edi,%edi
+8010277b:	75 e7                	jne    80102764 <iget+0x34>
+8010277d:	85 c0                	test   %eax,%eax
+8010277f:	75 76                	jne    801027f7 <iget+0xc7>
+80102781:	89 df                	mov    %ebx,%edi
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+80102783:	81 c3 cc 00 00 00    	add    $0xcc,%ebx
+80102789:	81 fb 98 39 1a 80    	cmp    $0x801a3998,%ebx
+8010278f:	75 e1                	jne    80102772 <iget+0x42>
+80102791:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      empty = ip;
+  }
+
+  // Recycle an inode cache entry.
+  if(empty == 0)
+80102798:	85 ff                	test   %edi,%edi
+8010279a:	74 79                	je     80102815 <iget+0xe5>
+  ip = empty;
+  ip->dev = dev;
+  ip->inum = inum;
+  ip->ref = 1;
+  ip->valid = 0;
+  release(&icache.lock);
+8010279c:	83 ec 0c             	sub    $0xc,%esp
+  ip->dev = dev;
+8010279f:	89 37                	mov    %esi,(%edi)
+  ip->inum = inum;
+801027a1:	89 57 04             	mov    %edx,0x4(%edi)
+  ip->ref = 1;
+801027a4:	c7 47 08 01 00 00 00 	movl   $0x1,0x8(%edi)
+  ip->valid = 0;
+801027ab:	c7 87 88 00 00 00 00 	movl   $0x0,0x88(%edi)
+801027b2:	00 00 00 
+  release(&icache.lock);
+801027b5:	68 60 11 1a 80       	push   $0x801a1160
+801027ba:	e8 41 47 00 00       	call   80106f00 <release>
+
+  return ip;
+801027bf:	83 c4 10             	add    $0x10,%esp
+}
+801027c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801027c5:	89 f8                	mov    %edi,%eax
+801027c7:	5b                   	pop    %ebx
+801027c8:	5e                   	pop    %esi
+801027c9:	5f                   	pop    %edi
+801027ca:	5d                   	pop    %ebp
+801027cb:	c3                   	ret
+801027cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+801027d0:	39 53 04             	cmp    %edx,0x4(%ebx)
+801027d3:	75 8f                	jne    80102764 <iget+0x34>
+      ip->ref++;
+801027d5:	83 c0 01             	add    $0x1,%eax
+      release(&icache.lock);
+801027d8:	83 ec 0c             	sub    $0xc,%esp
+      return ip;
+801027db:	89 df                	mov    %ebx,%edi
+      ip->ref++;
+801027dd:	89 43 08             	mov    %eax,0x8(%ebx)
+      release(&icache.lock);
+801027e0:	68 60 11 1a 80       	push   $0x801a1160
+801027e5:	e8 16 47 00 00       	call   80106f00 <release>
+      return ip;
+801027ea:	83 c4 10             	add    $0x10,%esp
+}
+801027ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801027f0:	89 f8                	mov    %edi,%eax
+801027f2:	5b                   	pop    %ebx
+801027f3:	5e                   	pop    %esi
+801027f4:	5f                   	pop    %edi
+801027f5:	5d                   	pop    %ebp
+801027f6:	c3                   	ret
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+801027f7:	81 c3 cc 00 00 00    	add    $0xcc,%ebx
+801027fd:	81 fb 98 39 1a 80    	cmp    $0x801a3998,%ebx
+80102803:	74 10                	je     80102815 <iget+0xe5>
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+80102805:	8b 43 08             	mov    0x8(%ebx),%eax
+80102808:	85 c0                	test   %eax,%eax
+8010280a:	0f 8f 50 ff ff ff    	jg     80102760 <iget+0x30>
+80102810:	e9 68 ff ff ff       	jmp    8010277d <iget+0x4d>
+    panic("iget: no inodes");
+80102815:	83 ec 0c             	sub    $0xc,%esp
+80102818:	68 3a b7 10 80       	push   $0x8010b73a
+8010281d:	e8 9e ec ff ff       	call   801014c0 <panic>
+80102822:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102829:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80102830 <bfree>:
+{
+80102830:	55                   	push   %ebp
+80102831:	89 c1                	mov    %eax,%ecx
+  bp = bread(dev, BBLOCK(b, sb));
+80102833:	89 d0                	mov    %edx,%eax
+80102835:	c1 e8 0c             	shr    $0xc,%eax
+{
+80102838:	89 e5                	mov    %esp,%ebp
+8010283a:	56                   	push   %esi
+8010283b:	53                   	push   %ebx
+  bp = bread(dev, BBLOCK(b, sb));
+8010283c:	03 05 b0 39 1a 80    	add    0x801a39b0,%eax
+{
+80102842:	89 d3                	mov    %edx,%ebx
+  bp = bread(dev, BBLOCK(b, sb));
+80102844:	83 ec 08             	sub    $0x8,%esp
+80102847:	50                   	push   %eax
+80102848:	51                   	push   %ecx
+80102849:	e8 e2 e5 ff ff       	call   80100e30 <bread>
+  m = 1 << (bi % 8);
+8010284e:	89 d9                	mov    %ebx,%ecx
+  if((bp->data[bi/8] & m) == 0)
+80102850:	c1 fb 03             	sar    $0x3,%ebx
+80102853:	83 c4 10             	add    $0x10,%esp
+  bp = bread(dev, BBLOCK(b, sb));
+80102856:	89 c6                	mov    %eax,%esi
+  m = 1 << (bi % 8);
+80102858:	83 e1 07             	and    $0x7,%ecx
+8010285b:	b8 01 00 00 00       	mov    $0x1,%eax
+  if((bp->data[bi/8] & m) == 0)
+80102860:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  m = 1 << (bi % 8);
+80102866:	d3 e0                	shl    %cl,%eax
+  if((bp->data[bi/8] & m) == 0)
+80102868:	0f b6 8c 1e a8 00 00 	movzbl 0xa8(%esi,%ebx,1),%ecx
+8010286f:	00 
+80102870:	85 c1                	test   %eax,%ecx
+80102872:	74 26                	je     8010289a <bfree+0x6a>
+  bp->data[bi/8] &= ~m;
+80102874:	f7 d0                	not    %eax
+  log_write(bp);
+80102876:	83 ec 0c             	sub    $0xc,%esp
+  bp->data[bi/8] &= ~m;
+80102879:	21 c8                	and    %ecx,%eax
+8010287b:	88 84 1e a8 00 00 00 	mov    %al,0xa8(%esi,%ebx,1)
+  log_write(bp);
+80102882:	56                   	push   %esi
+80102883:	e8 78 1d 00 00       	call   80104600 <log_write>
+  brelse(bp);
+80102888:	89 34 24             	mov    %esi,(%esp)
+8010288b:	e8 b0 e7 ff ff       	call   80101040 <brelse>
+}
+80102890:	83 c4 10             	add    $0x10,%esp
+80102893:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102896:	5b                   	pop    %ebx
+80102897:	5e                   	pop    %esi
+80102898:	5d                   	pop    %ebp
+80102899:	c3                   	ret
+    panic("freeing free block");
+8010289a:	83 ec 0c             	sub    $0xc,%esp
+8010289d:	68 4a b7 10 80       	push   $0x8010b74a
+801028a2:	e8 19 ec ff ff       	call   801014c0 <panic>
+801028a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801028ae:	66 90                	xchg   %ax,%ax
+
+801028b0 <bmap>:
+
+// Return the disk block address of the nth block in inode ip.
+// If there is no such block, bmap allocates one.
+static uint
+bmap(struct inode *ip, uint bn)
+{
+801028b0:	55                   	push   %ebp
+801028b1:	89 e5                	mov    %esp,%ebp
+801028b3:	57                   	push   %edi
+801028b4:	56                   	push   %esi
+801028b5:	89 c6                	mov    %eax,%esi
+801028b7:	53                   	push   %ebx
+801028b8:	83 ec 1c             	sub    $0x1c,%esp
+  uint addr, *a;
+  struct buf *bp;
+
+  if(bn < NDIRECT){
+801028bb:	83 fa 0b             	cmp    $0xb,%edx
+801028be:	0f 86 8c 00 00 00    	jbe    80102950 <bmap+0xa0>
+    if((addr = ip->addrs[bn]) == 0)
+      ip->addrs[bn] = addr = balloc(ip->dev);
+    return addr;
+  }
+  bn -= NDIRECT;
+801028c4:	8d 5a f4             	lea    -0xc(%edx),%ebx
+
+  if(bn < NINDIRECT){
+801028c7:	83 fb 7f             	cmp    $0x7f,%ebx
+801028ca:	0f 87 a2 00 00 00    	ja     80102972 <bmap+0xc2>
+    // Load indirect block, allocating if necessary.
+    if((addr = ip->addrs[NDIRECT]) == 0)
+801028d0:	8b 80 c8 00 00 00    	mov    0xc8(%eax),%eax
+801028d6:	85 c0                	test   %eax,%eax
+801028d8:	74 5e                	je     80102938 <bmap+0x88>
+      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+    bp = bread(ip->dev, addr);
+801028da:	83 ec 08             	sub    $0x8,%esp
+801028dd:	50                   	push   %eax
+801028de:	ff 36                	push   (%esi)
+801028e0:	e8 4b e5 ff ff       	call   80100e30 <bread>
+    a = (uint*)bp->data;
+    if((addr = a[bn]) == 0){
+801028e5:	83 c4 10             	add    $0x10,%esp
+801028e8:	8d 9c 98 a8 00 00 00 	lea    0xa8(%eax,%ebx,4),%ebx
+    bp = bread(ip->dev, addr);
+801028ef:	89 c2                	mov    %eax,%edx
+    if((addr = a[bn]) == 0){
+801028f1:	8b 3b                	mov    (%ebx),%edi
+801028f3:	85 ff                	test   %edi,%edi
+801028f5:	74 19                	je     80102910 <bmap+0x60>
+      a[bn] = addr = balloc(ip->dev);
+      log_write(bp);
+    }
+    brelse(bp);
+801028f7:	83 ec 0c             	sub    $0xc,%esp
+801028fa:	52                   	push   %edx
+801028fb:	e8 40 e7 ff ff       	call   80101040 <brelse>
+80102900:	83 c4 10             	add    $0x10,%esp
+    return addr;
+  }
+
+  panic("bmap: out of range");
+}
+80102903:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102906:	89 f8                	mov    %edi,%eax
+80102908:	5b                   	pop    %ebx
+80102909:	5e                   	pop    %esi
+8010290a:	5f                   	pop    %edi
+8010290b:	5d                   	pop    %ebp
+8010290c:	c3                   	ret
+8010290d:	8d 76 00             	lea    0x0(%esi),%esi
+80102910:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      a[bn] = addr = balloc(ip->dev);
+80102913:	8b 06                	mov    (%esi),%eax
+80102915:	e8 f6 fc ff ff       	call   80102610 <balloc>
+      log_write(bp);
+8010291a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010291d:	83 ec 0c             	sub    $0xc,%esp
+      a[bn] = addr = balloc(ip->dev);
+80102920:	89 03                	mov    %eax,(%ebx)
+80102922:	89 c7                	mov    %eax,%edi
+      log_write(bp);
+80102924:	52                   	push   %edx
+80102925:	e8 d6 1c 00 00       	call   80104600 <log_write>
+8010292a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010292d:	83 c4 10             	add    $0x10,%esp
+80102930:	eb c5                	jmp    801028f7 <bmap+0x47>
+80102932:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+80102938:	8b 06                	mov    (%esi),%eax
+8010293a:	e8 d1 fc ff ff       	call   80102610 <balloc>
+8010293f:	89 86 c8 00 00 00    	mov    %eax,0xc8(%esi)
+80102945:	eb 93                	jmp    801028da <bmap+0x2a>
+80102947:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010294e:	66 90                	xchg   %ax,%ax
+    if((addr = ip->addrs[bn]) == 0)
+80102950:	8d 5a 24             	lea    0x24(%edx),%ebx
+80102953:	8b 7c 98 08          	mov    0x8(%eax,%ebx,4),%edi
+80102957:	85 ff                	test   %edi,%edi
+80102959:	75 a8                	jne    80102903 <bmap+0x53>
+      ip->addrs[bn] = addr = balloc(ip->dev);
+8010295b:	8b 00                	mov    (%eax),%eax
+8010295d:	e8 ae fc ff ff       	call   80102610 <balloc>
+80102962:	89 44 9e 08          	mov    %eax,0x8(%esi,%ebx,4)
+80102966:	89 c7                	mov    %eax,%edi
+}
+80102968:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010296b:	5b                   	pop    %ebx
+8010296c:	89 f8                	mov    %edi,%eax
+8010296e:	5e                   	pop    %esi
+8010296f:	5f                   	pop    %edi
+80102970:	5d                   	pop    %ebp
+80102971:	c3                   	ret
+  panic("bmap: out of range");
+80102972:	83 ec 0c             	sub    $0xc,%esp
+80102975:	68 5d b7 10 80       	push   $0x8010b75d
+8010297a:	e8 41 eb ff ff       	call   801014c0 <panic>
+8010297f:	90                   	nop
+
+80102980 <readsb>:
+{
+80102980:	55                   	push   %ebp
+80102981:	89 e5                	mov    %esp,%ebp
+80102983:	56                   	push   %esi
+80102984:	53                   	push   %ebx
+80102985:	8b 75 0c             	mov    0xc(%ebp),%esi
+  bp = bread(dev, 1);
+80102988:	83 ec 08             	sub    $0x8,%esp
+8010298b:	6a 01                	push   $0x1
+8010298d:	ff 75 08             	push   0x8(%ebp)
+80102990:	e8 9b e4 ff ff       	call   80100e30 <bread>
+  memmove(sb, bp->data, sizeof(*sb));
+80102995:	83 c4 0c             	add    $0xc,%esp
+  bp = bread(dev, 1);
+80102998:	89 c3                	mov    %eax,%ebx
+  memmove(sb, bp->data, sizeof(*sb));
+8010299a:	8d 80 a8 00 00 00    	lea    0xa8(%eax),%eax
+801029a0:	6a 1c                	push   $0x1c
+801029a2:	50                   	push   %eax
+801029a3:	56                   	push   %esi
+801029a4:	e8 a7 4a 00 00       	call   80107450 <memmove>
+  brelse(bp);
+801029a9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+801029ac:	83 c4 10             	add    $0x10,%esp
+}
+801029af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801029b2:	5b                   	pop    %ebx
+801029b3:	5e                   	pop    %esi
+801029b4:	5d                   	pop    %ebp
+  brelse(bp);
+801029b5:	e9 86 e6 ff ff       	jmp    80101040 <brelse>
+801029ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801029c0 <iinit>:
+{
+801029c0:	55                   	push   %ebp
+801029c1:	89 e5                	mov    %esp,%ebp
+801029c3:	53                   	push   %ebx
+801029c4:	bb cc 11 1a 80       	mov    $0x801a11cc,%ebx
+801029c9:	83 ec 0c             	sub    $0xc,%esp
+  initlock(&icache.lock, "icache");
+801029cc:	68 70 b7 10 80       	push   $0x8010b770
+801029d1:	68 60 11 1a 80       	push   $0x801a1160
+801029d6:	e8 85 3f 00 00       	call   80106960 <initlock>
+  for(i = 0; i < NINODE; i++) {
+801029db:	83 c4 10             	add    $0x10,%esp
+801029de:	66 90                	xchg   %ax,%ax
+    initsleeplock(&icache.inode[i].lock, "inode");
+801029e0:	83 ec 08             	sub    $0x8,%esp
+801029e3:	68 77 b7 10 80       	push   $0x8010b777
+801029e8:	53                   	push   %ebx
+  for(i = 0; i < NINODE; i++) {
+801029e9:	81 c3 cc 00 00 00    	add    $0xcc,%ebx
+    initsleeplock(&icache.inode[i].lock, "inode");
+801029ef:	e8 6c 3b 00 00       	call   80106560 <initsleeplock>
+  for(i = 0; i < NINODE; i++) {
+801029f4:	83 c4 10             	add    $0x10,%esp
+801029f7:	81 fb a4 39 1a 80    	cmp    $0x801a39a4,%ebx
+801029fd:	75 e1                	jne    801029e0 <iinit+0x20>
+  bp = bread(dev, 1);
+801029ff:	83 ec 08             	sub    $0x8,%esp
+80102a02:	6a 01                	push   $0x1
+80102a04:	ff 75 08             	push   0x8(%ebp)
+80102a07:	e8 24 e4 ff ff       	call   80100e30 <bread>
+  memmove(sb, bp->data, sizeof(*sb));
+80102a0c:	83 c4 0c             	add    $0xc,%esp
+  bp = bread(dev, 1);
+80102a0f:	89 c3                	mov    %eax,%ebx
+  memmove(sb, bp->data, sizeof(*sb));
+80102a11:	8d 80 a8 00 00 00    	lea    0xa8(%eax),%eax
+80102a17:	6a 1c                	push   $0x1c
+80102a19:	50                   	push   %eax
+80102a1a:	68 98 39 1a 80       	push   $0x801a3998
+80102a1f:	e8 2c 4a 00 00       	call   80107450 <memmove>
+  brelse(bp);
+80102a24:	89 1c 24             	mov    %ebx,(%esp)
+80102a27:	e8 14 e6 ff ff       	call   80101040 <brelse>
+  cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
+80102a2c:	ff 35 b0 39 1a 80    	push   0x801a39b0
+80102a32:	ff 35 ac 39 1a 80    	push   0x801a39ac
+80102a38:	ff 35 a8 39 1a 80    	push   0x801a39a8
+80102a3e:	ff 35 a4 39 1a 80    	push   0x801a39a4
+80102a44:	ff 35 a0 39 1a 80    	push   0x801a39a0
+80102a4a:	ff 35 9c 39 1a 80    	push   0x801a399c
+80102a50:	ff 35 98 39 1a 80    	push   0x801a3998
+80102a56:	68 04 b8 10 80       	push   $0x8010b804
+80102a5b:	e8 90 ed ff ff       	call   801017f0 <cprintf>
+}
+80102a60:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102a63:	83 c4 30             	add    $0x30,%esp
+80102a66:	c9                   	leave
+80102a67:	c3                   	ret
+80102a68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102a6f:	90                   	nop
+
+80102a70 <ialloc>:
+{
+80102a70:	55                   	push   %ebp
+80102a71:	89 e5                	mov    %esp,%ebp
+80102a73:	57                   	push   %edi
+80102a74:	56                   	push   %esi
+80102a75:	53                   	push   %ebx
+80102a76:	83 ec 1c             	sub    $0x1c,%esp
+80102a79:	8b 45 0c             	mov    0xc(%ebp),%eax
+  for(inum = 1; inum < sb.ninodes; inum++){
+80102a7c:	83 3d a0 39 1a 80 01 	cmpl   $0x1,0x801a39a0
+{
+80102a83:	8b 75 08             	mov    0x8(%ebp),%esi
+80102a86:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(inum = 1; inum < sb.ninodes; inum++){
+80102a89:	0f 86 94 00 00 00    	jbe    80102b23 <ialloc+0xb3>
+80102a8f:	bf 01 00 00 00       	mov    $0x1,%edi
+80102a94:	eb 21                	jmp    80102ab7 <ialloc+0x47>
+80102a96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102a9d:	8d 76 00             	lea    0x0(%esi),%esi
+    brelse(bp);
+80102aa0:	83 ec 0c             	sub    $0xc,%esp
+  for(inum = 1; inum < sb.ninodes; inum++){
+80102aa3:	83 c7 01             	add    $0x1,%edi
+    brelse(bp);
+80102aa6:	53                   	push   %ebx
+80102aa7:	e8 94 e5 ff ff       	call   80101040 <brelse>
+  for(inum = 1; inum < sb.ninodes; inum++){
+80102aac:	83 c4 10             	add    $0x10,%esp
+80102aaf:	3b 3d a0 39 1a 80    	cmp    0x801a39a0,%edi
+80102ab5:	73 6c                	jae    80102b23 <ialloc+0xb3>
+    bp = bread(dev, IBLOCK(inum, sb));
+80102ab7:	89 f8                	mov    %edi,%eax
+80102ab9:	83 ec 08             	sub    $0x8,%esp
+80102abc:	c1 e8 03             	shr    $0x3,%eax
+80102abf:	03 05 ac 39 1a 80    	add    0x801a39ac,%eax
+80102ac5:	50                   	push   %eax
+80102ac6:	56                   	push   %esi
+80102ac7:	e8 64 e3 ff ff       	call   80100e30 <bread>
+    if(dip->type == 0){  // a free inode
+80102acc:	83 c4 10             	add    $0x10,%esp
+    bp = bread(dev, IBLOCK(inum, sb));
+80102acf:	89 c3                	mov    %eax,%ebx
+    dip = (struct dinode*)bp->data + inum%IPB;
+80102ad1:	89 f8                	mov    %edi,%eax
+80102ad3:	83 e0 07             	and    $0x7,%eax
+80102ad6:	c1 e0 06             	shl    $0x6,%eax
+80102ad9:	8d 8c 03 a8 00 00 00 	lea    0xa8(%ebx,%eax,1),%ecx
+    if(dip->type == 0){  // a free inode
+80102ae0:	66 83 39 00          	cmpw   $0x0,(%ecx)
+80102ae4:	75 ba                	jne    80102aa0 <ialloc+0x30>
+      memset(dip, 0, sizeof(*dip));
+80102ae6:	83 ec 04             	sub    $0x4,%esp
+80102ae9:	6a 40                	push   $0x40
+80102aeb:	6a 00                	push   $0x0
+80102aed:	51                   	push   %ecx
+80102aee:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+80102af1:	e8 ca 48 00 00       	call   801073c0 <memset>
+      dip->type = type;
+80102af6:	0f b7 45 e4          	movzwl -0x1c(%ebp),%eax
+80102afa:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80102afd:	66 89 01             	mov    %ax,(%ecx)
+      log_write(bp);   // mark it allocated on the disk
+80102b00:	89 1c 24             	mov    %ebx,(%esp)
+80102b03:	e8 f8 1a 00 00       	call   80104600 <log_write>
+      brelse(bp);
+80102b08:	89 1c 24             	mov    %ebx,(%esp)
+80102b0b:	e8 30 e5 ff ff       	call   80101040 <brelse>
+      return iget(dev, inum);
+80102b10:	83 c4 10             	add    $0x10,%esp
+}
+80102b13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return iget(dev, inum);
+80102b16:	89 fa                	mov    %edi,%edx
+}
+80102b18:	5b                   	pop    %ebx
+      return iget(dev, inum);
+80102b19:	89 f0                	mov    %esi,%eax
+}
+80102b1b:	5e                   	pop    %esi
+80102b1c:	5f                   	pop    %edi
+80102b1d:	5d                   	pop    %ebp
+      return iget(dev, inum);
+80102b1e:	e9 0d fc ff ff       	jmp    80102730 <iget>
+  panic("ialloc: no inodes");
+80102b23:	83 ec 0c             	sub    $0xc,%esp
+80102b26:	68 7d b7 10 80       	push   $0x8010b77d
+80102b2b:	e8 90 e9 ff ff       	call   801014c0 <panic>
+
+80102b30 <iupdate>:
+{
+80102b30:	55                   	push   %ebp
+80102b31:	89 e5                	mov    %esp,%ebp
+80102b33:	56                   	push   %esi
+80102b34:	53                   	push   %ebx
+80102b35:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80102b38:	8b 43 04             	mov    0x4(%ebx),%eax
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+80102b3b:	81 c3 98 00 00 00    	add    $0x98,%ebx
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80102b41:	83 ec 08             	sub    $0x8,%esp
+80102b44:	c1 e8 03             	shr    $0x3,%eax
+80102b47:	03 05 ac 39 1a 80    	add    0x801a39ac,%eax
+80102b4d:	50                   	push   %eax
+80102b4e:	ff b3 68 ff ff ff    	push   -0x98(%ebx)
+80102b54:	e8 d7 e2 ff ff       	call   80100e30 <bread>
+  dip->type = ip->type;
+80102b59:	0f b7 53 f4          	movzwl -0xc(%ebx),%edx
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+80102b5d:	83 c4 0c             	add    $0xc,%esp
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80102b60:	89 c6                	mov    %eax,%esi
+  dip = (struct dinode*)bp->data + ip->inum%IPB;
+80102b62:	8b 83 6c ff ff ff    	mov    -0x94(%ebx),%eax
+80102b68:	83 e0 07             	and    $0x7,%eax
+80102b6b:	c1 e0 06             	shl    $0x6,%eax
+80102b6e:	8d 84 06 a8 00 00 00 	lea    0xa8(%esi,%eax,1),%eax
+  dip->type = ip->type;
+80102b75:	66 89 10             	mov    %dx,(%eax)
+  dip->major = ip->major;
+80102b78:	0f b7 53 f6          	movzwl -0xa(%ebx),%edx
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+80102b7c:	83 c0 0c             	add    $0xc,%eax
+  dip->major = ip->major;
+80102b7f:	66 89 50 f6          	mov    %dx,-0xa(%eax)
+  dip->minor = ip->minor;
+80102b83:	0f b7 53 f8          	movzwl -0x8(%ebx),%edx
+80102b87:	66 89 50 f8          	mov    %dx,-0x8(%eax)
+  dip->nlink = ip->nlink;
+80102b8b:	0f b7 53 fa          	movzwl -0x6(%ebx),%edx
+80102b8f:	66 89 50 fa          	mov    %dx,-0x6(%eax)
+  dip->size = ip->size;
+80102b93:	8b 53 fc             	mov    -0x4(%ebx),%edx
+80102b96:	89 50 fc             	mov    %edx,-0x4(%eax)
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+80102b99:	6a 34                	push   $0x34
+80102b9b:	53                   	push   %ebx
+80102b9c:	50                   	push   %eax
+80102b9d:	e8 ae 48 00 00       	call   80107450 <memmove>
+  log_write(bp);
+80102ba2:	89 34 24             	mov    %esi,(%esp)
+80102ba5:	e8 56 1a 00 00       	call   80104600 <log_write>
+  brelse(bp);
+80102baa:	89 75 08             	mov    %esi,0x8(%ebp)
+80102bad:	83 c4 10             	add    $0x10,%esp
+}
+80102bb0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102bb3:	5b                   	pop    %ebx
+80102bb4:	5e                   	pop    %esi
+80102bb5:	5d                   	pop    %ebp
+  brelse(bp);
+80102bb6:	e9 85 e4 ff ff       	jmp    80101040 <brelse>
+80102bbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102bbf:	90                   	nop
+
+80102bc0 <idup>:
+{
+80102bc0:	55                   	push   %ebp
+80102bc1:	89 e5                	mov    %esp,%ebp
+80102bc3:	53                   	push   %ebx
+80102bc4:	83 ec 10             	sub    $0x10,%esp
+80102bc7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&icache.lock);
+80102bca:	68 60 11 1a 80       	push   $0x801a1160
+80102bcf:	e8 9c 44 00 00       	call   80107070 <acquire>
+  ip->ref++;
+80102bd4:	83 43 08 01          	addl   $0x1,0x8(%ebx)
+  release(&icache.lock);
+80102bd8:	c7 04 24 60 11 1a 80 	movl   $0x801a1160,(%esp)
+80102bdf:	e8 1c 43 00 00       	call   80106f00 <release>
+}
+80102be4:	89 d8                	mov    %ebx,%eax
+80102be6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102be9:	c9                   	leave
+80102bea:	c3                   	ret
+80102beb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102bef:	90                   	nop
+
+80102bf0 <ilock>:
+{
+80102bf0:	55                   	push   %ebp
+80102bf1:	89 e5                	mov    %esp,%ebp
+80102bf3:	56                   	push   %esi
+80102bf4:	53                   	push   %ebx
+80102bf5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || ip->ref < 1)
+80102bf8:	85 db                	test   %ebx,%ebx
+80102bfa:	0f 84 d2 00 00 00    	je     80102cd2 <ilock+0xe2>
+80102c00:	8b 53 08             	mov    0x8(%ebx),%edx
+80102c03:	85 d2                	test   %edx,%edx
+80102c05:	0f 8e c7 00 00 00    	jle    80102cd2 <ilock+0xe2>
+  acquiresleep(&ip->lock);
+80102c0b:	83 ec 0c             	sub    $0xc,%esp
+80102c0e:	8d 43 0c             	lea    0xc(%ebx),%eax
+80102c11:	50                   	push   %eax
+80102c12:	e8 99 39 00 00       	call   801065b0 <acquiresleep>
+  if(ip->valid == 0){
+80102c17:	8b 83 88 00 00 00    	mov    0x88(%ebx),%eax
+80102c1d:	83 c4 10             	add    $0x10,%esp
+80102c20:	85 c0                	test   %eax,%eax
+80102c22:	74 0c                	je     80102c30 <ilock+0x40>
+}
+80102c24:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102c27:	5b                   	pop    %ebx
+80102c28:	5e                   	pop    %esi
+80102c29:	5d                   	pop    %ebp
+80102c2a:	c3                   	ret
+80102c2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102c2f:	90                   	nop
+    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80102c30:	8b 43 04             	mov    0x4(%ebx),%eax
+80102c33:	83 ec 08             	sub    $0x8,%esp
+80102c36:	c1 e8 03             	shr    $0x3,%eax
+80102c39:	03 05 ac 39 1a 80    	add    0x801a39ac,%eax
+80102c3f:	50                   	push   %eax
+80102c40:	ff 33                	push   (%ebx)
+80102c42:	e8 e9 e1 ff ff       	call   80100e30 <bread>
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+80102c47:	83 c4 0c             	add    $0xc,%esp
+    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80102c4a:	89 c6                	mov    %eax,%esi
+    dip = (struct dinode*)bp->data + ip->inum%IPB;
+80102c4c:	8b 43 04             	mov    0x4(%ebx),%eax
+80102c4f:	83 e0 07             	and    $0x7,%eax
+80102c52:	c1 e0 06             	shl    $0x6,%eax
+80102c55:	8d 84 06 a8 00 00 00 	lea    0xa8(%esi,%eax,1),%eax
+    ip->type = dip->type;
+80102c5c:	0f b7 10             	movzwl (%eax),%edx
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+80102c5f:	83 c0 0c             	add    $0xc,%eax
+    ip->type = dip->type;
+80102c62:	66 89 93 8c 00 00 00 	mov    %dx,0x8c(%ebx)
+    ip->major = dip->major;
+80102c69:	0f b7 50 f6          	movzwl -0xa(%eax),%edx
+80102c6d:	66 89 93 8e 00 00 00 	mov    %dx,0x8e(%ebx)
+    ip->minor = dip->minor;
+80102c74:	0f b7 50 f8          	movzwl -0x8(%eax),%edx
+80102c78:	66 89 93 90 00 00 00 	mov    %dx,0x90(%ebx)
+    ip->nlink = dip->nlink;
+80102c7f:	0f b7 50 fa          	movzwl -0x6(%eax),%edx
+80102c83:	66 89 93 92 00 00 00 	mov    %dx,0x92(%ebx)
+    ip->size = dip->size;
+80102c8a:	8b 50 fc             	mov    -0x4(%eax),%edx
+80102c8d:	89 93 94 00 00 00    	mov    %edx,0x94(%ebx)
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+80102c93:	6a 34                	push   $0x34
+80102c95:	50                   	push   %eax
+80102c96:	8d 83 98 00 00 00    	lea    0x98(%ebx),%eax
+80102c9c:	50                   	push   %eax
+80102c9d:	e8 ae 47 00 00       	call   80107450 <memmove>
+    brelse(bp);
+80102ca2:	89 34 24             	mov    %esi,(%esp)
+80102ca5:	e8 96 e3 ff ff       	call   80101040 <brelse>
+    if(ip->type == 0)
+80102caa:	83 c4 10             	add    $0x10,%esp
+80102cad:	66 83 bb 8c 00 00 00 	cmpw   $0x0,0x8c(%ebx)
+80102cb4:	00 
+    ip->valid = 1;
+80102cb5:	c7 83 88 00 00 00 01 	movl   $0x1,0x88(%ebx)
+80102cbc:	00 00 00 
+    if(ip->type == 0)
+80102cbf:	0f 85 5f ff ff ff    	jne    80102c24 <ilock+0x34>
+      panic("ilock: no type");
+80102cc5:	83 ec 0c             	sub    $0xc,%esp
+80102cc8:	68 95 b7 10 80       	push   $0x8010b795
+80102ccd:	e8 ee e7 ff ff       	call   801014c0 <panic>
+    panic("ilock");
+80102cd2:	83 ec 0c             	sub    $0xc,%esp
+80102cd5:	68 8f b7 10 80       	push   $0x8010b78f
+80102cda:	e8 e1 e7 ff ff       	call   801014c0 <panic>
+80102cdf:	90                   	nop
+
+80102ce0 <ilockshared>:
+{
+80102ce0:	55                   	push   %ebp
+80102ce1:	89 e5                	mov    %esp,%ebp
+80102ce3:	56                   	push   %esi
+80102ce4:	53                   	push   %ebx
+80102ce5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || ip->ref < 1)
+80102ce8:	85 db                	test   %ebx,%ebx
+80102cea:	74 46                	je     80102d32 <ilockshared+0x52>
+80102cec:	8b 53 08             	mov    0x8(%ebx),%edx
+80102cef:	85 d2                	test   %edx,%edx
+80102cf1:	7e 3f                	jle    80102d32 <ilockshared+0x52>
+  acquiresleepshared(&ip->lock);
+80102cf3:	83 ec 0c             	sub    $0xc,%esp
+80102cf6:	8d 73 0c             	lea    0xc(%ebx),%esi
+80102cf9:	56                   	push   %esi
+80102cfa:	e8 b1 39 00 00       	call   801066b0 <acquiresleepshared>
+  if(ip->valid == 0){
+80102cff:	8b 83 88 00 00 00    	mov    0x88(%ebx),%eax
+80102d05:	83 c4 10             	add    $0x10,%esp
+80102d08:	85 c0                	test   %eax,%eax
+80102d0a:	74 0c                	je     80102d18 <ilockshared+0x38>
+}
+80102d0c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102d0f:	5b                   	pop    %ebx
+80102d10:	5e                   	pop    %esi
+80102d11:	5d                   	pop    %ebp
+80102d12:	c3                   	ret
+80102d13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102d17:	90                   	nop
+    releasesleep(&ip->lock);
+80102d18:	83 ec 0c             	sub    $0xc,%esp
+80102d1b:	56                   	push   %esi
+80102d1c:	e8 6f 3a 00 00       	call   80106790 <releasesleep>
+    ilock(ip);
+80102d21:	89 5d 08             	mov    %ebx,0x8(%ebp)
+80102d24:	83 c4 10             	add    $0x10,%esp
+}
+80102d27:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102d2a:	5b                   	pop    %ebx
+80102d2b:	5e                   	pop    %esi
+80102d2c:	5d                   	pop    %ebp
+    ilock(ip);
+80102d2d:	e9 be fe ff ff       	jmp    80102bf0 <ilock>
+    panic("ilockshared");
+80102d32:	83 ec 0c             	sub    $0xc,%esp
+80102d35:	68 a4 b7 10 80       	push   $0x8010b7a4
+80102d3a:	e8 81 e7 ff ff       	call   801014c0 <panic>
+80102d3f:	90                   	nop
+
+80102d40 <iunlock>:
+{
+80102d40:	55                   	push   %ebp
+80102d41:	89 e5                	mov    %esp,%ebp
+80102d43:	56                   	push   %esi
+80102d44:	53                   	push   %ebx
+80102d45:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || !lockedsleep(&ip->lock) || ip->ref < 1)
+80102d48:	85 db                	test   %ebx,%ebx
+80102d4a:	74 28                	je     80102d74 <iunlock+0x34>
+80102d4c:	83 ec 0c             	sub    $0xc,%esp
+80102d4f:	8d 73 0c             	lea    0xc(%ebx),%esi
+80102d52:	56                   	push   %esi
+80102d53:	e8 a8 3b 00 00       	call   80106900 <lockedsleep>
+80102d58:	83 c4 10             	add    $0x10,%esp
+80102d5b:	85 c0                	test   %eax,%eax
+80102d5d:	74 15                	je     80102d74 <iunlock+0x34>
+80102d5f:	8b 43 08             	mov    0x8(%ebx),%eax
+80102d62:	85 c0                	test   %eax,%eax
+80102d64:	7e 0e                	jle    80102d74 <iunlock+0x34>
+  releasesleep(&ip->lock);
+80102d66:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+80102d69:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102d6c:	5b                   	pop    %ebx
+80102d6d:	5e                   	pop    %esi
+80102d6e:	5d                   	pop    %ebp
+  releasesleep(&ip->lock);
+80102d6f:	e9 1c 3a 00 00       	jmp    80106790 <releasesleep>
+    panic("iunlock");
+80102d74:	83 ec 0c             	sub    $0xc,%esp
+80102d77:	68 b0 b7 10 80       	push   $0x8010b7b0
+80102d7c:	e8 3f e7 ff ff       	call   801014c0 <panic>
+80102d81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102d88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102d8f:	90                   	nop
+
+80102d90 <iput>:
+{
+80102d90:	55                   	push   %ebp
+80102d91:	89 e5                	mov    %esp,%ebp
+80102d93:	57                   	push   %edi
+80102d94:	56                   	push   %esi
+80102d95:	53                   	push   %ebx
+80102d96:	83 ec 28             	sub    $0x28,%esp
+80102d99:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquiresleep(&ip->lock);
+80102d9c:	8d 7b 0c             	lea    0xc(%ebx),%edi
+80102d9f:	57                   	push   %edi
+80102da0:	e8 0b 38 00 00       	call   801065b0 <acquiresleep>
+  if(ip->valid && ip->nlink == 0){
+80102da5:	8b 93 88 00 00 00    	mov    0x88(%ebx),%edx
+80102dab:	83 c4 10             	add    $0x10,%esp
+80102dae:	85 d2                	test   %edx,%edx
+80102db0:	74 0a                	je     80102dbc <iput+0x2c>
+80102db2:	66 83 bb 92 00 00 00 	cmpw   $0x0,0x92(%ebx)
+80102db9:	00 
+80102dba:	74 34                	je     80102df0 <iput+0x60>
+  releasesleep(&ip->lock);
+80102dbc:	83 ec 0c             	sub    $0xc,%esp
+80102dbf:	57                   	push   %edi
+80102dc0:	e8 cb 39 00 00       	call   80106790 <releasesleep>
+  acquire(&icache.lock);
+80102dc5:	c7 04 24 60 11 1a 80 	movl   $0x801a1160,(%esp)
+80102dcc:	e8 9f 42 00 00       	call   80107070 <acquire>
+  ip->ref--;
+80102dd1:	83 6b 08 01          	subl   $0x1,0x8(%ebx)
+  release(&icache.lock);
+80102dd5:	83 c4 10             	add    $0x10,%esp
+80102dd8:	c7 45 08 60 11 1a 80 	movl   $0x801a1160,0x8(%ebp)
+}
+80102ddf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102de2:	5b                   	pop    %ebx
+80102de3:	5e                   	pop    %esi
+80102de4:	5f                   	pop    %edi
+80102de5:	5d                   	pop    %ebp
+  release(&icache.lock);
+80102de6:	e9 15 41 00 00       	jmp    80106f00 <release>
+80102deb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102def:	90                   	nop
+    acquire(&icache.lock);
+80102df0:	83 ec 0c             	sub    $0xc,%esp
+80102df3:	68 60 11 1a 80       	push   $0x801a1160
+80102df8:	e8 73 42 00 00       	call   80107070 <acquire>
+    int r = ip->ref;
+80102dfd:	8b 73 08             	mov    0x8(%ebx),%esi
+    release(&icache.lock);
+80102e00:	c7 04 24 60 11 1a 80 	movl   $0x801a1160,(%esp)
+80102e07:	e8 f4 40 00 00       	call   80106f00 <release>
+    if(r == 1){
+80102e0c:	83 c4 10             	add    $0x10,%esp
+80102e0f:	83 fe 01             	cmp    $0x1,%esi
+80102e12:	75 a8                	jne    80102dbc <iput+0x2c>
+80102e14:	8d 8b c8 00 00 00    	lea    0xc8(%ebx),%ecx
+80102e1a:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80102e1d:	8d b3 98 00 00 00    	lea    0x98(%ebx),%esi
+80102e23:	89 df                	mov    %ebx,%edi
+80102e25:	89 cb                	mov    %ecx,%ebx
+80102e27:	eb 0e                	jmp    80102e37 <iput+0xa7>
+80102e29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+{
+  int i, j;
+  struct buf *bp;
+  uint *a;
+
+  for(i = 0; i < NDIRECT; i++){
+80102e30:	83 c6 04             	add    $0x4,%esi
+80102e33:	39 de                	cmp    %ebx,%esi
+80102e35:	74 19                	je     80102e50 <iput+0xc0>
+    if(ip->addrs[i]){
+80102e37:	8b 16                	mov    (%esi),%edx
+80102e39:	85 d2                	test   %edx,%edx
+80102e3b:	74 f3                	je     80102e30 <iput+0xa0>
+      bfree(ip->dev, ip->addrs[i]);
+80102e3d:	8b 07                	mov    (%edi),%eax
+80102e3f:	e8 ec f9 ff ff       	call   80102830 <bfree>
+      ip->addrs[i] = 0;
+80102e44:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+80102e4a:	eb e4                	jmp    80102e30 <iput+0xa0>
+80102e4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    }
+  }
+
+  if(ip->addrs[NDIRECT]){
+80102e50:	89 fb                	mov    %edi,%ebx
+80102e52:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80102e55:	8b 83 c8 00 00 00    	mov    0xc8(%ebx),%eax
+80102e5b:	85 c0                	test   %eax,%eax
+80102e5d:	75 36                	jne    80102e95 <iput+0x105>
+    brelse(bp);
+    bfree(ip->dev, ip->addrs[NDIRECT]);
+    ip->addrs[NDIRECT] = 0;
+  }
+
+  ip->size = 0;
+80102e5f:	c7 83 94 00 00 00 00 	movl   $0x0,0x94(%ebx)
+80102e66:	00 00 00 
+  iupdate(ip);
+80102e69:	83 ec 0c             	sub    $0xc,%esp
+80102e6c:	53                   	push   %ebx
+80102e6d:	e8 be fc ff ff       	call   80102b30 <iupdate>
+      ip->type = 0;
+80102e72:	31 c0                	xor    %eax,%eax
+80102e74:	66 89 83 8c 00 00 00 	mov    %ax,0x8c(%ebx)
+      iupdate(ip);
+80102e7b:	89 1c 24             	mov    %ebx,(%esp)
+80102e7e:	e8 ad fc ff ff       	call   80102b30 <iupdate>
+      ip->valid = 0;
+80102e83:	83 c4 10             	add    $0x10,%esp
+80102e86:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+80102e8d:	00 00 00 
+80102e90:	e9 27 ff ff ff       	jmp    80102dbc <iput+0x2c>
+    bp = bread(ip->dev, ip->addrs[NDIRECT]);
+80102e95:	83 ec 08             	sub    $0x8,%esp
+80102e98:	50                   	push   %eax
+80102e99:	ff 33                	push   (%ebx)
+80102e9b:	e8 90 df ff ff       	call   80100e30 <bread>
+    for(j = 0; j < NINDIRECT; j++){
+80102ea0:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80102ea3:	83 c4 10             	add    $0x10,%esp
+80102ea6:	8d 88 a8 02 00 00    	lea    0x2a8(%eax),%ecx
+80102eac:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80102eaf:	8d b0 a8 00 00 00    	lea    0xa8(%eax),%esi
+80102eb5:	89 cf                	mov    %ecx,%edi
+80102eb7:	eb 0e                	jmp    80102ec7 <iput+0x137>
+80102eb9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102ec0:	83 c6 04             	add    $0x4,%esi
+80102ec3:	39 fe                	cmp    %edi,%esi
+80102ec5:	74 0f                	je     80102ed6 <iput+0x146>
+      if(a[j])
+80102ec7:	8b 16                	mov    (%esi),%edx
+80102ec9:	85 d2                	test   %edx,%edx
+80102ecb:	74 f3                	je     80102ec0 <iput+0x130>
+        bfree(ip->dev, a[j]);
+80102ecd:	8b 03                	mov    (%ebx),%eax
+80102ecf:	e8 5c f9 ff ff       	call   80102830 <bfree>
+80102ed4:	eb ea                	jmp    80102ec0 <iput+0x130>
+    brelse(bp);
+80102ed6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80102ed9:	83 ec 0c             	sub    $0xc,%esp
+80102edc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80102edf:	50                   	push   %eax
+80102ee0:	e8 5b e1 ff ff       	call   80101040 <brelse>
+    bfree(ip->dev, ip->addrs[NDIRECT]);
+80102ee5:	8b 93 c8 00 00 00    	mov    0xc8(%ebx),%edx
+80102eeb:	8b 03                	mov    (%ebx),%eax
+80102eed:	e8 3e f9 ff ff       	call   80102830 <bfree>
+    ip->addrs[NDIRECT] = 0;
+80102ef2:	83 c4 10             	add    $0x10,%esp
+80102ef5:	c7 83 c8 00 00 00 00 	movl   $0x0,0xc8(%ebx)
+80102efc:	00 00 00 
+80102eff:	e9 5b ff ff ff       	jmp    80102e5f <iput+0xcf>
+80102f04:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102f0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102f0f:	90                   	nop
+
+80102f10 <iunlockput>:
+{
+80102f10:	55                   	push   %ebp
+80102f11:	89 e5                	mov    %esp,%ebp
+80102f13:	56                   	push   %esi
+80102f14:	53                   	push   %ebx
+80102f15:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || !lockedsleep(&ip->lock) || ip->ref < 1)
+80102f18:	85 db                	test   %ebx,%ebx
+80102f1a:	74 34                	je     80102f50 <iunlockput+0x40>
+80102f1c:	83 ec 0c             	sub    $0xc,%esp
+80102f1f:	8d 73 0c             	lea    0xc(%ebx),%esi
+80102f22:	56                   	push   %esi
+80102f23:	e8 d8 39 00 00       	call   80106900 <lockedsleep>
+80102f28:	83 c4 10             	add    $0x10,%esp
+80102f2b:	85 c0                	test   %eax,%eax
+80102f2d:	74 21                	je     80102f50 <iunlockput+0x40>
+80102f2f:	8b 43 08             	mov    0x8(%ebx),%eax
+80102f32:	85 c0                	test   %eax,%eax
+80102f34:	7e 1a                	jle    80102f50 <iunlockput+0x40>
+  releasesleep(&ip->lock);
+80102f36:	83 ec 0c             	sub    $0xc,%esp
+80102f39:	56                   	push   %esi
+80102f3a:	e8 51 38 00 00       	call   80106790 <releasesleep>
+  iput(ip);
+80102f3f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+80102f42:	83 c4 10             	add    $0x10,%esp
+}
+80102f45:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102f48:	5b                   	pop    %ebx
+80102f49:	5e                   	pop    %esi
+80102f4a:	5d                   	pop    %ebp
+  iput(ip);
+80102f4b:	e9 40 fe ff ff       	jmp    80102d90 <iput>
+    panic("iunlock");
+80102f50:	83 ec 0c             	sub    $0xc,%esp
+80102f53:	68 b0 b7 10 80       	push   $0x8010b7b0
+80102f58:	e8 63 e5 ff ff       	call   801014c0 <panic>
+80102f5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80102f60 <stati>:
+
+// Copy stat information from inode.
+// Caller must hold ip->lock.
+void
+stati(struct inode *ip, struct stat *st)
+{
+80102f60:	55                   	push   %ebp
+80102f61:	89 e5                	mov    %esp,%ebp
+80102f63:	8b 55 08             	mov    0x8(%ebp),%edx
+80102f66:	8b 45 0c             	mov    0xc(%ebp),%eax
+  st->dev = ip->dev;
+80102f69:	8b 0a                	mov    (%edx),%ecx
+80102f6b:	89 48 04             	mov    %ecx,0x4(%eax)
+  st->ino = ip->inum;
+80102f6e:	8b 4a 04             	mov    0x4(%edx),%ecx
+80102f71:	89 48 08             	mov    %ecx,0x8(%eax)
+  st->type = ip->type;
+80102f74:	0f b7 8a 8c 00 00 00 	movzwl 0x8c(%edx),%ecx
+80102f7b:	66 89 08             	mov    %cx,(%eax)
+  st->nlink = ip->nlink;
+80102f7e:	0f b7 8a 92 00 00 00 	movzwl 0x92(%edx),%ecx
+80102f85:	66 89 48 0c          	mov    %cx,0xc(%eax)
+  st->size = ip->size;
+80102f89:	8b 92 94 00 00 00    	mov    0x94(%edx),%edx
+80102f8f:	89 50 10             	mov    %edx,0x10(%eax)
+}
+80102f92:	5d                   	pop    %ebp
+80102f93:	c3                   	ret
+80102f94:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102f9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102f9f:	90                   	nop
+
+80102fa0 <ireadahead>:
+// Start reading the blocks that hold bytes [off, off+n)
+// of ip into the buffer cache, without waiting for them.
+// Caller must hold ip->lock.
+void
+ireadahead(struct inode *ip, uint off, uint n)
+{
+80102fa0:	55                   	push   %ebp
+80102fa1:	89 e5                	mov    %esp,%ebp
+80102fa3:	57                   	push   %edi
+80102fa4:	56                   	push   %esi
+80102fa5:	53                   	push   %ebx
+80102fa6:	83 ec 0c             	sub    $0xc,%esp
+80102fa9:	8b 75 08             	mov    0x8(%ebp),%esi
+80102fac:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint bn, end;
+
+  if(ip->type == T_DEV || off >= ip->size)
+80102faf:	66 83 be 8c 00 00 00 	cmpw   $0x3,0x8c(%esi)
+80102fb6:	03 
+80102fb7:	74 45                	je     80102ffe <ireadahead+0x5e>
+80102fb9:	8b 86 94 00 00 00    	mov    0x94(%esi),%eax
+80102fbf:	39 c3                	cmp    %eax,%ebx
+80102fc1:	73 3b                	jae    80102ffe <ireadahead+0x5e>
+    return;
+  if(n > ip->size - off)
+80102fc3:	29 d8                	sub    %ebx,%eax
+    n = ip->size - off;
+  end = (off + n + BSIZE - 1) / BSIZE;
+80102fc5:	3b 45 10             	cmp    0x10(%ebp),%eax
+80102fc8:	0f 47 45 10          	cmova  0x10(%ebp),%eax
+80102fcc:	8d bc 03 ff 01 00 00 	lea    0x1ff(%ebx,%eax,1),%edi
+  for(bn = off/BSIZE; bn < end; bn++)
+80102fd3:	c1 eb 09             	shr    $0x9,%ebx
+  end = (off + n + BSIZE - 1) / BSIZE;
+80102fd6:	c1 ef 09             	shr    $0x9,%edi
+  for(bn = off/BSIZE; bn < end; bn++)
+80102fd9:	39 fb                	cmp    %edi,%ebx
+80102fdb:	73 21                	jae    80102ffe <ireadahead+0x5e>
+80102fdd:	8d 76 00             	lea    0x0(%esi),%esi
+    breadahead(ip->dev, bmap(ip, bn));
+80102fe0:	89 da                	mov    %ebx,%edx
+80102fe2:	89 f0                	mov    %esi,%eax
+  for(bn = off/BSIZE; bn < end; bn++)
+80102fe4:	83 c3 01             	add    $0x1,%ebx
+    breadahead(ip->dev, bmap(ip, bn));
+80102fe7:	e8 c4 f8 ff ff       	call   801028b0 <bmap>
+80102fec:	83 ec 08             	sub    $0x8,%esp
+80102fef:	50                   	push   %eax
+80102ff0:	ff 36                	push   (%esi)
+80102ff2:	e8 99 de ff ff       	call   80100e90 <breadahead>
+  for(bn = off/BSIZE; bn < end; bn++)
+80102ff7:	83 c4 10             	add    $0x10,%esp
+80102ffa:	39 df                	cmp    %ebx,%edi
+80102ffc:	75 e2                	jne    80102fe0 <ireadahead+0x40>
+}
+80102ffe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103001:	5b                   	pop    %ebx
+80103002:	5e                   	pop    %esi
+80103003:	5f                   	pop    %edi
+80103004:	5d                   	pop    %ebp
+80103005:	c3                   	ret
+80103006:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010300d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80103010 <readi>:
+//PAGEBREAK!
+// Read data from inode.
+// Caller must hold ip->lock.
+int
+readi(struct inode *ip, char *dst, uint off, uint n)
+{
+80103010:	55                   	push   %ebp
+80103011:	89 e5                	mov    %esp,%ebp
+80103013:	57                   	push   %edi
+80103014:	56                   	push   %esi
+80103015:	53                   	push   %ebx
+80103016:	83 ec 1c             	sub    $0x1c,%esp
+80103019:	8b 75 08             	mov    0x8(%ebp),%esi
+8010301c:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010301f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  uint tot, m;
+  struct buf *bp;
+
+  if(ip->type == T_DEV){
+80103022:	66 83 be 8c 00 00 00 	cmpw   $0x3,0x8c(%esi)
+80103029:	03 
+{
+8010302a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+8010302d:	89 75 d8             	mov    %esi,-0x28(%ebp)
+80103030:	8b 45 14             	mov    0x14(%ebp),%eax
+  if(ip->type == T_DEV){
+80103033:	0f 84 af 00 00 00    	je     801030e8 <readi+0xd8>
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
+      return -1;
+    return devsw[ip->major].read(ip, dst, n);
+  }
+
+  if(off > ip->size || off + n < off)
+80103039:	8b 75 d8             	mov    -0x28(%ebp),%esi
+8010303c:	8b 96 94 00 00 00    	mov    0x94(%esi),%edx
+80103042:	39 fa                	cmp    %edi,%edx
+80103044:	0f 82 c2 00 00 00    	jb     8010310c <readi+0xfc>
+8010304a:	89 f9                	mov    %edi,%ecx
+8010304c:	31 db                	xor    %ebx,%ebx
+8010304e:	01 c1                	add    %eax,%ecx
+80103050:	0f 92 c3             	setb   %bl
+80103053:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+80103056:	0f 82 b0 00 00 00    	jb     8010310c <readi+0xfc>
+    return -1;
+  if(off + n > ip->size)
+    n = ip->size - off;
+8010305c:	89 d3                	mov    %edx,%ebx
+8010305e:	29 fb                	sub    %edi,%ebx
+80103060:	39 ca                	cmp    %ecx,%edx
+80103062:	0f 42 c3             	cmovb  %ebx,%eax
+
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+80103065:	85 c0                	test   %eax,%eax
+80103067:	74 70                	je     801030d9 <readi+0xc9>
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    m = min(n - tot, BSIZE - off%BSIZE);
+80103069:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+8010306c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010306f:	90                   	nop
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80103070:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+80103073:	89 fa                	mov    %edi,%edx
+80103075:	c1 ea 09             	shr    $0x9,%edx
+80103078:	89 d8                	mov    %ebx,%eax
+8010307a:	e8 31 f8 ff ff       	call   801028b0 <bmap>
+8010307f:	83 ec 08             	sub    $0x8,%esp
+80103082:	50                   	push   %eax
+80103083:	ff 33                	push   (%ebx)
+80103085:	e8 a6 dd ff ff       	call   80100e30 <bread>
+    m = min(n - tot, BSIZE - off%BSIZE);
+8010308a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+8010308d:	b9 00 02 00 00       	mov    $0x200,%ecx
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80103092:	89 c2                	mov    %eax,%edx
+    m = min(n - tot, BSIZE - off%BSIZE);
+80103094:	89 f8                	mov    %edi,%eax
+80103096:	25 ff 01 00 00       	and    $0x1ff,%eax
+8010309b:	29 f3                	sub    %esi,%ebx
+8010309d:	29 c1                	sub    %eax,%ecx
+    memmove(dst, bp->data + off%BSIZE, m);
+8010309f:	8d 84 02 a8 00 00 00 	lea    0xa8(%edx,%eax,1),%eax
+    m = min(n - tot, BSIZE - off%BSIZE);
+801030a6:	39 d9                	cmp    %ebx,%ecx
+801030a8:	0f 46 d9             	cmovbe %ecx,%ebx
+    memmove(dst, bp->data + off%BSIZE, m);
+801030ab:	83 c4 0c             	add    $0xc,%esp
+801030ae:	53                   	push   %ebx
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+801030af:	01 de                	add    %ebx,%esi
+801030b1:	01 df                	add    %ebx,%edi
+    memmove(dst, bp->data + off%BSIZE, m);
+801030b3:	89 55 dc             	mov    %edx,-0x24(%ebp)
+801030b6:	50                   	push   %eax
+801030b7:	ff 75 e0             	push   -0x20(%ebp)
+801030ba:	e8 91 43 00 00       	call   80107450 <memmove>
+    brelse(bp);
+801030bf:	8b 55 dc             	mov    -0x24(%ebp),%edx
+801030c2:	89 14 24             	mov    %edx,(%esp)
+801030c5:	e8 76 df ff ff       	call   80101040 <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+801030ca:	01 5d e0             	add    %ebx,-0x20(%ebp)
+801030cd:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+801030d0:	83 c4 10             	add    $0x10,%esp
+801030d3:	39 de                	cmp    %ebx,%esi
+801030d5:	72 99                	jb     80103070 <readi+0x60>
+801030d7:	89 d8                	mov    %ebx,%eax
+  }
+  return n;
+}
+801030d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801030dc:	5b                   	pop    %ebx
+801030dd:	5e                   	pop    %esi
+801030de:	5f                   	pop    %edi
+801030df:	5d                   	pop    %ebp
+801030e0:	c3                   	ret
+801030e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
+801030e8:	0f bf 96 8e 00 00 00 	movswl 0x8e(%esi),%edx
+801030ef:	66 83 fa 09          	cmp    $0x9,%dx
+801030f3:	77 17                	ja     8010310c <readi+0xfc>
+801030f5:	8b 14 d5 00 11 1a 80 	mov    -0x7fe5ef00(,%edx,8),%edx
+801030fc:	85 d2                	test   %edx,%edx
+801030fe:	74 0c                	je     8010310c <readi+0xfc>
+    return devsw[ip->major].read(ip, dst, n);
+80103100:	89 45 10             	mov    %eax,0x10(%ebp)
+}
+80103103:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103106:	5b                   	pop    %ebx
+80103107:	5e                   	pop    %esi
+80103108:	5f                   	pop    %edi
+80103109:	5d                   	pop    %ebp
+    return devsw[ip->major].read(ip, dst, n);
+8010310a:	ff e2                	jmp    *%edx
+      return -1;
+8010310c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103111:	eb c6                	jmp    801030d9 <readi+0xc9>
+80103113:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010311a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80103120 <writei>:
+// PAGEBREAK!
+// Write data to inode.
+// Caller must hold ip->lock.
+int
+writei(struct inode *ip, char *src, uint off, uint n)
+{
+80103120:	55                   	push   %ebp
+80103121:	89 e5                	mov    %esp,%ebp
+80103123:	57                   	push   %edi
+80103124:	56                   	push   %esi
+80103125:	53                   	push   %ebx
+80103126:	83 ec 1c             	sub    $0x1c,%esp
+80103129:	8b 45 08             	mov    0x8(%ebp),%eax
+8010312c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+8010312f:	8b 75 14             	mov    0x14(%ebp),%esi
+  uint tot, m;
+  struct buf *bp;
+
+  if(ip->type == T_DEV){
+80103132:	66 83 b8 8c 00 00 00 	cmpw   $0x3,0x8c(%eax)
+80103139:	03 
+{
+8010313a:	89 7d dc             	mov    %edi,-0x24(%ebp)
+8010313d:	89 75 e0             	mov    %esi,-0x20(%ebp)
+80103140:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(ip->type == T_DEV){
+80103143:	0f 84 d7 00 00 00    	je     80103220 <writei+0x100>
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
+      return -1;
+    return devsw[ip->major].write(ip, src, n);
+  }
+
+  if(off > ip->size || off + n < off)
+80103149:	39 b8 94 00 00 00    	cmp    %edi,0x94(%eax)
+8010314f:	0f 82 07 01 00 00    	jb     8010325c <writei+0x13c>
+80103155:	8b 75 e0             	mov    -0x20(%ebp),%esi
+80103158:	31 c9                	xor    %ecx,%ecx
+8010315a:	89 f2                	mov    %esi,%edx
+8010315c:	01 fa                	add    %edi,%edx
+8010315e:	0f 92 c1             	setb   %cl
+    return -1;
+  if(off + n > MAXFILE*BSIZE)
+80103161:	81 fa 00 18 01 00    	cmp    $0x11800,%edx
+80103167:	0f 87 ef 00 00 00    	ja     8010325c <writei+0x13c>
+8010316d:	85 c9                	test   %ecx,%ecx
+8010316f:	0f 85 e7 00 00 00    	jne    8010325c <writei+0x13c>
+    return -1;
+
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+80103175:	85 f6                	test   %esi,%esi
+80103177:	0f 84 8e 00 00 00    	je     8010320b <writei+0xeb>
+8010317d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    m = min(n - tot, BSIZE - off%BSIZE);
+80103184:	89 45 d8             	mov    %eax,-0x28(%ebp)
+80103187:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010318e:	66 90                	xchg   %ax,%ax
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80103190:	8b 75 d8             	mov    -0x28(%ebp),%esi
+80103193:	89 fa                	mov    %edi,%edx
+80103195:	c1 ea 09             	shr    $0x9,%edx
+80103198:	89 f0                	mov    %esi,%eax
+8010319a:	e8 11 f7 ff ff       	call   801028b0 <bmap>
+8010319f:	83 ec 08             	sub    $0x8,%esp
+801031a2:	50                   	push   %eax
+801031a3:	ff 36                	push   (%esi)
+801031a5:	e8 86 dc ff ff       	call   80100e30 <bread>
+    m = min(n - tot, BSIZE - off%BSIZE);
+801031aa:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801031ad:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+801031b0:	b9 00 02 00 00       	mov    $0x200,%ecx
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+801031b5:	89 c6                	mov    %eax,%esi
+    m = min(n - tot, BSIZE - off%BSIZE);
+801031b7:	89 f8                	mov    %edi,%eax
+801031b9:	25 ff 01 00 00       	and    $0x1ff,%eax
+801031be:	29 d3                	sub    %edx,%ebx
+801031c0:	29 c1                	sub    %eax,%ecx
+    memmove(bp->data + off%BSIZE, src, m);
+801031c2:	8d 84 06 a8 00 00 00 	lea    0xa8(%esi,%eax,1),%eax
+    m = min(n - tot, BSIZE - off%BSIZE);
+801031c9:	39 d9                	cmp    %ebx,%ecx
+801031cb:	0f 46 d9             	cmovbe %ecx,%ebx
+    memmove(bp->data + off%BSIZE, src, m);
+801031ce:	83 c4 0c             	add    $0xc,%esp
+801031d1:	53                   	push   %ebx
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+801031d2:	01 df                	add    %ebx,%edi
+    memmove(bp->data + off%BSIZE, src, m);
+801031d4:	ff 75 dc             	push   -0x24(%ebp)
+801031d7:	50                   	push   %eax
+801031d8:	e8 73 42 00 00       	call   80107450 <memmove>
+    log_write(bp);
+801031dd:	89 34 24             	mov    %esi,(%esp)
+801031e0:	e8 1b 14 00 00       	call   80104600 <log_write>
+    brelse(bp);
+801031e5:	89 34 24             	mov    %esi,(%esp)
+801031e8:	e8 53 de ff ff       	call   80101040 <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+801031ed:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+801031f0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801031f3:	83 c4 10             	add    $0x10,%esp
+801031f6:	01 5d dc             	add    %ebx,-0x24(%ebp)
+801031f9:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+801031fc:	39 d8                	cmp    %ebx,%eax
+801031fe:	72 90                	jb     80103190 <writei+0x70>
+  }
+
+  if(n > 0 && off > ip->size){
+80103200:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80103203:	39 b8 94 00 00 00    	cmp    %edi,0x94(%eax)
+80103209:	72 3d                	jb     80103248 <writei+0x128>
+    ip->size = off;
+    iupdate(ip);
+  }
+  return n;
+8010320b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+8010320e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103211:	5b                   	pop    %ebx
+80103212:	5e                   	pop    %esi
+80103213:	5f                   	pop    %edi
+80103214:	5d                   	pop    %ebp
+80103215:	c3                   	ret
+80103216:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010321d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
+80103220:	0f bf 80 8e 00 00 00 	movswl 0x8e(%eax),%eax
+80103227:	66 83 f8 09          	cmp    $0x9,%ax
+8010322b:	77 2f                	ja     8010325c <writei+0x13c>
+8010322d:	8b 04 c5 04 11 1a 80 	mov    -0x7fe5eefc(,%eax,8),%eax
+80103234:	85 c0                	test   %eax,%eax
+80103236:	74 24                	je     8010325c <writei+0x13c>
+    return devsw[ip->major].write(ip, src, n);
+80103238:	89 75 10             	mov    %esi,0x10(%ebp)
+}
+8010323b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010323e:	5b                   	pop    %ebx
+8010323f:	5e                   	pop    %esi
+80103240:	5f                   	pop    %edi
+80103241:	5d                   	pop    %ebp
+    return devsw[ip->major].write(ip, src, n);
+80103242:	ff e0                	jmp    *%eax
+80103244:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iupdate(ip);
+80103248:	83 ec 0c             	sub    $0xc,%esp
+    ip->size = off;
+8010324b:	89 b8 94 00 00 00    	mov    %edi,0x94(%eax)
+    iupdate(ip);
+80103251:	50                   	push   %eax
+80103252:	e8 d9 f8 ff ff       	call   80102b30 <iupdate>
+80103257:	83 c4 10             	add    $0x10,%esp
+8010325a:	eb af                	jmp    8010320b <writei+0xeb>
+      return -1;
+8010325c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103261:	eb ab                	jmp    8010320e <writei+0xee>
+80103263:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010326a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80103270 <namecmp>:
+//PAGEBREAK!
+// Directories
+
+int
+namecmp(const char *s, const char *t)
+{
+80103270:	55                   	push   %ebp
+80103271:	89 e5                	mov    %esp,%ebp
+80103273:	83 ec 0c             	sub    $0xc,%esp
+  return strncmp(s, t, DIRSIZ);
+80103276:	6a 0e                	push   $0xe
+80103278:	ff 75 0c             	push   0xc(%ebp)
+8010327b:	ff 75 08             	push   0x8(%ebp)
+8010327e:	e8 3d 42 00 00       	call   801074c0 <strncmp>
+}
+80103283:	c9                   	leave
+80103284:	c3                   	ret
+80103285:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010328c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80103290 <dirlookup>:
+
+// Look for a directory entry in a directory.
+// If found, set *poff to byte offset of entry.
+struct inode*
+dirlookup(struct inode *dp, char *name, uint *poff)
+{
+80103290:	55                   	push   %ebp
+80103291:	89 e5                	mov    %esp,%ebp
+80103293:	57                   	push   %edi
+80103294:	56                   	push   %esi
+80103295:	53                   	push   %ebx
+80103296:	83 ec 1c             	sub    $0x1c,%esp
+80103299:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint off, inum;
+  struct dirent de;
+
+  if(dp->type != T_DIR)
+8010329c:	66 83 bb 8c 00 00 00 	cmpw   $0x1,0x8c(%ebx)
+801032a3:	01 
+801032a4:	0f 85 92 00 00 00    	jne    8010333c <dirlookup+0xac>
+    panic("dirlookup not DIR");
+
+  for(off = 0; off < dp->size; off += sizeof(de)){
+801032aa:	8b 93 94 00 00 00    	mov    0x94(%ebx),%edx
+801032b0:	31 ff                	xor    %edi,%edi
+801032b2:	8d 75 d8             	lea    -0x28(%ebp),%esi
+801032b5:	85 d2                	test   %edx,%edx
+801032b7:	74 43                	je     801032fc <dirlookup+0x6c>
+801032b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+801032c0:	6a 10                	push   $0x10
+801032c2:	57                   	push   %edi
+801032c3:	56                   	push   %esi
+801032c4:	53                   	push   %ebx
+801032c5:	e8 46 fd ff ff       	call   80103010 <readi>
+801032ca:	83 c4 10             	add    $0x10,%esp
+801032cd:	83 f8 10             	cmp    $0x10,%eax
+801032d0:	75 5d                	jne    8010332f <dirlookup+0x9f>
+      panic("dirlookup read");
+    if(de.inum == 0)
+801032d2:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+801032d7:	74 18                	je     801032f1 <dirlookup+0x61>
+  return strncmp(s, t, DIRSIZ);
+801032d9:	83 ec 04             	sub    $0x4,%esp
+801032dc:	8d 45 da             	lea    -0x26(%ebp),%eax
+801032df:	6a 0e                	push   $0xe
+801032e1:	50                   	push   %eax
+801032e2:	ff 75 0c             	push   0xc(%ebp)
+801032e5:	e8 d6 41 00 00       	call   801074c0 <strncmp>
+      continue;
+    if(namecmp(name, de.name) == 0){
+801032ea:	83 c4 10             	add    $0x10,%esp
+801032ed:	85 c0                	test   %eax,%eax
+801032ef:	74 1f                	je     80103310 <dirlookup+0x80>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+801032f1:	83 c7 10             	add    $0x10,%edi
+801032f4:	3b bb 94 00 00 00    	cmp    0x94(%ebx),%edi
+801032fa:	72 c4                	jb     801032c0 <dirlookup+0x30>
+      return iget(dp->dev, inum);
+    }
+  }
+
+  return 0;
+}
+801032fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+801032ff:	31 c0                	xor    %eax,%eax
+}
+80103301:	5b                   	pop    %ebx
+80103302:	5e                   	pop    %esi
+80103303:	5f                   	pop    %edi
+80103304:	5d                   	pop    %ebp
+80103305:	c3                   	ret
+80103306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010330d:	8d 76 00             	lea    0x0(%esi),%esi
+      if(poff)
+80103310:	8b 45 10             	mov    0x10(%ebp),%eax
+80103313:	85 c0                	test   %eax,%eax
+80103315:	74 05                	je     8010331c <dirlookup+0x8c>
+        *poff = off;
+80103317:	8b 45 10             	mov    0x10(%ebp),%eax
+8010331a:	89 38                	mov    %edi,(%eax)
+      inum = de.inum;
+8010331c:	0f b7 55 d8          	movzwl -0x28(%ebp),%edx
+      return iget(dp->dev, inum);
+80103320:	8b 03                	mov    (%ebx),%eax
+80103322:	e8 09 f4 ff ff       	call   80102730 <iget>
+}
+80103327:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010332a:	5b                   	pop    %ebx
+8010332b:	5e                   	pop    %esi
+8010332c:	5f                   	pop    %edi
+8010332d:	5d                   	pop    %ebp
+8010332e:	c3                   	ret
+      panic("dirlookup read");
+8010332f:	83 ec 0c             	sub    $0xc,%esp
+80103332:	68 ca b7 10 80       	push   $0x8010b7ca
+80103337:	e8 84 e1 ff ff       	call   801014c0 <panic>
+    panic("dirlookup not DIR");
+8010333c:	83 ec 0c             	sub    $0xc,%esp
+8010333f:	68 b8 b7 10 80       	push   $0x8010b7b8
+80103344:	e8 77 e1 ff ff       	call   801014c0 <panic>
+80103349:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80103350 <namex>:
+// If parent != 0, return the inode for the parent and copy the final
+// path element into name, which must have room for DIRSIZ bytes.
+// Must be called inside a transaction since it calls iput().
+static struct inode*
+namex(char *path, int nameiparent, char *name)
+{
+80103350:	55                   	push   %ebp
+80103351:	89 e5                	mov    %esp,%ebp
+80103353:	57                   	push   %edi
+80103354:	56                   	push   %esi
+80103355:	53                   	push   %ebx
+80103356:	89 c3                	mov    %eax,%ebx
+80103358:	83 ec 1c             	sub    $0x1c,%esp
+  struct inode *ip, *next;
+
+  if(*path == '/')
+8010335b:	80 38 2f             	cmpb   $0x2f,(%eax)
+{
+8010335e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+80103361:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  if(*path == '/')
+80103364:	0f 84 fb 01 00 00    	je     80103565 <namex+0x215>
+    ip = iget(ROOTDEV, ROOTINO);
+  else
+    ip = idup(myproc()->cwd);
+8010336a:	e8 81 22 00 00       	call   801055f0 <myproc>
+  acquire(&icache.lock);
+8010336f:	83 ec 0c             	sub    $0xc,%esp
+80103372:	89 df                	mov    %ebx,%edi
+    ip = idup(myproc()->cwd);
+80103374:	8b 70 70             	mov    0x70(%eax),%esi
+  acquire(&icache.lock);
+80103377:	68 60 11 1a 80       	push   $0x801a1160
+8010337c:	e8 ef 3c 00 00       	call   80107070 <acquire>
+  ip->ref++;
+80103381:	83 46 08 01          	addl   $0x1,0x8(%esi)
+  release(&icache.lock);
+80103385:	c7 04 24 60 11 1a 80 	movl   $0x801a1160,(%esp)
+8010338c:	e8 6f 3b 00 00       	call   80106f00 <release>
+80103391:	83 c4 10             	add    $0x10,%esp
+80103394:	eb 0d                	jmp    801033a3 <namex+0x53>
+80103396:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010339d:	8d 76 00             	lea    0x0(%esi),%esi
+    path++;
+801033a0:	83 c7 01             	add    $0x1,%edi
+  while(*path == '/')
+801033a3:	0f b6 07             	movzbl (%edi),%eax
+801033a6:	3c 2f                	cmp    $0x2f,%al
+801033a8:	74 f6                	je     801033a0 <namex+0x50>
+  if(*path == 0)
+801033aa:	84 c0                	test   %al,%al
+801033ac:	0f 84 96 01 00 00    	je     80103548 <namex+0x1f8>
+  while(*path != '/' && *path != 0)
+801033b2:	0f b6 07             	movzbl (%edi),%eax
+801033b5:	84 c0                	test   %al,%al
+801033b7:	0f 84 9c 01 00 00    	je     80103559 <namex+0x209>
+801033bd:	89 fb                	mov    %edi,%ebx
+801033bf:	3c 2f                	cmp    $0x2f,%al
+801033c1:	0f 84 92 01 00 00    	je     80103559 <namex+0x209>
+801033c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801033ce:	66 90                	xchg   %ax,%ax
+801033d0:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+    path++;
+801033d4:	83 c3 01             	add    $0x1,%ebx
+  while(*path != '/' && *path != 0)
+801033d7:	3c 2f                	cmp    $0x2f,%al
+801033d9:	74 04                	je     801033df <namex+0x8f>
+801033db:	84 c0                	test   %al,%al
+801033dd:	75 f1                	jne    801033d0 <namex+0x80>
+  len = path - s;
+801033df:	89 d8                	mov    %ebx,%eax
+801033e1:	29 f8                	sub    %edi,%eax
+  if(len >= DIRSIZ)
+801033e3:	83 f8 0d             	cmp    $0xd,%eax
+801033e6:	0f 8e cc 00 00 00    	jle    801034b8 <namex+0x168>
+    memmove(name, s, DIRSIZ);
+801033ec:	83 ec 04             	sub    $0x4,%esp
+801033ef:	6a 0e                	push   $0xe
+801033f1:	57                   	push   %edi
+    path++;
+801033f2:	89 df                	mov    %ebx,%edi
+    memmove(name, s, DIRSIZ);
+801033f4:	ff 75 e4             	push   -0x1c(%ebp)
+801033f7:	e8 54 40 00 00       	call   80107450 <memmove>
+801033fc:	83 c4 10             	add    $0x10,%esp
+  while(*path == '/')
+801033ff:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+80103402:	75 0c                	jne    80103410 <namex+0xc0>
+80103404:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    path++;
+80103408:	83 c7 01             	add    $0x1,%edi
+  while(*path == '/')
+8010340b:	80 3f 2f             	cmpb   $0x2f,(%edi)
+8010340e:	74 f8                	je     80103408 <namex+0xb8>
+  if(ip == 0 || ip->ref < 1)
+80103410:	85 f6                	test   %esi,%esi
+80103412:	0f 84 b4 01 00 00    	je     801035cc <namex+0x27c>
+80103418:	8b 46 08             	mov    0x8(%esi),%eax
+8010341b:	85 c0                	test   %eax,%eax
+8010341d:	0f 8e a9 01 00 00    	jle    801035cc <namex+0x27c>
+  acquiresleepshared(&ip->lock);
+80103423:	83 ec 0c             	sub    $0xc,%esp
+80103426:	8d 5e 0c             	lea    0xc(%esi),%ebx
+80103429:	53                   	push   %ebx
+8010342a:	e8 81 32 00 00       	call   801066b0 <acquiresleepshared>
+  if(ip->valid == 0){
+8010342f:	8b 86 88 00 00 00    	mov    0x88(%esi),%eax
+80103435:	83 c4 10             	add    $0x10,%esp
+80103438:	85 c0                	test   %eax,%eax
+8010343a:	0f 84 a0 00 00 00    	je     801034e0 <namex+0x190>
+
+  while((path = skipelem(path, name)) != 0){
+    ilockshared(ip);
+    if(ip->type != T_DIR){
+80103440:	66 83 be 8c 00 00 00 	cmpw   $0x1,0x8c(%esi)
+80103447:	01 
+80103448:	0f 85 b4 00 00 00    	jne    80103502 <namex+0x1b2>
+      iunlockput(ip);
+      return 0;
+    }
+    if(nameiparent && *path == '\0'){
+8010344e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80103451:	85 c0                	test   %eax,%eax
+80103453:	74 09                	je     8010345e <namex+0x10e>
+80103455:	80 3f 00             	cmpb   $0x0,(%edi)
+80103458:	0f 84 1f 01 00 00    	je     8010357d <namex+0x22d>
+      // Stop one level early.
+      iunlock(ip);
+      return ip;
+    }
+    if((next = dirlookup(ip, name, 0)) == 0){
+8010345e:	83 ec 04             	sub    $0x4,%esp
+80103461:	6a 00                	push   $0x0
+80103463:	ff 75 e4             	push   -0x1c(%ebp)
+80103466:	56                   	push   %esi
+80103467:	e8 24 fe ff ff       	call   80103290 <dirlookup>
+8010346c:	83 c4 10             	add    $0x10,%esp
+8010346f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80103472:	85 c0                	test   %eax,%eax
+80103474:	0f 84 88 00 00 00    	je     80103502 <namex+0x1b2>
+  if(ip == 0 || !lockedsleep(&ip->lock) || ip->ref < 1)
+8010347a:	83 ec 0c             	sub    $0xc,%esp
+8010347d:	53                   	push   %ebx
+8010347e:	e8 7d 34 00 00       	call   80106900 <lockedsleep>
+80103483:	83 c4 10             	add    $0x10,%esp
+80103486:	85 c0                	test   %eax,%eax
+80103488:	0f 84 31 01 00 00    	je     801035bf <namex+0x26f>
+8010348e:	8b 56 08             	mov    0x8(%esi),%edx
+80103491:	85 d2                	test   %edx,%edx
+80103493:	0f 8e 26 01 00 00    	jle    801035bf <namex+0x26f>
+  releasesleep(&ip->lock);
+80103499:	83 ec 0c             	sub    $0xc,%esp
+8010349c:	53                   	push   %ebx
+8010349d:	e8 ee 32 00 00       	call   80106790 <releasesleep>
+  iput(ip);
+801034a2:	89 34 24             	mov    %esi,(%esp)
+801034a5:	e8 e6 f8 ff ff       	call   80102d90 <iput>
+801034aa:	8b 75 e0             	mov    -0x20(%ebp),%esi
+801034ad:	83 c4 10             	add    $0x10,%esp
+  while(*path == '/')
+801034b0:	e9 ee fe ff ff       	jmp    801033a3 <namex+0x53>
+801034b5:	8d 76 00             	lea    0x0(%esi),%esi
+    name[len] = 0;
+801034b8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+801034bb:	8d 14 01             	lea    (%ecx,%eax,1),%edx
+    memmove(name, s, len);
+801034be:	83 ec 04             	sub    $0x4,%esp
+801034c1:	89 55 e0             	mov    %edx,-0x20(%ebp)
+801034c4:	50                   	push   %eax
+801034c5:	57                   	push   %edi
+    name[len] = 0;
+801034c6:	89 df                	mov    %ebx,%edi
+    memmove(name, s, len);
+801034c8:	ff 75 e4             	push   -0x1c(%ebp)
+801034cb:	e8 80 3f 00 00       	call   80107450 <memmove>
+    name[len] = 0;
+801034d0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+801034d3:	83 c4 10             	add    $0x10,%esp
+801034d6:	c6 02 00             	movb   $0x0,(%edx)
+801034d9:	e9 21 ff ff ff       	jmp    801033ff <namex+0xaf>
+801034de:	66 90                	xchg   %ax,%ax
+    releasesleep(&ip->lock);
+801034e0:	83 ec 0c             	sub    $0xc,%esp
+801034e3:	53                   	push   %ebx
+801034e4:	e8 a7 32 00 00       	call   80106790 <releasesleep>
+    ilock(ip);
+801034e9:	89 34 24             	mov    %esi,(%esp)
+801034ec:	e8 ff f6 ff ff       	call   80102bf0 <ilock>
+801034f1:	83 c4 10             	add    $0x10,%esp
+    if(ip->type != T_DIR){
+801034f4:	66 83 be 8c 00 00 00 	cmpw   $0x1,0x8c(%esi)
+801034fb:	01 
+801034fc:	0f 84 4c ff ff ff    	je     8010344e <namex+0xfe>
+  if(ip == 0 || !lockedsleep(&ip->lock) || ip->ref < 1)
+80103502:	83 ec 0c             	sub    $0xc,%esp
+80103505:	53                   	push   %ebx
+80103506:	e8 f5 33 00 00       	call   80106900 <lockedsleep>
+8010350b:	83 c4 10             	add    $0x10,%esp
+8010350e:	85 c0                	test   %eax,%eax
+80103510:	0f 84 a9 00 00 00    	je     801035bf <namex+0x26f>
+80103516:	8b 4e 08             	mov    0x8(%esi),%ecx
+80103519:	85 c9                	test   %ecx,%ecx
+8010351b:	0f 8e 9e 00 00 00    	jle    801035bf <namex+0x26f>
+  releasesleep(&ip->lock);
+80103521:	83 ec 0c             	sub    $0xc,%esp
+80103524:	53                   	push   %ebx
+80103525:	e8 66 32 00 00       	call   80106790 <releasesleep>
+  iput(ip);
+8010352a:	89 34 24             	mov    %esi,(%esp)
+      return 0;
+8010352d:	31 f6                	xor    %esi,%esi
+  iput(ip);
+8010352f:	e8 5c f8 ff ff       	call   80102d90 <iput>
+      iunlockput(ip);
+      return 0;
+80103534:	83 c4 10             	add    $0x10,%esp
+  if(nameiparent){
+    iput(ip);
+    return 0;
+  }
+  return ip;
+}
+80103537:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010353a:	89 f0                	mov    %esi,%eax
+8010353c:	5b                   	pop    %ebx
+8010353d:	5e                   	pop    %esi
+8010353e:	5f                   	pop    %edi
+8010353f:	5d                   	pop    %ebp
+80103540:	c3                   	ret
+80103541:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(nameiparent){
+80103548:	8b 45 dc             	mov    -0x24(%ebp),%eax
+8010354b:	85 c0                	test   %eax,%eax
+8010354d:	75 5d                	jne    801035ac <namex+0x25c>
+}
+8010354f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103552:	89 f0                	mov    %esi,%eax
+80103554:	5b                   	pop    %ebx
+80103555:	5e                   	pop    %esi
+80103556:	5f                   	pop    %edi
+80103557:	5d                   	pop    %ebp
+80103558:	c3                   	ret
+  while(*path != '/' && *path != 0)
+80103559:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010355c:	89 fb                	mov    %edi,%ebx
+8010355e:	31 c0                	xor    %eax,%eax
+80103560:	e9 59 ff ff ff       	jmp    801034be <namex+0x16e>
+    ip = iget(ROOTDEV, ROOTINO);
+80103565:	ba 01 00 00 00       	mov    $0x1,%edx
+8010356a:	b8 01 00 00 00       	mov    $0x1,%eax
+8010356f:	89 df                	mov    %ebx,%edi
+80103571:	e8 ba f1 ff ff       	call   80102730 <iget>
+80103576:	89 c6                	mov    %eax,%esi
+80103578:	e9 26 fe ff ff       	jmp    801033a3 <namex+0x53>
+  if(ip == 0 || !lockedsleep(&ip->lock) || ip->ref < 1)
+8010357d:	83 ec 0c             	sub    $0xc,%esp
+80103580:	89 df                	mov    %ebx,%edi
+80103582:	53                   	push   %ebx
+80103583:	e8 78 33 00 00       	call   80106900 <lockedsleep>
+80103588:	83 c4 10             	add    $0x10,%esp
+8010358b:	85 c0                	test   %eax,%eax
+8010358d:	74 30                	je     801035bf <namex+0x26f>
+8010358f:	8b 5e 08             	mov    0x8(%esi),%ebx
+80103592:	85 db                	test   %ebx,%ebx
+80103594:	7e 29                	jle    801035bf <namex+0x26f>
+  releasesleep(&ip->lock);
+80103596:	83 ec 0c             	sub    $0xc,%esp
+80103599:	57                   	push   %edi
+8010359a:	e8 f1 31 00 00       	call   80106790 <releasesleep>
+}
+8010359f:	83 c4 10             	add    $0x10,%esp
+}
+801035a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801035a5:	89 f0                	mov    %esi,%eax
+801035a7:	5b                   	pop    %ebx
+801035a8:	5e                   	pop    %esi
+801035a9:	5f                   	pop    %edi
+801035aa:	5d                   	pop    %ebp
+801035ab:	c3                   	ret
+    iput(ip);
+801035ac:	83 ec 0c             	sub    $0xc,%esp
+801035af:	56                   	push   %esi
+      return 0;
+801035b0:	31 f6                	xor    %esi,%esi
+    iput(ip);
+801035b2:	e8 d9 f7 ff ff       	call   80102d90 <iput>
+    return 0;
+801035b7:	83 c4 10             	add    $0x10,%esp
+801035ba:	e9 78 ff ff ff       	jmp    80103537 <namex+0x1e7>
+    panic("iunlock");
+801035bf:	83 ec 0c             	sub    $0xc,%esp
+801035c2:	68 b0 b7 10 80       	push   $0x8010b7b0
+801035c7:	e8 f4 de ff ff       	call   801014c0 <panic>
+    panic("ilockshared");
+801035cc:	83 ec 0c             	sub    $0xc,%esp
+801035cf:	68 a4 b7 10 80       	push   $0x8010b7a4
+801035d4:	e8 e7 de ff ff       	call   801014c0 <panic>
+801035d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801035e0 <dirlink>:
+{
+801035e0:	55                   	push   %ebp
+801035e1:	89 e5                	mov    %esp,%ebp
+801035e3:	57                   	push   %edi
+801035e4:	56                   	push   %esi
+801035e5:	53                   	push   %ebx
+801035e6:	83 ec 20             	sub    $0x20,%esp
+801035e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((ip = dirlookup(dp, name, 0)) != 0){
+801035ec:	6a 00                	push   $0x0
+801035ee:	ff 75 0c             	push   0xc(%ebp)
+801035f1:	53                   	push   %ebx
+801035f2:	e8 99 fc ff ff       	call   80103290 <dirlookup>
+801035f7:	83 c4 10             	add    $0x10,%esp
+801035fa:	85 c0                	test   %eax,%eax
+801035fc:	75 72                	jne    80103670 <dirlink+0x90>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+801035fe:	8b bb 94 00 00 00    	mov    0x94(%ebx),%edi
+80103604:	8d 75 d8             	lea    -0x28(%ebp),%esi
+80103607:	85 ff                	test   %edi,%edi
+80103609:	74 31                	je     8010363c <dirlink+0x5c>
+8010360b:	31 ff                	xor    %edi,%edi
+8010360d:	8d 75 d8             	lea    -0x28(%ebp),%esi
+80103610:	eb 11                	jmp    80103623 <dirlink+0x43>
+80103612:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80103618:	83 c7 10             	add    $0x10,%edi
+8010361b:	3b bb 94 00 00 00    	cmp    0x94(%ebx),%edi
+80103621:	73 19                	jae    8010363c <dirlink+0x5c>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80103623:	6a 10                	push   $0x10
+80103625:	57                   	push   %edi
+80103626:	56                   	push   %esi
+80103627:	53                   	push   %ebx
+80103628:	e8 e3 f9 ff ff       	call   80103010 <readi>
+8010362d:	83 c4 10             	add    $0x10,%esp
+80103630:	83 f8 10             	cmp    $0x10,%eax
+80103633:	75 4e                	jne    80103683 <dirlink+0xa3>
+    if(de.inum == 0)
+80103635:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+8010363a:	75 dc                	jne    80103618 <dirlink+0x38>
+  strncpy(de.name, name, DIRSIZ);
+8010363c:	83 ec 04             	sub    $0x4,%esp
+8010363f:	8d 45 da             	lea    -0x26(%ebp),%eax
+80103642:	6a 0e                	push   $0xe
+80103644:	ff 75 0c             	push   0xc(%ebp)
+80103647:	50                   	push   %eax
+80103648:	e8 c3 3e 00 00       	call   80107510 <strncpy>
+  de.inum = inum;
+8010364d:	8b 45 10             	mov    0x10(%ebp),%eax
+80103650:	66 89 45 d8          	mov    %ax,-0x28(%ebp)
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80103654:	6a 10                	push   $0x10
+80103656:	57                   	push   %edi
+80103657:	56                   	push   %esi
+80103658:	53                   	push   %ebx
+80103659:	e8 c2 fa ff ff       	call   80103120 <writei>
+8010365e:	83 c4 20             	add    $0x20,%esp
+80103661:	83 f8 10             	cmp    $0x10,%eax
+80103664:	75 2a                	jne    80103690 <dirlink+0xb0>
+  return 0;
+80103666:	31 c0                	xor    %eax,%eax
+}
+80103668:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010366b:	5b                   	pop    %ebx
+8010366c:	5e                   	pop    %esi
+8010366d:	5f                   	pop    %edi
+8010366e:	5d                   	pop    %ebp
+8010366f:	c3                   	ret
+    iput(ip);
+80103670:	83 ec 0c             	sub    $0xc,%esp
+80103673:	50                   	push   %eax
+80103674:	e8 17 f7 ff ff       	call   80102d90 <iput>
+    return -1;
+80103679:	83 c4 10             	add    $0x10,%esp
+8010367c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80103681:	eb e5                	jmp    80103668 <dirlink+0x88>
+      panic("dirlink read");
+80103683:	83 ec 0c             	sub    $0xc,%esp
+80103686:	68 d9 b7 10 80       	push   $0x8010b7d9
+8010368b:	e8 30 de ff ff       	call   801014c0 <panic>
+    panic("dirlink");
+80103690:	83 ec 0c             	sub    $0xc,%esp
+80103693:	68 7a bd 10 80       	push   $0x8010bd7a
+80103698:	e8 23 de ff ff       	call   801014c0 <panic>
+8010369d:	8d 76 00             	lea    0x0(%esi),%esi
+
+801036a0 <namei>:
+
+struct inode*
+namei(char *path)
+{
+801036a0:	55                   	push   %ebp
+  char name[DIRSIZ];
+  return namex(path, 0, name);
+801036a1:	31 d2                	xor    %edx,%edx
+{
+801036a3:	89 e5                	mov    %esp,%ebp
+801036a5:	83 ec 18             	sub    $0x18,%esp
+  return namex(path, 0, name);
+801036a8:	8b 45 08             	mov    0x8(%ebp),%eax
+801036ab:	8d 4d ea             	lea    -0x16(%ebp),%ecx
+801036ae:	e8 9d fc ff ff       	call   80103350 <namex>
+}
+801036b3:	c9                   	leave
+801036b4:	c3                   	ret
+801036b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801036bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801036c0 <nameiparent>:
+
+struct inode*
+nameiparent(char *path, char *name)
+{
+801036c0:	55                   	push   %ebp
+  return namex(path, 1, name);
+801036c1:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+801036c6:	89 e5                	mov    %esp,%ebp
+  return namex(path, 1, name);
+801036c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+801036cb:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+801036ce:	5d                   	pop    %ebp
+  return namex(path, 1, name);
+801036cf:	e9 7c fc ff ff       	jmp    80103350 <namex>
+801036d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801036db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801036df:	90                   	nop
+
+801036e0 <swapread>:
+
+#define SWAPBASE	500
+#define SWAPMAX		(100000 - SWAPBASE)
+
+void swapread(char* ptr, int blkno)
+{
+801036e0:	55                   	push   %ebp
+801036e1:	89 e5                	mov    %esp,%ebp
+801036e3:	57                   	push   %edi
+801036e4:	56                   	push   %esi
+801036e5:	53                   	push   %ebx
+801036e6:	83 ec 1c             	sub    $0x1c,%esp
+801036e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct buf* bp;
+	int i;
+
+	if ( blkno < 0 || blkno >= SWAPMAX )
+801036ec:	3d ab 84 01 00       	cmp    $0x184ab,%eax
+801036f1:	77 5a                	ja     8010374d <swapread+0x6d>
+		panic("swapread: blkno exceed range");
+
+	for ( i=0; i < 8; ++i ) {
+		bp = bread(0, blkno + SWAPBASE + i);
+801036f3:	8d b8 f4 01 00 00    	lea    0x1f4(%eax),%edi
+801036f9:	05 fc 01 00 00       	add    $0x1fc,%eax
+801036fe:	8b 75 08             	mov    0x8(%ebp),%esi
+80103701:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80103704:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103708:	83 ec 08             	sub    $0x8,%esp
+8010370b:	57                   	push   %edi
+	for ( i=0; i < 8; ++i ) {
+8010370c:	83 c7 01             	add    $0x1,%edi
+		bp = bread(0, blkno + SWAPBASE + i);
+8010370f:	6a 00                	push   $0x0
+80103711:	e8 1a d7 ff ff       	call   80100e30 <bread>
+		memmove(ptr + i * BSIZE, bp->data, BSIZE);
+80103716:	83 c4 0c             	add    $0xc,%esp
+		bp = bread(0, blkno + SWAPBASE + i);
+80103719:	89 c3                	mov    %eax,%ebx
+		memmove(ptr + i * BSIZE, bp->data, BSIZE);
+8010371b:	8d 80 a8 00 00 00    	lea    0xa8(%eax),%eax
+80103721:	68 00 02 00 00       	push   $0x200
+80103726:	50                   	push   %eax
+80103727:	56                   	push   %esi
+	for ( i=0; i < 8; ++i ) {
+80103728:	81 c6 00 02 00 00    	add    $0x200,%esi
+		memmove(ptr + i * BSIZE, bp->data, BSIZE);
+8010372e:	e8 1d 3d 00 00       	call   80107450 <memmove>
+		brelse(bp);
+80103733:	89 1c 24             	mov    %ebx,(%esp)
+80103736:	e8 05 d9 ff ff       	call   80101040 <brelse>
+	for ( i=0; i < 8; ++i ) {
+8010373b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010373e:	83 c4 10             	add    $0x10,%esp
+80103741:	39 c7                	cmp    %eax,%edi
+80103743:	75 c3                	jne    80103708 <swapread+0x28>
+	}
+}
+80103745:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103748:	5b                   	pop    %ebx
+80103749:	5e                   	pop    %esi
+8010374a:	5f                   	pop    %edi
+8010374b:	5d                   	pop    %ebp
+8010374c:	c3                   	ret
+		panic("swapread: blkno exceed range");
+8010374d:	83 ec 0c             	sub    $0xc,%esp
+80103750:	68 e6 b7 10 80       	push   $0x8010b7e6
+80103755:	e8 66 dd ff ff       	call   801014c0 <panic>
+8010375a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80103760 <swapwrite>:
+
+void swapwrite(char* ptr, int blkno)
+{
+80103760:	55                   	push   %ebp
+80103761:	89 e5                	mov    %esp,%ebp
+80103763:	57                   	push   %edi
+80103764:	56                   	push   %esi
+80103765:	53                   	push   %ebx
+80103766:	83 ec 3c             	sub    $0x3c,%esp
+80103769:	8b 45 0c             	mov    0xc(%ebp),%eax
+	struct buf* bp[8];
+	int i;
+
+	if ( blkno < 0 || blkno >= SWAPMAX )
+8010376c:	3d ab 84 01 00       	cmp    $0x184ab,%eax
+80103771:	0f 87 86 00 00 00    	ja     801037fd <swapwrite+0x9d>
+80103777:	05 f4 01 00 00       	add    $0x1f4,%eax
+8010377c:	8b 75 08             	mov    0x8(%ebp),%esi
+		panic("swapread: blkno exceed range");
+
+	// Start all eight writes before waiting, so the disk
+	// driver can do them as one command.
+	for ( i=0; i < 8; ++i ) {
+8010377f:	31 ff                	xor    %edi,%edi
+80103781:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+80103784:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+		bp[i] = bread(0, blkno + SWAPBASE + i);
+80103788:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+8010378b:	83 ec 08             	sub    $0x8,%esp
+8010378e:	01 f8                	add    %edi,%eax
+80103790:	50                   	push   %eax
+80103791:	6a 00                	push   $0x0
+80103793:	e8 98 d6 ff ff       	call   80100e30 <bread>
+		memmove(bp[i]->data, ptr + i * BSIZE, BSIZE);
+80103798:	83 c4 0c             	add    $0xc,%esp
+		bp[i] = bread(0, blkno + SWAPBASE + i);
+8010379b:	89 44 bd c8          	mov    %eax,-0x38(%ebp,%edi,4)
+8010379f:	89 c3                	mov    %eax,%ebx
+		memmove(bp[i]->data, ptr + i * BSIZE, BSIZE);
+801037a1:	8d 80 a8 00 00 00    	lea    0xa8(%eax),%eax
+	for ( i=0; i < 8; ++i ) {
+801037a7:	83 c7 01             	add    $0x1,%edi
+		memmove(bp[i]->data, ptr + i * BSIZE, BSIZE);
+801037aa:	68 00 02 00 00       	push   $0x200
+801037af:	56                   	push   %esi
+	for ( i=0; i < 8; ++i ) {
+801037b0:	81 c6 00 02 00 00    	add    $0x200,%esi
+		memmove(bp[i]->data, ptr + i * BSIZE, BSIZE);
+801037b6:	50                   	push   %eax
+801037b7:	e8 94 3c 00 00       	call   80107450 <memmove>
+		bwrite_async(bp[i]);
+801037bc:	89 1c 24             	mov    %ebx,(%esp)
+801037bf:	e8 ac d7 ff ff       	call   80100f70 <bwrite_async>
+	for ( i=0; i < 8; ++i ) {
+801037c4:	83 c4 10             	add    $0x10,%esp
+801037c7:	83 ff 08             	cmp    $0x8,%edi
+801037ca:	75 bc                	jne    80103788 <swapwrite+0x28>
+801037cc:	8d 5d c8             	lea    -0x38(%ebp),%ebx
+801037cf:	8d 7d e8             	lea    -0x18(%ebp),%edi
+801037d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+	}
+	for ( i=0; i < 8; ++i ) {
+		bwait(bp[i]);
+801037d8:	8b 33                	mov    (%ebx),%esi
+801037da:	83 ec 0c             	sub    $0xc,%esp
+	for ( i=0; i < 8; ++i ) {
+801037dd:	83 c3 04             	add    $0x4,%ebx
+		bwait(bp[i]);
+801037e0:	56                   	push   %esi
+801037e1:	e8 7a d5 ff ff       	call   80100d60 <bwait>
+		brelse(bp[i]);
+801037e6:	89 34 24             	mov    %esi,(%esp)
+801037e9:	e8 52 d8 ff ff       	call   80101040 <brelse>
+	for ( i=0; i < 8; ++i ) {
+801037ee:	83 c4 10             	add    $0x10,%esp
+801037f1:	39 fb                	cmp    %edi,%ebx
+801037f3:	75 e3                	jne    801037d8 <swapwrite+0x78>
+	}
+}
+801037f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801037f8:	5b                   	pop    %ebx
+801037f9:	5e                   	pop    %esi
+801037fa:	5f                   	pop    %edi
+801037fb:	5d                   	pop    %ebp
+801037fc:	c3                   	ret
+		panic("swapread: blkno exceed range");
+801037fd:	83 ec 0c             	sub    $0xc,%esp
+80103800:	68 e6 b7 10 80       	push   $0x8010b7e6
+80103805:	e8 b6 dc ff ff       	call   801014c0 <panic>
+8010380a:	66 90                	xchg   %ax,%ax
+8010380c:	66 90                	xchg   %ax,%ax
+8010380e:	66 90                	xchg   %ax,%ax
+
+80103810 <ioapicinit>:
+  ioapic->data = data;
+}
+
+void
+ioapicinit(void)
+{
+80103810:	55                   	push   %ebp
+80103811:	89 e5                	mov    %esp,%ebp
+80103813:	56                   	push   %esi
+80103814:	53                   	push   %ebx
+  int i, id, maxintr;
+
+  ioapic = (volatile struct ioapic*)IOAPIC;
+80103815:	c7 05 b4 39 1a 80 00 	movl   $0xfec00000,0x801a39b4
+8010381c:	00 c0 fe 
+  ioapic->reg = reg;
+8010381f:	c7 05 00 00 c0 fe 01 	movl   $0x1,0xfec00000
+80103826:	00 00 00 
+  return ioapic->data;
+80103829:	8b 15 b4 39 1a 80    	mov    0x801a39b4,%edx
+8010382f:	8b 72 10             	mov    0x10(%edx),%esi
+  ioapic->reg = reg;
+80103832:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+  return ioapic->data;
+80103838:	8b 1d b4 39 1a 80    	mov    0x801a39b4,%ebx
+  maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+  id = ioapicread(REG_ID) >> 24;
+  if(id != ioapicid)
+8010383e:	0f b6 15 40 3b 1a 80 	movzbl 0x801a3b40,%edx
+  maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+80103845:	c1 ee 10             	shr    $0x10,%esi
+80103848:	89 f0                	mov    %esi,%eax
+8010384a:	0f b6 f0             	movzbl %al,%esi
+  return ioapic->data;
+8010384d:	8b 43 10             	mov    0x10(%ebx),%eax
+  id = ioapicread(REG_ID) >> 24;
+80103850:	c1 e8 18             	shr    $0x18,%eax
+  if(id != ioapicid)
+80103853:	39 c2                	cmp    %eax,%edx
+80103855:	74 16                	je     8010386d <ioapicinit+0x5d>
+    cprintf("ioapicinit: id isn't equal to ioapicid; not a MP\n");
+80103857:	83 ec 0c             	sub    $0xc,%esp
+8010385a:	68 58 b8 10 80       	push   $0x8010b858
+8010385f:	e8 8c df ff ff       	call   801017f0 <cprintf>
+  ioapic->reg = reg;
+80103864:	8b 1d b4 39 1a 80    	mov    0x801a39b4,%ebx
+8010386a:	83 c4 10             	add    $0x10,%esp
+{
+8010386d:	ba 10 00 00 00       	mov    $0x10,%edx
+80103872:	31 c0                	xor    %eax,%eax
+80103874:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ioapic->reg = reg;
+80103878:	89 13                	mov    %edx,(%ebx)
+8010387a:	8d 48 20             	lea    0x20(%eax),%ecx
+  ioapic->data = data;
+8010387d:	8b 1d b4 39 1a 80    	mov    0x801a39b4,%ebx
+
+  // Mark all interrupts edge-triggered, active high, disabled,
+  // and not routed to any CPUs.
+  for(i = 0; i <= maxintr; i++){
+80103883:	83 c0 01             	add    $0x1,%eax
+80103886:	81 c9 00 00 01 00    	or     $0x10000,%ecx
+  ioapic->data = data;
+8010388c:	89 4b 10             	mov    %ecx,0x10(%ebx)
+  ioapic->reg = reg;
+8010388f:	8d 4a 01             	lea    0x1(%edx),%ecx
+  for(i = 0; i <= maxintr; i++){
+80103892:	83 c2 02             	add    $0x2,%edx
+  ioapic->reg = reg;
+80103895:	89 0b                	mov    %ecx,(%ebx)
+  ioapic->data = data;
+80103897:	8b 1d b4 39 1a 80    	mov    0x801a39b4,%ebx
+8010389d:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  for(i = 0; i <= maxintr; i++){
+801038a4:	39 c6                	cmp    %eax,%esi
+801038a6:	7d d0                	jge    80103878 <ioapicinit+0x68>
+    ioapicwrite(REG_TABLE+2*i, INT_DISABLED | (T_IRQ0 + i));
+    ioapicwrite(REG_TABLE+2*i+1, 0);
+  }
+}
+801038a8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801038ab:	5b                   	pop    %ebx
+801038ac:	5e                   	pop    %esi
+801038ad:	5d                   	pop    %ebp
+801038ae:	c3                   	ret
+801038af:	90                   	nop
+
+801038b0 <ioapicenable>:
+
+void
+ioapicenable(int irq, int cpunum)
+{
+801038b0:	55                   	push   %ebp
+  ioapic->reg = reg;
+801038b1:	8b 0d b4 39 1a 80    	mov    0x801a39b4,%ecx
+{
+801038b7:	89 e5                	mov    %esp,%ebp
+801038b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  // Mark interrupt edge-triggered, active high,
+  // enabled, and routed to the given cpunum,
+  // which happens to be that cpu's APIC ID.
+  ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + irq);
+801038bc:	8d 50 20             	lea    0x20(%eax),%edx
+801038bf:	8d 44 00 10          	lea    0x10(%eax,%eax,1),%eax
+  ioapic->reg = reg;
+801038c3:	89 01                	mov    %eax,(%ecx)
+  ioapic->data = data;
+801038c5:	8b 0d b4 39 1a 80    	mov    0x801a39b4,%ecx
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+801038cb:	83 c0 01             	add    $0x1,%eax
+  ioapic->data = data;
+801038ce:	89 51 10             	mov    %edx,0x10(%ecx)
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+801038d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  ioapic->reg = reg;
+801038d4:	89 01                	mov    %eax,(%ecx)
+  ioapic->data = data;
+801038d6:	a1 b4 39 1a 80       	mov    0x801a39b4,%eax
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+801038db:	c1 e2 18             	shl    $0x18,%edx
+  ioapic->data = data;
+801038de:	89 50 10             	mov    %edx,0x10(%eax)
+}
+801038e1:	5d                   	pop    %ebp
+801038e2:	c3                   	ret
+801038e3:	66 90                	xchg   %ax,%ax
+801038e5:	66 90                	xchg   %ax,%ax
+801038e7:	66 90                	xchg   %ax,%ax
+801038e9:	66 90                	xchg   %ax,%ax
+801038eb:	66 90                	xchg   %ax,%ax
+801038ed:	66 90                	xchg   %ax,%ax
+801038ef:	90                   	nop
+
+801038f0 <kfree>:
+// which normally should have been returned by a
+// call to kalloc().  (The exception is when
+// initializing the allocator; see kinit above.)
+void
+kfree(char *v)
+{
+801038f0:	55                   	push   %ebp
+801038f1:	89 e5                	mov    %esp,%ebp
+801038f3:	53                   	push   %ebx
+801038f4:	83 ec 04             	sub    $0x4,%esp
+801038f7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct run *r;
+
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+801038fa:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+80103900:	0f 85 82 00 00 00    	jne    80103988 <kfree+0x98>
+80103906:	81 fb f0 49 1c 80    	cmp    $0x801c49f0,%ebx
+8010390c:	72 7a                	jb     80103988 <kfree+0x98>
+8010390e:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+80103914:	3d ff ff ff 0d       	cmp    $0xdffffff,%eax
+80103919:	77 6d                	ja     80103988 <kfree+0x98>
+    panic("kfree");
+
+  // Fill with junk to catch dangling refs.
+  memset(v, 1, PGSIZE);
+8010391b:	83 ec 04             	sub    $0x4,%esp
+8010391e:	68 00 10 00 00       	push   $0x1000
+80103923:	6a 01                	push   $0x1
+80103925:	53                   	push   %ebx
+80103926:	e8 95 3a 00 00       	call   801073c0 <memset>
+
+  if(kmem.use_lock)
+8010392b:	8b 15 20 3a 1a 80    	mov    0x801a3a20,%edx
+80103931:	83 c4 10             	add    $0x10,%esp
+80103934:	85 d2                	test   %edx,%edx
+80103936:	75 28                	jne    80103960 <kfree+0x70>
+    acquire(&kmem.lock);
+  r = (struct run*)v;
+  r->next = kmem.freelist;
+80103938:	a1 24 3a 1a 80       	mov    0x801a3a24,%eax
+8010393d:	89 03                	mov    %eax,(%ebx)
+  kmem.freelist = r;
+  kmem.nfree++;
+  if(kmem.use_lock)
+8010393f:	a1 20 3a 1a 80       	mov    0x801a3a20,%eax
+  kmem.nfree++;
+80103944:	83 05 28 3a 1a 80 01 	addl   $0x1,0x801a3a28
+  kmem.freelist = r;
+8010394b:	89 1d 24 3a 1a 80    	mov    %ebx,0x801a3a24
+  if(kmem.use_lock)
+80103951:	85 c0                	test   %eax,%eax
+80103953:	75 23                	jne    80103978 <kfree+0x88>
+    release(&kmem.lock);
+}
+80103955:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103958:	c9                   	leave
+80103959:	c3                   	ret
+8010395a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    acquire(&kmem.lock);
+80103960:	83 ec 0c             	sub    $0xc,%esp
+80103963:	68 c0 39 1a 80       	push   $0x801a39c0
+80103968:	e8 03 37 00 00       	call   80107070 <acquire>
+8010396d:	83 c4 10             	add    $0x10,%esp
+80103970:	eb c6                	jmp    80103938 <kfree+0x48>
+80103972:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    release(&kmem.lock);
+80103978:	c7 45 08 c0 39 1a 80 	movl   $0x801a39c0,0x8(%ebp)
+}
+8010397f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103982:	c9                   	leave
+    release(&kmem.lock);
+80103983:	e9 78 35 00 00       	jmp    80106f00 <release>
+    panic("kfree");
+80103988:	83 ec 0c             	sub    $0xc,%esp
+8010398b:	68 8a b8 10 80       	push   $0x8010b88a
+80103990:	e8 2b db ff ff       	call   801014c0 <panic>
+80103995:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010399c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801039a0 <freerange>:
+{
+801039a0:	55                   	push   %ebp
+801039a1:	89 e5                	mov    %esp,%ebp
+801039a3:	56                   	push   %esi
+801039a4:	53                   	push   %ebx
+  p = (char*)PGROUNDUP((uint)vstart);
+801039a5:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+801039a8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  p = (char*)PGROUNDUP((uint)vstart);
+801039ab:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+801039b1:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+801039b7:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+801039bd:	39 de                	cmp    %ebx,%esi
+801039bf:	72 23                	jb     801039e4 <freerange+0x44>
+801039c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    kfree(p);
+801039c8:	83 ec 0c             	sub    $0xc,%esp
+801039cb:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+801039d1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+801039d7:	50                   	push   %eax
+801039d8:	e8 13 ff ff ff       	call   801038f0 <kfree>
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+801039dd:	83 c4 10             	add    $0x10,%esp
+801039e0:	39 de                	cmp    %ebx,%esi
+801039e2:	73 e4                	jae    801039c8 <freerange+0x28>
+}
+801039e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801039e7:	5b                   	pop    %ebx
+801039e8:	5e                   	pop    %esi
+801039e9:	5d                   	pop    %ebp
+801039ea:	c3                   	ret
+801039eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801039ef:	90                   	nop
+
+801039f0 <kinit2>:
+{
+801039f0:	55                   	push   %ebp
+801039f1:	89 e5                	mov    %esp,%ebp
+801039f3:	56                   	push   %esi
+801039f4:	53                   	push   %ebx
+  p = (char*)PGROUNDUP((uint)vstart);
+801039f5:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+801039f8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  p = (char*)PGROUNDUP((uint)vstart);
+801039fb:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+80103a01:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80103a07:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+80103a0d:	39 de                	cmp    %ebx,%esi
+80103a0f:	72 23                	jb     80103a34 <kinit2+0x44>
+80103a11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    kfree(p);
+80103a18:	83 ec 0c             	sub    $0xc,%esp
+80103a1b:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80103a21:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+80103a27:	50                   	push   %eax
+80103a28:	e8 c3 fe ff ff       	call   801038f0 <kfree>
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80103a2d:	83 c4 10             	add    $0x10,%esp
+80103a30:	39 de                	cmp    %ebx,%esi
+80103a32:	73 e4                	jae    80103a18 <kinit2+0x28>
+  kmem.use_lock = 1;
+80103a34:	c7 05 20 3a 1a 80 01 	movl   $0x1,0x801a3a20
+80103a3b:	00 00 00 
+}
+80103a3e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103a41:	5b                   	pop    %ebx
+80103a42:	5e                   	pop    %esi
+80103a43:	5d                   	pop    %ebp
+80103a44:	c3                   	ret
+80103a45:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103a4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80103a50 <kinit1>:
+{
+80103a50:	55                   	push   %ebp
+80103a51:	89 e5                	mov    %esp,%ebp
+80103a53:	56                   	push   %esi
+80103a54:	53                   	push   %ebx
+80103a55:	8b 75 0c             	mov    0xc(%ebp),%esi
+  initlock(&kmem.lock, "kmem");
+80103a58:	83 ec 08             	sub    $0x8,%esp
+80103a5b:	68 90 b8 10 80       	push   $0x8010b890
+80103a60:	68 c0 39 1a 80       	push   $0x801a39c0
+80103a65:	e8 f6 2e 00 00       	call   80106960 <initlock>
+  p = (char*)PGROUNDUP((uint)vstart);
+80103a6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80103a6d:	83 c4 10             	add    $0x10,%esp
+  kmem.use_lock = 0;
+80103a70:	c7 05 20 3a 1a 80 00 	movl   $0x0,0x801a3a20
+80103a77:	00 00 00 
+  p = (char*)PGROUNDUP((uint)vstart);
+80103a7a:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+80103a80:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80103a86:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+80103a8c:	39 de                	cmp    %ebx,%esi
+80103a8e:	72 1c                	jb     80103aac <kinit1+0x5c>
+    kfree(p);
+80103a90:	83 ec 0c             	sub    $0xc,%esp
+80103a93:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80103a99:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+80103a9f:	50                   	push   %eax
+80103aa0:	e8 4b fe ff ff       	call   801038f0 <kfree>
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+80103aa5:	83 c4 10             	add    $0x10,%esp
+80103aa8:	39 de                	cmp    %ebx,%esi
+80103aaa:	73 e4                	jae    80103a90 <kinit1+0x40>
+}
+80103aac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103aaf:	5b                   	pop    %ebx
+80103ab0:	5e                   	pop    %esi
+80103ab1:	5d                   	pop    %ebp
+80103ab2:	c3                   	ret
+80103ab3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103aba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80103ac0 <kalloc>:
+// Returns 0 if the memory cannot be allocated.
+// When memory runs out, takes pages back from the buffer
+// cache, so the caller must not hold the cache's locks.
+char*
+kalloc(void)
+{
+80103ac0:	55                   	push   %ebp
+80103ac1:	89 e5                	mov    %esp,%ebp
+80103ac3:	53                   	push   %ebx
+80103ac4:	83 ec 04             	sub    $0x4,%esp
+80103ac7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103ace:	66 90                	xchg   %ax,%ax
+  struct run *r;
+
+  if(kmem.use_lock)
+80103ad0:	8b 15 20 3a 1a 80    	mov    0x801a3a20,%edx
+80103ad6:	85 d2                	test   %edx,%edx
+80103ad8:	75 26                	jne    80103b00 <kalloc+0x40>
+    acquire(&kmem.lock);
+  r = kmem.freelist;
+80103ada:	8b 1d 24 3a 1a 80    	mov    0x801a3a24,%ebx
+  if(r){
+80103ae0:	85 db                	test   %ebx,%ebx
+80103ae2:	0f 84 98 00 00 00    	je     80103b80 <kalloc+0xc0>
+    kmem.freelist = r->next;
+80103ae8:	8b 03                	mov    (%ebx),%eax
+    kmem.nfree--;
+80103aea:	83 2d 28 3a 1a 80 01 	subl   $0x1,0x801a3a28
+    kmem.freelist = r->next;
+80103af1:	a3 24 3a 1a 80       	mov    %eax,0x801a3a24
+  if(kmem.use_lock)
+    release(&kmem.lock);
+  if(r == 0 && kmem.use_lock && bshrink())
+    return kalloc();
+  return (char*)r;
+}
+80103af6:	89 d8                	mov    %ebx,%eax
+80103af8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103afb:	c9                   	leave
+80103afc:	c3                   	ret
+80103afd:	8d 76 00             	lea    0x0(%esi),%esi
+    acquire(&kmem.lock);
+80103b00:	83 ec 0c             	sub    $0xc,%esp
+80103b03:	68 c0 39 1a 80       	push   $0x801a39c0
+80103b08:	e8 63 35 00 00       	call   80107070 <acquire>
+  r = kmem.freelist;
+80103b0d:	8b 1d 24 3a 1a 80    	mov    0x801a3a24,%ebx
+  if(kmem.use_lock)
+80103b13:	a1 20 3a 1a 80       	mov    0x801a3a20,%eax
+  if(r){
+80103b18:	83 c4 10             	add    $0x10,%esp
+80103b1b:	85 db                	test   %ebx,%ebx
+80103b1d:	74 31                	je     80103b50 <kalloc+0x90>
+    kmem.freelist = r->next;
+80103b1f:	8b 13                	mov    (%ebx),%edx
+    kmem.nfree--;
+80103b21:	83 2d 28 3a 1a 80 01 	subl   $0x1,0x801a3a28
+    kmem.freelist = r->next;
+80103b28:	89 15 24 3a 1a 80    	mov    %edx,0x801a3a24
+  if(kmem.use_lock)
+80103b2e:	85 c0                	test   %eax,%eax
+80103b30:	74 c4                	je     80103af6 <kalloc+0x36>
+    release(&kmem.lock);
+80103b32:	83 ec 0c             	sub    $0xc,%esp
+80103b35:	68 c0 39 1a 80       	push   $0x801a39c0
+80103b3a:	e8 c1 33 00 00       	call   80106f00 <release>
+}
+80103b3f:	89 d8                	mov    %ebx,%eax
+    release(&kmem.lock);
+80103b41:	83 c4 10             	add    $0x10,%esp
+}
+80103b44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103b47:	c9                   	leave
+80103b48:	c3                   	ret
+80103b49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(kmem.use_lock)
+80103b50:	85 c0                	test   %eax,%eax
+80103b52:	74 2c                	je     80103b80 <kalloc+0xc0>
+    release(&kmem.lock);
+80103b54:	83 ec 0c             	sub    $0xc,%esp
+80103b57:	68 c0 39 1a 80       	push   $0x801a39c0
+80103b5c:	e8 9f 33 00 00       	call   80106f00 <release>
+  if(r == 0 && kmem.use_lock && bshrink())
+80103b61:	a1 20 3a 1a 80       	mov    0x801a3a20,%eax
+80103b66:	83 c4 10             	add    $0x10,%esp
+80103b69:	85 c0                	test   %eax,%eax
+80103b6b:	74 13                	je     80103b80 <kalloc+0xc0>
+80103b6d:	e8 4e d5 ff ff       	call   801010c0 <bshrink>
+80103b72:	85 c0                	test   %eax,%eax
+80103b74:	0f 85 56 ff ff ff    	jne    80103ad0 <kalloc+0x10>
+80103b7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+{
+80103b80:	31 db                	xor    %ebx,%ebx
+80103b82:	e9 6f ff ff ff       	jmp    80103af6 <kalloc+0x36>
+80103b87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103b8e:	66 90                	xchg   %ax,%ax
+
+80103b90 <kfreepages>:
+// Number of free pages; only a hint, so no lock.
+int
+kfreepages(void)
+{
+  return kmem.nfree;
+}
+80103b90:	a1 28 3a 1a 80       	mov    0x801a3a28,%eax
+80103b95:	c3                   	ret
+80103b96:	66 90                	xchg   %ax,%ax
+80103b98:	66 90                	xchg   %ax,%ax
+80103b9a:	66 90                	xchg   %ax,%ax
+80103b9c:	66 90                	xchg   %ax,%ax
+80103b9e:	66 90                	xchg   %ax,%ax
+
+80103ba0 <kbdgetc>:
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103ba0:	ba 64 00 00 00       	mov    $0x64,%edx
+80103ba5:	ec                   	in     (%dx),%al
+    normalmap, shiftmap, ctlmap, ctlmap
+  };
+  uint st, data, c;
+
+  st = inb(KBSTATP);
+  if((st & KBS_DIB) == 0)
+80103ba6:	a8 01                	test   $0x1,%al
+80103ba8:	0f 84 c2 00 00 00    	je     80103c70 <kbdgetc+0xd0>
+{
+80103bae:	55                   	push   %ebp
+80103baf:	ba 60 00 00 00       	mov    $0x60,%edx
+80103bb4:	89 e5                	mov    %esp,%ebp
+80103bb6:	53                   	push   %ebx
+80103bb7:	ec                   	in     (%dx),%al
+    return -1;
+  data = inb(KBDATAP);
+
+  if(data == 0xE0){
+    shift |= E0ESC;
+80103bb8:	8b 1d 2c 3a 1a 80    	mov    0x801a3a2c,%ebx
+  data = inb(KBDATAP);
+80103bbe:	0f b6 c8             	movzbl %al,%ecx
+  if(data == 0xE0){
+80103bc1:	3c e0                	cmp    $0xe0,%al
+80103bc3:	74 5b                	je     80103c20 <kbdgetc+0x80>
+    return 0;
+  } else if(data & 0x80){
+    // Key released
+    data = (shift & E0ESC ? data : data & 0x7F);
+80103bc5:	89 da                	mov    %ebx,%edx
+80103bc7:	83 e2 40             	and    $0x40,%edx
+  } else if(data & 0x80){
+80103bca:	84 c0                	test   %al,%al
+80103bcc:	78 6a                	js     80103c38 <kbdgetc+0x98>
+    shift &= ~(shiftcode[data] | E0ESC);
+    return 0;
+  } else if(shift & E0ESC){
+80103bce:	85 d2                	test   %edx,%edx
+80103bd0:	74 09                	je     80103bdb <kbdgetc+0x3b>
+    // Last character was an E0 escape; or with 0x80
+    data |= 0x80;
+80103bd2:	83 c8 80             	or     $0xffffff80,%eax
+    shift &= ~E0ESC;
+80103bd5:	83 e3 bf             	and    $0xffffffbf,%ebx
+    data |= 0x80;
+80103bd8:	0f b6 c8             	movzbl %al,%ecx
+  }
+
+  shift |= shiftcode[data];
+80103bdb:	0f b6 91 c0 b9 10 80 	movzbl -0x7fef4640(%ecx),%edx
+  shift ^= togglecode[data];
+80103be2:	0f b6 81 c0 b8 10 80 	movzbl -0x7fef4740(%ecx),%eax
+  shift |= shiftcode[data];
+80103be9:	09 da                	or     %ebx,%edx
+  shift ^= togglecode[data];
+80103beb:	31 c2                	xor    %eax,%edx
+  c = charcode[shift & (CTL | SHIFT)][data];
+80103bed:	89 d0                	mov    %edx,%eax
+  shift ^= togglecode[data];
+80103bef:	89 15 2c 3a 1a 80    	mov    %edx,0x801a3a2c
+  c = charcode[shift & (CTL | SHIFT)][data];
+80103bf5:	83 e0 03             	and    $0x3,%eax
+  if(shift & CAPSLOCK){
+80103bf8:	83 e2 08             	and    $0x8,%edx
+  c = charcode[shift & (CTL | SHIFT)][data];
+80103bfb:	8b 04 85 a0 b8 10 80 	mov    -0x7fef4760(,%eax,4),%eax
+80103c02:	0f b6 04 08          	movzbl (%eax,%ecx,1),%eax
+  if(shift & CAPSLOCK){
+80103c06:	74 0b                	je     80103c13 <kbdgetc+0x73>
+    if('a' <= c && c <= 'z')
+80103c08:	8d 50 9f             	lea    -0x61(%eax),%edx
+80103c0b:	83 fa 19             	cmp    $0x19,%edx
+80103c0e:	77 48                	ja     80103c58 <kbdgetc+0xb8>
+      c += 'A' - 'a';
+80103c10:	83 e8 20             	sub    $0x20,%eax
+    else if('A' <= c && c <= 'Z')
+      c += 'a' - 'A';
+  }
+  return c;
+}
+80103c13:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103c16:	c9                   	leave
+80103c17:	c3                   	ret
+80103c18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103c1f:	90                   	nop
+    shift |= E0ESC;
+80103c20:	89 d8                	mov    %ebx,%eax
+80103c22:	83 c8 40             	or     $0x40,%eax
+    shift &= ~(shiftcode[data] | E0ESC);
+80103c25:	a3 2c 3a 1a 80       	mov    %eax,0x801a3a2c
+    return 0;
+80103c2a:	31 c0                	xor    %eax,%eax
+}
+80103c2c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103c2f:	c9                   	leave
+80103c30:	c3                   	ret
+80103c31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    data = (shift & E0ESC ? data : data & 0x7F);
+80103c38:	83 e0 7f             	and    $0x7f,%eax
+80103c3b:	85 d2                	test   %edx,%edx
+80103c3d:	0f 44 c8             	cmove  %eax,%ecx
+    shift &= ~(shiftcode[data] | E0ESC);
+80103c40:	0f b6 81 c0 b9 10 80 	movzbl -0x7fef4640(%ecx),%eax
+80103c47:	83 c8 40             	or     $0x40,%eax
+80103c4a:	0f b6 c0             	movzbl %al,%eax
+80103c4d:	f7 d0                	not    %eax
+80103c4f:	21 d8                	and    %ebx,%eax
+    return 0;
+80103c51:	eb d2                	jmp    80103c25 <kbdgetc+0x85>
+80103c53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103c57:	90                   	nop
+    else if('A' <= c && c <= 'Z')
+80103c58:	8d 48 bf             	lea    -0x41(%eax),%ecx
+      c += 'a' - 'A';
+80103c5b:	8d 50 20             	lea    0x20(%eax),%edx
+}
+80103c5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103c61:	c9                   	leave
+      c += 'a' - 'A';
+80103c62:	83 f9 1a             	cmp    $0x1a,%ecx
+80103c65:	0f 42 c2             	cmovb  %edx,%eax
+}
+80103c68:	c3                   	ret
+80103c69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+80103c70:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80103c75:	c3                   	ret
+80103c76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103c7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80103c80 <kbdintr>:
+
+void
+kbdintr(void)
+{
+80103c80:	55                   	push   %ebp
+80103c81:	89 e5                	mov    %esp,%ebp
+80103c83:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(kbdgetc);
+80103c86:	68 a0 3b 10 80       	push   $0x80103ba0
+80103c8b:	e8 70 dd ff ff       	call   80101a00 <consoleintr>
+}
+80103c90:	83 c4 10             	add    $0x10,%esp
+80103c93:	c9                   	leave
+80103c94:	c3                   	ret
+80103c95:	66 90                	xchg   %ax,%ax
+80103c97:	66 90                	xchg   %ax,%ax
+80103c99:	66 90                	xchg   %ax,%ax
+80103c9b:	66 90                	xchg   %ax,%ax
+80103c9d:	66 90                	xchg   %ax,%ax
+80103c9f:	90                   	nop
+
+80103ca0 <lapicinit>:
+}
+
+void
+lapicinit(void)
+{
+  if(!lapic)
+80103ca0:	8b 0d 38 3a 1a 80    	mov    0x801a3a38,%ecx
+80103ca6:	85 c9                	test   %ecx,%ecx
+80103ca8:	0f 84 9a 01 00 00    	je     80103e48 <lapicinit+0x1a8>
+{
+80103cae:	55                   	push   %ebp
+80103caf:	89 e5                	mov    %esp,%ebp
+80103cb1:	56                   	push   %esi
+80103cb2:	53                   	push   %ebx
+  // and then issues an interrupt.  It runs in one-shot mode:
+  // timer.c re-arms it after every interrupt, for the next
+  // tick or an earlier nanosleep() deadline.  The boot CPU
+  // calibrates the tick length against the PIT.
+  lapicw(TDCR, X1);
+  if(lapicperiod == 0 && (lapicperiod = lapiccalibrate()) == 0)
+80103cb3:	8b 1d 34 3a 1a 80    	mov    0x801a3a34,%ebx
+  lapic[index] = value;
+80103cb9:	c7 81 f0 00 00 00 3f 	movl   $0x13f,0xf0(%ecx)
+80103cc0:	01 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103cc3:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+80103cc6:	c7 81 e0 03 00 00 0b 	movl   $0xb,0x3e0(%ecx)
+80103ccd:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103cd0:	8b 41 20             	mov    0x20(%ecx),%eax
+  if(lapicperiod == 0 && (lapicperiod = lapiccalibrate()) == 0)
+80103cd3:	85 db                	test   %ebx,%ebx
+80103cd5:	0f 84 c5 00 00 00    	je     80103da0 <lapicinit+0x100>
+  lapic[index] = value;
+80103cdb:	c7 81 20 03 00 00 20 	movl   $0x20,0x320(%ecx)
+80103ce2:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103ce5:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+80103ce8:	89 99 80 03 00 00    	mov    %ebx,0x380(%ecx)
+  lapic[ID];  // wait for write to finish, by reading
+80103cee:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+80103cf1:	c7 81 50 03 00 00 00 	movl   $0x10000,0x350(%ecx)
+80103cf8:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103cfb:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+80103cfe:	c7 81 60 03 00 00 00 	movl   $0x10000,0x360(%ecx)
+80103d05:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103d08:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapicw(LINT0, MASKED);
+  lapicw(LINT1, MASKED);
+
+  // Disable performance counter overflow interrupts
+  // on machines that provide that interrupt entry.
+  if(((lapic[VER]>>16) & 0xFF) >= 4)
+80103d0b:	8b 41 30             	mov    0x30(%ecx),%eax
+80103d0e:	c1 e8 10             	shr    $0x10,%eax
+80103d11:	a8 fc                	test   $0xfc,%al
+80103d13:	75 73                	jne    80103d88 <lapicinit+0xe8>
+  lapic[index] = value;
+80103d15:	c7 81 70 03 00 00 33 	movl   $0x33,0x370(%ecx)
+80103d1c:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103d1f:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+80103d22:	c7 81 80 02 00 00 00 	movl   $0x0,0x280(%ecx)
+80103d29:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103d2c:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+80103d2f:	c7 81 80 02 00 00 00 	movl   $0x0,0x280(%ecx)
+80103d36:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103d39:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+80103d3c:	c7 81 b0 00 00 00 00 	movl   $0x0,0xb0(%ecx)
+80103d43:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103d46:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+80103d49:	c7 81 10 03 00 00 00 	movl   $0x0,0x310(%ecx)
+80103d50:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103d53:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+80103d56:	c7 81 00 03 00 00 00 	movl   $0x88500,0x300(%ecx)
+80103d5d:	85 08 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103d60:	8b 41 20             	mov    0x20(%ecx),%eax
+80103d63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103d67:	90                   	nop
+  lapicw(EOI, 0);
+
+  // Send an Init Level De-Assert to synchronise arbitration ID's.
+  lapicw(ICRHI, 0);
+  lapicw(ICRLO, BCAST | INIT | LEVEL);
+  while(lapic[ICRLO] & DELIVS)
+80103d68:	8b 81 00 03 00 00    	mov    0x300(%ecx),%eax
+80103d6e:	f6 c4 10             	test   $0x10,%ah
+80103d71:	75 f5                	jne    80103d68 <lapicinit+0xc8>
+  lapic[index] = value;
+80103d73:	c7 81 80 00 00 00 00 	movl   $0x0,0x80(%ecx)
+80103d7a:	00 00 00 
+    ;
+
+  // Enable interrupts on the APIC (but not on the processor).
+  lapicw(TPR, 0);
+}
+80103d7d:	5b                   	pop    %ebx
+  lapic[ID];  // wait for write to finish, by reading
+80103d7e:	8b 41 20             	mov    0x20(%ecx),%eax
+}
+80103d81:	5e                   	pop    %esi
+80103d82:	5d                   	pop    %ebp
+80103d83:	c3                   	ret
+80103d84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  lapic[index] = value;
+80103d88:	c7 81 40 03 00 00 00 	movl   $0x10000,0x340(%ecx)
+80103d8f:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103d92:	8b 41 20             	mov    0x20(%ecx),%eax
+}
+80103d95:	e9 7b ff ff ff       	jmp    80103d15 <lapicinit+0x75>
+80103d9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80103da0:	bb 61 00 00 00       	mov    $0x61,%ebx
+80103da5:	89 da                	mov    %ebx,%edx
+80103da7:	ec                   	in     (%dx),%al
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103da8:	83 e0 fc             	and    $0xfffffffc,%eax
+80103dab:	ee                   	out    %al,(%dx)
+80103dac:	b8 b0 ff ff ff       	mov    $0xffffffb0,%eax
+80103db1:	ba 43 00 00 00       	mov    $0x43,%edx
+80103db6:	ee                   	out    %al,(%dx)
+80103db7:	ba 42 00 00 00       	mov    $0x42,%edx
+80103dbc:	b8 9b ff ff ff       	mov    $0xffffff9b,%eax
+80103dc1:	ee                   	out    %al,(%dx)
+80103dc2:	b8 2e 00 00 00       	mov    $0x2e,%eax
+80103dc7:	ee                   	out    %al,(%dx)
+  lapic[index] = value;
+80103dc8:	c7 81 20 03 00 00 00 	movl   $0x10000,0x320(%ecx)
+80103dcf:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103dd2:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+80103dd5:	c7 81 80 03 00 00 ff 	movl   $0xffffffff,0x380(%ecx)
+80103ddc:	ff ff ff 
+  lapic[ID];  // wait for write to finish, by reading
+80103ddf:	8b 41 20             	mov    0x20(%ecx),%eax
+  asm volatile("rdtsc" : "=A" (tsc));
+80103de2:	0f 31                	rdtsc
+80103de4:	89 c6                	mov    %eax,%esi
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103de6:	89 da                	mov    %ebx,%edx
+80103de8:	ec                   	in     (%dx),%al
+  outb(PIT_GATE, inb(PIT_GATE) | 0x01);  // start the PIT
+80103de9:	83 c8 01             	or     $0x1,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103dec:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103ded:	ec                   	in     (%dx),%al
+  for(i = 0; (inb(PIT_GATE) & 0x20) == 0; i++)
+80103dee:	bb 00 e1 f5 05       	mov    $0x5f5e100,%ebx
+80103df3:	a8 20                	test   $0x20,%al
+80103df5:	74 0e                	je     80103e05 <lapicinit+0x165>
+80103df7:	eb 11                	jmp    80103e0a <lapicinit+0x16a>
+80103df9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(i == 100000000)
+80103e00:	83 eb 01             	sub    $0x1,%ebx
+80103e03:	74 2b                	je     80103e30 <lapicinit+0x190>
+80103e05:	ec                   	in     (%dx),%al
+  for(i = 0; (inb(PIT_GATE) & 0x20) == 0; i++)
+80103e06:	a8 20                	test   $0x20,%al
+80103e08:	74 f6                	je     80103e00 <lapicinit+0x160>
+  n = 0xFFFFFFFF - lapic[TCCR];
+80103e0a:	8b 99 90 03 00 00    	mov    0x390(%ecx),%ebx
+80103e10:	f7 d3                	not    %ebx
+  asm volatile("rdtsc" : "=A" (tsc));
+80103e12:	0f 31                	rdtsc
+  tscperiod = rdtsc() - tsc;
+80103e14:	29 f0                	sub    %esi,%eax
+80103e16:	a3 30 3a 1a 80       	mov    %eax,0x801a3a30
+  if(lapicperiod == 0 && (lapicperiod = lapiccalibrate()) == 0)
+80103e1b:	85 db                	test   %ebx,%ebx
+80103e1d:	74 11                	je     80103e30 <lapicinit+0x190>
+80103e1f:	89 1d 34 3a 1a 80    	mov    %ebx,0x801a3a34
+80103e25:	e9 b1 fe ff ff       	jmp    80103cdb <lapicinit+0x3b>
+80103e2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    lapicperiod = 10000000;
+80103e30:	c7 05 34 3a 1a 80 80 	movl   $0x989680,0x801a3a34
+80103e37:	96 98 00 
+80103e3a:	bb 80 96 98 00       	mov    $0x989680,%ebx
+80103e3f:	e9 97 fe ff ff       	jmp    80103cdb <lapicinit+0x3b>
+80103e44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103e48:	c3                   	ret
+80103e49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80103e50 <lapicid>:
+
+int
+lapicid(void)
+{
+  if (!lapic)
+80103e50:	a1 38 3a 1a 80       	mov    0x801a3a38,%eax
+80103e55:	85 c0                	test   %eax,%eax
+80103e57:	74 07                	je     80103e60 <lapicid+0x10>
+    return 0;
+  return lapic[ID] >> 24;
+80103e59:	8b 40 20             	mov    0x20(%eax),%eax
+80103e5c:	c1 e8 18             	shr    $0x18,%eax
+80103e5f:	c3                   	ret
+    return 0;
+80103e60:	31 c0                	xor    %eax,%eax
+}
+80103e62:	c3                   	ret
+80103e63:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103e6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80103e70 <lapiceoi>:
+
+// Acknowledge interrupt.
+void
+lapiceoi(void)
+{
+  if(lapic)
+80103e70:	a1 38 3a 1a 80       	mov    0x801a3a38,%eax
+80103e75:	85 c0                	test   %eax,%eax
+80103e77:	74 0d                	je     80103e86 <lapiceoi+0x16>
+  lapic[index] = value;
+80103e79:	c7 80 b0 00 00 00 00 	movl   $0x0,0xb0(%eax)
+80103e80:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103e83:	8b 40 20             	mov    0x20(%eax),%eax
+    lapicw(EOI, 0);
+}
+80103e86:	c3                   	ret
+80103e87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103e8e:	66 90                	xchg   %ax,%ax
+
+80103e90 <lapicarm>:
+// Start the timer counting down from count; it interrupts
+// once when it reaches zero.
+void
+lapicarm(uint count)
+{
+  if(lapic)
+80103e90:	a1 38 3a 1a 80       	mov    0x801a3a38,%eax
+80103e95:	85 c0                	test   %eax,%eax
+80103e97:	74 17                	je     80103eb0 <lapicarm+0x20>
+{
+80103e99:	55                   	push   %ebp
+80103e9a:	89 e5                	mov    %esp,%ebp
+  lapic[index] = value;
+80103e9c:	8b 55 08             	mov    0x8(%ebp),%edx
+80103e9f:	89 90 80 03 00 00    	mov    %edx,0x380(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80103ea5:	8b 40 20             	mov    0x20(%eax),%eax
+    lapicw(TICR, count);
+}
+80103ea8:	5d                   	pop    %ebp
+80103ea9:	c3                   	ret
+80103eaa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80103eb0:	c3                   	ret
+80103eb1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103eb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103ebf:	90                   	nop
+
+80103ec0 <lapiccount>:
+
+// Timer counts left before the armed interrupt.
+uint
+lapiccount(void)
+{
+  if(!lapic)
+80103ec0:	a1 38 3a 1a 80       	mov    0x801a3a38,%eax
+80103ec5:	85 c0                	test   %eax,%eax
+80103ec7:	74 07                	je     80103ed0 <lapiccount+0x10>
+    return 0;
+  return lapic[TCCR];
+80103ec9:	8b 80 90 03 00 00    	mov    0x390(%eax),%eax
+80103ecf:	c3                   	ret
+    return 0;
+80103ed0:	31 c0                	xor    %eax,%eax
+}
+80103ed2:	c3                   	ret
+80103ed3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103eda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80103ee0 <microdelay>:
+// Spin for a given number of microseconds.
+// On real hardware would want to tune this dynamically.
+void
+microdelay(int us)
+{
+}
+80103ee0:	c3                   	ret
+80103ee1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103ee8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103eef:	90                   	nop
+
+80103ef0 <lapicipi>:
+// Must be called with interrupts disabled, since ICR is shared
+// by everything running on this CPU.
+void
+lapicipi(int apicid, int vector)
+{
+  if(!lapic)
+80103ef0:	8b 15 38 3a 1a 80    	mov    0x801a3a38,%edx
+80103ef6:	85 d2                	test   %edx,%edx
+80103ef8:	74 36                	je     80103f30 <lapicipi+0x40>
+{
+80103efa:	55                   	push   %ebp
+80103efb:	89 e5                	mov    %esp,%ebp
+    return;
+  lapicw(ICRHI, apicid<<24);
+80103efd:	8b 45 08             	mov    0x8(%ebp),%eax
+80103f00:	c1 e0 18             	shl    $0x18,%eax
+  lapic[index] = value;
+80103f03:	89 82 10 03 00 00    	mov    %eax,0x310(%edx)
+  lapic[ID];  // wait for write to finish, by reading
+80103f09:	8b 42 20             	mov    0x20(%edx),%eax
+  lapicw(ICRLO, FIXED | ASSERT | vector);
+80103f0c:	8b 45 0c             	mov    0xc(%ebp),%eax
+80103f0f:	80 cc 40             	or     $0x40,%ah
+  lapic[index] = value;
+80103f12:	89 82 00 03 00 00    	mov    %eax,0x300(%edx)
+  lapic[ID];  // wait for write to finish, by reading
+80103f18:	8b 42 20             	mov    0x20(%edx),%eax
+80103f1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103f1f:	90                   	nop
+  while(lapic[ICRLO] & DELIVS)
+80103f20:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+80103f26:	f6 c4 10             	test   $0x10,%ah
+80103f29:	75 f5                	jne    80103f20 <lapicipi+0x30>
+    ;
+}
+80103f2b:	5d                   	pop    %ebp
+80103f2c:	c3                   	ret
+80103f2d:	8d 76 00             	lea    0x0(%esi),%esi
+80103f30:	c3                   	ret
+80103f31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103f38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103f3f:	90                   	nop
+
+80103f40 <lapicstartap>:
+
+// Start additional processor running entry code at addr.
+// See Appendix B of MultiProcessor Specification.
+void
+lapicstartap(uchar apicid, uint addr)
+{
+80103f40:	55                   	push   %ebp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103f41:	b8 0f 00 00 00       	mov    $0xf,%eax
+80103f46:	ba 70 00 00 00       	mov    $0x70,%edx
+80103f4b:	89 e5                	mov    %esp,%ebp
+80103f4d:	53                   	push   %ebx
+80103f4e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80103f51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80103f54:	ee                   	out    %al,(%dx)
+80103f55:	b8 0a 00 00 00       	mov    $0xa,%eax
+80103f5a:	ba 71 00 00 00       	mov    $0x71,%edx
+80103f5f:	ee                   	out    %al,(%dx)
+  // and the warm reset vector (DWORD based at 40:67) to point at
+  // the AP startup code prior to the [universal startup algorithm]."
+  outb(CMOS_PORT, 0xF);  // offset 0xF is shutdown code
+  outb(CMOS_PORT+1, 0x0A);
+  wrv = (ushort*)P2V((0x40<<4 | 0x67));  // Warm reset vector
+  wrv[0] = 0;
+80103f60:	31 c0                	xor    %eax,%eax
+  lapic[index] = value;
+80103f62:	c1 e3 18             	shl    $0x18,%ebx
+  wrv[0] = 0;
+80103f65:	66 a3 67 04 00 80    	mov    %ax,0x80000467
+  wrv[1] = addr >> 4;
+80103f6b:	89 c8                	mov    %ecx,%eax
+  // when it is in the halted state due to an INIT.  So the second
+  // should be ignored, but it is part of the official Intel algorithm.
+  // Bochs complains about the second one.  Too bad for Bochs.
+  for(i = 0; i < 2; i++){
+    lapicw(ICRHI, apicid<<24);
+    lapicw(ICRLO, STARTUP | (addr>>12));
+80103f6d:	c1 e9 0c             	shr    $0xc,%ecx
+  lapic[index] = value;
+80103f70:	89 da                	mov    %ebx,%edx
+  wrv[1] = addr >> 4;
+80103f72:	c1 e8 04             	shr    $0x4,%eax
+    lapicw(ICRLO, STARTUP | (addr>>12));
+80103f75:	80 cd 06             	or     $0x6,%ch
+  wrv[1] = addr >> 4;
+80103f78:	66 a3 69 04 00 80    	mov    %ax,0x80000469
+  lapic[index] = value;
+80103f7e:	a1 38 3a 1a 80       	mov    0x801a3a38,%eax
+80103f83:	89 98 10 03 00 00    	mov    %ebx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80103f89:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80103f8c:	c7 80 00 03 00 00 00 	movl   $0xc500,0x300(%eax)
+80103f93:	c5 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103f96:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80103f99:	c7 80 00 03 00 00 00 	movl   $0x8500,0x300(%eax)
+80103fa0:	85 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103fa3:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80103fa6:	89 90 10 03 00 00    	mov    %edx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80103fac:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80103faf:	89 88 00 03 00 00    	mov    %ecx,0x300(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80103fb5:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+80103fb8:	89 90 10 03 00 00    	mov    %edx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80103fbe:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80103fc1:	89 88 00 03 00 00    	mov    %ecx,0x300(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80103fc7:	8b 40 20             	mov    0x20(%eax),%eax
+    microdelay(200);
+  }
+}
+80103fca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103fcd:	c9                   	leave
+80103fce:	c3                   	ret
+80103fcf:	90                   	nop
+
+80103fd0 <cmostime>:
+}
+
+// qemu seems to use 24-hour GWT and the values are BCD encoded
+void
+cmostime(struct rtcdate *r)
+{
+80103fd0:	55                   	push   %ebp
+80103fd1:	b8 0b 00 00 00       	mov    $0xb,%eax
+80103fd6:	ba 70 00 00 00       	mov    $0x70,%edx
+80103fdb:	89 e5                	mov    %esp,%ebp
+80103fdd:	57                   	push   %edi
+80103fde:	56                   	push   %esi
+80103fdf:	53                   	push   %ebx
+80103fe0:	83 ec 4c             	sub    $0x4c,%esp
+80103fe3:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103fe4:	ba 71 00 00 00       	mov    $0x71,%edx
+80103fe9:	ec                   	in     (%dx),%al
+  struct rtcdate t1, t2;
+  int sb, bcd;
+
+  sb = cmos_read(CMOS_STATB);
+
+  bcd = (sb & (1 << 2)) == 0;
+80103fea:	83 e0 04             	and    $0x4,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103fed:	bf 70 00 00 00       	mov    $0x70,%edi
+80103ff2:	88 45 b3             	mov    %al,-0x4d(%ebp)
+80103ff5:	8d 76 00             	lea    0x0(%esi),%esi
+80103ff8:	31 c0                	xor    %eax,%eax
+80103ffa:	89 fa                	mov    %edi,%edx
+80103ffc:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103ffd:	b9 71 00 00 00       	mov    $0x71,%ecx
+80104002:	89 ca                	mov    %ecx,%edx
+80104004:	ec                   	in     (%dx),%al
+80104005:	88 45 b7             	mov    %al,-0x49(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104008:	89 fa                	mov    %edi,%edx
+8010400a:	b8 02 00 00 00       	mov    $0x2,%eax
+8010400f:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104010:	89 ca                	mov    %ecx,%edx
+80104012:	ec                   	in     (%dx),%al
+80104013:	88 45 b6             	mov    %al,-0x4a(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104016:	89 fa                	mov    %edi,%edx
+80104018:	b8 04 00 00 00       	mov    $0x4,%eax
+8010401d:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010401e:	89 ca                	mov    %ecx,%edx
+80104020:	ec                   	in     (%dx),%al
+80104021:	88 45 b5             	mov    %al,-0x4b(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104024:	89 fa                	mov    %edi,%edx
+80104026:	b8 07 00 00 00       	mov    $0x7,%eax
+8010402b:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010402c:	89 ca                	mov    %ecx,%edx
+8010402e:	ec                   	in     (%dx),%al
+8010402f:	88 45 b4             	mov    %al,-0x4c(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104032:	89 fa                	mov    %edi,%edx
+80104034:	b8 08 00 00 00       	mov    $0x8,%eax
+80104039:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010403a:	89 ca                	mov    %ecx,%edx
+8010403c:	ec                   	in     (%dx),%al
+8010403d:	89 c6                	mov    %eax,%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010403f:	89 fa                	mov    %edi,%edx
+80104041:	b8 09 00 00 00       	mov    $0x9,%eax
+80104046:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104047:	89 ca                	mov    %ecx,%edx
+80104049:	ec                   	in     (%dx),%al
+8010404a:	0f b6 d8             	movzbl %al,%ebx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010404d:	89 fa                	mov    %edi,%edx
+8010404f:	b8 0a 00 00 00       	mov    $0xa,%eax
+80104054:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104055:	89 ca                	mov    %ecx,%edx
+80104057:	ec                   	in     (%dx),%al
+
+  // make sure CMOS doesn't modify time while we read it
+  for(;;) {
+    fill_rtcdate(&t1);
+    if(cmos_read(CMOS_STATA) & CMOS_UIP)
+80104058:	84 c0                	test   %al,%al
+8010405a:	78 9c                	js     80103ff8 <cmostime+0x28>
+  return inb(CMOS_RETURN);
+8010405c:	0f b6 45 b7          	movzbl -0x49(%ebp),%eax
+80104060:	89 f2                	mov    %esi,%edx
+80104062:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+80104065:	0f b6 f2             	movzbl %dl,%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104068:	89 fa                	mov    %edi,%edx
+8010406a:	89 45 b8             	mov    %eax,-0x48(%ebp)
+8010406d:	0f b6 45 b6          	movzbl -0x4a(%ebp),%eax
+80104071:	89 75 c8             	mov    %esi,-0x38(%ebp)
+80104074:	89 45 bc             	mov    %eax,-0x44(%ebp)
+80104077:	0f b6 45 b5          	movzbl -0x4b(%ebp),%eax
+8010407b:	89 45 c0             	mov    %eax,-0x40(%ebp)
+8010407e:	0f b6 45 b4          	movzbl -0x4c(%ebp),%eax
+80104082:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+80104085:	31 c0                	xor    %eax,%eax
+80104087:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104088:	89 ca                	mov    %ecx,%edx
+8010408a:	ec                   	in     (%dx),%al
+8010408b:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010408e:	89 fa                	mov    %edi,%edx
+80104090:	89 45 d0             	mov    %eax,-0x30(%ebp)
+80104093:	b8 02 00 00 00       	mov    $0x2,%eax
+80104098:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104099:	89 ca                	mov    %ecx,%edx
+8010409b:	ec                   	in     (%dx),%al
+8010409c:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010409f:	89 fa                	mov    %edi,%edx
+801040a1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+801040a4:	b8 04 00 00 00       	mov    $0x4,%eax
+801040a9:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801040aa:	89 ca                	mov    %ecx,%edx
+801040ac:	ec                   	in     (%dx),%al
+801040ad:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801040b0:	89 fa                	mov    %edi,%edx
+801040b2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+801040b5:	b8 07 00 00 00       	mov    $0x7,%eax
+801040ba:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801040bb:	89 ca                	mov    %ecx,%edx
+801040bd:	ec                   	in     (%dx),%al
+801040be:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801040c1:	89 fa                	mov    %edi,%edx
+801040c3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+801040c6:	b8 08 00 00 00       	mov    $0x8,%eax
+801040cb:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801040cc:	89 ca                	mov    %ecx,%edx
+801040ce:	ec                   	in     (%dx),%al
+801040cf:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801040d2:	89 fa                	mov    %edi,%edx
+801040d4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801040d7:	b8 09 00 00 00       	mov    $0x9,%eax
+801040dc:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801040dd:	89 ca                	mov    %ecx,%edx
+801040df:	ec                   	in     (%dx),%al
+801040e0:	0f b6 c0             	movzbl %al,%eax
+        continue;
+    fill_rtcdate(&t2);
+    if(memcmp(&t1, &t2, sizeof(t1)) == 0)
+801040e3:	83 ec 04             	sub    $0x4,%esp
+  return inb(CMOS_RETURN);
+801040e6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(memcmp(&t1, &t2, sizeof(t1)) == 0)
+801040e9:	8d 45 d0             	lea    -0x30(%ebp),%eax
+801040ec:	6a 18                	push   $0x18
+801040ee:	50                   	push   %eax
+801040ef:	8d 45 b8             	lea    -0x48(%ebp),%eax
+801040f2:	50                   	push   %eax
+801040f3:	e8 08 33 00 00       	call   80107400 <memcmp>
+801040f8:	83 c4 10             	add    $0x10,%esp
+801040fb:	85 c0                	test   %eax,%eax
+801040fd:	0f 85 f5 fe ff ff    	jne    80103ff8 <cmostime+0x28>
+      break;
+  }
+
+  // convert
+  if(bcd) {
+80104103:	0f b6 75 b3          	movzbl -0x4d(%ebp),%esi
+80104107:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010410a:	89 f0                	mov    %esi,%eax
+8010410c:	84 c0                	test   %al,%al
+8010410e:	75 78                	jne    80104188 <cmostime+0x1b8>
+#define    CONV(x)     (t1.x = ((t1.x >> 4) * 10) + (t1.x & 0xf))
+    CONV(second);
+80104110:	8b 45 b8             	mov    -0x48(%ebp),%eax
+80104113:	89 c2                	mov    %eax,%edx
+80104115:	83 e0 0f             	and    $0xf,%eax
+80104118:	c1 ea 04             	shr    $0x4,%edx
+8010411b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+8010411e:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80104121:	89 45 b8             	mov    %eax,-0x48(%ebp)
+    CONV(minute);
+80104124:	8b 45 bc             	mov    -0x44(%ebp),%eax
+80104127:	89 c2                	mov    %eax,%edx
+80104129:	83 e0 0f             	and    $0xf,%eax
+8010412c:	c1 ea 04             	shr    $0x4,%edx
+8010412f:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80104132:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80104135:	89 45 bc             	mov    %eax,-0x44(%ebp)
+    CONV(hour  );
+80104138:	8b 45 c0             	mov    -0x40(%ebp),%eax
+8010413b:	89 c2                	mov    %eax,%edx
+8010413d:	83 e0 0f             	and    $0xf,%eax
+80104140:	c1 ea 04             	shr    $0x4,%edx
+80104143:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80104146:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80104149:	89 45 c0             	mov    %eax,-0x40(%ebp)
+    CONV(day   );
+8010414c:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+8010414f:	89 c2                	mov    %eax,%edx
+80104151:	83 e0 0f             	and    $0xf,%eax
+80104154:	c1 ea 04             	shr    $0x4,%edx
+80104157:	8d 14 92             	lea    (%edx,%edx,4),%edx
+8010415a:	8d 04 50             	lea    (%eax,%edx,2),%eax
+8010415d:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    CONV(month );
+80104160:	8b 45 c8             	mov    -0x38(%ebp),%eax
+80104163:	89 c2                	mov    %eax,%edx
+80104165:	83 e0 0f             	and    $0xf,%eax
+80104168:	c1 ea 04             	shr    $0x4,%edx
+8010416b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+8010416e:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80104171:	89 45 c8             	mov    %eax,-0x38(%ebp)
+    CONV(year  );
+80104174:	8b 45 cc             	mov    -0x34(%ebp),%eax
+80104177:	89 c2                	mov    %eax,%edx
+80104179:	83 e0 0f             	and    $0xf,%eax
+8010417c:	c1 ea 04             	shr    $0x4,%edx
+8010417f:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80104182:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80104185:	89 45 cc             	mov    %eax,-0x34(%ebp)
+#undef     CONV
+  }
+
+  *r = t1;
+80104188:	8b 45 b8             	mov    -0x48(%ebp),%eax
+8010418b:	89 03                	mov    %eax,(%ebx)
+8010418d:	8b 45 bc             	mov    -0x44(%ebp),%eax
+80104190:	89 43 04             	mov    %eax,0x4(%ebx)
+80104193:	8b 45 c0             	mov    -0x40(%ebp),%eax
+80104196:	89 43 08             	mov    %eax,0x8(%ebx)
+80104199:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+8010419c:	89 43 0c             	mov    %eax,0xc(%ebx)
+8010419f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+801041a2:	89 43 10             	mov    %eax,0x10(%ebx)
+801041a5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+801041a8:	89 43 14             	mov    %eax,0x14(%ebx)
+  r->year += 2000;
+801041ab:	81 43 14 d0 07 00 00 	addl   $0x7d0,0x14(%ebx)
+}
+801041b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801041b5:	5b                   	pop    %ebx
+801041b6:	5e                   	pop    %esi
+801041b7:	5f                   	pop    %edi
+801041b8:	5d                   	pop    %ebp
+801041b9:	c3                   	ret
+801041ba:	66 90                	xchg   %ax,%ax
+801041bc:	66 90                	xchg   %ax,%ax
+801041be:	66 90                	xchg   %ax,%ax
+
+801041c0 <install_trans>:
+install_trans(void)
+{
+  struct buf *dbuf[LOGBATCH];
+  int tail, i, n;
+
+  for (tail = 0; tail < log.lh.n; tail += n) {
+801041c0:	a1 b4 3a 1a 80       	mov    0x801a3ab4,%eax
+801041c5:	85 c0                	test   %eax,%eax
+801041c7:	0f 8e ed 00 00 00    	jle    801042ba <install_trans+0xfa>
+{
+801041cd:	55                   	push   %ebp
+  for (tail = 0; tail < log.lh.n; tail += n) {
+801041ce:	31 c9                	xor    %ecx,%ecx
+{
+801041d0:	89 e5                	mov    %esp,%ebp
+801041d2:	57                   	push   %edi
+801041d3:	56                   	push   %esi
+801041d4:	53                   	push   %ebx
+801041d5:	83 ec 4c             	sub    $0x4c,%esp
+801041d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801041df:	90                   	nop
+    n = log.lh.n - tail;
+    if (n > LOGBATCH)
+801041e0:	ba 0a 00 00 00       	mov    $0xa,%edx
+    n = log.lh.n - tail;
+801041e5:	29 c8                	sub    %ecx,%eax
+      n = LOGBATCH;
+    for (i = 0; i < n; i++) {
+801041e7:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+    if (n > LOGBATCH)
+801041ea:	39 d0                	cmp    %edx,%eax
+801041ec:	0f 4f c2             	cmovg  %edx,%eax
+    for (i = 0; i < n; i++) {
+801041ef:	8d 14 8d 00 00 00 00 	lea    0x0(,%ecx,4),%edx
+801041f6:	31 db                	xor    %ebx,%ebx
+801041f8:	89 55 ac             	mov    %edx,-0x54(%ebp)
+801041fb:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+801041fe:	66 90                	xchg   %ax,%ax
+      struct buf *lbuf = bread(log.dev, log.start+tail+i+1); // read log block
+80104200:	8b 45 b0             	mov    -0x50(%ebp),%eax
+80104203:	03 05 a0 3a 1a 80    	add    0x801a3aa0,%eax
+80104209:	83 ec 08             	sub    $0x8,%esp
+8010420c:	8d 44 03 01          	lea    0x1(%ebx,%eax,1),%eax
+80104210:	50                   	push   %eax
+80104211:	ff 35 b0 3a 1a 80    	push   0x801a3ab0
+80104217:	e8 14 cc ff ff       	call   80100e30 <bread>
+8010421c:	89 c6                	mov    %eax,%esi
+      dbuf[i] = bread(log.dev, log.lh.block[tail+i]); // read dst
+8010421e:	58                   	pop    %eax
+8010421f:	8b 45 ac             	mov    -0x54(%ebp),%eax
+80104222:	5a                   	pop    %edx
+80104223:	ff b4 98 b8 3a 1a 80 	push   -0x7fe5c548(%eax,%ebx,4)
+8010422a:	ff 35 b0 3a 1a 80    	push   0x801a3ab0
+80104230:	e8 fb cb ff ff       	call   80100e30 <bread>
+      memmove(dbuf[i]->data, lbuf->data, BSIZE);  // copy block to dst
+80104235:	83 c4 0c             	add    $0xc,%esp
+      dbuf[i] = bread(log.dev, log.lh.block[tail+i]); // read dst
+80104238:	89 44 9d c0          	mov    %eax,-0x40(%ebp,%ebx,4)
+8010423c:	89 c7                	mov    %eax,%edi
+      memmove(dbuf[i]->data, lbuf->data, BSIZE);  // copy block to dst
+8010423e:	8d 86 a8 00 00 00    	lea    0xa8(%esi),%eax
+    for (i = 0; i < n; i++) {
+80104244:	83 c3 01             	add    $0x1,%ebx
+      memmove(dbuf[i]->data, lbuf->data, BSIZE);  // copy block to dst
+80104247:	68 00 02 00 00       	push   $0x200
+8010424c:	50                   	push   %eax
+8010424d:	8d 87 a8 00 00 00    	lea    0xa8(%edi),%eax
+80104253:	50                   	push   %eax
+80104254:	e8 f7 31 00 00       	call   80107450 <memmove>
+      brelse(lbuf);
+80104259:	89 34 24             	mov    %esi,(%esp)
+8010425c:	e8 df cd ff ff       	call   80101040 <brelse>
+      bwrite_async(dbuf[i]);  // write dst to disk
+80104261:	89 3c 24             	mov    %edi,(%esp)
+80104264:	e8 07 cd ff ff       	call   80100f70 <bwrite_async>
+    for (i = 0; i < n; i++) {
+80104269:	83 c4 10             	add    $0x10,%esp
+8010426c:	39 5d b4             	cmp    %ebx,-0x4c(%ebp)
+8010426f:	75 8f                	jne    80104200 <install_trans+0x40>
+80104271:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+80104274:	8d 75 c0             	lea    -0x40(%ebp),%esi
+80104277:	8d 5c 85 c0          	lea    -0x40(%ebp,%eax,4),%ebx
+8010427b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010427f:	90                   	nop
+    }
+    for (i = 0; i < n; i++) {
+      bwait(dbuf[i]);
+80104280:	8b 3e                	mov    (%esi),%edi
+80104282:	83 ec 0c             	sub    $0xc,%esp
+    for (i = 0; i < n; i++) {
+80104285:	83 c6 04             	add    $0x4,%esi
+      bwait(dbuf[i]);
+80104288:	57                   	push   %edi
+80104289:	e8 d2 ca ff ff       	call   80100d60 <bwait>
+      brelse(dbuf[i]);
+8010428e:	89 3c 24             	mov    %edi,(%esp)
+80104291:	e8 aa cd ff ff       	call   80101040 <brelse>
+    for (i = 0; i < n; i++) {
+80104296:	83 c4 10             	add    $0x10,%esp
+80104299:	39 f3                	cmp    %esi,%ebx
+8010429b:	75 e3                	jne    80104280 <install_trans+0xc0>
+  for (tail = 0; tail < log.lh.n; tail += n) {
+8010429d:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+801042a0:	8b 4d b0             	mov    -0x50(%ebp),%ecx
+801042a3:	01 c1                	add    %eax,%ecx
+801042a5:	a1 b4 3a 1a 80       	mov    0x801a3ab4,%eax
+801042aa:	39 c8                	cmp    %ecx,%eax
+801042ac:	0f 8f 2e ff ff ff    	jg     801041e0 <install_trans+0x20>
+    }
+  }
+}
+801042b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801042b5:	5b                   	pop    %ebx
+801042b6:	5e                   	pop    %esi
+801042b7:	5f                   	pop    %edi
+801042b8:	5d                   	pop    %ebp
+801042b9:	c3                   	ret
+801042ba:	c3                   	ret
+801042bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801042bf:	90                   	nop
+
+801042c0 <write_head>:
+// Write in-memory log header to disk.
+// This is the true point at which the
+// current transaction commits.
+static void
+write_head(void)
+{
+801042c0:	55                   	push   %ebp
+801042c1:	89 e5                	mov    %esp,%ebp
+801042c3:	53                   	push   %ebx
+801042c4:	83 ec 0c             	sub    $0xc,%esp
+  struct buf *buf = bread(log.dev, log.start);
+801042c7:	ff 35 a0 3a 1a 80    	push   0x801a3aa0
+801042cd:	ff 35 b0 3a 1a 80    	push   0x801a3ab0
+801042d3:	e8 58 cb ff ff       	call   80100e30 <bread>
+  struct logheader *hb = (struct logheader *) (buf->data);
+  int i;
+  hb->n = log.lh.n;
+  for (i = 0; i < log.lh.n; i++) {
+801042d8:	83 c4 10             	add    $0x10,%esp
+  struct buf *buf = bread(log.dev, log.start);
+801042db:	89 c3                	mov    %eax,%ebx
+  hb->n = log.lh.n;
+801042dd:	a1 b4 3a 1a 80       	mov    0x801a3ab4,%eax
+801042e2:	89 83 a8 00 00 00    	mov    %eax,0xa8(%ebx)
+  for (i = 0; i < log.lh.n; i++) {
+801042e8:	85 c0                	test   %eax,%eax
+801042ea:	7e 19                	jle    80104305 <write_head+0x45>
+801042ec:	31 d2                	xor    %edx,%edx
+801042ee:	66 90                	xchg   %ax,%ax
+    hb->block[i] = log.lh.block[i];
+801042f0:	8b 0c 95 b8 3a 1a 80 	mov    -0x7fe5c548(,%edx,4),%ecx
+801042f7:	89 8c 93 ac 00 00 00 	mov    %ecx,0xac(%ebx,%edx,4)
+  for (i = 0; i < log.lh.n; i++) {
+801042fe:	83 c2 01             	add    $0x1,%edx
+80104301:	39 d0                	cmp    %edx,%eax
+80104303:	75 eb                	jne    801042f0 <write_head+0x30>
+  }
+  bwrite(buf);
+80104305:	83 ec 0c             	sub    $0xc,%esp
+80104308:	53                   	push   %ebx
+80104309:	e8 e2 cc ff ff       	call   80100ff0 <bwrite>
+  brelse(buf);
+8010430e:	89 1c 24             	mov    %ebx,(%esp)
+80104311:	e8 2a cd ff ff       	call   80101040 <brelse>
+}
+80104316:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104319:	83 c4 10             	add    $0x10,%esp
+8010431c:	c9                   	leave
+8010431d:	c3                   	ret
+8010431e:	66 90                	xchg   %ax,%ax
+
+80104320 <initlog>:
+{
+80104320:	55                   	push   %ebp
+80104321:	89 e5                	mov    %esp,%ebp
+80104323:	53                   	push   %ebx
+80104324:	83 ec 2c             	sub    $0x2c,%esp
+80104327:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&log.lock, "log");
+8010432a:	68 c0 ba 10 80       	push   $0x8010bac0
+8010432f:	68 40 3a 1a 80       	push   $0x801a3a40
+80104334:	e8 27 26 00 00       	call   80106960 <initlock>
+  readsb(dev, &sb);
+80104339:	58                   	pop    %eax
+8010433a:	8d 45 dc             	lea    -0x24(%ebp),%eax
+8010433d:	5a                   	pop    %edx
+8010433e:	50                   	push   %eax
+8010433f:	53                   	push   %ebx
+80104340:	e8 3b e6 ff ff       	call   80102980 <readsb>
+  log.size = sb.nlog;
+80104345:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  log.start = sb.logstart;
+80104348:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  log.dev = dev;
+8010434b:	89 1d b0 3a 1a 80    	mov    %ebx,0x801a3ab0
+  log.start = sb.logstart;
+80104351:	a3 a0 3a 1a 80       	mov    %eax,0x801a3aa0
+  log.size = sb.nlog;
+80104356:	89 15 a4 3a 1a 80    	mov    %edx,0x801a3aa4
+  struct buf *buf = bread(log.dev, log.start);
+8010435c:	59                   	pop    %ecx
+8010435d:	5a                   	pop    %edx
+8010435e:	50                   	push   %eax
+8010435f:	53                   	push   %ebx
+80104360:	e8 cb ca ff ff       	call   80100e30 <bread>
+  for (i = 0; i < log.lh.n; i++) {
+80104365:	83 c4 10             	add    $0x10,%esp
+  log.lh.n = lh->n;
+80104368:	8b 98 a8 00 00 00    	mov    0xa8(%eax),%ebx
+8010436e:	89 1d b4 3a 1a 80    	mov    %ebx,0x801a3ab4
+  for (i = 0; i < log.lh.n; i++) {
+80104374:	85 db                	test   %ebx,%ebx
+80104376:	7e 1d                	jle    80104395 <initlog+0x75>
+80104378:	31 d2                	xor    %edx,%edx
+8010437a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    log.lh.block[i] = lh->block[i];
+80104380:	8b 8c 90 ac 00 00 00 	mov    0xac(%eax,%edx,4),%ecx
+80104387:	89 0c 95 b8 3a 1a 80 	mov    %ecx,-0x7fe5c548(,%edx,4)
+  for (i = 0; i < log.lh.n; i++) {
+8010438e:	83 c2 01             	add    $0x1,%edx
+80104391:	39 d3                	cmp    %edx,%ebx
+80104393:	75 eb                	jne    80104380 <initlog+0x60>
+  brelse(buf);
+80104395:	83 ec 0c             	sub    $0xc,%esp
+80104398:	50                   	push   %eax
+80104399:	e8 a2 cc ff ff       	call   80101040 <brelse>
+
+static void
+recover_from_log(void)
+{
+  read_head();
+  install_trans(); // if committed, copy from log to disk
+8010439e:	e8 1d fe ff ff       	call   801041c0 <install_trans>
+  log.lh.n = 0;
+801043a3:	c7 05 b4 3a 1a 80 00 	movl   $0x0,0x801a3ab4
+801043aa:	00 00 00 
+  write_head(); // clear the log
+801043ad:	e8 0e ff ff ff       	call   801042c0 <write_head>
+}
+801043b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801043b5:	83 c4 10             	add    $0x10,%esp
+801043b8:	c9                   	leave
+801043b9:	c3                   	ret
+801043ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801043c0 <begin_op>:
+}
+
+// called at the start of each FS system call.
+void
+begin_op(void)
+{
+801043c0:	55                   	push   %ebp
+801043c1:	89 e5                	mov    %esp,%ebp
+801043c3:	83 ec 14             	sub    $0x14,%esp
+  acquire(&log.lock);
+801043c6:	68 40 3a 1a 80       	push   $0x801a3a40
+801043cb:	e8 a0 2c 00 00       	call   80107070 <acquire>
+801043d0:	83 c4 10             	add    $0x10,%esp
+801043d3:	eb 18                	jmp    801043ed <begin_op+0x2d>
+801043d5:	8d 76 00             	lea    0x0(%esi),%esi
+  while(1){
+    if(log.committing){
+      sleep(&log, &log.lock);
+801043d8:	83 ec 08             	sub    $0x8,%esp
+801043db:	68 40 3a 1a 80       	push   $0x801a3a40
+801043e0:	68 40 3a 1a 80       	push   $0x801a3a40
+801043e5:	e8 56 1c 00 00       	call   80106040 <sleep>
+801043ea:	83 c4 10             	add    $0x10,%esp
+    if(log.committing){
+801043ed:	a1 ac 3a 1a 80       	mov    0x801a3aac,%eax
+801043f2:	85 c0                	test   %eax,%eax
+801043f4:	75 e2                	jne    801043d8 <begin_op+0x18>
+    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
+801043f6:	a1 a8 3a 1a 80       	mov    0x801a3aa8,%eax
+801043fb:	8b 15 b4 3a 1a 80    	mov    0x801a3ab4,%edx
+80104401:	83 c0 01             	add    $0x1,%eax
+80104404:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+80104407:	8d 14 4a             	lea    (%edx,%ecx,2),%edx
+8010440a:	83 fa 1e             	cmp    $0x1e,%edx
+8010440d:	7f c9                	jg     801043d8 <begin_op+0x18>
+      // this op might exhaust log space; wait for commit.
+      sleep(&log, &log.lock);
+    } else {
+      log.outstanding += 1;
+      release(&log.lock);
+8010440f:	83 ec 0c             	sub    $0xc,%esp
+      log.outstanding += 1;
+80104412:	a3 a8 3a 1a 80       	mov    %eax,0x801a3aa8
+      release(&log.lock);
+80104417:	68 40 3a 1a 80       	push   $0x801a3a40
+8010441c:	e8 df 2a 00 00       	call   80106f00 <release>
+      break;
+    }
+  }
+}
+80104421:	83 c4 10             	add    $0x10,%esp
+80104424:	c9                   	leave
+80104425:	c3                   	ret
+80104426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010442d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80104430 <end_op>:
+
+// called at the end of each FS system call.
+// commits if this was the last outstanding operation.
+void
+end_op(void)
+{
+80104430:	55                   	push   %ebp
+80104431:	89 e5                	mov    %esp,%ebp
+80104433:	57                   	push   %edi
+80104434:	56                   	push   %esi
+80104435:	53                   	push   %ebx
+80104436:	83 ec 58             	sub    $0x58,%esp
+  int do_commit = 0;
+
+  acquire(&log.lock);
+80104439:	68 40 3a 1a 80       	push   $0x801a3a40
+8010443e:	e8 2d 2c 00 00       	call   80107070 <acquire>
+  log.outstanding -= 1;
+80104443:	a1 a8 3a 1a 80       	mov    0x801a3aa8,%eax
+  if(log.committing)
+80104448:	8b 0d ac 3a 1a 80    	mov    0x801a3aac,%ecx
+8010444e:	83 c4 10             	add    $0x10,%esp
+  log.outstanding -= 1;
+80104451:	83 e8 01             	sub    $0x1,%eax
+80104454:	a3 a8 3a 1a 80       	mov    %eax,0x801a3aa8
+  if(log.committing)
+80104459:	85 c9                	test   %ecx,%ecx
+8010445b:	0f 85 83 01 00 00    	jne    801045e4 <end_op+0x1b4>
+    panic("log.committing");
+  if(log.outstanding == 0){
+80104461:	85 c0                	test   %eax,%eax
+80104463:	0f 85 57 01 00 00    	jne    801045c0 <end_op+0x190>
+    do_commit = 1;
+    log.committing = 1;
+80104469:	c7 05 ac 3a 1a 80 01 	movl   $0x1,0x801a3aac
+80104470:	00 00 00 
+    // begin_op() may be waiting for log space,
+    // and decrementing log.outstanding has decreased
+    // the amount of reserved space.
+    wakeup(&log);
+  }
+  release(&log.lock);
+80104473:	83 ec 0c             	sub    $0xc,%esp
+80104476:	68 40 3a 1a 80       	push   $0x801a3a40
+8010447b:	e8 80 2a 00 00       	call   80106f00 <release>
+}
+
+static void
+commit()
+{
+  if (log.lh.n > 0) {
+80104480:	a1 b4 3a 1a 80       	mov    0x801a3ab4,%eax
+80104485:	83 c4 10             	add    $0x10,%esp
+80104488:	85 c0                	test   %eax,%eax
+8010448a:	7f 44                	jg     801044d0 <end_op+0xa0>
+    acquire(&log.lock);
+8010448c:	83 ec 0c             	sub    $0xc,%esp
+8010448f:	68 40 3a 1a 80       	push   $0x801a3a40
+80104494:	e8 d7 2b 00 00       	call   80107070 <acquire>
+    log.committing = 0;
+80104499:	c7 05 ac 3a 1a 80 00 	movl   $0x0,0x801a3aac
+801044a0:	00 00 00 
+    wakeup(&log);
+801044a3:	c7 04 24 40 3a 1a 80 	movl   $0x801a3a40,(%esp)
+801044aa:	e8 41 1c 00 00       	call   801060f0 <wakeup>
+    release(&log.lock);
+801044af:	c7 04 24 40 3a 1a 80 	movl   $0x801a3a40,(%esp)
+801044b6:	e8 45 2a 00 00       	call   80106f00 <release>
+801044bb:	83 c4 10             	add    $0x10,%esp
+}
+801044be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801044c1:	5b                   	pop    %ebx
+801044c2:	5e                   	pop    %esi
+801044c3:	5f                   	pop    %edi
+801044c4:	5d                   	pop    %ebp
+801044c5:	c3                   	ret
+801044c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801044cd:	8d 76 00             	lea    0x0(%esi),%esi
+  for (tail = 0; tail < log.lh.n; tail += n) {
+801044d0:	31 c9                	xor    %ecx,%ecx
+    if (n > LOGBATCH)
+801044d2:	ba 0a 00 00 00       	mov    $0xa,%edx
+    n = log.lh.n - tail;
+801044d7:	29 c8                	sub    %ecx,%eax
+    for (i = 0; i < n; i++) {
+801044d9:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+    if (n > LOGBATCH)
+801044dc:	39 d0                	cmp    %edx,%eax
+801044de:	0f 4f c2             	cmovg  %edx,%eax
+    for (i = 0; i < n; i++) {
+801044e1:	8d 14 8d 00 00 00 00 	lea    0x0(,%ecx,4),%edx
+801044e8:	31 db                	xor    %ebx,%ebx
+801044ea:	89 55 ac             	mov    %edx,-0x54(%ebp)
+801044ed:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+      to[i] = bread(log.dev, log.start+tail+i+1); // log block
+801044f0:	8b 45 b0             	mov    -0x50(%ebp),%eax
+801044f3:	03 05 a0 3a 1a 80    	add    0x801a3aa0,%eax
+801044f9:	83 ec 08             	sub    $0x8,%esp
+801044fc:	8d 44 03 01          	lea    0x1(%ebx,%eax,1),%eax
+80104500:	50                   	push   %eax
+80104501:	ff 35 b0 3a 1a 80    	push   0x801a3ab0
+80104507:	e8 24 c9 ff ff       	call   80100e30 <bread>
+8010450c:	89 44 9d c0          	mov    %eax,-0x40(%ebp,%ebx,4)
+80104510:	89 c6                	mov    %eax,%esi
+      struct buf *from = bread(log.dev, log.lh.block[tail+i]); // cache block
+80104512:	58                   	pop    %eax
+80104513:	8b 45 ac             	mov    -0x54(%ebp),%eax
+80104516:	5a                   	pop    %edx
+80104517:	ff b4 98 b8 3a 1a 80 	push   -0x7fe5c548(%eax,%ebx,4)
+    for (i = 0; i < n; i++) {
+8010451e:	83 c3 01             	add    $0x1,%ebx
+      struct buf *from = bread(log.dev, log.lh.block[tail+i]); // cache block
+80104521:	ff 35 b0 3a 1a 80    	push   0x801a3ab0
+80104527:	e8 04 c9 ff ff       	call   80100e30 <bread>
+      memmove(to[i]->data, from->data, BSIZE);
+8010452c:	83 c4 0c             	add    $0xc,%esp
+      struct buf *from = bread(log.dev, log.lh.block[tail+i]); // cache block
+8010452f:	89 c7                	mov    %eax,%edi
+      memmove(to[i]->data, from->data, BSIZE);
+80104531:	8d 80 a8 00 00 00    	lea    0xa8(%eax),%eax
+80104537:	68 00 02 00 00       	push   $0x200
+8010453c:	50                   	push   %eax
+8010453d:	8d 86 a8 00 00 00    	lea    0xa8(%esi),%eax
+80104543:	50                   	push   %eax
+80104544:	e8 07 2f 00 00       	call   80107450 <memmove>
+      brelse(from);
+80104549:	89 3c 24             	mov    %edi,(%esp)
+8010454c:	e8 ef ca ff ff       	call   80101040 <brelse>
+      bwrite_async(to[i]);  // write the log
+80104551:	89 34 24             	mov    %esi,(%esp)
+80104554:	e8 17 ca ff ff       	call   80100f70 <bwrite_async>
+    for (i = 0; i < n; i++) {
+80104559:	83 c4 10             	add    $0x10,%esp
+8010455c:	39 5d b4             	cmp    %ebx,-0x4c(%ebp)
+8010455f:	75 8f                	jne    801044f0 <end_op+0xc0>
+80104561:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+80104564:	8d 75 c0             	lea    -0x40(%ebp),%esi
+80104567:	8d 5c 85 c0          	lea    -0x40(%ebp,%eax,4),%ebx
+8010456b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010456f:	90                   	nop
+      bwait(to[i]);
+80104570:	8b 3e                	mov    (%esi),%edi
+80104572:	83 ec 0c             	sub    $0xc,%esp
+    for (i = 0; i < n; i++) {
+80104575:	83 c6 04             	add    $0x4,%esi
+      bwait(to[i]);
+80104578:	57                   	push   %edi
+80104579:	e8 e2 c7 ff ff       	call   80100d60 <bwait>
+      brelse(to[i]);
+8010457e:	89 3c 24             	mov    %edi,(%esp)
+80104581:	e8 ba ca ff ff       	call   80101040 <brelse>
+    for (i = 0; i < n; i++) {
+80104586:	83 c4 10             	add    $0x10,%esp
+80104589:	39 f3                	cmp    %esi,%ebx
+8010458b:	75 e3                	jne    80104570 <end_op+0x140>
+  for (tail = 0; tail < log.lh.n; tail += n) {
+8010458d:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+80104590:	8b 4d b0             	mov    -0x50(%ebp),%ecx
+80104593:	01 c1                	add    %eax,%ecx
+80104595:	a1 b4 3a 1a 80       	mov    0x801a3ab4,%eax
+8010459a:	39 c8                	cmp    %ecx,%eax
+8010459c:	0f 8f 30 ff ff ff    	jg     801044d2 <end_op+0xa2>
+    write_log();     // Write modified blocks from cache to log
+    write_head();    // Write header to disk -- the real commit
+801045a2:	e8 19 fd ff ff       	call   801042c0 <write_head>
+    install_trans(); // Now install writes to home locations
+801045a7:	e8 14 fc ff ff       	call   801041c0 <install_trans>
+    log.lh.n = 0;
+801045ac:	c7 05 b4 3a 1a 80 00 	movl   $0x0,0x801a3ab4
+801045b3:	00 00 00 
+    write_head();    // Erase the transaction from the log
+801045b6:	e8 05 fd ff ff       	call   801042c0 <write_head>
+801045bb:	e9 cc fe ff ff       	jmp    8010448c <end_op+0x5c>
+    wakeup(&log);
+801045c0:	83 ec 0c             	sub    $0xc,%esp
+801045c3:	68 40 3a 1a 80       	push   $0x801a3a40
+801045c8:	e8 23 1b 00 00       	call   801060f0 <wakeup>
+  release(&log.lock);
+801045cd:	c7 04 24 40 3a 1a 80 	movl   $0x801a3a40,(%esp)
+801045d4:	e8 27 29 00 00       	call   80106f00 <release>
+801045d9:	83 c4 10             	add    $0x10,%esp
+}
+801045dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801045df:	5b                   	pop    %ebx
+801045e0:	5e                   	pop    %esi
+801045e1:	5f                   	pop    %edi
+801045e2:	5d                   	pop    %ebp
+801045e3:	c3                   	ret
+    panic("log.committing");
+801045e4:	83 ec 0c             	sub    $0xc,%esp
+801045e7:	68 c4 ba 10 80       	push   $0x8010bac4
+801045ec:	e8 cf ce ff ff       	call   801014c0 <panic>
+801045f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801045f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801045ff:	90                   	nop
+
+80104600 <log_write>:
+//   modify bp->data[]
+//   log_write(bp)
+//   brelse(bp)
+void
+log_write(struct buf *b)
+{
+80104600:	55                   	push   %ebp
+80104601:	89 e5                	mov    %esp,%ebp
+80104603:	53                   	push   %ebx
+80104604:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+80104607:	8b 15 b4 3a 1a 80    	mov    0x801a3ab4,%edx
+{
+8010460d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+80104610:	83 fa 1d             	cmp    $0x1d,%edx
+80104613:	7f 7d                	jg     80104692 <log_write+0x92>
+80104615:	a1 a4 3a 1a 80       	mov    0x801a3aa4,%eax
+8010461a:	83 e8 01             	sub    $0x1,%eax
+8010461d:	39 c2                	cmp    %eax,%edx
+8010461f:	7d 71                	jge    80104692 <log_write+0x92>
+    panic("too big a transaction");
+  if (log.outstanding < 1)
+80104621:	a1 a8 3a 1a 80       	mov    0x801a3aa8,%eax
+80104626:	85 c0                	test   %eax,%eax
+80104628:	7e 75                	jle    8010469f <log_write+0x9f>
+    panic("log_write outside of trans");
+
+  acquire(&log.lock);
+8010462a:	83 ec 0c             	sub    $0xc,%esp
+8010462d:	68 40 3a 1a 80       	push   $0x801a3a40
+80104632:	e8 39 2a 00 00       	call   80107070 <acquire>
+  for (i = 0; i < log.lh.n; i++) {
+    if (log.lh.block[i] == b->blockno)   // log absorbtion
+80104637:	8b 4b 08             	mov    0x8(%ebx),%ecx
+  for (i = 0; i < log.lh.n; i++) {
+8010463a:	83 c4 10             	add    $0x10,%esp
+8010463d:	31 c0                	xor    %eax,%eax
+8010463f:	8b 15 b4 3a 1a 80    	mov    0x801a3ab4,%edx
+80104645:	85 d2                	test   %edx,%edx
+80104647:	7f 0e                	jg     80104657 <log_write+0x57>
+80104649:	eb 15                	jmp    80104660 <log_write+0x60>
+8010464b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010464f:	90                   	nop
+80104650:	83 c0 01             	add    $0x1,%eax
+80104653:	39 c2                	cmp    %eax,%edx
+80104655:	74 29                	je     80104680 <log_write+0x80>
+    if (log.lh.block[i] == b->blockno)   // log absorbtion
+80104657:	39 0c 85 b8 3a 1a 80 	cmp    %ecx,-0x7fe5c548(,%eax,4)
+8010465e:	75 f0                	jne    80104650 <log_write+0x50>
+      break;
+  }
+  log.lh.block[i] = b->blockno;
+80104660:	89 0c 85 b8 3a 1a 80 	mov    %ecx,-0x7fe5c548(,%eax,4)
+  if (i == log.lh.n)
+80104667:	39 c2                	cmp    %eax,%edx
+80104669:	74 1c                	je     80104687 <log_write+0x87>
+    log.lh.n++;
+  b->flags |= B_DIRTY; // prevent eviction
+8010466b:	83 0b 04             	orl    $0x4,(%ebx)
+  release(&log.lock);
+}
+8010466e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  release(&log.lock);
+80104671:	c7 45 08 40 3a 1a 80 	movl   $0x801a3a40,0x8(%ebp)
+}
+80104678:	c9                   	leave
+  release(&log.lock);
+80104679:	e9 82 28 00 00       	jmp    80106f00 <release>
+8010467e:	66 90                	xchg   %ax,%ax
+  log.lh.block[i] = b->blockno;
+80104680:	89 0c 95 b8 3a 1a 80 	mov    %ecx,-0x7fe5c548(,%edx,4)
+    log.lh.n++;
+80104687:	83 c2 01             	add    $0x1,%edx
+8010468a:	89 15 b4 3a 1a 80    	mov    %edx,0x801a3ab4
+80104690:	eb d9                	jmp    8010466b <log_write+0x6b>
+    panic("too big a transaction");
+80104692:	83 ec 0c             	sub    $0xc,%esp
+80104695:	68 d3 ba 10 80       	push   $0x8010bad3
+8010469a:	e8 21 ce ff ff       	call   801014c0 <panic>
+    panic("log_write outside of trans");
+8010469f:	83 ec 0c             	sub    $0xc,%esp
+801046a2:	68 e9 ba 10 80       	push   $0x8010bae9
+801046a7:	e8 14 ce ff ff       	call   801014c0 <panic>
+801046ac:	66 90                	xchg   %ax,%ax
+801046ae:	66 90                	xchg   %ax,%ax
+
+801046b0 <mpmain>:
+}
+
+// Common CPU setup code.
+static void
+mpmain(void)
+{
+801046b0:	55                   	push   %ebp
+801046b1:	89 e5                	mov    %esp,%ebp
+801046b3:	53                   	push   %ebx
+801046b4:	83 ec 04             	sub    $0x4,%esp
+  cprintf("cpu%d: starting %d\n", cpuid(), cpuid());
+801046b7:	e8 04 0f 00 00       	call   801055c0 <cpuid>
+801046bc:	89 c3                	mov    %eax,%ebx
+801046be:	e8 fd 0e 00 00       	call   801055c0 <cpuid>
+801046c3:	83 ec 04             	sub    $0x4,%esp
+801046c6:	53                   	push   %ebx
+801046c7:	50                   	push   %eax
+801046c8:	68 04 bb 10 80       	push   $0x8010bb04
+801046cd:	e8 1e d1 ff ff       	call   801017f0 <cprintf>
+  idtinit();       // load idt register
+801046d2:	e8 e9 4c 00 00       	call   801093c0 <idtinit>
+  timerinit();     // this CPU's one-shot timer
+801046d7:	e8 64 45 00 00       	call   80108c40 <timerinit>
+  xchg(&(mycpu()->started), 1); // tell startothers() we're up
+801046dc:	e8 ff 0e 00 00       	call   801055e0 <mycpu>
+801046e1:	89 c2                	mov    %eax,%edx
+  asm volatile("lock; xchgl %0, %1" :
+801046e3:	b8 01 00 00 00       	mov    $0x1,%eax
+801046e8:	f0 87 82 b0 00 00 00 	lock xchg %eax,0xb0(%edx)
+  scheduler();     // start running processes
+801046ef:	e8 dc 14 00 00       	call   80105bd0 <scheduler>
+801046f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801046fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801046ff:	90                   	nop
+
+80104700 <mpenter>:
+{
+80104700:	55                   	push   %ebp
+80104701:	89 e5                	mov    %esp,%ebp
+80104703:	83 ec 08             	sub    $0x8,%esp
+  switchkvm();
+80104706:	e8 f5 63 00 00       	call   8010ab00 <switchkvm>
+  seginit();
+8010470b:	e8 b0 61 00 00       	call   8010a8c0 <seginit>
+  lapicinit();
+80104710:	e8 8b f5 ff ff       	call   80103ca0 <lapicinit>
+  mpmain();
+80104715:	e8 96 ff ff ff       	call   801046b0 <mpmain>
+8010471a:	66 90                	xchg   %ax,%ax
+8010471c:	66 90                	xchg   %ax,%ax
+8010471e:	66 90                	xchg   %ax,%ax
+
+80104720 <main>:
+{
+80104720:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+80104724:	83 e4 f0             	and    $0xfffffff0,%esp
+80104727:	ff 71 fc             	push   -0x4(%ecx)
+8010472a:	55                   	push   %ebp
+8010472b:	89 e5                	mov    %esp,%ebp
+8010472d:	53                   	push   %ebx
+8010472e:	51                   	push   %ecx
+  kinit1(end, P2V(4*1024*1024)); // phys page allocator
+8010472f:	83 ec 08             	sub    $0x8,%esp
+80104732:	68 00 00 40 80       	push   $0x80400000
+80104737:	68 f0 49 1c 80       	push   $0x801c49f0
+8010473c:	e8 0f f3 ff ff       	call   80103a50 <kinit1>
+  kvmalloc();      // kernel page table
+80104741:	e8 2a 69 00 00       	call   8010b070 <kvmalloc>
+  mpinit();        // detect other processors
+80104746:	e8 a5 01 00 00       	call   801048f0 <mpinit>
+  lapicinit();     // interrupt controller
+8010474b:	e8 50 f5 ff ff       	call   80103ca0 <lapicinit>
+  seginit();       // segment descriptors
+80104750:	e8 6b 61 00 00       	call   8010a8c0 <seginit>
+  picinit();       // disable pic
+80104755:	e8 a6 03 00 00       	call   80104b00 <picinit>
+  ioapicinit();    // another interrupt controller
+8010475a:	e8 b1 f0 ff ff       	call   80103810 <ioapicinit>
+  consoleinit();   // console hardware
+8010475f:	e8 7c d4 ff ff       	call   80101be0 <consoleinit>
+  uartinit();      // serial port
+80104764:	e8 97 4f 00 00       	call   80109700 <uartinit>
+  pinit();         // process table
+80104769:	e8 32 0e 00 00       	call   801055a0 <pinit>
+  tvinit();        // trap vectors
+8010476e:	e8 cd 4b 00 00       	call   80109340 <tvinit>
+  binit();         // buffer cache
+80104773:	e8 d8 c3 ff ff       	call   80100b50 <binit>
+  fileinit();      // file table
+80104778:	e8 f3 d9 ff ff       	call   80102170 <fileinit>
+  pciinit();       // PCI devices
+8010477d:	e8 1e 04 00 00       	call   80104ba0 <pciinit>
+  ideinit();       // disk 
+80104782:	e8 b9 6d 00 00       	call   8010b540 <ideinit>
+  virtioinit();    // virtio disk, if any
+80104787:	e8 54 5b 00 00       	call   8010a2e0 <virtioinit>
+
+  // Write entry code to unused memory at 0x7000.
+  // The linker has placed the image of entryother.S in
+  // _binary_entryother_start.
+  code = P2V(0x7000);
+  memmove(code, _binary_entryother_start, (uint)_binary_entryother_size);
+8010478c:	83 c4 0c             	add    $0xc,%esp
+8010478f:	68 8a 00 00 00       	push   $0x8a
+80104794:	68 8c f4 10 80       	push   $0x8010f48c
+80104799:	68 00 70 00 80       	push   $0x80007000
+8010479e:	e8 ad 2c 00 00       	call   80107450 <memmove>
+
+  for(c = cpus; c < cpus+ncpu; c++){
+801047a3:	83 c4 10             	add    $0x10,%esp
+801047a6:	69 05 44 3b 1a 80 c4 	imul   $0xc4,0x801a3b44,%eax
+801047ad:	00 00 00 
+801047b0:	05 60 3b 1a 80       	add    $0x801a3b60,%eax
+801047b5:	3d 60 3b 1a 80       	cmp    $0x801a3b60,%eax
+801047ba:	76 7c                	jbe    80104838 <main+0x118>
+801047bc:	bb 60 3b 1a 80       	mov    $0x801a3b60,%ebx
+801047c1:	eb 1e                	jmp    801047e1 <main+0xc1>
+801047c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801047c7:	90                   	nop
+801047c8:	69 05 44 3b 1a 80 c4 	imul   $0xc4,0x801a3b44,%eax
+801047cf:	00 00 00 
+801047d2:	81 c3 c4 00 00 00    	add    $0xc4,%ebx
+801047d8:	05 60 3b 1a 80       	add    $0x801a3b60,%eax
+801047dd:	39 c3                	cmp    %eax,%ebx
+801047df:	73 57                	jae    80104838 <main+0x118>
+    if(c == mycpu())  // We've started already.
+801047e1:	e8 fa 0d 00 00       	call   801055e0 <mycpu>
+801047e6:	39 c3                	cmp    %eax,%ebx
+801047e8:	74 de                	je     801047c8 <main+0xa8>
+      continue;
+
+    // Tell entryother.S what stack to use, where to enter, and what
+    // pgdir to use. We cannot use kpgdir yet, because the AP processor
+    // is running in low  memory, so we use entrypgdir for the APs too.
+    stack = kalloc();
+801047ea:	e8 d1 f2 ff ff       	call   80103ac0 <kalloc>
+    *(void**)(code-4) = stack + KSTACKSIZE;
+    *(void(**)(void))(code-8) = mpenter;
+    *(int**)(code-12) = (void *) V2P(entrypgdir);
+
+    lapicstartap(c->apicid, V2P(code));
+801047ef:	83 ec 08             	sub    $0x8,%esp
+    *(void(**)(void))(code-8) = mpenter;
+801047f2:	c7 05 f8 6f 00 80 00 	movl   $0x80104700,0x80006ff8
+801047f9:	47 10 80 
+    *(int**)(code-12) = (void *) V2P(entrypgdir);
+801047fc:	c7 05 f4 6f 00 80 00 	movl   $0x10e000,0x80006ff4
+80104803:	e0 10 00 
+    *(void**)(code-4) = stack + KSTACKSIZE;
+80104806:	05 00 10 00 00       	add    $0x1000,%eax
+8010480b:	a3 fc 6f 00 80       	mov    %eax,0x80006ffc
+    lapicstartap(c->apicid, V2P(code));
+80104810:	0f b6 43 08          	movzbl 0x8(%ebx),%eax
+80104814:	68 00 70 00 00       	push   $0x7000
+80104819:	50                   	push   %eax
+8010481a:	e8 21 f7 ff ff       	call   80103f40 <lapicstartap>
+
+    // wait for cpu to finish mpmain()
+    while(c->started == 0)
+8010481f:	83 c4 10             	add    $0x10,%esp
+80104822:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80104828:	8b 83 b0 00 00 00    	mov    0xb0(%ebx),%eax
+8010482e:	85 c0                	test   %eax,%eax
+80104830:	74 f6                	je     80104828 <main+0x108>
+80104832:	eb 94                	jmp    801047c8 <main+0xa8>
+80104834:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+80104838:	83 ec 08             	sub    $0x8,%esp
+8010483b:	68 00 00 00 8e       	push   $0x8e000000
+80104840:	68 00 00 40 80       	push   $0x80400000
+80104845:	e8 a6 f1 ff ff       	call   801039f0 <kinit2>
+  userinit();      // first user process
+8010484a:	e8 81 0e 00 00       	call   801056d0 <userinit>
+  wqinit(&syswq, "kworker", 1); // deferred work
+8010484f:	83 c4 0c             	add    $0xc,%esp
+80104852:	6a 01                	push   $0x1
+80104854:	68 18 bb 10 80       	push   $0x8010bb18
+80104859:	68 80 39 1c 80       	push   $0x801c3980
+8010485e:	e8 fd 6b 00 00       	call   8010b460 <wqinit>
+  aioinit();       // asynchronous I/O threads
+80104863:	e8 f8 b9 ff ff       	call   80100260 <aioinit>
+  mpmain();        // finish this processor's setup
+80104868:	e8 43 fe ff ff       	call   801046b0 <mpmain>
+8010486d:	66 90                	xchg   %ax,%ax
+8010486f:	90                   	nop
+
+80104870 <mpsearch1>:
+}
+
+// Look for an MP structure in the len bytes at addr.
+static struct mp*
+mpsearch1(uint a, int len)
+{
+80104870:	55                   	push   %ebp
+80104871:	89 e5                	mov    %esp,%ebp
+80104873:	57                   	push   %edi
+80104874:	56                   	push   %esi
+  uchar *e, *p, *addr;
+
+  addr = P2V(a);
+80104875:	8d b0 00 00 00 80    	lea    -0x80000000(%eax),%esi
+{
+8010487b:	53                   	push   %ebx
+  e = addr+len;
+8010487c:	8d 1c 16             	lea    (%esi,%edx,1),%ebx
+{
+8010487f:	83 ec 0c             	sub    $0xc,%esp
+  for(p = addr; p < e; p += sizeof(struct mp))
+80104882:	39 de                	cmp    %ebx,%esi
+80104884:	72 10                	jb     80104896 <mpsearch1+0x26>
+80104886:	eb 50                	jmp    801048d8 <mpsearch1+0x68>
+80104888:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010488f:	90                   	nop
+80104890:	89 fe                	mov    %edi,%esi
+80104892:	39 df                	cmp    %ebx,%edi
+80104894:	73 42                	jae    801048d8 <mpsearch1+0x68>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+80104896:	83 ec 04             	sub    $0x4,%esp
+80104899:	8d 7e 10             	lea    0x10(%esi),%edi
+8010489c:	6a 04                	push   $0x4
+8010489e:	68 20 bb 10 80       	push   $0x8010bb20
+801048a3:	56                   	push   %esi
+801048a4:	e8 57 2b 00 00       	call   80107400 <memcmp>
+801048a9:	83 c4 10             	add    $0x10,%esp
+801048ac:	85 c0                	test   %eax,%eax
+801048ae:	75 e0                	jne    80104890 <mpsearch1+0x20>
+801048b0:	89 f2                	mov    %esi,%edx
+801048b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    sum += addr[i];
+801048b8:	0f b6 0a             	movzbl (%edx),%ecx
+  for(i=0; i<len; i++)
+801048bb:	83 c2 01             	add    $0x1,%edx
+    sum += addr[i];
+801048be:	01 c8                	add    %ecx,%eax
+  for(i=0; i<len; i++)
+801048c0:	39 fa                	cmp    %edi,%edx
+801048c2:	75 f4                	jne    801048b8 <mpsearch1+0x48>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+801048c4:	84 c0                	test   %al,%al
+801048c6:	75 c8                	jne    80104890 <mpsearch1+0x20>
+      return (struct mp*)p;
+  return 0;
+}
+801048c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801048cb:	89 f0                	mov    %esi,%eax
+801048cd:	5b                   	pop    %ebx
+801048ce:	5e                   	pop    %esi
+801048cf:	5f                   	pop    %edi
+801048d0:	5d                   	pop    %ebp
+801048d1:	c3                   	ret
+801048d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+801048d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+801048db:	31 f6                	xor    %esi,%esi
+}
+801048dd:	5b                   	pop    %ebx
+801048de:	89 f0                	mov    %esi,%eax
+801048e0:	5e                   	pop    %esi
+801048e1:	5f                   	pop    %edi
+801048e2:	5d                   	pop    %ebp
+801048e3:	c3                   	ret
+801048e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801048eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801048ef:	90                   	nop
+
+801048f0 <mpinit>:
+  return conf;
+}
+
+void
+mpinit(void)
+{
+801048f0:	55                   	push   %ebp
+801048f1:	89 e5                	mov    %esp,%ebp
+801048f3:	57                   	push   %edi
+801048f4:	56                   	push   %esi
+801048f5:	53                   	push   %ebx
+801048f6:	83 ec 1c             	sub    $0x1c,%esp
+  if((p = ((bda[0x0F]<<8)| bda[0x0E]) << 4)){
+801048f9:	0f b6 05 0f 04 00 80 	movzbl 0x8000040f,%eax
+80104900:	0f b6 15 0e 04 00 80 	movzbl 0x8000040e,%edx
+80104907:	c1 e0 08             	shl    $0x8,%eax
+8010490a:	09 d0                	or     %edx,%eax
+8010490c:	c1 e0 04             	shl    $0x4,%eax
+8010490f:	75 1b                	jne    8010492c <mpinit+0x3c>
+    p = ((bda[0x14]<<8)|bda[0x13])*1024;
+80104911:	0f b6 05 14 04 00 80 	movzbl 0x80000414,%eax
+80104918:	0f b6 15 13 04 00 80 	movzbl 0x80000413,%edx
+8010491f:	c1 e0 08             	shl    $0x8,%eax
+80104922:	09 d0                	or     %edx,%eax
+80104924:	c1 e0 0a             	shl    $0xa,%eax
+    if((mp = mpsearch1(p-1024, 1024)))
+80104927:	2d 00 04 00 00       	sub    $0x400,%eax
+    if((mp = mpsearch1(p, 1024)))
+8010492c:	ba 00 04 00 00       	mov    $0x400,%edx
+80104931:	e8 3a ff ff ff       	call   80104870 <mpsearch1>
+80104936:	89 c3                	mov    %eax,%ebx
+80104938:	85 c0                	test   %eax,%eax
+8010493a:	0f 84 50 01 00 00    	je     80104a90 <mpinit+0x1a0>
+  if((mp = mpsearch()) == 0 || mp->physaddr == 0)
+80104940:	8b 73 04             	mov    0x4(%ebx),%esi
+80104943:	85 f6                	test   %esi,%esi
+80104945:	0f 84 35 01 00 00    	je     80104a80 <mpinit+0x190>
+  if(memcmp(conf, "PCMP", 4) != 0)
+8010494b:	83 ec 04             	sub    $0x4,%esp
+  conf = (struct mpconf*) P2V((uint) mp->physaddr);
+8010494e:	8d 86 00 00 00 80    	lea    -0x80000000(%esi),%eax
+80104954:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(memcmp(conf, "PCMP", 4) != 0)
+80104957:	6a 04                	push   $0x4
+80104959:	68 25 bb 10 80       	push   $0x8010bb25
+8010495e:	50                   	push   %eax
+8010495f:	e8 9c 2a 00 00       	call   80107400 <memcmp>
+80104964:	83 c4 10             	add    $0x10,%esp
+80104967:	85 c0                	test   %eax,%eax
+80104969:	0f 85 11 01 00 00    	jne    80104a80 <mpinit+0x190>
+  if(conf->version != 1 && conf->version != 4)
+8010496f:	0f b6 86 06 00 00 80 	movzbl -0x7ffffffa(%esi),%eax
+80104976:	3c 01                	cmp    $0x1,%al
+80104978:	74 08                	je     80104982 <mpinit+0x92>
+8010497a:	3c 04                	cmp    $0x4,%al
+8010497c:	0f 85 fe 00 00 00    	jne    80104a80 <mpinit+0x190>
+  if(sum((uchar*)conf, conf->length) != 0)
+80104982:	0f b7 96 04 00 00 80 	movzwl -0x7ffffffc(%esi),%edx
+  for(i=0; i<len; i++)
+80104989:	66 85 d2             	test   %dx,%dx
+8010498c:	74 22                	je     801049b0 <mpinit+0xc0>
+8010498e:	8d 3c 32             	lea    (%edx,%esi,1),%edi
+80104991:	89 f0                	mov    %esi,%eax
+  sum = 0;
+80104993:	31 d2                	xor    %edx,%edx
+80104995:	8d 76 00             	lea    0x0(%esi),%esi
+    sum += addr[i];
+80104998:	0f b6 88 00 00 00 80 	movzbl -0x80000000(%eax),%ecx
+  for(i=0; i<len; i++)
+8010499f:	83 c0 01             	add    $0x1,%eax
+    sum += addr[i];
+801049a2:	01 ca                	add    %ecx,%edx
+  for(i=0; i<len; i++)
+801049a4:	39 c7                	cmp    %eax,%edi
+801049a6:	75 f0                	jne    80104998 <mpinit+0xa8>
+  if(sum((uchar*)conf, conf->length) != 0)
+801049a8:	84 d2                	test   %dl,%dl
+801049aa:	0f 85 d0 00 00 00    	jne    80104a80 <mpinit+0x190>
+  struct mpioapic *ioapic;
+
+  if((conf = mpconfig(&mp)) == 0)
+    panic("Expect to run on an SMP");
+  ismp = 1;
+  lapic = (uint*)conf->lapicaddr;
+801049b0:	8b 86 24 00 00 80    	mov    -0x7fffffdc(%esi),%eax
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+801049b6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+801049b9:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  lapic = (uint*)conf->lapicaddr;
+801049bc:	a3 38 3a 1a 80       	mov    %eax,0x801a3a38
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+801049c1:	0f b7 96 04 00 00 80 	movzwl -0x7ffffffc(%esi),%edx
+801049c8:	8d 86 2c 00 00 80    	lea    -0x7fffffd4(%esi),%eax
+  ismp = 1;
+801049ce:	be 01 00 00 00       	mov    $0x1,%esi
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+801049d3:	01 d7                	add    %edx,%edi
+801049d5:	89 fa                	mov    %edi,%edx
+801049d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801049de:	66 90                	xchg   %ax,%ax
+801049e0:	39 d0                	cmp    %edx,%eax
+801049e2:	73 15                	jae    801049f9 <mpinit+0x109>
+    switch(*p){
+801049e4:	0f b6 08             	movzbl (%eax),%ecx
+801049e7:	80 f9 02             	cmp    $0x2,%cl
+801049ea:	74 54                	je     80104a40 <mpinit+0x150>
+801049ec:	77 42                	ja     80104a30 <mpinit+0x140>
+801049ee:	84 c9                	test   %cl,%cl
+801049f0:	74 5e                	je     80104a50 <mpinit+0x160>
+      p += sizeof(struct mpioapic);
+      continue;
+    case MPBUS:
+    case MPIOINTR:
+    case MPLINTR:
+      p += 8;
+801049f2:	83 c0 08             	add    $0x8,%eax
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+801049f5:	39 d0                	cmp    %edx,%eax
+801049f7:	72 eb                	jb     801049e4 <mpinit+0xf4>
+    default:
+      ismp = 0;
+      break;
+    }
+  }
+  if(!ismp)
+801049f9:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+801049fc:	85 f6                	test   %esi,%esi
+801049fe:	0f 84 e1 00 00 00    	je     80104ae5 <mpinit+0x1f5>
+    panic("Didn't find a suitable machine");
+
+  if(mp->imcrp){
+80104a04:	80 7b 0c 00          	cmpb   $0x0,0xc(%ebx)
+80104a08:	74 15                	je     80104a1f <mpinit+0x12f>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104a0a:	b8 70 00 00 00       	mov    $0x70,%eax
+80104a0f:	ba 22 00 00 00       	mov    $0x22,%edx
+80104a14:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104a15:	ba 23 00 00 00       	mov    $0x23,%edx
+80104a1a:	ec                   	in     (%dx),%al
+    // Bochs doesn't support IMCR, so this doesn't run on Bochs.
+    // But it would on real hardware.
+    outb(0x22, 0x70);   // Select IMCR
+    outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+80104a1b:	83 c8 01             	or     $0x1,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104a1e:	ee                   	out    %al,(%dx)
+  }
+}
+80104a1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104a22:	5b                   	pop    %ebx
+80104a23:	5e                   	pop    %esi
+80104a24:	5f                   	pop    %edi
+80104a25:	5d                   	pop    %ebp
+80104a26:	c3                   	ret
+80104a27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104a2e:	66 90                	xchg   %ax,%ax
+    switch(*p){
+80104a30:	83 e9 03             	sub    $0x3,%ecx
+80104a33:	80 f9 01             	cmp    $0x1,%cl
+80104a36:	76 ba                	jbe    801049f2 <mpinit+0x102>
+80104a38:	31 f6                	xor    %esi,%esi
+80104a3a:	eb a4                	jmp    801049e0 <mpinit+0xf0>
+80104a3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      ioapicid = ioapic->apicno;
+80104a40:	0f b6 48 01          	movzbl 0x1(%eax),%ecx
+      p += sizeof(struct mpioapic);
+80104a44:	83 c0 08             	add    $0x8,%eax
+      ioapicid = ioapic->apicno;
+80104a47:	88 0d 40 3b 1a 80    	mov    %cl,0x801a3b40
+      continue;
+80104a4d:	eb 91                	jmp    801049e0 <mpinit+0xf0>
+80104a4f:	90                   	nop
+      if(ncpu < NCPU) {
+80104a50:	8b 0d 44 3b 1a 80    	mov    0x801a3b44,%ecx
+80104a56:	83 f9 07             	cmp    $0x7,%ecx
+80104a59:	7f 19                	jg     80104a74 <mpinit+0x184>
+        cpus[ncpu].apicid = proc->apicid;  // apicid may differ from ncpu
+80104a5b:	69 f9 c4 00 00 00    	imul   $0xc4,%ecx,%edi
+80104a61:	0f b6 58 01          	movzbl 0x1(%eax),%ebx
+        ncpu++;
+80104a65:	83 c1 01             	add    $0x1,%ecx
+80104a68:	89 0d 44 3b 1a 80    	mov    %ecx,0x801a3b44
+        cpus[ncpu].apicid = proc->apicid;  // apicid may differ from ncpu
+80104a6e:	88 9f 68 3b 1a 80    	mov    %bl,-0x7fe5c498(%edi)
+      p += sizeof(struct mpproc);
+80104a74:	83 c0 14             	add    $0x14,%eax
+      continue;
+80104a77:	e9 64 ff ff ff       	jmp    801049e0 <mpinit+0xf0>
+80104a7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    panic("Expect to run on an SMP");
+80104a80:	83 ec 0c             	sub    $0xc,%esp
+80104a83:	68 2a bb 10 80       	push   $0x8010bb2a
+80104a88:	e8 33 ca ff ff       	call   801014c0 <panic>
+80104a8d:	8d 76 00             	lea    0x0(%esi),%esi
+{
+80104a90:	bb 00 00 0f 80       	mov    $0x800f0000,%ebx
+80104a95:	eb 13                	jmp    80104aaa <mpinit+0x1ba>
+80104a97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104a9e:	66 90                	xchg   %ax,%ax
+  for(p = addr; p < e; p += sizeof(struct mp))
+80104aa0:	89 f3                	mov    %esi,%ebx
+80104aa2:	81 fe 00 00 10 80    	cmp    $0x80100000,%esi
+80104aa8:	74 d6                	je     80104a80 <mpinit+0x190>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+80104aaa:	83 ec 04             	sub    $0x4,%esp
+80104aad:	8d 73 10             	lea    0x10(%ebx),%esi
+80104ab0:	6a 04                	push   $0x4
+80104ab2:	68 20 bb 10 80       	push   $0x8010bb20
+80104ab7:	53                   	push   %ebx
+80104ab8:	e8 43 29 00 00       	call   80107400 <memcmp>
+80104abd:	83 c4 10             	add    $0x10,%esp
+80104ac0:	85 c0                	test   %eax,%eax
+80104ac2:	75 dc                	jne    80104aa0 <mpinit+0x1b0>
+80104ac4:	89 da                	mov    %ebx,%edx
+80104ac6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104acd:	8d 76 00             	lea    0x0(%esi),%esi
+    sum += addr[i];
+80104ad0:	0f b6 0a             	movzbl (%edx),%ecx
+  for(i=0; i<len; i++)
+80104ad3:	83 c2 01             	add    $0x1,%edx
+    sum += addr[i];
+80104ad6:	01 c8                	add    %ecx,%eax
+  for(i=0; i<len; i++)
+80104ad8:	39 f2                	cmp    %esi,%edx
+80104ada:	75 f4                	jne    80104ad0 <mpinit+0x1e0>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+80104adc:	84 c0                	test   %al,%al
+80104ade:	75 c0                	jne    80104aa0 <mpinit+0x1b0>
+80104ae0:	e9 5b fe ff ff       	jmp    80104940 <mpinit+0x50>
+    panic("Didn't find a suitable machine");
+80104ae5:	83 ec 0c             	sub    $0xc,%esp
+80104ae8:	68 44 bb 10 80       	push   $0x8010bb44
+80104aed:	e8 ce c9 ff ff       	call   801014c0 <panic>
+80104af2:	66 90                	xchg   %ax,%ax
+80104af4:	66 90                	xchg   %ax,%ax
+80104af6:	66 90                	xchg   %ax,%ax
+80104af8:	66 90                	xchg   %ax,%ax
+80104afa:	66 90                	xchg   %ax,%ax
+80104afc:	66 90                	xchg   %ax,%ax
+80104afe:	66 90                	xchg   %ax,%ax
+
+80104b00 <picinit>:
+80104b00:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104b05:	ba 21 00 00 00       	mov    $0x21,%edx
+80104b0a:	ee                   	out    %al,(%dx)
+80104b0b:	ba a1 00 00 00       	mov    $0xa1,%edx
+80104b10:	ee                   	out    %al,(%dx)
+picinit(void)
+{
+  // mask all interrupts
+  outb(IO_PIC1+1, 0xFF);
+  outb(IO_PIC2+1, 0xFF);
+}
+80104b11:	c3                   	ret
+80104b12:	66 90                	xchg   %ax,%ax
+80104b14:	66 90                	xchg   %ax,%ax
+80104b16:	66 90                	xchg   %ax,%ax
+80104b18:	66 90                	xchg   %ax,%ax
+80104b1a:	66 90                	xchg   %ax,%ax
+80104b1c:	66 90                	xchg   %ax,%ax
+80104b1e:	66 90                	xchg   %ax,%ax
+
+80104b20 <pciread>:
+  return 0x80000000 | (bus<<16) | (dev<<11) | (func<<8) | (off & 0xfc);
+}
+
+uint
+pciread(struct pcidev *d, int off)
+{
+80104b20:	55                   	push   %ebp
+80104b21:	89 e5                	mov    %esp,%ebp
+80104b23:	8b 55 08             	mov    0x8(%ebp),%edx
+  outl(CONFADDR, confaddr(d->bus, d->dev, d->func, off));
+80104b26:	0f b6 02             	movzbl (%edx),%eax
+80104b29:	0f b6 4a 02          	movzbl 0x2(%edx),%ecx
+80104b2d:	0f b6 52 01          	movzbl 0x1(%edx),%edx
+  return 0x80000000 | (bus<<16) | (dev<<11) | (func<<8) | (off & 0xfc);
+80104b31:	c1 e1 08             	shl    $0x8,%ecx
+80104b34:	c1 e0 10             	shl    $0x10,%eax
+80104b37:	09 c8                	or     %ecx,%eax
+80104b39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80104b3c:	c1 e2 0b             	shl    $0xb,%edx
+80104b3f:	81 e1 fc 00 00 00    	and    $0xfc,%ecx
+80104b45:	09 c8                	or     %ecx,%eax
+80104b47:	09 d0                	or     %edx,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104b49:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+80104b4e:	0d 00 00 00 80       	or     $0x80000000,%eax
+80104b53:	ef                   	out    %eax,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104b54:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+80104b59:	ed                   	in     (%dx),%eax
+  return inl(CONFDATA);
+}
+80104b5a:	5d                   	pop    %ebp
+80104b5b:	c3                   	ret
+80104b5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80104b60 <pciwrite>:
+
+void
+pciwrite(struct pcidev *d, int off, uint val)
+{
+80104b60:	55                   	push   %ebp
+80104b61:	89 e5                	mov    %esp,%ebp
+80104b63:	8b 55 08             	mov    0x8(%ebp),%edx
+  outl(CONFADDR, confaddr(d->bus, d->dev, d->func, off));
+80104b66:	0f b6 02             	movzbl (%edx),%eax
+80104b69:	0f b6 4a 02          	movzbl 0x2(%edx),%ecx
+80104b6d:	0f b6 52 01          	movzbl 0x1(%edx),%edx
+  return 0x80000000 | (bus<<16) | (dev<<11) | (func<<8) | (off & 0xfc);
+80104b71:	c1 e1 08             	shl    $0x8,%ecx
+80104b74:	c1 e0 10             	shl    $0x10,%eax
+80104b77:	09 c8                	or     %ecx,%eax
+80104b79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80104b7c:	c1 e2 0b             	shl    $0xb,%edx
+80104b7f:	81 e1 fc 00 00 00    	and    $0xfc,%ecx
+80104b85:	09 c8                	or     %ecx,%eax
+80104b87:	09 d0                	or     %edx,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104b89:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+80104b8e:	0d 00 00 00 80       	or     $0x80000000,%eax
+80104b93:	ef                   	out    %eax,(%dx)
+80104b94:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+80104b99:	8b 45 10             	mov    0x10(%ebp),%eax
+80104b9c:	ef                   	out    %eax,(%dx)
+  outl(CONFDATA, val);
+}
+80104b9d:	5d                   	pop    %ebp
+80104b9e:	c3                   	ret
+80104b9f:	90                   	nop
+
+80104ba0 <pciinit>:
+  return inl(CONFDATA);
+}
+
+void
+pciinit(void)
+{
+80104ba0:	55                   	push   %ebp
+  struct pcidev *d;
+  int bus, dev, func, nfunc, i;
+  uint id, class;
+
+  for(bus = 0; bus < 256; bus++){
+    for(dev = 0; dev < 32; dev++){
+80104ba1:	31 d2                	xor    %edx,%edx
+{
+80104ba3:	89 e5                	mov    %esp,%ebp
+80104ba5:	57                   	push   %edi
+80104ba6:	56                   	push   %esi
+80104ba7:	53                   	push   %ebx
+80104ba8:	83 ec 20             	sub    $0x20,%esp
+  for(bus = 0; bus < 256; bus++){
+80104bab:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+80104bb2:	8b 0d 80 41 1a 80    	mov    0x801a4180,%ecx
+    for(dev = 0; dev < 32; dev++){
+80104bb8:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+80104bbb:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+80104bc2:	89 d6                	mov    %edx,%esi
+80104bc4:	c1 e3 10             	shl    $0x10,%ebx
+80104bc7:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+80104bca:	89 cb                	mov    %ecx,%ebx
+      nfunc = 1;
+      for(func = 0; func < nfunc; func++){
+80104bcc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80104bcf:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      nfunc = 1;
+80104bd2:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+80104bd9:	c1 e0 0b             	shl    $0xb,%eax
+80104bdc:	09 c7                	or     %eax,%edi
+80104bde:	89 7d e8             	mov    %edi,-0x18(%ebp)
+80104be1:	81 cf 0c 00 00 80    	or     $0x8000000c,%edi
+80104be7:	89 7d d8             	mov    %edi,-0x28(%ebp)
+      for(func = 0; func < nfunc; func++){
+80104bea:	31 ff                	xor    %edi,%edi
+80104bec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  outl(CONFADDR, confaddr(bus, dev, func, off));
+80104bf0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+80104bf3:	89 f9                	mov    %edi,%ecx
+80104bf5:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+80104bfa:	c1 e1 08             	shl    $0x8,%ecx
+80104bfd:	09 c1                	or     %eax,%ecx
+80104bff:	89 c8                	mov    %ecx,%eax
+80104c01:	0d 00 00 00 80       	or     $0x80000000,%eax
+80104c06:	ef                   	out    %eax,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104c07:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+80104c0c:	ed                   	in     (%dx),%eax
+80104c0d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+        id = confread(bus, dev, func, PCI_ID);
+        if((id & 0xffff) == 0xffff)
+80104c10:	0f b7 c0             	movzwl %ax,%eax
+80104c13:	3d ff ff 00 00       	cmp    $0xffff,%eax
+80104c18:	0f 84 ce 00 00 00    	je     80104cec <pciinit+0x14c>
+          continue;
+        // Bit 7 of the header type marks a multi-function device.
+        if(func == 0 && (confread(bus, dev, 0, PCI_HEADER) & 0x800000))
+80104c1e:	85 ff                	test   %edi,%edi
+80104c20:	75 20                	jne    80104c42 <pciinit+0xa2>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104c22:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80104c25:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+80104c2a:	ef                   	out    %eax,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104c2b:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+80104c30:	ed                   	in     (%dx),%eax
+          nfunc = 8;
+80104c31:	a9 00 00 80 00       	test   $0x800000,%eax
+80104c36:	b8 08 00 00 00       	mov    $0x8,%eax
+80104c3b:	0f 44 45 f0          	cmove  -0x10(%ebp),%eax
+80104c3f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(npci == NPCI)
+80104c42:	83 fb 20             	cmp    $0x20,%ebx
+80104c45:	0f 84 e5 00 00 00    	je     80104d30 <pciinit+0x190>
+          return;
+        d = &pcidevs[npci++];
+        d->bus = bus;
+80104c4b:	0f b6 55 dc          	movzbl -0x24(%ebp),%edx
+        d = &pcidevs[npci++];
+80104c4f:	8d 43 01             	lea    0x1(%ebx),%eax
+80104c52:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        d->bus = bus;
+80104c55:	8d 04 db             	lea    (%ebx,%ebx,8),%eax
+80104c58:	88 14 85 a0 41 1a 80 	mov    %dl,-0x7fe5be60(,%eax,4)
+80104c5f:	8d 1c 85 00 00 00 00 	lea    0x0(,%eax,4),%ebx
+        d->dev = dev;
+80104c66:	0f b6 45 e0          	movzbl -0x20(%ebp),%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104c6a:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+        d->bus = bus;
+80104c6f:	8d b3 a0 41 1a 80    	lea    -0x7fe5be60(%ebx),%esi
+        d->dev = dev;
+80104c75:	88 46 01             	mov    %al,0x1(%esi)
+        d->func = func;
+80104c78:	89 f8                	mov    %edi,%eax
+80104c7a:	88 46 02             	mov    %al,0x2(%esi)
+        d->vendor = id & 0xffff;
+80104c7d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+80104c80:	89 46 04             	mov    %eax,0x4(%esi)
+80104c83:	89 c8                	mov    %ecx,%eax
+80104c85:	0d 08 00 00 80       	or     $0x80000008,%eax
+80104c8a:	ef                   	out    %eax,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104c8b:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+80104c90:	ed                   	in     (%dx),%eax
+        d->device = id >> 16;
+        class = confread(bus, dev, func, PCI_CLASS);
+        d->class = class >> 24;
+80104c91:	89 c2                	mov    %eax,%edx
+        d->subclass = class >> 16;
+        d->progif = class >> 8;
+80104c93:	88 66 0a             	mov    %ah,0xa(%esi)
+        d->class = class >> 24;
+80104c96:	c1 ea 18             	shr    $0x18,%edx
+80104c99:	88 56 08             	mov    %dl,0x8(%esi)
+        d->subclass = class >> 16;
+80104c9c:	89 c2                	mov    %eax,%edx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104c9e:	89 c8                	mov    %ecx,%eax
+80104ca0:	c1 ea 10             	shr    $0x10,%edx
+80104ca3:	0d 3c 00 00 80       	or     $0x8000003c,%eax
+80104ca8:	88 56 09             	mov    %dl,0x9(%esi)
+80104cab:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+80104cb0:	ef                   	out    %eax,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104cb1:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+80104cb6:	ed                   	in     (%dx),%eax
+        d->irq = confread(bus, dev, func, PCI_INTR);
+80104cb7:	88 46 0b             	mov    %al,0xb(%esi)
+80104cba:	be 10 00 00 00       	mov    $0x10,%esi
+80104cbf:	90                   	nop
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104cc0:	89 c8                	mov    %ecx,%eax
+80104cc2:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+80104cc7:	09 f0                	or     %esi,%eax
+80104cc9:	0d 00 00 00 80       	or     $0x80000000,%eax
+80104cce:	ef                   	out    %eax,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104ccf:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+80104cd4:	ed                   	in     (%dx),%eax
+        for(i = 0; i < 6; i++)
+          d->bar[i] = confread(bus, dev, func, PCI_BAR0 + 4*i);
+80104cd5:	89 84 33 9c 41 1a 80 	mov    %eax,-0x7fe5be64(%ebx,%esi,1)
+        for(i = 0; i < 6; i++)
+80104cdc:	83 c6 04             	add    $0x4,%esi
+80104cdf:	83 fe 28             	cmp    $0x28,%esi
+80104ce2:	75 dc                	jne    80104cc0 <pciinit+0x120>
+        d = &pcidevs[npci++];
+80104ce4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80104ce7:	be 01 00 00 00       	mov    $0x1,%esi
+      for(func = 0; func < nfunc; func++){
+80104cec:	83 c7 01             	add    $0x1,%edi
+80104cef:	39 7d f0             	cmp    %edi,-0x10(%ebp)
+80104cf2:	0f 8f f8 fe ff ff    	jg     80104bf0 <pciinit+0x50>
+    for(dev = 0; dev < 32; dev++){
+80104cf8:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+80104cfc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80104cff:	83 f8 20             	cmp    $0x20,%eax
+80104d02:	0f 85 c4 fe ff ff    	jne    80104bcc <pciinit+0x2c>
+  for(bus = 0; bus < 256; bus++){
+80104d08:	83 45 dc 01          	addl   $0x1,-0x24(%ebp)
+80104d0c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80104d0f:	89 f2                	mov    %esi,%edx
+80104d11:	89 d9                	mov    %ebx,%ecx
+80104d13:	3d 00 01 00 00       	cmp    $0x100,%eax
+80104d18:	0f 85 9a fe ff ff    	jne    80104bb8 <pciinit+0x18>
+80104d1e:	84 d2                	test   %dl,%dl
+80104d20:	74 1e                	je     80104d40 <pciinit+0x1a0>
+80104d22:	89 1d 80 41 1a 80    	mov    %ebx,0x801a4180
+80104d28:	eb 16                	jmp    80104d40 <pciinit+0x1a0>
+80104d2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80104d30:	89 f0                	mov    %esi,%eax
+80104d32:	84 c0                	test   %al,%al
+80104d34:	74 0a                	je     80104d40 <pciinit+0x1a0>
+80104d36:	c7 05 80 41 1a 80 20 	movl   $0x20,0x801a4180
+80104d3d:	00 00 00 
+      }
+    }
+  }
+}
+80104d40:	83 c4 20             	add    $0x20,%esp
+80104d43:	5b                   	pop    %ebx
+80104d44:	5e                   	pop    %esi
+80104d45:	5f                   	pop    %edi
+80104d46:	5d                   	pop    %ebp
+80104d47:	c3                   	ret
+80104d48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104d4f:	90                   	nop
+
+80104d50 <pcifind>:
+
+// Find the first function of the given class and subclass.
+struct pcidev*
+pcifind(int class, int subclass)
+{
+80104d50:	55                   	push   %ebp
+  struct pcidev *d;
+
+  for(d = pcidevs; d < &pcidevs[npci]; d++)
+80104d51:	a1 80 41 1a 80       	mov    0x801a4180,%eax
+80104d56:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+{
+80104d59:	89 e5                	mov    %esp,%ebp
+  for(d = pcidevs; d < &pcidevs[npci]; d++)
+80104d5b:	8d 0c 85 a0 41 1a 80 	lea    -0x7fe5be60(,%eax,4),%ecx
+{
+80104d62:	56                   	push   %esi
+80104d63:	53                   	push   %ebx
+80104d64:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80104d67:	8b 75 0c             	mov    0xc(%ebp),%esi
+  for(d = pcidevs; d < &pcidevs[npci]; d++)
+80104d6a:	81 f9 a0 41 1a 80    	cmp    $0x801a41a0,%ecx
+80104d70:	76 2e                	jbe    80104da0 <pcifind+0x50>
+80104d72:	b8 a0 41 1a 80       	mov    $0x801a41a0,%eax
+80104d77:	eb 0e                	jmp    80104d87 <pcifind+0x37>
+80104d79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104d80:	83 c0 24             	add    $0x24,%eax
+80104d83:	39 c8                	cmp    %ecx,%eax
+80104d85:	73 19                	jae    80104da0 <pcifind+0x50>
+    if(d->class == class && d->subclass == subclass)
+80104d87:	0f b6 50 08          	movzbl 0x8(%eax),%edx
+80104d8b:	39 da                	cmp    %ebx,%edx
+80104d8d:	75 f1                	jne    80104d80 <pcifind+0x30>
+80104d8f:	0f b6 50 09          	movzbl 0x9(%eax),%edx
+80104d93:	39 f2                	cmp    %esi,%edx
+80104d95:	75 e9                	jne    80104d80 <pcifind+0x30>
+      return d;
+  return 0;
+}
+80104d97:	5b                   	pop    %ebx
+80104d98:	5e                   	pop    %esi
+80104d99:	5d                   	pop    %ebp
+80104d9a:	c3                   	ret
+80104d9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104d9f:	90                   	nop
+80104da0:	5b                   	pop    %ebx
+  return 0;
+80104da1:	31 c0                	xor    %eax,%eax
+}
+80104da3:	5e                   	pop    %esi
+80104da4:	5d                   	pop    %ebp
+80104da5:	c3                   	ret
+80104da6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104dad:	8d 76 00             	lea    0x0(%esi),%esi
+
+80104db0 <pcifindid>:
+
+// Find the first function with the given vendor and device IDs.
+struct pcidev*
+pcifindid(int vendor, int device)
+{
+80104db0:	55                   	push   %ebp
+  struct pcidev *d;
+
+  for(d = pcidevs; d < &pcidevs[npci]; d++)
+80104db1:	a1 80 41 1a 80       	mov    0x801a4180,%eax
+80104db6:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+{
+80104db9:	89 e5                	mov    %esp,%ebp
+  for(d = pcidevs; d < &pcidevs[npci]; d++)
+80104dbb:	8d 0c 85 a0 41 1a 80 	lea    -0x7fe5be60(,%eax,4),%ecx
+{
+80104dc2:	56                   	push   %esi
+80104dc3:	53                   	push   %ebx
+80104dc4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80104dc7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  for(d = pcidevs; d < &pcidevs[npci]; d++)
+80104dca:	81 f9 a0 41 1a 80    	cmp    $0x801a41a0,%ecx
+80104dd0:	76 2e                	jbe    80104e00 <pcifindid+0x50>
+80104dd2:	b8 a0 41 1a 80       	mov    $0x801a41a0,%eax
+80104dd7:	eb 0e                	jmp    80104de7 <pcifindid+0x37>
+80104dd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104de0:	83 c0 24             	add    $0x24,%eax
+80104de3:	39 c8                	cmp    %ecx,%eax
+80104de5:	73 19                	jae    80104e00 <pcifindid+0x50>
+    if(d->vendor == vendor && d->device == device)
+80104de7:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+80104deb:	39 da                	cmp    %ebx,%edx
+80104ded:	75 f1                	jne    80104de0 <pcifindid+0x30>
+80104def:	0f b7 50 06          	movzwl 0x6(%eax),%edx
+80104df3:	39 f2                	cmp    %esi,%edx
+80104df5:	75 e9                	jne    80104de0 <pcifindid+0x30>
+      return d;
+  return 0;
+}
+80104df7:	5b                   	pop    %ebx
+80104df8:	5e                   	pop    %esi
+80104df9:	5d                   	pop    %ebp
+80104dfa:	c3                   	ret
+80104dfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104dff:	90                   	nop
+80104e00:	5b                   	pop    %ebx
+  return 0;
+80104e01:	31 c0                	xor    %eax,%eax
+}
+80104e03:	5e                   	pop    %esi
+80104e04:	5d                   	pop    %ebp
+80104e05:	c3                   	ret
+80104e06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104e0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80104e10 <pcibusmaster>:
+
+// Let d respond to I/O accesses and do DMA.
+void
+pcibusmaster(struct pcidev *d)
+{
+80104e10:	55                   	push   %ebp
+80104e11:	89 e5                	mov    %esp,%ebp
+80104e13:	57                   	push   %edi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104e14:	bf f8 0c 00 00       	mov    $0xcf8,%edi
+80104e19:	56                   	push   %esi
+80104e1a:	53                   	push   %ebx
+80104e1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  outl(CONFADDR, confaddr(d->bus, d->dev, d->func, off));
+80104e1e:	0f b6 08             	movzbl (%eax),%ecx
+80104e21:	0f b6 50 02          	movzbl 0x2(%eax),%edx
+80104e25:	0f b6 40 01          	movzbl 0x1(%eax),%eax
+  return 0x80000000 | (bus<<16) | (dev<<11) | (func<<8) | (off & 0xfc);
+80104e29:	c1 e2 08             	shl    $0x8,%edx
+80104e2c:	c1 e1 10             	shl    $0x10,%ecx
+80104e2f:	09 d1                	or     %edx,%ecx
+80104e31:	c1 e0 0b             	shl    $0xb,%eax
+80104e34:	89 fa                	mov    %edi,%edx
+80104e36:	09 c1                	or     %eax,%ecx
+80104e38:	81 c9 04 00 00 80    	or     $0x80000004,%ecx
+80104e3e:	89 c8                	mov    %ecx,%eax
+80104e40:	ef                   	out    %eax,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104e41:	be fc 0c 00 00       	mov    $0xcfc,%esi
+80104e46:	89 f2                	mov    %esi,%edx
+80104e48:	ed                   	in     (%dx),%eax
+80104e49:	89 c3                	mov    %eax,%ebx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104e4b:	89 fa                	mov    %edi,%edx
+80104e4d:	89 c8                	mov    %ecx,%eax
+80104e4f:	ef                   	out    %eax,(%dx)
+  uint cmd;
+
+  // The status register in the top half clears bits written as 1.
+  cmd = pciread(d, PCI_COMMAND) & 0xffff;
+80104e50:	0f b7 c3             	movzwl %bx,%eax
+80104e53:	89 f2                	mov    %esi,%edx
+  pciwrite(d, PCI_COMMAND, cmd | PCI_CMD_IO | PCI_CMD_MEM | PCI_CMD_MASTER);
+80104e55:	83 c8 07             	or     $0x7,%eax
+80104e58:	ef                   	out    %eax,(%dx)
+}
+80104e59:	5b                   	pop    %ebx
+80104e5a:	5e                   	pop    %esi
+80104e5b:	5f                   	pop    %edi
+80104e5c:	5d                   	pop    %ebp
+80104e5d:	c3                   	ret
+80104e5e:	66 90                	xchg   %ax,%ax
+
+80104e60 <pipealloc>:
+  int writeopen;  // write fd is still open
+};
+
+int
+pipealloc(struct file **f0, struct file **f1)
+{
+80104e60:	55                   	push   %ebp
+80104e61:	89 e5                	mov    %esp,%ebp
+80104e63:	57                   	push   %edi
+80104e64:	56                   	push   %esi
+80104e65:	53                   	push   %ebx
+80104e66:	83 ec 0c             	sub    $0xc,%esp
+80104e69:	8b 75 08             	mov    0x8(%ebp),%esi
+80104e6c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  struct pipe *p;
+
+  p = 0;
+  *f0 = *f1 = 0;
+80104e6f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+80104e75:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if((*f0 = filealloc()) == 0 || (*f1 = filealloc()) == 0)
+80104e7b:	e8 10 d3 ff ff       	call   80102190 <filealloc>
+80104e80:	89 06                	mov    %eax,(%esi)
+80104e82:	85 c0                	test   %eax,%eax
+80104e84:	0f 84 a5 00 00 00    	je     80104f2f <pipealloc+0xcf>
+80104e8a:	e8 01 d3 ff ff       	call   80102190 <filealloc>
+80104e8f:	89 07                	mov    %eax,(%edi)
+80104e91:	85 c0                	test   %eax,%eax
+80104e93:	0f 84 84 00 00 00    	je     80104f1d <pipealloc+0xbd>
+    goto bad;
+  if((p = (struct pipe*)kalloc()) == 0)
+80104e99:	e8 22 ec ff ff       	call   80103ac0 <kalloc>
+80104e9e:	89 c3                	mov    %eax,%ebx
+80104ea0:	85 c0                	test   %eax,%eax
+80104ea2:	0f 84 a0 00 00 00    	je     80104f48 <pipealloc+0xe8>
+    goto bad;
+  p->readopen = 1;
+80104ea8:	c7 80 68 02 00 00 01 	movl   $0x1,0x268(%eax)
+80104eaf:	00 00 00 
+  p->writeopen = 1;
+  p->nwrite = 0;
+  p->nread = 0;
+  initlock(&p->lock, "pipe");
+80104eb2:	83 ec 08             	sub    $0x8,%esp
+  p->writeopen = 1;
+80104eb5:	c7 80 6c 02 00 00 01 	movl   $0x1,0x26c(%eax)
+80104ebc:	00 00 00 
+  p->nwrite = 0;
+80104ebf:	c7 80 64 02 00 00 00 	movl   $0x0,0x264(%eax)
+80104ec6:	00 00 00 
+  p->nread = 0;
+80104ec9:	c7 80 60 02 00 00 00 	movl   $0x0,0x260(%eax)
+80104ed0:	00 00 00 
+  initlock(&p->lock, "pipe");
+80104ed3:	68 63 bb 10 80       	push   $0x8010bb63
+80104ed8:	50                   	push   %eax
+80104ed9:	e8 82 1a 00 00       	call   80106960 <initlock>
+  (*f0)->type = FD_PIPE;
+80104ede:	8b 06                	mov    (%esi),%eax
+  (*f0)->pipe = p;
+  (*f1)->type = FD_PIPE;
+  (*f1)->readable = 0;
+  (*f1)->writable = 1;
+  (*f1)->pipe = p;
+  return 0;
+80104ee0:	83 c4 10             	add    $0x10,%esp
+  (*f0)->type = FD_PIPE;
+80104ee3:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f0)->readable = 1;
+80104ee9:	8b 06                	mov    (%esi),%eax
+80104eeb:	c6 40 08 01          	movb   $0x1,0x8(%eax)
+  (*f0)->writable = 0;
+80104eef:	8b 06                	mov    (%esi),%eax
+80104ef1:	c6 40 09 00          	movb   $0x0,0x9(%eax)
+  (*f0)->pipe = p;
+80104ef5:	8b 06                	mov    (%esi),%eax
+80104ef7:	89 58 0c             	mov    %ebx,0xc(%eax)
+  (*f1)->type = FD_PIPE;
+80104efa:	8b 07                	mov    (%edi),%eax
+80104efc:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f1)->readable = 0;
+80104f02:	8b 07                	mov    (%edi),%eax
+80104f04:	c6 40 08 00          	movb   $0x0,0x8(%eax)
+  (*f1)->writable = 1;
+80104f08:	8b 07                	mov    (%edi),%eax
+80104f0a:	c6 40 09 01          	movb   $0x1,0x9(%eax)
+  (*f1)->pipe = p;
+80104f0e:	8b 07                	mov    (%edi),%eax
+80104f10:	89 58 0c             	mov    %ebx,0xc(%eax)
+  return 0;
+80104f13:	31 c0                	xor    %eax,%eax
+  if(*f0)
+    fileclose(*f0);
+  if(*f1)
+    fileclose(*f1);
+  return -1;
+}
+80104f15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104f18:	5b                   	pop    %ebx
+80104f19:	5e                   	pop    %esi
+80104f1a:	5f                   	pop    %edi
+80104f1b:	5d                   	pop    %ebp
+80104f1c:	c3                   	ret
+  if(*f0)
+80104f1d:	8b 06                	mov    (%esi),%eax
+80104f1f:	85 c0                	test   %eax,%eax
+80104f21:	74 1e                	je     80104f41 <pipealloc+0xe1>
+    fileclose(*f0);
+80104f23:	83 ec 0c             	sub    $0xc,%esp
+80104f26:	50                   	push   %eax
+80104f27:	e8 24 d3 ff ff       	call   80102250 <fileclose>
+80104f2c:	83 c4 10             	add    $0x10,%esp
+  if(*f1)
+80104f2f:	8b 07                	mov    (%edi),%eax
+80104f31:	85 c0                	test   %eax,%eax
+80104f33:	74 0c                	je     80104f41 <pipealloc+0xe1>
+    fileclose(*f1);
+80104f35:	83 ec 0c             	sub    $0xc,%esp
+80104f38:	50                   	push   %eax
+80104f39:	e8 12 d3 ff ff       	call   80102250 <fileclose>
+80104f3e:	83 c4 10             	add    $0x10,%esp
+  return -1;
+80104f41:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104f46:	eb cd                	jmp    80104f15 <pipealloc+0xb5>
+  if(*f0)
+80104f48:	8b 06                	mov    (%esi),%eax
+80104f4a:	85 c0                	test   %eax,%eax
+80104f4c:	75 d5                	jne    80104f23 <pipealloc+0xc3>
+80104f4e:	eb df                	jmp    80104f2f <pipealloc+0xcf>
+
+80104f50 <pipeclose>:
+
+void
+pipeclose(struct pipe *p, int writable)
+{
+80104f50:	55                   	push   %ebp
+80104f51:	89 e5                	mov    %esp,%ebp
+80104f53:	56                   	push   %esi
+80104f54:	53                   	push   %ebx
+80104f55:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80104f58:	8b 75 0c             	mov    0xc(%ebp),%esi
+  acquire(&p->lock);
+80104f5b:	83 ec 0c             	sub    $0xc,%esp
+80104f5e:	53                   	push   %ebx
+80104f5f:	e8 0c 21 00 00       	call   80107070 <acquire>
+  if(writable){
+80104f64:	83 c4 10             	add    $0x10,%esp
+80104f67:	85 f6                	test   %esi,%esi
+80104f69:	74 6d                	je     80104fd8 <pipeclose+0x88>
+    p->writeopen = 0;
+    wakeup(&p->nread);
+80104f6b:	83 ec 0c             	sub    $0xc,%esp
+80104f6e:	8d 83 60 02 00 00    	lea    0x260(%ebx),%eax
+    p->writeopen = 0;
+80104f74:	c7 83 6c 02 00 00 00 	movl   $0x0,0x26c(%ebx)
+80104f7b:	00 00 00 
+    wakeup(&p->nread);
+80104f7e:	50                   	push   %eax
+80104f7f:	e8 6c 11 00 00       	call   801060f0 <wakeup>
+80104f84:	83 c4 10             	add    $0x10,%esp
+  } else {
+    p->readopen = 0;
+    wakeup(&p->nwrite);
+  }
+  if(p->readopen == 0 && p->writeopen == 0){
+80104f87:	8b 93 68 02 00 00    	mov    0x268(%ebx),%edx
+80104f8d:	85 d2                	test   %edx,%edx
+80104f8f:	75 0a                	jne    80104f9b <pipeclose+0x4b>
+80104f91:	8b 83 6c 02 00 00    	mov    0x26c(%ebx),%eax
+80104f97:	85 c0                	test   %eax,%eax
+80104f99:	74 15                	je     80104fb0 <pipeclose+0x60>
+    release(&p->lock);
+    freelock(&p->lock);
+    kfree((char*)p);
+  } else
+    release(&p->lock);
+80104f9b:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+80104f9e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104fa1:	5b                   	pop    %ebx
+80104fa2:	5e                   	pop    %esi
+80104fa3:	5d                   	pop    %ebp
+    release(&p->lock);
+80104fa4:	e9 57 1f 00 00       	jmp    80106f00 <release>
+80104fa9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    release(&p->lock);
+80104fb0:	83 ec 0c             	sub    $0xc,%esp
+80104fb3:	53                   	push   %ebx
+80104fb4:	e8 47 1f 00 00       	call   80106f00 <release>
+    freelock(&p->lock);
+80104fb9:	89 1c 24             	mov    %ebx,(%esp)
+80104fbc:	e8 ff 1a 00 00       	call   80106ac0 <freelock>
+    kfree((char*)p);
+80104fc1:	89 5d 08             	mov    %ebx,0x8(%ebp)
+80104fc4:	83 c4 10             	add    $0x10,%esp
+}
+80104fc7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104fca:	5b                   	pop    %ebx
+80104fcb:	5e                   	pop    %esi
+80104fcc:	5d                   	pop    %ebp
+    kfree((char*)p);
+80104fcd:	e9 1e e9 ff ff       	jmp    801038f0 <kfree>
+80104fd2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wakeup(&p->nwrite);
+80104fd8:	83 ec 0c             	sub    $0xc,%esp
+80104fdb:	8d 83 64 02 00 00    	lea    0x264(%ebx),%eax
+    p->readopen = 0;
+80104fe1:	c7 83 68 02 00 00 00 	movl   $0x0,0x268(%ebx)
+80104fe8:	00 00 00 
+    wakeup(&p->nwrite);
+80104feb:	50                   	push   %eax
+80104fec:	e8 ff 10 00 00       	call   801060f0 <wakeup>
+80104ff1:	83 c4 10             	add    $0x10,%esp
+80104ff4:	eb 91                	jmp    80104f87 <pipeclose+0x37>
+80104ff6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104ffd:	8d 76 00             	lea    0x0(%esi),%esi
+
+80105000 <pipewrite>:
+
+//PAGEBREAK: 40
+int
+pipewrite(struct pipe *p, char *addr, int n)
+{
+80105000:	55                   	push   %ebp
+80105001:	89 e5                	mov    %esp,%ebp
+80105003:	57                   	push   %edi
+80105004:	56                   	push   %esi
+80105005:	53                   	push   %ebx
+80105006:	83 ec 28             	sub    $0x28,%esp
+80105009:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010500c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  int i;
+
+  acquire(&p->lock);
+8010500f:	53                   	push   %ebx
+80105010:	e8 5b 20 00 00       	call   80107070 <acquire>
+  for(i = 0; i < n; i++){
+80105015:	83 c4 10             	add    $0x10,%esp
+80105018:	85 ff                	test   %edi,%edi
+8010501a:	0f 8e ce 00 00 00    	jle    801050ee <pipewrite+0xee>
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+80105020:	8b 83 64 02 00 00    	mov    0x264(%ebx),%eax
+80105026:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80105029:	89 7d 10             	mov    %edi,0x10(%ebp)
+8010502c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010502f:	8d 34 39             	lea    (%ecx,%edi,1),%esi
+80105032:	89 75 e0             	mov    %esi,-0x20(%ebp)
+      if(p->readopen == 0 || myproc()->killed){
+        release(&p->lock);
+        return -1;
+      }
+      wakeup(&p->nread);
+80105035:	8d b3 60 02 00 00    	lea    0x260(%ebx),%esi
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+8010503b:	8b 83 60 02 00 00    	mov    0x260(%ebx),%eax
+      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+80105041:	8d bb 64 02 00 00    	lea    0x264(%ebx),%edi
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+80105047:	8d 90 00 02 00 00    	lea    0x200(%eax),%edx
+8010504d:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+80105050:	0f 85 b6 00 00 00    	jne    8010510c <pipewrite+0x10c>
+80105056:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80105059:	eb 3b                	jmp    80105096 <pipewrite+0x96>
+8010505b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010505f:	90                   	nop
+      if(p->readopen == 0 || myproc()->killed){
+80105060:	e8 8b 05 00 00       	call   801055f0 <myproc>
+80105065:	8b 48 2c             	mov    0x2c(%eax),%ecx
+80105068:	85 c9                	test   %ecx,%ecx
+8010506a:	75 34                	jne    801050a0 <pipewrite+0xa0>
+      wakeup(&p->nread);
+8010506c:	83 ec 0c             	sub    $0xc,%esp
+8010506f:	56                   	push   %esi
+80105070:	e8 7b 10 00 00       	call   801060f0 <wakeup>
+      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+80105075:	58                   	pop    %eax
+80105076:	5a                   	pop    %edx
+80105077:	53                   	push   %ebx
+80105078:	57                   	push   %edi
+80105079:	e8 c2 0f 00 00       	call   80106040 <sleep>
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+8010507e:	8b 83 60 02 00 00    	mov    0x260(%ebx),%eax
+80105084:	8b 93 64 02 00 00    	mov    0x264(%ebx),%edx
+8010508a:	83 c4 10             	add    $0x10,%esp
+8010508d:	05 00 02 00 00       	add    $0x200,%eax
+80105092:	39 c2                	cmp    %eax,%edx
+80105094:	75 2a                	jne    801050c0 <pipewrite+0xc0>
+      if(p->readopen == 0 || myproc()->killed){
+80105096:	8b 83 68 02 00 00    	mov    0x268(%ebx),%eax
+8010509c:	85 c0                	test   %eax,%eax
+8010509e:	75 c0                	jne    80105060 <pipewrite+0x60>
+        release(&p->lock);
+801050a0:	83 ec 0c             	sub    $0xc,%esp
+801050a3:	53                   	push   %ebx
+801050a4:	e8 57 1e 00 00       	call   80106f00 <release>
+        return -1;
+801050a9:	83 c4 10             	add    $0x10,%esp
+801050ac:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+  }
+  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+  release(&p->lock);
+  return n;
+}
+801050b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801050b4:	5b                   	pop    %ebx
+801050b5:	5e                   	pop    %esi
+801050b6:	5f                   	pop    %edi
+801050b7:	5d                   	pop    %ebp
+801050b8:	c3                   	ret
+801050b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801050c0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+801050c3:	8d 42 01             	lea    0x1(%edx),%eax
+801050c6:	81 e2 ff 01 00 00    	and    $0x1ff,%edx
+  for(i = 0; i < n; i++){
+801050cc:	83 c1 01             	add    $0x1,%ecx
+    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+801050cf:	89 83 64 02 00 00    	mov    %eax,0x264(%ebx)
+801050d5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801050d8:	0f b6 41 ff          	movzbl -0x1(%ecx),%eax
+801050dc:	88 44 13 60          	mov    %al,0x60(%ebx,%edx,1)
+  for(i = 0; i < n; i++){
+801050e0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801050e3:	39 c1                	cmp    %eax,%ecx
+801050e5:	0f 85 50 ff ff ff    	jne    8010503b <pipewrite+0x3b>
+801050eb:	8b 7d 10             	mov    0x10(%ebp),%edi
+  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+801050ee:	83 ec 0c             	sub    $0xc,%esp
+801050f1:	8d 83 60 02 00 00    	lea    0x260(%ebx),%eax
+801050f7:	50                   	push   %eax
+801050f8:	e8 f3 0f 00 00       	call   801060f0 <wakeup>
+  release(&p->lock);
+801050fd:	89 1c 24             	mov    %ebx,(%esp)
+80105100:	e8 fb 1d 00 00       	call   80106f00 <release>
+  return n;
+80105105:	83 c4 10             	add    $0x10,%esp
+80105108:	89 f8                	mov    %edi,%eax
+8010510a:	eb a5                	jmp    801050b1 <pipewrite+0xb1>
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+8010510c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010510f:	eb b2                	jmp    801050c3 <pipewrite+0xc3>
+80105111:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105118:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010511f:	90                   	nop
+
+80105120 <piperead>:
+
+int
+piperead(struct pipe *p, char *addr, int n)
+{
+80105120:	55                   	push   %ebp
+80105121:	89 e5                	mov    %esp,%ebp
+80105123:	57                   	push   %edi
+80105124:	56                   	push   %esi
+80105125:	53                   	push   %ebx
+80105126:	83 ec 18             	sub    $0x18,%esp
+80105129:	8b 75 08             	mov    0x8(%ebp),%esi
+8010512c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  int i;
+
+  acquire(&p->lock);
+8010512f:	56                   	push   %esi
+80105130:	8d 9e 60 02 00 00    	lea    0x260(%esi),%ebx
+80105136:	e8 35 1f 00 00       	call   80107070 <acquire>
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+8010513b:	8b 86 60 02 00 00    	mov    0x260(%esi),%eax
+80105141:	83 c4 10             	add    $0x10,%esp
+80105144:	39 86 64 02 00 00    	cmp    %eax,0x264(%esi)
+8010514a:	74 2f                	je     8010517b <piperead+0x5b>
+8010514c:	eb 37                	jmp    80105185 <piperead+0x65>
+8010514e:	66 90                	xchg   %ax,%ax
+    if(myproc()->killed){
+80105150:	e8 9b 04 00 00       	call   801055f0 <myproc>
+80105155:	8b 48 2c             	mov    0x2c(%eax),%ecx
+80105158:	85 c9                	test   %ecx,%ecx
+8010515a:	0f 85 80 00 00 00    	jne    801051e0 <piperead+0xc0>
+      release(&p->lock);
+      return -1;
+    }
+    sleep(&p->nread, &p->lock); //DOC: piperead-sleep
+80105160:	83 ec 08             	sub    $0x8,%esp
+80105163:	56                   	push   %esi
+80105164:	53                   	push   %ebx
+80105165:	e8 d6 0e 00 00       	call   80106040 <sleep>
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+8010516a:	8b 86 64 02 00 00    	mov    0x264(%esi),%eax
+80105170:	83 c4 10             	add    $0x10,%esp
+80105173:	39 86 60 02 00 00    	cmp    %eax,0x260(%esi)
+80105179:	75 0a                	jne    80105185 <piperead+0x65>
+8010517b:	8b 86 6c 02 00 00    	mov    0x26c(%esi),%eax
+80105181:	85 c0                	test   %eax,%eax
+80105183:	75 cb                	jne    80105150 <piperead+0x30>
+  }
+  for(i = 0; i < n; i++){  //DOC: piperead-copy
+80105185:	8b 55 10             	mov    0x10(%ebp),%edx
+80105188:	31 db                	xor    %ebx,%ebx
+8010518a:	85 d2                	test   %edx,%edx
+8010518c:	7f 20                	jg     801051ae <piperead+0x8e>
+8010518e:	eb 2c                	jmp    801051bc <piperead+0x9c>
+    if(p->nread == p->nwrite)
+      break;
+    addr[i] = p->data[p->nread++ % PIPESIZE];
+80105190:	8d 48 01             	lea    0x1(%eax),%ecx
+80105193:	25 ff 01 00 00       	and    $0x1ff,%eax
+80105198:	89 8e 60 02 00 00    	mov    %ecx,0x260(%esi)
+8010519e:	0f b6 44 06 60       	movzbl 0x60(%esi,%eax,1),%eax
+801051a3:	88 04 1f             	mov    %al,(%edi,%ebx,1)
+  for(i = 0; i < n; i++){  //DOC: piperead-copy
+801051a6:	83 c3 01             	add    $0x1,%ebx
+801051a9:	39 5d 10             	cmp    %ebx,0x10(%ebp)
+801051ac:	74 0e                	je     801051bc <piperead+0x9c>
+    if(p->nread == p->nwrite)
+801051ae:	8b 86 60 02 00 00    	mov    0x260(%esi),%eax
+801051b4:	3b 86 64 02 00 00    	cmp    0x264(%esi),%eax
+801051ba:	75 d4                	jne    80105190 <piperead+0x70>
+  }
+  wakeup(&p->nwrite);  //DOC: piperead-wakeup
+801051bc:	83 ec 0c             	sub    $0xc,%esp
+801051bf:	8d 86 64 02 00 00    	lea    0x264(%esi),%eax
+801051c5:	50                   	push   %eax
+801051c6:	e8 25 0f 00 00       	call   801060f0 <wakeup>
+  release(&p->lock);
+801051cb:	89 34 24             	mov    %esi,(%esp)
+801051ce:	e8 2d 1d 00 00       	call   80106f00 <release>
+  return i;
+801051d3:	83 c4 10             	add    $0x10,%esp
+}
+801051d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801051d9:	89 d8                	mov    %ebx,%eax
+801051db:	5b                   	pop    %ebx
+801051dc:	5e                   	pop    %esi
+801051dd:	5f                   	pop    %edi
+801051de:	5d                   	pop    %ebp
+801051df:	c3                   	ret
+      release(&p->lock);
+801051e0:	83 ec 0c             	sub    $0xc,%esp
+      return -1;
+801051e3:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+      release(&p->lock);
+801051e8:	56                   	push   %esi
+801051e9:	e8 12 1d 00 00       	call   80106f00 <release>
+      return -1;
+801051ee:	83 c4 10             	add    $0x10,%esp
+}
+801051f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801051f4:	89 d8                	mov    %ebx,%eax
+801051f6:	5b                   	pop    %ebx
+801051f7:	5e                   	pop    %esi
+801051f8:	5f                   	pop    %edi
+801051f9:	5d                   	pop    %ebp
+801051fa:	c3                   	ret
+801051fb:	66 90                	xchg   %ax,%ax
+801051fd:	66 90                	xchg   %ax,%ax
+801051ff:	90                   	nop
+
+80105200 <freeproc>:
+static void
+freeproc(struct proc *p)
+{
+  struct proc **pp;
+
+  for(pp = pidchain(p->pid); *pp != p; pp = &(*pp)->hashnext)
+80105200:	0f b6 48 10          	movzbl 0x10(%eax),%ecx
+{
+80105204:	89 c2                	mov    %eax,%edx
+  for(pp = pidchain(p->pid); *pp != p; pp = &(*pp)->hashnext)
+80105206:	8b 04 8d 88 46 1a 80 	mov    -0x7fe5b978(,%ecx,4),%eax
+8010520d:	39 c2                	cmp    %eax,%edx
+8010520f:	74 7f                	je     80105290 <freeproc+0x90>
+80105211:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105218:	89 c1                	mov    %eax,%ecx
+8010521a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+80105220:	39 c2                	cmp    %eax,%edx
+80105222:	75 f4                	jne    80105218 <freeproc+0x18>
+80105224:	81 c1 8c 00 00 00    	add    $0x8c,%ecx
+    ;
+  *pp = p->hashnext;
+8010522a:	8b 82 8c 00 00 00    	mov    0x8c(%edx),%eax
+80105230:	89 01                	mov    %eax,(%ecx)
+  if(p->prev)
+80105232:	8b 8a 88 00 00 00    	mov    0x88(%edx),%ecx
+    p->prev->next = p->next;
+80105238:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  if(p->prev)
+8010523e:	85 c9                	test   %ecx,%ecx
+80105240:	74 3e                	je     80105280 <freeproc+0x80>
+    p->prev->next = p->next;
+80105242:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+  else
+    ptable.list = p->next;
+  if(p->next)
+80105248:	85 c0                	test   %eax,%eax
+8010524a:	74 0c                	je     80105258 <freeproc+0x58>
+    p->next->prev = p->prev;
+8010524c:	8b 8a 88 00 00 00    	mov    0x88(%edx),%ecx
+80105252:	89 88 88 00 00 00    	mov    %ecx,0x88(%eax)
+  ptable.nproc--;
+80105258:	83 2d 88 4a 1a 80 01 	subl   $0x1,0x801a4a88
+
+  p->state = UNUSED;
+8010525f:	c7 42 0c 00 00 00 00 	movl   $0x0,0xc(%edx)
+  p->next = ptable.free;
+80105266:	a1 84 46 1a 80       	mov    0x801a4684,%eax
+  ptable.free = p;
+8010526b:	89 15 84 46 1a 80    	mov    %edx,0x801a4684
+  p->next = ptable.free;
+80105271:	89 82 84 00 00 00    	mov    %eax,0x84(%edx)
+}
+80105277:	c3                   	ret
+80105278:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010527f:	90                   	nop
+    ptable.list = p->next;
+80105280:	a3 80 46 1a 80       	mov    %eax,0x801a4680
+80105285:	eb c1                	jmp    80105248 <freeproc+0x48>
+80105287:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010528e:	66 90                	xchg   %ax,%ax
+  for(pp = pidchain(p->pid); *pp != p; pp = &(*pp)->hashnext)
+80105290:	8d 0c 8d 88 46 1a 80 	lea    -0x7fe5b978(,%ecx,4),%ecx
+80105297:	eb 91                	jmp    8010522a <freeproc+0x2a>
+80105299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801052a0 <allocproc>:
+// descriptors if none are free.  If found, change state to
+// EMBRYO and initialize state required to run in the kernel.
+// Otherwise return 0.
+static struct proc*
+allocproc(void)
+{
+801052a0:	55                   	push   %ebp
+801052a1:	89 e5                	mov    %esp,%ebp
+801052a3:	53                   	push   %ebx
+801052a4:	83 ec 10             	sub    $0x10,%esp
+  struct proc *p;
+  char *sp, *mem;
+
+  acquire(&ptable.lock);
+801052a7:	68 20 46 1a 80       	push   $0x801a4620
+801052ac:	e8 bf 1d 00 00       	call   80107070 <acquire>
+
+  if(ptable.nproc >= NPROC)
+801052b1:	83 c4 10             	add    $0x10,%esp
+801052b4:	81 3d 88 4a 1a 80 ff 	cmpl   $0xfff,0x801a4a88
+801052bb:	0f 00 00 
+801052be:	0f 8f 24 01 00 00    	jg     801053e8 <allocproc+0x148>
+    goto bad;
+  if(ptable.free == 0){
+801052c4:	8b 1d 84 46 1a 80    	mov    0x801a4684,%ebx
+801052ca:	85 db                	test   %ebx,%ebx
+801052cc:	0f 84 e6 00 00 00    	je     801053b8 <allocproc+0x118>
+      p->next = ptable.free;
+      ptable.free = p;
+    }
+  }
+  p = ptable.free;
+  ptable.free = p->next;
+801052d2:	8b 93 84 00 00 00    	mov    0x84(%ebx),%edx
+  memset(p, 0, sizeof(*p));
+801052d8:	83 ec 04             	sub    $0x4,%esp
+  ptable.free = p->next;
+801052db:	89 15 84 46 1a 80    	mov    %edx,0x801a4684
+  memset(p, 0, sizeof(*p));
+801052e1:	68 c4 00 00 00       	push   $0xc4
+801052e6:	6a 00                	push   $0x0
+801052e8:	53                   	push   %ebx
+801052e9:	e8 d2 20 00 00       	call   801073c0 <memset>
+
+  p->state = EMBRYO;
+  p->pid = nextpid++;
+801052ee:	a1 04 f0 10 80       	mov    0x8010f004,%eax
+  p->state = EMBRYO;
+801052f3:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+  p->lastcpu = -1;
+  p->affinity = ~0;
+
+  p->next = ptable.list;
+  if(ptable.list)
+801052fa:	83 c4 10             	add    $0x10,%esp
+  p->lastcpu = -1;
+801052fd:	c7 83 90 00 00 00 ff 	movl   $0xffffffff,0x90(%ebx)
+80105304:	ff ff ff 
+  p->pid = nextpid++;
+80105307:	8d 50 01             	lea    0x1(%eax),%edx
+8010530a:	89 43 10             	mov    %eax,0x10(%ebx)
+  p->next = ptable.list;
+8010530d:	a1 80 46 1a 80       	mov    0x801a4680,%eax
+  p->pid = nextpid++;
+80105312:	89 15 04 f0 10 80    	mov    %edx,0x8010f004
+  p->affinity = ~0;
+80105318:	c7 83 94 00 00 00 ff 	movl   $0xffffffff,0x94(%ebx)
+8010531f:	ff ff ff 
+  p->next = ptable.list;
+80105322:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  if(ptable.list)
+80105328:	85 c0                	test   %eax,%eax
+8010532a:	74 06                	je     80105332 <allocproc+0x92>
+    ptable.list->prev = p;
+8010532c:	89 98 88 00 00 00    	mov    %ebx,0x88(%eax)
+  ptable.list = p;
+80105332:	89 1d 80 46 1a 80    	mov    %ebx,0x801a4680
+  p->hashnext = *pidchain(p->pid);
+80105338:	0f b6 43 10          	movzbl 0x10(%ebx),%eax
+  *pidchain(p->pid) = p;
+  ptable.nproc++;
+
+  release(&ptable.lock);
+8010533c:	83 ec 0c             	sub    $0xc,%esp
+  p->hashnext = *pidchain(p->pid);
+8010533f:	83 c0 18             	add    $0x18,%eax
+80105342:	8b 14 85 28 46 1a 80 	mov    -0x7fe5b9d8(,%eax,4),%edx
+80105349:	89 93 8c 00 00 00    	mov    %edx,0x8c(%ebx)
+  *pidchain(p->pid) = p;
+8010534f:	89 1c 85 28 46 1a 80 	mov    %ebx,-0x7fe5b9d8(,%eax,4)
+  ptable.nproc++;
+80105356:	83 05 88 4a 1a 80 01 	addl   $0x1,0x801a4a88
+  release(&ptable.lock);
+8010535d:	68 20 46 1a 80       	push   $0x801a4620
+80105362:	e8 99 1b 00 00       	call   80106f00 <release>
+
+  // Allocate kernel stack.
+  if((p->kstack = kalloc()) == 0){
+80105367:	e8 54 e7 ff ff       	call   80103ac0 <kalloc>
+8010536c:	83 c4 10             	add    $0x10,%esp
+8010536f:	89 43 08             	mov    %eax,0x8(%ebx)
+80105372:	85 c0                	test   %eax,%eax
+80105374:	0f 84 8e 00 00 00    	je     80105408 <allocproc+0x168>
+    return 0;
+  }
+  sp = p->kstack + KSTACKSIZE;
+
+  // Leave room for trap frame.
+  sp -= sizeof *p->tf;
+8010537a:	8d 90 b4 0f 00 00    	lea    0xfb4(%eax),%edx
+  sp -= 4;
+  *(uint*)sp = (uint)trapret;
+
+  sp -= sizeof *p->context;
+  p->context = (struct context*)sp;
+  memset(p->context, 0, sizeof *p->context);
+80105380:	83 ec 04             	sub    $0x4,%esp
+  sp -= sizeof *p->context;
+80105383:	05 9c 0f 00 00       	add    $0xf9c,%eax
+  sp -= sizeof *p->tf;
+80105388:	89 53 20             	mov    %edx,0x20(%ebx)
+  *(uint*)sp = (uint)trapret;
+8010538b:	c7 40 14 e8 92 10 80 	movl   $0x801092e8,0x14(%eax)
+  p->context = (struct context*)sp;
+80105392:	89 43 24             	mov    %eax,0x24(%ebx)
+  memset(p->context, 0, sizeof *p->context);
+80105395:	6a 14                	push   $0x14
+80105397:	6a 00                	push   $0x0
+80105399:	50                   	push   %eax
+8010539a:	e8 21 20 00 00       	call   801073c0 <memset>
+  p->context->eip = (uint)forkret;
+8010539f:	8b 43 24             	mov    0x24(%ebx),%eax
+
+  return p;
+801053a2:	83 c4 10             	add    $0x10,%esp
+  p->context->eip = (uint)forkret;
+801053a5:	c7 40 10 50 55 10 80 	movl   $0x80105550,0x10(%eax)
+
+bad:
+  release(&ptable.lock);
+  return 0;
+}
+801053ac:	89 d8                	mov    %ebx,%eax
+801053ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801053b1:	c9                   	leave
+801053b2:	c3                   	ret
+801053b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801053b7:	90                   	nop
+    if((mem = kalloc()) == 0)
+801053b8:	e8 03 e7 ff ff       	call   80103ac0 <kalloc>
+801053bd:	85 c0                	test   %eax,%eax
+801053bf:	74 27                	je     801053e8 <allocproc+0x148>
+    for(p = (struct proc*)mem; p+1 <= (struct proc*)(mem+PGSIZE); p++){
+801053c1:	8b 1d 84 46 1a 80    	mov    0x801a4684,%ebx
+801053c7:	8d 88 50 0f 00 00    	lea    0xf50(%eax),%ecx
+801053cd:	8d 76 00             	lea    0x0(%esi),%esi
+801053d0:	89 da                	mov    %ebx,%edx
+801053d2:	89 c3                	mov    %eax,%ebx
+801053d4:	05 c4 00 00 00       	add    $0xc4,%eax
+      p->next = ptable.free;
+801053d9:	89 50 c0             	mov    %edx,-0x40(%eax)
+    for(p = (struct proc*)mem; p+1 <= (struct proc*)(mem+PGSIZE); p++){
+801053dc:	39 c8                	cmp    %ecx,%eax
+801053de:	75 f0                	jne    801053d0 <allocproc+0x130>
+801053e0:	e9 f3 fe ff ff       	jmp    801052d8 <allocproc+0x38>
+801053e5:	8d 76 00             	lea    0x0(%esi),%esi
+  release(&ptable.lock);
+801053e8:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+801053eb:	31 db                	xor    %ebx,%ebx
+  release(&ptable.lock);
+801053ed:	68 20 46 1a 80       	push   $0x801a4620
+801053f2:	e8 09 1b 00 00       	call   80106f00 <release>
+  return 0;
+801053f7:	83 c4 10             	add    $0x10,%esp
+}
+801053fa:	89 d8                	mov    %ebx,%eax
+801053fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801053ff:	c9                   	leave
+80105400:	c3                   	ret
+80105401:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    acquire(&ptable.lock);
+80105408:	83 ec 0c             	sub    $0xc,%esp
+8010540b:	68 20 46 1a 80       	push   $0x801a4620
+80105410:	e8 5b 1c 00 00       	call   80107070 <acquire>
+    freeproc(p);
+80105415:	89 d8                	mov    %ebx,%eax
+    return 0;
+80105417:	31 db                	xor    %ebx,%ebx
+    freeproc(p);
+80105419:	e8 e2 fd ff ff       	call   80105200 <freeproc>
+    release(&ptable.lock);
+8010541e:	c7 04 24 20 46 1a 80 	movl   $0x801a4620,(%esp)
+80105425:	e8 d6 1a 00 00       	call   80106f00 <release>
+    return 0;
+8010542a:	83 c4 10             	add    $0x10,%esp
+8010542d:	eb cb                	jmp    801053fa <allocproc+0x15a>
+8010542f:	90                   	nop
+
+80105430 <makerunnable>:
+// scheduler(), kick it with an IPI so that p does not wait for the
+// next timer interrupt, preferring the CPU p last ran on.
+// The ptable lock must be held.
+static void
+makerunnable(struct proc *p)
+{
+80105430:	55                   	push   %ebp
+80105431:	89 e5                	mov    %esp,%ebp
+80105433:	57                   	push   %edi
+80105434:	56                   	push   %esi
+80105435:	53                   	push   %ebx
+80105436:	83 ec 0c             	sub    $0xc,%esp
+  struct cpu *c, *target;
+
+  p->state = RUNNABLE;
+80105439:	c7 40 0c 03 00 00 00 	movl   $0x3,0xc(%eax)
+  target = 0;
+  for(c = cpus; c < cpus+ncpu; c++){
+80105440:	69 35 44 3b 1a 80 c4 	imul   $0xc4,0x801a3b44,%esi
+80105447:	00 00 00 
+8010544a:	81 c6 60 3b 1a 80    	add    $0x801a3b60,%esi
+80105450:	81 fe 60 3b 1a 80    	cmp    $0x801a3b60,%esi
+80105456:	0f 86 8e 00 00 00    	jbe    801054ea <makerunnable+0xba>
+8010545c:	89 c7                	mov    %eax,%edi
+  target = 0;
+8010545e:	31 db                	xor    %ebx,%ebx
+  for(c = cpus; c < cpus+ncpu; c++){
+80105460:	b8 60 3b 1a 80       	mov    $0x801a3b60,%eax
+80105465:	eb 1b                	jmp    80105482 <makerunnable+0x52>
+80105467:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010546e:	66 90                	xchg   %ax,%ax
+    if(!c->idle || (p->affinity & (1 << (c-cpus))) == 0)
+      continue;
+    if(target == 0 || c-cpus == p->lastcpu)
+80105470:	3b 8f 90 00 00 00    	cmp    0x90(%edi),%ecx
+80105476:	0f 44 d8             	cmove  %eax,%ebx
+  for(c = cpus; c < cpus+ncpu; c++){
+80105479:	05 c4 00 00 00       	add    $0xc4,%eax
+8010547e:	39 f0                	cmp    %esi,%eax
+80105480:	73 3e                	jae    801054c0 <makerunnable+0x90>
+    if(!c->idle || (p->affinity & (1 << (c-cpus))) == 0)
+80105482:	8b 90 bc 00 00 00    	mov    0xbc(%eax),%edx
+80105488:	85 d2                	test   %edx,%edx
+8010548a:	74 ed                	je     80105479 <makerunnable+0x49>
+8010548c:	89 c1                	mov    %eax,%ecx
+8010548e:	ba 01 00 00 00       	mov    $0x1,%edx
+80105493:	81 e9 60 3b 1a 80    	sub    $0x801a3b60,%ecx
+80105499:	c1 f9 02             	sar    $0x2,%ecx
+8010549c:	69 c9 d1 58 1f 1a    	imul   $0x1a1f58d1,%ecx,%ecx
+801054a2:	d3 e2                	shl    %cl,%edx
+801054a4:	23 97 94 00 00 00    	and    0x94(%edi),%edx
+801054aa:	74 cd                	je     80105479 <makerunnable+0x49>
+    if(target == 0 || c-cpus == p->lastcpu)
+801054ac:	85 db                	test   %ebx,%ebx
+801054ae:	75 c0                	jne    80105470 <makerunnable+0x40>
+801054b0:	89 c3                	mov    %eax,%ebx
+  for(c = cpus; c < cpus+ncpu; c++){
+801054b2:	05 c4 00 00 00       	add    $0xc4,%eax
+801054b7:	39 f0                	cmp    %esi,%eax
+801054b9:	72 c7                	jb     80105482 <makerunnable+0x52>
+801054bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801054bf:	90                   	nop
+      target = c;
+  }
+  if(target == 0)
+801054c0:	85 db                	test   %ebx,%ebx
+801054c2:	74 26                	je     801054ea <makerunnable+0xba>
+    return;
+  target->idle = 0;
+801054c4:	c7 83 bc 00 00 00 00 	movl   $0x0,0xbc(%ebx)
+801054cb:	00 00 00 
+  asm volatile("movl %%gs:0, %0" : "=r" (c));
+801054ce:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+  // We may be in an interrupt taken on an idle CPU; it is
+  // going to rescan the table anyway, so don't IPI ourselves.
+  if(target != mycpu())
+801054d4:	39 c3                	cmp    %eax,%ebx
+801054d6:	74 12                	je     801054ea <makerunnable+0xba>
+    lapicipi(target->apicid, T_IRQ0 + IRQ_WAKEUP);
+801054d8:	83 ec 08             	sub    $0x8,%esp
+801054db:	6a 3e                	push   $0x3e
+801054dd:	0f b6 43 08          	movzbl 0x8(%ebx),%eax
+801054e1:	50                   	push   %eax
+801054e2:	e8 09 ea ff ff       	call   80103ef0 <lapicipi>
+801054e7:	83 c4 10             	add    $0x10,%esp
+}
+801054ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801054ed:	5b                   	pop    %ebx
+801054ee:	5e                   	pop    %esi
+801054ef:	5f                   	pop    %edi
+801054f0:	5d                   	pop    %ebp
+801054f1:	c3                   	ret
+801054f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801054f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80105500 <wakeup1>:
+//PAGEBREAK!
+// Wake up all processes sleeping on chan.
+// The ptable lock must be held.
+static void
+wakeup1(void *chan)
+{
+80105500:	55                   	push   %ebp
+80105501:	89 e5                	mov    %esp,%ebp
+80105503:	56                   	push   %esi
+80105504:	53                   	push   %ebx
+  struct proc *p;
+
+  for(p = ptable.list; p; p = p->next)
+80105505:	8b 1d 80 46 1a 80    	mov    0x801a4680,%ebx
+8010550b:	85 db                	test   %ebx,%ebx
+8010550d:	74 2f                	je     8010553e <wakeup1+0x3e>
+8010550f:	89 c6                	mov    %eax,%esi
+80105511:	eb 0f                	jmp    80105522 <wakeup1+0x22>
+80105513:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105517:	90                   	nop
+80105518:	8b 9b 84 00 00 00    	mov    0x84(%ebx),%ebx
+8010551e:	85 db                	test   %ebx,%ebx
+80105520:	74 1c                	je     8010553e <wakeup1+0x3e>
+    if(p->state == SLEEPING && p->chan == chan)
+80105522:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+80105526:	75 f0                	jne    80105518 <wakeup1+0x18>
+80105528:	39 73 28             	cmp    %esi,0x28(%ebx)
+8010552b:	75 eb                	jne    80105518 <wakeup1+0x18>
+      makerunnable(p);
+8010552d:	89 d8                	mov    %ebx,%eax
+8010552f:	e8 fc fe ff ff       	call   80105430 <makerunnable>
+  for(p = ptable.list; p; p = p->next)
+80105534:	8b 9b 84 00 00 00    	mov    0x84(%ebx),%ebx
+8010553a:	85 db                	test   %ebx,%ebx
+8010553c:	75 e4                	jne    80105522 <wakeup1+0x22>
+}
+8010553e:	5b                   	pop    %ebx
+8010553f:	5e                   	pop    %esi
+80105540:	5d                   	pop    %ebp
+80105541:	c3                   	ret
+80105542:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105549:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80105550 <forkret>:
+{
+80105550:	55                   	push   %ebp
+80105551:	89 e5                	mov    %esp,%ebp
+80105553:	83 ec 14             	sub    $0x14,%esp
+  release(&ptable.lock);
+80105556:	68 20 46 1a 80       	push   $0x801a4620
+8010555b:	e8 a0 19 00 00       	call   80106f00 <release>
+  if (first) {
+80105560:	a1 00 f0 10 80       	mov    0x8010f000,%eax
+80105565:	83 c4 10             	add    $0x10,%esp
+80105568:	85 c0                	test   %eax,%eax
+8010556a:	75 04                	jne    80105570 <forkret+0x20>
+}
+8010556c:	c9                   	leave
+8010556d:	c3                   	ret
+8010556e:	66 90                	xchg   %ax,%ax
+    first = 0;
+80105570:	c7 05 00 f0 10 80 00 	movl   $0x0,0x8010f000
+80105577:	00 00 00 
+    iinit(ROOTDEV);
+8010557a:	83 ec 0c             	sub    $0xc,%esp
+8010557d:	6a 01                	push   $0x1
+8010557f:	e8 3c d4 ff ff       	call   801029c0 <iinit>
+    initlog(ROOTDEV);
+80105584:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+8010558b:	e8 90 ed ff ff       	call   80104320 <initlog>
+}
+80105590:	83 c4 10             	add    $0x10,%esp
+80105593:	c9                   	leave
+80105594:	c3                   	ret
+80105595:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010559c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801055a0 <pinit>:
+{
+801055a0:	55                   	push   %ebp
+801055a1:	89 e5                	mov    %esp,%ebp
+801055a3:	83 ec 10             	sub    $0x10,%esp
+  initlock(&ptable.lock, "ptable");
+801055a6:	68 68 bb 10 80       	push   $0x8010bb68
+801055ab:	68 20 46 1a 80       	push   $0x801a4620
+801055b0:	e8 ab 13 00 00       	call   80106960 <initlock>
+}
+801055b5:	83 c4 10             	add    $0x10,%esp
+801055b8:	c9                   	leave
+801055b9:	c3                   	ret
+801055ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801055c0 <cpuid>:
+  asm volatile("movl %%gs:0, %0" : "=r" (c));
+801055c0:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+  return mycpu()-cpus;
+801055c6:	2d 60 3b 1a 80       	sub    $0x801a3b60,%eax
+801055cb:	c1 f8 02             	sar    $0x2,%eax
+801055ce:	69 c0 d1 58 1f 1a    	imul   $0x1a1f58d1,%eax,%eax
+}
+801055d4:	c3                   	ret
+801055d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801055dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801055e0 <mycpu>:
+  asm volatile("movl %%gs:0, %0" : "=r" (c));
+801055e0:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+}
+801055e6:	c3                   	ret
+801055e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801055ee:	66 90                	xchg   %ax,%ax
+
+801055f0 <myproc>:
+  asm volatile("movl %%gs:4, %0" : "=r" (p) : : "memory");
+801055f0:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+}
+801055f6:	c3                   	ret
+801055f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801055fe:	66 90                	xchg   %ax,%ax
+
+80105600 <kthread_create>:
+{
+80105600:	55                   	push   %ebp
+80105601:	89 e5                	mov    %esp,%ebp
+80105603:	53                   	push   %ebx
+80105604:	83 ec 04             	sub    $0x4,%esp
+  if((p = allocproc()) == 0)
+80105607:	e8 94 fc ff ff       	call   801052a0 <allocproc>
+8010560c:	85 c0                	test   %eax,%eax
+8010560e:	0f 84 b0 00 00 00    	je     801056c4 <kthread_create+0xc4>
+80105614:	89 c3                	mov    %eax,%ebx
+  if((p->pgdir = setupkvm()) == 0){
+80105616:	e8 a5 59 00 00       	call   8010afc0 <setupkvm>
+8010561b:	89 43 04             	mov    %eax,0x4(%ebx)
+8010561e:	85 c0                	test   %eax,%eax
+80105620:	74 6e                	je     80105690 <kthread_create+0x90>
+  safestrcpy(p->name, name, sizeof(p->name));
+80105622:	83 ec 04             	sub    $0x4,%esp
+80105625:	8d 43 74             	lea    0x74(%ebx),%eax
+80105628:	6a 10                	push   $0x10
+8010562a:	ff 75 10             	push   0x10(%ebp)
+8010562d:	50                   	push   %eax
+8010562e:	e8 3d 1f 00 00       	call   80107570 <safestrcpy>
+  sp = (uint*)(p->context + 1);
+80105633:	8b 43 24             	mov    0x24(%ebx),%eax
+  sp[0] = (uint)fn;
+80105636:	8b 55 08             	mov    0x8(%ebp),%edx
+80105639:	89 50 14             	mov    %edx,0x14(%eax)
+  sp[2] = (uint)arg;
+8010563c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  sp[1] = (uint)exit;
+8010563f:	c7 40 18 00 5e 10 80 	movl   $0x80105e00,0x18(%eax)
+  sp[2] = (uint)arg;
+80105646:	89 50 1c             	mov    %edx,0x1c(%eax)
+  acquire(&ptable.lock);
+80105649:	c7 04 24 20 46 1a 80 	movl   $0x801a4620,(%esp)
+80105650:	e8 1b 1a 00 00       	call   80107070 <acquire>
+  p->parent = initproc;
+80105655:	a1 8c 4a 1a 80       	mov    0x801a4a8c,%eax
+  if(initproc){
+8010565a:	83 c4 10             	add    $0x10,%esp
+  p->parent = initproc;
+8010565d:	89 43 14             	mov    %eax,0x14(%ebx)
+  if(initproc){
+80105660:	85 c0                	test   %eax,%eax
+80105662:	74 09                	je     8010566d <kthread_create+0x6d>
+    p->sibling = initproc->children;
+80105664:	8b 50 18             	mov    0x18(%eax),%edx
+80105667:	89 53 1c             	mov    %edx,0x1c(%ebx)
+    initproc->children = p;
+8010566a:	89 58 18             	mov    %ebx,0x18(%eax)
+  makerunnable(p);
+8010566d:	89 d8                	mov    %ebx,%eax
+8010566f:	e8 bc fd ff ff       	call   80105430 <makerunnable>
+  release(&ptable.lock);
+80105674:	83 ec 0c             	sub    $0xc,%esp
+80105677:	68 20 46 1a 80       	push   $0x801a4620
+8010567c:	e8 7f 18 00 00       	call   80106f00 <release>
+  return p;
+80105681:	83 c4 10             	add    $0x10,%esp
+}
+80105684:	89 d8                	mov    %ebx,%eax
+80105686:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105689:	c9                   	leave
+8010568a:	c3                   	ret
+8010568b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010568f:	90                   	nop
+    kfree(p->kstack);
+80105690:	83 ec 0c             	sub    $0xc,%esp
+80105693:	ff 73 08             	push   0x8(%ebx)
+80105696:	e8 55 e2 ff ff       	call   801038f0 <kfree>
+    p->kstack = 0;
+8010569b:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    acquire(&ptable.lock);
+801056a2:	c7 04 24 20 46 1a 80 	movl   $0x801a4620,(%esp)
+801056a9:	e8 c2 19 00 00       	call   80107070 <acquire>
+    freeproc(p);
+801056ae:	89 d8                	mov    %ebx,%eax
+801056b0:	e8 4b fb ff ff       	call   80105200 <freeproc>
+    release(&ptable.lock);
+801056b5:	c7 04 24 20 46 1a 80 	movl   $0x801a4620,(%esp)
+801056bc:	e8 3f 18 00 00       	call   80106f00 <release>
+    return 0;
+801056c1:	83 c4 10             	add    $0x10,%esp
+    return 0;
+801056c4:	31 db                	xor    %ebx,%ebx
+801056c6:	eb bc                	jmp    80105684 <kthread_create+0x84>
+801056c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801056cf:	90                   	nop
+
+801056d0 <userinit>:
+{
+801056d0:	55                   	push   %ebp
+801056d1:	89 e5                	mov    %esp,%ebp
+801056d3:	53                   	push   %ebx
+801056d4:	83 ec 04             	sub    $0x4,%esp
+  p = allocproc();
+801056d7:	e8 c4 fb ff ff       	call   801052a0 <allocproc>
+801056dc:	89 c3                	mov    %eax,%ebx
+  initproc = p;
+801056de:	a3 8c 4a 1a 80       	mov    %eax,0x801a4a8c
+  if((p->pgdir = setupkvm()) == 0)
+801056e3:	e8 d8 58 00 00       	call   8010afc0 <setupkvm>
+801056e8:	89 43 04             	mov    %eax,0x4(%ebx)
+801056eb:	85 c0                	test   %eax,%eax
+801056ed:	0f 84 ed 00 00 00    	je     801057e0 <userinit+0x110>
+  if(mapupages(p->pgdir, p->pid) < 0)
+801056f3:	83 ec 08             	sub    $0x8,%esp
+801056f6:	ff 73 10             	push   0x10(%ebx)
+801056f9:	50                   	push   %eax
+801056fa:	e8 a1 55 00 00       	call   8010aca0 <mapupages>
+801056ff:	83 c4 10             	add    $0x10,%esp
+80105702:	85 c0                	test   %eax,%eax
+80105704:	0f 88 d6 00 00 00    	js     801057e0 <userinit+0x110>
+  cprintf("%p %p\n", _binary_initcode_start, _binary_initcode_size);
+8010570a:	83 ec 04             	sub    $0x4,%esp
+8010570d:	68 2c 00 00 00       	push   $0x2c
+80105712:	68 60 f4 10 80       	push   $0x8010f460
+80105717:	68 88 bb 10 80       	push   $0x8010bb88
+8010571c:	e8 cf c0 ff ff       	call   801017f0 <cprintf>
+  inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
+80105721:	83 c4 0c             	add    $0xc,%esp
+80105724:	68 2c 00 00 00       	push   $0x2c
+80105729:	68 60 f4 10 80       	push   $0x8010f460
+8010572e:	ff 73 04             	push   0x4(%ebx)
+80105731:	e8 ea 54 00 00       	call   8010ac20 <inituvm>
+  memset(p->tf, 0, sizeof(*p->tf));
+80105736:	83 c4 0c             	add    $0xc,%esp
+  p->sz = PGSIZE;
+80105739:	c7 03 00 10 00 00    	movl   $0x1000,(%ebx)
+  memset(p->tf, 0, sizeof(*p->tf));
+8010573f:	6a 4c                	push   $0x4c
+80105741:	6a 00                	push   $0x0
+80105743:	ff 73 20             	push   0x20(%ebx)
+80105746:	e8 75 1c 00 00       	call   801073c0 <memset>
+  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+8010574b:	8b 43 20             	mov    0x20(%ebx),%eax
+8010574e:	ba 1b 00 00 00       	mov    $0x1b,%edx
+  safestrcpy(p->name, "initcode", sizeof(p->name));
+80105753:	83 c4 0c             	add    $0xc,%esp
+  p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+80105756:	b9 23 00 00 00       	mov    $0x23,%ecx
+  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+8010575b:	66 89 50 3c          	mov    %dx,0x3c(%eax)
+  p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+8010575f:	8b 43 20             	mov    0x20(%ebx),%eax
+80105762:	66 89 48 2c          	mov    %cx,0x2c(%eax)
+  p->tf->es = p->tf->ds;
+80105766:	8b 43 20             	mov    0x20(%ebx),%eax
+80105769:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+8010576d:	66 89 50 28          	mov    %dx,0x28(%eax)
+  p->tf->ss = p->tf->ds;
+80105771:	8b 43 20             	mov    0x20(%ebx),%eax
+80105774:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80105778:	66 89 50 48          	mov    %dx,0x48(%eax)
+  p->tf->eflags = FL_IF;
+8010577c:	8b 43 20             	mov    0x20(%ebx),%eax
+8010577f:	c7 40 40 00 02 00 00 	movl   $0x200,0x40(%eax)
+  p->tf->esp = PGSIZE;
+80105786:	8b 43 20             	mov    0x20(%ebx),%eax
+80105789:	c7 40 44 00 10 00 00 	movl   $0x1000,0x44(%eax)
+  p->tf->eip = 0;  // beginning of initcode.S
+80105790:	8b 43 20             	mov    0x20(%ebx),%eax
+80105793:	c7 40 38 00 00 00 00 	movl   $0x0,0x38(%eax)
+  safestrcpy(p->name, "initcode", sizeof(p->name));
+8010579a:	8d 43 74             	lea    0x74(%ebx),%eax
+8010579d:	6a 10                	push   $0x10
+8010579f:	68 8f bb 10 80       	push   $0x8010bb8f
+801057a4:	50                   	push   %eax
+801057a5:	e8 c6 1d 00 00       	call   80107570 <safestrcpy>
+  p->cwd = namei("/");
+801057aa:	c7 04 24 98 bb 10 80 	movl   $0x8010bb98,(%esp)
+801057b1:	e8 ea de ff ff       	call   801036a0 <namei>
+801057b6:	89 43 70             	mov    %eax,0x70(%ebx)
+  acquire(&ptable.lock);
+801057b9:	c7 04 24 20 46 1a 80 	movl   $0x801a4620,(%esp)
+801057c0:	e8 ab 18 00 00       	call   80107070 <acquire>
+  makerunnable(p);
+801057c5:	89 d8                	mov    %ebx,%eax
+801057c7:	e8 64 fc ff ff       	call   80105430 <makerunnable>
+  release(&ptable.lock);
+801057cc:	c7 04 24 20 46 1a 80 	movl   $0x801a4620,(%esp)
+801057d3:	e8 28 17 00 00       	call   80106f00 <release>
+}
+801057d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801057db:	83 c4 10             	add    $0x10,%esp
+801057de:	c9                   	leave
+801057df:	c3                   	ret
+    panic("userinit: out of memory?");
+801057e0:	83 ec 0c             	sub    $0xc,%esp
+801057e3:	68 6f bb 10 80       	push   $0x8010bb6f
+801057e8:	e8 d3 bc ff ff       	call   801014c0 <panic>
+801057ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+801057f0 <growproc>:
+{
+801057f0:	55                   	push   %ebp
+801057f1:	89 e5                	mov    %esp,%ebp
+801057f3:	57                   	push   %edi
+801057f4:	56                   	push   %esi
+801057f5:	53                   	push   %ebx
+801057f6:	83 ec 0c             	sub    $0xc,%esp
+801057f9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  asm volatile("movl %%gs:4, %0" : "=r" (p) : : "memory");
+801057fc:	65 8b 35 04 00 00 00 	mov    %gs:0x4,%esi
+  sz = curproc->sz;
+80105803:	8b 1e                	mov    (%esi),%ebx
+  if(n < 0)
+80105805:	85 ff                	test   %edi,%edi
+80105807:	78 47                	js     80105850 <growproc+0x60>
+  if(n > 0){
+80105809:	75 1d                	jne    80105828 <growproc+0x38>
+  switchuvm(curproc);
+8010580b:	83 ec 0c             	sub    $0xc,%esp
+  curproc->sz = sz;
+8010580e:	89 1e                	mov    %ebx,(%esi)
+  switchuvm(curproc);
+80105810:	56                   	push   %esi
+80105811:	e8 fa 52 00 00       	call   8010ab10 <switchuvm>
+  return 0;
+80105816:	83 c4 10             	add    $0x10,%esp
+80105819:	31 c0                	xor    %eax,%eax
+}
+8010581b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010581e:	5b                   	pop    %ebx
+8010581f:	5e                   	pop    %esi
+80105820:	5f                   	pop    %edi
+80105821:	5d                   	pop    %ebp
+80105822:	c3                   	ret
+80105823:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105827:	90                   	nop
+    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
+80105828:	83 ec 04             	sub    $0x4,%esp
+8010582b:	01 df                	add    %ebx,%edi
+8010582d:	57                   	push   %edi
+8010582e:	53                   	push   %ebx
+8010582f:	ff 76 04             	push   0x4(%esi)
+80105832:	e8 c9 55 00 00       	call   8010ae00 <allocuvm>
+80105837:	83 c4 10             	add    $0x10,%esp
+8010583a:	89 c3                	mov    %eax,%ebx
+8010583c:	85 c0                	test   %eax,%eax
+8010583e:	75 cb                	jne    8010580b <growproc+0x1b>
+      return -1;
+80105840:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105845:	eb d4                	jmp    8010581b <growproc+0x2b>
+80105847:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010584e:	66 90                	xchg   %ax,%ax
+    aiodrain();  // I/O threads may be writing into the pages
+80105850:	e8 bb ad ff ff       	call   80100610 <aiodrain>
+    if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
+80105855:	01 df                	add    %ebx,%edi
+80105857:	83 ec 04             	sub    $0x4,%esp
+8010585a:	57                   	push   %edi
+8010585b:	53                   	push   %ebx
+8010585c:	ff 76 04             	push   0x4(%esi)
+8010585f:	e8 ac 56 00 00       	call   8010af10 <deallocuvm>
+80105864:	83 c4 10             	add    $0x10,%esp
+80105867:	89 c3                	mov    %eax,%ebx
+80105869:	85 c0                	test   %eax,%eax
+8010586b:	75 9e                	jne    8010580b <growproc+0x1b>
+8010586d:	eb d1                	jmp    80105840 <growproc+0x50>
+8010586f:	90                   	nop
+
+80105870 <fork>:
+{
+80105870:	55                   	push   %ebp
+80105871:	89 e5                	mov    %esp,%ebp
+80105873:	57                   	push   %edi
+80105874:	56                   	push   %esi
+80105875:	53                   	push   %ebx
+80105876:	83 ec 1c             	sub    $0x1c,%esp
+  asm volatile("movl %%gs:4, %0" : "=r" (p) : : "memory");
+80105879:	65 8b 1d 04 00 00 00 	mov    %gs:0x4,%ebx
+  if((np = allocproc()) == 0){
+80105880:	e8 1b fa ff ff       	call   801052a0 <allocproc>
+80105885:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80105888:	85 c0                	test   %eax,%eax
+8010588a:	0f 84 41 01 00 00    	je     801059d1 <fork+0x161>
+  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0 ||
+80105890:	83 ec 08             	sub    $0x8,%esp
+80105893:	ff 33                	push   (%ebx)
+80105895:	89 c7                	mov    %eax,%edi
+80105897:	ff 73 04             	push   0x4(%ebx)
+8010589a:	e8 41 58 00 00       	call   8010b0e0 <copyuvm>
+8010589f:	83 c4 10             	add    $0x10,%esp
+801058a2:	89 47 04             	mov    %eax,0x4(%edi)
+801058a5:	85 c0                	test   %eax,%eax
+801058a7:	0f 84 e6 00 00 00    	je     80105993 <fork+0x123>
+     mapupages(np->pgdir, np->pid) < 0){
+801058ad:	83 ec 08             	sub    $0x8,%esp
+801058b0:	ff 77 10             	push   0x10(%edi)
+801058b3:	50                   	push   %eax
+801058b4:	e8 e7 53 00 00       	call   8010aca0 <mapupages>
+  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0 ||
+801058b9:	83 c4 10             	add    $0x10,%esp
+801058bc:	85 c0                	test   %eax,%eax
+801058be:	0f 88 b9 00 00 00    	js     8010597d <fork+0x10d>
+  np->sz = curproc->sz;
+801058c4:	8b 03                	mov    (%ebx),%eax
+801058c6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+801058c9:	89 01                	mov    %eax,(%ecx)
+  *np->tf = *curproc->tf;
+801058cb:	8b 79 20             	mov    0x20(%ecx),%edi
+801058ce:	89 c8                	mov    %ecx,%eax
+801058d0:	b9 13 00 00 00       	mov    $0x13,%ecx
+801058d5:	8b 73 20             	mov    0x20(%ebx),%esi
+801058d8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  for(i = 0; i < NOFILE; i++)
+801058da:	31 f6                	xor    %esi,%esi
+  np->tf->eax = 0;
+801058dc:	8b 40 20             	mov    0x20(%eax),%eax
+801058df:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  for(i = 0; i < NOFILE; i++)
+801058e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801058ed:	8d 76 00             	lea    0x0(%esi),%esi
+    if(curproc->ofile[i])
+801058f0:	8b 44 b3 30          	mov    0x30(%ebx,%esi,4),%eax
+801058f4:	85 c0                	test   %eax,%eax
+801058f6:	74 13                	je     8010590b <fork+0x9b>
+      np->ofile[i] = filedup(curproc->ofile[i]);
+801058f8:	83 ec 0c             	sub    $0xc,%esp
+801058fb:	50                   	push   %eax
+801058fc:	e8 ff c8 ff ff       	call   80102200 <filedup>
+80105901:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80105904:	83 c4 10             	add    $0x10,%esp
+80105907:	89 44 b2 30          	mov    %eax,0x30(%edx,%esi,4)
+  for(i = 0; i < NOFILE; i++)
+8010590b:	83 c6 01             	add    $0x1,%esi
+8010590e:	83 fe 10             	cmp    $0x10,%esi
+80105911:	75 dd                	jne    801058f0 <fork+0x80>
+  np->cwd = idup(curproc->cwd);
+80105913:	83 ec 0c             	sub    $0xc,%esp
+80105916:	ff 73 70             	push   0x70(%ebx)
+80105919:	e8 a2 d2 ff ff       	call   80102bc0 <idup>
+8010591e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+80105921:	83 c4 0c             	add    $0xc,%esp
+  np->cwd = idup(curproc->cwd);
+80105924:	89 47 70             	mov    %eax,0x70(%edi)
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+80105927:	8d 43 74             	lea    0x74(%ebx),%eax
+8010592a:	6a 10                	push   $0x10
+8010592c:	50                   	push   %eax
+8010592d:	8d 47 74             	lea    0x74(%edi),%eax
+80105930:	50                   	push   %eax
+80105931:	e8 3a 1c 00 00       	call   80107570 <safestrcpy>
+  np->affinity = curproc->affinity;
+80105936:	8b 83 94 00 00 00    	mov    0x94(%ebx),%eax
+  pid = np->pid;
+8010593c:	8b 77 10             	mov    0x10(%edi),%esi
+  np->affinity = curproc->affinity;
+8010593f:	89 87 94 00 00 00    	mov    %eax,0x94(%edi)
+  acquire(&ptable.lock);
+80105945:	c7 04 24 20 46 1a 80 	movl   $0x801a4620,(%esp)
+8010594c:	e8 1f 17 00 00       	call   80107070 <acquire>
+  np->parent = curproc;
+80105951:	89 5f 14             	mov    %ebx,0x14(%edi)
+  np->sibling = curproc->children;
+80105954:	8b 43 18             	mov    0x18(%ebx),%eax
+80105957:	89 47 1c             	mov    %eax,0x1c(%edi)
+  makerunnable(np);
+8010595a:	89 f8                	mov    %edi,%eax
+  curproc->children = np;
+8010595c:	89 7b 18             	mov    %edi,0x18(%ebx)
+  makerunnable(np);
+8010595f:	e8 cc fa ff ff       	call   80105430 <makerunnable>
+  release(&ptable.lock);
+80105964:	c7 04 24 20 46 1a 80 	movl   $0x801a4620,(%esp)
+8010596b:	e8 90 15 00 00       	call   80106f00 <release>
+  return pid;
+80105970:	83 c4 10             	add    $0x10,%esp
+}
+80105973:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105976:	89 f0                	mov    %esi,%eax
+80105978:	5b                   	pop    %ebx
+80105979:	5e                   	pop    %esi
+8010597a:	5f                   	pop    %edi
+8010597b:	5d                   	pop    %ebp
+8010597c:	c3                   	ret
+    if(np->pgdir)
+8010597d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80105980:	8b 40 04             	mov    0x4(%eax),%eax
+80105983:	85 c0                	test   %eax,%eax
+80105985:	74 0c                	je     80105993 <fork+0x123>
+      freevm(np->pgdir);
+80105987:	83 ec 0c             	sub    $0xc,%esp
+8010598a:	50                   	push   %eax
+8010598b:	e8 b0 55 00 00       	call   8010af40 <freevm>
+80105990:	83 c4 10             	add    $0x10,%esp
+    np->pgdir = 0;
+80105993:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    kfree(np->kstack);
+80105996:	83 ec 0c             	sub    $0xc,%esp
+    np->pgdir = 0;
+80105999:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    kfree(np->kstack);
+801059a0:	ff 73 08             	push   0x8(%ebx)
+801059a3:	e8 48 df ff ff       	call   801038f0 <kfree>
+    np->kstack = 0;
+801059a8:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    acquire(&ptable.lock);
+801059af:	c7 04 24 20 46 1a 80 	movl   $0x801a4620,(%esp)
+801059b6:	e8 b5 16 00 00       	call   80107070 <acquire>
+    freeproc(np);
+801059bb:	89 d8                	mov    %ebx,%eax
+801059bd:	e8 3e f8 ff ff       	call   80105200 <freeproc>
+    release(&ptable.lock);
+801059c2:	c7 04 24 20 46 1a 80 	movl   $0x801a4620,(%esp)
+801059c9:	e8 32 15 00 00       	call   80106f00 <release>
+    return -1;
+801059ce:	83 c4 10             	add    $0x10,%esp
+    return -1;
+801059d1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+801059d6:	eb 9b                	jmp    80105973 <fork+0x103>
+801059d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801059df:	90                   	nop
+
+801059e0 <spawn>:
+{
+801059e0:	55                   	push   %ebp
+801059e1:	89 e5                	mov    %esp,%ebp
+801059e3:	57                   	push   %edi
+801059e4:	56                   	push   %esi
+801059e5:	53                   	push   %ebx
+801059e6:	83 ec 1c             	sub    $0x1c,%esp
+801059e9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+801059ec:	8b 75 14             	mov    0x14(%ebp),%esi
+  asm volatile("movl %%gs:4, %0" : "=r" (p) : : "memory");
+801059ef:	65 8b 3d 04 00 00 00 	mov    %gs:0x4,%edi
+  if(fdmap == 0)
+801059f6:	85 db                	test   %ebx,%ebx
+801059f8:	74 3e                	je     80105a38 <spawn+0x58>
+  else if(nfd < 0 || nfd > NOFILE)
+801059fa:	83 fe 10             	cmp    $0x10,%esi
+801059fd:	77 2c                	ja     80105a2b <spawn+0x4b>
+  for(i = 0; fdmap && i < nfd; i++)
+801059ff:	85 f6                	test   %esi,%esi
+80105a01:	74 3a                	je     80105a3d <spawn+0x5d>
+80105a03:	31 c0                	xor    %eax,%eax
+80105a05:	eb 1c                	jmp    80105a23 <spawn+0x43>
+80105a07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105a0e:	66 90                	xchg   %ax,%ax
+    if(fdmap[i] >= NOFILE || (fdmap[i] >= 0 && curproc->ofile[fdmap[i]] == 0))
+80105a10:	85 d2                	test   %edx,%edx
+80105a12:	78 08                	js     80105a1c <spawn+0x3c>
+80105a14:	8b 54 97 30          	mov    0x30(%edi,%edx,4),%edx
+80105a18:	85 d2                	test   %edx,%edx
+80105a1a:	74 0f                	je     80105a2b <spawn+0x4b>
+  for(i = 0; fdmap && i < nfd; i++)
+80105a1c:	83 c0 01             	add    $0x1,%eax
+80105a1f:	39 c6                	cmp    %eax,%esi
+80105a21:	74 1a                	je     80105a3d <spawn+0x5d>
+    if(fdmap[i] >= NOFILE || (fdmap[i] >= 0 && curproc->ofile[fdmap[i]] == 0))
+80105a23:	8b 14 83             	mov    (%ebx,%eax,4),%edx
+80105a26:	83 fa 0f             	cmp    $0xf,%edx
+80105a29:	7e e5                	jle    80105a10 <spawn+0x30>
+    return -1;
+80105a2b:	83 cb ff             	or     $0xffffffff,%ebx
+80105a2e:	e9 4e 01 00 00       	jmp    80105b81 <spawn+0x1a1>
+80105a33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105a37:	90                   	nop
+    nfd = NOFILE;
+80105a38:	be 10 00 00 00       	mov    $0x10,%esi
+  if((np = allocproc()) == 0)
+80105a3d:	e8 5e f8 ff ff       	call   801052a0 <allocproc>
+80105a42:	85 c0                	test   %eax,%eax
+80105a44:	74 e5                	je     80105a2b <spawn+0x4b>
+  memset(np->tf, 0, sizeof(*np->tf));
+80105a46:	83 ec 04             	sub    $0x4,%esp
+80105a49:	6a 4c                	push   $0x4c
+80105a4b:	6a 00                	push   $0x0
+80105a4d:	ff 70 20             	push   0x20(%eax)
+80105a50:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80105a53:	e8 68 19 00 00       	call   801073c0 <memset>
+                            &np->tf->eip, &np->tf->esp)) == 0){
+80105a58:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  if((np->pgdir = loadimage(path, argv, np->pid, &np->sz,
+80105a5b:	83 c4 08             	add    $0x8,%esp
+                            &np->tf->eip, &np->tf->esp)) == 0){
+80105a5e:	8b 41 20             	mov    0x20(%ecx),%eax
+  if((np->pgdir = loadimage(path, argv, np->pid, &np->sz,
+80105a61:	8d 50 44             	lea    0x44(%eax),%edx
+80105a64:	83 c0 38             	add    $0x38,%eax
+80105a67:	52                   	push   %edx
+80105a68:	50                   	push   %eax
+80105a69:	51                   	push   %ecx
+80105a6a:	ff 71 10             	push   0x10(%ecx)
+80105a6d:	ff 75 0c             	push   0xc(%ebp)
+80105a70:	ff 75 08             	push   0x8(%ebp)
+80105a73:	e8 b8 c1 ff ff       	call   80101c30 <loadimage>
+80105a78:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80105a7b:	83 c4 20             	add    $0x20,%esp
+80105a7e:	89 41 04             	mov    %eax,0x4(%ecx)
+80105a81:	85 c0                	test   %eax,%eax
+80105a83:	0f 84 02 01 00 00    	je     80105b8b <spawn+0x1ab>
+  np->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+80105a89:	8b 41 20             	mov    0x20(%ecx),%eax
+80105a8c:	ba 1b 00 00 00       	mov    $0x1b,%edx
+80105a91:	66 89 50 3c          	mov    %dx,0x3c(%eax)
+  np->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+80105a95:	8b 41 20             	mov    0x20(%ecx),%eax
+80105a98:	ba 23 00 00 00       	mov    $0x23,%edx
+80105a9d:	66 89 50 2c          	mov    %dx,0x2c(%eax)
+  np->tf->es = np->tf->ds;
+80105aa1:	8b 41 20             	mov    0x20(%ecx),%eax
+80105aa4:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80105aa8:	66 89 50 28          	mov    %dx,0x28(%eax)
+  np->tf->ss = np->tf->ds;
+80105aac:	8b 41 20             	mov    0x20(%ecx),%eax
+80105aaf:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80105ab3:	66 89 50 48          	mov    %dx,0x48(%eax)
+  np->tf->eflags = FL_IF;
+80105ab7:	8b 41 20             	mov    0x20(%ecx),%eax
+80105aba:	c7 40 40 00 02 00 00 	movl   $0x200,0x40(%eax)
+  for(i = 0; i < nfd; i++){
+80105ac1:	85 f6                	test   %esi,%esi
+80105ac3:	74 4a                	je     80105b0f <spawn+0x12f>
+80105ac5:	31 d2                	xor    %edx,%edx
+80105ac7:	eb 15                	jmp    80105ade <spawn+0xfe>
+80105ac9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    fd = fdmap ? fdmap[i] : i;
+80105ad0:	8b 04 93             	mov    (%ebx,%edx,4),%eax
+    if(fd >= 0 && curproc->ofile[fd])
+80105ad3:	85 c0                	test   %eax,%eax
+80105ad5:	79 0d                	jns    80105ae4 <spawn+0x104>
+  for(i = 0; i < nfd; i++){
+80105ad7:	83 c2 01             	add    $0x1,%edx
+80105ada:	39 f2                	cmp    %esi,%edx
+80105adc:	74 31                	je     80105b0f <spawn+0x12f>
+    fd = fdmap ? fdmap[i] : i;
+80105ade:	85 db                	test   %ebx,%ebx
+80105ae0:	75 ee                	jne    80105ad0 <spawn+0xf0>
+80105ae2:	89 d0                	mov    %edx,%eax
+    if(fd >= 0 && curproc->ofile[fd])
+80105ae4:	8b 44 87 30          	mov    0x30(%edi,%eax,4),%eax
+80105ae8:	85 c0                	test   %eax,%eax
+80105aea:	74 eb                	je     80105ad7 <spawn+0xf7>
+      np->ofile[i] = filedup(curproc->ofile[fd]);
+80105aec:	83 ec 0c             	sub    $0xc,%esp
+80105aef:	89 55 e0             	mov    %edx,-0x20(%ebp)
+80105af2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80105af5:	50                   	push   %eax
+80105af6:	e8 05 c7 ff ff       	call   80102200 <filedup>
+80105afb:	8b 55 e0             	mov    -0x20(%ebp),%edx
+80105afe:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80105b01:	83 c4 10             	add    $0x10,%esp
+80105b04:	89 44 91 30          	mov    %eax,0x30(%ecx,%edx,4)
+  for(i = 0; i < nfd; i++){
+80105b08:	83 c2 01             	add    $0x1,%edx
+80105b0b:	39 f2                	cmp    %esi,%edx
+80105b0d:	75 cf                	jne    80105ade <spawn+0xfe>
+  np->cwd = idup(curproc->cwd);
+80105b0f:	83 ec 0c             	sub    $0xc,%esp
+80105b12:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80105b15:	ff 77 70             	push   0x70(%edi)
+80105b18:	e8 a3 d0 ff ff       	call   80102bc0 <idup>
+80105b1d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80105b20:	89 41 70             	mov    %eax,0x70(%ecx)
+  safestrcpy(np->name, progname(path), sizeof(np->name));
+80105b23:	58                   	pop    %eax
+80105b24:	ff 75 08             	push   0x8(%ebp)
+80105b27:	e8 94 c4 ff ff       	call   80101fc0 <progname>
+80105b2c:	83 c4 0c             	add    $0xc,%esp
+80105b2f:	6a 10                	push   $0x10
+80105b31:	50                   	push   %eax
+80105b32:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80105b35:	8d 41 74             	lea    0x74(%ecx),%eax
+80105b38:	50                   	push   %eax
+80105b39:	e8 32 1a 00 00       	call   80107570 <safestrcpy>
+  np->affinity = curproc->affinity;
+80105b3e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80105b41:	8b 87 94 00 00 00    	mov    0x94(%edi),%eax
+  pid = np->pid;
+80105b47:	8b 59 10             	mov    0x10(%ecx),%ebx
+  np->affinity = curproc->affinity;
+80105b4a:	89 81 94 00 00 00    	mov    %eax,0x94(%ecx)
+  acquire(&ptable.lock);
+80105b50:	c7 04 24 20 46 1a 80 	movl   $0x801a4620,(%esp)
+80105b57:	e8 14 15 00 00       	call   80107070 <acquire>
+  np->parent = curproc;
+80105b5c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80105b5f:	89 79 14             	mov    %edi,0x14(%ecx)
+  np->sibling = curproc->children;
+80105b62:	8b 47 18             	mov    0x18(%edi),%eax
+80105b65:	89 41 1c             	mov    %eax,0x1c(%ecx)
+  makerunnable(np);
+80105b68:	89 c8                	mov    %ecx,%eax
+  curproc->children = np;
+80105b6a:	89 4f 18             	mov    %ecx,0x18(%edi)
+  makerunnable(np);
+80105b6d:	e8 be f8 ff ff       	call   80105430 <makerunnable>
+  release(&ptable.lock);
+80105b72:	c7 04 24 20 46 1a 80 	movl   $0x801a4620,(%esp)
+80105b79:	e8 82 13 00 00       	call   80106f00 <release>
+  return pid;
+80105b7e:	83 c4 10             	add    $0x10,%esp
+}
+80105b81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105b84:	89 d8                	mov    %ebx,%eax
+80105b86:	5b                   	pop    %ebx
+80105b87:	5e                   	pop    %esi
+80105b88:	5f                   	pop    %edi
+80105b89:	5d                   	pop    %ebp
+80105b8a:	c3                   	ret
+    kfree(np->kstack);
+80105b8b:	83 ec 0c             	sub    $0xc,%esp
+80105b8e:	ff 71 08             	push   0x8(%ecx)
+    np->kstack = 0;
+80105b91:	31 db                	xor    %ebx,%ebx
+    kfree(np->kstack);
+80105b93:	e8 58 dd ff ff       	call   801038f0 <kfree>
+    np->kstack = 0;
+80105b98:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80105b9b:	89 59 08             	mov    %ebx,0x8(%ecx)
+    acquire(&ptable.lock);
+80105b9e:	c7 04 24 20 46 1a 80 	movl   $0x801a4620,(%esp)
+80105ba5:	e8 c6 14 00 00       	call   80107070 <acquire>
+    freeproc(np);
+80105baa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80105bad:	e8 4e f6 ff ff       	call   80105200 <freeproc>
+    release(&ptable.lock);
+80105bb2:	c7 04 24 20 46 1a 80 	movl   $0x801a4620,(%esp)
+80105bb9:	e8 42 13 00 00       	call   80106f00 <release>
+    return -1;
+80105bbe:	83 c4 10             	add    $0x10,%esp
+80105bc1:	e9 65 fe ff ff       	jmp    80105a2b <spawn+0x4b>
+80105bc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105bcd:	8d 76 00             	lea    0x0(%esi),%esi
+
+80105bd0 <scheduler>:
+{
+80105bd0:	55                   	push   %ebp
+80105bd1:	89 e5                	mov    %esp,%ebp
+80105bd3:	57                   	push   %edi
+80105bd4:	56                   	push   %esi
+80105bd5:	53                   	push   %ebx
+80105bd6:	83 ec 1c             	sub    $0x1c,%esp
+  asm volatile("movl %%gs:0, %0" : "=r" (c));
+80105bd9:	65 8b 35 00 00 00 00 	mov    %gs:0x0,%esi
+80105be0:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+  return mycpu()-cpus;
+80105be6:	2d 60 3b 1a 80       	sub    $0x801a3b60,%eax
+  c->proc = 0;
+80105beb:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+  return mycpu()-cpus;
+80105bf2:	c1 f8 02             	sar    $0x2,%eax
+80105bf5:	69 f8 d1 58 1f 1a    	imul   $0x1a1f58d1,%eax,%edi
+        if(p->state != RUNNABLE || (p->affinity & (1 << id)) == 0)
+80105bfb:	b8 01 00 00 00       	mov    $0x1,%eax
+80105c00:	89 f9                	mov    %edi,%ecx
+  return mycpu()-cpus;
+80105c02:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+        if(p->state != RUNNABLE || (p->affinity & (1 << id)) == 0)
+80105c05:	d3 e0                	shl    %cl,%eax
+80105c07:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80105c0a:	8d 46 0c             	lea    0xc(%esi),%eax
+80105c0d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  asm volatile("sti");
+80105c10:	fb                   	sti
+    acquire(&ptable.lock);
+80105c11:	83 ec 0c             	sub    $0xc,%esp
+80105c14:	68 20 46 1a 80       	push   $0x801a4620
+80105c19:	e8 52 14 00 00       	call   80107070 <acquire>
+      for(p = ptable.list; p; p = p->next){
+80105c1e:	8b 1d 80 46 1a 80    	mov    0x801a4680,%ebx
+80105c24:	83 c4 10             	add    $0x10,%esp
+    c->idle = 0;
+80105c27:	c7 86 bc 00 00 00 00 	movl   $0x0,0xbc(%esi)
+80105c2e:	00 00 00 
+      for(p = ptable.list; p; p = p->next){
+80105c31:	89 d8                	mov    %ebx,%eax
+80105c33:	85 db                	test   %ebx,%ebx
+80105c35:	0f 84 a9 00 00 00    	je     80105ce4 <scheduler+0x114>
+    for(pass = 0; pass < 2 && !ran; pass++){
+80105c3b:	31 ff                	xor    %edi,%edi
+80105c3d:	31 d2                	xor    %edx,%edx
+80105c3f:	89 55 e0             	mov    %edx,-0x20(%ebp)
+80105c42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        if(p->state != RUNNABLE || (p->affinity & (1 << id)) == 0)
+80105c48:	83 7b 0c 03          	cmpl   $0x3,0xc(%ebx)
+80105c4c:	75 78                	jne    80105cc6 <scheduler+0xf6>
+80105c4e:	8b 83 94 00 00 00    	mov    0x94(%ebx),%eax
+80105c54:	85 45 dc             	test   %eax,-0x24(%ebp)
+80105c57:	74 6d                	je     80105cc6 <scheduler+0xf6>
+        if(pass == 0 && p->lastcpu != id && p->lastcpu >= 0 &&
+80105c59:	85 ff                	test   %edi,%edi
+80105c5b:	75 23                	jne    80105c80 <scheduler+0xb0>
+80105c5d:	8b 8b 90 00 00 00    	mov    0x90(%ebx),%ecx
+80105c63:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80105c66:	39 d1                	cmp    %edx,%ecx
+80105c68:	74 16                	je     80105c80 <scheduler+0xb0>
+80105c6a:	85 c9                	test   %ecx,%ecx
+80105c6c:	78 12                	js     80105c80 <scheduler+0xb0>
+           (p->affinity & (1 << p->lastcpu)))
+80105c6e:	ba 01 00 00 00       	mov    $0x1,%edx
+80105c73:	d3 e2                	shl    %cl,%edx
+        if(pass == 0 && p->lastcpu != id && p->lastcpu >= 0 &&
+80105c75:	85 c2                	test   %eax,%edx
+80105c77:	75 4d                	jne    80105cc6 <scheduler+0xf6>
+80105c79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        switchuvm(p);
+80105c80:	83 ec 0c             	sub    $0xc,%esp
+        c->proc = p;
+80105c83:	89 5e 04             	mov    %ebx,0x4(%esi)
+        switchuvm(p);
+80105c86:	53                   	push   %ebx
+80105c87:	e8 84 4e 00 00       	call   8010ab10 <switchuvm>
+        p->lastcpu = id;
+80105c8c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+        p->nswitch++;
+80105c8f:	83 83 b4 00 00 00 01 	addl   $0x1,0xb4(%ebx)
+        p->state = RUNNING;
+80105c96:	c7 43 0c 04 00 00 00 	movl   $0x4,0xc(%ebx)
+        p->lastcpu = id;
+80105c9d:	89 83 90 00 00 00    	mov    %eax,0x90(%ebx)
+        swtch(&(c->scheduler), p->context);
+80105ca3:	58                   	pop    %eax
+80105ca4:	5a                   	pop    %edx
+80105ca5:	ff 73 24             	push   0x24(%ebx)
+80105ca8:	ff 75 d8             	push   -0x28(%ebp)
+80105cab:	e8 1b 19 00 00       	call   801075cb <swtch>
+        switchkvm();
+80105cb0:	e8 4b 4e 00 00       	call   8010ab00 <switchkvm>
+        c->proc = 0;
+80105cb5:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+80105cbc:	83 c4 10             	add    $0x10,%esp
+        ran = 1;
+80105cbf:	c7 45 e0 01 00 00 00 	movl   $0x1,-0x20(%ebp)
+      for(p = ptable.list; p; p = p->next){
+80105cc6:	8b 9b 84 00 00 00    	mov    0x84(%ebx),%ebx
+80105ccc:	85 db                	test   %ebx,%ebx
+80105cce:	0f 85 74 ff ff ff    	jne    80105c48 <scheduler+0x78>
+    for(pass = 0; pass < 2 && !ran; pass++){
+80105cd4:	8b 55 e0             	mov    -0x20(%ebp),%edx
+80105cd7:	85 ff                	test   %edi,%edi
+80105cd9:	75 4d                	jne    80105d28 <scheduler+0x158>
+80105cdb:	85 d2                	test   %edx,%edx
+80105cdd:	75 4d                	jne    80105d2c <scheduler+0x15c>
+80105cdf:	a1 80 46 1a 80       	mov    0x801a4680,%eax
+      for(p = ptable.list; p; p = p->next){
+80105ce4:	89 c3                	mov    %eax,%ebx
+80105ce6:	bf 01 00 00 00       	mov    $0x1,%edi
+80105ceb:	85 c0                	test   %eax,%eax
+80105ced:	0f 85 4a ff ff ff    	jne    80105c3d <scheduler+0x6d>
+      c->idle = 1;
+80105cf3:	c7 86 bc 00 00 00 01 	movl   $0x1,0xbc(%esi)
+80105cfa:	00 00 00 
+    release(&ptable.lock);
+80105cfd:	83 ec 0c             	sub    $0xc,%esp
+80105d00:	68 20 46 1a 80       	push   $0x801a4620
+80105d05:	e8 f6 11 00 00       	call   80106f00 <release>
+  asm volatile("cli");
+80105d0a:	fa                   	cli
+      if(c->idle)
+80105d0b:	8b 86 bc 00 00 00    	mov    0xbc(%esi),%eax
+80105d11:	83 c4 10             	add    $0x10,%esp
+80105d14:	85 c0                	test   %eax,%eax
+80105d16:	0f 84 f4 fe ff ff    	je     80105c10 <scheduler+0x40>
+  asm volatile("sti; hlt");
+80105d1c:	fb                   	sti
+80105d1d:	f4                   	hlt
+}
+80105d1e:	e9 ed fe ff ff       	jmp    80105c10 <scheduler+0x40>
+80105d23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105d27:	90                   	nop
+    if(!ran)
+80105d28:	85 d2                	test   %edx,%edx
+80105d2a:	74 c7                	je     80105cf3 <scheduler+0x123>
+    release(&ptable.lock);
+80105d2c:	83 ec 0c             	sub    $0xc,%esp
+80105d2f:	68 20 46 1a 80       	push   $0x801a4620
+80105d34:	e8 c7 11 00 00       	call   80106f00 <release>
+    if(!ran){
+80105d39:	83 c4 10             	add    $0x10,%esp
+80105d3c:	e9 cf fe ff ff       	jmp    80105c10 <scheduler+0x40>
+80105d41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105d48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105d4f:	90                   	nop
+
+80105d50 <sched>:
+{
+80105d50:	55                   	push   %ebp
+80105d51:	89 e5                	mov    %esp,%ebp
+80105d53:	56                   	push   %esi
+80105d54:	53                   	push   %ebx
+  asm volatile("movl %%gs:4, %0" : "=r" (p) : : "memory");
+80105d55:	65 8b 1d 04 00 00 00 	mov    %gs:0x4,%ebx
+  if(!holding(&ptable.lock))
+80105d5c:	83 ec 0c             	sub    $0xc,%esp
+80105d5f:	68 20 46 1a 80       	push   $0x801a4620
+80105d64:	e8 57 11 00 00       	call   80106ec0 <holding>
+80105d69:	83 c4 10             	add    $0x10,%esp
+80105d6c:	85 c0                	test   %eax,%eax
+80105d6e:	74 53                	je     80105dc3 <sched+0x73>
+  asm volatile("movl %%gs:0, %0" : "=r" (c));
+80105d70:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+  if(mycpu()->ncli != 1)
+80105d76:	83 b8 b4 00 00 00 01 	cmpl   $0x1,0xb4(%eax)
+80105d7d:	75 6b                	jne    80105dea <sched+0x9a>
+  if(p->state == RUNNING)
+80105d7f:	83 7b 0c 04          	cmpl   $0x4,0xc(%ebx)
+80105d83:	74 58                	je     80105ddd <sched+0x8d>
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80105d85:	9c                   	pushf
+80105d86:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+80105d87:	f6 c4 02             	test   $0x2,%ah
+80105d8a:	75 44                	jne    80105dd0 <sched+0x80>
+  asm volatile("movl %%gs:0, %0" : "=r" (c));
+80105d8c:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+  intena = mycpu()->intena;
+80105d92:	8b b0 b8 00 00 00    	mov    0xb8(%eax),%esi
+  asm volatile("movl %%gs:0, %0" : "=r" (c));
+80105d98:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+  swtch(&p->context, mycpu()->scheduler);
+80105d9e:	83 ec 08             	sub    $0x8,%esp
+80105da1:	83 c3 24             	add    $0x24,%ebx
+80105da4:	ff 70 0c             	push   0xc(%eax)
+80105da7:	53                   	push   %ebx
+80105da8:	e8 1e 18 00 00       	call   801075cb <swtch>
+  asm volatile("movl %%gs:0, %0" : "=r" (c));
+80105dad:	65 a1 00 00 00 00    	mov    %gs:0x0,%eax
+  mycpu()->intena = intena;
+80105db3:	89 b0 b8 00 00 00    	mov    %esi,0xb8(%eax)
+}
+80105db9:	83 c4 10             	add    $0x10,%esp
+80105dbc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105dbf:	5b                   	pop    %ebx
+80105dc0:	5e                   	pop    %esi
+80105dc1:	5d                   	pop    %ebp
+80105dc2:	c3                   	ret
+    panic("sched ptable.lock");
+80105dc3:	83 ec 0c             	sub    $0xc,%esp
+80105dc6:	68 9a bb 10 80       	push   $0x8010bb9a
+80105dcb:	e8 f0 b6 ff ff       	call   801014c0 <panic>
+    panic("sched interruptible");
+80105dd0:	83 ec 0c             	sub    $0xc,%esp
+80105dd3:	68 c6 bb 10 80       	push   $0x8010bbc6
+80105dd8:	e8 e3 b6 ff ff       	call   801014c0 <panic>
+    panic("sched running");
+80105ddd:	83 ec 0c             	sub    $0xc,%esp
+80105de0:	68 b8 bb 10 80       	push   $0x8010bbb8
+80105de5:	e8 d6 b6 ff ff       	call   801014c0 <panic>
+    panic("sched locks");
+80105dea:	83 ec 0c             	sub    $0xc,%esp
+80105ded:	68 ac bb 10 80       	push   $0x8010bbac
+80105df2:	e8 c9 b6 ff ff       	call   801014c0 <panic>
+80105df7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105dfe:	66 90                	xchg   %ax,%ax
+
+80105e00 <exit>:
+{
+80105e00:	55                   	push   %ebp
+80105e01:	89 e5                	mov    %esp,%ebp
+80105e03:	57                   	push   %edi
+80105e04:	56                   	push   %esi
+80105e05:	53                   	push   %ebx
+80105e06:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("movl %%gs:4, %0" : "=r" (p) : : "memory");
+80105e09:	65 8b 3d 04 00 00 00 	mov    %gs:0x4,%edi
+  if(curproc == initproc)
+80105e10:	39 3d 8c 4a 1a 80    	cmp    %edi,0x801a4a8c
+80105e16:	0f 84 d4 00 00 00    	je     80105ef0 <exit+0xf0>
+  aioexit();
+80105e1c:	e8 4f a8 ff ff       	call   80100670 <aioexit>
+  for(fd = 0; fd < NOFILE; fd++){
+80105e21:	8d 5f 30             	lea    0x30(%edi),%ebx
+80105e24:	8d 77 70             	lea    0x70(%edi),%esi
+80105e27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105e2e:	66 90                	xchg   %ax,%ax
+    if(curproc->ofile[fd]){
+80105e30:	8b 03                	mov    (%ebx),%eax
+80105e32:	85 c0                	test   %eax,%eax
+80105e34:	74 12                	je     80105e48 <exit+0x48>
+      fileclose(curproc->ofile[fd]);
+80105e36:	83 ec 0c             	sub    $0xc,%esp
+80105e39:	50                   	push   %eax
+80105e3a:	e8 11 c4 ff ff       	call   80102250 <fileclose>
+      curproc->ofile[fd] = 0;
+80105e3f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+80105e45:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++){
+80105e48:	83 c3 04             	add    $0x4,%ebx
+80105e4b:	39 f3                	cmp    %esi,%ebx
+80105e4d:	75 e1                	jne    80105e30 <exit+0x30>
+  if(curproc->cwd){  // kernel threads have none
+80105e4f:	8b 4f 70             	mov    0x70(%edi),%ecx
+80105e52:	85 c9                	test   %ecx,%ecx
+80105e54:	74 1d                	je     80105e73 <exit+0x73>
+    begin_op();
+80105e56:	e8 65 e5 ff ff       	call   801043c0 <begin_op>
+    iput(curproc->cwd);
+80105e5b:	83 ec 0c             	sub    $0xc,%esp
+80105e5e:	ff 77 70             	push   0x70(%edi)
+80105e61:	e8 2a cf ff ff       	call   80102d90 <iput>
+    end_op();
+80105e66:	e8 c5 e5 ff ff       	call   80104430 <end_op>
+    curproc->cwd = 0;
+80105e6b:	31 d2                	xor    %edx,%edx
+80105e6d:	83 c4 10             	add    $0x10,%esp
+80105e70:	89 57 70             	mov    %edx,0x70(%edi)
+  acquire(&ptable.lock);
+80105e73:	83 ec 0c             	sub    $0xc,%esp
+80105e76:	68 20 46 1a 80       	push   $0x801a4620
+80105e7b:	e8 f0 11 00 00       	call   80107070 <acquire>
+  wakeup1(curproc->parent);
+80105e80:	8b 47 14             	mov    0x14(%edi),%eax
+80105e83:	e8 78 f6 ff ff       	call   80105500 <wakeup1>
+  for(p = curproc->children; p; p = p->sibling){
+80105e88:	8b 5f 18             	mov    0x18(%edi),%ebx
+80105e8b:	83 c4 10             	add    $0x10,%esp
+80105e8e:	85 db                	test   %ebx,%ebx
+80105e90:	74 45                	je     80105ed7 <exit+0xd7>
+    p->parent = initproc;
+80105e92:	8b 15 8c 4a 1a 80    	mov    0x801a4a8c,%edx
+80105e98:	eb 0f                	jmp    80105ea9 <exit+0xa9>
+80105e9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(p = curproc->children; p; p = p->sibling){
+80105ea0:	8b 43 1c             	mov    0x1c(%ebx),%eax
+80105ea3:	85 c0                	test   %eax,%eax
+80105ea5:	74 1f                	je     80105ec6 <exit+0xc6>
+80105ea7:	89 c3                	mov    %eax,%ebx
+    if(p->state == ZOMBIE)
+80105ea9:	83 7b 0c 05          	cmpl   $0x5,0xc(%ebx)
+    p->parent = initproc;
+80105ead:	89 53 14             	mov    %edx,0x14(%ebx)
+    if(p->state == ZOMBIE)
+80105eb0:	75 ee                	jne    80105ea0 <exit+0xa0>
+      wakeup1(initproc);
+80105eb2:	89 d0                	mov    %edx,%eax
+80105eb4:	e8 47 f6 ff ff       	call   80105500 <wakeup1>
+  for(p = curproc->children; p; p = p->sibling){
+80105eb9:	8b 43 1c             	mov    0x1c(%ebx),%eax
+    last->sibling = initproc->children;
+80105ebc:	8b 15 8c 4a 1a 80    	mov    0x801a4a8c,%edx
+  for(p = curproc->children; p; p = p->sibling){
+80105ec2:	85 c0                	test   %eax,%eax
+80105ec4:	75 e1                	jne    80105ea7 <exit+0xa7>
+    last->sibling = initproc->children;
+80105ec6:	8b 42 18             	mov    0x18(%edx),%eax
+80105ec9:	89 43 1c             	mov    %eax,0x1c(%ebx)
+    initproc->children = curproc->children;
+80105ecc:	8b 47 18             	mov    0x18(%edi),%eax
+80105ecf:	89 42 18             	mov    %eax,0x18(%edx)
+    curproc->children = 0;
+80105ed2:	31 c0                	xor    %eax,%eax
+80105ed4:	89 47 18             	mov    %eax,0x18(%edi)
+  curproc->state = ZOMBIE;
+80105ed7:	c7 47 0c 05 00 00 00 	movl   $0x5,0xc(%edi)
+  sched();
+80105ede:	e8 6d fe ff ff       	call   80105d50 <sched>
+  panic("zombie exit");
+80105ee3:	83 ec 0c             	sub    $0xc,%esp
+80105ee6:	68 e7 bb 10 80       	push   $0x8010bbe7
+80105eeb:	e8 d0 b5 ff ff       	call   801014c0 <panic>
+    panic("init exiting");
+80105ef0:	83 ec 0c             	sub    $0xc,%esp
+80105ef3:	68 da bb 10 80       	push   $0x8010bbda
+80105ef8:	e8 c3 b5 ff ff       	call   801014c0 <panic>
+80105efd:	8d 76 00             	lea    0x0(%esi),%esi
+
+80105f00 <wait>:
+{
+80105f00:	55                   	push   %ebp
+80105f01:	89 e5                	mov    %esp,%ebp
+80105f03:	57                   	push   %edi
+80105f04:	56                   	push   %esi
+80105f05:	53                   	push   %ebx
+80105f06:	83 ec 18             	sub    $0x18,%esp
+  asm volatile("movl %%gs:4, %0" : "=r" (p) : : "memory");
+80105f09:	65 8b 35 04 00 00 00 	mov    %gs:0x4,%esi
+  acquire(&ptable.lock);
+80105f10:	68 20 46 1a 80       	push   $0x801a4620
+    for(pp = &curproc->children; (p = *pp) != 0; pp = &p->sibling){
+80105f15:	8d 7e 18             	lea    0x18(%esi),%edi
+  acquire(&ptable.lock);
+80105f18:	e8 53 11 00 00       	call   80107070 <acquire>
+    for(pp = &curproc->children; (p = *pp) != 0; pp = &p->sibling){
+80105f1d:	8b 46 18             	mov    0x18(%esi),%eax
+80105f20:	83 c4 10             	add    $0x10,%esp
+80105f23:	85 c0                	test   %eax,%eax
+80105f25:	0f 84 b0 00 00 00    	je     80105fdb <wait+0xdb>
+80105f2b:	89 f9                	mov    %edi,%ecx
+80105f2d:	eb 08                	jmp    80105f37 <wait+0x37>
+80105f2f:	90                   	nop
+80105f30:	8d 4b 1c             	lea    0x1c(%ebx),%ecx
+80105f33:	85 c0                	test   %eax,%eax
+80105f35:	74 71                	je     80105fa8 <wait+0xa8>
+      if(p->state == ZOMBIE){
+80105f37:	8b 50 0c             	mov    0xc(%eax),%edx
+80105f3a:	89 c3                	mov    %eax,%ebx
+        *pp = p->sibling;
+80105f3c:	8b 40 1c             	mov    0x1c(%eax),%eax
+      if(p->state == ZOMBIE){
+80105f3f:	83 fa 05             	cmp    $0x5,%edx
+80105f42:	75 ec                	jne    80105f30 <wait+0x30>
+        release(&ptable.lock);
+80105f44:	83 ec 0c             	sub    $0xc,%esp
+        *pp = p->sibling;
+80105f47:	89 01                	mov    %eax,(%ecx)
+        pid = p->pid;
+80105f49:	8b 73 10             	mov    0x10(%ebx),%esi
+        release(&ptable.lock);
+80105f4c:	68 20 46 1a 80       	push   $0x801a4620
+80105f51:	e8 aa 0f 00 00       	call   80106f00 <release>
+        kfree(p->kstack);
+80105f56:	5a                   	pop    %edx
+80105f57:	ff 73 08             	push   0x8(%ebx)
+80105f5a:	e8 91 d9 ff ff       	call   801038f0 <kfree>
+        p->kstack = 0;
+80105f5f:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+        freevm(p->pgdir);
+80105f66:	59                   	pop    %ecx
+80105f67:	ff 73 04             	push   0x4(%ebx)
+80105f6a:	e8 d1 4f 00 00       	call   8010af40 <freevm>
+        p->pgdir = 0;
+80105f6f:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+        acquire(&ptable.lock);
+80105f76:	c7 04 24 20 46 1a 80 	movl   $0x801a4620,(%esp)
+80105f7d:	e8 ee 10 00 00       	call   80107070 <acquire>
+        freeproc(p);
+80105f82:	89 d8                	mov    %ebx,%eax
+80105f84:	e8 77 f2 ff ff       	call   80105200 <freeproc>
+        release(&ptable.lock);
+80105f89:	c7 04 24 20 46 1a 80 	movl   $0x801a4620,(%esp)
+80105f90:	e8 6b 0f 00 00       	call   80106f00 <release>
+        return pid;
+80105f95:	83 c4 10             	add    $0x10,%esp
+}
+80105f98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105f9b:	89 f0                	mov    %esi,%eax
+80105f9d:	5b                   	pop    %ebx
+80105f9e:	5e                   	pop    %esi
+80105f9f:	5f                   	pop    %edi
+80105fa0:	5d                   	pop    %ebp
+80105fa1:	c3                   	ret
+80105fa2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(curproc->children == 0 || curproc->killed){
+80105fa8:	8b 46 2c             	mov    0x2c(%esi),%eax
+80105fab:	85 c0                	test   %eax,%eax
+80105fad:	75 2c                	jne    80105fdb <wait+0xdb>
+  asm volatile("movl %%gs:4, %0" : "=r" (p) : : "memory");
+80105faf:	65 8b 1d 04 00 00 00 	mov    %gs:0x4,%ebx
+  if(p == 0)
+80105fb6:	85 db                	test   %ebx,%ebx
+80105fb8:	74 38                	je     80105ff2 <wait+0xf2>
+  p->chan = chan;
+80105fba:	89 73 28             	mov    %esi,0x28(%ebx)
+  p->state = SLEEPING;
+80105fbd:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+  sched();
+80105fc4:	e8 87 fd ff ff       	call   80105d50 <sched>
+  p->chan = 0;
+80105fc9:	c7 43 28 00 00 00 00 	movl   $0x0,0x28(%ebx)
+    for(pp = &curproc->children; (p = *pp) != 0; pp = &p->sibling){
+80105fd0:	8b 46 18             	mov    0x18(%esi),%eax
+80105fd3:	85 c0                	test   %eax,%eax
+80105fd5:	0f 85 50 ff ff ff    	jne    80105f2b <wait+0x2b>
+      release(&ptable.lock);
+80105fdb:	83 ec 0c             	sub    $0xc,%esp
+      return -1;
+80105fde:	be ff ff ff ff       	mov    $0xffffffff,%esi
+      release(&ptable.lock);
+80105fe3:	68 20 46 1a 80       	push   $0x801a4620
+80105fe8:	e8 13 0f 00 00       	call   80106f00 <release>
+      return -1;
+80105fed:	83 c4 10             	add    $0x10,%esp
+80105ff0:	eb a6                	jmp    80105f98 <wait+0x98>
+    panic("sleep");
+80105ff2:	83 ec 0c             	sub    $0xc,%esp
+80105ff5:	68 6e bc 10 80       	push   $0x8010bc6e
+80105ffa:	e8 c1 b4 ff ff       	call   801014c0 <panic>
+80105fff:	90                   	nop
+
+80106000 <yield>:
+{
+80106000:	55                   	push   %ebp
+80106001:	89 e5                	mov    %esp,%ebp
+80106003:	83 ec 14             	sub    $0x14,%esp
+  acquire(&ptable.lock);  //DOC: yieldlock
+80106006:	68 20 46 1a 80       	push   $0x801a4620
+8010600b:	e8 60 10 00 00       	call   80107070 <acquire>
+  asm volatile("movl %%gs:4, %0" : "=r" (p) : : "memory");
+80106010:	65 a1 04 00 00 00    	mov    %gs:0x4,%eax
+  myproc()->state = RUNNABLE;
+80106016:	c7 40 0c 03 00 00 00 	movl   $0x3,0xc(%eax)
+  sched();
+8010601d:	e8 2e fd ff ff       	call   80105d50 <sched>
+  release(&ptable.lock);
+80106022:	c7 04 24 20 46 1a 80 	movl   $0x801a4620,(%esp)
+80106029:	e8 d2 0e 00 00       	call   80106f00 <release>
+}
+8010602e:	83 c4 10             	add    $0x10,%esp
+80106031:	c9                   	leave
+80106032:	c3                   	ret
+80106033:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010603a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80106040 <sleep>:
+{
+80106040:	55                   	push   %ebp
+80106041:	89 e5                	mov    %esp,%ebp
+80106043:	57                   	push   %edi
+80106044:	56                   	push   %esi
+80106045:	53                   	push   %ebx
+80106046:	83 ec 0c             	sub    $0xc,%esp
+80106049:	8b 7d 08             	mov    0x8(%ebp),%edi
+8010604c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  asm volatile("movl %%gs:4, %0" : "=r" (p) : : "memory");
+8010604f:	65 8b 1d 04 00 00 00 	mov    %gs:0x4,%ebx
+  if(p == 0)
+80106056:	85 db                	test   %ebx,%ebx
+80106058:	0f 84 85 00 00 00    	je     801060e3 <sleep+0xa3>
+  if(lk == 0)
+8010605e:	85 f6                	test   %esi,%esi
+80106060:	74 74                	je     801060d6 <sleep+0x96>
+  if(lk != &ptable.lock){  //DOC: sleeplock0
+80106062:	81 fe 20 46 1a 80    	cmp    $0x801a4620,%esi
+80106068:	74 4e                	je     801060b8 <sleep+0x78>
+    acquire(&ptable.lock);  //DOC: sleeplock1
+8010606a:	83 ec 0c             	sub    $0xc,%esp
+8010606d:	68 20 46 1a 80       	push   $0x801a4620
+80106072:	e8 f9 0f 00 00       	call   80107070 <acquire>
+    release(lk);
+80106077:	89 34 24             	mov    %esi,(%esp)
+8010607a:	e8 81 0e 00 00       	call   80106f00 <release>
+  p->chan = chan;
+8010607f:	89 7b 28             	mov    %edi,0x28(%ebx)
+  p->state = SLEEPING;
+80106082:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+  sched();
+80106089:	e8 c2 fc ff ff       	call   80105d50 <sched>
+  p->chan = 0;
+8010608e:	c7 43 28 00 00 00 00 	movl   $0x0,0x28(%ebx)
+    release(&ptable.lock);
+80106095:	c7 04 24 20 46 1a 80 	movl   $0x801a4620,(%esp)
+8010609c:	e8 5f 0e 00 00       	call   80106f00 <release>
+    acquire(lk);
+801060a1:	89 75 08             	mov    %esi,0x8(%ebp)
+801060a4:	83 c4 10             	add    $0x10,%esp
+}
+801060a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801060aa:	5b                   	pop    %ebx
+801060ab:	5e                   	pop    %esi
+801060ac:	5f                   	pop    %edi
+801060ad:	5d                   	pop    %ebp
+    acquire(lk);
+801060ae:	e9 bd 0f 00 00       	jmp    80107070 <acquire>
+801060b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801060b7:	90                   	nop
+  p->chan = chan;
+801060b8:	89 7b 28             	mov    %edi,0x28(%ebx)
+  p->state = SLEEPING;
+801060bb:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+  sched();
+801060c2:	e8 89 fc ff ff       	call   80105d50 <sched>
+  p->chan = 0;
+801060c7:	c7 43 28 00 00 00 00 	movl   $0x0,0x28(%ebx)
+}
+801060ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801060d1:	5b                   	pop    %ebx
+801060d2:	5e                   	pop    %esi
+801060d3:	5f                   	pop    %edi
+801060d4:	5d                   	pop    %ebp
+801060d5:	c3                   	ret
+    panic("sleep without lk");
+801060d6:	83 ec 0c             	sub    $0xc,%esp
+801060d9:	68 f3 bb 10 80       	push   $0x8010bbf3
+801060de:	e8 dd b3 ff ff       	call   801014c0 <panic>
+    panic("sleep");
+801060e3:	83 ec 0c             	sub    $0xc,%esp
+801060e6:	68 6e bc 10 80       	push   $0x8010bc6e
+801060eb:	e8 d0 b3 ff ff       	call   801014c0 <panic>
+
+801060f0 <wakeup>:
+
+// Wake up all processes sleeping on chan.
+void
+wakeup(void *chan)
+{
+801060f0:	55                   	push   %ebp
+801060f1:	89 e5                	mov    %esp,%ebp
+801060f3:	56                   	push   %esi
+801060f4:	53                   	push   %ebx
+801060f5:	8b 75 08             	mov    0x8(%ebp),%esi
+  acquire(&ptable.lock);
+801060f8:	83 ec 0c             	sub    $0xc,%esp
+801060fb:	68 20 46 1a 80       	push   $0x801a4620
+80106100:	e8 6b 0f 00 00       	call   80107070 <acquire>
+  for(p = ptable.list; p; p = p->next)
+80106105:	8b 1d 80 46 1a 80    	mov    0x801a4680,%ebx
+8010610b:	83 c4 10             	add    $0x10,%esp
+8010610e:	85 db                	test   %ebx,%ebx
+80106110:	75 10                	jne    80106122 <wakeup+0x32>
+80106112:	eb 2a                	jmp    8010613e <wakeup+0x4e>
+80106114:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106118:	8b 9b 84 00 00 00    	mov    0x84(%ebx),%ebx
+8010611e:	85 db                	test   %ebx,%ebx
+80106120:	74 1c                	je     8010613e <wakeup+0x4e>
+    if(p->state == SLEEPING && p->chan == chan)
+80106122:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+80106126:	75 f0                	jne    80106118 <wakeup+0x28>
+80106128:	3b 73 28             	cmp    0x28(%ebx),%esi
+8010612b:	75 eb                	jne    80106118 <wakeup+0x28>
+      makerunnable(p);
+8010612d:	89 d8                	mov    %ebx,%eax
+8010612f:	e8 fc f2 ff ff       	call   80105430 <makerunnable>
+  for(p = ptable.list; p; p = p->next)
+80106134:	8b 9b 84 00 00 00    	mov    0x84(%ebx),%ebx
+8010613a:	85 db                	test   %ebx,%ebx
+8010613c:	75 e4                	jne    80106122 <wakeup+0x32>
+  wakeup1(chan);
+  release(&ptable.lock);
+8010613e:	c7 45 08 20 46 1a 80 	movl   $0x801a4620,0x8(%ebp)
+}
+80106145:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106148:	5b                   	pop    %ebx
+80106149:	5e                   	pop    %esi
+8010614a:	5d                   	pop    %ebp
+  release(&ptable.lock);
+8010614b:	e9 b0 0d 00 00       	jmp    80106f00 <release>
+
+80106150 <wakeproc>:
+
+// Wake up p if it is sleeping on chan, without scanning
+// the process list for other sleepers.
+void
+wakeproc(struct proc *p, void *chan)
+{
+80106150:	55                   	push   %ebp
+80106151:	89 e5                	mov    %esp,%ebp
+80106153:	56                   	push   %esi
+80106154:	53                   	push   %ebx
+80106155:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80106158:	8b 75 0c             	mov    0xc(%ebp),%esi
+  acquire(&ptable.lock);
+8010615b:	83 ec 0c             	sub    $0xc,%esp
+8010615e:	68 20 46 1a 80       	push   $0x801a4620
+80106163:	e8 08 0f 00 00       	call   80107070 <acquire>
+  if(p->state == SLEEPING && p->chan == chan)
+80106168:	83 c4 10             	add    $0x10,%esp
+8010616b:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+8010616f:	74 17                	je     80106188 <wakeproc+0x38>
+    makerunnable(p);
+  release(&ptable.lock);
+80106171:	c7 45 08 20 46 1a 80 	movl   $0x801a4620,0x8(%ebp)
+}
+80106178:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010617b:	5b                   	pop    %ebx
+8010617c:	5e                   	pop    %esi
+8010617d:	5d                   	pop    %ebp
+  release(&ptable.lock);
+8010617e:	e9 7d 0d 00 00       	jmp    80106f00 <release>
+80106183:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106187:	90                   	nop
+  if(p->state == SLEEPING && p->chan == chan)
+80106188:	39 73 28             	cmp    %esi,0x28(%ebx)
+8010618b:	75 e4                	jne    80106171 <wakeproc+0x21>
+    makerunnable(p);
+8010618d:	89 d8                	mov    %ebx,%eax
+8010618f:	e8 9c f2 ff ff       	call   80105430 <makerunnable>
+80106194:	eb db                	jmp    80106171 <wakeproc+0x21>
+80106196:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010619d:	8d 76 00             	lea    0x0(%esi),%esi
+
+801061a0 <kill>:
+// Kill the process with the given pid.
+// Process won't exit until it returns
+// to user space (see trap in trap.c).
+int
+kill(int pid)
+{
+801061a0:	55                   	push   %ebp
+801061a1:	89 e5                	mov    %esp,%ebp
+801061a3:	53                   	push   %ebx
+801061a4:	83 ec 10             	sub    $0x10,%esp
+801061a7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *p;
+
+  acquire(&ptable.lock);
+801061aa:	68 20 46 1a 80       	push   $0x801a4620
+801061af:	e8 bc 0e 00 00       	call   80107070 <acquire>
+  for(p = *pidchain(pid); p; p = p->hashnext)
+801061b4:	0f b6 c3             	movzbl %bl,%eax
+801061b7:	83 c4 10             	add    $0x10,%esp
+801061ba:	8b 04 85 88 46 1a 80 	mov    -0x7fe5b978(,%eax,4),%eax
+801061c1:	85 c0                	test   %eax,%eax
+801061c3:	75 15                	jne    801061da <kill+0x3a>
+801061c5:	eb 49                	jmp    80106210 <kill+0x70>
+801061c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801061ce:	66 90                	xchg   %ax,%ax
+801061d0:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+801061d6:	85 c0                	test   %eax,%eax
+801061d8:	74 36                	je     80106210 <kill+0x70>
+    if(p->pid == pid)
+801061da:	3b 58 10             	cmp    0x10(%eax),%ebx
+801061dd:	75 f1                	jne    801061d0 <kill+0x30>
+  if((p = findproc(pid)) != 0){
+    p->killed = 1;
+    // Wake process from sleep if necessary.
+    if(p->state == SLEEPING)
+801061df:	83 78 0c 02          	cmpl   $0x2,0xc(%eax)
+    p->killed = 1;
+801061e3:	c7 40 2c 01 00 00 00 	movl   $0x1,0x2c(%eax)
+    if(p->state == SLEEPING)
+801061ea:	74 1c                	je     80106208 <kill+0x68>
+      makerunnable(p);
+    release(&ptable.lock);
+801061ec:	83 ec 0c             	sub    $0xc,%esp
+801061ef:	68 20 46 1a 80       	push   $0x801a4620
+801061f4:	e8 07 0d 00 00       	call   80106f00 <release>
+    return 0;
+801061f9:	83 c4 10             	add    $0x10,%esp
+801061fc:	31 c0                	xor    %eax,%eax
+  }
+  release(&ptable.lock);
+  return -1;
+}
+801061fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106201:	c9                   	leave
+80106202:	c3                   	ret
+80106203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106207:	90                   	nop
+      makerunnable(p);
+80106208:	e8 23 f2 ff ff       	call   80105430 <makerunnable>
+8010620d:	eb dd                	jmp    801061ec <kill+0x4c>
+8010620f:	90                   	nop
+  release(&ptable.lock);
+80106210:	83 ec 0c             	sub    $0xc,%esp
+80106213:	68 20 46 1a 80       	push   $0x801a4620
+80106218:	e8 e3 0c 00 00       	call   80106f00 <release>
+  return -1;
+8010621d:	83 c4 10             	add    $0x10,%esp
+80106220:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106225:	eb d7                	jmp    801061fe <kill+0x5e>
+80106227:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010622e:	66 90                	xchg   %ax,%ax
+
+80106230 <setaffinity>:
+// Restrict the process with the given pid to the CPUs in mask.
+// If that excludes the CPU the caller is running on, give it up
+// now rather than at the next timer tick.
+int
+setaffinity(int pid, uint mask)
+{
+80106230:	55                   	push   %ebp
+  struct proc *p;
+
+  mask &= (1 << ncpu) - 1;
+80106231:	b8 01 00 00 00       	mov    $0x1,%eax
+{
+80106236:	89 e5                	mov    %esp,%ebp
+80106238:	56                   	push   %esi
+80106239:	53                   	push   %ebx
+  mask &= (1 << ncpu) - 1;
+8010623a:	8b 0d 44 3b 1a 80    	mov    0x801a3b44,%ecx
+{
+80106240:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  mask &= (1 << ncpu) - 1;
+80106243:	d3 e0                	shl    %cl,%eax
+80106245:	83 e8 01             	sub    $0x1,%eax
+  if(mask == 0)
+80106248:	23 45 0c             	and    0xc(%ebp),%eax
+8010624b:	0f 84 9f 00 00 00    	je     801062f0 <setaffinity+0xc0>
+    return -1;
+
+  acquire(&ptable.lock);
+80106251:	83 ec 0c             	sub    $0xc,%esp
+80106254:	89 c6                	mov    %eax,%esi
+80106256:	68 20 46 1a 80       	push   $0x801a4620
+8010625b:	e8 10 0e 00 00       	call   80107070 <acquire>
+  for(p = *pidchain(pid); p; p = p->hashnext)
+80106260:	0f b6 c3             	movzbl %bl,%eax
+80106263:	83 c4 10             	add    $0x10,%esp
+80106266:	8b 04 85 88 46 1a 80 	mov    -0x7fe5b978(,%eax,4),%eax
+8010626d:	85 c0                	test   %eax,%eax
+8010626f:	75 11                	jne    80106282 <setaffinity+0x52>
+80106271:	eb 6d                	jmp    801062e0 <setaffinity+0xb0>
+80106273:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106277:	90                   	nop
+80106278:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+8010627e:	85 c0                	test   %eax,%eax
+80106280:	74 5e                	je     801062e0 <setaffinity+0xb0>
+    if(p->pid == pid)
+80106282:	3b 58 10             	cmp    0x10(%eax),%ebx
+80106285:	75 f1                	jne    80106278 <setaffinity+0x48>
+  if((p = findproc(pid)) != 0){
+    p->affinity = mask;
+80106287:	89 b0 94 00 00 00    	mov    %esi,0x94(%eax)
+  asm volatile("movl %%gs:4, %0" : "=r" (p) : : "memory");
+8010628d:	65 8b 15 04 00 00 00 	mov    %gs:0x4,%edx
+    if(p == myproc() && (mask & (1 << cpuid())) == 0){
+80106294:	39 c2                	cmp    %eax,%edx
+80106296:	74 20                	je     801062b8 <setaffinity+0x88>
+      makerunnable(p);
+      sched();
+    }
+    release(&ptable.lock);
+80106298:	83 ec 0c             	sub    $0xc,%esp
+8010629b:	68 20 46 1a 80       	push   $0x801a4620
+801062a0:	e8 5b 0c 00 00       	call   80106f00 <release>
+    return 0;
+801062a5:	83 c4 10             	add    $0x10,%esp
+801062a8:	31 c0                	xor    %eax,%eax
+  }
+  release(&ptable.lock);
+  return -1;
+}
+801062aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801062ad:	5b                   	pop    %ebx
+801062ae:	5e                   	pop    %esi
+801062af:	5d                   	pop    %ebp
+801062b0:	c3                   	ret
+801062b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  asm volatile("movl %%gs:0, %0" : "=r" (c));
+801062b8:	65 8b 15 00 00 00 00 	mov    %gs:0x0,%edx
+  return mycpu()-cpus;
+801062bf:	81 ea 60 3b 1a 80    	sub    $0x801a3b60,%edx
+801062c5:	c1 fa 02             	sar    $0x2,%edx
+801062c8:	69 d2 d1 58 1f 1a    	imul   $0x1a1f58d1,%edx,%edx
+    if(p == myproc() && (mask & (1 << cpuid())) == 0){
+801062ce:	0f a3 d6             	bt     %edx,%esi
+801062d1:	72 c5                	jb     80106298 <setaffinity+0x68>
+      makerunnable(p);
+801062d3:	e8 58 f1 ff ff       	call   80105430 <makerunnable>
+      sched();
+801062d8:	e8 73 fa ff ff       	call   80105d50 <sched>
+801062dd:	eb b9                	jmp    80106298 <setaffinity+0x68>
+801062df:	90                   	nop
+  release(&ptable.lock);
+801062e0:	83 ec 0c             	sub    $0xc,%esp
+801062e3:	68 20 46 1a 80       	push   $0x801a4620
+801062e8:	e8 13 0c 00 00       	call   80106f00 <release>
+  return -1;
+801062ed:	83 c4 10             	add    $0x10,%esp
+    return -1;
+801062f0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801062f5:	eb b3                	jmp    801062aa <setaffinity+0x7a>
+801062f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801062fe:	66 90                	xchg   %ax,%ax
+
+80106300 <getaffinity>:
+
+// Return the CPU mask of the process with the given pid,
+// limited to the CPUs that are present, or -1.
+int
+getaffinity(int pid)
+{
+80106300:	55                   	push   %ebp
+80106301:	89 e5                	mov    %esp,%ebp
+80106303:	53                   	push   %ebx
+80106304:	83 ec 10             	sub    $0x10,%esp
+80106307:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *p;
+  int mask;
+
+  acquire(&ptable.lock);
+8010630a:	68 20 46 1a 80       	push   $0x801a4620
+8010630f:	e8 5c 0d 00 00       	call   80107070 <acquire>
+  for(p = *pidchain(pid); p; p = p->hashnext)
+80106314:	0f b6 c3             	movzbl %bl,%eax
+80106317:	83 c4 10             	add    $0x10,%esp
+8010631a:	8b 14 85 88 46 1a 80 	mov    -0x7fe5b978(,%eax,4),%edx
+80106321:	85 d2                	test   %edx,%edx
+80106323:	75 15                	jne    8010633a <getaffinity+0x3a>
+80106325:	eb 49                	jmp    80106370 <getaffinity+0x70>
+80106327:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010632e:	66 90                	xchg   %ax,%ax
+80106330:	8b 92 8c 00 00 00    	mov    0x8c(%edx),%edx
+80106336:	85 d2                	test   %edx,%edx
+80106338:	74 36                	je     80106370 <getaffinity+0x70>
+    if(p->pid == pid)
+8010633a:	3b 5a 10             	cmp    0x10(%edx),%ebx
+8010633d:	75 f1                	jne    80106330 <getaffinity+0x30>
+  if((p = findproc(pid)) != 0){
+    mask = p->affinity & ((1 << ncpu) - 1);
+8010633f:	8b 0d 44 3b 1a 80    	mov    0x801a3b44,%ecx
+80106345:	bb 01 00 00 00       	mov    $0x1,%ebx
+    release(&ptable.lock);
+8010634a:	83 ec 0c             	sub    $0xc,%esp
+    mask = p->affinity & ((1 << ncpu) - 1);
+8010634d:	d3 e3                	shl    %cl,%ebx
+8010634f:	83 eb 01             	sub    $0x1,%ebx
+80106352:	23 9a 94 00 00 00    	and    0x94(%edx),%ebx
+    release(&ptable.lock);
+80106358:	68 20 46 1a 80       	push   $0x801a4620
+8010635d:	e8 9e 0b 00 00       	call   80106f00 <release>
+    return mask;
+80106362:	83 c4 10             	add    $0x10,%esp
+  }
+  release(&ptable.lock);
+  return -1;
+}
+80106365:	89 d8                	mov    %ebx,%eax
+80106367:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010636a:	c9                   	leave
+8010636b:	c3                   	ret
+8010636c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  release(&ptable.lock);
+80106370:	83 ec 0c             	sub    $0xc,%esp
+  return -1;
+80106373:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+  release(&ptable.lock);
+80106378:	68 20 46 1a 80       	push   $0x801a4620
+8010637d:	e8 7e 0b 00 00       	call   80106f00 <release>
+  return -1;
+80106382:	83 c4 10             	add    $0x10,%esp
+80106385:	eb de                	jmp    80106365 <getaffinity+0x65>
+80106387:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010638e:	66 90                	xchg   %ax,%ax
+
+80106390 <getprocinfo>:
+
+// Fill in up to n entries of info, one per process.
+// Returns the number filled in.
+int
+getprocinfo(struct procinfo *info, int n)
+{
+80106390:	55                   	push   %ebp
+80106391:	89 e5                	mov    %esp,%ebp
+80106393:	57                   	push   %edi
+  struct proc *p;
+  int i;
+
+  acquire(&ptable.lock);
+  for(i = 0, p = ptable.list; p && i < n; p = p->next){
+80106394:	31 ff                	xor    %edi,%edi
+{
+80106396:	56                   	push   %esi
+80106397:	53                   	push   %ebx
+80106398:	83 ec 18             	sub    $0x18,%esp
+8010639b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  acquire(&ptable.lock);
+8010639e:	68 20 46 1a 80       	push   $0x801a4620
+801063a3:	e8 c8 0c 00 00       	call   80107070 <acquire>
+  for(i = 0, p = ptable.list; p && i < n; p = p->next){
+801063a8:	8b 1d 80 46 1a 80    	mov    0x801a4680,%ebx
+801063ae:	83 c4 10             	add    $0x10,%esp
+801063b1:	85 f6                	test   %esi,%esi
+801063b3:	0f 8e b1 00 00 00    	jle    8010646a <getprocinfo+0xda>
+801063b9:	85 db                	test   %ebx,%ebx
+801063bb:	0f 84 a9 00 00 00    	je     8010646a <getprocinfo+0xda>
+801063c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(p->state == UNUSED)
+801063c8:	8b 43 0c             	mov    0xc(%ebx),%eax
+801063cb:	85 c0                	test   %eax,%eax
+801063cd:	0f 84 85 00 00 00    	je     80106458 <getprocinfo+0xc8>
+      continue;
+    info[i].pid = p->pid;
+801063d3:	8b 53 10             	mov    0x10(%ebx),%edx
+801063d6:	6b c7 3c             	imul   $0x3c,%edi,%eax
+801063d9:	03 45 08             	add    0x8(%ebp),%eax
+801063dc:	89 10                	mov    %edx,(%eax)
+    info[i].ppid = p->parent ? p->parent->pid : 0;
+801063de:	8b 4b 14             	mov    0x14(%ebx),%ecx
+801063e1:	31 d2                	xor    %edx,%edx
+801063e3:	85 c9                	test   %ecx,%ecx
+801063e5:	74 03                	je     801063ea <getprocinfo+0x5a>
+801063e7:	8b 51 10             	mov    0x10(%ecx),%edx
+801063ea:	89 50 04             	mov    %edx,0x4(%eax)
+    info[i].state = p->state;
+801063ed:	8b 53 0c             	mov    0xc(%ebx),%edx
+    info[i].nfault = p->nfault;
+    info[i].nbread = p->nbread;
+    info[i].nbwrite = p->nbwrite;
+    // Nothing is paged out, so all of [0, sz) is resident.
+    info[i].rss = PGROUNDUP(p->sz) / PGSIZE;
+    safestrcpy(info[i].name, p->name, sizeof(info[i].name));
+801063f0:	83 ec 04             	sub    $0x4,%esp
+801063f3:	83 c0 2c             	add    $0x2c,%eax
+    i++;
+801063f6:	83 c7 01             	add    $0x1,%edi
+    info[i].state = p->state;
+801063f9:	89 50 dc             	mov    %edx,-0x24(%eax)
+    info[i].cpu = p->lastcpu;
+801063fc:	8b 93 90 00 00 00    	mov    0x90(%ebx),%edx
+80106402:	89 50 e0             	mov    %edx,-0x20(%eax)
+    info[i].utime = p->utime;
+80106405:	8b 93 ac 00 00 00    	mov    0xac(%ebx),%edx
+8010640b:	89 50 e4             	mov    %edx,-0x1c(%eax)
+    info[i].stime = p->stime;
+8010640e:	8b 93 b0 00 00 00    	mov    0xb0(%ebx),%edx
+80106414:	89 50 e8             	mov    %edx,-0x18(%eax)
+    info[i].nswitch = p->nswitch;
+80106417:	8b 93 b4 00 00 00    	mov    0xb4(%ebx),%edx
+8010641d:	89 50 ec             	mov    %edx,-0x14(%eax)
+    info[i].nfault = p->nfault;
+80106420:	8b 93 b8 00 00 00    	mov    0xb8(%ebx),%edx
+80106426:	89 50 f0             	mov    %edx,-0x10(%eax)
+    info[i].nbread = p->nbread;
+80106429:	8b 93 bc 00 00 00    	mov    0xbc(%ebx),%edx
+8010642f:	89 50 f4             	mov    %edx,-0xc(%eax)
+    info[i].nbwrite = p->nbwrite;
+80106432:	8b 93 c0 00 00 00    	mov    0xc0(%ebx),%edx
+80106438:	89 50 f8             	mov    %edx,-0x8(%eax)
+    info[i].rss = PGROUNDUP(p->sz) / PGSIZE;
+8010643b:	8b 0b                	mov    (%ebx),%ecx
+8010643d:	8d 91 ff 0f 00 00    	lea    0xfff(%ecx),%edx
+80106443:	c1 ea 0c             	shr    $0xc,%edx
+80106446:	89 50 fc             	mov    %edx,-0x4(%eax)
+    safestrcpy(info[i].name, p->name, sizeof(info[i].name));
+80106449:	8d 53 74             	lea    0x74(%ebx),%edx
+8010644c:	6a 10                	push   $0x10
+8010644e:	52                   	push   %edx
+8010644f:	50                   	push   %eax
+80106450:	e8 1b 11 00 00       	call   80107570 <safestrcpy>
+    i++;
+80106455:	83 c4 10             	add    $0x10,%esp
+  for(i = 0, p = ptable.list; p && i < n; p = p->next){
+80106458:	8b 9b 84 00 00 00    	mov    0x84(%ebx),%ebx
+8010645e:	85 db                	test   %ebx,%ebx
+80106460:	74 08                	je     8010646a <getprocinfo+0xda>
+80106462:	39 f7                	cmp    %esi,%edi
+80106464:	0f 8c 5e ff ff ff    	jl     801063c8 <getprocinfo+0x38>
+  }
+  release(&ptable.lock);
+8010646a:	83 ec 0c             	sub    $0xc,%esp
+8010646d:	68 20 46 1a 80       	push   $0x801a4620
+80106472:	e8 89 0a 00 00       	call   80106f00 <release>
+  return i;
+}
+80106477:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010647a:	89 f8                	mov    %edi,%eax
+8010647c:	5b                   	pop    %ebx
+8010647d:	5e                   	pop    %esi
+8010647e:	5f                   	pop    %edi
+8010647f:	5d                   	pop    %ebp
+80106480:	c3                   	ret
+80106481:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106488:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010648f:	90                   	nop
+
+80106490 <procdump>:
+// Print a process listing to console.  For debugging.
+// Runs when user types ^P on console.
+// No lock to avoid wedging a stuck machine further.
+void
+procdump(void)
+{
+80106490:	55                   	push   %ebp
+80106491:	89 e5                	mov    %esp,%ebp
+80106493:	57                   	push   %edi
+80106494:	56                   	push   %esi
+80106495:	53                   	push   %ebx
+80106496:	83 ec 3c             	sub    $0x3c,%esp
+  int i;
+  struct proc *p;
+  char *state;
+  uint pc[10];
+
+  for(p = ptable.list; p; p = p->next){
+80106499:	8b 1d 80 46 1a 80    	mov    0x801a4680,%ebx
+8010649f:	85 db                	test   %ebx,%ebx
+801064a1:	74 67                	je     8010650a <procdump+0x7a>
+801064a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801064a7:	90                   	nop
+    if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
+801064a8:	8b 53 0c             	mov    0xc(%ebx),%edx
+      state = states[p->state];
+    else
+      state = "???";
+801064ab:	b8 04 bc 10 80       	mov    $0x8010bc04,%eax
+    if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
+801064b0:	83 fa 05             	cmp    $0x5,%edx
+801064b3:	77 11                	ja     801064c6 <procdump+0x36>
+801064b5:	8b 04 95 44 bc 10 80 	mov    -0x7fef43bc(,%edx,4),%eax
+      state = "???";
+801064bc:	b9 04 bc 10 80       	mov    $0x8010bc04,%ecx
+801064c1:	85 c0                	test   %eax,%eax
+801064c3:	0f 44 c1             	cmove  %ecx,%eax
+    cprintf("%d %s %s u%d s%d", p->pid, state, p->name, p->utime, p->stime);
+801064c6:	83 ec 08             	sub    $0x8,%esp
+801064c9:	8d 53 74             	lea    0x74(%ebx),%edx
+801064cc:	ff b3 b0 00 00 00    	push   0xb0(%ebx)
+801064d2:	ff b3 ac 00 00 00    	push   0xac(%ebx)
+801064d8:	52                   	push   %edx
+801064d9:	50                   	push   %eax
+801064da:	ff 73 10             	push   0x10(%ebx)
+801064dd:	68 08 bc 10 80       	push   $0x8010bc08
+801064e2:	e8 09 b3 ff ff       	call   801017f0 <cprintf>
+    if(p->state == SLEEPING){
+801064e7:	83 c4 20             	add    $0x20,%esp
+801064ea:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+801064ee:	74 28                	je     80106518 <procdump+0x88>
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+      for(i=0; i<10 && pc[i] != 0; i++)
+        cprintf(" %p", pc[i]);
+    }
+    cprintf("\n");
+801064f0:	83 ec 0c             	sub    $0xc,%esp
+801064f3:	68 0d c0 10 80       	push   $0x8010c00d
+801064f8:	e8 f3 b2 ff ff       	call   801017f0 <cprintf>
+  for(p = ptable.list; p; p = p->next){
+801064fd:	8b 9b 84 00 00 00    	mov    0x84(%ebx),%ebx
+80106503:	83 c4 10             	add    $0x10,%esp
+80106506:	85 db                	test   %ebx,%ebx
+80106508:	75 9e                	jne    801064a8 <procdump+0x18>
+  }
+}
+8010650a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010650d:	5b                   	pop    %ebx
+8010650e:	5e                   	pop    %esi
+8010650f:	5f                   	pop    %edi
+80106510:	5d                   	pop    %ebp
+80106511:	c3                   	ret
+80106512:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+80106518:	83 ec 08             	sub    $0x8,%esp
+8010651b:	8d 75 c0             	lea    -0x40(%ebp),%esi
+8010651e:	8d 7d e8             	lea    -0x18(%ebp),%edi
+80106521:	56                   	push   %esi
+80106522:	8b 43 24             	mov    0x24(%ebx),%eax
+80106525:	8b 40 0c             	mov    0xc(%eax),%eax
+80106528:	83 c0 08             	add    $0x8,%eax
+8010652b:	50                   	push   %eax
+8010652c:	e8 2f 06 00 00       	call   80106b60 <getcallerpcs>
+      for(i=0; i<10 && pc[i] != 0; i++)
+80106531:	83 c4 10             	add    $0x10,%esp
+80106534:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106538:	8b 16                	mov    (%esi),%edx
+8010653a:	85 d2                	test   %edx,%edx
+8010653c:	74 b2                	je     801064f0 <procdump+0x60>
+        cprintf(" %p", pc[i]);
+8010653e:	83 ec 08             	sub    $0x8,%esp
+      for(i=0; i<10 && pc[i] != 0; i++)
+80106541:	83 c6 04             	add    $0x4,%esi
+        cprintf(" %p", pc[i]);
+80106544:	52                   	push   %edx
+80106545:	68 90 b6 10 80       	push   $0x8010b690
+8010654a:	e8 a1 b2 ff ff       	call   801017f0 <cprintf>
+      for(i=0; i<10 && pc[i] != 0; i++)
+8010654f:	83 c4 10             	add    $0x10,%esp
+80106552:	39 fe                	cmp    %edi,%esi
+80106554:	75 e2                	jne    80106538 <procdump+0xa8>
+80106556:	eb 98                	jmp    801064f0 <procdump+0x60>
+80106558:	66 90                	xchg   %ax,%ax
+8010655a:	66 90                	xchg   %ax,%ax
+8010655c:	66 90                	xchg   %ax,%ax
+8010655e:	66 90                	xchg   %ax,%ax
+
+80106560 <initsleeplock>:
+#define SHARED 1
+#define EXCL   2
+
+void
+initsleeplock(struct sleeplock *lk, char *name)
+{
+80106560:	55                   	push   %ebp
+80106561:	89 e5                	mov    %esp,%ebp
+80106563:	53                   	push   %ebx
+80106564:	83 ec 0c             	sub    $0xc,%esp
+80106567:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&lk->lk, "sleep lock");
+8010656a:	68 5c bc 10 80       	push   $0x8010bc5c
+8010656f:	8d 43 08             	lea    0x8(%ebx),%eax
+80106572:	50                   	push   %eax
+80106573:	e8 e8 03 00 00       	call   80106960 <initlock>
+  lk->name = name;
+80106578:	8b 45 0c             	mov    0xc(%ebp),%eax
+  lk->locked = 0;
+  lk->nshared = 0;
+  lk->owner = 0;
+  lk->head = 0;
+  lk->pid = 0;
+}
+8010657b:	83 c4 10             	add    $0x10,%esp
+  lk->locked = 0;
+8010657e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->nshared = 0;
+80106584:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+  lk->name = name;
+8010658b:	89 43 74             	mov    %eax,0x74(%ebx)
+  lk->owner = 0;
+8010658e:	c7 43 68 00 00 00 00 	movl   $0x0,0x68(%ebx)
+  lk->head = 0;
+80106595:	c7 43 6c 00 00 00 00 	movl   $0x0,0x6c(%ebx)
+  lk->pid = 0;
+8010659c:	c7 43 78 00 00 00 00 	movl   $0x0,0x78(%ebx)
+}
+801065a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801065a6:	c9                   	leave
+801065a7:	c3                   	ret
+801065a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801065af:	90                   	nop
+
+801065b0 <acquiresleep>:
+  }
+}
+
+void
+acquiresleep(struct sleeplock *lk)
+{
+801065b0:	55                   	push   %ebp
+801065b1:	89 e5                	mov    %esp,%ebp
+801065b3:	57                   	push   %edi
+801065b4:	56                   	push   %esi
+801065b5:	53                   	push   %ebx
+  struct proc *p = myproc();
+801065b6:	bb 10 27 00 00       	mov    $0x2710,%ebx
+{
+801065bb:	83 ec 1c             	sub    $0x1c,%esp
+801065be:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct proc *p = myproc();
+801065c1:	e8 2a f0 ff ff       	call   801055f0 <myproc>
+801065c6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < MAXSPIN; i++){
+801065c9:	eb 1b                	jmp    801065e6 <acquiresleep+0x36>
+801065cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801065cf:	90                   	nop
+    if(o == 0 || o == myproc() || o->state != RUNNING)
+801065d0:	e8 1b f0 ff ff       	call   801055f0 <myproc>
+801065d5:	39 c7                	cmp    %eax,%edi
+801065d7:	74 14                	je     801065ed <acquiresleep+0x3d>
+801065d9:	83 7f 0c 04          	cmpl   $0x4,0xc(%edi)
+801065dd:	75 0e                	jne    801065ed <acquiresleep+0x3d>
+
+// Hint to the processor that this is a spin-wait loop.
+static inline void
+pause(void)
+{
+  asm volatile("pause");
+801065df:	f3 90                	pause
+  for(i = 0; i < MAXSPIN; i++){
+801065e1:	83 eb 01             	sub    $0x1,%ebx
+801065e4:	74 07                	je     801065ed <acquiresleep+0x3d>
+    o = *(struct proc * volatile *)&lk->owner;
+801065e6:	8b 7e 68             	mov    0x68(%esi),%edi
+    if(o == 0 || o == myproc() || o->state != RUNNING)
+801065e9:	85 ff                	test   %edi,%edi
+801065eb:	75 e3                	jne    801065d0 <acquiresleep+0x20>
+
+  spinsleep(lk);
+  acquire(&lk->lk);
+801065ed:	83 ec 0c             	sub    $0xc,%esp
+801065f0:	8d 5e 08             	lea    0x8(%esi),%ebx
+801065f3:	53                   	push   %ebx
+801065f4:	e8 77 0a 00 00       	call   80107070 <acquire>
+  if(lk->locked || lk->nshared || lk->head)
+801065f9:	8b 06                	mov    (%esi),%eax
+801065fb:	83 c4 10             	add    $0x10,%esp
+801065fe:	85 c0                	test   %eax,%eax
+80106600:	75 07                	jne    80106609 <acquiresleep+0x59>
+80106602:	8b 46 04             	mov    0x4(%esi),%eax
+80106605:	85 c0                	test   %eax,%eax
+80106607:	74 67                	je     80106670 <acquiresleep+0xc0>
+  struct proc *p = myproc();
+80106609:	e8 e2 ef ff ff       	call   801055f0 <myproc>
+  p->slwait = mode;
+8010660e:	c7 80 a4 00 00 00 02 	movl   $0x2,0xa4(%eax)
+80106615:	00 00 00 
+  struct proc *p = myproc();
+80106618:	89 c7                	mov    %eax,%edi
+  p->slnext = 0;
+8010661a:	c7 80 a0 00 00 00 00 	movl   $0x0,0xa0(%eax)
+80106621:	00 00 00 
+  if(lk->head)
+80106624:	8b 4e 6c             	mov    0x6c(%esi),%ecx
+80106627:	85 c9                	test   %ecx,%ecx
+80106629:	74 75                	je     801066a0 <acquiresleep+0xf0>
+    lk->tail->slnext = p;
+8010662b:	8b 46 70             	mov    0x70(%esi),%eax
+8010662e:	89 b8 a0 00 00 00    	mov    %edi,0xa0(%eax)
+  lk->tail = p;
+80106634:	89 7e 70             	mov    %edi,0x70(%esi)
+  while(p->slwait)
+80106637:	8b 97 a4 00 00 00    	mov    0xa4(%edi),%edx
+8010663d:	85 d2                	test   %edx,%edx
+8010663f:	74 1e                	je     8010665f <acquiresleep+0xaf>
+80106641:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    sleep(lk, &lk->lk);
+80106648:	83 ec 08             	sub    $0x8,%esp
+8010664b:	53                   	push   %ebx
+8010664c:	56                   	push   %esi
+8010664d:	e8 ee f9 ff ff       	call   80106040 <sleep>
+  while(p->slwait)
+80106652:	8b 87 a4 00 00 00    	mov    0xa4(%edi),%eax
+80106658:	83 c4 10             	add    $0x10,%esp
+8010665b:	85 c0                	test   %eax,%eax
+8010665d:	75 e9                	jne    80106648 <acquiresleep+0x98>
+  else {
+    lk->locked = 1;
+    lk->owner = p;
+    lk->pid = p->pid;
+  }
+  release(&lk->lk);
+8010665f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+80106662:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106665:	5b                   	pop    %ebx
+80106666:	5e                   	pop    %esi
+80106667:	5f                   	pop    %edi
+80106668:	5d                   	pop    %ebp
+  release(&lk->lk);
+80106669:	e9 92 08 00 00       	jmp    80106f00 <release>
+8010666e:	66 90                	xchg   %ax,%ax
+  if(lk->locked || lk->nshared || lk->head)
+80106670:	8b 7e 6c             	mov    0x6c(%esi),%edi
+80106673:	85 ff                	test   %edi,%edi
+80106675:	75 92                	jne    80106609 <acquiresleep+0x59>
+    lk->owner = p;
+80106677:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    lk->locked = 1;
+8010667a:	c7 06 01 00 00 00    	movl   $0x1,(%esi)
+    lk->owner = p;
+80106680:	89 46 68             	mov    %eax,0x68(%esi)
+    lk->pid = p->pid;
+80106683:	8b 40 10             	mov    0x10(%eax),%eax
+80106686:	89 46 78             	mov    %eax,0x78(%esi)
+  release(&lk->lk);
+80106689:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+8010668c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010668f:	5b                   	pop    %ebx
+80106690:	5e                   	pop    %esi
+80106691:	5f                   	pop    %edi
+80106692:	5d                   	pop    %ebp
+  release(&lk->lk);
+80106693:	e9 68 08 00 00       	jmp    80106f00 <release>
+80106698:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010669f:	90                   	nop
+    lk->head = p;
+801066a0:	89 46 6c             	mov    %eax,0x6c(%esi)
+801066a3:	eb 8f                	jmp    80106634 <acquiresleep+0x84>
+801066a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801066ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801066b0 <acquiresleepshared>:
+
+// Acquire lk shared with other readers.
+void
+acquiresleepshared(struct sleeplock *lk)
+{
+801066b0:	55                   	push   %ebp
+801066b1:	89 e5                	mov    %esp,%ebp
+801066b3:	57                   	push   %edi
+801066b4:	56                   	push   %esi
+801066b5:	be 10 27 00 00       	mov    $0x2710,%esi
+801066ba:	53                   	push   %ebx
+801066bb:	83 ec 0c             	sub    $0xc,%esp
+801066be:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; i < MAXSPIN; i++){
+801066c1:	eb 1b                	jmp    801066de <acquiresleepshared+0x2e>
+801066c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801066c7:	90                   	nop
+    if(o == 0 || o == myproc() || o->state != RUNNING)
+801066c8:	e8 23 ef ff ff       	call   801055f0 <myproc>
+801066cd:	39 c3                	cmp    %eax,%ebx
+801066cf:	74 14                	je     801066e5 <acquiresleepshared+0x35>
+801066d1:	83 7b 0c 04          	cmpl   $0x4,0xc(%ebx)
+801066d5:	75 0e                	jne    801066e5 <acquiresleepshared+0x35>
+801066d7:	f3 90                	pause
+  for(i = 0; i < MAXSPIN; i++){
+801066d9:	83 ee 01             	sub    $0x1,%esi
+801066dc:	74 07                	je     801066e5 <acquiresleepshared+0x35>
+    o = *(struct proc * volatile *)&lk->owner;
+801066de:	8b 5f 68             	mov    0x68(%edi),%ebx
+    if(o == 0 || o == myproc() || o->state != RUNNING)
+801066e1:	85 db                	test   %ebx,%ebx
+801066e3:	75 e3                	jne    801066c8 <acquiresleepshared+0x18>
+  spinsleep(lk);
+  acquire(&lk->lk);
+801066e5:	83 ec 0c             	sub    $0xc,%esp
+801066e8:	8d 77 08             	lea    0x8(%edi),%esi
+801066eb:	56                   	push   %esi
+801066ec:	e8 7f 09 00 00       	call   80107070 <acquire>
+  if(lk->locked || lk->head)
+801066f1:	8b 07                	mov    (%edi),%eax
+801066f3:	83 c4 10             	add    $0x10,%esp
+801066f6:	85 c0                	test   %eax,%eax
+801066f8:	75 07                	jne    80106701 <acquiresleepshared+0x51>
+801066fa:	8b 5f 6c             	mov    0x6c(%edi),%ebx
+801066fd:	85 db                	test   %ebx,%ebx
+801066ff:	74 6f                	je     80106770 <acquiresleepshared+0xc0>
+  struct proc *p = myproc();
+80106701:	e8 ea ee ff ff       	call   801055f0 <myproc>
+  p->slwait = mode;
+80106706:	c7 80 a4 00 00 00 01 	movl   $0x1,0xa4(%eax)
+8010670d:	00 00 00 
+  struct proc *p = myproc();
+80106710:	89 c3                	mov    %eax,%ebx
+  p->slnext = 0;
+80106712:	c7 80 a0 00 00 00 00 	movl   $0x0,0xa0(%eax)
+80106719:	00 00 00 
+  if(lk->head)
+8010671c:	8b 4f 6c             	mov    0x6c(%edi),%ecx
+8010671f:	85 c9                	test   %ecx,%ecx
+80106721:	74 65                	je     80106788 <acquiresleepshared+0xd8>
+    lk->tail->slnext = p;
+80106723:	8b 47 70             	mov    0x70(%edi),%eax
+80106726:	89 98 a0 00 00 00    	mov    %ebx,0xa0(%eax)
+  lk->tail = p;
+8010672c:	89 5f 70             	mov    %ebx,0x70(%edi)
+  while(p->slwait)
+8010672f:	8b 93 a4 00 00 00    	mov    0xa4(%ebx),%edx
+80106735:	85 d2                	test   %edx,%edx
+80106737:	74 1e                	je     80106757 <acquiresleepshared+0xa7>
+80106739:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    sleep(lk, &lk->lk);
+80106740:	83 ec 08             	sub    $0x8,%esp
+80106743:	56                   	push   %esi
+80106744:	57                   	push   %edi
+80106745:	e8 f6 f8 ff ff       	call   80106040 <sleep>
+  while(p->slwait)
+8010674a:	8b 83 a4 00 00 00    	mov    0xa4(%ebx),%eax
+80106750:	83 c4 10             	add    $0x10,%esp
+80106753:	85 c0                	test   %eax,%eax
+80106755:	75 e9                	jne    80106740 <acquiresleepshared+0x90>
+    waitsleep(lk, SHARED);
+  else
+    lk->nshared++;
+  release(&lk->lk);
+80106757:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+8010675a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010675d:	5b                   	pop    %ebx
+8010675e:	5e                   	pop    %esi
+8010675f:	5f                   	pop    %edi
+80106760:	5d                   	pop    %ebp
+  release(&lk->lk);
+80106761:	e9 9a 07 00 00       	jmp    80106f00 <release>
+80106766:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010676d:	8d 76 00             	lea    0x0(%esi),%esi
+    lk->nshared++;
+80106770:	83 47 04 01          	addl   $0x1,0x4(%edi)
+  release(&lk->lk);
+80106774:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+80106777:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010677a:	5b                   	pop    %ebx
+8010677b:	5e                   	pop    %esi
+8010677c:	5f                   	pop    %edi
+8010677d:	5d                   	pop    %ebp
+  release(&lk->lk);
+8010677e:	e9 7d 07 00 00       	jmp    80106f00 <release>
+80106783:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106787:	90                   	nop
+    lk->head = p;
+80106788:	89 47 6c             	mov    %eax,0x6c(%edi)
+8010678b:	eb 9f                	jmp    8010672c <acquiresleepshared+0x7c>
+8010678d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80106790 <releasesleep>:
+
+// Release lk, held in either mode.
+void
+releasesleep(struct sleeplock *lk)
+{
+80106790:	55                   	push   %ebp
+80106791:	89 e5                	mov    %esp,%ebp
+80106793:	56                   	push   %esi
+80106794:	53                   	push   %ebx
+80106795:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+80106798:	8d 73 08             	lea    0x8(%ebx),%esi
+8010679b:	83 ec 0c             	sub    $0xc,%esp
+8010679e:	56                   	push   %esi
+8010679f:	e8 cc 08 00 00       	call   80107070 <acquire>
+  if(lk->locked){
+801067a4:	8b 13                	mov    (%ebx),%edx
+801067a6:	83 c4 10             	add    $0x10,%esp
+801067a9:	85 d2                	test   %edx,%edx
+801067ab:	0f 84 8f 00 00 00    	je     80106840 <releasesleep+0xb0>
+    lk->locked = 0;
+801067b1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    lk->owner = 0;
+801067b7:	c7 43 68 00 00 00 00 	movl   $0x0,0x68(%ebx)
+    lk->pid = 0;
+801067be:	c7 43 78 00 00 00 00 	movl   $0x0,0x78(%ebx)
+  while(!lk->locked && (p = lk->head) != 0){
+801067c5:	eb 35                	jmp    801067fc <releasesleep+0x6c>
+801067c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801067ce:	66 90                	xchg   %ax,%ax
+      lk->nshared++;
+801067d0:	83 c2 01             	add    $0x1,%edx
+801067d3:	89 53 04             	mov    %edx,0x4(%ebx)
+    lk->head = p->slnext;
+801067d6:	8b 90 a0 00 00 00    	mov    0xa0(%eax),%edx
+    wakeproc(p, lk);
+801067dc:	83 ec 08             	sub    $0x8,%esp
+    lk->head = p->slnext;
+801067df:	89 53 6c             	mov    %edx,0x6c(%ebx)
+    p->slwait = 0;
+801067e2:	c7 80 a4 00 00 00 00 	movl   $0x0,0xa4(%eax)
+801067e9:	00 00 00 
+    wakeproc(p, lk);
+801067ec:	53                   	push   %ebx
+801067ed:	50                   	push   %eax
+801067ee:	e8 5d f9 ff ff       	call   80106150 <wakeproc>
+  while(!lk->locked && (p = lk->head) != 0){
+801067f3:	8b 03                	mov    (%ebx),%eax
+801067f5:	83 c4 10             	add    $0x10,%esp
+801067f8:	85 c0                	test   %eax,%eax
+801067fa:	75 2c                	jne    80106828 <releasesleep+0x98>
+801067fc:	8b 43 6c             	mov    0x6c(%ebx),%eax
+801067ff:	85 c0                	test   %eax,%eax
+80106801:	74 25                	je     80106828 <releasesleep+0x98>
+    if(p->slwait == EXCL){
+80106803:	83 b8 a4 00 00 00 02 	cmpl   $0x2,0xa4(%eax)
+      if(lk->nshared)
+8010680a:	8b 53 04             	mov    0x4(%ebx),%edx
+    if(p->slwait == EXCL){
+8010680d:	75 c1                	jne    801067d0 <releasesleep+0x40>
+      if(lk->nshared)
+8010680f:	85 d2                	test   %edx,%edx
+80106811:	75 15                	jne    80106828 <releasesleep+0x98>
+      lk->locked = 1;
+80106813:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+      lk->owner = p;
+80106819:	89 43 68             	mov    %eax,0x68(%ebx)
+      lk->pid = p->pid;
+8010681c:	8b 50 10             	mov    0x10(%eax),%edx
+8010681f:	89 53 78             	mov    %edx,0x78(%ebx)
+80106822:	eb b2                	jmp    801067d6 <releasesleep+0x46>
+80106824:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  } else if(lk->nshared > 0)
+    lk->nshared--;
+  else
+    panic("releasesleep");
+  handoff(lk);
+  release(&lk->lk);
+80106828:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+8010682b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010682e:	5b                   	pop    %ebx
+8010682f:	5e                   	pop    %esi
+80106830:	5d                   	pop    %ebp
+  release(&lk->lk);
+80106831:	e9 ca 06 00 00       	jmp    80106f00 <release>
+80106836:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010683d:	8d 76 00             	lea    0x0(%esi),%esi
+  } else if(lk->nshared > 0)
+80106840:	8b 43 04             	mov    0x4(%ebx),%eax
+80106843:	85 c0                	test   %eax,%eax
+80106845:	7e 08                	jle    8010684f <releasesleep+0xbf>
+    lk->nshared--;
+80106847:	83 e8 01             	sub    $0x1,%eax
+8010684a:	89 43 04             	mov    %eax,0x4(%ebx)
+  while(!lk->locked && (p = lk->head) != 0){
+8010684d:	eb ad                	jmp    801067fc <releasesleep+0x6c>
+    panic("releasesleep");
+8010684f:	83 ec 0c             	sub    $0xc,%esp
+80106852:	68 67 bc 10 80       	push   $0x8010bc67
+80106857:	e8 64 ac ff ff       	call   801014c0 <panic>
+8010685c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80106860 <disownsleep>:
+// lock that something else (an interrupt) will release, so
+// that nobody spins waiting for this process to release it.
+// Does nothing if lk has already changed hands.
+void
+disownsleep(struct sleeplock *lk)
+{
+80106860:	55                   	push   %ebp
+80106861:	89 e5                	mov    %esp,%ebp
+80106863:	57                   	push   %edi
+80106864:	56                   	push   %esi
+80106865:	53                   	push   %ebx
+80106866:	83 ec 18             	sub    $0x18,%esp
+80106869:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+8010686c:	8d 73 08             	lea    0x8(%ebx),%esi
+8010686f:	56                   	push   %esi
+80106870:	e8 fb 07 00 00       	call   80107070 <acquire>
+  if(lk->locked && lk->owner == myproc()){
+80106875:	8b 03                	mov    (%ebx),%eax
+80106877:	83 c4 10             	add    $0x10,%esp
+8010687a:	85 c0                	test   %eax,%eax
+8010687c:	75 12                	jne    80106890 <disownsleep+0x30>
+    lk->owner = 0;
+    lk->pid = 0;
+  }
+  release(&lk->lk);
+8010687e:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+80106881:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106884:	5b                   	pop    %ebx
+80106885:	5e                   	pop    %esi
+80106886:	5f                   	pop    %edi
+80106887:	5d                   	pop    %ebp
+  release(&lk->lk);
+80106888:	e9 73 06 00 00       	jmp    80106f00 <release>
+8010688d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(lk->locked && lk->owner == myproc()){
+80106890:	8b 7b 68             	mov    0x68(%ebx),%edi
+80106893:	e8 58 ed ff ff       	call   801055f0 <myproc>
+80106898:	39 c7                	cmp    %eax,%edi
+8010689a:	75 e2                	jne    8010687e <disownsleep+0x1e>
+    lk->owner = 0;
+8010689c:	c7 43 68 00 00 00 00 	movl   $0x0,0x68(%ebx)
+    lk->pid = 0;
+801068a3:	c7 43 78 00 00 00 00 	movl   $0x0,0x78(%ebx)
+801068aa:	eb d2                	jmp    8010687e <disownsleep+0x1e>
+801068ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801068b0 <holdingsleep>:
+
+int
+holdingsleep(struct sleeplock *lk)
+{
+801068b0:	55                   	push   %ebp
+801068b1:	89 e5                	mov    %esp,%ebp
+801068b3:	57                   	push   %edi
+801068b4:	31 ff                	xor    %edi,%edi
+801068b6:	56                   	push   %esi
+801068b7:	53                   	push   %ebx
+801068b8:	83 ec 18             	sub    $0x18,%esp
+801068bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  
+  acquire(&lk->lk);
+801068be:	8d 73 08             	lea    0x8(%ebx),%esi
+801068c1:	56                   	push   %esi
+801068c2:	e8 a9 07 00 00       	call   80107070 <acquire>
+  r = lk->locked && (lk->owner == myproc());
+801068c7:	8b 03                	mov    (%ebx),%eax
+801068c9:	83 c4 10             	add    $0x10,%esp
+801068cc:	85 c0                	test   %eax,%eax
+801068ce:	75 18                	jne    801068e8 <holdingsleep+0x38>
+  release(&lk->lk);
+801068d0:	83 ec 0c             	sub    $0xc,%esp
+801068d3:	56                   	push   %esi
+801068d4:	e8 27 06 00 00       	call   80106f00 <release>
+  return r;
+}
+801068d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801068dc:	89 f8                	mov    %edi,%eax
+801068de:	5b                   	pop    %ebx
+801068df:	5e                   	pop    %esi
+801068e0:	5f                   	pop    %edi
+801068e1:	5d                   	pop    %ebp
+801068e2:	c3                   	ret
+801068e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801068e7:	90                   	nop
+  r = lk->locked && (lk->owner == myproc());
+801068e8:	8b 5b 68             	mov    0x68(%ebx),%ebx
+801068eb:	e8 00 ed ff ff       	call   801055f0 <myproc>
+801068f0:	39 c3                	cmp    %eax,%ebx
+801068f2:	0f 94 c0             	sete   %al
+801068f5:	0f b6 c0             	movzbl %al,%eax
+801068f8:	89 c7                	mov    %eax,%edi
+801068fa:	eb d4                	jmp    801068d0 <holdingsleep+0x20>
+801068fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80106900 <lockedsleep>:
+
+// Is lk held exclusively by this process, or shared
+// by anyone?  Shared holders are not recorded.
+int
+lockedsleep(struct sleeplock *lk)
+{
+80106900:	55                   	push   %ebp
+80106901:	89 e5                	mov    %esp,%ebp
+80106903:	57                   	push   %edi
+  int r;
+
+  acquire(&lk->lk);
+  r = lk->nshared > 0 || (lk->locked && lk->owner == myproc());
+80106904:	bf 01 00 00 00       	mov    $0x1,%edi
+{
+80106909:	56                   	push   %esi
+8010690a:	53                   	push   %ebx
+8010690b:	83 ec 18             	sub    $0x18,%esp
+8010690e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+80106911:	8d 73 08             	lea    0x8(%ebx),%esi
+80106914:	56                   	push   %esi
+80106915:	e8 56 07 00 00       	call   80107070 <acquire>
+  r = lk->nshared > 0 || (lk->locked && lk->owner == myproc());
+8010691a:	8b 53 04             	mov    0x4(%ebx),%edx
+8010691d:	83 c4 10             	add    $0x10,%esp
+80106920:	85 d2                	test   %edx,%edx
+80106922:	7e 1c                	jle    80106940 <lockedsleep+0x40>
+  release(&lk->lk);
+80106924:	83 ec 0c             	sub    $0xc,%esp
+80106927:	56                   	push   %esi
+80106928:	e8 d3 05 00 00       	call   80106f00 <release>
+  return r;
+}
+8010692d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106930:	89 f8                	mov    %edi,%eax
+80106932:	5b                   	pop    %ebx
+80106933:	5e                   	pop    %esi
+80106934:	5f                   	pop    %edi
+80106935:	5d                   	pop    %ebp
+80106936:	c3                   	ret
+80106937:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010693e:	66 90                	xchg   %ax,%ax
+  r = lk->nshared > 0 || (lk->locked && lk->owner == myproc());
+80106940:	8b 03                	mov    (%ebx),%eax
+80106942:	31 ff                	xor    %edi,%edi
+80106944:	85 c0                	test   %eax,%eax
+80106946:	74 dc                	je     80106924 <lockedsleep+0x24>
+80106948:	8b 5b 68             	mov    0x68(%ebx),%ebx
+8010694b:	e8 a0 ec ff ff       	call   801055f0 <myproc>
+80106950:	39 c3                	cmp    %eax,%ebx
+80106952:	0f 94 c0             	sete   %al
+80106955:	0f b6 c0             	movzbl %al,%eax
+80106958:	89 c7                	mov    %eax,%edi
+8010695a:	eb c8                	jmp    80106924 <lockedsleep+0x24>
+8010695c:	66 90                	xchg   %ax,%ax
+8010695e:	66 90                	xchg   %ax,%ax
+
+80106960 <initlock>:
+  return i;
+}
+
+void
+initlock(struct spinlock *lk, char *name)
+{
+80106960:	55                   	push   %ebp
+80106961:	89 e5                	mov    %esp,%ebp
+80106963:	57                   	push   %edi
+80106964:	56                   	push   %esi
+80106965:	53                   	push   %ebx
+80106966:	83 ec 1c             	sub    $0x1c,%esp
+80106969:	8b 55 08             	mov    0x8(%ebp),%edx
+  uint eflags;
+  int i;
+
+  lk->name = name;
+8010696c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  lk->next = 0;
+8010696f:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+  lk->name = name;
+80106975:	89 42 08             	mov    %eax,0x8(%edx)
+  lk->owner = 0;
+80106978:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+  lk->cpu = 0;
+8010697f:	c7 42 0c 00 00 00 00 	movl   $0x0,0xc(%edx)
+  lk->nacquire = 0;
+80106986:	c7 42 38 00 00 00 00 	movl   $0x0,0x38(%edx)
+  lk->ncontend = 0;
+8010698d:	c7 42 3c 00 00 00 00 	movl   $0x0,0x3c(%edx)
+  lk->spin = 0;
+80106994:	c7 42 40 00 00 00 00 	movl   $0x0,0x40(%edx)
+8010699b:	c7 42 44 00 00 00 00 	movl   $0x0,0x44(%edx)
+  lk->stat = 0;
+801069a2:	c7 42 48 00 00 00 00 	movl   $0x0,0x48(%edx)
+  lk->tacquire = 0;
+801069a9:	c7 42 54 00 00 00 00 	movl   $0x0,0x54(%edx)
+801069b0:	c7 42 58 00 00 00 00 	movl   $0x0,0x58(%edx)
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+801069b7:	9c                   	pushf
+801069b8:	58                   	pop    %eax
+801069b9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  asm volatile("cli");
+801069bc:	fa                   	cli
+  asm volatile("lock; xchgl %0, %1" :
+801069bd:	b9 01 00 00 00       	mov    $0x1,%ecx
+801069c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+801069c8:	89 c8                	mov    %ecx,%eax
+801069ca:	f0 87 05 c0 76 1b 80 	lock xchg %eax,0x801b76c0
+  while(xchg(&locktab.busy, 1) != 0)
+801069d1:	85 c0                	test   %eax,%eax
+801069d3:	75 f3                	jne    801069c8 <initlock+0x68>
+  for(i = 0; i < locktab.n; i++)
+801069d5:	a1 c4 76 1b 80       	mov    0x801b76c4,%eax
+801069da:	85 c0                	test   %eax,%eax
+801069dc:	0f 8e c8 00 00 00    	jle    80106aaa <initlock+0x14a>
+801069e2:	bb c8 76 1b 80       	mov    $0x801b76c8,%ebx
+801069e7:	89 55 08             	mov    %edx,0x8(%ebp)
+801069ea:	31 f6                	xor    %esi,%esi
+801069ec:	89 df                	mov    %ebx,%edi
+801069ee:	eb 12                	jmp    80106a02 <initlock+0xa2>
+801069f0:	a1 c4 76 1b 80       	mov    0x801b76c4,%eax
+801069f5:	83 c6 01             	add    $0x1,%esi
+801069f8:	81 c7 24 01 00 00    	add    $0x124,%edi
+801069fe:	39 c6                	cmp    %eax,%esi
+80106a00:	7d 6e                	jge    80106a70 <initlock+0x110>
+    if(strncmp(locktab.stat[i].name, name, sizeof(locktab.stat[i].name)) == 0)
+80106a02:	83 ec 04             	sub    $0x4,%esp
+80106a05:	6a 10                	push   $0x10
+80106a07:	ff 75 0c             	push   0xc(%ebp)
+80106a0a:	57                   	push   %edi
+80106a0b:	e8 b0 0a 00 00       	call   801074c0 <strncmp>
+80106a10:	83 c4 10             	add    $0x10,%esp
+80106a13:	85 c0                	test   %eax,%eax
+80106a15:	75 d9                	jne    801069f0 <initlock+0x90>
+80106a17:	8b 55 08             	mov    0x8(%ebp),%edx
+
+  eflags = locktablock();
+  if((i = lockstatfor(name)) >= 0){
+    lk->stat = &locktab.stat[i];
+    lk->stat->nlock++;
+80106a1a:	69 c6 24 01 00 00    	imul   $0x124,%esi,%eax
+    lk->statprev = 0;
+    lk->statnext = locktab.locks[i];
+80106a20:	81 c6 40 12 00 00    	add    $0x1240,%esi
+    lk->stat = &locktab.stat[i];
+80106a26:	89 7a 48             	mov    %edi,0x48(%edx)
+    lk->stat->nlock++;
+80106a29:	83 80 d8 76 1b 80 01 	addl   $0x1,-0x7fe48928(%eax)
+    lk->statprev = 0;
+80106a30:	c7 42 50 00 00 00 00 	movl   $0x0,0x50(%edx)
+    lk->statnext = locktab.locks[i];
+80106a37:	8b 04 b5 c8 76 1b 80 	mov    -0x7fe48938(,%esi,4),%eax
+80106a3e:	89 42 4c             	mov    %eax,0x4c(%edx)
+    if(lk->statnext)
+80106a41:	85 c0                	test   %eax,%eax
+80106a43:	74 03                	je     80106a48 <initlock+0xe8>
+      lk->statnext->statprev = lk;
+80106a45:	89 50 50             	mov    %edx,0x50(%eax)
+    locktab.locks[i] = lk;
+80106a48:	89 14 b5 c8 76 1b 80 	mov    %edx,-0x7fe48938(,%esi,4)
+80106a4f:	31 c0                	xor    %eax,%eax
+80106a51:	f0 87 05 c0 76 1b 80 	lock xchg %eax,0x801b76c0
+  if(eflags & FL_IF)
+80106a58:	f7 45 e4 00 02 00 00 	testl  $0x200,-0x1c(%ebp)
+80106a5f:	74 01                	je     80106a62 <initlock+0x102>
+  asm volatile("sti");
+80106a61:	fb                   	sti
+  }
+  locktabunlock(eflags);
+}
+80106a62:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106a65:	5b                   	pop    %ebx
+80106a66:	5e                   	pop    %esi
+80106a67:	5f                   	pop    %edi
+80106a68:	5d                   	pop    %ebp
+80106a69:	c3                   	ret
+80106a6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(locktab.n == NLOCKSTAT)
+80106a70:	8b 55 08             	mov    0x8(%ebp),%edx
+80106a73:	83 f8 40             	cmp    $0x40,%eax
+80106a76:	74 d7                	je     80106a4f <initlock+0xef>
+80106a78:	69 ce 24 01 00 00    	imul   $0x124,%esi,%ecx
+80106a7e:	83 c1 08             	add    $0x8,%ecx
+  safestrcpy(locktab.stat[i].name, name, sizeof(locktab.stat[i].name));
+80106a81:	83 ec 04             	sub    $0x4,%esp
+80106a84:	8d b9 c0 76 1b 80    	lea    -0x7fe48940(%ecx),%edi
+80106a8a:	89 55 08             	mov    %edx,0x8(%ebp)
+80106a8d:	6a 10                	push   $0x10
+80106a8f:	ff 75 0c             	push   0xc(%ebp)
+80106a92:	57                   	push   %edi
+80106a93:	e8 d8 0a 00 00       	call   80107570 <safestrcpy>
+  locktab.n++;
+80106a98:	83 05 c4 76 1b 80 01 	addl   $0x1,0x801b76c4
+  return i;
+80106a9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  locktab.n++;
+80106aa2:	83 c4 10             	add    $0x10,%esp
+80106aa5:	e9 70 ff ff ff       	jmp    80106a1a <initlock+0xba>
+  for(i = 0; i < locktab.n; i++)
+80106aaa:	b9 08 00 00 00       	mov    $0x8,%ecx
+80106aaf:	31 f6                	xor    %esi,%esi
+80106ab1:	eb ce                	jmp    80106a81 <initlock+0x121>
+80106ab3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106aba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80106ac0 <freelock>:
+
+// Forget lk, whose memory is about to be freed,
+// keeping its counts in its name's totals.
+void
+freelock(struct spinlock *lk)
+{
+80106ac0:	55                   	push   %ebp
+80106ac1:	89 e5                	mov    %esp,%ebp
+80106ac3:	56                   	push   %esi
+80106ac4:	53                   	push   %ebx
+80106ac5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct lockstat *st;
+  uint eflags;
+
+  if((st = lk->stat) == 0)
+80106ac8:	8b 4b 48             	mov    0x48(%ebx),%ecx
+80106acb:	85 c9                	test   %ecx,%ecx
+80106acd:	74 6d                	je     80106b3c <freelock+0x7c>
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80106acf:	9c                   	pushf
+80106ad0:	5e                   	pop    %esi
+  asm volatile("cli");
+80106ad1:	fa                   	cli
+  asm volatile("lock; xchgl %0, %1" :
+80106ad2:	ba 01 00 00 00       	mov    $0x1,%edx
+80106ad7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106ade:	66 90                	xchg   %ax,%ax
+80106ae0:	89 d0                	mov    %edx,%eax
+80106ae2:	f0 87 05 c0 76 1b 80 	lock xchg %eax,0x801b76c0
+  while(xchg(&locktab.busy, 1) != 0)
+80106ae9:	85 c0                	test   %eax,%eax
+80106aeb:	75 f3                	jne    80106ae0 <freelock+0x20>
+    return;
+  eflags = locktablock();
+  st->nlock--;
+80106aed:	83 69 10 01          	subl   $0x1,0x10(%ecx)
+  st->nacquire += lk->nacquire;
+80106af1:	8b 43 38             	mov    0x38(%ebx),%eax
+80106af4:	01 41 14             	add    %eax,0x14(%ecx)
+  st->ncontend += lk->ncontend;
+80106af7:	8b 43 3c             	mov    0x3c(%ebx),%eax
+80106afa:	01 41 18             	add    %eax,0x18(%ecx)
+  st->spin += lk->spin;
+80106afd:	8b 43 40             	mov    0x40(%ebx),%eax
+80106b00:	8b 53 44             	mov    0x44(%ebx),%edx
+80106b03:	01 41 1c             	add    %eax,0x1c(%ecx)
+80106b06:	11 51 20             	adc    %edx,0x20(%ecx)
+  if(lk->statprev)
+80106b09:	8b 43 50             	mov    0x50(%ebx),%eax
+    lk->statprev->statnext = lk->statnext;
+80106b0c:	8b 53 4c             	mov    0x4c(%ebx),%edx
+  if(lk->statprev)
+80106b0f:	85 c0                	test   %eax,%eax
+80106b11:	74 2d                	je     80106b40 <freelock+0x80>
+    lk->statprev->statnext = lk->statnext;
+80106b13:	89 50 4c             	mov    %edx,0x4c(%eax)
+  else
+    locktab.locks[st - locktab.stat] = lk->statnext;
+  if(lk->statnext)
+80106b16:	8b 43 4c             	mov    0x4c(%ebx),%eax
+80106b19:	85 c0                	test   %eax,%eax
+80106b1b:	74 06                	je     80106b23 <freelock+0x63>
+    lk->statnext->statprev = lk->statprev;
+80106b1d:	8b 53 50             	mov    0x50(%ebx),%edx
+80106b20:	89 50 50             	mov    %edx,0x50(%eax)
+  lk->stat = 0;
+80106b23:	c7 43 48 00 00 00 00 	movl   $0x0,0x48(%ebx)
+80106b2a:	31 c0                	xor    %eax,%eax
+80106b2c:	f0 87 05 c0 76 1b 80 	lock xchg %eax,0x801b76c0
+  if(eflags & FL_IF)
+80106b33:	81 e6 00 02 00 00    	and    $0x200,%esi
+80106b39:	74 01                	je     80106b3c <freelock+0x7c>
+  asm volatile("sti");
+80106b3b:	fb                   	sti
+  locktabunlock(eflags);
+}
+80106b3c:	5b                   	pop    %ebx
+80106b3d:	5e                   	pop    %esi
+80106b3e:	5d                   	pop    %ebp
+80106b3f:	c3                   	ret
+    locktab.locks[st - locktab.stat] = lk->statnext;
+80106b40:	81 e9 c8 76 1b 80    	sub    $0x801b76c8,%ecx
+80106b46:	c1 f9 02             	sar    $0x2,%ecx
+80106b49:	69 c1 f9 f1 e3 c7    	imul   $0xc7e3f1f9,%ecx,%eax
+80106b4f:	89 14 85 c8 bf 1b 80 	mov    %edx,-0x7fe44038(,%eax,4)
+80106b56:	eb be                	jmp    80106b16 <freelock+0x56>
+80106b58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106b5f:	90                   	nop
+
+80106b60 <getcallerpcs>:
+}
+
+// Record the current call stack in pcs[] by following the %ebp chain.
+void
+getcallerpcs(void *v, uint pcs[])
+{
+80106b60:	55                   	push   %ebp
+80106b61:	89 e5                	mov    %esp,%ebp
+80106b63:	53                   	push   %ebx
+80106b64:	8b 45 08             	mov    0x8(%ebp),%eax
+80106b67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  uint *ebp;
+  int i;
+
+  ebp = (uint*)v - 2;
+80106b6a:	8d 50 f8             	lea    -0x8(%eax),%edx
+  for(i = 0; i < 10; i++){
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80106b6d:	05 f8 ff ff 7f       	add    $0x7ffffff8,%eax
+80106b72:	3d fe ff ff 7f       	cmp    $0x7ffffffe,%eax
+  for(i = 0; i < 10; i++){
+80106b77:	b8 00 00 00 00       	mov    $0x0,%eax
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80106b7c:	76 10                	jbe    80106b8e <getcallerpcs+0x2e>
+80106b7e:	eb 28                	jmp    80106ba8 <getcallerpcs+0x48>
+80106b80:	8d 9a 00 00 00 80    	lea    -0x80000000(%edx),%ebx
+80106b86:	81 fb fe ff ff 7f    	cmp    $0x7ffffffe,%ebx
+80106b8c:	77 1a                	ja     80106ba8 <getcallerpcs+0x48>
+      break;
+    pcs[i] = ebp[1];     // saved %eip
+80106b8e:	8b 5a 04             	mov    0x4(%edx),%ebx
+80106b91:	89 1c 81             	mov    %ebx,(%ecx,%eax,4)
+  for(i = 0; i < 10; i++){
+80106b94:	83 c0 01             	add    $0x1,%eax
+    ebp = (uint*)ebp[0]; // saved %ebp
+80106b97:	8b 12                	mov    (%edx),%edx
+  for(i = 0; i < 10; i++){
+80106b99:	83 f8 0a             	cmp    $0xa,%eax
+80106b9c:	75 e2                	jne    80106b80 <getcallerpcs+0x20>
+  }
+  for(; i < 10; i++)
+    pcs[i] = 0;
+}
+80106b9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106ba1:	c9                   	leave
+80106ba2:	c3                   	ret
+80106ba3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106ba7:	90                   	nop
+80106ba8:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+80106bab:	8d 51 28             	lea    0x28(%ecx),%edx
+80106bae:	66 90                	xchg   %ax,%ax
+    pcs[i] = 0;
+80106bb0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  for(; i < 10; i++)
+80106bb6:	83 c0 04             	add    $0x4,%eax
+80106bb9:	39 d0                	cmp    %edx,%eax
+80106bbb:	75 f3                	jne    80106bb0 <getcallerpcs+0x50>
+}
+80106bbd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106bc0:	c9                   	leave
+80106bc1:	c3                   	ret
+80106bc2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106bc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80106bd0 <getlockstat>:
+
+// Copy statistics for up to n lock names into st.
+// Returns the number copied.
+int
+getlockstat(struct lockstat *st, int n)
+{
+80106bd0:	55                   	push   %ebp
+80106bd1:	89 e5                	mov    %esp,%ebp
+80106bd3:	57                   	push   %edi
+80106bd4:	56                   	push   %esi
+80106bd5:	53                   	push   %ebx
+80106bd6:	81 ec 44 01 00 00    	sub    $0x144,%esp
+  int i;
+
+  // st is in user memory, so fill it outside the table lock.
+  // The counts of a lock being acquired may be read halfway
+  // through an update; they are only statistics.
+  for(i = 0; i < n; i++){
+80106bdc:	8b 45 0c             	mov    0xc(%ebp),%eax
+80106bdf:	85 c0                	test   %eax,%eax
+80106be1:	0f 8e 32 01 00 00    	jle    80106d19 <getlockstat+0x149>
+80106be7:	c7 85 b8 fe ff ff 00 	movl   $0x0,-0x148(%ebp)
+80106bee:	00 00 00 
+  asm volatile("lock; xchgl %0, %1" :
+80106bf1:	ba 01 00 00 00       	mov    $0x1,%edx
+80106bf6:	c7 85 bc fe ff ff 00 	movl   $0x0,-0x144(%ebp)
+80106bfd:	00 00 00 
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80106c00:	9c                   	pushf
+80106c01:	58                   	pop    %eax
+80106c02:	89 85 b4 fe ff ff    	mov    %eax,-0x14c(%ebp)
+  asm volatile("cli");
+80106c08:	fa                   	cli
+80106c09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  asm volatile("lock; xchgl %0, %1" :
+80106c10:	89 d0                	mov    %edx,%eax
+80106c12:	f0 87 05 c0 76 1b 80 	lock xchg %eax,0x801b76c0
+  while(xchg(&locktab.busy, 1) != 0)
+80106c19:	85 c0                	test   %eax,%eax
+80106c1b:	75 f3                	jne    80106c10 <getlockstat+0x40>
+    eflags = locktablock();
+    if(i >= locktab.n){
+80106c1d:	8b 9d bc fe ff ff    	mov    -0x144(%ebp),%ebx
+80106c23:	39 1d c4 76 1b 80    	cmp    %ebx,0x801b76c4
+80106c29:	0f 8e d4 00 00 00    	jle    80106d03 <getlockstat+0x133>
+      locktabunlock(eflags);
+      break;
+    }
+    t = locktab.stat[i];
+80106c2f:	8b 85 b8 fe ff ff    	mov    -0x148(%ebp),%eax
+80106c35:	b9 49 00 00 00       	mov    $0x49,%ecx
+80106c3a:	8d bd cc fe ff ff    	lea    -0x134(%ebp),%edi
+80106c40:	8d b0 c8 76 1b 80    	lea    -0x7fe48938(%eax),%esi
+80106c46:	8b 98 e8 76 1b 80    	mov    -0x7fe48918(%eax),%ebx
+80106c4c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+80106c4e:	8b b8 dc 76 1b 80    	mov    -0x7fe48924(%eax),%edi
+80106c54:	8b b0 e0 76 1b 80    	mov    -0x7fe48920(%eax),%esi
+80106c5a:	8b 88 e4 76 1b 80    	mov    -0x7fe4891c(%eax),%ecx
+    for(lk = locktab.locks[i]; lk; lk = lk->statnext){
+80106c60:	8b 85 bc fe ff ff    	mov    -0x144(%ebp),%eax
+80106c66:	8b 04 85 c8 bf 1b 80 	mov    -0x7fe44038(,%eax,4),%eax
+80106c6d:	85 c0                	test   %eax,%eax
+80106c6f:	74 1a                	je     80106c8b <getlockstat+0xbb>
+80106c71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      t.nacquire += lk->nacquire;
+80106c78:	03 78 38             	add    0x38(%eax),%edi
+      t.ncontend += lk->ncontend;
+80106c7b:	03 70 3c             	add    0x3c(%eax),%esi
+      t.spin += lk->spin;
+80106c7e:	03 48 40             	add    0x40(%eax),%ecx
+80106c81:	13 58 44             	adc    0x44(%eax),%ebx
+    for(lk = locktab.locks[i]; lk; lk = lk->statnext){
+80106c84:	8b 40 4c             	mov    0x4c(%eax),%eax
+80106c87:	85 c0                	test   %eax,%eax
+80106c89:	75 ed                	jne    80106c78 <getlockstat+0xa8>
+80106c8b:	31 c0                	xor    %eax,%eax
+80106c8d:	f0 87 05 c0 76 1b 80 	lock xchg %eax,0x801b76c0
+  if(eflags & FL_IF)
+80106c94:	f7 85 b4 fe ff ff 00 	testl  $0x200,-0x14c(%ebp)
+80106c9b:	02 00 00 
+80106c9e:	74 01                	je     80106ca1 <getlockstat+0xd1>
+  asm volatile("sti");
+80106ca0:	fb                   	sti
+    }
+    locktabunlock(eflags);
+    st[i] = t;
+80106ca1:	8b 85 b8 fe ff ff    	mov    -0x148(%ebp),%eax
+80106ca7:	89 bd e0 fe ff ff    	mov    %edi,-0x120(%ebp)
+80106cad:	8b 7d 08             	mov    0x8(%ebp),%edi
+80106cb0:	89 b5 e4 fe ff ff    	mov    %esi,-0x11c(%ebp)
+80106cb6:	8d b5 cc fe ff ff    	lea    -0x134(%ebp),%esi
+80106cbc:	89 8d e8 fe ff ff    	mov    %ecx,-0x118(%ebp)
+80106cc2:	b9 49 00 00 00       	mov    $0x49,%ecx
+80106cc7:	01 c7                	add    %eax,%edi
+  for(i = 0; i < n; i++){
+80106cc9:	05 24 01 00 00       	add    $0x124,%eax
+    st[i] = t;
+80106cce:	89 9d ec fe ff ff    	mov    %ebx,-0x114(%ebp)
+80106cd4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  for(i = 0; i < n; i++){
+80106cd6:	83 85 bc fe ff ff 01 	addl   $0x1,-0x144(%ebp)
+80106cdd:	8b 9d bc fe ff ff    	mov    -0x144(%ebp),%ebx
+80106ce3:	89 85 b8 fe ff ff    	mov    %eax,-0x148(%ebp)
+80106ce9:	39 5d 0c             	cmp    %ebx,0xc(%ebp)
+80106cec:	0f 85 0e ff ff ff    	jne    80106c00 <getlockstat+0x30>
+  }
+  return i;
+}
+80106cf2:	8b 85 bc fe ff ff    	mov    -0x144(%ebp),%eax
+80106cf8:	81 c4 44 01 00 00    	add    $0x144,%esp
+80106cfe:	5b                   	pop    %ebx
+80106cff:	5e                   	pop    %esi
+80106d00:	5f                   	pop    %edi
+80106d01:	5d                   	pop    %ebp
+80106d02:	c3                   	ret
+  asm volatile("lock; xchgl %0, %1" :
+80106d03:	f0 87 05 c0 76 1b 80 	lock xchg %eax,0x801b76c0
+  if(eflags & FL_IF)
+80106d0a:	f7 85 b4 fe ff ff 00 	testl  $0x200,-0x14c(%ebp)
+80106d11:	02 00 00 
+80106d14:	74 dc                	je     80106cf2 <getlockstat+0x122>
+  asm volatile("sti");
+80106d16:	fb                   	sti
+}
+80106d17:	eb d9                	jmp    80106cf2 <getlockstat+0x122>
+  for(i = 0; i < n; i++){
+80106d19:	c7 85 bc fe ff ff 00 	movl   $0x0,-0x144(%ebp)
+80106d20:	00 00 00 
+  return i;
+80106d23:	eb cd                	jmp    80106cf2 <getlockstat+0x122>
+80106d25:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106d2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80106d30 <lockprof>:
+// Turn lock profiling on, starting from empty histograms
+// and call sites, or off.  Locks held or waited for while
+// it is turned on or off may be counted partly.
+void
+lockprof(int on)
+{
+80106d30:	55                   	push   %ebp
+80106d31:	89 e5                	mov    %esp,%ebp
+80106d33:	56                   	push   %esi
+80106d34:	53                   	push   %ebx
+80106d35:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct lockstat *st;
+
+  if(on){
+80106d38:	85 f6                	test   %esi,%esi
+80106d3a:	74 62                	je     80106d9e <lockprof+0x6e>
+    lockprofon = 0;
+80106d3c:	c7 05 a0 76 1b 80 00 	movl   $0x0,0x801b76a0
+80106d43:	00 00 00 
+    for(st = locktab.stat; st < &locktab.stat[NLOCKSTAT]; st++){
+80106d46:	bb ec 76 1b 80       	mov    $0x801b76ec,%ebx
+80106d4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106d4f:	90                   	nop
+      memset(st->waithist, 0, sizeof(st->waithist));
+80106d50:	83 ec 04             	sub    $0x4,%esp
+80106d53:	68 80 00 00 00       	push   $0x80
+80106d58:	6a 00                	push   $0x0
+80106d5a:	53                   	push   %ebx
+80106d5b:	e8 60 06 00 00       	call   801073c0 <memset>
+      memset(st->holdhist, 0, sizeof(st->holdhist));
+80106d60:	83 c4 0c             	add    $0xc,%esp
+80106d63:	8d 83 80 00 00 00    	lea    0x80(%ebx),%eax
+    for(st = locktab.stat; st < &locktab.stat[NLOCKSTAT]; st++){
+80106d69:	81 c3 24 01 00 00    	add    $0x124,%ebx
+      memset(st->holdhist, 0, sizeof(st->holdhist));
+80106d6f:	68 80 00 00 00       	push   $0x80
+80106d74:	6a 00                	push   $0x0
+80106d76:	50                   	push   %eax
+80106d77:	e8 44 06 00 00       	call   801073c0 <memset>
+    for(st = locktab.stat; st < &locktab.stat[NLOCKSTAT]; st++){
+80106d7c:	83 c4 10             	add    $0x10,%esp
+80106d7f:	81 fb ec bf 1b 80    	cmp    $0x801bbfec,%ebx
+80106d85:	75 c9                	jne    80106d50 <lockprof+0x20>
+    }
+    memset(locksite, 0, sizeof(locksite));
+80106d87:	83 ec 04             	sub    $0x4,%esp
+80106d8a:	68 00 2c 01 00       	push   $0x12c00
+80106d8f:	6a 00                	push   $0x0
+80106d91:	68 a0 4a 1a 80       	push   $0x801a4aa0
+80106d96:	e8 25 06 00 00       	call   801073c0 <memset>
+80106d9b:	83 c4 10             	add    $0x10,%esp
+  }
+  lockprofon = on;
+80106d9e:	89 35 a0 76 1b 80    	mov    %esi,0x801b76a0
+}
+80106da4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106da7:	5b                   	pop    %ebx
+80106da8:	5e                   	pop    %esi
+80106da9:	5d                   	pop    %ebp
+80106daa:	c3                   	ret
+80106dab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106daf:	90                   	nop
+
+80106db0 <getlockprof>:
+
+// Copy up to n profiled call sites into s.
+// Returns the number copied.
+int
+getlockprof(struct locksite *s, int n)
+{
+80106db0:	55                   	push   %ebp
+80106db1:	89 e5                	mov    %esp,%ebp
+80106db3:	57                   	push   %edi
+80106db4:	56                   	push   %esi
+80106db5:	53                   	push   %ebx
+  struct locksite *t;
+  int i;
+
+  i = 0;
+  for(t = locksite; t < &locksite[NLOCKSITE] && i < n; t++)
+80106db6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  i = 0;
+80106db9:	31 db                	xor    %ebx,%ebx
+  for(t = locksite; t < &locksite[NLOCKSITE] && i < n; t++)
+80106dbb:	85 c0                	test   %eax,%eax
+80106dbd:	7e 40                	jle    80106dff <getlockprof+0x4f>
+80106dbf:	ba a0 4a 1a 80       	mov    $0x801a4aa0,%edx
+80106dc4:	eb 12                	jmp    80106dd8 <getlockprof+0x28>
+80106dc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106dcd:	8d 76 00             	lea    0x0(%esi),%esi
+80106dd0:	81 fa a0 76 1b 80    	cmp    $0x801b76a0,%edx
+80106dd6:	73 27                	jae    80106dff <getlockprof+0x4f>
+    if(t->pc && t->pc != CLAIMED)
+80106dd8:	83 3a 01             	cmpl   $0x1,(%edx)
+80106ddb:	76 17                	jbe    80106df4 <getlockprof+0x44>
+      s[i++] = *t;
+80106ddd:	69 c3 2c 01 00 00    	imul   $0x12c,%ebx,%eax
+80106de3:	03 45 08             	add    0x8(%ebp),%eax
+80106de6:	b9 4b 00 00 00       	mov    $0x4b,%ecx
+80106deb:	89 d6                	mov    %edx,%esi
+80106ded:	89 c7                	mov    %eax,%edi
+80106def:	83 c3 01             	add    $0x1,%ebx
+80106df2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  for(t = locksite; t < &locksite[NLOCKSITE] && i < n; t++)
+80106df4:	81 c2 2c 01 00 00    	add    $0x12c,%edx
+80106dfa:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+80106dfd:	7c d1                	jl     80106dd0 <getlockprof+0x20>
+  return i;
+}
+80106dff:	89 d8                	mov    %ebx,%eax
+80106e01:	5b                   	pop    %ebx
+80106e02:	5e                   	pop    %esi
+80106e03:	5f                   	pop    %edi
+80106e04:	5d                   	pop    %ebp
+80106e05:	c3                   	ret
+80106e06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106e0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80106e10 <pushcli>:
+// it takes two popcli to undo two pushcli.  Also, if interrupts
+// are off, then pushcli, popcli leaves them off.
+
+void
+pushcli(void)
+{
+80106e10:	55                   	push   %ebp
+80106e11:	89 e5                	mov    %esp,%ebp
+80106e13:	53                   	push   %ebx
+80106e14:	83 ec 04             	sub    $0x4,%esp
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80106e17:	9c                   	pushf
+80106e18:	5b                   	pop    %ebx
+  asm volatile("cli");
+80106e19:	fa                   	cli
+  int eflags;
+
+  eflags = readeflags();
+  cli();
+  if(mycpu()->ncli == 0)
+80106e1a:	e8 c1 e7 ff ff       	call   801055e0 <mycpu>
+80106e1f:	8b 80 b4 00 00 00    	mov    0xb4(%eax),%eax
+80106e25:	85 c0                	test   %eax,%eax
+80106e27:	74 17                	je     80106e40 <pushcli+0x30>
+    mycpu()->intena = eflags & FL_IF;
+  mycpu()->ncli += 1;
+80106e29:	e8 b2 e7 ff ff       	call   801055e0 <mycpu>
+80106e2e:	83 80 b4 00 00 00 01 	addl   $0x1,0xb4(%eax)
+}
+80106e35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106e38:	c9                   	leave
+80106e39:	c3                   	ret
+80106e3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mycpu()->intena = eflags & FL_IF;
+80106e40:	e8 9b e7 ff ff       	call   801055e0 <mycpu>
+80106e45:	81 e3 00 02 00 00    	and    $0x200,%ebx
+80106e4b:	89 98 b8 00 00 00    	mov    %ebx,0xb8(%eax)
+80106e51:	eb d6                	jmp    80106e29 <pushcli+0x19>
+80106e53:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106e5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80106e60 <popcli>:
+
+void
+popcli(void)
+{
+80106e60:	55                   	push   %ebp
+80106e61:	89 e5                	mov    %esp,%ebp
+80106e63:	83 ec 08             	sub    $0x8,%esp
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80106e66:	9c                   	pushf
+80106e67:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+80106e68:	f6 c4 02             	test   $0x2,%ah
+80106e6b:	75 35                	jne    80106ea2 <popcli+0x42>
+    panic("popcli - interruptible");
+  if(--mycpu()->ncli < 0)
+80106e6d:	e8 6e e7 ff ff       	call   801055e0 <mycpu>
+80106e72:	83 a8 b4 00 00 00 01 	subl   $0x1,0xb4(%eax)
+80106e79:	78 34                	js     80106eaf <popcli+0x4f>
+    panic("popcli");
+  if(mycpu()->ncli == 0 && mycpu()->intena)
+80106e7b:	e8 60 e7 ff ff       	call   801055e0 <mycpu>
+80106e80:	8b 90 b4 00 00 00    	mov    0xb4(%eax),%edx
+80106e86:	85 d2                	test   %edx,%edx
+80106e88:	74 06                	je     80106e90 <popcli+0x30>
+    sti();
+}
+80106e8a:	c9                   	leave
+80106e8b:	c3                   	ret
+80106e8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(mycpu()->ncli == 0 && mycpu()->intena)
+80106e90:	e8 4b e7 ff ff       	call   801055e0 <mycpu>
+80106e95:	8b 80 b8 00 00 00    	mov    0xb8(%eax),%eax
+80106e9b:	85 c0                	test   %eax,%eax
+80106e9d:	74 eb                	je     80106e8a <popcli+0x2a>
+  asm volatile("sti");
+80106e9f:	fb                   	sti
+}
+80106ea0:	c9                   	leave
+80106ea1:	c3                   	ret
+    panic("popcli - interruptible");
+80106ea2:	83 ec 0c             	sub    $0xc,%esp
+80106ea5:	68 74 bc 10 80       	push   $0x8010bc74
+80106eaa:	e8 11 a6 ff ff       	call   801014c0 <panic>
+    panic("popcli");
+80106eaf:	83 ec 0c             	sub    $0xc,%esp
+80106eb2:	68 8b bc 10 80       	push   $0x8010bc8b
+80106eb7:	e8 04 a6 ff ff       	call   801014c0 <panic>
+80106ebc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80106ec0 <holding>:
+{
+80106ec0:	55                   	push   %ebp
+80106ec1:	89 e5                	mov    %esp,%ebp
+80106ec3:	56                   	push   %esi
+80106ec4:	31 f6                	xor    %esi,%esi
+80106ec6:	53                   	push   %ebx
+80106ec7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pushcli();
+80106eca:	e8 41 ff ff ff       	call   80106e10 <pushcli>
+  r = lock->next != lock->owner && lock->cpu == mycpu();
+80106ecf:	8b 43 04             	mov    0x4(%ebx),%eax
+80106ed2:	39 03                	cmp    %eax,(%ebx)
+80106ed4:	74 12                	je     80106ee8 <holding+0x28>
+80106ed6:	8b 5b 0c             	mov    0xc(%ebx),%ebx
+80106ed9:	e8 02 e7 ff ff       	call   801055e0 <mycpu>
+80106ede:	39 c3                	cmp    %eax,%ebx
+80106ee0:	0f 94 c0             	sete   %al
+80106ee3:	0f b6 c0             	movzbl %al,%eax
+80106ee6:	89 c6                	mov    %eax,%esi
+  popcli();
+80106ee8:	e8 73 ff ff ff       	call   80106e60 <popcli>
+}
+80106eed:	89 f0                	mov    %esi,%eax
+80106eef:	5b                   	pop    %ebx
+80106ef0:	5e                   	pop    %esi
+80106ef1:	5d                   	pop    %ebp
+80106ef2:	c3                   	ret
+80106ef3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106efa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80106f00 <release>:
+{
+80106f00:	55                   	push   %ebp
+80106f01:	89 e5                	mov    %esp,%ebp
+80106f03:	57                   	push   %edi
+80106f04:	56                   	push   %esi
+80106f05:	53                   	push   %ebx
+80106f06:	83 ec 1c             	sub    $0x1c,%esp
+80106f09:	8b 45 08             	mov    0x8(%ebp),%eax
+80106f0c:	89 c7                	mov    %eax,%edi
+80106f0e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  pushcli();
+80106f11:	e8 fa fe ff ff       	call   80106e10 <pushcli>
+  r = lock->next != lock->owner && lock->cpu == mycpu();
+80106f16:	8b 4f 04             	mov    0x4(%edi),%ecx
+80106f19:	39 0f                	cmp    %ecx,(%edi)
+80106f1b:	75 13                	jne    80106f30 <release+0x30>
+  popcli();
+80106f1d:	e8 3e ff ff ff       	call   80106e60 <popcli>
+    panic("release");
+80106f22:	83 ec 0c             	sub    $0xc,%esp
+80106f25:	68 92 bc 10 80       	push   $0x8010bc92
+80106f2a:	e8 91 a5 ff ff       	call   801014c0 <panic>
+80106f2f:	90                   	nop
+  r = lock->next != lock->owner && lock->cpu == mycpu();
+80106f30:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80106f33:	8b 70 0c             	mov    0xc(%eax),%esi
+80106f36:	e8 a5 e6 ff ff       	call   801055e0 <mycpu>
+80106f3b:	39 c6                	cmp    %eax,%esi
+80106f3d:	75 de                	jne    80106f1d <release+0x1d>
+  popcli();
+80106f3f:	e8 1c ff ff ff       	call   80106e60 <popcli>
+  if(lk->tacquire){
+80106f44:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80106f47:	8b 7b 58             	mov    0x58(%ebx),%edi
+80106f4a:	8b 73 54             	mov    0x54(%ebx),%esi
+80106f4d:	89 f8                	mov    %edi,%eax
+80106f4f:	09 f0                	or     %esi,%eax
+80106f51:	0f 84 c6 00 00 00    	je     8010701d <release+0x11d>
+  asm volatile("rdtsc" : "=A" (tsc));
+80106f57:	0f 31                	rdtsc
+    hold = rdtsc() - lk->tacquire;
+80106f59:	29 f0                	sub    %esi,%eax
+    lk->tacquire = 0;
+80106f5b:	c7 43 54 00 00 00 00 	movl   $0x0,0x54(%ebx)
+    hold = rdtsc() - lk->tacquire;
+80106f62:	19 fa                	sbb    %edi,%edx
+    lk->tacquire = 0;
+80106f64:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+    hold = rdtsc() - lk->tacquire;
+80106f6b:	89 d1                	mov    %edx,%ecx
+80106f6d:	89 c2                	mov    %eax,%edx
+    if(lk->stat)
+80106f6f:	8b 43 48             	mov    0x48(%ebx),%eax
+80106f72:	85 c0                	test   %eax,%eax
+80106f74:	74 54                	je     80106fca <release+0xca>
+      histadd(lk->stat->holdhist, hold);
+80106f76:	05 a4 00 00 00       	add    $0xa4,%eax
+80106f7b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for(b = 0; n > 1 && b < NLOCKHIST-1; b++)
+80106f7e:	b8 01 00 00 00       	mov    $0x1,%eax
+80106f83:	39 d0                	cmp    %edx,%eax
+80106f85:	b8 00 00 00 00       	mov    $0x0,%eax
+80106f8a:	19 c8                	sbb    %ecx,%eax
+80106f8c:	73 30                	jae    80106fbe <release+0xbe>
+80106f8e:	89 d6                	mov    %edx,%esi
+80106f90:	89 cf                	mov    %ecx,%edi
+80106f92:	31 c0                	xor    %eax,%eax
+80106f94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    n >>= 1;
+80106f98:	0f ac fe 01          	shrd   $0x1,%edi,%esi
+  for(b = 0; n > 1 && b < NLOCKHIST-1; b++)
+80106f9c:	bb 01 00 00 00       	mov    $0x1,%ebx
+    n >>= 1;
+80106fa1:	d1 ef                	shr    %edi
+  for(b = 0; n > 1 && b < NLOCKHIST-1; b++)
+80106fa3:	83 c0 01             	add    $0x1,%eax
+80106fa6:	39 f3                	cmp    %esi,%ebx
+80106fa8:	bb 00 00 00 00       	mov    $0x0,%ebx
+80106fad:	19 fb                	sbb    %edi,%ebx
+80106faf:	0f 82 93 00 00 00    	jb     80107048 <release+0x148>
+  xadd(&hist[b], 1);
+80106fb5:	8b 7d e0             	mov    -0x20(%ebp),%edi
+80106fb8:	8d 04 87             	lea    (%edi,%eax,4),%eax
+80106fbb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  asm volatile("lock; xaddl %0, %1" :
+80106fbe:	b8 01 00 00 00       	mov    $0x1,%eax
+80106fc3:	8b 7d e0             	mov    -0x20(%ebp),%edi
+80106fc6:	f0 0f c1 07          	lock xadd %eax,(%edi)
+    if(lk->site){
+80106fca:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80106fcd:	8b 47 5c             	mov    0x5c(%edi),%eax
+80106fd0:	85 c0                	test   %eax,%eax
+80106fd2:	74 49                	je     8010701d <release+0x11d>
+  asm volatile("lock; addl %2, %0\n\tlock; adcl %3, %1" :
+80106fd4:	f0 01 50 24          	lock add %edx,0x24(%eax)
+80106fd8:	f0 11 48 28          	lock adc %ecx,0x28(%eax)
+      histadd(lk->site->holdhist, hold);
+80106fdc:	8b 47 5c             	mov    0x5c(%edi),%eax
+80106fdf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80106fe2:	8d b8 ac 00 00 00    	lea    0xac(%eax),%edi
+  for(b = 0; n > 1 && b < NLOCKHIST-1; b++)
+80106fe8:	b8 01 00 00 00       	mov    $0x1,%eax
+80106fed:	39 d0                	cmp    %edx,%eax
+80106fef:	b8 00 00 00 00       	mov    $0x0,%eax
+80106ff4:	19 c8                	sbb    %ecx,%eax
+80106ff6:	73 1c                	jae    80107014 <release+0x114>
+80106ff8:	31 c0                	xor    %eax,%eax
+80106ffa:	bb 01 00 00 00       	mov    $0x1,%ebx
+80106fff:	90                   	nop
+    n >>= 1;
+80107000:	0f ac ca 01          	shrd   $0x1,%ecx,%edx
+  for(b = 0; n > 1 && b < NLOCKHIST-1; b++)
+80107004:	31 f6                	xor    %esi,%esi
+    n >>= 1;
+80107006:	d1 e9                	shr    %ecx
+  for(b = 0; n > 1 && b < NLOCKHIST-1; b++)
+80107008:	83 c0 01             	add    $0x1,%eax
+8010700b:	39 d3                	cmp    %edx,%ebx
+8010700d:	19 ce                	sbb    %ecx,%esi
+8010700f:	72 4f                	jb     80107060 <release+0x160>
+  xadd(&hist[b], 1);
+80107011:	8d 3c 87             	lea    (%edi,%eax,4),%edi
+80107014:	b8 01 00 00 00       	mov    $0x1,%eax
+80107019:	f0 0f c1 07          	lock xadd %eax,(%edi)
+  lk->pcs[0] = 0;
+8010701d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80107020:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  lk->cpu = 0;
+80107027:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+  __sync_synchronize();
+8010702e:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  asm volatile("incl %0" : "+m" (lk->owner) : );
+80107033:	ff 40 04             	incl   0x4(%eax)
+}
+80107036:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107039:	5b                   	pop    %ebx
+8010703a:	5e                   	pop    %esi
+8010703b:	5f                   	pop    %edi
+8010703c:	5d                   	pop    %ebp
+  popcli();
+8010703d:	e9 1e fe ff ff       	jmp    80106e60 <popcli>
+80107042:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(b = 0; n > 1 && b < NLOCKHIST-1; b++)
+80107048:	83 f8 1e             	cmp    $0x1e,%eax
+8010704b:	0f 8e 47 ff ff ff    	jle    80106f98 <release+0x98>
+80107051:	e9 5f ff ff ff       	jmp    80106fb5 <release+0xb5>
+80107056:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010705d:	8d 76 00             	lea    0x0(%esi),%esi
+80107060:	83 f8 1e             	cmp    $0x1e,%eax
+80107063:	7e 9b                	jle    80107000 <release+0x100>
+80107065:	eb aa                	jmp    80107011 <release+0x111>
+80107067:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010706e:	66 90                	xchg   %ax,%ax
+
+80107070 <acquire>:
+{
+80107070:	55                   	push   %ebp
+80107071:	89 e5                	mov    %esp,%ebp
+80107073:	57                   	push   %edi
+80107074:	56                   	push   %esi
+80107075:	53                   	push   %ebx
+80107076:	83 ec 2c             	sub    $0x2c,%esp
+  pushcli(); // disable interrupts to avoid deadlock.
+80107079:	e8 92 fd ff ff       	call   80106e10 <pushcli>
+  if(holding(lk))
+8010707e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pushcli();
+80107081:	e8 8a fd ff ff       	call   80106e10 <pushcli>
+  r = lock->next != lock->owner && lock->cpu == mycpu();
+80107086:	8b 43 04             	mov    0x4(%ebx),%eax
+80107089:	39 03                	cmp    %eax,(%ebx)
+8010708b:	0f 85 8d 02 00 00    	jne    8010731e <acquire+0x2ae>
+  popcli();
+80107091:	e8 ca fd ff ff       	call   80106e60 <popcli>
+80107096:	be 01 00 00 00       	mov    $0x1,%esi
+  ticket = xadd(&lk->next, 1);
+8010709b:	8b 45 08             	mov    0x8(%ebp),%eax
+8010709e:	f0 0f c1 30          	lock xadd %esi,(%eax)
+  if(lk->owner != ticket){
+801070a2:	8b 7d 08             	mov    0x8(%ebp),%edi
+801070a5:	39 77 04             	cmp    %esi,0x4(%edi)
+801070a8:	0f 84 92 02 00 00    	je     80107340 <acquire+0x2d0>
+  asm volatile("rdtsc" : "=A" (tsc));
+801070ae:	0f 31                	rdtsc
+801070b0:	89 c1                	mov    %eax,%ecx
+    while(*(volatile uint*)&lk->owner != ticket)
+801070b2:	8b 47 04             	mov    0x4(%edi),%eax
+801070b5:	89 d3                	mov    %edx,%ebx
+801070b7:	39 c6                	cmp    %eax,%esi
+801070b9:	74 11                	je     801070cc <acquire+0x5c>
+801070bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801070bf:	90                   	nop
+  asm volatile("pause");
+801070c0:	f3 90                	pause
+801070c2:	8b 45 08             	mov    0x8(%ebp),%eax
+801070c5:	8b 40 04             	mov    0x4(%eax),%eax
+801070c8:	39 f0                	cmp    %esi,%eax
+801070ca:	75 f4                	jne    801070c0 <acquire+0x50>
+  asm volatile("rdtsc" : "=A" (tsc));
+801070cc:	0f 31                	rdtsc
+    spin = rdtsc() - t0;
+801070ce:	29 c8                	sub    %ecx,%eax
+801070d0:	19 da                	sbb    %ebx,%edx
+801070d2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+801070d5:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  __sync_synchronize();
+801070d8:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  lk->cpu = mycpu();
+801070dd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801070e0:	e8 fb e4 ff ff       	call   801055e0 <mycpu>
+  getcallerpcs(&lk, lk->pcs);
+801070e5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  for(i = 0; i < 10; i++){
+801070e8:	31 d2                	xor    %edx,%edx
+  lk->cpu = mycpu();
+801070ea:	89 43 0c             	mov    %eax,0xc(%ebx)
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+801070ed:	8d 85 00 00 00 80    	lea    -0x80000000(%ebp),%eax
+801070f3:	3d fe ff ff 7f       	cmp    $0x7ffffffe,%eax
+801070f8:	0f 87 c9 01 00 00    	ja     801072c7 <acquire+0x257>
+  ebp = (uint*)v - 2;
+801070fe:	89 e8                	mov    %ebp,%eax
+80107100:	eb 18                	jmp    8010711a <acquire+0xaa>
+80107102:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80107108:	8d 98 00 00 00 80    	lea    -0x80000000(%eax),%ebx
+8010710e:	81 fb fe ff ff 7f    	cmp    $0x7ffffffe,%ebx
+80107114:	0f 87 ad 01 00 00    	ja     801072c7 <acquire+0x257>
+    pcs[i] = ebp[1];     // saved %eip
+8010711a:	8b 58 04             	mov    0x4(%eax),%ebx
+8010711d:	89 5c 91 10          	mov    %ebx,0x10(%ecx,%edx,4)
+  for(i = 0; i < 10; i++){
+80107121:	83 c2 01             	add    $0x1,%edx
+    ebp = (uint*)ebp[0]; // saved %ebp
+80107124:	8b 00                	mov    (%eax),%eax
+  for(i = 0; i < 10; i++){
+80107126:	83 fa 0a             	cmp    $0xa,%edx
+80107129:	75 dd                	jne    80107108 <acquire+0x98>
+  lk->nacquire++;
+8010712b:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(spin){
+8010712e:	8b 75 d0             	mov    -0x30(%ebp),%esi
+80107131:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  lk->nacquire++;
+80107134:	83 40 38 01          	addl   $0x1,0x38(%eax)
+  if(spin){
+80107138:	09 f3                	or     %esi,%ebx
+8010713a:	74 10                	je     8010714c <acquire+0xdc>
+    lk->ncontend++;
+8010713c:	83 40 3c 01          	addl   $0x1,0x3c(%eax)
+    lk->spin += spin;
+80107140:	8b 75 d0             	mov    -0x30(%ebp),%esi
+80107143:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+80107146:	01 70 40             	add    %esi,0x40(%eax)
+80107149:	11 78 44             	adc    %edi,0x44(%eax)
+  if(lockprofon){
+8010714c:	8b 0d a0 76 1b 80    	mov    0x801b76a0,%ecx
+  st = lk->stat;
+80107152:	8b 50 48             	mov    0x48(%eax),%edx
+  lk->tacquire = 0;
+80107155:	c7 40 54 00 00 00 00 	movl   $0x0,0x54(%eax)
+8010715c:	c7 40 58 00 00 00 00 	movl   $0x0,0x58(%eax)
+  if(lockprofon){
+80107163:	85 c9                	test   %ecx,%ecx
+80107165:	0f 84 54 01 00 00    	je     801072bf <acquire+0x24f>
+    if(st)
+8010716b:	85 d2                	test   %edx,%edx
+8010716d:	74 5e                	je     801071cd <acquire+0x15d>
+      histadd(st->waithist, spin);
+8010716f:	8d 42 24             	lea    0x24(%edx),%eax
+  for(b = 0; n > 1 && b < NLOCKHIST-1; b++)
+80107172:	8b 75 d0             	mov    -0x30(%ebp),%esi
+80107175:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      histadd(st->waithist, spin);
+80107178:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for(b = 0; n > 1 && b < NLOCKHIST-1; b++)
+8010717b:	b8 01 00 00 00       	mov    $0x1,%eax
+80107180:	39 f0                	cmp    %esi,%eax
+80107182:	b8 00 00 00 00       	mov    $0x0,%eax
+80107187:	19 f8                	sbb    %edi,%eax
+80107189:	73 33                	jae    801071be <acquire+0x14e>
+8010718b:	89 f0                	mov    %esi,%eax
+8010718d:	89 fa                	mov    %edi,%edx
+8010718f:	31 c9                	xor    %ecx,%ecx
+80107191:	be 01 00 00 00       	mov    $0x1,%esi
+80107196:	31 db                	xor    %ebx,%ebx
+80107198:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010719f:	90                   	nop
+    n >>= 1;
+801071a0:	0f ac d0 01          	shrd   $0x1,%edx,%eax
+  for(b = 0; n > 1 && b < NLOCKHIST-1; b++)
+801071a4:	83 c1 01             	add    $0x1,%ecx
+    n >>= 1;
+801071a7:	d1 ea                	shr    %edx
+  for(b = 0; n > 1 && b < NLOCKHIST-1; b++)
+801071a9:	89 df                	mov    %ebx,%edi
+801071ab:	39 c6                	cmp    %eax,%esi
+801071ad:	19 d7                	sbb    %edx,%edi
+801071af:	0f 82 5b 01 00 00    	jb     80107310 <acquire+0x2a0>
+  xadd(&hist[b], 1);
+801071b5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801071b8:	8d 04 88             	lea    (%eax,%ecx,4),%eax
+801071bb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  asm volatile("lock; xaddl %0, %1" :
+801071be:	b8 01 00 00 00       	mov    $0x1,%eax
+801071c3:	8b 7d e0             	mov    -0x20(%ebp),%edi
+801071c6:	f0 0f c1 07          	lock xadd %eax,(%edi)
+    if((s = locksitefor(lk->pcs[0], lk->name)) != 0){
+801071ca:	8b 45 08             	mov    0x8(%ebp),%eax
+801071cd:	8b 78 08             	mov    0x8(%eax),%edi
+801071d0:	8b 40 10             	mov    0x10(%eax),%eax
+801071d3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  h = (pc >> 2) % NLOCKSITE;
+801071d6:	c1 e8 02             	shr    $0x2,%eax
+801071d9:	0f b6 f0             	movzbl %al,%esi
+    if((s = locksitefor(lk->pcs[0], lk->name)) != 0){
+801071dc:	89 7d d8             	mov    %edi,-0x28(%ebp)
+801071df:	8d 86 00 01 00 00    	lea    0x100(%esi),%eax
+801071e5:	89 45 dc             	mov    %eax,-0x24(%ebp)
+801071e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801071ef:	90                   	nop
+    s = &locksite[(h + i) % NLOCKSITE];
+801071f0:	89 f0                	mov    %esi,%eax
+801071f2:	0f b6 d0             	movzbl %al,%edx
+801071f5:	69 da 2c 01 00 00    	imul   $0x12c,%edx,%ebx
+    if(s->pc == 0 && cmpxchg(&s->pc, 0, CLAIMED) == 0){
+801071fb:	8b 83 a0 4a 1a 80    	mov    -0x7fe5b560(%ebx),%eax
+    s = &locksite[(h + i) % NLOCKSITE];
+80107201:	8d bb a0 4a 1a 80    	lea    -0x7fe5b560(%ebx),%edi
+    if(s->pc == 0 && cmpxchg(&s->pc, 0, CLAIMED) == 0){
+80107207:	85 c0                	test   %eax,%eax
+80107209:	75 13                	jne    8010721e <acquire+0x1ae>
+  asm volatile("lock; cmpxchgl %2, %1" :
+8010720b:	31 c0                	xor    %eax,%eax
+8010720d:	b9 01 00 00 00       	mov    $0x1,%ecx
+80107212:	f0 0f b1 8b a0 4a 1a 	lock cmpxchg %ecx,-0x7fe5b560(%ebx)
+80107219:	80 
+8010721a:	85 c0                	test   %eax,%eax
+8010721c:	74 40                	je     8010725e <acquire+0x1ee>
+    while(*(volatile uint*)&s->pc == CLAIMED)
+8010721e:	69 ca 2c 01 00 00    	imul   $0x12c,%edx,%ecx
+80107224:	8b 81 a0 4a 1a 80    	mov    -0x7fe5b560(%ecx),%eax
+8010722a:	83 f8 01             	cmp    $0x1,%eax
+8010722d:	75 0e                	jne    8010723d <acquire+0x1cd>
+8010722f:	90                   	nop
+  asm volatile("pause");
+80107230:	f3 90                	pause
+80107232:	8b 81 a0 4a 1a 80    	mov    -0x7fe5b560(%ecx),%eax
+80107238:	83 f8 01             	cmp    $0x1,%eax
+8010723b:	74 f3                	je     80107230 <acquire+0x1c0>
+    if(s->pc == pc && strncmp(s->name, name, sizeof(s->name)) == 0)
+8010723d:	69 d2 2c 01 00 00    	imul   $0x12c,%edx,%edx
+80107243:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80107246:	3b 82 a0 4a 1a 80    	cmp    -0x7fe5b560(%edx),%eax
+8010724c:	0f 84 96 00 00 00    	je     801072e8 <acquire+0x278>
+  for(i = 0; i < NLOCKSITE; i++){
+80107252:	83 c6 01             	add    $0x1,%esi
+80107255:	39 75 dc             	cmp    %esi,-0x24(%ebp)
+80107258:	75 96                	jne    801071f0 <acquire+0x180>
+8010725a:	31 ff                	xor    %edi,%edi
+8010725c:	eb 53                	jmp    801072b1 <acquire+0x241>
+      safestrcpy(s->name, name, sizeof(s->name));
+8010725e:	83 ec 04             	sub    $0x4,%esp
+80107261:	8d 83 a4 4a 1a 80    	lea    -0x7fe5b55c(%ebx),%eax
+80107267:	6a 10                	push   $0x10
+80107269:	ff 75 d8             	push   -0x28(%ebp)
+8010726c:	50                   	push   %eax
+8010726d:	e8 fe 02 00 00       	call   80107570 <safestrcpy>
+      s->pc = pc;
+80107272:	83 c4 10             	add    $0x10,%esp
+      __sync_synchronize();
+80107275:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+      s->pc = pc;
+8010727a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010727d:	89 83 a0 4a 1a 80    	mov    %eax,-0x7fe5b560(%ebx)
+  asm volatile("lock; xaddl %0, %1" :
+80107283:	b8 01 00 00 00       	mov    $0x1,%eax
+80107288:	89 c2                	mov    %eax,%edx
+8010728a:	f0 0f c1 57 14       	lock xadd %edx,0x14(%edi)
+      if(spin)
+8010728f:	8b 55 d0             	mov    -0x30(%ebp),%edx
+80107292:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+      histadd(s->waithist, spin);
+80107295:	8d 5f 2c             	lea    0x2c(%edi),%ebx
+      if(spin)
+80107298:	09 d6                	or     %edx,%esi
+8010729a:	0f 85 b3 00 00 00    	jne    80107353 <acquire+0x2e3>
+  asm volatile("lock; addl %2, %0\n\tlock; adcl %3, %1" :
+801072a0:	f0 01 77 1c          	lock add %esi,0x1c(%edi)
+801072a4:	f0 11 77 20          	lock adc %esi,0x20(%edi)
+801072a8:	b8 01 00 00 00       	mov    $0x1,%eax
+801072ad:	f0 0f c1 03          	lock xadd %eax,(%ebx)
+    lk->site = s;
+801072b1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+801072b4:	89 79 5c             	mov    %edi,0x5c(%ecx)
+  asm volatile("rdtsc" : "=A" (tsc));
+801072b7:	0f 31                	rdtsc
+    lk->tacquire = rdtsc();
+801072b9:	89 41 54             	mov    %eax,0x54(%ecx)
+801072bc:	89 51 58             	mov    %edx,0x58(%ecx)
+}
+801072bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801072c2:	5b                   	pop    %ebx
+801072c3:	5e                   	pop    %esi
+801072c4:	5f                   	pop    %edi
+801072c5:	5d                   	pop    %ebp
+801072c6:	c3                   	ret
+801072c7:	8d 44 91 10          	lea    0x10(%ecx,%edx,4),%eax
+801072cb:	8d 51 38             	lea    0x38(%ecx),%edx
+801072ce:	66 90                	xchg   %ax,%ax
+    pcs[i] = 0;
+801072d0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  for(; i < 10; i++)
+801072d6:	83 c0 04             	add    $0x4,%eax
+801072d9:	39 c2                	cmp    %eax,%edx
+801072db:	75 f3                	jne    801072d0 <acquire+0x260>
+801072dd:	e9 49 fe ff ff       	jmp    8010712b <acquire+0xbb>
+801072e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(s->pc == pc && strncmp(s->name, name, sizeof(s->name)) == 0)
+801072e8:	83 ec 04             	sub    $0x4,%esp
+801072eb:	81 c3 a4 4a 1a 80    	add    $0x801a4aa4,%ebx
+801072f1:	6a 10                	push   $0x10
+801072f3:	ff 75 d8             	push   -0x28(%ebp)
+801072f6:	53                   	push   %ebx
+801072f7:	e8 c4 01 00 00       	call   801074c0 <strncmp>
+801072fc:	83 c4 10             	add    $0x10,%esp
+801072ff:	85 c0                	test   %eax,%eax
+80107301:	0f 85 4b ff ff ff    	jne    80107252 <acquire+0x1e2>
+80107307:	e9 77 ff ff ff       	jmp    80107283 <acquire+0x213>
+8010730c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(b = 0; n > 1 && b < NLOCKHIST-1; b++)
+80107310:	83 f9 1e             	cmp    $0x1e,%ecx
+80107313:	0f 8e 87 fe ff ff    	jle    801071a0 <acquire+0x130>
+80107319:	e9 97 fe ff ff       	jmp    801071b5 <acquire+0x145>
+  r = lock->next != lock->owner && lock->cpu == mycpu();
+8010731e:	8b 5b 0c             	mov    0xc(%ebx),%ebx
+80107321:	e8 ba e2 ff ff       	call   801055e0 <mycpu>
+80107326:	39 c3                	cmp    %eax,%ebx
+80107328:	0f 85 63 fd ff ff    	jne    80107091 <acquire+0x21>
+  popcli();
+8010732e:	e8 2d fb ff ff       	call   80106e60 <popcli>
+    panic("acquire");
+80107333:	83 ec 0c             	sub    $0xc,%esp
+80107336:	68 9a bc 10 80       	push   $0x8010bc9a
+8010733b:	e8 80 a1 ff ff       	call   801014c0 <panic>
+  spin = 0;
+80107340:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+80107347:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+8010734e:	e9 85 fd ff ff       	jmp    801070d8 <acquire+0x68>
+  asm volatile("lock; xaddl %0, %1" :
+80107353:	f0 0f c1 47 18       	lock xadd %eax,0x18(%edi)
+  asm volatile("lock; addl %2, %0\n\tlock; adcl %3, %1" :
+80107358:	8b 45 d0             	mov    -0x30(%ebp),%eax
+8010735b:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+8010735e:	f0 01 47 1c          	lock add %eax,0x1c(%edi)
+80107362:	f0 11 57 20          	lock adc %edx,0x20(%edi)
+  for(b = 0; n > 1 && b < NLOCKHIST-1; b++)
+80107366:	83 f0 01             	xor    $0x1,%eax
+80107369:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+8010736c:	31 d2                	xor    %edx,%edx
+8010736e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80107371:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80107374:	31 c0                	xor    %eax,%eax
+80107376:	0b 4d e0             	or     -0x20(%ebp),%ecx
+80107379:	be 01 00 00 00       	mov    $0x1,%esi
+8010737e:	0f 84 24 ff ff ff    	je     801072a8 <acquire+0x238>
+80107384:	89 7d e0             	mov    %edi,-0x20(%ebp)
+80107387:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+8010738a:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+8010738d:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+    n >>= 1;
+80107390:	0f ac d9 01          	shrd   $0x1,%ebx,%ecx
+  for(b = 0; n > 1 && b < NLOCKHIST-1; b++)
+80107394:	83 c0 01             	add    $0x1,%eax
+    n >>= 1;
+80107397:	d1 eb                	shr    %ebx
+  for(b = 0; n > 1 && b < NLOCKHIST-1; b++)
+80107399:	89 d7                	mov    %edx,%edi
+8010739b:	39 ce                	cmp    %ecx,%esi
+8010739d:	19 df                	sbb    %ebx,%edi
+8010739f:	72 0f                	jb     801073b0 <acquire+0x340>
+  xadd(&hist[b], 1);
+801073a1:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+801073a4:	8b 7d e0             	mov    -0x20(%ebp),%edi
+801073a7:	8d 1c 83             	lea    (%ebx,%eax,4),%ebx
+801073aa:	e9 f9 fe ff ff       	jmp    801072a8 <acquire+0x238>
+801073af:	90                   	nop
+  for(b = 0; n > 1 && b < NLOCKHIST-1; b++)
+801073b0:	83 f8 1e             	cmp    $0x1e,%eax
+801073b3:	7e db                	jle    80107390 <acquire+0x320>
+801073b5:	eb ea                	jmp    801073a1 <acquire+0x331>
+801073b7:	66 90                	xchg   %ax,%ax
+801073b9:	66 90                	xchg   %ax,%ax
+801073bb:	66 90                	xchg   %ax,%ax
+801073bd:	66 90                	xchg   %ax,%ax
+801073bf:	90                   	nop
+
+801073c0 <memset>:
+#include "types.h"
+#include "x86.h"
+
+void*
+memset(void *dst, int c, uint n)
+{
+801073c0:	55                   	push   %ebp
+801073c1:	89 e5                	mov    %esp,%ebp
+801073c3:	57                   	push   %edi
+801073c4:	8b 55 08             	mov    0x8(%ebp),%edx
+801073c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  if ((int)dst%4 == 0 && n%4 == 0){
+801073ca:	89 d0                	mov    %edx,%eax
+801073cc:	09 c8                	or     %ecx,%eax
+801073ce:	a8 03                	test   $0x3,%al
+801073d0:	75 1e                	jne    801073f0 <memset+0x30>
+    c &= 0xFF;
+801073d2:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+    stosl(dst, (c<<24)|(c<<16)|(c<<8)|c, n/4);
+801073d6:	c1 e9 02             	shr    $0x2,%ecx
+  asm volatile("cld; rep stosl" :
+801073d9:	89 d7                	mov    %edx,%edi
+801073db:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+801073e1:	fc                   	cld
+801073e2:	f3 ab                	rep stos %eax,%es:(%edi)
+  } else
+    stosb(dst, c, n);
+  return dst;
+}
+801073e4:	8b 7d fc             	mov    -0x4(%ebp),%edi
+801073e7:	89 d0                	mov    %edx,%eax
+801073e9:	c9                   	leave
+801073ea:	c3                   	ret
+801073eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801073ef:	90                   	nop
+  asm volatile("cld; rep stosb" :
+801073f0:	8b 45 0c             	mov    0xc(%ebp),%eax
+801073f3:	89 d7                	mov    %edx,%edi
+801073f5:	fc                   	cld
+801073f6:	f3 aa                	rep stos %al,%es:(%edi)
+801073f8:	8b 7d fc             	mov    -0x4(%ebp),%edi
+801073fb:	89 d0                	mov    %edx,%eax
+801073fd:	c9                   	leave
+801073fe:	c3                   	ret
+801073ff:	90                   	nop
+
+80107400 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+80107400:	55                   	push   %ebp
+80107401:	89 e5                	mov    %esp,%ebp
+80107403:	56                   	push   %esi
+80107404:	53                   	push   %ebx
+80107405:	8b 75 10             	mov    0x10(%ebp),%esi
+80107408:	8b 55 08             	mov    0x8(%ebp),%edx
+8010740b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+8010740e:	85 f6                	test   %esi,%esi
+80107410:	74 2e                	je     80107440 <memcmp+0x40>
+80107412:	01 c6                	add    %eax,%esi
+80107414:	eb 14                	jmp    8010742a <memcmp+0x2a>
+80107416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010741d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+80107420:	83 c0 01             	add    $0x1,%eax
+80107423:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+80107426:	39 f0                	cmp    %esi,%eax
+80107428:	74 16                	je     80107440 <memcmp+0x40>
+    if(*s1 != *s2)
+8010742a:	0f b6 0a             	movzbl (%edx),%ecx
+8010742d:	0f b6 18             	movzbl (%eax),%ebx
+80107430:	38 d9                	cmp    %bl,%cl
+80107432:	74 ec                	je     80107420 <memcmp+0x20>
+      return *s1 - *s2;
+80107434:	0f b6 c1             	movzbl %cl,%eax
+80107437:	29 d8                	sub    %ebx,%eax
+  }
+
+  return 0;
+}
+80107439:	5b                   	pop    %ebx
+8010743a:	5e                   	pop    %esi
+8010743b:	5d                   	pop    %ebp
+8010743c:	c3                   	ret
+8010743d:	8d 76 00             	lea    0x0(%esi),%esi
+80107440:	5b                   	pop    %ebx
+  return 0;
+80107441:	31 c0                	xor    %eax,%eax
+}
+80107443:	5e                   	pop    %esi
+80107444:	5d                   	pop    %ebp
+80107445:	c3                   	ret
+80107446:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010744d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107450 <memmove>:
+
+void*
+memmove(void *dst, const void *src, uint n)
+{
+80107450:	55                   	push   %ebp
+80107451:	89 e5                	mov    %esp,%ebp
+80107453:	57                   	push   %edi
+80107454:	56                   	push   %esi
+80107455:	8b 55 08             	mov    0x8(%ebp),%edx
+80107458:	8b 75 0c             	mov    0xc(%ebp),%esi
+8010745b:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if(s < d && s + n > d){
+8010745e:	39 d6                	cmp    %edx,%esi
+80107460:	73 26                	jae    80107488 <memmove+0x38>
+80107462:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+80107465:	39 ca                	cmp    %ecx,%edx
+80107467:	73 1f                	jae    80107488 <memmove+0x38>
+    s += n;
+    d += n;
+    while(n-- > 0)
+80107469:	85 c0                	test   %eax,%eax
+8010746b:	74 0f                	je     8010747c <memmove+0x2c>
+8010746d:	83 e8 01             	sub    $0x1,%eax
+      *--d = *--s;
+80107470:	0f b6 0c 06          	movzbl (%esi,%eax,1),%ecx
+80107474:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+    while(n-- > 0)
+80107477:	83 e8 01             	sub    $0x1,%eax
+8010747a:	73 f4                	jae    80107470 <memmove+0x20>
+  } else
+    while(n-- > 0)
+      *d++ = *s++;
+
+  return dst;
+}
+8010747c:	5e                   	pop    %esi
+8010747d:	89 d0                	mov    %edx,%eax
+8010747f:	5f                   	pop    %edi
+80107480:	5d                   	pop    %ebp
+80107481:	c3                   	ret
+80107482:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    while(n-- > 0)
+80107488:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+8010748b:	89 d7                	mov    %edx,%edi
+8010748d:	85 c0                	test   %eax,%eax
+8010748f:	74 eb                	je     8010747c <memmove+0x2c>
+80107491:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      *d++ = *s++;
+80107498:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+    while(n-- > 0)
+80107499:	39 ce                	cmp    %ecx,%esi
+8010749b:	75 fb                	jne    80107498 <memmove+0x48>
+}
+8010749d:	5e                   	pop    %esi
+8010749e:	89 d0                	mov    %edx,%eax
+801074a0:	5f                   	pop    %edi
+801074a1:	5d                   	pop    %ebp
+801074a2:	c3                   	ret
+801074a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801074aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801074b0 <memcpy>:
+
+// memcpy exists to placate GCC.  Use memmove.
+void*
+memcpy(void *dst, const void *src, uint n)
+{
+  return memmove(dst, src, n);
+801074b0:	eb 9e                	jmp    80107450 <memmove>
+801074b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801074b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801074c0 <strncmp>:
+}
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+801074c0:	55                   	push   %ebp
+801074c1:	89 e5                	mov    %esp,%ebp
+801074c3:	53                   	push   %ebx
+801074c4:	8b 55 10             	mov    0x10(%ebp),%edx
+801074c7:	8b 45 08             	mov    0x8(%ebp),%eax
+801074ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(n > 0 && *p && *p == *q)
+801074cd:	85 d2                	test   %edx,%edx
+801074cf:	75 16                	jne    801074e7 <strncmp+0x27>
+801074d1:	eb 2d                	jmp    80107500 <strncmp+0x40>
+801074d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801074d7:	90                   	nop
+801074d8:	3a 19                	cmp    (%ecx),%bl
+801074da:	75 12                	jne    801074ee <strncmp+0x2e>
+    n--, p++, q++;
+801074dc:	83 c0 01             	add    $0x1,%eax
+801074df:	83 c1 01             	add    $0x1,%ecx
+  while(n > 0 && *p && *p == *q)
+801074e2:	83 ea 01             	sub    $0x1,%edx
+801074e5:	74 19                	je     80107500 <strncmp+0x40>
+801074e7:	0f b6 18             	movzbl (%eax),%ebx
+801074ea:	84 db                	test   %bl,%bl
+801074ec:	75 ea                	jne    801074d8 <strncmp+0x18>
+  if(n == 0)
+    return 0;
+  return (uchar)*p - (uchar)*q;
+801074ee:	0f b6 00             	movzbl (%eax),%eax
+801074f1:	0f b6 11             	movzbl (%ecx),%edx
+}
+801074f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801074f7:	c9                   	leave
+  return (uchar)*p - (uchar)*q;
+801074f8:	29 d0                	sub    %edx,%eax
+}
+801074fa:	c3                   	ret
+801074fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801074ff:	90                   	nop
+80107500:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+80107503:	31 c0                	xor    %eax,%eax
+}
+80107505:	c9                   	leave
+80107506:	c3                   	ret
+80107507:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010750e:	66 90                	xchg   %ax,%ax
+
+80107510 <strncpy>:
+
+char*
+strncpy(char *s, const char *t, int n)
+{
+80107510:	55                   	push   %ebp
+80107511:	89 e5                	mov    %esp,%ebp
+80107513:	57                   	push   %edi
+80107514:	56                   	push   %esi
+80107515:	53                   	push   %ebx
+80107516:	8b 75 08             	mov    0x8(%ebp),%esi
+80107519:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *os;
+
+  os = s;
+  while(n-- > 0 && (*s++ = *t++) != 0)
+8010751c:	89 f0                	mov    %esi,%eax
+8010751e:	eb 15                	jmp    80107535 <strncpy+0x25>
+80107520:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+80107524:	8b 7d 0c             	mov    0xc(%ebp),%edi
+80107527:	83 c0 01             	add    $0x1,%eax
+8010752a:	0f b6 4f ff          	movzbl -0x1(%edi),%ecx
+8010752e:	88 48 ff             	mov    %cl,-0x1(%eax)
+80107531:	84 c9                	test   %cl,%cl
+80107533:	74 13                	je     80107548 <strncpy+0x38>
+80107535:	89 d3                	mov    %edx,%ebx
+80107537:	83 ea 01             	sub    $0x1,%edx
+8010753a:	85 db                	test   %ebx,%ebx
+8010753c:	7f e2                	jg     80107520 <strncpy+0x10>
+    ;
+  while(n-- > 0)
+    *s++ = 0;
+  return os;
+}
+8010753e:	5b                   	pop    %ebx
+8010753f:	89 f0                	mov    %esi,%eax
+80107541:	5e                   	pop    %esi
+80107542:	5f                   	pop    %edi
+80107543:	5d                   	pop    %ebp
+80107544:	c3                   	ret
+80107545:	8d 76 00             	lea    0x0(%esi),%esi
+  while(n-- > 0)
+80107548:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+8010754b:	83 e9 01             	sub    $0x1,%ecx
+8010754e:	85 d2                	test   %edx,%edx
+80107550:	74 ec                	je     8010753e <strncpy+0x2e>
+80107552:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *s++ = 0;
+80107558:	83 c0 01             	add    $0x1,%eax
+8010755b:	89 ca                	mov    %ecx,%edx
+8010755d:	c6 40 ff 00          	movb   $0x0,-0x1(%eax)
+  while(n-- > 0)
+80107561:	29 c2                	sub    %eax,%edx
+80107563:	85 d2                	test   %edx,%edx
+80107565:	7f f1                	jg     80107558 <strncpy+0x48>
+}
+80107567:	5b                   	pop    %ebx
+80107568:	89 f0                	mov    %esi,%eax
+8010756a:	5e                   	pop    %esi
+8010756b:	5f                   	pop    %edi
+8010756c:	5d                   	pop    %ebp
+8010756d:	c3                   	ret
+8010756e:	66 90                	xchg   %ax,%ax
+
+80107570 <safestrcpy>:
+
+// Like strncpy but guaranteed to NUL-terminate.
+char*
+safestrcpy(char *s, const char *t, int n)
+{
+80107570:	55                   	push   %ebp
+80107571:	89 e5                	mov    %esp,%ebp
+80107573:	56                   	push   %esi
+80107574:	53                   	push   %ebx
+80107575:	8b 55 10             	mov    0x10(%ebp),%edx
+80107578:	8b 75 08             	mov    0x8(%ebp),%esi
+8010757b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  char *os;
+
+  os = s;
+  if(n <= 0)
+8010757e:	85 d2                	test   %edx,%edx
+80107580:	7e 25                	jle    801075a7 <safestrcpy+0x37>
+80107582:	8d 5c 10 ff          	lea    -0x1(%eax,%edx,1),%ebx
+80107586:	89 f2                	mov    %esi,%edx
+80107588:	eb 16                	jmp    801075a0 <safestrcpy+0x30>
+8010758a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return os;
+  while(--n > 0 && (*s++ = *t++) != 0)
+80107590:	0f b6 08             	movzbl (%eax),%ecx
+80107593:	83 c0 01             	add    $0x1,%eax
+80107596:	83 c2 01             	add    $0x1,%edx
+80107599:	88 4a ff             	mov    %cl,-0x1(%edx)
+8010759c:	84 c9                	test   %cl,%cl
+8010759e:	74 04                	je     801075a4 <safestrcpy+0x34>
+801075a0:	39 d8                	cmp    %ebx,%eax
+801075a2:	75 ec                	jne    80107590 <safestrcpy+0x20>
+    ;
+  *s = 0;
+801075a4:	c6 02 00             	movb   $0x0,(%edx)
+  return os;
+}
+801075a7:	89 f0                	mov    %esi,%eax
+801075a9:	5b                   	pop    %ebx
+801075aa:	5e                   	pop    %esi
+801075ab:	5d                   	pop    %ebp
+801075ac:	c3                   	ret
+801075ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+801075b0 <strlen>:
+
+int
+strlen(const char *s)
+{
+801075b0:	55                   	push   %ebp
+  int n;
+
+  for(n = 0; s[n]; n++)
+801075b1:	31 c0                	xor    %eax,%eax
+{
+801075b3:	89 e5                	mov    %esp,%ebp
+801075b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+801075b8:	80 3a 00             	cmpb   $0x0,(%edx)
+801075bb:	74 0c                	je     801075c9 <strlen+0x19>
+801075bd:	8d 76 00             	lea    0x0(%esi),%esi
+801075c0:	83 c0 01             	add    $0x1,%eax
+801075c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+801075c7:	75 f7                	jne    801075c0 <strlen+0x10>
+    ;
+  return n;
+}
+801075c9:	5d                   	pop    %ebp
+801075ca:	c3                   	ret
+
+801075cb <swtch>:
+# a struct context, and save its address in *old.
+# Switch stacks to new and pop previously-saved registers.
+
+.globl swtch
+swtch:
+  movl 4(%esp), %eax
+801075cb:	8b 44 24 04          	mov    0x4(%esp),%eax
+  movl 8(%esp), %edx
+801075cf:	8b 54 24 08          	mov    0x8(%esp),%edx
+
+  # Save old callee-saved registers
+  pushl %ebp
+801075d3:	55                   	push   %ebp
+  pushl %ebx
+801075d4:	53                   	push   %ebx
+  pushl %esi
+801075d5:	56                   	push   %esi
+  pushl %edi
+801075d6:	57                   	push   %edi
+
+  # Switch stacks
+  movl %esp, (%eax)
+801075d7:	89 20                	mov    %esp,(%eax)
+  movl %edx, %esp
+801075d9:	89 d4                	mov    %edx,%esp
+
+  # Load new callee-saved registers
+  popl %edi
+801075db:	5f                   	pop    %edi
+  popl %esi
+801075dc:	5e                   	pop    %esi
+  popl %ebx
+801075dd:	5b                   	pop    %ebx
+  popl %ebp
+801075de:	5d                   	pop    %ebp
+  ret
+801075df:	c3                   	ret
+
+801075e0 <dispatch>:
+[SYS_diskstat] sys_diskstat,
+};
+
+static int
+dispatch(int num)
+{
+801075e0:	55                   	push   %ebp
+801075e1:	89 e5                	mov    %esp,%ebp
+801075e3:	53                   	push   %ebx
+801075e4:	89 c3                	mov    %eax,%ebx
+801075e6:	83 ec 04             	sub    $0x4,%esp
+  struct proc *curproc = myproc();
+801075e9:	e8 02 e0 ff ff       	call   801055f0 <myproc>
+
+  if(num > 0 && num < NELEM(syscalls) && syscalls[num])
+801075ee:	8d 53 ff             	lea    -0x1(%ebx),%edx
+801075f1:	83 fa 23             	cmp    $0x23,%edx
+801075f4:	77 1a                	ja     80107610 <dispatch+0x30>
+801075f6:	8b 14 9d c0 bc 10 80 	mov    -0x7fef4340(,%ebx,4),%edx
+801075fd:	85 d2                	test   %edx,%edx
+801075ff:	74 0f                	je     80107610 <dispatch+0x30>
+    return syscalls[num]();
+  cprintf("%d %s: unknown sys call %d\n",
+          curproc->pid, curproc->name, num);
+  return -1;
+}
+80107601:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107604:	c9                   	leave
+    return syscalls[num]();
+80107605:	ff e2                	jmp    *%edx
+80107607:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010760e:	66 90                	xchg   %ax,%ax
+          curproc->pid, curproc->name, num);
+80107610:	8d 50 74             	lea    0x74(%eax),%edx
+  cprintf("%d %s: unknown sys call %d\n",
+80107613:	53                   	push   %ebx
+80107614:	52                   	push   %edx
+80107615:	ff 70 10             	push   0x10(%eax)
+80107618:	68 a2 bc 10 80       	push   $0x8010bca2
+8010761d:	e8 ce a1 ff ff       	call   801017f0 <cprintf>
+}
+80107622:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return -1;
+80107625:	83 c4 10             	add    $0x10,%esp
+}
+80107628:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010762d:	c9                   	leave
+8010762e:	c3                   	ret
+8010762f:	90                   	nop
+
+80107630 <sys_batch>:
+// replace the trap frame or never return are refused.  Returns
+// the number of calls run; with BATCH_STOPERR the last of those
+// is the first one that failed.
+static int
+sys_batch(void)
+{
+80107630:	55                   	push   %ebp
+80107631:	89 e5                	mov    %esp,%ebp
+80107633:	57                   	push   %edi
+80107634:	56                   	push   %esi
+80107635:	53                   	push   %ebx
+80107636:	83 ec 2c             	sub    $0x2c,%esp
+  struct proc *curproc = myproc();
+80107639:	e8 b2 df ff ff       	call   801055f0 <myproc>
+8010763e:	89 c6                	mov    %eax,%esi
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80107640:	e8 ab df ff ff       	call   801055f0 <myproc>
+80107645:	8b 40 20             	mov    0x20(%eax),%eax
+80107648:	8b 58 44             	mov    0x44(%eax),%ebx
+  struct proc *curproc = myproc();
+8010764b:	e8 a0 df ff ff       	call   801055f0 <myproc>
+  if(addr >= curproc->sz || addr+4 > curproc->sz)
+80107650:	8b 00                	mov    (%eax),%eax
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80107652:	8d 7b 08             	lea    0x8(%ebx),%edi
+  if(addr >= curproc->sz || addr+4 > curproc->sz)
+80107655:	39 c7                	cmp    %eax,%edi
+80107657:	0f 83 33 01 00 00    	jae    80107790 <sys_batch+0x160>
+8010765d:	8d 53 0c             	lea    0xc(%ebx),%edx
+80107660:	39 d0                	cmp    %edx,%eax
+80107662:	0f 82 28 01 00 00    	jb     80107790 <sys_batch+0x160>
+  *ip = *(int*)(addr);
+80107668:	8b 4b 08             	mov    0x8(%ebx),%ecx
+8010766b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+8010766e:	e8 7d df ff ff       	call   801055f0 <myproc>
+80107673:	8b 40 20             	mov    0x20(%eax),%eax
+80107676:	8b 78 44             	mov    0x44(%eax),%edi
+  struct proc *curproc = myproc();
+80107679:	e8 72 df ff ff       	call   801055f0 <myproc>
+  if(addr >= curproc->sz || addr+4 > curproc->sz)
+8010767e:	8b 00                	mov    (%eax),%eax
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80107680:	8d 5f 0c             	lea    0xc(%edi),%ebx
+  if(addr >= curproc->sz || addr+4 > curproc->sz)
+80107683:	39 c3                	cmp    %eax,%ebx
+80107685:	0f 83 05 01 00 00    	jae    80107790 <sys_batch+0x160>
+8010768b:	8d 57 10             	lea    0x10(%edi),%edx
+8010768e:	39 d0                	cmp    %edx,%eax
+80107690:	0f 82 fa 00 00 00    	jb     80107790 <sys_batch+0x160>
+  *ip = *(int*)(addr);
+80107696:	8b 47 0c             	mov    0xc(%edi),%eax
+  struct sysent *ents, *e;
+  int n, flags, i, ret;
+  uint esp;
+
+  if(argint(1, &n) < 0 || argint(2, &flags) < 0 || n < 0 || n > NBATCH)
+80107699:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  *ip = *(int*)(addr);
+8010769c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(argint(1, &n) < 0 || argint(2, &flags) < 0 || n < 0 || n > NBATCH)
+8010769f:	83 f9 40             	cmp    $0x40,%ecx
+801076a2:	0f 87 e8 00 00 00    	ja     80107790 <sys_batch+0x160>
+    return -1;
+  if(argptr(0, (void*)&ents, n*sizeof(*ents)) < 0)
+801076a8:	89 c8                	mov    %ecx,%eax
+801076aa:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+801076ad:	c1 e0 05             	shl    $0x5,%eax
+801076b0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  struct proc *curproc = myproc();
+801076b3:	e8 38 df ff ff       	call   801055f0 <myproc>
+801076b8:	89 c7                	mov    %eax,%edi
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+801076ba:	e8 31 df ff ff       	call   801055f0 <myproc>
+801076bf:	8b 40 20             	mov    0x20(%eax),%eax
+801076c2:	8b 58 44             	mov    0x44(%eax),%ebx
+801076c5:	8d 4b 04             	lea    0x4(%ebx),%ecx
+801076c8:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  struct proc *curproc = myproc();
+801076cb:	e8 20 df ff ff       	call   801055f0 <myproc>
+  if(addr >= curproc->sz || addr+4 > curproc->sz)
+801076d0:	8b 00                	mov    (%eax),%eax
+801076d2:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+801076d5:	0f 83 b5 00 00 00    	jae    80107790 <sys_batch+0x160>
+801076db:	8d 53 08             	lea    0x8(%ebx),%edx
+801076de:	39 d0                	cmp    %edx,%eax
+801076e0:	0f 82 aa 00 00 00    	jb     80107790 <sys_batch+0x160>
+  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+801076e6:	8b 07                	mov    (%edi),%eax
+801076e8:	8b 5b 04             	mov    0x4(%ebx),%ebx
+801076eb:	39 c3                	cmp    %eax,%ebx
+801076ed:	0f 83 9d 00 00 00    	jae    80107790 <sys_batch+0x160>
+801076f3:	8b 55 dc             	mov    -0x24(%ebp),%edx
+801076f6:	01 da                	add    %ebx,%edx
+801076f8:	39 d0                	cmp    %edx,%eax
+801076fa:	0f 82 90 00 00 00    	jb     80107790 <sys_batch+0x160>
+    return -1;
+
+  esp = curproc->tf->esp;
+80107700:	8b 46 20             	mov    0x20(%esi),%eax
+  for(i = 0; i < n && !curproc->killed; i++){
+80107703:	31 d2                	xor    %edx,%edx
+  esp = curproc->tf->esp;
+80107705:	8b 48 44             	mov    0x44(%eax),%ecx
+    }
+    // sbrk() may have shrunk the process out from under ents.
+    if((uint)(e+1) > curproc->sz)
+      return i + 1;
+    e->ret = ret;
+    if(ret < 0 && (flags & BATCH_STOPERR))
+80107708:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  esp = curproc->tf->esp;
+8010770b:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  for(i = 0; i < n && !curproc->killed; i++){
+8010770e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    if(ret < 0 && (flags & BATCH_STOPERR))
+80107711:	83 e0 01             	and    $0x1,%eax
+80107714:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  for(i = 0; i < n && !curproc->killed; i++){
+80107717:	85 c9                	test   %ecx,%ecx
+80107719:	74 68                	je     80107783 <sys_batch+0x153>
+8010771b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+8010771e:	eb 33                	jmp    80107753 <sys_batch+0x123>
+      curproc->tf->esp = (uint)&e->num;
+80107720:	8b 46 20             	mov    0x20(%esi),%eax
+80107723:	89 55 e0             	mov    %edx,-0x20(%ebp)
+80107726:	89 58 44             	mov    %ebx,0x44(%eax)
+      ret = dispatch(e->num);
+80107729:	8b 03                	mov    (%ebx),%eax
+8010772b:	e8 b0 fe ff ff       	call   801075e0 <dispatch>
+      curproc->tf->esp = esp;
+80107730:	8b 55 d8             	mov    -0x28(%ebp),%edx
+80107733:	8b 4e 20             	mov    0x20(%esi),%ecx
+80107736:	89 51 44             	mov    %edx,0x44(%ecx)
+    if((uint)(e+1) > curproc->sz)
+80107739:	39 3e                	cmp    %edi,(%esi)
+8010773b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+8010773e:	72 40                	jb     80107780 <sys_batch+0x150>
+    e->ret = ret;
+80107740:	89 43 1c             	mov    %eax,0x1c(%ebx)
+    if(ret < 0 && (flags & BATCH_STOPERR))
+80107743:	85 c0                	test   %eax,%eax
+80107745:	78 32                	js     80107779 <sys_batch+0x149>
+  for(i = 0; i < n && !curproc->killed; i++){
+80107747:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010774a:	83 c2 01             	add    $0x1,%edx
+8010774d:	39 c2                	cmp    %eax,%edx
+8010774f:	74 32                	je     80107783 <sys_batch+0x153>
+80107751:	89 fb                	mov    %edi,%ebx
+80107753:	8b 46 2c             	mov    0x2c(%esi),%eax
+80107756:	85 c0                	test   %eax,%eax
+80107758:	75 29                	jne    80107783 <sys_batch+0x153>
+    if((uint)(e+1) > curproc->sz)
+8010775a:	8d 7b 20             	lea    0x20(%ebx),%edi
+8010775d:	39 3e                	cmp    %edi,(%esi)
+8010775f:	72 22                	jb     80107783 <sys_batch+0x153>
+    switch(e->num){
+80107761:	8b 03                	mov    (%ebx),%eax
+80107763:	83 f8 1c             	cmp    $0x1c,%eax
+80107766:	77 b8                	ja     80107720 <sys_batch+0xf0>
+80107768:	b9 86 00 00 10       	mov    $0x10000086,%ecx
+8010776d:	0f a3 c1             	bt     %eax,%ecx
+80107770:	73 ae                	jae    80107720 <sys_batch+0xf0>
+    e->ret = ret;
+80107772:	c7 43 1c ff ff ff ff 	movl   $0xffffffff,0x1c(%ebx)
+    if(ret < 0 && (flags & BATCH_STOPERR))
+80107779:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+8010777c:	85 c9                	test   %ecx,%ecx
+8010777e:	74 c7                	je     80107747 <sys_batch+0x117>
+      return i + 1;
+80107780:	83 c2 01             	add    $0x1,%edx
+  }
+  return i;
+}
+80107783:	83 c4 2c             	add    $0x2c,%esp
+80107786:	89 d0                	mov    %edx,%eax
+80107788:	5b                   	pop    %ebx
+80107789:	5e                   	pop    %esi
+8010778a:	5f                   	pop    %edi
+8010778b:	5d                   	pop    %ebp
+8010778c:	c3                   	ret
+8010778d:	8d 76 00             	lea    0x0(%esi),%esi
+80107790:	83 c4 2c             	add    $0x2c,%esp
+    return -1;
+80107793:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+}
+80107798:	5b                   	pop    %ebx
+80107799:	89 d0                	mov    %edx,%eax
+8010779b:	5e                   	pop    %esi
+8010779c:	5f                   	pop    %edi
+8010779d:	5d                   	pop    %ebp
+8010779e:	c3                   	ret
+8010779f:	90                   	nop
+
+801077a0 <fetchint>:
+{
+801077a0:	55                   	push   %ebp
+801077a1:	89 e5                	mov    %esp,%ebp
+801077a3:	53                   	push   %ebx
+801077a4:	83 ec 04             	sub    $0x4,%esp
+801077a7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *curproc = myproc();
+801077aa:	e8 41 de ff ff       	call   801055f0 <myproc>
+  if(addr >= curproc->sz || addr+4 > curproc->sz)
+801077af:	8b 00                	mov    (%eax),%eax
+801077b1:	39 c3                	cmp    %eax,%ebx
+801077b3:	73 1b                	jae    801077d0 <fetchint+0x30>
+801077b5:	8d 53 04             	lea    0x4(%ebx),%edx
+801077b8:	39 d0                	cmp    %edx,%eax
+801077ba:	72 14                	jb     801077d0 <fetchint+0x30>
+  *ip = *(int*)(addr);
+801077bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+801077bf:	8b 13                	mov    (%ebx),%edx
+801077c1:	89 10                	mov    %edx,(%eax)
+  return 0;
+801077c3:	31 c0                	xor    %eax,%eax
+}
+801077c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801077c8:	c9                   	leave
+801077c9:	c3                   	ret
+801077ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+801077d0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801077d5:	eb ee                	jmp    801077c5 <fetchint+0x25>
+801077d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801077de:	66 90                	xchg   %ax,%ax
+
+801077e0 <fetchstr>:
+{
+801077e0:	55                   	push   %ebp
+801077e1:	89 e5                	mov    %esp,%ebp
+801077e3:	53                   	push   %ebx
+801077e4:	83 ec 04             	sub    $0x4,%esp
+801077e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *curproc = myproc();
+801077ea:	e8 01 de ff ff       	call   801055f0 <myproc>
+  if(addr >= curproc->sz)
+801077ef:	3b 18                	cmp    (%eax),%ebx
+801077f1:	73 2d                	jae    80107820 <fetchstr+0x40>
+  *pp = (char*)addr;
+801077f3:	8b 55 0c             	mov    0xc(%ebp),%edx
+801077f6:	89 1a                	mov    %ebx,(%edx)
+  ep = (char*)curproc->sz;
+801077f8:	8b 10                	mov    (%eax),%edx
+  for(s = *pp; s < ep; s++){
+801077fa:	39 d3                	cmp    %edx,%ebx
+801077fc:	73 22                	jae    80107820 <fetchstr+0x40>
+801077fe:	89 d8                	mov    %ebx,%eax
+80107800:	eb 0d                	jmp    8010780f <fetchstr+0x2f>
+80107802:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80107808:	83 c0 01             	add    $0x1,%eax
+8010780b:	39 d0                	cmp    %edx,%eax
+8010780d:	73 11                	jae    80107820 <fetchstr+0x40>
+    if(*s == 0)
+8010780f:	80 38 00             	cmpb   $0x0,(%eax)
+80107812:	75 f4                	jne    80107808 <fetchstr+0x28>
+      return s - *pp;
+80107814:	29 d8                	sub    %ebx,%eax
+}
+80107816:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107819:	c9                   	leave
+8010781a:	c3                   	ret
+8010781b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010781f:	90                   	nop
+80107820:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return -1;
+80107823:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80107828:	c9                   	leave
+80107829:	c3                   	ret
+8010782a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107830 <argint>:
+{
+80107830:	55                   	push   %ebp
+80107831:	89 e5                	mov    %esp,%ebp
+80107833:	56                   	push   %esi
+80107834:	53                   	push   %ebx
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80107835:	e8 b6 dd ff ff       	call   801055f0 <myproc>
+8010783a:	8b 55 08             	mov    0x8(%ebp),%edx
+8010783d:	8b 40 20             	mov    0x20(%eax),%eax
+80107840:	8b 40 44             	mov    0x44(%eax),%eax
+80107843:	8d 1c 90             	lea    (%eax,%edx,4),%ebx
+  struct proc *curproc = myproc();
+80107846:	e8 a5 dd ff ff       	call   801055f0 <myproc>
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+8010784b:	8d 73 04             	lea    0x4(%ebx),%esi
+  if(addr >= curproc->sz || addr+4 > curproc->sz)
+8010784e:	8b 00                	mov    (%eax),%eax
+80107850:	39 c6                	cmp    %eax,%esi
+80107852:	73 1c                	jae    80107870 <argint+0x40>
+80107854:	8d 53 08             	lea    0x8(%ebx),%edx
+80107857:	39 d0                	cmp    %edx,%eax
+80107859:	72 15                	jb     80107870 <argint+0x40>
+  *ip = *(int*)(addr);
+8010785b:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010785e:	8b 53 04             	mov    0x4(%ebx),%edx
+80107861:	89 10                	mov    %edx,(%eax)
+  return 0;
+80107863:	31 c0                	xor    %eax,%eax
+}
+80107865:	5b                   	pop    %ebx
+80107866:	5e                   	pop    %esi
+80107867:	5d                   	pop    %ebp
+80107868:	c3                   	ret
+80107869:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+80107870:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80107875:	eb ee                	jmp    80107865 <argint+0x35>
+80107877:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010787e:	66 90                	xchg   %ax,%ax
+
+80107880 <argptr>:
+{
+80107880:	55                   	push   %ebp
+80107881:	89 e5                	mov    %esp,%ebp
+80107883:	57                   	push   %edi
+80107884:	56                   	push   %esi
+80107885:	53                   	push   %ebx
+80107886:	83 ec 0c             	sub    $0xc,%esp
+  struct proc *curproc = myproc();
+80107889:	e8 62 dd ff ff       	call   801055f0 <myproc>
+8010788e:	89 c6                	mov    %eax,%esi
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80107890:	e8 5b dd ff ff       	call   801055f0 <myproc>
+80107895:	8b 55 08             	mov    0x8(%ebp),%edx
+80107898:	8b 40 20             	mov    0x20(%eax),%eax
+8010789b:	8b 40 44             	mov    0x44(%eax),%eax
+8010789e:	8d 1c 90             	lea    (%eax,%edx,4),%ebx
+  struct proc *curproc = myproc();
+801078a1:	e8 4a dd ff ff       	call   801055f0 <myproc>
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+801078a6:	8d 7b 04             	lea    0x4(%ebx),%edi
+  if(addr >= curproc->sz || addr+4 > curproc->sz)
+801078a9:	8b 00                	mov    (%eax),%eax
+801078ab:	39 c7                	cmp    %eax,%edi
+801078ad:	73 31                	jae    801078e0 <argptr+0x60>
+801078af:	8d 4b 08             	lea    0x8(%ebx),%ecx
+801078b2:	39 c8                	cmp    %ecx,%eax
+801078b4:	72 2a                	jb     801078e0 <argptr+0x60>
+  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+801078b6:	8b 55 10             	mov    0x10(%ebp),%edx
+  *ip = *(int*)(addr);
+801078b9:	8b 43 04             	mov    0x4(%ebx),%eax
+  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+801078bc:	85 d2                	test   %edx,%edx
+801078be:	78 20                	js     801078e0 <argptr+0x60>
+801078c0:	8b 16                	mov    (%esi),%edx
+801078c2:	39 d0                	cmp    %edx,%eax
+801078c4:	73 1a                	jae    801078e0 <argptr+0x60>
+801078c6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+801078c9:	01 c3                	add    %eax,%ebx
+801078cb:	39 da                	cmp    %ebx,%edx
+801078cd:	72 11                	jb     801078e0 <argptr+0x60>
+  *pp = (char*)i;
+801078cf:	8b 55 0c             	mov    0xc(%ebp),%edx
+801078d2:	89 02                	mov    %eax,(%edx)
+  return 0;
+801078d4:	31 c0                	xor    %eax,%eax
+}
+801078d6:	83 c4 0c             	add    $0xc,%esp
+801078d9:	5b                   	pop    %ebx
+801078da:	5e                   	pop    %esi
+801078db:	5f                   	pop    %edi
+801078dc:	5d                   	pop    %ebp
+801078dd:	c3                   	ret
+801078de:	66 90                	xchg   %ax,%ax
+    return -1;
+801078e0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801078e5:	eb ef                	jmp    801078d6 <argptr+0x56>
+801078e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801078ee:	66 90                	xchg   %ax,%ax
+
+801078f0 <argstr>:
+{
+801078f0:	55                   	push   %ebp
+801078f1:	89 e5                	mov    %esp,%ebp
+801078f3:	56                   	push   %esi
+801078f4:	53                   	push   %ebx
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+801078f5:	e8 f6 dc ff ff       	call   801055f0 <myproc>
+801078fa:	8b 55 08             	mov    0x8(%ebp),%edx
+801078fd:	8b 40 20             	mov    0x20(%eax),%eax
+80107900:	8b 40 44             	mov    0x44(%eax),%eax
+80107903:	8d 1c 90             	lea    (%eax,%edx,4),%ebx
+  struct proc *curproc = myproc();
+80107906:	e8 e5 dc ff ff       	call   801055f0 <myproc>
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+8010790b:	8d 73 04             	lea    0x4(%ebx),%esi
+  if(addr >= curproc->sz || addr+4 > curproc->sz)
+8010790e:	8b 00                	mov    (%eax),%eax
+80107910:	39 c6                	cmp    %eax,%esi
+80107912:	73 44                	jae    80107958 <argstr+0x68>
+80107914:	8d 53 08             	lea    0x8(%ebx),%edx
+80107917:	39 d0                	cmp    %edx,%eax
+80107919:	72 3d                	jb     80107958 <argstr+0x68>
+  *ip = *(int*)(addr);
+8010791b:	8b 5b 04             	mov    0x4(%ebx),%ebx
+  struct proc *curproc = myproc();
+8010791e:	e8 cd dc ff ff       	call   801055f0 <myproc>
+  if(addr >= curproc->sz)
+80107923:	3b 18                	cmp    (%eax),%ebx
+80107925:	73 31                	jae    80107958 <argstr+0x68>
+  *pp = (char*)addr;
+80107927:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010792a:	89 1a                	mov    %ebx,(%edx)
+  ep = (char*)curproc->sz;
+8010792c:	8b 10                	mov    (%eax),%edx
+  for(s = *pp; s < ep; s++){
+8010792e:	39 d3                	cmp    %edx,%ebx
+80107930:	73 26                	jae    80107958 <argstr+0x68>
+80107932:	89 d8                	mov    %ebx,%eax
+80107934:	eb 11                	jmp    80107947 <argstr+0x57>
+80107936:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010793d:	8d 76 00             	lea    0x0(%esi),%esi
+80107940:	83 c0 01             	add    $0x1,%eax
+80107943:	39 d0                	cmp    %edx,%eax
+80107945:	73 11                	jae    80107958 <argstr+0x68>
+    if(*s == 0)
+80107947:	80 38 00             	cmpb   $0x0,(%eax)
+8010794a:	75 f4                	jne    80107940 <argstr+0x50>
+      return s - *pp;
+8010794c:	29 d8                	sub    %ebx,%eax
+}
+8010794e:	5b                   	pop    %ebx
+8010794f:	5e                   	pop    %esi
+80107950:	5d                   	pop    %ebp
+80107951:	c3                   	ret
+80107952:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80107958:	5b                   	pop    %ebx
+    return -1;
+80107959:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010795e:	5e                   	pop    %esi
+8010795f:	5d                   	pop    %ebp
+80107960:	c3                   	ret
+80107961:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107968:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010796f:	90                   	nop
+
+80107970 <syscall>:
+{
+80107970:	55                   	push   %ebp
+80107971:	89 e5                	mov    %esp,%ebp
+80107973:	53                   	push   %ebx
+80107974:	83 ec 04             	sub    $0x4,%esp
+  struct proc *curproc = myproc();
+80107977:	e8 74 dc ff ff       	call   801055f0 <myproc>
+8010797c:	89 c3                	mov    %eax,%ebx
+  curproc->tf->eax = dispatch(curproc->tf->eax);
+8010797e:	8b 40 20             	mov    0x20(%eax),%eax
+80107981:	8b 40 1c             	mov    0x1c(%eax),%eax
+80107984:	e8 57 fc ff ff       	call   801075e0 <dispatch>
+80107989:	89 c2                	mov    %eax,%edx
+8010798b:	8b 43 20             	mov    0x20(%ebx),%eax
+8010798e:	89 50 1c             	mov    %edx,0x1c(%eax)
+}
+80107991:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107994:	c9                   	leave
+80107995:	c3                   	ret
+80107996:	66 90                	xchg   %ax,%ax
+80107998:	66 90                	xchg   %ax,%ax
+8010799a:	66 90                	xchg   %ax,%ax
+8010799c:	66 90                	xchg   %ax,%ax
+8010799e:	66 90                	xchg   %ax,%ax
+
+801079a0 <create>:
+  return -1;
+}
+
+static struct inode*
+create(char *path, short type, short major, short minor)
+{
+801079a0:	55                   	push   %ebp
+801079a1:	89 e5                	mov    %esp,%ebp
+801079a3:	57                   	push   %edi
+801079a4:	56                   	push   %esi
+  struct inode *ip, *dp;
+  char name[DIRSIZ];
+
+  if((dp = nameiparent(path, name)) == 0)
+801079a5:	8d 7d da             	lea    -0x26(%ebp),%edi
+{
+801079a8:	53                   	push   %ebx
+801079a9:	83 ec 34             	sub    $0x34,%esp
+801079ac:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+801079af:	8b 4d 08             	mov    0x8(%ebp),%ecx
+801079b2:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+801079b5:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if((dp = nameiparent(path, name)) == 0)
+801079b8:	57                   	push   %edi
+801079b9:	50                   	push   %eax
+801079ba:	e8 01 bd ff ff       	call   801036c0 <nameiparent>
+801079bf:	83 c4 10             	add    $0x10,%esp
+801079c2:	85 c0                	test   %eax,%eax
+801079c4:	74 5e                	je     80107a24 <create+0x84>
+    return 0;
+  ilock(dp);
+801079c6:	83 ec 0c             	sub    $0xc,%esp
+801079c9:	89 c3                	mov    %eax,%ebx
+801079cb:	50                   	push   %eax
+801079cc:	e8 1f b2 ff ff       	call   80102bf0 <ilock>
+
+  if((ip = dirlookup(dp, name, 0)) != 0){
+801079d1:	83 c4 0c             	add    $0xc,%esp
+801079d4:	6a 00                	push   $0x0
+801079d6:	57                   	push   %edi
+801079d7:	53                   	push   %ebx
+801079d8:	e8 b3 b8 ff ff       	call   80103290 <dirlookup>
+801079dd:	83 c4 10             	add    $0x10,%esp
+801079e0:	89 c6                	mov    %eax,%esi
+801079e2:	85 c0                	test   %eax,%eax
+801079e4:	74 4a                	je     80107a30 <create+0x90>
+    iunlockput(dp);
+801079e6:	83 ec 0c             	sub    $0xc,%esp
+801079e9:	53                   	push   %ebx
+801079ea:	e8 21 b5 ff ff       	call   80102f10 <iunlockput>
+    ilock(ip);
+801079ef:	89 34 24             	mov    %esi,(%esp)
+801079f2:	e8 f9 b1 ff ff       	call   80102bf0 <ilock>
+    if(type == T_FILE && ip->type == T_FILE)
+801079f7:	83 c4 10             	add    $0x10,%esp
+801079fa:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+801079ff:	75 17                	jne    80107a18 <create+0x78>
+80107a01:	66 83 be 8c 00 00 00 	cmpw   $0x2,0x8c(%esi)
+80107a08:	02 
+80107a09:	75 0d                	jne    80107a18 <create+0x78>
+    panic("create: dirlink");
+
+  iunlockput(dp);
+
+  return ip;
+}
+80107a0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107a0e:	89 f0                	mov    %esi,%eax
+80107a10:	5b                   	pop    %ebx
+80107a11:	5e                   	pop    %esi
+80107a12:	5f                   	pop    %edi
+80107a13:	5d                   	pop    %ebp
+80107a14:	c3                   	ret
+80107a15:	8d 76 00             	lea    0x0(%esi),%esi
+    iunlockput(ip);
+80107a18:	83 ec 0c             	sub    $0xc,%esp
+80107a1b:	56                   	push   %esi
+80107a1c:	e8 ef b4 ff ff       	call   80102f10 <iunlockput>
+    return 0;
+80107a21:	83 c4 10             	add    $0x10,%esp
+}
+80107a24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+80107a27:	31 f6                	xor    %esi,%esi
+}
+80107a29:	5b                   	pop    %ebx
+80107a2a:	89 f0                	mov    %esi,%eax
+80107a2c:	5e                   	pop    %esi
+80107a2d:	5f                   	pop    %edi
+80107a2e:	5d                   	pop    %ebp
+80107a2f:	c3                   	ret
+  if((ip = ialloc(dp->dev, type)) == 0)
+80107a30:	0f bf 45 d4          	movswl -0x2c(%ebp),%eax
+80107a34:	83 ec 08             	sub    $0x8,%esp
+80107a37:	50                   	push   %eax
+80107a38:	ff 33                	push   (%ebx)
+80107a3a:	e8 31 b0 ff ff       	call   80102a70 <ialloc>
+80107a3f:	83 c4 10             	add    $0x10,%esp
+80107a42:	89 c6                	mov    %eax,%esi
+80107a44:	85 c0                	test   %eax,%eax
+80107a46:	0f 84 c7 00 00 00    	je     80107b13 <create+0x173>
+  ilock(ip);
+80107a4c:	83 ec 0c             	sub    $0xc,%esp
+80107a4f:	50                   	push   %eax
+80107a50:	e8 9b b1 ff ff       	call   80102bf0 <ilock>
+  ip->major = major;
+80107a55:	0f b7 45 d0          	movzwl -0x30(%ebp),%eax
+80107a59:	66 89 86 8e 00 00 00 	mov    %ax,0x8e(%esi)
+  ip->minor = minor;
+80107a60:	0f b7 45 cc          	movzwl -0x34(%ebp),%eax
+80107a64:	66 89 86 90 00 00 00 	mov    %ax,0x90(%esi)
+  ip->nlink = 1;
+80107a6b:	b8 01 00 00 00       	mov    $0x1,%eax
+80107a70:	66 89 86 92 00 00 00 	mov    %ax,0x92(%esi)
+  iupdate(ip);
+80107a77:	89 34 24             	mov    %esi,(%esp)
+80107a7a:	e8 b1 b0 ff ff       	call   80102b30 <iupdate>
+  if(type == T_DIR){  // Create . and .. entries.
+80107a7f:	83 c4 10             	add    $0x10,%esp
+80107a82:	66 83 7d d4 01       	cmpw   $0x1,-0x2c(%ebp)
+80107a87:	74 2f                	je     80107ab8 <create+0x118>
+  if(dirlink(dp, name, ip->inum) < 0)
+80107a89:	83 ec 04             	sub    $0x4,%esp
+80107a8c:	ff 76 04             	push   0x4(%esi)
+80107a8f:	57                   	push   %edi
+80107a90:	53                   	push   %ebx
+80107a91:	e8 4a bb ff ff       	call   801035e0 <dirlink>
+80107a96:	83 c4 10             	add    $0x10,%esp
+80107a99:	85 c0                	test   %eax,%eax
+80107a9b:	78 69                	js     80107b06 <create+0x166>
+  iunlockput(dp);
+80107a9d:	83 ec 0c             	sub    $0xc,%esp
+80107aa0:	53                   	push   %ebx
+80107aa1:	e8 6a b4 ff ff       	call   80102f10 <iunlockput>
+  return ip;
+80107aa6:	83 c4 10             	add    $0x10,%esp
+}
+80107aa9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107aac:	89 f0                	mov    %esi,%eax
+80107aae:	5b                   	pop    %ebx
+80107aaf:	5e                   	pop    %esi
+80107ab0:	5f                   	pop    %edi
+80107ab1:	5d                   	pop    %ebp
+80107ab2:	c3                   	ret
+80107ab3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107ab7:	90                   	nop
+    iupdate(dp);
+80107ab8:	83 ec 0c             	sub    $0xc,%esp
+    dp->nlink++;  // for ".."
+80107abb:	66 83 83 92 00 00 00 	addw   $0x1,0x92(%ebx)
+80107ac2:	01 
+    iupdate(dp);
+80107ac3:	53                   	push   %ebx
+80107ac4:	e8 67 b0 ff ff       	call   80102b30 <iupdate>
+    if(dirlink(ip, ".", ip->inum) < 0 || dirlink(ip, "..", dp->inum) < 0)
+80107ac9:	83 c4 0c             	add    $0xc,%esp
+80107acc:	ff 76 04             	push   0x4(%esi)
+80107acf:	68 70 bd 10 80       	push   $0x8010bd70
+80107ad4:	56                   	push   %esi
+80107ad5:	e8 06 bb ff ff       	call   801035e0 <dirlink>
+80107ada:	83 c4 10             	add    $0x10,%esp
+80107add:	85 c0                	test   %eax,%eax
+80107adf:	78 18                	js     80107af9 <create+0x159>
+80107ae1:	83 ec 04             	sub    $0x4,%esp
+80107ae4:	ff 73 04             	push   0x4(%ebx)
+80107ae7:	68 6f bd 10 80       	push   $0x8010bd6f
+80107aec:	56                   	push   %esi
+80107aed:	e8 ee ba ff ff       	call   801035e0 <dirlink>
+80107af2:	83 c4 10             	add    $0x10,%esp
+80107af5:	85 c0                	test   %eax,%eax
+80107af7:	79 90                	jns    80107a89 <create+0xe9>
+      panic("create dots");
+80107af9:	83 ec 0c             	sub    $0xc,%esp
+80107afc:	68 63 bd 10 80       	push   $0x8010bd63
+80107b01:	e8 ba 99 ff ff       	call   801014c0 <panic>
+    panic("create: dirlink");
+80107b06:	83 ec 0c             	sub    $0xc,%esp
+80107b09:	68 72 bd 10 80       	push   $0x8010bd72
+80107b0e:	e8 ad 99 ff ff       	call   801014c0 <panic>
+    panic("create: ialloc");
+80107b13:	83 ec 0c             	sub    $0xc,%esp
+80107b16:	68 54 bd 10 80       	push   $0x8010bd54
+80107b1b:	e8 a0 99 ff ff       	call   801014c0 <panic>
+
+80107b20 <fetchargv>:
+
+// Fetch the null-terminated argument vector at user address
+// uargv into argv[MAXARG].
+static int
+fetchargv(uint uargv, char **argv)
+{
+80107b20:	55                   	push   %ebp
+80107b21:	89 e5                	mov    %esp,%ebp
+80107b23:	57                   	push   %edi
+80107b24:	89 c7                	mov    %eax,%edi
+80107b26:	56                   	push   %esi
+80107b27:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+80107b2a:	53                   	push   %ebx
+80107b2b:	89 d3                	mov    %edx,%ebx
+    if(i >= MAXARG)
+      return -1;
+    if(fetchint(uargv+4*i, (int*)&uarg) < 0)
+      return -1;
+    if(uarg == 0){
+      argv[i] = 0;
+80107b2d:	29 fb                	sub    %edi,%ebx
+{
+80107b2f:	83 ec 30             	sub    $0x30,%esp
+  memset(argv, 0, MAXARG*sizeof(argv[0]));
+80107b32:	68 80 00 00 00       	push   $0x80
+80107b37:	6a 00                	push   $0x0
+80107b39:	52                   	push   %edx
+80107b3a:	e8 81 f8 ff ff       	call   801073c0 <memset>
+    if(i >= MAXARG)
+80107b3f:	8d 87 80 00 00 00    	lea    0x80(%edi),%eax
+80107b45:	83 c4 10             	add    $0x10,%esp
+80107b48:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+80107b4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107b4f:	90                   	nop
+    if(fetchint(uargv+4*i, (int*)&uarg) < 0)
+80107b50:	83 ec 08             	sub    $0x8,%esp
+80107b53:	56                   	push   %esi
+80107b54:	57                   	push   %edi
+80107b55:	e8 46 fc ff ff       	call   801077a0 <fetchint>
+80107b5a:	83 c4 10             	add    $0x10,%esp
+80107b5d:	85 c0                	test   %eax,%eax
+80107b5f:	78 23                	js     80107b84 <fetchargv+0x64>
+    if(uarg == 0){
+80107b61:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      argv[i] = 0;
+80107b64:	8d 14 3b             	lea    (%ebx,%edi,1),%edx
+    if(uarg == 0){
+80107b67:	85 c0                	test   %eax,%eax
+80107b69:	74 2d                	je     80107b98 <fetchargv+0x78>
+      break;
+    }
+    if(fetchstr(uarg, &argv[i]) < 0)
+80107b6b:	83 ec 08             	sub    $0x8,%esp
+80107b6e:	52                   	push   %edx
+80107b6f:	50                   	push   %eax
+80107b70:	e8 6b fc ff ff       	call   801077e0 <fetchstr>
+80107b75:	83 c4 10             	add    $0x10,%esp
+80107b78:	85 c0                	test   %eax,%eax
+80107b7a:	78 08                	js     80107b84 <fetchargv+0x64>
+    if(i >= MAXARG)
+80107b7c:	83 c7 04             	add    $0x4,%edi
+80107b7f:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+80107b82:	75 cc                	jne    80107b50 <fetchargv+0x30>
+      return -1;
+  }
+  return 0;
+}
+80107b84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+80107b87:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80107b8c:	5b                   	pop    %ebx
+80107b8d:	5e                   	pop    %esi
+80107b8e:	5f                   	pop    %edi
+80107b8f:	5d                   	pop    %ebp
+80107b90:	c3                   	ret
+80107b91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      argv[i] = 0;
+80107b98:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+}
+80107b9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107ba1:	5b                   	pop    %ebx
+80107ba2:	5e                   	pop    %esi
+80107ba3:	5f                   	pop    %edi
+80107ba4:	5d                   	pop    %ebp
+80107ba5:	c3                   	ret
+80107ba6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107bad:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107bb0 <sys_dup>:
+{
+80107bb0:	55                   	push   %ebp
+80107bb1:	89 e5                	mov    %esp,%ebp
+80107bb3:	56                   	push   %esi
+80107bb4:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80107bb5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80107bb8:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80107bbb:	50                   	push   %eax
+80107bbc:	6a 00                	push   $0x0
+80107bbe:	e8 6d fc ff ff       	call   80107830 <argint>
+80107bc3:	83 c4 10             	add    $0x10,%esp
+80107bc6:	85 c0                	test   %eax,%eax
+80107bc8:	78 36                	js     80107c00 <sys_dup+0x50>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80107bca:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80107bce:	77 30                	ja     80107c00 <sys_dup+0x50>
+80107bd0:	e8 1b da ff ff       	call   801055f0 <myproc>
+80107bd5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80107bd8:	8b 74 90 30          	mov    0x30(%eax,%edx,4),%esi
+80107bdc:	85 f6                	test   %esi,%esi
+80107bde:	74 20                	je     80107c00 <sys_dup+0x50>
+  struct proc *curproc = myproc();
+80107be0:	e8 0b da ff ff       	call   801055f0 <myproc>
+  for(fd = 0; fd < NOFILE; fd++){
+80107be5:	31 db                	xor    %ebx,%ebx
+80107be7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107bee:	66 90                	xchg   %ax,%ax
+    if(curproc->ofile[fd] == 0){
+80107bf0:	8b 54 98 30          	mov    0x30(%eax,%ebx,4),%edx
+80107bf4:	85 d2                	test   %edx,%edx
+80107bf6:	74 18                	je     80107c10 <sys_dup+0x60>
+  for(fd = 0; fd < NOFILE; fd++){
+80107bf8:	83 c3 01             	add    $0x1,%ebx
+80107bfb:	83 fb 10             	cmp    $0x10,%ebx
+80107bfe:	75 f0                	jne    80107bf0 <sys_dup+0x40>
+}
+80107c00:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return -1;
+80107c03:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+}
+80107c08:	89 d8                	mov    %ebx,%eax
+80107c0a:	5b                   	pop    %ebx
+80107c0b:	5e                   	pop    %esi
+80107c0c:	5d                   	pop    %ebp
+80107c0d:	c3                   	ret
+80107c0e:	66 90                	xchg   %ax,%ax
+  filedup(f);
+80107c10:	83 ec 0c             	sub    $0xc,%esp
+      curproc->ofile[fd] = f;
+80107c13:	89 74 98 30          	mov    %esi,0x30(%eax,%ebx,4)
+  filedup(f);
+80107c17:	56                   	push   %esi
+80107c18:	e8 e3 a5 ff ff       	call   80102200 <filedup>
+  return fd;
+80107c1d:	83 c4 10             	add    $0x10,%esp
+}
+80107c20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107c23:	89 d8                	mov    %ebx,%eax
+80107c25:	5b                   	pop    %ebx
+80107c26:	5e                   	pop    %esi
+80107c27:	5d                   	pop    %ebp
+80107c28:	c3                   	ret
+80107c29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80107c30 <sys_read>:
+{
+80107c30:	55                   	push   %ebp
+80107c31:	89 e5                	mov    %esp,%ebp
+80107c33:	56                   	push   %esi
+80107c34:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80107c35:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+80107c38:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80107c3b:	53                   	push   %ebx
+80107c3c:	6a 00                	push   $0x0
+80107c3e:	e8 ed fb ff ff       	call   80107830 <argint>
+80107c43:	83 c4 10             	add    $0x10,%esp
+80107c46:	85 c0                	test   %eax,%eax
+80107c48:	78 5e                	js     80107ca8 <sys_read+0x78>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80107c4a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80107c4e:	77 58                	ja     80107ca8 <sys_read+0x78>
+80107c50:	e8 9b d9 ff ff       	call   801055f0 <myproc>
+80107c55:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80107c58:	8b 74 90 30          	mov    0x30(%eax,%edx,4),%esi
+80107c5c:	85 f6                	test   %esi,%esi
+80107c5e:	74 48                	je     80107ca8 <sys_read+0x78>
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+80107c60:	83 ec 08             	sub    $0x8,%esp
+80107c63:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80107c66:	50                   	push   %eax
+80107c67:	6a 02                	push   $0x2
+80107c69:	e8 c2 fb ff ff       	call   80107830 <argint>
+80107c6e:	83 c4 10             	add    $0x10,%esp
+80107c71:	85 c0                	test   %eax,%eax
+80107c73:	78 33                	js     80107ca8 <sys_read+0x78>
+80107c75:	83 ec 04             	sub    $0x4,%esp
+80107c78:	ff 75 f0             	push   -0x10(%ebp)
+80107c7b:	53                   	push   %ebx
+80107c7c:	6a 01                	push   $0x1
+80107c7e:	e8 fd fb ff ff       	call   80107880 <argptr>
+80107c83:	83 c4 10             	add    $0x10,%esp
+80107c86:	85 c0                	test   %eax,%eax
+80107c88:	78 1e                	js     80107ca8 <sys_read+0x78>
+  return fileread(f, p, n);
+80107c8a:	83 ec 04             	sub    $0x4,%esp
+80107c8d:	ff 75 f0             	push   -0x10(%ebp)
+80107c90:	ff 75 f4             	push   -0xc(%ebp)
+80107c93:	56                   	push   %esi
+80107c94:	e8 e7 a6 ff ff       	call   80102380 <fileread>
+80107c99:	83 c4 10             	add    $0x10,%esp
+}
+80107c9c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107c9f:	5b                   	pop    %ebx
+80107ca0:	5e                   	pop    %esi
+80107ca1:	5d                   	pop    %ebp
+80107ca2:	c3                   	ret
+80107ca3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107ca7:	90                   	nop
+    return -1;
+80107ca8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107cad:	eb ed                	jmp    80107c9c <sys_read+0x6c>
+80107caf:	90                   	nop
+
+80107cb0 <sys_write>:
+{
+80107cb0:	55                   	push   %ebp
+80107cb1:	89 e5                	mov    %esp,%ebp
+80107cb3:	56                   	push   %esi
+80107cb4:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80107cb5:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+80107cb8:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80107cbb:	53                   	push   %ebx
+80107cbc:	6a 00                	push   $0x0
+80107cbe:	e8 6d fb ff ff       	call   80107830 <argint>
+80107cc3:	83 c4 10             	add    $0x10,%esp
+80107cc6:	85 c0                	test   %eax,%eax
+80107cc8:	78 5e                	js     80107d28 <sys_write+0x78>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80107cca:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80107cce:	77 58                	ja     80107d28 <sys_write+0x78>
+80107cd0:	e8 1b d9 ff ff       	call   801055f0 <myproc>
+80107cd5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80107cd8:	8b 74 90 30          	mov    0x30(%eax,%edx,4),%esi
+80107cdc:	85 f6                	test   %esi,%esi
+80107cde:	74 48                	je     80107d28 <sys_write+0x78>
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+80107ce0:	83 ec 08             	sub    $0x8,%esp
+80107ce3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80107ce6:	50                   	push   %eax
+80107ce7:	6a 02                	push   $0x2
+80107ce9:	e8 42 fb ff ff       	call   80107830 <argint>
+80107cee:	83 c4 10             	add    $0x10,%esp
+80107cf1:	85 c0                	test   %eax,%eax
+80107cf3:	78 33                	js     80107d28 <sys_write+0x78>
+80107cf5:	83 ec 04             	sub    $0x4,%esp
+80107cf8:	ff 75 f0             	push   -0x10(%ebp)
+80107cfb:	53                   	push   %ebx
+80107cfc:	6a 01                	push   $0x1
+80107cfe:	e8 7d fb ff ff       	call   80107880 <argptr>
+80107d03:	83 c4 10             	add    $0x10,%esp
+80107d06:	85 c0                	test   %eax,%eax
+80107d08:	78 1e                	js     80107d28 <sys_write+0x78>
+  return filewrite(f, p, n);
+80107d0a:	83 ec 04             	sub    $0x4,%esp
+80107d0d:	ff 75 f0             	push   -0x10(%ebp)
+80107d10:	ff 75 f4             	push   -0xc(%ebp)
+80107d13:	56                   	push   %esi
+80107d14:	e8 17 a8 ff ff       	call   80102530 <filewrite>
+80107d19:	83 c4 10             	add    $0x10,%esp
+}
+80107d1c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107d1f:	5b                   	pop    %ebx
+80107d20:	5e                   	pop    %esi
+80107d21:	5d                   	pop    %ebp
+80107d22:	c3                   	ret
+80107d23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107d27:	90                   	nop
+    return -1;
+80107d28:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107d2d:	eb ed                	jmp    80107d1c <sys_write+0x6c>
+80107d2f:	90                   	nop
+
+80107d30 <sys_close>:
+{
+80107d30:	55                   	push   %ebp
+80107d31:	89 e5                	mov    %esp,%ebp
+80107d33:	56                   	push   %esi
+80107d34:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80107d35:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80107d38:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80107d3b:	50                   	push   %eax
+80107d3c:	6a 00                	push   $0x0
+80107d3e:	e8 ed fa ff ff       	call   80107830 <argint>
+80107d43:	83 c4 10             	add    $0x10,%esp
+80107d46:	85 c0                	test   %eax,%eax
+80107d48:	78 3e                	js     80107d88 <sys_close+0x58>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80107d4a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80107d4e:	77 38                	ja     80107d88 <sys_close+0x58>
+80107d50:	e8 9b d8 ff ff       	call   801055f0 <myproc>
+80107d55:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80107d58:	8d 5a 0c             	lea    0xc(%edx),%ebx
+80107d5b:	8b 34 98             	mov    (%eax,%ebx,4),%esi
+80107d5e:	85 f6                	test   %esi,%esi
+80107d60:	74 26                	je     80107d88 <sys_close+0x58>
+  myproc()->ofile[fd] = 0;
+80107d62:	e8 89 d8 ff ff       	call   801055f0 <myproc>
+  fileclose(f);
+80107d67:	83 ec 0c             	sub    $0xc,%esp
+  myproc()->ofile[fd] = 0;
+80107d6a:	c7 04 98 00 00 00 00 	movl   $0x0,(%eax,%ebx,4)
+  fileclose(f);
+80107d71:	56                   	push   %esi
+80107d72:	e8 d9 a4 ff ff       	call   80102250 <fileclose>
+  return 0;
+80107d77:	83 c4 10             	add    $0x10,%esp
+80107d7a:	31 c0                	xor    %eax,%eax
+}
+80107d7c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107d7f:	5b                   	pop    %ebx
+80107d80:	5e                   	pop    %esi
+80107d81:	5d                   	pop    %ebp
+80107d82:	c3                   	ret
+80107d83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107d87:	90                   	nop
+    return -1;
+80107d88:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107d8d:	eb ed                	jmp    80107d7c <sys_close+0x4c>
+80107d8f:	90                   	nop
+
+80107d90 <sys_fstat>:
+{
+80107d90:	55                   	push   %ebp
+80107d91:	89 e5                	mov    %esp,%ebp
+80107d93:	56                   	push   %esi
+80107d94:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80107d95:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+80107d98:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80107d9b:	53                   	push   %ebx
+80107d9c:	6a 00                	push   $0x0
+80107d9e:	e8 8d fa ff ff       	call   80107830 <argint>
+80107da3:	83 c4 10             	add    $0x10,%esp
+80107da6:	85 c0                	test   %eax,%eax
+80107da8:	78 46                	js     80107df0 <sys_fstat+0x60>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80107daa:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80107dae:	77 40                	ja     80107df0 <sys_fstat+0x60>
+80107db0:	e8 3b d8 ff ff       	call   801055f0 <myproc>
+80107db5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80107db8:	8b 74 90 30          	mov    0x30(%eax,%edx,4),%esi
+80107dbc:	85 f6                	test   %esi,%esi
+80107dbe:	74 30                	je     80107df0 <sys_fstat+0x60>
+  if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+80107dc0:	83 ec 04             	sub    $0x4,%esp
+80107dc3:	6a 14                	push   $0x14
+80107dc5:	53                   	push   %ebx
+80107dc6:	6a 01                	push   $0x1
+80107dc8:	e8 b3 fa ff ff       	call   80107880 <argptr>
+80107dcd:	83 c4 10             	add    $0x10,%esp
+80107dd0:	85 c0                	test   %eax,%eax
+80107dd2:	78 1c                	js     80107df0 <sys_fstat+0x60>
+  return filestat(f, st);
+80107dd4:	83 ec 08             	sub    $0x8,%esp
+80107dd7:	ff 75 f4             	push   -0xc(%ebp)
+80107dda:	56                   	push   %esi
+80107ddb:	e8 50 a5 ff ff       	call   80102330 <filestat>
+80107de0:	83 c4 10             	add    $0x10,%esp
+}
+80107de3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107de6:	5b                   	pop    %ebx
+80107de7:	5e                   	pop    %esi
+80107de8:	5d                   	pop    %ebp
+80107de9:	c3                   	ret
+80107dea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+80107df0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107df5:	eb ec                	jmp    80107de3 <sys_fstat+0x53>
+80107df7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107dfe:	66 90                	xchg   %ax,%ax
+
+80107e00 <sys_link>:
+{
+80107e00:	55                   	push   %ebp
+80107e01:	89 e5                	mov    %esp,%ebp
+80107e03:	57                   	push   %edi
+80107e04:	56                   	push   %esi
+  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+80107e05:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+{
+80107e08:	53                   	push   %ebx
+80107e09:	83 ec 34             	sub    $0x34,%esp
+  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+80107e0c:	50                   	push   %eax
+80107e0d:	6a 00                	push   $0x0
+80107e0f:	e8 dc fa ff ff       	call   801078f0 <argstr>
+80107e14:	83 c4 10             	add    $0x10,%esp
+80107e17:	85 c0                	test   %eax,%eax
+80107e19:	0f 88 06 01 00 00    	js     80107f25 <sys_link+0x125>
+80107e1f:	83 ec 08             	sub    $0x8,%esp
+80107e22:	8d 45 d0             	lea    -0x30(%ebp),%eax
+80107e25:	50                   	push   %eax
+80107e26:	6a 01                	push   $0x1
+80107e28:	e8 c3 fa ff ff       	call   801078f0 <argstr>
+80107e2d:	83 c4 10             	add    $0x10,%esp
+80107e30:	85 c0                	test   %eax,%eax
+80107e32:	0f 88 ed 00 00 00    	js     80107f25 <sys_link+0x125>
+  begin_op();
+80107e38:	e8 83 c5 ff ff       	call   801043c0 <begin_op>
+  if((ip = namei(old)) == 0){
+80107e3d:	83 ec 0c             	sub    $0xc,%esp
+80107e40:	ff 75 d4             	push   -0x2c(%ebp)
+80107e43:	e8 58 b8 ff ff       	call   801036a0 <namei>
+80107e48:	83 c4 10             	add    $0x10,%esp
+80107e4b:	89 c3                	mov    %eax,%ebx
+80107e4d:	85 c0                	test   %eax,%eax
+80107e4f:	0f 84 ea 00 00 00    	je     80107f3f <sys_link+0x13f>
+  ilock(ip);
+80107e55:	83 ec 0c             	sub    $0xc,%esp
+80107e58:	50                   	push   %eax
+80107e59:	e8 92 ad ff ff       	call   80102bf0 <ilock>
+  if(ip->type == T_DIR){
+80107e5e:	83 c4 10             	add    $0x10,%esp
+80107e61:	66 83 bb 8c 00 00 00 	cmpw   $0x1,0x8c(%ebx)
+80107e68:	01 
+80107e69:	0f 84 bd 00 00 00    	je     80107f2c <sys_link+0x12c>
+  iupdate(ip);
+80107e6f:	83 ec 0c             	sub    $0xc,%esp
+  ip->nlink++;
+80107e72:	66 83 83 92 00 00 00 	addw   $0x1,0x92(%ebx)
+80107e79:	01 
+  if((dp = nameiparent(new, name)) == 0)
+80107e7a:	8d 7d da             	lea    -0x26(%ebp),%edi
+  iupdate(ip);
+80107e7d:	53                   	push   %ebx
+80107e7e:	e8 ad ac ff ff       	call   80102b30 <iupdate>
+  iunlock(ip);
+80107e83:	89 1c 24             	mov    %ebx,(%esp)
+80107e86:	e8 b5 ae ff ff       	call   80102d40 <iunlock>
+  if((dp = nameiparent(new, name)) == 0)
+80107e8b:	58                   	pop    %eax
+80107e8c:	5a                   	pop    %edx
+80107e8d:	57                   	push   %edi
+80107e8e:	ff 75 d0             	push   -0x30(%ebp)
+80107e91:	e8 2a b8 ff ff       	call   801036c0 <nameiparent>
+80107e96:	83 c4 10             	add    $0x10,%esp
+80107e99:	89 c6                	mov    %eax,%esi
+80107e9b:	85 c0                	test   %eax,%eax
+80107e9d:	74 5d                	je     80107efc <sys_link+0xfc>
+  ilock(dp);
+80107e9f:	83 ec 0c             	sub    $0xc,%esp
+80107ea2:	50                   	push   %eax
+80107ea3:	e8 48 ad ff ff       	call   80102bf0 <ilock>
+  if(dp->dev != ip->dev || dirlink(dp, name, ip->inum) < 0){
+80107ea8:	8b 03                	mov    (%ebx),%eax
+80107eaa:	83 c4 10             	add    $0x10,%esp
+80107ead:	39 06                	cmp    %eax,(%esi)
+80107eaf:	75 3f                	jne    80107ef0 <sys_link+0xf0>
+80107eb1:	83 ec 04             	sub    $0x4,%esp
+80107eb4:	ff 73 04             	push   0x4(%ebx)
+80107eb7:	57                   	push   %edi
+80107eb8:	56                   	push   %esi
+80107eb9:	e8 22 b7 ff ff       	call   801035e0 <dirlink>
+80107ebe:	83 c4 10             	add    $0x10,%esp
+80107ec1:	85 c0                	test   %eax,%eax
+80107ec3:	78 2b                	js     80107ef0 <sys_link+0xf0>
+  iunlockput(dp);
+80107ec5:	83 ec 0c             	sub    $0xc,%esp
+80107ec8:	56                   	push   %esi
+80107ec9:	e8 42 b0 ff ff       	call   80102f10 <iunlockput>
+  iput(ip);
+80107ece:	89 1c 24             	mov    %ebx,(%esp)
+80107ed1:	e8 ba ae ff ff       	call   80102d90 <iput>
+  end_op();
+80107ed6:	e8 55 c5 ff ff       	call   80104430 <end_op>
+  return 0;
+80107edb:	83 c4 10             	add    $0x10,%esp
+80107ede:	31 c0                	xor    %eax,%eax
+}
+80107ee0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107ee3:	5b                   	pop    %ebx
+80107ee4:	5e                   	pop    %esi
+80107ee5:	5f                   	pop    %edi
+80107ee6:	5d                   	pop    %ebp
+80107ee7:	c3                   	ret
+80107ee8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107eef:	90                   	nop
+    iunlockput(dp);
+80107ef0:	83 ec 0c             	sub    $0xc,%esp
+80107ef3:	56                   	push   %esi
+80107ef4:	e8 17 b0 ff ff       	call   80102f10 <iunlockput>
+    goto bad;
+80107ef9:	83 c4 10             	add    $0x10,%esp
+  ilock(ip);
+80107efc:	83 ec 0c             	sub    $0xc,%esp
+80107eff:	53                   	push   %ebx
+80107f00:	e8 eb ac ff ff       	call   80102bf0 <ilock>
+  ip->nlink--;
+80107f05:	66 83 ab 92 00 00 00 	subw   $0x1,0x92(%ebx)
+80107f0c:	01 
+  iupdate(ip);
+80107f0d:	89 1c 24             	mov    %ebx,(%esp)
+80107f10:	e8 1b ac ff ff       	call   80102b30 <iupdate>
+  iunlockput(ip);
+80107f15:	89 1c 24             	mov    %ebx,(%esp)
+80107f18:	e8 f3 af ff ff       	call   80102f10 <iunlockput>
+  end_op();
+80107f1d:	e8 0e c5 ff ff       	call   80104430 <end_op>
+  return -1;
+80107f22:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80107f25:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107f2a:	eb b4                	jmp    80107ee0 <sys_link+0xe0>
+    iunlockput(ip);
+80107f2c:	83 ec 0c             	sub    $0xc,%esp
+80107f2f:	53                   	push   %ebx
+80107f30:	e8 db af ff ff       	call   80102f10 <iunlockput>
+    end_op();
+80107f35:	e8 f6 c4 ff ff       	call   80104430 <end_op>
+    return -1;
+80107f3a:	83 c4 10             	add    $0x10,%esp
+80107f3d:	eb e6                	jmp    80107f25 <sys_link+0x125>
+    end_op();
+80107f3f:	e8 ec c4 ff ff       	call   80104430 <end_op>
+    return -1;
+80107f44:	eb df                	jmp    80107f25 <sys_link+0x125>
+80107f46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107f4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107f50 <sys_unlink>:
+{
+80107f50:	55                   	push   %ebp
+80107f51:	89 e5                	mov    %esp,%ebp
+80107f53:	57                   	push   %edi
+80107f54:	56                   	push   %esi
+  if(argstr(0, &path) < 0)
+80107f55:	8d 45 c0             	lea    -0x40(%ebp),%eax
+{
+80107f58:	53                   	push   %ebx
+80107f59:	83 ec 54             	sub    $0x54,%esp
+  if(argstr(0, &path) < 0)
+80107f5c:	50                   	push   %eax
+80107f5d:	6a 00                	push   $0x0
+80107f5f:	e8 8c f9 ff ff       	call   801078f0 <argstr>
+80107f64:	83 c4 10             	add    $0x10,%esp
+80107f67:	85 c0                	test   %eax,%eax
+80107f69:	0f 88 6c 01 00 00    	js     801080db <sys_unlink+0x18b>
+  begin_op();
+80107f6f:	e8 4c c4 ff ff       	call   801043c0 <begin_op>
+  if((dp = nameiparent(path, name)) == 0){
+80107f74:	8d 5d ca             	lea    -0x36(%ebp),%ebx
+80107f77:	83 ec 08             	sub    $0x8,%esp
+80107f7a:	53                   	push   %ebx
+80107f7b:	ff 75 c0             	push   -0x40(%ebp)
+80107f7e:	e8 3d b7 ff ff       	call   801036c0 <nameiparent>
+80107f83:	83 c4 10             	add    $0x10,%esp
+80107f86:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+80107f89:	85 c0                	test   %eax,%eax
+80107f8b:	0f 84 73 01 00 00    	je     80108104 <sys_unlink+0x1b4>
+  ilock(dp);
+80107f91:	8b 7d b4             	mov    -0x4c(%ebp),%edi
+80107f94:	83 ec 0c             	sub    $0xc,%esp
+80107f97:	57                   	push   %edi
+80107f98:	e8 53 ac ff ff       	call   80102bf0 <ilock>
+  if(namecmp(name, ".") == 0 || namecmp(name, "..") == 0)
+80107f9d:	58                   	pop    %eax
+80107f9e:	5a                   	pop    %edx
+80107f9f:	68 70 bd 10 80       	push   $0x8010bd70
+80107fa4:	53                   	push   %ebx
+80107fa5:	e8 c6 b2 ff ff       	call   80103270 <namecmp>
+80107faa:	83 c4 10             	add    $0x10,%esp
+80107fad:	85 c0                	test   %eax,%eax
+80107faf:	0f 84 13 01 00 00    	je     801080c8 <sys_unlink+0x178>
+80107fb5:	83 ec 08             	sub    $0x8,%esp
+80107fb8:	68 6f bd 10 80       	push   $0x8010bd6f
+80107fbd:	53                   	push   %ebx
+80107fbe:	e8 ad b2 ff ff       	call   80103270 <namecmp>
+80107fc3:	83 c4 10             	add    $0x10,%esp
+80107fc6:	85 c0                	test   %eax,%eax
+80107fc8:	0f 84 fa 00 00 00    	je     801080c8 <sys_unlink+0x178>
+  if((ip = dirlookup(dp, name, &off)) == 0)
+80107fce:	83 ec 04             	sub    $0x4,%esp
+80107fd1:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+80107fd4:	50                   	push   %eax
+80107fd5:	53                   	push   %ebx
+80107fd6:	57                   	push   %edi
+80107fd7:	e8 b4 b2 ff ff       	call   80103290 <dirlookup>
+80107fdc:	83 c4 10             	add    $0x10,%esp
+80107fdf:	89 c3                	mov    %eax,%ebx
+80107fe1:	85 c0                	test   %eax,%eax
+80107fe3:	0f 84 df 00 00 00    	je     801080c8 <sys_unlink+0x178>
+  ilock(ip);
+80107fe9:	83 ec 0c             	sub    $0xc,%esp
+80107fec:	50                   	push   %eax
+80107fed:	e8 fe ab ff ff       	call   80102bf0 <ilock>
+  if(ip->nlink < 1)
+80107ff2:	83 c4 10             	add    $0x10,%esp
+80107ff5:	66 83 bb 92 00 00 00 	cmpw   $0x0,0x92(%ebx)
+80107ffc:	00 
+80107ffd:	0f 8e 22 01 00 00    	jle    80108125 <sys_unlink+0x1d5>
+  if(ip->type == T_DIR && !isdirempty(ip)){
+80108003:	66 83 bb 8c 00 00 00 	cmpw   $0x1,0x8c(%ebx)
+8010800a:	01 
+8010800b:	8d 7d d8             	lea    -0x28(%ebp),%edi
+8010800e:	74 70                	je     80108080 <sys_unlink+0x130>
+  memset(&de, 0, sizeof(de));
+80108010:	83 ec 04             	sub    $0x4,%esp
+80108013:	6a 10                	push   $0x10
+80108015:	6a 00                	push   $0x0
+80108017:	57                   	push   %edi
+80108018:	e8 a3 f3 ff ff       	call   801073c0 <memset>
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+8010801d:	6a 10                	push   $0x10
+8010801f:	ff 75 c4             	push   -0x3c(%ebp)
+80108022:	57                   	push   %edi
+80108023:	ff 75 b4             	push   -0x4c(%ebp)
+80108026:	e8 f5 b0 ff ff       	call   80103120 <writei>
+8010802b:	83 c4 20             	add    $0x20,%esp
+8010802e:	83 f8 10             	cmp    $0x10,%eax
+80108031:	0f 85 e1 00 00 00    	jne    80108118 <sys_unlink+0x1c8>
+  if(ip->type == T_DIR){
+80108037:	66 83 bb 8c 00 00 00 	cmpw   $0x1,0x8c(%ebx)
+8010803e:	01 
+8010803f:	0f 84 a3 00 00 00    	je     801080e8 <sys_unlink+0x198>
+  iunlockput(dp);
+80108045:	83 ec 0c             	sub    $0xc,%esp
+80108048:	ff 75 b4             	push   -0x4c(%ebp)
+8010804b:	e8 c0 ae ff ff       	call   80102f10 <iunlockput>
+  ip->nlink--;
+80108050:	66 83 ab 92 00 00 00 	subw   $0x1,0x92(%ebx)
+80108057:	01 
+  iupdate(ip);
+80108058:	89 1c 24             	mov    %ebx,(%esp)
+8010805b:	e8 d0 aa ff ff       	call   80102b30 <iupdate>
+  iunlockput(ip);
+80108060:	89 1c 24             	mov    %ebx,(%esp)
+80108063:	e8 a8 ae ff ff       	call   80102f10 <iunlockput>
+  end_op();
+80108068:	e8 c3 c3 ff ff       	call   80104430 <end_op>
+  return 0;
+8010806d:	83 c4 10             	add    $0x10,%esp
+80108070:	31 c0                	xor    %eax,%eax
+}
+80108072:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108075:	5b                   	pop    %ebx
+80108076:	5e                   	pop    %esi
+80108077:	5f                   	pop    %edi
+80108078:	5d                   	pop    %ebp
+80108079:	c3                   	ret
+8010807a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
+80108080:	83 bb 94 00 00 00 20 	cmpl   $0x20,0x94(%ebx)
+80108087:	76 87                	jbe    80108010 <sys_unlink+0xc0>
+80108089:	be 20 00 00 00       	mov    $0x20,%esi
+8010808e:	eb 0f                	jmp    8010809f <sys_unlink+0x14f>
+80108090:	83 c6 10             	add    $0x10,%esi
+80108093:	3b b3 94 00 00 00    	cmp    0x94(%ebx),%esi
+80108099:	0f 83 71 ff ff ff    	jae    80108010 <sys_unlink+0xc0>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+8010809f:	6a 10                	push   $0x10
+801080a1:	56                   	push   %esi
+801080a2:	57                   	push   %edi
+801080a3:	53                   	push   %ebx
+801080a4:	e8 67 af ff ff       	call   80103010 <readi>
+801080a9:	83 c4 10             	add    $0x10,%esp
+801080ac:	83 f8 10             	cmp    $0x10,%eax
+801080af:	75 5a                	jne    8010810b <sys_unlink+0x1bb>
+    if(de.inum != 0)
+801080b1:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+801080b6:	74 d8                	je     80108090 <sys_unlink+0x140>
+    iunlockput(ip);
+801080b8:	83 ec 0c             	sub    $0xc,%esp
+801080bb:	53                   	push   %ebx
+801080bc:	e8 4f ae ff ff       	call   80102f10 <iunlockput>
+    goto bad;
+801080c1:	83 c4 10             	add    $0x10,%esp
+801080c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  iunlockput(dp);
+801080c8:	83 ec 0c             	sub    $0xc,%esp
+801080cb:	ff 75 b4             	push   -0x4c(%ebp)
+801080ce:	e8 3d ae ff ff       	call   80102f10 <iunlockput>
+  end_op();
+801080d3:	e8 58 c3 ff ff       	call   80104430 <end_op>
+  return -1;
+801080d8:	83 c4 10             	add    $0x10,%esp
+    return -1;
+801080db:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801080e0:	eb 90                	jmp    80108072 <sys_unlink+0x122>
+801080e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    dp->nlink--;
+801080e8:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    iupdate(dp);
+801080eb:	83 ec 0c             	sub    $0xc,%esp
+    dp->nlink--;
+801080ee:	66 83 a8 92 00 00 00 	subw   $0x1,0x92(%eax)
+801080f5:	01 
+    iupdate(dp);
+801080f6:	50                   	push   %eax
+801080f7:	e8 34 aa ff ff       	call   80102b30 <iupdate>
+801080fc:	83 c4 10             	add    $0x10,%esp
+801080ff:	e9 41 ff ff ff       	jmp    80108045 <sys_unlink+0xf5>
+    end_op();
+80108104:	e8 27 c3 ff ff       	call   80104430 <end_op>
+    return -1;
+80108109:	eb d0                	jmp    801080db <sys_unlink+0x18b>
+      panic("isdirempty: readi");
+8010810b:	83 ec 0c             	sub    $0xc,%esp
+8010810e:	68 94 bd 10 80       	push   $0x8010bd94
+80108113:	e8 a8 93 ff ff       	call   801014c0 <panic>
+    panic("unlink: writei");
+80108118:	83 ec 0c             	sub    $0xc,%esp
+8010811b:	68 a6 bd 10 80       	push   $0x8010bda6
+80108120:	e8 9b 93 ff ff       	call   801014c0 <panic>
+    panic("unlink: nlink < 1");
+80108125:	83 ec 0c             	sub    $0xc,%esp
+80108128:	68 82 bd 10 80       	push   $0x8010bd82
+8010812d:	e8 8e 93 ff ff       	call   801014c0 <panic>
+80108132:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80108140 <sys_open>:
+{
+80108140:	55                   	push   %ebp
+80108141:	89 e5                	mov    %esp,%ebp
+80108143:	57                   	push   %edi
+80108144:	56                   	push   %esi
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+80108145:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+80108148:	53                   	push   %ebx
+80108149:	83 ec 24             	sub    $0x24,%esp
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+8010814c:	50                   	push   %eax
+8010814d:	6a 00                	push   $0x0
+8010814f:	e8 9c f7 ff ff       	call   801078f0 <argstr>
+80108154:	83 c4 10             	add    $0x10,%esp
+80108157:	85 c0                	test   %eax,%eax
+80108159:	0f 88 9e 00 00 00    	js     801081fd <sys_open+0xbd>
+8010815f:	83 ec 08             	sub    $0x8,%esp
+80108162:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80108165:	50                   	push   %eax
+80108166:	6a 01                	push   $0x1
+80108168:	e8 c3 f6 ff ff       	call   80107830 <argint>
+8010816d:	83 c4 10             	add    $0x10,%esp
+80108170:	85 c0                	test   %eax,%eax
+80108172:	0f 88 85 00 00 00    	js     801081fd <sys_open+0xbd>
+  begin_op();
+80108178:	e8 43 c2 ff ff       	call   801043c0 <begin_op>
+  if(omode & O_CREATE){
+8010817d:	f6 45 e5 02          	testb  $0x2,-0x1b(%ebp)
+80108181:	0f 85 81 00 00 00    	jne    80108208 <sys_open+0xc8>
+    if((ip = namei(path)) == 0){
+80108187:	83 ec 0c             	sub    $0xc,%esp
+8010818a:	ff 75 e0             	push   -0x20(%ebp)
+8010818d:	e8 0e b5 ff ff       	call   801036a0 <namei>
+80108192:	83 c4 10             	add    $0x10,%esp
+80108195:	89 c6                	mov    %eax,%esi
+80108197:	85 c0                	test   %eax,%eax
+80108199:	0f 84 86 00 00 00    	je     80108225 <sys_open+0xe5>
+    ilock(ip);
+8010819f:	83 ec 0c             	sub    $0xc,%esp
+801081a2:	50                   	push   %eax
+801081a3:	e8 48 aa ff ff       	call   80102bf0 <ilock>
+    if(ip->type == T_DIR && omode != O_RDONLY){
+801081a8:	83 c4 10             	add    $0x10,%esp
+801081ab:	66 83 be 8c 00 00 00 	cmpw   $0x1,0x8c(%esi)
+801081b2:	01 
+801081b3:	0f 84 cf 00 00 00    	je     80108288 <sys_open+0x148>
+  if((f = filealloc()) == 0 || (fd = fdalloc(f)) < 0){
+801081b9:	e8 d2 9f ff ff       	call   80102190 <filealloc>
+801081be:	89 c7                	mov    %eax,%edi
+801081c0:	85 c0                	test   %eax,%eax
+801081c2:	74 28                	je     801081ec <sys_open+0xac>
+  struct proc *curproc = myproc();
+801081c4:	e8 27 d4 ff ff       	call   801055f0 <myproc>
+  for(fd = 0; fd < NOFILE; fd++){
+801081c9:	31 db                	xor    %ebx,%ebx
+801081cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801081cf:	90                   	nop
+    if(curproc->ofile[fd] == 0){
+801081d0:	8b 54 98 30          	mov    0x30(%eax,%ebx,4),%edx
+801081d4:	85 d2                	test   %edx,%edx
+801081d6:	74 58                	je     80108230 <sys_open+0xf0>
+  for(fd = 0; fd < NOFILE; fd++){
+801081d8:	83 c3 01             	add    $0x1,%ebx
+801081db:	83 fb 10             	cmp    $0x10,%ebx
+801081de:	75 f0                	jne    801081d0 <sys_open+0x90>
+      fileclose(f);
+801081e0:	83 ec 0c             	sub    $0xc,%esp
+801081e3:	57                   	push   %edi
+801081e4:	e8 67 a0 ff ff       	call   80102250 <fileclose>
+801081e9:	83 c4 10             	add    $0x10,%esp
+    iunlockput(ip);
+801081ec:	83 ec 0c             	sub    $0xc,%esp
+801081ef:	56                   	push   %esi
+801081f0:	e8 1b ad ff ff       	call   80102f10 <iunlockput>
+    end_op();
+801081f5:	e8 36 c2 ff ff       	call   80104430 <end_op>
+    return -1;
+801081fa:	83 c4 10             	add    $0x10,%esp
+    return -1;
+801081fd:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80108202:	eb 73                	jmp    80108277 <sys_open+0x137>
+80108204:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    ip = create(path, T_FILE, 0, 0);
+80108208:	83 ec 0c             	sub    $0xc,%esp
+8010820b:	31 c9                	xor    %ecx,%ecx
+8010820d:	ba 02 00 00 00       	mov    $0x2,%edx
+80108212:	6a 00                	push   $0x0
+80108214:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80108217:	e8 84 f7 ff ff       	call   801079a0 <create>
+    if(ip == 0){
+8010821c:	83 c4 10             	add    $0x10,%esp
+    ip = create(path, T_FILE, 0, 0);
+8010821f:	89 c6                	mov    %eax,%esi
+    if(ip == 0){
+80108221:	85 c0                	test   %eax,%eax
+80108223:	75 94                	jne    801081b9 <sys_open+0x79>
+      end_op();
+80108225:	e8 06 c2 ff ff       	call   80104430 <end_op>
+      return -1;
+8010822a:	eb d1                	jmp    801081fd <sys_open+0xbd>
+8010822c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  iunlock(ip);
+80108230:	83 ec 0c             	sub    $0xc,%esp
+      curproc->ofile[fd] = f;
+80108233:	89 7c 98 30          	mov    %edi,0x30(%eax,%ebx,4)
+  iunlock(ip);
+80108237:	56                   	push   %esi
+80108238:	e8 03 ab ff ff       	call   80102d40 <iunlock>
+  end_op();
+8010823d:	e8 ee c1 ff ff       	call   80104430 <end_op>
+  f->type = FD_INODE;
+80108242:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  f->readable = !(omode & O_WRONLY);
+80108248:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+8010824b:	83 c4 10             	add    $0x10,%esp
+  f->ip = ip;
+8010824e:	89 77 10             	mov    %esi,0x10(%edi)
+  f->readable = !(omode & O_WRONLY);
+80108251:	89 d0                	mov    %edx,%eax
+  f->off = 0;
+80108253:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+  f->readable = !(omode & O_WRONLY);
+8010825a:	f7 d0                	not    %eax
+  f->raend = 0;
+8010825c:	c7 47 18 00 00 00 00 	movl   $0x0,0x18(%edi)
+  f->readable = !(omode & O_WRONLY);
+80108263:	83 e0 01             	and    $0x1,%eax
+  f->ra = 0;
+80108266:	c7 47 1c 00 00 00 00 	movl   $0x0,0x1c(%edi)
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+8010826d:	83 e2 03             	and    $0x3,%edx
+  f->readable = !(omode & O_WRONLY);
+80108270:	88 47 08             	mov    %al,0x8(%edi)
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+80108273:	0f 95 47 09          	setne  0x9(%edi)
+}
+80108277:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010827a:	89 d8                	mov    %ebx,%eax
+8010827c:	5b                   	pop    %ebx
+8010827d:	5e                   	pop    %esi
+8010827e:	5f                   	pop    %edi
+8010827f:	5d                   	pop    %ebp
+80108280:	c3                   	ret
+80108281:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(ip->type == T_DIR && omode != O_RDONLY){
+80108288:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010828b:	85 c9                	test   %ecx,%ecx
+8010828d:	0f 84 26 ff ff ff    	je     801081b9 <sys_open+0x79>
+80108293:	e9 54 ff ff ff       	jmp    801081ec <sys_open+0xac>
+80108298:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010829f:	90                   	nop
+
+801082a0 <sys_mkdir>:
+{
+801082a0:	55                   	push   %ebp
+801082a1:	89 e5                	mov    %esp,%ebp
+801082a3:	83 ec 18             	sub    $0x18,%esp
+  begin_op();
+801082a6:	e8 15 c1 ff ff       	call   801043c0 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = create(path, T_DIR, 0, 0)) == 0){
+801082ab:	83 ec 08             	sub    $0x8,%esp
+801082ae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801082b1:	50                   	push   %eax
+801082b2:	6a 00                	push   $0x0
+801082b4:	e8 37 f6 ff ff       	call   801078f0 <argstr>
+801082b9:	83 c4 10             	add    $0x10,%esp
+801082bc:	85 c0                	test   %eax,%eax
+801082be:	78 30                	js     801082f0 <sys_mkdir+0x50>
+801082c0:	83 ec 0c             	sub    $0xc,%esp
+801082c3:	31 c9                	xor    %ecx,%ecx
+801082c5:	ba 01 00 00 00       	mov    $0x1,%edx
+801082ca:	6a 00                	push   $0x0
+801082cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+801082cf:	e8 cc f6 ff ff       	call   801079a0 <create>
+801082d4:	83 c4 10             	add    $0x10,%esp
+801082d7:	85 c0                	test   %eax,%eax
+801082d9:	74 15                	je     801082f0 <sys_mkdir+0x50>
+  iunlockput(ip);
+801082db:	83 ec 0c             	sub    $0xc,%esp
+801082de:	50                   	push   %eax
+801082df:	e8 2c ac ff ff       	call   80102f10 <iunlockput>
+  end_op();
+801082e4:	e8 47 c1 ff ff       	call   80104430 <end_op>
+  return 0;
+801082e9:	83 c4 10             	add    $0x10,%esp
+801082ec:	31 c0                	xor    %eax,%eax
+}
+801082ee:	c9                   	leave
+801082ef:	c3                   	ret
+    end_op();
+801082f0:	e8 3b c1 ff ff       	call   80104430 <end_op>
+    return -1;
+801082f5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801082fa:	c9                   	leave
+801082fb:	c3                   	ret
+801082fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108300 <sys_mknod>:
+{
+80108300:	55                   	push   %ebp
+80108301:	89 e5                	mov    %esp,%ebp
+80108303:	83 ec 18             	sub    $0x18,%esp
+  begin_op();
+80108306:	e8 b5 c0 ff ff       	call   801043c0 <begin_op>
+  if((argstr(0, &path)) < 0 ||
+8010830b:	83 ec 08             	sub    $0x8,%esp
+8010830e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80108311:	50                   	push   %eax
+80108312:	6a 00                	push   $0x0
+80108314:	e8 d7 f5 ff ff       	call   801078f0 <argstr>
+80108319:	83 c4 10             	add    $0x10,%esp
+8010831c:	85 c0                	test   %eax,%eax
+8010831e:	78 60                	js     80108380 <sys_mknod+0x80>
+     argint(1, &major) < 0 ||
+80108320:	83 ec 08             	sub    $0x8,%esp
+80108323:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108326:	50                   	push   %eax
+80108327:	6a 01                	push   $0x1
+80108329:	e8 02 f5 ff ff       	call   80107830 <argint>
+  if((argstr(0, &path)) < 0 ||
+8010832e:	83 c4 10             	add    $0x10,%esp
+80108331:	85 c0                	test   %eax,%eax
+80108333:	78 4b                	js     80108380 <sys_mknod+0x80>
+     argint(2, &minor) < 0 ||
+80108335:	83 ec 08             	sub    $0x8,%esp
+80108338:	8d 45 f4             	lea    -0xc(%ebp),%eax
+8010833b:	50                   	push   %eax
+8010833c:	6a 02                	push   $0x2
+8010833e:	e8 ed f4 ff ff       	call   80107830 <argint>
+     argint(1, &major) < 0 ||
+80108343:	83 c4 10             	add    $0x10,%esp
+80108346:	85 c0                	test   %eax,%eax
+80108348:	78 36                	js     80108380 <sys_mknod+0x80>
+     (ip = create(path, T_DEV, major, minor)) == 0){
+8010834a:	0f bf 45 f4          	movswl -0xc(%ebp),%eax
+8010834e:	83 ec 0c             	sub    $0xc,%esp
+80108351:	0f bf 4d f0          	movswl -0x10(%ebp),%ecx
+80108355:	ba 03 00 00 00       	mov    $0x3,%edx
+8010835a:	50                   	push   %eax
+8010835b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+8010835e:	e8 3d f6 ff ff       	call   801079a0 <create>
+     argint(2, &minor) < 0 ||
+80108363:	83 c4 10             	add    $0x10,%esp
+80108366:	85 c0                	test   %eax,%eax
+80108368:	74 16                	je     80108380 <sys_mknod+0x80>
+  iunlockput(ip);
+8010836a:	83 ec 0c             	sub    $0xc,%esp
+8010836d:	50                   	push   %eax
+8010836e:	e8 9d ab ff ff       	call   80102f10 <iunlockput>
+  end_op();
+80108373:	e8 b8 c0 ff ff       	call   80104430 <end_op>
+  return 0;
+80108378:	83 c4 10             	add    $0x10,%esp
+8010837b:	31 c0                	xor    %eax,%eax
+}
+8010837d:	c9                   	leave
+8010837e:	c3                   	ret
+8010837f:	90                   	nop
+    end_op();
+80108380:	e8 ab c0 ff ff       	call   80104430 <end_op>
+    return -1;
+80108385:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010838a:	c9                   	leave
+8010838b:	c3                   	ret
+8010838c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108390 <sys_chdir>:
+{
+80108390:	55                   	push   %ebp
+80108391:	89 e5                	mov    %esp,%ebp
+80108393:	56                   	push   %esi
+80108394:	53                   	push   %ebx
+80108395:	83 ec 10             	sub    $0x10,%esp
+  struct proc *curproc = myproc();
+80108398:	e8 53 d2 ff ff       	call   801055f0 <myproc>
+8010839d:	89 c6                	mov    %eax,%esi
+  begin_op();
+8010839f:	e8 1c c0 ff ff       	call   801043c0 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = namei(path)) == 0){
+801083a4:	83 ec 08             	sub    $0x8,%esp
+801083a7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801083aa:	50                   	push   %eax
+801083ab:	6a 00                	push   $0x0
+801083ad:	e8 3e f5 ff ff       	call   801078f0 <argstr>
+801083b2:	83 c4 10             	add    $0x10,%esp
+801083b5:	85 c0                	test   %eax,%eax
+801083b7:	78 77                	js     80108430 <sys_chdir+0xa0>
+801083b9:	83 ec 0c             	sub    $0xc,%esp
+801083bc:	ff 75 f4             	push   -0xc(%ebp)
+801083bf:	e8 dc b2 ff ff       	call   801036a0 <namei>
+801083c4:	83 c4 10             	add    $0x10,%esp
+801083c7:	89 c3                	mov    %eax,%ebx
+801083c9:	85 c0                	test   %eax,%eax
+801083cb:	74 63                	je     80108430 <sys_chdir+0xa0>
+  ilock(ip);
+801083cd:	83 ec 0c             	sub    $0xc,%esp
+801083d0:	50                   	push   %eax
+801083d1:	e8 1a a8 ff ff       	call   80102bf0 <ilock>
+  if(ip->type != T_DIR){
+801083d6:	83 c4 10             	add    $0x10,%esp
+801083d9:	66 83 bb 8c 00 00 00 	cmpw   $0x1,0x8c(%ebx)
+801083e0:	01 
+801083e1:	75 2d                	jne    80108410 <sys_chdir+0x80>
+  iunlock(ip);
+801083e3:	83 ec 0c             	sub    $0xc,%esp
+801083e6:	53                   	push   %ebx
+801083e7:	e8 54 a9 ff ff       	call   80102d40 <iunlock>
+  iput(curproc->cwd);
+801083ec:	58                   	pop    %eax
+801083ed:	ff 76 70             	push   0x70(%esi)
+801083f0:	e8 9b a9 ff ff       	call   80102d90 <iput>
+  end_op();
+801083f5:	e8 36 c0 ff ff       	call   80104430 <end_op>
+  curproc->cwd = ip;
+801083fa:	89 5e 70             	mov    %ebx,0x70(%esi)
+  return 0;
+801083fd:	83 c4 10             	add    $0x10,%esp
+80108400:	31 c0                	xor    %eax,%eax
+}
+80108402:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108405:	5b                   	pop    %ebx
+80108406:	5e                   	pop    %esi
+80108407:	5d                   	pop    %ebp
+80108408:	c3                   	ret
+80108409:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    iunlockput(ip);
+80108410:	83 ec 0c             	sub    $0xc,%esp
+80108413:	53                   	push   %ebx
+80108414:	e8 f7 aa ff ff       	call   80102f10 <iunlockput>
+    end_op();
+80108419:	e8 12 c0 ff ff       	call   80104430 <end_op>
+    return -1;
+8010841e:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80108421:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108426:	eb da                	jmp    80108402 <sys_chdir+0x72>
+80108428:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010842f:	90                   	nop
+    end_op();
+80108430:	e8 fb bf ff ff       	call   80104430 <end_op>
+    return -1;
+80108435:	eb ea                	jmp    80108421 <sys_chdir+0x91>
+80108437:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010843e:	66 90                	xchg   %ax,%ax
+
+80108440 <sys_exec>:
+
+int
+sys_exec(void)
+{
+80108440:	55                   	push   %ebp
+80108441:	89 e5                	mov    %esp,%ebp
+80108443:	81 ec a0 00 00 00    	sub    $0xa0,%esp
+  char *path, *argv[MAXARG];
+  uint uargv;
+
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+80108449:	8d 85 70 ff ff ff    	lea    -0x90(%ebp),%eax
+8010844f:	50                   	push   %eax
+80108450:	6a 00                	push   $0x0
+80108452:	e8 99 f4 ff ff       	call   801078f0 <argstr>
+80108457:	83 c4 10             	add    $0x10,%esp
+8010845a:	85 c0                	test   %eax,%eax
+8010845c:	78 4a                	js     801084a8 <sys_exec+0x68>
+8010845e:	83 ec 08             	sub    $0x8,%esp
+80108461:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+80108467:	50                   	push   %eax
+80108468:	6a 01                	push   $0x1
+8010846a:	e8 c1 f3 ff ff       	call   80107830 <argint>
+8010846f:	83 c4 10             	add    $0x10,%esp
+80108472:	85 c0                	test   %eax,%eax
+80108474:	78 32                	js     801084a8 <sys_exec+0x68>
+    return -1;
+  }
+  if(fetchargv(uargv, argv) < 0)
+80108476:	8b 85 74 ff ff ff    	mov    -0x8c(%ebp),%eax
+8010847c:	8d 95 78 ff ff ff    	lea    -0x88(%ebp),%edx
+80108482:	e8 99 f6 ff ff       	call   80107b20 <fetchargv>
+80108487:	85 c0                	test   %eax,%eax
+80108489:	78 1d                	js     801084a8 <sys_exec+0x68>
+    return -1;
+  return exec(path, argv);
+8010848b:	83 ec 08             	sub    $0x8,%esp
+8010848e:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+80108494:	50                   	push   %eax
+80108495:	ff b5 70 ff ff ff    	push   -0x90(%ebp)
+8010849b:	e8 50 9b ff ff       	call   80101ff0 <exec>
+801084a0:	83 c4 10             	add    $0x10,%esp
+}
+801084a3:	c9                   	leave
+801084a4:	c3                   	ret
+801084a5:	8d 76 00             	lea    0x0(%esi),%esi
+801084a8:	c9                   	leave
+    return -1;
+801084a9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801084ae:	c3                   	ret
+801084af:	90                   	nop
+
+801084b0 <sys_spawn>:
+
+// int spawn(char *path, char **argv, int *fdmap, int nfd)
+int
+sys_spawn(void)
+{
+801084b0:	55                   	push   %ebp
+801084b1:	89 e5                	mov    %esp,%ebp
+801084b3:	53                   	push   %ebx
+  char *path, *argv[MAXARG];
+  int *fdmap, nfd;
+  uint uargv;
+
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0 ||
+801084b4:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+{
+801084ba:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0 ||
+801084c0:	50                   	push   %eax
+801084c1:	6a 00                	push   $0x0
+801084c3:	e8 28 f4 ff ff       	call   801078f0 <argstr>
+801084c8:	83 c4 10             	add    $0x10,%esp
+801084cb:	85 c0                	test   %eax,%eax
+801084cd:	0f 88 bd 00 00 00    	js     80108590 <sys_spawn+0xe0>
+801084d3:	83 ec 08             	sub    $0x8,%esp
+801084d6:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+801084dc:	50                   	push   %eax
+801084dd:	6a 01                	push   $0x1
+801084df:	e8 4c f3 ff ff       	call   80107830 <argint>
+801084e4:	83 c4 10             	add    $0x10,%esp
+801084e7:	85 c0                	test   %eax,%eax
+801084e9:	0f 88 a1 00 00 00    	js     80108590 <sys_spawn+0xe0>
+     argint(3, &nfd) < 0 || argint(2, (int*)&fdmap) < 0)
+801084ef:	83 ec 08             	sub    $0x8,%esp
+801084f2:	8d 85 70 ff ff ff    	lea    -0x90(%ebp),%eax
+801084f8:	50                   	push   %eax
+801084f9:	6a 03                	push   $0x3
+801084fb:	e8 30 f3 ff ff       	call   80107830 <argint>
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0 ||
+80108500:	83 c4 10             	add    $0x10,%esp
+80108503:	85 c0                	test   %eax,%eax
+80108505:	0f 88 85 00 00 00    	js     80108590 <sys_spawn+0xe0>
+     argint(3, &nfd) < 0 || argint(2, (int*)&fdmap) < 0)
+8010850b:	83 ec 08             	sub    $0x8,%esp
+8010850e:	8d 9d 6c ff ff ff    	lea    -0x94(%ebp),%ebx
+80108514:	53                   	push   %ebx
+80108515:	6a 02                	push   $0x2
+80108517:	e8 14 f3 ff ff       	call   80107830 <argint>
+8010851c:	83 c4 10             	add    $0x10,%esp
+8010851f:	85 c0                	test   %eax,%eax
+80108521:	78 6d                	js     80108590 <sys_spawn+0xe0>
+    return -1;
+  if(fdmap && (nfd < 0 || argptr(2, (void*)&fdmap, nfd*sizeof(int)) < 0))
+80108523:	8b 85 6c ff ff ff    	mov    -0x94(%ebp),%eax
+80108529:	85 c0                	test   %eax,%eax
+8010852b:	74 20                	je     8010854d <sys_spawn+0x9d>
+8010852d:	8b 85 70 ff ff ff    	mov    -0x90(%ebp),%eax
+80108533:	85 c0                	test   %eax,%eax
+80108535:	78 59                	js     80108590 <sys_spawn+0xe0>
+80108537:	83 ec 04             	sub    $0x4,%esp
+8010853a:	c1 e0 02             	shl    $0x2,%eax
+8010853d:	50                   	push   %eax
+8010853e:	53                   	push   %ebx
+8010853f:	6a 02                	push   $0x2
+80108541:	e8 3a f3 ff ff       	call   80107880 <argptr>
+80108546:	83 c4 10             	add    $0x10,%esp
+80108549:	85 c0                	test   %eax,%eax
+8010854b:	78 43                	js     80108590 <sys_spawn+0xe0>
+    return -1;
+  if(fetchargv(uargv, argv) < 0)
+8010854d:	8b 85 74 ff ff ff    	mov    -0x8c(%ebp),%eax
+80108553:	8d 95 78 ff ff ff    	lea    -0x88(%ebp),%edx
+80108559:	e8 c2 f5 ff ff       	call   80107b20 <fetchargv>
+8010855e:	85 c0                	test   %eax,%eax
+80108560:	78 2e                	js     80108590 <sys_spawn+0xe0>
+    return -1;
+  return spawn(path, argv, fdmap, nfd);
+80108562:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+80108568:	ff b5 70 ff ff ff    	push   -0x90(%ebp)
+8010856e:	ff b5 6c ff ff ff    	push   -0x94(%ebp)
+80108574:	50                   	push   %eax
+80108575:	ff b5 68 ff ff ff    	push   -0x98(%ebp)
+8010857b:	e8 60 d4 ff ff       	call   801059e0 <spawn>
+80108580:	83 c4 10             	add    $0x10,%esp
+}
+80108583:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108586:	c9                   	leave
+80108587:	c3                   	ret
+80108588:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010858f:	90                   	nop
+    return -1;
+80108590:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108595:	eb ec                	jmp    80108583 <sys_spawn+0xd3>
+80108597:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010859e:	66 90                	xchg   %ax,%ax
+
+801085a0 <sys_pipe>:
+
+int
+sys_pipe(void)
+{
+801085a0:	55                   	push   %ebp
+801085a1:	89 e5                	mov    %esp,%ebp
+801085a3:	57                   	push   %edi
+801085a4:	56                   	push   %esi
+  int *fd;
+  struct file *rf, *wf;
+  int fd0, fd1;
+
+  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+801085a5:	8d 45 dc             	lea    -0x24(%ebp),%eax
+{
+801085a8:	53                   	push   %ebx
+801085a9:	83 ec 20             	sub    $0x20,%esp
+  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+801085ac:	6a 08                	push   $0x8
+801085ae:	50                   	push   %eax
+801085af:	6a 00                	push   $0x0
+801085b1:	e8 ca f2 ff ff       	call   80107880 <argptr>
+801085b6:	83 c4 10             	add    $0x10,%esp
+801085b9:	85 c0                	test   %eax,%eax
+801085bb:	0f 88 82 00 00 00    	js     80108643 <sys_pipe+0xa3>
+    return -1;
+  if(pipealloc(&rf, &wf) < 0)
+801085c1:	83 ec 08             	sub    $0x8,%esp
+801085c4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+801085c7:	50                   	push   %eax
+801085c8:	8d 45 e0             	lea    -0x20(%ebp),%eax
+801085cb:	50                   	push   %eax
+801085cc:	e8 8f c8 ff ff       	call   80104e60 <pipealloc>
+801085d1:	83 c4 10             	add    $0x10,%esp
+801085d4:	85 c0                	test   %eax,%eax
+801085d6:	78 6b                	js     80108643 <sys_pipe+0xa3>
+    return -1;
+  fd0 = -1;
+  if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
+801085d8:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for(fd = 0; fd < NOFILE; fd++){
+801085db:	31 db                	xor    %ebx,%ebx
+  struct proc *curproc = myproc();
+801085dd:	e8 0e d0 ff ff       	call   801055f0 <myproc>
+    if(curproc->ofile[fd] == 0){
+801085e2:	8b 74 98 30          	mov    0x30(%eax,%ebx,4),%esi
+801085e6:	85 f6                	test   %esi,%esi
+801085e8:	74 16                	je     80108600 <sys_pipe+0x60>
+801085ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(fd = 0; fd < NOFILE; fd++){
+801085f0:	83 c3 01             	add    $0x1,%ebx
+801085f3:	83 fb 10             	cmp    $0x10,%ebx
+801085f6:	74 34                	je     8010862c <sys_pipe+0x8c>
+    if(curproc->ofile[fd] == 0){
+801085f8:	8b 74 98 30          	mov    0x30(%eax,%ebx,4),%esi
+801085fc:	85 f6                	test   %esi,%esi
+801085fe:	75 f0                	jne    801085f0 <sys_pipe+0x50>
+      curproc->ofile[fd] = f;
+80108600:	8d 73 0c             	lea    0xc(%ebx),%esi
+80108603:	89 3c b0             	mov    %edi,(%eax,%esi,4)
+  if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
+80108606:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  struct proc *curproc = myproc();
+80108609:	e8 e2 cf ff ff       	call   801055f0 <myproc>
+  for(fd = 0; fd < NOFILE; fd++){
+8010860e:	31 d2                	xor    %edx,%edx
+    if(curproc->ofile[fd] == 0){
+80108610:	8b 4c 90 30          	mov    0x30(%eax,%edx,4),%ecx
+80108614:	85 c9                	test   %ecx,%ecx
+80108616:	74 38                	je     80108650 <sys_pipe+0xb0>
+  for(fd = 0; fd < NOFILE; fd++){
+80108618:	83 c2 01             	add    $0x1,%edx
+8010861b:	83 fa 10             	cmp    $0x10,%edx
+8010861e:	75 f0                	jne    80108610 <sys_pipe+0x70>
+    if(fd0 >= 0)
+      myproc()->ofile[fd0] = 0;
+80108620:	e8 cb cf ff ff       	call   801055f0 <myproc>
+80108625:	c7 04 b0 00 00 00 00 	movl   $0x0,(%eax,%esi,4)
+    fileclose(rf);
+8010862c:	83 ec 0c             	sub    $0xc,%esp
+8010862f:	ff 75 e0             	push   -0x20(%ebp)
+80108632:	e8 19 9c ff ff       	call   80102250 <fileclose>
+    fileclose(wf);
+80108637:	58                   	pop    %eax
+80108638:	ff 75 e4             	push   -0x1c(%ebp)
+8010863b:	e8 10 9c ff ff       	call   80102250 <fileclose>
+    return -1;
+80108640:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80108643:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108648:	eb 17                	jmp    80108661 <sys_pipe+0xc1>
+8010864a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      curproc->ofile[fd] = f;
+80108650:	89 7c 90 30          	mov    %edi,0x30(%eax,%edx,4)
+  }
+  fd[0] = fd0;
+80108654:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80108657:	89 18                	mov    %ebx,(%eax)
+  fd[1] = fd1;
+80108659:	8b 45 dc             	mov    -0x24(%ebp),%eax
+8010865c:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+8010865f:	31 c0                	xor    %eax,%eax
+}
+80108661:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108664:	5b                   	pop    %ebx
+80108665:	5e                   	pop    %esi
+80108666:	5f                   	pop    %edi
+80108667:	5d                   	pop    %ebp
+80108668:	c3                   	ret
+80108669:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80108670 <sys_swapread>:
+
+int sys_swapread(void)
+{
+80108670:	55                   	push   %ebp
+80108671:	89 e5                	mov    %esp,%ebp
+80108673:	83 ec 1c             	sub    $0x1c,%esp
+	char* ptr;
+	int blkno;
+
+	if(argptr(0, &ptr, PGSIZE) < 0 || argint(1, &blkno) < 0 )
+80108676:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108679:	68 00 10 00 00       	push   $0x1000
+8010867e:	50                   	push   %eax
+8010867f:	6a 00                	push   $0x0
+80108681:	e8 fa f1 ff ff       	call   80107880 <argptr>
+80108686:	83 c4 10             	add    $0x10,%esp
+80108689:	85 c0                	test   %eax,%eax
+8010868b:	78 33                	js     801086c0 <sys_swapread+0x50>
+8010868d:	83 ec 08             	sub    $0x8,%esp
+80108690:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108693:	50                   	push   %eax
+80108694:	6a 01                	push   $0x1
+80108696:	e8 95 f1 ff ff       	call   80107830 <argint>
+8010869b:	83 c4 10             	add    $0x10,%esp
+8010869e:	85 c0                	test   %eax,%eax
+801086a0:	78 1e                	js     801086c0 <sys_swapread+0x50>
+		return -1;
+
+	swapread(ptr, blkno);
+801086a2:	83 ec 08             	sub    $0x8,%esp
+801086a5:	ff 75 f4             	push   -0xc(%ebp)
+801086a8:	ff 75 f0             	push   -0x10(%ebp)
+801086ab:	e8 30 b0 ff ff       	call   801036e0 <swapread>
+	return 0;
+801086b0:	83 c4 10             	add    $0x10,%esp
+801086b3:	31 c0                	xor    %eax,%eax
+}
+801086b5:	c9                   	leave
+801086b6:	c3                   	ret
+801086b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801086be:	66 90                	xchg   %ax,%ax
+801086c0:	c9                   	leave
+		return -1;
+801086c1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801086c6:	c3                   	ret
+801086c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801086ce:	66 90                	xchg   %ax,%ax
+
+801086d0 <sys_swapwrite>:
+
+int sys_swapwrite(void)
+{
+801086d0:	55                   	push   %ebp
+801086d1:	89 e5                	mov    %esp,%ebp
+801086d3:	83 ec 1c             	sub    $0x1c,%esp
+	char* ptr;
+	int blkno;
+
+	if(argptr(0, &ptr, PGSIZE) < 0 || argint(1, &blkno) < 0 )
+801086d6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801086d9:	68 00 10 00 00       	push   $0x1000
+801086de:	50                   	push   %eax
+801086df:	6a 00                	push   $0x0
+801086e1:	e8 9a f1 ff ff       	call   80107880 <argptr>
+801086e6:	83 c4 10             	add    $0x10,%esp
+801086e9:	85 c0                	test   %eax,%eax
+801086eb:	78 33                	js     80108720 <sys_swapwrite+0x50>
+801086ed:	83 ec 08             	sub    $0x8,%esp
+801086f0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801086f3:	50                   	push   %eax
+801086f4:	6a 01                	push   $0x1
+801086f6:	e8 35 f1 ff ff       	call   80107830 <argint>
+801086fb:	83 c4 10             	add    $0x10,%esp
+801086fe:	85 c0                	test   %eax,%eax
+80108700:	78 1e                	js     80108720 <sys_swapwrite+0x50>
+		return -1;
+
+	swapwrite(ptr, blkno);
+80108702:	83 ec 08             	sub    $0x8,%esp
+80108705:	ff 75 f4             	push   -0xc(%ebp)
+80108708:	ff 75 f0             	push   -0x10(%ebp)
+8010870b:	e8 50 b0 ff ff       	call   80103760 <swapwrite>
+	return 0;
+80108710:	83 c4 10             	add    $0x10,%esp
+80108713:	31 c0                	xor    %eax,%eax
+}
+80108715:	c9                   	leave
+80108716:	c3                   	ret
+80108717:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010871e:	66 90                	xchg   %ax,%ax
+80108720:	c9                   	leave
+		return -1;
+80108721:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108726:	c3                   	ret
+80108727:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010872e:	66 90                	xchg   %ax,%ax
+
+80108730 <sys_aiosetup>:
+
+int
+sys_aiosetup(void)
+{
+  return aiosetup();
+80108730:	e9 4b 7b ff ff       	jmp    80100280 <aiosetup>
+80108735:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010873c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108740 <sys_aiowait>:
+}
+
+int
+sys_aiowait(void)
+{
+80108740:	55                   	push   %ebp
+80108741:	89 e5                	mov    %esp,%ebp
+80108743:	83 ec 20             	sub    $0x20,%esp
+  int min;
+
+  if(argint(0, &min) < 0)
+80108746:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108749:	50                   	push   %eax
+8010874a:	6a 00                	push   $0x0
+8010874c:	e8 df f0 ff ff       	call   80107830 <argint>
+80108751:	83 c4 10             	add    $0x10,%esp
+80108754:	85 c0                	test   %eax,%eax
+80108756:	78 18                	js     80108770 <sys_aiowait+0x30>
+    return -1;
+  return aiowait(min);
+80108758:	83 ec 0c             	sub    $0xc,%esp
+8010875b:	ff 75 f4             	push   -0xc(%ebp)
+8010875e:	e8 2d 7c ff ff       	call   80100390 <aiowait>
+80108763:	83 c4 10             	add    $0x10,%esp
+}
+80108766:	c9                   	leave
+80108767:	c3                   	ret
+80108768:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010876f:	90                   	nop
+80108770:	c9                   	leave
+    return -1;
+80108771:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108776:	c3                   	ret
+80108777:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010877e:	66 90                	xchg   %ax,%ax
+
+80108780 <sys_diskstat>:
+
+// int diskstat(struct diskstat *st)
+int
+sys_diskstat(void)
+{
+80108780:	55                   	push   %ebp
+80108781:	89 e5                	mov    %esp,%ebp
+80108783:	83 ec 1c             	sub    $0x1c,%esp
+  struct diskstat *st;
+
+  if(argptr(0, (void*)&st, sizeof(*st)) < 0)
+80108786:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108789:	68 80 00 00 00       	push   $0x80
+8010878e:	50                   	push   %eax
+8010878f:	6a 00                	push   $0x0
+80108791:	e8 ea f0 ff ff       	call   80107880 <argptr>
+80108796:	83 c4 10             	add    $0x10,%esp
+80108799:	85 c0                	test   %eax,%eax
+8010879b:	78 13                	js     801087b0 <sys_diskstat+0x30>
+    return -1;
+  getdiskstat(st);
+8010879d:	83 ec 0c             	sub    $0xc,%esp
+801087a0:	ff 75 f4             	push   -0xc(%ebp)
+801087a3:	e8 a8 8b ff ff       	call   80101350 <getdiskstat>
+  return 0;
+801087a8:	83 c4 10             	add    $0x10,%esp
+801087ab:	31 c0                	xor    %eax,%eax
+}
+801087ad:	c9                   	leave
+801087ae:	c3                   	ret
+801087af:	90                   	nop
+801087b0:	c9                   	leave
+    return -1;
+801087b1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801087b6:	c3                   	ret
+801087b7:	66 90                	xchg   %ax,%ax
+801087b9:	66 90                	xchg   %ax,%ax
+801087bb:	66 90                	xchg   %ax,%ax
+801087bd:	66 90                	xchg   %ax,%ax
+801087bf:	90                   	nop
+
+801087c0 <sys_fork>:
+#include "lockstat.h"
+
+int
+sys_fork(void)
+{
+  return fork();
+801087c0:	e9 ab d0 ff ff       	jmp    80105870 <fork>
+801087c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801087cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801087d0 <sys_exit>:
+}
+
+int
+sys_exit(void)
+{
+801087d0:	55                   	push   %ebp
+801087d1:	89 e5                	mov    %esp,%ebp
+801087d3:	83 ec 08             	sub    $0x8,%esp
+  exit();
+801087d6:	e8 25 d6 ff ff       	call   80105e00 <exit>
+  return 0;  // not reached
+}
+801087db:	31 c0                	xor    %eax,%eax
+801087dd:	c9                   	leave
+801087de:	c3                   	ret
+801087df:	90                   	nop
+
+801087e0 <sys_wait>:
+
+int
+sys_wait(void)
+{
+  return wait();
+801087e0:	e9 1b d7 ff ff       	jmp    80105f00 <wait>
+801087e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801087ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801087f0 <sys_kill>:
+}
+
+int
+sys_kill(void)
+{
+801087f0:	55                   	push   %ebp
+801087f1:	89 e5                	mov    %esp,%ebp
+801087f3:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+
+  if(argint(0, &pid) < 0)
+801087f6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801087f9:	50                   	push   %eax
+801087fa:	6a 00                	push   $0x0
+801087fc:	e8 2f f0 ff ff       	call   80107830 <argint>
+80108801:	83 c4 10             	add    $0x10,%esp
+80108804:	85 c0                	test   %eax,%eax
+80108806:	78 18                	js     80108820 <sys_kill+0x30>
+    return -1;
+  return kill(pid);
+80108808:	83 ec 0c             	sub    $0xc,%esp
+8010880b:	ff 75 f4             	push   -0xc(%ebp)
+8010880e:	e8 8d d9 ff ff       	call   801061a0 <kill>
+80108813:	83 c4 10             	add    $0x10,%esp
+}
+80108816:	c9                   	leave
+80108817:	c3                   	ret
+80108818:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010881f:	90                   	nop
+80108820:	c9                   	leave
+    return -1;
+80108821:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108826:	c3                   	ret
+80108827:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010882e:	66 90                	xchg   %ax,%ax
+
+80108830 <sys_getpid>:
+
+int
+sys_getpid(void)
+{
+80108830:	55                   	push   %ebp
+80108831:	89 e5                	mov    %esp,%ebp
+80108833:	83 ec 08             	sub    $0x8,%esp
+  return myproc()->pid;
+80108836:	e8 b5 cd ff ff       	call   801055f0 <myproc>
+8010883b:	8b 40 10             	mov    0x10(%eax),%eax
+}
+8010883e:	c9                   	leave
+8010883f:	c3                   	ret
+
+80108840 <sys_sbrk>:
+
+int
+sys_sbrk(void)
+{
+80108840:	55                   	push   %ebp
+80108841:	89 e5                	mov    %esp,%ebp
+80108843:	53                   	push   %ebx
+  int addr;
+  int n;
+
+  if(argint(0, &n) < 0)
+80108844:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80108847:	83 ec 1c             	sub    $0x1c,%esp
+  if(argint(0, &n) < 0)
+8010884a:	50                   	push   %eax
+8010884b:	6a 00                	push   $0x0
+8010884d:	e8 de ef ff ff       	call   80107830 <argint>
+80108852:	83 c4 10             	add    $0x10,%esp
+80108855:	85 c0                	test   %eax,%eax
+80108857:	78 27                	js     80108880 <sys_sbrk+0x40>
+    return -1;
+  addr = myproc()->sz;
+80108859:	e8 92 cd ff ff       	call   801055f0 <myproc>
+  if(growproc(n) < 0)
+8010885e:	83 ec 0c             	sub    $0xc,%esp
+  addr = myproc()->sz;
+80108861:	8b 18                	mov    (%eax),%ebx
+  if(growproc(n) < 0)
+80108863:	ff 75 f4             	push   -0xc(%ebp)
+80108866:	e8 85 cf ff ff       	call   801057f0 <growproc>
+8010886b:	83 c4 10             	add    $0x10,%esp
+8010886e:	85 c0                	test   %eax,%eax
+80108870:	78 0e                	js     80108880 <sys_sbrk+0x40>
+    return -1;
+  return addr;
+}
+80108872:	89 d8                	mov    %ebx,%eax
+80108874:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108877:	c9                   	leave
+80108878:	c3                   	ret
+80108879:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+80108880:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80108885:	eb eb                	jmp    80108872 <sys_sbrk+0x32>
+80108887:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010888e:	66 90                	xchg   %ax,%ax
+
+80108890 <sys_sleep>:
+
+int
+sys_sleep(void)
+{
+80108890:	55                   	push   %ebp
+80108891:	89 e5                	mov    %esp,%ebp
+80108893:	53                   	push   %ebx
+  int n, r;
+
+  if(argint(0, &n) < 0)
+80108894:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80108897:	83 ec 1c             	sub    $0x1c,%esp
+  if(argint(0, &n) < 0)
+8010889a:	50                   	push   %eax
+8010889b:	6a 00                	push   $0x0
+8010889d:	e8 8e ef ff ff       	call   80107830 <argint>
+801088a2:	83 c4 10             	add    $0x10,%esp
+801088a5:	85 c0                	test   %eax,%eax
+801088a7:	78 37                	js     801088e0 <sys_sleep+0x50>
+    return -1;
+  acquire(&tickslock);
+801088a9:	83 ec 0c             	sub    $0xc,%esp
+801088ac:	68 a0 e4 1b 80       	push   $0x801be4a0
+801088b1:	e8 ba e7 ff ff       	call   80107070 <acquire>
+  r = tsleep(ticks + n);
+801088b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+801088b9:	03 05 80 e4 1b 80    	add    0x801be480,%eax
+801088bf:	89 04 24             	mov    %eax,(%esp)
+801088c2:	e8 09 05 00 00       	call   80108dd0 <tsleep>
+  release(&tickslock);
+801088c7:	c7 04 24 a0 e4 1b 80 	movl   $0x801be4a0,(%esp)
+  r = tsleep(ticks + n);
+801088ce:	89 c3                	mov    %eax,%ebx
+  release(&tickslock);
+801088d0:	e8 2b e6 ff ff       	call   80106f00 <release>
+  return r;
+801088d5:	83 c4 10             	add    $0x10,%esp
+}
+801088d8:	89 d8                	mov    %ebx,%eax
+801088da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801088dd:	c9                   	leave
+801088de:	c3                   	ret
+801088df:	90                   	nop
+    return -1;
+801088e0:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+801088e5:	eb f1                	jmp    801088d8 <sys_sleep+0x48>
+801088e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801088ee:	66 90                	xchg   %ax,%ax
+
+801088f0 <sys_clocktime>:
+
+// Return the monotonic clock, nanoseconds since boot.
+int
+sys_clocktime(void)
+{
+801088f0:	55                   	push   %ebp
+801088f1:	89 e5                	mov    %esp,%ebp
+801088f3:	83 ec 1c             	sub    $0x1c,%esp
+  struct timespec *ts;
+
+  if(argptr(0, (void*)&ts, sizeof(*ts)) < 0)
+801088f6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801088f9:	6a 08                	push   $0x8
+801088fb:	50                   	push   %eax
+801088fc:	6a 00                	push   $0x0
+801088fe:	e8 7d ef ff ff       	call   80107880 <argptr>
+80108903:	83 c4 10             	add    $0x10,%esp
+80108906:	85 c0                	test   %eax,%eax
+80108908:	78 16                	js     80108920 <sys_clocktime+0x30>
+    return -1;
+  clockread(ts);
+8010890a:	83 ec 0c             	sub    $0xc,%esp
+8010890d:	ff 75 f4             	push   -0xc(%ebp)
+80108910:	e8 fb 03 00 00       	call   80108d10 <clockread>
+  return 0;
+80108915:	83 c4 10             	add    $0x10,%esp
+80108918:	31 c0                	xor    %eax,%eax
+}
+8010891a:	c9                   	leave
+8010891b:	c3                   	ret
+8010891c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108920:	c9                   	leave
+    return -1;
+80108921:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108926:	c3                   	ret
+80108927:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010892e:	66 90                	xchg   %ax,%ax
+
+80108930 <sys_nanosleep>:
+// Sleep for at least the given struct timespec.  Short
+// sleeps use the one-shot timer; longer ones are rounded
+// up to whole ticks.
+int
+sys_nanosleep(void)
+{
+80108930:	55                   	push   %ebp
+80108931:	89 e5                	mov    %esp,%ebp
+80108933:	53                   	push   %ebx
+  struct timespec *ts;
+  uint n, tickns;
+  int r;
+
+  tickns = 1000000000/HZ;
+  if(argptr(0, (void*)&ts, sizeof(*ts)) < 0 || ts->nsec >= 1000000000)
+80108934:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80108937:	83 ec 18             	sub    $0x18,%esp
+  if(argptr(0, (void*)&ts, sizeof(*ts)) < 0 || ts->nsec >= 1000000000)
+8010893a:	6a 08                	push   $0x8
+8010893c:	50                   	push   %eax
+8010893d:	6a 00                	push   $0x0
+8010893f:	e8 3c ef ff ff       	call   80107880 <argptr>
+80108944:	83 c4 10             	add    $0x10,%esp
+80108947:	85 c0                	test   %eax,%eax
+80108949:	0f 88 a1 00 00 00    	js     801089f0 <sys_nanosleep+0xc0>
+8010894f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108952:	8b 50 04             	mov    0x4(%eax),%edx
+80108955:	81 fa ff c9 9a 3b    	cmp    $0x3b9ac9ff,%edx
+8010895b:	0f 87 8f 00 00 00    	ja     801089f0 <sys_nanosleep+0xc0>
+    return -1;
+  if(ts->sec == 0 && ts->nsec < HRMAX){
+80108961:	8b 08                	mov    (%eax),%ecx
+80108963:	85 c9                	test   %ecx,%ecx
+80108965:	74 49                	je     801089b0 <sys_nanosleep+0x80>
+    if(ts->nsec == 0)
+      return 0;
+    return hrsleep(ts->nsec);
+  }
+  if(ts->sec >= 0x10000000/HZ)  // keep the deadline within range
+80108967:	81 f9 c1 f5 28 00    	cmp    $0x28f5c1,%ecx
+8010896d:	76 61                	jbe    801089d0 <sys_nanosleep+0xa0>
+    n = 0x10000000;
+8010896f:	bb 00 00 00 10       	mov    $0x10000000,%ebx
+  else
+    n = ts->sec*HZ + (ts->nsec + tickns - 1)/tickns;
+  acquire(&tickslock);
+80108974:	83 ec 0c             	sub    $0xc,%esp
+80108977:	68 a0 e4 1b 80       	push   $0x801be4a0
+8010897c:	e8 ef e6 ff ff       	call   80107070 <acquire>
+  r = tsleep(ticks + n + 1);  // the current tick is partly over
+80108981:	a1 80 e4 1b 80       	mov    0x801be480,%eax
+80108986:	8d 44 03 01          	lea    0x1(%ebx,%eax,1),%eax
+8010898a:	89 04 24             	mov    %eax,(%esp)
+8010898d:	e8 3e 04 00 00       	call   80108dd0 <tsleep>
+  release(&tickslock);
+80108992:	c7 04 24 a0 e4 1b 80 	movl   $0x801be4a0,(%esp)
+  r = tsleep(ticks + n + 1);  // the current tick is partly over
+80108999:	89 c3                	mov    %eax,%ebx
+  release(&tickslock);
+8010899b:	e8 60 e5 ff ff       	call   80106f00 <release>
+  return r;
+801089a0:	83 c4 10             	add    $0x10,%esp
+}
+801089a3:	89 d8                	mov    %ebx,%eax
+801089a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801089a8:	c9                   	leave
+801089a9:	c3                   	ret
+801089aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(ts->sec == 0 && ts->nsec < HRMAX){
+801089b0:	81 fa ff e0 f5 05    	cmp    $0x5f5e0ff,%edx
+801089b6:	77 18                	ja     801089d0 <sys_nanosleep+0xa0>
+      return 0;
+801089b8:	31 db                	xor    %ebx,%ebx
+    if(ts->nsec == 0)
+801089ba:	85 d2                	test   %edx,%edx
+801089bc:	74 e5                	je     801089a3 <sys_nanosleep+0x73>
+    return hrsleep(ts->nsec);
+801089be:	83 ec 0c             	sub    $0xc,%esp
+801089c1:	52                   	push   %edx
+801089c2:	e8 d9 04 00 00       	call   80108ea0 <hrsleep>
+801089c7:	83 c4 10             	add    $0x10,%esp
+801089ca:	89 c3                	mov    %eax,%ebx
+801089cc:	eb d5                	jmp    801089a3 <sys_nanosleep+0x73>
+801089ce:	66 90                	xchg   %ax,%ax
+    n = ts->sec*HZ + (ts->nsec + tickns - 1)/tickns;
+801089d0:	81 c2 7f 96 98 00    	add    $0x98967f,%edx
+801089d6:	6b c9 64             	imul   $0x64,%ecx,%ecx
+801089d9:	b8 6b ca 5f 6b       	mov    $0x6b5fca6b,%eax
+801089de:	f7 e2                	mul    %edx
+801089e0:	c1 ea 16             	shr    $0x16,%edx
+801089e3:	8d 1c 0a             	lea    (%edx,%ecx,1),%ebx
+801089e6:	eb 8c                	jmp    80108974 <sys_nanosleep+0x44>
+801089e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801089ef:	90                   	nop
+    return -1;
+801089f0:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+801089f5:	eb ac                	jmp    801089a3 <sys_nanosleep+0x73>
+801089f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801089fe:	66 90                	xchg   %ax,%ax
+
+80108a00 <sys_uptime>:
+
+// return how many clock tick interrupts have occurred
+// since start.
+int
+sys_uptime(void)
+{
+80108a00:	55                   	push   %ebp
+80108a01:	89 e5                	mov    %esp,%ebp
+80108a03:	53                   	push   %ebx
+80108a04:	83 ec 10             	sub    $0x10,%esp
+  uint xticks;
+
+  acquire(&tickslock);
+80108a07:	68 a0 e4 1b 80       	push   $0x801be4a0
+80108a0c:	e8 5f e6 ff ff       	call   80107070 <acquire>
+  xticks = ticks;
+80108a11:	8b 1d 80 e4 1b 80    	mov    0x801be480,%ebx
+  release(&tickslock);
+80108a17:	c7 04 24 a0 e4 1b 80 	movl   $0x801be4a0,(%esp)
+80108a1e:	e8 dd e4 ff ff       	call   80106f00 <release>
+  return xticks;
+}
+80108a23:	89 d8                	mov    %ebx,%eax
+80108a25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108a28:	c9                   	leave
+80108a29:	c3                   	ret
+80108a2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80108a30 <sys_getprocinfo>:
+
+// int getprocinfo(struct procinfo *info, int n)
+int
+sys_getprocinfo(void)
+{
+80108a30:	55                   	push   %ebp
+80108a31:	89 e5                	mov    %esp,%ebp
+80108a33:	83 ec 20             	sub    $0x20,%esp
+  struct procinfo *info;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0 || n > NPROC ||
+80108a36:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108a39:	50                   	push   %eax
+80108a3a:	6a 01                	push   $0x1
+80108a3c:	e8 ef ed ff ff       	call   80107830 <argint>
+80108a41:	83 c4 10             	add    $0x10,%esp
+80108a44:	85 c0                	test   %eax,%eax
+80108a46:	78 38                	js     80108a80 <sys_getprocinfo+0x50>
+80108a48:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108a4b:	3d 00 10 00 00       	cmp    $0x1000,%eax
+80108a50:	77 2e                	ja     80108a80 <sys_getprocinfo+0x50>
+     argptr(0, (void*)&info, n*sizeof(*info)) < 0)
+80108a52:	6b c0 3c             	imul   $0x3c,%eax,%eax
+80108a55:	83 ec 04             	sub    $0x4,%esp
+80108a58:	50                   	push   %eax
+80108a59:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108a5c:	50                   	push   %eax
+80108a5d:	6a 00                	push   $0x0
+80108a5f:	e8 1c ee ff ff       	call   80107880 <argptr>
+  if(argint(1, &n) < 0 || n < 0 || n > NPROC ||
+80108a64:	83 c4 10             	add    $0x10,%esp
+80108a67:	85 c0                	test   %eax,%eax
+80108a69:	78 15                	js     80108a80 <sys_getprocinfo+0x50>
+    return -1;
+  return getprocinfo(info, n);
+80108a6b:	83 ec 08             	sub    $0x8,%esp
+80108a6e:	ff 75 f4             	push   -0xc(%ebp)
+80108a71:	ff 75 f0             	push   -0x10(%ebp)
+80108a74:	e8 17 d9 ff ff       	call   80106390 <getprocinfo>
+80108a79:	83 c4 10             	add    $0x10,%esp
+}
+80108a7c:	c9                   	leave
+80108a7d:	c3                   	ret
+80108a7e:	66 90                	xchg   %ax,%ax
+80108a80:	c9                   	leave
+    return -1;
+80108a81:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108a86:	c3                   	ret
+80108a87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108a8e:	66 90                	xchg   %ax,%ax
+
+80108a90 <sys_getlockstat>:
+
+// int getlockstat(struct lockstat *st, int n)
+int
+sys_getlockstat(void)
+{
+80108a90:	55                   	push   %ebp
+80108a91:	89 e5                	mov    %esp,%ebp
+80108a93:	83 ec 20             	sub    $0x20,%esp
+  struct lockstat *st;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0 || n > NLOCKSTAT ||
+80108a96:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108a99:	50                   	push   %eax
+80108a9a:	6a 01                	push   $0x1
+80108a9c:	e8 8f ed ff ff       	call   80107830 <argint>
+80108aa1:	83 c4 10             	add    $0x10,%esp
+80108aa4:	85 c0                	test   %eax,%eax
+80108aa6:	78 38                	js     80108ae0 <sys_getlockstat+0x50>
+80108aa8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108aab:	83 f8 40             	cmp    $0x40,%eax
+80108aae:	77 30                	ja     80108ae0 <sys_getlockstat+0x50>
+     argptr(0, (void*)&st, n*sizeof(*st)) < 0)
+80108ab0:	69 c0 24 01 00 00    	imul   $0x124,%eax,%eax
+80108ab6:	83 ec 04             	sub    $0x4,%esp
+80108ab9:	50                   	push   %eax
+80108aba:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108abd:	50                   	push   %eax
+80108abe:	6a 00                	push   $0x0
+80108ac0:	e8 bb ed ff ff       	call   80107880 <argptr>
+  if(argint(1, &n) < 0 || n < 0 || n > NLOCKSTAT ||
+80108ac5:	83 c4 10             	add    $0x10,%esp
+80108ac8:	85 c0                	test   %eax,%eax
+80108aca:	78 14                	js     80108ae0 <sys_getlockstat+0x50>
+    return -1;
+  return getlockstat(st, n);
+80108acc:	83 ec 08             	sub    $0x8,%esp
+80108acf:	ff 75 f4             	push   -0xc(%ebp)
+80108ad2:	ff 75 f0             	push   -0x10(%ebp)
+80108ad5:	e8 f6 e0 ff ff       	call   80106bd0 <getlockstat>
+80108ada:	83 c4 10             	add    $0x10,%esp
+}
+80108add:	c9                   	leave
+80108ade:	c3                   	ret
+80108adf:	90                   	nop
+80108ae0:	c9                   	leave
+    return -1;
+80108ae1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108ae6:	c3                   	ret
+80108ae7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108aee:	66 90                	xchg   %ax,%ax
+
+80108af0 <sys_lockprof>:
+
+// Turn lock profiling on (nonzero) or off.
+int
+sys_lockprof(void)
+{
+80108af0:	55                   	push   %ebp
+80108af1:	89 e5                	mov    %esp,%ebp
+80108af3:	83 ec 20             	sub    $0x20,%esp
+  int on;
+
+  if(argint(0, &on) < 0)
+80108af6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108af9:	50                   	push   %eax
+80108afa:	6a 00                	push   $0x0
+80108afc:	e8 2f ed ff ff       	call   80107830 <argint>
+80108b01:	83 c4 10             	add    $0x10,%esp
+80108b04:	85 c0                	test   %eax,%eax
+80108b06:	78 20                	js     80108b28 <sys_lockprof+0x38>
+    return -1;
+  lockprof(on != 0);
+80108b08:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80108b0b:	83 ec 0c             	sub    $0xc,%esp
+80108b0e:	31 c0                	xor    %eax,%eax
+80108b10:	85 d2                	test   %edx,%edx
+80108b12:	0f 95 c0             	setne  %al
+80108b15:	50                   	push   %eax
+80108b16:	e8 15 e2 ff ff       	call   80106d30 <lockprof>
+  return 0;
+80108b1b:	83 c4 10             	add    $0x10,%esp
+80108b1e:	31 c0                	xor    %eax,%eax
+}
+80108b20:	c9                   	leave
+80108b21:	c3                   	ret
+80108b22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80108b28:	c9                   	leave
+    return -1;
+80108b29:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108b2e:	c3                   	ret
+80108b2f:	90                   	nop
+
+80108b30 <sys_getlockprof>:
+
+// int getlockprof(struct locksite *s, int n)
+int
+sys_getlockprof(void)
+{
+80108b30:	55                   	push   %ebp
+80108b31:	89 e5                	mov    %esp,%ebp
+80108b33:	83 ec 20             	sub    $0x20,%esp
+  struct locksite *s;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0 || n > NLOCKSITE ||
+80108b36:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108b39:	50                   	push   %eax
+80108b3a:	6a 01                	push   $0x1
+80108b3c:	e8 ef ec ff ff       	call   80107830 <argint>
+80108b41:	83 c4 10             	add    $0x10,%esp
+80108b44:	85 c0                	test   %eax,%eax
+80108b46:	78 40                	js     80108b88 <sys_getlockprof+0x58>
+80108b48:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108b4b:	3d 00 01 00 00       	cmp    $0x100,%eax
+80108b50:	77 36                	ja     80108b88 <sys_getlockprof+0x58>
+     argptr(0, (void*)&s, n*sizeof(*s)) < 0)
+80108b52:	69 c0 2c 01 00 00    	imul   $0x12c,%eax,%eax
+80108b58:	83 ec 04             	sub    $0x4,%esp
+80108b5b:	50                   	push   %eax
+80108b5c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108b5f:	50                   	push   %eax
+80108b60:	6a 00                	push   $0x0
+80108b62:	e8 19 ed ff ff       	call   80107880 <argptr>
+  if(argint(1, &n) < 0 || n < 0 || n > NLOCKSITE ||
+80108b67:	83 c4 10             	add    $0x10,%esp
+80108b6a:	85 c0                	test   %eax,%eax
+80108b6c:	78 1a                	js     80108b88 <sys_getlockprof+0x58>
+    return -1;
+  return getlockprof(s, n);
+80108b6e:	83 ec 08             	sub    $0x8,%esp
+80108b71:	ff 75 f4             	push   -0xc(%ebp)
+80108b74:	ff 75 f0             	push   -0x10(%ebp)
+80108b77:	e8 34 e2 ff ff       	call   80106db0 <getlockprof>
+80108b7c:	83 c4 10             	add    $0x10,%esp
+}
+80108b7f:	c9                   	leave
+80108b80:	c3                   	ret
+80108b81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108b88:	c9                   	leave
+    return -1;
+80108b89:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108b8e:	c3                   	ret
+80108b8f:	90                   	nop
+
+80108b90 <sys_setaffinity>:
+
+// Restrict a process (pid 0 means the caller) to a mask of CPUs.
+int
+sys_setaffinity(void)
+{
+80108b90:	55                   	push   %ebp
+80108b91:	89 e5                	mov    %esp,%ebp
+80108b93:	83 ec 20             	sub    $0x20,%esp
+  int pid, mask;
+
+  if(argint(0, &pid) < 0 || argint(1, &mask) < 0)
+80108b96:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108b99:	50                   	push   %eax
+80108b9a:	6a 00                	push   $0x0
+80108b9c:	e8 8f ec ff ff       	call   80107830 <argint>
+80108ba1:	83 c4 10             	add    $0x10,%esp
+80108ba4:	85 c0                	test   %eax,%eax
+80108ba6:	78 40                	js     80108be8 <sys_setaffinity+0x58>
+80108ba8:	83 ec 08             	sub    $0x8,%esp
+80108bab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108bae:	50                   	push   %eax
+80108baf:	6a 01                	push   $0x1
+80108bb1:	e8 7a ec ff ff       	call   80107830 <argint>
+80108bb6:	83 c4 10             	add    $0x10,%esp
+80108bb9:	85 c0                	test   %eax,%eax
+80108bbb:	78 2b                	js     80108be8 <sys_setaffinity+0x58>
+    return -1;
+  if(pid == 0)
+80108bbd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+80108bc0:	85 c0                	test   %eax,%eax
+80108bc2:	74 14                	je     80108bd8 <sys_setaffinity+0x48>
+    pid = myproc()->pid;
+  return setaffinity(pid, mask);
+80108bc4:	83 ec 08             	sub    $0x8,%esp
+80108bc7:	ff 75 f4             	push   -0xc(%ebp)
+80108bca:	50                   	push   %eax
+80108bcb:	e8 60 d6 ff ff       	call   80106230 <setaffinity>
+80108bd0:	83 c4 10             	add    $0x10,%esp
+}
+80108bd3:	c9                   	leave
+80108bd4:	c3                   	ret
+80108bd5:	8d 76 00             	lea    0x0(%esi),%esi
+    pid = myproc()->pid;
+80108bd8:	e8 13 ca ff ff       	call   801055f0 <myproc>
+80108bdd:	8b 40 10             	mov    0x10(%eax),%eax
+80108be0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+80108be3:	eb df                	jmp    80108bc4 <sys_setaffinity+0x34>
+80108be5:	8d 76 00             	lea    0x0(%esi),%esi
+}
+80108be8:	c9                   	leave
+    return -1;
+80108be9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108bee:	c3                   	ret
+80108bef:	90                   	nop
+
+80108bf0 <sys_getaffinity>:
+
+// Return the CPU mask of a process (pid 0 means the caller).
+int
+sys_getaffinity(void)
+{
+80108bf0:	55                   	push   %ebp
+80108bf1:	89 e5                	mov    %esp,%ebp
+80108bf3:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+
+  if(argint(0, &pid) < 0)
+80108bf6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108bf9:	50                   	push   %eax
+80108bfa:	6a 00                	push   $0x0
+80108bfc:	e8 2f ec ff ff       	call   80107830 <argint>
+80108c01:	83 c4 10             	add    $0x10,%esp
+80108c04:	85 c0                	test   %eax,%eax
+80108c06:	78 25                	js     80108c2d <sys_getaffinity+0x3d>
+    return -1;
+  if(pid == 0)
+80108c08:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108c0b:	85 c0                	test   %eax,%eax
+80108c0d:	74 11                	je     80108c20 <sys_getaffinity+0x30>
+    pid = myproc()->pid;
+  return getaffinity(pid);
+80108c0f:	83 ec 0c             	sub    $0xc,%esp
+80108c12:	50                   	push   %eax
+80108c13:	e8 e8 d6 ff ff       	call   80106300 <getaffinity>
+80108c18:	83 c4 10             	add    $0x10,%esp
+}
+80108c1b:	c9                   	leave
+80108c1c:	c3                   	ret
+80108c1d:	8d 76 00             	lea    0x0(%esi),%esi
+    pid = myproc()->pid;
+80108c20:	e8 cb c9 ff ff       	call   801055f0 <myproc>
+80108c25:	8b 40 10             	mov    0x10(%eax),%eax
+80108c28:	89 45 f4             	mov    %eax,-0xc(%ebp)
+80108c2b:	eb e2                	jmp    80108c0f <sys_getaffinity+0x1f>
+}
+80108c2d:	c9                   	leave
+    return -1;
+80108c2e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108c33:	c3                   	ret
+80108c34:	66 90                	xchg   %ax,%ax
+80108c36:	66 90                	xchg   %ax,%ax
+80108c38:	66 90                	xchg   %ax,%ax
+80108c3a:	66 90                	xchg   %ax,%ax
+80108c3c:	66 90                	xchg   %ax,%ax
+80108c3e:	66 90                	xchg   %ax,%ax
+
+80108c40 <timerinit>:
+char uclockpage[PGSIZE] __attribute__((aligned(PGSIZE)));
+#define uclock ((struct uclock*)uclockpage)
+
+void
+timerinit(void)
+{
+80108c40:	55                   	push   %ebp
+80108c41:	89 e5                	mov    %esp,%ebp
+80108c43:	56                   	push   %esi
+80108c44:	53                   	push   %ebx
+  struct cputimer *t;
+  uint rem;
+
+  if(cpuid() == 0 && tscperiod > ((uint64)(1000000000/HZ) << TSCSHIFT) >> 32){
+80108c45:	e8 76 c9 ff ff       	call   801055c0 <cpuid>
+80108c4a:	85 c0                	test   %eax,%eax
+80108c4c:	75 12                	jne    80108c60 <timerinit+0x20>
+80108c4e:	8b 0d 30 3a 1a 80    	mov    0x801a3a30,%ecx
+80108c54:	81 f9 96 98 00 00    	cmp    $0x9896,%ecx
+80108c5a:	0f 87 80 00 00 00    	ja     80108ce0 <timerinit+0xa0>
+    uclock->tscmult = divl((uint64)(1000000000/HZ) << TSCSHIFT, tscperiod, &rem);
+    uclock->tscbase = rdtsc();
+  }
+
+  t = &cputimer[cpuid()];
+80108c60:	e8 5b c9 ff ff       	call   801055c0 <cpuid>
+  initlock(&t->lock, "timer");
+80108c65:	83 ec 08             	sub    $0x8,%esp
+  t = &cputimer[cpuid()];
+80108c68:	6b f0 70             	imul   $0x70,%eax,%esi
+  initlock(&t->lock, "timer");
+80108c6b:	68 b5 bd 10 80       	push   $0x8010bdb5
+  t = &cputimer[cpuid()];
+80108c70:	89 c3                	mov    %eax,%ebx
+80108c72:	81 c6 00 e0 1b 80    	add    $0x801be000,%esi
+  initlock(&t->lock, "timer");
+80108c78:	56                   	push   %esi
+80108c79:	e8 e2 dc ff ff       	call   80106960 <initlock>
+  acquire(&t->lock);
+80108c7e:	89 34 24             	mov    %esi,(%esp)
+80108c81:	e8 ea e3 ff ff       	call   80107070 <acquire>
+  t->nexttick = lapicperiod;
+80108c86:	8b 15 34 3a 1a 80    	mov    0x801a3a34,%edx
+  if(t->hrq && (int)(t->hrq->twhen - next) < 0)
+80108c8c:	8b 46 6c             	mov    0x6c(%esi),%eax
+80108c8f:	83 c4 10             	add    $0x10,%esp
+  t->nexttick = lapicperiod;
+80108c92:	89 56 68             	mov    %edx,0x68(%esi)
+  if(t->hrq && (int)(t->hrq->twhen - next) < 0)
+80108c95:	85 c0                	test   %eax,%eax
+80108c97:	74 0b                	je     80108ca4 <timerinit+0x64>
+80108c99:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+    next = t->hrq->twhen;
+80108c9f:	39 d0                	cmp    %edx,%eax
+80108ca1:	0f 48 d0             	cmovs  %eax,%edx
+    next = now + 1;
+80108ca4:	85 d2                	test   %edx,%edx
+80108ca6:	b8 01 00 00 00       	mov    $0x1,%eax
+80108cab:	0f 4e d0             	cmovle %eax,%edx
+  t->now = now;
+80108cae:	6b c3 70             	imul   $0x70,%ebx,%eax
+  lapicarm(t->armed);
+80108cb1:	83 ec 0c             	sub    $0xc,%esp
+  t->now = now;
+80108cb4:	c7 80 60 e0 1b 80 00 	movl   $0x0,-0x7fe41fa0(%eax)
+80108cbb:	00 00 00 
+  t->armed = next - now;
+80108cbe:	89 90 64 e0 1b 80    	mov    %edx,-0x7fe41f9c(%eax)
+  lapicarm(t->armed);
+80108cc4:	52                   	push   %edx
+80108cc5:	e8 c6 b1 ff ff       	call   80103e90 <lapicarm>
+  tarm(t, 0);
+  release(&t->lock);
+80108cca:	89 34 24             	mov    %esi,(%esp)
+80108ccd:	e8 2e e2 ff ff       	call   80106f00 <release>
+}
+80108cd2:	83 c4 10             	add    $0x10,%esp
+80108cd5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108cd8:	5b                   	pop    %ebx
+80108cd9:	5e                   	pop    %esi
+80108cda:	5d                   	pop    %ebp
+80108cdb:	c3                   	ret
+80108cdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  asm("divl %4" : "=a" (q), "=d" (r) : "a" ((uint)n), "d" ((uint)(n>>32)), "rm" (d));
+80108ce0:	b8 00 00 00 80       	mov    $0x80000000,%eax
+80108ce5:	ba 96 98 00 00       	mov    $0x9896,%edx
+80108cea:	f7 f1                	div    %ecx
+    uclock->tscmult = divl((uint64)(1000000000/HZ) << TSCSHIFT, tscperiod, &rem);
+80108cec:	a3 08 d0 1b 80       	mov    %eax,0x801bd008
+  asm volatile("rdtsc" : "=A" (tsc));
+80108cf1:	0f 31                	rdtsc
+    uclock->tscbase = rdtsc();
+80108cf3:	a3 0c d0 1b 80       	mov    %eax,0x801bd00c
+80108cf8:	89 15 10 d0 1b 80    	mov    %edx,0x801bd010
+80108cfe:	e9 5d ff ff ff       	jmp    80108c60 <timerinit+0x20>
+80108d03:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108d0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80108d10 <clockread>:
+
+// Read the monotonic clock.  Falls back to ticks
+// if the TSC could not be calibrated.
+void
+clockread(struct timespec *ts)
+{
+80108d10:	55                   	push   %ebp
+80108d11:	89 e5                	mov    %esp,%ebp
+80108d13:	57                   	push   %edi
+80108d14:	56                   	push   %esi
+80108d15:	53                   	push   %ebx
+80108d16:	83 ec 1c             	sub    $0x1c,%esp
+  uint t;
+
+  if(uclock->tscmult == 0){
+80108d19:	8b 0d 08 d0 1b 80    	mov    0x801bd008,%ecx
+{
+80108d1f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(uclock->tscmult == 0){
+80108d22:	85 c9                	test   %ecx,%ecx
+80108d24:	74 5a                	je     80108d80 <clockread+0x70>
+80108d26:	0f 31                	rdtsc
+static inline void
+uclockread(struct uclock *c, uint64 tsc, struct timespec *ts)
+{
+  uint64 d, ns;
+
+  d = tsc - c->tscbase;
+80108d28:	2b 05 0c d0 1b 80    	sub    0x801bd00c,%eax
+80108d2e:	1b 15 10 d0 1b 80    	sbb    0x801bd010,%edx
+80108d34:	89 c6                	mov    %eax,%esi
+  if((long long)d < 0)  // another CPU's TSC is a little behind
+80108d36:	85 d2                	test   %edx,%edx
+80108d38:	78 3e                	js     80108d78 <clockread+0x68>
+    d = 0;
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+80108d3a:	89 d0                	mov    %edx,%eax
+80108d3c:	f7 e1                	mul    %ecx
+80108d3e:	0f a4 c2 08          	shld   $0x8,%eax,%edx
+80108d42:	c1 e0 08             	shl    $0x8,%eax
+80108d45:	89 45 e0             	mov    %eax,-0x20(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+80108d48:	89 f0                	mov    %esi,%eax
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+80108d4a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+80108d4d:	f7 e1                	mul    %ecx
+80108d4f:	0f ac d0 18          	shrd   $0x18,%edx,%eax
+80108d53:	c1 ea 18             	shr    $0x18,%edx
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+80108d56:	03 45 e0             	add    -0x20(%ebp),%eax
+80108d59:	13 55 e4             	adc    -0x1c(%ebp),%edx
+  asm("divl %4" : "=a" (q), "=d" (r) : "a" ((uint)n), "d" ((uint)(n>>32)), "rm" (d));
+80108d5c:	89 c7                	mov    %eax,%edi
+80108d5e:	89 f8                	mov    %edi,%eax
+80108d60:	b9 00 ca 9a 3b       	mov    $0x3b9aca00,%ecx
+80108d65:	f7 f1                	div    %ecx
+  *rem = r;
+80108d67:	89 53 04             	mov    %edx,0x4(%ebx)
+  ts->sec = divl(ns, 1000000000, &ts->nsec);
+80108d6a:	89 03                	mov    %eax,(%ebx)
+    ts->sec = t / HZ;
+    ts->nsec = (t % HZ) * (1000000000/HZ);
+    return;
+  }
+  uclockread(uclock, rdtsc(), ts);
+}
+80108d6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108d6f:	5b                   	pop    %ebx
+80108d70:	5e                   	pop    %esi
+80108d71:	5f                   	pop    %edi
+80108d72:	5d                   	pop    %ebp
+80108d73:	c3                   	ret
+80108d74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108d78:	31 d2                	xor    %edx,%edx
+80108d7a:	31 ff                	xor    %edi,%edi
+80108d7c:	eb e0                	jmp    80108d5e <clockread+0x4e>
+80108d7e:	66 90                	xchg   %ax,%ax
+    acquire(&tickslock);
+80108d80:	83 ec 0c             	sub    $0xc,%esp
+80108d83:	68 a0 e4 1b 80       	push   $0x801be4a0
+80108d88:	e8 e3 e2 ff ff       	call   80107070 <acquire>
+    t = ticks;
+80108d8d:	8b 35 80 e4 1b 80    	mov    0x801be480,%esi
+    release(&tickslock);
+80108d93:	c7 04 24 a0 e4 1b 80 	movl   $0x801be4a0,(%esp)
+80108d9a:	e8 61 e1 ff ff       	call   80106f00 <release>
+    ts->sec = t / HZ;
+80108d9f:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    return;
+80108da4:	83 c4 10             	add    $0x10,%esp
+    ts->sec = t / HZ;
+80108da7:	f7 e6                	mul    %esi
+80108da9:	c1 ea 05             	shr    $0x5,%edx
+80108dac:	89 13                	mov    %edx,(%ebx)
+    ts->nsec = (t % HZ) * (1000000000/HZ);
+80108dae:	6b d2 64             	imul   $0x64,%edx,%edx
+80108db1:	29 d6                	sub    %edx,%esi
+80108db3:	69 f6 80 96 98 00    	imul   $0x989680,%esi,%esi
+80108db9:	89 73 04             	mov    %esi,0x4(%ebx)
+}
+80108dbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108dbf:	5b                   	pop    %ebx
+80108dc0:	5e                   	pop    %esi
+80108dc1:	5f                   	pop    %edi
+80108dc2:	5d                   	pop    %ebp
+80108dc3:	c3                   	ret
+80108dc4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108dcb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108dcf:	90                   	nop
+
+80108dd0 <tsleep>:
+// Sleep until ticks reaches deadline.
+// Caller must hold tickslock.
+// Returns -1 if killed first.
+int
+tsleep(uint deadline)
+{
+80108dd0:	55                   	push   %ebp
+80108dd1:	89 e5                	mov    %esp,%ebp
+80108dd3:	57                   	push   %edi
+80108dd4:	56                   	push   %esi
+80108dd5:	53                   	push   %ebx
+80108dd6:	83 ec 1c             	sub    $0x1c,%esp
+80108dd9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *p = myproc();
+80108ddc:	e8 0f c8 ff ff       	call   801055f0 <myproc>
+
+  while((int)(deadline - ticks) > 0){
+    if(p->killed)
+      return -1;
+    p->twhen = deadline;
+    pp = &wheel.slot[deadline % NWHEEL];
+80108de1:	89 de                	mov    %ebx,%esi
+  struct proc *p = myproc();
+80108de3:	89 c7                	mov    %eax,%edi
+    pp = &wheel.slot[deadline % NWHEEL];
+80108de5:	83 e6 3f             	and    $0x3f,%esi
+80108de8:	8d 04 b5 80 e3 1b 80 	lea    -0x7fe41c80(,%esi,4),%eax
+80108def:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    p->tnext = *pp;
+    *pp = p;
+    sleep(&p->twhen, &tickslock);
+80108df2:	8d 87 98 00 00 00    	lea    0x98(%edi),%eax
+80108df8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80108dfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108dff:	90                   	nop
+  while((int)(deadline - ticks) > 0){
+80108e00:	89 d8                	mov    %ebx,%eax
+80108e02:	2b 05 80 e4 1b 80    	sub    0x801be480,%eax
+80108e08:	85 c0                	test   %eax,%eax
+80108e0a:	7e 6e                	jle    80108e7a <tsleep+0xaa>
+    if(p->killed)
+80108e0c:	8b 47 2c             	mov    0x2c(%edi),%eax
+80108e0f:	85 c0                	test   %eax,%eax
+80108e11:	75 76                	jne    80108e89 <tsleep+0xb9>
+    p->twhen = deadline;
+80108e13:	89 9f 98 00 00 00    	mov    %ebx,0x98(%edi)
+    p->tnext = *pp;
+80108e19:	8b 04 b5 80 e3 1b 80 	mov    -0x7fe41c80(,%esi,4),%eax
+    sleep(&p->twhen, &tickslock);
+80108e20:	83 ec 08             	sub    $0x8,%esp
+    p->tnext = *pp;
+80108e23:	89 87 9c 00 00 00    	mov    %eax,0x9c(%edi)
+    *pp = p;
+80108e29:	89 3c b5 80 e3 1b 80 	mov    %edi,-0x7fe41c80(,%esi,4)
+    sleep(&p->twhen, &tickslock);
+80108e30:	68 a0 e4 1b 80       	push   $0x801be4a0
+80108e35:	ff 75 e4             	push   -0x1c(%ebp)
+80108e38:	e8 03 d2 ff ff       	call   80106040 <sleep>
+    pp = &wheel.slot[deadline % NWHEEL];
+80108e3d:	8b 04 b5 80 e3 1b 80 	mov    -0x7fe41c80(,%esi,4),%eax
+  for(; *pp; pp = &(*pp)->tnext){
+80108e44:	83 c4 10             	add    $0x10,%esp
+80108e47:	85 c0                	test   %eax,%eax
+80108e49:	74 b5                	je     80108e00 <tsleep+0x30>
+    if(*pp == p){
+80108e4b:	39 c7                	cmp    %eax,%edi
+80108e4d:	74 35                	je     80108e84 <tsleep+0xb4>
+80108e4f:	90                   	nop
+  for(; *pp; pp = &(*pp)->tnext){
+80108e50:	89 c2                	mov    %eax,%edx
+80108e52:	8b 80 9c 00 00 00    	mov    0x9c(%eax),%eax
+80108e58:	85 c0                	test   %eax,%eax
+80108e5a:	74 a4                	je     80108e00 <tsleep+0x30>
+    if(*pp == p){
+80108e5c:	39 c7                	cmp    %eax,%edi
+80108e5e:	75 f0                	jne    80108e50 <tsleep+0x80>
+  for(; *pp; pp = &(*pp)->tnext){
+80108e60:	81 c2 9c 00 00 00    	add    $0x9c,%edx
+      *pp = p->tnext;
+80108e66:	8b 87 9c 00 00 00    	mov    0x9c(%edi),%eax
+80108e6c:	89 02                	mov    %eax,(%edx)
+  while((int)(deadline - ticks) > 0){
+80108e6e:	89 d8                	mov    %ebx,%eax
+80108e70:	2b 05 80 e4 1b 80    	sub    0x801be480,%eax
+80108e76:	85 c0                	test   %eax,%eax
+80108e78:	7f 92                	jg     80108e0c <tsleep+0x3c>
+    // The clock takes p off the wheel when it wakes it;
+    // a kill() leaves it there.
+    tremove(&wheel.slot[deadline % NWHEEL], p);
+  }
+  return 0;
+}
+80108e7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+80108e7d:	31 c0                	xor    %eax,%eax
+}
+80108e7f:	5b                   	pop    %ebx
+80108e80:	5e                   	pop    %esi
+80108e81:	5f                   	pop    %edi
+80108e82:	5d                   	pop    %ebp
+80108e83:	c3                   	ret
+    if(*pp == p){
+80108e84:	8b 55 e0             	mov    -0x20(%ebp),%edx
+80108e87:	eb dd                	jmp    80108e66 <tsleep+0x96>
+}
+80108e89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+80108e8c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108e91:	5b                   	pop    %ebx
+80108e92:	5e                   	pop    %esi
+80108e93:	5f                   	pop    %edi
+80108e94:	5d                   	pop    %ebp
+80108e95:	c3                   	ret
+80108e96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108e9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80108ea0 <hrsleep>:
+
+// Sleep for ns nanoseconds (less than HRMAX) on this
+// CPU's one-shot timer.  Returns -1 if killed first.
+int
+hrsleep(uint ns)
+{
+80108ea0:	55                   	push   %ebp
+80108ea1:	89 e5                	mov    %esp,%ebp
+80108ea3:	57                   	push   %edi
+80108ea4:	56                   	push   %esi
+80108ea5:	53                   	push   %ebx
+80108ea6:	83 ec 2c             	sub    $0x2c,%esp
+  struct proc *p = myproc();
+80108ea9:	e8 42 c7 ff ff       	call   801055f0 <myproc>
+80108eae:	89 c3                	mov    %eax,%ebx
+  struct cputimer *t;
+  struct proc **pp;
+
+  pushcli();  // stay on this CPU until the lock is held
+80108eb0:	e8 5b df ff ff       	call   80106e10 <pushcli>
+  t = &cputimer[cpuid()];
+80108eb5:	e8 06 c7 ff ff       	call   801055c0 <cpuid>
+  acquire(&t->lock);
+80108eba:	83 ec 0c             	sub    $0xc,%esp
+80108ebd:	6b f8 70             	imul   $0x70,%eax,%edi
+  t = &cputimer[cpuid()];
+80108ec0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80108ec3:	8d b7 00 e0 1b 80    	lea    -0x7fe42000(%edi),%esi
+  acquire(&t->lock);
+80108ec9:	56                   	push   %esi
+80108eca:	e8 a1 e1 ff ff       	call   80107070 <acquire>
+  popcli();
+80108ecf:	e8 8c df ff ff       	call   80106e60 <popcli>
+  return t->now + (t->armed - lapiccount());
+80108ed4:	8b 4e 64             	mov    0x64(%esi),%ecx
+80108ed7:	8b 46 60             	mov    0x60(%esi),%eax
+80108eda:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+80108edd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80108ee0:	e8 db af ff ff       	call   80103ec0 <lapiccount>
+  n = (ns/1000)*perus + (ns%1000)*perus/1000;
+80108ee5:	83 c4 10             	add    $0x10,%esp
+  return t->now + (t->armed - lapiccount());
+80108ee8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  perus = lapicperiod / (1000000/HZ);
+80108eeb:	b8 59 17 b7 d1       	mov    $0xd1b71759,%eax
+80108ef0:	f7 25 34 3a 1a 80    	mull   0x801a3a34
+  n = (ns/1000)*perus + (ns%1000)*perus/1000;
+80108ef6:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+  perus = lapicperiod / (1000000/HZ);
+80108efb:	c1 ea 0d             	shr    $0xd,%edx
+80108efe:	89 d1                	mov    %edx,%ecx
+  n = (ns/1000)*perus + (ns%1000)*perus/1000;
+80108f00:	f7 65 08             	mull   0x8(%ebp)
+80108f03:	c1 ea 06             	shr    $0x6,%edx
+80108f06:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+80108f0c:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+80108f0f:	8b 55 08             	mov    0x8(%ebp),%edx
+80108f12:	29 c2                	sub    %eax,%edx
+80108f14:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+80108f19:	0f af d1             	imul   %ecx,%edx
+80108f1c:	f7 e2                	mul    %edx
+80108f1e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80108f21:	0f af c8             	imul   %eax,%ecx
+80108f24:	b8 01 00 00 00       	mov    $0x1,%eax
+80108f29:	c1 ea 06             	shr    $0x6,%edx
+80108f2c:	01 ca                	add    %ecx,%edx
+80108f2e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+80108f31:	0f 44 d0             	cmove  %eax,%edx
+80108f34:	8b 45 e0             	mov    -0x20(%ebp),%eax
+
+  p->twhen = tnow(t) + nstocount(ns);
+  for(pp = &t->hrq; *pp; pp = &(*pp)->tnext)
+80108f37:	81 c7 6c e0 1b 80    	add    $0x801be06c,%edi
+80108f3d:	89 7d e0             	mov    %edi,-0x20(%ebp)
+80108f40:	01 c8                	add    %ecx,%eax
+  p->twhen = tnow(t) + nstocount(ns);
+80108f42:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+80108f45:	01 c2                	add    %eax,%edx
+80108f47:	89 d0                	mov    %edx,%eax
+80108f49:	29 c8                	sub    %ecx,%eax
+80108f4b:	89 83 98 00 00 00    	mov    %eax,0x98(%ebx)
+  for(pp = &t->hrq; *pp; pp = &(*pp)->tnext)
+80108f51:	8b 46 6c             	mov    0x6c(%esi),%eax
+80108f54:	85 c0                	test   %eax,%eax
+80108f56:	0f 84 71 01 00 00    	je     801090cd <hrsleep+0x22d>
+80108f5c:	29 d1                	sub    %edx,%ecx
+80108f5e:	eb 10                	jmp    80108f70 <hrsleep+0xd0>
+80108f60:	8d b8 9c 00 00 00    	lea    0x9c(%eax),%edi
+80108f66:	8b 80 9c 00 00 00    	mov    0x9c(%eax),%eax
+80108f6c:	85 c0                	test   %eax,%eax
+80108f6e:	74 0c                	je     80108f7c <hrsleep+0xdc>
+    if((int)((*pp)->twhen - p->twhen) > 0)
+80108f70:	8b 90 98 00 00 00    	mov    0x98(%eax),%edx
+80108f76:	01 ca                	add    %ecx,%edx
+80108f78:	85 d2                	test   %edx,%edx
+80108f7a:	7e e4                	jle    80108f60 <hrsleep+0xc0>
+      break;
+  p->tnext = *pp;
+80108f7c:	89 83 9c 00 00 00    	mov    %eax,0x9c(%ebx)
+  *pp = p;
+80108f82:	89 1f                	mov    %ebx,(%edi)
+  if(t->hrq == p)
+80108f84:	6b 7d e4 70          	imul   $0x70,-0x1c(%ebp),%edi
+80108f88:	81 c7 00 e0 1b 80    	add    $0x801be000,%edi
+80108f8e:	8b 47 6c             	mov    0x6c(%edi),%eax
+80108f91:	39 d8                	cmp    %ebx,%eax
+80108f93:	0f 84 b6 00 00 00    	je     8010904f <hrsleep+0x1af>
+    tarm(t, tnow(t));
+
+  // timerintr() dequeues p when its time comes.  p may
+  // wake up on another CPU, but t->lock still guards t->hrq.
+  for(;;){
+    if(p->killed){
+80108f99:	8b 4b 2c             	mov    0x2c(%ebx),%ecx
+80108f9c:	85 c9                	test   %ecx,%ecx
+80108f9e:	0f 85 31 01 00 00    	jne    801090d5 <hrsleep+0x235>
+  for(pp = &t->hrq; *pp; pp = &(*pp)->tnext)
+80108fa4:	6b 7d e4 70          	imul   $0x70,-0x1c(%ebp),%edi
+80108fa8:	81 c7 00 e0 1b 80    	add    $0x801be000,%edi
+      tremove(&t->hrq, p);
+      release(&t->lock);
+      return -1;
+    }
+    for(pp = &t->hrq; *pp && *pp != p; pp = &(*pp)->tnext)
+80108fae:	eb 0a                	jmp    80108fba <hrsleep+0x11a>
+80108fb0:	39 c3                	cmp    %eax,%ebx
+80108fb2:	74 24                	je     80108fd8 <hrsleep+0x138>
+80108fb4:	8b 80 9c 00 00 00    	mov    0x9c(%eax),%eax
+80108fba:	85 c0                	test   %eax,%eax
+80108fbc:	75 f2                	jne    80108fb0 <hrsleep+0x110>
+      ;
+    if(*pp == 0)
+      break;
+    sleep(&p->twhen, &t->lock);
+  }
+  release(&t->lock);
+80108fbe:	83 ec 0c             	sub    $0xc,%esp
+80108fc1:	56                   	push   %esi
+80108fc2:	e8 39 df ff ff       	call   80106f00 <release>
+  return 0;
+80108fc7:	83 c4 10             	add    $0x10,%esp
+}
+80108fca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+80108fcd:	31 c0                	xor    %eax,%eax
+}
+80108fcf:	5b                   	pop    %ebx
+80108fd0:	5e                   	pop    %esi
+80108fd1:	5f                   	pop    %edi
+80108fd2:	5d                   	pop    %ebp
+80108fd3:	c3                   	ret
+80108fd4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    sleep(&p->twhen, &t->lock);
+80108fd8:	83 ec 08             	sub    $0x8,%esp
+80108fdb:	8d 83 98 00 00 00    	lea    0x98(%ebx),%eax
+80108fe1:	56                   	push   %esi
+80108fe2:	50                   	push   %eax
+80108fe3:	e8 58 d0 ff ff       	call   80106040 <sleep>
+    if(p->killed){
+80108fe8:	8b 43 2c             	mov    0x2c(%ebx),%eax
+80108feb:	83 c4 10             	add    $0x10,%esp
+80108fee:	85 c0                	test   %eax,%eax
+80108ff0:	75 05                	jne    80108ff7 <hrsleep+0x157>
+  for(pp = &t->hrq; *pp; pp = &(*pp)->tnext)
+80108ff2:	8b 47 6c             	mov    0x6c(%edi),%eax
+80108ff5:	eb c3                	jmp    80108fba <hrsleep+0x11a>
+80108ff7:	6b 45 e4 70          	imul   $0x70,-0x1c(%ebp),%eax
+80108ffb:	8b 80 6c e0 1b 80    	mov    -0x7fe41f94(%eax),%eax
+  for(; *pp; pp = &(*pp)->tnext){
+80109001:	85 c0                	test   %eax,%eax
+80109003:	74 1b                	je     80109020 <hrsleep+0x180>
+    if(*pp == p){
+80109005:	39 c3                	cmp    %eax,%ebx
+80109007:	75 0b                	jne    80109014 <hrsleep+0x174>
+80109009:	eb 37                	jmp    80109042 <hrsleep+0x1a2>
+8010900b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010900f:	90                   	nop
+80109010:	39 c3                	cmp    %eax,%ebx
+80109012:	74 25                	je     80109039 <hrsleep+0x199>
+  for(; *pp; pp = &(*pp)->tnext){
+80109014:	89 c2                	mov    %eax,%edx
+80109016:	8b 80 9c 00 00 00    	mov    0x9c(%eax),%eax
+8010901c:	85 c0                	test   %eax,%eax
+8010901e:	75 f0                	jne    80109010 <hrsleep+0x170>
+      release(&t->lock);
+80109020:	83 ec 0c             	sub    $0xc,%esp
+80109023:	56                   	push   %esi
+80109024:	e8 d7 de ff ff       	call   80106f00 <release>
+      return -1;
+80109029:	83 c4 10             	add    $0x10,%esp
+}
+8010902c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010902f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80109034:	5b                   	pop    %ebx
+80109035:	5e                   	pop    %esi
+80109036:	5f                   	pop    %edi
+80109037:	5d                   	pop    %ebp
+80109038:	c3                   	ret
+  for(; *pp; pp = &(*pp)->tnext){
+80109039:	8d 82 9c 00 00 00    	lea    0x9c(%edx),%eax
+8010903f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      *pp = p->tnext;
+80109042:	8b 83 9c 00 00 00    	mov    0x9c(%ebx),%eax
+80109048:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+8010904b:	89 01                	mov    %eax,(%ecx)
+      return 1;
+8010904d:	eb d1                	jmp    80109020 <hrsleep+0x180>
+  return t->now + (t->armed - lapiccount());
+8010904f:	8b 4f 64             	mov    0x64(%edi),%ecx
+80109052:	8b 47 60             	mov    0x60(%edi),%eax
+80109055:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+80109058:	89 45 dc             	mov    %eax,-0x24(%ebp)
+8010905b:	e8 60 ae ff ff       	call   80103ec0 <lapiccount>
+80109060:	8b 55 d8             	mov    -0x28(%ebp),%edx
+80109063:	89 c1                	mov    %eax,%ecx
+80109065:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80109068:	01 d0                	add    %edx,%eax
+  if(t->hrq && (int)(t->hrq->twhen - next) < 0)
+8010906a:	8b 57 6c             	mov    0x6c(%edi),%edx
+8010906d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  return t->now + (t->armed - lapiccount());
+80109070:	29 c8                	sub    %ecx,%eax
+80109072:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  next = t->nexttick;
+80109075:	8b 47 68             	mov    0x68(%edi),%eax
+  if(t->hrq && (int)(t->hrq->twhen - next) < 0)
+80109078:	85 d2                	test   %edx,%edx
+8010907a:	74 0b                	je     80109087 <hrsleep+0x1e7>
+8010907c:	8b 92 98 00 00 00    	mov    0x98(%edx),%edx
+    next = t->hrq->twhen;
+80109082:	39 c2                	cmp    %eax,%edx
+80109084:	0f 48 c2             	cmovs  %edx,%eax
+  if((int)(next - now) <= 0)
+80109087:	8b 7d d8             	mov    -0x28(%ebp),%edi
+8010908a:	29 f9                	sub    %edi,%ecx
+8010908c:	01 c1                	add    %eax,%ecx
+8010908e:	b8 01 00 00 00       	mov    $0x1,%eax
+80109093:	85 c9                	test   %ecx,%ecx
+80109095:	0f 4e c8             	cmovle %eax,%ecx
+  t->now = now;
+80109098:	6b 7d e4 70          	imul   $0x70,-0x1c(%ebp),%edi
+8010909c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  lapicarm(t->armed);
+8010909f:	83 ec 0c             	sub    $0xc,%esp
+  t->now = now;
+801090a2:	89 87 60 e0 1b 80    	mov    %eax,-0x7fe41fa0(%edi)
+  t->armed = next - now;
+801090a8:	89 8f 64 e0 1b 80    	mov    %ecx,-0x7fe41f9c(%edi)
+  lapicarm(t->armed);
+801090ae:	51                   	push   %ecx
+801090af:	e8 dc ad ff ff       	call   80103e90 <lapicarm>
+    if(p->killed){
+801090b4:	8b 53 2c             	mov    0x2c(%ebx),%edx
+  for(pp = &t->hrq; *pp; pp = &(*pp)->tnext)
+801090b7:	8b 87 6c e0 1b 80    	mov    -0x7fe41f94(%edi),%eax
+    if(p->killed){
+801090bd:	83 c4 10             	add    $0x10,%esp
+801090c0:	85 d2                	test   %edx,%edx
+801090c2:	0f 84 dc fe ff ff    	je     80108fa4 <hrsleep+0x104>
+801090c8:	e9 34 ff ff ff       	jmp    80109001 <hrsleep+0x161>
+  for(pp = &t->hrq; *pp; pp = &(*pp)->tnext)
+801090cd:	8b 7d e0             	mov    -0x20(%ebp),%edi
+801090d0:	e9 a7 fe ff ff       	jmp    80108f7c <hrsleep+0xdc>
+  for(; *pp; pp = &(*pp)->tnext){
+801090d5:	85 c0                	test   %eax,%eax
+801090d7:	0f 85 37 ff ff ff    	jne    80109014 <hrsleep+0x174>
+801090dd:	e9 3e ff ff ff       	jmp    80109020 <hrsleep+0x180>
+801090e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801090e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801090f0 <timerintr>:
+// Handle this CPU's timer interrupt: run the scheduler tick
+// if one is due, wake expired hrsleep()ers, and re-arm.
+// Returns 1 if this interrupt was a scheduler tick.
+int
+timerintr(void)
+{
+801090f0:	55                   	push   %ebp
+801090f1:	89 e5                	mov    %esp,%ebp
+801090f3:	57                   	push   %edi
+801090f4:	56                   	push   %esi
+801090f5:	53                   	push   %ebx
+801090f6:	83 ec 1c             	sub    $0x1c,%esp
+  struct cputimer *t;
+  struct proc *p, **pp;
+  uint now;
+  int tick;
+
+  t = &cputimer[cpuid()];
+801090f9:	e8 c2 c4 ff ff       	call   801055c0 <cpuid>
+  acquire(&t->lock);
+801090fe:	83 ec 0c             	sub    $0xc,%esp
+  t = &cputimer[cpuid()];
+80109101:	6b f0 70             	imul   $0x70,%eax,%esi
+80109104:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80109107:	81 c6 00 e0 1b 80    	add    $0x801be000,%esi
+  acquire(&t->lock);
+8010910d:	56                   	push   %esi
+8010910e:	e8 5d df ff ff       	call   80107070 <acquire>
+  return t->now + (t->armed - lapiccount());
+80109113:	8b 5e 60             	mov    0x60(%esi),%ebx
+80109116:	8b 7e 64             	mov    0x64(%esi),%edi
+80109119:	e8 a2 ad ff ff       	call   80103ec0 <lapiccount>
+  now = tnow(t);
+  tick = 0;
+8010911e:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  if((int)(now - t->nexttick) >= 0){
+80109125:	83 c4 10             	add    $0x10,%esp
+80109128:	8d 0c 3b             	lea    (%ebx,%edi,1),%ecx
+  return t->now + (t->armed - lapiccount());
+8010912b:	89 c2                	mov    %eax,%edx
+8010912d:	89 cb                	mov    %ecx,%ebx
+8010912f:	29 c3                	sub    %eax,%ebx
+  if((int)(now - t->nexttick) >= 0){
+80109131:	8b 46 68             	mov    0x68(%esi),%eax
+80109134:	39 c3                	cmp    %eax,%ebx
+80109136:	78 19                	js     80109151 <timerintr+0x61>
+    tick = 1;
+    t->nexttick += lapicperiod;
+80109138:	8b 3d 34 3a 1a 80    	mov    0x801a3a34,%edi
+    tick = 1;
+8010913e:	c7 45 e0 01 00 00 00 	movl   $0x1,-0x20(%ebp)
+    t->nexttick += lapicperiod;
+80109145:	01 f8                	add    %edi,%eax
+    if((int)(now - t->nexttick) >= 0)  // fell behind; don't catch up
+      t->nexttick = now + lapicperiod;
+80109147:	01 df                	add    %ebx,%edi
+80109149:	39 c3                	cmp    %eax,%ebx
+8010914b:	0f 49 c7             	cmovns %edi,%eax
+8010914e:	89 46 68             	mov    %eax,0x68(%esi)
+  }
+  while((p = t->hrq) != 0 && (int)(p->twhen - now) <= 0){
+80109151:	6b 7d e4 70          	imul   $0x70,-0x1c(%ebp),%edi
+80109155:	81 c7 00 e0 1b 80    	add    $0x801be000,%edi
+8010915b:	8b 47 6c             	mov    0x6c(%edi),%eax
+8010915e:	85 c0                	test   %eax,%eax
+80109160:	74 3d                	je     8010919f <timerintr+0xaf>
+80109162:	89 d3                	mov    %edx,%ebx
+80109164:	29 cb                	sub    %ecx,%ebx
+80109166:	eb 2b                	jmp    80109193 <timerintr+0xa3>
+80109168:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010916f:	90                   	nop
+    t->hrq = p->tnext;
+80109170:	8b 90 9c 00 00 00    	mov    0x9c(%eax),%edx
+    wakeproc(p, &p->twhen);
+80109176:	83 ec 08             	sub    $0x8,%esp
+    t->hrq = p->tnext;
+80109179:	89 57 6c             	mov    %edx,0x6c(%edi)
+    wakeproc(p, &p->twhen);
+8010917c:	8d 90 98 00 00 00    	lea    0x98(%eax),%edx
+80109182:	52                   	push   %edx
+80109183:	50                   	push   %eax
+80109184:	e8 c7 cf ff ff       	call   80106150 <wakeproc>
+  while((p = t->hrq) != 0 && (int)(p->twhen - now) <= 0){
+80109189:	8b 47 6c             	mov    0x6c(%edi),%eax
+8010918c:	83 c4 10             	add    $0x10,%esp
+8010918f:	85 c0                	test   %eax,%eax
+80109191:	74 0c                	je     8010919f <timerintr+0xaf>
+80109193:	8b 90 98 00 00 00    	mov    0x98(%eax),%edx
+80109199:	01 da                	add    %ebx,%edx
+8010919b:	85 d2                	test   %edx,%edx
+8010919d:	7e d1                	jle    80109170 <timerintr+0x80>
+  return t->now + (t->armed - lapiccount());
+8010919f:	6b 55 e4 70          	imul   $0x70,-0x1c(%ebp),%edx
+801091a3:	8b ba 60 e0 1b 80    	mov    -0x7fe41fa0(%edx),%edi
+801091a9:	8b 9a 64 e0 1b 80    	mov    -0x7fe41f9c(%edx),%ebx
+801091af:	81 c2 00 e0 1b 80    	add    $0x801be000,%edx
+801091b5:	89 55 dc             	mov    %edx,-0x24(%ebp)
+801091b8:	e8 03 ad ff ff       	call   80103ec0 <lapiccount>
+  next = t->nexttick;
+801091bd:	8b 55 dc             	mov    -0x24(%ebp),%edx
+801091c0:	01 fb                	add    %edi,%ebx
+  return t->now + (t->armed - lapiccount());
+801091c2:	89 df                	mov    %ebx,%edi
+  next = t->nexttick;
+801091c4:	8b 4a 68             	mov    0x68(%edx),%ecx
+  if(t->hrq && (int)(t->hrq->twhen - next) < 0)
+801091c7:	8b 52 6c             	mov    0x6c(%edx),%edx
+  return t->now + (t->armed - lapiccount());
+801091ca:	29 c7                	sub    %eax,%edi
+  if(t->hrq && (int)(t->hrq->twhen - next) < 0)
+801091cc:	85 d2                	test   %edx,%edx
+801091ce:	74 0b                	je     801091db <timerintr+0xeb>
+801091d0:	8b 92 98 00 00 00    	mov    0x98(%edx),%edx
+    next = t->hrq->twhen;
+801091d6:	39 ca                	cmp    %ecx,%edx
+801091d8:	0f 48 ca             	cmovs  %edx,%ecx
+  if((int)(next - now) <= 0)
+801091db:	29 d8                	sub    %ebx,%eax
+801091dd:	ba 01 00 00 00       	mov    $0x1,%edx
+801091e2:	01 c8                	add    %ecx,%eax
+801091e4:	85 c0                	test   %eax,%eax
+801091e6:	0f 4e c2             	cmovle %edx,%eax
+  t->now = now;
+801091e9:	6b 55 e4 70          	imul   $0x70,-0x1c(%ebp),%edx
+  lapicarm(t->armed);
+801091ed:	83 ec 0c             	sub    $0xc,%esp
+  t->armed = next - now;
+801091f0:	89 82 64 e0 1b 80    	mov    %eax,-0x7fe41f9c(%edx)
+  t->now = now;
+801091f6:	89 ba 60 e0 1b 80    	mov    %edi,-0x7fe41fa0(%edx)
+  lapicarm(t->armed);
+801091fc:	50                   	push   %eax
+801091fd:	e8 8e ac ff ff       	call   80103e90 <lapicarm>
+  }
+  tarm(t, tnow(t));
+  release(&t->lock);
+80109202:	89 34 24             	mov    %esi,(%esp)
+80109205:	e8 f6 dc ff ff       	call   80106f00 <release>
+
+  if(!tick || cpuid() != 0)
+8010920a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010920d:	83 c4 10             	add    $0x10,%esp
+80109210:	85 c0                	test   %eax,%eax
+80109212:	75 0c                	jne    80109220 <timerintr+0x130>
+    } else
+      pp = &p->tnext;
+  }
+  release(&tickslock);
+  return 1;
+}
+80109214:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80109217:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010921a:	5b                   	pop    %ebx
+8010921b:	5e                   	pop    %esi
+8010921c:	5f                   	pop    %edi
+8010921d:	5d                   	pop    %ebp
+8010921e:	c3                   	ret
+8010921f:	90                   	nop
+  if(!tick || cpuid() != 0)
+80109220:	e8 9b c3 ff ff       	call   801055c0 <cpuid>
+80109225:	85 c0                	test   %eax,%eax
+80109227:	75 eb                	jne    80109214 <timerintr+0x124>
+  acquire(&tickslock);
+80109229:	83 ec 0c             	sub    $0xc,%esp
+8010922c:	68 a0 e4 1b 80       	push   $0x801be4a0
+80109231:	e8 3a de ff ff       	call   80107070 <acquire>
+  ticks++;
+80109236:	a1 80 e4 1b 80       	mov    0x801be480,%eax
+  while((p = *pp) != 0){
+8010923b:	83 c4 10             	add    $0x10,%esp
+  ticks++;
+8010923e:	8d 48 01             	lea    0x1(%eax),%ecx
+  pp = &wheel.slot[ticks % NWHEEL];
+80109241:	89 c8                	mov    %ecx,%eax
+  ticks++;
+80109243:	89 0d 80 e4 1b 80    	mov    %ecx,0x801be480
+  pp = &wheel.slot[ticks % NWHEEL];
+80109249:	83 e0 3f             	and    $0x3f,%eax
+  uclock->ticks = ticks;
+8010924c:	89 0d 04 d0 1b 80    	mov    %ecx,0x801bd004
+  pp = &wheel.slot[ticks % NWHEEL];
+80109252:	8d 1c 85 80 e3 1b 80 	lea    -0x7fe41c80(,%eax,4),%ebx
+  while((p = *pp) != 0){
+80109259:	8b 04 85 80 e3 1b 80 	mov    -0x7fe41c80(,%eax,4),%eax
+80109260:	85 c0                	test   %eax,%eax
+80109262:	75 1e                	jne    80109282 <timerintr+0x192>
+80109264:	eb 49                	jmp    801092af <timerintr+0x1bf>
+80109266:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010926d:	8d 76 00             	lea    0x0(%esi),%esi
+      pp = &p->tnext;
+80109270:	8d 98 9c 00 00 00    	lea    0x9c(%eax),%ebx
+  while((p = *pp) != 0){
+80109276:	8b 03                	mov    (%ebx),%eax
+80109278:	85 c0                	test   %eax,%eax
+8010927a:	74 33                	je     801092af <timerintr+0x1bf>
+    if((int)(p->twhen - ticks) <= 0){
+8010927c:	8b 0d 80 e4 1b 80    	mov    0x801be480,%ecx
+80109282:	8b 90 98 00 00 00    	mov    0x98(%eax),%edx
+80109288:	29 ca                	sub    %ecx,%edx
+8010928a:	85 d2                	test   %edx,%edx
+8010928c:	7f e2                	jg     80109270 <timerintr+0x180>
+      *pp = p->tnext;
+8010928e:	8b 90 9c 00 00 00    	mov    0x9c(%eax),%edx
+      wakeproc(p, &p->twhen);
+80109294:	83 ec 08             	sub    $0x8,%esp
+      *pp = p->tnext;
+80109297:	89 13                	mov    %edx,(%ebx)
+      wakeproc(p, &p->twhen);
+80109299:	8d 90 98 00 00 00    	lea    0x98(%eax),%edx
+8010929f:	52                   	push   %edx
+801092a0:	50                   	push   %eax
+801092a1:	e8 aa ce ff ff       	call   80106150 <wakeproc>
+  while((p = *pp) != 0){
+801092a6:	8b 03                	mov    (%ebx),%eax
+801092a8:	83 c4 10             	add    $0x10,%esp
+801092ab:	85 c0                	test   %eax,%eax
+801092ad:	75 cd                	jne    8010927c <timerintr+0x18c>
+  release(&tickslock);
+801092af:	83 ec 0c             	sub    $0xc,%esp
+801092b2:	68 a0 e4 1b 80       	push   $0x801be4a0
+801092b7:	e8 44 dc ff ff       	call   80106f00 <release>
+}
+801092bc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  return 1;
+801092bf:	83 c4 10             	add    $0x10,%esp
+}
+801092c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801092c5:	5b                   	pop    %ebx
+801092c6:	5e                   	pop    %esi
+801092c7:	5f                   	pop    %edi
+801092c8:	5d                   	pop    %ebp
+801092c9:	c3                   	ret
+
+801092ca <alltraps>:
+
+  # vectors.S sends all traps here.
+.globl alltraps
+alltraps:
+  # Build trap frame.
+  pushl %ds
+801092ca:	1e                   	push   %ds
+  pushl %es
+801092cb:	06                   	push   %es
+  pushl %fs
+801092cc:	0f a0                	push   %fs
+  pushl %gs
+801092ce:	0f a8                	push   %gs
+  pushal
+801092d0:	60                   	pusha
+  
+  # Set up data segments.
+  movw $(SEG_KDATA<<3), %ax
+801092d1:	66 b8 10 00          	mov    $0x10,%ax
+  movw %ax, %ds
+801092d5:	8e d8                	mov    %eax,%ds
+  movw %ax, %es
+801092d7:	8e c0                	mov    %eax,%es
+  movw $(SEG_KCPU<<3), %ax
+801092d9:	66 b8 30 00          	mov    $0x30,%ax
+  movw %ax, %gs
+801092dd:	8e e8                	mov    %eax,%gs
+
+  # Call trap(tf), where tf=%esp
+  pushl %esp
+801092df:	54                   	push   %esp
+  call trap
+801092e0:	e8 5b 01 00 00       	call   80109440 <trap>
+  addl $4, %esp
+801092e5:	83 c4 04             	add    $0x4,%esp
+
+801092e8 <trapret>:
+
+  # Return falls through to trapret...
+.globl trapret
+trapret:
+  popal
+801092e8:	61                   	popa
+  popl %gs
+801092e9:	0f a9                	pop    %gs
+  popl %fs
+801092eb:	0f a1                	pop    %fs
+  popl %es
+801092ed:	07                   	pop    %es
+  popl %ds
+801092ee:	1f                   	pop    %ds
+  addl $0x8, %esp  # trapno and errcode
+801092ef:	83 c4 08             	add    $0x8,%esp
+  iret
+801092f2:	cf                   	iret
+
+801092f3 <sysentry>:
+  # ts.esp0 and build the same trap frame int $T_SYSCALL would,
+  # from the user %eip and %esp passed in %edx and %ecx, so that
+  # fork and exec need not know which way the call came in.
+.globl sysentry
+sysentry:
+  movl 4(%esp), %esp
+801092f3:	8b 64 24 04          	mov    0x4(%esp),%esp
+  pushl $(SEG_UDATA<<3 | DPL_USER)  # ss
+801092f7:	6a 23                	push   $0x23
+  pushl %ecx                         # esp
+801092f9:	51                   	push   %ecx
+  pushfl
+801092fa:	9c                   	pushf
+  orl $FL_IF, (%esp)                 # eflags
+801092fb:	81 0c 24 00 02 00 00 	orl    $0x200,(%esp)
+  pushl $(SEG_UCODE<<3 | DPL_USER)  # cs
+80109302:	6a 1b                	push   $0x1b
+  pushl %edx                         # eip
+80109304:	52                   	push   %edx
+  pushl $0                           # errcode
+80109305:	6a 00                	push   $0x0
+  pushl $T_SYSCALL                   # trapno
+80109307:	6a 40                	push   $0x40
+  pushl %ds
+80109309:	1e                   	push   %ds
+  pushl %es
+8010930a:	06                   	push   %es
+  pushl %fs
+8010930b:	0f a0                	push   %fs
+  pushl %gs
+8010930d:	0f a8                	push   %gs
+  pushal
+8010930f:	60                   	pusha
+
+  movw $(SEG_KDATA<<3), %ax
+80109310:	66 b8 10 00          	mov    $0x10,%ax
+  movw %ax, %ds
+80109314:	8e d8                	mov    %eax,%ds
+  movw %ax, %es
+80109316:	8e c0                	mov    %eax,%es
+  movw $(SEG_KCPU<<3), %ax
+80109318:	66 b8 30 00          	mov    $0x30,%ax
+  movw %ax, %gs
+8010931c:	8e e8                	mov    %eax,%gs
+  sti
+8010931e:	fb                   	sti
+
+  pushl %esp
+8010931f:	54                   	push   %esp
+  call sysentertrap
+80109320:	e8 cb 00 00 00       	call   801093f0 <sysentertrap>
+  addl $4, %esp
+80109325:	83 c4 04             	add    $0x4,%esp
+
+  # Return with sysexit, which jumps to %edx with %esp = %ecx.
+  # The sti takes effect after sysexit, in user mode.
+  cli
+80109328:	fa                   	cli
+  popal
+80109329:	61                   	popa
+  popl %gs
+8010932a:	0f a9                	pop    %gs
+  popl %fs
+8010932c:	0f a1                	pop    %fs
+  popl %es
+8010932e:	07                   	pop    %es
+  popl %ds
+8010932f:	1f                   	pop    %ds
+  addl $0x8, %esp  # trapno and errcode
+80109330:	83 c4 08             	add    $0x8,%esp
+  movl 0(%esp), %edx   # eip
+80109333:	8b 14 24             	mov    (%esp),%edx
+  movl 12(%esp), %ecx  # esp
+80109336:	8b 4c 24 0c          	mov    0xc(%esp),%ecx
+  sti
+8010933a:	fb                   	sti
+  sysexit
+8010933b:	0f 35                	sysexit
+8010933d:	66 90                	xchg   %ax,%ax
+8010933f:	90                   	nop
+
+80109340 <tvinit>:
+struct spinlock tickslock;
+uint ticks;
+
+void
+tvinit(void)
+{
+80109340:	55                   	push   %ebp
+  int i;
+
+  for(i = 0; i < 256; i++)
+80109341:	31 c0                	xor    %eax,%eax
+{
+80109343:	89 e5                	mov    %esp,%ebp
+80109345:	83 ec 08             	sub    $0x8,%esp
+80109348:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010934f:	90                   	nop
+    SETGATE(idt[i], 0, SEG_KCODE<<3, vectors[i], 0);
+80109350:	8b 14 85 08 f0 10 80 	mov    -0x7fef0ff8(,%eax,4),%edx
+80109357:	c7 04 c5 02 e5 1b 80 	movl   $0x8e000008,-0x7fe41afe(,%eax,8)
+8010935e:	08 00 00 8e 
+80109362:	66 89 14 c5 00 e5 1b 	mov    %dx,-0x7fe41b00(,%eax,8)
+80109369:	80 
+8010936a:	c1 ea 10             	shr    $0x10,%edx
+8010936d:	66 89 14 c5 06 e5 1b 	mov    %dx,-0x7fe41afa(,%eax,8)
+80109374:	80 
+  for(i = 0; i < 256; i++)
+80109375:	83 c0 01             	add    $0x1,%eax
+80109378:	3d 00 01 00 00       	cmp    $0x100,%eax
+8010937d:	75 d1                	jne    80109350 <tvinit+0x10>
+  SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
+8010937f:	a1 08 f1 10 80       	mov    0x8010f108,%eax
+
+  initlock(&tickslock, "time");
+80109384:	83 ec 08             	sub    $0x8,%esp
+  SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
+80109387:	c7 05 02 e7 1b 80 08 	movl   $0xef000008,0x801be702
+8010938e:	00 00 ef 
+80109391:	66 a3 00 e7 1b 80    	mov    %ax,0x801be700
+80109397:	c1 e8 10             	shr    $0x10,%eax
+8010939a:	66 a3 06 e7 1b 80    	mov    %ax,0x801be706
+  initlock(&tickslock, "time");
+801093a0:	68 bb bd 10 80       	push   $0x8010bdbb
+801093a5:	68 a0 e4 1b 80       	push   $0x801be4a0
+801093aa:	e8 b1 d5 ff ff       	call   80106960 <initlock>
+}
+801093af:	83 c4 10             	add    $0x10,%esp
+801093b2:	c9                   	leave
+801093b3:	c3                   	ret
+801093b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801093bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801093bf:	90                   	nop
+
+801093c0 <idtinit>:
+
+void
+idtinit(void)
+{
+801093c0:	55                   	push   %ebp
+  pd[0] = size-1;
+801093c1:	b8 ff 07 00 00       	mov    $0x7ff,%eax
+801093c6:	89 e5                	mov    %esp,%ebp
+801093c8:	83 ec 10             	sub    $0x10,%esp
+801093cb:	66 89 45 fa          	mov    %ax,-0x6(%ebp)
+  pd[1] = (uint)p;
+801093cf:	b8 00 e5 1b 80       	mov    $0x801be500,%eax
+801093d4:	66 89 45 fc          	mov    %ax,-0x4(%ebp)
+  pd[2] = (uint)p >> 16;
+801093d8:	c1 e8 10             	shr    $0x10,%eax
+801093db:	66 89 45 fe          	mov    %ax,-0x2(%ebp)
+  asm volatile("lidt (%0)" : : "r" (pd));
+801093df:	8d 45 fa             	lea    -0x6(%ebp),%eax
+801093e2:	0f 01 18             	lidtl  (%eax)
+  lidt(idt, sizeof(idt));
+}
+801093e5:	c9                   	leave
+801093e6:	c3                   	ret
+801093e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801093ee:	66 90                	xchg   %ax,%ax
+
+801093f0 <sysentertrap>:
+
+// System calls made with sysenter arrive here from sysentry
+// in trapasm.S, skipping the trap() switch.
+void
+sysentertrap(struct trapframe *tf)
+{
+801093f0:	55                   	push   %ebp
+801093f1:	89 e5                	mov    %esp,%ebp
+801093f3:	53                   	push   %ebx
+801093f4:	83 ec 04             	sub    $0x4,%esp
+801093f7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(myproc()->killed)
+801093fa:	e8 f1 c1 ff ff       	call   801055f0 <myproc>
+801093ff:	8b 50 2c             	mov    0x2c(%eax),%edx
+80109402:	85 d2                	test   %edx,%edx
+80109404:	75 22                	jne    80109428 <sysentertrap+0x38>
+    exit();
+  myproc()->tf = tf;
+80109406:	e8 e5 c1 ff ff       	call   801055f0 <myproc>
+8010940b:	89 58 20             	mov    %ebx,0x20(%eax)
+  syscall();
+8010940e:	e8 5d e5 ff ff       	call   80107970 <syscall>
+  if(myproc()->killed)
+80109413:	e8 d8 c1 ff ff       	call   801055f0 <myproc>
+80109418:	8b 40 2c             	mov    0x2c(%eax),%eax
+8010941b:	85 c0                	test   %eax,%eax
+8010941d:	75 11                	jne    80109430 <sysentertrap+0x40>
+    exit();
+}
+8010941f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80109422:	c9                   	leave
+80109423:	c3                   	ret
+80109424:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    exit();
+80109428:	e8 d3 c9 ff ff       	call   80105e00 <exit>
+8010942d:	eb d7                	jmp    80109406 <sysentertrap+0x16>
+8010942f:	90                   	nop
+}
+80109430:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80109433:	c9                   	leave
+    exit();
+80109434:	e9 c7 c9 ff ff       	jmp    80105e00 <exit>
+80109439:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80109440 <trap>:
+
+//PAGEBREAK: 41
+void
+trap(struct trapframe *tf)
+{
+80109440:	55                   	push   %ebp
+80109441:	89 e5                	mov    %esp,%ebp
+80109443:	57                   	push   %edi
+80109444:	56                   	push   %esi
+80109445:	53                   	push   %ebx
+80109446:	83 ec 1c             	sub    $0x1c,%esp
+80109449:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int tick;
+
+  if(tf->trapno == T_SYSCALL){
+8010944c:	8b 43 30             	mov    0x30(%ebx),%eax
+8010944f:	83 f8 40             	cmp    $0x40,%eax
+80109452:	0f 84 98 01 00 00    	je     801095f0 <trap+0x1b0>
+      exit();
+    return;
+  }
+
+  tick = 0;
+  switch(tf->trapno){
+80109458:	8d 50 e0             	lea    -0x20(%eax),%edx
+8010945b:	83 fa 1f             	cmp    $0x1f,%edx
+8010945e:	77 10                	ja     80109470 <trap+0x30>
+80109460:	ff 24 95 64 be 10 80 	jmp    *-0x7fef419c(,%edx,4)
+80109467:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010946e:	66 90                	xchg   %ax,%ax
+    lapiceoi();
+    break;
+
+  //PAGEBREAK: 13
+  default:
+    if(virtioirq >= 0 && tf->trapno == T_IRQ0 + virtioirq){
+80109470:	8b 15 08 f4 10 80    	mov    0x8010f408,%edx
+80109476:	85 d2                	test   %edx,%edx
+80109478:	78 0b                	js     80109485 <trap+0x45>
+8010947a:	83 c2 20             	add    $0x20,%edx
+8010947d:	39 d0                	cmp    %edx,%eax
+8010947f:	0f 84 ab 00 00 00    	je     80109530 <trap+0xf0>
+      virtiointr();
+      lapiceoi();
+      break;
+    }
+    if(myproc() == 0 || (tf->cs&3) == 0){
+80109485:	e8 66 c1 ff ff       	call   801055f0 <myproc>
+8010948a:	85 c0                	test   %eax,%eax
+8010948c:	0f 84 10 02 00 00    	je     801096a2 <trap+0x262>
+80109492:	f6 43 3c 03          	testb  $0x3,0x3c(%ebx)
+80109496:	0f 84 06 02 00 00    	je     801096a2 <trap+0x262>
+      cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
+              tf->trapno, cpuid(), tf->eip, rcr2());
+      panic("trap");
+    }
+    // In user space, assume process misbehaved.
+    if(tf->trapno == T_PGFLT)
+8010949c:	83 7b 30 0e          	cmpl   $0xe,0x30(%ebx)
+801094a0:	0f 84 da 01 00 00    	je     80109680 <trap+0x240>
+
+static inline uint
+rcr2(void)
+{
+  uint val;
+  asm volatile("movl %%cr2,%0" : "=r" (val));
+801094a6:	0f 20 d1             	mov    %cr2,%ecx
+      myproc()->nfault++;
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+801094a9:	8b 53 38             	mov    0x38(%ebx),%edx
+801094ac:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+801094af:	89 55 dc             	mov    %edx,-0x24(%ebp)
+801094b2:	e8 09 c1 ff ff       	call   801055c0 <cpuid>
+801094b7:	8b 73 30             	mov    0x30(%ebx),%esi
+801094ba:	89 c7                	mov    %eax,%edi
+801094bc:	8b 43 34             	mov    0x34(%ebx),%eax
+801094bf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+            "eip 0x%x addr 0x%x--kill proc\n",
+            myproc()->pid, myproc()->name, tf->trapno,
+801094c2:	e8 29 c1 ff ff       	call   801055f0 <myproc>
+801094c7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801094ca:	e8 21 c1 ff ff       	call   801055f0 <myproc>
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+801094cf:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+801094d2:	51                   	push   %ecx
+801094d3:	8b 55 dc             	mov    -0x24(%ebp),%edx
+801094d6:	52                   	push   %edx
+801094d7:	57                   	push   %edi
+801094d8:	ff 75 e4             	push   -0x1c(%ebp)
+801094db:	56                   	push   %esi
+            myproc()->pid, myproc()->name, tf->trapno,
+801094dc:	8b 75 e0             	mov    -0x20(%ebp),%esi
+801094df:	83 c6 74             	add    $0x74,%esi
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+801094e2:	56                   	push   %esi
+801094e3:	ff 70 10             	push   0x10(%eax)
+801094e6:	68 20 be 10 80       	push   $0x8010be20
+801094eb:	e8 00 83 ff ff       	call   801017f0 <cprintf>
+            tf->err, cpuid(), tf->eip, rcr2());
+    myproc()->killed = 1;
+801094f0:	83 c4 20             	add    $0x20,%esp
+801094f3:	e8 f8 c0 ff ff       	call   801055f0 <myproc>
+801094f8:	c7 40 2c 01 00 00 00 	movl   $0x1,0x2c(%eax)
+{
+801094ff:	31 f6                	xor    %esi,%esi
+80109501:	eb 75                	jmp    80109578 <trap+0x138>
+80109503:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80109507:	90                   	nop
+    cprintf("cpu%d: spurious interrupt at %x:%x\n",
+80109508:	0f b7 73 3c          	movzwl 0x3c(%ebx),%esi
+8010950c:	8b 7b 38             	mov    0x38(%ebx),%edi
+8010950f:	e8 ac c0 ff ff       	call   801055c0 <cpuid>
+80109514:	57                   	push   %edi
+80109515:	56                   	push   %esi
+{
+80109516:	31 f6                	xor    %esi,%esi
+    cprintf("cpu%d: spurious interrupt at %x:%x\n",
+80109518:	50                   	push   %eax
+80109519:	68 c8 bd 10 80       	push   $0x8010bdc8
+8010951e:	e8 cd 82 ff ff       	call   801017f0 <cprintf>
+    lapiceoi();
+80109523:	e8 48 a9 ff ff       	call   80103e70 <lapiceoi>
+    break;
+80109528:	83 c4 10             	add    $0x10,%esp
+8010952b:	eb 4b                	jmp    80109578 <trap+0x138>
+8010952d:	8d 76 00             	lea    0x0(%esi),%esi
+      virtiointr();
+80109530:	e8 bb 11 00 00       	call   8010a6f0 <virtiointr>
+      lapiceoi();
+80109535:	e8 36 a9 ff ff       	call   80103e70 <lapiceoi>
+{
+8010953a:	31 f6                	xor    %esi,%esi
+8010953c:	eb 3a                	jmp    80109578 <trap+0x138>
+8010953e:	66 90                	xchg   %ax,%ax
+    ideintr();
+80109540:	e8 1b 20 00 00       	call   8010b560 <ideintr>
+{
+80109545:	31 f6                	xor    %esi,%esi
+    lapiceoi();
+80109547:	e8 24 a9 ff ff       	call   80103e70 <lapiceoi>
+    break;
+8010954c:	eb 2a                	jmp    80109578 <trap+0x138>
+8010954e:	66 90                	xchg   %ax,%ax
+    uartintr();
+80109550:	e8 fb 02 00 00       	call   80109850 <uartintr>
+{
+80109555:	31 f6                	xor    %esi,%esi
+    lapiceoi();
+80109557:	e8 14 a9 ff ff       	call   80103e70 <lapiceoi>
+    break;
+8010955c:	eb 1a                	jmp    80109578 <trap+0x138>
+8010955e:	66 90                	xchg   %ax,%ax
+    tick = timerintr();
+80109560:	e8 8b fb ff ff       	call   801090f0 <timerintr>
+80109565:	89 c6                	mov    %eax,%esi
+    if(tick && myproc()){
+80109567:	85 c0                	test   %eax,%eax
+80109569:	0f 85 e1 00 00 00    	jne    80109650 <trap+0x210>
+    lapiceoi();
+8010956f:	e8 fc a8 ff ff       	call   80103e70 <lapiceoi>
+    break;
+80109574:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  }
+
+  // Force process exit if it has been killed and is in user space.
+  // (If it is still executing in the kernel, let it keep running
+  // until it gets to the regular system call return.)
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+80109578:	e8 73 c0 ff ff       	call   801055f0 <myproc>
+8010957d:	85 c0                	test   %eax,%eax
+8010957f:	74 1d                	je     8010959e <trap+0x15e>
+80109581:	e8 6a c0 ff ff       	call   801055f0 <myproc>
+80109586:	8b 50 2c             	mov    0x2c(%eax),%edx
+80109589:	85 d2                	test   %edx,%edx
+8010958b:	74 11                	je     8010959e <trap+0x15e>
+8010958d:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+80109591:	83 e0 03             	and    $0x3,%eax
+80109594:	66 83 f8 03          	cmp    $0x3,%ax
+80109598:	0f 84 92 00 00 00    	je     80109630 <trap+0x1f0>
+    exit();
+
+  // Force process to give up CPU on clock tick.
+  // If interrupts were on while locks held, would need to check nlock.
+  if(myproc() && myproc()->state == RUNNING && tick)
+8010959e:	e8 4d c0 ff ff       	call   801055f0 <myproc>
+801095a3:	85 c0                	test   %eax,%eax
+801095a5:	74 0f                	je     801095b6 <trap+0x176>
+801095a7:	e8 44 c0 ff ff       	call   801055f0 <myproc>
+801095ac:	83 78 0c 04          	cmpl   $0x4,0xc(%eax)
+801095b0:	75 04                	jne    801095b6 <trap+0x176>
+801095b2:	85 f6                	test   %esi,%esi
+801095b4:	75 72                	jne    80109628 <trap+0x1e8>
+    yield();
+
+  // Check if the process has been killed since we yielded
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+801095b6:	e8 35 c0 ff ff       	call   801055f0 <myproc>
+801095bb:	85 c0                	test   %eax,%eax
+801095bd:	74 19                	je     801095d8 <trap+0x198>
+801095bf:	e8 2c c0 ff ff       	call   801055f0 <myproc>
+801095c4:	8b 40 2c             	mov    0x2c(%eax),%eax
+801095c7:	85 c0                	test   %eax,%eax
+801095c9:	74 0d                	je     801095d8 <trap+0x198>
+801095cb:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+801095cf:	83 e0 03             	and    $0x3,%eax
+801095d2:	66 83 f8 03          	cmp    $0x3,%ax
+801095d6:	74 3d                	je     80109615 <trap+0x1d5>
+    exit();
+}
+801095d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801095db:	5b                   	pop    %ebx
+801095dc:	5e                   	pop    %esi
+801095dd:	5f                   	pop    %edi
+801095de:	5d                   	pop    %ebp
+801095df:	c3                   	ret
+    kbdintr();
+801095e0:	e8 9b a6 ff ff       	call   80103c80 <kbdintr>
+{
+801095e5:	31 f6                	xor    %esi,%esi
+    lapiceoi();
+801095e7:	e8 84 a8 ff ff       	call   80103e70 <lapiceoi>
+    break;
+801095ec:	eb 8a                	jmp    80109578 <trap+0x138>
+801095ee:	66 90                	xchg   %ax,%ax
+    if(myproc()->killed)
+801095f0:	e8 fb bf ff ff       	call   801055f0 <myproc>
+801095f5:	8b 70 2c             	mov    0x2c(%eax),%esi
+801095f8:	85 f6                	test   %esi,%esi
+801095fa:	75 44                	jne    80109640 <trap+0x200>
+    myproc()->tf = tf;
+801095fc:	e8 ef bf ff ff       	call   801055f0 <myproc>
+80109601:	89 58 20             	mov    %ebx,0x20(%eax)
+    syscall();
+80109604:	e8 67 e3 ff ff       	call   80107970 <syscall>
+    if(myproc()->killed)
+80109609:	e8 e2 bf ff ff       	call   801055f0 <myproc>
+8010960e:	8b 48 2c             	mov    0x2c(%eax),%ecx
+80109611:	85 c9                	test   %ecx,%ecx
+80109613:	74 c3                	je     801095d8 <trap+0x198>
+}
+80109615:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109618:	5b                   	pop    %ebx
+80109619:	5e                   	pop    %esi
+8010961a:	5f                   	pop    %edi
+8010961b:	5d                   	pop    %ebp
+      exit();
+8010961c:	e9 df c7 ff ff       	jmp    80105e00 <exit>
+80109621:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    yield();
+80109628:	e8 d3 c9 ff ff       	call   80106000 <yield>
+8010962d:	eb 87                	jmp    801095b6 <trap+0x176>
+8010962f:	90                   	nop
+    exit();
+80109630:	e8 cb c7 ff ff       	call   80105e00 <exit>
+80109635:	e9 64 ff ff ff       	jmp    8010959e <trap+0x15e>
+8010963a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      exit();
+80109640:	e8 bb c7 ff ff       	call   80105e00 <exit>
+80109645:	eb b5                	jmp    801095fc <trap+0x1bc>
+80109647:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010964e:	66 90                	xchg   %ax,%ax
+    if(tick && myproc()){
+80109650:	e8 9b bf ff ff       	call   801055f0 <myproc>
+80109655:	85 c0                	test   %eax,%eax
+80109657:	0f 84 12 ff ff ff    	je     8010956f <trap+0x12f>
+      if((tf->cs&3) == DPL_USER)
+8010965d:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+80109661:	83 e0 03             	and    $0x3,%eax
+80109664:	66 83 f8 03          	cmp    $0x3,%ax
+80109668:	74 27                	je     80109691 <trap+0x251>
+        myproc()->stime++;
+8010966a:	e8 81 bf ff ff       	call   801055f0 <myproc>
+8010966f:	83 80 b0 00 00 00 01 	addl   $0x1,0xb0(%eax)
+80109676:	e9 f4 fe ff ff       	jmp    8010956f <trap+0x12f>
+8010967b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010967f:	90                   	nop
+      myproc()->nfault++;
+80109680:	e8 6b bf ff ff       	call   801055f0 <myproc>
+80109685:	83 80 b8 00 00 00 01 	addl   $0x1,0xb8(%eax)
+8010968c:	e9 15 fe ff ff       	jmp    801094a6 <trap+0x66>
+        myproc()->utime++;
+80109691:	e8 5a bf ff ff       	call   801055f0 <myproc>
+80109696:	83 80 ac 00 00 00 01 	addl   $0x1,0xac(%eax)
+8010969d:	e9 cd fe ff ff       	jmp    8010956f <trap+0x12f>
+801096a2:	0f 20 d7             	mov    %cr2,%edi
+      cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
+801096a5:	8b 73 38             	mov    0x38(%ebx),%esi
+801096a8:	e8 13 bf ff ff       	call   801055c0 <cpuid>
+801096ad:	83 ec 0c             	sub    $0xc,%esp
+801096b0:	57                   	push   %edi
+801096b1:	56                   	push   %esi
+801096b2:	50                   	push   %eax
+801096b3:	ff 73 30             	push   0x30(%ebx)
+801096b6:	68 ec bd 10 80       	push   $0x8010bdec
+801096bb:	e8 30 81 ff ff       	call   801017f0 <cprintf>
+      panic("trap");
+801096c0:	83 c4 14             	add    $0x14,%esp
+801096c3:	68 c0 bd 10 80       	push   $0x8010bdc0
+801096c8:	e8 f3 7d ff ff       	call   801014c0 <panic>
+801096cd:	66 90                	xchg   %ax,%ax
+801096cf:	90                   	nop
+
+801096d0 <uartgetc>:
+}
+
+static int
+uartgetc(void)
+{
+  if(!uart)
+801096d0:	a1 00 ed 1b 80       	mov    0x801bed00,%eax
+801096d5:	85 c0                	test   %eax,%eax
+801096d7:	74 17                	je     801096f0 <uartgetc+0x20>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801096d9:	ba fd 03 00 00       	mov    $0x3fd,%edx
+801096de:	ec                   	in     (%dx),%al
+    return -1;
+  if(!(inb(COM1+5) & 0x01))
+801096df:	a8 01                	test   $0x1,%al
+801096e1:	74 0d                	je     801096f0 <uartgetc+0x20>
+801096e3:	ba f8 03 00 00       	mov    $0x3f8,%edx
+801096e8:	ec                   	in     (%dx),%al
+    return -1;
+  return inb(COM1+0);
+801096e9:	0f b6 c0             	movzbl %al,%eax
+801096ec:	c3                   	ret
+801096ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+801096f0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801096f5:	c3                   	ret
+801096f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801096fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+80109700 <uartinit>:
+{
+80109700:	55                   	push   %ebp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109701:	31 c9                	xor    %ecx,%ecx
+80109703:	89 c8                	mov    %ecx,%eax
+80109705:	89 e5                	mov    %esp,%ebp
+80109707:	57                   	push   %edi
+80109708:	bf fa 03 00 00       	mov    $0x3fa,%edi
+8010970d:	56                   	push   %esi
+8010970e:	89 fa                	mov    %edi,%edx
+80109710:	53                   	push   %ebx
+80109711:	83 ec 1c             	sub    $0x1c,%esp
+80109714:	ee                   	out    %al,(%dx)
+80109715:	be fb 03 00 00       	mov    $0x3fb,%esi
+8010971a:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+8010971f:	89 f2                	mov    %esi,%edx
+80109721:	ee                   	out    %al,(%dx)
+80109722:	b8 0c 00 00 00       	mov    $0xc,%eax
+80109727:	ba f8 03 00 00       	mov    $0x3f8,%edx
+8010972c:	ee                   	out    %al,(%dx)
+8010972d:	bb f9 03 00 00       	mov    $0x3f9,%ebx
+80109732:	89 c8                	mov    %ecx,%eax
+80109734:	89 da                	mov    %ebx,%edx
+80109736:	ee                   	out    %al,(%dx)
+80109737:	b8 03 00 00 00       	mov    $0x3,%eax
+8010973c:	89 f2                	mov    %esi,%edx
+8010973e:	ee                   	out    %al,(%dx)
+8010973f:	ba fc 03 00 00       	mov    $0x3fc,%edx
+80109744:	89 c8                	mov    %ecx,%eax
+80109746:	ee                   	out    %al,(%dx)
+80109747:	b8 01 00 00 00       	mov    $0x1,%eax
+8010974c:	89 da                	mov    %ebx,%edx
+8010974e:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010974f:	ba fd 03 00 00       	mov    $0x3fd,%edx
+80109754:	ec                   	in     (%dx),%al
+  if(inb(COM1+5) == 0xFF)
+80109755:	3c ff                	cmp    $0xff,%al
+80109757:	0f 84 7c 00 00 00    	je     801097d9 <uartinit+0xd9>
+  uart = 1;
+8010975d:	c7 05 00 ed 1b 80 01 	movl   $0x1,0x801bed00
+80109764:	00 00 00 
+80109767:	89 fa                	mov    %edi,%edx
+80109769:	ec                   	in     (%dx),%al
+8010976a:	ba f8 03 00 00       	mov    $0x3f8,%edx
+8010976f:	ec                   	in     (%dx),%al
+  ioapicenable(IRQ_COM1, 0);
+80109770:	83 ec 08             	sub    $0x8,%esp
+  for(p="xv6...\n"; *p; p++)
+80109773:	bf e4 be 10 80       	mov    $0x8010bee4,%edi
+80109778:	be fd 03 00 00       	mov    $0x3fd,%esi
+  ioapicenable(IRQ_COM1, 0);
+8010977d:	6a 00                	push   $0x0
+8010977f:	6a 04                	push   $0x4
+80109781:	e8 2a a1 ff ff       	call   801038b0 <ioapicenable>
+  for(p="xv6...\n"; *p; p++)
+80109786:	c6 45 e7 78          	movb   $0x78,-0x19(%ebp)
+  ioapicenable(IRQ_COM1, 0);
+8010978a:	83 c4 10             	add    $0x10,%esp
+8010978d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(!uart)
+80109790:	a1 00 ed 1b 80       	mov    0x801bed00,%eax
+80109795:	85 c0                	test   %eax,%eax
+80109797:	74 32                	je     801097cb <uartinit+0xcb>
+80109799:	89 f2                	mov    %esi,%edx
+8010979b:	ec                   	in     (%dx),%al
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+8010979c:	a8 20                	test   $0x20,%al
+8010979e:	75 21                	jne    801097c1 <uartinit+0xc1>
+801097a0:	bb 80 00 00 00       	mov    $0x80,%ebx
+801097a5:	8d 76 00             	lea    0x0(%esi),%esi
+    microdelay(10);
+801097a8:	83 ec 0c             	sub    $0xc,%esp
+801097ab:	6a 0a                	push   $0xa
+801097ad:	e8 2e a7 ff ff       	call   80103ee0 <microdelay>
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+801097b2:	83 c4 10             	add    $0x10,%esp
+801097b5:	83 eb 01             	sub    $0x1,%ebx
+801097b8:	74 07                	je     801097c1 <uartinit+0xc1>
+801097ba:	89 f2                	mov    %esi,%edx
+801097bc:	ec                   	in     (%dx),%al
+801097bd:	a8 20                	test   $0x20,%al
+801097bf:	74 e7                	je     801097a8 <uartinit+0xa8>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801097c1:	ba f8 03 00 00       	mov    $0x3f8,%edx
+801097c6:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+801097ca:	ee                   	out    %al,(%dx)
+  for(p="xv6...\n"; *p; p++)
+801097cb:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+801097cf:	83 c7 01             	add    $0x1,%edi
+801097d2:	88 45 e7             	mov    %al,-0x19(%ebp)
+801097d5:	84 c0                	test   %al,%al
+801097d7:	75 b7                	jne    80109790 <uartinit+0x90>
+}
+801097d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801097dc:	5b                   	pop    %ebx
+801097dd:	5e                   	pop    %esi
+801097de:	5f                   	pop    %edi
+801097df:	5d                   	pop    %ebp
+801097e0:	c3                   	ret
+801097e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801097e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801097ef:	90                   	nop
+
+801097f0 <uartputc>:
+  if(!uart)
+801097f0:	a1 00 ed 1b 80       	mov    0x801bed00,%eax
+801097f5:	85 c0                	test   %eax,%eax
+801097f7:	74 4f                	je     80109848 <uartputc+0x58>
+{
+801097f9:	55                   	push   %ebp
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801097fa:	ba fd 03 00 00       	mov    $0x3fd,%edx
+801097ff:	89 e5                	mov    %esp,%ebp
+80109801:	56                   	push   %esi
+80109802:	53                   	push   %ebx
+80109803:	ec                   	in     (%dx),%al
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109804:	a8 20                	test   $0x20,%al
+80109806:	75 29                	jne    80109831 <uartputc+0x41>
+80109808:	bb 80 00 00 00       	mov    $0x80,%ebx
+8010980d:	be fd 03 00 00       	mov    $0x3fd,%esi
+80109812:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    microdelay(10);
+80109818:	83 ec 0c             	sub    $0xc,%esp
+8010981b:	6a 0a                	push   $0xa
+8010981d:	e8 be a6 ff ff       	call   80103ee0 <microdelay>
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109822:	83 c4 10             	add    $0x10,%esp
+80109825:	83 eb 01             	sub    $0x1,%ebx
+80109828:	74 07                	je     80109831 <uartputc+0x41>
+8010982a:	89 f2                	mov    %esi,%edx
+8010982c:	ec                   	in     (%dx),%al
+8010982d:	a8 20                	test   $0x20,%al
+8010982f:	74 e7                	je     80109818 <uartputc+0x28>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109831:	8b 45 08             	mov    0x8(%ebp),%eax
+80109834:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109839:	ee                   	out    %al,(%dx)
+}
+8010983a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010983d:	5b                   	pop    %ebx
+8010983e:	5e                   	pop    %esi
+8010983f:	5d                   	pop    %ebp
+80109840:	c3                   	ret
+80109841:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109848:	c3                   	ret
+80109849:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80109850 <uartintr>:
+
+void
+uartintr(void)
+{
+80109850:	55                   	push   %ebp
+80109851:	89 e5                	mov    %esp,%ebp
+80109853:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(uartgetc);
+80109856:	68 d0 96 10 80       	push   $0x801096d0
+8010985b:	e8 a0 81 ff ff       	call   80101a00 <consoleintr>
+}
+80109860:	83 c4 10             	add    $0x10,%esp
+80109863:	c9                   	leave
+80109864:	c3                   	ret
+
+80109865 <vector0>:
+# generated by vectors.pl - do not edit
+# handlers
+.globl alltraps
+.globl vector0
+vector0:
+  pushl $0
+80109865:	6a 00                	push   $0x0
+  pushl $0
+80109867:	6a 00                	push   $0x0
+  jmp alltraps
+80109869:	e9 5c fa ff ff       	jmp    801092ca <alltraps>
+
+8010986e <vector1>:
+.globl vector1
+vector1:
+  pushl $0
+8010986e:	6a 00                	push   $0x0
+  pushl $1
+80109870:	6a 01                	push   $0x1
+  jmp alltraps
+80109872:	e9 53 fa ff ff       	jmp    801092ca <alltraps>
+
+80109877 <vector2>:
+.globl vector2
+vector2:
+  pushl $0
+80109877:	6a 00                	push   $0x0
+  pushl $2
+80109879:	6a 02                	push   $0x2
+  jmp alltraps
+8010987b:	e9 4a fa ff ff       	jmp    801092ca <alltraps>
+
+80109880 <vector3>:
+.globl vector3
+vector3:
+  pushl $0
+80109880:	6a 00                	push   $0x0
+  pushl $3
+80109882:	6a 03                	push   $0x3
+  jmp alltraps
+80109884:	e9 41 fa ff ff       	jmp    801092ca <alltraps>
+
+80109889 <vector4>:
+.globl vector4
+vector4:
+  pushl $0
+80109889:	6a 00                	push   $0x0
+  pushl $4
+8010988b:	6a 04                	push   $0x4
+  jmp alltraps
+8010988d:	e9 38 fa ff ff       	jmp    801092ca <alltraps>
+
+80109892 <vector5>:
+.globl vector5
+vector5:
+  pushl $0
+80109892:	6a 00                	push   $0x0
+  pushl $5
+80109894:	6a 05                	push   $0x5
+  jmp alltraps
+80109896:	e9 2f fa ff ff       	jmp    801092ca <alltraps>
+
+8010989b <vector6>:
+.globl vector6
+vector6:
+  pushl $0
+8010989b:	6a 00                	push   $0x0
+  pushl $6
+8010989d:	6a 06                	push   $0x6
+  jmp alltraps
+8010989f:	e9 26 fa ff ff       	jmp    801092ca <alltraps>
+
+801098a4 <vector7>:
+.globl vector7
+vector7:
+  pushl $0
+801098a4:	6a 00                	push   $0x0
+  pushl $7
+801098a6:	6a 07                	push   $0x7
+  jmp alltraps
+801098a8:	e9 1d fa ff ff       	jmp    801092ca <alltraps>
+
+801098ad <vector8>:
+.globl vector8
+vector8:
+  pushl $8
+801098ad:	6a 08                	push   $0x8
+  jmp alltraps
+801098af:	e9 16 fa ff ff       	jmp    801092ca <alltraps>
+
+801098b4 <vector9>:
+.globl vector9
+vector9:
+  pushl $0
+801098b4:	6a 00                	push   $0x0
+  pushl $9
+801098b6:	6a 09                	push   $0x9
+  jmp alltraps
+801098b8:	e9 0d fa ff ff       	jmp    801092ca <alltraps>
+
+801098bd <vector10>:
+.globl vector10
+vector10:
+  pushl $10
+801098bd:	6a 0a                	push   $0xa
+  jmp alltraps
+801098bf:	e9 06 fa ff ff       	jmp    801092ca <alltraps>
+
+801098c4 <vector11>:
+.globl vector11
+vector11:
+  pushl $11
+801098c4:	6a 0b                	push   $0xb
+  jmp alltraps
+801098c6:	e9 ff f9 ff ff       	jmp    801092ca <alltraps>
+
+801098cb <vector12>:
+.globl vector12
+vector12:
+  pushl $12
+801098cb:	6a 0c                	push   $0xc
+  jmp alltraps
+801098cd:	e9 f8 f9 ff ff       	jmp    801092ca <alltraps>
+
+801098d2 <vector13>:
+.globl vector13
+vector13:
+  pushl $13
+801098d2:	6a 0d                	push   $0xd
+  jmp alltraps
+801098d4:	e9 f1 f9 ff ff       	jmp    801092ca <alltraps>
+
+801098d9 <vector14>:
+.globl vector14
+vector14:
+  pushl $14
+801098d9:	6a 0e                	push   $0xe
+  jmp alltraps
+801098db:	e9 ea f9 ff ff       	jmp    801092ca <alltraps>
+
+801098e0 <vector15>:
+.globl vector15
+vector15:
+  pushl $0
+801098e0:	6a 00                	push   $0x0
+  pushl $15
+801098e2:	6a 0f                	push   $0xf
+  jmp alltraps
+801098e4:	e9 e1 f9 ff ff       	jmp    801092ca <alltraps>
+
+801098e9 <vector16>:
+.globl vector16
+vector16:
+  pushl $0
+801098e9:	6a 00                	push   $0x0
+  pushl $16
+801098eb:	6a 10                	push   $0x10
+  jmp alltraps
+801098ed:	e9 d8 f9 ff ff       	jmp    801092ca <alltraps>
+
+801098f2 <vector17>:
+.globl vector17
+vector17:
+  pushl $17
+801098f2:	6a 11                	push   $0x11
+  jmp alltraps
+801098f4:	e9 d1 f9 ff ff       	jmp    801092ca <alltraps>
+
+801098f9 <vector18>:
+.globl vector18
+vector18:
+  pushl $0
+801098f9:	6a 00                	push   $0x0
+  pushl $18
+801098fb:	6a 12                	push   $0x12
+  jmp alltraps
+801098fd:	e9 c8 f9 ff ff       	jmp    801092ca <alltraps>
+
+80109902 <vector19>:
+.globl vector19
+vector19:
+  pushl $0
+80109902:	6a 00                	push   $0x0
+  pushl $19
+80109904:	6a 13                	push   $0x13
+  jmp alltraps
+80109906:	e9 bf f9 ff ff       	jmp    801092ca <alltraps>
+
+8010990b <vector20>:
+.globl vector20
+vector20:
+  pushl $0
+8010990b:	6a 00                	push   $0x0
+  pushl $20
+8010990d:	6a 14                	push   $0x14
+  jmp alltraps
+8010990f:	e9 b6 f9 ff ff       	jmp    801092ca <alltraps>
+
+80109914 <vector21>:
+.globl vector21
+vector21:
+  pushl $0
+80109914:	6a 00                	push   $0x0
+  pushl $21
+80109916:	6a 15                	push   $0x15
+  jmp alltraps
+80109918:	e9 ad f9 ff ff       	jmp    801092ca <alltraps>
+
+8010991d <vector22>:
+.globl vector22
+vector22:
+  pushl $0
+8010991d:	6a 00                	push   $0x0
+  pushl $22
+8010991f:	6a 16                	push   $0x16
+  jmp alltraps
+80109921:	e9 a4 f9 ff ff       	jmp    801092ca <alltraps>
+
+80109926 <vector23>:
+.globl vector23
+vector23:
+  pushl $0
+80109926:	6a 00                	push   $0x0
+  pushl $23
+80109928:	6a 17                	push   $0x17
+  jmp alltraps
+8010992a:	e9 9b f9 ff ff       	jmp    801092ca <alltraps>
+
+8010992f <vector24>:
+.globl vector24
+vector24:
+  pushl $0
+8010992f:	6a 00                	push   $0x0
+  pushl $24
+80109931:	6a 18                	push   $0x18
+  jmp alltraps
+80109933:	e9 92 f9 ff ff       	jmp    801092ca <alltraps>
+
+80109938 <vector25>:
+.globl vector25
+vector25:
+  pushl $0
+80109938:	6a 00                	push   $0x0
+  pushl $25
+8010993a:	6a 19                	push   $0x19
+  jmp alltraps
+8010993c:	e9 89 f9 ff ff       	jmp    801092ca <alltraps>
+
+80109941 <vector26>:
+.globl vector26
+vector26:
+  pushl $0
+80109941:	6a 00                	push   $0x0
+  pushl $26
+80109943:	6a 1a                	push   $0x1a
+  jmp alltraps
+80109945:	e9 80 f9 ff ff       	jmp    801092ca <alltraps>
+
+8010994a <vector27>:
+.globl vector27
+vector27:
+  pushl $0
+8010994a:	6a 00                	push   $0x0
+  pushl $27
+8010994c:	6a 1b                	push   $0x1b
+  jmp alltraps
+8010994e:	e9 77 f9 ff ff       	jmp    801092ca <alltraps>
+
+80109953 <vector28>:
+.globl vector28
+vector28:
+  pushl $0
+80109953:	6a 00                	push   $0x0
+  pushl $28
+80109955:	6a 1c                	push   $0x1c
+  jmp alltraps
+80109957:	e9 6e f9 ff ff       	jmp    801092ca <alltraps>
+
+8010995c <vector29>:
+.globl vector29
+vector29:
+  pushl $0
+8010995c:	6a 00                	push   $0x0
+  pushl $29
+8010995e:	6a 1d                	push   $0x1d
+  jmp alltraps
+80109960:	e9 65 f9 ff ff       	jmp    801092ca <alltraps>
+
+80109965 <vector30>:
+.globl vector30
+vector30:
+  pushl $0
+80109965:	6a 00                	push   $0x0
+  pushl $30
+80109967:	6a 1e                	push   $0x1e
+  jmp alltraps
+80109969:	e9 5c f9 ff ff       	jmp    801092ca <alltraps>
+
+8010996e <vector31>:
+.globl vector31
+vector31:
+  pushl $0
+8010996e:	6a 00                	push   $0x0
+  pushl $31
+80109970:	6a 1f                	push   $0x1f
+  jmp alltraps
+80109972:	e9 53 f9 ff ff       	jmp    801092ca <alltraps>
+
+80109977 <vector32>:
+.globl vector32
+vector32:
+  pushl $0
+80109977:	6a 00                	push   $0x0
+  pushl $32
+80109979:	6a 20                	push   $0x20
+  jmp alltraps
+8010997b:	e9 4a f9 ff ff       	jmp    801092ca <alltraps>
+
+80109980 <vector33>:
+.globl vector33
+vector33:
+  pushl $0
+80109980:	6a 00                	push   $0x0
+  pushl $33
+80109982:	6a 21                	push   $0x21
+  jmp alltraps
+80109984:	e9 41 f9 ff ff       	jmp    801092ca <alltraps>
+
+80109989 <vector34>:
+.globl vector34
+vector34:
+  pushl $0
+80109989:	6a 00                	push   $0x0
+  pushl $34
+8010998b:	6a 22                	push   $0x22
+  jmp alltraps
+8010998d:	e9 38 f9 ff ff       	jmp    801092ca <alltraps>
+
+80109992 <vector35>:
+.globl vector35
+vector35:
+  pushl $0
+80109992:	6a 00                	push   $0x0
+  pushl $35
+80109994:	6a 23                	push   $0x23
+  jmp alltraps
+80109996:	e9 2f f9 ff ff       	jmp    801092ca <alltraps>
+
+8010999b <vector36>:
+.globl vector36
+vector36:
+  pushl $0
+8010999b:	6a 00                	push   $0x0
+  pushl $36
+8010999d:	6a 24                	push   $0x24
+  jmp alltraps
+8010999f:	e9 26 f9 ff ff       	jmp    801092ca <alltraps>
+
+801099a4 <vector37>:
+.globl vector37
+vector37:
+  pushl $0
+801099a4:	6a 00                	push   $0x0
+  pushl $37
+801099a6:	6a 25                	push   $0x25
+  jmp alltraps
+801099a8:	e9 1d f9 ff ff       	jmp    801092ca <alltraps>
+
+801099ad <vector38>:
+.globl vector38
+vector38:
+  pushl $0
+801099ad:	6a 00                	push   $0x0
+  pushl $38
+801099af:	6a 26                	push   $0x26
+  jmp alltraps
+801099b1:	e9 14 f9 ff ff       	jmp    801092ca <alltraps>
+
+801099b6 <vector39>:
+.globl vector39
+vector39:
+  pushl $0
+801099b6:	6a 00                	push   $0x0
+  pushl $39
+801099b8:	6a 27                	push   $0x27
+  jmp alltraps
+801099ba:	e9 0b f9 ff ff       	jmp    801092ca <alltraps>
+
+801099bf <vector40>:
+.globl vector40
+vector40:
+  pushl $0
+801099bf:	6a 00                	push   $0x0
+  pushl $40
+801099c1:	6a 28                	push   $0x28
+  jmp alltraps
+801099c3:	e9 02 f9 ff ff       	jmp    801092ca <alltraps>
+
+801099c8 <vector41>:
+.globl vector41
+vector41:
+  pushl $0
+801099c8:	6a 00                	push   $0x0
+  pushl $41
+801099ca:	6a 29                	push   $0x29
+  jmp alltraps
+801099cc:	e9 f9 f8 ff ff       	jmp    801092ca <alltraps>
+
+801099d1 <vector42>:
+.globl vector42
+vector42:
+  pushl $0
+801099d1:	6a 00                	push   $0x0
+  pushl $42
+801099d3:	6a 2a                	push   $0x2a
+  jmp alltraps
+801099d5:	e9 f0 f8 ff ff       	jmp    801092ca <alltraps>
+
+801099da <vector43>:
+.globl vector43
+vector43:
+  pushl $0
+801099da:	6a 00                	push   $0x0
+  pushl $43
+801099dc:	6a 2b                	push   $0x2b
+  jmp alltraps
+801099de:	e9 e7 f8 ff ff       	jmp    801092ca <alltraps>
+
+801099e3 <vector44>:
+.globl vector44
+vector44:
+  pushl $0
+801099e3:	6a 00                	push   $0x0
+  pushl $44
+801099e5:	6a 2c                	push   $0x2c
+  jmp alltraps
+801099e7:	e9 de f8 ff ff       	jmp    801092ca <alltraps>
+
+801099ec <vector45>:
+.globl vector45
+vector45:
+  pushl $0
+801099ec:	6a 00                	push   $0x0
+  pushl $45
+801099ee:	6a 2d                	push   $0x2d
+  jmp alltraps
+801099f0:	e9 d5 f8 ff ff       	jmp    801092ca <alltraps>
+
+801099f5 <vector46>:
+.globl vector46
+vector46:
+  pushl $0
+801099f5:	6a 00                	push   $0x0
+  pushl $46
+801099f7:	6a 2e                	push   $0x2e
+  jmp alltraps
+801099f9:	e9 cc f8 ff ff       	jmp    801092ca <alltraps>
+
+801099fe <vector47>:
+.globl vector47
+vector47:
+  pushl $0
+801099fe:	6a 00                	push   $0x0
+  pushl $47
+80109a00:	6a 2f                	push   $0x2f
+  jmp alltraps
+80109a02:	e9 c3 f8 ff ff       	jmp    801092ca <alltraps>
+
+80109a07 <vector48>:
+.globl vector48
+vector48:
+  pushl $0
+80109a07:	6a 00                	push   $0x0
+  pushl $48
+80109a09:	6a 30                	push   $0x30
+  jmp alltraps
+80109a0b:	e9 ba f8 ff ff       	jmp    801092ca <alltraps>
+
+80109a10 <vector49>:
+.globl vector49
+vector49:
+  pushl $0
+80109a10:	6a 00                	push   $0x0
+  pushl $49
+80109a12:	6a 31                	push   $0x31
+  jmp alltraps
+80109a14:	e9 b1 f8 ff ff       	jmp    801092ca <alltraps>
+
+80109a19 <vector50>:
+.globl vector50
+vector50:
+  pushl $0
+80109a19:	6a 00                	push   $0x0
+  pushl $50
+80109a1b:	6a 32                	push   $0x32
+  jmp alltraps
+80109a1d:	e9 a8 f8 ff ff       	jmp    801092ca <alltraps>
+
+80109a22 <vector51>:
+.globl vector51
+vector51:
+  pushl $0
+80109a22:	6a 00                	push   $0x0
+  pushl $51
+80109a24:	6a 33                	push   $0x33
+  jmp alltraps
+80109a26:	e9 9f f8 ff ff       	jmp    801092ca <alltraps>
+
+80109a2b <vector52>:
+.globl vector52
+vector52:
+  pushl $0
+80109a2b:	6a 00                	push   $0x0
+  pushl $52
+80109a2d:	6a 34                	push   $0x34
+  jmp alltraps
+80109a2f:	e9 96 f8 ff ff       	jmp    801092ca <alltraps>
+
+80109a34 <vector53>:
+.globl vector53
+vector53:
+  pushl $0
+80109a34:	6a 00                	push   $0x0
+  pushl $53
+80109a36:	6a 35                	push   $0x35
+  jmp alltraps
+80109a38:	e9 8d f8 ff ff       	jmp    801092ca <alltraps>
+
+80109a3d <vector54>:
+.globl vector54
+vector54:
+  pushl $0
+80109a3d:	6a 00                	push   $0x0
+  pushl $54
+80109a3f:	6a 36                	push   $0x36
+  jmp alltraps
+80109a41:	e9 84 f8 ff ff       	jmp    801092ca <alltraps>
+
+80109a46 <vector55>:
+.globl vector55
+vector55:
+  pushl $0
+80109a46:	6a 00                	push   $0x0
+  pushl $55
+80109a48:	6a 37                	push   $0x37
+  jmp alltraps
+80109a4a:	e9 7b f8 ff ff       	jmp    801092ca <alltraps>
+
+80109a4f <vector56>:
+.globl vector56
+vector56:
+  pushl $0
+80109a4f:	6a 00                	push   $0x0
+  pushl $56
+80109a51:	6a 38                	push   $0x38
+  jmp alltraps
+80109a53:	e9 72 f8 ff ff       	jmp    801092ca <alltraps>
+
+80109a58 <vector57>:
+.globl vector57
+vector57:
+  pushl $0
+80109a58:	6a 00                	push   $0x0
+  pushl $57
+80109a5a:	6a 39                	push   $0x39
+  jmp alltraps
+80109a5c:	e9 69 f8 ff ff       	jmp    801092ca <alltraps>
+
+80109a61 <vector58>:
+.globl vector58
+vector58:
+  pushl $0
+80109a61:	6a 00                	push   $0x0
+  pushl $58
+80109a63:	6a 3a                	push   $0x3a
+  jmp alltraps
+80109a65:	e9 60 f8 ff ff       	jmp    801092ca <alltraps>
+
+80109a6a <vector59>:
+.globl vector59
+vector59:
+  pushl $0
+80109a6a:	6a 00                	push   $0x0
+  pushl $59
+80109a6c:	6a 3b                	push   $0x3b
+  jmp alltraps
+80109a6e:	e9 57 f8 ff ff       	jmp    801092ca <alltraps>
+
+80109a73 <vector60>:
+.globl vector60
+vector60:
+  pushl $0
+80109a73:	6a 00                	push   $0x0
+  pushl $60
+80109a75:	6a 3c                	push   $0x3c
+  jmp alltraps
+80109a77:	e9 4e f8 ff ff       	jmp    801092ca <alltraps>
+
+80109a7c <vector61>:
+.globl vector61
+vector61:
+  pushl $0
+80109a7c:	6a 00                	push   $0x0
+  pushl $61
+80109a7e:	6a 3d                	push   $0x3d
+  jmp alltraps
+80109a80:	e9 45 f8 ff ff       	jmp    801092ca <alltraps>
+
+80109a85 <vector62>:
+.globl vector62
+vector62:
+  pushl $0
+80109a85:	6a 00                	push   $0x0
+  pushl $62
+80109a87:	6a 3e                	push   $0x3e
+  jmp alltraps
+80109a89:	e9 3c f8 ff ff       	jmp    801092ca <alltraps>
+
+80109a8e <vector63>:
+.globl vector63
+vector63:
+  pushl $0
+80109a8e:	6a 00                	push   $0x0
+  pushl $63
+80109a90:	6a 3f                	push   $0x3f
+  jmp alltraps
+80109a92:	e9 33 f8 ff ff       	jmp    801092ca <alltraps>
+
+80109a97 <vector64>:
+.globl vector64
+vector64:
+  pushl $0
+80109a97:	6a 00                	push   $0x0
+  pushl $64
+80109a99:	6a 40                	push   $0x40
+  jmp alltraps
+80109a9b:	e9 2a f8 ff ff       	jmp    801092ca <alltraps>
+
+80109aa0 <vector65>:
+.globl vector65
+vector65:
+  pushl $0
+80109aa0:	6a 00                	push   $0x0
+  pushl $65
+80109aa2:	6a 41                	push   $0x41
+  jmp alltraps
+80109aa4:	e9 21 f8 ff ff       	jmp    801092ca <alltraps>
+
+80109aa9 <vector66>:
+.globl vector66
+vector66:
+  pushl $0
+80109aa9:	6a 00                	push   $0x0
+  pushl $66
+80109aab:	6a 42                	push   $0x42
+  jmp alltraps
+80109aad:	e9 18 f8 ff ff       	jmp    801092ca <alltraps>
+
+80109ab2 <vector67>:
+.globl vector67
+vector67:
+  pushl $0
+80109ab2:	6a 00                	push   $0x0
+  pushl $67
+80109ab4:	6a 43                	push   $0x43
+  jmp alltraps
+80109ab6:	e9 0f f8 ff ff       	jmp    801092ca <alltraps>
+
+80109abb <vector68>:
+.globl vector68
+vector68:
+  pushl $0
+80109abb:	6a 00                	push   $0x0
+  pushl $68
+80109abd:	6a 44                	push   $0x44
+  jmp alltraps
+80109abf:	e9 06 f8 ff ff       	jmp    801092ca <alltraps>
+
+80109ac4 <vector69>:
+.globl vector69
+vector69:
+  pushl $0
+80109ac4:	6a 00                	push   $0x0
+  pushl $69
+80109ac6:	6a 45                	push   $0x45
+  jmp alltraps
+80109ac8:	e9 fd f7 ff ff       	jmp    801092ca <alltraps>
+
+80109acd <vector70>:
+.globl vector70
+vector70:
+  pushl $0
+80109acd:	6a 00                	push   $0x0
+  pushl $70
+80109acf:	6a 46                	push   $0x46
+  jmp alltraps
+80109ad1:	e9 f4 f7 ff ff       	jmp    801092ca <alltraps>
+
+80109ad6 <vector71>:
+.globl vector71
+vector71:
+  pushl $0
+80109ad6:	6a 00                	push   $0x0
+  pushl $71
+80109ad8:	6a 47                	push   $0x47
+  jmp alltraps
+80109ada:	e9 eb f7 ff ff       	jmp    801092ca <alltraps>
+
+80109adf <vector72>:
+.globl vector72
+vector72:
+  pushl $0
+80109adf:	6a 00                	push   $0x0
+  pushl $72
+80109ae1:	6a 48                	push   $0x48
+  jmp alltraps
+80109ae3:	e9 e2 f7 ff ff       	jmp    801092ca <alltraps>
+
+80109ae8 <vector73>:
+.globl vector73
+vector73:
+  pushl $0
+80109ae8:	6a 00                	push   $0x0
+  pushl $73
+80109aea:	6a 49                	push   $0x49
+  jmp alltraps
+80109aec:	e9 d9 f7 ff ff       	jmp    801092ca <alltraps>
+
+80109af1 <vector74>:
+.globl vector74
+vector74:
+  pushl $0
+80109af1:	6a 00                	push   $0x0
+  pushl $74
+80109af3:	6a 4a                	push   $0x4a
+  jmp alltraps
+80109af5:	e9 d0 f7 ff ff       	jmp    801092ca <alltraps>
+
+80109afa <vector75>:
+.globl vector75
+vector75:
+  pushl $0
+80109afa:	6a 00                	push   $0x0
+  pushl $75
+80109afc:	6a 4b                	push   $0x4b
+  jmp alltraps
+80109afe:	e9 c7 f7 ff ff       	jmp    801092ca <alltraps>
+
+80109b03 <vector76>:
+.globl vector76
+vector76:
+  pushl $0
+80109b03:	6a 00                	push   $0x0
+  pushl $76
+80109b05:	6a 4c                	push   $0x4c
+  jmp alltraps
+80109b07:	e9 be f7 ff ff       	jmp    801092ca <alltraps>
+
+80109b0c <vector77>:
+.globl vector77
+vector77:
+  pushl $0
+80109b0c:	6a 00                	push   $0x0
+  pushl $77
+80109b0e:	6a 4d                	push   $0x4d
+  jmp alltraps
+80109b10:	e9 b5 f7 ff ff       	jmp    801092ca <alltraps>
+
+80109b15 <vector78>:
+.globl vector78
+vector78:
+  pushl $0
+80109b15:	6a 00                	push   $0x0
+  pushl $78
+80109b17:	6a 4e                	push   $0x4e
+  jmp alltraps
+80109b19:	e9 ac f7 ff ff       	jmp    801092ca <alltraps>
+
+80109b1e <vector79>:
+.globl vector79
+vector79:
+  pushl $0
+80109b1e:	6a 00                	push   $0x0
+  pushl $79
+80109b20:	6a 4f                	push   $0x4f
+  jmp alltraps
+80109b22:	e9 a3 f7 ff ff       	jmp    801092ca <alltraps>
+
+80109b27 <vector80>:
+.globl vector80
+vector80:
+  pushl $0
+80109b27:	6a 00                	push   $0x0
+  pushl $80
+80109b29:	6a 50                	push   $0x50
+  jmp alltraps
+80109b2b:	e9 9a f7 ff ff       	jmp    801092ca <alltraps>
+
+80109b30 <vector81>:
+.globl vector81
+vector81:
+  pushl $0
+80109b30:	6a 00                	push   $0x0
+  pushl $81
+80109b32:	6a 51                	push   $0x51
+  jmp alltraps
+80109b34:	e9 91 f7 ff ff       	jmp    801092ca <alltraps>
+
+80109b39 <vector82>:
+.globl vector82
+vector82:
+  pushl $0
+80109b39:	6a 00                	push   $0x0
+  pushl $82
+80109b3b:	6a 52                	push   $0x52
+  jmp alltraps
+80109b3d:	e9 88 f7 ff ff       	jmp    801092ca <alltraps>
+
+80109b42 <vector83>:
+.globl vector83
+vector83:
+  pushl $0
+80109b42:	6a 00                	push   $0x0
+  pushl $83
+80109b44:	6a 53                	push   $0x53
+  jmp alltraps
+80109b46:	e9 7f f7 ff ff       	jmp    801092ca <alltraps>
+
+80109b4b <vector84>:
+.globl vector84
+vector84:
+  pushl $0
+80109b4b:	6a 00                	push   $0x0
+  pushl $84
+80109b4d:	6a 54                	push   $0x54
+  jmp alltraps
+80109b4f:	e9 76 f7 ff ff       	jmp    801092ca <alltraps>
+
+80109b54 <vector85>:
+.globl vector85
+vector85:
+  pushl $0
+80109b54:	6a 00                	push   $0x0
+  pushl $85
+80109b56:	6a 55                	push   $0x55
+  jmp alltraps
+80109b58:	e9 6d f7 ff ff       	jmp    801092ca <alltraps>
+
+80109b5d <vector86>:
+.globl vector86
+vector86:
+  pushl $0
+80109b5d:	6a 00                	push   $0x0
+  pushl $86
+80109b5f:	6a 56                	push   $0x56
+  jmp alltraps
+80109b61:	e9 64 f7 ff ff       	jmp    801092ca <alltraps>
+
+80109b66 <vector87>:
+.globl vector87
+vector87:
+  pushl $0
+80109b66:	6a 00                	push   $0x0
+  pushl $87
+80109b68:	6a 57                	push   $0x57
+  jmp alltraps
+80109b6a:	e9 5b f7 ff ff       	jmp    801092ca <alltraps>
+
+80109b6f <vector88>:
+.globl vector88
+vector88:
+  pushl $0
+80109b6f:	6a 00                	push   $0x0
+  pushl $88
+80109b71:	6a 58                	push   $0x58
+  jmp alltraps
+80109b73:	e9 52 f7 ff ff       	jmp    801092ca <alltraps>
+
+80109b78 <vector89>:
+.globl vector89
+vector89:
+  pushl $0
+80109b78:	6a 00                	push   $0x0
+  pushl $89
+80109b7a:	6a 59                	push   $0x59
+  jmp alltraps
+80109b7c:	e9 49 f7 ff ff       	jmp    801092ca <alltraps>
+
+80109b81 <vector90>:
+.globl vector90
+vector90:
+  pushl $0
+80109b81:	6a 00                	push   $0x0
+  pushl $90
+80109b83:	6a 5a                	push   $0x5a
+  jmp alltraps
+80109b85:	e9 40 f7 ff ff       	jmp    801092ca <alltraps>
+
+80109b8a <vector91>:
+.globl vector91
+vector91:
+  pushl $0
+80109b8a:	6a 00                	push   $0x0
+  pushl $91
+80109b8c:	6a 5b                	push   $0x5b
+  jmp alltraps
+80109b8e:	e9 37 f7 ff ff       	jmp    801092ca <alltraps>
+
+80109b93 <vector92>:
+.globl vector92
+vector92:
+  pushl $0
+80109b93:	6a 00                	push   $0x0
+  pushl $92
+80109b95:	6a 5c                	push   $0x5c
+  jmp alltraps
+80109b97:	e9 2e f7 ff ff       	jmp    801092ca <alltraps>
+
+80109b9c <vector93>:
+.globl vector93
+vector93:
+  pushl $0
+80109b9c:	6a 00                	push   $0x0
+  pushl $93
+80109b9e:	6a 5d                	push   $0x5d
+  jmp alltraps
+80109ba0:	e9 25 f7 ff ff       	jmp    801092ca <alltraps>
+
+80109ba5 <vector94>:
+.globl vector94
+vector94:
+  pushl $0
+80109ba5:	6a 00                	push   $0x0
+  pushl $94
+80109ba7:	6a 5e                	push   $0x5e
+  jmp alltraps
+80109ba9:	e9 1c f7 ff ff       	jmp    801092ca <alltraps>
+
+80109bae <vector95>:
+.globl vector95
+vector95:
+  pushl $0
+80109bae:	6a 00                	push   $0x0
+  pushl $95
+80109bb0:	6a 5f                	push   $0x5f
+  jmp alltraps
+80109bb2:	e9 13 f7 ff ff       	jmp    801092ca <alltraps>
+
+80109bb7 <vector96>:
+.globl vector96
+vector96:
+  pushl $0
+80109bb7:	6a 00                	push   $0x0
+  pushl $96
+80109bb9:	6a 60                	push   $0x60
+  jmp alltraps
+80109bbb:	e9 0a f7 ff ff       	jmp    801092ca <alltraps>
+
+80109bc0 <vector97>:
+.globl vector97
+vector97:
+  pushl $0
+80109bc0:	6a 00                	push   $0x0
+  pushl $97
+80109bc2:	6a 61                	push   $0x61
+  jmp alltraps
+80109bc4:	e9 01 f7 ff ff       	jmp    801092ca <alltraps>
+
+80109bc9 <vector98>:
+.globl vector98
+vector98:
+  pushl $0
+80109bc9:	6a 00                	push   $0x0
+  pushl $98
+80109bcb:	6a 62                	push   $0x62
+  jmp alltraps
+80109bcd:	e9 f8 f6 ff ff       	jmp    801092ca <alltraps>
+
+80109bd2 <vector99>:
+.globl vector99
+vector99:
+  pushl $0
+80109bd2:	6a 00                	push   $0x0
+  pushl $99
+80109bd4:	6a 63                	push   $0x63
+  jmp alltraps
+80109bd6:	e9 ef f6 ff ff       	jmp    801092ca <alltraps>
+
+80109bdb <vector100>:
+.globl vector100
+vector100:
+  pushl $0
+80109bdb:	6a 00                	push   $0x0
+  pushl $100
+80109bdd:	6a 64                	push   $0x64
+  jmp alltraps
+80109bdf:	e9 e6 f6 ff ff       	jmp    801092ca <alltraps>
+
+80109be4 <vector101>:
+.globl vector101
+vector101:
+  pushl $0
+80109be4:	6a 00                	push   $0x0
+  pushl $101
+80109be6:	6a 65                	push   $0x65
+  jmp alltraps
+80109be8:	e9 dd f6 ff ff       	jmp    801092ca <alltraps>
+
+80109bed <vector102>:
+.globl vector102
+vector102:
+  pushl $0
+80109bed:	6a 00                	push   $0x0
+  pushl $102
+80109bef:	6a 66                	push   $0x66
+  jmp alltraps
+80109bf1:	e9 d4 f6 ff ff       	jmp    801092ca <alltraps>
+
+80109bf6 <vector103>:
+.globl vector103
+vector103:
+  pushl $0
+80109bf6:	6a 00                	push   $0x0
+  pushl $103
+80109bf8:	6a 67                	push   $0x67
+  jmp alltraps
+80109bfa:	e9 cb f6 ff ff       	jmp    801092ca <alltraps>
+
+80109bff <vector104>:
+.globl vector104
+vector104:
+  pushl $0
+80109bff:	6a 00                	push   $0x0
+  pushl $104
+80109c01:	6a 68                	push   $0x68
+  jmp alltraps
+80109c03:	e9 c2 f6 ff ff       	jmp    801092ca <alltraps>
+
+80109c08 <vector105>:
+.globl vector105
+vector105:
+  pushl $0
+80109c08:	6a 00                	push   $0x0
+  pushl $105
+80109c0a:	6a 69                	push   $0x69
+  jmp alltraps
+80109c0c:	e9 b9 f6 ff ff       	jmp    801092ca <alltraps>
+
+80109c11 <vector106>:
+.globl vector106
+vector106:
+  pushl $0
+80109c11:	6a 00                	push   $0x0
+  pushl $106
+80109c13:	6a 6a                	push   $0x6a
+  jmp alltraps
+80109c15:	e9 b0 f6 ff ff       	jmp    801092ca <alltraps>
+
+80109c1a <vector107>:
+.globl vector107
+vector107:
+  pushl $0
+80109c1a:	6a 00                	push   $0x0
+  pushl $107
+80109c1c:	6a 6b                	push   $0x6b
+  jmp alltraps
+80109c1e:	e9 a7 f6 ff ff       	jmp    801092ca <alltraps>
+
+80109c23 <vector108>:
+.globl vector108
+vector108:
+  pushl $0
+80109c23:	6a 00                	push   $0x0
+  pushl $108
+80109c25:	6a 6c                	push   $0x6c
+  jmp alltraps
+80109c27:	e9 9e f6 ff ff       	jmp    801092ca <alltraps>
+
+80109c2c <vector109>:
+.globl vector109
+vector109:
+  pushl $0
+80109c2c:	6a 00                	push   $0x0
+  pushl $109
+80109c2e:	6a 6d                	push   $0x6d
+  jmp alltraps
+80109c30:	e9 95 f6 ff ff       	jmp    801092ca <alltraps>
+
+80109c35 <vector110>:
+.globl vector110
+vector110:
+  pushl $0
+80109c35:	6a 00                	push   $0x0
+  pushl $110
+80109c37:	6a 6e                	push   $0x6e
+  jmp alltraps
+80109c39:	e9 8c f6 ff ff       	jmp    801092ca <alltraps>
+
+80109c3e <vector111>:
+.globl vector111
+vector111:
+  pushl $0
+80109c3e:	6a 00                	push   $0x0
+  pushl $111
+80109c40:	6a 6f                	push   $0x6f
+  jmp alltraps
+80109c42:	e9 83 f6 ff ff       	jmp    801092ca <alltraps>
+
+80109c47 <vector112>:
+.globl vector112
+vector112:
+  pushl $0
+80109c47:	6a 00                	push   $0x0
+  pushl $112
+80109c49:	6a 70                	push   $0x70
+  jmp alltraps
+80109c4b:	e9 7a f6 ff ff       	jmp    801092ca <alltraps>
+
+80109c50 <vector113>:
+.globl vector113
+vector113:
+  pushl $0
+80109c50:	6a 00                	push   $0x0
+  pushl $113
+80109c52:	6a 71                	push   $0x71
+  jmp alltraps
+80109c54:	e9 71 f6 ff ff       	jmp    801092ca <alltraps>
+
+80109c59 <vector114>:
+.globl vector114
+vector114:
+  pushl $0
+80109c59:	6a 00                	push   $0x0
+  pushl $114
+80109c5b:	6a 72                	push   $0x72
+  jmp alltraps
+80109c5d:	e9 68 f6 ff ff       	jmp    801092ca <alltraps>
+
+80109c62 <vector115>:
+.globl vector115
+vector115:
+  pushl $0
+80109c62:	6a 00                	push   $0x0
+  pushl $115
+80109c64:	6a 73                	push   $0x73
+  jmp alltraps
+80109c66:	e9 5f f6 ff ff       	jmp    801092ca <alltraps>
+
+80109c6b <vector116>:
+.globl vector116
+vector116:
+  pushl $0
+80109c6b:	6a 00                	push   $0x0
+  pushl $116
+80109c6d:	6a 74                	push   $0x74
+  jmp alltraps
+80109c6f:	e9 56 f6 ff ff       	jmp    801092ca <alltraps>
+
+80109c74 <vector117>:
+.globl vector117
+vector117:
+  pushl $0
+80109c74:	6a 00                	push   $0x0
+  pushl $117
+80109c76:	6a 75                	push   $0x75
+  jmp alltraps
+80109c78:	e9 4d f6 ff ff       	jmp    801092ca <alltraps>
+
+80109c7d <vector118>:
+.globl vector118
+vector118:
+  pushl $0
+80109c7d:	6a 00                	push   $0x0
+  pushl $118
+80109c7f:	6a 76                	push   $0x76
+  jmp alltraps
+80109c81:	e9 44 f6 ff ff       	jmp    801092ca <alltraps>
+
+80109c86 <vector119>:
+.globl vector119
+vector119:
+  pushl $0
+80109c86:	6a 00                	push   $0x0
+  pushl $119
+80109c88:	6a 77                	push   $0x77
+  jmp alltraps
+80109c8a:	e9 3b f6 ff ff       	jmp    801092ca <alltraps>
+
+80109c8f <vector120>:
+.globl vector120
+vector120:
+  pushl $0
+80109c8f:	6a 00                	push   $0x0
+  pushl $120
+80109c91:	6a 78                	push   $0x78
+  jmp alltraps
+80109c93:	e9 32 f6 ff ff       	jmp    801092ca <alltraps>
+
+80109c98 <vector121>:
+.globl vector121
+vector121:
+  pushl $0
+80109c98:	6a 00                	push   $0x0
+  pushl $121
+80109c9a:	6a 79                	push   $0x79
+  jmp alltraps
+80109c9c:	e9 29 f6 ff ff       	jmp    801092ca <alltraps>
+
+80109ca1 <vector122>:
+.globl vector122
+vector122:
+  pushl $0
+80109ca1:	6a 00                	push   $0x0
+  pushl $122
+80109ca3:	6a 7a                	push   $0x7a
+  jmp alltraps
+80109ca5:	e9 20 f6 ff ff       	jmp    801092ca <alltraps>
+
+80109caa <vector123>:
+.globl vector123
+vector123:
+  pushl $0
+80109caa:	6a 00                	push   $0x0
+  pushl $123
+80109cac:	6a 7b                	push   $0x7b
+  jmp alltraps
+80109cae:	e9 17 f6 ff ff       	jmp    801092ca <alltraps>
+
+80109cb3 <vector124>:
+.globl vector124
+vector124:
+  pushl $0
+80109cb3:	6a 00                	push   $0x0
+  pushl $124
+80109cb5:	6a 7c                	push   $0x7c
+  jmp alltraps
+80109cb7:	e9 0e f6 ff ff       	jmp    801092ca <alltraps>
+
+80109cbc <vector125>:
+.globl vector125
+vector125:
+  pushl $0
+80109cbc:	6a 00                	push   $0x0
+  pushl $125
+80109cbe:	6a 7d                	push   $0x7d
+  jmp alltraps
+80109cc0:	e9 05 f6 ff ff       	jmp    801092ca <alltraps>
+
+80109cc5 <vector126>:
+.globl vector126
+vector126:
+  pushl $0
+80109cc5:	6a 00                	push   $0x0
+  pushl $126
+80109cc7:	6a 7e                	push   $0x7e
+  jmp alltraps
+80109cc9:	e9 fc f5 ff ff       	jmp    801092ca <alltraps>
+
+80109cce <vector127>:
+.globl vector127
+vector127:
+  pushl $0
+80109cce:	6a 00                	push   $0x0
+  pushl $127
+80109cd0:	6a 7f                	push   $0x7f
+  jmp alltraps
+80109cd2:	e9 f3 f5 ff ff       	jmp    801092ca <alltraps>
+
+80109cd7 <vector128>:
+.globl vector128
+vector128:
+  pushl $0
+80109cd7:	6a 00                	push   $0x0
+  pushl $128
+80109cd9:	68 80 00 00 00       	push   $0x80
+  jmp alltraps
+80109cde:	e9 e7 f5 ff ff       	jmp    801092ca <alltraps>
+
+80109ce3 <vector129>:
+.globl vector129
+vector129:
+  pushl $0
+80109ce3:	6a 00                	push   $0x0
+  pushl $129
+80109ce5:	68 81 00 00 00       	push   $0x81
+  jmp alltraps
+80109cea:	e9 db f5 ff ff       	jmp    801092ca <alltraps>
+
+80109cef <vector130>:
+.globl vector130
+vector130:
+  pushl $0
+80109cef:	6a 00                	push   $0x0
+  pushl $130
+80109cf1:	68 82 00 00 00       	push   $0x82
+  jmp alltraps
+80109cf6:	e9 cf f5 ff ff       	jmp    801092ca <alltraps>
+
+80109cfb <vector131>:
+.globl vector131
+vector131:
+  pushl $0
+80109cfb:	6a 00                	push   $0x0
+  pushl $131
+80109cfd:	68 83 00 00 00       	push   $0x83
+  jmp alltraps
+80109d02:	e9 c3 f5 ff ff       	jmp    801092ca <alltraps>
+
+80109d07 <vector132>:
+.globl vector132
+vector132:
+  pushl $0
+80109d07:	6a 00                	push   $0x0
+  pushl $132
+80109d09:	68 84 00 00 00       	push   $0x84
+  jmp alltraps
+80109d0e:	e9 b7 f5 ff ff       	jmp    801092ca <alltraps>
+
+80109d13 <vector133>:
+.globl vector133
+vector133:
+  pushl $0
+80109d13:	6a 00                	push   $0x0
+  pushl $133
+80109d15:	68 85 00 00 00       	push   $0x85
+  jmp alltraps
+80109d1a:	e9 ab f5 ff ff       	jmp    801092ca <alltraps>
+
+80109d1f <vector134>:
+.globl vector134
+vector134:
+  pushl $0
+80109d1f:	6a 00                	push   $0x0
+  pushl $134
+80109d21:	68 86 00 00 00       	push   $0x86
+  jmp alltraps
+80109d26:	e9 9f f5 ff ff       	jmp    801092ca <alltraps>
+
+80109d2b <vector135>:
+.globl vector135
+vector135:
+  pushl $0
+80109d2b:	6a 00                	push   $0x0
+  pushl $135
+80109d2d:	68 87 00 00 00       	push   $0x87
+  jmp alltraps
+80109d32:	e9 93 f5 ff ff       	jmp    801092ca <alltraps>
+
+80109d37 <vector136>:
+.globl vector136
+vector136:
+  pushl $0
+80109d37:	6a 00                	push   $0x0
+  pushl $136
+80109d39:	68 88 00 00 00       	push   $0x88
+  jmp alltraps
+80109d3e:	e9 87 f5 ff ff       	jmp    801092ca <alltraps>
+
+80109d43 <vector137>:
+.globl vector137
+vector137:
+  pushl $0
+80109d43:	6a 00                	push   $0x0
+  pushl $137
+80109d45:	68 89 00 00 00       	push   $0x89
+  jmp alltraps
+80109d4a:	e9 7b f5 ff ff       	jmp    801092ca <alltraps>
+
+80109d4f <vector138>:
+.globl vector138
+vector138:
+  pushl $0
+80109d4f:	6a 00                	push   $0x0
+  pushl $138
+80109d51:	68 8a 00 00 00       	push   $0x8a
+  jmp alltraps
+80109d56:	e9 6f f5 ff ff       	jmp    801092ca <alltraps>
+
+80109d5b <vector139>:
+.globl vector139
+vector139:
+  pushl $0
+80109d5b:	6a 00                	push   $0x0
+  pushl $139
+80109d5d:	68 8b 00 00 00       	push   $0x8b
+  jmp alltraps
+80109d62:	e9 63 f5 ff ff       	jmp    801092ca <alltraps>
+
+80109d67 <vector140>:
+.globl vector140
+vector140:
+  pushl $0
+80109d67:	6a 00                	push   $0x0
+  pushl $140
+80109d69:	68 8c 00 00 00       	push   $0x8c
+  jmp alltraps
+80109d6e:	e9 57 f5 ff ff       	jmp    801092ca <alltraps>
+
+80109d73 <vector141>:
+.globl vector141
+vector141:
+  pushl $0
+80109d73:	6a 00                	push   $0x0
+  pushl $141
+80109d75:	68 8d 00 00 00       	push   $0x8d
+  jmp alltraps
+80109d7a:	e9 4b f5 ff ff       	jmp    801092ca <alltraps>
+
+80109d7f <vector142>:
+.globl vector142
+vector142:
+  pushl $0
+80109d7f:	6a 00                	push   $0x0
+  pushl $142
+80109d81:	68 8e 00 00 00       	push   $0x8e
+  jmp alltraps
+80109d86:	e9 3f f5 ff ff       	jmp    801092ca <alltraps>
+
+80109d8b <vector143>:
+.globl vector143
+vector143:
+  pushl $0
+80109d8b:	6a 00                	push   $0x0
+  pushl $143
+80109d8d:	68 8f 00 00 00       	push   $0x8f
+  jmp alltraps
+80109d92:	e9 33 f5 ff ff       	jmp    801092ca <alltraps>
+
+80109d97 <vector144>:
+.globl vector144
+vector144:
+  pushl $0
+80109d97:	6a 00                	push   $0x0
+  pushl $144
+80109d99:	68 90 00 00 00       	push   $0x90
+  jmp alltraps
+80109d9e:	e9 27 f5 ff ff       	jmp    801092ca <alltraps>
+
+80109da3 <vector145>:
+.globl vector145
+vector145:
+  pushl $0
+80109da3:	6a 00                	push   $0x0
+  pushl $145
+80109da5:	68 91 00 00 00       	push   $0x91
+  jmp alltraps
+80109daa:	e9 1b f5 ff ff       	jmp    801092ca <alltraps>
+
+80109daf <vector146>:
+.globl vector146
+vector146:
+  pushl $0
+80109daf:	6a 00                	push   $0x0
+  pushl $146
+80109db1:	68 92 00 00 00       	push   $0x92
+  jmp alltraps
+80109db6:	e9 0f f5 ff ff       	jmp    801092ca <alltraps>
+
+80109dbb <vector147>:
+.globl vector147
+vector147:
+  pushl $0
+80109dbb:	6a 00                	push   $0x0
+  pushl $147
+80109dbd:	68 93 00 00 00       	push   $0x93
+  jmp alltraps
+80109dc2:	e9 03 f5 ff ff       	jmp    801092ca <alltraps>
+
+80109dc7 <vector148>:
+.globl vector148
+vector148:
+  pushl $0
+80109dc7:	6a 00                	push   $0x0
+  pushl $148
+80109dc9:	68 94 00 00 00       	push   $0x94
+  jmp alltraps
+80109dce:	e9 f7 f4 ff ff       	jmp    801092ca <alltraps>
+
+80109dd3 <vector149>:
+.globl vector149
+vector149:
+  pushl $0
+80109dd3:	6a 00                	push   $0x0
+  pushl $149
+80109dd5:	68 95 00 00 00       	push   $0x95
+  jmp alltraps
+80109dda:	e9 eb f4 ff ff       	jmp    801092ca <alltraps>
+
+80109ddf <vector150>:
+.globl vector150
+vector150:
+  pushl $0
+80109ddf:	6a 00                	push   $0x0
+  pushl $150
+80109de1:	68 96 00 00 00       	push   $0x96
+  jmp alltraps
+80109de6:	e9 df f4 ff ff       	jmp    801092ca <alltraps>
+
+80109deb <vector151>:
+.globl vector151
+vector151:
+  pushl $0
+80109deb:	6a 00                	push   $0x0
+  pushl $151
+80109ded:	68 97 00 00 00       	push   $0x97
+  jmp alltraps
+80109df2:	e9 d3 f4 ff ff       	jmp    801092ca <alltraps>
+
+80109df7 <vector152>:
+.globl vector152
+vector152:
+  pushl $0
+80109df7:	6a 00                	push   $0x0
+  pushl $152
+80109df9:	68 98 00 00 00       	push   $0x98
+  jmp alltraps
+80109dfe:	e9 c7 f4 ff ff       	jmp    801092ca <alltraps>
+
+80109e03 <vector153>:
+.globl vector153
+vector153:
+  pushl $0
+80109e03:	6a 00                	push   $0x0
+  pushl $153
+80109e05:	68 99 00 00 00       	push   $0x99
+  jmp alltraps
+80109e0a:	e9 bb f4 ff ff       	jmp    801092ca <alltraps>
+
+80109e0f <vector154>:
+.globl vector154
+vector154:
+  pushl $0
+80109e0f:	6a 00                	push   $0x0
+  pushl $154
+80109e11:	68 9a 00 00 00       	push   $0x9a
+  jmp alltraps
+80109e16:	e9 af f4 ff ff       	jmp    801092ca <alltraps>
+
+80109e1b <vector155>:
+.globl vector155
+vector155:
+  pushl $0
+80109e1b:	6a 00                	push   $0x0
+  pushl $155
+80109e1d:	68 9b 00 00 00       	push   $0x9b
+  jmp alltraps
+80109e22:	e9 a3 f4 ff ff       	jmp    801092ca <alltraps>
+
+80109e27 <vector156>:
+.globl vector156
+vector156:
+  pushl $0
+80109e27:	6a 00                	push   $0x0
+  pushl $156
+80109e29:	68 9c 00 00 00       	push   $0x9c
+  jmp alltraps
+80109e2e:	e9 97 f4 ff ff       	jmp    801092ca <alltraps>
+
+80109e33 <vector157>:
+.globl vector157
+vector157:
+  pushl $0
+80109e33:	6a 00                	push   $0x0
+  pushl $157
+80109e35:	68 9d 00 00 00       	push   $0x9d
+  jmp alltraps
+80109e3a:	e9 8b f4 ff ff       	jmp    801092ca <alltraps>
+
+80109e3f <vector158>:
+.globl vector158
+vector158:
+  pushl $0
+80109e3f:	6a 00                	push   $0x0
+  pushl $158
+80109e41:	68 9e 00 00 00       	push   $0x9e
+  jmp alltraps
+80109e46:	e9 7f f4 ff ff       	jmp    801092ca <alltraps>
+
+80109e4b <vector159>:
+.globl vector159
+vector159:
+  pushl $0
+80109e4b:	6a 00                	push   $0x0
+  pushl $159
+80109e4d:	68 9f 00 00 00       	push   $0x9f
+  jmp alltraps
+80109e52:	e9 73 f4 ff ff       	jmp    801092ca <alltraps>
+
+80109e57 <vector160>:
+.globl vector160
+vector160:
+  pushl $0
+80109e57:	6a 00                	push   $0x0
+  pushl $160
+80109e59:	68 a0 00 00 00       	push   $0xa0
+  jmp alltraps
+80109e5e:	e9 67 f4 ff ff       	jmp    801092ca <alltraps>
+
+80109e63 <vector161>:
+.globl vector161
+vector161:
+  pushl $0
+80109e63:	6a 00                	push   $0x0
+  pushl $161
+80109e65:	68 a1 00 00 00       	push   $0xa1
+  jmp alltraps
+80109e6a:	e9 5b f4 ff ff       	jmp    801092ca <alltraps>
+
+80109e6f <vector162>:
+.globl vector162
+vector162:
+  pushl $0
+80109e6f:	6a 00                	push   $0x0
+  pushl $162
+80109e71:	68 a2 00 00 00       	push   $0xa2
+  jmp alltraps
+80109e76:	e9 4f f4 ff ff       	jmp    801092ca <alltraps>
+
+80109e7b <vector163>:
+.globl vector163
+vector163:
+  pushl $0
+80109e7b:	6a 00                	push   $0x0
+  pushl $163
+80109e7d:	68 a3 00 00 00       	push   $0xa3
+  jmp alltraps
+80109e82:	e9 43 f4 ff ff       	jmp    801092ca <alltraps>
+
+80109e87 <vector164>:
+.globl vector164
+vector164:
+  pushl $0
+80109e87:	6a 00                	push   $0x0
+  pushl $164
+80109e89:	68 a4 00 00 00       	push   $0xa4
+  jmp alltraps
+80109e8e:	e9 37 f4 ff ff       	jmp    801092ca <alltraps>
+
+80109e93 <vector165>:
+.globl vector165
+vector165:
+  pushl $0
+80109e93:	6a 00                	push   $0x0
+  pushl $165
+80109e95:	68 a5 00 00 00       	push   $0xa5
+  jmp alltraps
+80109e9a:	e9 2b f4 ff ff       	jmp    801092ca <alltraps>
+
+80109e9f <vector166>:
+.globl vector166
+vector166:
+  pushl $0
+80109e9f:	6a 00                	push   $0x0
+  pushl $166
+80109ea1:	68 a6 00 00 00       	push   $0xa6
+  jmp alltraps
+80109ea6:	e9 1f f4 ff ff       	jmp    801092ca <alltraps>
+
+80109eab <vector167>:
+.globl vector167
+vector167:
+  pushl $0
+80109eab:	6a 00                	push   $0x0
+  pushl $167
+80109ead:	68 a7 00 00 00       	push   $0xa7
+  jmp alltraps
+80109eb2:	e9 13 f4 ff ff       	jmp    801092ca <alltraps>
+
+80109eb7 <vector168>:
+.globl vector168
+vector168:
+  pushl $0
+80109eb7:	6a 00                	push   $0x0
+  pushl $168
+80109eb9:	68 a8 00 00 00       	push   $0xa8
+  jmp alltraps
+80109ebe:	e9 07 f4 ff ff       	jmp    801092ca <alltraps>
+
+80109ec3 <vector169>:
+.globl vector169
+vector169:
+  pushl $0
+80109ec3:	6a 00                	push   $0x0
+  pushl $169
+80109ec5:	68 a9 00 00 00       	push   $0xa9
+  jmp alltraps
+80109eca:	e9 fb f3 ff ff       	jmp    801092ca <alltraps>
+
+80109ecf <vector170>:
+.globl vector170
+vector170:
+  pushl $0
+80109ecf:	6a 00                	push   $0x0
+  pushl $170
+80109ed1:	68 aa 00 00 00       	push   $0xaa
+  jmp alltraps
+80109ed6:	e9 ef f3 ff ff       	jmp    801092ca <alltraps>
+
+80109edb <vector171>:
+.globl vector171
+vector171:
+  pushl $0
+80109edb:	6a 00                	push   $0x0
+  pushl $171
+80109edd:	68 ab 00 00 00       	push   $0xab
+  jmp alltraps
+80109ee2:	e9 e3 f3 ff ff       	jmp    801092ca <alltraps>
+
+80109ee7 <vector172>:
+.globl vector172
+vector172:
+  pushl $0
+80109ee7:	6a 00                	push   $0x0
+  pushl $172
+80109ee9:	68 ac 00 00 00       	push   $0xac
+  jmp alltraps
+80109eee:	e9 d7 f3 ff ff       	jmp    801092ca <alltraps>
+
+80109ef3 <vector173>:
+.globl vector173
+vector173:
+  pushl $0
+80109ef3:	6a 00                	push   $0x0
+  pushl $173
+80109ef5:	68 ad 00 00 00       	push   $0xad
+  jmp alltraps
+80109efa:	e9 cb f3 ff ff       	jmp    801092ca <alltraps>
+
+80109eff <vector174>:
+.globl vector174
+vector174:
+  pushl $0
+80109eff:	6a 00                	push   $0x0
+  pushl $174
+80109f01:	68 ae 00 00 00       	push   $0xae
+  jmp alltraps
+80109f06:	e9 bf f3 ff ff       	jmp    801092ca <alltraps>
+
+80109f0b <vector175>:
+.globl vector175
+vector175:
+  pushl $0
+80109f0b:	6a 00                	push   $0x0
+  pushl $175
+80109f0d:	68 af 00 00 00       	push   $0xaf
+  jmp alltraps
+80109f12:	e9 b3 f3 ff ff       	jmp    801092ca <alltraps>
+
+80109f17 <vector176>:
+.globl vector176
+vector176:
+  pushl $0
+80109f17:	6a 00                	push   $0x0
+  pushl $176
+80109f19:	68 b0 00 00 00       	push   $0xb0
+  jmp alltraps
+80109f1e:	e9 a7 f3 ff ff       	jmp    801092ca <alltraps>
+
+80109f23 <vector177>:
+.globl vector177
+vector177:
+  pushl $0
+80109f23:	6a 00                	push   $0x0
+  pushl $177
+80109f25:	68 b1 00 00 00       	push   $0xb1
+  jmp alltraps
+80109f2a:	e9 9b f3 ff ff       	jmp    801092ca <alltraps>
+
+80109f2f <vector178>:
+.globl vector178
+vector178:
+  pushl $0
+80109f2f:	6a 00                	push   $0x0
+  pushl $178
+80109f31:	68 b2 00 00 00       	push   $0xb2
+  jmp alltraps
+80109f36:	e9 8f f3 ff ff       	jmp    801092ca <alltraps>
+
+80109f3b <vector179>:
+.globl vector179
+vector179:
+  pushl $0
+80109f3b:	6a 00                	push   $0x0
+  pushl $179
+80109f3d:	68 b3 00 00 00       	push   $0xb3
+  jmp alltraps
+80109f42:	e9 83 f3 ff ff       	jmp    801092ca <alltraps>
+
+80109f47 <vector180>:
+.globl vector180
+vector180:
+  pushl $0
+80109f47:	6a 00                	push   $0x0
+  pushl $180
+80109f49:	68 b4 00 00 00       	push   $0xb4
+  jmp alltraps
+80109f4e:	e9 77 f3 ff ff       	jmp    801092ca <alltraps>
+
+80109f53 <vector181>:
+.globl vector181
+vector181:
+  pushl $0
+80109f53:	6a 00                	push   $0x0
+  pushl $181
+80109f55:	68 b5 00 00 00       	push   $0xb5
+  jmp alltraps
+80109f5a:	e9 6b f3 ff ff       	jmp    801092ca <alltraps>
+
+80109f5f <vector182>:
+.globl vector182
+vector182:
+  pushl $0
+80109f5f:	6a 00                	push   $0x0
+  pushl $182
+80109f61:	68 b6 00 00 00       	push   $0xb6
+  jmp alltraps
+80109f66:	e9 5f f3 ff ff       	jmp    801092ca <alltraps>
+
+80109f6b <vector183>:
+.globl vector183
+vector183:
+  pushl $0
+80109f6b:	6a 00                	push   $0x0
+  pushl $183
+80109f6d:	68 b7 00 00 00       	push   $0xb7
+  jmp alltraps
+80109f72:	e9 53 f3 ff ff       	jmp    801092ca <alltraps>
+
+80109f77 <vector184>:
+.globl vector184
+vector184:
+  pushl $0
+80109f77:	6a 00                	push   $0x0
+  pushl $184
+80109f79:	68 b8 00 00 00       	push   $0xb8
+  jmp alltraps
+80109f7e:	e9 47 f3 ff ff       	jmp    801092ca <alltraps>
+
+80109f83 <vector185>:
+.globl vector185
+vector185:
+  pushl $0
+80109f83:	6a 00                	push   $0x0
+  pushl $185
+80109f85:	68 b9 00 00 00       	push   $0xb9
+  jmp alltraps
+80109f8a:	e9 3b f3 ff ff       	jmp    801092ca <alltraps>
+
+80109f8f <vector186>:
+.globl vector186
+vector186:
+  pushl $0
+80109f8f:	6a 00                	push   $0x0
+  pushl $186
+80109f91:	68 ba 00 00 00       	push   $0xba
+  jmp alltraps
+80109f96:	e9 2f f3 ff ff       	jmp    801092ca <alltraps>
+
+80109f9b <vector187>:
+.globl vector187
+vector187:
+  pushl $0
+80109f9b:	6a 00                	push   $0x0
+  pushl $187
+80109f9d:	68 bb 00 00 00       	push   $0xbb
+  jmp alltraps
+80109fa2:	e9 23 f3 ff ff       	jmp    801092ca <alltraps>
+
+80109fa7 <vector188>:
+.globl vector188
+vector188:
+  pushl $0
+80109fa7:	6a 00                	push   $0x0
+  pushl $188
+80109fa9:	68 bc 00 00 00       	push   $0xbc
+  jmp alltraps
+80109fae:	e9 17 f3 ff ff       	jmp    801092ca <alltraps>
+
+80109fb3 <vector189>:
+.globl vector189
+vector189:
+  pushl $0
+80109fb3:	6a 00                	push   $0x0
+  pushl $189
+80109fb5:	68 bd 00 00 00       	push   $0xbd
+  jmp alltraps
+80109fba:	e9 0b f3 ff ff       	jmp    801092ca <alltraps>
+
+80109fbf <vector190>:
+.globl vector190
+vector190:
+  pushl $0
+80109fbf:	6a 00                	push   $0x0
+  pushl $190
+80109fc1:	68 be 00 00 00       	push   $0xbe
+  jmp alltraps
+80109fc6:	e9 ff f2 ff ff       	jmp    801092ca <alltraps>
+
+80109fcb <vector191>:
+.globl vector191
+vector191:
+  pushl $0
+80109fcb:	6a 00                	push   $0x0
+  pushl $191
+80109fcd:	68 bf 00 00 00       	push   $0xbf
+  jmp alltraps
+80109fd2:	e9 f3 f2 ff ff       	jmp    801092ca <alltraps>
+
+80109fd7 <vector192>:
+.globl vector192
+vector192:
+  pushl $0
+80109fd7:	6a 00                	push   $0x0
+  pushl $192
+80109fd9:	68 c0 00 00 00       	push   $0xc0
+  jmp alltraps
+80109fde:	e9 e7 f2 ff ff       	jmp    801092ca <alltraps>
+
+80109fe3 <vector193>:
+.globl vector193
+vector193:
+  pushl $0
+80109fe3:	6a 00                	push   $0x0
+  pushl $193
+80109fe5:	68 c1 00 00 00       	push   $0xc1
+  jmp alltraps
+80109fea:	e9 db f2 ff ff       	jmp    801092ca <alltraps>
+
+80109fef <vector194>:
+.globl vector194
+vector194:
+  pushl $0
+80109fef:	6a 00                	push   $0x0
+  pushl $194
+80109ff1:	68 c2 00 00 00       	push   $0xc2
+  jmp alltraps
+80109ff6:	e9 cf f2 ff ff       	jmp    801092ca <alltraps>
+
+80109ffb <vector195>:
+.globl vector195
+vector195:
+  pushl $0
+80109ffb:	6a 00                	push   $0x0
+  pushl $195
+80109ffd:	68 c3 00 00 00       	push   $0xc3
+  jmp alltraps
+8010a002:	e9 c3 f2 ff ff       	jmp    801092ca <alltraps>
+
+8010a007 <vector196>:
+.globl vector196
+vector196:
+  pushl $0
+8010a007:	6a 00                	push   $0x0
+  pushl $196
+8010a009:	68 c4 00 00 00       	push   $0xc4
+  jmp alltraps
+8010a00e:	e9 b7 f2 ff ff       	jmp    801092ca <alltraps>
+
+8010a013 <vector197>:
+.globl vector197
+vector197:
+  pushl $0
+8010a013:	6a 00                	push   $0x0
+  pushl $197
+8010a015:	68 c5 00 00 00       	push   $0xc5
+  jmp alltraps
+8010a01a:	e9 ab f2 ff ff       	jmp    801092ca <alltraps>
+
+8010a01f <vector198>:
+.globl vector198
+vector198:
+  pushl $0
+8010a01f:	6a 00                	push   $0x0
+  pushl $198
+8010a021:	68 c6 00 00 00       	push   $0xc6
+  jmp alltraps
+8010a026:	e9 9f f2 ff ff       	jmp    801092ca <alltraps>
+
+8010a02b <vector199>:
+.globl vector199
+vector199:
+  pushl $0
+8010a02b:	6a 00                	push   $0x0
+  pushl $199
+8010a02d:	68 c7 00 00 00       	push   $0xc7
+  jmp alltraps
+8010a032:	e9 93 f2 ff ff       	jmp    801092ca <alltraps>
+
+8010a037 <vector200>:
+.globl vector200
+vector200:
+  pushl $0
+8010a037:	6a 00                	push   $0x0
+  pushl $200
+8010a039:	68 c8 00 00 00       	push   $0xc8
+  jmp alltraps
+8010a03e:	e9 87 f2 ff ff       	jmp    801092ca <alltraps>
+
+8010a043 <vector201>:
+.globl vector201
+vector201:
+  pushl $0
+8010a043:	6a 00                	push   $0x0
+  pushl $201
+8010a045:	68 c9 00 00 00       	push   $0xc9
+  jmp alltraps
+8010a04a:	e9 7b f2 ff ff       	jmp    801092ca <alltraps>
+
+8010a04f <vector202>:
+.globl vector202
+vector202:
+  pushl $0
+8010a04f:	6a 00                	push   $0x0
+  pushl $202
+8010a051:	68 ca 00 00 00       	push   $0xca
+  jmp alltraps
+8010a056:	e9 6f f2 ff ff       	jmp    801092ca <alltraps>
+
+8010a05b <vector203>:
+.globl vector203
+vector203:
+  pushl $0
+8010a05b:	6a 00                	push   $0x0
+  pushl $203
+8010a05d:	68 cb 00 00 00       	push   $0xcb
+  jmp alltraps
+8010a062:	e9 63 f2 ff ff       	jmp    801092ca <alltraps>
+
+8010a067 <vector204>:
+.globl vector204
+vector204:
+  pushl $0
+8010a067:	6a 00                	push   $0x0
+  pushl $204
+8010a069:	68 cc 00 00 00       	push   $0xcc
+  jmp alltraps
+8010a06e:	e9 57 f2 ff ff       	jmp    801092ca <alltraps>
+
+8010a073 <vector205>:
+.globl vector205
+vector205:
+  pushl $0
+8010a073:	6a 00                	push   $0x0
+  pushl $205
+8010a075:	68 cd 00 00 00       	push   $0xcd
+  jmp alltraps
+8010a07a:	e9 4b f2 ff ff       	jmp    801092ca <alltraps>
+
+8010a07f <vector206>:
+.globl vector206
+vector206:
+  pushl $0
+8010a07f:	6a 00                	push   $0x0
+  pushl $206
+8010a081:	68 ce 00 00 00       	push   $0xce
+  jmp alltraps
+8010a086:	e9 3f f2 ff ff       	jmp    801092ca <alltraps>
+
+8010a08b <vector207>:
+.globl vector207
+vector207:
+  pushl $0
+8010a08b:	6a 00                	push   $0x0
+  pushl $207
+8010a08d:	68 cf 00 00 00       	push   $0xcf
+  jmp alltraps
+8010a092:	e9 33 f2 ff ff       	jmp    801092ca <alltraps>
+
+8010a097 <vector208>:
+.globl vector208
+vector208:
+  pushl $0
+8010a097:	6a 00                	push   $0x0
+  pushl $208
+8010a099:	68 d0 00 00 00       	push   $0xd0
+  jmp alltraps
+8010a09e:	e9 27 f2 ff ff       	jmp    801092ca <alltraps>
+
+8010a0a3 <vector209>:
+.globl vector209
+vector209:
+  pushl $0
+8010a0a3:	6a 00                	push   $0x0
+  pushl $209
+8010a0a5:	68 d1 00 00 00       	push   $0xd1
+  jmp alltraps
+8010a0aa:	e9 1b f2 ff ff       	jmp    801092ca <alltraps>
+
+8010a0af <vector210>:
+.globl vector210
+vector210:
+  pushl $0
+8010a0af:	6a 00                	push   $0x0
+  pushl $210
+8010a0b1:	68 d2 00 00 00       	push   $0xd2
+  jmp alltraps
+8010a0b6:	e9 0f f2 ff ff       	jmp    801092ca <alltraps>
+
+8010a0bb <vector211>:
+.globl vector211
+vector211:
+  pushl $0
+8010a0bb:	6a 00                	push   $0x0
+  pushl $211
+8010a0bd:	68 d3 00 00 00       	push   $0xd3
+  jmp alltraps
+8010a0c2:	e9 03 f2 ff ff       	jmp    801092ca <alltraps>
+
+8010a0c7 <vector212>:
+.globl vector212
+vector212:
+  pushl $0
+8010a0c7:	6a 00                	push   $0x0
+  pushl $212
+8010a0c9:	68 d4 00 00 00       	push   $0xd4
+  jmp alltraps
+8010a0ce:	e9 f7 f1 ff ff       	jmp    801092ca <alltraps>
+
+8010a0d3 <vector213>:
+.globl vector213
+vector213:
+  pushl $0
+8010a0d3:	6a 00                	push   $0x0
+  pushl $213
+8010a0d5:	68 d5 00 00 00       	push   $0xd5
+  jmp alltraps
+8010a0da:	e9 eb f1 ff ff       	jmp    801092ca <alltraps>
+
+8010a0df <vector214>:
+.globl vector214
+vector214:
+  pushl $0
+8010a0df:	6a 00                	push   $0x0
+  pushl $214
+8010a0e1:	68 d6 00 00 00       	push   $0xd6
+  jmp alltraps
+8010a0e6:	e9 df f1 ff ff       	jmp    801092ca <alltraps>
+
+8010a0eb <vector215>:
+.globl vector215
+vector215:
+  pushl $0
+8010a0eb:	6a 00                	push   $0x0
+  pushl $215
+8010a0ed:	68 d7 00 00 00       	push   $0xd7
+  jmp alltraps
+8010a0f2:	e9 d3 f1 ff ff       	jmp    801092ca <alltraps>
+
+8010a0f7 <vector216>:
+.globl vector216
+vector216:
+  pushl $0
+8010a0f7:	6a 00                	push   $0x0
+  pushl $216
+8010a0f9:	68 d8 00 00 00       	push   $0xd8
+  jmp alltraps
+8010a0fe:	e9 c7 f1 ff ff       	jmp    801092ca <alltraps>
+
+8010a103 <vector217>:
+.globl vector217
+vector217:
+  pushl $0
+8010a103:	6a 00                	push   $0x0
+  pushl $217
+8010a105:	68 d9 00 00 00       	push   $0xd9
+  jmp alltraps
+8010a10a:	e9 bb f1 ff ff       	jmp    801092ca <alltraps>
+
+8010a10f <vector218>:
+.globl vector218
+vector218:
+  pushl $0
+8010a10f:	6a 00                	push   $0x0
+  pushl $218
+8010a111:	68 da 00 00 00       	push   $0xda
+  jmp alltraps
+8010a116:	e9 af f1 ff ff       	jmp    801092ca <alltraps>
+
+8010a11b <vector219>:
+.globl vector219
+vector219:
+  pushl $0
+8010a11b:	6a 00                	push   $0x0
+  pushl $219
+8010a11d:	68 db 00 00 00       	push   $0xdb
+  jmp alltraps
+8010a122:	e9 a3 f1 ff ff       	jmp    801092ca <alltraps>
+
+8010a127 <vector220>:
+.globl vector220
+vector220:
+  pushl $0
+8010a127:	6a 00                	push   $0x0
+  pushl $220
+8010a129:	68 dc 00 00 00       	push   $0xdc
+  jmp alltraps
+8010a12e:	e9 97 f1 ff ff       	jmp    801092ca <alltraps>
+
+8010a133 <vector221>:
+.globl vector221
+vector221:
+  pushl $0
+8010a133:	6a 00                	push   $0x0
+  pushl $221
+8010a135:	68 dd 00 00 00       	push   $0xdd
+  jmp alltraps
+8010a13a:	e9 8b f1 ff ff       	jmp    801092ca <alltraps>
+
+8010a13f <vector222>:
+.globl vector222
+vector222:
+  pushl $0
+8010a13f:	6a 00                	push   $0x0
+  pushl $222
+8010a141:	68 de 00 00 00       	push   $0xde
+  jmp alltraps
+8010a146:	e9 7f f1 ff ff       	jmp    801092ca <alltraps>
+
+8010a14b <vector223>:
+.globl vector223
+vector223:
+  pushl $0
+8010a14b:	6a 00                	push   $0x0
+  pushl $223
+8010a14d:	68 df 00 00 00       	push   $0xdf
+  jmp alltraps
+8010a152:	e9 73 f1 ff ff       	jmp    801092ca <alltraps>
+
+8010a157 <vector224>:
+.globl vector224
+vector224:
+  pushl $0
+8010a157:	6a 00                	push   $0x0
+  pushl $224
+8010a159:	68 e0 00 00 00       	push   $0xe0
+  jmp alltraps
+8010a15e:	e9 67 f1 ff ff       	jmp    801092ca <alltraps>
+
+8010a163 <vector225>:
+.globl vector225
+vector225:
+  pushl $0
+8010a163:	6a 00                	push   $0x0
+  pushl $225
+8010a165:	68 e1 00 00 00       	push   $0xe1
+  jmp alltraps
+8010a16a:	e9 5b f1 ff ff       	jmp    801092ca <alltraps>
+
+8010a16f <vector226>:
+.globl vector226
+vector226:
+  pushl $0
+8010a16f:	6a 00                	push   $0x0
+  pushl $226
+8010a171:	68 e2 00 00 00       	push   $0xe2
+  jmp alltraps
+8010a176:	e9 4f f1 ff ff       	jmp    801092ca <alltraps>
+
+8010a17b <vector227>:
+.globl vector227
+vector227:
+  pushl $0
+8010a17b:	6a 00                	push   $0x0
+  pushl $227
+8010a17d:	68 e3 00 00 00       	push   $0xe3
+  jmp alltraps
+8010a182:	e9 43 f1 ff ff       	jmp    801092ca <alltraps>
+
+8010a187 <vector228>:
+.globl vector228
+vector228:
+  pushl $0
+8010a187:	6a 00                	push   $0x0
+  pushl $228
+8010a189:	68 e4 00 00 00       	push   $0xe4
+  jmp alltraps
+8010a18e:	e9 37 f1 ff ff       	jmp    801092ca <alltraps>
+
+8010a193 <vector229>:
+.globl vector229
+vector229:
+  pushl $0
+8010a193:	6a 00                	push   $0x0
+  pushl $229
+8010a195:	68 e5 00 00 00       	push   $0xe5
+  jmp alltraps
+8010a19a:	e9 2b f1 ff ff       	jmp    801092ca <alltraps>
+
+8010a19f <vector230>:
+.globl vector230
+vector230:
+  pushl $0
+8010a19f:	6a 00                	push   $0x0
+  pushl $230
+8010a1a1:	68 e6 00 00 00       	push   $0xe6
+  jmp alltraps
+8010a1a6:	e9 1f f1 ff ff       	jmp    801092ca <alltraps>
+
+8010a1ab <vector231>:
+.globl vector231
+vector231:
+  pushl $0
+8010a1ab:	6a 00                	push   $0x0
+  pushl $231
+8010a1ad:	68 e7 00 00 00       	push   $0xe7
+  jmp alltraps
+8010a1b2:	e9 13 f1 ff ff       	jmp    801092ca <alltraps>
+
+8010a1b7 <vector232>:
+.globl vector232
+vector232:
+  pushl $0
+8010a1b7:	6a 00                	push   $0x0
+  pushl $232
+8010a1b9:	68 e8 00 00 00       	push   $0xe8
+  jmp alltraps
+8010a1be:	e9 07 f1 ff ff       	jmp    801092ca <alltraps>
+
+8010a1c3 <vector233>:
+.globl vector233
+vector233:
+  pushl $0
+8010a1c3:	6a 00                	push   $0x0
+  pushl $233
+8010a1c5:	68 e9 00 00 00       	push   $0xe9
+  jmp alltraps
+8010a1ca:	e9 fb f0 ff ff       	jmp    801092ca <alltraps>
+
+8010a1cf <vector234>:
+.globl vector234
+vector234:
+  pushl $0
+8010a1cf:	6a 00                	push   $0x0
+  pushl $234
+8010a1d1:	68 ea 00 00 00       	push   $0xea
+  jmp alltraps
+8010a1d6:	e9 ef f0 ff ff       	jmp    801092ca <alltraps>
+
+8010a1db <vector235>:
+.globl vector235
+vector235:
+  pushl $0
+8010a1db:	6a 00                	push   $0x0
+  pushl $235
+8010a1dd:	68 eb 00 00 00       	push   $0xeb
+  jmp alltraps
+8010a1e2:	e9 e3 f0 ff ff       	jmp    801092ca <alltraps>
+
+8010a1e7 <vector236>:
+.globl vector236
+vector236:
+  pushl $0
+8010a1e7:	6a 00                	push   $0x0
+  pushl $236
+8010a1e9:	68 ec 00 00 00       	push   $0xec
+  jmp alltraps
+8010a1ee:	e9 d7 f0 ff ff       	jmp    801092ca <alltraps>
+
+8010a1f3 <vector237>:
+.globl vector237
+vector237:
+  pushl $0
+8010a1f3:	6a 00                	push   $0x0
+  pushl $237
+8010a1f5:	68 ed 00 00 00       	push   $0xed
+  jmp alltraps
+8010a1fa:	e9 cb f0 ff ff       	jmp    801092ca <alltraps>
+
+8010a1ff <vector238>:
+.globl vector238
+vector238:
+  pushl $0
+8010a1ff:	6a 00                	push   $0x0
+  pushl $238
+8010a201:	68 ee 00 00 00       	push   $0xee
+  jmp alltraps
+8010a206:	e9 bf f0 ff ff       	jmp    801092ca <alltraps>
+
+8010a20b <vector239>:
+.globl vector239
+vector239:
+  pushl $0
+8010a20b:	6a 00                	push   $0x0
+  pushl $239
+8010a20d:	68 ef 00 00 00       	push   $0xef
+  jmp alltraps
+8010a212:	e9 b3 f0 ff ff       	jmp    801092ca <alltraps>
+
+8010a217 <vector240>:
+.globl vector240
+vector240:
+  pushl $0
+8010a217:	6a 00                	push   $0x0
+  pushl $240
+8010a219:	68 f0 00 00 00       	push   $0xf0
+  jmp alltraps
+8010a21e:	e9 a7 f0 ff ff       	jmp    801092ca <alltraps>
+
+8010a223 <vector241>:
+.globl vector241
+vector241:
+  pushl $0
+8010a223:	6a 00                	push   $0x0
+  pushl $241
+8010a225:	68 f1 00 00 00       	push   $0xf1
+  jmp alltraps
+8010a22a:	e9 9b f0 ff ff       	jmp    801092ca <alltraps>
+
+8010a22f <vector242>:
+.globl vector242
+vector242:
+  pushl $0
+8010a22f:	6a 00                	push   $0x0
+  pushl $242
+8010a231:	68 f2 00 00 00       	push   $0xf2
+  jmp alltraps
+8010a236:	e9 8f f0 ff ff       	jmp    801092ca <alltraps>
+
+8010a23b <vector243>:
+.globl vector243
+vector243:
+  pushl $0
+8010a23b:	6a 00                	push   $0x0
+  pushl $243
+8010a23d:	68 f3 00 00 00       	push   $0xf3
+  jmp alltraps
+8010a242:	e9 83 f0 ff ff       	jmp    801092ca <alltraps>
+
+8010a247 <vector244>:
+.globl vector244
+vector244:
+  pushl $0
+8010a247:	6a 00                	push   $0x0
+  pushl $244
+8010a249:	68 f4 00 00 00       	push   $0xf4
+  jmp alltraps
+8010a24e:	e9 77 f0 ff ff       	jmp    801092ca <alltraps>
+
+8010a253 <vector245>:
+.globl vector245
+vector245:
+  pushl $0
+8010a253:	6a 00                	push   $0x0
+  pushl $245
+8010a255:	68 f5 00 00 00       	push   $0xf5
+  jmp alltraps
+8010a25a:	e9 6b f0 ff ff       	jmp    801092ca <alltraps>
+
+8010a25f <vector246>:
+.globl vector246
+vector246:
+  pushl $0
+8010a25f:	6a 00                	push   $0x0
+  pushl $246
+8010a261:	68 f6 00 00 00       	push   $0xf6
+  jmp alltraps
+8010a266:	e9 5f f0 ff ff       	jmp    801092ca <alltraps>
+
+8010a26b <vector247>:
+.globl vector247
+vector247:
+  pushl $0
+8010a26b:	6a 00                	push   $0x0
+  pushl $247
+8010a26d:	68 f7 00 00 00       	push   $0xf7
+  jmp alltraps
+8010a272:	e9 53 f0 ff ff       	jmp    801092ca <alltraps>
+
+8010a277 <vector248>:
+.globl vector248
+vector248:
+  pushl $0
+8010a277:	6a 00                	push   $0x0
+  pushl $248
+8010a279:	68 f8 00 00 00       	push   $0xf8
+  jmp alltraps
+8010a27e:	e9 47 f0 ff ff       	jmp    801092ca <alltraps>
+
+8010a283 <vector249>:
+.globl vector249
+vector249:
+  pushl $0
+8010a283:	6a 00                	push   $0x0
+  pushl $249
+8010a285:	68 f9 00 00 00       	push   $0xf9
+  jmp alltraps
+8010a28a:	e9 3b f0 ff ff       	jmp    801092ca <alltraps>
+
+8010a28f <vector250>:
+.globl vector250
+vector250:
+  pushl $0
+8010a28f:	6a 00                	push   $0x0
+  pushl $250
+8010a291:	68 fa 00 00 00       	push   $0xfa
+  jmp alltraps
+8010a296:	e9 2f f0 ff ff       	jmp    801092ca <alltraps>
+
+8010a29b <vector251>:
+.globl vector251
+vector251:
+  pushl $0
+8010a29b:	6a 00                	push   $0x0
+  pushl $251
+8010a29d:	68 fb 00 00 00       	push   $0xfb
+  jmp alltraps
+8010a2a2:	e9 23 f0 ff ff       	jmp    801092ca <alltraps>
+
+8010a2a7 <vector252>:
+.globl vector252
+vector252:
+  pushl $0
+8010a2a7:	6a 00                	push   $0x0
+  pushl $252
+8010a2a9:	68 fc 00 00 00       	push   $0xfc
+  jmp alltraps
+8010a2ae:	e9 17 f0 ff ff       	jmp    801092ca <alltraps>
+
+8010a2b3 <vector253>:
+.globl vector253
+vector253:
+  pushl $0
+8010a2b3:	6a 00                	push   $0x0
+  pushl $253
+8010a2b5:	68 fd 00 00 00       	push   $0xfd
+  jmp alltraps
+8010a2ba:	e9 0b f0 ff ff       	jmp    801092ca <alltraps>
+
+8010a2bf <vector254>:
+.globl vector254
+vector254:
+  pushl $0
+8010a2bf:	6a 00                	push   $0x0
+  pushl $254
+8010a2c1:	68 fe 00 00 00       	push   $0xfe
+  jmp alltraps
+8010a2c6:	e9 ff ef ff ff       	jmp    801092ca <alltraps>
+
+8010a2cb <vector255>:
+.globl vector255
+vector255:
+  pushl $0
+8010a2cb:	6a 00                	push   $0x0
+  pushl $255
+8010a2cd:	68 ff 00 00 00       	push   $0xff
+  jmp alltraps
+8010a2d2:	e9 f3 ef ff ff       	jmp    801092ca <alltraps>
+8010a2d7:	66 90                	xchg   %ax,%ax
+8010a2d9:	66 90                	xchg   %ax,%ax
+8010a2db:	66 90                	xchg   %ax,%ax
+8010a2dd:	66 90                	xchg   %ax,%ax
+8010a2df:	90                   	nop
+
+8010a2e0 <virtioinit>:
+
+int virtioirq = -1;  // IRQ of the device, or -1 if there is none
+
+void
+virtioinit(void)
+{
+8010a2e0:	55                   	push   %ebp
+8010a2e1:	89 e5                	mov    %esp,%ebp
+8010a2e3:	57                   	push   %edi
+8010a2e4:	56                   	push   %esi
+8010a2e5:	53                   	push   %ebx
+8010a2e6:	83 ec 24             	sub    $0x24,%esp
+  struct pcidev *d;
+  ushort base;
+  int i, n;
+
+  if((d = pcifindid(0x1af4, 0x1001)) == 0 || !(d->bar[0] & PCI_BAR_IO))
+8010a2e9:	68 01 10 00 00       	push   $0x1001
+8010a2ee:	68 f4 1a 00 00       	push   $0x1af4
+8010a2f3:	e8 b8 aa ff ff       	call   80104db0 <pcifindid>
+8010a2f8:	83 c4 10             	add    $0x10,%esp
+8010a2fb:	85 c0                	test   %eax,%eax
+8010a2fd:	74 08                	je     8010a307 <virtioinit+0x27>
+8010a2ff:	89 c3                	mov    %eax,%ebx
+8010a301:	f6 40 0c 01          	testb  $0x1,0xc(%eax)
+8010a305:	75 09                	jne    8010a310 <virtioinit+0x30>
+
+  outb(base+VIRTIO_STATUS, VIRTIO_ACK|VIRTIO_DRIVER|VIRTIO_DRIVER_OK);
+  vblk.iobase = base;
+  virtioirq = d->irq;
+  ioapicenable(virtioirq, ncpu - 1);
+}
+8010a307:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a30a:	5b                   	pop    %ebx
+8010a30b:	5e                   	pop    %esi
+8010a30c:	5f                   	pop    %edi
+8010a30d:	5d                   	pop    %ebp
+8010a30e:	c3                   	ret
+8010a30f:	90                   	nop
+  initlock(&vblk.lock, "virtio");
+8010a310:	83 ec 08             	sub    $0x8,%esp
+8010a313:	68 ec be 10 80       	push   $0x8010beec
+8010a318:	68 00 20 1c 80       	push   $0x801c2000
+8010a31d:	e8 3e c6 ff ff       	call   80106960 <initlock>
+  base = d->bar[0] & PCI_BAR_IOMASK;
+8010a322:	0f b7 73 0c          	movzwl 0xc(%ebx),%esi
+  pcibusmaster(d);
+8010a326:	89 1c 24             	mov    %ebx,(%esp)
+  base = d->bar[0] & PCI_BAR_IOMASK;
+8010a329:	83 e6 fc             	and    $0xfffffffc,%esi
+  pcibusmaster(d);
+8010a32c:	e8 df aa ff ff       	call   80104e10 <pcibusmaster>
+  outb(base+VIRTIO_STATUS, 0);  // reset
+8010a331:	8d 7e 12             	lea    0x12(%esi),%edi
+8010a334:	31 c0                	xor    %eax,%eax
+8010a336:	89 fa                	mov    %edi,%edx
+8010a338:	ee                   	out    %al,(%dx)
+8010a339:	b8 01 00 00 00       	mov    $0x1,%eax
+8010a33e:	ee                   	out    %al,(%dx)
+8010a33f:	b8 03 00 00 00       	mov    $0x3,%eax
+8010a344:	ee                   	out    %al,(%dx)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010a345:	31 c0                	xor    %eax,%eax
+  outl(base+VIRTIO_GUESTFEAT, 0);  // no optional features
+8010a347:	8d 56 04             	lea    0x4(%esi),%edx
+8010a34a:	ef                   	out    %eax,(%dx)
+  outw(base+VIRTIO_QSEL, 0);
+8010a34b:	8d 56 0e             	lea    0xe(%esi),%edx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010a34e:	66 ef                	out    %ax,(%dx)
+  n = inw(base+VIRTIO_QSIZE);
+8010a350:	8d 56 0c             	lea    0xc(%esi),%edx
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010a353:	66 ed                	in     (%dx),%ax
+  if(n < 3 || n > NVDESC){
+8010a355:	0f b7 c8             	movzwl %ax,%ecx
+8010a358:	83 c4 10             	add    $0x10,%esp
+8010a35b:	8d 41 fd             	lea    -0x3(%ecx),%eax
+8010a35e:	3d fd 00 00 00       	cmp    $0xfd,%eax
+8010a363:	76 13                	jbe    8010a378 <virtioinit+0x98>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010a365:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+8010a36a:	89 fa                	mov    %edi,%edx
+8010a36c:	ee                   	out    %al,(%dx)
+}
+8010a36d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a370:	5b                   	pop    %ebx
+8010a371:	5e                   	pop    %esi
+8010a372:	5f                   	pop    %edi
+8010a373:	5d                   	pop    %ebp
+8010a374:	c3                   	ret
+8010a375:	8d 76 00             	lea    0x0(%esi),%esi
+  memset(vqmem, 0, sizeof(vqmem));
+8010a378:	83 ec 04             	sub    $0x4,%esp
+8010a37b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+8010a37e:	68 00 30 00 00       	push   $0x3000
+8010a383:	6a 00                	push   $0x0
+8010a385:	68 00 f0 1b 80       	push   $0x801bf000
+8010a38a:	e8 31 d0 ff ff       	call   801073c0 <memset>
+  vblk.n = n;
+8010a38f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  vblk.used = (struct vqused*)(vqmem + PGROUNDUP(VQAVAILSZ(n)));
+8010a392:	83 c4 10             	add    $0x10,%esp
+  vblk.desc = (struct vqdesc*)vqmem;
+8010a395:	c7 05 68 20 1c 80 00 	movl   $0x801bf000,0x801c2068
+8010a39c:	f0 1b 80 
+  vblk.avail = (struct vqavail*)(vqmem + 16*n);
+8010a39f:	89 c8                	mov    %ecx,%eax
+  vblk.n = n;
+8010a3a1:	89 0d 64 20 1c 80    	mov    %ecx,0x801c2064
+  vblk.avail = (struct vqavail*)(vqmem + 16*n);
+8010a3a7:	c1 e0 04             	shl    $0x4,%eax
+8010a3aa:	8d 90 00 f0 1b 80    	lea    -0x7fe41000(%eax),%edx
+  vblk.used = (struct vqused*)(vqmem + PGROUNDUP(VQAVAILSZ(n)));
+8010a3b0:	8d 84 48 05 10 00 00 	lea    0x1005(%eax,%ecx,2),%eax
+8010a3b7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  vblk.avail = (struct vqavail*)(vqmem + 16*n);
+8010a3bc:	89 15 6c 20 1c 80    	mov    %edx,0x801c206c
+  for(i = 0; i < n; i++)
+8010a3c2:	31 d2                	xor    %edx,%edx
+  vblk.used = (struct vqused*)(vqmem + PGROUNDUP(VQAVAILSZ(n)));
+8010a3c4:	05 00 f0 1b 80       	add    $0x801bf000,%eax
+8010a3c9:	a3 70 20 1c 80       	mov    %eax,0x801c2070
+  for(i = 0; i < n; i++)
+8010a3ce:	66 90                	xchg   %ax,%ax
+    vblk.free[i] = 1;
+8010a3d0:	c6 82 76 20 1c 80 01 	movb   $0x1,-0x7fe3df8a(%edx)
+  for(i = 0; i < n; i++)
+8010a3d7:	83 c2 01             	add    $0x1,%edx
+8010a3da:	39 d1                	cmp    %edx,%ecx
+8010a3dc:	75 f2                	jne    8010a3d0 <virtioinit+0xf0>
+  outl(base+VIRTIO_QADDR, V2P(vqmem) / PGSIZE);
+8010a3de:	b8 00 f0 1b 00       	mov    $0x1bf000,%eax
+  vblk.nfree = n;
+8010a3e3:	89 0d 78 21 1c 80    	mov    %ecx,0x801c2178
+  outl(base+VIRTIO_QADDR, V2P(vqmem) / PGSIZE);
+8010a3e9:	8d 56 08             	lea    0x8(%esi),%edx
+8010a3ec:	c1 e8 0c             	shr    $0xc,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010a3ef:	ef                   	out    %eax,(%dx)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010a3f0:	b8 07 00 00 00       	mov    $0x7,%eax
+8010a3f5:	89 fa                	mov    %edi,%edx
+8010a3f7:	ee                   	out    %al,(%dx)
+  ioapicenable(virtioirq, ncpu - 1);
+8010a3f8:	a1 44 3b 1a 80       	mov    0x801a3b44,%eax
+  vblk.iobase = base;
+8010a3fd:	66 89 35 60 20 1c 80 	mov    %si,0x801c2060
+  ioapicenable(virtioirq, ncpu - 1);
+8010a404:	83 ec 08             	sub    $0x8,%esp
+  virtioirq = d->irq;
+8010a407:	0f b6 53 0b          	movzbl 0xb(%ebx),%edx
+  ioapicenable(virtioirq, ncpu - 1);
+8010a40b:	83 e8 01             	sub    $0x1,%eax
+  virtioirq = d->irq;
+8010a40e:	89 15 08 f4 10 80    	mov    %edx,0x8010f408
+  ioapicenable(virtioirq, ncpu - 1);
+8010a414:	50                   	push   %eax
+8010a415:	52                   	push   %edx
+8010a416:	e8 95 94 ff ff       	call   801038b0 <ioapicenable>
+8010a41b:	83 c4 10             	add    $0x10,%esp
+}
+8010a41e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a421:	5b                   	pop    %ebx
+8010a422:	5e                   	pop    %esi
+8010a423:	5f                   	pop    %edi
+8010a424:	5d                   	pop    %ebp
+8010a425:	c3                   	ret
+8010a426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a42d:	8d 76 00             	lea    0x0(%esi),%esi
+
+8010a430 <virtioready>:
+
+// Is there a virtio disk to use?
+int
+virtioready(void)
+{
+  return vblk.iobase != 0;
+8010a430:	31 c0                	xor    %eax,%eax
+8010a432:	66 83 3d 60 20 1c 80 	cmpw   $0x0,0x801c2060
+8010a439:	00 
+8010a43a:	0f 95 c0             	setne  %al
+}
+8010a43d:	c3                   	ret
+8010a43e:	66 90                	xchg   %ax,%ax
+
+8010a440 <virtiorw>:
+}
+
+// Start syncing buf with disk, like iderw().
+void
+virtiorw(struct buf *b)
+{
+8010a440:	55                   	push   %ebp
+8010a441:	89 e5                	mov    %esp,%ebp
+8010a443:	57                   	push   %edi
+8010a444:	56                   	push   %esi
+8010a445:	53                   	push   %ebx
+8010a446:	83 ec 28             	sub    $0x28,%esp
+8010a449:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct vreq *r;
+  int d0, d1, d2;
+
+  if(!holdingsleep(&b->lock))
+8010a44c:	8d 43 0c             	lea    0xc(%ebx),%eax
+8010a44f:	50                   	push   %eax
+8010a450:	e8 5b c4 ff ff       	call   801068b0 <holdingsleep>
+8010a455:	83 c4 10             	add    $0x10,%esp
+8010a458:	85 c0                	test   %eax,%eax
+8010a45a:	0f 84 83 02 00 00    	je     8010a6e3 <virtiorw+0x2a3>
+    panic("virtiorw: buf not locked");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+8010a460:	8b 03                	mov    (%ebx),%eax
+8010a462:	83 e0 06             	and    $0x6,%eax
+8010a465:	83 f8 02             	cmp    $0x2,%eax
+8010a468:	0f 84 68 02 00 00    	je     8010a6d6 <virtiorw+0x296>
+    panic("virtiorw: nothing to do");
+
+  acquire(&vblk.lock);
+8010a46e:	83 ec 0c             	sub    $0xc,%esp
+8010a471:	68 00 20 1c 80       	push   $0x801c2000
+8010a476:	e8 f5 cb ff ff       	call   80107070 <acquire>
+  while(vblk.nfree < 3)
+8010a47b:	8b 3d 78 21 1c 80    	mov    0x801c2178,%edi
+8010a481:	83 c4 10             	add    $0x10,%esp
+8010a484:	83 ff 02             	cmp    $0x2,%edi
+8010a487:	7f 27                	jg     8010a4b0 <virtiorw+0x70>
+8010a489:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    sleep(&vblk.free, &vblk.lock);
+8010a490:	83 ec 08             	sub    $0x8,%esp
+8010a493:	68 00 20 1c 80       	push   $0x801c2000
+8010a498:	68 76 20 1c 80       	push   $0x801c2076
+8010a49d:	e8 9e bb ff ff       	call   80106040 <sleep>
+  while(vblk.nfree < 3)
+8010a4a2:	8b 3d 78 21 1c 80    	mov    0x801c2178,%edi
+8010a4a8:	83 c4 10             	add    $0x10,%esp
+8010a4ab:	83 ff 02             	cmp    $0x2,%edi
+8010a4ae:	7e e0                	jle    8010a490 <virtiorw+0x50>
+  for(i = 0; i < vblk.n; i++){
+8010a4b0:	8b 35 64 20 1c 80    	mov    0x801c2064,%esi
+8010a4b6:	85 f6                	test   %esi,%esi
+8010a4b8:	0f 8e 0b 02 00 00    	jle    8010a6c9 <virtiorw+0x289>
+8010a4be:	31 c9                	xor    %ecx,%ecx
+8010a4c0:	eb 11                	jmp    8010a4d3 <virtiorw+0x93>
+8010a4c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+8010a4c8:	83 c1 01             	add    $0x1,%ecx
+8010a4cb:	39 ce                	cmp    %ecx,%esi
+8010a4cd:	0f 84 f6 01 00 00    	je     8010a6c9 <virtiorw+0x289>
+    if(vblk.free[i]){
+8010a4d3:	80 b9 76 20 1c 80 00 	cmpb   $0x0,-0x7fe3df8a(%ecx)
+8010a4da:	74 ec                	je     8010a4c8 <virtiorw+0x88>
+      vblk.nfree--;
+8010a4dc:	8d 47 ff             	lea    -0x1(%edi),%eax
+      vblk.free[i] = 0;
+8010a4df:	c6 81 76 20 1c 80 00 	movb   $0x0,-0x7fe3df8a(%ecx)
+      vblk.nfree--;
+8010a4e6:	a3 78 21 1c 80       	mov    %eax,0x801c2178
+  for(i = 0; i < vblk.n; i++){
+8010a4eb:	31 c0                	xor    %eax,%eax
+8010a4ed:	eb 0c                	jmp    8010a4fb <virtiorw+0xbb>
+8010a4ef:	90                   	nop
+8010a4f0:	83 c0 01             	add    $0x1,%eax
+8010a4f3:	39 c6                	cmp    %eax,%esi
+8010a4f5:	0f 84 ce 01 00 00    	je     8010a6c9 <virtiorw+0x289>
+    if(vblk.free[i]){
+8010a4fb:	80 b8 76 20 1c 80 00 	cmpb   $0x0,-0x7fe3df8a(%eax)
+8010a502:	74 ec                	je     8010a4f0 <virtiorw+0xb0>
+      vblk.nfree--;
+8010a504:	8d 57 fe             	lea    -0x2(%edi),%edx
+      vblk.free[i] = 0;
+8010a507:	c6 80 76 20 1c 80 00 	movb   $0x0,-0x7fe3df8a(%eax)
+      vblk.nfree--;
+8010a50e:	89 15 78 21 1c 80    	mov    %edx,0x801c2178
+  for(i = 0; i < vblk.n; i++){
+8010a514:	31 d2                	xor    %edx,%edx
+8010a516:	eb 13                	jmp    8010a52b <virtiorw+0xeb>
+8010a518:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a51f:	90                   	nop
+8010a520:	83 c2 01             	add    $0x1,%edx
+8010a523:	39 f2                	cmp    %esi,%edx
+8010a525:	0f 84 9e 01 00 00    	je     8010a6c9 <virtiorw+0x289>
+    if(vblk.free[i]){
+8010a52b:	80 ba 76 20 1c 80 00 	cmpb   $0x0,-0x7fe3df8a(%edx)
+8010a532:	74 ec                	je     8010a520 <virtiorw+0xe0>
+      vblk.nfree--;
+8010a534:	83 ef 03             	sub    $0x3,%edi
+  d0 = allocdesc();
+  d1 = allocdesc();
+  d2 = allocdesc();
+
+  r = &vblk.req[d0];
+  r->hdr.type = (b->flags & B_DIRTY) ? VBLK_OUT : VBLK_IN;
+8010a537:	8d 34 49             	lea    (%ecx,%ecx,2),%esi
+      vblk.free[i] = 0;
+8010a53a:	c6 82 76 20 1c 80 00 	movb   $0x0,-0x7fe3df8a(%edx)
+      vblk.nfree--;
+8010a541:	89 3d 78 21 1c 80    	mov    %edi,0x801c2178
+  r->hdr.type = (b->flags & B_DIRTY) ? VBLK_OUT : VBLK_IN;
+8010a547:	8d 3c f5 00 00 00 00 	lea    0x0(,%esi,8),%edi
+8010a54e:	8d b7 00 20 1c 80    	lea    -0x7fe3e000(%edi),%esi
+      vblk.free[i] = 0;
+8010a554:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  r->hdr.type = (b->flags & B_DIRTY) ? VBLK_OUT : VBLK_IN;
+8010a557:	89 fa                	mov    %edi,%edx
+8010a559:	8b 3b                	mov    (%ebx),%edi
+  r->hdr.reserved = 0;
+8010a55b:	c7 86 80 01 00 00 00 	movl   $0x0,0x180(%esi)
+8010a562:	00 00 00 
+  r->hdr.type = (b->flags & B_DIRTY) ? VBLK_OUT : VBLK_IN;
+8010a565:	c1 ff 02             	sar    $0x2,%edi
+  r->hdr.sector = (uint64)b->blockno * (BSIZE/512);
+  r->status = 0xff;
+  r->b = b;
+
+  vblk.desc[d0].addr = V2P(&r->hdr);
+8010a568:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  r->hdr.type = (b->flags & B_DIRTY) ? VBLK_OUT : VBLK_IN;
+8010a56b:	83 e7 01             	and    $0x1,%edi
+8010a56e:	89 be 7c 01 00 00    	mov    %edi,0x17c(%esi)
+  r->hdr.sector = (uint64)b->blockno * (BSIZE/512);
+8010a574:	8b 7b 08             	mov    0x8(%ebx),%edi
+8010a577:	c7 86 88 01 00 00 00 	movl   $0x0,0x188(%esi)
+8010a57e:	00 00 00 
+8010a581:	89 be 84 01 00 00    	mov    %edi,0x184(%esi)
+  vblk.desc[d0].addr = V2P(&r->hdr);
+8010a587:	89 d7                	mov    %edx,%edi
+8010a589:	8b 15 68 20 1c 80    	mov    0x801c2068,%edx
+  r->status = 0xff;
+8010a58f:	c6 86 8c 01 00 00 ff 	movb   $0xff,0x18c(%esi)
+  vblk.desc[d0].addr = V2P(&r->hdr);
+8010a596:	81 c7 7c 21 1c 00    	add    $0x1c217c,%edi
+  r->b = b;
+8010a59c:	89 9e 90 01 00 00    	mov    %ebx,0x190(%esi)
+  vblk.desc[d0].addr = V2P(&r->hdr);
+8010a5a2:	89 ce                	mov    %ecx,%esi
+8010a5a4:	c1 e6 04             	shl    $0x4,%esi
+8010a5a7:	89 3c 32             	mov    %edi,(%edx,%esi,1)
+8010a5aa:	c7 44 32 04 00 00 00 	movl   $0x0,0x4(%edx,%esi,1)
+8010a5b1:	00 
+  vblk.desc[d0].len = sizeof(r->hdr);
+8010a5b2:	8b 3d 68 20 1c 80    	mov    0x801c2068,%edi
+  vblk.desc[d0].flags = VQ_NEXT;
+8010a5b8:	ba 01 00 00 00       	mov    $0x1,%edx
+  vblk.desc[d0].len = sizeof(r->hdr);
+8010a5bd:	c7 44 37 08 10 00 00 	movl   $0x10,0x8(%edi,%esi,1)
+8010a5c4:	00 
+  vblk.desc[d0].flags = VQ_NEXT;
+8010a5c5:	8b 3d 68 20 1c 80    	mov    0x801c2068,%edi
+8010a5cb:	66 89 54 37 0c       	mov    %dx,0xc(%edi,%esi,1)
+  vblk.desc[d0].next = d1;
+8010a5d0:	8b 3d 68 20 1c 80    	mov    0x801c2068,%edi
+  vblk.desc[d1].addr = V2P(b->data);
+  vblk.desc[d1].len = BSIZE;
+  vblk.desc[d1].flags = VQ_NEXT | ((b->flags & B_DIRTY) ? 0 : VQ_WRITE);
+  vblk.desc[d1].next = d2;
+8010a5d6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  vblk.desc[d0].next = d1;
+8010a5d9:	66 89 44 37 0e       	mov    %ax,0xe(%edi,%esi,1)
+  vblk.desc[d1].addr = V2P(b->data);
+8010a5de:	8b 35 68 20 1c 80    	mov    0x801c2068,%esi
+8010a5e4:	c1 e0 04             	shl    $0x4,%eax
+8010a5e7:	8d bb a8 00 00 80    	lea    -0x7fffff58(%ebx),%edi
+8010a5ed:	89 3c 06             	mov    %edi,(%esi,%eax,1)
+8010a5f0:	c7 44 06 04 00 00 00 	movl   $0x0,0x4(%esi,%eax,1)
+8010a5f7:	00 
+  vblk.desc[d1].len = BSIZE;
+8010a5f8:	8b 35 68 20 1c 80    	mov    0x801c2068,%esi
+8010a5fe:	c7 44 06 08 00 02 00 	movl   $0x200,0x8(%esi,%eax,1)
+8010a605:	00 
+  vblk.desc[d1].flags = VQ_NEXT | ((b->flags & B_DIRTY) ? 0 : VQ_WRITE);
+8010a606:	8b 1b                	mov    (%ebx),%ebx
+8010a608:	8b 35 68 20 1c 80    	mov    0x801c2068,%esi
+8010a60e:	83 e3 04             	and    $0x4,%ebx
+8010a611:	83 fb 01             	cmp    $0x1,%ebx
+8010a614:	19 db                	sbb    %ebx,%ebx
+8010a616:	83 e3 02             	and    $0x2,%ebx
+8010a619:	83 c3 01             	add    $0x1,%ebx
+8010a61c:	66 89 5c 06 0c       	mov    %bx,0xc(%esi,%eax,1)
+  vblk.desc[d1].next = d2;
+8010a621:	8b 1d 68 20 1c 80    	mov    0x801c2068,%ebx
+  vblk.desc[d2].addr = V2P(&r->status);
+  vblk.desc[d2].len = 1;
+  vblk.desc[d2].flags = VQ_WRITE;
+  vblk.desc[d2].next = 0;
+8010a627:	31 f6                	xor    %esi,%esi
+  vblk.desc[d1].next = d2;
+8010a629:	66 89 54 03 0e       	mov    %dx,0xe(%ebx,%eax,1)
+  vblk.desc[d2].addr = V2P(&r->status);
+8010a62e:	8b 7d e0             	mov    -0x20(%ebp),%edi
+8010a631:	c1 e2 04             	shl    $0x4,%edx
+8010a634:	8b 1d 68 20 1c 80    	mov    0x801c2068,%ebx
+8010a63a:	8d 87 8c 21 1c 00    	lea    0x1c218c(%edi),%eax
+8010a640:	89 04 13             	mov    %eax,(%ebx,%edx,1)
+8010a643:	c7 44 13 04 00 00 00 	movl   $0x0,0x4(%ebx,%edx,1)
+8010a64a:	00 
+  vblk.desc[d2].len = 1;
+8010a64b:	a1 68 20 1c 80       	mov    0x801c2068,%eax
+  vblk.desc[d2].flags = VQ_WRITE;
+8010a650:	bb 02 00 00 00       	mov    $0x2,%ebx
+  vblk.desc[d2].len = 1;
+8010a655:	c7 44 10 08 01 00 00 	movl   $0x1,0x8(%eax,%edx,1)
+8010a65c:	00 
+  vblk.desc[d2].flags = VQ_WRITE;
+8010a65d:	a1 68 20 1c 80       	mov    0x801c2068,%eax
+8010a662:	66 89 5c 10 0c       	mov    %bx,0xc(%eax,%edx,1)
+  vblk.desc[d2].next = 0;
+8010a667:	a1 68 20 1c 80       	mov    0x801c2068,%eax
+8010a66c:	66 89 74 10 0e       	mov    %si,0xe(%eax,%edx,1)
+
+  // The device must see the chain before the new index.
+  vblk.avail->ring[vblk.avail->idx % vblk.n] = d0;
+8010a671:	8b 1d 6c 20 1c 80    	mov    0x801c206c,%ebx
+8010a677:	0f b7 43 02          	movzwl 0x2(%ebx),%eax
+8010a67b:	99                   	cltd
+8010a67c:	f7 3d 64 20 1c 80    	idivl  0x801c2064
+8010a682:	66 89 4c 53 04       	mov    %cx,0x4(%ebx,%edx,2)
+  __sync_synchronize();
+8010a687:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  vblk.avail->idx++;
+8010a68c:	a1 6c 20 1c 80       	mov    0x801c206c,%eax
+8010a691:	66 83 40 02 01       	addw   $0x1,0x2(%eax)
+  __sync_synchronize();
+8010a696:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  outw(vblk.iobase+VIRTIO_QNOTIFY, 0);
+8010a69b:	0f b7 05 60 20 1c 80 	movzwl 0x801c2060,%eax
+8010a6a2:	8d 50 10             	lea    0x10(%eax),%edx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010a6a5:	31 c0                	xor    %eax,%eax
+8010a6a7:	66 ef                	out    %ax,(%dx)
+  asm volatile("lock; xaddl %0, %1" :
+8010a6a9:	b8 01 00 00 00       	mov    $0x1,%eax
+8010a6ae:	f0 0f c1 05 88 d0 18 	lock xadd %eax,0x8018d088
+8010a6b5:	80 
+  xadd(&diskstat.ncmd, 1);
+  release(&vblk.lock);
+8010a6b6:	c7 45 08 00 20 1c 80 	movl   $0x801c2000,0x8(%ebp)
+}
+8010a6bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a6c0:	5b                   	pop    %ebx
+8010a6c1:	5e                   	pop    %esi
+8010a6c2:	5f                   	pop    %edi
+8010a6c3:	5d                   	pop    %ebp
+  release(&vblk.lock);
+8010a6c4:	e9 37 c8 ff ff       	jmp    80106f00 <release>
+  panic("virtio: no desc");
+8010a6c9:	83 ec 0c             	sub    $0xc,%esp
+8010a6cc:	68 24 bf 10 80       	push   $0x8010bf24
+8010a6d1:	e8 ea 6d ff ff       	call   801014c0 <panic>
+    panic("virtiorw: nothing to do");
+8010a6d6:	83 ec 0c             	sub    $0xc,%esp
+8010a6d9:	68 0c bf 10 80       	push   $0x8010bf0c
+8010a6de:	e8 dd 6d ff ff       	call   801014c0 <panic>
+    panic("virtiorw: buf not locked");
+8010a6e3:	83 ec 0c             	sub    $0xc,%esp
+8010a6e6:	68 f3 be 10 80       	push   $0x8010bef3
+8010a6eb:	e8 d0 6d ff ff       	call   801014c0 <panic>
+
+8010a6f0 <virtiointr>:
+
+// Interrupt handler.
+void
+virtiointr(void)
+{
+8010a6f0:	55                   	push   %ebp
+8010a6f1:	89 e5                	mov    %esp,%ebp
+8010a6f3:	53                   	push   %ebx
+8010a6f4:	83 ec 10             	sub    $0x10,%esp
+  struct vreq *r;
+  struct buf *b;
+  int id;
+
+  acquire(&vblk.lock);
+8010a6f7:	68 00 20 1c 80       	push   $0x801c2000
+8010a6fc:	e8 6f c9 ff ff       	call   80107070 <acquire>
+  // Reading the ISR lowers the interrupt, so completions
+  // after this point raise a new one.
+  inb(vblk.iobase+VIRTIO_ISR);
+8010a701:	0f b7 05 60 20 1c 80 	movzwl 0x801c2060,%eax
+8010a708:	8d 50 13             	lea    0x13(%eax),%edx
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010a70b:	ec                   	in     (%dx),%al
+  __sync_synchronize();
+8010a70c:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  while(vblk.lastused != *(volatile ushort*)&vblk.used->idx){
+8010a711:	0f b7 05 74 20 1c 80 	movzwl 0x801c2074,%eax
+8010a718:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a71f:	90                   	nop
+8010a720:	8b 0d 70 20 1c 80    	mov    0x801c2070,%ecx
+8010a726:	83 c4 10             	add    $0x10,%esp
+8010a729:	0f b7 51 02          	movzwl 0x2(%ecx),%edx
+8010a72d:	66 39 d0             	cmp    %dx,%ax
+8010a730:	0f 84 a3 00 00 00    	je     8010a7d9 <virtiointr+0xe9>
+    id = vblk.used->ring[vblk.lastused % vblk.n].id;
+8010a736:	0f b7 c0             	movzwl %ax,%eax
+8010a739:	99                   	cltd
+8010a73a:	f7 3d 64 20 1c 80    	idivl  0x801c2064
+8010a740:	8b 44 d1 04          	mov    0x4(%ecx,%edx,8),%eax
+    r = &vblk.req[id];
+    if(r->status != 0)
+8010a744:	8d 14 40             	lea    (%eax,%eax,2),%edx
+8010a747:	8d 14 d5 00 20 1c 80 	lea    -0x7fe3e000(,%edx,8),%edx
+8010a74e:	80 ba 8c 01 00 00 00 	cmpb   $0x0,0x18c(%edx)
+8010a755:	0f 85 90 00 00 00    	jne    8010a7eb <virtiointr+0xfb>
+    vblk.nfree++;
+8010a75b:	8b 0d 78 21 1c 80    	mov    0x801c2178,%ecx
+      panic("virtio: I/O error");
+    b = r->b;
+8010a761:	8b 9a 90 01 00 00    	mov    0x190(%edx),%ebx
+    vblk.free[i] = 1;
+8010a767:	c6 80 76 20 1c 80 01 	movb   $0x1,-0x7fe3df8a(%eax)
+    if(!(vblk.desc[i].flags & VQ_NEXT))
+8010a76e:	c1 e0 04             	shl    $0x4,%eax
+    vblk.nfree++;
+8010a771:	8d 51 01             	lea    0x1(%ecx),%edx
+8010a774:	83 c1 02             	add    $0x2,%ecx
+8010a777:	89 15 78 21 1c 80    	mov    %edx,0x801c2178
+    if(!(vblk.desc[i].flags & VQ_NEXT))
+8010a77d:	8b 15 68 20 1c 80    	mov    0x801c2068,%edx
+8010a783:	01 d0                	add    %edx,%eax
+8010a785:	f6 40 0c 01          	testb  $0x1,0xc(%eax)
+8010a789:	74 24                	je     8010a7af <virtiointr+0xbf>
+8010a78b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010a78f:	90                   	nop
+    i = vblk.desc[i].next;
+8010a790:	0f b7 40 0e          	movzwl 0xe(%eax),%eax
+    vblk.nfree++;
+8010a794:	89 0d 78 21 1c 80    	mov    %ecx,0x801c2178
+    if(!(vblk.desc[i].flags & VQ_NEXT))
+8010a79a:	83 c1 01             	add    $0x1,%ecx
+    vblk.free[i] = 1;
+8010a79d:	c6 80 76 20 1c 80 01 	movb   $0x1,-0x7fe3df8a(%eax)
+    if(!(vblk.desc[i].flags & VQ_NEXT))
+8010a7a4:	c1 e0 04             	shl    $0x4,%eax
+8010a7a7:	01 d0                	add    %edx,%eax
+8010a7a9:	f6 40 0c 01          	testb  $0x1,0xc(%eax)
+8010a7ad:	75 e1                	jne    8010a790 <virtiointr+0xa0>
+  wakeup(&vblk.free);
+8010a7af:	83 ec 0c             	sub    $0xc,%esp
+8010a7b2:	68 76 20 1c 80       	push   $0x801c2076
+8010a7b7:	e8 34 b9 ff ff       	call   801060f0 <wakeup>
+    freechain(id);
+    biodone(b);
+8010a7bc:	89 1c 24             	mov    %ebx,(%esp)
+8010a7bf:	e8 2c 64 ff ff       	call   80100bf0 <biodone>
+    vblk.lastused++;
+8010a7c4:	0f b7 05 74 20 1c 80 	movzwl 0x801c2074,%eax
+8010a7cb:	83 c0 01             	add    $0x1,%eax
+8010a7ce:	66 a3 74 20 1c 80    	mov    %ax,0x801c2074
+  while(vblk.lastused != *(volatile ushort*)&vblk.used->idx){
+8010a7d4:	e9 47 ff ff ff       	jmp    8010a720 <virtiointr+0x30>
+  }
+  release(&vblk.lock);
+8010a7d9:	83 ec 0c             	sub    $0xc,%esp
+8010a7dc:	68 00 20 1c 80       	push   $0x801c2000
+8010a7e1:	e8 1a c7 ff ff       	call   80106f00 <release>
+}
+8010a7e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010a7e9:	c9                   	leave
+8010a7ea:	c3                   	ret
+      panic("virtio: I/O error");
+8010a7eb:	83 ec 0c             	sub    $0xc,%esp
+8010a7ee:	68 34 bf 10 80       	push   $0x8010bf34
+8010a7f3:	e8 c8 6c ff ff       	call   801014c0 <panic>
+8010a7f8:	66 90                	xchg   %ax,%ax
+8010a7fa:	66 90                	xchg   %ax,%ax
+8010a7fc:	66 90                	xchg   %ax,%ax
+8010a7fe:	66 90                	xchg   %ax,%ax
+
+8010a800 <deallocuvm.part.0>:
+// Deallocate user pages to bring the process size from oldsz to
+// newsz.  oldsz and newsz need not be page-aligned, nor does newsz
+// need to be less than oldsz.  oldsz can be larger than the actual
+// process size.  Returns the new process size.
+int
+deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+8010a800:	55                   	push   %ebp
+8010a801:	89 e5                	mov    %esp,%ebp
+8010a803:	57                   	push   %edi
+8010a804:	56                   	push   %esi
+8010a805:	89 c6                	mov    %eax,%esi
+8010a807:	89 c8                	mov    %ecx,%eax
+8010a809:	53                   	push   %ebx
+  uint a, pa;
+
+  if(newsz >= oldsz)
+    return oldsz;
+
+  a = PGROUNDUP(newsz);
+8010a80a:	8d 99 ff 0f 00 00    	lea    0xfff(%ecx),%ebx
+8010a810:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+8010a816:	83 ec 1c             	sub    $0x1c,%esp
+  for(; a  < oldsz; a += PGSIZE){
+8010a819:	39 d3                	cmp    %edx,%ebx
+8010a81b:	73 66                	jae    8010a883 <deallocuvm.part.0+0x83>
+8010a81d:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+8010a820:	89 d7                	mov    %edx,%edi
+8010a822:	eb 10                	jmp    8010a834 <deallocuvm.part.0+0x34>
+8010a824:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(!pte)
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+8010a828:	83 c2 01             	add    $0x1,%edx
+8010a82b:	89 d3                	mov    %edx,%ebx
+8010a82d:	c1 e3 16             	shl    $0x16,%ebx
+  for(; a  < oldsz; a += PGSIZE){
+8010a830:	39 fb                	cmp    %edi,%ebx
+8010a832:	73 4c                	jae    8010a880 <deallocuvm.part.0+0x80>
+  pde = &pgdir[PDX(va)];
+8010a834:	89 da                	mov    %ebx,%edx
+8010a836:	c1 ea 16             	shr    $0x16,%edx
+  if(*pde & PTE_P){
+8010a839:	8b 04 96             	mov    (%esi,%edx,4),%eax
+8010a83c:	a8 01                	test   $0x1,%al
+8010a83e:	74 e8                	je     8010a828 <deallocuvm.part.0+0x28>
+  return &pgtab[PTX(va)];
+8010a840:	89 d9                	mov    %ebx,%ecx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010a842:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010a847:	c1 e9 0a             	shr    $0xa,%ecx
+8010a84a:	81 e1 fc 0f 00 00    	and    $0xffc,%ecx
+8010a850:	8d 8c 08 00 00 00 80 	lea    -0x80000000(%eax,%ecx,1),%ecx
+    if(!pte)
+8010a857:	85 c9                	test   %ecx,%ecx
+8010a859:	74 cd                	je     8010a828 <deallocuvm.part.0+0x28>
+    else if((*pte & PTE_P) != 0){
+8010a85b:	8b 01                	mov    (%ecx),%eax
+8010a85d:	a8 01                	test   $0x1,%al
+8010a85f:	74 15                	je     8010a876 <deallocuvm.part.0+0x76>
+      pa = PTE_ADDR(*pte);
+      if(pa == 0)
+8010a861:	89 c2                	mov    %eax,%edx
+8010a863:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+8010a869:	74 3f                	je     8010a8aa <deallocuvm.part.0+0xaa>
+        panic("kfree");
+      char *v = P2V(pa);
+      if(!(*pte & PTE_SHARED))
+8010a86b:	f6 c4 02             	test   $0x2,%ah
+8010a86e:	74 20                	je     8010a890 <deallocuvm.part.0+0x90>
+        kfree(v);
+      *pte = 0;
+8010a870:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+  for(; a  < oldsz; a += PGSIZE){
+8010a876:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010a87c:	39 fb                	cmp    %edi,%ebx
+8010a87e:	72 b4                	jb     8010a834 <deallocuvm.part.0+0x34>
+8010a880:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    }
+  }
+  return newsz;
+}
+8010a883:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a886:	5b                   	pop    %ebx
+8010a887:	5e                   	pop    %esi
+8010a888:	5f                   	pop    %edi
+8010a889:	5d                   	pop    %ebp
+8010a88a:	c3                   	ret
+8010a88b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010a88f:	90                   	nop
+        kfree(v);
+8010a890:	83 ec 0c             	sub    $0xc,%esp
+      char *v = P2V(pa);
+8010a893:	81 c2 00 00 00 80    	add    $0x80000000,%edx
+8010a899:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        kfree(v);
+8010a89c:	52                   	push   %edx
+8010a89d:	e8 4e 90 ff ff       	call   801038f0 <kfree>
+8010a8a2:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010a8a5:	83 c4 10             	add    $0x10,%esp
+8010a8a8:	eb c6                	jmp    8010a870 <deallocuvm.part.0+0x70>
+        panic("kfree");
+8010a8aa:	83 ec 0c             	sub    $0xc,%esp
+8010a8ad:	68 8a b8 10 80       	push   $0x8010b88a
+8010a8b2:	e8 09 6c ff ff       	call   801014c0 <panic>
+8010a8b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a8be:	66 90                	xchg   %ax,%ax
+
+8010a8c0 <seginit>:
+{
+8010a8c0:	55                   	push   %ebp
+8010a8c1:	89 e5                	mov    %esp,%ebp
+8010a8c3:	56                   	push   %esi
+  for(c = cpus; c < cpus+ncpu; c++)
+8010a8c4:	be 60 3b 1a 80       	mov    $0x801a3b60,%esi
+{
+8010a8c9:	53                   	push   %ebx
+8010a8ca:	83 ec 10             	sub    $0x10,%esp
+  apicid = lapicid();
+8010a8cd:	e8 7e 95 ff ff       	call   80103e50 <lapicid>
+  for(c = cpus; c < cpus+ncpu; c++)
+8010a8d2:	69 0d 44 3b 1a 80 c4 	imul   $0xc4,0x801a3b44,%ecx
+8010a8d9:	00 00 00 
+8010a8dc:	81 c1 60 3b 1a 80    	add    $0x801a3b60,%ecx
+8010a8e2:	81 f9 60 3b 1a 80    	cmp    $0x801a3b60,%ecx
+8010a8e8:	77 10                	ja     8010a8fa <seginit+0x3a>
+8010a8ea:	eb 16                	jmp    8010a902 <seginit+0x42>
+8010a8ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010a8f0:	81 c6 c4 00 00 00    	add    $0xc4,%esi
+8010a8f6:	39 ce                	cmp    %ecx,%esi
+8010a8f8:	73 08                	jae    8010a902 <seginit+0x42>
+    if(c->apicid == apicid)
+8010a8fa:	0f b6 56 08          	movzbl 0x8(%esi),%edx
+8010a8fe:	39 c2                	cmp    %eax,%edx
+8010a900:	75 ee                	jne    8010a8f0 <seginit+0x30>
+  if(c == cpus+ncpu)
+8010a902:	39 ce                	cmp    %ecx,%esi
+8010a904:	0f 84 f3 00 00 00    	je     8010a9fd <seginit+0x13d>
+  c->gdt[SEG_KCPU] = SEG(STA_W, c, sizeof(*c) - 1, 0);
+8010a90a:	31 c0                	xor    %eax,%eax
+  pd[0] = size-1;
+8010a90c:	b9 37 00 00 00       	mov    $0x37,%ecx
+8010a911:	ba 92 c0 ff ff       	mov    $0xffffc092,%edx
+  c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
+8010a916:	c7 86 80 00 00 00 ff 	movl   $0xffff,0x80(%esi)
+8010a91d:	ff 00 00 
+  c->gdt[SEG_KCPU] = SEG(STA_W, c, sizeof(*c) - 1, 0);
+8010a920:	66 89 86 a8 00 00 00 	mov    %ax,0xa8(%esi)
+8010a927:	89 f0                	mov    %esi,%eax
+8010a929:	c1 e8 10             	shr    $0x10,%eax
+8010a92c:	66 89 4d f2          	mov    %cx,-0xe(%ebp)
+8010a930:	88 86 ac 00 00 00    	mov    %al,0xac(%esi)
+8010a936:	89 f0                	mov    %esi,%eax
+8010a938:	c1 e8 18             	shr    $0x18,%eax
+  c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
+8010a93b:	c7 86 84 00 00 00 00 	movl   $0xcf9a00,0x84(%esi)
+8010a942:	9a cf 00 
+  c->gdt[SEG_KCPU] = SEG(STA_W, c, sizeof(*c) - 1, 0);
+8010a945:	88 86 af 00 00 00    	mov    %al,0xaf(%esi)
+  lgdt(c->gdt, sizeof(c->gdt));
+8010a94b:	8d 46 78             	lea    0x78(%esi),%eax
+  pd[1] = (uint)p;
+8010a94e:	66 89 45 f4          	mov    %ax,-0xc(%ebp)
+  pd[2] = (uint)p >> 16;
+8010a952:	c1 e8 10             	shr    $0x10,%eax
+8010a955:	66 89 45 f6          	mov    %ax,-0xa(%ebp)
+  asm volatile("lgdt (%0)" : : "r" (pd));
+8010a959:	8d 45 f2             	lea    -0xe(%ebp),%eax
+  c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
+8010a95c:	c7 86 88 00 00 00 ff 	movl   $0xffff,0x88(%esi)
+8010a963:	ff 00 00 
+8010a966:	c7 86 8c 00 00 00 00 	movl   $0xcf9200,0x8c(%esi)
+8010a96d:	92 cf 00 
+  c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
+8010a970:	c7 86 90 00 00 00 ff 	movl   $0xffff,0x90(%esi)
+8010a977:	ff 00 00 
+8010a97a:	c7 86 94 00 00 00 00 	movl   $0xcffa00,0x94(%esi)
+8010a981:	fa cf 00 
+  c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+8010a984:	c7 86 98 00 00 00 ff 	movl   $0xffff,0x98(%esi)
+8010a98b:	ff 00 00 
+8010a98e:	c7 86 9c 00 00 00 00 	movl   $0xcff200,0x9c(%esi)
+8010a995:	f2 cf 00 
+  c->gdt[SEG_KCPU] = SEG(STA_W, c, sizeof(*c) - 1, 0);
+8010a998:	66 89 b6 aa 00 00 00 	mov    %si,0xaa(%esi)
+8010a99f:	66 89 96 ad 00 00 00 	mov    %dx,0xad(%esi)
+8010a9a6:	0f 01 10             	lgdtl  (%eax)
+  asm volatile("movw %0, %%gs" : : "r" (v));
+8010a9a9:	b8 30 00 00 00       	mov    $0x30,%eax
+8010a9ae:	8e e8                	mov    %eax,%gs
+  asm volatile("cpuid" :
+8010a9b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  c->self = c;
+8010a9b5:	89 36                	mov    %esi,(%esi)
+8010a9b7:	31 c9                	xor    %ecx,%ecx
+  c->proc = 0;
+8010a9b9:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+8010a9c0:	0f a2                	cpuid
+  if(edx & CPUID_SEP){
+8010a9c2:	80 e6 08             	and    $0x8,%dh
+8010a9c5:	74 2f                	je     8010a9f6 <seginit+0x136>
+  asm volatile("wrmsr" : : "c" (msr), "A" (val));
+8010a9c7:	b9 74 01 00 00       	mov    $0x174,%ecx
+8010a9cc:	b8 08 00 00 00       	mov    $0x8,%eax
+8010a9d1:	31 d2                	xor    %edx,%edx
+8010a9d3:	0f 30                	wrmsr
+    wrmsr(MSR_SYSENTER_ESP, (uint)&c->ts);
+8010a9d5:	31 d2                	xor    %edx,%edx
+8010a9d7:	8d 46 10             	lea    0x10(%esi),%eax
+8010a9da:	b9 75 01 00 00       	mov    $0x175,%ecx
+8010a9df:	0f 30                	wrmsr
+8010a9e1:	b9 76 01 00 00       	mov    $0x176,%ecx
+8010a9e6:	b8 f3 92 10 80       	mov    $0x801092f3,%eax
+8010a9eb:	31 d2                	xor    %edx,%edx
+8010a9ed:	0f 30                	wrmsr
+    ((struct uclock*)uclockpage)->flags |= UCLOCK_SYSENTER;
+8010a9ef:	83 0d 00 d0 1b 80 01 	orl    $0x1,0x801bd000
+}
+8010a9f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010a9f9:	5b                   	pop    %ebx
+8010a9fa:	5e                   	pop    %esi
+8010a9fb:	5d                   	pop    %ebp
+8010a9fc:	c3                   	ret
+    panic("seginit: unknown apicid");
+8010a9fd:	83 ec 0c             	sub    $0xc,%esp
+8010aa00:	68 46 bf 10 80       	push   $0x8010bf46
+8010aa05:	e8 b6 6a ff ff       	call   801014c0 <panic>
+8010aa0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010aa10 <mappages>:
+{
+8010aa10:	55                   	push   %ebp
+8010aa11:	89 e5                	mov    %esp,%ebp
+8010aa13:	57                   	push   %edi
+8010aa14:	56                   	push   %esi
+8010aa15:	53                   	push   %ebx
+8010aa16:	83 ec 1c             	sub    $0x1c,%esp
+8010aa19:	8b 45 0c             	mov    0xc(%ebp),%eax
+  last = (char*)PGROUNDDOWN(((uint)va) + size - 1);
+8010aa1c:	8b 55 10             	mov    0x10(%ebp),%edx
+  a = (char*)PGROUNDDOWN((uint)va);
+8010aa1f:	89 c3                	mov    %eax,%ebx
+  last = (char*)PGROUNDDOWN(((uint)va) + size - 1);
+8010aa21:	8d 44 10 ff          	lea    -0x1(%eax,%edx,1),%eax
+8010aa25:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  a = (char*)PGROUNDDOWN((uint)va);
+8010aa2a:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  last = (char*)PGROUNDDOWN(((uint)va) + size - 1);
+8010aa30:	89 45 e0             	mov    %eax,-0x20(%ebp)
+8010aa33:	8b 45 14             	mov    0x14(%ebp),%eax
+8010aa36:	29 d8                	sub    %ebx,%eax
+8010aa38:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010aa3b:	eb 3c                	jmp    8010aa79 <mappages+0x69>
+8010aa3d:	8d 76 00             	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+8010aa40:	89 da                	mov    %ebx,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010aa42:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010aa47:	c1 ea 0a             	shr    $0xa,%edx
+8010aa4a:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+8010aa50:	8d 84 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%eax
+    if((pte = walkpgdir(pgdir, a, 1)) == 0)
+8010aa57:	85 c0                	test   %eax,%eax
+8010aa59:	74 75                	je     8010aad0 <mappages+0xc0>
+    if(*pte & PTE_P)
+8010aa5b:	f6 00 01             	testb  $0x1,(%eax)
+8010aa5e:	0f 85 86 00 00 00    	jne    8010aaea <mappages+0xda>
+    *pte = pa | perm | PTE_P;
+8010aa64:	0b 75 18             	or     0x18(%ebp),%esi
+8010aa67:	83 ce 01             	or     $0x1,%esi
+8010aa6a:	89 30                	mov    %esi,(%eax)
+    if(a == last)
+8010aa6c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010aa6f:	39 c3                	cmp    %eax,%ebx
+8010aa71:	74 6d                	je     8010aae0 <mappages+0xd0>
+    a += PGSIZE;
+8010aa73:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  for(;;){
+8010aa79:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  pde = &pgdir[PDX(va)];
+8010aa7c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+8010aa7f:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+8010aa82:	89 d8                	mov    %ebx,%eax
+8010aa84:	c1 e8 16             	shr    $0x16,%eax
+8010aa87:	8d 3c 81             	lea    (%ecx,%eax,4),%edi
+  if(*pde & PTE_P){
+8010aa8a:	8b 07                	mov    (%edi),%eax
+8010aa8c:	a8 01                	test   $0x1,%al
+8010aa8e:	75 b0                	jne    8010aa40 <mappages+0x30>
+    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
+8010aa90:	e8 2b 90 ff ff       	call   80103ac0 <kalloc>
+8010aa95:	85 c0                	test   %eax,%eax
+8010aa97:	74 37                	je     8010aad0 <mappages+0xc0>
+    memset(pgtab, 0, PGSIZE);
+8010aa99:	83 ec 04             	sub    $0x4,%esp
+8010aa9c:	68 00 10 00 00       	push   $0x1000
+8010aaa1:	6a 00                	push   $0x0
+8010aaa3:	50                   	push   %eax
+8010aaa4:	89 45 dc             	mov    %eax,-0x24(%ebp)
+8010aaa7:	e8 14 c9 ff ff       	call   801073c0 <memset>
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+8010aaac:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  return &pgtab[PTX(va)];
+8010aaaf:	83 c4 10             	add    $0x10,%esp
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+8010aab2:	8d 82 00 00 00 80    	lea    -0x80000000(%edx),%eax
+8010aab8:	83 c8 07             	or     $0x7,%eax
+8010aabb:	89 07                	mov    %eax,(%edi)
+  return &pgtab[PTX(va)];
+8010aabd:	89 d8                	mov    %ebx,%eax
+8010aabf:	c1 e8 0a             	shr    $0xa,%eax
+8010aac2:	25 fc 0f 00 00       	and    $0xffc,%eax
+8010aac7:	01 d0                	add    %edx,%eax
+8010aac9:	eb 90                	jmp    8010aa5b <mappages+0x4b>
+8010aacb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010aacf:	90                   	nop
+}
+8010aad0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010aad3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010aad8:	5b                   	pop    %ebx
+8010aad9:	5e                   	pop    %esi
+8010aada:	5f                   	pop    %edi
+8010aadb:	5d                   	pop    %ebp
+8010aadc:	c3                   	ret
+8010aadd:	8d 76 00             	lea    0x0(%esi),%esi
+8010aae0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010aae3:	31 c0                	xor    %eax,%eax
+}
+8010aae5:	5b                   	pop    %ebx
+8010aae6:	5e                   	pop    %esi
+8010aae7:	5f                   	pop    %edi
+8010aae8:	5d                   	pop    %ebp
+8010aae9:	c3                   	ret
+      panic("remap");
+8010aaea:	83 ec 0c             	sub    $0xc,%esp
+8010aaed:	68 5e bf 10 80       	push   $0x8010bf5e
+8010aaf2:	e8 c9 69 ff ff       	call   801014c0 <panic>
+8010aaf7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010aafe:	66 90                	xchg   %ax,%ax
+
+8010ab00 <switchkvm>:
+  lcr3(V2P(kpgdir));   // switch to the kernel page table
+8010ab00:	a1 7c 39 1c 80       	mov    0x801c397c,%eax
+8010ab05:	05 00 00 00 80       	add    $0x80000000,%eax
+}
+
+static inline void
+lcr3(uint val)
+{
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010ab0a:	0f 22 d8             	mov    %eax,%cr3
+}
+8010ab0d:	c3                   	ret
+8010ab0e:	66 90                	xchg   %ax,%ax
+
+8010ab10 <switchuvm>:
+{
+8010ab10:	55                   	push   %ebp
+8010ab11:	89 e5                	mov    %esp,%ebp
+8010ab13:	57                   	push   %edi
+8010ab14:	56                   	push   %esi
+8010ab15:	53                   	push   %ebx
+8010ab16:	83 ec 1c             	sub    $0x1c,%esp
+8010ab19:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(p == 0)
+8010ab1c:	85 f6                	test   %esi,%esi
+8010ab1e:	0f 84 cb 00 00 00    	je     8010abef <switchuvm+0xdf>
+  if(p->kstack == 0)
+8010ab24:	8b 46 08             	mov    0x8(%esi),%eax
+8010ab27:	85 c0                	test   %eax,%eax
+8010ab29:	0f 84 da 00 00 00    	je     8010ac09 <switchuvm+0xf9>
+  if(p->pgdir == 0)
+8010ab2f:	8b 46 04             	mov    0x4(%esi),%eax
+8010ab32:	85 c0                	test   %eax,%eax
+8010ab34:	0f 84 c2 00 00 00    	je     8010abfc <switchuvm+0xec>
+  pushcli();
+8010ab3a:	e8 d1 c2 ff ff       	call   80106e10 <pushcli>
+  mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts,
+8010ab3f:	e8 9c aa ff ff       	call   801055e0 <mycpu>
+8010ab44:	89 c3                	mov    %eax,%ebx
+8010ab46:	e8 95 aa ff ff       	call   801055e0 <mycpu>
+8010ab4b:	89 c7                	mov    %eax,%edi
+8010ab4d:	e8 8e aa ff ff       	call   801055e0 <mycpu>
+8010ab52:	83 c7 10             	add    $0x10,%edi
+8010ab55:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010ab58:	e8 83 aa ff ff       	call   801055e0 <mycpu>
+8010ab5d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010ab60:	ba 67 00 00 00       	mov    $0x67,%edx
+8010ab65:	66 89 bb a2 00 00 00 	mov    %di,0xa2(%ebx)
+8010ab6c:	83 c0 10             	add    $0x10,%eax
+8010ab6f:	66 89 93 a0 00 00 00 	mov    %dx,0xa0(%ebx)
+  mycpu()->ts.iomb = (ushort) 0xFFFF;
+8010ab76:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+  mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts,
+8010ab7b:	83 c1 10             	add    $0x10,%ecx
+8010ab7e:	c1 e8 18             	shr    $0x18,%eax
+8010ab81:	c1 e9 10             	shr    $0x10,%ecx
+8010ab84:	88 83 a7 00 00 00    	mov    %al,0xa7(%ebx)
+8010ab8a:	88 8b a4 00 00 00    	mov    %cl,0xa4(%ebx)
+8010ab90:	b9 99 40 00 00       	mov    $0x4099,%ecx
+8010ab95:	66 89 8b a5 00 00 00 	mov    %cx,0xa5(%ebx)
+  mycpu()->ts.ss0 = SEG_KDATA << 3;
+8010ab9c:	bb 10 00 00 00       	mov    $0x10,%ebx
+  mycpu()->gdt[SEG_TSS].s = 0;
+8010aba1:	e8 3a aa ff ff       	call   801055e0 <mycpu>
+8010aba6:	80 a0 a5 00 00 00 ef 	andb   $0xef,0xa5(%eax)
+  mycpu()->ts.ss0 = SEG_KDATA << 3;
+8010abad:	e8 2e aa ff ff       	call   801055e0 <mycpu>
+8010abb2:	66 89 58 18          	mov    %bx,0x18(%eax)
+  mycpu()->ts.esp0 = (uint)p->kstack + KSTACKSIZE;
+8010abb6:	8b 5e 08             	mov    0x8(%esi),%ebx
+8010abb9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010abbf:	e8 1c aa ff ff       	call   801055e0 <mycpu>
+8010abc4:	89 58 14             	mov    %ebx,0x14(%eax)
+  mycpu()->ts.iomb = (ushort) 0xFFFF;
+8010abc7:	e8 14 aa ff ff       	call   801055e0 <mycpu>
+8010abcc:	66 89 78 76          	mov    %di,0x76(%eax)
+  asm volatile("ltr %0" : : "r" (sel));
+8010abd0:	b8 28 00 00 00       	mov    $0x28,%eax
+8010abd5:	0f 00 d8             	ltr    %ax
+  lcr3(V2P(p->pgdir));  // switch to process's address space
+8010abd8:	8b 46 04             	mov    0x4(%esi),%eax
+8010abdb:	05 00 00 00 80       	add    $0x80000000,%eax
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010abe0:	0f 22 d8             	mov    %eax,%cr3
+}
+8010abe3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010abe6:	5b                   	pop    %ebx
+8010abe7:	5e                   	pop    %esi
+8010abe8:	5f                   	pop    %edi
+8010abe9:	5d                   	pop    %ebp
+  popcli();
+8010abea:	e9 71 c2 ff ff       	jmp    80106e60 <popcli>
+    panic("switchuvm: no process");
+8010abef:	83 ec 0c             	sub    $0xc,%esp
+8010abf2:	68 64 bf 10 80       	push   $0x8010bf64
+8010abf7:	e8 c4 68 ff ff       	call   801014c0 <panic>
+    panic("switchuvm: no pgdir");
+8010abfc:	83 ec 0c             	sub    $0xc,%esp
+8010abff:	68 8f bf 10 80       	push   $0x8010bf8f
+8010ac04:	e8 b7 68 ff ff       	call   801014c0 <panic>
+    panic("switchuvm: no kstack");
+8010ac09:	83 ec 0c             	sub    $0xc,%esp
+8010ac0c:	68 7a bf 10 80       	push   $0x8010bf7a
+8010ac11:	e8 aa 68 ff ff       	call   801014c0 <panic>
+8010ac16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010ac1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+8010ac20 <inituvm>:
+{
+8010ac20:	55                   	push   %ebp
+8010ac21:	89 e5                	mov    %esp,%ebp
+8010ac23:	57                   	push   %edi
+8010ac24:	56                   	push   %esi
+8010ac25:	53                   	push   %ebx
+8010ac26:	83 ec 1c             	sub    $0x1c,%esp
+8010ac29:	8b 75 10             	mov    0x10(%ebp),%esi
+8010ac2c:	8b 55 08             	mov    0x8(%ebp),%edx
+8010ac2f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(sz >= PGSIZE)
+8010ac32:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+8010ac38:	77 50                	ja     8010ac8a <inituvm+0x6a>
+8010ac3a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  mem = kalloc();
+8010ac3d:	e8 7e 8e ff ff       	call   80103ac0 <kalloc>
+  memset(mem, 0, PGSIZE);
+8010ac42:	83 ec 04             	sub    $0x4,%esp
+8010ac45:	68 00 10 00 00       	push   $0x1000
+  mem = kalloc();
+8010ac4a:	89 c3                	mov    %eax,%ebx
+  memset(mem, 0, PGSIZE);
+8010ac4c:	6a 00                	push   $0x0
+8010ac4e:	50                   	push   %eax
+8010ac4f:	e8 6c c7 ff ff       	call   801073c0 <memset>
+  mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
+8010ac54:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+8010ac5a:	c7 04 24 06 00 00 00 	movl   $0x6,(%esp)
+8010ac61:	50                   	push   %eax
+8010ac62:	68 00 10 00 00       	push   $0x1000
+8010ac67:	6a 00                	push   $0x0
+8010ac69:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010ac6c:	52                   	push   %edx
+8010ac6d:	e8 9e fd ff ff       	call   8010aa10 <mappages>
+  memmove(mem, init, sz);
+8010ac72:	89 75 10             	mov    %esi,0x10(%ebp)
+8010ac75:	83 c4 20             	add    $0x20,%esp
+8010ac78:	89 7d 0c             	mov    %edi,0xc(%ebp)
+8010ac7b:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+8010ac7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010ac81:	5b                   	pop    %ebx
+8010ac82:	5e                   	pop    %esi
+8010ac83:	5f                   	pop    %edi
+8010ac84:	5d                   	pop    %ebp
+  memmove(mem, init, sz);
+8010ac85:	e9 c6 c7 ff ff       	jmp    80107450 <memmove>
+    panic("inituvm: more than a page");
+8010ac8a:	83 ec 0c             	sub    $0xc,%esp
+8010ac8d:	68 a3 bf 10 80       	push   $0x8010bfa3
+8010ac92:	e8 29 68 ff ff       	call   801014c0 <panic>
+8010ac97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010ac9e:	66 90                	xchg   %ax,%ax
+
+8010aca0 <mapupages>:
+{
+8010aca0:	55                   	push   %ebp
+8010aca1:	89 e5                	mov    %esp,%ebp
+8010aca3:	56                   	push   %esi
+8010aca4:	53                   	push   %ebx
+8010aca5:	8b 75 08             	mov    0x8(%ebp),%esi
+  if((mem = kalloc()) == 0)
+8010aca8:	e8 13 8e ff ff       	call   80103ac0 <kalloc>
+8010acad:	85 c0                	test   %eax,%eax
+8010acaf:	74 72                	je     8010ad23 <mapupages+0x83>
+  memset(mem, 0, PGSIZE);
+8010acb1:	83 ec 04             	sub    $0x4,%esp
+8010acb4:	89 c3                	mov    %eax,%ebx
+8010acb6:	68 00 10 00 00       	push   $0x1000
+8010acbb:	6a 00                	push   $0x0
+8010acbd:	50                   	push   %eax
+8010acbe:	e8 fd c6 ff ff       	call   801073c0 <memset>
+  ((struct uproc*)mem)->pid = pid;
+8010acc3:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010acc6:	89 03                	mov    %eax,(%ebx)
+  if(mappages(pgdir, (char*)UPROC, PGSIZE, V2P(mem), PTE_U) < 0){
+8010acc8:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+8010acce:	c7 04 24 04 00 00 00 	movl   $0x4,(%esp)
+8010acd5:	50                   	push   %eax
+8010acd6:	68 00 10 00 00       	push   $0x1000
+8010acdb:	68 00 e0 ff 7f       	push   $0x7fffe000
+8010ace0:	56                   	push   %esi
+8010ace1:	e8 2a fd ff ff       	call   8010aa10 <mappages>
+8010ace6:	83 c4 20             	add    $0x20,%esp
+8010ace9:	85 c0                	test   %eax,%eax
+8010aceb:	78 2a                	js     8010ad17 <mapupages+0x77>
+  if(mappages(pgdir, (char*)UCLOCK, PGSIZE, V2P(uclockpage), PTE_U|PTE_SHARED) < 0)
+8010aced:	83 ec 0c             	sub    $0xc,%esp
+8010acf0:	68 04 02 00 00       	push   $0x204
+8010acf5:	68 00 d0 1b 00       	push   $0x1bd000
+8010acfa:	68 00 10 00 00       	push   $0x1000
+8010acff:	68 00 f0 ff 7f       	push   $0x7ffff000
+8010ad04:	56                   	push   %esi
+8010ad05:	e8 06 fd ff ff       	call   8010aa10 <mappages>
+8010ad0a:	83 c4 20             	add    $0x20,%esp
+8010ad0d:	c1 f8 1f             	sar    $0x1f,%eax
+}
+8010ad10:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010ad13:	5b                   	pop    %ebx
+8010ad14:	5e                   	pop    %esi
+8010ad15:	5d                   	pop    %ebp
+8010ad16:	c3                   	ret
+    kfree(mem);
+8010ad17:	83 ec 0c             	sub    $0xc,%esp
+8010ad1a:	53                   	push   %ebx
+8010ad1b:	e8 d0 8b ff ff       	call   801038f0 <kfree>
+    return -1;
+8010ad20:	83 c4 10             	add    $0x10,%esp
+    return -1;
+8010ad23:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010ad28:	eb e6                	jmp    8010ad10 <mapupages+0x70>
+8010ad2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010ad30 <loaduvm>:
+{
+8010ad30:	55                   	push   %ebp
+8010ad31:	89 e5                	mov    %esp,%ebp
+8010ad33:	57                   	push   %edi
+8010ad34:	56                   	push   %esi
+8010ad35:	53                   	push   %ebx
+8010ad36:	83 ec 0c             	sub    $0xc,%esp
+  if((uint) addr % PGSIZE != 0)
+8010ad39:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+8010ad3c:	8b 7d 18             	mov    0x18(%ebp),%edi
+  if((uint) addr % PGSIZE != 0)
+8010ad3f:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+8010ad45:	0f 85 a2 00 00 00    	jne    8010aded <loaduvm+0xbd>
+  for(i = 0; i < sz; i += PGSIZE){
+8010ad4b:	85 ff                	test   %edi,%edi
+8010ad4d:	74 7d                	je     8010adcc <loaduvm+0x9c>
+8010ad4f:	90                   	nop
+  pde = &pgdir[PDX(va)];
+8010ad50:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if(*pde & PTE_P){
+8010ad53:	8b 55 08             	mov    0x8(%ebp),%edx
+8010ad56:	01 f0                	add    %esi,%eax
+  pde = &pgdir[PDX(va)];
+8010ad58:	89 c1                	mov    %eax,%ecx
+8010ad5a:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010ad5d:	8b 0c 8a             	mov    (%edx,%ecx,4),%ecx
+8010ad60:	f6 c1 01             	test   $0x1,%cl
+8010ad63:	75 13                	jne    8010ad78 <loaduvm+0x48>
+      panic("loaduvm: address should exist");
+8010ad65:	83 ec 0c             	sub    $0xc,%esp
+8010ad68:	68 bd bf 10 80       	push   $0x8010bfbd
+8010ad6d:	e8 4e 67 ff ff       	call   801014c0 <panic>
+8010ad72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+8010ad78:	c1 e8 0a             	shr    $0xa,%eax
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010ad7b:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  return &pgtab[PTX(va)];
+8010ad81:	25 fc 0f 00 00       	and    $0xffc,%eax
+8010ad86:	8d 8c 01 00 00 00 80 	lea    -0x80000000(%ecx,%eax,1),%ecx
+    if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
+8010ad8d:	85 c9                	test   %ecx,%ecx
+8010ad8f:	74 d4                	je     8010ad65 <loaduvm+0x35>
+    if(sz - i < PGSIZE)
+8010ad91:	89 fb                	mov    %edi,%ebx
+8010ad93:	b8 00 10 00 00       	mov    $0x1000,%eax
+8010ad98:	29 f3                	sub    %esi,%ebx
+8010ad9a:	39 c3                	cmp    %eax,%ebx
+8010ad9c:	0f 47 d8             	cmova  %eax,%ebx
+    if(readi(ip, P2V(pa), offset+i, n) != n)
+8010ad9f:	53                   	push   %ebx
+8010ada0:	8b 45 14             	mov    0x14(%ebp),%eax
+8010ada3:	01 f0                	add    %esi,%eax
+8010ada5:	50                   	push   %eax
+    pa = PTE_ADDR(*pte);
+8010ada6:	8b 01                	mov    (%ecx),%eax
+8010ada8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    if(readi(ip, P2V(pa), offset+i, n) != n)
+8010adad:	05 00 00 00 80       	add    $0x80000000,%eax
+8010adb2:	50                   	push   %eax
+8010adb3:	ff 75 10             	push   0x10(%ebp)
+8010adb6:	e8 55 82 ff ff       	call   80103010 <readi>
+8010adbb:	83 c4 10             	add    $0x10,%esp
+8010adbe:	39 d8                	cmp    %ebx,%eax
+8010adc0:	75 1e                	jne    8010ade0 <loaduvm+0xb0>
+  for(i = 0; i < sz; i += PGSIZE){
+8010adc2:	81 c6 00 10 00 00    	add    $0x1000,%esi
+8010adc8:	39 fe                	cmp    %edi,%esi
+8010adca:	72 84                	jb     8010ad50 <loaduvm+0x20>
+}
+8010adcc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010adcf:	31 c0                	xor    %eax,%eax
+}
+8010add1:	5b                   	pop    %ebx
+8010add2:	5e                   	pop    %esi
+8010add3:	5f                   	pop    %edi
+8010add4:	5d                   	pop    %ebp
+8010add5:	c3                   	ret
+8010add6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010addd:	8d 76 00             	lea    0x0(%esi),%esi
+8010ade0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010ade3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010ade8:	5b                   	pop    %ebx
+8010ade9:	5e                   	pop    %esi
+8010adea:	5f                   	pop    %edi
+8010adeb:	5d                   	pop    %ebp
+8010adec:	c3                   	ret
+    panic("loaduvm: addr must be page aligned");
+8010aded:	83 ec 0c             	sub    $0xc,%esp
+8010adf0:	68 60 c0 10 80       	push   $0x8010c060
+8010adf5:	e8 c6 66 ff ff       	call   801014c0 <panic>
+8010adfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010ae00 <allocuvm>:
+{
+8010ae00:	55                   	push   %ebp
+8010ae01:	89 e5                	mov    %esp,%ebp
+8010ae03:	57                   	push   %edi
+8010ae04:	56                   	push   %esi
+8010ae05:	53                   	push   %ebx
+8010ae06:	83 ec 0c             	sub    $0xc,%esp
+8010ae09:	8b 55 10             	mov    0x10(%ebp),%edx
+  if(newsz > UTOP)
+8010ae0c:	81 fa 00 d0 ff 7f    	cmp    $0x7fffd000,%edx
+8010ae12:	0f 87 a3 00 00 00    	ja     8010aebb <allocuvm+0xbb>
+    return oldsz;
+8010ae18:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if(newsz < oldsz)
+8010ae1b:	3b 55 0c             	cmp    0xc(%ebp),%edx
+8010ae1e:	0f 82 99 00 00 00    	jb     8010aebd <allocuvm+0xbd>
+  a = PGROUNDUP(oldsz);
+8010ae24:	05 ff 0f 00 00       	add    $0xfff,%eax
+8010ae29:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010ae2e:	89 c6                	mov    %eax,%esi
+  for(; a < newsz; a += PGSIZE){
+8010ae30:	39 d0                	cmp    %edx,%eax
+8010ae32:	0f 83 93 00 00 00    	jae    8010aecb <allocuvm+0xcb>
+8010ae38:	8d 4a ff             	lea    -0x1(%edx),%ecx
+8010ae3b:	89 55 10             	mov    %edx,0x10(%ebp)
+8010ae3e:	29 c1                	sub    %eax,%ecx
+8010ae40:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+8010ae46:	8d bc 08 00 10 00 00 	lea    0x1000(%eax,%ecx,1),%edi
+8010ae4d:	eb 3e                	jmp    8010ae8d <allocuvm+0x8d>
+8010ae4f:	90                   	nop
+    memset(mem, 0, PGSIZE);
+8010ae50:	83 ec 04             	sub    $0x4,%esp
+8010ae53:	68 00 10 00 00       	push   $0x1000
+8010ae58:	6a 00                	push   $0x0
+8010ae5a:	50                   	push   %eax
+8010ae5b:	e8 60 c5 ff ff       	call   801073c0 <memset>
+    if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+8010ae60:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+8010ae66:	c7 04 24 06 00 00 00 	movl   $0x6,(%esp)
+8010ae6d:	50                   	push   %eax
+8010ae6e:	68 00 10 00 00       	push   $0x1000
+8010ae73:	56                   	push   %esi
+8010ae74:	ff 75 08             	push   0x8(%ebp)
+8010ae77:	e8 94 fb ff ff       	call   8010aa10 <mappages>
+8010ae7c:	83 c4 20             	add    $0x20,%esp
+8010ae7f:	85 c0                	test   %eax,%eax
+8010ae81:	78 55                	js     8010aed8 <allocuvm+0xd8>
+  for(; a < newsz; a += PGSIZE){
+8010ae83:	81 c6 00 10 00 00    	add    $0x1000,%esi
+8010ae89:	39 fe                	cmp    %edi,%esi
+8010ae8b:	74 3b                	je     8010aec8 <allocuvm+0xc8>
+    mem = kalloc();
+8010ae8d:	e8 2e 8c ff ff       	call   80103ac0 <kalloc>
+8010ae92:	89 c3                	mov    %eax,%ebx
+    if(mem == 0){
+8010ae94:	85 c0                	test   %eax,%eax
+8010ae96:	75 b8                	jne    8010ae50 <allocuvm+0x50>
+      cprintf("allocuvm out of memory\n");
+8010ae98:	83 ec 0c             	sub    $0xc,%esp
+8010ae9b:	68 db bf 10 80       	push   $0x8010bfdb
+8010aea0:	e8 4b 69 ff ff       	call   801017f0 <cprintf>
+  if(newsz >= oldsz)
+8010aea5:	8b 55 10             	mov    0x10(%ebp),%edx
+8010aea8:	83 c4 10             	add    $0x10,%esp
+8010aeab:	3b 55 0c             	cmp    0xc(%ebp),%edx
+8010aeae:	74 0b                	je     8010aebb <allocuvm+0xbb>
+8010aeb0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010aeb3:	8b 45 08             	mov    0x8(%ebp),%eax
+8010aeb6:	e8 45 f9 ff ff       	call   8010a800 <deallocuvm.part.0>
+    return 0;
+8010aebb:	31 c0                	xor    %eax,%eax
+}
+8010aebd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010aec0:	5b                   	pop    %ebx
+8010aec1:	5e                   	pop    %esi
+8010aec2:	5f                   	pop    %edi
+8010aec3:	5d                   	pop    %ebp
+8010aec4:	c3                   	ret
+8010aec5:	8d 76 00             	lea    0x0(%esi),%esi
+8010aec8:	8b 55 10             	mov    0x10(%ebp),%edx
+8010aecb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return newsz;
+8010aece:	89 d0                	mov    %edx,%eax
+}
+8010aed0:	5b                   	pop    %ebx
+8010aed1:	5e                   	pop    %esi
+8010aed2:	5f                   	pop    %edi
+8010aed3:	5d                   	pop    %ebp
+8010aed4:	c3                   	ret
+8010aed5:	8d 76 00             	lea    0x0(%esi),%esi
+      cprintf("allocuvm out of memory (2)\n");
+8010aed8:	83 ec 0c             	sub    $0xc,%esp
+8010aedb:	68 f3 bf 10 80       	push   $0x8010bff3
+8010aee0:	e8 0b 69 ff ff       	call   801017f0 <cprintf>
+  if(newsz >= oldsz)
+8010aee5:	8b 55 10             	mov    0x10(%ebp),%edx
+8010aee8:	83 c4 10             	add    $0x10,%esp
+8010aeeb:	3b 55 0c             	cmp    0xc(%ebp),%edx
+8010aeee:	74 0b                	je     8010aefb <allocuvm+0xfb>
+8010aef0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010aef3:	8b 45 08             	mov    0x8(%ebp),%eax
+8010aef6:	e8 05 f9 ff ff       	call   8010a800 <deallocuvm.part.0>
+      kfree(mem);
+8010aefb:	83 ec 0c             	sub    $0xc,%esp
+8010aefe:	53                   	push   %ebx
+8010aeff:	e8 ec 89 ff ff       	call   801038f0 <kfree>
+      return 0;
+8010af04:	83 c4 10             	add    $0x10,%esp
+    return 0;
+8010af07:	31 c0                	xor    %eax,%eax
+8010af09:	eb b2                	jmp    8010aebd <allocuvm+0xbd>
+8010af0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010af0f:	90                   	nop
+
+8010af10 <deallocuvm>:
+{
+8010af10:	55                   	push   %ebp
+8010af11:	89 e5                	mov    %esp,%ebp
+8010af13:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010af16:	8b 4d 10             	mov    0x10(%ebp),%ecx
+8010af19:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(newsz >= oldsz)
+8010af1c:	39 d1                	cmp    %edx,%ecx
+8010af1e:	73 10                	jae    8010af30 <deallocuvm+0x20>
+}
+8010af20:	5d                   	pop    %ebp
+8010af21:	e9 da f8 ff ff       	jmp    8010a800 <deallocuvm.part.0>
+8010af26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010af2d:	8d 76 00             	lea    0x0(%esi),%esi
+8010af30:	89 d0                	mov    %edx,%eax
+8010af32:	5d                   	pop    %ebp
+8010af33:	c3                   	ret
+8010af34:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010af3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010af3f:	90                   	nop
+
+8010af40 <freevm>:
+// Free a page table and all the physical memory pages
+// in the user part.  The kernel part's page-table pages
+// are shared with kpgdir (see setupkvm) and are kept.
+void
+freevm(pde_t *pgdir)
+{
+8010af40:	55                   	push   %ebp
+8010af41:	89 e5                	mov    %esp,%ebp
+8010af43:	57                   	push   %edi
+8010af44:	56                   	push   %esi
+8010af45:	53                   	push   %ebx
+8010af46:	83 ec 0c             	sub    $0xc,%esp
+8010af49:	8b 75 08             	mov    0x8(%ebp),%esi
+  uint i;
+
+  if(pgdir == 0)
+8010af4c:	85 f6                	test   %esi,%esi
+8010af4e:	74 59                	je     8010afa9 <freevm+0x69>
+  if(newsz >= oldsz)
+8010af50:	31 c9                	xor    %ecx,%ecx
+8010af52:	ba 00 00 00 80       	mov    $0x80000000,%edx
+8010af57:	89 f0                	mov    %esi,%eax
+8010af59:	89 f3                	mov    %esi,%ebx
+8010af5b:	e8 a0 f8 ff ff       	call   8010a800 <deallocuvm.part.0>
+    panic("freevm: no pgdir");
+  deallocuvm(pgdir, KERNBASE, 0);
+  for(i = 0; i < PDX(KERNBASE); i++){
+8010af60:	8d be 00 08 00 00    	lea    0x800(%esi),%edi
+8010af66:	eb 0f                	jmp    8010af77 <freevm+0x37>
+8010af68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010af6f:	90                   	nop
+8010af70:	83 c3 04             	add    $0x4,%ebx
+8010af73:	39 fb                	cmp    %edi,%ebx
+8010af75:	74 23                	je     8010af9a <freevm+0x5a>
+    if(pgdir[i] & PTE_P){
+8010af77:	8b 03                	mov    (%ebx),%eax
+8010af79:	a8 01                	test   $0x1,%al
+8010af7b:	74 f3                	je     8010af70 <freevm+0x30>
+      char * v = P2V(PTE_ADDR(pgdir[i]));
+8010af7d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+      kfree(v);
+8010af82:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < PDX(KERNBASE); i++){
+8010af85:	83 c3 04             	add    $0x4,%ebx
+      char * v = P2V(PTE_ADDR(pgdir[i]));
+8010af88:	05 00 00 00 80       	add    $0x80000000,%eax
+      kfree(v);
+8010af8d:	50                   	push   %eax
+8010af8e:	e8 5d 89 ff ff       	call   801038f0 <kfree>
+8010af93:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < PDX(KERNBASE); i++){
+8010af96:	39 fb                	cmp    %edi,%ebx
+8010af98:	75 dd                	jne    8010af77 <freevm+0x37>
+    }
+  }
+  kfree((char*)pgdir);
+8010af9a:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+8010af9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010afa0:	5b                   	pop    %ebx
+8010afa1:	5e                   	pop    %esi
+8010afa2:	5f                   	pop    %edi
+8010afa3:	5d                   	pop    %ebp
+  kfree((char*)pgdir);
+8010afa4:	e9 47 89 ff ff       	jmp    801038f0 <kfree>
+    panic("freevm: no pgdir");
+8010afa9:	83 ec 0c             	sub    $0xc,%esp
+8010afac:	68 0f c0 10 80       	push   $0x8010c00f
+8010afb1:	e8 0a 65 ff ff       	call   801014c0 <panic>
+8010afb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010afbd:	8d 76 00             	lea    0x0(%esi),%esi
+
+8010afc0 <setupkvm>:
+{
+8010afc0:	55                   	push   %ebp
+8010afc1:	89 e5                	mov    %esp,%ebp
+8010afc3:	56                   	push   %esi
+8010afc4:	53                   	push   %ebx
+  if((pgdir = (pde_t*)kalloc()) == 0)
+8010afc5:	e8 f6 8a ff ff       	call   80103ac0 <kalloc>
+8010afca:	85 c0                	test   %eax,%eax
+8010afcc:	0f 84 9a 00 00 00    	je     8010b06c <setupkvm+0xac>
+  memset(pgdir, 0, PGSIZE);
+8010afd2:	83 ec 04             	sub    $0x4,%esp
+8010afd5:	89 c6                	mov    %eax,%esi
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+8010afd7:	bb 20 f4 10 80       	mov    $0x8010f420,%ebx
+  memset(pgdir, 0, PGSIZE);
+8010afdc:	68 00 10 00 00       	push   $0x1000
+8010afe1:	6a 00                	push   $0x0
+8010afe3:	50                   	push   %eax
+8010afe4:	e8 d7 c3 ff ff       	call   801073c0 <memset>
+  if(kpgdir){
+8010afe9:	a1 7c 39 1c 80       	mov    0x801c397c,%eax
+8010afee:	83 c4 10             	add    $0x10,%esp
+8010aff1:	85 c0                	test   %eax,%eax
+8010aff3:	75 3b                	jne    8010b030 <setupkvm+0x70>
+                (uint)k->phys_start, k->perm) < 0) {
+8010aff5:	8b 53 04             	mov    0x4(%ebx),%edx
+    if(mappages(pgdir, k->virt, k->phys_end - k->phys_start,
+8010aff8:	83 ec 0c             	sub    $0xc,%esp
+8010affb:	ff 73 0c             	push   0xc(%ebx)
+8010affe:	52                   	push   %edx
+8010afff:	8b 43 08             	mov    0x8(%ebx),%eax
+8010b002:	29 d0                	sub    %edx,%eax
+8010b004:	50                   	push   %eax
+8010b005:	ff 33                	push   (%ebx)
+8010b007:	56                   	push   %esi
+8010b008:	e8 03 fa ff ff       	call   8010aa10 <mappages>
+8010b00d:	83 c4 20             	add    $0x20,%esp
+8010b010:	85 c0                	test   %eax,%eax
+8010b012:	78 4c                	js     8010b060 <setupkvm+0xa0>
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+8010b014:	83 c3 10             	add    $0x10,%ebx
+8010b017:	81 fb 60 f4 10 80    	cmp    $0x8010f460,%ebx
+8010b01d:	75 d6                	jne    8010aff5 <setupkvm+0x35>
+}
+8010b01f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010b022:	89 f0                	mov    %esi,%eax
+8010b024:	5b                   	pop    %ebx
+8010b025:	5e                   	pop    %esi
+8010b026:	5d                   	pop    %ebp
+8010b027:	c3                   	ret
+8010b028:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b02f:	90                   	nop
+    memmove(&pgdir[PDX(KERNBASE)], &kpgdir[PDX(KERNBASE)],
+8010b030:	83 ec 04             	sub    $0x4,%esp
+8010b033:	05 00 08 00 00       	add    $0x800,%eax
+8010b038:	68 00 08 00 00       	push   $0x800
+8010b03d:	50                   	push   %eax
+8010b03e:	8d 86 00 08 00 00    	lea    0x800(%esi),%eax
+8010b044:	50                   	push   %eax
+8010b045:	e8 06 c4 ff ff       	call   80107450 <memmove>
+    return pgdir;
+8010b04a:	83 c4 10             	add    $0x10,%esp
+}
+8010b04d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010b050:	89 f0                	mov    %esi,%eax
+8010b052:	5b                   	pop    %ebx
+8010b053:	5e                   	pop    %esi
+8010b054:	5d                   	pop    %ebp
+8010b055:	c3                   	ret
+8010b056:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b05d:	8d 76 00             	lea    0x0(%esi),%esi
+      freevm(pgdir);
+8010b060:	83 ec 0c             	sub    $0xc,%esp
+8010b063:	56                   	push   %esi
+8010b064:	e8 d7 fe ff ff       	call   8010af40 <freevm>
+      return 0;
+8010b069:	83 c4 10             	add    $0x10,%esp
+    return 0;
+8010b06c:	31 f6                	xor    %esi,%esi
+8010b06e:	eb af                	jmp    8010b01f <setupkvm+0x5f>
+
+8010b070 <kvmalloc>:
+{
+8010b070:	55                   	push   %ebp
+8010b071:	89 e5                	mov    %esp,%ebp
+8010b073:	83 ec 08             	sub    $0x8,%esp
+  kpgdir = setupkvm();
+8010b076:	e8 45 ff ff ff       	call   8010afc0 <setupkvm>
+8010b07b:	a3 7c 39 1c 80       	mov    %eax,0x801c397c
+  lcr3(V2P(kpgdir));   // switch to the kernel page table
+8010b080:	05 00 00 00 80       	add    $0x80000000,%eax
+8010b085:	0f 22 d8             	mov    %eax,%cr3
+}
+8010b088:	c9                   	leave
+8010b089:	c3                   	ret
+8010b08a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010b090 <clearpteu>:
+
+// Clear PTE_U on a page. Used to create an inaccessible
+// page beneath the user stack.
+void
+clearpteu(pde_t *pgdir, char *uva)
+{
+8010b090:	55                   	push   %ebp
+8010b091:	89 e5                	mov    %esp,%ebp
+8010b093:	83 ec 08             	sub    $0x8,%esp
+8010b096:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if(*pde & PTE_P){
+8010b099:	8b 55 08             	mov    0x8(%ebp),%edx
+  pde = &pgdir[PDX(va)];
+8010b09c:	89 c1                	mov    %eax,%ecx
+8010b09e:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010b0a1:	8b 14 8a             	mov    (%edx,%ecx,4),%edx
+8010b0a4:	f6 c2 01             	test   $0x1,%dl
+8010b0a7:	75 17                	jne    8010b0c0 <clearpteu+0x30>
+  pte_t *pte;
+
+  pte = walkpgdir(pgdir, uva, 0);
+  if(pte == 0)
+    panic("clearpteu");
+8010b0a9:	83 ec 0c             	sub    $0xc,%esp
+8010b0ac:	68 20 c0 10 80       	push   $0x8010c020
+8010b0b1:	e8 0a 64 ff ff       	call   801014c0 <panic>
+8010b0b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b0bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+8010b0c0:	c1 e8 0a             	shr    $0xa,%eax
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b0c3:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  return &pgtab[PTX(va)];
+8010b0c9:	25 fc 0f 00 00       	and    $0xffc,%eax
+8010b0ce:	8d 84 02 00 00 00 80 	lea    -0x80000000(%edx,%eax,1),%eax
+  if(pte == 0)
+8010b0d5:	85 c0                	test   %eax,%eax
+8010b0d7:	74 d0                	je     8010b0a9 <clearpteu+0x19>
+  *pte &= ~PTE_U;
+8010b0d9:	83 20 fb             	andl   $0xfffffffb,(%eax)
+}
+8010b0dc:	c9                   	leave
+8010b0dd:	c3                   	ret
+8010b0de:	66 90                	xchg   %ax,%ax
+
+8010b0e0 <copyuvm>:
+
+// Given a parent process's page table, create a copy
+// of it for a child.
+pde_t*
+copyuvm(pde_t *pgdir, uint sz)
+{
+8010b0e0:	55                   	push   %ebp
+8010b0e1:	89 e5                	mov    %esp,%ebp
+8010b0e3:	57                   	push   %edi
+8010b0e4:	56                   	push   %esi
+8010b0e5:	53                   	push   %ebx
+8010b0e6:	83 ec 1c             	sub    $0x1c,%esp
+  pde_t *d;
+  pte_t *pte;
+  uint pa, i, flags;
+  char *mem;
+
+  if((d = setupkvm()) == 0)
+8010b0e9:	e8 d2 fe ff ff       	call   8010afc0 <setupkvm>
+8010b0ee:	89 45 e0             	mov    %eax,-0x20(%ebp)
+8010b0f1:	85 c0                	test   %eax,%eax
+8010b0f3:	0f 84 e9 00 00 00    	je     8010b1e2 <copyuvm+0x102>
+    return 0;
+  for(i = 0; i < sz; i += PGSIZE){
+8010b0f9:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010b0fc:	85 d2                	test   %edx,%edx
+8010b0fe:	0f 84 b5 00 00 00    	je     8010b1b9 <copyuvm+0xd9>
+8010b104:	31 f6                	xor    %esi,%esi
+8010b106:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b10d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(*pde & PTE_P){
+8010b110:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  pde = &pgdir[PDX(va)];
+8010b113:	89 f0                	mov    %esi,%eax
+8010b115:	c1 e8 16             	shr    $0x16,%eax
+  if(*pde & PTE_P){
+8010b118:	8b 04 81             	mov    (%ecx,%eax,4),%eax
+8010b11b:	a8 01                	test   $0x1,%al
+8010b11d:	75 11                	jne    8010b130 <copyuvm+0x50>
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
+      panic("copyuvm: pte should exist");
+8010b11f:	83 ec 0c             	sub    $0xc,%esp
+8010b122:	68 2a c0 10 80       	push   $0x8010c02a
+8010b127:	e8 94 63 ff ff       	call   801014c0 <panic>
+8010b12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return &pgtab[PTX(va)];
+8010b130:	89 f2                	mov    %esi,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b132:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010b137:	c1 ea 0a             	shr    $0xa,%edx
+8010b13a:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+8010b140:	8d 84 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%eax
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
+8010b147:	85 c0                	test   %eax,%eax
+8010b149:	74 d4                	je     8010b11f <copyuvm+0x3f>
+    if(!(*pte & PTE_P))
+8010b14b:	8b 38                	mov    (%eax),%edi
+8010b14d:	f7 c7 01 00 00 00    	test   $0x1,%edi
+8010b153:	0f 84 9b 00 00 00    	je     8010b1f4 <copyuvm+0x114>
+      panic("copyuvm: page not present");
+    pa = PTE_ADDR(*pte);
+8010b159:	89 fb                	mov    %edi,%ebx
+    flags = PTE_FLAGS(*pte);
+8010b15b:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+8010b161:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    pa = PTE_ADDR(*pte);
+8010b164:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    if((mem = kalloc()) == 0)
+8010b16a:	e8 51 89 ff ff       	call   80103ac0 <kalloc>
+8010b16f:	89 c7                	mov    %eax,%edi
+8010b171:	85 c0                	test   %eax,%eax
+8010b173:	74 5f                	je     8010b1d4 <copyuvm+0xf4>
+      goto bad;
+    memmove(mem, (char*)P2V(pa), PGSIZE);
+8010b175:	83 ec 04             	sub    $0x4,%esp
+8010b178:	81 c3 00 00 00 80    	add    $0x80000000,%ebx
+8010b17e:	68 00 10 00 00       	push   $0x1000
+8010b183:	53                   	push   %ebx
+8010b184:	50                   	push   %eax
+8010b185:	e8 c6 c2 ff ff       	call   80107450 <memmove>
+    if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0) {
+8010b18a:	58                   	pop    %eax
+8010b18b:	8d 87 00 00 00 80    	lea    -0x80000000(%edi),%eax
+8010b191:	ff 75 e4             	push   -0x1c(%ebp)
+8010b194:	50                   	push   %eax
+8010b195:	68 00 10 00 00       	push   $0x1000
+8010b19a:	56                   	push   %esi
+8010b19b:	ff 75 e0             	push   -0x20(%ebp)
+8010b19e:	e8 6d f8 ff ff       	call   8010aa10 <mappages>
+8010b1a3:	83 c4 20             	add    $0x20,%esp
+8010b1a6:	85 c0                	test   %eax,%eax
+8010b1a8:	78 1e                	js     8010b1c8 <copyuvm+0xe8>
+  for(i = 0; i < sz; i += PGSIZE){
+8010b1aa:	81 c6 00 10 00 00    	add    $0x1000,%esi
+8010b1b0:	3b 75 0c             	cmp    0xc(%ebp),%esi
+8010b1b3:	0f 82 57 ff ff ff    	jb     8010b110 <copyuvm+0x30>
+  return d;
+
+bad:
+  freevm(d);
+  return 0;
+}
+8010b1b9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010b1bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b1bf:	5b                   	pop    %ebx
+8010b1c0:	5e                   	pop    %esi
+8010b1c1:	5f                   	pop    %edi
+8010b1c2:	5d                   	pop    %ebp
+8010b1c3:	c3                   	ret
+8010b1c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      kfree(mem);
+8010b1c8:	83 ec 0c             	sub    $0xc,%esp
+8010b1cb:	57                   	push   %edi
+8010b1cc:	e8 1f 87 ff ff       	call   801038f0 <kfree>
+      goto bad;
+8010b1d1:	83 c4 10             	add    $0x10,%esp
+  freevm(d);
+8010b1d4:	83 ec 0c             	sub    $0xc,%esp
+8010b1d7:	ff 75 e0             	push   -0x20(%ebp)
+8010b1da:	e8 61 fd ff ff       	call   8010af40 <freevm>
+  return 0;
+8010b1df:	83 c4 10             	add    $0x10,%esp
+    return 0;
+8010b1e2:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+}
+8010b1e9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010b1ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b1ef:	5b                   	pop    %ebx
+8010b1f0:	5e                   	pop    %esi
+8010b1f1:	5f                   	pop    %edi
+8010b1f2:	5d                   	pop    %ebp
+8010b1f3:	c3                   	ret
+      panic("copyuvm: page not present");
+8010b1f4:	83 ec 0c             	sub    $0xc,%esp
+8010b1f7:	68 44 c0 10 80       	push   $0x8010c044
+8010b1fc:	e8 bf 62 ff ff       	call   801014c0 <panic>
+8010b201:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b208:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b20f:	90                   	nop
+
+8010b210 <uva2ka>:
+
+//PAGEBREAK!
+// Map user virtual address to kernel address.
+char*
+uva2ka(pde_t *pgdir, char *uva)
+{
+8010b210:	55                   	push   %ebp
+8010b211:	89 e5                	mov    %esp,%ebp
+8010b213:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if(*pde & PTE_P){
+8010b216:	8b 55 08             	mov    0x8(%ebp),%edx
+  pde = &pgdir[PDX(va)];
+8010b219:	89 c1                	mov    %eax,%ecx
+8010b21b:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010b21e:	8b 14 8a             	mov    (%edx,%ecx,4),%edx
+8010b221:	f6 c2 01             	test   $0x1,%dl
+8010b224:	0f 84 c0 01 00 00    	je     8010b3ea <uva2ka.cold>
+  return &pgtab[PTX(va)];
+8010b22a:	c1 e8 0c             	shr    $0xc,%eax
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b22d:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  if((*pte & PTE_P) == 0)
+    return 0;
+  if((*pte & PTE_U) == 0)
+    return 0;
+  return (char*)P2V(PTE_ADDR(*pte));
+}
+8010b233:	5d                   	pop    %ebp
+  return &pgtab[PTX(va)];
+8010b234:	25 ff 03 00 00       	and    $0x3ff,%eax
+  if((*pte & PTE_P) == 0)
+8010b239:	8b 84 82 00 00 00 80 	mov    -0x80000000(%edx,%eax,4),%eax
+  if((*pte & PTE_U) == 0)
+8010b240:	89 c2                	mov    %eax,%edx
+  return (char*)P2V(PTE_ADDR(*pte));
+8010b242:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  if((*pte & PTE_U) == 0)
+8010b247:	83 e2 05             	and    $0x5,%edx
+  return (char*)P2V(PTE_ADDR(*pte));
+8010b24a:	05 00 00 00 80       	add    $0x80000000,%eax
+8010b24f:	83 fa 05             	cmp    $0x5,%edx
+8010b252:	ba 00 00 00 00       	mov    $0x0,%edx
+8010b257:	0f 45 c2             	cmovne %edx,%eax
+}
+8010b25a:	c3                   	ret
+8010b25b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010b25f:	90                   	nop
+
+8010b260 <copyout>:
+// Most useful when pgdir is not the current page table.
+// Only works for pages the user could write itself: PTE_U and
+// PTE_W, so not the read-only pages shared with the kernel.
+int
+copyout(pde_t *pgdir, uint va, void *p, uint len)
+{
+8010b260:	55                   	push   %ebp
+8010b261:	89 e5                	mov    %esp,%ebp
+8010b263:	57                   	push   %edi
+8010b264:	56                   	push   %esi
+8010b265:	53                   	push   %ebx
+8010b266:	83 ec 0c             	sub    $0xc,%esp
+8010b269:	8b 75 14             	mov    0x14(%ebp),%esi
+8010b26c:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010b26f:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *buf, *pa0;
+  uint n, va0;
+  pte_t *pte;
+
+  buf = (char*)p;
+  while(len > 0){
+8010b272:	85 f6                	test   %esi,%esi
+8010b274:	75 70                	jne    8010b2e6 <copyout+0x86>
+8010b276:	e9 95 00 00 00       	jmp    8010b310 <copyout+0xb0>
+8010b27b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010b27f:	90                   	nop
+  return &pgtab[PTX(va)];
+8010b280:	89 fb                	mov    %edi,%ebx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b282:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  return &pgtab[PTX(va)];
+8010b288:	c1 eb 0a             	shr    $0xa,%ebx
+8010b28b:	81 e3 fc 0f 00 00    	and    $0xffc,%ebx
+8010b291:	8d 8c 19 00 00 00 80 	lea    -0x80000000(%ecx,%ebx,1),%ecx
+    va0 = (uint)PGROUNDDOWN(va);
+    pte = walkpgdir(pgdir, (char*)va0, 0);
+    if(pte == 0 || (*pte & (PTE_P|PTE_U|PTE_W)) != (PTE_P|PTE_U|PTE_W))
+8010b298:	85 c9                	test   %ecx,%ecx
+8010b29a:	74 62                	je     8010b2fe <copyout+0x9e>
+8010b29c:	8b 09                	mov    (%ecx),%ecx
+8010b29e:	89 cb                	mov    %ecx,%ebx
+8010b2a0:	83 e3 07             	and    $0x7,%ebx
+8010b2a3:	83 fb 07             	cmp    $0x7,%ebx
+8010b2a6:	75 56                	jne    8010b2fe <copyout+0x9e>
+      return -1;
+    pa0 = (char*)P2V(PTE_ADDR(*pte));
+    n = PGSIZE - (va - va0);
+8010b2a8:	89 fb                	mov    %edi,%ebx
+8010b2aa:	29 c3                	sub    %eax,%ebx
+8010b2ac:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010b2b2:	39 f3                	cmp    %esi,%ebx
+8010b2b4:	0f 47 de             	cmova  %esi,%ebx
+    pa0 = (char*)P2V(PTE_ADDR(*pte));
+8010b2b7:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+    if(n > len)
+      n = len;
+    memmove(pa0 + (va - va0), buf, n);
+8010b2bd:	29 f8                	sub    %edi,%eax
+8010b2bf:	83 ec 04             	sub    $0x4,%esp
+8010b2c2:	8d 84 01 00 00 00 80 	lea    -0x80000000(%ecx,%eax,1),%eax
+8010b2c9:	53                   	push   %ebx
+8010b2ca:	52                   	push   %edx
+8010b2cb:	89 55 10             	mov    %edx,0x10(%ebp)
+8010b2ce:	50                   	push   %eax
+8010b2cf:	e8 7c c1 ff ff       	call   80107450 <memmove>
+    len -= n;
+    buf += n;
+8010b2d4:	8b 55 10             	mov    0x10(%ebp),%edx
+    va = va0 + PGSIZE;
+8010b2d7:	8d 87 00 10 00 00    	lea    0x1000(%edi),%eax
+  while(len > 0){
+8010b2dd:	83 c4 10             	add    $0x10,%esp
+    buf += n;
+8010b2e0:	01 da                	add    %ebx,%edx
+  while(len > 0){
+8010b2e2:	29 de                	sub    %ebx,%esi
+8010b2e4:	74 2a                	je     8010b310 <copyout+0xb0>
+  if(*pde & PTE_P){
+8010b2e6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pde = &pgdir[PDX(va)];
+8010b2e9:	89 c1                	mov    %eax,%ecx
+    va0 = (uint)PGROUNDDOWN(va);
+8010b2eb:	89 c7                	mov    %eax,%edi
+  pde = &pgdir[PDX(va)];
+8010b2ed:	c1 e9 16             	shr    $0x16,%ecx
+    va0 = (uint)PGROUNDDOWN(va);
+8010b2f0:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  if(*pde & PTE_P){
+8010b2f6:	8b 0c 8b             	mov    (%ebx,%ecx,4),%ecx
+8010b2f9:	f6 c1 01             	test   $0x1,%cl
+8010b2fc:	75 82                	jne    8010b280 <copyout+0x20>
+  }
+  return 0;
+}
+8010b2fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010b301:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010b306:	5b                   	pop    %ebx
+8010b307:	5e                   	pop    %esi
+8010b308:	5f                   	pop    %edi
+8010b309:	5d                   	pop    %ebp
+8010b30a:	c3                   	ret
+8010b30b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010b30f:	90                   	nop
+8010b310:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010b313:	31 c0                	xor    %eax,%eax
+}
+8010b315:	5b                   	pop    %ebx
+8010b316:	5e                   	pop    %esi
+8010b317:	5f                   	pop    %edi
+8010b318:	5d                   	pop    %ebp
+8010b319:	c3                   	ret
+8010b31a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010b320 <copyin>:
+
+// Copy len bytes to p from user address va in page table pgdir.
+// The counterpart of copyout, for pgdirs other than the current one.
+int
+copyin(pde_t *pgdir, void *p, uint va, uint len)
+{
+8010b320:	55                   	push   %ebp
+8010b321:	89 e5                	mov    %esp,%ebp
+8010b323:	57                   	push   %edi
+8010b324:	56                   	push   %esi
+8010b325:	53                   	push   %ebx
+8010b326:	83 ec 0c             	sub    $0xc,%esp
+8010b329:	8b 75 14             	mov    0x14(%ebp),%esi
+8010b32c:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010b32f:	8b 45 10             	mov    0x10(%ebp),%eax
+  char *buf, *pa0;
+  uint n, va0;
+
+  buf = (char*)p;
+  while(len > 0){
+8010b332:	85 f6                	test   %esi,%esi
+8010b334:	75 51                	jne    8010b387 <copyin+0x67>
+8010b336:	e9 a5 00 00 00       	jmp    8010b3e0 <copyin+0xc0>
+8010b33b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010b33f:	90                   	nop
+  return (char*)P2V(PTE_ADDR(*pte));
+8010b340:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+8010b346:	8d 8b 00 00 00 80    	lea    -0x80000000(%ebx),%ecx
+    va0 = (uint)PGROUNDDOWN(va);
+    pa0 = uva2ka(pgdir, (char*)va0);
+    if(pa0 == 0)
+8010b34c:	81 fb 00 00 00 80    	cmp    $0x80000000,%ebx
+8010b352:	74 75                	je     8010b3c9 <copyin+0xa9>
+      return -1;
+    n = PGSIZE - (va - va0);
+8010b354:	89 fb                	mov    %edi,%ebx
+8010b356:	29 c3                	sub    %eax,%ebx
+8010b358:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010b35e:	39 f3                	cmp    %esi,%ebx
+8010b360:	0f 47 de             	cmova  %esi,%ebx
+    if(n > len)
+      n = len;
+    memmove(buf, pa0 + (va - va0), n);
+8010b363:	29 f8                	sub    %edi,%eax
+8010b365:	83 ec 04             	sub    $0x4,%esp
+8010b368:	01 c1                	add    %eax,%ecx
+8010b36a:	53                   	push   %ebx
+8010b36b:	51                   	push   %ecx
+8010b36c:	52                   	push   %edx
+8010b36d:	89 55 0c             	mov    %edx,0xc(%ebp)
+8010b370:	e8 db c0 ff ff       	call   80107450 <memmove>
+    len -= n;
+    buf += n;
+8010b375:	8b 55 0c             	mov    0xc(%ebp),%edx
+    va = va0 + PGSIZE;
+8010b378:	8d 87 00 10 00 00    	lea    0x1000(%edi),%eax
+  while(len > 0){
+8010b37e:	83 c4 10             	add    $0x10,%esp
+    buf += n;
+8010b381:	01 da                	add    %ebx,%edx
+  while(len > 0){
+8010b383:	29 de                	sub    %ebx,%esi
+8010b385:	74 59                	je     8010b3e0 <copyin+0xc0>
+  if(*pde & PTE_P){
+8010b387:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pde = &pgdir[PDX(va)];
+8010b38a:	89 c1                	mov    %eax,%ecx
+    va0 = (uint)PGROUNDDOWN(va);
+8010b38c:	89 c7                	mov    %eax,%edi
+  pde = &pgdir[PDX(va)];
+8010b38e:	c1 e9 16             	shr    $0x16,%ecx
+    va0 = (uint)PGROUNDDOWN(va);
+8010b391:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  if(*pde & PTE_P){
+8010b397:	8b 0c 8b             	mov    (%ebx,%ecx,4),%ecx
+8010b39a:	f6 c1 01             	test   $0x1,%cl
+8010b39d:	0f 84 4e 00 00 00    	je     8010b3f1 <copyin.cold>
+  return &pgtab[PTX(va)];
+8010b3a3:	89 fb                	mov    %edi,%ebx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b3a5:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  return &pgtab[PTX(va)];
+8010b3ab:	c1 eb 0c             	shr    $0xc,%ebx
+8010b3ae:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  if((*pte & PTE_P) == 0)
+8010b3b4:	8b 9c 99 00 00 00 80 	mov    -0x80000000(%ecx,%ebx,4),%ebx
+  if((*pte & PTE_U) == 0)
+8010b3bb:	89 d9                	mov    %ebx,%ecx
+8010b3bd:	83 e1 05             	and    $0x5,%ecx
+8010b3c0:	83 f9 05             	cmp    $0x5,%ecx
+8010b3c3:	0f 84 77 ff ff ff    	je     8010b340 <copyin+0x20>
+  }
+  return 0;
+}
+8010b3c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010b3cc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010b3d1:	5b                   	pop    %ebx
+8010b3d2:	5e                   	pop    %esi
+8010b3d3:	5f                   	pop    %edi
+8010b3d4:	5d                   	pop    %ebp
+8010b3d5:	c3                   	ret
+8010b3d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b3dd:	8d 76 00             	lea    0x0(%esi),%esi
+8010b3e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010b3e3:	31 c0                	xor    %eax,%eax
+}
+8010b3e5:	5b                   	pop    %ebx
+8010b3e6:	5e                   	pop    %esi
+8010b3e7:	5f                   	pop    %edi
+8010b3e8:	5d                   	pop    %ebp
+8010b3e9:	c3                   	ret
+
+8010b3ea <uva2ka.cold>:
+  if((*pte & PTE_P) == 0)
+8010b3ea:	a1 00 00 00 00       	mov    0x0,%eax
+8010b3ef:	0f 0b                	ud2
+
+8010b3f1 <copyin.cold>:
+8010b3f1:	a1 00 00 00 00       	mov    0x0,%eax
+8010b3f6:	0f 0b                	ud2
+8010b3f8:	66 90                	xchg   %ax,%ax
+8010b3fa:	66 90                	xchg   %ax,%ax
+8010b3fc:	66 90                	xchg   %ax,%ax
+8010b3fe:	66 90                	xchg   %ax,%ax
+
+8010b400 <wqthread>:
+
+struct workqueue syswq;  // General-purpose queue, one thread
+
+static void
+wqthread(void *arg)
+{
+8010b400:	55                   	push   %ebp
+8010b401:	89 e5                	mov    %esp,%ebp
+8010b403:	56                   	push   %esi
+8010b404:	53                   	push   %ebx
+8010b405:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct workqueue *wq = arg;
+  struct work *w;
+
+  acquire(&wq->lock);
+8010b408:	83 ec 0c             	sub    $0xc,%esp
+8010b40b:	56                   	push   %esi
+8010b40c:	e8 5f bc ff ff       	call   80107070 <acquire>
+8010b411:	83 c4 10             	add    $0x10,%esp
+8010b414:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(;;){
+    while((w = wq->head) == 0)
+8010b418:	8b 5e 60             	mov    0x60(%esi),%ebx
+8010b41b:	85 db                	test   %ebx,%ebx
+8010b41d:	74 2e                	je     8010b44d <wqthread+0x4d>
+      sleep(wq, &wq->lock);
+    wq->head = w->next;
+8010b41f:	8b 43 0c             	mov    0xc(%ebx),%eax
+    w->pending = 0;
+    release(&wq->lock);
+8010b422:	83 ec 0c             	sub    $0xc,%esp
+    wq->head = w->next;
+8010b425:	89 46 60             	mov    %eax,0x60(%esi)
+    w->pending = 0;
+8010b428:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    release(&wq->lock);
+8010b42f:	56                   	push   %esi
+8010b430:	e8 cb ba ff ff       	call   80106f00 <release>
+    w->fn(w->arg);
+8010b435:	58                   	pop    %eax
+8010b436:	ff 73 04             	push   0x4(%ebx)
+8010b439:	ff 13                	call   *(%ebx)
+    acquire(&wq->lock);
+8010b43b:	89 34 24             	mov    %esi,(%esp)
+8010b43e:	e8 2d bc ff ff       	call   80107070 <acquire>
+    while((w = wq->head) == 0)
+8010b443:	8b 5e 60             	mov    0x60(%esi),%ebx
+8010b446:	83 c4 10             	add    $0x10,%esp
+8010b449:	85 db                	test   %ebx,%ebx
+8010b44b:	75 d2                	jne    8010b41f <wqthread+0x1f>
+      sleep(wq, &wq->lock);
+8010b44d:	83 ec 08             	sub    $0x8,%esp
+8010b450:	56                   	push   %esi
+8010b451:	56                   	push   %esi
+8010b452:	e8 e9 ab ff ff       	call   80106040 <sleep>
+8010b457:	83 c4 10             	add    $0x10,%esp
+8010b45a:	eb bc                	jmp    8010b418 <wqthread+0x18>
+8010b45c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+8010b460 <wqinit>:
+}
+
+// Set up wq, served by nthread kernel threads called name.
+void
+wqinit(struct workqueue *wq, char *name, int nthread)
+{
+8010b460:	55                   	push   %ebp
+8010b461:	89 e5                	mov    %esp,%ebp
+8010b463:	57                   	push   %edi
+8010b464:	56                   	push   %esi
+8010b465:	53                   	push   %ebx
+8010b466:	83 ec 14             	sub    $0x14,%esp
+8010b469:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010b46c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int i;
+
+  initlock(&wq->lock, name);
+8010b46f:	56                   	push   %esi
+8010b470:	53                   	push   %ebx
+8010b471:	e8 ea b4 ff ff       	call   80106960 <initlock>
+  wq->head = 0;
+  for(i = 0; i < nthread; i++)
+8010b476:	8b 45 10             	mov    0x10(%ebp),%eax
+  wq->head = 0;
+8010b479:	c7 43 60 00 00 00 00 	movl   $0x0,0x60(%ebx)
+  for(i = 0; i < nthread; i++)
+8010b480:	83 c4 10             	add    $0x10,%esp
+8010b483:	85 c0                	test   %eax,%eax
+8010b485:	7e 27                	jle    8010b4ae <wqinit+0x4e>
+8010b487:	31 ff                	xor    %edi,%edi
+8010b489:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(kthread_create(wqthread, wq, name) == 0)
+8010b490:	83 ec 04             	sub    $0x4,%esp
+8010b493:	56                   	push   %esi
+8010b494:	53                   	push   %ebx
+8010b495:	68 00 b4 10 80       	push   $0x8010b400
+8010b49a:	e8 61 a1 ff ff       	call   80105600 <kthread_create>
+8010b49f:	83 c4 10             	add    $0x10,%esp
+8010b4a2:	85 c0                	test   %eax,%eax
+8010b4a4:	74 10                	je     8010b4b6 <wqinit+0x56>
+  for(i = 0; i < nthread; i++)
+8010b4a6:	83 c7 01             	add    $0x1,%edi
+8010b4a9:	39 7d 10             	cmp    %edi,0x10(%ebp)
+8010b4ac:	75 e2                	jne    8010b490 <wqinit+0x30>
+      panic("wqinit");
+}
+8010b4ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b4b1:	5b                   	pop    %ebx
+8010b4b2:	5e                   	pop    %esi
+8010b4b3:	5f                   	pop    %edi
+8010b4b4:	5d                   	pop    %ebp
+8010b4b5:	c3                   	ret
+      panic("wqinit");
+8010b4b6:	83 ec 0c             	sub    $0xc,%esp
+8010b4b9:	68 83 c0 10 80       	push   $0x8010c083
+8010b4be:	e8 fd 5f ff ff       	call   801014c0 <panic>
+8010b4c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b4ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010b4d0 <queuework>:
+
+// Queue w on wq, unless it is already pending.
+// Safe to call from interrupt handlers.
+void
+queuework(struct workqueue *wq, struct work *w)
+{
+8010b4d0:	55                   	push   %ebp
+8010b4d1:	89 e5                	mov    %esp,%ebp
+8010b4d3:	56                   	push   %esi
+8010b4d4:	53                   	push   %ebx
+8010b4d5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010b4d8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  acquire(&wq->lock);
+8010b4db:	83 ec 0c             	sub    $0xc,%esp
+8010b4de:	53                   	push   %ebx
+8010b4df:	e8 8c bb ff ff       	call   80107070 <acquire>
+  if(!w->pending){
+8010b4e4:	8b 56 08             	mov    0x8(%esi),%edx
+8010b4e7:	83 c4 10             	add    $0x10,%esp
+8010b4ea:	85 d2                	test   %edx,%edx
+8010b4ec:	75 2a                	jne    8010b518 <queuework+0x48>
+    w->pending = 1;
+8010b4ee:	c7 46 08 01 00 00 00 	movl   $0x1,0x8(%esi)
+    w->next = 0;
+8010b4f5:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+    if(wq->head)
+8010b4fc:	8b 43 60             	mov    0x60(%ebx),%eax
+8010b4ff:	85 c0                	test   %eax,%eax
+8010b501:	74 2d                	je     8010b530 <queuework+0x60>
+      wq->tail->next = w;
+8010b503:	8b 43 64             	mov    0x64(%ebx),%eax
+8010b506:	89 70 0c             	mov    %esi,0xc(%eax)
+    else
+      wq->head = w;
+    wq->tail = w;
+    wakeup(wq);
+8010b509:	83 ec 0c             	sub    $0xc,%esp
+    wq->tail = w;
+8010b50c:	89 73 64             	mov    %esi,0x64(%ebx)
+    wakeup(wq);
+8010b50f:	53                   	push   %ebx
+8010b510:	e8 db ab ff ff       	call   801060f0 <wakeup>
+8010b515:	83 c4 10             	add    $0x10,%esp
+  }
+  release(&wq->lock);
+8010b518:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+8010b51b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010b51e:	5b                   	pop    %ebx
+8010b51f:	5e                   	pop    %esi
+8010b520:	5d                   	pop    %ebp
+  release(&wq->lock);
+8010b521:	e9 da b9 ff ff       	jmp    80106f00 <release>
+8010b526:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b52d:	8d 76 00             	lea    0x0(%esi),%esi
+      wq->head = w;
+8010b530:	89 73 60             	mov    %esi,0x60(%ebx)
+8010b533:	eb d4                	jmp    8010b509 <queuework+0x39>
+8010b535:	66 90                	xchg   %ax,%ax
+8010b537:	66 90                	xchg   %ax,%ax
+8010b539:	66 90                	xchg   %ax,%ax
+8010b53b:	66 90                	xchg   %ax,%ax
+8010b53d:	66 90                	xchg   %ax,%ax
+8010b53f:	90                   	nop
+
+8010b540 <ideinit>:
+static uchar *memdisk;
+
+void
+ideinit(void)
+{
+  memdisk = _binary_fs_img_start;
+8010b540:	c7 05 e8 39 1c 80 16 	movl   $0x8010f516,0x801c39e8
+8010b547:	f5 10 80 
+  disksize = (uint)_binary_fs_img_size/BSIZE;
+8010b54a:	b8 00 d0 07 00       	mov    $0x7d000,%eax
+8010b54f:	c1 e8 09             	shr    $0x9,%eax
+8010b552:	a3 ec 39 1c 80       	mov    %eax,0x801c39ec
+}
+8010b557:	c3                   	ret
+8010b558:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b55f:	90                   	nop
+
+8010b560 <ideintr>:
+// Interrupt handler.
+void
+ideintr(void)
+{
+  // no-op
+}
+8010b560:	c3                   	ret
+8010b561:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b568:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b56f:	90                   	nop
+
+8010b570 <iderw>:
+
+// Sync buf with disk, then call biodone(b).
+// If B_DIRTY is set, write buf to disk; else read it.
+void
+iderw(struct buf *b)
+{
+8010b570:	55                   	push   %ebp
+8010b571:	89 e5                	mov    %esp,%ebp
+8010b573:	53                   	push   %ebx
+8010b574:	83 ec 10             	sub    $0x10,%esp
+8010b577:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uchar *p;
+
+  if(!holdingsleep(&b->lock))
+8010b57a:	8d 43 0c             	lea    0xc(%ebx),%eax
+8010b57d:	50                   	push   %eax
+8010b57e:	e8 2d b3 ff ff       	call   801068b0 <holdingsleep>
+8010b583:	83 c4 10             	add    $0x10,%esp
+8010b586:	85 c0                	test   %eax,%eax
+8010b588:	0f 84 97 00 00 00    	je     8010b625 <iderw+0xb5>
+    panic("iderw: buf not locked");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+8010b58e:	8b 13                	mov    (%ebx),%edx
+8010b590:	89 d0                	mov    %edx,%eax
+8010b592:	83 e0 06             	and    $0x6,%eax
+8010b595:	83 f8 02             	cmp    $0x2,%eax
+8010b598:	74 7e                	je     8010b618 <iderw+0xa8>
+    panic("iderw: nothing to do");
+  if(b->dev != 1)
+8010b59a:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+8010b59e:	75 6b                	jne    8010b60b <iderw+0x9b>
+    panic("iderw: request not for disk 1");
+  if(b->blockno >= disksize)
+8010b5a0:	8b 43 08             	mov    0x8(%ebx),%eax
+8010b5a3:	3b 05 ec 39 1c 80    	cmp    0x801c39ec,%eax
+8010b5a9:	73 53                	jae    8010b5fe <iderw+0x8e>
+    panic("iderw: block out of range");
+
+  p = memdisk + b->blockno*BSIZE;
+8010b5ab:	c1 e0 09             	shl    $0x9,%eax
+8010b5ae:	03 05 e8 39 1c 80    	add    0x801c39e8,%eax
+
+  if(b->flags & B_DIRTY)
+8010b5b4:	83 e2 04             	and    $0x4,%edx
+    memmove(p, b->data, BSIZE);
+8010b5b7:	8d 8b a8 00 00 00    	lea    0xa8(%ebx),%ecx
+  if(b->flags & B_DIRTY)
+8010b5bd:	75 21                	jne    8010b5e0 <iderw+0x70>
+  else
+    memmove(b->data, p, BSIZE);
+8010b5bf:	83 ec 04             	sub    $0x4,%esp
+8010b5c2:	68 00 02 00 00       	push   $0x200
+8010b5c7:	50                   	push   %eax
+8010b5c8:	51                   	push   %ecx
+8010b5c9:	e8 82 be ff ff       	call   80107450 <memmove>
+  biodone(b);
+8010b5ce:	89 5d 08             	mov    %ebx,0x8(%ebp)
+    memmove(b->data, p, BSIZE);
+8010b5d1:	83 c4 10             	add    $0x10,%esp
+}
+8010b5d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010b5d7:	c9                   	leave
+  biodone(b);
+8010b5d8:	e9 13 56 ff ff       	jmp    80100bf0 <biodone>
+8010b5dd:	8d 76 00             	lea    0x0(%esi),%esi
+    memmove(p, b->data, BSIZE);
+8010b5e0:	83 ec 04             	sub    $0x4,%esp
+8010b5e3:	68 00 02 00 00       	push   $0x200
+8010b5e8:	51                   	push   %ecx
+8010b5e9:	50                   	push   %eax
+8010b5ea:	e8 61 be ff ff       	call   80107450 <memmove>
+  biodone(b);
+8010b5ef:	89 5d 08             	mov    %ebx,0x8(%ebp)
+8010b5f2:	83 c4 10             	add    $0x10,%esp
+}
+8010b5f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010b5f8:	c9                   	leave
+  biodone(b);
+8010b5f9:	e9 f2 55 ff ff       	jmp    80100bf0 <biodone>
+    panic("iderw: block out of range");
+8010b5fe:	83 ec 0c             	sub    $0xc,%esp
+8010b601:	68 d3 c0 10 80       	push   $0x8010c0d3
+8010b606:	e8 b5 5e ff ff       	call   801014c0 <panic>
+    panic("iderw: request not for disk 1");
+8010b60b:	83 ec 0c             	sub    $0xc,%esp
+8010b60e:	68 b5 c0 10 80       	push   $0x8010c0b5
+8010b613:	e8 a8 5e ff ff       	call   801014c0 <panic>
+    panic("iderw: nothing to do");
+8010b618:	83 ec 0c             	sub    $0xc,%esp
+8010b61b:	68 a0 c0 10 80       	push   $0x8010c0a0
+8010b620:	e8 9b 5e ff ff       	call   801014c0 <panic>
+    panic("iderw: buf not locked");
+8010b625:	83 ec 0c             	sub    $0xc,%esp
+8010b628:	68 8a c0 10 80       	push   $0x8010c08a
+8010b62d:	e8 8e 5e ff ff       	call   801014c0 <panic>
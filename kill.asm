@@ -0,0 +1,1543 @@
+
+_kill:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char **argv)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	bb 01 00 00 00       	mov    $0x1,%ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 31                	mov    (%ecx),%esi
+  1b:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+  1e:	83 fe 01             	cmp    $0x1,%esi
+  21:	7e 27                	jle    4a <main+0x4a>
+  23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  27:	90                   	nop
+    printf(2, "usage: kill pid...\n");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+    kill(atoi(argv[i]));
+  28:	83 ec 0c             	sub    $0xc,%esp
+  2b:	ff 34 9f             	push   (%edi,%ebx,4)
+  for(i=1; i<argc; i++)
+  2e:	83 c3 01             	add    $0x1,%ebx
+    kill(atoi(argv[i]));
+  31:	e8 fa 01 00 00       	call   230 <atoi>
+  36:	89 04 24             	mov    %eax,(%esp)
+  39:	e8 c9 03 00 00       	call   407 <kill>
+  for(i=1; i<argc; i++)
+  3e:	83 c4 10             	add    $0x10,%esp
+  41:	39 de                	cmp    %ebx,%esi
+  43:	75 e3                	jne    28 <main+0x28>
+  exit();
+  45:	e8 0f 03 00 00       	call   359 <exit>
+    printf(2, "usage: kill pid...\n");
+  4a:	50                   	push   %eax
+  4b:	50                   	push   %eax
+  4c:	68 18 0b 00 00       	push   $0xb18
+  51:	6a 02                	push   $0x2
+  53:	e8 98 07 00 00       	call   7f0 <printf>
+    exit();
+  58:	e8 fc 02 00 00       	call   359 <exit>
+  5d:	66 90                	xchg   %ax,%ax
+  5f:	90                   	nop
+
+00000060 <strcpy>:
+#include "date.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  60:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  61:	31 c0                	xor    %eax,%eax
+{
+  63:	89 e5                	mov    %esp,%ebp
+  65:	53                   	push   %ebx
+  66:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  69:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  70:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  74:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  77:	83 c0 01             	add    $0x1,%eax
+  7a:	84 d2                	test   %dl,%dl
+  7c:	75 f2                	jne    70 <strcpy+0x10>
+    ;
+  return os;
+}
+  7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  81:	89 c8                	mov    %ecx,%eax
+  83:	c9                   	leave
+  84:	c3                   	ret
+  85:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000090 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	53                   	push   %ebx
+  94:	8b 55 08             	mov    0x8(%ebp),%edx
+  97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  9a:	0f b6 02             	movzbl (%edx),%eax
+  9d:	84 c0                	test   %al,%al
+  9f:	75 17                	jne    b8 <strcmp+0x28>
+  a1:	eb 3a                	jmp    dd <strcmp+0x4d>
+  a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  a7:	90                   	nop
+  a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  ac:	83 c2 01             	add    $0x1,%edx
+  af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  b2:	84 c0                	test   %al,%al
+  b4:	74 1a                	je     d0 <strcmp+0x40>
+    p++, q++;
+  b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  b8:	0f b6 19             	movzbl (%ecx),%ebx
+  bb:	38 c3                	cmp    %al,%bl
+  bd:	74 e9                	je     a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  bf:	29 d8                	sub    %ebx,%eax
+}
+  c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  c4:	c9                   	leave
+  c5:	c3                   	ret
+  c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  d4:	31 c0                	xor    %eax,%eax
+  d6:	29 d8                	sub    %ebx,%eax
+}
+  d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  db:	c9                   	leave
+  dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  dd:	0f b6 19             	movzbl (%ecx),%ebx
+  e0:	31 c0                	xor    %eax,%eax
+  e2:	eb db                	jmp    bf <strcmp+0x2f>
+  e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ef:	90                   	nop
+
+000000f0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  f6:	80 3a 00             	cmpb   $0x0,(%edx)
+  f9:	74 15                	je     110 <strlen+0x20>
+  fb:	31 c0                	xor    %eax,%eax
+  fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 100:	83 c0 01             	add    $0x1,%eax
+ 103:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 107:	89 c1                	mov    %eax,%ecx
+ 109:	75 f5                	jne    100 <strlen+0x10>
+    ;
+  return n;
+}
+ 10b:	89 c8                	mov    %ecx,%eax
+ 10d:	5d                   	pop    %ebp
+ 10e:	c3                   	ret
+ 10f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 110:	31 c9                	xor    %ecx,%ecx
+}
+ 112:	5d                   	pop    %ebp
+ 113:	89 c8                	mov    %ecx,%eax
+ 115:	c3                   	ret
+ 116:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000120 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	57                   	push   %edi
+ 124:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 127:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 12a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 12d:	89 d7                	mov    %edx,%edi
+ 12f:	fc                   	cld
+ 130:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 132:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 135:	89 d0                	mov    %edx,%eax
+ 137:	c9                   	leave
+ 138:	c3                   	ret
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000140 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	8b 45 08             	mov    0x8(%ebp),%eax
+ 146:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 14a:	0f b6 10             	movzbl (%eax),%edx
+ 14d:	84 d2                	test   %dl,%dl
+ 14f:	75 12                	jne    163 <strchr+0x23>
+ 151:	eb 1d                	jmp    170 <strchr+0x30>
+ 153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 157:	90                   	nop
+ 158:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 15c:	83 c0 01             	add    $0x1,%eax
+ 15f:	84 d2                	test   %dl,%dl
+ 161:	74 0d                	je     170 <strchr+0x30>
+    if(*s == c)
+ 163:	38 d1                	cmp    %dl,%cl
+ 165:	75 f1                	jne    158 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 167:	5d                   	pop    %ebp
+ 168:	c3                   	ret
+ 169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 170:	31 c0                	xor    %eax,%eax
+}
+ 172:	5d                   	pop    %ebp
+ 173:	c3                   	ret
+ 174:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 17f:	90                   	nop
+
+00000180 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	57                   	push   %edi
+ 184:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 185:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 188:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 189:	31 db                	xor    %ebx,%ebx
+{
+ 18b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 18e:	eb 27                	jmp    1b7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 190:	83 ec 04             	sub    $0x4,%esp
+ 193:	6a 01                	push   $0x1
+ 195:	56                   	push   %esi
+ 196:	6a 00                	push   $0x0
+ 198:	e8 13 02 00 00       	call   3b0 <read>
+    if(cc < 1)
+ 19d:	83 c4 10             	add    $0x10,%esp
+ 1a0:	85 c0                	test   %eax,%eax
+ 1a2:	7e 1d                	jle    1c1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1ab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1af:	3c 0a                	cmp    $0xa,%al
+ 1b1:	74 10                	je     1c3 <gets+0x43>
+ 1b3:	3c 0d                	cmp    $0xd,%al
+ 1b5:	74 0c                	je     1c3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1b7:	89 df                	mov    %ebx,%edi
+ 1b9:	83 c3 01             	add    $0x1,%ebx
+ 1bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1bf:	7c cf                	jl     190 <gets+0x10>
+ 1c1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1cd:	5b                   	pop    %ebx
+ 1ce:	5e                   	pop    %esi
+ 1cf:	5f                   	pop    %edi
+ 1d0:	5d                   	pop    %ebp
+ 1d1:	c3                   	ret
+ 1d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001e0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	56                   	push   %esi
+ 1e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1e5:	83 ec 08             	sub    $0x8,%esp
+ 1e8:	6a 00                	push   $0x0
+ 1ea:	ff 75 08             	push   0x8(%ebp)
+ 1ed:	e8 4f 02 00 00       	call   441 <open>
+  if(fd < 0)
+ 1f2:	83 c4 10             	add    $0x10,%esp
+ 1f5:	85 c0                	test   %eax,%eax
+ 1f7:	78 27                	js     220 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1f9:	83 ec 08             	sub    $0x8,%esp
+ 1fc:	ff 75 0c             	push   0xc(%ebp)
+ 1ff:	89 c3                	mov    %eax,%ebx
+ 201:	50                   	push   %eax
+ 202:	e8 91 02 00 00       	call   498 <fstat>
+  close(fd);
+ 207:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 20a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 20c:	e8 d9 01 00 00       	call   3ea <close>
+  return r;
+ 211:	83 c4 10             	add    $0x10,%esp
+}
+ 214:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 217:	89 f0                	mov    %esi,%eax
+ 219:	5b                   	pop    %ebx
+ 21a:	5e                   	pop    %esi
+ 21b:	5d                   	pop    %ebp
+ 21c:	c3                   	ret
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 220:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 225:	eb ed                	jmp    214 <stat+0x34>
+ 227:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22e:	66 90                	xchg   %ax,%ax
+
+00000230 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	53                   	push   %ebx
+ 234:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 237:	0f be 02             	movsbl (%edx),%eax
+ 23a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 23d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 240:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 245:	77 1e                	ja     265 <atoi+0x35>
+ 247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 250:	83 c2 01             	add    $0x1,%edx
+ 253:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 256:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 25a:	0f be 02             	movsbl (%edx),%eax
+ 25d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 260:	80 fb 09             	cmp    $0x9,%bl
+ 263:	76 eb                	jbe    250 <atoi+0x20>
+  return n;
+}
+ 265:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 268:	89 c8                	mov    %ecx,%eax
+ 26a:	c9                   	leave
+ 26b:	c3                   	ret
+ 26c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000270 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	57                   	push   %edi
+ 274:	56                   	push   %esi
+ 275:	8b 45 10             	mov    0x10(%ebp),%eax
+ 278:	8b 55 08             	mov    0x8(%ebp),%edx
+ 27b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 27e:	85 c0                	test   %eax,%eax
+ 280:	7e 13                	jle    295 <memmove+0x25>
+ 282:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 284:	89 d7                	mov    %edx,%edi
+ 286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 290:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 291:	39 f8                	cmp    %edi,%eax
+ 293:	75 fb                	jne    290 <memmove+0x20>
+  return vdst;
+}
+ 295:	5e                   	pop    %esi
+ 296:	89 d0                	mov    %edx,%eax
+ 298:	5f                   	pop    %edi
+ 299:	5d                   	pop    %ebp
+ 29a:	c3                   	ret
+ 29b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 29f:	90                   	nop
+
+000002a0 <ugetpid>:
+// getpid() without a system call, from the page at UPROC.
+int
+ugetpid(void)
+{
+  return ((struct uproc*)UPROC)->pid;
+}
+ 2a0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+ 2a5:	c3                   	ret
+ 2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002b0 <uclocktime>:
+
+// clocktime() without a system call, from the page at UCLOCK.
+int
+uclocktime(struct timespec *ts)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	57                   	push   %edi
+ 2b4:	56                   	push   %esi
+ 2b5:	53                   	push   %ebx
+ 2b6:	83 ec 1c             	sub    $0x1c,%esp
+  struct uclock *c = (struct uclock*)UCLOCK;
+
+  if(c->tscmult == 0)
+ 2b9:	8b 0d 08 f0 ff 7f    	mov    0x7ffff008,%ecx
+{
+ 2bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(c->tscmult == 0)
+ 2c2:	85 c9                	test   %ecx,%ecx
+ 2c4:	74 6a                	je     330 <uclocktime+0x80>
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+ 2c6:	0f 31                	rdtsc
+static inline void
+uclockread(struct uclock *c, uint64 tsc, struct timespec *ts)
+{
+  uint64 d, ns;
+
+  d = tsc - c->tscbase;
+ 2c8:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 2ce:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+ 2d4:	89 c6                	mov    %eax,%esi
+  if((long long)d < 0)  // another CPU's TSC is a little behind
+ 2d6:	85 d2                	test   %edx,%edx
+ 2d8:	78 46                	js     320 <uclocktime+0x70>
+    d = 0;
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 2da:	89 d0                	mov    %edx,%eax
+ 2dc:	f7 e1                	mul    %ecx
+ 2de:	0f a4 c2 08          	shld   $0x8,%eax,%edx
+ 2e2:	c1 e0 08             	shl    $0x8,%eax
+ 2e5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+ 2e8:	89 f0                	mov    %esi,%eax
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 2ea:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+ 2ed:	f7 e1                	mul    %ecx
+ 2ef:	0f ac d0 18          	shrd   $0x18,%edx,%eax
+ 2f3:	c1 ea 18             	shr    $0x18,%edx
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 2f6:	03 45 e0             	add    -0x20(%ebp),%eax
+ 2f9:	13 55 e4             	adc    -0x1c(%ebp),%edx
+// linked with libgcc, so it cannot use 64-bit '/' or '%'.
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+  asm("divl %4" : "=a" (q), "=d" (r) : "a" ((uint)n), "d" ((uint)(n>>32)), "rm" (d));
+ 2fc:	89 c7                	mov    %eax,%edi
+ 2fe:	89 f8                	mov    %edi,%eax
+ 300:	b9 00 ca 9a 3b       	mov    $0x3b9aca00,%ecx
+ 305:	f7 f1                	div    %ecx
+  ts->sec = divl(ns, 1000000000, &ts->nsec);
+ 307:	89 03                	mov    %eax,(%ebx)
+    return clocktime(ts);
+  uclockread(c, rdtsc(), ts);
+  return 0;
+}
+ 309:	31 c0                	xor    %eax,%eax
+  *rem = r;
+ 30b:	89 53 04             	mov    %edx,0x4(%ebx)
+ 30e:	83 c4 1c             	add    $0x1c,%esp
+ 311:	5b                   	pop    %ebx
+ 312:	5e                   	pop    %esi
+ 313:	5f                   	pop    %edi
+ 314:	5d                   	pop    %ebp
+ 315:	c3                   	ret
+ 316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+ 320:	31 d2                	xor    %edx,%edx
+ 322:	31 ff                	xor    %edi,%edi
+ 324:	eb d8                	jmp    2fe <uclocktime+0x4e>
+ 326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+ 330:	83 c4 1c             	add    $0x1c,%esp
+ 333:	5b                   	pop    %ebx
+ 334:	5e                   	pop    %esi
+ 335:	5f                   	pop    %edi
+ 336:	5d                   	pop    %ebp
+    return clocktime(ts);
+ 337:	e9 f2 02 00 00       	jmp    62e <clocktime>
+
+0000033c <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+ 33c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 341:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 348:	00 00 00 
+ 34b:	74 09                	je     356 <fork+0x1a>
+ 34d:	89 e1                	mov    %esp,%ecx
+ 34f:	ba 58 03 00 00       	mov    $0x358,%edx
+ 354:	0f 34                	sysenter
+ 356:	cd 40                	int    $0x40
+ 358:	c3                   	ret
+
+00000359 <exit>:
+SYSCALL(exit)
+ 359:	b8 02 00 00 00       	mov    $0x2,%eax
+ 35e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 365:	00 00 00 
+ 368:	74 09                	je     373 <exit+0x1a>
+ 36a:	89 e1                	mov    %esp,%ecx
+ 36c:	ba 75 03 00 00       	mov    $0x375,%edx
+ 371:	0f 34                	sysenter
+ 373:	cd 40                	int    $0x40
+ 375:	c3                   	ret
+
+00000376 <wait>:
+SYSCALL(wait)
+ 376:	b8 03 00 00 00       	mov    $0x3,%eax
+ 37b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 382:	00 00 00 
+ 385:	74 09                	je     390 <wait+0x1a>
+ 387:	89 e1                	mov    %esp,%ecx
+ 389:	ba 92 03 00 00       	mov    $0x392,%edx
+ 38e:	0f 34                	sysenter
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <pipe>:
+SYSCALL(pipe)
+ 393:	b8 04 00 00 00       	mov    $0x4,%eax
+ 398:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 39f:	00 00 00 
+ 3a2:	74 09                	je     3ad <pipe+0x1a>
+ 3a4:	89 e1                	mov    %esp,%ecx
+ 3a6:	ba af 03 00 00       	mov    $0x3af,%edx
+ 3ab:	0f 34                	sysenter
+ 3ad:	cd 40                	int    $0x40
+ 3af:	c3                   	ret
+
+000003b0 <read>:
+SYSCALL(read)
+ 3b0:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3b5:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 3bc:	00 00 00 
+ 3bf:	74 09                	je     3ca <read+0x1a>
+ 3c1:	89 e1                	mov    %esp,%ecx
+ 3c3:	ba cc 03 00 00       	mov    $0x3cc,%edx
+ 3c8:	0f 34                	sysenter
+ 3ca:	cd 40                	int    $0x40
+ 3cc:	c3                   	ret
+
+000003cd <write>:
+SYSCALL(write)
+ 3cd:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3d2:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 3d9:	00 00 00 
+ 3dc:	74 09                	je     3e7 <write+0x1a>
+ 3de:	89 e1                	mov    %esp,%ecx
+ 3e0:	ba e9 03 00 00       	mov    $0x3e9,%edx
+ 3e5:	0f 34                	sysenter
+ 3e7:	cd 40                	int    $0x40
+ 3e9:	c3                   	ret
+
+000003ea <close>:
+SYSCALL(close)
+ 3ea:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3ef:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 3f6:	00 00 00 
+ 3f9:	74 09                	je     404 <close+0x1a>
+ 3fb:	89 e1                	mov    %esp,%ecx
+ 3fd:	ba 06 04 00 00       	mov    $0x406,%edx
+ 402:	0f 34                	sysenter
+ 404:	cd 40                	int    $0x40
+ 406:	c3                   	ret
+
+00000407 <kill>:
+SYSCALL(kill)
+ 407:	b8 06 00 00 00       	mov    $0x6,%eax
+ 40c:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 413:	00 00 00 
+ 416:	74 09                	je     421 <kill+0x1a>
+ 418:	89 e1                	mov    %esp,%ecx
+ 41a:	ba 23 04 00 00       	mov    $0x423,%edx
+ 41f:	0f 34                	sysenter
+ 421:	cd 40                	int    $0x40
+ 423:	c3                   	ret
+
+00000424 <exec>:
+SYSCALL(exec)
+ 424:	b8 07 00 00 00       	mov    $0x7,%eax
+ 429:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 430:	00 00 00 
+ 433:	74 09                	je     43e <exec+0x1a>
+ 435:	89 e1                	mov    %esp,%ecx
+ 437:	ba 40 04 00 00       	mov    $0x440,%edx
+ 43c:	0f 34                	sysenter
+ 43e:	cd 40                	int    $0x40
+ 440:	c3                   	ret
+
+00000441 <open>:
+SYSCALL(open)
+ 441:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 446:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 44d:	00 00 00 
+ 450:	74 09                	je     45b <open+0x1a>
+ 452:	89 e1                	mov    %esp,%ecx
+ 454:	ba 5d 04 00 00       	mov    $0x45d,%edx
+ 459:	0f 34                	sysenter
+ 45b:	cd 40                	int    $0x40
+ 45d:	c3                   	ret
+
+0000045e <mknod>:
+SYSCALL(mknod)
+ 45e:	b8 11 00 00 00       	mov    $0x11,%eax
+ 463:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 46a:	00 00 00 
+ 46d:	74 09                	je     478 <mknod+0x1a>
+ 46f:	89 e1                	mov    %esp,%ecx
+ 471:	ba 7a 04 00 00       	mov    $0x47a,%edx
+ 476:	0f 34                	sysenter
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <unlink>:
+SYSCALL(unlink)
+ 47b:	b8 12 00 00 00       	mov    $0x12,%eax
+ 480:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 487:	00 00 00 
+ 48a:	74 09                	je     495 <unlink+0x1a>
+ 48c:	89 e1                	mov    %esp,%ecx
+ 48e:	ba 97 04 00 00       	mov    $0x497,%edx
+ 493:	0f 34                	sysenter
+ 495:	cd 40                	int    $0x40
+ 497:	c3                   	ret
+
+00000498 <fstat>:
+SYSCALL(fstat)
+ 498:	b8 08 00 00 00       	mov    $0x8,%eax
+ 49d:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4a4:	00 00 00 
+ 4a7:	74 09                	je     4b2 <fstat+0x1a>
+ 4a9:	89 e1                	mov    %esp,%ecx
+ 4ab:	ba b4 04 00 00       	mov    $0x4b4,%edx
+ 4b0:	0f 34                	sysenter
+ 4b2:	cd 40                	int    $0x40
+ 4b4:	c3                   	ret
+
+000004b5 <link>:
+SYSCALL(link)
+ 4b5:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4ba:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4c1:	00 00 00 
+ 4c4:	74 09                	je     4cf <link+0x1a>
+ 4c6:	89 e1                	mov    %esp,%ecx
+ 4c8:	ba d1 04 00 00       	mov    $0x4d1,%edx
+ 4cd:	0f 34                	sysenter
+ 4cf:	cd 40                	int    $0x40
+ 4d1:	c3                   	ret
+
+000004d2 <mkdir>:
+SYSCALL(mkdir)
+ 4d2:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4d7:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4de:	00 00 00 
+ 4e1:	74 09                	je     4ec <mkdir+0x1a>
+ 4e3:	89 e1                	mov    %esp,%ecx
+ 4e5:	ba ee 04 00 00       	mov    $0x4ee,%edx
+ 4ea:	0f 34                	sysenter
+ 4ec:	cd 40                	int    $0x40
+ 4ee:	c3                   	ret
+
+000004ef <chdir>:
+SYSCALL(chdir)
+ 4ef:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4f4:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4fb:	00 00 00 
+ 4fe:	74 09                	je     509 <chdir+0x1a>
+ 500:	89 e1                	mov    %esp,%ecx
+ 502:	ba 0b 05 00 00       	mov    $0x50b,%edx
+ 507:	0f 34                	sysenter
+ 509:	cd 40                	int    $0x40
+ 50b:	c3                   	ret
+
+0000050c <dup>:
+SYSCALL(dup)
+ 50c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 511:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 518:	00 00 00 
+ 51b:	74 09                	je     526 <dup+0x1a>
+ 51d:	89 e1                	mov    %esp,%ecx
+ 51f:	ba 28 05 00 00       	mov    $0x528,%edx
+ 524:	0f 34                	sysenter
+ 526:	cd 40                	int    $0x40
+ 528:	c3                   	ret
+
+00000529 <getpid>:
+SYSCALL(getpid)
+ 529:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 52e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 535:	00 00 00 
+ 538:	74 09                	je     543 <getpid+0x1a>
+ 53a:	89 e1                	mov    %esp,%ecx
+ 53c:	ba 45 05 00 00       	mov    $0x545,%edx
+ 541:	0f 34                	sysenter
+ 543:	cd 40                	int    $0x40
+ 545:	c3                   	ret
+
+00000546 <sbrk>:
+SYSCALL(sbrk)
+ 546:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 54b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 552:	00 00 00 
+ 555:	74 09                	je     560 <sbrk+0x1a>
+ 557:	89 e1                	mov    %esp,%ecx
+ 559:	ba 62 05 00 00       	mov    $0x562,%edx
+ 55e:	0f 34                	sysenter
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <sleep>:
+SYSCALL(sleep)
+ 563:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 568:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 56f:	00 00 00 
+ 572:	74 09                	je     57d <sleep+0x1a>
+ 574:	89 e1                	mov    %esp,%ecx
+ 576:	ba 7f 05 00 00       	mov    $0x57f,%edx
+ 57b:	0f 34                	sysenter
+ 57d:	cd 40                	int    $0x40
+ 57f:	c3                   	ret
+
+00000580 <uptime>:
+SYSCALL(uptime)
+ 580:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 585:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 58c:	00 00 00 
+ 58f:	74 09                	je     59a <uptime+0x1a>
+ 591:	89 e1                	mov    %esp,%ecx
+ 593:	ba 9c 05 00 00       	mov    $0x59c,%edx
+ 598:	0f 34                	sysenter
+ 59a:	cd 40                	int    $0x40
+ 59c:	c3                   	ret
+
+0000059d <swapread>:
+SYSCALL(swapread)
+ 59d:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5a2:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5a9:	00 00 00 
+ 5ac:	74 09                	je     5b7 <swapread+0x1a>
+ 5ae:	89 e1                	mov    %esp,%ecx
+ 5b0:	ba b9 05 00 00       	mov    $0x5b9,%edx
+ 5b5:	0f 34                	sysenter
+ 5b7:	cd 40                	int    $0x40
+ 5b9:	c3                   	ret
+
+000005ba <swapwrite>:
+SYSCALL(swapwrite)
+ 5ba:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5bf:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5c6:	00 00 00 
+ 5c9:	74 09                	je     5d4 <swapwrite+0x1a>
+ 5cb:	89 e1                	mov    %esp,%ecx
+ 5cd:	ba d6 05 00 00       	mov    $0x5d6,%edx
+ 5d2:	0f 34                	sysenter
+ 5d4:	cd 40                	int    $0x40
+ 5d6:	c3                   	ret
+
+000005d7 <setaffinity>:
+SYSCALL(setaffinity)
+ 5d7:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5dc:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5e3:	00 00 00 
+ 5e6:	74 09                	je     5f1 <setaffinity+0x1a>
+ 5e8:	89 e1                	mov    %esp,%ecx
+ 5ea:	ba f3 05 00 00       	mov    $0x5f3,%edx
+ 5ef:	0f 34                	sysenter
+ 5f1:	cd 40                	int    $0x40
+ 5f3:	c3                   	ret
+
+000005f4 <getaffinity>:
+SYSCALL(getaffinity)
+ 5f4:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5f9:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 600:	00 00 00 
+ 603:	74 09                	je     60e <getaffinity+0x1a>
+ 605:	89 e1                	mov    %esp,%ecx
+ 607:	ba 10 06 00 00       	mov    $0x610,%edx
+ 60c:	0f 34                	sysenter
+ 60e:	cd 40                	int    $0x40
+ 610:	c3                   	ret
+
+00000611 <nanosleep>:
+SYSCALL(nanosleep)
+ 611:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 616:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 61d:	00 00 00 
+ 620:	74 09                	je     62b <nanosleep+0x1a>
+ 622:	89 e1                	mov    %esp,%ecx
+ 624:	ba 2d 06 00 00       	mov    $0x62d,%edx
+ 629:	0f 34                	sysenter
+ 62b:	cd 40                	int    $0x40
+ 62d:	c3                   	ret
+
+0000062e <clocktime>:
+SYSCALL(clocktime)
+ 62e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 633:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 63a:	00 00 00 
+ 63d:	74 09                	je     648 <clocktime+0x1a>
+ 63f:	89 e1                	mov    %esp,%ecx
+ 641:	ba 4a 06 00 00       	mov    $0x64a,%edx
+ 646:	0f 34                	sysenter
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <batch>:
+SYSCALL(batch)
+ 64b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 650:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 657:	00 00 00 
+ 65a:	74 09                	je     665 <batch+0x1a>
+ 65c:	89 e1                	mov    %esp,%ecx
+ 65e:	ba 67 06 00 00       	mov    $0x667,%edx
+ 663:	0f 34                	sysenter
+ 665:	cd 40                	int    $0x40
+ 667:	c3                   	ret
+
+00000668 <aiosetup>:
+SYSCALL(aiosetup)
+ 668:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 66d:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 674:	00 00 00 
+ 677:	74 09                	je     682 <aiosetup+0x1a>
+ 679:	89 e1                	mov    %esp,%ecx
+ 67b:	ba 84 06 00 00       	mov    $0x684,%edx
+ 680:	0f 34                	sysenter
+ 682:	cd 40                	int    $0x40
+ 684:	c3                   	ret
+
+00000685 <aiowait>:
+SYSCALL(aiowait)
+ 685:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 68a:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 691:	00 00 00 
+ 694:	74 09                	je     69f <aiowait+0x1a>
+ 696:	89 e1                	mov    %esp,%ecx
+ 698:	ba a1 06 00 00       	mov    $0x6a1,%edx
+ 69d:	0f 34                	sysenter
+ 69f:	cd 40                	int    $0x40
+ 6a1:	c3                   	ret
+
+000006a2 <spawn>:
+SYSCALL(spawn)
+ 6a2:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6a7:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6ae:	00 00 00 
+ 6b1:	74 09                	je     6bc <spawn+0x1a>
+ 6b3:	89 e1                	mov    %esp,%ecx
+ 6b5:	ba be 06 00 00       	mov    $0x6be,%edx
+ 6ba:	0f 34                	sysenter
+ 6bc:	cd 40                	int    $0x40
+ 6be:	c3                   	ret
+
+000006bf <getprocinfo>:
+SYSCALL(getprocinfo)
+ 6bf:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6c4:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6cb:	00 00 00 
+ 6ce:	74 09                	je     6d9 <getprocinfo+0x1a>
+ 6d0:	89 e1                	mov    %esp,%ecx
+ 6d2:	ba db 06 00 00       	mov    $0x6db,%edx
+ 6d7:	0f 34                	sysenter
+ 6d9:	cd 40                	int    $0x40
+ 6db:	c3                   	ret
+
+000006dc <getlockstat>:
+SYSCALL(getlockstat)
+ 6dc:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6e1:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6e8:	00 00 00 
+ 6eb:	74 09                	je     6f6 <getlockstat+0x1a>
+ 6ed:	89 e1                	mov    %esp,%ecx
+ 6ef:	ba f8 06 00 00       	mov    $0x6f8,%edx
+ 6f4:	0f 34                	sysenter
+ 6f6:	cd 40                	int    $0x40
+ 6f8:	c3                   	ret
+
+000006f9 <lockprof>:
+SYSCALL(lockprof)
+ 6f9:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6fe:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 705:	00 00 00 
+ 708:	74 09                	je     713 <lockprof+0x1a>
+ 70a:	89 e1                	mov    %esp,%ecx
+ 70c:	ba 15 07 00 00       	mov    $0x715,%edx
+ 711:	0f 34                	sysenter
+ 713:	cd 40                	int    $0x40
+ 715:	c3                   	ret
+
+00000716 <getlockprof>:
+SYSCALL(getlockprof)
+ 716:	b8 23 00 00 00       	mov    $0x23,%eax
+ 71b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 722:	00 00 00 
+ 725:	74 09                	je     730 <getlockprof+0x1a>
+ 727:	89 e1                	mov    %esp,%ecx
+ 729:	ba 32 07 00 00       	mov    $0x732,%edx
+ 72e:	0f 34                	sysenter
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <diskstat>:
+SYSCALL(diskstat)
+ 733:	b8 24 00 00 00       	mov    $0x24,%eax
+ 738:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 73f:	00 00 00 
+ 742:	74 09                	je     74d <diskstat+0x1a>
+ 744:	89 e1                	mov    %esp,%ecx
+ 746:	ba 4f 07 00 00       	mov    $0x74f,%edx
+ 74b:	0f 34                	sysenter
+ 74d:	cd 40                	int    $0x40
+ 74f:	c3                   	ret
+
+00000750 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 750:	55                   	push   %ebp
+ 751:	89 e5                	mov    %esp,%ebp
+ 753:	57                   	push   %edi
+ 754:	56                   	push   %esi
+ 755:	53                   	push   %ebx
+ 756:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 758:	89 d1                	mov    %edx,%ecx
+{
+ 75a:	83 ec 3c             	sub    $0x3c,%esp
+ 75d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 760:	85 d2                	test   %edx,%edx
+ 762:	0f 89 80 00 00 00    	jns    7e8 <printint+0x98>
+ 768:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 76c:	74 7a                	je     7e8 <printint+0x98>
+    x = -xx;
+ 76e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 770:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 775:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 778:	31 f6                	xor    %esi,%esi
+ 77a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 780:	89 c8                	mov    %ecx,%eax
+ 782:	31 d2                	xor    %edx,%edx
+ 784:	89 f7                	mov    %esi,%edi
+ 786:	f7 f3                	div    %ebx
+ 788:	8d 76 01             	lea    0x1(%esi),%esi
+ 78b:	0f b6 92 8c 0b 00 00 	movzbl 0xb8c(%edx),%edx
+ 792:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 796:	89 ca                	mov    %ecx,%edx
+ 798:	89 c1                	mov    %eax,%ecx
+ 79a:	39 da                	cmp    %ebx,%edx
+ 79c:	73 e2                	jae    780 <printint+0x30>
+  if(neg)
+ 79e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 7a1:	85 c0                	test   %eax,%eax
+ 7a3:	74 07                	je     7ac <printint+0x5c>
+    buf[i++] = '-';
+ 7a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 7aa:	89 f7                	mov    %esi,%edi
+ 7ac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 7af:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 7b2:	01 df                	add    %ebx,%edi
+ 7b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 7b8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 7bb:	83 ec 04             	sub    $0x4,%esp
+ 7be:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 7c1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 7c4:	6a 01                	push   $0x1
+ 7c6:	50                   	push   %eax
+ 7c7:	56                   	push   %esi
+ 7c8:	e8 00 fc ff ff       	call   3cd <write>
+  while(--i >= 0)
+ 7cd:	89 f8                	mov    %edi,%eax
+ 7cf:	83 c4 10             	add    $0x10,%esp
+ 7d2:	83 ef 01             	sub    $0x1,%edi
+ 7d5:	39 d8                	cmp    %ebx,%eax
+ 7d7:	75 df                	jne    7b8 <printint+0x68>
+}
+ 7d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7dc:	5b                   	pop    %ebx
+ 7dd:	5e                   	pop    %esi
+ 7de:	5f                   	pop    %edi
+ 7df:	5d                   	pop    %ebp
+ 7e0:	c3                   	ret
+ 7e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 7e8:	31 c0                	xor    %eax,%eax
+ 7ea:	eb 89                	jmp    775 <printint+0x25>
+ 7ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007f0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 7f0:	55                   	push   %ebp
+ 7f1:	89 e5                	mov    %esp,%ebp
+ 7f3:	57                   	push   %edi
+ 7f4:	56                   	push   %esi
+ 7f5:	53                   	push   %ebx
+ 7f6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 7fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 7ff:	0f b6 1e             	movzbl (%esi),%ebx
+ 802:	83 c6 01             	add    $0x1,%esi
+ 805:	84 db                	test   %bl,%bl
+ 807:	74 67                	je     870 <printf+0x80>
+ 809:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 80c:	31 d2                	xor    %edx,%edx
+ 80e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 811:	eb 34                	jmp    847 <printf+0x57>
+ 813:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 817:	90                   	nop
+ 818:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 81b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 820:	83 f8 25             	cmp    $0x25,%eax
+ 823:	74 18                	je     83d <printf+0x4d>
+  write(fd, &c, 1);
+ 825:	83 ec 04             	sub    $0x4,%esp
+ 828:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 82b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 82e:	6a 01                	push   $0x1
+ 830:	50                   	push   %eax
+ 831:	57                   	push   %edi
+ 832:	e8 96 fb ff ff       	call   3cd <write>
+ 837:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 83a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 83d:	0f b6 1e             	movzbl (%esi),%ebx
+ 840:	83 c6 01             	add    $0x1,%esi
+ 843:	84 db                	test   %bl,%bl
+ 845:	74 29                	je     870 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 847:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 84a:	85 d2                	test   %edx,%edx
+ 84c:	74 ca                	je     818 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 84e:	83 fa 25             	cmp    $0x25,%edx
+ 851:	75 ea                	jne    83d <printf+0x4d>
+      if(c == 'd'){
+ 853:	83 f8 25             	cmp    $0x25,%eax
+ 856:	0f 84 24 01 00 00    	je     980 <printf+0x190>
+ 85c:	83 e8 63             	sub    $0x63,%eax
+ 85f:	83 f8 15             	cmp    $0x15,%eax
+ 862:	77 1c                	ja     880 <printf+0x90>
+ 864:	ff 24 85 34 0b 00 00 	jmp    *0xb34(,%eax,4)
+ 86b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 86f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 870:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 873:	5b                   	pop    %ebx
+ 874:	5e                   	pop    %esi
+ 875:	5f                   	pop    %edi
+ 876:	5d                   	pop    %ebp
+ 877:	c3                   	ret
+ 878:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 87f:	90                   	nop
+  write(fd, &c, 1);
+ 880:	83 ec 04             	sub    $0x4,%esp
+ 883:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 886:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 88a:	6a 01                	push   $0x1
+ 88c:	52                   	push   %edx
+ 88d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 890:	57                   	push   %edi
+ 891:	e8 37 fb ff ff       	call   3cd <write>
+ 896:	83 c4 0c             	add    $0xc,%esp
+ 899:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 89c:	6a 01                	push   $0x1
+ 89e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 8a1:	52                   	push   %edx
+ 8a2:	57                   	push   %edi
+ 8a3:	e8 25 fb ff ff       	call   3cd <write>
+        putc(fd, c);
+ 8a8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8ab:	31 d2                	xor    %edx,%edx
+ 8ad:	eb 8e                	jmp    83d <printf+0x4d>
+ 8af:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 8b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8b3:	83 ec 0c             	sub    $0xc,%esp
+ 8b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 8bb:	8b 13                	mov    (%ebx),%edx
+ 8bd:	6a 00                	push   $0x0
+ 8bf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 8c1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 8c4:	e8 87 fe ff ff       	call   750 <printint>
+        ap++;
+ 8c9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8cc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8cf:	31 d2                	xor    %edx,%edx
+ 8d1:	e9 67 ff ff ff       	jmp    83d <printf+0x4d>
+ 8d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8dd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 8e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 8e3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 8e5:	83 c0 04             	add    $0x4,%eax
+ 8e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 8eb:	85 db                	test   %ebx,%ebx
+ 8ed:	0f 84 9d 00 00 00    	je     990 <printf+0x1a0>
+        while(*s != 0){
+ 8f3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 8f6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 8f8:	84 c0                	test   %al,%al
+ 8fa:	0f 84 3d ff ff ff    	je     83d <printf+0x4d>
+ 900:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 903:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 906:	89 de                	mov    %ebx,%esi
+ 908:	89 d3                	mov    %edx,%ebx
+ 90a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 910:	83 ec 04             	sub    $0x4,%esp
+ 913:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 916:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 919:	6a 01                	push   $0x1
+ 91b:	53                   	push   %ebx
+ 91c:	57                   	push   %edi
+ 91d:	e8 ab fa ff ff       	call   3cd <write>
+        while(*s != 0){
+ 922:	0f b6 06             	movzbl (%esi),%eax
+ 925:	83 c4 10             	add    $0x10,%esp
+ 928:	84 c0                	test   %al,%al
+ 92a:	75 e4                	jne    910 <printf+0x120>
+      state = 0;
+ 92c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 92f:	31 d2                	xor    %edx,%edx
+ 931:	e9 07 ff ff ff       	jmp    83d <printf+0x4d>
+ 936:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 940:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 943:	83 ec 0c             	sub    $0xc,%esp
+ 946:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 94b:	8b 13                	mov    (%ebx),%edx
+ 94d:	6a 01                	push   $0x1
+ 94f:	e9 6b ff ff ff       	jmp    8bf <printf+0xcf>
+ 954:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 958:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 95b:	83 ec 04             	sub    $0x4,%esp
+ 95e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 961:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 963:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 966:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 969:	6a 01                	push   $0x1
+ 96b:	52                   	push   %edx
+ 96c:	57                   	push   %edi
+ 96d:	e8 5b fa ff ff       	call   3cd <write>
+        ap++;
+ 972:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 975:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 978:	31 d2                	xor    %edx,%edx
+ 97a:	e9 be fe ff ff       	jmp    83d <printf+0x4d>
+ 97f:	90                   	nop
+  write(fd, &c, 1);
+ 980:	83 ec 04             	sub    $0x4,%esp
+ 983:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 986:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 989:	6a 01                	push   $0x1
+ 98b:	e9 11 ff ff ff       	jmp    8a1 <printf+0xb1>
+ 990:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 995:	bb 2c 0b 00 00       	mov    $0xb2c,%ebx
+ 99a:	e9 61 ff ff ff       	jmp    900 <printf+0x110>
+ 99f:	90                   	nop
+
+000009a0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 9a0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9a1:	a1 88 0e 00 00       	mov    0xe88,%eax
+{
+ 9a6:	89 e5                	mov    %esp,%ebp
+ 9a8:	57                   	push   %edi
+ 9a9:	56                   	push   %esi
+ 9aa:	53                   	push   %ebx
+ 9ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 9ae:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9b8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9ba:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9bc:	39 ca                	cmp    %ecx,%edx
+ 9be:	73 30                	jae    9f0 <free+0x50>
+ 9c0:	39 c1                	cmp    %eax,%ecx
+ 9c2:	72 04                	jb     9c8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9c4:	39 c2                	cmp    %eax,%edx
+ 9c6:	72 f0                	jb     9b8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 9c8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 9cb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 9ce:	39 f8                	cmp    %edi,%eax
+ 9d0:	74 2e                	je     a00 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9d2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 9d5:	8b 42 04             	mov    0x4(%edx),%eax
+ 9d8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9db:	39 f1                	cmp    %esi,%ecx
+ 9dd:	74 38                	je     a17 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 9df:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 9e1:	5b                   	pop    %ebx
+  freep = p;
+ 9e2:	89 15 88 0e 00 00    	mov    %edx,0xe88
+}
+ 9e8:	5e                   	pop    %esi
+ 9e9:	5f                   	pop    %edi
+ 9ea:	5d                   	pop    %ebp
+ 9eb:	c3                   	ret
+ 9ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9f0:	39 c1                	cmp    %eax,%ecx
+ 9f2:	72 d0                	jb     9c4 <free+0x24>
+ 9f4:	eb c2                	jmp    9b8 <free+0x18>
+ 9f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9fd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ a00:	03 70 04             	add    0x4(%eax),%esi
+ a03:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a06:	8b 02                	mov    (%edx),%eax
+ a08:	8b 00                	mov    (%eax),%eax
+ a0a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ a0d:	8b 42 04             	mov    0x4(%edx),%eax
+ a10:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a13:	39 f1                	cmp    %esi,%ecx
+ a15:	75 c8                	jne    9df <free+0x3f>
+    p->s.size += bp->s.size;
+ a17:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ a1a:	89 15 88 0e 00 00    	mov    %edx,0xe88
+    p->s.size += bp->s.size;
+ a20:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a23:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ a26:	89 0a                	mov    %ecx,(%edx)
+}
+ a28:	5b                   	pop    %ebx
+ a29:	5e                   	pop    %esi
+ a2a:	5f                   	pop    %edi
+ a2b:	5d                   	pop    %ebp
+ a2c:	c3                   	ret
+ a2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a30 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a30:	55                   	push   %ebp
+ a31:	89 e5                	mov    %esp,%ebp
+ a33:	57                   	push   %edi
+ a34:	56                   	push   %esi
+ a35:	53                   	push   %ebx
+ a36:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a39:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ a3c:	8b 15 88 0e 00 00    	mov    0xe88,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a42:	8d 78 07             	lea    0x7(%eax),%edi
+ a45:	c1 ef 03             	shr    $0x3,%edi
+ a48:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a4b:	85 d2                	test   %edx,%edx
+ a4d:	0f 84 8d 00 00 00    	je     ae0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a53:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a55:	8b 48 04             	mov    0x4(%eax),%ecx
+ a58:	39 f9                	cmp    %edi,%ecx
+ a5a:	73 64                	jae    ac0 <malloc+0x90>
+  if(nu < 4096)
+ a5c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a61:	39 df                	cmp    %ebx,%edi
+ a63:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a66:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a6d:	eb 0a                	jmp    a79 <malloc+0x49>
+ a6f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a70:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a72:	8b 48 04             	mov    0x4(%eax),%ecx
+ a75:	39 f9                	cmp    %edi,%ecx
+ a77:	73 47                	jae    ac0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ a79:	89 c2                	mov    %eax,%edx
+ a7b:	39 05 88 0e 00 00    	cmp    %eax,0xe88
+ a81:	75 ed                	jne    a70 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ a83:	83 ec 0c             	sub    $0xc,%esp
+ a86:	56                   	push   %esi
+ a87:	e8 ba fa ff ff       	call   546 <sbrk>
+  if(p == (char*)-1)
+ a8c:	83 c4 10             	add    $0x10,%esp
+ a8f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a92:	74 1c                	je     ab0 <malloc+0x80>
+  hp->s.size = nu;
+ a94:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ a97:	83 ec 0c             	sub    $0xc,%esp
+ a9a:	83 c0 08             	add    $0x8,%eax
+ a9d:	50                   	push   %eax
+ a9e:	e8 fd fe ff ff       	call   9a0 <free>
+  return freep;
+ aa3:	8b 15 88 0e 00 00    	mov    0xe88,%edx
+      if((p = morecore(nunits)) == 0)
+ aa9:	83 c4 10             	add    $0x10,%esp
+ aac:	85 d2                	test   %edx,%edx
+ aae:	75 c0                	jne    a70 <malloc+0x40>
+        return 0;
+  }
+}
+ ab0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ ab3:	31 c0                	xor    %eax,%eax
+}
+ ab5:	5b                   	pop    %ebx
+ ab6:	5e                   	pop    %esi
+ ab7:	5f                   	pop    %edi
+ ab8:	5d                   	pop    %ebp
+ ab9:	c3                   	ret
+ aba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ ac0:	39 cf                	cmp    %ecx,%edi
+ ac2:	74 4c                	je     b10 <malloc+0xe0>
+        p->s.size -= nunits;
+ ac4:	29 f9                	sub    %edi,%ecx
+ ac6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ ac9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ acc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ acf:	89 15 88 0e 00 00    	mov    %edx,0xe88
+}
+ ad5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ ad8:	83 c0 08             	add    $0x8,%eax
+}
+ adb:	5b                   	pop    %ebx
+ adc:	5e                   	pop    %esi
+ add:	5f                   	pop    %edi
+ ade:	5d                   	pop    %ebp
+ adf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ ae0:	c7 05 88 0e 00 00 8c 	movl   $0xe8c,0xe88
+ ae7:	0e 00 00 
+    base.s.size = 0;
+ aea:	b8 8c 0e 00 00       	mov    $0xe8c,%eax
+    base.s.ptr = freep = prevp = &base;
+ aef:	c7 05 8c 0e 00 00 8c 	movl   $0xe8c,0xe8c
+ af6:	0e 00 00 
+    base.s.size = 0;
+ af9:	c7 05 90 0e 00 00 00 	movl   $0x0,0xe90
+ b00:	00 00 00 
+    if(p->s.size >= nunits){
+ b03:	e9 54 ff ff ff       	jmp    a5c <malloc+0x2c>
+ b08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b0f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ b10:	8b 08                	mov    (%eax),%ecx
+ b12:	89 0a                	mov    %ecx,(%edx)
+ b14:	eb b9                	jmp    acf <malloc+0x9f>
@@ -42,6 +42,14 @@
 #define TDCR    (0x03E0/4)   // Timer Divide Configuration
 
 volatile uint *lapic;  // Initialized in mp.c
+uint lapicperiod;      // Timer counts per scheduler tick
+uint tscperiod;        // TSC counts per scheduler tick, or 0
+
+// PIT channel 2, used only to calibrate the LAPIC timer.
+#define PIT_HZ      1193182
+#define PIT_CH2     0x42
+#define PIT_MODE    0x43
+#define PIT_GATE    0x61      // bit 0: channel 2 gate; bit 5: its output
 
 //PAGEBREAK!
 static void
@@ -51,6 +59,34 @@ lapicw(int index, int value)
   lapic[ID];  // wait for write to finish, by reading
 }
 
+// Count how far the LAPIC timer gets in one scheduler tick,
+// as measured by PIT channel 2 counting down 1/HZ seconds.
+// Measures the TSC into tscperiod along the way.
+// Returns 0 if the PIT never finishes.
+static uint
+lapiccalibrate(void)
+{
+  uint n, i;
+  uint64 tsc;
+
+  n = PIT_HZ / HZ;
+  outb(PIT_GATE, inb(PIT_GATE) & ~0x03);  // gate off, speaker off
+  outb(PIT_MODE, 0xB0);  // channel 2, lobyte/hibyte, interrupt on count
+  outb(PIT_CH2, n & 0xFF);
+  outb(PIT_CH2, n >> 8);
+
+  lapicw(TIMER, MASKED);
+  lapicw(TICR, 0xFFFFFFFF);
+  tsc = rdtsc();
+  outb(PIT_GATE, inb(PIT_GATE) | 0x01);  // start the PIT
+  for(i = 0; (inb(PIT_GATE) & 0x20) == 0; i++)
+    if(i == 100000000)
+      return 0;
+  n = 0xFFFFFFFF - lapic[TCCR];
+  tscperiod = rdtsc() - tsc;
+  return n;
+}
+
 void
 lapicinit(void)
 {
@@ -60,13 +96,16 @@ lapicinit(void)
   // Enable local APIC; set spurious interrupt vector.
   lapicw(SVR, ENABLE | (T_IRQ0 + IRQ_SPURIOUS));
 
-  // The timer repeatedly counts down at bus frequency
-  // from lapic[TICR] and then issues an interrupt.
-  // If xv6 cared more about precise timekeeping,
-  // TICR would be calibrated using an external time source.
+  // The timer counts down at bus frequency from lapic[TICR]
+  // and then issues an interrupt.  It runs in one-shot mode:
+  // timer.c re-arms it after every interrupt, for the next
+  // tick or an earlier nanosleep() deadline.  The boot CPU
+  // calibrates the tick length against the PIT.
   lapicw(TDCR, X1);
-  lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
-  lapicw(TICR, 10000000);
+  if(lapicperiod == 0 && (lapicperiod = lapiccalibrate()) == 0)
+    lapicperiod = 10000000;
+  lapicw(TIMER, T_IRQ0 + IRQ_TIMER);
+  lapicw(TICR, lapicperiod);
 
   // Disable logical interrupt lines.
   lapicw(LINT0, MASKED);
@@ -113,6 +152,24 @@ lapiceoi(void)
     lapicw(EOI, 0);
 }
 
+// Start the timer counting down from count; it interrupts
+// once when it reaches zero.
+void
+lapicarm(uint count)
+{
+  if(lapic)
+    lapicw(TICR, count);
+}
+
+// Timer counts left before the armed interrupt.
+uint
+lapiccount(void)
+{
+  if(!lapic)
+    return 0;
+  return lapic[TCCR];
+}
+
 // Spin for a given number of microseconds.
 // On real hardware would want to tune this dynamically.
 void
@@ -120,6 +177,21 @@ microdelay(int us)
 {
 }
 
+// Send a fixed-delivery inter-processor interrupt with the
+// given vector to the CPU whose local APIC ID is apicid.
+// Must be called with interrupts disabled, since ICR is shared
+// by everything running on this CPU.
+void
+lapicipi(int apicid, int vector)
+{
+  if(!lapic)
+    return;
+  lapicw(ICRHI, apicid<<24);
+  lapicw(ICRLO, FIXED | ASSERT | vector);
+  while(lapic[ICRLO] & DELIVS)
+    ;
+}
+
 #define CMOS_PORT    0x70
 #define CMOS_RETURN  0x71
 
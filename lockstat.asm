@@ -0,0 +1,2603 @@
+
+_lockstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+      hist(&cur[i]);
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 18             	sub    $0x18,%esp
+      14:	8b 39                	mov    (%ecx),%edi
+      16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  int i, j, nold, ncur;
+
+  nold = 0;
+  if(argc > 1){
+      19:	83 ff 01             	cmp    $0x1,%edi
+      1c:	7e 44                	jle    62 <main+0x62>
+    nold = getlockstat(old, NSTAT);
+      1e:	50                   	push   %eax
+      1f:	50                   	push   %eax
+      20:	6a 40                	push   $0x40
+      22:	68 80 90 01 00       	push   $0x19080
+      27:	e8 40 11 00 00       	call   116c <getlockstat>
+      2c:	89 c6                	mov    %eax,%esi
+    if(strcmp(argv[1], "-p") == 0){
+      2e:	58                   	pop    %eax
+      2f:	5a                   	pop    %edx
+      30:	68 f2 15 00 00       	push   $0x15f2
+      35:	ff 73 04             	push   0x4(%ebx)
+      38:	e8 e3 0a 00 00       	call   b20 <strcmp>
+      3d:	83 c4 10             	add    $0x10,%esp
+      40:	85 c0                	test   %eax,%eax
+      42:	0f 85 2c 01 00 00    	jne    174 <main+0x174>
+      if(argc < 3){
+      48:	83 ff 02             	cmp    $0x2,%edi
+      4b:	0f 84 b5 01 00 00    	je     206 <main+0x206>
+        printf(2, "usage: lockstat [-p] [command [arg ...]]\n");
+        exit();
+      }
+      profile(argv+2);
+      51:	83 ec 0c             	sub    $0xc,%esp
+      54:	83 c3 08             	add    $0x8,%ebx
+      57:	53                   	push   %ebx
+      58:	e8 c3 06 00 00       	call   720 <profile>
+      exit();
+      5d:	e8 87 0d 00 00       	call   de9 <exit>
+    }
+    run(argv+1);
+  }
+  ncur = getlockstat(cur, NSTAT);
+      62:	51                   	push   %ecx
+      63:	51                   	push   %ecx
+      64:	6a 40                	push   $0x40
+      66:	68 80 47 01 00       	push   $0x14780
+      6b:	e8 fc 10 00 00       	call   116c <getlockstat>
+      70:	83 c4 10             	add    $0x10,%esp
+      73:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < nold; i++){
+    cur[i].nacquire -= old[i].nacquire;
+    cur[i].ncontend -= old[i].ncontend;
+    cur[i].spin -= old[i].spin;
+  }
+  sortstat(ncur);
+      76:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      79:	83 ec 0c             	sub    $0xc,%esp
+      7c:	57                   	push   %edi
+      7d:	e8 ce 02 00 00       	call   350 <sortstat>
+
+  printf(1, "NAME             LOCKS    ACQUIRE    CONTEND   WAIT-KCYC\n");
+      82:	58                   	pop    %eax
+      83:	5a                   	pop    %edx
+      84:	68 90 16 00 00       	push   $0x1690
+      89:	6a 01                	push   $0x1
+      8b:	e8 f0 11 00 00       	call   1280 <printf>
+  for(i = 0; i < ncur; i++){
+      90:	83 c4 10             	add    $0x10,%esp
+      93:	85 ff                	test   %edi,%edi
+      95:	0f 8e d4 00 00 00    	jle    16f <main+0x16f>
+      9b:	be 80 47 01 00       	mov    $0x14780,%esi
+      a0:	31 ff                	xor    %edi,%edi
+      a2:	eb 18                	jmp    bc <main+0xbc>
+      a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      a8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      ab:	83 c7 01             	add    $0x1,%edi
+      ae:	81 c6 24 01 00 00    	add    $0x124,%esi
+      b4:	39 c7                	cmp    %eax,%edi
+      b6:	0f 84 b3 00 00 00    	je     16f <main+0x16f>
+    if(cur[i].nacquire == 0)
+      bc:	8b 46 14             	mov    0x14(%esi),%eax
+      bf:	85 c0                	test   %eax,%eax
+      c1:	74 e5                	je     a8 <main+0xa8>
+      continue;
+    printf(1, "%s", cur[i].name);
+      c3:	83 ec 04             	sub    $0x4,%esp
+      c6:	56                   	push   %esi
+      c7:	68 ad 15 00 00       	push   $0x15ad
+      cc:	6a 01                	push   $0x1
+      ce:	e8 ad 11 00 00       	call   1280 <printf>
+    for(j = strlen(cur[i].name); j < 16; j++)
+      d3:	89 34 24             	mov    %esi,(%esp)
+      d6:	e8 a5 0a 00 00       	call   b80 <strlen>
+      db:	83 c4 10             	add    $0x10,%esp
+      de:	89 c3                	mov    %eax,%ebx
+      e0:	83 f8 0f             	cmp    $0xf,%eax
+      e3:	7f 1d                	jg     102 <main+0x102>
+      e5:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(1, " ");
+      e8:	83 ec 08             	sub    $0x8,%esp
+    for(j = strlen(cur[i].name); j < 16; j++)
+      eb:	83 c3 01             	add    $0x1,%ebx
+      printf(1, " ");
+      ee:	68 ed 15 00 00       	push   $0x15ed
+      f3:	6a 01                	push   $0x1
+      f5:	e8 86 11 00 00       	call   1280 <printf>
+    for(j = strlen(cur[i].name); j < 16; j++)
+      fa:	83 c4 10             	add    $0x10,%esp
+      fd:	83 fb 10             	cmp    $0x10,%ebx
+     100:	75 e6                	jne    e8 <main+0xe8>
+    col(cur[i].nlock, 5);
+     102:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < ncur; i++){
+     105:	83 c7 01             	add    $0x1,%edi
+     108:	81 c6 24 01 00 00    	add    $0x124,%esi
+    col(cur[i].nlock, 5);
+     10e:	6a 05                	push   $0x5
+     110:	ff b6 ec fe ff ff    	push   -0x114(%esi)
+     116:	e8 05 01 00 00       	call   220 <col>
+    col(cur[i].nacquire, 10);
+     11b:	58                   	pop    %eax
+     11c:	5a                   	pop    %edx
+     11d:	6a 0a                	push   $0xa
+     11f:	ff b6 f0 fe ff ff    	push   -0x110(%esi)
+     125:	e8 f6 00 00 00       	call   220 <col>
+    col(cur[i].ncontend, 10);
+     12a:	59                   	pop    %ecx
+     12b:	5b                   	pop    %ebx
+     12c:	6a 0a                	push   $0xa
+     12e:	ff b6 f4 fe ff ff    	push   -0x10c(%esi)
+     134:	e8 e7 00 00 00       	call   220 <col>
+    col((uint)(cur[i].spin >> 10), 11);
+     139:	58                   	pop    %eax
+     13a:	5a                   	pop    %edx
+     13b:	6a 0b                	push   $0xb
+     13d:	8b 96 fc fe ff ff    	mov    -0x104(%esi),%edx
+     143:	8b 86 f8 fe ff ff    	mov    -0x108(%esi),%eax
+     149:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+     14d:	50                   	push   %eax
+     14e:	e8 cd 00 00 00       	call   220 <col>
+    printf(1, "\n");
+     153:	5b                   	pop    %ebx
+     154:	58                   	pop    %eax
+     155:	68 c5 15 00 00       	push   $0x15c5
+     15a:	6a 01                	push   $0x1
+     15c:	e8 1f 11 00 00       	call   1280 <printf>
+  for(i = 0; i < ncur; i++){
+     161:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    printf(1, "\n");
+     164:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < ncur; i++){
+     167:	39 c7                	cmp    %eax,%edi
+     169:	0f 85 4d ff ff ff    	jne    bc <main+0xbc>
+  }
+  exit();
+     16f:	e8 75 0c 00 00       	call   de9 <exit>
+    run(argv+1);
+     174:	83 ec 0c             	sub    $0xc,%esp
+     177:	83 c3 04             	add    $0x4,%ebx
+     17a:	53                   	push   %ebx
+     17b:	e8 70 01 00 00       	call   2f0 <run>
+  ncur = getlockstat(cur, NSTAT);
+     180:	59                   	pop    %ecx
+     181:	5b                   	pop    %ebx
+     182:	6a 40                	push   $0x40
+     184:	68 80 47 01 00       	push   $0x14780
+     189:	e8 de 0f 00 00       	call   116c <getlockstat>
+  for(i = 0; i < nold; i++){
+     18e:	83 c4 10             	add    $0x10,%esp
+  ncur = getlockstat(cur, NSTAT);
+     191:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < nold; i++){
+     194:	85 f6                	test   %esi,%esi
+     196:	0f 8e da fe ff ff    	jle    76 <main+0x76>
+     19c:	69 d6 24 01 00 00    	imul   $0x124,%esi,%edx
+     1a2:	b8 14 00 00 00       	mov    $0x14,%eax
+     1a7:	83 c2 14             	add    $0x14,%edx
+     1aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    cur[i].nacquire -= old[i].nacquire;
+     1b0:	8b 88 80 47 01 00    	mov    0x14780(%eax),%ecx
+     1b6:	2b 88 80 90 01 00    	sub    0x19080(%eax),%ecx
+    cur[i].spin -= old[i].spin;
+     1bc:	8b b0 88 47 01 00    	mov    0x14788(%eax),%esi
+     1c2:	8b b8 8c 47 01 00    	mov    0x1478c(%eax),%edi
+    cur[i].nacquire -= old[i].nacquire;
+     1c8:	89 88 80 47 01 00    	mov    %ecx,0x14780(%eax)
+    cur[i].ncontend -= old[i].ncontend;
+     1ce:	8b 88 84 47 01 00    	mov    0x14784(%eax),%ecx
+     1d4:	2b 88 84 90 01 00    	sub    0x19084(%eax),%ecx
+    cur[i].spin -= old[i].spin;
+     1da:	2b b0 88 90 01 00    	sub    0x19088(%eax),%esi
+     1e0:	1b b8 8c 90 01 00    	sbb    0x1908c(%eax),%edi
+    cur[i].ncontend -= old[i].ncontend;
+     1e6:	89 88 84 47 01 00    	mov    %ecx,0x14784(%eax)
+  for(i = 0; i < nold; i++){
+     1ec:	05 24 01 00 00       	add    $0x124,%eax
+    cur[i].spin -= old[i].spin;
+     1f1:	89 b0 64 46 01 00    	mov    %esi,0x14664(%eax)
+     1f7:	89 b8 68 46 01 00    	mov    %edi,0x14668(%eax)
+  for(i = 0; i < nold; i++){
+     1fd:	39 c2                	cmp    %eax,%edx
+     1ff:	75 af                	jne    1b0 <main+0x1b0>
+     201:	e9 70 fe ff ff       	jmp    76 <main+0x76>
+        printf(2, "usage: lockstat [-p] [command [arg ...]]\n");
+     206:	56                   	push   %esi
+     207:	56                   	push   %esi
+     208:	68 64 16 00 00       	push   $0x1664
+     20d:	6a 02                	push   $0x2
+     20f:	e8 6c 10 00 00       	call   1280 <printf>
+        exit();
+     214:	e8 d0 0b 00 00       	call   de9 <exit>
+     219:	66 90                	xchg   %ax,%ax
+     21b:	66 90                	xchg   %ax,%ax
+     21d:	66 90                	xchg   %ax,%ax
+     21f:	90                   	nop
+
+00000220 <col>:
+{
+     220:	55                   	push   %ebp
+     221:	89 e5                	mov    %esp,%ebp
+     223:	57                   	push   %edi
+     224:	56                   	push   %esi
+     225:	53                   	push   %ebx
+     226:	83 ec 0c             	sub    $0xc,%esp
+  for(m = n, w--; m >= 10; m /= 10)
+     229:	8b 45 0c             	mov    0xc(%ebp),%eax
+{
+     22c:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(m = n, w--; m >= 10; m /= 10)
+     22f:	8d 58 ff             	lea    -0x1(%eax),%ebx
+     232:	83 fe 09             	cmp    $0x9,%esi
+     235:	76 1a                	jbe    251 <col+0x31>
+     237:	89 f2                	mov    %esi,%edx
+     239:	bf cd cc cc cc       	mov    $0xcccccccd,%edi
+     23e:	66 90                	xchg   %ax,%ax
+     240:	89 d0                	mov    %edx,%eax
+     242:	89 d1                	mov    %edx,%ecx
+    w--;
+     244:	83 eb 01             	sub    $0x1,%ebx
+  for(m = n, w--; m >= 10; m /= 10)
+     247:	f7 e7                	mul    %edi
+     249:	c1 ea 03             	shr    $0x3,%edx
+     24c:	83 f9 63             	cmp    $0x63,%ecx
+     24f:	77 ef                	ja     240 <col+0x20>
+  while(w-- > 0)
+     251:	8d 7b ff             	lea    -0x1(%ebx),%edi
+     254:	85 db                	test   %ebx,%ebx
+     256:	7e 22                	jle    27a <col+0x5a>
+     258:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     25f:	90                   	nop
+    printf(1, " ");
+     260:	83 ec 08             	sub    $0x8,%esp
+  while(w-- > 0)
+     263:	83 ef 01             	sub    $0x1,%edi
+    printf(1, " ");
+     266:	68 ed 15 00 00       	push   $0x15ed
+     26b:	6a 01                	push   $0x1
+     26d:	e8 0e 10 00 00       	call   1280 <printf>
+  while(w-- > 0)
+     272:	83 c4 10             	add    $0x10,%esp
+     275:	83 ff ff             	cmp    $0xffffffff,%edi
+     278:	75 e6                	jne    260 <col+0x40>
+  printf(1, " %d", n);
+     27a:	83 ec 04             	sub    $0x4,%esp
+     27d:	56                   	push   %esi
+     27e:	68 a8 15 00 00       	push   $0x15a8
+     283:	6a 01                	push   $0x1
+     285:	e8 f6 0f 00 00       	call   1280 <printf>
+}
+     28a:	83 c4 10             	add    $0x10,%esp
+     28d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     290:	5b                   	pop    %ebx
+     291:	5e                   	pop    %esi
+     292:	5f                   	pop    %edi
+     293:	5d                   	pop    %ebp
+     294:	c3                   	ret
+     295:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     29c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <lcol>:
+{
+     2a0:	55                   	push   %ebp
+     2a1:	89 e5                	mov    %esp,%ebp
+     2a3:	53                   	push   %ebx
+     2a4:	83 ec 08             	sub    $0x8,%esp
+     2a7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  printf(1, " %s", s);
+     2aa:	53                   	push   %ebx
+     2ab:	68 ac 15 00 00       	push   $0x15ac
+     2b0:	6a 01                	push   $0x1
+     2b2:	e8 c9 0f 00 00       	call   1280 <printf>
+  for(w -= strlen(s); w > 0; w--)
+     2b7:	89 1c 24             	mov    %ebx,(%esp)
+     2ba:	e8 c1 08 00 00       	call   b80 <strlen>
+     2bf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     2c2:	83 c4 10             	add    $0x10,%esp
+     2c5:	29 c3                	sub    %eax,%ebx
+     2c7:	85 db                	test   %ebx,%ebx
+     2c9:	7e 1c                	jle    2e7 <lcol+0x47>
+     2cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2cf:	90                   	nop
+    printf(1, " ");
+     2d0:	83 ec 08             	sub    $0x8,%esp
+     2d3:	68 ed 15 00 00       	push   $0x15ed
+     2d8:	6a 01                	push   $0x1
+     2da:	e8 a1 0f 00 00       	call   1280 <printf>
+  for(w -= strlen(s); w > 0; w--)
+     2df:	83 c4 10             	add    $0x10,%esp
+     2e2:	83 eb 01             	sub    $0x1,%ebx
+     2e5:	75 e9                	jne    2d0 <lcol+0x30>
+}
+     2e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2ea:	c9                   	leave
+     2eb:	c3                   	ret
+     2ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002f0 <run>:
+{
+     2f0:	55                   	push   %ebp
+     2f1:	89 e5                	mov    %esp,%ebp
+     2f3:	53                   	push   %ebx
+     2f4:	83 ec 04             	sub    $0x4,%esp
+     2f7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pid = fork();
+     2fa:	e8 cd 0a 00 00       	call   dcc <fork>
+  if(pid < 0){
+     2ff:	85 c0                	test   %eax,%eax
+     301:	78 0b                	js     30e <run+0x1e>
+  if(pid == 0){
+     303:	74 1c                	je     321 <run+0x31>
+}
+     305:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     308:	c9                   	leave
+  wait();
+     309:	e9 f8 0a 00 00       	jmp    e06 <wait>
+    printf(2, "lockstat: fork failed\n");
+     30e:	52                   	push   %edx
+     30f:	52                   	push   %edx
+     310:	68 b0 15 00 00       	push   $0x15b0
+     315:	6a 02                	push   $0x2
+     317:	e8 64 0f 00 00       	call   1280 <printf>
+    exit();
+     31c:	e8 c8 0a 00 00       	call   de9 <exit>
+    exec(argv[0], argv);
+     321:	50                   	push   %eax
+     322:	50                   	push   %eax
+     323:	53                   	push   %ebx
+     324:	ff 33                	push   (%ebx)
+     326:	e8 89 0b 00 00       	call   eb4 <exec>
+    printf(2, "lockstat: exec %s failed\n", argv[0]);
+     32b:	83 c4 0c             	add    $0xc,%esp
+     32e:	ff 33                	push   (%ebx)
+     330:	68 c7 15 00 00       	push   $0x15c7
+     335:	6a 02                	push   $0x2
+     337:	e8 44 0f 00 00       	call   1280 <printf>
+    exit();
+     33c:	e8 a8 0a 00 00       	call   de9 <exit>
+     341:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     348:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     34f:	90                   	nop
+
+00000350 <sortstat>:
+{
+     350:	55                   	push   %ebp
+     351:	89 e5                	mov    %esp,%ebp
+     353:	57                   	push   %edi
+     354:	56                   	push   %esi
+     355:	53                   	push   %ebx
+     356:	81 ec 44 01 00 00    	sub    $0x144,%esp
+  for(i = 1; i < n; i++){
+     35c:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     360:	0f 8e b5 00 00 00    	jle    41b <sortstat+0xcb>
+     366:	c7 85 b4 fe ff ff a4 	movl   $0x148a4,-0x14c(%ebp)
+     36d:	48 01 00 
+     370:	c7 85 b8 fe ff ff 01 	movl   $0x1,-0x148(%ebp)
+     377:	00 00 00 
+     37a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    t = cur[i];
+     380:	8b 85 b4 fe ff ff    	mov    -0x14c(%ebp),%eax
+     386:	8b b5 b4 fe ff ff    	mov    -0x14c(%ebp),%esi
+     38c:	b9 49 00 00 00       	mov    $0x49,%ecx
+     391:	8d bd cc fe ff ff    	lea    -0x134(%ebp),%edi
+     397:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+     399:	8b 50 20             	mov    0x20(%eax),%edx
+     39c:	8b 58 1c             	mov    0x1c(%eax),%ebx
+     39f:	89 95 bc fe ff ff    	mov    %edx,-0x144(%ebp)
+     3a5:	8b 95 b8 fe ff ff    	mov    -0x148(%ebp),%edx
+     3ab:	eb 1b                	jmp    3c8 <sortstat+0x78>
+     3ad:	8d 76 00             	lea    0x0(%esi),%esi
+      cur[j] = cur[j-1];
+     3b0:	8d b0 dc fe ff ff    	lea    -0x124(%eax),%esi
+     3b6:	89 c7                	mov    %eax,%edi
+     3b8:	b9 49 00 00 00       	mov    $0x49,%ecx
+    for(j = i; j > 0 && cur[j-1].spin < t.spin; j--)
+     3bd:	2d 24 01 00 00       	sub    $0x124,%eax
+      cur[j] = cur[j-1];
+     3c2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    for(j = i; j > 0 && cur[j-1].spin < t.spin; j--)
+     3c4:	85 d2                	test   %edx,%edx
+     3c6:	74 68                	je     430 <sortstat+0xe0>
+     3c8:	8b 88 fc fe ff ff    	mov    -0x104(%eax),%ecx
+     3ce:	39 98 f8 fe ff ff    	cmp    %ebx,-0x108(%eax)
+     3d4:	89 d6                	mov    %edx,%esi
+     3d6:	8d 52 ff             	lea    -0x1(%edx),%edx
+     3d9:	1b 8d bc fe ff ff    	sbb    -0x144(%ebp),%ecx
+     3df:	72 cf                	jb     3b0 <sortstat+0x60>
+    cur[j] = t;
+     3e1:	69 c6 24 01 00 00    	imul   $0x124,%esi,%eax
+     3e7:	b9 49 00 00 00       	mov    $0x49,%ecx
+  for(i = 1; i < n; i++){
+     3ec:	83 85 b8 fe ff ff 01 	addl   $0x1,-0x148(%ebp)
+     3f3:	81 85 b4 fe ff ff 24 	addl   $0x124,-0x14c(%ebp)
+     3fa:	01 00 00 
+    cur[j] = t;
+     3fd:	8d b5 cc fe ff ff    	lea    -0x134(%ebp),%esi
+     403:	05 80 47 01 00       	add    $0x14780,%eax
+     408:	89 c7                	mov    %eax,%edi
+  for(i = 1; i < n; i++){
+     40a:	8b 85 b8 fe ff ff    	mov    -0x148(%ebp),%eax
+    cur[j] = t;
+     410:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  for(i = 1; i < n; i++){
+     412:	39 45 08             	cmp    %eax,0x8(%ebp)
+     415:	0f 85 65 ff ff ff    	jne    380 <sortstat+0x30>
+}
+     41b:	81 c4 44 01 00 00    	add    $0x144,%esp
+     421:	5b                   	pop    %ebx
+     422:	5e                   	pop    %esi
+     423:	5f                   	pop    %edi
+     424:	5d                   	pop    %ebp
+     425:	c3                   	ret
+     426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     42d:	8d 76 00             	lea    0x0(%esi),%esi
+     430:	31 f6                	xor    %esi,%esi
+     432:	eb ad                	jmp    3e1 <sortstat+0x91>
+     434:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     43b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     43f:	90                   	nop
+
+00000440 <sortsite>:
+{
+     440:	55                   	push   %ebp
+     441:	89 e5                	mov    %esp,%ebp
+     443:	57                   	push   %edi
+     444:	56                   	push   %esi
+     445:	53                   	push   %ebx
+     446:	81 ec 44 01 00 00    	sub    $0x144,%esp
+  for(i = 1; i < n; i++){
+     44c:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     450:	c7 85 b4 fe ff ff 01 	movl   $0x1,-0x14c(%ebp)
+     457:	00 00 00 
+     45a:	0f 8e c3 00 00 00    	jle    523 <sortsite+0xe3>
+     460:	bb ac 1c 00 00       	mov    $0x1cac,%ebx
+     465:	8d 76 00             	lea    0x0(%esi),%esi
+    for(j = i; j > 0 && site[j-1].wait + site[j-1].hold < t.wait + t.hold; j--)
+     468:	8b 43 24             	mov    0x24(%ebx),%eax
+     46b:	8b 53 28             	mov    0x28(%ebx),%edx
+    t = site[i];
+     46e:	b9 4b 00 00 00       	mov    $0x4b,%ecx
+     473:	89 de                	mov    %ebx,%esi
+    for(j = i; j > 0 && site[j-1].wait + site[j-1].hold < t.wait + t.hold; j--)
+     475:	03 43 1c             	add    0x1c(%ebx),%eax
+     478:	13 53 20             	adc    0x20(%ebx),%edx
+    t = site[i];
+     47b:	8d bd c4 fe ff ff    	lea    -0x13c(%ebp),%edi
+     481:	89 9d b0 fe ff ff    	mov    %ebx,-0x150(%ebp)
+     487:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    for(j = i; j > 0 && site[j-1].wait + site[j-1].hold < t.wait + t.hold; j--)
+     489:	89 85 b8 fe ff ff    	mov    %eax,-0x148(%ebp)
+     48f:	89 d8                	mov    %ebx,%eax
+     491:	89 95 bc fe ff ff    	mov    %edx,-0x144(%ebp)
+     497:	8b 95 b4 fe ff ff    	mov    -0x14c(%ebp),%edx
+     49d:	eb 19                	jmp    4b8 <sortsite+0x78>
+     49f:	90                   	nop
+      site[j] = site[j-1];
+     4a0:	8d b0 d4 fe ff ff    	lea    -0x12c(%eax),%esi
+     4a6:	89 c7                	mov    %eax,%edi
+     4a8:	b9 4b 00 00 00       	mov    $0x4b,%ecx
+    for(j = i; j > 0 && site[j-1].wait + site[j-1].hold < t.wait + t.hold; j--)
+     4ad:	2d 2c 01 00 00       	sub    $0x12c,%eax
+      site[j] = site[j-1];
+     4b2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    for(j = i; j > 0 && site[j-1].wait + site[j-1].hold < t.wait + t.hold; j--)
+     4b4:	85 d2                	test   %edx,%edx
+     4b6:	74 78                	je     530 <sortsite+0xf0>
+     4b8:	8b 9d b8 fe ff ff    	mov    -0x148(%ebp),%ebx
+     4be:	8b b0 f8 fe ff ff    	mov    -0x108(%eax),%esi
+     4c4:	89 d1                	mov    %edx,%ecx
+     4c6:	8d 52 ff             	lea    -0x1(%edx),%edx
+     4c9:	03 b0 f0 fe ff ff    	add    -0x110(%eax),%esi
+     4cf:	8b b8 fc fe ff ff    	mov    -0x104(%eax),%edi
+     4d5:	13 b8 f4 fe ff ff    	adc    -0x10c(%eax),%edi
+     4db:	39 de                	cmp    %ebx,%esi
+     4dd:	1b bd bc fe ff ff    	sbb    -0x144(%ebp),%edi
+     4e3:	72 bb                	jb     4a0 <sortsite+0x60>
+     4e5:	8b 9d b0 fe ff ff    	mov    -0x150(%ebp),%ebx
+     4eb:	89 ce                	mov    %ecx,%esi
+    site[j] = t;
+     4ed:	69 c6 2c 01 00 00    	imul   $0x12c,%esi,%eax
+  for(i = 1; i < n; i++){
+     4f3:	83 85 b4 fe ff ff 01 	addl   $0x1,-0x14c(%ebp)
+    site[j] = t;
+     4fa:	b9 4b 00 00 00       	mov    $0x4b,%ecx
+  for(i = 1; i < n; i++){
+     4ff:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+    site[j] = t;
+     505:	8d b5 c4 fe ff ff    	lea    -0x13c(%ebp),%esi
+     50b:	05 80 1b 00 00       	add    $0x1b80,%eax
+     510:	89 c7                	mov    %eax,%edi
+  for(i = 1; i < n; i++){
+     512:	8b 85 b4 fe ff ff    	mov    -0x14c(%ebp),%eax
+    site[j] = t;
+     518:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  for(i = 1; i < n; i++){
+     51a:	39 45 08             	cmp    %eax,0x8(%ebp)
+     51d:	0f 85 45 ff ff ff    	jne    468 <sortsite+0x28>
+}
+     523:	81 c4 44 01 00 00    	add    $0x144,%esp
+     529:	5b                   	pop    %ebx
+     52a:	5e                   	pop    %esi
+     52b:	5f                   	pop    %edi
+     52c:	5d                   	pop    %ebp
+     52d:	c3                   	ret
+     52e:	66 90                	xchg   %ax,%ax
+     530:	8b 9d b0 fe ff ff    	mov    -0x150(%ebp),%ebx
+     536:	31 f6                	xor    %esi,%esi
+     538:	eb b3                	jmp    4ed <sortsite+0xad>
+     53a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000540 <hist>:
+{
+     540:	55                   	push   %ebp
+     541:	89 e5                	mov    %esp,%ebp
+     543:	57                   	push   %edi
+     544:	56                   	push   %esi
+     545:	53                   	push   %ebx
+     546:	83 ec 20             	sub    $0x20,%esp
+     549:	8b 45 08             	mov    0x8(%ebp),%eax
+  printf(1, "\n%s\n  CYCLES >=        WAIT      HOLD\n", st->name);
+     54c:	50                   	push   %eax
+     54d:	68 f8 15 00 00       	push   $0x15f8
+     552:	6a 01                	push   $0x1
+     554:	e8 27 0d 00 00       	call   1280 <printf>
+  for(top = NLOCKHIST-1; top > 0; top--)
+     559:	8b 45 08             	mov    0x8(%ebp),%eax
+  printf(1, "\n%s\n  CYCLES >=        WAIT      HOLD\n", st->name);
+     55c:	83 c4 10             	add    $0x10,%esp
+  for(top = NLOCKHIST-1; top > 0; top--)
+     55f:	ba 1f 00 00 00       	mov    $0x1f,%edx
+     564:	eb 1a                	jmp    580 <hist+0x40>
+     566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     56d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(st->waithist[top] || st->holdhist[top])
+     570:	8b 8c 90 a4 00 00 00 	mov    0xa4(%eax,%edx,4),%ecx
+     577:	85 c9                	test   %ecx,%ecx
+     579:	75 0d                	jne    588 <hist+0x48>
+  for(top = NLOCKHIST-1; top > 0; top--)
+     57b:	83 ea 01             	sub    $0x1,%edx
+     57e:	74 08                	je     588 <hist+0x48>
+    if(st->waithist[top] || st->holdhist[top])
+     580:	8b 5c 90 24          	mov    0x24(%eax,%edx,4),%ebx
+     584:	85 db                	test   %ebx,%ebx
+     586:	74 e8                	je     570 <hist+0x30>
+  for(top = NLOCKHIST-1; top > 0; top--)
+     588:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+     58f:	8d 7a 01             	lea    0x1(%edx),%edi
+     592:	89 45 08             	mov    %eax,0x8(%ebp)
+     595:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  for(m = n, w--; m >= 10; m /= 10)
+     598:	bf cd cc cc cc       	mov    $0xcccccccd,%edi
+     59d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "  2^%d", b);
+     5a0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     5a3:	83 ec 04             	sub    $0x4,%esp
+     5a6:	56                   	push   %esi
+     5a7:	68 e1 15 00 00       	push   $0x15e1
+     5ac:	6a 01                	push   $0x1
+     5ae:	e8 cd 0c 00 00       	call   1280 <printf>
+    if(b < 10)
+     5b3:	83 c4 10             	add    $0x10,%esp
+     5b6:	83 fe 09             	cmp    $0x9,%esi
+     5b9:	0f 8e 21 01 00 00    	jle    6e0 <hist+0x1a0>
+    printf(1, "      ");
+     5bf:	83 ec 08             	sub    $0x8,%esp
+     5c2:	68 e8 15 00 00       	push   $0x15e8
+     5c7:	6a 01                	push   $0x1
+     5c9:	e8 b2 0c 00 00       	call   1280 <printf>
+    col(st->waithist[b], 9);
+     5ce:	8b 45 08             	mov    0x8(%ebp),%eax
+     5d1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(m = n, w--; m >= 10; m /= 10)
+     5d4:	83 c4 10             	add    $0x10,%esp
+    col(st->waithist[b], 9);
+     5d7:	8b 44 88 24          	mov    0x24(%eax,%ecx,4),%eax
+     5db:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for(m = n, w--; m >= 10; m /= 10)
+     5de:	83 f8 09             	cmp    $0x9,%eax
+     5e1:	0f 86 29 01 00 00    	jbe    710 <hist+0x1d0>
+     5e7:	89 c2                	mov    %eax,%edx
+     5e9:	be 08 00 00 00       	mov    $0x8,%esi
+     5ee:	66 90                	xchg   %ax,%ax
+     5f0:	89 d0                	mov    %edx,%eax
+     5f2:	89 d3                	mov    %edx,%ebx
+     5f4:	89 f1                	mov    %esi,%ecx
+    w--;
+     5f6:	83 ee 01             	sub    $0x1,%esi
+  for(m = n, w--; m >= 10; m /= 10)
+     5f9:	f7 e7                	mul    %edi
+     5fb:	c1 ea 03             	shr    $0x3,%edx
+     5fe:	83 fb 63             	cmp    $0x63,%ebx
+     601:	77 ed                	ja     5f0 <hist+0xb0>
+  while(w-- > 0)
+     603:	8d 59 fe             	lea    -0x2(%ecx),%ebx
+     606:	85 f6                	test   %esi,%esi
+     608:	7e 21                	jle    62b <hist+0xeb>
+     60a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(1, " ");
+     610:	83 ec 08             	sub    $0x8,%esp
+     613:	68 ed 15 00 00       	push   $0x15ed
+     618:	6a 01                	push   $0x1
+     61a:	e8 61 0c 00 00       	call   1280 <printf>
+  while(w-- > 0)
+     61f:	89 d8                	mov    %ebx,%eax
+     621:	83 c4 10             	add    $0x10,%esp
+     624:	83 eb 01             	sub    $0x1,%ebx
+     627:	85 c0                	test   %eax,%eax
+     629:	7f e5                	jg     610 <hist+0xd0>
+  printf(1, " %d", n);
+     62b:	83 ec 04             	sub    $0x4,%esp
+     62e:	ff 75 e0             	push   -0x20(%ebp)
+     631:	68 a8 15 00 00       	push   $0x15a8
+     636:	6a 01                	push   $0x1
+     638:	e8 43 0c 00 00       	call   1280 <printf>
+    col(st->holdhist[b], 9);
+     63d:	8b 45 08             	mov    0x8(%ebp),%eax
+     640:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  for(m = n, w--; m >= 10; m /= 10)
+     643:	83 c4 10             	add    $0x10,%esp
+    col(st->holdhist[b], 9);
+     646:	8b 84 88 a4 00 00 00 	mov    0xa4(%eax,%ecx,4),%eax
+     64d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for(m = n, w--; m >= 10; m /= 10)
+     650:	83 f8 09             	cmp    $0x9,%eax
+     653:	0f 86 a7 00 00 00    	jbe    700 <hist+0x1c0>
+     659:	89 c2                	mov    %eax,%edx
+     65b:	be 08 00 00 00       	mov    $0x8,%esi
+     660:	89 d0                	mov    %edx,%eax
+     662:	89 d3                	mov    %edx,%ebx
+     664:	89 f1                	mov    %esi,%ecx
+    w--;
+     666:	83 ee 01             	sub    $0x1,%esi
+  for(m = n, w--; m >= 10; m /= 10)
+     669:	f7 e7                	mul    %edi
+     66b:	c1 ea 03             	shr    $0x3,%edx
+     66e:	83 fb 63             	cmp    $0x63,%ebx
+     671:	77 ed                	ja     660 <hist+0x120>
+  while(w-- > 0)
+     673:	8d 59 fe             	lea    -0x2(%ecx),%ebx
+     676:	85 f6                	test   %esi,%esi
+     678:	7e 21                	jle    69b <hist+0x15b>
+     67a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(1, " ");
+     680:	83 ec 08             	sub    $0x8,%esp
+     683:	68 ed 15 00 00       	push   $0x15ed
+     688:	6a 01                	push   $0x1
+     68a:	e8 f1 0b 00 00       	call   1280 <printf>
+  while(w-- > 0)
+     68f:	89 d8                	mov    %ebx,%eax
+     691:	83 c4 10             	add    $0x10,%esp
+     694:	83 eb 01             	sub    $0x1,%ebx
+     697:	85 c0                	test   %eax,%eax
+     699:	7f e5                	jg     680 <hist+0x140>
+  printf(1, " %d", n);
+     69b:	83 ec 04             	sub    $0x4,%esp
+     69e:	ff 75 e0             	push   -0x20(%ebp)
+     6a1:	68 a8 15 00 00       	push   $0x15a8
+     6a6:	6a 01                	push   $0x1
+     6a8:	e8 d3 0b 00 00       	call   1280 <printf>
+    printf(1, "\n");
+     6ad:	58                   	pop    %eax
+     6ae:	5a                   	pop    %edx
+     6af:	68 c5 15 00 00       	push   $0x15c5
+     6b4:	6a 01                	push   $0x1
+     6b6:	e8 c5 0b 00 00       	call   1280 <printf>
+  for(b = 0; b <= top; b++){
+     6bb:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+     6bf:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+     6c2:	83 c4 10             	add    $0x10,%esp
+     6c5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     6c8:	39 c8                	cmp    %ecx,%eax
+     6ca:	0f 85 d0 fe ff ff    	jne    5a0 <hist+0x60>
+}
+     6d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     6d3:	5b                   	pop    %ebx
+     6d4:	5e                   	pop    %esi
+     6d5:	5f                   	pop    %edi
+     6d6:	5d                   	pop    %ebp
+     6d7:	c3                   	ret
+     6d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6df:	90                   	nop
+      printf(1, " ");
+     6e0:	83 ec 08             	sub    $0x8,%esp
+     6e3:	68 ed 15 00 00       	push   $0x15ed
+     6e8:	6a 01                	push   $0x1
+     6ea:	e8 91 0b 00 00       	call   1280 <printf>
+     6ef:	83 c4 10             	add    $0x10,%esp
+     6f2:	e9 c8 fe ff ff       	jmp    5bf <hist+0x7f>
+     6f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6fe:	66 90                	xchg   %ax,%ax
+  while(w-- > 0)
+     700:	bb 07 00 00 00       	mov    $0x7,%ebx
+     705:	e9 76 ff ff ff       	jmp    680 <hist+0x140>
+     70a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     710:	bb 07 00 00 00       	mov    $0x7,%ebx
+     715:	e9 f6 fe ff ff       	jmp    610 <hist+0xd0>
+     71a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000720 <profile>:
+{
+     720:	55                   	push   %ebp
+     721:	89 e5                	mov    %esp,%ebp
+     723:	57                   	push   %edi
+     724:	56                   	push   %esi
+     725:	53                   	push   %ebx
+     726:	83 ec 28             	sub    $0x28,%esp
+     729:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  lockprof(1);
+     72c:	6a 01                	push   $0x1
+     72e:	e8 56 0a 00 00       	call   1189 <lockprof>
+  run(argv);
+     733:	89 1c 24             	mov    %ebx,(%esp)
+     736:	e8 b5 fb ff ff       	call   2f0 <run>
+  lockprof(0);
+     73b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     742:	e8 42 0a 00 00       	call   1189 <lockprof>
+  nsite = getlockprof(site, NSITE);
+     747:	59                   	pop    %ecx
+     748:	5b                   	pop    %ebx
+     749:	68 00 01 00 00       	push   $0x100
+     74e:	68 80 1b 00 00       	push   $0x1b80
+     753:	e8 4e 0a 00 00       	call   11a6 <getlockprof>
+     758:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  n = getlockstat(cur, NSTAT);
+     75b:	5e                   	pop    %esi
+     75c:	5f                   	pop    %edi
+     75d:	6a 40                	push   $0x40
+     75f:	68 80 47 01 00       	push   $0x14780
+     764:	e8 03 0a 00 00       	call   116c <getlockstat>
+  for(i = 0; i < n; i++)
+     769:	83 c4 10             	add    $0x10,%esp
+  n = getlockstat(cur, NSTAT);
+     76c:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < n; i++)
+     76e:	85 c0                	test   %eax,%eax
+     770:	0f 8e 34 03 00 00    	jle    aaa <profile+0x38a>
+     776:	69 f0 24 01 00 00    	imul   $0x124,%eax,%esi
+     77c:	b9 1c 00 00 00       	mov    $0x1c,%ecx
+     781:	83 c6 1c             	add    $0x1c,%esi
+     784:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    cur[i].spin -= old[i].spin;
+     788:	8b 81 80 47 01 00    	mov    0x14780(%ecx),%eax
+     78e:	8b 91 84 47 01 00    	mov    0x14784(%ecx),%edx
+     794:	2b 81 80 90 01 00    	sub    0x19080(%ecx),%eax
+     79a:	1b 91 84 90 01 00    	sbb    0x19084(%ecx),%edx
+  for(i = 0; i < n; i++)
+     7a0:	81 c1 24 01 00 00    	add    $0x124,%ecx
+    cur[i].spin -= old[i].spin;
+     7a6:	89 81 5c 46 01 00    	mov    %eax,0x1465c(%ecx)
+     7ac:	89 91 60 46 01 00    	mov    %edx,0x14660(%ecx)
+  for(i = 0; i < n; i++)
+     7b2:	39 ce                	cmp    %ecx,%esi
+     7b4:	75 d2                	jne    788 <profile+0x68>
+  sortsite(nsite);
+     7b6:	8b 7d dc             	mov    -0x24(%ebp),%edi
+     7b9:	83 ec 0c             	sub    $0xc,%esp
+     7bc:	57                   	push   %edi
+     7bd:	e8 7e fc ff ff       	call   440 <sortsite>
+  printf(1, "PC        LOCK               ACQUIRE   CONTEND WAIT-KCYC HOLD-KCYC\n");
+     7c2:	58                   	pop    %eax
+     7c3:	5a                   	pop    %edx
+     7c4:	68 20 16 00 00       	push   $0x1620
+     7c9:	6a 01                	push   $0x1
+     7cb:	e8 b0 0a 00 00       	call   1280 <printf>
+  for(i = 0; i < nsite && i < NTOP; i++){
+     7d0:	83 c4 10             	add    $0x10,%esp
+     7d3:	85 ff                	test   %edi,%edi
+     7d5:	0f 8e 03 03 00 00    	jle    ade <profile+0x3be>
+     7db:	c7 45 e4 84 1b 00 00 	movl   $0x1b84,-0x1c(%ebp)
+     7e2:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  for(m = n, w--; m >= 10; m /= 10)
+     7e9:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+     7ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, "%x", site[i].pc);
+     7f0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     7f3:	83 ec 04             	sub    $0x4,%esp
+  for(w -= strlen(s); w > 0; w--)
+     7f6:	bb 10 00 00 00       	mov    $0x10,%ebx
+    printf(1, "%x", site[i].pc);
+     7fb:	ff 77 fc             	push   -0x4(%edi)
+     7fe:	68 ef 15 00 00       	push   $0x15ef
+     803:	6a 01                	push   $0x1
+     805:	e8 76 0a 00 00       	call   1280 <printf>
+  printf(1, " %s", s);
+     80a:	83 c4 0c             	add    $0xc,%esp
+     80d:	57                   	push   %edi
+     80e:	68 ac 15 00 00       	push   $0x15ac
+     813:	6a 01                	push   $0x1
+     815:	e8 66 0a 00 00       	call   1280 <printf>
+  for(w -= strlen(s); w > 0; w--)
+     81a:	89 3c 24             	mov    %edi,(%esp)
+     81d:	e8 5e 03 00 00       	call   b80 <strlen>
+     822:	83 c4 10             	add    $0x10,%esp
+     825:	29 c3                	sub    %eax,%ebx
+     827:	85 db                	test   %ebx,%ebx
+     829:	7e 1c                	jle    847 <profile+0x127>
+     82b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     82f:	90                   	nop
+    printf(1, " ");
+     830:	83 ec 08             	sub    $0x8,%esp
+     833:	68 ed 15 00 00       	push   $0x15ed
+     838:	6a 01                	push   $0x1
+     83a:	e8 41 0a 00 00       	call   1280 <printf>
+  for(w -= strlen(s); w > 0; w--)
+     83f:	83 c4 10             	add    $0x10,%esp
+     842:	83 eb 01             	sub    $0x1,%ebx
+     845:	75 e9                	jne    830 <profile+0x110>
+    col(site[i].nacquire, 9);
+     847:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     84a:	8b 78 10             	mov    0x10(%eax),%edi
+  for(m = n, w--; m >= 10; m /= 10)
+     84d:	83 ff 09             	cmp    $0x9,%edi
+     850:	0f 86 4a 02 00 00    	jbe    aa0 <profile+0x380>
+     856:	89 fa                	mov    %edi,%edx
+     858:	bb 08 00 00 00       	mov    $0x8,%ebx
+     85d:	8d 76 00             	lea    0x0(%esi),%esi
+     860:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+     865:	89 d6                	mov    %edx,%esi
+     867:	89 d9                	mov    %ebx,%ecx
+    w--;
+     869:	83 eb 01             	sub    $0x1,%ebx
+  for(m = n, w--; m >= 10; m /= 10)
+     86c:	f7 e2                	mul    %edx
+     86e:	c1 ea 03             	shr    $0x3,%edx
+     871:	83 fe 63             	cmp    $0x63,%esi
+     874:	77 ea                	ja     860 <profile+0x140>
+  while(w-- > 0)
+     876:	8d 71 fe             	lea    -0x2(%ecx),%esi
+     879:	85 db                	test   %ebx,%ebx
+     87b:	7e 1e                	jle    89b <profile+0x17b>
+     87d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, " ");
+     880:	83 ec 08             	sub    $0x8,%esp
+     883:	68 ed 15 00 00       	push   $0x15ed
+     888:	6a 01                	push   $0x1
+     88a:	e8 f1 09 00 00       	call   1280 <printf>
+  while(w-- > 0)
+     88f:	89 f0                	mov    %esi,%eax
+     891:	83 c4 10             	add    $0x10,%esp
+     894:	83 ee 01             	sub    $0x1,%esi
+     897:	85 c0                	test   %eax,%eax
+     899:	7f e5                	jg     880 <profile+0x160>
+  printf(1, " %d", n);
+     89b:	83 ec 04             	sub    $0x4,%esp
+     89e:	57                   	push   %edi
+     89f:	68 a8 15 00 00       	push   $0x15a8
+     8a4:	6a 01                	push   $0x1
+     8a6:	e8 d5 09 00 00       	call   1280 <printf>
+    col(site[i].ncontend, 9);
+     8ab:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for(m = n, w--; m >= 10; m /= 10)
+     8ae:	83 c4 10             	add    $0x10,%esp
+    col(site[i].ncontend, 9);
+     8b1:	8b 78 14             	mov    0x14(%eax),%edi
+  for(m = n, w--; m >= 10; m /= 10)
+     8b4:	83 ff 09             	cmp    $0x9,%edi
+     8b7:	0f 86 d3 01 00 00    	jbe    a90 <profile+0x370>
+     8bd:	89 fa                	mov    %edi,%edx
+     8bf:	bb 08 00 00 00       	mov    $0x8,%ebx
+     8c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     8c8:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+     8cd:	89 d6                	mov    %edx,%esi
+     8cf:	89 d9                	mov    %ebx,%ecx
+    w--;
+     8d1:	83 eb 01             	sub    $0x1,%ebx
+  for(m = n, w--; m >= 10; m /= 10)
+     8d4:	f7 e2                	mul    %edx
+     8d6:	c1 ea 03             	shr    $0x3,%edx
+     8d9:	83 fe 63             	cmp    $0x63,%esi
+     8dc:	77 ea                	ja     8c8 <profile+0x1a8>
+  while(w-- > 0)
+     8de:	8d 71 fe             	lea    -0x2(%ecx),%esi
+     8e1:	85 db                	test   %ebx,%ebx
+     8e3:	7e 1e                	jle    903 <profile+0x1e3>
+     8e5:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, " ");
+     8e8:	83 ec 08             	sub    $0x8,%esp
+     8eb:	68 ed 15 00 00       	push   $0x15ed
+     8f0:	6a 01                	push   $0x1
+     8f2:	e8 89 09 00 00       	call   1280 <printf>
+  while(w-- > 0)
+     8f7:	89 f0                	mov    %esi,%eax
+     8f9:	83 c4 10             	add    $0x10,%esp
+     8fc:	83 ee 01             	sub    $0x1,%esi
+     8ff:	85 c0                	test   %eax,%eax
+     901:	7f e5                	jg     8e8 <profile+0x1c8>
+  printf(1, " %d", n);
+     903:	83 ec 04             	sub    $0x4,%esp
+     906:	57                   	push   %edi
+     907:	68 a8 15 00 00       	push   $0x15a8
+     90c:	6a 01                	push   $0x1
+     90e:	e8 6d 09 00 00       	call   1280 <printf>
+    col((uint)(site[i].wait >> 10), 9);
+     913:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for(m = n, w--; m >= 10; m /= 10)
+     916:	83 c4 10             	add    $0x10,%esp
+    col((uint)(site[i].wait >> 10), 9);
+     919:	8b 50 1c             	mov    0x1c(%eax),%edx
+     91c:	8b 40 18             	mov    0x18(%eax),%eax
+     91f:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+     923:	89 c6                	mov    %eax,%esi
+  for(m = n, w--; m >= 10; m /= 10)
+     925:	83 f8 09             	cmp    $0x9,%eax
+     928:	0f 86 52 01 00 00    	jbe    a80 <profile+0x360>
+     92e:	89 c2                	mov    %eax,%edx
+     930:	bf 08 00 00 00       	mov    $0x8,%edi
+     935:	8d 76 00             	lea    0x0(%esi),%esi
+     938:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+     93d:	89 d3                	mov    %edx,%ebx
+     93f:	89 f9                	mov    %edi,%ecx
+    w--;
+     941:	83 ef 01             	sub    $0x1,%edi
+  for(m = n, w--; m >= 10; m /= 10)
+     944:	f7 e2                	mul    %edx
+     946:	c1 ea 03             	shr    $0x3,%edx
+     949:	83 fb 63             	cmp    $0x63,%ebx
+     94c:	77 ea                	ja     938 <profile+0x218>
+  while(w-- > 0)
+     94e:	8d 59 fe             	lea    -0x2(%ecx),%ebx
+     951:	85 ff                	test   %edi,%edi
+     953:	7e 1e                	jle    973 <profile+0x253>
+     955:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, " ");
+     958:	83 ec 08             	sub    $0x8,%esp
+     95b:	68 ed 15 00 00       	push   $0x15ed
+     960:	6a 01                	push   $0x1
+     962:	e8 19 09 00 00       	call   1280 <printf>
+  while(w-- > 0)
+     967:	89 d8                	mov    %ebx,%eax
+     969:	83 c4 10             	add    $0x10,%esp
+     96c:	83 eb 01             	sub    $0x1,%ebx
+     96f:	85 c0                	test   %eax,%eax
+     971:	7f e5                	jg     958 <profile+0x238>
+  printf(1, " %d", n);
+     973:	83 ec 04             	sub    $0x4,%esp
+     976:	56                   	push   %esi
+     977:	68 a8 15 00 00       	push   $0x15a8
+     97c:	6a 01                	push   $0x1
+     97e:	e8 fd 08 00 00       	call   1280 <printf>
+    col((uint)(site[i].hold >> 10), 9);
+     983:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for(m = n, w--; m >= 10; m /= 10)
+     986:	83 c4 10             	add    $0x10,%esp
+    col((uint)(site[i].hold >> 10), 9);
+     989:	8b 50 24             	mov    0x24(%eax),%edx
+     98c:	8b 40 20             	mov    0x20(%eax),%eax
+     98f:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+     993:	89 c6                	mov    %eax,%esi
+  for(m = n, w--; m >= 10; m /= 10)
+     995:	83 f8 09             	cmp    $0x9,%eax
+     998:	0f 86 d2 00 00 00    	jbe    a70 <profile+0x350>
+     99e:	89 c2                	mov    %eax,%edx
+     9a0:	bf 08 00 00 00       	mov    $0x8,%edi
+     9a5:	8d 76 00             	lea    0x0(%esi),%esi
+     9a8:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+     9ad:	89 d3                	mov    %edx,%ebx
+     9af:	89 f9                	mov    %edi,%ecx
+    w--;
+     9b1:	83 ef 01             	sub    $0x1,%edi
+  for(m = n, w--; m >= 10; m /= 10)
+     9b4:	f7 e2                	mul    %edx
+     9b6:	c1 ea 03             	shr    $0x3,%edx
+     9b9:	83 fb 63             	cmp    $0x63,%ebx
+     9bc:	77 ea                	ja     9a8 <profile+0x288>
+  while(w-- > 0)
+     9be:	8d 59 fe             	lea    -0x2(%ecx),%ebx
+     9c1:	85 ff                	test   %edi,%edi
+     9c3:	7e 1e                	jle    9e3 <profile+0x2c3>
+     9c5:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, " ");
+     9c8:	83 ec 08             	sub    $0x8,%esp
+     9cb:	68 ed 15 00 00       	push   $0x15ed
+     9d0:	6a 01                	push   $0x1
+     9d2:	e8 a9 08 00 00       	call   1280 <printf>
+  while(w-- > 0)
+     9d7:	89 d8                	mov    %ebx,%eax
+     9d9:	83 c4 10             	add    $0x10,%esp
+     9dc:	83 eb 01             	sub    $0x1,%ebx
+     9df:	85 c0                	test   %eax,%eax
+     9e1:	7f e5                	jg     9c8 <profile+0x2a8>
+  printf(1, " %d", n);
+     9e3:	83 ec 04             	sub    $0x4,%esp
+     9e6:	56                   	push   %esi
+     9e7:	68 a8 15 00 00       	push   $0x15a8
+     9ec:	6a 01                	push   $0x1
+     9ee:	e8 8d 08 00 00       	call   1280 <printf>
+    printf(1, "\n");
+     9f3:	59                   	pop    %ecx
+     9f4:	5b                   	pop    %ebx
+     9f5:	68 c5 15 00 00       	push   $0x15c5
+     9fa:	6a 01                	push   $0x1
+     9fc:	e8 7f 08 00 00       	call   1280 <printf>
+  for(i = 0; i < nsite && i < NTOP; i++){
+     a01:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+     a05:	83 c4 10             	add    $0x10,%esp
+     a08:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     a0b:	81 45 e4 2c 01 00 00 	addl   $0x12c,-0x1c(%ebp)
+     a12:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+     a15:	7e 09                	jle    a20 <profile+0x300>
+     a17:	83 f8 09             	cmp    $0x9,%eax
+     a1a:	0f 8e d0 fd ff ff    	jle    7f0 <profile+0xd0>
+  sortstat(n);
+     a20:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+     a23:	83 ec 0c             	sub    $0xc,%esp
+     a26:	53                   	push   %ebx
+     a27:	e8 24 f9 ff ff       	call   350 <sortstat>
+  for(i = 0; i < n && i < NHIST; i++)
+     a2c:	83 c4 10             	add    $0x10,%esp
+     a2f:	85 db                	test   %ebx,%ebx
+     a31:	7e 21                	jle    a54 <profile+0x334>
+     a33:	be 80 47 01 00       	mov    $0x14780,%esi
+     a38:	31 ff                	xor    %edi,%edi
+    if(cur[i].spin)
+     a3a:	8b 46 20             	mov    0x20(%esi),%eax
+     a3d:	0b 46 1c             	or     0x1c(%esi),%eax
+     a40:	75 1e                	jne    a60 <profile+0x340>
+  for(i = 0; i < n && i < NHIST; i++)
+     a42:	83 c7 01             	add    $0x1,%edi
+     a45:	81 c6 24 01 00 00    	add    $0x124,%esi
+     a4b:	39 fb                	cmp    %edi,%ebx
+     a4d:	7e 05                	jle    a54 <profile+0x334>
+     a4f:	83 ff 02             	cmp    $0x2,%edi
+     a52:	7e e6                	jle    a3a <profile+0x31a>
+}
+     a54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a57:	5b                   	pop    %ebx
+     a58:	5e                   	pop    %esi
+     a59:	5f                   	pop    %edi
+     a5a:	5d                   	pop    %ebp
+     a5b:	c3                   	ret
+     a5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      hist(&cur[i]);
+     a60:	83 ec 0c             	sub    $0xc,%esp
+     a63:	56                   	push   %esi
+     a64:	e8 d7 fa ff ff       	call   540 <hist>
+     a69:	83 c4 10             	add    $0x10,%esp
+     a6c:	eb d4                	jmp    a42 <profile+0x322>
+     a6e:	66 90                	xchg   %ax,%ax
+  while(w-- > 0)
+     a70:	bb 07 00 00 00       	mov    $0x7,%ebx
+     a75:	e9 4e ff ff ff       	jmp    9c8 <profile+0x2a8>
+     a7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     a80:	bb 07 00 00 00       	mov    $0x7,%ebx
+     a85:	e9 ce fe ff ff       	jmp    958 <profile+0x238>
+     a8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     a90:	be 07 00 00 00       	mov    $0x7,%esi
+     a95:	e9 4e fe ff ff       	jmp    8e8 <profile+0x1c8>
+     a9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     aa0:	be 07 00 00 00       	mov    $0x7,%esi
+     aa5:	e9 d6 fd ff ff       	jmp    880 <profile+0x160>
+  sortsite(nsite);
+     aaa:	8b 7d dc             	mov    -0x24(%ebp),%edi
+     aad:	83 ec 0c             	sub    $0xc,%esp
+     ab0:	57                   	push   %edi
+     ab1:	e8 8a f9 ff ff       	call   440 <sortsite>
+  printf(1, "PC        LOCK               ACQUIRE   CONTEND WAIT-KCYC HOLD-KCYC\n");
+     ab6:	58                   	pop    %eax
+     ab7:	5a                   	pop    %edx
+     ab8:	68 20 16 00 00       	push   $0x1620
+     abd:	6a 01                	push   $0x1
+     abf:	e8 bc 07 00 00       	call   1280 <printf>
+  for(i = 0; i < nsite && i < NTOP; i++){
+     ac4:	83 c4 10             	add    $0x10,%esp
+     ac7:	85 ff                	test   %edi,%edi
+     ac9:	0f 8f 0c fd ff ff    	jg     7db <profile+0xbb>
+  sortstat(n);
+     acf:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     ad2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ad5:	5b                   	pop    %ebx
+     ad6:	5e                   	pop    %esi
+     ad7:	5f                   	pop    %edi
+     ad8:	5d                   	pop    %ebp
+  sortstat(n);
+     ad9:	e9 72 f8 ff ff       	jmp    350 <sortstat>
+     ade:	83 ec 0c             	sub    $0xc,%esp
+     ae1:	53                   	push   %ebx
+     ae2:	e8 69 f8 ff ff       	call   350 <sortstat>
+     ae7:	83 c4 10             	add    $0x10,%esp
+     aea:	e9 44 ff ff ff       	jmp    a33 <profile+0x313>
+     aef:	90                   	nop
+
+00000af0 <strcpy>:
+#include "date.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     af0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     af1:	31 c0                	xor    %eax,%eax
+{
+     af3:	89 e5                	mov    %esp,%ebp
+     af5:	53                   	push   %ebx
+     af6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     af9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     afc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     b00:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     b04:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     b07:	83 c0 01             	add    $0x1,%eax
+     b0a:	84 d2                	test   %dl,%dl
+     b0c:	75 f2                	jne    b00 <strcpy+0x10>
+    ;
+  return os;
+}
+     b0e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b11:	89 c8                	mov    %ecx,%eax
+     b13:	c9                   	leave
+     b14:	c3                   	ret
+     b15:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b20 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     b20:	55                   	push   %ebp
+     b21:	89 e5                	mov    %esp,%ebp
+     b23:	53                   	push   %ebx
+     b24:	8b 55 08             	mov    0x8(%ebp),%edx
+     b27:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     b2a:	0f b6 02             	movzbl (%edx),%eax
+     b2d:	84 c0                	test   %al,%al
+     b2f:	75 17                	jne    b48 <strcmp+0x28>
+     b31:	eb 3a                	jmp    b6d <strcmp+0x4d>
+     b33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b37:	90                   	nop
+     b38:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     b3c:	83 c2 01             	add    $0x1,%edx
+     b3f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     b42:	84 c0                	test   %al,%al
+     b44:	74 1a                	je     b60 <strcmp+0x40>
+    p++, q++;
+     b46:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     b48:	0f b6 19             	movzbl (%ecx),%ebx
+     b4b:	38 c3                	cmp    %al,%bl
+     b4d:	74 e9                	je     b38 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     b4f:	29 d8                	sub    %ebx,%eax
+}
+     b51:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b54:	c9                   	leave
+     b55:	c3                   	ret
+     b56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b5d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     b60:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     b64:	31 c0                	xor    %eax,%eax
+     b66:	29 d8                	sub    %ebx,%eax
+}
+     b68:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b6b:	c9                   	leave
+     b6c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     b6d:	0f b6 19             	movzbl (%ecx),%ebx
+     b70:	31 c0                	xor    %eax,%eax
+     b72:	eb db                	jmp    b4f <strcmp+0x2f>
+     b74:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b7f:	90                   	nop
+
+00000b80 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     b80:	55                   	push   %ebp
+     b81:	89 e5                	mov    %esp,%ebp
+     b83:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     b86:	80 3a 00             	cmpb   $0x0,(%edx)
+     b89:	74 15                	je     ba0 <strlen+0x20>
+     b8b:	31 c0                	xor    %eax,%eax
+     b8d:	8d 76 00             	lea    0x0(%esi),%esi
+     b90:	83 c0 01             	add    $0x1,%eax
+     b93:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     b97:	89 c1                	mov    %eax,%ecx
+     b99:	75 f5                	jne    b90 <strlen+0x10>
+    ;
+  return n;
+}
+     b9b:	89 c8                	mov    %ecx,%eax
+     b9d:	5d                   	pop    %ebp
+     b9e:	c3                   	ret
+     b9f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     ba0:	31 c9                	xor    %ecx,%ecx
+}
+     ba2:	5d                   	pop    %ebp
+     ba3:	89 c8                	mov    %ecx,%eax
+     ba5:	c3                   	ret
+     ba6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000bb0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     bb0:	55                   	push   %ebp
+     bb1:	89 e5                	mov    %esp,%ebp
+     bb3:	57                   	push   %edi
+     bb4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     bb7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     bba:	8b 45 0c             	mov    0xc(%ebp),%eax
+     bbd:	89 d7                	mov    %edx,%edi
+     bbf:	fc                   	cld
+     bc0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     bc2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     bc5:	89 d0                	mov    %edx,%eax
+     bc7:	c9                   	leave
+     bc8:	c3                   	ret
+     bc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000bd0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     bd0:	55                   	push   %ebp
+     bd1:	89 e5                	mov    %esp,%ebp
+     bd3:	8b 45 08             	mov    0x8(%ebp),%eax
+     bd6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     bda:	0f b6 10             	movzbl (%eax),%edx
+     bdd:	84 d2                	test   %dl,%dl
+     bdf:	75 12                	jne    bf3 <strchr+0x23>
+     be1:	eb 1d                	jmp    c00 <strchr+0x30>
+     be3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     be7:	90                   	nop
+     be8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     bec:	83 c0 01             	add    $0x1,%eax
+     bef:	84 d2                	test   %dl,%dl
+     bf1:	74 0d                	je     c00 <strchr+0x30>
+    if(*s == c)
+     bf3:	38 d1                	cmp    %dl,%cl
+     bf5:	75 f1                	jne    be8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     bf7:	5d                   	pop    %ebp
+     bf8:	c3                   	ret
+     bf9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     c00:	31 c0                	xor    %eax,%eax
+}
+     c02:	5d                   	pop    %ebp
+     c03:	c3                   	ret
+     c04:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c0f:	90                   	nop
+
+00000c10 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     c10:	55                   	push   %ebp
+     c11:	89 e5                	mov    %esp,%ebp
+     c13:	57                   	push   %edi
+     c14:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     c15:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     c18:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     c19:	31 db                	xor    %ebx,%ebx
+{
+     c1b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     c1e:	eb 27                	jmp    c47 <gets+0x37>
+    cc = read(0, &c, 1);
+     c20:	83 ec 04             	sub    $0x4,%esp
+     c23:	6a 01                	push   $0x1
+     c25:	56                   	push   %esi
+     c26:	6a 00                	push   $0x0
+     c28:	e8 13 02 00 00       	call   e40 <read>
+    if(cc < 1)
+     c2d:	83 c4 10             	add    $0x10,%esp
+     c30:	85 c0                	test   %eax,%eax
+     c32:	7e 1d                	jle    c51 <gets+0x41>
+      break;
+    buf[i++] = c;
+     c34:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     c38:	8b 55 08             	mov    0x8(%ebp),%edx
+     c3b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     c3f:	3c 0a                	cmp    $0xa,%al
+     c41:	74 10                	je     c53 <gets+0x43>
+     c43:	3c 0d                	cmp    $0xd,%al
+     c45:	74 0c                	je     c53 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     c47:	89 df                	mov    %ebx,%edi
+     c49:	83 c3 01             	add    $0x1,%ebx
+     c4c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     c4f:	7c cf                	jl     c20 <gets+0x10>
+     c51:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     c53:	8b 45 08             	mov    0x8(%ebp),%eax
+     c56:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     c5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c5d:	5b                   	pop    %ebx
+     c5e:	5e                   	pop    %esi
+     c5f:	5f                   	pop    %edi
+     c60:	5d                   	pop    %ebp
+     c61:	c3                   	ret
+     c62:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000c70 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     c70:	55                   	push   %ebp
+     c71:	89 e5                	mov    %esp,%ebp
+     c73:	56                   	push   %esi
+     c74:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     c75:	83 ec 08             	sub    $0x8,%esp
+     c78:	6a 00                	push   $0x0
+     c7a:	ff 75 08             	push   0x8(%ebp)
+     c7d:	e8 4f 02 00 00       	call   ed1 <open>
+  if(fd < 0)
+     c82:	83 c4 10             	add    $0x10,%esp
+     c85:	85 c0                	test   %eax,%eax
+     c87:	78 27                	js     cb0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     c89:	83 ec 08             	sub    $0x8,%esp
+     c8c:	ff 75 0c             	push   0xc(%ebp)
+     c8f:	89 c3                	mov    %eax,%ebx
+     c91:	50                   	push   %eax
+     c92:	e8 91 02 00 00       	call   f28 <fstat>
+  close(fd);
+     c97:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     c9a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     c9c:	e8 d9 01 00 00       	call   e7a <close>
+  return r;
+     ca1:	83 c4 10             	add    $0x10,%esp
+}
+     ca4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ca7:	89 f0                	mov    %esi,%eax
+     ca9:	5b                   	pop    %ebx
+     caa:	5e                   	pop    %esi
+     cab:	5d                   	pop    %ebp
+     cac:	c3                   	ret
+     cad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     cb0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     cb5:	eb ed                	jmp    ca4 <stat+0x34>
+     cb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cbe:	66 90                	xchg   %ax,%ax
+
+00000cc0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     cc0:	55                   	push   %ebp
+     cc1:	89 e5                	mov    %esp,%ebp
+     cc3:	53                   	push   %ebx
+     cc4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     cc7:	0f be 02             	movsbl (%edx),%eax
+     cca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     ccd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     cd0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     cd5:	77 1e                	ja     cf5 <atoi+0x35>
+     cd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cde:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     ce0:	83 c2 01             	add    $0x1,%edx
+     ce3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     ce6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     cea:	0f be 02             	movsbl (%edx),%eax
+     ced:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     cf0:	80 fb 09             	cmp    $0x9,%bl
+     cf3:	76 eb                	jbe    ce0 <atoi+0x20>
+  return n;
+}
+     cf5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     cf8:	89 c8                	mov    %ecx,%eax
+     cfa:	c9                   	leave
+     cfb:	c3                   	ret
+     cfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000d00 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     d00:	55                   	push   %ebp
+     d01:	89 e5                	mov    %esp,%ebp
+     d03:	57                   	push   %edi
+     d04:	56                   	push   %esi
+     d05:	8b 45 10             	mov    0x10(%ebp),%eax
+     d08:	8b 55 08             	mov    0x8(%ebp),%edx
+     d0b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     d0e:	85 c0                	test   %eax,%eax
+     d10:	7e 13                	jle    d25 <memmove+0x25>
+     d12:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     d14:	89 d7                	mov    %edx,%edi
+     d16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d1d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     d20:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     d21:	39 f8                	cmp    %edi,%eax
+     d23:	75 fb                	jne    d20 <memmove+0x20>
+  return vdst;
+}
+     d25:	5e                   	pop    %esi
+     d26:	89 d0                	mov    %edx,%eax
+     d28:	5f                   	pop    %edi
+     d29:	5d                   	pop    %ebp
+     d2a:	c3                   	ret
+     d2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d2f:	90                   	nop
+
+00000d30 <ugetpid>:
+// getpid() without a system call, from the page at UPROC.
+int
+ugetpid(void)
+{
+  return ((struct uproc*)UPROC)->pid;
+}
+     d30:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+     d35:	c3                   	ret
+     d36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d40 <uclocktime>:
+
+// clocktime() without a system call, from the page at UCLOCK.
+int
+uclocktime(struct timespec *ts)
+{
+     d40:	55                   	push   %ebp
+     d41:	89 e5                	mov    %esp,%ebp
+     d43:	57                   	push   %edi
+     d44:	56                   	push   %esi
+     d45:	53                   	push   %ebx
+     d46:	83 ec 1c             	sub    $0x1c,%esp
+  struct uclock *c = (struct uclock*)UCLOCK;
+
+  if(c->tscmult == 0)
+     d49:	8b 0d 08 f0 ff 7f    	mov    0x7ffff008,%ecx
+{
+     d4f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(c->tscmult == 0)
+     d52:	85 c9                	test   %ecx,%ecx
+     d54:	74 6a                	je     dc0 <uclocktime+0x80>
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+     d56:	0f 31                	rdtsc
+static inline void
+uclockread(struct uclock *c, uint64 tsc, struct timespec *ts)
+{
+  uint64 d, ns;
+
+  d = tsc - c->tscbase;
+     d58:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+     d5e:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+     d64:	89 c6                	mov    %eax,%esi
+  if((long long)d < 0)  // another CPU's TSC is a little behind
+     d66:	85 d2                	test   %edx,%edx
+     d68:	78 46                	js     db0 <uclocktime+0x70>
+    d = 0;
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+     d6a:	89 d0                	mov    %edx,%eax
+     d6c:	f7 e1                	mul    %ecx
+     d6e:	0f a4 c2 08          	shld   $0x8,%eax,%edx
+     d72:	c1 e0 08             	shl    $0x8,%eax
+     d75:	89 45 e0             	mov    %eax,-0x20(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+     d78:	89 f0                	mov    %esi,%eax
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+     d7a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+     d7d:	f7 e1                	mul    %ecx
+     d7f:	0f ac d0 18          	shrd   $0x18,%edx,%eax
+     d83:	c1 ea 18             	shr    $0x18,%edx
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+     d86:	03 45 e0             	add    -0x20(%ebp),%eax
+     d89:	13 55 e4             	adc    -0x1c(%ebp),%edx
+// linked with libgcc, so it cannot use 64-bit '/' or '%'.
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+  asm("divl %4" : "=a" (q), "=d" (r) : "a" ((uint)n), "d" ((uint)(n>>32)), "rm" (d));
+     d8c:	89 c7                	mov    %eax,%edi
+     d8e:	89 f8                	mov    %edi,%eax
+     d90:	b9 00 ca 9a 3b       	mov    $0x3b9aca00,%ecx
+     d95:	f7 f1                	div    %ecx
+  ts->sec = divl(ns, 1000000000, &ts->nsec);
+     d97:	89 03                	mov    %eax,(%ebx)
+    return clocktime(ts);
+  uclockread(c, rdtsc(), ts);
+  return 0;
+}
+     d99:	31 c0                	xor    %eax,%eax
+  *rem = r;
+     d9b:	89 53 04             	mov    %edx,0x4(%ebx)
+     d9e:	83 c4 1c             	add    $0x1c,%esp
+     da1:	5b                   	pop    %ebx
+     da2:	5e                   	pop    %esi
+     da3:	5f                   	pop    %edi
+     da4:	5d                   	pop    %ebp
+     da5:	c3                   	ret
+     da6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dad:	8d 76 00             	lea    0x0(%esi),%esi
+     db0:	31 d2                	xor    %edx,%edx
+     db2:	31 ff                	xor    %edi,%edi
+     db4:	eb d8                	jmp    d8e <uclocktime+0x4e>
+     db6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dbd:	8d 76 00             	lea    0x0(%esi),%esi
+     dc0:	83 c4 1c             	add    $0x1c,%esp
+     dc3:	5b                   	pop    %ebx
+     dc4:	5e                   	pop    %esi
+     dc5:	5f                   	pop    %edi
+     dc6:	5d                   	pop    %ebp
+    return clocktime(ts);
+     dc7:	e9 f2 02 00 00       	jmp    10be <clocktime>
+
+00000dcc <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+     dcc:	b8 01 00 00 00       	mov    $0x1,%eax
+     dd1:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     dd8:	00 00 00 
+     ddb:	74 09                	je     de6 <fork+0x1a>
+     ddd:	89 e1                	mov    %esp,%ecx
+     ddf:	ba e8 0d 00 00       	mov    $0xde8,%edx
+     de4:	0f 34                	sysenter
+     de6:	cd 40                	int    $0x40
+     de8:	c3                   	ret
+
+00000de9 <exit>:
+SYSCALL(exit)
+     de9:	b8 02 00 00 00       	mov    $0x2,%eax
+     dee:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     df5:	00 00 00 
+     df8:	74 09                	je     e03 <exit+0x1a>
+     dfa:	89 e1                	mov    %esp,%ecx
+     dfc:	ba 05 0e 00 00       	mov    $0xe05,%edx
+     e01:	0f 34                	sysenter
+     e03:	cd 40                	int    $0x40
+     e05:	c3                   	ret
+
+00000e06 <wait>:
+SYSCALL(wait)
+     e06:	b8 03 00 00 00       	mov    $0x3,%eax
+     e0b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     e12:	00 00 00 
+     e15:	74 09                	je     e20 <wait+0x1a>
+     e17:	89 e1                	mov    %esp,%ecx
+     e19:	ba 22 0e 00 00       	mov    $0xe22,%edx
+     e1e:	0f 34                	sysenter
+     e20:	cd 40                	int    $0x40
+     e22:	c3                   	ret
+
+00000e23 <pipe>:
+SYSCALL(pipe)
+     e23:	b8 04 00 00 00       	mov    $0x4,%eax
+     e28:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     e2f:	00 00 00 
+     e32:	74 09                	je     e3d <pipe+0x1a>
+     e34:	89 e1                	mov    %esp,%ecx
+     e36:	ba 3f 0e 00 00       	mov    $0xe3f,%edx
+     e3b:	0f 34                	sysenter
+     e3d:	cd 40                	int    $0x40
+     e3f:	c3                   	ret
+
+00000e40 <read>:
+SYSCALL(read)
+     e40:	b8 05 00 00 00       	mov    $0x5,%eax
+     e45:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     e4c:	00 00 00 
+     e4f:	74 09                	je     e5a <read+0x1a>
+     e51:	89 e1                	mov    %esp,%ecx
+     e53:	ba 5c 0e 00 00       	mov    $0xe5c,%edx
+     e58:	0f 34                	sysenter
+     e5a:	cd 40                	int    $0x40
+     e5c:	c3                   	ret
+
+00000e5d <write>:
+SYSCALL(write)
+     e5d:	b8 10 00 00 00       	mov    $0x10,%eax
+     e62:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     e69:	00 00 00 
+     e6c:	74 09                	je     e77 <write+0x1a>
+     e6e:	89 e1                	mov    %esp,%ecx
+     e70:	ba 79 0e 00 00       	mov    $0xe79,%edx
+     e75:	0f 34                	sysenter
+     e77:	cd 40                	int    $0x40
+     e79:	c3                   	ret
+
+00000e7a <close>:
+SYSCALL(close)
+     e7a:	b8 15 00 00 00       	mov    $0x15,%eax
+     e7f:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     e86:	00 00 00 
+     e89:	74 09                	je     e94 <close+0x1a>
+     e8b:	89 e1                	mov    %esp,%ecx
+     e8d:	ba 96 0e 00 00       	mov    $0xe96,%edx
+     e92:	0f 34                	sysenter
+     e94:	cd 40                	int    $0x40
+     e96:	c3                   	ret
+
+00000e97 <kill>:
+SYSCALL(kill)
+     e97:	b8 06 00 00 00       	mov    $0x6,%eax
+     e9c:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     ea3:	00 00 00 
+     ea6:	74 09                	je     eb1 <kill+0x1a>
+     ea8:	89 e1                	mov    %esp,%ecx
+     eaa:	ba b3 0e 00 00       	mov    $0xeb3,%edx
+     eaf:	0f 34                	sysenter
+     eb1:	cd 40                	int    $0x40
+     eb3:	c3                   	ret
+
+00000eb4 <exec>:
+SYSCALL(exec)
+     eb4:	b8 07 00 00 00       	mov    $0x7,%eax
+     eb9:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     ec0:	00 00 00 
+     ec3:	74 09                	je     ece <exec+0x1a>
+     ec5:	89 e1                	mov    %esp,%ecx
+     ec7:	ba d0 0e 00 00       	mov    $0xed0,%edx
+     ecc:	0f 34                	sysenter
+     ece:	cd 40                	int    $0x40
+     ed0:	c3                   	ret
+
+00000ed1 <open>:
+SYSCALL(open)
+     ed1:	b8 0f 00 00 00       	mov    $0xf,%eax
+     ed6:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     edd:	00 00 00 
+     ee0:	74 09                	je     eeb <open+0x1a>
+     ee2:	89 e1                	mov    %esp,%ecx
+     ee4:	ba ed 0e 00 00       	mov    $0xeed,%edx
+     ee9:	0f 34                	sysenter
+     eeb:	cd 40                	int    $0x40
+     eed:	c3                   	ret
+
+00000eee <mknod>:
+SYSCALL(mknod)
+     eee:	b8 11 00 00 00       	mov    $0x11,%eax
+     ef3:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     efa:	00 00 00 
+     efd:	74 09                	je     f08 <mknod+0x1a>
+     eff:	89 e1                	mov    %esp,%ecx
+     f01:	ba 0a 0f 00 00       	mov    $0xf0a,%edx
+     f06:	0f 34                	sysenter
+     f08:	cd 40                	int    $0x40
+     f0a:	c3                   	ret
+
+00000f0b <unlink>:
+SYSCALL(unlink)
+     f0b:	b8 12 00 00 00       	mov    $0x12,%eax
+     f10:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     f17:	00 00 00 
+     f1a:	74 09                	je     f25 <unlink+0x1a>
+     f1c:	89 e1                	mov    %esp,%ecx
+     f1e:	ba 27 0f 00 00       	mov    $0xf27,%edx
+     f23:	0f 34                	sysenter
+     f25:	cd 40                	int    $0x40
+     f27:	c3                   	ret
+
+00000f28 <fstat>:
+SYSCALL(fstat)
+     f28:	b8 08 00 00 00       	mov    $0x8,%eax
+     f2d:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     f34:	00 00 00 
+     f37:	74 09                	je     f42 <fstat+0x1a>
+     f39:	89 e1                	mov    %esp,%ecx
+     f3b:	ba 44 0f 00 00       	mov    $0xf44,%edx
+     f40:	0f 34                	sysenter
+     f42:	cd 40                	int    $0x40
+     f44:	c3                   	ret
+
+00000f45 <link>:
+SYSCALL(link)
+     f45:	b8 13 00 00 00       	mov    $0x13,%eax
+     f4a:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     f51:	00 00 00 
+     f54:	74 09                	je     f5f <link+0x1a>
+     f56:	89 e1                	mov    %esp,%ecx
+     f58:	ba 61 0f 00 00       	mov    $0xf61,%edx
+     f5d:	0f 34                	sysenter
+     f5f:	cd 40                	int    $0x40
+     f61:	c3                   	ret
+
+00000f62 <mkdir>:
+SYSCALL(mkdir)
+     f62:	b8 14 00 00 00       	mov    $0x14,%eax
+     f67:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     f6e:	00 00 00 
+     f71:	74 09                	je     f7c <mkdir+0x1a>
+     f73:	89 e1                	mov    %esp,%ecx
+     f75:	ba 7e 0f 00 00       	mov    $0xf7e,%edx
+     f7a:	0f 34                	sysenter
+     f7c:	cd 40                	int    $0x40
+     f7e:	c3                   	ret
+
+00000f7f <chdir>:
+SYSCALL(chdir)
+     f7f:	b8 09 00 00 00       	mov    $0x9,%eax
+     f84:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     f8b:	00 00 00 
+     f8e:	74 09                	je     f99 <chdir+0x1a>
+     f90:	89 e1                	mov    %esp,%ecx
+     f92:	ba 9b 0f 00 00       	mov    $0xf9b,%edx
+     f97:	0f 34                	sysenter
+     f99:	cd 40                	int    $0x40
+     f9b:	c3                   	ret
+
+00000f9c <dup>:
+SYSCALL(dup)
+     f9c:	b8 0a 00 00 00       	mov    $0xa,%eax
+     fa1:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     fa8:	00 00 00 
+     fab:	74 09                	je     fb6 <dup+0x1a>
+     fad:	89 e1                	mov    %esp,%ecx
+     faf:	ba b8 0f 00 00       	mov    $0xfb8,%edx
+     fb4:	0f 34                	sysenter
+     fb6:	cd 40                	int    $0x40
+     fb8:	c3                   	ret
+
+00000fb9 <getpid>:
+SYSCALL(getpid)
+     fb9:	b8 0b 00 00 00       	mov    $0xb,%eax
+     fbe:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     fc5:	00 00 00 
+     fc8:	74 09                	je     fd3 <getpid+0x1a>
+     fca:	89 e1                	mov    %esp,%ecx
+     fcc:	ba d5 0f 00 00       	mov    $0xfd5,%edx
+     fd1:	0f 34                	sysenter
+     fd3:	cd 40                	int    $0x40
+     fd5:	c3                   	ret
+
+00000fd6 <sbrk>:
+SYSCALL(sbrk)
+     fd6:	b8 0c 00 00 00       	mov    $0xc,%eax
+     fdb:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     fe2:	00 00 00 
+     fe5:	74 09                	je     ff0 <sbrk+0x1a>
+     fe7:	89 e1                	mov    %esp,%ecx
+     fe9:	ba f2 0f 00 00       	mov    $0xff2,%edx
+     fee:	0f 34                	sysenter
+     ff0:	cd 40                	int    $0x40
+     ff2:	c3                   	ret
+
+00000ff3 <sleep>:
+SYSCALL(sleep)
+     ff3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     ff8:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     fff:	00 00 00 
+    1002:	74 09                	je     100d <sleep+0x1a>
+    1004:	89 e1                	mov    %esp,%ecx
+    1006:	ba 0f 10 00 00       	mov    $0x100f,%edx
+    100b:	0f 34                	sysenter
+    100d:	cd 40                	int    $0x40
+    100f:	c3                   	ret
+
+00001010 <uptime>:
+SYSCALL(uptime)
+    1010:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1015:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    101c:	00 00 00 
+    101f:	74 09                	je     102a <uptime+0x1a>
+    1021:	89 e1                	mov    %esp,%ecx
+    1023:	ba 2c 10 00 00       	mov    $0x102c,%edx
+    1028:	0f 34                	sysenter
+    102a:	cd 40                	int    $0x40
+    102c:	c3                   	ret
+
+0000102d <swapread>:
+SYSCALL(swapread)
+    102d:	b8 16 00 00 00       	mov    $0x16,%eax
+    1032:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    1039:	00 00 00 
+    103c:	74 09                	je     1047 <swapread+0x1a>
+    103e:	89 e1                	mov    %esp,%ecx
+    1040:	ba 49 10 00 00       	mov    $0x1049,%edx
+    1045:	0f 34                	sysenter
+    1047:	cd 40                	int    $0x40
+    1049:	c3                   	ret
+
+0000104a <swapwrite>:
+SYSCALL(swapwrite)
+    104a:	b8 17 00 00 00       	mov    $0x17,%eax
+    104f:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    1056:	00 00 00 
+    1059:	74 09                	je     1064 <swapwrite+0x1a>
+    105b:	89 e1                	mov    %esp,%ecx
+    105d:	ba 66 10 00 00       	mov    $0x1066,%edx
+    1062:	0f 34                	sysenter
+    1064:	cd 40                	int    $0x40
+    1066:	c3                   	ret
+
+00001067 <setaffinity>:
+SYSCALL(setaffinity)
+    1067:	b8 18 00 00 00       	mov    $0x18,%eax
+    106c:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    1073:	00 00 00 
+    1076:	74 09                	je     1081 <setaffinity+0x1a>
+    1078:	89 e1                	mov    %esp,%ecx
+    107a:	ba 83 10 00 00       	mov    $0x1083,%edx
+    107f:	0f 34                	sysenter
+    1081:	cd 40                	int    $0x40
+    1083:	c3                   	ret
+
+00001084 <getaffinity>:
+SYSCALL(getaffinity)
+    1084:	b8 19 00 00 00       	mov    $0x19,%eax
+    1089:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    1090:	00 00 00 
+    1093:	74 09                	je     109e <getaffinity+0x1a>
+    1095:	89 e1                	mov    %esp,%ecx
+    1097:	ba a0 10 00 00       	mov    $0x10a0,%edx
+    109c:	0f 34                	sysenter
+    109e:	cd 40                	int    $0x40
+    10a0:	c3                   	ret
+
+000010a1 <nanosleep>:
+SYSCALL(nanosleep)
+    10a1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    10a6:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    10ad:	00 00 00 
+    10b0:	74 09                	je     10bb <nanosleep+0x1a>
+    10b2:	89 e1                	mov    %esp,%ecx
+    10b4:	ba bd 10 00 00       	mov    $0x10bd,%edx
+    10b9:	0f 34                	sysenter
+    10bb:	cd 40                	int    $0x40
+    10bd:	c3                   	ret
+
+000010be <clocktime>:
+SYSCALL(clocktime)
+    10be:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    10c3:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    10ca:	00 00 00 
+    10cd:	74 09                	je     10d8 <clocktime+0x1a>
+    10cf:	89 e1                	mov    %esp,%ecx
+    10d1:	ba da 10 00 00       	mov    $0x10da,%edx
+    10d6:	0f 34                	sysenter
+    10d8:	cd 40                	int    $0x40
+    10da:	c3                   	ret
+
+000010db <batch>:
+SYSCALL(batch)
+    10db:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    10e0:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    10e7:	00 00 00 
+    10ea:	74 09                	je     10f5 <batch+0x1a>
+    10ec:	89 e1                	mov    %esp,%ecx
+    10ee:	ba f7 10 00 00       	mov    $0x10f7,%edx
+    10f3:	0f 34                	sysenter
+    10f5:	cd 40                	int    $0x40
+    10f7:	c3                   	ret
+
+000010f8 <aiosetup>:
+SYSCALL(aiosetup)
+    10f8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    10fd:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    1104:	00 00 00 
+    1107:	74 09                	je     1112 <aiosetup+0x1a>
+    1109:	89 e1                	mov    %esp,%ecx
+    110b:	ba 14 11 00 00       	mov    $0x1114,%edx
+    1110:	0f 34                	sysenter
+    1112:	cd 40                	int    $0x40
+    1114:	c3                   	ret
+
+00001115 <aiowait>:
+SYSCALL(aiowait)
+    1115:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    111a:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    1121:	00 00 00 
+    1124:	74 09                	je     112f <aiowait+0x1a>
+    1126:	89 e1                	mov    %esp,%ecx
+    1128:	ba 31 11 00 00       	mov    $0x1131,%edx
+    112d:	0f 34                	sysenter
+    112f:	cd 40                	int    $0x40
+    1131:	c3                   	ret
+
+00001132 <spawn>:
+SYSCALL(spawn)
+    1132:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1137:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    113e:	00 00 00 
+    1141:	74 09                	je     114c <spawn+0x1a>
+    1143:	89 e1                	mov    %esp,%ecx
+    1145:	ba 4e 11 00 00       	mov    $0x114e,%edx
+    114a:	0f 34                	sysenter
+    114c:	cd 40                	int    $0x40
+    114e:	c3                   	ret
+
+0000114f <getprocinfo>:
+SYSCALL(getprocinfo)
+    114f:	b8 20 00 00 00       	mov    $0x20,%eax
+    1154:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    115b:	00 00 00 
+    115e:	74 09                	je     1169 <getprocinfo+0x1a>
+    1160:	89 e1                	mov    %esp,%ecx
+    1162:	ba 6b 11 00 00       	mov    $0x116b,%edx
+    1167:	0f 34                	sysenter
+    1169:	cd 40                	int    $0x40
+    116b:	c3                   	ret
+
+0000116c <getlockstat>:
+SYSCALL(getlockstat)
+    116c:	b8 21 00 00 00       	mov    $0x21,%eax
+    1171:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    1178:	00 00 00 
+    117b:	74 09                	je     1186 <getlockstat+0x1a>
+    117d:	89 e1                	mov    %esp,%ecx
+    117f:	ba 88 11 00 00       	mov    $0x1188,%edx
+    1184:	0f 34                	sysenter
+    1186:	cd 40                	int    $0x40
+    1188:	c3                   	ret
+
+00001189 <lockprof>:
+SYSCALL(lockprof)
+    1189:	b8 22 00 00 00       	mov    $0x22,%eax
+    118e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    1195:	00 00 00 
+    1198:	74 09                	je     11a3 <lockprof+0x1a>
+    119a:	89 e1                	mov    %esp,%ecx
+    119c:	ba a5 11 00 00       	mov    $0x11a5,%edx
+    11a1:	0f 34                	sysenter
+    11a3:	cd 40                	int    $0x40
+    11a5:	c3                   	ret
+
+000011a6 <getlockprof>:
+SYSCALL(getlockprof)
+    11a6:	b8 23 00 00 00       	mov    $0x23,%eax
+    11ab:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    11b2:	00 00 00 
+    11b5:	74 09                	je     11c0 <getlockprof+0x1a>
+    11b7:	89 e1                	mov    %esp,%ecx
+    11b9:	ba c2 11 00 00       	mov    $0x11c2,%edx
+    11be:	0f 34                	sysenter
+    11c0:	cd 40                	int    $0x40
+    11c2:	c3                   	ret
+
+000011c3 <diskstat>:
+SYSCALL(diskstat)
+    11c3:	b8 24 00 00 00       	mov    $0x24,%eax
+    11c8:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    11cf:	00 00 00 
+    11d2:	74 09                	je     11dd <diskstat+0x1a>
+    11d4:	89 e1                	mov    %esp,%ecx
+    11d6:	ba df 11 00 00       	mov    $0x11df,%edx
+    11db:	0f 34                	sysenter
+    11dd:	cd 40                	int    $0x40
+    11df:	c3                   	ret
+
+000011e0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    11e0:	55                   	push   %ebp
+    11e1:	89 e5                	mov    %esp,%ebp
+    11e3:	57                   	push   %edi
+    11e4:	56                   	push   %esi
+    11e5:	53                   	push   %ebx
+    11e6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    11e8:	89 d1                	mov    %edx,%ecx
+{
+    11ea:	83 ec 3c             	sub    $0x3c,%esp
+    11ed:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    11f0:	85 d2                	test   %edx,%edx
+    11f2:	0f 89 80 00 00 00    	jns    1278 <printint+0x98>
+    11f8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    11fc:	74 7a                	je     1278 <printint+0x98>
+    x = -xx;
+    11fe:	f7 d9                	neg    %ecx
+    neg = 1;
+    1200:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1205:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1208:	31 f6                	xor    %esi,%esi
+    120a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    1210:	89 c8                	mov    %ecx,%eax
+    1212:	31 d2                	xor    %edx,%edx
+    1214:	89 f7                	mov    %esi,%edi
+    1216:	f7 f3                	div    %ebx
+    1218:	8d 76 01             	lea    0x1(%esi),%esi
+    121b:	0f b6 92 2c 17 00 00 	movzbl 0x172c(%edx),%edx
+    1222:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1226:	89 ca                	mov    %ecx,%edx
+    1228:	89 c1                	mov    %eax,%ecx
+    122a:	39 da                	cmp    %ebx,%edx
+    122c:	73 e2                	jae    1210 <printint+0x30>
+  if(neg)
+    122e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1231:	85 c0                	test   %eax,%eax
+    1233:	74 07                	je     123c <printint+0x5c>
+    buf[i++] = '-';
+    1235:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    123a:	89 f7                	mov    %esi,%edi
+    123c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    123f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1242:	01 df                	add    %ebx,%edi
+    1244:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1248:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    124b:	83 ec 04             	sub    $0x4,%esp
+    124e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1251:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1254:	6a 01                	push   $0x1
+    1256:	50                   	push   %eax
+    1257:	56                   	push   %esi
+    1258:	e8 00 fc ff ff       	call   e5d <write>
+  while(--i >= 0)
+    125d:	89 f8                	mov    %edi,%eax
+    125f:	83 c4 10             	add    $0x10,%esp
+    1262:	83 ef 01             	sub    $0x1,%edi
+    1265:	39 d8                	cmp    %ebx,%eax
+    1267:	75 df                	jne    1248 <printint+0x68>
+}
+    1269:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    126c:	5b                   	pop    %ebx
+    126d:	5e                   	pop    %esi
+    126e:	5f                   	pop    %edi
+    126f:	5d                   	pop    %ebp
+    1270:	c3                   	ret
+    1271:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1278:	31 c0                	xor    %eax,%eax
+    127a:	eb 89                	jmp    1205 <printint+0x25>
+    127c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001280 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1280:	55                   	push   %ebp
+    1281:	89 e5                	mov    %esp,%ebp
+    1283:	57                   	push   %edi
+    1284:	56                   	push   %esi
+    1285:	53                   	push   %ebx
+    1286:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1289:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    128c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    128f:	0f b6 1e             	movzbl (%esi),%ebx
+    1292:	83 c6 01             	add    $0x1,%esi
+    1295:	84 db                	test   %bl,%bl
+    1297:	74 67                	je     1300 <printf+0x80>
+    1299:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    129c:	31 d2                	xor    %edx,%edx
+    129e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    12a1:	eb 34                	jmp    12d7 <printf+0x57>
+    12a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12a7:	90                   	nop
+    12a8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    12ab:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    12b0:	83 f8 25             	cmp    $0x25,%eax
+    12b3:	74 18                	je     12cd <printf+0x4d>
+  write(fd, &c, 1);
+    12b5:	83 ec 04             	sub    $0x4,%esp
+    12b8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    12bb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    12be:	6a 01                	push   $0x1
+    12c0:	50                   	push   %eax
+    12c1:	57                   	push   %edi
+    12c2:	e8 96 fb ff ff       	call   e5d <write>
+    12c7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    12ca:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    12cd:	0f b6 1e             	movzbl (%esi),%ebx
+    12d0:	83 c6 01             	add    $0x1,%esi
+    12d3:	84 db                	test   %bl,%bl
+    12d5:	74 29                	je     1300 <printf+0x80>
+    c = fmt[i] & 0xff;
+    12d7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    12da:	85 d2                	test   %edx,%edx
+    12dc:	74 ca                	je     12a8 <printf+0x28>
+      }
+    } else if(state == '%'){
+    12de:	83 fa 25             	cmp    $0x25,%edx
+    12e1:	75 ea                	jne    12cd <printf+0x4d>
+      if(c == 'd'){
+    12e3:	83 f8 25             	cmp    $0x25,%eax
+    12e6:	0f 84 24 01 00 00    	je     1410 <printf+0x190>
+    12ec:	83 e8 63             	sub    $0x63,%eax
+    12ef:	83 f8 15             	cmp    $0x15,%eax
+    12f2:	77 1c                	ja     1310 <printf+0x90>
+    12f4:	ff 24 85 d4 16 00 00 	jmp    *0x16d4(,%eax,4)
+    12fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12ff:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    1300:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1303:	5b                   	pop    %ebx
+    1304:	5e                   	pop    %esi
+    1305:	5f                   	pop    %edi
+    1306:	5d                   	pop    %ebp
+    1307:	c3                   	ret
+    1308:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    130f:	90                   	nop
+  write(fd, &c, 1);
+    1310:	83 ec 04             	sub    $0x4,%esp
+    1313:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1316:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    131a:	6a 01                	push   $0x1
+    131c:	52                   	push   %edx
+    131d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1320:	57                   	push   %edi
+    1321:	e8 37 fb ff ff       	call   e5d <write>
+    1326:	83 c4 0c             	add    $0xc,%esp
+    1329:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    132c:	6a 01                	push   $0x1
+    132e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1331:	52                   	push   %edx
+    1332:	57                   	push   %edi
+    1333:	e8 25 fb ff ff       	call   e5d <write>
+        putc(fd, c);
+    1338:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    133b:	31 d2                	xor    %edx,%edx
+    133d:	eb 8e                	jmp    12cd <printf+0x4d>
+    133f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    1340:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1343:	83 ec 0c             	sub    $0xc,%esp
+    1346:	b9 10 00 00 00       	mov    $0x10,%ecx
+    134b:	8b 13                	mov    (%ebx),%edx
+    134d:	6a 00                	push   $0x0
+    134f:	89 f8                	mov    %edi,%eax
+        ap++;
+    1351:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    1354:	e8 87 fe ff ff       	call   11e0 <printint>
+        ap++;
+    1359:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    135c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    135f:	31 d2                	xor    %edx,%edx
+    1361:	e9 67 ff ff ff       	jmp    12cd <printf+0x4d>
+    1366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    136d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1370:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1373:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1375:	83 c0 04             	add    $0x4,%eax
+    1378:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    137b:	85 db                	test   %ebx,%ebx
+    137d:	0f 84 9d 00 00 00    	je     1420 <printf+0x1a0>
+        while(*s != 0){
+    1383:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1386:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1388:	84 c0                	test   %al,%al
+    138a:	0f 84 3d ff ff ff    	je     12cd <printf+0x4d>
+    1390:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1393:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1396:	89 de                	mov    %ebx,%esi
+    1398:	89 d3                	mov    %edx,%ebx
+    139a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    13a0:	83 ec 04             	sub    $0x4,%esp
+    13a3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    13a6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    13a9:	6a 01                	push   $0x1
+    13ab:	53                   	push   %ebx
+    13ac:	57                   	push   %edi
+    13ad:	e8 ab fa ff ff       	call   e5d <write>
+        while(*s != 0){
+    13b2:	0f b6 06             	movzbl (%esi),%eax
+    13b5:	83 c4 10             	add    $0x10,%esp
+    13b8:	84 c0                	test   %al,%al
+    13ba:	75 e4                	jne    13a0 <printf+0x120>
+      state = 0;
+    13bc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    13bf:	31 d2                	xor    %edx,%edx
+    13c1:	e9 07 ff ff ff       	jmp    12cd <printf+0x4d>
+    13c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13cd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    13d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    13d3:	83 ec 0c             	sub    $0xc,%esp
+    13d6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    13db:	8b 13                	mov    (%ebx),%edx
+    13dd:	6a 01                	push   $0x1
+    13df:	e9 6b ff ff ff       	jmp    134f <printf+0xcf>
+    13e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    13e8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    13eb:	83 ec 04             	sub    $0x4,%esp
+    13ee:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    13f1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    13f3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    13f6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    13f9:	6a 01                	push   $0x1
+    13fb:	52                   	push   %edx
+    13fc:	57                   	push   %edi
+    13fd:	e8 5b fa ff ff       	call   e5d <write>
+        ap++;
+    1402:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1405:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1408:	31 d2                	xor    %edx,%edx
+    140a:	e9 be fe ff ff       	jmp    12cd <printf+0x4d>
+    140f:	90                   	nop
+  write(fd, &c, 1);
+    1410:	83 ec 04             	sub    $0x4,%esp
+    1413:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1416:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1419:	6a 01                	push   $0x1
+    141b:	e9 11 ff ff ff       	jmp    1331 <printf+0xb1>
+    1420:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1425:	bb ca 16 00 00       	mov    $0x16ca,%ebx
+    142a:	e9 61 ff ff ff       	jmp    1390 <printf+0x110>
+    142f:	90                   	nop
+
+00001430 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1430:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1431:	a1 80 d9 01 00       	mov    0x1d980,%eax
+{
+    1436:	89 e5                	mov    %esp,%ebp
+    1438:	57                   	push   %edi
+    1439:	56                   	push   %esi
+    143a:	53                   	push   %ebx
+    143b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    143e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1441:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1448:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    144a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    144c:	39 ca                	cmp    %ecx,%edx
+    144e:	73 30                	jae    1480 <free+0x50>
+    1450:	39 c1                	cmp    %eax,%ecx
+    1452:	72 04                	jb     1458 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1454:	39 c2                	cmp    %eax,%edx
+    1456:	72 f0                	jb     1448 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1458:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    145b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    145e:	39 f8                	cmp    %edi,%eax
+    1460:	74 2e                	je     1490 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1462:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1465:	8b 42 04             	mov    0x4(%edx),%eax
+    1468:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    146b:	39 f1                	cmp    %esi,%ecx
+    146d:	74 38                	je     14a7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    146f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1471:	5b                   	pop    %ebx
+  freep = p;
+    1472:	89 15 80 d9 01 00    	mov    %edx,0x1d980
+}
+    1478:	5e                   	pop    %esi
+    1479:	5f                   	pop    %edi
+    147a:	5d                   	pop    %ebp
+    147b:	c3                   	ret
+    147c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1480:	39 c1                	cmp    %eax,%ecx
+    1482:	72 d0                	jb     1454 <free+0x24>
+    1484:	eb c2                	jmp    1448 <free+0x18>
+    1486:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    148d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1490:	03 70 04             	add    0x4(%eax),%esi
+    1493:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1496:	8b 02                	mov    (%edx),%eax
+    1498:	8b 00                	mov    (%eax),%eax
+    149a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    149d:	8b 42 04             	mov    0x4(%edx),%eax
+    14a0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    14a3:	39 f1                	cmp    %esi,%ecx
+    14a5:	75 c8                	jne    146f <free+0x3f>
+    p->s.size += bp->s.size;
+    14a7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    14aa:	89 15 80 d9 01 00    	mov    %edx,0x1d980
+    p->s.size += bp->s.size;
+    14b0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    14b3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    14b6:	89 0a                	mov    %ecx,(%edx)
+}
+    14b8:	5b                   	pop    %ebx
+    14b9:	5e                   	pop    %esi
+    14ba:	5f                   	pop    %edi
+    14bb:	5d                   	pop    %ebp
+    14bc:	c3                   	ret
+    14bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000014c0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    14c0:	55                   	push   %ebp
+    14c1:	89 e5                	mov    %esp,%ebp
+    14c3:	57                   	push   %edi
+    14c4:	56                   	push   %esi
+    14c5:	53                   	push   %ebx
+    14c6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    14c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    14cc:	8b 15 80 d9 01 00    	mov    0x1d980,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    14d2:	8d 78 07             	lea    0x7(%eax),%edi
+    14d5:	c1 ef 03             	shr    $0x3,%edi
+    14d8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    14db:	85 d2                	test   %edx,%edx
+    14dd:	0f 84 8d 00 00 00    	je     1570 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    14e3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    14e5:	8b 48 04             	mov    0x4(%eax),%ecx
+    14e8:	39 f9                	cmp    %edi,%ecx
+    14ea:	73 64                	jae    1550 <malloc+0x90>
+  if(nu < 4096)
+    14ec:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    14f1:	39 df                	cmp    %ebx,%edi
+    14f3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    14f6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    14fd:	eb 0a                	jmp    1509 <malloc+0x49>
+    14ff:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1500:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1502:	8b 48 04             	mov    0x4(%eax),%ecx
+    1505:	39 f9                	cmp    %edi,%ecx
+    1507:	73 47                	jae    1550 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1509:	89 c2                	mov    %eax,%edx
+    150b:	39 05 80 d9 01 00    	cmp    %eax,0x1d980
+    1511:	75 ed                	jne    1500 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1513:	83 ec 0c             	sub    $0xc,%esp
+    1516:	56                   	push   %esi
+    1517:	e8 ba fa ff ff       	call   fd6 <sbrk>
+  if(p == (char*)-1)
+    151c:	83 c4 10             	add    $0x10,%esp
+    151f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1522:	74 1c                	je     1540 <malloc+0x80>
+  hp->s.size = nu;
+    1524:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1527:	83 ec 0c             	sub    $0xc,%esp
+    152a:	83 c0 08             	add    $0x8,%eax
+    152d:	50                   	push   %eax
+    152e:	e8 fd fe ff ff       	call   1430 <free>
+  return freep;
+    1533:	8b 15 80 d9 01 00    	mov    0x1d980,%edx
+      if((p = morecore(nunits)) == 0)
+    1539:	83 c4 10             	add    $0x10,%esp
+    153c:	85 d2                	test   %edx,%edx
+    153e:	75 c0                	jne    1500 <malloc+0x40>
+        return 0;
+  }
+}
+    1540:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1543:	31 c0                	xor    %eax,%eax
+}
+    1545:	5b                   	pop    %ebx
+    1546:	5e                   	pop    %esi
+    1547:	5f                   	pop    %edi
+    1548:	5d                   	pop    %ebp
+    1549:	c3                   	ret
+    154a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1550:	39 cf                	cmp    %ecx,%edi
+    1552:	74 4c                	je     15a0 <malloc+0xe0>
+        p->s.size -= nunits;
+    1554:	29 f9                	sub    %edi,%ecx
+    1556:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1559:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    155c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    155f:	89 15 80 d9 01 00    	mov    %edx,0x1d980
+}
+    1565:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1568:	83 c0 08             	add    $0x8,%eax
+}
+    156b:	5b                   	pop    %ebx
+    156c:	5e                   	pop    %esi
+    156d:	5f                   	pop    %edi
+    156e:	5d                   	pop    %ebp
+    156f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1570:	c7 05 80 d9 01 00 84 	movl   $0x1d984,0x1d980
+    1577:	d9 01 00 
+    base.s.size = 0;
+    157a:	b8 84 d9 01 00       	mov    $0x1d984,%eax
+    base.s.ptr = freep = prevp = &base;
+    157f:	c7 05 84 d9 01 00 84 	movl   $0x1d984,0x1d984
+    1586:	d9 01 00 
+    base.s.size = 0;
+    1589:	c7 05 88 d9 01 00 00 	movl   $0x0,0x1d988
+    1590:	00 00 00 
+    if(p->s.size >= nunits){
+    1593:	e9 54 ff ff ff       	jmp    14ec <malloc+0x2c>
+    1598:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    159f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    15a0:	8b 08                	mov    (%eax),%ecx
+    15a2:	89 0a                	mov    %ecx,(%edx)
+    15a4:	eb b9                	jmp    155f <malloc+0x9f>
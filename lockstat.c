@@ -0,0 +1,192 @@
+// Show which spin locks are contended.
+//
+// usage: lockstat [-p] [command [arg ...]]
+//
+// With no command, prints each lock name's counts since boot.
+// Otherwise runs the command and prints what changed while it
+// ran.  Locks are listed by time spent waiting for them, most
+// first.  Times are in thousands of TSC cycles.
+//
+// -p profiles the command instead: it lists the call sites of
+// acquire() that waited and held longest, then log2 histograms
+// of wait and hold times for the most waited-for locks.  Look
+// the sites up in kernel.asm.
+
+#include "types.h"
+#include "user.h"
+#include "lockstat.h"
+
+#define NSTAT 64
+#define NSITE 256
+#define NTOP  10  // call sites listed by -p
+#define NHIST 3   // locks whose histograms -p prints
+
+struct lockstat old[NSTAT], cur[NSTAT];
+struct locksite site[NSITE];
+
+// Print n right-aligned in a column w wide.
+void
+col(uint n, int w)
+{
+  uint m;
+
+  for(m = n, w--; m >= 10; m /= 10)
+    w--;
+  while(w-- > 0)
+    printf(1, " ");
+  printf(1, " %d", n);
+}
+
+// Print s left-aligned in a column w wide.
+void
+lcol(char *s, int w)
+{
+  printf(1, " %s", s);
+  for(w -= strlen(s); w > 0; w--)
+    printf(1, " ");
+}
+
+// Run argv[0] and wait for it.
+void
+run(char **argv)
+{
+  int pid;
+
+  pid = fork();
+  if(pid < 0){
+    printf(2, "lockstat: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    exec(argv[0], argv);
+    printf(2, "lockstat: exec %s failed\n", argv[0]);
+    exit();
+  }
+  wait();
+}
+
+// Sort cur[] by spin, most first.
+void
+sortstat(int n)
+{
+  struct lockstat t;
+  int i, j;
+
+  for(i = 1; i < n; i++){
+    t = cur[i];
+    for(j = i; j > 0 && cur[j-1].spin < t.spin; j--)
+      cur[j] = cur[j-1];
+    cur[j] = t;
+  }
+}
+
+// Sort site[] by wait plus hold, most first.
+void
+sortsite(int n)
+{
+  struct locksite t;
+  int i, j;
+
+  for(i = 1; i < n; i++){
+    t = site[i];
+    for(j = i; j > 0 && site[j-1].wait + site[j-1].hold < t.wait + t.hold; j--)
+      site[j] = site[j-1];
+    site[j] = t;
+  }
+}
+
+void
+hist(struct lockstat *st)
+{
+  int b, top;
+
+  printf(1, "\n%s\n  CYCLES >=        WAIT      HOLD\n", st->name);
+  for(top = NLOCKHIST-1; top > 0; top--)
+    if(st->waithist[top] || st->holdhist[top])
+      break;
+  for(b = 0; b <= top; b++){
+    printf(1, "  2^%d", b);
+    if(b < 10)
+      printf(1, " ");
+    printf(1, "      ");
+    col(st->waithist[b], 9);
+    col(st->holdhist[b], 9);
+    printf(1, "\n");
+  }
+}
+
+void
+profile(char **argv)
+{
+  int i, n, nsite;
+
+  lockprof(1);
+  run(argv);
+  lockprof(0);
+  nsite = getlockprof(site, NSITE);
+  n = getlockstat(cur, NSTAT);
+  for(i = 0; i < n; i++)
+    cur[i].spin -= old[i].spin;
+
+  sortsite(nsite);
+  printf(1, "PC        LOCK               ACQUIRE   CONTEND WAIT-KCYC HOLD-KCYC\n");
+  for(i = 0; i < nsite && i < NTOP; i++){
+    printf(1, "%x", site[i].pc);
+    lcol(site[i].name, 16);
+    col(site[i].nacquire, 9);
+    col(site[i].ncontend, 9);
+    col((uint)(site[i].wait >> 10), 9);
+    col((uint)(site[i].hold >> 10), 9);
+    printf(1, "\n");
+  }
+
+  sortstat(n);
+  for(i = 0; i < n && i < NHIST; i++)
+    if(cur[i].spin)
+      hist(&cur[i]);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, j, nold, ncur;
+
+  nold = 0;
+  if(argc > 1){
+    nold = getlockstat(old, NSTAT);
+    if(strcmp(argv[1], "-p") == 0){
+      if(argc < 3){
+        printf(2, "usage: lockstat [-p] [command [arg ...]]\n");
+        exit();
+      }
+      profile(argv+2);
+      exit();
+    }
+    run(argv+1);
+  }
+  ncur = getlockstat(cur, NSTAT);
+
+  // Entries are never removed, so old[i] and cur[i]
+  // describe the same name.
+  for(i = 0; i < nold; i++){
+    cur[i].nacquire -= old[i].nacquire;
+    cur[i].ncontend -= old[i].ncontend;
+    cur[i].spin -= old[i].spin;
+  }
+  sortstat(ncur);
+
+  printf(1, "NAME             LOCKS    ACQUIRE    CONTEND   WAIT-KCYC\n");
+  for(i = 0; i < ncur; i++){
+    if(cur[i].nacquire == 0)
+      continue;
+    printf(1, "%s", cur[i].name);
+    for(j = strlen(cur[i].name); j < 16; j++)
+      printf(1, " ");
+    col(cur[i].nlock, 5);
+    col(cur[i].nacquire, 10);
+    col(cur[i].ncontend, 10);
+    col((uint)(cur[i].spin >> 10), 11);
+    printf(1, "\n");
+  }
+  exit();
+}
@@ -0,0 +1,31 @@
+// Spin lock statistics, as returned by getlockstat().
+// Locks with the same name share one entry.
+
+#define NLOCKHIST 32  // log2 histogram buckets
+
+struct lockstat {
+  char name[16];
+  uint nlock;        // Live locks with this name
+  uint nacquire;     // Acquisitions
+  uint ncontend;     // Acquisitions that had to wait
+  uint64 spin;       // TSC cycles spent waiting
+
+  // Only counted while lockprof() is on.  Bucket i counts
+  // waits or holds of 2^i to 2^(i+1)-1 TSC cycles; the last
+  // bucket also counts everything longer.
+  uint waithist[NLOCKHIST];
+  uint holdhist[NLOCKHIST];
+};
+
+// A place acquire() is called from, as returned by
+// getlockprof().  Only recorded while lockprof() is on.
+struct locksite {
+  uint pc;           // Return address of the call to acquire()
+  char name[16];     // Name of the lock acquired
+  uint nacquire;
+  uint ncontend;
+  uint64 wait;       // TSC cycles spent waiting
+  uint64 hold;       // TSC cycles spent holding the lock
+  uint waithist[NLOCKHIST];
+  uint holdhist[NLOCKHIST];
+};
@@ -0,0 +1,1824 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  close(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	bb 01 00 00 00       	mov    $0x1,%ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 31                	mov    (%ecx),%esi
+  1b:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+  1e:	83 fe 01             	cmp    $0x1,%esi
+  21:	7e 1f                	jle    42 <main+0x42>
+  23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  27:	90                   	nop
+    ls(".");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+    ls(argv[i]);
+  28:	83 ec 0c             	sub    $0xc,%esp
+  2b:	ff 34 9f             	push   (%edi,%ebx,4)
+  for(i=1; i<argc; i++)
+  2e:	83 c3 01             	add    $0x1,%ebx
+    ls(argv[i]);
+  31:	e8 ca 00 00 00       	call   100 <ls>
+  for(i=1; i<argc; i++)
+  36:	83 c4 10             	add    $0x10,%esp
+  39:	39 de                	cmp    %ebx,%esi
+  3b:	75 eb                	jne    28 <main+0x28>
+  exit();
+  3d:	e8 f7 05 00 00       	call   639 <exit>
+    ls(".");
+  42:	83 ec 0c             	sub    $0xc,%esp
+  45:	68 40 0e 00 00       	push   $0xe40
+  4a:	e8 b1 00 00 00       	call   100 <ls>
+    exit();
+  4f:	e8 e5 05 00 00       	call   639 <exit>
+  54:	66 90                	xchg   %ax,%ax
+  56:	66 90                	xchg   %ax,%ax
+  58:	66 90                	xchg   %ax,%ax
+  5a:	66 90                	xchg   %ax,%ax
+  5c:	66 90                	xchg   %ax,%ax
+  5e:	66 90                	xchg   %ax,%ax
+
+00000060 <fmtname>:
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	56                   	push   %esi
+  64:	53                   	push   %ebx
+  65:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+  68:	83 ec 0c             	sub    $0xc,%esp
+  6b:	56                   	push   %esi
+  6c:	e8 5f 03 00 00       	call   3d0 <strlen>
+  71:	83 c4 10             	add    $0x10,%esp
+  74:	01 f0                	add    %esi,%eax
+  76:	89 c3                	mov    %eax,%ebx
+  78:	73 0f                	jae    89 <fmtname+0x29>
+  7a:	eb 12                	jmp    8e <fmtname+0x2e>
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  83:	39 f0                	cmp    %esi,%eax
+  85:	72 0a                	jb     91 <fmtname+0x31>
+  87:	89 c3                	mov    %eax,%ebx
+  89:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+  8c:	75 f2                	jne    80 <fmtname+0x20>
+  p++;
+  8e:	83 c3 01             	add    $0x1,%ebx
+  if(strlen(p) >= DIRSIZ)
+  91:	83 ec 0c             	sub    $0xc,%esp
+  94:	53                   	push   %ebx
+  95:	e8 36 03 00 00       	call   3d0 <strlen>
+  9a:	83 c4 10             	add    $0x10,%esp
+  9d:	83 f8 0d             	cmp    $0xd,%eax
+  a0:	77 4a                	ja     ec <fmtname+0x8c>
+  memmove(buf, p, strlen(p));
+  a2:	83 ec 0c             	sub    $0xc,%esp
+  a5:	53                   	push   %ebx
+  a6:	e8 25 03 00 00       	call   3d0 <strlen>
+  ab:	83 c4 0c             	add    $0xc,%esp
+  ae:	50                   	push   %eax
+  af:	53                   	push   %ebx
+  b0:	68 18 12 00 00       	push   $0x1218
+  b5:	e8 96 04 00 00       	call   550 <memmove>
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  ba:	89 1c 24             	mov    %ebx,(%esp)
+  bd:	e8 0e 03 00 00       	call   3d0 <strlen>
+  c2:	89 1c 24             	mov    %ebx,(%esp)
+  return buf;
+  c5:	bb 18 12 00 00       	mov    $0x1218,%ebx
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  ca:	89 c6                	mov    %eax,%esi
+  cc:	e8 ff 02 00 00       	call   3d0 <strlen>
+  d1:	ba 0e 00 00 00       	mov    $0xe,%edx
+  d6:	83 c4 0c             	add    $0xc,%esp
+  d9:	29 f2                	sub    %esi,%edx
+  db:	05 18 12 00 00       	add    $0x1218,%eax
+  e0:	52                   	push   %edx
+  e1:	6a 20                	push   $0x20
+  e3:	50                   	push   %eax
+  e4:	e8 17 03 00 00       	call   400 <memset>
+  return buf;
+  e9:	83 c4 10             	add    $0x10,%esp
+}
+  ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  ef:	89 d8                	mov    %ebx,%eax
+  f1:	5b                   	pop    %ebx
+  f2:	5e                   	pop    %esi
+  f3:	5d                   	pop    %ebp
+  f4:	c3                   	ret
+  f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000100 <ls>:
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	57                   	push   %edi
+ 104:	56                   	push   %esi
+ 105:	53                   	push   %ebx
+ 106:	81 ec 64 02 00 00    	sub    $0x264,%esp
+ 10c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if((fd = open(path, 0)) < 0){
+ 10f:	6a 00                	push   $0x0
+ 111:	57                   	push   %edi
+ 112:	e8 0a 06 00 00       	call   721 <open>
+ 117:	83 c4 10             	add    $0x10,%esp
+ 11a:	85 c0                	test   %eax,%eax
+ 11c:	0f 88 9e 01 00 00    	js     2c0 <ls+0x1c0>
+  if(fstat(fd, &st) < 0){
+ 122:	83 ec 08             	sub    $0x8,%esp
+ 125:	8d b5 d4 fd ff ff    	lea    -0x22c(%ebp),%esi
+ 12b:	89 c3                	mov    %eax,%ebx
+ 12d:	56                   	push   %esi
+ 12e:	50                   	push   %eax
+ 12f:	e8 44 06 00 00       	call   778 <fstat>
+ 134:	83 c4 10             	add    $0x10,%esp
+ 137:	85 c0                	test   %eax,%eax
+ 139:	0f 88 c1 01 00 00    	js     300 <ls+0x200>
+  switch(st.type){
+ 13f:	0f b7 85 d4 fd ff ff 	movzwl -0x22c(%ebp),%eax
+ 146:	66 83 f8 01          	cmp    $0x1,%ax
+ 14a:	74 64                	je     1b0 <ls+0xb0>
+ 14c:	66 83 f8 02          	cmp    $0x2,%ax
+ 150:	74 1e                	je     170 <ls+0x70>
+  close(fd);
+ 152:	83 ec 0c             	sub    $0xc,%esp
+ 155:	53                   	push   %ebx
+ 156:	e8 6f 05 00 00       	call   6ca <close>
+ 15b:	83 c4 10             	add    $0x10,%esp
+}
+ 15e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 161:	5b                   	pop    %ebx
+ 162:	5e                   	pop    %esi
+ 163:	5f                   	pop    %edi
+ 164:	5d                   	pop    %ebp
+ 165:	c3                   	ret
+ 166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+ 170:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+ 176:	83 ec 0c             	sub    $0xc,%esp
+ 179:	8b b5 dc fd ff ff    	mov    -0x224(%ebp),%esi
+ 17f:	89 95 b4 fd ff ff    	mov    %edx,-0x24c(%ebp)
+ 185:	57                   	push   %edi
+ 186:	e8 d5 fe ff ff       	call   60 <fmtname>
+ 18b:	8b 95 b4 fd ff ff    	mov    -0x24c(%ebp),%edx
+ 191:	59                   	pop    %ecx
+ 192:	5f                   	pop    %edi
+ 193:	52                   	push   %edx
+ 194:	56                   	push   %esi
+ 195:	6a 02                	push   $0x2
+ 197:	50                   	push   %eax
+ 198:	68 20 0e 00 00       	push   $0xe20
+ 19d:	6a 01                	push   $0x1
+ 19f:	e8 2c 09 00 00       	call   ad0 <printf>
+    break;
+ 1a4:	83 c4 20             	add    $0x20,%esp
+ 1a7:	eb a9                	jmp    152 <ls+0x52>
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+ 1b0:	83 ec 0c             	sub    $0xc,%esp
+ 1b3:	57                   	push   %edi
+ 1b4:	e8 17 02 00 00       	call   3d0 <strlen>
+ 1b9:	83 c4 10             	add    $0x10,%esp
+ 1bc:	83 c0 10             	add    $0x10,%eax
+ 1bf:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 1c4:	0f 87 16 01 00 00    	ja     2e0 <ls+0x1e0>
+    strcpy(buf, path);
+ 1ca:	83 ec 08             	sub    $0x8,%esp
+ 1cd:	57                   	push   %edi
+ 1ce:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+ 1d4:	57                   	push   %edi
+ 1d5:	e8 66 01 00 00       	call   340 <strcpy>
+    p = buf+strlen(buf);
+ 1da:	89 3c 24             	mov    %edi,(%esp)
+ 1dd:	e8 ee 01 00 00       	call   3d0 <strlen>
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1e2:	83 c4 10             	add    $0x10,%esp
+    p = buf+strlen(buf);
+ 1e5:	01 f8                	add    %edi,%eax
+    *p++ = '/';
+ 1e7:	8d 48 01             	lea    0x1(%eax),%ecx
+    p = buf+strlen(buf);
+ 1ea:	89 85 a8 fd ff ff    	mov    %eax,-0x258(%ebp)
+    *p++ = '/';
+ 1f0:	89 8d a4 fd ff ff    	mov    %ecx,-0x25c(%ebp)
+ 1f6:	c6 00 2f             	movb   $0x2f,(%eax)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 200:	83 ec 04             	sub    $0x4,%esp
+ 203:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+ 209:	6a 10                	push   $0x10
+ 20b:	50                   	push   %eax
+ 20c:	53                   	push   %ebx
+ 20d:	e8 7e 04 00 00       	call   690 <read>
+ 212:	83 c4 10             	add    $0x10,%esp
+ 215:	83 f8 10             	cmp    $0x10,%eax
+ 218:	0f 85 34 ff ff ff    	jne    152 <ls+0x52>
+      if(de.inum == 0)
+ 21e:	66 83 bd c4 fd ff ff 	cmpw   $0x0,-0x23c(%ebp)
+ 225:	00 
+ 226:	74 d8                	je     200 <ls+0x100>
+      memmove(p, de.name, DIRSIZ);
+ 228:	83 ec 04             	sub    $0x4,%esp
+ 22b:	8d 85 c6 fd ff ff    	lea    -0x23a(%ebp),%eax
+ 231:	6a 0e                	push   $0xe
+ 233:	50                   	push   %eax
+ 234:	ff b5 a4 fd ff ff    	push   -0x25c(%ebp)
+ 23a:	e8 11 03 00 00       	call   550 <memmove>
+      p[DIRSIZ] = 0;
+ 23f:	8b 85 a8 fd ff ff    	mov    -0x258(%ebp),%eax
+ 245:	c6 40 0f 00          	movb   $0x0,0xf(%eax)
+      if(stat(buf, &st) < 0){
+ 249:	58                   	pop    %eax
+ 24a:	5a                   	pop    %edx
+ 24b:	56                   	push   %esi
+ 24c:	57                   	push   %edi
+ 24d:	e8 6e 02 00 00       	call   4c0 <stat>
+ 252:	83 c4 10             	add    $0x10,%esp
+ 255:	85 c0                	test   %eax,%eax
+ 257:	0f 88 cb 00 00 00    	js     328 <ls+0x228>
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+ 25d:	8b 8d e4 fd ff ff    	mov    -0x21c(%ebp),%ecx
+ 263:	8b 95 dc fd ff ff    	mov    -0x224(%ebp),%edx
+ 269:	83 ec 0c             	sub    $0xc,%esp
+ 26c:	0f bf 85 d4 fd ff ff 	movswl -0x22c(%ebp),%eax
+ 273:	89 8d ac fd ff ff    	mov    %ecx,-0x254(%ebp)
+ 279:	89 95 b0 fd ff ff    	mov    %edx,-0x250(%ebp)
+ 27f:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+ 285:	57                   	push   %edi
+ 286:	e8 d5 fd ff ff       	call   60 <fmtname>
+ 28b:	5a                   	pop    %edx
+ 28c:	59                   	pop    %ecx
+ 28d:	8b 8d ac fd ff ff    	mov    -0x254(%ebp),%ecx
+ 293:	51                   	push   %ecx
+ 294:	8b 95 b0 fd ff ff    	mov    -0x250(%ebp),%edx
+ 29a:	52                   	push   %edx
+ 29b:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+ 2a1:	50                   	push   %eax
+ 2a2:	68 20 0e 00 00       	push   $0xe20
+ 2a7:	6a 01                	push   $0x1
+ 2a9:	e8 22 08 00 00       	call   ad0 <printf>
+ 2ae:	83 c4 20             	add    $0x20,%esp
+ 2b1:	e9 4a ff ff ff       	jmp    200 <ls+0x100>
+ 2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(2, "ls: cannot open %s\n", path);
+ 2c0:	83 ec 04             	sub    $0x4,%esp
+ 2c3:	57                   	push   %edi
+ 2c4:	68 f8 0d 00 00       	push   $0xdf8
+ 2c9:	6a 02                	push   $0x2
+ 2cb:	e8 00 08 00 00       	call   ad0 <printf>
+    return;
+ 2d0:	83 c4 10             	add    $0x10,%esp
+}
+ 2d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2d6:	5b                   	pop    %ebx
+ 2d7:	5e                   	pop    %esi
+ 2d8:	5f                   	pop    %edi
+ 2d9:	5d                   	pop    %ebp
+ 2da:	c3                   	ret
+ 2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+      printf(1, "ls: path too long\n");
+ 2e0:	83 ec 08             	sub    $0x8,%esp
+ 2e3:	68 2d 0e 00 00       	push   $0xe2d
+ 2e8:	6a 01                	push   $0x1
+ 2ea:	e8 e1 07 00 00       	call   ad0 <printf>
+      break;
+ 2ef:	83 c4 10             	add    $0x10,%esp
+ 2f2:	e9 5b fe ff ff       	jmp    152 <ls+0x52>
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+    printf(2, "ls: cannot stat %s\n", path);
+ 300:	83 ec 04             	sub    $0x4,%esp
+ 303:	57                   	push   %edi
+ 304:	68 0c 0e 00 00       	push   $0xe0c
+ 309:	6a 02                	push   $0x2
+ 30b:	e8 c0 07 00 00       	call   ad0 <printf>
+    close(fd);
+ 310:	89 1c 24             	mov    %ebx,(%esp)
+ 313:	e8 b2 03 00 00       	call   6ca <close>
+    return;
+ 318:	83 c4 10             	add    $0x10,%esp
+}
+ 31b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 31e:	5b                   	pop    %ebx
+ 31f:	5e                   	pop    %esi
+ 320:	5f                   	pop    %edi
+ 321:	5d                   	pop    %ebp
+ 322:	c3                   	ret
+ 323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 327:	90                   	nop
+        printf(1, "ls: cannot stat %s\n", buf);
+ 328:	83 ec 04             	sub    $0x4,%esp
+ 32b:	57                   	push   %edi
+ 32c:	68 0c 0e 00 00       	push   $0xe0c
+ 331:	6a 01                	push   $0x1
+ 333:	e8 98 07 00 00       	call   ad0 <printf>
+        continue;
+ 338:	83 c4 10             	add    $0x10,%esp
+ 33b:	e9 c0 fe ff ff       	jmp    200 <ls+0x100>
+
+00000340 <strcpy>:
+#include "date.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 340:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 341:	31 c0                	xor    %eax,%eax
+{
+ 343:	89 e5                	mov    %esp,%ebp
+ 345:	53                   	push   %ebx
+ 346:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 349:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 350:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 354:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 357:	83 c0 01             	add    $0x1,%eax
+ 35a:	84 d2                	test   %dl,%dl
+ 35c:	75 f2                	jne    350 <strcpy+0x10>
+    ;
+  return os;
+}
+ 35e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 361:	89 c8                	mov    %ecx,%eax
+ 363:	c9                   	leave
+ 364:	c3                   	ret
+ 365:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	53                   	push   %ebx
+ 374:	8b 55 08             	mov    0x8(%ebp),%edx
+ 377:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 37a:	0f b6 02             	movzbl (%edx),%eax
+ 37d:	84 c0                	test   %al,%al
+ 37f:	75 17                	jne    398 <strcmp+0x28>
+ 381:	eb 3a                	jmp    3bd <strcmp+0x4d>
+ 383:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 387:	90                   	nop
+ 388:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 38c:	83 c2 01             	add    $0x1,%edx
+ 38f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 392:	84 c0                	test   %al,%al
+ 394:	74 1a                	je     3b0 <strcmp+0x40>
+    p++, q++;
+ 396:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 398:	0f b6 19             	movzbl (%ecx),%ebx
+ 39b:	38 c3                	cmp    %al,%bl
+ 39d:	74 e9                	je     388 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 39f:	29 d8                	sub    %ebx,%eax
+}
+ 3a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3a4:	c9                   	leave
+ 3a5:	c3                   	ret
+ 3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 3b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 3b4:	31 c0                	xor    %eax,%eax
+ 3b6:	29 d8                	sub    %ebx,%eax
+}
+ 3b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3bb:	c9                   	leave
+ 3bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 3bd:	0f b6 19             	movzbl (%ecx),%ebx
+ 3c0:	31 c0                	xor    %eax,%eax
+ 3c2:	eb db                	jmp    39f <strcmp+0x2f>
+ 3c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3cf:	90                   	nop
+
+000003d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3d6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 3d9:	74 15                	je     3f0 <strlen+0x20>
+ 3db:	31 c0                	xor    %eax,%eax
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 3e0:	83 c0 01             	add    $0x1,%eax
+ 3e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 3e7:	89 c1                	mov    %eax,%ecx
+ 3e9:	75 f5                	jne    3e0 <strlen+0x10>
+    ;
+  return n;
+}
+ 3eb:	89 c8                	mov    %ecx,%eax
+ 3ed:	5d                   	pop    %ebp
+ 3ee:	c3                   	ret
+ 3ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 3f0:	31 c9                	xor    %ecx,%ecx
+}
+ 3f2:	5d                   	pop    %ebp
+ 3f3:	89 c8                	mov    %ecx,%eax
+ 3f5:	c3                   	ret
+ 3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000400 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 407:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 40a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 40d:	89 d7                	mov    %edx,%edi
+ 40f:	fc                   	cld
+ 410:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 412:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 415:	89 d0                	mov    %edx,%eax
+ 417:	c9                   	leave
+ 418:	c3                   	ret
+ 419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	8b 45 08             	mov    0x8(%ebp),%eax
+ 426:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 42a:	0f b6 10             	movzbl (%eax),%edx
+ 42d:	84 d2                	test   %dl,%dl
+ 42f:	75 12                	jne    443 <strchr+0x23>
+ 431:	eb 1d                	jmp    450 <strchr+0x30>
+ 433:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 437:	90                   	nop
+ 438:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 43c:	83 c0 01             	add    $0x1,%eax
+ 43f:	84 d2                	test   %dl,%dl
+ 441:	74 0d                	je     450 <strchr+0x30>
+    if(*s == c)
+ 443:	38 d1                	cmp    %dl,%cl
+ 445:	75 f1                	jne    438 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 447:	5d                   	pop    %ebp
+ 448:	c3                   	ret
+ 449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 450:	31 c0                	xor    %eax,%eax
+}
+ 452:	5d                   	pop    %ebp
+ 453:	c3                   	ret
+ 454:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 45f:	90                   	nop
+
+00000460 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 465:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 468:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 469:	31 db                	xor    %ebx,%ebx
+{
+ 46b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 46e:	eb 27                	jmp    497 <gets+0x37>
+    cc = read(0, &c, 1);
+ 470:	83 ec 04             	sub    $0x4,%esp
+ 473:	6a 01                	push   $0x1
+ 475:	56                   	push   %esi
+ 476:	6a 00                	push   $0x0
+ 478:	e8 13 02 00 00       	call   690 <read>
+    if(cc < 1)
+ 47d:	83 c4 10             	add    $0x10,%esp
+ 480:	85 c0                	test   %eax,%eax
+ 482:	7e 1d                	jle    4a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 484:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 488:	8b 55 08             	mov    0x8(%ebp),%edx
+ 48b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 48f:	3c 0a                	cmp    $0xa,%al
+ 491:	74 10                	je     4a3 <gets+0x43>
+ 493:	3c 0d                	cmp    $0xd,%al
+ 495:	74 0c                	je     4a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 497:	89 df                	mov    %ebx,%edi
+ 499:	83 c3 01             	add    $0x1,%ebx
+ 49c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 49f:	7c cf                	jl     470 <gets+0x10>
+ 4a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 4a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 4aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4ad:	5b                   	pop    %ebx
+ 4ae:	5e                   	pop    %esi
+ 4af:	5f                   	pop    %edi
+ 4b0:	5d                   	pop    %ebp
+ 4b1:	c3                   	ret
+ 4b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	56                   	push   %esi
+ 4c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4c5:	83 ec 08             	sub    $0x8,%esp
+ 4c8:	6a 00                	push   $0x0
+ 4ca:	ff 75 08             	push   0x8(%ebp)
+ 4cd:	e8 4f 02 00 00       	call   721 <open>
+  if(fd < 0)
+ 4d2:	83 c4 10             	add    $0x10,%esp
+ 4d5:	85 c0                	test   %eax,%eax
+ 4d7:	78 27                	js     500 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 4d9:	83 ec 08             	sub    $0x8,%esp
+ 4dc:	ff 75 0c             	push   0xc(%ebp)
+ 4df:	89 c3                	mov    %eax,%ebx
+ 4e1:	50                   	push   %eax
+ 4e2:	e8 91 02 00 00       	call   778 <fstat>
+  close(fd);
+ 4e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 4ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 4ec:	e8 d9 01 00 00       	call   6ca <close>
+  return r;
+ 4f1:	83 c4 10             	add    $0x10,%esp
+}
+ 4f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4f7:	89 f0                	mov    %esi,%eax
+ 4f9:	5b                   	pop    %ebx
+ 4fa:	5e                   	pop    %esi
+ 4fb:	5d                   	pop    %ebp
+ 4fc:	c3                   	ret
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 500:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 505:	eb ed                	jmp    4f4 <stat+0x34>
+ 507:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50e:	66 90                	xchg   %ax,%ax
+
+00000510 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	53                   	push   %ebx
+ 514:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 517:	0f be 02             	movsbl (%edx),%eax
+ 51a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 51d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 520:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 525:	77 1e                	ja     545 <atoi+0x35>
+ 527:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 530:	83 c2 01             	add    $0x1,%edx
+ 533:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 536:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 53a:	0f be 02             	movsbl (%edx),%eax
+ 53d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 540:	80 fb 09             	cmp    $0x9,%bl
+ 543:	76 eb                	jbe    530 <atoi+0x20>
+  return n;
+}
+ 545:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 548:	89 c8                	mov    %ecx,%eax
+ 54a:	c9                   	leave
+ 54b:	c3                   	ret
+ 54c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	56                   	push   %esi
+ 555:	8b 45 10             	mov    0x10(%ebp),%eax
+ 558:	8b 55 08             	mov    0x8(%ebp),%edx
+ 55b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 55e:	85 c0                	test   %eax,%eax
+ 560:	7e 13                	jle    575 <memmove+0x25>
+ 562:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 564:	89 d7                	mov    %edx,%edi
+ 566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 570:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 571:	39 f8                	cmp    %edi,%eax
+ 573:	75 fb                	jne    570 <memmove+0x20>
+  return vdst;
+}
+ 575:	5e                   	pop    %esi
+ 576:	89 d0                	mov    %edx,%eax
+ 578:	5f                   	pop    %edi
+ 579:	5d                   	pop    %ebp
+ 57a:	c3                   	ret
+ 57b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 57f:	90                   	nop
+
+00000580 <ugetpid>:
+// getpid() without a system call, from the page at UPROC.
+int
+ugetpid(void)
+{
+  return ((struct uproc*)UPROC)->pid;
+}
+ 580:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+ 585:	c3                   	ret
+ 586:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000590 <uclocktime>:
+
+// clocktime() without a system call, from the page at UCLOCK.
+int
+uclocktime(struct timespec *ts)
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	57                   	push   %edi
+ 594:	56                   	push   %esi
+ 595:	53                   	push   %ebx
+ 596:	83 ec 1c             	sub    $0x1c,%esp
+  struct uclock *c = (struct uclock*)UCLOCK;
+
+  if(c->tscmult == 0)
+ 599:	8b 0d 08 f0 ff 7f    	mov    0x7ffff008,%ecx
+{
+ 59f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(c->tscmult == 0)
+ 5a2:	85 c9                	test   %ecx,%ecx
+ 5a4:	74 6a                	je     610 <uclocktime+0x80>
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+ 5a6:	0f 31                	rdtsc
+static inline void
+uclockread(struct uclock *c, uint64 tsc, struct timespec *ts)
+{
+  uint64 d, ns;
+
+  d = tsc - c->tscbase;
+ 5a8:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 5ae:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+ 5b4:	89 c6                	mov    %eax,%esi
+  if((long long)d < 0)  // another CPU's TSC is a little behind
+ 5b6:	85 d2                	test   %edx,%edx
+ 5b8:	78 46                	js     600 <uclocktime+0x70>
+    d = 0;
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 5ba:	89 d0                	mov    %edx,%eax
+ 5bc:	f7 e1                	mul    %ecx
+ 5be:	0f a4 c2 08          	shld   $0x8,%eax,%edx
+ 5c2:	c1 e0 08             	shl    $0x8,%eax
+ 5c5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+ 5c8:	89 f0                	mov    %esi,%eax
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 5ca:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+ 5cd:	f7 e1                	mul    %ecx
+ 5cf:	0f ac d0 18          	shrd   $0x18,%edx,%eax
+ 5d3:	c1 ea 18             	shr    $0x18,%edx
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 5d6:	03 45 e0             	add    -0x20(%ebp),%eax
+ 5d9:	13 55 e4             	adc    -0x1c(%ebp),%edx
+// linked with libgcc, so it cannot use 64-bit '/' or '%'.
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+  asm("divl %4" : "=a" (q), "=d" (r) : "a" ((uint)n), "d" ((uint)(n>>32)), "rm" (d));
+ 5dc:	89 c7                	mov    %eax,%edi
+ 5de:	89 f8                	mov    %edi,%eax
+ 5e0:	b9 00 ca 9a 3b       	mov    $0x3b9aca00,%ecx
+ 5e5:	f7 f1                	div    %ecx
+  ts->sec = divl(ns, 1000000000, &ts->nsec);
+ 5e7:	89 03                	mov    %eax,(%ebx)
+    return clocktime(ts);
+  uclockread(c, rdtsc(), ts);
+  return 0;
+}
+ 5e9:	31 c0                	xor    %eax,%eax
+  *rem = r;
+ 5eb:	89 53 04             	mov    %edx,0x4(%ebx)
+ 5ee:	83 c4 1c             	add    $0x1c,%esp
+ 5f1:	5b                   	pop    %ebx
+ 5f2:	5e                   	pop    %esi
+ 5f3:	5f                   	pop    %edi
+ 5f4:	5d                   	pop    %ebp
+ 5f5:	c3                   	ret
+ 5f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 600:	31 d2                	xor    %edx,%edx
+ 602:	31 ff                	xor    %edi,%edi
+ 604:	eb d8                	jmp    5de <uclocktime+0x4e>
+ 606:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 60d:	8d 76 00             	lea    0x0(%esi),%esi
+ 610:	83 c4 1c             	add    $0x1c,%esp
+ 613:	5b                   	pop    %ebx
+ 614:	5e                   	pop    %esi
+ 615:	5f                   	pop    %edi
+ 616:	5d                   	pop    %ebp
+    return clocktime(ts);
+ 617:	e9 f2 02 00 00       	jmp    90e <clocktime>
+
+0000061c <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+ 61c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 621:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 628:	00 00 00 
+ 62b:	74 09                	je     636 <fork+0x1a>
+ 62d:	89 e1                	mov    %esp,%ecx
+ 62f:	ba 38 06 00 00       	mov    $0x638,%edx
+ 634:	0f 34                	sysenter
+ 636:	cd 40                	int    $0x40
+ 638:	c3                   	ret
+
+00000639 <exit>:
+SYSCALL(exit)
+ 639:	b8 02 00 00 00       	mov    $0x2,%eax
+ 63e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 645:	00 00 00 
+ 648:	74 09                	je     653 <exit+0x1a>
+ 64a:	89 e1                	mov    %esp,%ecx
+ 64c:	ba 55 06 00 00       	mov    $0x655,%edx
+ 651:	0f 34                	sysenter
+ 653:	cd 40                	int    $0x40
+ 655:	c3                   	ret
+
+00000656 <wait>:
+SYSCALL(wait)
+ 656:	b8 03 00 00 00       	mov    $0x3,%eax
+ 65b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 662:	00 00 00 
+ 665:	74 09                	je     670 <wait+0x1a>
+ 667:	89 e1                	mov    %esp,%ecx
+ 669:	ba 72 06 00 00       	mov    $0x672,%edx
+ 66e:	0f 34                	sysenter
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <pipe>:
+SYSCALL(pipe)
+ 673:	b8 04 00 00 00       	mov    $0x4,%eax
+ 678:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 67f:	00 00 00 
+ 682:	74 09                	je     68d <pipe+0x1a>
+ 684:	89 e1                	mov    %esp,%ecx
+ 686:	ba 8f 06 00 00       	mov    $0x68f,%edx
+ 68b:	0f 34                	sysenter
+ 68d:	cd 40                	int    $0x40
+ 68f:	c3                   	ret
+
+00000690 <read>:
+SYSCALL(read)
+ 690:	b8 05 00 00 00       	mov    $0x5,%eax
+ 695:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 69c:	00 00 00 
+ 69f:	74 09                	je     6aa <read+0x1a>
+ 6a1:	89 e1                	mov    %esp,%ecx
+ 6a3:	ba ac 06 00 00       	mov    $0x6ac,%edx
+ 6a8:	0f 34                	sysenter
+ 6aa:	cd 40                	int    $0x40
+ 6ac:	c3                   	ret
+
+000006ad <write>:
+SYSCALL(write)
+ 6ad:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6b2:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6b9:	00 00 00 
+ 6bc:	74 09                	je     6c7 <write+0x1a>
+ 6be:	89 e1                	mov    %esp,%ecx
+ 6c0:	ba c9 06 00 00       	mov    $0x6c9,%edx
+ 6c5:	0f 34                	sysenter
+ 6c7:	cd 40                	int    $0x40
+ 6c9:	c3                   	ret
+
+000006ca <close>:
+SYSCALL(close)
+ 6ca:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6cf:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6d6:	00 00 00 
+ 6d9:	74 09                	je     6e4 <close+0x1a>
+ 6db:	89 e1                	mov    %esp,%ecx
+ 6dd:	ba e6 06 00 00       	mov    $0x6e6,%edx
+ 6e2:	0f 34                	sysenter
+ 6e4:	cd 40                	int    $0x40
+ 6e6:	c3                   	ret
+
+000006e7 <kill>:
+SYSCALL(kill)
+ 6e7:	b8 06 00 00 00       	mov    $0x6,%eax
+ 6ec:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6f3:	00 00 00 
+ 6f6:	74 09                	je     701 <kill+0x1a>
+ 6f8:	89 e1                	mov    %esp,%ecx
+ 6fa:	ba 03 07 00 00       	mov    $0x703,%edx
+ 6ff:	0f 34                	sysenter
+ 701:	cd 40                	int    $0x40
+ 703:	c3                   	ret
+
+00000704 <exec>:
+SYSCALL(exec)
+ 704:	b8 07 00 00 00       	mov    $0x7,%eax
+ 709:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 710:	00 00 00 
+ 713:	74 09                	je     71e <exec+0x1a>
+ 715:	89 e1                	mov    %esp,%ecx
+ 717:	ba 20 07 00 00       	mov    $0x720,%edx
+ 71c:	0f 34                	sysenter
+ 71e:	cd 40                	int    $0x40
+ 720:	c3                   	ret
+
+00000721 <open>:
+SYSCALL(open)
+ 721:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 726:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 72d:	00 00 00 
+ 730:	74 09                	je     73b <open+0x1a>
+ 732:	89 e1                	mov    %esp,%ecx
+ 734:	ba 3d 07 00 00       	mov    $0x73d,%edx
+ 739:	0f 34                	sysenter
+ 73b:	cd 40                	int    $0x40
+ 73d:	c3                   	ret
+
+0000073e <mknod>:
+SYSCALL(mknod)
+ 73e:	b8 11 00 00 00       	mov    $0x11,%eax
+ 743:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 74a:	00 00 00 
+ 74d:	74 09                	je     758 <mknod+0x1a>
+ 74f:	89 e1                	mov    %esp,%ecx
+ 751:	ba 5a 07 00 00       	mov    $0x75a,%edx
+ 756:	0f 34                	sysenter
+ 758:	cd 40                	int    $0x40
+ 75a:	c3                   	ret
+
+0000075b <unlink>:
+SYSCALL(unlink)
+ 75b:	b8 12 00 00 00       	mov    $0x12,%eax
+ 760:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 767:	00 00 00 
+ 76a:	74 09                	je     775 <unlink+0x1a>
+ 76c:	89 e1                	mov    %esp,%ecx
+ 76e:	ba 77 07 00 00       	mov    $0x777,%edx
+ 773:	0f 34                	sysenter
+ 775:	cd 40                	int    $0x40
+ 777:	c3                   	ret
+
+00000778 <fstat>:
+SYSCALL(fstat)
+ 778:	b8 08 00 00 00       	mov    $0x8,%eax
+ 77d:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 784:	00 00 00 
+ 787:	74 09                	je     792 <fstat+0x1a>
+ 789:	89 e1                	mov    %esp,%ecx
+ 78b:	ba 94 07 00 00       	mov    $0x794,%edx
+ 790:	0f 34                	sysenter
+ 792:	cd 40                	int    $0x40
+ 794:	c3                   	ret
+
+00000795 <link>:
+SYSCALL(link)
+ 795:	b8 13 00 00 00       	mov    $0x13,%eax
+ 79a:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 7a1:	00 00 00 
+ 7a4:	74 09                	je     7af <link+0x1a>
+ 7a6:	89 e1                	mov    %esp,%ecx
+ 7a8:	ba b1 07 00 00       	mov    $0x7b1,%edx
+ 7ad:	0f 34                	sysenter
+ 7af:	cd 40                	int    $0x40
+ 7b1:	c3                   	ret
+
+000007b2 <mkdir>:
+SYSCALL(mkdir)
+ 7b2:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7b7:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 7be:	00 00 00 
+ 7c1:	74 09                	je     7cc <mkdir+0x1a>
+ 7c3:	89 e1                	mov    %esp,%ecx
+ 7c5:	ba ce 07 00 00       	mov    $0x7ce,%edx
+ 7ca:	0f 34                	sysenter
+ 7cc:	cd 40                	int    $0x40
+ 7ce:	c3                   	ret
+
+000007cf <chdir>:
+SYSCALL(chdir)
+ 7cf:	b8 09 00 00 00       	mov    $0x9,%eax
+ 7d4:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 7db:	00 00 00 
+ 7de:	74 09                	je     7e9 <chdir+0x1a>
+ 7e0:	89 e1                	mov    %esp,%ecx
+ 7e2:	ba eb 07 00 00       	mov    $0x7eb,%edx
+ 7e7:	0f 34                	sysenter
+ 7e9:	cd 40                	int    $0x40
+ 7eb:	c3                   	ret
+
+000007ec <dup>:
+SYSCALL(dup)
+ 7ec:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 7f1:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 7f8:	00 00 00 
+ 7fb:	74 09                	je     806 <dup+0x1a>
+ 7fd:	89 e1                	mov    %esp,%ecx
+ 7ff:	ba 08 08 00 00       	mov    $0x808,%edx
+ 804:	0f 34                	sysenter
+ 806:	cd 40                	int    $0x40
+ 808:	c3                   	ret
+
+00000809 <getpid>:
+SYSCALL(getpid)
+ 809:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 80e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 815:	00 00 00 
+ 818:	74 09                	je     823 <getpid+0x1a>
+ 81a:	89 e1                	mov    %esp,%ecx
+ 81c:	ba 25 08 00 00       	mov    $0x825,%edx
+ 821:	0f 34                	sysenter
+ 823:	cd 40                	int    $0x40
+ 825:	c3                   	ret
+
+00000826 <sbrk>:
+SYSCALL(sbrk)
+ 826:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 82b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 832:	00 00 00 
+ 835:	74 09                	je     840 <sbrk+0x1a>
+ 837:	89 e1                	mov    %esp,%ecx
+ 839:	ba 42 08 00 00       	mov    $0x842,%edx
+ 83e:	0f 34                	sysenter
+ 840:	cd 40                	int    $0x40
+ 842:	c3                   	ret
+
+00000843 <sleep>:
+SYSCALL(sleep)
+ 843:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 848:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 84f:	00 00 00 
+ 852:	74 09                	je     85d <sleep+0x1a>
+ 854:	89 e1                	mov    %esp,%ecx
+ 856:	ba 5f 08 00 00       	mov    $0x85f,%edx
+ 85b:	0f 34                	sysenter
+ 85d:	cd 40                	int    $0x40
+ 85f:	c3                   	ret
+
+00000860 <uptime>:
+SYSCALL(uptime)
+ 860:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 865:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 86c:	00 00 00 
+ 86f:	74 09                	je     87a <uptime+0x1a>
+ 871:	89 e1                	mov    %esp,%ecx
+ 873:	ba 7c 08 00 00       	mov    $0x87c,%edx
+ 878:	0f 34                	sysenter
+ 87a:	cd 40                	int    $0x40
+ 87c:	c3                   	ret
+
+0000087d <swapread>:
+SYSCALL(swapread)
+ 87d:	b8 16 00 00 00       	mov    $0x16,%eax
+ 882:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 889:	00 00 00 
+ 88c:	74 09                	je     897 <swapread+0x1a>
+ 88e:	89 e1                	mov    %esp,%ecx
+ 890:	ba 99 08 00 00       	mov    $0x899,%edx
+ 895:	0f 34                	sysenter
+ 897:	cd 40                	int    $0x40
+ 899:	c3                   	ret
+
+0000089a <swapwrite>:
+SYSCALL(swapwrite)
+ 89a:	b8 17 00 00 00       	mov    $0x17,%eax
+ 89f:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 8a6:	00 00 00 
+ 8a9:	74 09                	je     8b4 <swapwrite+0x1a>
+ 8ab:	89 e1                	mov    %esp,%ecx
+ 8ad:	ba b6 08 00 00       	mov    $0x8b6,%edx
+ 8b2:	0f 34                	sysenter
+ 8b4:	cd 40                	int    $0x40
+ 8b6:	c3                   	ret
+
+000008b7 <setaffinity>:
+SYSCALL(setaffinity)
+ 8b7:	b8 18 00 00 00       	mov    $0x18,%eax
+ 8bc:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 8c3:	00 00 00 
+ 8c6:	74 09                	je     8d1 <setaffinity+0x1a>
+ 8c8:	89 e1                	mov    %esp,%ecx
+ 8ca:	ba d3 08 00 00       	mov    $0x8d3,%edx
+ 8cf:	0f 34                	sysenter
+ 8d1:	cd 40                	int    $0x40
+ 8d3:	c3                   	ret
+
+000008d4 <getaffinity>:
+SYSCALL(getaffinity)
+ 8d4:	b8 19 00 00 00       	mov    $0x19,%eax
+ 8d9:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 8e0:	00 00 00 
+ 8e3:	74 09                	je     8ee <getaffinity+0x1a>
+ 8e5:	89 e1                	mov    %esp,%ecx
+ 8e7:	ba f0 08 00 00       	mov    $0x8f0,%edx
+ 8ec:	0f 34                	sysenter
+ 8ee:	cd 40                	int    $0x40
+ 8f0:	c3                   	ret
+
+000008f1 <nanosleep>:
+SYSCALL(nanosleep)
+ 8f1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 8f6:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 8fd:	00 00 00 
+ 900:	74 09                	je     90b <nanosleep+0x1a>
+ 902:	89 e1                	mov    %esp,%ecx
+ 904:	ba 0d 09 00 00       	mov    $0x90d,%edx
+ 909:	0f 34                	sysenter
+ 90b:	cd 40                	int    $0x40
+ 90d:	c3                   	ret
+
+0000090e <clocktime>:
+SYSCALL(clocktime)
+ 90e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 913:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 91a:	00 00 00 
+ 91d:	74 09                	je     928 <clocktime+0x1a>
+ 91f:	89 e1                	mov    %esp,%ecx
+ 921:	ba 2a 09 00 00       	mov    $0x92a,%edx
+ 926:	0f 34                	sysenter
+ 928:	cd 40                	int    $0x40
+ 92a:	c3                   	ret
+
+0000092b <batch>:
+SYSCALL(batch)
+ 92b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 930:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 937:	00 00 00 
+ 93a:	74 09                	je     945 <batch+0x1a>
+ 93c:	89 e1                	mov    %esp,%ecx
+ 93e:	ba 47 09 00 00       	mov    $0x947,%edx
+ 943:	0f 34                	sysenter
+ 945:	cd 40                	int    $0x40
+ 947:	c3                   	ret
+
+00000948 <aiosetup>:
+SYSCALL(aiosetup)
+ 948:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 94d:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 954:	00 00 00 
+ 957:	74 09                	je     962 <aiosetup+0x1a>
+ 959:	89 e1                	mov    %esp,%ecx
+ 95b:	ba 64 09 00 00       	mov    $0x964,%edx
+ 960:	0f 34                	sysenter
+ 962:	cd 40                	int    $0x40
+ 964:	c3                   	ret
+
+00000965 <aiowait>:
+SYSCALL(aiowait)
+ 965:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 96a:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 971:	00 00 00 
+ 974:	74 09                	je     97f <aiowait+0x1a>
+ 976:	89 e1                	mov    %esp,%ecx
+ 978:	ba 81 09 00 00       	mov    $0x981,%edx
+ 97d:	0f 34                	sysenter
+ 97f:	cd 40                	int    $0x40
+ 981:	c3                   	ret
+
+00000982 <spawn>:
+SYSCALL(spawn)
+ 982:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 987:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 98e:	00 00 00 
+ 991:	74 09                	je     99c <spawn+0x1a>
+ 993:	89 e1                	mov    %esp,%ecx
+ 995:	ba 9e 09 00 00       	mov    $0x99e,%edx
+ 99a:	0f 34                	sysenter
+ 99c:	cd 40                	int    $0x40
+ 99e:	c3                   	ret
+
+0000099f <getprocinfo>:
+SYSCALL(getprocinfo)
+ 99f:	b8 20 00 00 00       	mov    $0x20,%eax
+ 9a4:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 9ab:	00 00 00 
+ 9ae:	74 09                	je     9b9 <getprocinfo+0x1a>
+ 9b0:	89 e1                	mov    %esp,%ecx
+ 9b2:	ba bb 09 00 00       	mov    $0x9bb,%edx
+ 9b7:	0f 34                	sysenter
+ 9b9:	cd 40                	int    $0x40
+ 9bb:	c3                   	ret
+
+000009bc <getlockstat>:
+SYSCALL(getlockstat)
+ 9bc:	b8 21 00 00 00       	mov    $0x21,%eax
+ 9c1:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 9c8:	00 00 00 
+ 9cb:	74 09                	je     9d6 <getlockstat+0x1a>
+ 9cd:	89 e1                	mov    %esp,%ecx
+ 9cf:	ba d8 09 00 00       	mov    $0x9d8,%edx
+ 9d4:	0f 34                	sysenter
+ 9d6:	cd 40                	int    $0x40
+ 9d8:	c3                   	ret
+
+000009d9 <lockprof>:
+SYSCALL(lockprof)
+ 9d9:	b8 22 00 00 00       	mov    $0x22,%eax
+ 9de:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 9e5:	00 00 00 
+ 9e8:	74 09                	je     9f3 <lockprof+0x1a>
+ 9ea:	89 e1                	mov    %esp,%ecx
+ 9ec:	ba f5 09 00 00       	mov    $0x9f5,%edx
+ 9f1:	0f 34                	sysenter
+ 9f3:	cd 40                	int    $0x40
+ 9f5:	c3                   	ret
+
+000009f6 <getlockprof>:
+SYSCALL(getlockprof)
+ 9f6:	b8 23 00 00 00       	mov    $0x23,%eax
+ 9fb:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ a02:	00 00 00 
+ a05:	74 09                	je     a10 <getlockprof+0x1a>
+ a07:	89 e1                	mov    %esp,%ecx
+ a09:	ba 12 0a 00 00       	mov    $0xa12,%edx
+ a0e:	0f 34                	sysenter
+ a10:	cd 40                	int    $0x40
+ a12:	c3                   	ret
+
+00000a13 <diskstat>:
+SYSCALL(diskstat)
+ a13:	b8 24 00 00 00       	mov    $0x24,%eax
+ a18:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ a1f:	00 00 00 
+ a22:	74 09                	je     a2d <diskstat+0x1a>
+ a24:	89 e1                	mov    %esp,%ecx
+ a26:	ba 2f 0a 00 00       	mov    $0xa2f,%edx
+ a2b:	0f 34                	sysenter
+ a2d:	cd 40                	int    $0x40
+ a2f:	c3                   	ret
+
+00000a30 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ a30:	55                   	push   %ebp
+ a31:	89 e5                	mov    %esp,%ebp
+ a33:	57                   	push   %edi
+ a34:	56                   	push   %esi
+ a35:	53                   	push   %ebx
+ a36:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ a38:	89 d1                	mov    %edx,%ecx
+{
+ a3a:	83 ec 3c             	sub    $0x3c,%esp
+ a3d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ a40:	85 d2                	test   %edx,%edx
+ a42:	0f 89 80 00 00 00    	jns    ac8 <printint+0x98>
+ a48:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ a4c:	74 7a                	je     ac8 <printint+0x98>
+    x = -xx;
+ a4e:	f7 d9                	neg    %ecx
+    neg = 1;
+ a50:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ a55:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ a58:	31 f6                	xor    %esi,%esi
+ a5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ a60:	89 c8                	mov    %ecx,%eax
+ a62:	31 d2                	xor    %edx,%edx
+ a64:	89 f7                	mov    %esi,%edi
+ a66:	f7 f3                	div    %ebx
+ a68:	8d 76 01             	lea    0x1(%esi),%esi
+ a6b:	0f b6 92 a4 0e 00 00 	movzbl 0xea4(%edx),%edx
+ a72:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ a76:	89 ca                	mov    %ecx,%edx
+ a78:	89 c1                	mov    %eax,%ecx
+ a7a:	39 da                	cmp    %ebx,%edx
+ a7c:	73 e2                	jae    a60 <printint+0x30>
+  if(neg)
+ a7e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ a81:	85 c0                	test   %eax,%eax
+ a83:	74 07                	je     a8c <printint+0x5c>
+    buf[i++] = '-';
+ a85:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ a8a:	89 f7                	mov    %esi,%edi
+ a8c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ a8f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ a92:	01 df                	add    %ebx,%edi
+ a94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ a98:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ a9b:	83 ec 04             	sub    $0x4,%esp
+ a9e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ aa1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ aa4:	6a 01                	push   $0x1
+ aa6:	50                   	push   %eax
+ aa7:	56                   	push   %esi
+ aa8:	e8 00 fc ff ff       	call   6ad <write>
+  while(--i >= 0)
+ aad:	89 f8                	mov    %edi,%eax
+ aaf:	83 c4 10             	add    $0x10,%esp
+ ab2:	83 ef 01             	sub    $0x1,%edi
+ ab5:	39 d8                	cmp    %ebx,%eax
+ ab7:	75 df                	jne    a98 <printint+0x68>
+}
+ ab9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ abc:	5b                   	pop    %ebx
+ abd:	5e                   	pop    %esi
+ abe:	5f                   	pop    %edi
+ abf:	5d                   	pop    %ebp
+ ac0:	c3                   	ret
+ ac1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ ac8:	31 c0                	xor    %eax,%eax
+ aca:	eb 89                	jmp    a55 <printint+0x25>
+ acc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ad0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ ad0:	55                   	push   %ebp
+ ad1:	89 e5                	mov    %esp,%ebp
+ ad3:	57                   	push   %edi
+ ad4:	56                   	push   %esi
+ ad5:	53                   	push   %ebx
+ ad6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ ad9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ adc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ adf:	0f b6 1e             	movzbl (%esi),%ebx
+ ae2:	83 c6 01             	add    $0x1,%esi
+ ae5:	84 db                	test   %bl,%bl
+ ae7:	74 67                	je     b50 <printf+0x80>
+ ae9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ aec:	31 d2                	xor    %edx,%edx
+ aee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ af1:	eb 34                	jmp    b27 <printf+0x57>
+ af3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ af7:	90                   	nop
+ af8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ afb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ b00:	83 f8 25             	cmp    $0x25,%eax
+ b03:	74 18                	je     b1d <printf+0x4d>
+  write(fd, &c, 1);
+ b05:	83 ec 04             	sub    $0x4,%esp
+ b08:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ b0b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b0e:	6a 01                	push   $0x1
+ b10:	50                   	push   %eax
+ b11:	57                   	push   %edi
+ b12:	e8 96 fb ff ff       	call   6ad <write>
+ b17:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ b1a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ b1d:	0f b6 1e             	movzbl (%esi),%ebx
+ b20:	83 c6 01             	add    $0x1,%esi
+ b23:	84 db                	test   %bl,%bl
+ b25:	74 29                	je     b50 <printf+0x80>
+    c = fmt[i] & 0xff;
+ b27:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ b2a:	85 d2                	test   %edx,%edx
+ b2c:	74 ca                	je     af8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ b2e:	83 fa 25             	cmp    $0x25,%edx
+ b31:	75 ea                	jne    b1d <printf+0x4d>
+      if(c == 'd'){
+ b33:	83 f8 25             	cmp    $0x25,%eax
+ b36:	0f 84 24 01 00 00    	je     c60 <printf+0x190>
+ b3c:	83 e8 63             	sub    $0x63,%eax
+ b3f:	83 f8 15             	cmp    $0x15,%eax
+ b42:	77 1c                	ja     b60 <printf+0x90>
+ b44:	ff 24 85 4c 0e 00 00 	jmp    *0xe4c(,%eax,4)
+ b4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b4f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ b50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b53:	5b                   	pop    %ebx
+ b54:	5e                   	pop    %esi
+ b55:	5f                   	pop    %edi
+ b56:	5d                   	pop    %ebp
+ b57:	c3                   	ret
+ b58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b5f:	90                   	nop
+  write(fd, &c, 1);
+ b60:	83 ec 04             	sub    $0x4,%esp
+ b63:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b66:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ b6a:	6a 01                	push   $0x1
+ b6c:	52                   	push   %edx
+ b6d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ b70:	57                   	push   %edi
+ b71:	e8 37 fb ff ff       	call   6ad <write>
+ b76:	83 c4 0c             	add    $0xc,%esp
+ b79:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b7c:	6a 01                	push   $0x1
+ b7e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ b81:	52                   	push   %edx
+ b82:	57                   	push   %edi
+ b83:	e8 25 fb ff ff       	call   6ad <write>
+        putc(fd, c);
+ b88:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b8b:	31 d2                	xor    %edx,%edx
+ b8d:	eb 8e                	jmp    b1d <printf+0x4d>
+ b8f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ b90:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ b93:	83 ec 0c             	sub    $0xc,%esp
+ b96:	b9 10 00 00 00       	mov    $0x10,%ecx
+ b9b:	8b 13                	mov    (%ebx),%edx
+ b9d:	6a 00                	push   $0x0
+ b9f:	89 f8                	mov    %edi,%eax
+        ap++;
+ ba1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ ba4:	e8 87 fe ff ff       	call   a30 <printint>
+        ap++;
+ ba9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ bac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ baf:	31 d2                	xor    %edx,%edx
+ bb1:	e9 67 ff ff ff       	jmp    b1d <printf+0x4d>
+ bb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bbd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ bc0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ bc3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ bc5:	83 c0 04             	add    $0x4,%eax
+ bc8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ bcb:	85 db                	test   %ebx,%ebx
+ bcd:	0f 84 9d 00 00 00    	je     c70 <printf+0x1a0>
+        while(*s != 0){
+ bd3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ bd6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ bd8:	84 c0                	test   %al,%al
+ bda:	0f 84 3d ff ff ff    	je     b1d <printf+0x4d>
+ be0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ be3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ be6:	89 de                	mov    %ebx,%esi
+ be8:	89 d3                	mov    %edx,%ebx
+ bea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ bf0:	83 ec 04             	sub    $0x4,%esp
+ bf3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ bf6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ bf9:	6a 01                	push   $0x1
+ bfb:	53                   	push   %ebx
+ bfc:	57                   	push   %edi
+ bfd:	e8 ab fa ff ff       	call   6ad <write>
+        while(*s != 0){
+ c02:	0f b6 06             	movzbl (%esi),%eax
+ c05:	83 c4 10             	add    $0x10,%esp
+ c08:	84 c0                	test   %al,%al
+ c0a:	75 e4                	jne    bf0 <printf+0x120>
+      state = 0;
+ c0c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ c0f:	31 d2                	xor    %edx,%edx
+ c11:	e9 07 ff ff ff       	jmp    b1d <printf+0x4d>
+ c16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c1d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ c20:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ c23:	83 ec 0c             	sub    $0xc,%esp
+ c26:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ c2b:	8b 13                	mov    (%ebx),%edx
+ c2d:	6a 01                	push   $0x1
+ c2f:	e9 6b ff ff ff       	jmp    b9f <printf+0xcf>
+ c34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ c38:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ c3b:	83 ec 04             	sub    $0x4,%esp
+ c3e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ c41:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ c43:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ c46:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ c49:	6a 01                	push   $0x1
+ c4b:	52                   	push   %edx
+ c4c:	57                   	push   %edi
+ c4d:	e8 5b fa ff ff       	call   6ad <write>
+        ap++;
+ c52:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ c55:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ c58:	31 d2                	xor    %edx,%edx
+ c5a:	e9 be fe ff ff       	jmp    b1d <printf+0x4d>
+ c5f:	90                   	nop
+  write(fd, &c, 1);
+ c60:	83 ec 04             	sub    $0x4,%esp
+ c63:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ c66:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ c69:	6a 01                	push   $0x1
+ c6b:	e9 11 ff ff ff       	jmp    b81 <printf+0xb1>
+ c70:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ c75:	bb 42 0e 00 00       	mov    $0xe42,%ebx
+ c7a:	e9 61 ff ff ff       	jmp    be0 <printf+0x110>
+ c7f:	90                   	nop
+
+00000c80 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ c80:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c81:	a1 28 12 00 00       	mov    0x1228,%eax
+{
+ c86:	89 e5                	mov    %esp,%ebp
+ c88:	57                   	push   %edi
+ c89:	56                   	push   %esi
+ c8a:	53                   	push   %ebx
+ c8b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ c8e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c98:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c9a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c9c:	39 ca                	cmp    %ecx,%edx
+ c9e:	73 30                	jae    cd0 <free+0x50>
+ ca0:	39 c1                	cmp    %eax,%ecx
+ ca2:	72 04                	jb     ca8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ca4:	39 c2                	cmp    %eax,%edx
+ ca6:	72 f0                	jb     c98 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ ca8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ cab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ cae:	39 f8                	cmp    %edi,%eax
+ cb0:	74 2e                	je     ce0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ cb2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ cb5:	8b 42 04             	mov    0x4(%edx),%eax
+ cb8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ cbb:	39 f1                	cmp    %esi,%ecx
+ cbd:	74 38                	je     cf7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ cbf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ cc1:	5b                   	pop    %ebx
+  freep = p;
+ cc2:	89 15 28 12 00 00    	mov    %edx,0x1228
+}
+ cc8:	5e                   	pop    %esi
+ cc9:	5f                   	pop    %edi
+ cca:	5d                   	pop    %ebp
+ ccb:	c3                   	ret
+ ccc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cd0:	39 c1                	cmp    %eax,%ecx
+ cd2:	72 d0                	jb     ca4 <free+0x24>
+ cd4:	eb c2                	jmp    c98 <free+0x18>
+ cd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cdd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ ce0:	03 70 04             	add    0x4(%eax),%esi
+ ce3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ce6:	8b 02                	mov    (%edx),%eax
+ ce8:	8b 00                	mov    (%eax),%eax
+ cea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ ced:	8b 42 04             	mov    0x4(%edx),%eax
+ cf0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ cf3:	39 f1                	cmp    %esi,%ecx
+ cf5:	75 c8                	jne    cbf <free+0x3f>
+    p->s.size += bp->s.size;
+ cf7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ cfa:	89 15 28 12 00 00    	mov    %edx,0x1228
+    p->s.size += bp->s.size;
+ d00:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ d03:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ d06:	89 0a                	mov    %ecx,(%edx)
+}
+ d08:	5b                   	pop    %ebx
+ d09:	5e                   	pop    %esi
+ d0a:	5f                   	pop    %edi
+ d0b:	5d                   	pop    %ebp
+ d0c:	c3                   	ret
+ d0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d10 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ d10:	55                   	push   %ebp
+ d11:	89 e5                	mov    %esp,%ebp
+ d13:	57                   	push   %edi
+ d14:	56                   	push   %esi
+ d15:	53                   	push   %ebx
+ d16:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d19:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ d1c:	8b 15 28 12 00 00    	mov    0x1228,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d22:	8d 78 07             	lea    0x7(%eax),%edi
+ d25:	c1 ef 03             	shr    $0x3,%edi
+ d28:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ d2b:	85 d2                	test   %edx,%edx
+ d2d:	0f 84 8d 00 00 00    	je     dc0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d33:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d35:	8b 48 04             	mov    0x4(%eax),%ecx
+ d38:	39 f9                	cmp    %edi,%ecx
+ d3a:	73 64                	jae    da0 <malloc+0x90>
+  if(nu < 4096)
+ d3c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ d41:	39 df                	cmp    %ebx,%edi
+ d43:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ d46:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ d4d:	eb 0a                	jmp    d59 <malloc+0x49>
+ d4f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d50:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d52:	8b 48 04             	mov    0x4(%eax),%ecx
+ d55:	39 f9                	cmp    %edi,%ecx
+ d57:	73 47                	jae    da0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ d59:	89 c2                	mov    %eax,%edx
+ d5b:	39 05 28 12 00 00    	cmp    %eax,0x1228
+ d61:	75 ed                	jne    d50 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ d63:	83 ec 0c             	sub    $0xc,%esp
+ d66:	56                   	push   %esi
+ d67:	e8 ba fa ff ff       	call   826 <sbrk>
+  if(p == (char*)-1)
+ d6c:	83 c4 10             	add    $0x10,%esp
+ d6f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ d72:	74 1c                	je     d90 <malloc+0x80>
+  hp->s.size = nu;
+ d74:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ d77:	83 ec 0c             	sub    $0xc,%esp
+ d7a:	83 c0 08             	add    $0x8,%eax
+ d7d:	50                   	push   %eax
+ d7e:	e8 fd fe ff ff       	call   c80 <free>
+  return freep;
+ d83:	8b 15 28 12 00 00    	mov    0x1228,%edx
+      if((p = morecore(nunits)) == 0)
+ d89:	83 c4 10             	add    $0x10,%esp
+ d8c:	85 d2                	test   %edx,%edx
+ d8e:	75 c0                	jne    d50 <malloc+0x40>
+        return 0;
+  }
+}
+ d90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ d93:	31 c0                	xor    %eax,%eax
+}
+ d95:	5b                   	pop    %ebx
+ d96:	5e                   	pop    %esi
+ d97:	5f                   	pop    %edi
+ d98:	5d                   	pop    %ebp
+ d99:	c3                   	ret
+ d9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ da0:	39 cf                	cmp    %ecx,%edi
+ da2:	74 4c                	je     df0 <malloc+0xe0>
+        p->s.size -= nunits;
+ da4:	29 f9                	sub    %edi,%ecx
+ da6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ da9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ dac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ daf:	89 15 28 12 00 00    	mov    %edx,0x1228
+}
+ db5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ db8:	83 c0 08             	add    $0x8,%eax
+}
+ dbb:	5b                   	pop    %ebx
+ dbc:	5e                   	pop    %esi
+ dbd:	5f                   	pop    %edi
+ dbe:	5d                   	pop    %ebp
+ dbf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ dc0:	c7 05 28 12 00 00 2c 	movl   $0x122c,0x1228
+ dc7:	12 00 00 
+    base.s.size = 0;
+ dca:	b8 2c 12 00 00       	mov    $0x122c,%eax
+    base.s.ptr = freep = prevp = &base;
+ dcf:	c7 05 2c 12 00 00 2c 	movl   $0x122c,0x122c
+ dd6:	12 00 00 
+    base.s.size = 0;
+ dd9:	c7 05 30 12 00 00 00 	movl   $0x0,0x1230
+ de0:	00 00 00 
+    if(p->s.size >= nunits){
+ de3:	e9 54 ff ff ff       	jmp    d3c <malloc+0x2c>
+ de8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ def:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ df0:	8b 08                	mov    (%eax),%ecx
+ df2:	89 0a                	mov    %ecx,(%edx)
+ df4:	eb b9                	jmp    daf <malloc+0x9f>
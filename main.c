@@ -30,10 +30,14 @@ main(void)
   tvinit();        // trap vectors
   binit();         // buffer cache
   fileinit();      // file table
+  pciinit();       // PCI devices
   ideinit();       // disk 
+  virtioinit();    // virtio disk, if any
   startothers();   // start other processors
   kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
   userinit();      // first user process
+  wqinit(&syswq, "kworker", 1); // deferred work
+  aioinit();       // asynchronous I/O threads
   mpmain();        // finish this processor's setup
 }
 
@@ -53,6 +57,7 @@ mpmain(void)
 {
   cprintf("cpu%d: starting %d\n", cpuid(), cpuid());
   idtinit();       // load idt register
+  timerinit();     // this CPU's one-shot timer
   xchg(&(mycpu()->started), 1); // tell startothers() we're up
   scheduler();     // start running processes
 }
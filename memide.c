@@ -32,9 +32,8 @@ ideintr(void)
   // no-op
 }
 
-// Sync buf with disk.
-// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
-// Else if B_VALID is not set, read buf from disk, set B_VALID.
+// Sync buf with disk, then call biodone(b).
+// If B_DIRTY is set, write buf to disk; else read it.
 void
 iderw(struct buf *b)
 {
@@ -51,10 +50,9 @@ iderw(struct buf *b)
 
   p = memdisk + b->blockno*BSIZE;
 
-  if(b->flags & B_DIRTY){
-    b->flags &= ~B_DIRTY;
+  if(b->flags & B_DIRTY)
     memmove(p, b->data, BSIZE);
-  } else
+  else
     memmove(b->data, p, BSIZE);
-  b->flags |= B_VALID;
+  biodone(b);
 }
@@ -1,6 +1,10 @@
-#define NPROC        64  // maximum number of processes
+#define NPROC      4096  // maximum number of processes
 #define KSTACKSIZE 4096  // size of per-process kernel stack
 #define NCPU          8  // maximum number of CPUs
+#define NLOCKSTAT    64  // maximum number of distinct lock names
+#define NLOCKSITE   256  // maximum number of lock call sites profiled
+#define HZ          100  // scheduler ticks per second
+#define HRMAX  100000000  // longest nanosleep() (ns) done off the tick
 #define NOFILE       16  // open files per process
 #define NFILE       100  // open files per system
 #define NINODE       50  // maximum number of active i-nodes
@@ -9,6 +13,8 @@
 #define MAXARG       32  // max exec arguments
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
 #define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
+#define NBUF         (LOGSIZE+MAXOPBLOCKS)  // minimum size of disk block cache
+#define NBUFPAGE     2048  // most pages of buffers the cache grows by
+#define BUFRESERVE   1024  // free pages below which it stops growing
 #define FSSIZE       1000  // size of file system in blocks
 
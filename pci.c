@@ -0,0 +1,119 @@
+// PCI bus.
+//
+// pciinit() reads the configuration space of every PCI function
+// through configuration mechanism #1 (I/O ports 0xCF8/0xCFC)
+// and remembers what it found.  It does not assign resources;
+// the BIOS has already done that.  Drivers look up their
+// devices with pcifind() or pcifindid().
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "x86.h"
+#include "pci.h"
+
+#define CONFADDR  0xcf8
+#define CONFDATA  0xcfc
+#define NPCI      32
+
+static struct pcidev pcidevs[NPCI];
+static int npci;
+
+static uint
+confaddr(int bus, int dev, int func, int off)
+{
+  return 0x80000000 | (bus<<16) | (dev<<11) | (func<<8) | (off & 0xfc);
+}
+
+uint
+pciread(struct pcidev *d, int off)
+{
+  outl(CONFADDR, confaddr(d->bus, d->dev, d->func, off));
+  return inl(CONFDATA);
+}
+
+void
+pciwrite(struct pcidev *d, int off, uint val)
+{
+  outl(CONFADDR, confaddr(d->bus, d->dev, d->func, off));
+  outl(CONFDATA, val);
+}
+
+static uint
+confread(int bus, int dev, int func, int off)
+{
+  outl(CONFADDR, confaddr(bus, dev, func, off));
+  return inl(CONFDATA);
+}
+
+void
+pciinit(void)
+{
+  struct pcidev *d;
+  int bus, dev, func, nfunc, i;
+  uint id, class;
+
+  for(bus = 0; bus < 256; bus++){
+    for(dev = 0; dev < 32; dev++){
+      nfunc = 1;
+      for(func = 0; func < nfunc; func++){
+        id = confread(bus, dev, func, PCI_ID);
+        if((id & 0xffff) == 0xffff)
+          continue;
+        // Bit 7 of the header type marks a multi-function device.
+        if(func == 0 && (confread(bus, dev, 0, PCI_HEADER) & 0x800000))
+          nfunc = 8;
+        if(npci == NPCI)
+          return;
+        d = &pcidevs[npci++];
+        d->bus = bus;
+        d->dev = dev;
+        d->func = func;
+        d->vendor = id & 0xffff;
+        d->device = id >> 16;
+        class = confread(bus, dev, func, PCI_CLASS);
+        d->class = class >> 24;
+        d->subclass = class >> 16;
+        d->progif = class >> 8;
+        d->irq = confread(bus, dev, func, PCI_INTR);
+        for(i = 0; i < 6; i++)
+          d->bar[i] = confread(bus, dev, func, PCI_BAR0 + 4*i);
+      }
+    }
+  }
+}
+
+// Find the first function of the given class and subclass.
+struct pcidev*
+pcifind(int class, int subclass)
+{
+  struct pcidev *d;
+
+  for(d = pcidevs; d < &pcidevs[npci]; d++)
+    if(d->class == class && d->subclass == subclass)
+      return d;
+  return 0;
+}
+
+// Find the first function with the given vendor and device IDs.
+struct pcidev*
+pcifindid(int vendor, int device)
+{
+  struct pcidev *d;
+
+  for(d = pcidevs; d < &pcidevs[npci]; d++)
+    if(d->vendor == vendor && d->device == device)
+      return d;
+  return 0;
+}
+
+// Let d respond to I/O accesses and do DMA.
+void
+pcibusmaster(struct pcidev *d)
+{
+  uint cmd;
+
+  // The status register in the top half clears bits written as 1.
+  cmd = pciread(d, PCI_COMMAND) & 0xffff;
+  pciwrite(d, PCI_COMMAND, cmd | PCI_CMD_IO | PCI_CMD_MEM | PCI_CMD_MASTER);
+}
@@ -0,0 +1,30 @@
+// A PCI function found by pciinit().
+struct pcidev {
+  uchar bus;
+  uchar dev;
+  uchar func;
+  ushort vendor;
+  ushort device;
+  uchar class;
+  uchar subclass;
+  uchar progif;      // Programming interface
+  uchar irq;         // Interrupt line the BIOS assigned
+  uint bar[6];       // Base address registers, as read
+};
+
+// Base address register bits.
+#define PCI_BAR_IO    0x1  // In I/O space, not memory
+#define PCI_BAR_IOMASK  0xfffffffc
+
+// PCI configuration space registers.
+#define PCI_ID        0x00
+#define PCI_COMMAND   0x04
+#define PCI_CLASS     0x08
+#define PCI_HEADER    0x0c
+#define PCI_BAR0      0x10
+#define PCI_INTR      0x3c
+
+// PCI_COMMAND bits.
+#define PCI_CMD_IO    0x1  // Respond to I/O space accesses
+#define PCI_CMD_MEM   0x2  // Respond to memory space accesses
+#define PCI_CMD_MASTER 0x4  // Bus master: may do DMA
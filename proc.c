@@ -4,12 +4,26 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "x86.h"
+#include "traps.h"
+#include "procinfo.h"
 #include "proc.h"
 #include "spinlock.h"
 
+#define NPIDHASH 256  // buckets in the pid hash table
+// Chain for pid; unsigned, so that kill(-1) and the like
+// find nothing rather than index before the table.
+#define pidchain(pid) (&ptable.pidhash[(uint)(pid) % NPIDHASH])
+
+// Process descriptors are carved out of kalloc()ed pages on demand
+// and recycled through ptable.free, so the number of processes is
+// bounded only by NPROC and physical memory.  Every descriptor that
+// is not UNUSED is on ptable.list and in the pid hash.
 struct {
   struct spinlock lock;
-  struct proc proc[NPROC];
+  struct proc *list;               // All processes, through next/prev
+  struct proc *free;               // UNUSED descriptors, through next
+  struct proc *pidhash[NPIDHASH];  // Chains through hashnext
+  int nproc;                       // Processes on list
 } ptable;
 
 static struct proc *initproc;
@@ -19,6 +33,7 @@ extern void forkret(void);
 extern void trapret(void);
 
 static void wakeup1(void *chan);
+static void makerunnable(struct proc *p);
 
 void
 pinit(void)
@@ -32,68 +47,113 @@ cpuid() {
   return mycpu()-cpus;
 }
 
-// Must be called with interrupts disabled to avoid the caller being
-// rescheduled between reading lapicid and running through the loop.
+// Return this CPU's cpu structure, which seginit() installed as
+// the base of %gs.  The load itself cannot be split by a migration,
+// but the caller must have interrupts disabled for the result to
+// stay meaningful: otherwise it may be rescheduled onto another CPU.
 struct cpu*
 mycpu(void)
 {
-  int apicid, i;
-  
-  if(readeflags()&FL_IF)
-    panic("mycpu called with interrupts enabled\n");
-  
-  apicid = lapicid();
-  // APIC IDs are not guaranteed to be contiguous. Maybe we should have
-  // a reverse map, or reserve a register to store &cpus[i].
-  for (i = 0; i < ncpu; ++i) {
-    if (cpus[i].apicid == apicid)
-      return &cpus[i];
-  }
-  panic("unknown apicid\n");
+  struct cpu *c;
+
+  asm volatile("movl %%gs:0, %0" : "=r" (c));
+  return c;
 }
 
-// Disable interrupts so that we are not rescheduled
-// while reading proc from the cpu structure
+// Return the process running on this CPU.  A single %gs-relative
+// load cannot be interrupted half way, and every CPU's %gs refers
+// to its own cpu structure, so unlike mycpu() this needs no pushcli.
 struct proc*
 myproc(void) {
-  struct cpu *c;
   struct proc *p;
-  pushcli();
-  c = mycpu();
-  p = c->proc;
-  popcli();
+
+  asm volatile("movl %%gs:4, %0" : "=r" (p) : : "memory");
   return p;
 }
 
+// Return the process with the given pid, or 0.
+// The ptable lock must be held.
+static struct proc*
+findproc(int pid)
+{
+  struct proc *p;
+
+  for(p = *pidchain(pid); p; p = p->hashnext)
+    if(p->pid == pid)
+      return p;
+  return 0;
+}
+
+// Take p off the process list and pid hash and recycle it.
+// The ptable lock must be held.
+static void
+freeproc(struct proc *p)
+{
+  struct proc **pp;
+
+  for(pp = pidchain(p->pid); *pp != p; pp = &(*pp)->hashnext)
+    ;
+  *pp = p->hashnext;
+  if(p->prev)
+    p->prev->next = p->next;
+  else
+    ptable.list = p->next;
+  if(p->next)
+    p->next->prev = p->prev;
+  ptable.nproc--;
+
+  p->state = UNUSED;
+  p->next = ptable.free;
+  ptable.free = p;
+}
+
 //PAGEBREAK: 32
-// Look in the process table for an UNUSED proc.
-// If found, change state to EMBRYO and initialize
-// state required to run in the kernel.
+// Allocate a process descriptor, carving a fresh page into
+// descriptors if none are free.  If found, change state to
+// EMBRYO and initialize state required to run in the kernel.
 // Otherwise return 0.
 static struct proc*
 allocproc(void)
 {
   struct proc *p;
-  char *sp;
+  char *sp, *mem;
 
   acquire(&ptable.lock);
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == UNUSED)
-      goto found;
-
-  release(&ptable.lock);
-  return 0;
+  if(ptable.nproc >= NPROC)
+    goto bad;
+  if(ptable.free == 0){
+    if((mem = kalloc()) == 0)
+      goto bad;
+    for(p = (struct proc*)mem; p+1 <= (struct proc*)(mem+PGSIZE); p++){
+      p->next = ptable.free;
+      ptable.free = p;
+    }
+  }
+  p = ptable.free;
+  ptable.free = p->next;
+  memset(p, 0, sizeof(*p));
 
-found:
   p->state = EMBRYO;
   p->pid = nextpid++;
+  p->lastcpu = -1;
+  p->affinity = ~0;
+
+  p->next = ptable.list;
+  if(ptable.list)
+    ptable.list->prev = p;
+  ptable.list = p;
+  p->hashnext = *pidchain(p->pid);
+  *pidchain(p->pid) = p;
+  ptable.nproc++;
 
   release(&ptable.lock);
 
   // Allocate kernel stack.
   if((p->kstack = kalloc()) == 0){
-    p->state = UNUSED;
+    acquire(&ptable.lock);
+    freeproc(p);
+    release(&ptable.lock);
     return 0;
   }
   sp = p->kstack + KSTACKSIZE;
@@ -113,6 +173,50 @@ found:
   p->context->eip = (uint)forkret;
 
   return p;
+
+bad:
+  release(&ptable.lock);
+  return 0;
+}
+
+// Start a kernel thread running fn(arg).  It is a process
+// with no user memory, scheduled like any other.  If fn
+// returns, the thread exits and init reaps it.
+// Returns 0 if out of memory.
+struct proc*
+kthread_create(void (*fn)(void*), void *arg, char *name)
+{
+  struct proc *p;
+  uint *sp;
+
+  if((p = allocproc()) == 0)
+    return 0;
+  if((p->pgdir = setupkvm()) == 0){
+    kfree(p->kstack);
+    p->kstack = 0;
+    acquire(&ptable.lock);
+    freeproc(p);
+    release(&ptable.lock);
+    return 0;
+  }
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  // forkret returns to fn instead of trapret, with arg above
+  // a return address, as if exit() had called fn.
+  sp = (uint*)(p->context + 1);
+  sp[0] = (uint)fn;
+  sp[1] = (uint)exit;
+  sp[2] = (uint)arg;
+
+  acquire(&ptable.lock);
+  p->parent = initproc;
+  if(initproc){
+    p->sibling = initproc->children;
+    initproc->children = p;
+  }
+  makerunnable(p);
+  release(&ptable.lock);
+  return p;
 }
 
 //PAGEBREAK: 32
@@ -128,6 +232,8 @@ userinit(void)
   initproc = p;
   if((p->pgdir = setupkvm()) == 0)
     panic("userinit: out of memory?");
+  if(mapupages(p->pgdir, p->pid) < 0)
+    panic("userinit: out of memory?");
   cprintf("%p %p\n", _binary_initcode_start, _binary_initcode_size);
   inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
   p->sz = PGSIZE;
@@ -149,7 +255,7 @@ userinit(void)
   // because the assignment might not be atomic.
   acquire(&ptable.lock);
 
-  p->state = RUNNABLE;
+  makerunnable(p);
 
   release(&ptable.lock);
 }
@@ -163,6 +269,8 @@ growproc(int n)
   struct proc *curproc = myproc();
 
   sz = curproc->sz;
+  if(n < 0)
+    aiodrain();  // I/O threads may be writing into the pages
   if(n > 0){
     if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
       return -1;
@@ -191,14 +299,19 @@ fork(void)
   }
 
   // Copy process state from proc.
-  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
+  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0 ||
+     mapupages(np->pgdir, np->pid) < 0){
+    if(np->pgdir)
+      freevm(np->pgdir);
+    np->pgdir = 0;
     kfree(np->kstack);
     np->kstack = 0;
-    np->state = UNUSED;
+    acquire(&ptable.lock);
+    freeproc(np);
+    release(&ptable.lock);
     return -1;
   }
   np->sz = curproc->sz;
-  np->parent = curproc;
   *np->tf = *curproc->tf;
 
   // Clear %eax so that fork returns 0 in the child.
@@ -210,12 +323,80 @@ fork(void)
   np->cwd = idup(curproc->cwd);
 
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+  np->affinity = curproc->affinity;
+
+  pid = np->pid;
+
+  acquire(&ptable.lock);
+
+  np->parent = curproc;
+  np->sibling = curproc->children;
+  curproc->children = np;
+  makerunnable(np);
+
+  release(&ptable.lock);
+
+  return pid;
+}
+
+// Create a process running the program at path with argv,
+// loading it straight into a new address space instead of
+// copying the caller's and then replacing it, as fork() and
+// exec() would.  The new process's file descriptor i is a
+// duplicate of the caller's fdmap[i], for i < nfd, or closed
+// if fdmap[i] < 0; fdmap == 0 passes all of them through.
+// Returns the new pid, or -1.
+int
+spawn(char *path, char **argv, int *fdmap, int nfd)
+{
+  int i, fd, pid;
+  struct proc *np;
+  struct proc *curproc = myproc();
+
+  if(fdmap == 0)
+    nfd = NOFILE;
+  else if(nfd < 0 || nfd > NOFILE)
+    return -1;
+  for(i = 0; fdmap && i < nfd; i++)
+    if(fdmap[i] >= NOFILE || (fdmap[i] >= 0 && curproc->ofile[fdmap[i]] == 0))
+      return -1;
+
+  if((np = allocproc()) == 0)
+    return -1;
+  memset(np->tf, 0, sizeof(*np->tf));
+  if((np->pgdir = loadimage(path, argv, np->pid, &np->sz,
+                            &np->tf->eip, &np->tf->esp)) == 0){
+    kfree(np->kstack);
+    np->kstack = 0;
+    acquire(&ptable.lock);
+    freeproc(np);
+    release(&ptable.lock);
+    return -1;
+  }
+  np->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+  np->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+  np->tf->es = np->tf->ds;
+  np->tf->ss = np->tf->ds;
+  np->tf->eflags = FL_IF;
+
+  for(i = 0; i < nfd; i++){
+    fd = fdmap ? fdmap[i] : i;
+    if(fd >= 0 && curproc->ofile[fd])
+      np->ofile[i] = filedup(curproc->ofile[fd]);
+  }
+  np->cwd = idup(curproc->cwd);
+
+  safestrcpy(np->name, progname(path), sizeof(np->name));
+  np->affinity = curproc->affinity;
 
   pid = np->pid;
 
   acquire(&ptable.lock);
 
-  np->state = RUNNABLE;
+  np->parent = curproc;
+  np->sibling = curproc->children;
+  curproc->children = np;
+  makerunnable(np);
 
   release(&ptable.lock);
 
@@ -229,12 +410,14 @@ void
 exit(void)
 {
   struct proc *curproc = myproc();
-  struct proc *p;
+  struct proc *p, *last;
   int fd;
 
   if(curproc == initproc)
     panic("init exiting");
 
+  aioexit();
+
   // Close all open files.
   for(fd = 0; fd < NOFILE; fd++){
     if(curproc->ofile[fd]){
@@ -243,23 +426,31 @@ exit(void)
     }
   }
 
-  begin_op();
-  iput(curproc->cwd);
-  end_op();
-  curproc->cwd = 0;
+  if(curproc->cwd){  // kernel threads have none
+    begin_op();
+    iput(curproc->cwd);
+    end_op();
+    curproc->cwd = 0;
+  }
 
   acquire(&ptable.lock);
 
   // Parent might be sleeping in wait().
   wakeup1(curproc->parent);
 
-  // Pass abandoned children to init.
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->parent == curproc){
-      p->parent = initproc;
-      if(p->state == ZOMBIE)
-        wakeup1(initproc);
-    }
+  // Pass abandoned children to init by splicing our child list
+  // onto the front of init's.
+  last = 0;
+  for(p = curproc->children; p; p = p->sibling){
+    p->parent = initproc;
+    if(p->state == ZOMBIE)
+      wakeup1(initproc);
+    last = p;
+  }
+  if(last){
+    last->sibling = initproc->children;
+    initproc->children = curproc->children;
+    curproc->children = 0;
   }
 
   // Jump into the scheduler, never to return.
@@ -273,36 +464,35 @@ exit(void)
 int
 wait(void)
 {
-  struct proc *p;
-  int havekids, pid;
+  struct proc *p, **pp;
+  int pid;
   struct proc *curproc = myproc();
   
   acquire(&ptable.lock);
   for(;;){
-    // Scan through table looking for exited children.
-    havekids = 0;
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->parent != curproc)
-        continue;
-      havekids = 1;
+    // Scan through our children looking for exited ones.
+    for(pp = &curproc->children; (p = *pp) != 0; pp = &p->sibling){
       if(p->state == ZOMBIE){
-        // Found one.
+        // Found one.  Once it is off our child list nobody
+        // else can reap it, so free its memory without
+        // holding ptable.lock, which every scheduler needs.
+        // Its pid and descriptor stay taken until freeproc().
+        *pp = p->sibling;
         pid = p->pid;
+        release(&ptable.lock);
         kfree(p->kstack);
         p->kstack = 0;
         freevm(p->pgdir);
-        p->pid = 0;
-        p->parent = 0;
-        p->name[0] = 0;
-        p->killed = 0;
-        p->state = UNUSED;
+        p->pgdir = 0;
+        acquire(&ptable.lock);
+        freeproc(p);
         release(&ptable.lock);
         return pid;
       }
     }
 
     // No point waiting if we don't have any children.
-    if(!havekids || curproc->killed){
+    if(curproc->children == 0 || curproc->killed){
       release(&ptable.lock);
       return -1;
     }
@@ -325,6 +515,9 @@ scheduler(void)
 {
   struct proc *p;
   struct cpu *c = mycpu();
+  int id = cpuid();
+  int pass, ran;
+
   c->proc = 0;
   
   for(;;){
@@ -332,27 +525,55 @@ scheduler(void)
     sti();
 
     // Loop over process table looking for process to run.
+    // The first pass only takes processes that last ran on this
+    // CPU (or never ran, or last ran on a CPU their affinity no
+    // longer allows), whose cache and TLB state is still warm
+    // here.  Only if there are none does the second pass steal
+    // work that last ran elsewhere.
     acquire(&ptable.lock);
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->state != RUNNABLE)
-        continue;
-
-      // Switch to chosen process.  It is the process's job
-      // to release ptable.lock and then reacquire it
-      // before jumping back to us.
-      c->proc = p;
-      switchuvm(p);
-      p->state = RUNNING;
-
-      swtch(&(c->scheduler), p->context);
-      switchkvm();
-
-      // Process is done running for now.
-      // It should have changed its p->state before coming back.
-      c->proc = 0;
+    c->idle = 0;
+    ran = 0;
+    for(pass = 0; pass < 2 && !ran; pass++){
+      for(p = ptable.list; p; p = p->next){
+        if(p->state != RUNNABLE || (p->affinity & (1 << id)) == 0)
+          continue;
+        if(pass == 0 && p->lastcpu != id && p->lastcpu >= 0 &&
+           (p->affinity & (1 << p->lastcpu)))
+          continue;
+
+        // Switch to chosen process.  It is the process's job
+        // to release ptable.lock and then reacquire it
+        // before jumping back to us.
+        c->proc = p;
+        switchuvm(p);
+        p->state = RUNNING;
+        p->lastcpu = id;
+        p->nswitch++;
+
+        swtch(&(c->scheduler), p->context);
+        switchkvm();
+
+        // Process is done running for now.
+        // It should have changed its p->state before coming back.
+        c->proc = 0;
+        ran = 1;
+      }
     }
+    // Nothing to run: advertise that this CPU is about to halt,
+    // so that makerunnable() sends it a wakeup IPI.
+    if(!ran)
+      c->idle = 1;
     release(&ptable.lock);
 
+    if(!ran){
+      // Halt instead of spinning on ptable.lock.  Check idle with
+      // interrupts off: if a waker cleared it after the release
+      // above, there is work and we must not sleep; otherwise its
+      // IPI is still pending and will end the hlt.
+      cli();
+      if(c->idle)
+        stihlt();
+    }
   }
 }
 
@@ -452,6 +673,32 @@ sleep(void *chan, struct spinlock *lk)
   }
 }
 
+// Mark p RUNNABLE.  If a CPU allowed to run p is halted in
+// scheduler(), kick it with an IPI so that p does not wait for the
+// next timer interrupt, preferring the CPU p last ran on.
+// The ptable lock must be held.
+static void
+makerunnable(struct proc *p)
+{
+  struct cpu *c, *target;
+
+  p->state = RUNNABLE;
+  target = 0;
+  for(c = cpus; c < cpus+ncpu; c++){
+    if(!c->idle || (p->affinity & (1 << (c-cpus))) == 0)
+      continue;
+    if(target == 0 || c-cpus == p->lastcpu)
+      target = c;
+  }
+  if(target == 0)
+    return;
+  target->idle = 0;
+  // We may be in an interrupt taken on an idle CPU; it is
+  // going to rescan the table anyway, so don't IPI ourselves.
+  if(target != mycpu())
+    lapicipi(target->apicid, T_IRQ0 + IRQ_WAKEUP);
+}
+
 //PAGEBREAK!
 // Wake up all processes sleeping on chan.
 // The ptable lock must be held.
@@ -460,9 +707,9 @@ wakeup1(void *chan)
 {
   struct proc *p;
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+  for(p = ptable.list; p; p = p->next)
     if(p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
+      makerunnable(p);
 }
 
 // Wake up all processes sleeping on chan.
@@ -474,6 +721,17 @@ wakeup(void *chan)
   release(&ptable.lock);
 }
 
+// Wake up p if it is sleeping on chan, without scanning
+// the process list for other sleepers.
+void
+wakeproc(struct proc *p, void *chan)
+{
+  acquire(&ptable.lock);
+  if(p->state == SLEEPING && p->chan == chan)
+    makerunnable(p);
+  release(&ptable.lock);
+}
+
 // Kill the process with the given pid.
 // Process won't exit until it returns
 // to user space (see trap in trap.c).
@@ -483,20 +741,93 @@ kill(int pid)
   struct proc *p;
 
   acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->pid == pid){
-      p->killed = 1;
-      // Wake process from sleep if necessary.
-      if(p->state == SLEEPING)
-        p->state = RUNNABLE;
-      release(&ptable.lock);
-      return 0;
+  if((p = findproc(pid)) != 0){
+    p->killed = 1;
+    // Wake process from sleep if necessary.
+    if(p->state == SLEEPING)
+      makerunnable(p);
+    release(&ptable.lock);
+    return 0;
+  }
+  release(&ptable.lock);
+  return -1;
+}
+
+// Restrict the process with the given pid to the CPUs in mask.
+// If that excludes the CPU the caller is running on, give it up
+// now rather than at the next timer tick.
+int
+setaffinity(int pid, uint mask)
+{
+  struct proc *p;
+
+  mask &= (1 << ncpu) - 1;
+  if(mask == 0)
+    return -1;
+
+  acquire(&ptable.lock);
+  if((p = findproc(pid)) != 0){
+    p->affinity = mask;
+    if(p == myproc() && (mask & (1 << cpuid())) == 0){
+      makerunnable(p);
+      sched();
     }
+    release(&ptable.lock);
+    return 0;
+  }
+  release(&ptable.lock);
+  return -1;
+}
+
+// Return the CPU mask of the process with the given pid,
+// limited to the CPUs that are present, or -1.
+int
+getaffinity(int pid)
+{
+  struct proc *p;
+  int mask;
+
+  acquire(&ptable.lock);
+  if((p = findproc(pid)) != 0){
+    mask = p->affinity & ((1 << ncpu) - 1);
+    release(&ptable.lock);
+    return mask;
   }
   release(&ptable.lock);
   return -1;
 }
 
+// Fill in up to n entries of info, one per process.
+// Returns the number filled in.
+int
+getprocinfo(struct procinfo *info, int n)
+{
+  struct proc *p;
+  int i;
+
+  acquire(&ptable.lock);
+  for(i = 0, p = ptable.list; p && i < n; p = p->next){
+    if(p->state == UNUSED)
+      continue;
+    info[i].pid = p->pid;
+    info[i].ppid = p->parent ? p->parent->pid : 0;
+    info[i].state = p->state;
+    info[i].cpu = p->lastcpu;
+    info[i].utime = p->utime;
+    info[i].stime = p->stime;
+    info[i].nswitch = p->nswitch;
+    info[i].nfault = p->nfault;
+    info[i].nbread = p->nbread;
+    info[i].nbwrite = p->nbwrite;
+    // Nothing is paged out, so all of [0, sz) is resident.
+    info[i].rss = PGROUNDUP(p->sz) / PGSIZE;
+    safestrcpy(info[i].name, p->name, sizeof(info[i].name));
+    i++;
+  }
+  release(&ptable.lock);
+  return i;
+}
+
 //PAGEBREAK: 36
 // Print a process listing to console.  For debugging.
 // Runs when user types ^P on console.
@@ -517,14 +848,12 @@ procdump(void)
   char *state;
   uint pc[10];
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->state == UNUSED)
-      continue;
+  for(p = ptable.list; p; p = p->next){
     if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
       state = states[p->state];
     else
       state = "???";
-    cprintf("%d %s %s", p->pid, state, p->name);
+    cprintf("%d %s %s u%d s%d", p->pid, state, p->name, p->utime, p->stime);
     if(p->state == SLEEPING){
       getcallerpcs((uint*)p->context->ebp+2, pc);
       for(i=0; i<10 && pc[i] != 0; i++)
@@ -1,5 +1,10 @@
 // Per-CPU state
+// seginit() points the base of %gs at each CPU's struct cpu, so the
+// first two fields are reachable with a single %gs-relative load
+// (see mycpu() and myproc()).  Do not move them.
 struct cpu {
+  struct cpu *self;            // %gs:0, points at this struct cpu
+  struct proc *proc;           // %gs:4, the process running on this cpu or null
   uchar apicid;                // Local APIC ID
   struct context *scheduler;   // swtch() here to enter scheduler
   struct taskstate ts;         // Used by x86 to find stack for interrupt
@@ -7,7 +12,8 @@ struct cpu {
   volatile uint started;       // Has the CPU started?
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
-  struct proc *proc;           // The process running on this cpu or null
+  volatile int idle;           // Halted in scheduler(), waiting for work?
+  uint nbhit;                  // Buffer cache hits on this CPU (bio.c)
 };
 
 extern struct cpu cpus[NCPU];
@@ -42,6 +48,8 @@ struct proc {
   enum procstate state;        // Process state
   int pid;                     // Process ID
   struct proc *parent;         // Parent process
+  struct proc *children;       // First child; the rest follow via sibling
+  struct proc *sibling;        // Next child of parent
   struct trapframe *tf;        // Trap frame for current syscall
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
@@ -49,6 +57,22 @@ struct proc {
   struct file *ofile[NOFILE];  // Open files
   struct inode *cwd;           // Current directory
   char name[16];               // Process name (debugging)
+  struct proc *next;           // ptable.list or ptable.free
+  struct proc *prev;           // ptable.list
+  struct proc *hashnext;       // Next process in this pid hash bucket
+  int lastcpu;                 // cpuid() this process last ran on, or -1
+  uint affinity;               // Bitmask of cpuids allowed to run it
+  uint twhen;                  // Wake-up time while on a timer queue
+  struct proc *tnext;          // Next process on the same timer queue
+  struct proc *slnext;         // Next waiter for the same sleep lock
+  int slwait;                  // Sleep lock mode waited for, 0 once granted
+  struct aioctx *aio;          // Asynchronous I/O rings, or 0
+  uint utime;                  // Clock ticks spent in user mode
+  uint stime;                  // Clock ticks spent in the kernel
+  uint nswitch;                // Times the scheduler switched to it
+  uint nfault;                 // Page faults
+  uint nbread;                 // Disk blocks read
+  uint nbwrite;                // Disk blocks written
 };
 
 // Process memory is laid out contiguously, low addresses first:
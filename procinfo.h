@@ -0,0 +1,16 @@
+// Per-process statistics, as returned by getprocinfo().
+
+struct procinfo {
+  int pid;
+  int ppid;
+  int state;         // enum procstate in proc.h
+  int cpu;           // CPU it last ran on, or -1
+  uint utime;        // Clock ticks spent in user mode
+  uint stime;        // Clock ticks spent in the kernel
+  uint nswitch;      // Times the scheduler switched to it
+  uint nfault;       // Page faults
+  uint nbread;       // Disk blocks read (buffer cache misses)
+  uint nbwrite;      // Disk blocks written
+  uint rss;          // Resident user pages
+  char name[16];
+};
@@ -0,0 +1,1559 @@
+
+_rm:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	bf 01 00 00 00       	mov    $0x1,%edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1c:	8b 31                	mov    (%ecx),%esi
+  1e:	83 c3 04             	add    $0x4,%ebx
+  int i;
+
+  if(argc < 2){
+  21:	83 fe 01             	cmp    $0x1,%esi
+  24:	7f 14                	jg     3a <main+0x3a>
+  26:	eb 3a                	jmp    62 <main+0x62>
+  28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+    printf(2, "Usage: rm files...\n");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  30:	83 c7 01             	add    $0x1,%edi
+  33:	83 c3 04             	add    $0x4,%ebx
+  36:	39 fe                	cmp    %edi,%esi
+  38:	74 23                	je     5d <main+0x5d>
+    if(unlink(argv[i]) < 0){
+  3a:	83 ec 0c             	sub    $0xc,%esp
+  3d:	ff 33                	push   (%ebx)
+  3f:	e8 57 04 00 00       	call   49b <unlink>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	85 c0                	test   %eax,%eax
+  49:	79 e5                	jns    30 <main+0x30>
+      printf(2, "rm: %s failed to delete\n", argv[i]);
+  4b:	50                   	push   %eax
+  4c:	ff 33                	push   (%ebx)
+  4e:	68 4c 0b 00 00       	push   $0xb4c
+  53:	6a 02                	push   $0x2
+  55:	e8 b6 07 00 00       	call   810 <printf>
+      break;
+  5a:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+  5d:	e8 17 03 00 00       	call   379 <exit>
+    printf(2, "Usage: rm files...\n");
+  62:	52                   	push   %edx
+  63:	52                   	push   %edx
+  64:	68 38 0b 00 00       	push   $0xb38
+  69:	6a 02                	push   $0x2
+  6b:	e8 a0 07 00 00       	call   810 <printf>
+    exit();
+  70:	e8 04 03 00 00       	call   379 <exit>
+  75:	66 90                	xchg   %ax,%ax
+  77:	66 90                	xchg   %ax,%ax
+  79:	66 90                	xchg   %ax,%ax
+  7b:	66 90                	xchg   %ax,%ax
+  7d:	66 90                	xchg   %ax,%ax
+  7f:	90                   	nop
+
+00000080 <strcpy>:
+#include "date.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  80:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  81:	31 c0                	xor    %eax,%eax
+{
+  83:	89 e5                	mov    %esp,%ebp
+  85:	53                   	push   %ebx
+  86:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  89:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  90:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  94:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  97:	83 c0 01             	add    $0x1,%eax
+  9a:	84 d2                	test   %dl,%dl
+  9c:	75 f2                	jne    90 <strcpy+0x10>
+    ;
+  return os;
+}
+  9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  a1:	89 c8                	mov    %ecx,%eax
+  a3:	c9                   	leave
+  a4:	c3                   	ret
+  a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  b0:	55                   	push   %ebp
+  b1:	89 e5                	mov    %esp,%ebp
+  b3:	53                   	push   %ebx
+  b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  ba:	0f b6 02             	movzbl (%edx),%eax
+  bd:	84 c0                	test   %al,%al
+  bf:	75 17                	jne    d8 <strcmp+0x28>
+  c1:	eb 3a                	jmp    fd <strcmp+0x4d>
+  c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  c7:	90                   	nop
+  c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  cc:	83 c2 01             	add    $0x1,%edx
+  cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  d2:	84 c0                	test   %al,%al
+  d4:	74 1a                	je     f0 <strcmp+0x40>
+    p++, q++;
+  d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  d8:	0f b6 19             	movzbl (%ecx),%ebx
+  db:	38 c3                	cmp    %al,%bl
+  dd:	74 e9                	je     c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  df:	29 d8                	sub    %ebx,%eax
+}
+  e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  e4:	c9                   	leave
+  e5:	c3                   	ret
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  f4:	31 c0                	xor    %eax,%eax
+  f6:	29 d8                	sub    %ebx,%eax
+}
+  f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  fb:	c9                   	leave
+  fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 100:	31 c0                	xor    %eax,%eax
+ 102:	eb db                	jmp    df <strcmp+0x2f>
+ 104:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 10f:	90                   	nop
+
+00000110 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 116:	80 3a 00             	cmpb   $0x0,(%edx)
+ 119:	74 15                	je     130 <strlen+0x20>
+ 11b:	31 c0                	xor    %eax,%eax
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+ 120:	83 c0 01             	add    $0x1,%eax
+ 123:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 127:	89 c1                	mov    %eax,%ecx
+ 129:	75 f5                	jne    120 <strlen+0x10>
+    ;
+  return n;
+}
+ 12b:	89 c8                	mov    %ecx,%eax
+ 12d:	5d                   	pop    %ebp
+ 12e:	c3                   	ret
+ 12f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 130:	31 c9                	xor    %ecx,%ecx
+}
+ 132:	5d                   	pop    %ebp
+ 133:	89 c8                	mov    %ecx,%eax
+ 135:	c3                   	ret
+ 136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000140 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	57                   	push   %edi
+ 144:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 147:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 14a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 14d:	89 d7                	mov    %edx,%edi
+ 14f:	fc                   	cld
+ 150:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 152:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 155:	89 d0                	mov    %edx,%eax
+ 157:	c9                   	leave
+ 158:	c3                   	ret
+ 159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000160 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	8b 45 08             	mov    0x8(%ebp),%eax
+ 166:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 16a:	0f b6 10             	movzbl (%eax),%edx
+ 16d:	84 d2                	test   %dl,%dl
+ 16f:	75 12                	jne    183 <strchr+0x23>
+ 171:	eb 1d                	jmp    190 <strchr+0x30>
+ 173:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 177:	90                   	nop
+ 178:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 17c:	83 c0 01             	add    $0x1,%eax
+ 17f:	84 d2                	test   %dl,%dl
+ 181:	74 0d                	je     190 <strchr+0x30>
+    if(*s == c)
+ 183:	38 d1                	cmp    %dl,%cl
+ 185:	75 f1                	jne    178 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 187:	5d                   	pop    %ebp
+ 188:	c3                   	ret
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 190:	31 c0                	xor    %eax,%eax
+}
+ 192:	5d                   	pop    %ebp
+ 193:	c3                   	ret
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1a9:	31 db                	xor    %ebx,%ebx
+{
+ 1ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1ae:	eb 27                	jmp    1d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1b0:	83 ec 04             	sub    $0x4,%esp
+ 1b3:	6a 01                	push   $0x1
+ 1b5:	56                   	push   %esi
+ 1b6:	6a 00                	push   $0x0
+ 1b8:	e8 13 02 00 00       	call   3d0 <read>
+    if(cc < 1)
+ 1bd:	83 c4 10             	add    $0x10,%esp
+ 1c0:	85 c0                	test   %eax,%eax
+ 1c2:	7e 1d                	jle    1e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1cf:	3c 0a                	cmp    $0xa,%al
+ 1d1:	74 10                	je     1e3 <gets+0x43>
+ 1d3:	3c 0d                	cmp    $0xd,%al
+ 1d5:	74 0c                	je     1e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1d7:	89 df                	mov    %ebx,%edi
+ 1d9:	83 c3 01             	add    $0x1,%ebx
+ 1dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1df:	7c cf                	jl     1b0 <gets+0x10>
+ 1e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1ed:	5b                   	pop    %ebx
+ 1ee:	5e                   	pop    %esi
+ 1ef:	5f                   	pop    %edi
+ 1f0:	5d                   	pop    %ebp
+ 1f1:	c3                   	ret
+ 1f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	56                   	push   %esi
+ 204:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 205:	83 ec 08             	sub    $0x8,%esp
+ 208:	6a 00                	push   $0x0
+ 20a:	ff 75 08             	push   0x8(%ebp)
+ 20d:	e8 4f 02 00 00       	call   461 <open>
+  if(fd < 0)
+ 212:	83 c4 10             	add    $0x10,%esp
+ 215:	85 c0                	test   %eax,%eax
+ 217:	78 27                	js     240 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 219:	83 ec 08             	sub    $0x8,%esp
+ 21c:	ff 75 0c             	push   0xc(%ebp)
+ 21f:	89 c3                	mov    %eax,%ebx
+ 221:	50                   	push   %eax
+ 222:	e8 91 02 00 00       	call   4b8 <fstat>
+  close(fd);
+ 227:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 22a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 22c:	e8 d9 01 00 00       	call   40a <close>
+  return r;
+ 231:	83 c4 10             	add    $0x10,%esp
+}
+ 234:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 237:	89 f0                	mov    %esi,%eax
+ 239:	5b                   	pop    %ebx
+ 23a:	5e                   	pop    %esi
+ 23b:	5d                   	pop    %ebp
+ 23c:	c3                   	ret
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 240:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 245:	eb ed                	jmp    234 <stat+0x34>
+ 247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24e:	66 90                	xchg   %ax,%ax
+
+00000250 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	53                   	push   %ebx
+ 254:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 257:	0f be 02             	movsbl (%edx),%eax
+ 25a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 25d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 260:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 265:	77 1e                	ja     285 <atoi+0x35>
+ 267:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 270:	83 c2 01             	add    $0x1,%edx
+ 273:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 276:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 27a:	0f be 02             	movsbl (%edx),%eax
+ 27d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 280:	80 fb 09             	cmp    $0x9,%bl
+ 283:	76 eb                	jbe    270 <atoi+0x20>
+  return n;
+}
+ 285:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 288:	89 c8                	mov    %ecx,%eax
+ 28a:	c9                   	leave
+ 28b:	c3                   	ret
+ 28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	56                   	push   %esi
+ 295:	8b 45 10             	mov    0x10(%ebp),%eax
+ 298:	8b 55 08             	mov    0x8(%ebp),%edx
+ 29b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 29e:	85 c0                	test   %eax,%eax
+ 2a0:	7e 13                	jle    2b5 <memmove+0x25>
+ 2a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2a4:	89 d7                	mov    %edx,%edi
+ 2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2b1:	39 f8                	cmp    %edi,%eax
+ 2b3:	75 fb                	jne    2b0 <memmove+0x20>
+  return vdst;
+}
+ 2b5:	5e                   	pop    %esi
+ 2b6:	89 d0                	mov    %edx,%eax
+ 2b8:	5f                   	pop    %edi
+ 2b9:	5d                   	pop    %ebp
+ 2ba:	c3                   	ret
+ 2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2bf:	90                   	nop
+
+000002c0 <ugetpid>:
+// getpid() without a system call, from the page at UPROC.
+int
+ugetpid(void)
+{
+  return ((struct uproc*)UPROC)->pid;
+}
+ 2c0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+ 2c5:	c3                   	ret
+ 2c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002d0 <uclocktime>:
+
+// clocktime() without a system call, from the page at UCLOCK.
+int
+uclocktime(struct timespec *ts)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	57                   	push   %edi
+ 2d4:	56                   	push   %esi
+ 2d5:	53                   	push   %ebx
+ 2d6:	83 ec 1c             	sub    $0x1c,%esp
+  struct uclock *c = (struct uclock*)UCLOCK;
+
+  if(c->tscmult == 0)
+ 2d9:	8b 0d 08 f0 ff 7f    	mov    0x7ffff008,%ecx
+{
+ 2df:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(c->tscmult == 0)
+ 2e2:	85 c9                	test   %ecx,%ecx
+ 2e4:	74 6a                	je     350 <uclocktime+0x80>
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+ 2e6:	0f 31                	rdtsc
+static inline void
+uclockread(struct uclock *c, uint64 tsc, struct timespec *ts)
+{
+  uint64 d, ns;
+
+  d = tsc - c->tscbase;
+ 2e8:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 2ee:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+ 2f4:	89 c6                	mov    %eax,%esi
+  if((long long)d < 0)  // another CPU's TSC is a little behind
+ 2f6:	85 d2                	test   %edx,%edx
+ 2f8:	78 46                	js     340 <uclocktime+0x70>
+    d = 0;
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 2fa:	89 d0                	mov    %edx,%eax
+ 2fc:	f7 e1                	mul    %ecx
+ 2fe:	0f a4 c2 08          	shld   $0x8,%eax,%edx
+ 302:	c1 e0 08             	shl    $0x8,%eax
+ 305:	89 45 e0             	mov    %eax,-0x20(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+ 308:	89 f0                	mov    %esi,%eax
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 30a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+ 30d:	f7 e1                	mul    %ecx
+ 30f:	0f ac d0 18          	shrd   $0x18,%edx,%eax
+ 313:	c1 ea 18             	shr    $0x18,%edx
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 316:	03 45 e0             	add    -0x20(%ebp),%eax
+ 319:	13 55 e4             	adc    -0x1c(%ebp),%edx
+// linked with libgcc, so it cannot use 64-bit '/' or '%'.
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+  asm("divl %4" : "=a" (q), "=d" (r) : "a" ((uint)n), "d" ((uint)(n>>32)), "rm" (d));
+ 31c:	89 c7                	mov    %eax,%edi
+ 31e:	89 f8                	mov    %edi,%eax
+ 320:	b9 00 ca 9a 3b       	mov    $0x3b9aca00,%ecx
+ 325:	f7 f1                	div    %ecx
+  ts->sec = divl(ns, 1000000000, &ts->nsec);
+ 327:	89 03                	mov    %eax,(%ebx)
+    return clocktime(ts);
+  uclockread(c, rdtsc(), ts);
+  return 0;
+}
+ 329:	31 c0                	xor    %eax,%eax
+  *rem = r;
+ 32b:	89 53 04             	mov    %edx,0x4(%ebx)
+ 32e:	83 c4 1c             	add    $0x1c,%esp
+ 331:	5b                   	pop    %ebx
+ 332:	5e                   	pop    %esi
+ 333:	5f                   	pop    %edi
+ 334:	5d                   	pop    %ebp
+ 335:	c3                   	ret
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+ 340:	31 d2                	xor    %edx,%edx
+ 342:	31 ff                	xor    %edi,%edi
+ 344:	eb d8                	jmp    31e <uclocktime+0x4e>
+ 346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+ 350:	83 c4 1c             	add    $0x1c,%esp
+ 353:	5b                   	pop    %ebx
+ 354:	5e                   	pop    %esi
+ 355:	5f                   	pop    %edi
+ 356:	5d                   	pop    %ebp
+    return clocktime(ts);
+ 357:	e9 f2 02 00 00       	jmp    64e <clocktime>
+
+0000035c <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+ 35c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 361:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 368:	00 00 00 
+ 36b:	74 09                	je     376 <fork+0x1a>
+ 36d:	89 e1                	mov    %esp,%ecx
+ 36f:	ba 78 03 00 00       	mov    $0x378,%edx
+ 374:	0f 34                	sysenter
+ 376:	cd 40                	int    $0x40
+ 378:	c3                   	ret
+
+00000379 <exit>:
+SYSCALL(exit)
+ 379:	b8 02 00 00 00       	mov    $0x2,%eax
+ 37e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 385:	00 00 00 
+ 388:	74 09                	je     393 <exit+0x1a>
+ 38a:	89 e1                	mov    %esp,%ecx
+ 38c:	ba 95 03 00 00       	mov    $0x395,%edx
+ 391:	0f 34                	sysenter
+ 393:	cd 40                	int    $0x40
+ 395:	c3                   	ret
+
+00000396 <wait>:
+SYSCALL(wait)
+ 396:	b8 03 00 00 00       	mov    $0x3,%eax
+ 39b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 3a2:	00 00 00 
+ 3a5:	74 09                	je     3b0 <wait+0x1a>
+ 3a7:	89 e1                	mov    %esp,%ecx
+ 3a9:	ba b2 03 00 00       	mov    $0x3b2,%edx
+ 3ae:	0f 34                	sysenter
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <pipe>:
+SYSCALL(pipe)
+ 3b3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3b8:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 3bf:	00 00 00 
+ 3c2:	74 09                	je     3cd <pipe+0x1a>
+ 3c4:	89 e1                	mov    %esp,%ecx
+ 3c6:	ba cf 03 00 00       	mov    $0x3cf,%edx
+ 3cb:	0f 34                	sysenter
+ 3cd:	cd 40                	int    $0x40
+ 3cf:	c3                   	ret
+
+000003d0 <read>:
+SYSCALL(read)
+ 3d0:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3d5:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 3dc:	00 00 00 
+ 3df:	74 09                	je     3ea <read+0x1a>
+ 3e1:	89 e1                	mov    %esp,%ecx
+ 3e3:	ba ec 03 00 00       	mov    $0x3ec,%edx
+ 3e8:	0f 34                	sysenter
+ 3ea:	cd 40                	int    $0x40
+ 3ec:	c3                   	ret
+
+000003ed <write>:
+SYSCALL(write)
+ 3ed:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3f2:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 3f9:	00 00 00 
+ 3fc:	74 09                	je     407 <write+0x1a>
+ 3fe:	89 e1                	mov    %esp,%ecx
+ 400:	ba 09 04 00 00       	mov    $0x409,%edx
+ 405:	0f 34                	sysenter
+ 407:	cd 40                	int    $0x40
+ 409:	c3                   	ret
+
+0000040a <close>:
+SYSCALL(close)
+ 40a:	b8 15 00 00 00       	mov    $0x15,%eax
+ 40f:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 416:	00 00 00 
+ 419:	74 09                	je     424 <close+0x1a>
+ 41b:	89 e1                	mov    %esp,%ecx
+ 41d:	ba 26 04 00 00       	mov    $0x426,%edx
+ 422:	0f 34                	sysenter
+ 424:	cd 40                	int    $0x40
+ 426:	c3                   	ret
+
+00000427 <kill>:
+SYSCALL(kill)
+ 427:	b8 06 00 00 00       	mov    $0x6,%eax
+ 42c:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 433:	00 00 00 
+ 436:	74 09                	je     441 <kill+0x1a>
+ 438:	89 e1                	mov    %esp,%ecx
+ 43a:	ba 43 04 00 00       	mov    $0x443,%edx
+ 43f:	0f 34                	sysenter
+ 441:	cd 40                	int    $0x40
+ 443:	c3                   	ret
+
+00000444 <exec>:
+SYSCALL(exec)
+ 444:	b8 07 00 00 00       	mov    $0x7,%eax
+ 449:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 450:	00 00 00 
+ 453:	74 09                	je     45e <exec+0x1a>
+ 455:	89 e1                	mov    %esp,%ecx
+ 457:	ba 60 04 00 00       	mov    $0x460,%edx
+ 45c:	0f 34                	sysenter
+ 45e:	cd 40                	int    $0x40
+ 460:	c3                   	ret
+
+00000461 <open>:
+SYSCALL(open)
+ 461:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 466:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 46d:	00 00 00 
+ 470:	74 09                	je     47b <open+0x1a>
+ 472:	89 e1                	mov    %esp,%ecx
+ 474:	ba 7d 04 00 00       	mov    $0x47d,%edx
+ 479:	0f 34                	sysenter
+ 47b:	cd 40                	int    $0x40
+ 47d:	c3                   	ret
+
+0000047e <mknod>:
+SYSCALL(mknod)
+ 47e:	b8 11 00 00 00       	mov    $0x11,%eax
+ 483:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 48a:	00 00 00 
+ 48d:	74 09                	je     498 <mknod+0x1a>
+ 48f:	89 e1                	mov    %esp,%ecx
+ 491:	ba 9a 04 00 00       	mov    $0x49a,%edx
+ 496:	0f 34                	sysenter
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <unlink>:
+SYSCALL(unlink)
+ 49b:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4a0:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4a7:	00 00 00 
+ 4aa:	74 09                	je     4b5 <unlink+0x1a>
+ 4ac:	89 e1                	mov    %esp,%ecx
+ 4ae:	ba b7 04 00 00       	mov    $0x4b7,%edx
+ 4b3:	0f 34                	sysenter
+ 4b5:	cd 40                	int    $0x40
+ 4b7:	c3                   	ret
+
+000004b8 <fstat>:
+SYSCALL(fstat)
+ 4b8:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4bd:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4c4:	00 00 00 
+ 4c7:	74 09                	je     4d2 <fstat+0x1a>
+ 4c9:	89 e1                	mov    %esp,%ecx
+ 4cb:	ba d4 04 00 00       	mov    $0x4d4,%edx
+ 4d0:	0f 34                	sysenter
+ 4d2:	cd 40                	int    $0x40
+ 4d4:	c3                   	ret
+
+000004d5 <link>:
+SYSCALL(link)
+ 4d5:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4da:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4e1:	00 00 00 
+ 4e4:	74 09                	je     4ef <link+0x1a>
+ 4e6:	89 e1                	mov    %esp,%ecx
+ 4e8:	ba f1 04 00 00       	mov    $0x4f1,%edx
+ 4ed:	0f 34                	sysenter
+ 4ef:	cd 40                	int    $0x40
+ 4f1:	c3                   	ret
+
+000004f2 <mkdir>:
+SYSCALL(mkdir)
+ 4f2:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4f7:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4fe:	00 00 00 
+ 501:	74 09                	je     50c <mkdir+0x1a>
+ 503:	89 e1                	mov    %esp,%ecx
+ 505:	ba 0e 05 00 00       	mov    $0x50e,%edx
+ 50a:	0f 34                	sysenter
+ 50c:	cd 40                	int    $0x40
+ 50e:	c3                   	ret
+
+0000050f <chdir>:
+SYSCALL(chdir)
+ 50f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 514:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 51b:	00 00 00 
+ 51e:	74 09                	je     529 <chdir+0x1a>
+ 520:	89 e1                	mov    %esp,%ecx
+ 522:	ba 2b 05 00 00       	mov    $0x52b,%edx
+ 527:	0f 34                	sysenter
+ 529:	cd 40                	int    $0x40
+ 52b:	c3                   	ret
+
+0000052c <dup>:
+SYSCALL(dup)
+ 52c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 531:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 538:	00 00 00 
+ 53b:	74 09                	je     546 <dup+0x1a>
+ 53d:	89 e1                	mov    %esp,%ecx
+ 53f:	ba 48 05 00 00       	mov    $0x548,%edx
+ 544:	0f 34                	sysenter
+ 546:	cd 40                	int    $0x40
+ 548:	c3                   	ret
+
+00000549 <getpid>:
+SYSCALL(getpid)
+ 549:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 54e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 555:	00 00 00 
+ 558:	74 09                	je     563 <getpid+0x1a>
+ 55a:	89 e1                	mov    %esp,%ecx
+ 55c:	ba 65 05 00 00       	mov    $0x565,%edx
+ 561:	0f 34                	sysenter
+ 563:	cd 40                	int    $0x40
+ 565:	c3                   	ret
+
+00000566 <sbrk>:
+SYSCALL(sbrk)
+ 566:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 56b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 572:	00 00 00 
+ 575:	74 09                	je     580 <sbrk+0x1a>
+ 577:	89 e1                	mov    %esp,%ecx
+ 579:	ba 82 05 00 00       	mov    $0x582,%edx
+ 57e:	0f 34                	sysenter
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <sleep>:
+SYSCALL(sleep)
+ 583:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 588:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 58f:	00 00 00 
+ 592:	74 09                	je     59d <sleep+0x1a>
+ 594:	89 e1                	mov    %esp,%ecx
+ 596:	ba 9f 05 00 00       	mov    $0x59f,%edx
+ 59b:	0f 34                	sysenter
+ 59d:	cd 40                	int    $0x40
+ 59f:	c3                   	ret
+
+000005a0 <uptime>:
+SYSCALL(uptime)
+ 5a0:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5a5:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5ac:	00 00 00 
+ 5af:	74 09                	je     5ba <uptime+0x1a>
+ 5b1:	89 e1                	mov    %esp,%ecx
+ 5b3:	ba bc 05 00 00       	mov    $0x5bc,%edx
+ 5b8:	0f 34                	sysenter
+ 5ba:	cd 40                	int    $0x40
+ 5bc:	c3                   	ret
+
+000005bd <swapread>:
+SYSCALL(swapread)
+ 5bd:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5c2:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5c9:	00 00 00 
+ 5cc:	74 09                	je     5d7 <swapread+0x1a>
+ 5ce:	89 e1                	mov    %esp,%ecx
+ 5d0:	ba d9 05 00 00       	mov    $0x5d9,%edx
+ 5d5:	0f 34                	sysenter
+ 5d7:	cd 40                	int    $0x40
+ 5d9:	c3                   	ret
+
+000005da <swapwrite>:
+SYSCALL(swapwrite)
+ 5da:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5df:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5e6:	00 00 00 
+ 5e9:	74 09                	je     5f4 <swapwrite+0x1a>
+ 5eb:	89 e1                	mov    %esp,%ecx
+ 5ed:	ba f6 05 00 00       	mov    $0x5f6,%edx
+ 5f2:	0f 34                	sysenter
+ 5f4:	cd 40                	int    $0x40
+ 5f6:	c3                   	ret
+
+000005f7 <setaffinity>:
+SYSCALL(setaffinity)
+ 5f7:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5fc:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 603:	00 00 00 
+ 606:	74 09                	je     611 <setaffinity+0x1a>
+ 608:	89 e1                	mov    %esp,%ecx
+ 60a:	ba 13 06 00 00       	mov    $0x613,%edx
+ 60f:	0f 34                	sysenter
+ 611:	cd 40                	int    $0x40
+ 613:	c3                   	ret
+
+00000614 <getaffinity>:
+SYSCALL(getaffinity)
+ 614:	b8 19 00 00 00       	mov    $0x19,%eax
+ 619:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 620:	00 00 00 
+ 623:	74 09                	je     62e <getaffinity+0x1a>
+ 625:	89 e1                	mov    %esp,%ecx
+ 627:	ba 30 06 00 00       	mov    $0x630,%edx
+ 62c:	0f 34                	sysenter
+ 62e:	cd 40                	int    $0x40
+ 630:	c3                   	ret
+
+00000631 <nanosleep>:
+SYSCALL(nanosleep)
+ 631:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 636:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 63d:	00 00 00 
+ 640:	74 09                	je     64b <nanosleep+0x1a>
+ 642:	89 e1                	mov    %esp,%ecx
+ 644:	ba 4d 06 00 00       	mov    $0x64d,%edx
+ 649:	0f 34                	sysenter
+ 64b:	cd 40                	int    $0x40
+ 64d:	c3                   	ret
+
+0000064e <clocktime>:
+SYSCALL(clocktime)
+ 64e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 653:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 65a:	00 00 00 
+ 65d:	74 09                	je     668 <clocktime+0x1a>
+ 65f:	89 e1                	mov    %esp,%ecx
+ 661:	ba 6a 06 00 00       	mov    $0x66a,%edx
+ 666:	0f 34                	sysenter
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <batch>:
+SYSCALL(batch)
+ 66b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 670:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 677:	00 00 00 
+ 67a:	74 09                	je     685 <batch+0x1a>
+ 67c:	89 e1                	mov    %esp,%ecx
+ 67e:	ba 87 06 00 00       	mov    $0x687,%edx
+ 683:	0f 34                	sysenter
+ 685:	cd 40                	int    $0x40
+ 687:	c3                   	ret
+
+00000688 <aiosetup>:
+SYSCALL(aiosetup)
+ 688:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 68d:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 694:	00 00 00 
+ 697:	74 09                	je     6a2 <aiosetup+0x1a>
+ 699:	89 e1                	mov    %esp,%ecx
+ 69b:	ba a4 06 00 00       	mov    $0x6a4,%edx
+ 6a0:	0f 34                	sysenter
+ 6a2:	cd 40                	int    $0x40
+ 6a4:	c3                   	ret
+
+000006a5 <aiowait>:
+SYSCALL(aiowait)
+ 6a5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6aa:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6b1:	00 00 00 
+ 6b4:	74 09                	je     6bf <aiowait+0x1a>
+ 6b6:	89 e1                	mov    %esp,%ecx
+ 6b8:	ba c1 06 00 00       	mov    $0x6c1,%edx
+ 6bd:	0f 34                	sysenter
+ 6bf:	cd 40                	int    $0x40
+ 6c1:	c3                   	ret
+
+000006c2 <spawn>:
+SYSCALL(spawn)
+ 6c2:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6c7:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6ce:	00 00 00 
+ 6d1:	74 09                	je     6dc <spawn+0x1a>
+ 6d3:	89 e1                	mov    %esp,%ecx
+ 6d5:	ba de 06 00 00       	mov    $0x6de,%edx
+ 6da:	0f 34                	sysenter
+ 6dc:	cd 40                	int    $0x40
+ 6de:	c3                   	ret
+
+000006df <getprocinfo>:
+SYSCALL(getprocinfo)
+ 6df:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6e4:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6eb:	00 00 00 
+ 6ee:	74 09                	je     6f9 <getprocinfo+0x1a>
+ 6f0:	89 e1                	mov    %esp,%ecx
+ 6f2:	ba fb 06 00 00       	mov    $0x6fb,%edx
+ 6f7:	0f 34                	sysenter
+ 6f9:	cd 40                	int    $0x40
+ 6fb:	c3                   	ret
+
+000006fc <getlockstat>:
+SYSCALL(getlockstat)
+ 6fc:	b8 21 00 00 00       	mov    $0x21,%eax
+ 701:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 708:	00 00 00 
+ 70b:	74 09                	je     716 <getlockstat+0x1a>
+ 70d:	89 e1                	mov    %esp,%ecx
+ 70f:	ba 18 07 00 00       	mov    $0x718,%edx
+ 714:	0f 34                	sysenter
+ 716:	cd 40                	int    $0x40
+ 718:	c3                   	ret
+
+00000719 <lockprof>:
+SYSCALL(lockprof)
+ 719:	b8 22 00 00 00       	mov    $0x22,%eax
+ 71e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 725:	00 00 00 
+ 728:	74 09                	je     733 <lockprof+0x1a>
+ 72a:	89 e1                	mov    %esp,%ecx
+ 72c:	ba 35 07 00 00       	mov    $0x735,%edx
+ 731:	0f 34                	sysenter
+ 733:	cd 40                	int    $0x40
+ 735:	c3                   	ret
+
+00000736 <getlockprof>:
+SYSCALL(getlockprof)
+ 736:	b8 23 00 00 00       	mov    $0x23,%eax
+ 73b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 742:	00 00 00 
+ 745:	74 09                	je     750 <getlockprof+0x1a>
+ 747:	89 e1                	mov    %esp,%ecx
+ 749:	ba 52 07 00 00       	mov    $0x752,%edx
+ 74e:	0f 34                	sysenter
+ 750:	cd 40                	int    $0x40
+ 752:	c3                   	ret
+
+00000753 <diskstat>:
+SYSCALL(diskstat)
+ 753:	b8 24 00 00 00       	mov    $0x24,%eax
+ 758:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 75f:	00 00 00 
+ 762:	74 09                	je     76d <diskstat+0x1a>
+ 764:	89 e1                	mov    %esp,%ecx
+ 766:	ba 6f 07 00 00       	mov    $0x76f,%edx
+ 76b:	0f 34                	sysenter
+ 76d:	cd 40                	int    $0x40
+ 76f:	c3                   	ret
+
+00000770 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 770:	55                   	push   %ebp
+ 771:	89 e5                	mov    %esp,%ebp
+ 773:	57                   	push   %edi
+ 774:	56                   	push   %esi
+ 775:	53                   	push   %ebx
+ 776:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 778:	89 d1                	mov    %edx,%ecx
+{
+ 77a:	83 ec 3c             	sub    $0x3c,%esp
+ 77d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 780:	85 d2                	test   %edx,%edx
+ 782:	0f 89 80 00 00 00    	jns    808 <printint+0x98>
+ 788:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 78c:	74 7a                	je     808 <printint+0x98>
+    x = -xx;
+ 78e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 790:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 795:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 798:	31 f6                	xor    %esi,%esi
+ 79a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 7a0:	89 c8                	mov    %ecx,%eax
+ 7a2:	31 d2                	xor    %edx,%edx
+ 7a4:	89 f7                	mov    %esi,%edi
+ 7a6:	f7 f3                	div    %ebx
+ 7a8:	8d 76 01             	lea    0x1(%esi),%esi
+ 7ab:	0f b6 92 c4 0b 00 00 	movzbl 0xbc4(%edx),%edx
+ 7b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 7b6:	89 ca                	mov    %ecx,%edx
+ 7b8:	89 c1                	mov    %eax,%ecx
+ 7ba:	39 da                	cmp    %ebx,%edx
+ 7bc:	73 e2                	jae    7a0 <printint+0x30>
+  if(neg)
+ 7be:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 7c1:	85 c0                	test   %eax,%eax
+ 7c3:	74 07                	je     7cc <printint+0x5c>
+    buf[i++] = '-';
+ 7c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 7ca:	89 f7                	mov    %esi,%edi
+ 7cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 7cf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 7d2:	01 df                	add    %ebx,%edi
+ 7d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 7d8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 7db:	83 ec 04             	sub    $0x4,%esp
+ 7de:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 7e1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 7e4:	6a 01                	push   $0x1
+ 7e6:	50                   	push   %eax
+ 7e7:	56                   	push   %esi
+ 7e8:	e8 00 fc ff ff       	call   3ed <write>
+  while(--i >= 0)
+ 7ed:	89 f8                	mov    %edi,%eax
+ 7ef:	83 c4 10             	add    $0x10,%esp
+ 7f2:	83 ef 01             	sub    $0x1,%edi
+ 7f5:	39 d8                	cmp    %ebx,%eax
+ 7f7:	75 df                	jne    7d8 <printint+0x68>
+}
+ 7f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7fc:	5b                   	pop    %ebx
+ 7fd:	5e                   	pop    %esi
+ 7fe:	5f                   	pop    %edi
+ 7ff:	5d                   	pop    %ebp
+ 800:	c3                   	ret
+ 801:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 808:	31 c0                	xor    %eax,%eax
+ 80a:	eb 89                	jmp    795 <printint+0x25>
+ 80c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000810 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 810:	55                   	push   %ebp
+ 811:	89 e5                	mov    %esp,%ebp
+ 813:	57                   	push   %edi
+ 814:	56                   	push   %esi
+ 815:	53                   	push   %ebx
+ 816:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 819:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 81c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 81f:	0f b6 1e             	movzbl (%esi),%ebx
+ 822:	83 c6 01             	add    $0x1,%esi
+ 825:	84 db                	test   %bl,%bl
+ 827:	74 67                	je     890 <printf+0x80>
+ 829:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 82c:	31 d2                	xor    %edx,%edx
+ 82e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 831:	eb 34                	jmp    867 <printf+0x57>
+ 833:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 837:	90                   	nop
+ 838:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 83b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 840:	83 f8 25             	cmp    $0x25,%eax
+ 843:	74 18                	je     85d <printf+0x4d>
+  write(fd, &c, 1);
+ 845:	83 ec 04             	sub    $0x4,%esp
+ 848:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 84b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 84e:	6a 01                	push   $0x1
+ 850:	50                   	push   %eax
+ 851:	57                   	push   %edi
+ 852:	e8 96 fb ff ff       	call   3ed <write>
+ 857:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 85a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 85d:	0f b6 1e             	movzbl (%esi),%ebx
+ 860:	83 c6 01             	add    $0x1,%esi
+ 863:	84 db                	test   %bl,%bl
+ 865:	74 29                	je     890 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 867:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 86a:	85 d2                	test   %edx,%edx
+ 86c:	74 ca                	je     838 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 86e:	83 fa 25             	cmp    $0x25,%edx
+ 871:	75 ea                	jne    85d <printf+0x4d>
+      if(c == 'd'){
+ 873:	83 f8 25             	cmp    $0x25,%eax
+ 876:	0f 84 24 01 00 00    	je     9a0 <printf+0x190>
+ 87c:	83 e8 63             	sub    $0x63,%eax
+ 87f:	83 f8 15             	cmp    $0x15,%eax
+ 882:	77 1c                	ja     8a0 <printf+0x90>
+ 884:	ff 24 85 6c 0b 00 00 	jmp    *0xb6c(,%eax,4)
+ 88b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 88f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 890:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 893:	5b                   	pop    %ebx
+ 894:	5e                   	pop    %esi
+ 895:	5f                   	pop    %edi
+ 896:	5d                   	pop    %ebp
+ 897:	c3                   	ret
+ 898:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89f:	90                   	nop
+  write(fd, &c, 1);
+ 8a0:	83 ec 04             	sub    $0x4,%esp
+ 8a3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8a6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 8aa:	6a 01                	push   $0x1
+ 8ac:	52                   	push   %edx
+ 8ad:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 8b0:	57                   	push   %edi
+ 8b1:	e8 37 fb ff ff       	call   3ed <write>
+ 8b6:	83 c4 0c             	add    $0xc,%esp
+ 8b9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8bc:	6a 01                	push   $0x1
+ 8be:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 8c1:	52                   	push   %edx
+ 8c2:	57                   	push   %edi
+ 8c3:	e8 25 fb ff ff       	call   3ed <write>
+        putc(fd, c);
+ 8c8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8cb:	31 d2                	xor    %edx,%edx
+ 8cd:	eb 8e                	jmp    85d <printf+0x4d>
+ 8cf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 8d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8d3:	83 ec 0c             	sub    $0xc,%esp
+ 8d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 8db:	8b 13                	mov    (%ebx),%edx
+ 8dd:	6a 00                	push   $0x0
+ 8df:	89 f8                	mov    %edi,%eax
+        ap++;
+ 8e1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 8e4:	e8 87 fe ff ff       	call   770 <printint>
+        ap++;
+ 8e9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8ec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8ef:	31 d2                	xor    %edx,%edx
+ 8f1:	e9 67 ff ff ff       	jmp    85d <printf+0x4d>
+ 8f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8fd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 900:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 903:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 905:	83 c0 04             	add    $0x4,%eax
+ 908:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 90b:	85 db                	test   %ebx,%ebx
+ 90d:	0f 84 9d 00 00 00    	je     9b0 <printf+0x1a0>
+        while(*s != 0){
+ 913:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 916:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 918:	84 c0                	test   %al,%al
+ 91a:	0f 84 3d ff ff ff    	je     85d <printf+0x4d>
+ 920:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 923:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 926:	89 de                	mov    %ebx,%esi
+ 928:	89 d3                	mov    %edx,%ebx
+ 92a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 930:	83 ec 04             	sub    $0x4,%esp
+ 933:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 936:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 939:	6a 01                	push   $0x1
+ 93b:	53                   	push   %ebx
+ 93c:	57                   	push   %edi
+ 93d:	e8 ab fa ff ff       	call   3ed <write>
+        while(*s != 0){
+ 942:	0f b6 06             	movzbl (%esi),%eax
+ 945:	83 c4 10             	add    $0x10,%esp
+ 948:	84 c0                	test   %al,%al
+ 94a:	75 e4                	jne    930 <printf+0x120>
+      state = 0;
+ 94c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 94f:	31 d2                	xor    %edx,%edx
+ 951:	e9 07 ff ff ff       	jmp    85d <printf+0x4d>
+ 956:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 95d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 960:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 963:	83 ec 0c             	sub    $0xc,%esp
+ 966:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 96b:	8b 13                	mov    (%ebx),%edx
+ 96d:	6a 01                	push   $0x1
+ 96f:	e9 6b ff ff ff       	jmp    8df <printf+0xcf>
+ 974:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 978:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 97b:	83 ec 04             	sub    $0x4,%esp
+ 97e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 981:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 983:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 986:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 989:	6a 01                	push   $0x1
+ 98b:	52                   	push   %edx
+ 98c:	57                   	push   %edi
+ 98d:	e8 5b fa ff ff       	call   3ed <write>
+        ap++;
+ 992:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 995:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 998:	31 d2                	xor    %edx,%edx
+ 99a:	e9 be fe ff ff       	jmp    85d <printf+0x4d>
+ 99f:	90                   	nop
+  write(fd, &c, 1);
+ 9a0:	83 ec 04             	sub    $0x4,%esp
+ 9a3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9a6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9a9:	6a 01                	push   $0x1
+ 9ab:	e9 11 ff ff ff       	jmp    8c1 <printf+0xb1>
+ 9b0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 9b5:	bb 65 0b 00 00       	mov    $0xb65,%ebx
+ 9ba:	e9 61 ff ff ff       	jmp    920 <printf+0x110>
+ 9bf:	90                   	nop
+
+000009c0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 9c0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9c1:	a1 c0 0e 00 00       	mov    0xec0,%eax
+{
+ 9c6:	89 e5                	mov    %esp,%ebp
+ 9c8:	57                   	push   %edi
+ 9c9:	56                   	push   %esi
+ 9ca:	53                   	push   %ebx
+ 9cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 9ce:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9d8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9da:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9dc:	39 ca                	cmp    %ecx,%edx
+ 9de:	73 30                	jae    a10 <free+0x50>
+ 9e0:	39 c1                	cmp    %eax,%ecx
+ 9e2:	72 04                	jb     9e8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9e4:	39 c2                	cmp    %eax,%edx
+ 9e6:	72 f0                	jb     9d8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 9e8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 9eb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 9ee:	39 f8                	cmp    %edi,%eax
+ 9f0:	74 2e                	je     a20 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9f2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 9f5:	8b 42 04             	mov    0x4(%edx),%eax
+ 9f8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9fb:	39 f1                	cmp    %esi,%ecx
+ 9fd:	74 38                	je     a37 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 9ff:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a01:	5b                   	pop    %ebx
+  freep = p;
+ a02:	89 15 c0 0e 00 00    	mov    %edx,0xec0
+}
+ a08:	5e                   	pop    %esi
+ a09:	5f                   	pop    %edi
+ a0a:	5d                   	pop    %ebp
+ a0b:	c3                   	ret
+ a0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a10:	39 c1                	cmp    %eax,%ecx
+ a12:	72 d0                	jb     9e4 <free+0x24>
+ a14:	eb c2                	jmp    9d8 <free+0x18>
+ a16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a1d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ a20:	03 70 04             	add    0x4(%eax),%esi
+ a23:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a26:	8b 02                	mov    (%edx),%eax
+ a28:	8b 00                	mov    (%eax),%eax
+ a2a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ a2d:	8b 42 04             	mov    0x4(%edx),%eax
+ a30:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a33:	39 f1                	cmp    %esi,%ecx
+ a35:	75 c8                	jne    9ff <free+0x3f>
+    p->s.size += bp->s.size;
+ a37:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ a3a:	89 15 c0 0e 00 00    	mov    %edx,0xec0
+    p->s.size += bp->s.size;
+ a40:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a43:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ a46:	89 0a                	mov    %ecx,(%edx)
+}
+ a48:	5b                   	pop    %ebx
+ a49:	5e                   	pop    %esi
+ a4a:	5f                   	pop    %edi
+ a4b:	5d                   	pop    %ebp
+ a4c:	c3                   	ret
+ a4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a50 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a50:	55                   	push   %ebp
+ a51:	89 e5                	mov    %esp,%ebp
+ a53:	57                   	push   %edi
+ a54:	56                   	push   %esi
+ a55:	53                   	push   %ebx
+ a56:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a59:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ a5c:	8b 15 c0 0e 00 00    	mov    0xec0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a62:	8d 78 07             	lea    0x7(%eax),%edi
+ a65:	c1 ef 03             	shr    $0x3,%edi
+ a68:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a6b:	85 d2                	test   %edx,%edx
+ a6d:	0f 84 8d 00 00 00    	je     b00 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a73:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a75:	8b 48 04             	mov    0x4(%eax),%ecx
+ a78:	39 f9                	cmp    %edi,%ecx
+ a7a:	73 64                	jae    ae0 <malloc+0x90>
+  if(nu < 4096)
+ a7c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a81:	39 df                	cmp    %ebx,%edi
+ a83:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a86:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a8d:	eb 0a                	jmp    a99 <malloc+0x49>
+ a8f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a90:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a92:	8b 48 04             	mov    0x4(%eax),%ecx
+ a95:	39 f9                	cmp    %edi,%ecx
+ a97:	73 47                	jae    ae0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ a99:	89 c2                	mov    %eax,%edx
+ a9b:	39 05 c0 0e 00 00    	cmp    %eax,0xec0
+ aa1:	75 ed                	jne    a90 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ aa3:	83 ec 0c             	sub    $0xc,%esp
+ aa6:	56                   	push   %esi
+ aa7:	e8 ba fa ff ff       	call   566 <sbrk>
+  if(p == (char*)-1)
+ aac:	83 c4 10             	add    $0x10,%esp
+ aaf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ab2:	74 1c                	je     ad0 <malloc+0x80>
+  hp->s.size = nu;
+ ab4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ ab7:	83 ec 0c             	sub    $0xc,%esp
+ aba:	83 c0 08             	add    $0x8,%eax
+ abd:	50                   	push   %eax
+ abe:	e8 fd fe ff ff       	call   9c0 <free>
+  return freep;
+ ac3:	8b 15 c0 0e 00 00    	mov    0xec0,%edx
+      if((p = morecore(nunits)) == 0)
+ ac9:	83 c4 10             	add    $0x10,%esp
+ acc:	85 d2                	test   %edx,%edx
+ ace:	75 c0                	jne    a90 <malloc+0x40>
+        return 0;
+  }
+}
+ ad0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ ad3:	31 c0                	xor    %eax,%eax
+}
+ ad5:	5b                   	pop    %ebx
+ ad6:	5e                   	pop    %esi
+ ad7:	5f                   	pop    %edi
+ ad8:	5d                   	pop    %ebp
+ ad9:	c3                   	ret
+ ada:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ ae0:	39 cf                	cmp    %ecx,%edi
+ ae2:	74 4c                	je     b30 <malloc+0xe0>
+        p->s.size -= nunits;
+ ae4:	29 f9                	sub    %edi,%ecx
+ ae6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ ae9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ aec:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ aef:	89 15 c0 0e 00 00    	mov    %edx,0xec0
+}
+ af5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ af8:	83 c0 08             	add    $0x8,%eax
+}
+ afb:	5b                   	pop    %ebx
+ afc:	5e                   	pop    %esi
+ afd:	5f                   	pop    %edi
+ afe:	5d                   	pop    %ebp
+ aff:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ b00:	c7 05 c0 0e 00 00 c4 	movl   $0xec4,0xec0
+ b07:	0e 00 00 
+    base.s.size = 0;
+ b0a:	b8 c4 0e 00 00       	mov    $0xec4,%eax
+    base.s.ptr = freep = prevp = &base;
+ b0f:	c7 05 c4 0e 00 00 c4 	movl   $0xec4,0xec4
+ b16:	0e 00 00 
+    base.s.size = 0;
+ b19:	c7 05 c8 0e 00 00 00 	movl   $0x0,0xec8
+ b20:	00 00 00 
+    if(p->s.size >= nunits){
+ b23:	e9 54 ff ff ff       	jmp    a7c <malloc+0x2c>
+ b28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b2f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ b30:	8b 08                	mov    (%eax),%ecx
+ b32:	89 0a                	mov    %ecx,(%edx)
+ b34:	eb b9                	jmp    aef <malloc+0x9f>
@@ -0,0 +1,3525 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return 0;
+}
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	56                   	push   %esi
+       e:	53                   	push   %ebx
+       f:	51                   	push   %ecx
+      10:	83 ec 0c             	sub    $0xc,%esp
+  static int stdfd[3] = { 0, 1, 2 };
+  struct cmd *cmd;
+  int fd, n;
+
+  // Ensure that three file descriptors are open.
+  while((fd = open("console", O_RDWR)) >= 0){
+      13:	eb 0c                	jmp    21 <main+0x21>
+      15:	8d 76 00             	lea    0x0(%esi),%esi
+    if(fd >= 3){
+      18:	83 f8 02             	cmp    $0x2,%eax
+      1b:	0f 8f 54 01 00 00    	jg     175 <main+0x175>
+  while((fd = open("console", O_RDWR)) >= 0){
+      21:	83 ec 08             	sub    $0x8,%esp
+      24:	6a 02                	push   $0x2
+      26:	68 32 1b 00 00       	push   $0x1b32
+      2b:	e8 81 13 00 00       	call   13b1 <open>
+      30:	83 c4 10             	add    $0x10,%esp
+      33:	85 c0                	test   %eax,%eax
+      35:	79 e1                	jns    18 <main+0x18>
+      37:	eb 2e                	jmp    67 <main+0x67>
+      39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+int
+fork1(void)
+{
+  int pid;
+
+  pid = fork();
+      40:	e8 67 12 00 00       	call   12ac <fork>
+  if(pid == -1)
+      45:	83 f8 ff             	cmp    $0xffffffff,%eax
+      48:	0f 84 41 01 00 00    	je     18f <main+0x18f>
+      if(fork1() == 0)
+      4e:	85 c0                	test   %eax,%eax
+      50:	0f 84 30 01 00 00    	je     186 <main+0x186>
+      wait();
+      56:	e8 8b 12 00 00       	call   12e6 <wait>
+    freecmd(cmd);
+      5b:	83 ec 0c             	sub    $0xc,%esp
+      5e:	56                   	push   %esi
+      5f:	e8 bc 01 00 00       	call   220 <freecmd>
+      64:	83 c4 10             	add    $0x10,%esp
+  printf(2, "$ ");
+      67:	83 ec 08             	sub    $0x8,%esp
+      6a:	68 88 1a 00 00       	push   $0x1a88
+      6f:	6a 02                	push   $0x2
+      71:	e8 ea 16 00 00       	call   1760 <printf>
+  memset(buf, 0, nbuf);
+      76:	83 c4 0c             	add    $0xc,%esp
+      79:	6a 64                	push   $0x64
+      7b:	6a 00                	push   $0x0
+      7d:	68 00 23 00 00       	push   $0x2300
+      82:	e8 09 10 00 00       	call   1090 <memset>
+  gets(buf, nbuf);
+      87:	58                   	pop    %eax
+      88:	5a                   	pop    %edx
+      89:	6a 64                	push   $0x64
+      8b:	68 00 23 00 00       	push   $0x2300
+      90:	e8 5b 10 00 00       	call   10f0 <gets>
+  if(buf[0] == 0) // EOF
+      95:	0f b6 05 00 23 00 00 	movzbl 0x2300,%eax
+      9c:	83 c4 10             	add    $0x10,%esp
+      9f:	84 c0                	test   %al,%al
+      a1:	0f 84 c9 00 00 00    	je     170 <main+0x170>
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+      a7:	3c 63                	cmp    $0x63,%al
+      a9:	75 09                	jne    b4 <main+0xb4>
+      ab:	80 3d 01 23 00 00 64 	cmpb   $0x64,0x2301
+      b2:	74 6c                	je     120 <main+0x120>
+    badsyntax = 0;
+      b4:	c7 05 e0 22 00 00 00 	movl   $0x0,0x22e0
+      bb:	00 00 00 
+    cmd = parsecmd(buf);
+      be:	83 ec 0c             	sub    $0xc,%esp
+      c1:	68 00 23 00 00       	push   $0x2300
+      c6:	e8 55 0e 00 00       	call   f20 <parsecmd>
+    if(badsyntax){
+      cb:	8b 0d e0 22 00 00    	mov    0x22e0,%ecx
+      d1:	83 c4 10             	add    $0x10,%esp
+    cmd = parsecmd(buf);
+      d4:	89 c6                	mov    %eax,%esi
+    if(badsyntax){
+      d6:	85 c9                	test   %ecx,%ecx
+      d8:	75 81                	jne    5b <main+0x5b>
+    if(canspawn(cmd)){
+      da:	83 ec 0c             	sub    $0xc,%esp
+      dd:	50                   	push   %eax
+      de:	e8 bd 00 00 00       	call   1a0 <canspawn>
+      e3:	83 c4 10             	add    $0x10,%esp
+      e6:	85 c0                	test   %eax,%eax
+      e8:	0f 84 52 ff ff ff    	je     40 <main+0x40>
+      for(n = spawncmd(cmd, stdfd); n > 0; n--)
+      ee:	83 ec 08             	sub    $0x8,%esp
+      f1:	68 b8 22 00 00       	push   $0x22b8
+      f6:	56                   	push   %esi
+      f7:	e8 04 02 00 00       	call   300 <spawncmd>
+      fc:	83 c4 10             	add    $0x10,%esp
+      ff:	89 c3                	mov    %eax,%ebx
+     101:	85 c0                	test   %eax,%eax
+     103:	0f 8e 52 ff ff ff    	jle    5b <main+0x5b>
+     109:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        wait();
+     110:	e8 d1 11 00 00       	call   12e6 <wait>
+      for(n = spawncmd(cmd, stdfd); n > 0; n--)
+     115:	83 eb 01             	sub    $0x1,%ebx
+     118:	75 f6                	jne    110 <main+0x110>
+     11a:	e9 3c ff ff ff       	jmp    5b <main+0x5b>
+     11f:	90                   	nop
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+     120:	80 3d 02 23 00 00 20 	cmpb   $0x20,0x2302
+     127:	75 8b                	jne    b4 <main+0xb4>
+      buf[strlen(buf)-1] = 0;  // chop \n
+     129:	83 ec 0c             	sub    $0xc,%esp
+     12c:	68 00 23 00 00       	push   $0x2300
+     131:	e8 2a 0f 00 00       	call   1060 <strlen>
+      if(chdir(buf+3) < 0)
+     136:	c7 04 24 03 23 00 00 	movl   $0x2303,(%esp)
+      buf[strlen(buf)-1] = 0;  // chop \n
+     13d:	c6 80 ff 22 00 00 00 	movb   $0x0,0x22ff(%eax)
+      if(chdir(buf+3) < 0)
+     144:	e8 16 13 00 00       	call   145f <chdir>
+     149:	83 c4 10             	add    $0x10,%esp
+     14c:	85 c0                	test   %eax,%eax
+     14e:	0f 89 13 ff ff ff    	jns    67 <main+0x67>
+        printf(2, "cannot cd %s\n", buf+3);
+     154:	53                   	push   %ebx
+     155:	68 03 23 00 00       	push   $0x2303
+     15a:	68 3a 1b 00 00       	push   $0x1b3a
+     15f:	6a 02                	push   $0x2
+     161:	e8 fa 15 00 00       	call   1760 <printf>
+     166:	83 c4 10             	add    $0x10,%esp
+     169:	e9 f9 fe ff ff       	jmp    67 <main+0x67>
+     16e:	66 90                	xchg   %ax,%ax
+  exit();
+     170:	e8 54 11 00 00       	call   12c9 <exit>
+      close(fd);
+     175:	83 ec 0c             	sub    $0xc,%esp
+     178:	50                   	push   %eax
+     179:	e8 dc 11 00 00       	call   135a <close>
+      break;
+     17e:	83 c4 10             	add    $0x10,%esp
+     181:	e9 e1 fe ff ff       	jmp    67 <main+0x67>
+        runcmd(cmd);
+     186:	83 ec 0c             	sub    $0xc,%esp
+     189:	56                   	push   %esi
+     18a:	e8 51 03 00 00       	call   4e0 <runcmd>
+    panic("fork");
+     18f:	83 ec 0c             	sub    $0xc,%esp
+     192:	68 b9 1a 00 00       	push   $0x1ab9
+     197:	e8 44 01 00 00       	call   2e0 <panic>
+     19c:	66 90                	xchg   %ax,%ax
+     19e:	66 90                	xchg   %ax,%ax
+
+000001a0 <canspawn>:
+{
+     1a0:	55                   	push   %ebp
+     1a1:	89 e5                	mov    %esp,%ebp
+     1a3:	53                   	push   %ebx
+     1a4:	83 ec 04             	sub    $0x4,%esp
+     1a7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  switch(cmd->type){
+     1aa:	8b 13                	mov    (%ebx),%edx
+     1ac:	83 fa 02             	cmp    $0x2,%edx
+     1af:	74 17                	je     1c8 <canspawn+0x28>
+     1b1:	83 fa 03             	cmp    $0x3,%edx
+     1b4:	74 3a                	je     1f0 <canspawn+0x50>
+     1b6:	31 c0                	xor    %eax,%eax
+     1b8:	83 fa 01             	cmp    $0x1,%edx
+     1bb:	74 23                	je     1e0 <canspawn+0x40>
+}
+     1bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1c0:	c9                   	leave
+     1c1:	c3                   	ret
+     1c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return rcmd->fd <= 2 && canspawn(rcmd->cmd);
+     1c8:	31 c0                	xor    %eax,%eax
+     1ca:	83 7b 14 02          	cmpl   $0x2,0x14(%ebx)
+     1ce:	7f ed                	jg     1bd <canspawn+0x1d>
+     1d0:	83 ec 0c             	sub    $0xc,%esp
+     1d3:	ff 73 04             	push   0x4(%ebx)
+     1d6:	eb 30                	jmp    208 <canspawn+0x68>
+     1d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1df:	90                   	nop
+    return ((struct execcmd*)cmd)->argv[0] != 0;
+     1e0:	8b 53 04             	mov    0x4(%ebx),%edx
+     1e3:	31 c0                	xor    %eax,%eax
+}
+     1e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1e8:	c9                   	leave
+    return ((struct execcmd*)cmd)->argv[0] != 0;
+     1e9:	85 d2                	test   %edx,%edx
+     1eb:	0f 95 c0             	setne  %al
+}
+     1ee:	c3                   	ret
+     1ef:	90                   	nop
+    return canspawn(pcmd->left) && canspawn(pcmd->right);
+     1f0:	83 ec 0c             	sub    $0xc,%esp
+     1f3:	ff 73 04             	push   0x4(%ebx)
+     1f6:	e8 a5 ff ff ff       	call   1a0 <canspawn>
+     1fb:	83 c4 10             	add    $0x10,%esp
+     1fe:	85 c0                	test   %eax,%eax
+     200:	74 bb                	je     1bd <canspawn+0x1d>
+     202:	83 ec 0c             	sub    $0xc,%esp
+     205:	ff 73 08             	push   0x8(%ebx)
+     208:	e8 93 ff ff ff       	call   1a0 <canspawn>
+     20d:	83 c4 10             	add    $0x10,%esp
+}
+     210:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     213:	c9                   	leave
+    return canspawn(pcmd->left) && canspawn(pcmd->right);
+     214:	85 c0                	test   %eax,%eax
+     216:	0f 95 c0             	setne  %al
+     219:	0f b6 c0             	movzbl %al,%eax
+}
+     21c:	c3                   	ret
+     21d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000220 <freecmd>:
+{
+     220:	55                   	push   %ebp
+     221:	89 e5                	mov    %esp,%ebp
+     223:	53                   	push   %ebx
+     224:	83 ec 04             	sub    $0x4,%esp
+     227:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+     22a:	85 db                	test   %ebx,%ebx
+     22c:	74 62                	je     290 <freecmd+0x70>
+  switch(cmd->type){
+     22e:	8b 03                	mov    (%ebx),%eax
+     230:	83 f8 04             	cmp    $0x4,%eax
+     233:	74 0c                	je     241 <freecmd+0x21>
+     235:	7f 31                	jg     268 <freecmd+0x48>
+     237:	83 f8 02             	cmp    $0x2,%eax
+     23a:	74 31                	je     26d <freecmd+0x4d>
+     23c:	83 f8 03             	cmp    $0x3,%eax
+     23f:	75 17                	jne    258 <freecmd+0x38>
+    freecmd(((struct listcmd*)cmd)->left);
+     241:	83 ec 0c             	sub    $0xc,%esp
+     244:	ff 73 04             	push   0x4(%ebx)
+     247:	e8 d4 ff ff ff       	call   220 <freecmd>
+    freecmd(((struct listcmd*)cmd)->right);
+     24c:	58                   	pop    %eax
+     24d:	ff 73 08             	push   0x8(%ebx)
+     250:	e8 cb ff ff ff       	call   220 <freecmd>
+    break;
+     255:	83 c4 10             	add    $0x10,%esp
+  free(cmd);
+     258:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     25b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     25e:	c9                   	leave
+  free(cmd);
+     25f:	e9 ac 16 00 00       	jmp    1910 <free>
+     264:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  switch(cmd->type){
+     268:	83 f8 05             	cmp    $0x5,%eax
+     26b:	75 eb                	jne    258 <freecmd+0x38>
+    freecmd(((struct backcmd*)cmd)->cmd);
+     26d:	83 ec 0c             	sub    $0xc,%esp
+     270:	ff 73 04             	push   0x4(%ebx)
+     273:	e8 a8 ff ff ff       	call   220 <freecmd>
+  free(cmd);
+     278:	89 5d 08             	mov    %ebx,0x8(%ebp)
+    break;
+     27b:	83 c4 10             	add    $0x10,%esp
+}
+     27e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     281:	c9                   	leave
+  free(cmd);
+     282:	e9 89 16 00 00       	jmp    1910 <free>
+     287:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     28e:	66 90                	xchg   %ax,%ax
+}
+     290:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     293:	c9                   	leave
+     294:	c3                   	ret
+     295:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     29c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <getcmd>:
+{
+     2a0:	55                   	push   %ebp
+     2a1:	89 e5                	mov    %esp,%ebp
+     2a3:	56                   	push   %esi
+     2a4:	53                   	push   %ebx
+     2a5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     2a8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(2, "$ ");
+     2ab:	83 ec 08             	sub    $0x8,%esp
+     2ae:	68 88 1a 00 00       	push   $0x1a88
+     2b3:	6a 02                	push   $0x2
+     2b5:	e8 a6 14 00 00       	call   1760 <printf>
+  memset(buf, 0, nbuf);
+     2ba:	83 c4 0c             	add    $0xc,%esp
+     2bd:	56                   	push   %esi
+     2be:	6a 00                	push   $0x0
+     2c0:	53                   	push   %ebx
+     2c1:	e8 ca 0d 00 00       	call   1090 <memset>
+  gets(buf, nbuf);
+     2c6:	58                   	pop    %eax
+     2c7:	5a                   	pop    %edx
+     2c8:	56                   	push   %esi
+     2c9:	53                   	push   %ebx
+     2ca:	e8 21 0e 00 00       	call   10f0 <gets>
+  if(buf[0] == 0) // EOF
+     2cf:	83 c4 10             	add    $0x10,%esp
+     2d2:	80 3b 01             	cmpb   $0x1,(%ebx)
+     2d5:	19 c0                	sbb    %eax,%eax
+}
+     2d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     2da:	5b                   	pop    %ebx
+     2db:	5e                   	pop    %esi
+     2dc:	5d                   	pop    %ebp
+     2dd:	c3                   	ret
+     2de:	66 90                	xchg   %ax,%ax
+
+000002e0 <panic>:
+{
+     2e0:	55                   	push   %ebp
+     2e1:	89 e5                	mov    %esp,%ebp
+     2e3:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "%s\n", s);
+     2e6:	ff 75 08             	push   0x8(%ebp)
+     2e9:	68 2e 1b 00 00       	push   $0x1b2e
+     2ee:	6a 02                	push   $0x2
+     2f0:	e8 6b 14 00 00       	call   1760 <printf>
+  exit();
+     2f5:	e8 cf 0f 00 00       	call   12c9 <exit>
+     2fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000300 <spawncmd>:
+{
+     300:	55                   	push   %ebp
+     301:	89 e5                	mov    %esp,%ebp
+     303:	57                   	push   %edi
+     304:	56                   	push   %esi
+     305:	53                   	push   %ebx
+     306:	83 ec 3c             	sub    $0x3c,%esp
+     309:	8b 75 08             	mov    0x8(%ebp),%esi
+     30c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  switch(cmd->type){
+     30f:	8b 1e                	mov    (%esi),%ebx
+     311:	83 fb 02             	cmp    $0x2,%ebx
+     314:	74 22                	je     338 <spawncmd+0x38>
+     316:	83 fb 03             	cmp    $0x3,%ebx
+     319:	0f 84 b1 00 00 00    	je     3d0 <spawncmd+0xd0>
+     31f:	83 fb 01             	cmp    $0x1,%ebx
+     322:	74 74                	je     398 <spawncmd+0x98>
+  panic("spawncmd");
+     324:	83 ec 0c             	sub    $0xc,%esp
+     327:	68 b0 1a 00 00       	push   $0x1ab0
+     32c:	e8 af ff ff ff       	call   2e0 <panic>
+     331:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if((f = open(rcmd->file, rcmd->mode)) < 0){
+     338:	83 ec 08             	sub    $0x8,%esp
+     33b:	ff 76 10             	push   0x10(%esi)
+     33e:	ff 76 08             	push   0x8(%esi)
+     341:	e8 6b 10 00 00       	call   13b1 <open>
+     346:	83 c4 10             	add    $0x10,%esp
+     349:	85 c0                	test   %eax,%eax
+     34b:	0f 88 f7 00 00 00    	js     448 <spawncmd+0x148>
+    memmove(map, fd, sizeof(map));
+     351:	83 ec 04             	sub    $0x4,%esp
+     354:	8d 5d dc             	lea    -0x24(%ebp),%ebx
+     357:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     35a:	6a 0c                	push   $0xc
+     35c:	57                   	push   %edi
+     35d:	53                   	push   %ebx
+     35e:	e8 7d 0e 00 00       	call   11e0 <memmove>
+    map[rcmd->fd] = f;
+     363:	8b 46 14             	mov    0x14(%esi),%eax
+     366:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     369:	89 54 85 dc          	mov    %edx,-0x24(%ebp,%eax,4)
+    n = spawncmd(rcmd->cmd, map);
+     36d:	5f                   	pop    %edi
+     36e:	58                   	pop    %eax
+     36f:	53                   	push   %ebx
+     370:	ff 76 04             	push   0x4(%esi)
+     373:	e8 88 ff ff ff       	call   300 <spawncmd>
+    close(f);
+     378:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+    n = spawncmd(rcmd->cmd, map);
+     37b:	89 c3                	mov    %eax,%ebx
+    close(f);
+     37d:	89 14 24             	mov    %edx,(%esp)
+     380:	e8 d5 0f 00 00       	call   135a <close>
+    return n;
+     385:	83 c4 10             	add    $0x10,%esp
+}
+     388:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     38b:	89 d8                	mov    %ebx,%eax
+     38d:	5b                   	pop    %ebx
+     38e:	5e                   	pop    %esi
+     38f:	5f                   	pop    %edi
+     390:	5d                   	pop    %ebp
+     391:	c3                   	ret
+     392:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(spawn(ecmd->argv[0], ecmd->argv, fd, 3) < 0){
+     398:	8d 46 04             	lea    0x4(%esi),%eax
+     39b:	6a 03                	push   $0x3
+     39d:	57                   	push   %edi
+     39e:	50                   	push   %eax
+     39f:	ff 76 04             	push   0x4(%esi)
+     3a2:	e8 6b 12 00 00       	call   1612 <spawn>
+     3a7:	83 c4 10             	add    $0x10,%esp
+     3aa:	85 c0                	test   %eax,%eax
+     3ac:	79 da                	jns    388 <spawncmd+0x88>
+      printf(2, "exec %s failed\n", ecmd->argv[0]);
+     3ae:	83 ec 04             	sub    $0x4,%esp
+     3b1:	ff 76 04             	push   0x4(%esi)
+      return 0;
+     3b4:	31 db                	xor    %ebx,%ebx
+      printf(2, "exec %s failed\n", ecmd->argv[0]);
+     3b6:	68 8b 1a 00 00       	push   $0x1a8b
+     3bb:	6a 02                	push   $0x2
+     3bd:	e8 9e 13 00 00       	call   1760 <printf>
+      return 0;
+     3c2:	83 c4 10             	add    $0x10,%esp
+     3c5:	eb c1                	jmp    388 <spawncmd+0x88>
+     3c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ce:	66 90                	xchg   %ax,%ax
+    if(pipe(p) < 0)
+     3d0:	83 ec 0c             	sub    $0xc,%esp
+     3d3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     3d6:	50                   	push   %eax
+     3d7:	e8 27 0f 00 00       	call   1303 <pipe>
+     3dc:	83 c4 10             	add    $0x10,%esp
+     3df:	85 c0                	test   %eax,%eax
+     3e1:	0f 88 7d 00 00 00    	js     464 <spawncmd+0x164>
+    map[0] = fd[0];
+     3e7:	8b 07                	mov    (%edi),%eax
+    n = spawncmd(pcmd->left, map);
+     3e9:	83 ec 08             	sub    $0x8,%esp
+     3ec:	8d 5d dc             	lea    -0x24(%ebp),%ebx
+    map[0] = fd[0];
+     3ef:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    map[1] = p[1];
+     3f2:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     3f5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    map[2] = fd[2];
+     3f8:	8b 47 08             	mov    0x8(%edi),%eax
+     3fb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    n = spawncmd(pcmd->left, map);
+     3fe:	53                   	push   %ebx
+     3ff:	ff 76 04             	push   0x4(%esi)
+     402:	e8 f9 fe ff ff       	call   300 <spawncmd>
+     407:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    map[0] = p[0];
+     40a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     40d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    map[1] = fd[1];
+     410:	8b 47 04             	mov    0x4(%edi),%eax
+     413:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    n += spawncmd(pcmd->right, map);
+     416:	58                   	pop    %eax
+     417:	5a                   	pop    %edx
+     418:	53                   	push   %ebx
+     419:	ff 76 08             	push   0x8(%esi)
+     41c:	e8 df fe ff ff       	call   300 <spawncmd>
+    close(p[0]);
+     421:	59                   	pop    %ecx
+    n += spawncmd(pcmd->right, map);
+     422:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+    close(p[0]);
+     425:	ff 75 d4             	push   -0x2c(%ebp)
+    n += spawncmd(pcmd->right, map);
+     428:	01 c3                	add    %eax,%ebx
+    close(p[0]);
+     42a:	e8 2b 0f 00 00       	call   135a <close>
+    close(p[1]);
+     42f:	5e                   	pop    %esi
+     430:	ff 75 d8             	push   -0x28(%ebp)
+     433:	e8 22 0f 00 00       	call   135a <close>
+    return n;
+     438:	83 c4 10             	add    $0x10,%esp
+}
+     43b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     43e:	89 d8                	mov    %ebx,%eax
+     440:	5b                   	pop    %ebx
+     441:	5e                   	pop    %esi
+     442:	5f                   	pop    %edi
+     443:	5d                   	pop    %ebp
+     444:	c3                   	ret
+     445:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(2, "open %s failed\n", rcmd->file);
+     448:	83 ec 04             	sub    $0x4,%esp
+     44b:	ff 76 08             	push   0x8(%esi)
+      return 0;
+     44e:	31 db                	xor    %ebx,%ebx
+      printf(2, "open %s failed\n", rcmd->file);
+     450:	68 9b 1a 00 00       	push   $0x1a9b
+     455:	6a 02                	push   $0x2
+     457:	e8 04 13 00 00       	call   1760 <printf>
+      return 0;
+     45c:	83 c4 10             	add    $0x10,%esp
+     45f:	e9 24 ff ff ff       	jmp    388 <spawncmd+0x88>
+      panic("pipe");
+     464:	83 ec 0c             	sub    $0xc,%esp
+     467:	68 ab 1a 00 00       	push   $0x1aab
+     46c:	e8 6f fe ff ff       	call   2e0 <panic>
+     471:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     478:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     47f:	90                   	nop
+
+00000480 <syntax>:
+  if(!badsyntax)
+     480:	a1 e0 22 00 00       	mov    0x22e0,%eax
+     485:	85 c0                	test   %eax,%eax
+     487:	74 0f                	je     498 <syntax+0x18>
+  badsyntax = 1;
+     489:	c7 05 e0 22 00 00 01 	movl   $0x1,0x22e0
+     490:	00 00 00 
+     493:	c3                   	ret
+     494:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+{
+     498:	55                   	push   %ebp
+     499:	89 e5                	mov    %esp,%ebp
+     49b:	83 ec 0c             	sub    $0xc,%esp
+    printf(2, "%s\n", s);
+     49e:	ff 75 08             	push   0x8(%ebp)
+     4a1:	68 2e 1b 00 00       	push   $0x1b2e
+     4a6:	6a 02                	push   $0x2
+     4a8:	e8 b3 12 00 00       	call   1760 <printf>
+     4ad:	83 c4 10             	add    $0x10,%esp
+  badsyntax = 1;
+     4b0:	c7 05 e0 22 00 00 01 	movl   $0x1,0x22e0
+     4b7:	00 00 00 
+}
+     4ba:	c9                   	leave
+     4bb:	c3                   	ret
+     4bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <fork1>:
+{
+     4c0:	55                   	push   %ebp
+     4c1:	89 e5                	mov    %esp,%ebp
+     4c3:	83 ec 08             	sub    $0x8,%esp
+  pid = fork();
+     4c6:	e8 e1 0d 00 00       	call   12ac <fork>
+  if(pid == -1)
+     4cb:	83 f8 ff             	cmp    $0xffffffff,%eax
+     4ce:	74 02                	je     4d2 <fork1+0x12>
+  return pid;
+}
+     4d0:	c9                   	leave
+     4d1:	c3                   	ret
+    panic("fork");
+     4d2:	83 ec 0c             	sub    $0xc,%esp
+     4d5:	68 b9 1a 00 00       	push   $0x1ab9
+     4da:	e8 01 fe ff ff       	call   2e0 <panic>
+     4df:	90                   	nop
+
+000004e0 <runcmd>:
+{
+     4e0:	55                   	push   %ebp
+     4e1:	89 e5                	mov    %esp,%ebp
+     4e3:	53                   	push   %ebx
+     4e4:	83 ec 14             	sub    $0x14,%esp
+     4e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+     4ea:	85 db                	test   %ebx,%ebx
+     4ec:	74 42                	je     530 <runcmd+0x50>
+  switch(cmd->type){
+     4ee:	83 3b 05             	cmpl   $0x5,(%ebx)
+     4f1:	0f 87 e3 00 00 00    	ja     5da <runcmd+0xfa>
+     4f7:	8b 03                	mov    (%ebx),%eax
+     4f9:	ff 24 85 48 1b 00 00 	jmp    *0x1b48(,%eax,4)
+    if(ecmd->argv[0] == 0)
+     500:	8b 43 04             	mov    0x4(%ebx),%eax
+     503:	85 c0                	test   %eax,%eax
+     505:	74 29                	je     530 <runcmd+0x50>
+    exec(ecmd->argv[0], ecmd->argv);
+     507:	8d 53 04             	lea    0x4(%ebx),%edx
+     50a:	51                   	push   %ecx
+     50b:	51                   	push   %ecx
+     50c:	52                   	push   %edx
+     50d:	50                   	push   %eax
+     50e:	e8 81 0e 00 00       	call   1394 <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+     513:	83 c4 0c             	add    $0xc,%esp
+     516:	ff 73 04             	push   0x4(%ebx)
+     519:	68 8b 1a 00 00       	push   $0x1a8b
+     51e:	6a 02                	push   $0x2
+     520:	e8 3b 12 00 00       	call   1760 <printf>
+    break;
+     525:	83 c4 10             	add    $0x10,%esp
+     528:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     52f:	90                   	nop
+    exit();
+     530:	e8 94 0d 00 00       	call   12c9 <exit>
+    if(fork1() == 0)
+     535:	e8 86 ff ff ff       	call   4c0 <fork1>
+     53a:	85 c0                	test   %eax,%eax
+     53c:	75 f2                	jne    530 <runcmd+0x50>
+     53e:	e9 8c 00 00 00       	jmp    5cf <runcmd+0xef>
+    if(pipe(p) < 0)
+     543:	83 ec 0c             	sub    $0xc,%esp
+     546:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     549:	50                   	push   %eax
+     54a:	e8 b4 0d 00 00       	call   1303 <pipe>
+     54f:	83 c4 10             	add    $0x10,%esp
+     552:	85 c0                	test   %eax,%eax
+     554:	0f 88 a2 00 00 00    	js     5fc <runcmd+0x11c>
+    if(fork1() == 0){
+     55a:	e8 61 ff ff ff       	call   4c0 <fork1>
+     55f:	85 c0                	test   %eax,%eax
+     561:	0f 84 a2 00 00 00    	je     609 <runcmd+0x129>
+    if(fork1() == 0){
+     567:	e8 54 ff ff ff       	call   4c0 <fork1>
+     56c:	85 c0                	test   %eax,%eax
+     56e:	0f 84 c3 00 00 00    	je     637 <runcmd+0x157>
+    close(p[0]);
+     574:	83 ec 0c             	sub    $0xc,%esp
+     577:	ff 75 f0             	push   -0x10(%ebp)
+     57a:	e8 db 0d 00 00       	call   135a <close>
+    close(p[1]);
+     57f:	58                   	pop    %eax
+     580:	ff 75 f4             	push   -0xc(%ebp)
+     583:	e8 d2 0d 00 00       	call   135a <close>
+    wait();
+     588:	e8 59 0d 00 00       	call   12e6 <wait>
+    wait();
+     58d:	e8 54 0d 00 00       	call   12e6 <wait>
+    break;
+     592:	83 c4 10             	add    $0x10,%esp
+     595:	eb 99                	jmp    530 <runcmd+0x50>
+    if(fork1() == 0)
+     597:	e8 24 ff ff ff       	call   4c0 <fork1>
+     59c:	85 c0                	test   %eax,%eax
+     59e:	74 2f                	je     5cf <runcmd+0xef>
+    wait();
+     5a0:	e8 41 0d 00 00       	call   12e6 <wait>
+    runcmd(lcmd->right);
+     5a5:	83 ec 0c             	sub    $0xc,%esp
+     5a8:	ff 73 08             	push   0x8(%ebx)
+     5ab:	e8 30 ff ff ff       	call   4e0 <runcmd>
+    close(rcmd->fd);
+     5b0:	83 ec 0c             	sub    $0xc,%esp
+     5b3:	ff 73 14             	push   0x14(%ebx)
+     5b6:	e8 9f 0d 00 00       	call   135a <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+     5bb:	58                   	pop    %eax
+     5bc:	5a                   	pop    %edx
+     5bd:	ff 73 10             	push   0x10(%ebx)
+     5c0:	ff 73 08             	push   0x8(%ebx)
+     5c3:	e8 e9 0d 00 00       	call   13b1 <open>
+     5c8:	83 c4 10             	add    $0x10,%esp
+     5cb:	85 c0                	test   %eax,%eax
+     5cd:	78 18                	js     5e7 <runcmd+0x107>
+      runcmd(bcmd->cmd);
+     5cf:	83 ec 0c             	sub    $0xc,%esp
+     5d2:	ff 73 04             	push   0x4(%ebx)
+     5d5:	e8 06 ff ff ff       	call   4e0 <runcmd>
+    panic("runcmd");
+     5da:	83 ec 0c             	sub    $0xc,%esp
+     5dd:	68 be 1a 00 00       	push   $0x1abe
+     5e2:	e8 f9 fc ff ff       	call   2e0 <panic>
+      printf(2, "open %s failed\n", rcmd->file);
+     5e7:	51                   	push   %ecx
+     5e8:	ff 73 08             	push   0x8(%ebx)
+     5eb:	68 9b 1a 00 00       	push   $0x1a9b
+     5f0:	6a 02                	push   $0x2
+     5f2:	e8 69 11 00 00       	call   1760 <printf>
+      exit();
+     5f7:	e8 cd 0c 00 00       	call   12c9 <exit>
+      panic("pipe");
+     5fc:	83 ec 0c             	sub    $0xc,%esp
+     5ff:	68 ab 1a 00 00       	push   $0x1aab
+     604:	e8 d7 fc ff ff       	call   2e0 <panic>
+      close(1);
+     609:	83 ec 0c             	sub    $0xc,%esp
+     60c:	6a 01                	push   $0x1
+     60e:	e8 47 0d 00 00       	call   135a <close>
+      dup(p[1]);
+     613:	58                   	pop    %eax
+     614:	ff 75 f4             	push   -0xc(%ebp)
+     617:	e8 60 0e 00 00       	call   147c <dup>
+      close(p[0]);
+     61c:	58                   	pop    %eax
+     61d:	ff 75 f0             	push   -0x10(%ebp)
+     620:	e8 35 0d 00 00       	call   135a <close>
+      close(p[1]);
+     625:	58                   	pop    %eax
+     626:	ff 75 f4             	push   -0xc(%ebp)
+     629:	e8 2c 0d 00 00       	call   135a <close>
+      runcmd(pcmd->left);
+     62e:	5a                   	pop    %edx
+     62f:	ff 73 04             	push   0x4(%ebx)
+     632:	e8 a9 fe ff ff       	call   4e0 <runcmd>
+      close(0);
+     637:	83 ec 0c             	sub    $0xc,%esp
+     63a:	6a 00                	push   $0x0
+     63c:	e8 19 0d 00 00       	call   135a <close>
+      dup(p[0]);
+     641:	5a                   	pop    %edx
+     642:	ff 75 f0             	push   -0x10(%ebp)
+     645:	e8 32 0e 00 00       	call   147c <dup>
+      close(p[0]);
+     64a:	59                   	pop    %ecx
+     64b:	ff 75 f0             	push   -0x10(%ebp)
+     64e:	e8 07 0d 00 00       	call   135a <close>
+      close(p[1]);
+     653:	58                   	pop    %eax
+     654:	ff 75 f4             	push   -0xc(%ebp)
+     657:	e8 fe 0c 00 00       	call   135a <close>
+      runcmd(pcmd->right);
+     65c:	58                   	pop    %eax
+     65d:	ff 73 08             	push   0x8(%ebx)
+     660:	e8 7b fe ff ff       	call   4e0 <runcmd>
+     665:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     66c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000670 <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+     670:	55                   	push   %ebp
+     671:	89 e5                	mov    %esp,%ebp
+     673:	53                   	push   %ebx
+     674:	83 ec 10             	sub    $0x10,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     677:	6a 54                	push   $0x54
+     679:	e8 22 13 00 00       	call   19a0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     67e:	83 c4 0c             	add    $0xc,%esp
+     681:	6a 54                	push   $0x54
+  cmd = malloc(sizeof(*cmd));
+     683:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     685:	6a 00                	push   $0x0
+     687:	50                   	push   %eax
+     688:	e8 03 0a 00 00       	call   1090 <memset>
+  cmd->type = EXEC;
+     68d:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  return (struct cmd*)cmd;
+}
+     693:	89 d8                	mov    %ebx,%eax
+     695:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     698:	c9                   	leave
+     699:	c3                   	ret
+     69a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000006a0 <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     6a0:	55                   	push   %ebp
+     6a1:	89 e5                	mov    %esp,%ebp
+     6a3:	53                   	push   %ebx
+     6a4:	83 ec 10             	sub    $0x10,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     6a7:	6a 18                	push   $0x18
+     6a9:	e8 f2 12 00 00       	call   19a0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     6ae:	83 c4 0c             	add    $0xc,%esp
+     6b1:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     6b3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     6b5:	6a 00                	push   $0x0
+     6b7:	50                   	push   %eax
+     6b8:	e8 d3 09 00 00       	call   1090 <memset>
+  cmd->type = REDIR;
+  cmd->cmd = subcmd;
+     6bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = REDIR;
+     6c0:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  cmd->cmd = subcmd;
+     6c6:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->file = file;
+     6c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     6cc:	89 43 08             	mov    %eax,0x8(%ebx)
+  cmd->efile = efile;
+     6cf:	8b 45 10             	mov    0x10(%ebp),%eax
+     6d2:	89 43 0c             	mov    %eax,0xc(%ebx)
+  cmd->mode = mode;
+     6d5:	8b 45 14             	mov    0x14(%ebp),%eax
+     6d8:	89 43 10             	mov    %eax,0x10(%ebx)
+  cmd->fd = fd;
+     6db:	8b 45 18             	mov    0x18(%ebp),%eax
+     6de:	89 43 14             	mov    %eax,0x14(%ebx)
+  return (struct cmd*)cmd;
+}
+     6e1:	89 d8                	mov    %ebx,%eax
+     6e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6e6:	c9                   	leave
+     6e7:	c3                   	ret
+     6e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ef:	90                   	nop
+
+000006f0 <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     6f0:	55                   	push   %ebp
+     6f1:	89 e5                	mov    %esp,%ebp
+     6f3:	53                   	push   %ebx
+     6f4:	83 ec 10             	sub    $0x10,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     6f7:	6a 0c                	push   $0xc
+     6f9:	e8 a2 12 00 00       	call   19a0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     6fe:	83 c4 0c             	add    $0xc,%esp
+     701:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     703:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     705:	6a 00                	push   $0x0
+     707:	50                   	push   %eax
+     708:	e8 83 09 00 00       	call   1090 <memset>
+  cmd->type = PIPE;
+  cmd->left = left;
+     70d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = PIPE;
+     710:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+  cmd->left = left;
+     716:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     719:	8b 45 0c             	mov    0xc(%ebp),%eax
+     71c:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     71f:	89 d8                	mov    %ebx,%eax
+     721:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     724:	c9                   	leave
+     725:	c3                   	ret
+     726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     72d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000730 <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+     730:	55                   	push   %ebp
+     731:	89 e5                	mov    %esp,%ebp
+     733:	53                   	push   %ebx
+     734:	83 ec 10             	sub    $0x10,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     737:	6a 0c                	push   $0xc
+     739:	e8 62 12 00 00       	call   19a0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     73e:	83 c4 0c             	add    $0xc,%esp
+     741:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     743:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     745:	6a 00                	push   $0x0
+     747:	50                   	push   %eax
+     748:	e8 43 09 00 00       	call   1090 <memset>
+  cmd->type = LIST;
+  cmd->left = left;
+     74d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = LIST;
+     750:	c7 03 04 00 00 00    	movl   $0x4,(%ebx)
+  cmd->left = left;
+     756:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     759:	8b 45 0c             	mov    0xc(%ebp),%eax
+     75c:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     75f:	89 d8                	mov    %ebx,%eax
+     761:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     764:	c9                   	leave
+     765:	c3                   	ret
+     766:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     76d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000770 <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+     770:	55                   	push   %ebp
+     771:	89 e5                	mov    %esp,%ebp
+     773:	53                   	push   %ebx
+     774:	83 ec 10             	sub    $0x10,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     777:	6a 08                	push   $0x8
+     779:	e8 22 12 00 00       	call   19a0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     77e:	83 c4 0c             	add    $0xc,%esp
+     781:	6a 08                	push   $0x8
+  cmd = malloc(sizeof(*cmd));
+     783:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     785:	6a 00                	push   $0x0
+     787:	50                   	push   %eax
+     788:	e8 03 09 00 00       	call   1090 <memset>
+  cmd->type = BACK;
+  cmd->cmd = subcmd;
+     78d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = BACK;
+     790:	c7 03 05 00 00 00    	movl   $0x5,(%ebx)
+  cmd->cmd = subcmd;
+     796:	89 43 04             	mov    %eax,0x4(%ebx)
+  return (struct cmd*)cmd;
+}
+     799:	89 d8                	mov    %ebx,%eax
+     79b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     79e:	c9                   	leave
+     79f:	c3                   	ret
+
+000007a0 <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+     7a0:	55                   	push   %ebp
+     7a1:	89 e5                	mov    %esp,%ebp
+     7a3:	57                   	push   %edi
+     7a4:	56                   	push   %esi
+     7a5:	53                   	push   %ebx
+     7a6:	83 ec 0c             	sub    $0xc,%esp
+  char *s;
+  int ret;
+
+  s = *ps;
+     7a9:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+     7ac:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     7af:	8b 75 10             	mov    0x10(%ebp),%esi
+  s = *ps;
+     7b2:	8b 38                	mov    (%eax),%edi
+  while(s < es && strchr(whitespace, *s))
+     7b4:	39 df                	cmp    %ebx,%edi
+     7b6:	72 0f                	jb     7c7 <gettoken+0x27>
+     7b8:	eb 25                	jmp    7df <gettoken+0x3f>
+     7ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    s++;
+     7c0:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     7c3:	39 fb                	cmp    %edi,%ebx
+     7c5:	74 18                	je     7df <gettoken+0x3f>
+     7c7:	0f be 07             	movsbl (%edi),%eax
+     7ca:	83 ec 08             	sub    $0x8,%esp
+     7cd:	50                   	push   %eax
+     7ce:	68 cc 22 00 00       	push   $0x22cc
+     7d3:	e8 d8 08 00 00       	call   10b0 <strchr>
+     7d8:	83 c4 10             	add    $0x10,%esp
+     7db:	85 c0                	test   %eax,%eax
+     7dd:	75 e1                	jne    7c0 <gettoken+0x20>
+  if(q)
+     7df:	85 f6                	test   %esi,%esi
+     7e1:	74 02                	je     7e5 <gettoken+0x45>
+    *q = s;
+     7e3:	89 3e                	mov    %edi,(%esi)
+  ret = *s;
+     7e5:	0f b6 07             	movzbl (%edi),%eax
+  switch(*s){
+     7e8:	3c 3c                	cmp    $0x3c,%al
+     7ea:	0f 8f d0 00 00 00    	jg     8c0 <gettoken+0x120>
+     7f0:	3c 3a                	cmp    $0x3a,%al
+     7f2:	0f 8f bc 00 00 00    	jg     8b4 <gettoken+0x114>
+     7f8:	84 c0                	test   %al,%al
+     7fa:	75 44                	jne    840 <gettoken+0xa0>
+     7fc:	31 f6                	xor    %esi,%esi
+    ret = 'a';
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+      s++;
+    break;
+  }
+  if(eq)
+     7fe:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     801:	85 c9                	test   %ecx,%ecx
+     803:	74 05                	je     80a <gettoken+0x6a>
+    *eq = s;
+     805:	8b 45 14             	mov    0x14(%ebp),%eax
+     808:	89 38                	mov    %edi,(%eax)
+
+  while(s < es && strchr(whitespace, *s))
+     80a:	39 df                	cmp    %ebx,%edi
+     80c:	72 09                	jb     817 <gettoken+0x77>
+     80e:	eb 1f                	jmp    82f <gettoken+0x8f>
+    s++;
+     810:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     813:	39 fb                	cmp    %edi,%ebx
+     815:	74 18                	je     82f <gettoken+0x8f>
+     817:	0f be 07             	movsbl (%edi),%eax
+     81a:	83 ec 08             	sub    $0x8,%esp
+     81d:	50                   	push   %eax
+     81e:	68 cc 22 00 00       	push   $0x22cc
+     823:	e8 88 08 00 00       	call   10b0 <strchr>
+     828:	83 c4 10             	add    $0x10,%esp
+     82b:	85 c0                	test   %eax,%eax
+     82d:	75 e1                	jne    810 <gettoken+0x70>
+  *ps = s;
+     82f:	8b 45 08             	mov    0x8(%ebp),%eax
+     832:	89 38                	mov    %edi,(%eax)
+  return ret;
+}
+     834:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     837:	89 f0                	mov    %esi,%eax
+     839:	5b                   	pop    %ebx
+     83a:	5e                   	pop    %esi
+     83b:	5f                   	pop    %edi
+     83c:	5d                   	pop    %ebp
+     83d:	c3                   	ret
+     83e:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     840:	79 66                	jns    8a8 <gettoken+0x108>
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     842:	39 df                	cmp    %ebx,%edi
+     844:	72 39                	jb     87f <gettoken+0xdf>
+  if(eq)
+     846:	8b 55 14             	mov    0x14(%ebp),%edx
+     849:	85 d2                	test   %edx,%edx
+     84b:	0f 84 b3 00 00 00    	je     904 <gettoken+0x164>
+    *eq = s;
+     851:	8b 45 14             	mov    0x14(%ebp),%eax
+     854:	89 38                	mov    %edi,(%eax)
+  while(s < es && strchr(whitespace, *s))
+     856:	e9 a9 00 00 00       	jmp    904 <gettoken+0x164>
+     85b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     85f:	90                   	nop
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     860:	0f be 07             	movsbl (%edi),%eax
+     863:	83 ec 08             	sub    $0x8,%esp
+     866:	50                   	push   %eax
+     867:	68 c4 22 00 00       	push   $0x22c4
+     86c:	e8 3f 08 00 00       	call   10b0 <strchr>
+     871:	83 c4 10             	add    $0x10,%esp
+     874:	85 c0                	test   %eax,%eax
+     876:	75 1f                	jne    897 <gettoken+0xf7>
+      s++;
+     878:	83 c7 01             	add    $0x1,%edi
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     87b:	39 fb                	cmp    %edi,%ebx
+     87d:	74 77                	je     8f6 <gettoken+0x156>
+     87f:	0f be 07             	movsbl (%edi),%eax
+     882:	83 ec 08             	sub    $0x8,%esp
+     885:	50                   	push   %eax
+     886:	68 cc 22 00 00       	push   $0x22cc
+     88b:	e8 20 08 00 00       	call   10b0 <strchr>
+     890:	83 c4 10             	add    $0x10,%esp
+     893:	85 c0                	test   %eax,%eax
+     895:	74 c9                	je     860 <gettoken+0xc0>
+    ret = 'a';
+     897:	be 61 00 00 00       	mov    $0x61,%esi
+     89c:	e9 5d ff ff ff       	jmp    7fe <gettoken+0x5e>
+     8a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  switch(*s){
+     8a8:	3c 26                	cmp    $0x26,%al
+     8aa:	74 08                	je     8b4 <gettoken+0x114>
+     8ac:	8d 48 d8             	lea    -0x28(%eax),%ecx
+     8af:	80 f9 01             	cmp    $0x1,%cl
+     8b2:	77 8e                	ja     842 <gettoken+0xa2>
+  ret = *s;
+     8b4:	0f be f0             	movsbl %al,%esi
+    s++;
+     8b7:	83 c7 01             	add    $0x1,%edi
+    break;
+     8ba:	e9 3f ff ff ff       	jmp    7fe <gettoken+0x5e>
+     8bf:	90                   	nop
+  switch(*s){
+     8c0:	3c 3e                	cmp    $0x3e,%al
+     8c2:	75 1c                	jne    8e0 <gettoken+0x140>
+    if(*s == '>'){
+     8c4:	80 7f 01 3e          	cmpb   $0x3e,0x1(%edi)
+     8c8:	74 1f                	je     8e9 <gettoken+0x149>
+    s++;
+     8ca:	83 c7 01             	add    $0x1,%edi
+  ret = *s;
+     8cd:	be 3e 00 00 00       	mov    $0x3e,%esi
+     8d2:	e9 27 ff ff ff       	jmp    7fe <gettoken+0x5e>
+     8d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8de:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     8e0:	3c 7c                	cmp    $0x7c,%al
+     8e2:	74 d0                	je     8b4 <gettoken+0x114>
+     8e4:	e9 59 ff ff ff       	jmp    842 <gettoken+0xa2>
+      s++;
+     8e9:	83 c7 02             	add    $0x2,%edi
+      ret = '+';
+     8ec:	be 2b 00 00 00       	mov    $0x2b,%esi
+     8f1:	e9 08 ff ff ff       	jmp    7fe <gettoken+0x5e>
+  if(eq)
+     8f6:	8b 45 14             	mov    0x14(%ebp),%eax
+     8f9:	85 c0                	test   %eax,%eax
+     8fb:	74 05                	je     902 <gettoken+0x162>
+    *eq = s;
+     8fd:	8b 45 14             	mov    0x14(%ebp),%eax
+     900:	89 18                	mov    %ebx,(%eax)
+      s++;
+     902:	89 df                	mov    %ebx,%edi
+    ret = 'a';
+     904:	be 61 00 00 00       	mov    $0x61,%esi
+     909:	e9 21 ff ff ff       	jmp    82f <gettoken+0x8f>
+     90e:	66 90                	xchg   %ax,%ax
+
+00000910 <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+     910:	55                   	push   %ebp
+     911:	89 e5                	mov    %esp,%ebp
+     913:	57                   	push   %edi
+     914:	56                   	push   %esi
+     915:	53                   	push   %ebx
+     916:	83 ec 0c             	sub    $0xc,%esp
+     919:	8b 7d 08             	mov    0x8(%ebp),%edi
+     91c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s;
+
+  s = *ps;
+     91f:	8b 1f                	mov    (%edi),%ebx
+  while(s < es && strchr(whitespace, *s))
+     921:	39 f3                	cmp    %esi,%ebx
+     923:	72 12                	jb     937 <peek+0x27>
+     925:	eb 28                	jmp    94f <peek+0x3f>
+     927:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     92e:	66 90                	xchg   %ax,%ax
+    s++;
+     930:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     933:	39 de                	cmp    %ebx,%esi
+     935:	74 18                	je     94f <peek+0x3f>
+     937:	0f be 03             	movsbl (%ebx),%eax
+     93a:	83 ec 08             	sub    $0x8,%esp
+     93d:	50                   	push   %eax
+     93e:	68 cc 22 00 00       	push   $0x22cc
+     943:	e8 68 07 00 00       	call   10b0 <strchr>
+     948:	83 c4 10             	add    $0x10,%esp
+     94b:	85 c0                	test   %eax,%eax
+     94d:	75 e1                	jne    930 <peek+0x20>
+  *ps = s;
+     94f:	89 1f                	mov    %ebx,(%edi)
+  return *s && strchr(toks, *s);
+     951:	0f be 03             	movsbl (%ebx),%eax
+     954:	31 d2                	xor    %edx,%edx
+     956:	84 c0                	test   %al,%al
+     958:	75 0e                	jne    968 <peek+0x58>
+}
+     95a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     95d:	89 d0                	mov    %edx,%eax
+     95f:	5b                   	pop    %ebx
+     960:	5e                   	pop    %esi
+     961:	5f                   	pop    %edi
+     962:	5d                   	pop    %ebp
+     963:	c3                   	ret
+     964:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return *s && strchr(toks, *s);
+     968:	83 ec 08             	sub    $0x8,%esp
+     96b:	50                   	push   %eax
+     96c:	ff 75 10             	push   0x10(%ebp)
+     96f:	e8 3c 07 00 00       	call   10b0 <strchr>
+     974:	83 c4 10             	add    $0x10,%esp
+     977:	31 d2                	xor    %edx,%edx
+     979:	85 c0                	test   %eax,%eax
+     97b:	0f 95 c2             	setne  %dl
+}
+     97e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     981:	5b                   	pop    %ebx
+     982:	89 d0                	mov    %edx,%eax
+     984:	5e                   	pop    %esi
+     985:	5f                   	pop    %edi
+     986:	5d                   	pop    %ebp
+     987:	c3                   	ret
+     988:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     98f:	90                   	nop
+
+00000990 <parseredirs>:
+  return cmd;
+}
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     990:	55                   	push   %ebp
+     991:	89 e5                	mov    %esp,%ebp
+     993:	57                   	push   %edi
+     994:	56                   	push   %esi
+     995:	53                   	push   %ebx
+     996:	83 ec 2c             	sub    $0x2c,%esp
+     999:	8b 75 0c             	mov    0xc(%ebp),%esi
+     99c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+     99f:	90                   	nop
+     9a0:	83 ec 04             	sub    $0x4,%esp
+     9a3:	68 e2 1a 00 00       	push   $0x1ae2
+     9a8:	53                   	push   %ebx
+     9a9:	56                   	push   %esi
+     9aa:	e8 61 ff ff ff       	call   910 <peek>
+     9af:	83 c4 10             	add    $0x10,%esp
+     9b2:	85 c0                	test   %eax,%eax
+     9b4:	0f 84 09 01 00 00    	je     ac3 <parseredirs+0x133>
+    tok = gettoken(ps, es, 0, 0);
+     9ba:	6a 00                	push   $0x0
+     9bc:	6a 00                	push   $0x0
+     9be:	53                   	push   %ebx
+     9bf:	56                   	push   %esi
+     9c0:	e8 db fd ff ff       	call   7a0 <gettoken>
+     9c5:	89 c7                	mov    %eax,%edi
+    if(gettoken(ps, es, &q, &eq) != 'a'){
+     9c7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     9ca:	50                   	push   %eax
+     9cb:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     9ce:	50                   	push   %eax
+     9cf:	53                   	push   %ebx
+     9d0:	56                   	push   %esi
+     9d1:	e8 ca fd ff ff       	call   7a0 <gettoken>
+     9d6:	83 c4 20             	add    $0x20,%esp
+     9d9:	83 f8 61             	cmp    $0x61,%eax
+     9dc:	0f 85 ce 00 00 00    	jne    ab0 <parseredirs+0x120>
+      syntax("missing file for redirection");
+      break;
+    }
+    switch(tok){
+     9e2:	83 ff 3c             	cmp    $0x3c,%edi
+     9e5:	74 69                	je     a50 <parseredirs+0xc0>
+     9e7:	83 ff 3e             	cmp    $0x3e,%edi
+     9ea:	74 05                	je     9f1 <parseredirs+0x61>
+     9ec:	83 ff 2b             	cmp    $0x2b,%edi
+     9ef:	75 af                	jne    9a0 <parseredirs+0x10>
+      break;
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+      break;
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     9f1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     9f4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     9f7:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     9fa:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     9fd:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     a00:	6a 18                	push   $0x18
+     a02:	e8 99 0f 00 00       	call   19a0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     a07:	83 c4 0c             	add    $0xc,%esp
+     a0a:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     a0c:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     a0e:	6a 00                	push   $0x0
+     a10:	50                   	push   %eax
+     a11:	e8 7a 06 00 00       	call   1090 <memset>
+  cmd->type = REDIR;
+     a16:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  cmd->cmd = subcmd;
+     a1c:	8b 45 08             	mov    0x8(%ebp),%eax
+      break;
+     a1f:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     a22:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     a25:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     a28:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     a2b:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->mode = mode;
+     a2e:	c7 47 10 01 02 00 00 	movl   $0x201,0x10(%edi)
+  cmd->efile = efile;
+     a35:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->fd = fd;
+     a38:	c7 47 14 01 00 00 00 	movl   $0x1,0x14(%edi)
+      break;
+     a3f:	89 7d 08             	mov    %edi,0x8(%ebp)
+     a42:	e9 59 ff ff ff       	jmp    9a0 <parseredirs+0x10>
+     a47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a4e:	66 90                	xchg   %ax,%ax
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     a50:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     a53:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     a56:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     a59:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     a5c:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     a5f:	6a 18                	push   $0x18
+     a61:	e8 3a 0f 00 00       	call   19a0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     a66:	83 c4 0c             	add    $0xc,%esp
+     a69:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     a6b:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     a6d:	6a 00                	push   $0x0
+     a6f:	50                   	push   %eax
+     a70:	e8 1b 06 00 00       	call   1090 <memset>
+  cmd->cmd = subcmd;
+     a75:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->file = file;
+     a78:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+      break;
+     a7b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  cmd->efile = efile;
+     a7e:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->type = REDIR;
+     a81:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+      break;
+     a87:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     a8a:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     a8d:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     a90:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->mode = mode;
+     a93:	c7 47 10 00 00 00 00 	movl   $0x0,0x10(%edi)
+  cmd->fd = fd;
+     a9a:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+      break;
+     aa1:	e9 fa fe ff ff       	jmp    9a0 <parseredirs+0x10>
+     aa6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aad:	8d 76 00             	lea    0x0(%esi),%esi
+  if(!badsyntax)
+     ab0:	a1 e0 22 00 00       	mov    0x22e0,%eax
+     ab5:	85 c0                	test   %eax,%eax
+     ab7:	74 15                	je     ace <parseredirs+0x13e>
+  badsyntax = 1;
+     ab9:	c7 05 e0 22 00 00 01 	movl   $0x1,0x22e0
+     ac0:	00 00 00 
+    }
+  }
+  return cmd;
+}
+     ac3:	8b 45 08             	mov    0x8(%ebp),%eax
+     ac6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ac9:	5b                   	pop    %ebx
+     aca:	5e                   	pop    %esi
+     acb:	5f                   	pop    %edi
+     acc:	5d                   	pop    %ebp
+     acd:	c3                   	ret
+    printf(2, "%s\n", s);
+     ace:	83 ec 04             	sub    $0x4,%esp
+     ad1:	68 c5 1a 00 00       	push   $0x1ac5
+     ad6:	68 2e 1b 00 00       	push   $0x1b2e
+     adb:	6a 02                	push   $0x2
+     add:	e8 7e 0c 00 00       	call   1760 <printf>
+     ae2:	83 c4 10             	add    $0x10,%esp
+     ae5:	eb d2                	jmp    ab9 <parseredirs+0x129>
+     ae7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aee:	66 90                	xchg   %ax,%ax
+
+00000af0 <parseexec>:
+  return cmd;
+}
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     af0:	55                   	push   %ebp
+     af1:	89 e5                	mov    %esp,%ebp
+     af3:	57                   	push   %edi
+     af4:	56                   	push   %esi
+     af5:	53                   	push   %ebx
+     af6:	83 ec 30             	sub    $0x30,%esp
+     af9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     afc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if(peek(ps, es, "("))
+     aff:	68 e5 1a 00 00       	push   $0x1ae5
+     b04:	56                   	push   %esi
+     b05:	53                   	push   %ebx
+     b06:	e8 05 fe ff ff       	call   910 <peek>
+     b0b:	83 c4 10             	add    $0x10,%esp
+     b0e:	85 c0                	test   %eax,%eax
+     b10:	0f 85 ca 00 00 00    	jne    be0 <parseexec+0xf0>
+  cmd = malloc(sizeof(*cmd));
+     b16:	83 ec 0c             	sub    $0xc,%esp
+     b19:	89 c7                	mov    %eax,%edi
+     b1b:	6a 54                	push   $0x54
+     b1d:	e8 7e 0e 00 00       	call   19a0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     b22:	83 c4 0c             	add    $0xc,%esp
+     b25:	6a 54                	push   $0x54
+     b27:	6a 00                	push   $0x0
+     b29:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     b2c:	50                   	push   %eax
+     b2d:	e8 5e 05 00 00       	call   1090 <memset>
+  cmd->type = EXEC;
+     b32:	8b 45 d0             	mov    -0x30(%ebp),%eax
+
+  ret = execcmd();
+  cmd = (struct execcmd*)ret;
+
+  argc = 0;
+  ret = parseredirs(ret, ps, es);
+     b35:	83 c4 0c             	add    $0xc,%esp
+  cmd->type = EXEC;
+     b38:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  ret = parseredirs(ret, ps, es);
+     b3e:	56                   	push   %esi
+     b3f:	53                   	push   %ebx
+     b40:	50                   	push   %eax
+     b41:	e8 4a fe ff ff       	call   990 <parseredirs>
+  while(!peek(ps, es, "|)&;")){
+     b46:	83 c4 10             	add    $0x10,%esp
+  ret = parseredirs(ret, ps, es);
+     b49:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     b4c:	eb 29                	jmp    b77 <parseexec+0x87>
+     b4e:	66 90                	xchg   %ax,%ax
+    }
+    if(argc >= MAXARGS-1){
+      syntax("too many args");
+      break;
+    }
+    cmd->argv[argc] = q;
+     b50:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     b53:	8b 55 d0             	mov    -0x30(%ebp),%edx
+    cmd->eargv[argc] = eq;
+    argc++;
+    ret = parseredirs(ret, ps, es);
+     b56:	83 ec 04             	sub    $0x4,%esp
+    cmd->argv[argc] = q;
+     b59:	89 44 ba 04          	mov    %eax,0x4(%edx,%edi,4)
+    cmd->eargv[argc] = eq;
+     b5d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     b60:	89 44 ba 2c          	mov    %eax,0x2c(%edx,%edi,4)
+    argc++;
+     b64:	83 c7 01             	add    $0x1,%edi
+    ret = parseredirs(ret, ps, es);
+     b67:	56                   	push   %esi
+     b68:	53                   	push   %ebx
+     b69:	ff 75 d4             	push   -0x2c(%ebp)
+     b6c:	e8 1f fe ff ff       	call   990 <parseredirs>
+     b71:	83 c4 10             	add    $0x10,%esp
+     b74:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     b77:	83 ec 04             	sub    $0x4,%esp
+     b7a:	68 fc 1a 00 00       	push   $0x1afc
+     b7f:	56                   	push   %esi
+     b80:	53                   	push   %ebx
+     b81:	e8 8a fd ff ff       	call   910 <peek>
+     b86:	83 c4 10             	add    $0x10,%esp
+     b89:	85 c0                	test   %eax,%eax
+     b8b:	75 33                	jne    bc0 <parseexec+0xd0>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     b8d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     b90:	50                   	push   %eax
+     b91:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     b94:	50                   	push   %eax
+     b95:	56                   	push   %esi
+     b96:	53                   	push   %ebx
+     b97:	e8 04 fc ff ff       	call   7a0 <gettoken>
+     b9c:	83 c4 10             	add    $0x10,%esp
+     b9f:	85 c0                	test   %eax,%eax
+     ba1:	74 1d                	je     bc0 <parseexec+0xd0>
+    if(tok != 'a'){
+     ba3:	83 f8 61             	cmp    $0x61,%eax
+     ba6:	75 70                	jne    c18 <parseexec+0x128>
+    if(argc >= MAXARGS-1){
+     ba8:	83 ff 09             	cmp    $0x9,%edi
+     bab:	75 a3                	jne    b50 <parseexec+0x60>
+  if(!badsyntax)
+     bad:	a1 e0 22 00 00       	mov    0x22e0,%eax
+     bb2:	85 c0                	test   %eax,%eax
+     bb4:	74 42                	je     bf8 <parseexec+0x108>
+  badsyntax = 1;
+     bb6:	c7 05 e0 22 00 00 01 	movl   $0x1,0x22e0
+     bbd:	00 00 00 
+  }
+  cmd->argv[argc] = 0;
+     bc0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     bc3:	c7 44 b8 04 00 00 00 	movl   $0x0,0x4(%eax,%edi,4)
+     bca:	00 
+  cmd->eargv[argc] = 0;
+     bcb:	c7 44 b8 2c 00 00 00 	movl   $0x0,0x2c(%eax,%edi,4)
+     bd2:	00 
+  return ret;
+}
+     bd3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     bd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bd9:	5b                   	pop    %ebx
+     bda:	5e                   	pop    %esi
+     bdb:	5f                   	pop    %edi
+     bdc:	5d                   	pop    %ebp
+     bdd:	c3                   	ret
+     bde:	66 90                	xchg   %ax,%ax
+    return parseblock(ps, es);
+     be0:	89 75 0c             	mov    %esi,0xc(%ebp)
+     be3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     be6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     be9:	5b                   	pop    %ebx
+     bea:	5e                   	pop    %esi
+     beb:	5f                   	pop    %edi
+     bec:	5d                   	pop    %ebp
+    return parseblock(ps, es);
+     bed:	e9 be 01 00 00       	jmp    db0 <parseblock>
+     bf2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(2, "%s\n", s);
+     bf8:	83 ec 04             	sub    $0x4,%esp
+     bfb:	68 ee 1a 00 00       	push   $0x1aee
+     c00:	68 2e 1b 00 00       	push   $0x1b2e
+     c05:	6a 02                	push   $0x2
+     c07:	e8 54 0b 00 00       	call   1760 <printf>
+     c0c:	83 c4 10             	add    $0x10,%esp
+     c0f:	eb a5                	jmp    bb6 <parseexec+0xc6>
+     c11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(!badsyntax)
+     c18:	8b 15 e0 22 00 00    	mov    0x22e0,%edx
+     c1e:	85 d2                	test   %edx,%edx
+     c20:	75 94                	jne    bb6 <parseexec+0xc6>
+    printf(2, "%s\n", s);
+     c22:	83 ec 04             	sub    $0x4,%esp
+     c25:	68 e7 1a 00 00       	push   $0x1ae7
+     c2a:	68 2e 1b 00 00       	push   $0x1b2e
+     c2f:	6a 02                	push   $0x2
+     c31:	e8 2a 0b 00 00       	call   1760 <printf>
+     c36:	83 c4 10             	add    $0x10,%esp
+  badsyntax = 1;
+     c39:	e9 78 ff ff ff       	jmp    bb6 <parseexec+0xc6>
+     c3e:	66 90                	xchg   %ax,%ax
+
+00000c40 <parsepipe>:
+{
+     c40:	55                   	push   %ebp
+     c41:	89 e5                	mov    %esp,%ebp
+     c43:	57                   	push   %edi
+     c44:	56                   	push   %esi
+     c45:	53                   	push   %ebx
+     c46:	83 ec 14             	sub    $0x14,%esp
+     c49:	8b 75 08             	mov    0x8(%ebp),%esi
+     c4c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parseexec(ps, es);
+     c4f:	57                   	push   %edi
+     c50:	56                   	push   %esi
+     c51:	e8 9a fe ff ff       	call   af0 <parseexec>
+  if(peek(ps, es, "|")){
+     c56:	83 c4 0c             	add    $0xc,%esp
+     c59:	68 01 1b 00 00       	push   $0x1b01
+  cmd = parseexec(ps, es);
+     c5e:	89 c3                	mov    %eax,%ebx
+  if(peek(ps, es, "|")){
+     c60:	57                   	push   %edi
+     c61:	56                   	push   %esi
+     c62:	e8 a9 fc ff ff       	call   910 <peek>
+     c67:	83 c4 10             	add    $0x10,%esp
+     c6a:	85 c0                	test   %eax,%eax
+     c6c:	75 12                	jne    c80 <parsepipe+0x40>
+}
+     c6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c71:	89 d8                	mov    %ebx,%eax
+     c73:	5b                   	pop    %ebx
+     c74:	5e                   	pop    %esi
+     c75:	5f                   	pop    %edi
+     c76:	5d                   	pop    %ebp
+     c77:	c3                   	ret
+     c78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c7f:	90                   	nop
+    gettoken(ps, es, 0, 0);
+     c80:	6a 00                	push   $0x0
+     c82:	6a 00                	push   $0x0
+     c84:	57                   	push   %edi
+     c85:	56                   	push   %esi
+     c86:	e8 15 fb ff ff       	call   7a0 <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     c8b:	58                   	pop    %eax
+     c8c:	5a                   	pop    %edx
+     c8d:	57                   	push   %edi
+     c8e:	56                   	push   %esi
+     c8f:	e8 ac ff ff ff       	call   c40 <parsepipe>
+  cmd = malloc(sizeof(*cmd));
+     c94:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     c9b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     c9d:	e8 fe 0c 00 00       	call   19a0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     ca2:	83 c4 0c             	add    $0xc,%esp
+     ca5:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     ca7:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     ca9:	6a 00                	push   $0x0
+     cab:	50                   	push   %eax
+     cac:	e8 df 03 00 00       	call   1090 <memset>
+  cmd->left = left;
+     cb1:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     cb4:	83 c4 10             	add    $0x10,%esp
+     cb7:	89 f3                	mov    %esi,%ebx
+  cmd->type = PIPE;
+     cb9:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+}
+     cbf:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     cc1:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     cc4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cc7:	5b                   	pop    %ebx
+     cc8:	5e                   	pop    %esi
+     cc9:	5f                   	pop    %edi
+     cca:	5d                   	pop    %ebp
+     ccb:	c3                   	ret
+     ccc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000cd0 <parseline>:
+{
+     cd0:	55                   	push   %ebp
+     cd1:	89 e5                	mov    %esp,%ebp
+     cd3:	57                   	push   %edi
+     cd4:	56                   	push   %esi
+     cd5:	53                   	push   %ebx
+     cd6:	83 ec 24             	sub    $0x24,%esp
+     cd9:	8b 75 08             	mov    0x8(%ebp),%esi
+     cdc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parsepipe(ps, es);
+     cdf:	57                   	push   %edi
+     ce0:	56                   	push   %esi
+     ce1:	e8 5a ff ff ff       	call   c40 <parsepipe>
+  while(peek(ps, es, "&")){
+     ce6:	83 c4 10             	add    $0x10,%esp
+  cmd = parsepipe(ps, es);
+     ce9:	89 c3                	mov    %eax,%ebx
+  while(peek(ps, es, "&")){
+     ceb:	eb 3b                	jmp    d28 <parseline+0x58>
+     ced:	8d 76 00             	lea    0x0(%esi),%esi
+    gettoken(ps, es, 0, 0);
+     cf0:	6a 00                	push   $0x0
+     cf2:	6a 00                	push   $0x0
+     cf4:	57                   	push   %edi
+     cf5:	56                   	push   %esi
+     cf6:	e8 a5 fa ff ff       	call   7a0 <gettoken>
+  cmd = malloc(sizeof(*cmd));
+     cfb:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+     d02:	e8 99 0c 00 00       	call   19a0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     d07:	83 c4 0c             	add    $0xc,%esp
+     d0a:	6a 08                	push   $0x8
+     d0c:	6a 00                	push   $0x0
+     d0e:	50                   	push   %eax
+     d0f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     d12:	e8 79 03 00 00       	call   1090 <memset>
+  cmd->type = BACK;
+     d17:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  cmd->cmd = subcmd;
+     d1a:	83 c4 10             	add    $0x10,%esp
+  cmd->type = BACK;
+     d1d:	c7 02 05 00 00 00    	movl   $0x5,(%edx)
+  cmd->cmd = subcmd;
+     d23:	89 5a 04             	mov    %ebx,0x4(%edx)
+     d26:	89 d3                	mov    %edx,%ebx
+  while(peek(ps, es, "&")){
+     d28:	83 ec 04             	sub    $0x4,%esp
+     d2b:	68 03 1b 00 00       	push   $0x1b03
+     d30:	57                   	push   %edi
+     d31:	56                   	push   %esi
+     d32:	e8 d9 fb ff ff       	call   910 <peek>
+     d37:	83 c4 10             	add    $0x10,%esp
+     d3a:	85 c0                	test   %eax,%eax
+     d3c:	75 b2                	jne    cf0 <parseline+0x20>
+  if(peek(ps, es, ";")){
+     d3e:	83 ec 04             	sub    $0x4,%esp
+     d41:	68 ff 1a 00 00       	push   $0x1aff
+     d46:	57                   	push   %edi
+     d47:	56                   	push   %esi
+     d48:	e8 c3 fb ff ff       	call   910 <peek>
+     d4d:	83 c4 10             	add    $0x10,%esp
+     d50:	85 c0                	test   %eax,%eax
+     d52:	75 0c                	jne    d60 <parseline+0x90>
+}
+     d54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d57:	89 d8                	mov    %ebx,%eax
+     d59:	5b                   	pop    %ebx
+     d5a:	5e                   	pop    %esi
+     d5b:	5f                   	pop    %edi
+     d5c:	5d                   	pop    %ebp
+     d5d:	c3                   	ret
+     d5e:	66 90                	xchg   %ax,%ax
+    gettoken(ps, es, 0, 0);
+     d60:	6a 00                	push   $0x0
+     d62:	6a 00                	push   $0x0
+     d64:	57                   	push   %edi
+     d65:	56                   	push   %esi
+     d66:	e8 35 fa ff ff       	call   7a0 <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+     d6b:	58                   	pop    %eax
+     d6c:	5a                   	pop    %edx
+     d6d:	57                   	push   %edi
+     d6e:	56                   	push   %esi
+     d6f:	e8 5c ff ff ff       	call   cd0 <parseline>
+  cmd = malloc(sizeof(*cmd));
+     d74:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = listcmd(cmd, parseline(ps, es));
+     d7b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     d7d:	e8 1e 0c 00 00       	call   19a0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     d82:	83 c4 0c             	add    $0xc,%esp
+     d85:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     d87:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     d89:	6a 00                	push   $0x0
+     d8b:	50                   	push   %eax
+     d8c:	e8 ff 02 00 00       	call   1090 <memset>
+  cmd->left = left;
+     d91:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     d94:	83 c4 10             	add    $0x10,%esp
+     d97:	89 f3                	mov    %esi,%ebx
+  cmd->type = LIST;
+     d99:	c7 06 04 00 00 00    	movl   $0x4,(%esi)
+}
+     d9f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     da1:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     da4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     da7:	5b                   	pop    %ebx
+     da8:	5e                   	pop    %esi
+     da9:	5f                   	pop    %edi
+     daa:	5d                   	pop    %ebp
+     dab:	c3                   	ret
+     dac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000db0 <parseblock>:
+{
+     db0:	55                   	push   %ebp
+     db1:	89 e5                	mov    %esp,%ebp
+     db3:	57                   	push   %edi
+     db4:	56                   	push   %esi
+     db5:	53                   	push   %ebx
+     db6:	83 ec 10             	sub    $0x10,%esp
+     db9:	8b 75 08             	mov    0x8(%ebp),%esi
+     dbc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(!peek(ps, es, "("))
+     dbf:	68 e5 1a 00 00       	push   $0x1ae5
+     dc4:	57                   	push   %edi
+     dc5:	56                   	push   %esi
+     dc6:	e8 45 fb ff ff       	call   910 <peek>
+     dcb:	83 c4 10             	add    $0x10,%esp
+     dce:	85 c0                	test   %eax,%eax
+     dd0:	0f 84 93 00 00 00    	je     e69 <parseblock+0xb9>
+  gettoken(ps, es, 0, 0);
+     dd6:	6a 00                	push   $0x0
+     dd8:	6a 00                	push   $0x0
+     dda:	57                   	push   %edi
+     ddb:	56                   	push   %esi
+     ddc:	e8 bf f9 ff ff       	call   7a0 <gettoken>
+  cmd = parseline(ps, es);
+     de1:	5a                   	pop    %edx
+     de2:	59                   	pop    %ecx
+     de3:	57                   	push   %edi
+     de4:	56                   	push   %esi
+     de5:	e8 e6 fe ff ff       	call   cd0 <parseline>
+  if(!peek(ps, es, ")")){
+     dea:	83 c4 0c             	add    $0xc,%esp
+     ded:	68 21 1b 00 00       	push   $0x1b21
+  cmd = parseline(ps, es);
+     df2:	89 c3                	mov    %eax,%ebx
+  if(!peek(ps, es, ")")){
+     df4:	57                   	push   %edi
+     df5:	56                   	push   %esi
+     df6:	e8 15 fb ff ff       	call   910 <peek>
+     dfb:	83 c4 10             	add    $0x10,%esp
+     dfe:	85 c0                	test   %eax,%eax
+     e00:	74 2e                	je     e30 <parseblock+0x80>
+  gettoken(ps, es, 0, 0);
+     e02:	6a 00                	push   $0x0
+     e04:	6a 00                	push   $0x0
+     e06:	57                   	push   %edi
+     e07:	56                   	push   %esi
+     e08:	e8 93 f9 ff ff       	call   7a0 <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+     e0d:	83 c4 0c             	add    $0xc,%esp
+     e10:	57                   	push   %edi
+     e11:	56                   	push   %esi
+     e12:	53                   	push   %ebx
+     e13:	e8 78 fb ff ff       	call   990 <parseredirs>
+  return cmd;
+     e18:	83 c4 10             	add    $0x10,%esp
+}
+     e1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  cmd = parseredirs(cmd, ps, es);
+     e1e:	89 c3                	mov    %eax,%ebx
+}
+     e20:	89 d8                	mov    %ebx,%eax
+     e22:	5b                   	pop    %ebx
+     e23:	5e                   	pop    %esi
+     e24:	5f                   	pop    %edi
+     e25:	5d                   	pop    %ebp
+     e26:	c3                   	ret
+     e27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e2e:	66 90                	xchg   %ax,%ax
+  if(!badsyntax)
+     e30:	a1 e0 22 00 00       	mov    0x22e0,%eax
+     e35:	85 c0                	test   %eax,%eax
+     e37:	74 17                	je     e50 <parseblock+0xa0>
+  badsyntax = 1;
+     e39:	c7 05 e0 22 00 00 01 	movl   $0x1,0x22e0
+     e40:	00 00 00 
+}
+     e43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e46:	89 d8                	mov    %ebx,%eax
+     e48:	5b                   	pop    %ebx
+     e49:	5e                   	pop    %esi
+     e4a:	5f                   	pop    %edi
+     e4b:	5d                   	pop    %ebp
+     e4c:	c3                   	ret
+     e4d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(2, "%s\n", s);
+     e50:	83 ec 04             	sub    $0x4,%esp
+     e53:	68 10 1b 00 00       	push   $0x1b10
+     e58:	68 2e 1b 00 00       	push   $0x1b2e
+     e5d:	6a 02                	push   $0x2
+     e5f:	e8 fc 08 00 00       	call   1760 <printf>
+     e64:	83 c4 10             	add    $0x10,%esp
+     e67:	eb d0                	jmp    e39 <parseblock+0x89>
+    panic("parseblock");
+     e69:	83 ec 0c             	sub    $0xc,%esp
+     e6c:	68 05 1b 00 00       	push   $0x1b05
+     e71:	e8 6a f4 ff ff       	call   2e0 <panic>
+     e76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e80 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+     e80:	55                   	push   %ebp
+     e81:	89 e5                	mov    %esp,%ebp
+     e83:	53                   	push   %ebx
+     e84:	83 ec 04             	sub    $0x4,%esp
+     e87:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     e8a:	85 db                	test   %ebx,%ebx
+     e8c:	0f 84 7e 00 00 00    	je     f10 <nulterminate+0x90>
+    return 0;
+
+  switch(cmd->type){
+     e92:	83 3b 05             	cmpl   $0x5,(%ebx)
+     e95:	77 20                	ja     eb7 <nulterminate+0x37>
+     e97:	8b 03                	mov    (%ebx),%eax
+     e99:	ff 24 85 60 1b 00 00 	jmp    *0x1b60(,%eax,4)
+    nulterminate(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    nulterminate(lcmd->left);
+     ea0:	83 ec 0c             	sub    $0xc,%esp
+     ea3:	ff 73 04             	push   0x4(%ebx)
+     ea6:	e8 d5 ff ff ff       	call   e80 <nulterminate>
+    nulterminate(lcmd->right);
+     eab:	58                   	pop    %eax
+     eac:	ff 73 08             	push   0x8(%ebx)
+     eaf:	e8 cc ff ff ff       	call   e80 <nulterminate>
+    break;
+     eb4:	83 c4 10             	add    $0x10,%esp
+    return 0;
+     eb7:	89 d8                	mov    %ebx,%eax
+    bcmd = (struct backcmd*)cmd;
+    nulterminate(bcmd->cmd);
+    break;
+  }
+  return cmd;
+}
+     eb9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ebc:	c9                   	leave
+     ebd:	c3                   	ret
+     ebe:	66 90                	xchg   %ax,%ax
+    nulterminate(bcmd->cmd);
+     ec0:	83 ec 0c             	sub    $0xc,%esp
+     ec3:	ff 73 04             	push   0x4(%ebx)
+     ec6:	e8 b5 ff ff ff       	call   e80 <nulterminate>
+    break;
+     ecb:	83 c4 10             	add    $0x10,%esp
+     ece:	eb e7                	jmp    eb7 <nulterminate+0x37>
+    for(i=0; ecmd->argv[i]; i++)
+     ed0:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     ed3:	8d 43 08             	lea    0x8(%ebx),%eax
+     ed6:	85 c9                	test   %ecx,%ecx
+     ed8:	74 dd                	je     eb7 <nulterminate+0x37>
+     eda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      *ecmd->eargv[i] = 0;
+     ee0:	8b 50 24             	mov    0x24(%eax),%edx
+    for(i=0; ecmd->argv[i]; i++)
+     ee3:	83 c0 04             	add    $0x4,%eax
+      *ecmd->eargv[i] = 0;
+     ee6:	c6 02 00             	movb   $0x0,(%edx)
+    for(i=0; ecmd->argv[i]; i++)
+     ee9:	8b 50 fc             	mov    -0x4(%eax),%edx
+     eec:	85 d2                	test   %edx,%edx
+     eee:	75 f0                	jne    ee0 <nulterminate+0x60>
+     ef0:	eb c5                	jmp    eb7 <nulterminate+0x37>
+     ef2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    nulterminate(rcmd->cmd);
+     ef8:	83 ec 0c             	sub    $0xc,%esp
+     efb:	ff 73 04             	push   0x4(%ebx)
+     efe:	e8 7d ff ff ff       	call   e80 <nulterminate>
+    *rcmd->efile = 0;
+     f03:	8b 43 0c             	mov    0xc(%ebx),%eax
+    break;
+     f06:	83 c4 10             	add    $0x10,%esp
+    *rcmd->efile = 0;
+     f09:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+     f0c:	eb a9                	jmp    eb7 <nulterminate+0x37>
+     f0e:	66 90                	xchg   %ax,%ax
+    return 0;
+     f10:	31 c0                	xor    %eax,%eax
+     f12:	eb a5                	jmp    eb9 <nulterminate+0x39>
+     f14:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f1f:	90                   	nop
+
+00000f20 <parsecmd>:
+{
+     f20:	55                   	push   %ebp
+     f21:	89 e5                	mov    %esp,%ebp
+     f23:	57                   	push   %edi
+     f24:	56                   	push   %esi
+  cmd = parseline(&s, es);
+     f25:	8d 7d 08             	lea    0x8(%ebp),%edi
+{
+     f28:	53                   	push   %ebx
+     f29:	83 ec 18             	sub    $0x18,%esp
+  es = s + strlen(s);
+     f2c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     f2f:	53                   	push   %ebx
+     f30:	e8 2b 01 00 00       	call   1060 <strlen>
+  cmd = parseline(&s, es);
+     f35:	59                   	pop    %ecx
+     f36:	5e                   	pop    %esi
+  es = s + strlen(s);
+     f37:	01 c3                	add    %eax,%ebx
+  cmd = parseline(&s, es);
+     f39:	53                   	push   %ebx
+     f3a:	57                   	push   %edi
+     f3b:	e8 90 fd ff ff       	call   cd0 <parseline>
+  peek(&s, es, "");
+     f40:	83 c4 0c             	add    $0xc,%esp
+     f43:	68 9a 1a 00 00       	push   $0x1a9a
+  cmd = parseline(&s, es);
+     f48:	89 c6                	mov    %eax,%esi
+  peek(&s, es, "");
+     f4a:	53                   	push   %ebx
+     f4b:	57                   	push   %edi
+     f4c:	e8 bf f9 ff ff       	call   910 <peek>
+  if(s != es && !badsyntax){
+     f51:	8b 45 08             	mov    0x8(%ebp),%eax
+     f54:	83 c4 10             	add    $0x10,%esp
+     f57:	39 d8                	cmp    %ebx,%eax
+     f59:	74 0a                	je     f65 <parsecmd+0x45>
+     f5b:	8b 15 e0 22 00 00    	mov    0x22e0,%edx
+     f61:	85 d2                	test   %edx,%edx
+     f63:	74 1b                	je     f80 <parsecmd+0x60>
+  nulterminate(cmd);
+     f65:	83 ec 0c             	sub    $0xc,%esp
+     f68:	56                   	push   %esi
+     f69:	e8 12 ff ff ff       	call   e80 <nulterminate>
+}
+     f6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f71:	89 f0                	mov    %esi,%eax
+     f73:	5b                   	pop    %ebx
+     f74:	5e                   	pop    %esi
+     f75:	5f                   	pop    %edi
+     f76:	5d                   	pop    %ebp
+     f77:	c3                   	ret
+     f78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f7f:	90                   	nop
+    printf(2, "leftovers: %s\n", s);
+     f80:	83 ec 04             	sub    $0x4,%esp
+     f83:	50                   	push   %eax
+     f84:	68 23 1b 00 00       	push   $0x1b23
+     f89:	6a 02                	push   $0x2
+     f8b:	e8 d0 07 00 00       	call   1760 <printf>
+  if(!badsyntax)
+     f90:	a1 e0 22 00 00       	mov    0x22e0,%eax
+     f95:	83 c4 10             	add    $0x10,%esp
+     f98:	85 c0                	test   %eax,%eax
+     f9a:	74 14                	je     fb0 <parsecmd+0x90>
+  badsyntax = 1;
+     f9c:	c7 05 e0 22 00 00 01 	movl   $0x1,0x22e0
+     fa3:	00 00 00 
+}
+     fa6:	eb bd                	jmp    f65 <parsecmd+0x45>
+     fa8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     faf:	90                   	nop
+    printf(2, "%s\n", s);
+     fb0:	83 ec 04             	sub    $0x4,%esp
+     fb3:	68 e7 1a 00 00       	push   $0x1ae7
+     fb8:	68 2e 1b 00 00       	push   $0x1b2e
+     fbd:	6a 02                	push   $0x2
+     fbf:	e8 9c 07 00 00       	call   1760 <printf>
+     fc4:	83 c4 10             	add    $0x10,%esp
+     fc7:	eb d3                	jmp    f9c <parsecmd+0x7c>
+     fc9:	66 90                	xchg   %ax,%ax
+     fcb:	66 90                	xchg   %ax,%ax
+     fcd:	66 90                	xchg   %ax,%ax
+     fcf:	90                   	nop
+
+00000fd0 <strcpy>:
+#include "date.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     fd0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     fd1:	31 c0                	xor    %eax,%eax
+{
+     fd3:	89 e5                	mov    %esp,%ebp
+     fd5:	53                   	push   %ebx
+     fd6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     fd9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     fdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     fe0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     fe4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     fe7:	83 c0 01             	add    $0x1,%eax
+     fea:	84 d2                	test   %dl,%dl
+     fec:	75 f2                	jne    fe0 <strcpy+0x10>
+    ;
+  return os;
+}
+     fee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ff1:	89 c8                	mov    %ecx,%eax
+     ff3:	c9                   	leave
+     ff4:	c3                   	ret
+     ff5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ffc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001000 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1000:	55                   	push   %ebp
+    1001:	89 e5                	mov    %esp,%ebp
+    1003:	53                   	push   %ebx
+    1004:	8b 55 08             	mov    0x8(%ebp),%edx
+    1007:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    100a:	0f b6 02             	movzbl (%edx),%eax
+    100d:	84 c0                	test   %al,%al
+    100f:	75 17                	jne    1028 <strcmp+0x28>
+    1011:	eb 3a                	jmp    104d <strcmp+0x4d>
+    1013:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1017:	90                   	nop
+    1018:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    101c:	83 c2 01             	add    $0x1,%edx
+    101f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    1022:	84 c0                	test   %al,%al
+    1024:	74 1a                	je     1040 <strcmp+0x40>
+    p++, q++;
+    1026:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    1028:	0f b6 19             	movzbl (%ecx),%ebx
+    102b:	38 c3                	cmp    %al,%bl
+    102d:	74 e9                	je     1018 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    102f:	29 d8                	sub    %ebx,%eax
+}
+    1031:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1034:	c9                   	leave
+    1035:	c3                   	ret
+    1036:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    103d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    1040:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    1044:	31 c0                	xor    %eax,%eax
+    1046:	29 d8                	sub    %ebx,%eax
+}
+    1048:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    104b:	c9                   	leave
+    104c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    104d:	0f b6 19             	movzbl (%ecx),%ebx
+    1050:	31 c0                	xor    %eax,%eax
+    1052:	eb db                	jmp    102f <strcmp+0x2f>
+    1054:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    105b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    105f:	90                   	nop
+
+00001060 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    1060:	55                   	push   %ebp
+    1061:	89 e5                	mov    %esp,%ebp
+    1063:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1066:	80 3a 00             	cmpb   $0x0,(%edx)
+    1069:	74 15                	je     1080 <strlen+0x20>
+    106b:	31 c0                	xor    %eax,%eax
+    106d:	8d 76 00             	lea    0x0(%esi),%esi
+    1070:	83 c0 01             	add    $0x1,%eax
+    1073:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    1077:	89 c1                	mov    %eax,%ecx
+    1079:	75 f5                	jne    1070 <strlen+0x10>
+    ;
+  return n;
+}
+    107b:	89 c8                	mov    %ecx,%eax
+    107d:	5d                   	pop    %ebp
+    107e:	c3                   	ret
+    107f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    1080:	31 c9                	xor    %ecx,%ecx
+}
+    1082:	5d                   	pop    %ebp
+    1083:	89 c8                	mov    %ecx,%eax
+    1085:	c3                   	ret
+    1086:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    108d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001090 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1090:	55                   	push   %ebp
+    1091:	89 e5                	mov    %esp,%ebp
+    1093:	57                   	push   %edi
+    1094:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    1097:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    109a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    109d:	89 d7                	mov    %edx,%edi
+    109f:	fc                   	cld
+    10a0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    10a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    10a5:	89 d0                	mov    %edx,%eax
+    10a7:	c9                   	leave
+    10a8:	c3                   	ret
+    10a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000010b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    10b0:	55                   	push   %ebp
+    10b1:	89 e5                	mov    %esp,%ebp
+    10b3:	8b 45 08             	mov    0x8(%ebp),%eax
+    10b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    10ba:	0f b6 10             	movzbl (%eax),%edx
+    10bd:	84 d2                	test   %dl,%dl
+    10bf:	75 12                	jne    10d3 <strchr+0x23>
+    10c1:	eb 1d                	jmp    10e0 <strchr+0x30>
+    10c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10c7:	90                   	nop
+    10c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    10cc:	83 c0 01             	add    $0x1,%eax
+    10cf:	84 d2                	test   %dl,%dl
+    10d1:	74 0d                	je     10e0 <strchr+0x30>
+    if(*s == c)
+    10d3:	38 d1                	cmp    %dl,%cl
+    10d5:	75 f1                	jne    10c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    10d7:	5d                   	pop    %ebp
+    10d8:	c3                   	ret
+    10d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    10e0:	31 c0                	xor    %eax,%eax
+}
+    10e2:	5d                   	pop    %ebp
+    10e3:	c3                   	ret
+    10e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10ef:	90                   	nop
+
+000010f0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    10f0:	55                   	push   %ebp
+    10f1:	89 e5                	mov    %esp,%ebp
+    10f3:	57                   	push   %edi
+    10f4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    10f5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    10f8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    10f9:	31 db                	xor    %ebx,%ebx
+{
+    10fb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    10fe:	eb 27                	jmp    1127 <gets+0x37>
+    cc = read(0, &c, 1);
+    1100:	83 ec 04             	sub    $0x4,%esp
+    1103:	6a 01                	push   $0x1
+    1105:	56                   	push   %esi
+    1106:	6a 00                	push   $0x0
+    1108:	e8 13 02 00 00       	call   1320 <read>
+    if(cc < 1)
+    110d:	83 c4 10             	add    $0x10,%esp
+    1110:	85 c0                	test   %eax,%eax
+    1112:	7e 1d                	jle    1131 <gets+0x41>
+      break;
+    buf[i++] = c;
+    1114:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    1118:	8b 55 08             	mov    0x8(%ebp),%edx
+    111b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    111f:	3c 0a                	cmp    $0xa,%al
+    1121:	74 10                	je     1133 <gets+0x43>
+    1123:	3c 0d                	cmp    $0xd,%al
+    1125:	74 0c                	je     1133 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    1127:	89 df                	mov    %ebx,%edi
+    1129:	83 c3 01             	add    $0x1,%ebx
+    112c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    112f:	7c cf                	jl     1100 <gets+0x10>
+    1131:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    1133:	8b 45 08             	mov    0x8(%ebp),%eax
+    1136:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    113a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    113d:	5b                   	pop    %ebx
+    113e:	5e                   	pop    %esi
+    113f:	5f                   	pop    %edi
+    1140:	5d                   	pop    %ebp
+    1141:	c3                   	ret
+    1142:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001150 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    1150:	55                   	push   %ebp
+    1151:	89 e5                	mov    %esp,%ebp
+    1153:	56                   	push   %esi
+    1154:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1155:	83 ec 08             	sub    $0x8,%esp
+    1158:	6a 00                	push   $0x0
+    115a:	ff 75 08             	push   0x8(%ebp)
+    115d:	e8 4f 02 00 00       	call   13b1 <open>
+  if(fd < 0)
+    1162:	83 c4 10             	add    $0x10,%esp
+    1165:	85 c0                	test   %eax,%eax
+    1167:	78 27                	js     1190 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    1169:	83 ec 08             	sub    $0x8,%esp
+    116c:	ff 75 0c             	push   0xc(%ebp)
+    116f:	89 c3                	mov    %eax,%ebx
+    1171:	50                   	push   %eax
+    1172:	e8 91 02 00 00       	call   1408 <fstat>
+  close(fd);
+    1177:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    117a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    117c:	e8 d9 01 00 00       	call   135a <close>
+  return r;
+    1181:	83 c4 10             	add    $0x10,%esp
+}
+    1184:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1187:	89 f0                	mov    %esi,%eax
+    1189:	5b                   	pop    %ebx
+    118a:	5e                   	pop    %esi
+    118b:	5d                   	pop    %ebp
+    118c:	c3                   	ret
+    118d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    1190:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1195:	eb ed                	jmp    1184 <stat+0x34>
+    1197:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    119e:	66 90                	xchg   %ax,%ax
+
+000011a0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    11a0:	55                   	push   %ebp
+    11a1:	89 e5                	mov    %esp,%ebp
+    11a3:	53                   	push   %ebx
+    11a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    11a7:	0f be 02             	movsbl (%edx),%eax
+    11aa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    11ad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    11b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    11b5:	77 1e                	ja     11d5 <atoi+0x35>
+    11b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    11c0:	83 c2 01             	add    $0x1,%edx
+    11c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    11c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    11ca:	0f be 02             	movsbl (%edx),%eax
+    11cd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    11d0:	80 fb 09             	cmp    $0x9,%bl
+    11d3:	76 eb                	jbe    11c0 <atoi+0x20>
+  return n;
+}
+    11d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    11d8:	89 c8                	mov    %ecx,%eax
+    11da:	c9                   	leave
+    11db:	c3                   	ret
+    11dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000011e0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    11e0:	55                   	push   %ebp
+    11e1:	89 e5                	mov    %esp,%ebp
+    11e3:	57                   	push   %edi
+    11e4:	56                   	push   %esi
+    11e5:	8b 45 10             	mov    0x10(%ebp),%eax
+    11e8:	8b 55 08             	mov    0x8(%ebp),%edx
+    11eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    11ee:	85 c0                	test   %eax,%eax
+    11f0:	7e 13                	jle    1205 <memmove+0x25>
+    11f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    11f4:	89 d7                	mov    %edx,%edi
+    11f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    1200:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    1201:	39 f8                	cmp    %edi,%eax
+    1203:	75 fb                	jne    1200 <memmove+0x20>
+  return vdst;
+}
+    1205:	5e                   	pop    %esi
+    1206:	89 d0                	mov    %edx,%eax
+    1208:	5f                   	pop    %edi
+    1209:	5d                   	pop    %ebp
+    120a:	c3                   	ret
+    120b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    120f:	90                   	nop
+
+00001210 <ugetpid>:
+// getpid() without a system call, from the page at UPROC.
+int
+ugetpid(void)
+{
+  return ((struct uproc*)UPROC)->pid;
+}
+    1210:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+    1215:	c3                   	ret
+    1216:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    121d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001220 <uclocktime>:
+
+// clocktime() without a system call, from the page at UCLOCK.
+int
+uclocktime(struct timespec *ts)
+{
+    1220:	55                   	push   %ebp
+    1221:	89 e5                	mov    %esp,%ebp
+    1223:	57                   	push   %edi
+    1224:	56                   	push   %esi
+    1225:	53                   	push   %ebx
+    1226:	83 ec 1c             	sub    $0x1c,%esp
+  struct uclock *c = (struct uclock*)UCLOCK;
+
+  if(c->tscmult == 0)
+    1229:	8b 0d 08 f0 ff 7f    	mov    0x7ffff008,%ecx
+{
+    122f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(c->tscmult == 0)
+    1232:	85 c9                	test   %ecx,%ecx
+    1234:	74 6a                	je     12a0 <uclocktime+0x80>
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+    1236:	0f 31                	rdtsc
+static inline void
+uclockread(struct uclock *c, uint64 tsc, struct timespec *ts)
+{
+  uint64 d, ns;
+
+  d = tsc - c->tscbase;
+    1238:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+    123e:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+    1244:	89 c6                	mov    %eax,%esi
+  if((long long)d < 0)  // another CPU's TSC is a little behind
+    1246:	85 d2                	test   %edx,%edx
+    1248:	78 46                	js     1290 <uclocktime+0x70>
+    d = 0;
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+    124a:	89 d0                	mov    %edx,%eax
+    124c:	f7 e1                	mul    %ecx
+    124e:	0f a4 c2 08          	shld   $0x8,%eax,%edx
+    1252:	c1 e0 08             	shl    $0x8,%eax
+    1255:	89 45 e0             	mov    %eax,-0x20(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+    1258:	89 f0                	mov    %esi,%eax
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+    125a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+    125d:	f7 e1                	mul    %ecx
+    125f:	0f ac d0 18          	shrd   $0x18,%edx,%eax
+    1263:	c1 ea 18             	shr    $0x18,%edx
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+    1266:	03 45 e0             	add    -0x20(%ebp),%eax
+    1269:	13 55 e4             	adc    -0x1c(%ebp),%edx
+// linked with libgcc, so it cannot use 64-bit '/' or '%'.
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+  asm("divl %4" : "=a" (q), "=d" (r) : "a" ((uint)n), "d" ((uint)(n>>32)), "rm" (d));
+    126c:	89 c7                	mov    %eax,%edi
+    126e:	89 f8                	mov    %edi,%eax
+    1270:	b9 00 ca 9a 3b       	mov    $0x3b9aca00,%ecx
+    1275:	f7 f1                	div    %ecx
+  ts->sec = divl(ns, 1000000000, &ts->nsec);
+    1277:	89 03                	mov    %eax,(%ebx)
+    return clocktime(ts);
+  uclockread(c, rdtsc(), ts);
+  return 0;
+}
+    1279:	31 c0                	xor    %eax,%eax
+  *rem = r;
+    127b:	89 53 04             	mov    %edx,0x4(%ebx)
+    127e:	83 c4 1c             	add    $0x1c,%esp
+    1281:	5b                   	pop    %ebx
+    1282:	5e                   	pop    %esi
+    1283:	5f                   	pop    %edi
+    1284:	5d                   	pop    %ebp
+    1285:	c3                   	ret
+    1286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    128d:	8d 76 00             	lea    0x0(%esi),%esi
+    1290:	31 d2                	xor    %edx,%edx
+    1292:	31 ff                	xor    %edi,%edi
+    1294:	eb d8                	jmp    126e <uclocktime+0x4e>
+    1296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    129d:	8d 76 00             	lea    0x0(%esi),%esi
+    12a0:	83 c4 1c             	add    $0x1c,%esp
+    12a3:	5b                   	pop    %ebx
+    12a4:	5e                   	pop    %esi
+    12a5:	5f                   	pop    %edi
+    12a6:	5d                   	pop    %ebp
+    return clocktime(ts);
+    12a7:	e9 f2 02 00 00       	jmp    159e <clocktime>
+
+000012ac <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+    12ac:	b8 01 00 00 00       	mov    $0x1,%eax
+    12b1:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    12b8:	00 00 00 
+    12bb:	74 09                	je     12c6 <fork+0x1a>
+    12bd:	89 e1                	mov    %esp,%ecx
+    12bf:	ba c8 12 00 00       	mov    $0x12c8,%edx
+    12c4:	0f 34                	sysenter
+    12c6:	cd 40                	int    $0x40
+    12c8:	c3                   	ret
+
+000012c9 <exit>:
+SYSCALL(exit)
+    12c9:	b8 02 00 00 00       	mov    $0x2,%eax
+    12ce:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    12d5:	00 00 00 
+    12d8:	74 09                	je     12e3 <exit+0x1a>
+    12da:	89 e1                	mov    %esp,%ecx
+    12dc:	ba e5 12 00 00       	mov    $0x12e5,%edx
+    12e1:	0f 34                	sysenter
+    12e3:	cd 40                	int    $0x40
+    12e5:	c3                   	ret
+
+000012e6 <wait>:
+SYSCALL(wait)
+    12e6:	b8 03 00 00 00       	mov    $0x3,%eax
+    12eb:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    12f2:	00 00 00 
+    12f5:	74 09                	je     1300 <wait+0x1a>
+    12f7:	89 e1                	mov    %esp,%ecx
+    12f9:	ba 02 13 00 00       	mov    $0x1302,%edx
+    12fe:	0f 34                	sysenter
+    1300:	cd 40                	int    $0x40
+    1302:	c3                   	ret
+
+00001303 <pipe>:
+SYSCALL(pipe)
+    1303:	b8 04 00 00 00       	mov    $0x4,%eax
+    1308:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    130f:	00 00 00 
+    1312:	74 09                	je     131d <pipe+0x1a>
+    1314:	89 e1                	mov    %esp,%ecx
+    1316:	ba 1f 13 00 00       	mov    $0x131f,%edx
+    131b:	0f 34                	sysenter
+    131d:	cd 40                	int    $0x40
+    131f:	c3                   	ret
+
+00001320 <read>:
+SYSCALL(read)
+    1320:	b8 05 00 00 00       	mov    $0x5,%eax
+    1325:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    132c:	00 00 00 
+    132f:	74 09                	je     133a <read+0x1a>
+    1331:	89 e1                	mov    %esp,%ecx
+    1333:	ba 3c 13 00 00       	mov    $0x133c,%edx
+    1338:	0f 34                	sysenter
+    133a:	cd 40                	int    $0x40
+    133c:	c3                   	ret
+
+0000133d <write>:
+SYSCALL(write)
+    133d:	b8 10 00 00 00       	mov    $0x10,%eax
+    1342:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    1349:	00 00 00 
+    134c:	74 09                	je     1357 <write+0x1a>
+    134e:	89 e1                	mov    %esp,%ecx
+    1350:	ba 59 13 00 00       	mov    $0x1359,%edx
+    1355:	0f 34                	sysenter
+    1357:	cd 40                	int    $0x40
+    1359:	c3                   	ret
+
+0000135a <close>:
+SYSCALL(close)
+    135a:	b8 15 00 00 00       	mov    $0x15,%eax
+    135f:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    1366:	00 00 00 
+    1369:	74 09                	je     1374 <close+0x1a>
+    136b:	89 e1                	mov    %esp,%ecx
+    136d:	ba 76 13 00 00       	mov    $0x1376,%edx
+    1372:	0f 34                	sysenter
+    1374:	cd 40                	int    $0x40
+    1376:	c3                   	ret
+
+00001377 <kill>:
+SYSCALL(kill)
+    1377:	b8 06 00 00 00       	mov    $0x6,%eax
+    137c:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    1383:	00 00 00 
+    1386:	74 09                	je     1391 <kill+0x1a>
+    1388:	89 e1                	mov    %esp,%ecx
+    138a:	ba 93 13 00 00       	mov    $0x1393,%edx
+    138f:	0f 34                	sysenter
+    1391:	cd 40                	int    $0x40
+    1393:	c3                   	ret
+
+00001394 <exec>:
+SYSCALL(exec)
+    1394:	b8 07 00 00 00       	mov    $0x7,%eax
+    1399:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    13a0:	00 00 00 
+    13a3:	74 09                	je     13ae <exec+0x1a>
+    13a5:	89 e1                	mov    %esp,%ecx
+    13a7:	ba b0 13 00 00       	mov    $0x13b0,%edx
+    13ac:	0f 34                	sysenter
+    13ae:	cd 40                	int    $0x40
+    13b0:	c3                   	ret
+
+000013b1 <open>:
+SYSCALL(open)
+    13b1:	b8 0f 00 00 00       	mov    $0xf,%eax
+    13b6:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    13bd:	00 00 00 
+    13c0:	74 09                	je     13cb <open+0x1a>
+    13c2:	89 e1                	mov    %esp,%ecx
+    13c4:	ba cd 13 00 00       	mov    $0x13cd,%edx
+    13c9:	0f 34                	sysenter
+    13cb:	cd 40                	int    $0x40
+    13cd:	c3                   	ret
+
+000013ce <mknod>:
+SYSCALL(mknod)
+    13ce:	b8 11 00 00 00       	mov    $0x11,%eax
+    13d3:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    13da:	00 00 00 
+    13dd:	74 09                	je     13e8 <mknod+0x1a>
+    13df:	89 e1                	mov    %esp,%ecx
+    13e1:	ba ea 13 00 00       	mov    $0x13ea,%edx
+    13e6:	0f 34                	sysenter
+    13e8:	cd 40                	int    $0x40
+    13ea:	c3                   	ret
+
+000013eb <unlink>:
+SYSCALL(unlink)
+    13eb:	b8 12 00 00 00       	mov    $0x12,%eax
+    13f0:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    13f7:	00 00 00 
+    13fa:	74 09                	je     1405 <unlink+0x1a>
+    13fc:	89 e1                	mov    %esp,%ecx
+    13fe:	ba 07 14 00 00       	mov    $0x1407,%edx
+    1403:	0f 34                	sysenter
+    1405:	cd 40                	int    $0x40
+    1407:	c3                   	ret
+
+00001408 <fstat>:
+SYSCALL(fstat)
+    1408:	b8 08 00 00 00       	mov    $0x8,%eax
+    140d:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    1414:	00 00 00 
+    1417:	74 09                	je     1422 <fstat+0x1a>
+    1419:	89 e1                	mov    %esp,%ecx
+    141b:	ba 24 14 00 00       	mov    $0x1424,%edx
+    1420:	0f 34                	sysenter
+    1422:	cd 40                	int    $0x40
+    1424:	c3                   	ret
+
+00001425 <link>:
+SYSCALL(link)
+    1425:	b8 13 00 00 00       	mov    $0x13,%eax
+    142a:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    1431:	00 00 00 
+    1434:	74 09                	je     143f <link+0x1a>
+    1436:	89 e1                	mov    %esp,%ecx
+    1438:	ba 41 14 00 00       	mov    $0x1441,%edx
+    143d:	0f 34                	sysenter
+    143f:	cd 40                	int    $0x40
+    1441:	c3                   	ret
+
+00001442 <mkdir>:
+SYSCALL(mkdir)
+    1442:	b8 14 00 00 00       	mov    $0x14,%eax
+    1447:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    144e:	00 00 00 
+    1451:	74 09                	je     145c <mkdir+0x1a>
+    1453:	89 e1                	mov    %esp,%ecx
+    1455:	ba 5e 14 00 00       	mov    $0x145e,%edx
+    145a:	0f 34                	sysenter
+    145c:	cd 40                	int    $0x40
+    145e:	c3                   	ret
+
+0000145f <chdir>:
+SYSCALL(chdir)
+    145f:	b8 09 00 00 00       	mov    $0x9,%eax
+    1464:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    146b:	00 00 00 
+    146e:	74 09                	je     1479 <chdir+0x1a>
+    1470:	89 e1                	mov    %esp,%ecx
+    1472:	ba 7b 14 00 00       	mov    $0x147b,%edx
+    1477:	0f 34                	sysenter
+    1479:	cd 40                	int    $0x40
+    147b:	c3                   	ret
+
+0000147c <dup>:
+SYSCALL(dup)
+    147c:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1481:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    1488:	00 00 00 
+    148b:	74 09                	je     1496 <dup+0x1a>
+    148d:	89 e1                	mov    %esp,%ecx
+    148f:	ba 98 14 00 00       	mov    $0x1498,%edx
+    1494:	0f 34                	sysenter
+    1496:	cd 40                	int    $0x40
+    1498:	c3                   	ret
+
+00001499 <getpid>:
+SYSCALL(getpid)
+    1499:	b8 0b 00 00 00       	mov    $0xb,%eax
+    149e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    14a5:	00 00 00 
+    14a8:	74 09                	je     14b3 <getpid+0x1a>
+    14aa:	89 e1                	mov    %esp,%ecx
+    14ac:	ba b5 14 00 00       	mov    $0x14b5,%edx
+    14b1:	0f 34                	sysenter
+    14b3:	cd 40                	int    $0x40
+    14b5:	c3                   	ret
+
+000014b6 <sbrk>:
+SYSCALL(sbrk)
+    14b6:	b8 0c 00 00 00       	mov    $0xc,%eax
+    14bb:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    14c2:	00 00 00 
+    14c5:	74 09                	je     14d0 <sbrk+0x1a>
+    14c7:	89 e1                	mov    %esp,%ecx
+    14c9:	ba d2 14 00 00       	mov    $0x14d2,%edx
+    14ce:	0f 34                	sysenter
+    14d0:	cd 40                	int    $0x40
+    14d2:	c3                   	ret
+
+000014d3 <sleep>:
+SYSCALL(sleep)
+    14d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    14d8:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    14df:	00 00 00 
+    14e2:	74 09                	je     14ed <sleep+0x1a>
+    14e4:	89 e1                	mov    %esp,%ecx
+    14e6:	ba ef 14 00 00       	mov    $0x14ef,%edx
+    14eb:	0f 34                	sysenter
+    14ed:	cd 40                	int    $0x40
+    14ef:	c3                   	ret
+
+000014f0 <uptime>:
+SYSCALL(uptime)
+    14f0:	b8 0e 00 00 00       	mov    $0xe,%eax
+    14f5:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    14fc:	00 00 00 
+    14ff:	74 09                	je     150a <uptime+0x1a>
+    1501:	89 e1                	mov    %esp,%ecx
+    1503:	ba 0c 15 00 00       	mov    $0x150c,%edx
+    1508:	0f 34                	sysenter
+    150a:	cd 40                	int    $0x40
+    150c:	c3                   	ret
+
+0000150d <swapread>:
+SYSCALL(swapread)
+    150d:	b8 16 00 00 00       	mov    $0x16,%eax
+    1512:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    1519:	00 00 00 
+    151c:	74 09                	je     1527 <swapread+0x1a>
+    151e:	89 e1                	mov    %esp,%ecx
+    1520:	ba 29 15 00 00       	mov    $0x1529,%edx
+    1525:	0f 34                	sysenter
+    1527:	cd 40                	int    $0x40
+    1529:	c3                   	ret
+
+0000152a <swapwrite>:
+SYSCALL(swapwrite)
+    152a:	b8 17 00 00 00       	mov    $0x17,%eax
+    152f:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    1536:	00 00 00 
+    1539:	74 09                	je     1544 <swapwrite+0x1a>
+    153b:	89 e1                	mov    %esp,%ecx
+    153d:	ba 46 15 00 00       	mov    $0x1546,%edx
+    1542:	0f 34                	sysenter
+    1544:	cd 40                	int    $0x40
+    1546:	c3                   	ret
+
+00001547 <setaffinity>:
+SYSCALL(setaffinity)
+    1547:	b8 18 00 00 00       	mov    $0x18,%eax
+    154c:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    1553:	00 00 00 
+    1556:	74 09                	je     1561 <setaffinity+0x1a>
+    1558:	89 e1                	mov    %esp,%ecx
+    155a:	ba 63 15 00 00       	mov    $0x1563,%edx
+    155f:	0f 34                	sysenter
+    1561:	cd 40                	int    $0x40
+    1563:	c3                   	ret
+
+00001564 <getaffinity>:
+SYSCALL(getaffinity)
+    1564:	b8 19 00 00 00       	mov    $0x19,%eax
+    1569:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    1570:	00 00 00 
+    1573:	74 09                	je     157e <getaffinity+0x1a>
+    1575:	89 e1                	mov    %esp,%ecx
+    1577:	ba 80 15 00 00       	mov    $0x1580,%edx
+    157c:	0f 34                	sysenter
+    157e:	cd 40                	int    $0x40
+    1580:	c3                   	ret
+
+00001581 <nanosleep>:
+SYSCALL(nanosleep)
+    1581:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1586:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    158d:	00 00 00 
+    1590:	74 09                	je     159b <nanosleep+0x1a>
+    1592:	89 e1                	mov    %esp,%ecx
+    1594:	ba 9d 15 00 00       	mov    $0x159d,%edx
+    1599:	0f 34                	sysenter
+    159b:	cd 40                	int    $0x40
+    159d:	c3                   	ret
+
+0000159e <clocktime>:
+SYSCALL(clocktime)
+    159e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    15a3:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    15aa:	00 00 00 
+    15ad:	74 09                	je     15b8 <clocktime+0x1a>
+    15af:	89 e1                	mov    %esp,%ecx
+    15b1:	ba ba 15 00 00       	mov    $0x15ba,%edx
+    15b6:	0f 34                	sysenter
+    15b8:	cd 40                	int    $0x40
+    15ba:	c3                   	ret
+
+000015bb <batch>:
+SYSCALL(batch)
+    15bb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    15c0:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    15c7:	00 00 00 
+    15ca:	74 09                	je     15d5 <batch+0x1a>
+    15cc:	89 e1                	mov    %esp,%ecx
+    15ce:	ba d7 15 00 00       	mov    $0x15d7,%edx
+    15d3:	0f 34                	sysenter
+    15d5:	cd 40                	int    $0x40
+    15d7:	c3                   	ret
+
+000015d8 <aiosetup>:
+SYSCALL(aiosetup)
+    15d8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    15dd:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    15e4:	00 00 00 
+    15e7:	74 09                	je     15f2 <aiosetup+0x1a>
+    15e9:	89 e1                	mov    %esp,%ecx
+    15eb:	ba f4 15 00 00       	mov    $0x15f4,%edx
+    15f0:	0f 34                	sysenter
+    15f2:	cd 40                	int    $0x40
+    15f4:	c3                   	ret
+
+000015f5 <aiowait>:
+SYSCALL(aiowait)
+    15f5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    15fa:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    1601:	00 00 00 
+    1604:	74 09                	je     160f <aiowait+0x1a>
+    1606:	89 e1                	mov    %esp,%ecx
+    1608:	ba 11 16 00 00       	mov    $0x1611,%edx
+    160d:	0f 34                	sysenter
+    160f:	cd 40                	int    $0x40
+    1611:	c3                   	ret
+
+00001612 <spawn>:
+SYSCALL(spawn)
+    1612:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1617:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    161e:	00 00 00 
+    1621:	74 09                	je     162c <spawn+0x1a>
+    1623:	89 e1                	mov    %esp,%ecx
+    1625:	ba 2e 16 00 00       	mov    $0x162e,%edx
+    162a:	0f 34                	sysenter
+    162c:	cd 40                	int    $0x40
+    162e:	c3                   	ret
+
+0000162f <getprocinfo>:
+SYSCALL(getprocinfo)
+    162f:	b8 20 00 00 00       	mov    $0x20,%eax
+    1634:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    163b:	00 00 00 
+    163e:	74 09                	je     1649 <getprocinfo+0x1a>
+    1640:	89 e1                	mov    %esp,%ecx
+    1642:	ba 4b 16 00 00       	mov    $0x164b,%edx
+    1647:	0f 34                	sysenter
+    1649:	cd 40                	int    $0x40
+    164b:	c3                   	ret
+
+0000164c <getlockstat>:
+SYSCALL(getlockstat)
+    164c:	b8 21 00 00 00       	mov    $0x21,%eax
+    1651:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    1658:	00 00 00 
+    165b:	74 09                	je     1666 <getlockstat+0x1a>
+    165d:	89 e1                	mov    %esp,%ecx
+    165f:	ba 68 16 00 00       	mov    $0x1668,%edx
+    1664:	0f 34                	sysenter
+    1666:	cd 40                	int    $0x40
+    1668:	c3                   	ret
+
+00001669 <lockprof>:
+SYSCALL(lockprof)
+    1669:	b8 22 00 00 00       	mov    $0x22,%eax
+    166e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    1675:	00 00 00 
+    1678:	74 09                	je     1683 <lockprof+0x1a>
+    167a:	89 e1                	mov    %esp,%ecx
+    167c:	ba 85 16 00 00       	mov    $0x1685,%edx
+    1681:	0f 34                	sysenter
+    1683:	cd 40                	int    $0x40
+    1685:	c3                   	ret
+
+00001686 <getlockprof>:
+SYSCALL(getlockprof)
+    1686:	b8 23 00 00 00       	mov    $0x23,%eax
+    168b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    1692:	00 00 00 
+    1695:	74 09                	je     16a0 <getlockprof+0x1a>
+    1697:	89 e1                	mov    %esp,%ecx
+    1699:	ba a2 16 00 00       	mov    $0x16a2,%edx
+    169e:	0f 34                	sysenter
+    16a0:	cd 40                	int    $0x40
+    16a2:	c3                   	ret
+
+000016a3 <diskstat>:
+SYSCALL(diskstat)
+    16a3:	b8 24 00 00 00       	mov    $0x24,%eax
+    16a8:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    16af:	00 00 00 
+    16b2:	74 09                	je     16bd <diskstat+0x1a>
+    16b4:	89 e1                	mov    %esp,%ecx
+    16b6:	ba bf 16 00 00       	mov    $0x16bf,%edx
+    16bb:	0f 34                	sysenter
+    16bd:	cd 40                	int    $0x40
+    16bf:	c3                   	ret
+
+000016c0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    16c0:	55                   	push   %ebp
+    16c1:	89 e5                	mov    %esp,%ebp
+    16c3:	57                   	push   %edi
+    16c4:	56                   	push   %esi
+    16c5:	53                   	push   %ebx
+    16c6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    16c8:	89 d1                	mov    %edx,%ecx
+{
+    16ca:	83 ec 3c             	sub    $0x3c,%esp
+    16cd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    16d0:	85 d2                	test   %edx,%edx
+    16d2:	0f 89 80 00 00 00    	jns    1758 <printint+0x98>
+    16d8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    16dc:	74 7a                	je     1758 <printint+0x98>
+    x = -xx;
+    16de:	f7 d9                	neg    %ecx
+    neg = 1;
+    16e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    16e5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    16e8:	31 f6                	xor    %esi,%esi
+    16ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    16f0:	89 c8                	mov    %ecx,%eax
+    16f2:	31 d2                	xor    %edx,%edx
+    16f4:	89 f7                	mov    %esi,%edi
+    16f6:	f7 f3                	div    %ebx
+    16f8:	8d 76 01             	lea    0x1(%esi),%esi
+    16fb:	0f b6 92 d8 1b 00 00 	movzbl 0x1bd8(%edx),%edx
+    1702:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1706:	89 ca                	mov    %ecx,%edx
+    1708:	89 c1                	mov    %eax,%ecx
+    170a:	39 da                	cmp    %ebx,%edx
+    170c:	73 e2                	jae    16f0 <printint+0x30>
+  if(neg)
+    170e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1711:	85 c0                	test   %eax,%eax
+    1713:	74 07                	je     171c <printint+0x5c>
+    buf[i++] = '-';
+    1715:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    171a:	89 f7                	mov    %esi,%edi
+    171c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    171f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1722:	01 df                	add    %ebx,%edi
+    1724:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1728:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    172b:	83 ec 04             	sub    $0x4,%esp
+    172e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1731:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1734:	6a 01                	push   $0x1
+    1736:	50                   	push   %eax
+    1737:	56                   	push   %esi
+    1738:	e8 00 fc ff ff       	call   133d <write>
+  while(--i >= 0)
+    173d:	89 f8                	mov    %edi,%eax
+    173f:	83 c4 10             	add    $0x10,%esp
+    1742:	83 ef 01             	sub    $0x1,%edi
+    1745:	39 d8                	cmp    %ebx,%eax
+    1747:	75 df                	jne    1728 <printint+0x68>
+}
+    1749:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    174c:	5b                   	pop    %ebx
+    174d:	5e                   	pop    %esi
+    174e:	5f                   	pop    %edi
+    174f:	5d                   	pop    %ebp
+    1750:	c3                   	ret
+    1751:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1758:	31 c0                	xor    %eax,%eax
+    175a:	eb 89                	jmp    16e5 <printint+0x25>
+    175c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001760 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1760:	55                   	push   %ebp
+    1761:	89 e5                	mov    %esp,%ebp
+    1763:	57                   	push   %edi
+    1764:	56                   	push   %esi
+    1765:	53                   	push   %ebx
+    1766:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1769:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    176c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    176f:	0f b6 1e             	movzbl (%esi),%ebx
+    1772:	83 c6 01             	add    $0x1,%esi
+    1775:	84 db                	test   %bl,%bl
+    1777:	74 67                	je     17e0 <printf+0x80>
+    1779:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    177c:	31 d2                	xor    %edx,%edx
+    177e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1781:	eb 34                	jmp    17b7 <printf+0x57>
+    1783:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1787:	90                   	nop
+    1788:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    178b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1790:	83 f8 25             	cmp    $0x25,%eax
+    1793:	74 18                	je     17ad <printf+0x4d>
+  write(fd, &c, 1);
+    1795:	83 ec 04             	sub    $0x4,%esp
+    1798:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    179b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    179e:	6a 01                	push   $0x1
+    17a0:	50                   	push   %eax
+    17a1:	57                   	push   %edi
+    17a2:	e8 96 fb ff ff       	call   133d <write>
+    17a7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    17aa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    17ad:	0f b6 1e             	movzbl (%esi),%ebx
+    17b0:	83 c6 01             	add    $0x1,%esi
+    17b3:	84 db                	test   %bl,%bl
+    17b5:	74 29                	je     17e0 <printf+0x80>
+    c = fmt[i] & 0xff;
+    17b7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    17ba:	85 d2                	test   %edx,%edx
+    17bc:	74 ca                	je     1788 <printf+0x28>
+      }
+    } else if(state == '%'){
+    17be:	83 fa 25             	cmp    $0x25,%edx
+    17c1:	75 ea                	jne    17ad <printf+0x4d>
+      if(c == 'd'){
+    17c3:	83 f8 25             	cmp    $0x25,%eax
+    17c6:	0f 84 24 01 00 00    	je     18f0 <printf+0x190>
+    17cc:	83 e8 63             	sub    $0x63,%eax
+    17cf:	83 f8 15             	cmp    $0x15,%eax
+    17d2:	77 1c                	ja     17f0 <printf+0x90>
+    17d4:	ff 24 85 80 1b 00 00 	jmp    *0x1b80(,%eax,4)
+    17db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    17df:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    17e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    17e3:	5b                   	pop    %ebx
+    17e4:	5e                   	pop    %esi
+    17e5:	5f                   	pop    %edi
+    17e6:	5d                   	pop    %ebp
+    17e7:	c3                   	ret
+    17e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    17ef:	90                   	nop
+  write(fd, &c, 1);
+    17f0:	83 ec 04             	sub    $0x4,%esp
+    17f3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    17f6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    17fa:	6a 01                	push   $0x1
+    17fc:	52                   	push   %edx
+    17fd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1800:	57                   	push   %edi
+    1801:	e8 37 fb ff ff       	call   133d <write>
+    1806:	83 c4 0c             	add    $0xc,%esp
+    1809:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    180c:	6a 01                	push   $0x1
+    180e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1811:	52                   	push   %edx
+    1812:	57                   	push   %edi
+    1813:	e8 25 fb ff ff       	call   133d <write>
+        putc(fd, c);
+    1818:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    181b:	31 d2                	xor    %edx,%edx
+    181d:	eb 8e                	jmp    17ad <printf+0x4d>
+    181f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    1820:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1823:	83 ec 0c             	sub    $0xc,%esp
+    1826:	b9 10 00 00 00       	mov    $0x10,%ecx
+    182b:	8b 13                	mov    (%ebx),%edx
+    182d:	6a 00                	push   $0x0
+    182f:	89 f8                	mov    %edi,%eax
+        ap++;
+    1831:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    1834:	e8 87 fe ff ff       	call   16c0 <printint>
+        ap++;
+    1839:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    183c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    183f:	31 d2                	xor    %edx,%edx
+    1841:	e9 67 ff ff ff       	jmp    17ad <printf+0x4d>
+    1846:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    184d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1850:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1853:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1855:	83 c0 04             	add    $0x4,%eax
+    1858:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    185b:	85 db                	test   %ebx,%ebx
+    185d:	0f 84 9d 00 00 00    	je     1900 <printf+0x1a0>
+        while(*s != 0){
+    1863:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1866:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1868:	84 c0                	test   %al,%al
+    186a:	0f 84 3d ff ff ff    	je     17ad <printf+0x4d>
+    1870:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1873:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1876:	89 de                	mov    %ebx,%esi
+    1878:	89 d3                	mov    %edx,%ebx
+    187a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1880:	83 ec 04             	sub    $0x4,%esp
+    1883:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1886:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1889:	6a 01                	push   $0x1
+    188b:	53                   	push   %ebx
+    188c:	57                   	push   %edi
+    188d:	e8 ab fa ff ff       	call   133d <write>
+        while(*s != 0){
+    1892:	0f b6 06             	movzbl (%esi),%eax
+    1895:	83 c4 10             	add    $0x10,%esp
+    1898:	84 c0                	test   %al,%al
+    189a:	75 e4                	jne    1880 <printf+0x120>
+      state = 0;
+    189c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    189f:	31 d2                	xor    %edx,%edx
+    18a1:	e9 07 ff ff ff       	jmp    17ad <printf+0x4d>
+    18a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18ad:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    18b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    18b3:	83 ec 0c             	sub    $0xc,%esp
+    18b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    18bb:	8b 13                	mov    (%ebx),%edx
+    18bd:	6a 01                	push   $0x1
+    18bf:	e9 6b ff ff ff       	jmp    182f <printf+0xcf>
+    18c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    18c8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    18cb:	83 ec 04             	sub    $0x4,%esp
+    18ce:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    18d1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    18d3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    18d6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    18d9:	6a 01                	push   $0x1
+    18db:	52                   	push   %edx
+    18dc:	57                   	push   %edi
+    18dd:	e8 5b fa ff ff       	call   133d <write>
+        ap++;
+    18e2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    18e5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    18e8:	31 d2                	xor    %edx,%edx
+    18ea:	e9 be fe ff ff       	jmp    17ad <printf+0x4d>
+    18ef:	90                   	nop
+  write(fd, &c, 1);
+    18f0:	83 ec 04             	sub    $0x4,%esp
+    18f3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    18f6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    18f9:	6a 01                	push   $0x1
+    18fb:	e9 11 ff ff ff       	jmp    1811 <printf+0xb1>
+    1900:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1905:	bb 78 1b 00 00       	mov    $0x1b78,%ebx
+    190a:	e9 61 ff ff ff       	jmp    1870 <printf+0x110>
+    190f:	90                   	nop
+
+00001910 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1910:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1911:	a1 64 23 00 00       	mov    0x2364,%eax
+{
+    1916:	89 e5                	mov    %esp,%ebp
+    1918:	57                   	push   %edi
+    1919:	56                   	push   %esi
+    191a:	53                   	push   %ebx
+    191b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    191e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1921:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1928:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    192a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    192c:	39 ca                	cmp    %ecx,%edx
+    192e:	73 30                	jae    1960 <free+0x50>
+    1930:	39 c1                	cmp    %eax,%ecx
+    1932:	72 04                	jb     1938 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1934:	39 c2                	cmp    %eax,%edx
+    1936:	72 f0                	jb     1928 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1938:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    193b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    193e:	39 f8                	cmp    %edi,%eax
+    1940:	74 2e                	je     1970 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1942:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1945:	8b 42 04             	mov    0x4(%edx),%eax
+    1948:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    194b:	39 f1                	cmp    %esi,%ecx
+    194d:	74 38                	je     1987 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    194f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1951:	5b                   	pop    %ebx
+  freep = p;
+    1952:	89 15 64 23 00 00    	mov    %edx,0x2364
+}
+    1958:	5e                   	pop    %esi
+    1959:	5f                   	pop    %edi
+    195a:	5d                   	pop    %ebp
+    195b:	c3                   	ret
+    195c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1960:	39 c1                	cmp    %eax,%ecx
+    1962:	72 d0                	jb     1934 <free+0x24>
+    1964:	eb c2                	jmp    1928 <free+0x18>
+    1966:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    196d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1970:	03 70 04             	add    0x4(%eax),%esi
+    1973:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1976:	8b 02                	mov    (%edx),%eax
+    1978:	8b 00                	mov    (%eax),%eax
+    197a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    197d:	8b 42 04             	mov    0x4(%edx),%eax
+    1980:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1983:	39 f1                	cmp    %esi,%ecx
+    1985:	75 c8                	jne    194f <free+0x3f>
+    p->s.size += bp->s.size;
+    1987:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    198a:	89 15 64 23 00 00    	mov    %edx,0x2364
+    p->s.size += bp->s.size;
+    1990:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1993:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1996:	89 0a                	mov    %ecx,(%edx)
+}
+    1998:	5b                   	pop    %ebx
+    1999:	5e                   	pop    %esi
+    199a:	5f                   	pop    %edi
+    199b:	5d                   	pop    %ebp
+    199c:	c3                   	ret
+    199d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000019a0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    19a0:	55                   	push   %ebp
+    19a1:	89 e5                	mov    %esp,%ebp
+    19a3:	57                   	push   %edi
+    19a4:	56                   	push   %esi
+    19a5:	53                   	push   %ebx
+    19a6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    19a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    19ac:	8b 15 64 23 00 00    	mov    0x2364,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    19b2:	8d 78 07             	lea    0x7(%eax),%edi
+    19b5:	c1 ef 03             	shr    $0x3,%edi
+    19b8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    19bb:	85 d2                	test   %edx,%edx
+    19bd:	0f 84 8d 00 00 00    	je     1a50 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    19c3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    19c5:	8b 48 04             	mov    0x4(%eax),%ecx
+    19c8:	39 f9                	cmp    %edi,%ecx
+    19ca:	73 64                	jae    1a30 <malloc+0x90>
+  if(nu < 4096)
+    19cc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    19d1:	39 df                	cmp    %ebx,%edi
+    19d3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    19d6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    19dd:	eb 0a                	jmp    19e9 <malloc+0x49>
+    19df:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    19e0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    19e2:	8b 48 04             	mov    0x4(%eax),%ecx
+    19e5:	39 f9                	cmp    %edi,%ecx
+    19e7:	73 47                	jae    1a30 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    19e9:	89 c2                	mov    %eax,%edx
+    19eb:	39 05 64 23 00 00    	cmp    %eax,0x2364
+    19f1:	75 ed                	jne    19e0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    19f3:	83 ec 0c             	sub    $0xc,%esp
+    19f6:	56                   	push   %esi
+    19f7:	e8 ba fa ff ff       	call   14b6 <sbrk>
+  if(p == (char*)-1)
+    19fc:	83 c4 10             	add    $0x10,%esp
+    19ff:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1a02:	74 1c                	je     1a20 <malloc+0x80>
+  hp->s.size = nu;
+    1a04:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1a07:	83 ec 0c             	sub    $0xc,%esp
+    1a0a:	83 c0 08             	add    $0x8,%eax
+    1a0d:	50                   	push   %eax
+    1a0e:	e8 fd fe ff ff       	call   1910 <free>
+  return freep;
+    1a13:	8b 15 64 23 00 00    	mov    0x2364,%edx
+      if((p = morecore(nunits)) == 0)
+    1a19:	83 c4 10             	add    $0x10,%esp
+    1a1c:	85 d2                	test   %edx,%edx
+    1a1e:	75 c0                	jne    19e0 <malloc+0x40>
+        return 0;
+  }
+}
+    1a20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1a23:	31 c0                	xor    %eax,%eax
+}
+    1a25:	5b                   	pop    %ebx
+    1a26:	5e                   	pop    %esi
+    1a27:	5f                   	pop    %edi
+    1a28:	5d                   	pop    %ebp
+    1a29:	c3                   	ret
+    1a2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1a30:	39 cf                	cmp    %ecx,%edi
+    1a32:	74 4c                	je     1a80 <malloc+0xe0>
+        p->s.size -= nunits;
+    1a34:	29 f9                	sub    %edi,%ecx
+    1a36:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1a39:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    1a3c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    1a3f:	89 15 64 23 00 00    	mov    %edx,0x2364
+}
+    1a45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1a48:	83 c0 08             	add    $0x8,%eax
+}
+    1a4b:	5b                   	pop    %ebx
+    1a4c:	5e                   	pop    %esi
+    1a4d:	5f                   	pop    %edi
+    1a4e:	5d                   	pop    %ebp
+    1a4f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1a50:	c7 05 64 23 00 00 68 	movl   $0x2368,0x2364
+    1a57:	23 00 00 
+    base.s.size = 0;
+    1a5a:	b8 68 23 00 00       	mov    $0x2368,%eax
+    base.s.ptr = freep = prevp = &base;
+    1a5f:	c7 05 68 23 00 00 68 	movl   $0x2368,0x2368
+    1a66:	23 00 00 
+    base.s.size = 0;
+    1a69:	c7 05 6c 23 00 00 00 	movl   $0x0,0x236c
+    1a70:	00 00 00 
+    if(p->s.size >= nunits){
+    1a73:	e9 54 ff ff ff       	jmp    19cc <malloc+0x2c>
+    1a78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1a7f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1a80:	8b 08                	mov    (%eax),%ecx
+    1a82:	89 0a                	mov    %ecx,(%edx)
+    1a84:	eb b9                	jmp    1a3f <malloc+0x9f>
@@ -51,7 +51,9 @@ struct backcmd {
 
 int fork1(void);  // Fork but panics on failure.
 void panic(char*);
+void syntax(char*);
 struct cmd *parsecmd(char*);
+int badsyntax;    // Set by syntax() while parsing a command.
 
 // Execute cmd.  Never returns.
 void
@@ -130,6 +132,102 @@ runcmd(struct cmd *cmd)
   exit();
 }
 
+// Can cmd be started with spawn() instead of fork()?  Plain
+// commands, their redirections of fds 0-2 and pipelines of
+// those can; lists, background jobs and blocks need a shell.
+int
+canspawn(struct cmd *cmd)
+{
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  switch(cmd->type){
+  case EXEC:
+    return ((struct execcmd*)cmd)->argv[0] != 0;
+  case REDIR:
+    rcmd = (struct redircmd*)cmd;
+    return rcmd->fd <= 2 && canspawn(rcmd->cmd);
+  case PIPE:
+    pcmd = (struct pipecmd*)cmd;
+    return canspawn(pcmd->left) && canspawn(pcmd->right);
+  }
+  return 0;
+}
+
+// Start cmd, which must pass canspawn(), with its fds 0-2
+// taken from fd[].  Returns the number of processes started.
+int
+spawncmd(struct cmd *cmd, int *fd)
+{
+  int n, f, p[2], map[3];
+  struct execcmd *ecmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  switch(cmd->type){
+  case EXEC:
+    ecmd = (struct execcmd*)cmd;
+    if(spawn(ecmd->argv[0], ecmd->argv, fd, 3) < 0){
+      printf(2, "exec %s failed\n", ecmd->argv[0]);
+      return 0;
+    }
+    return 1;
+
+  case REDIR:
+    rcmd = (struct redircmd*)cmd;
+    if((f = open(rcmd->file, rcmd->mode)) < 0){
+      printf(2, "open %s failed\n", rcmd->file);
+      return 0;
+    }
+    memmove(map, fd, sizeof(map));
+    map[rcmd->fd] = f;
+    n = spawncmd(rcmd->cmd, map);
+    close(f);
+    return n;
+
+  case PIPE:
+    pcmd = (struct pipecmd*)cmd;
+    if(pipe(p) < 0)
+      panic("pipe");
+    map[0] = fd[0];
+    map[1] = p[1];
+    map[2] = fd[2];
+    n = spawncmd(pcmd->left, map);
+    map[0] = p[0];
+    map[1] = fd[1];
+    n += spawncmd(pcmd->right, map);
+    close(p[0]);
+    close(p[1]);
+    return n;
+  }
+  panic("spawncmd");
+  return 0;
+}
+
+void
+freecmd(struct cmd *cmd)
+{
+  if(cmd == 0)
+    return;
+  switch(cmd->type){
+  case REDIR:
+    freecmd(((struct redircmd*)cmd)->cmd);
+    break;
+  case PIPE:
+    freecmd(((struct pipecmd*)cmd)->left);
+    freecmd(((struct pipecmd*)cmd)->right);
+    break;
+  case LIST:
+    freecmd(((struct listcmd*)cmd)->left);
+    freecmd(((struct listcmd*)cmd)->right);
+    break;
+  case BACK:
+    freecmd(((struct backcmd*)cmd)->cmd);
+    break;
+  }
+  free(cmd);
+}
+
 int
 getcmd(char *buf, int nbuf)
 {
@@ -145,7 +243,9 @@ int
 main(void)
 {
   static char buf[100];
-  int fd;
+  static int stdfd[3] = { 0, 1, 2 };
+  struct cmd *cmd;
+  int fd, n;
 
   // Ensure that three file descriptors are open.
   while((fd = open("console", O_RDWR)) >= 0){
@@ -164,9 +264,23 @@ main(void)
         printf(2, "cannot cd %s\n", buf+3);
       continue;
     }
-    if(fork1() == 0)
-      runcmd(parsecmd(buf));
-    wait();
+    // Parse here rather than in a child, so that simple
+    // commands can be spawned without copying the shell.
+    badsyntax = 0;
+    cmd = parsecmd(buf);
+    if(badsyntax){
+      freecmd(cmd);
+      continue;
+    }
+    if(canspawn(cmd)){
+      for(n = spawncmd(cmd, stdfd); n > 0; n--)
+        wait();
+    } else {
+      if(fork1() == 0)
+        runcmd(cmd);
+      wait();
+    }
+    freecmd(cmd);
   }
   exit();
 }
@@ -178,6 +292,16 @@ panic(char *s)
   exit();
 }
 
+// Report a syntax error.  The parser carries on, so that
+// the shell need not exit, and main() drops the command.
+void
+syntax(char *s)
+{
+  if(!badsyntax)
+    printf(2, "%s\n", s);
+  badsyntax = 1;
+}
+
 int
 fork1(void)
 {
@@ -333,9 +457,9 @@ parsecmd(char *s)
   es = s + strlen(s);
   cmd = parseline(&s, es);
   peek(&s, es, "");
-  if(s != es){
+  if(s != es && !badsyntax){
     printf(2, "leftovers: %s\n", s);
-    panic("syntax");
+    syntax("syntax");
   }
   nulterminate(cmd);
   return cmd;
@@ -379,8 +503,10 @@ parseredirs(struct cmd *cmd, char **ps, char *es)
 
   while(peek(ps, es, "<>")){
     tok = gettoken(ps, es, 0, 0);
-    if(gettoken(ps, es, &q, &eq) != 'a')
-      panic("missing file for redirection");
+    if(gettoken(ps, es, &q, &eq) != 'a'){
+      syntax("missing file for redirection");
+      break;
+    }
     switch(tok){
     case '<':
       cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
@@ -405,8 +531,10 @@ parseblock(char **ps, char *es)
     panic("parseblock");
   gettoken(ps, es, 0, 0);
   cmd = parseline(ps, es);
-  if(!peek(ps, es, ")"))
-    panic("syntax - missing )");
+  if(!peek(ps, es, ")")){
+    syntax("syntax - missing )");
+    return cmd;
+  }
   gettoken(ps, es, 0, 0);
   cmd = parseredirs(cmd, ps, es);
   return cmd;
@@ -431,13 +559,17 @@ parseexec(char **ps, char *es)
   while(!peek(ps, es, "|)&;")){
     if((tok=gettoken(ps, es, &q, &eq)) == 0)
       break;
-    if(tok != 'a')
-      panic("syntax");
+    if(tok != 'a'){
+      syntax("syntax");
+      break;
+    }
+    if(argc >= MAXARGS-1){
+      syntax("too many args");
+      break;
+    }
     cmd->argv[argc] = q;
     cmd->eargv[argc] = eq;
     argc++;
-    if(argc >= MAXARGS)
-      panic("too many args");
     ret = parseredirs(ret, ps, es);
   }
   cmd->argv[argc] = 0;
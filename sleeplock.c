@@ -1,4 +1,19 @@
 // Sleeping locks
+//
+// A sleep lock can be held exclusively by one process, or
+// shared by any number of processes that only read what it
+// protects.
+//
+// A process that finds the lock held spins for a while first
+// if the holder is running on another CPU, since it will
+// probably release the lock before a sleep and wakeup could
+// finish.  Otherwise it queues up and sleeps.  releasesleep()
+// hands the lock straight to the oldest waiter and wakes only
+// that one, so waiters get the lock in order and the others
+// stay asleep.  A waiter for shared mode is handed the lock
+// along with any shared waiters queued right behind it.  New
+// shared holders queue behind a waiting exclusive one, so a
+// stream of readers cannot starve a writer.
 
 #include "types.h"
 #include "defs.h"
@@ -10,34 +25,140 @@
 #include "spinlock.h"
 #include "sleeplock.h"
 
+#define MAXSPIN 10000  // pause()s to spin before sleeping
+
+// Values of proc.slwait.
+#define SHARED 1
+#define EXCL   2
+
 void
 initsleeplock(struct sleeplock *lk, char *name)
 {
   initlock(&lk->lk, "sleep lock");
   lk->name = name;
   lk->locked = 0;
+  lk->nshared = 0;
+  lk->owner = 0;
+  lk->head = 0;
   lk->pid = 0;
 }
 
+// Wait, without holding lk->lk, while the lock is held
+// by another process that is running.  Process descriptors
+// are recycled but never freed, so a stale owner is safe to read.
+static void
+spinsleep(struct sleeplock *lk)
+{
+  struct proc *o;
+  int i;
+
+  for(i = 0; i < MAXSPIN; i++){
+    o = *(struct proc * volatile *)&lk->owner;
+    if(o == 0 || o == myproc() || o->state != RUNNING)
+      break;
+    pause();
+  }
+}
+
+// Join the queue of waiters for mode and sleep until
+// handoff() grants it.  Caller must hold lk->lk.
+static void
+waitsleep(struct sleeplock *lk, int mode)
+{
+  struct proc *p = myproc();
+
+  p->slwait = mode;
+  p->slnext = 0;
+  if(lk->head)
+    lk->tail->slnext = p;
+  else
+    lk->head = p;
+  lk->tail = p;
+  while(p->slwait)
+    sleep(lk, &lk->lk);
+}
+
+// Grant the lock to the waiters at the head of the queue
+// that can now have it.  Caller must hold lk->lk.
+static void
+handoff(struct sleeplock *lk)
+{
+  struct proc *p;
+
+  while(!lk->locked && (p = lk->head) != 0){
+    if(p->slwait == EXCL){
+      if(lk->nshared)
+        break;
+      lk->locked = 1;
+      lk->owner = p;
+      lk->pid = p->pid;
+    } else
+      lk->nshared++;
+    lk->head = p->slnext;
+    p->slwait = 0;
+    wakeproc(p, lk);
+  }
+}
+
 void
 acquiresleep(struct sleeplock *lk)
 {
+  struct proc *p = myproc();
+
+  spinsleep(lk);
   acquire(&lk->lk);
-  while (lk->locked) {
-    sleep(lk, &lk->lk);
+  if(lk->locked || lk->nshared || lk->head)
+    waitsleep(lk, EXCL);
+  else {
+    lk->locked = 1;
+    lk->owner = p;
+    lk->pid = p->pid;
   }
-  lk->locked = 1;
-  lk->pid = myproc()->pid;
   release(&lk->lk);
 }
 
+// Acquire lk shared with other readers.
+void
+acquiresleepshared(struct sleeplock *lk)
+{
+  spinsleep(lk);
+  acquire(&lk->lk);
+  if(lk->locked || lk->head)
+    waitsleep(lk, SHARED);
+  else
+    lk->nshared++;
+  release(&lk->lk);
+}
+
+// Release lk, held in either mode.
 void
 releasesleep(struct sleeplock *lk)
 {
   acquire(&lk->lk);
-  lk->locked = 0;
-  lk->pid = 0;
-  wakeup(lk);
+  if(lk->locked){
+    lk->locked = 0;
+    lk->owner = 0;
+    lk->pid = 0;
+  } else if(lk->nshared > 0)
+    lk->nshared--;
+  else
+    panic("releasesleep");
+  handoff(lk);
+  release(&lk->lk);
+}
+
+// Stop recording the current process as lk's owner, for a
+// lock that something else (an interrupt) will release, so
+// that nobody spins waiting for this process to release it.
+// Does nothing if lk has already changed hands.
+void
+disownsleep(struct sleeplock *lk)
+{
+  acquire(&lk->lk);
+  if(lk->locked && lk->owner == myproc()){
+    lk->owner = 0;
+    lk->pid = 0;
+  }
   release(&lk->lk);
 }
 
@@ -47,7 +168,20 @@ holdingsleep(struct sleeplock *lk)
   int r;
   
   acquire(&lk->lk);
-  r = lk->locked && (lk->pid == myproc()->pid);
+  r = lk->locked && (lk->owner == myproc());
+  release(&lk->lk);
+  return r;
+}
+
+// Is lk held exclusively by this process, or shared
+// by anyone?  Shared holders are not recorded.
+int
+lockedsleep(struct sleeplock *lk)
+{
+  int r;
+
+  acquire(&lk->lk);
+  r = lk->nshared > 0 || (lk->locked && lk->owner == myproc());
   release(&lk->lk);
   return r;
 }
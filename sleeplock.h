@@ -1,7 +1,11 @@
 // Long-term locks for processes
 struct sleeplock {
-  uint locked;       // Is the lock held?
+  uint locked;       // Is the lock held exclusively?
+  int nshared;       // Number of processes holding it shared
   struct spinlock lk; // spinlock protecting this sleep lock
+  struct proc *owner; // Process holding lock
+  struct proc *head;  // Processes waiting for it, oldest first,
+  struct proc *tail;  //   linked by slnext
   
   // For debugging:
   char *name;        // Name of lock.
@@ -1,4 +1,23 @@
 // Mutual exclusion spin locks.
+//
+// Each lock is a ticket lock.  acquire() takes the next ticket
+// with one atomic add and then spins, only reading, until the
+// lock's owner field reaches that ticket; release() advances
+// owner.  Waiting CPUs therefore get the lock in arrival order,
+// and the lock's cache line moves once per hand-off instead of
+// on every spin.
+//
+// acquire() also counts acquisitions, contended acquisitions
+// and the TSC cycles spent waiting, in the lock itself, so that
+// locks that share a name (the buffer cache's bucket locks, say)
+// do not share a cache line of counters.  getlockstat() sums
+// them over the live locks of each name.  A lock in memory that
+// is about to be freed must be passed to freelock(), which adds
+// its counts to its name's totals and forgets it.
+//
+// While lockprof() is on, acquire() and release() also time
+// each wait and hold, and add them to log2 histograms kept
+// both per lock name and per call site of acquire().
 
 #include "types.h"
 #include "defs.h"
@@ -8,13 +27,166 @@
 #include "mmu.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "lockstat.h"
+
+struct {
+  uint busy;         // Guards the rest
+  int n;
+  struct lockstat stat[NLOCKSTAT];     // Totals of freed locks
+  struct spinlock *locks[NLOCKSTAT];  // Live locks, by statnext
+} locktab;
+
+// Lock the table.  initlock() runs before mycpu() works, and
+// never from an interrupt handler, so a bare xchg loop with
+// interrupts off guards the table.  Returns the old eflags.
+static uint
+locktablock(void)
+{
+  uint eflags;
+
+  eflags = readeflags();
+  cli();
+  while(xchg(&locktab.busy, 1) != 0)
+    ;
+  return eflags;
+}
+
+static void
+locktabunlock(uint eflags)
+{
+  xchg(&locktab.busy, 0);
+  if(eflags & FL_IF)
+    sti();
+}
+
+// Find or make the statistics entry for locks called name.
+// Returns -1 if the table is full.  Caller must hold the table.
+static int
+lockstatfor(char *name)
+{
+  int i;
+
+  for(i = 0; i < locktab.n; i++)
+    if(strncmp(locktab.stat[i].name, name, sizeof(locktab.stat[i].name)) == 0)
+      return i;
+  if(locktab.n == NLOCKSTAT)
+    return -1;
+  safestrcpy(locktab.stat[i].name, name, sizeof(locktab.stat[i].name));
+  locktab.n++;
+  return i;
+}
 
 void
 initlock(struct spinlock *lk, char *name)
 {
+  uint eflags;
+  int i;
+
   lk->name = name;
-  lk->locked = 0;
+  lk->next = 0;
+  lk->owner = 0;
   lk->cpu = 0;
+  lk->nacquire = 0;
+  lk->ncontend = 0;
+  lk->spin = 0;
+  lk->stat = 0;
+  lk->tacquire = 0;
+
+  eflags = locktablock();
+  if((i = lockstatfor(name)) >= 0){
+    lk->stat = &locktab.stat[i];
+    lk->stat->nlock++;
+    lk->statprev = 0;
+    lk->statnext = locktab.locks[i];
+    if(lk->statnext)
+      lk->statnext->statprev = lk;
+    locktab.locks[i] = lk;
+  }
+  locktabunlock(eflags);
+}
+
+// Forget lk, whose memory is about to be freed,
+// keeping its counts in its name's totals.
+void
+freelock(struct spinlock *lk)
+{
+  struct lockstat *st;
+  uint eflags;
+
+  if((st = lk->stat) == 0)
+    return;
+  eflags = locktablock();
+  st->nlock--;
+  st->nacquire += lk->nacquire;
+  st->ncontend += lk->ncontend;
+  st->spin += lk->spin;
+  if(lk->statprev)
+    lk->statprev->statnext = lk->statnext;
+  else
+    locktab.locks[st - locktab.stat] = lk->statnext;
+  if(lk->statnext)
+    lk->statnext->statprev = lk->statprev;
+  lk->stat = 0;
+  locktabunlock(eflags);
+}
+
+int lockprofon;    // Is lockprof() on?
+
+// Call sites of acquire(), hashed by pc and never removed
+// while profiling.  A free slot is claimed by setting its pc
+// to CLAIMED, and published by setting the real pc once the
+// name is written, so nobody compares a half-written name.
+struct locksite locksite[NLOCKSITE];
+
+#define CLAIMED 1  // never a return address
+
+// Find or make the entry for acquires of the lock
+// called name from pc.  Returns 0 if the table is full.
+static struct locksite*
+locksitefor(uint pc, char *name)
+{
+  struct locksite *s;
+  int i, h;
+
+  h = (pc >> 2) % NLOCKSITE;
+  for(i = 0; i < NLOCKSITE; i++){
+    s = &locksite[(h + i) % NLOCKSITE];
+    if(s->pc == 0 && cmpxchg(&s->pc, 0, CLAIMED) == 0){
+      safestrcpy(s->name, name, sizeof(s->name));
+      __sync_synchronize();
+      s->pc = pc;
+      return s;
+    }
+    while(*(volatile uint*)&s->pc == CLAIMED)
+      pause();
+    if(s->pc == pc && strncmp(s->name, name, sizeof(s->name)) == 0)
+      return s;
+  }
+  return 0;
+}
+
+// Atomically add n to *p.  Other CPUs may see the low word
+// carry before the high word, but no addition is lost.
+static void
+add64(volatile uint64 *p, uint64 n)
+{
+  volatile uint *w = (volatile uint*)p;
+
+  asm volatile("lock; addl %2, %0\n\tlock; adcl %3, %1" :
+               "+m" (w[0]), "+m" (w[1]) :
+               "r" ((uint)n), "r" ((uint)(n >> 32)) :
+               "cc");
+}
+
+// Count n TSC cycles in a log2 histogram.
+static void
+histadd(uint *hist, uint64 n)
+{
+  int b;
+
+  for(b = 0; n > 1 && b < NLOCKHIST-1; b++)
+    n >>= 1;
+  xadd(&hist[b], 1);
 }
 
 // Acquire the lock.
@@ -24,13 +196,24 @@ initlock(struct spinlock *lk, char *name)
 void
 acquire(struct spinlock *lk)
 {
+  struct lockstat *st;
+  struct locksite *s;
+  uint ticket;
+  uint64 t0, spin;
+
   pushcli(); // disable interrupts to avoid deadlock.
   if(holding(lk))
     panic("acquire");
 
-  // The xchg is atomic.
-  while(xchg(&lk->locked, 1) != 0)
-    ;
+  // The xadd is atomic.
+  ticket = xadd(&lk->next, 1);
+  spin = 0;
+  if(lk->owner != ticket){
+    t0 = rdtsc();
+    while(*(volatile uint*)&lk->owner != ticket)
+      pause();
+    spin = rdtsc() - t0;
+  }
 
   // Tell the C compiler and the processor to not move loads or stores
   // past this point, to ensure that the critical section's memory
@@ -40,15 +223,52 @@ acquire(struct spinlock *lk)
   // Record info about lock acquisition for debugging.
   lk->cpu = mycpu();
   getcallerpcs(&lk, lk->pcs);
+
+  lk->nacquire++;
+  if(spin){
+    lk->ncontend++;
+    lk->spin += spin;
+  }
+
+  // The profiler's histograms are shared by every lock with
+  // the same name, so they need atomic adds; it is opt-in.
+  st = lk->stat;
+  lk->tacquire = 0;
+  if(lockprofon){
+    if(st)
+      histadd(st->waithist, spin);
+    if((s = locksitefor(lk->pcs[0], lk->name)) != 0){
+      xadd(&s->nacquire, 1);
+      if(spin)
+        xadd(&s->ncontend, 1);
+      add64(&s->wait, spin);
+      histadd(s->waithist, spin);
+    }
+    lk->site = s;
+    lk->tacquire = rdtsc();
+  }
 }
 
 // Release the lock.
 void
 release(struct spinlock *lk)
 {
+  uint64 hold;
+
   if(!holding(lk))
     panic("release");
 
+  if(lk->tacquire){
+    hold = rdtsc() - lk->tacquire;
+    lk->tacquire = 0;
+    if(lk->stat)
+      histadd(lk->stat->holdhist, hold);
+    if(lk->site){
+      add64(&lk->site->hold, hold);
+      histadd(lk->site->holdhist, hold);
+    }
+  }
+
   lk->pcs[0] = 0;
   lk->cpu = 0;
 
@@ -59,10 +279,11 @@ release(struct spinlock *lk)
   // stores; __sync_synchronize() tells them both not to.
   __sync_synchronize();
 
-  // Release the lock, equivalent to lk->locked = 0.
-  // This code can't use a C assignment, since it might
-  // not be atomic. A real OS would use C atomics here.
-  asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+  // Release the lock, equivalent to lk->owner++.  Only the
+  // holder writes owner, so this needs no lock prefix, but it
+  // can't use a C assignment, since that might not be a single
+  // store. A real OS would use C atomics here.
+  asm volatile("incl %0" : "+m" (lk->owner) : );
 
   popcli();
 }
@@ -91,12 +312,77 @@ holding(struct spinlock *lock)
 {
   int r;
   pushcli();
-  r = lock->locked && lock->cpu == mycpu();
+  r = lock->next != lock->owner && lock->cpu == mycpu();
   popcli();
   return r;
 }
 
 
+// Copy statistics for up to n lock names into st.
+// Returns the number copied.
+int
+getlockstat(struct lockstat *st, int n)
+{
+  struct lockstat t;
+  struct spinlock *lk;
+  uint eflags;
+  int i;
+
+  // st is in user memory, so fill it outside the table lock.
+  // The counts of a lock being acquired may be read halfway
+  // through an update; they are only statistics.
+  for(i = 0; i < n; i++){
+    eflags = locktablock();
+    if(i >= locktab.n){
+      locktabunlock(eflags);
+      break;
+    }
+    t = locktab.stat[i];
+    for(lk = locktab.locks[i]; lk; lk = lk->statnext){
+      t.nacquire += lk->nacquire;
+      t.ncontend += lk->ncontend;
+      t.spin += lk->spin;
+    }
+    locktabunlock(eflags);
+    st[i] = t;
+  }
+  return i;
+}
+
+// Turn lock profiling on, starting from empty histograms
+// and call sites, or off.  Locks held or waited for while
+// it is turned on or off may be counted partly.
+void
+lockprof(int on)
+{
+  struct lockstat *st;
+
+  if(on){
+    lockprofon = 0;
+    for(st = locktab.stat; st < &locktab.stat[NLOCKSTAT]; st++){
+      memset(st->waithist, 0, sizeof(st->waithist));
+      memset(st->holdhist, 0, sizeof(st->holdhist));
+    }
+    memset(locksite, 0, sizeof(locksite));
+  }
+  lockprofon = on;
+}
+
+// Copy up to n profiled call sites into s.
+// Returns the number copied.
+int
+getlockprof(struct locksite *s, int n)
+{
+  struct locksite *t;
+  int i;
+
+  i = 0;
+  for(t = locksite; t < &locksite[NLOCKSITE] && i < n; t++)
+    if(t->pc && t->pc != CLAIMED)
+      s[i++] = *t;
+  return i;
+}
+
 // Pushcli/popcli are like cli/sti except that they are matched:
 // it takes two popcli to undo two pushcli.  Also, if interrupts
 // are off, then pushcli, popcli leaves them off.
@@ -1,11 +1,24 @@
 // Mutual exclusion lock.
+// A ticket lock: CPUs get the lock in the order they asked for it.
 struct spinlock {
-  uint locked;       // Is the lock held?
+  uint next;         // Next ticket to hand out
+  uint owner;        // Ticket that holds (or may take) the lock
 
   // For debugging:
   char *name;        // Name of lock.
   struct cpu *cpu;   // The cpu holding the lock.
   uint pcs[10];      // The call stack (an array of program counters)
                      // that locked the lock.
+  // For getlockstat().  Only the holder updates the counts.
+  uint nacquire;     // Acquisitions
+  uint ncontend;     // Acquisitions that had to wait
+  uint64 spin;       // TSC cycles spent waiting
+  struct lockstat *stat;  // Entry for locks with this name
+  struct spinlock *statnext;  // Other live locks with this name
+  struct spinlock *statprev;
+
+  // For lockprof():
+  uint64 tacquire;   // TSC when acquired, or 0 if not profiled
+  struct locksite *site;  // Where it was acquired from
 };
 
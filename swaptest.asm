@@ -0,0 +1,1581 @@
+
+_swaptest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char buffer1[4096];
+char buffer2[4096];
+
+int main(int argc, char** argv)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+	int blkno = 10;
+	int i;
+
+	if ( argc < 2 ) {
+   f:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  12:	8b 41 04             	mov    0x4(%ecx),%eax
+	if ( argc < 2 ) {
+  15:	7e 7b                	jle    92 <main+0x92>
+		printf(1, "Usage: %s blkno\n", argv[0]);
+		exit();
+	}
+
+	blkno = atoi(argv[1]);
+  17:	83 ec 0c             	sub    $0xc,%esp
+  1a:	ff 70 04             	push   0x4(%eax)
+  1d:	e8 5e 02 00 00       	call   280 <atoi>
+
+	memset(buffer1, '1', 4096);
+  22:	83 c4 0c             	add    $0xc,%esp
+  25:	68 00 10 00 00       	push   $0x1000
+	blkno = atoi(argv[1]);
+  2a:	89 c3                	mov    %eax,%ebx
+	memset(buffer1, '1', 4096);
+  2c:	6a 31                	push   $0x31
+  2e:	68 e0 1e 00 00       	push   $0x1ee0
+  33:	e8 38 01 00 00       	call   170 <memset>
+
+	swapwrite(buffer1, blkno);
+  38:	58                   	pop    %eax
+  39:	5a                   	pop    %edx
+  3a:	53                   	push   %ebx
+  3b:	68 e0 1e 00 00       	push   $0x1ee0
+  40:	e8 c5 05 00 00       	call   60a <swapwrite>
+
+	swapread(buffer2, blkno);
+  45:	59                   	pop    %ecx
+  46:	58                   	pop    %eax
+  47:	53                   	push   %ebx
+  48:	68 e0 0e 00 00       	push   $0xee0
+
+	for ( i=0; i <4096; ++i ) {
+  4d:	31 db                	xor    %ebx,%ebx
+	swapread(buffer2, blkno);
+  4f:	e8 99 05 00 00       	call   5ed <swapread>
+  54:	83 c4 10             	add    $0x10,%esp
+  57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  5e:	66 90                	xchg   %ax,%ax
+		if ( buffer1[i] != buffer2[i] )
+  60:	0f b6 83 e0 0e 00 00 	movzbl 0xee0(%ebx),%eax
+  67:	38 83 e0 1e 00 00    	cmp    %al,0x1ee0(%ebx)
+  6d:	74 13                	je     82 <main+0x82>
+			printf(1, "different at %d\n", i);
+  6f:	83 ec 04             	sub    $0x4,%esp
+  72:	53                   	push   %ebx
+  73:	68 79 0b 00 00       	push   $0xb79
+  78:	6a 01                	push   $0x1
+  7a:	e8 c1 07 00 00       	call   840 <printf>
+  7f:	83 c4 10             	add    $0x10,%esp
+	for ( i=0; i <4096; ++i ) {
+  82:	83 c3 01             	add    $0x1,%ebx
+  85:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  8b:	75 d3                	jne    60 <main+0x60>
+	}
+
+	exit();
+  8d:	e8 17 03 00 00       	call   3a9 <exit>
+		printf(1, "Usage: %s blkno\n", argv[0]);
+  92:	52                   	push   %edx
+  93:	ff 30                	push   (%eax)
+  95:	68 68 0b 00 00       	push   $0xb68
+  9a:	6a 01                	push   $0x1
+  9c:	e8 9f 07 00 00       	call   840 <printf>
+		exit();
+  a1:	e8 03 03 00 00       	call   3a9 <exit>
+  a6:	66 90                	xchg   %ax,%ax
+  a8:	66 90                	xchg   %ax,%ax
+  aa:	66 90                	xchg   %ax,%ax
+  ac:	66 90                	xchg   %ax,%ax
+  ae:	66 90                	xchg   %ax,%ax
+
+000000b0 <strcpy>:
+#include "date.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  b0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  b1:	31 c0                	xor    %eax,%eax
+{
+  b3:	89 e5                	mov    %esp,%ebp
+  b5:	53                   	push   %ebx
+  b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  c7:	83 c0 01             	add    $0x1,%eax
+  ca:	84 d2                	test   %dl,%dl
+  cc:	75 f2                	jne    c0 <strcpy+0x10>
+    ;
+  return os;
+}
+  ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  d1:	89 c8                	mov    %ecx,%eax
+  d3:	c9                   	leave
+  d4:	c3                   	ret
+  d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000e0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  e0:	55                   	push   %ebp
+  e1:	89 e5                	mov    %esp,%ebp
+  e3:	53                   	push   %ebx
+  e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  ea:	0f b6 02             	movzbl (%edx),%eax
+  ed:	84 c0                	test   %al,%al
+  ef:	75 17                	jne    108 <strcmp+0x28>
+  f1:	eb 3a                	jmp    12d <strcmp+0x4d>
+  f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  f7:	90                   	nop
+  f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  fc:	83 c2 01             	add    $0x1,%edx
+  ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 102:	84 c0                	test   %al,%al
+ 104:	74 1a                	je     120 <strcmp+0x40>
+    p++, q++;
+ 106:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 108:	0f b6 19             	movzbl (%ecx),%ebx
+ 10b:	38 c3                	cmp    %al,%bl
+ 10d:	74 e9                	je     f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 10f:	29 d8                	sub    %ebx,%eax
+}
+ 111:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 114:	c9                   	leave
+ 115:	c3                   	ret
+ 116:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 120:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 124:	31 c0                	xor    %eax,%eax
+ 126:	29 d8                	sub    %ebx,%eax
+}
+ 128:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 12b:	c9                   	leave
+ 12c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 12d:	0f b6 19             	movzbl (%ecx),%ebx
+ 130:	31 c0                	xor    %eax,%eax
+ 132:	eb db                	jmp    10f <strcmp+0x2f>
+ 134:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 13f:	90                   	nop
+
+00000140 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 146:	80 3a 00             	cmpb   $0x0,(%edx)
+ 149:	74 15                	je     160 <strlen+0x20>
+ 14b:	31 c0                	xor    %eax,%eax
+ 14d:	8d 76 00             	lea    0x0(%esi),%esi
+ 150:	83 c0 01             	add    $0x1,%eax
+ 153:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 157:	89 c1                	mov    %eax,%ecx
+ 159:	75 f5                	jne    150 <strlen+0x10>
+    ;
+  return n;
+}
+ 15b:	89 c8                	mov    %ecx,%eax
+ 15d:	5d                   	pop    %ebp
+ 15e:	c3                   	ret
+ 15f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 160:	31 c9                	xor    %ecx,%ecx
+}
+ 162:	5d                   	pop    %ebp
+ 163:	89 c8                	mov    %ecx,%eax
+ 165:	c3                   	ret
+ 166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000170 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 170:	55                   	push   %ebp
+ 171:	89 e5                	mov    %esp,%ebp
+ 173:	57                   	push   %edi
+ 174:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 177:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 17a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 17d:	89 d7                	mov    %edx,%edi
+ 17f:	fc                   	cld
+ 180:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 182:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 185:	89 d0                	mov    %edx,%eax
+ 187:	c9                   	leave
+ 188:	c3                   	ret
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000190 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	8b 45 08             	mov    0x8(%ebp),%eax
+ 196:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 19a:	0f b6 10             	movzbl (%eax),%edx
+ 19d:	84 d2                	test   %dl,%dl
+ 19f:	75 12                	jne    1b3 <strchr+0x23>
+ 1a1:	eb 1d                	jmp    1c0 <strchr+0x30>
+ 1a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1a7:	90                   	nop
+ 1a8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1ac:	83 c0 01             	add    $0x1,%eax
+ 1af:	84 d2                	test   %dl,%dl
+ 1b1:	74 0d                	je     1c0 <strchr+0x30>
+    if(*s == c)
+ 1b3:	38 d1                	cmp    %dl,%cl
+ 1b5:	75 f1                	jne    1a8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1b7:	5d                   	pop    %ebp
+ 1b8:	c3                   	ret
+ 1b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 1c0:	31 c0                	xor    %eax,%eax
+}
+ 1c2:	5d                   	pop    %ebp
+ 1c3:	c3                   	ret
+ 1c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1cf:	90                   	nop
+
+000001d0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	57                   	push   %edi
+ 1d4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1d5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1d8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1d9:	31 db                	xor    %ebx,%ebx
+{
+ 1db:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1de:	eb 27                	jmp    207 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1e0:	83 ec 04             	sub    $0x4,%esp
+ 1e3:	6a 01                	push   $0x1
+ 1e5:	56                   	push   %esi
+ 1e6:	6a 00                	push   $0x0
+ 1e8:	e8 13 02 00 00       	call   400 <read>
+    if(cc < 1)
+ 1ed:	83 c4 10             	add    $0x10,%esp
+ 1f0:	85 c0                	test   %eax,%eax
+ 1f2:	7e 1d                	jle    211 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1f4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1fb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1ff:	3c 0a                	cmp    $0xa,%al
+ 201:	74 10                	je     213 <gets+0x43>
+ 203:	3c 0d                	cmp    $0xd,%al
+ 205:	74 0c                	je     213 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 207:	89 df                	mov    %ebx,%edi
+ 209:	83 c3 01             	add    $0x1,%ebx
+ 20c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 20f:	7c cf                	jl     1e0 <gets+0x10>
+ 211:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 213:	8b 45 08             	mov    0x8(%ebp),%eax
+ 216:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 21a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 21d:	5b                   	pop    %ebx
+ 21e:	5e                   	pop    %esi
+ 21f:	5f                   	pop    %edi
+ 220:	5d                   	pop    %ebp
+ 221:	c3                   	ret
+ 222:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000230 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	56                   	push   %esi
+ 234:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 235:	83 ec 08             	sub    $0x8,%esp
+ 238:	6a 00                	push   $0x0
+ 23a:	ff 75 08             	push   0x8(%ebp)
+ 23d:	e8 4f 02 00 00       	call   491 <open>
+  if(fd < 0)
+ 242:	83 c4 10             	add    $0x10,%esp
+ 245:	85 c0                	test   %eax,%eax
+ 247:	78 27                	js     270 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 249:	83 ec 08             	sub    $0x8,%esp
+ 24c:	ff 75 0c             	push   0xc(%ebp)
+ 24f:	89 c3                	mov    %eax,%ebx
+ 251:	50                   	push   %eax
+ 252:	e8 91 02 00 00       	call   4e8 <fstat>
+  close(fd);
+ 257:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 25a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 25c:	e8 d9 01 00 00       	call   43a <close>
+  return r;
+ 261:	83 c4 10             	add    $0x10,%esp
+}
+ 264:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 267:	89 f0                	mov    %esi,%eax
+ 269:	5b                   	pop    %ebx
+ 26a:	5e                   	pop    %esi
+ 26b:	5d                   	pop    %ebp
+ 26c:	c3                   	ret
+ 26d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 270:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 275:	eb ed                	jmp    264 <stat+0x34>
+ 277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27e:	66 90                	xchg   %ax,%ax
+
+00000280 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	53                   	push   %ebx
+ 284:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 287:	0f be 02             	movsbl (%edx),%eax
+ 28a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 28d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 290:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 295:	77 1e                	ja     2b5 <atoi+0x35>
+ 297:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 2a0:	83 c2 01             	add    $0x1,%edx
+ 2a3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 2a6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 2aa:	0f be 02             	movsbl (%edx),%eax
+ 2ad:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2b0:	80 fb 09             	cmp    $0x9,%bl
+ 2b3:	76 eb                	jbe    2a0 <atoi+0x20>
+  return n;
+}
+ 2b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2b8:	89 c8                	mov    %ecx,%eax
+ 2ba:	c9                   	leave
+ 2bb:	c3                   	ret
+ 2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002c0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	57                   	push   %edi
+ 2c4:	56                   	push   %esi
+ 2c5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 2ce:	85 c0                	test   %eax,%eax
+ 2d0:	7e 13                	jle    2e5 <memmove+0x25>
+ 2d2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2d4:	89 d7                	mov    %edx,%edi
+ 2d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2e0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2e1:	39 f8                	cmp    %edi,%eax
+ 2e3:	75 fb                	jne    2e0 <memmove+0x20>
+  return vdst;
+}
+ 2e5:	5e                   	pop    %esi
+ 2e6:	89 d0                	mov    %edx,%eax
+ 2e8:	5f                   	pop    %edi
+ 2e9:	5d                   	pop    %ebp
+ 2ea:	c3                   	ret
+ 2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+
+000002f0 <ugetpid>:
+// getpid() without a system call, from the page at UPROC.
+int
+ugetpid(void)
+{
+  return ((struct uproc*)UPROC)->pid;
+}
+ 2f0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+ 2f5:	c3                   	ret
+ 2f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000300 <uclocktime>:
+
+// clocktime() without a system call, from the page at UCLOCK.
+int
+uclocktime(struct timespec *ts)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	57                   	push   %edi
+ 304:	56                   	push   %esi
+ 305:	53                   	push   %ebx
+ 306:	83 ec 1c             	sub    $0x1c,%esp
+  struct uclock *c = (struct uclock*)UCLOCK;
+
+  if(c->tscmult == 0)
+ 309:	8b 0d 08 f0 ff 7f    	mov    0x7ffff008,%ecx
+{
+ 30f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(c->tscmult == 0)
+ 312:	85 c9                	test   %ecx,%ecx
+ 314:	74 6a                	je     380 <uclocktime+0x80>
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+ 316:	0f 31                	rdtsc
+static inline void
+uclockread(struct uclock *c, uint64 tsc, struct timespec *ts)
+{
+  uint64 d, ns;
+
+  d = tsc - c->tscbase;
+ 318:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 31e:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+ 324:	89 c6                	mov    %eax,%esi
+  if((long long)d < 0)  // another CPU's TSC is a little behind
+ 326:	85 d2                	test   %edx,%edx
+ 328:	78 46                	js     370 <uclocktime+0x70>
+    d = 0;
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 32a:	89 d0                	mov    %edx,%eax
+ 32c:	f7 e1                	mul    %ecx
+ 32e:	0f a4 c2 08          	shld   $0x8,%eax,%edx
+ 332:	c1 e0 08             	shl    $0x8,%eax
+ 335:	89 45 e0             	mov    %eax,-0x20(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+ 338:	89 f0                	mov    %esi,%eax
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 33a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+ 33d:	f7 e1                	mul    %ecx
+ 33f:	0f ac d0 18          	shrd   $0x18,%edx,%eax
+ 343:	c1 ea 18             	shr    $0x18,%edx
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 346:	03 45 e0             	add    -0x20(%ebp),%eax
+ 349:	13 55 e4             	adc    -0x1c(%ebp),%edx
+// linked with libgcc, so it cannot use 64-bit '/' or '%'.
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+  asm("divl %4" : "=a" (q), "=d" (r) : "a" ((uint)n), "d" ((uint)(n>>32)), "rm" (d));
+ 34c:	89 c7                	mov    %eax,%edi
+ 34e:	89 f8                	mov    %edi,%eax
+ 350:	b9 00 ca 9a 3b       	mov    $0x3b9aca00,%ecx
+ 355:	f7 f1                	div    %ecx
+  ts->sec = divl(ns, 1000000000, &ts->nsec);
+ 357:	89 03                	mov    %eax,(%ebx)
+    return clocktime(ts);
+  uclockread(c, rdtsc(), ts);
+  return 0;
+}
+ 359:	31 c0                	xor    %eax,%eax
+  *rem = r;
+ 35b:	89 53 04             	mov    %edx,0x4(%ebx)
+ 35e:	83 c4 1c             	add    $0x1c,%esp
+ 361:	5b                   	pop    %ebx
+ 362:	5e                   	pop    %esi
+ 363:	5f                   	pop    %edi
+ 364:	5d                   	pop    %ebp
+ 365:	c3                   	ret
+ 366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+ 370:	31 d2                	xor    %edx,%edx
+ 372:	31 ff                	xor    %edi,%edi
+ 374:	eb d8                	jmp    34e <uclocktime+0x4e>
+ 376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+ 380:	83 c4 1c             	add    $0x1c,%esp
+ 383:	5b                   	pop    %ebx
+ 384:	5e                   	pop    %esi
+ 385:	5f                   	pop    %edi
+ 386:	5d                   	pop    %ebp
+    return clocktime(ts);
+ 387:	e9 f2 02 00 00       	jmp    67e <clocktime>
+
+0000038c <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+ 38c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 391:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 398:	00 00 00 
+ 39b:	74 09                	je     3a6 <fork+0x1a>
+ 39d:	89 e1                	mov    %esp,%ecx
+ 39f:	ba a8 03 00 00       	mov    $0x3a8,%edx
+ 3a4:	0f 34                	sysenter
+ 3a6:	cd 40                	int    $0x40
+ 3a8:	c3                   	ret
+
+000003a9 <exit>:
+SYSCALL(exit)
+ 3a9:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3ae:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 3b5:	00 00 00 
+ 3b8:	74 09                	je     3c3 <exit+0x1a>
+ 3ba:	89 e1                	mov    %esp,%ecx
+ 3bc:	ba c5 03 00 00       	mov    $0x3c5,%edx
+ 3c1:	0f 34                	sysenter
+ 3c3:	cd 40                	int    $0x40
+ 3c5:	c3                   	ret
+
+000003c6 <wait>:
+SYSCALL(wait)
+ 3c6:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3cb:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 3d2:	00 00 00 
+ 3d5:	74 09                	je     3e0 <wait+0x1a>
+ 3d7:	89 e1                	mov    %esp,%ecx
+ 3d9:	ba e2 03 00 00       	mov    $0x3e2,%edx
+ 3de:	0f 34                	sysenter
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <pipe>:
+SYSCALL(pipe)
+ 3e3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3e8:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 3ef:	00 00 00 
+ 3f2:	74 09                	je     3fd <pipe+0x1a>
+ 3f4:	89 e1                	mov    %esp,%ecx
+ 3f6:	ba ff 03 00 00       	mov    $0x3ff,%edx
+ 3fb:	0f 34                	sysenter
+ 3fd:	cd 40                	int    $0x40
+ 3ff:	c3                   	ret
+
+00000400 <read>:
+SYSCALL(read)
+ 400:	b8 05 00 00 00       	mov    $0x5,%eax
+ 405:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 40c:	00 00 00 
+ 40f:	74 09                	je     41a <read+0x1a>
+ 411:	89 e1                	mov    %esp,%ecx
+ 413:	ba 1c 04 00 00       	mov    $0x41c,%edx
+ 418:	0f 34                	sysenter
+ 41a:	cd 40                	int    $0x40
+ 41c:	c3                   	ret
+
+0000041d <write>:
+SYSCALL(write)
+ 41d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 422:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 429:	00 00 00 
+ 42c:	74 09                	je     437 <write+0x1a>
+ 42e:	89 e1                	mov    %esp,%ecx
+ 430:	ba 39 04 00 00       	mov    $0x439,%edx
+ 435:	0f 34                	sysenter
+ 437:	cd 40                	int    $0x40
+ 439:	c3                   	ret
+
+0000043a <close>:
+SYSCALL(close)
+ 43a:	b8 15 00 00 00       	mov    $0x15,%eax
+ 43f:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 446:	00 00 00 
+ 449:	74 09                	je     454 <close+0x1a>
+ 44b:	89 e1                	mov    %esp,%ecx
+ 44d:	ba 56 04 00 00       	mov    $0x456,%edx
+ 452:	0f 34                	sysenter
+ 454:	cd 40                	int    $0x40
+ 456:	c3                   	ret
+
+00000457 <kill>:
+SYSCALL(kill)
+ 457:	b8 06 00 00 00       	mov    $0x6,%eax
+ 45c:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 463:	00 00 00 
+ 466:	74 09                	je     471 <kill+0x1a>
+ 468:	89 e1                	mov    %esp,%ecx
+ 46a:	ba 73 04 00 00       	mov    $0x473,%edx
+ 46f:	0f 34                	sysenter
+ 471:	cd 40                	int    $0x40
+ 473:	c3                   	ret
+
+00000474 <exec>:
+SYSCALL(exec)
+ 474:	b8 07 00 00 00       	mov    $0x7,%eax
+ 479:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 480:	00 00 00 
+ 483:	74 09                	je     48e <exec+0x1a>
+ 485:	89 e1                	mov    %esp,%ecx
+ 487:	ba 90 04 00 00       	mov    $0x490,%edx
+ 48c:	0f 34                	sysenter
+ 48e:	cd 40                	int    $0x40
+ 490:	c3                   	ret
+
+00000491 <open>:
+SYSCALL(open)
+ 491:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 496:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 49d:	00 00 00 
+ 4a0:	74 09                	je     4ab <open+0x1a>
+ 4a2:	89 e1                	mov    %esp,%ecx
+ 4a4:	ba ad 04 00 00       	mov    $0x4ad,%edx
+ 4a9:	0f 34                	sysenter
+ 4ab:	cd 40                	int    $0x40
+ 4ad:	c3                   	ret
+
+000004ae <mknod>:
+SYSCALL(mknod)
+ 4ae:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4b3:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4ba:	00 00 00 
+ 4bd:	74 09                	je     4c8 <mknod+0x1a>
+ 4bf:	89 e1                	mov    %esp,%ecx
+ 4c1:	ba ca 04 00 00       	mov    $0x4ca,%edx
+ 4c6:	0f 34                	sysenter
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <unlink>:
+SYSCALL(unlink)
+ 4cb:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4d0:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4d7:	00 00 00 
+ 4da:	74 09                	je     4e5 <unlink+0x1a>
+ 4dc:	89 e1                	mov    %esp,%ecx
+ 4de:	ba e7 04 00 00       	mov    $0x4e7,%edx
+ 4e3:	0f 34                	sysenter
+ 4e5:	cd 40                	int    $0x40
+ 4e7:	c3                   	ret
+
+000004e8 <fstat>:
+SYSCALL(fstat)
+ 4e8:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4ed:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4f4:	00 00 00 
+ 4f7:	74 09                	je     502 <fstat+0x1a>
+ 4f9:	89 e1                	mov    %esp,%ecx
+ 4fb:	ba 04 05 00 00       	mov    $0x504,%edx
+ 500:	0f 34                	sysenter
+ 502:	cd 40                	int    $0x40
+ 504:	c3                   	ret
+
+00000505 <link>:
+SYSCALL(link)
+ 505:	b8 13 00 00 00       	mov    $0x13,%eax
+ 50a:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 511:	00 00 00 
+ 514:	74 09                	je     51f <link+0x1a>
+ 516:	89 e1                	mov    %esp,%ecx
+ 518:	ba 21 05 00 00       	mov    $0x521,%edx
+ 51d:	0f 34                	sysenter
+ 51f:	cd 40                	int    $0x40
+ 521:	c3                   	ret
+
+00000522 <mkdir>:
+SYSCALL(mkdir)
+ 522:	b8 14 00 00 00       	mov    $0x14,%eax
+ 527:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 52e:	00 00 00 
+ 531:	74 09                	je     53c <mkdir+0x1a>
+ 533:	89 e1                	mov    %esp,%ecx
+ 535:	ba 3e 05 00 00       	mov    $0x53e,%edx
+ 53a:	0f 34                	sysenter
+ 53c:	cd 40                	int    $0x40
+ 53e:	c3                   	ret
+
+0000053f <chdir>:
+SYSCALL(chdir)
+ 53f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 544:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 54b:	00 00 00 
+ 54e:	74 09                	je     559 <chdir+0x1a>
+ 550:	89 e1                	mov    %esp,%ecx
+ 552:	ba 5b 05 00 00       	mov    $0x55b,%edx
+ 557:	0f 34                	sysenter
+ 559:	cd 40                	int    $0x40
+ 55b:	c3                   	ret
+
+0000055c <dup>:
+SYSCALL(dup)
+ 55c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 561:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 568:	00 00 00 
+ 56b:	74 09                	je     576 <dup+0x1a>
+ 56d:	89 e1                	mov    %esp,%ecx
+ 56f:	ba 78 05 00 00       	mov    $0x578,%edx
+ 574:	0f 34                	sysenter
+ 576:	cd 40                	int    $0x40
+ 578:	c3                   	ret
+
+00000579 <getpid>:
+SYSCALL(getpid)
+ 579:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 57e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 585:	00 00 00 
+ 588:	74 09                	je     593 <getpid+0x1a>
+ 58a:	89 e1                	mov    %esp,%ecx
+ 58c:	ba 95 05 00 00       	mov    $0x595,%edx
+ 591:	0f 34                	sysenter
+ 593:	cd 40                	int    $0x40
+ 595:	c3                   	ret
+
+00000596 <sbrk>:
+SYSCALL(sbrk)
+ 596:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 59b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5a2:	00 00 00 
+ 5a5:	74 09                	je     5b0 <sbrk+0x1a>
+ 5a7:	89 e1                	mov    %esp,%ecx
+ 5a9:	ba b2 05 00 00       	mov    $0x5b2,%edx
+ 5ae:	0f 34                	sysenter
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <sleep>:
+SYSCALL(sleep)
+ 5b3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5b8:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5bf:	00 00 00 
+ 5c2:	74 09                	je     5cd <sleep+0x1a>
+ 5c4:	89 e1                	mov    %esp,%ecx
+ 5c6:	ba cf 05 00 00       	mov    $0x5cf,%edx
+ 5cb:	0f 34                	sysenter
+ 5cd:	cd 40                	int    $0x40
+ 5cf:	c3                   	ret
+
+000005d0 <uptime>:
+SYSCALL(uptime)
+ 5d0:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5d5:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5dc:	00 00 00 
+ 5df:	74 09                	je     5ea <uptime+0x1a>
+ 5e1:	89 e1                	mov    %esp,%ecx
+ 5e3:	ba ec 05 00 00       	mov    $0x5ec,%edx
+ 5e8:	0f 34                	sysenter
+ 5ea:	cd 40                	int    $0x40
+ 5ec:	c3                   	ret
+
+000005ed <swapread>:
+SYSCALL(swapread)
+ 5ed:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5f2:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5f9:	00 00 00 
+ 5fc:	74 09                	je     607 <swapread+0x1a>
+ 5fe:	89 e1                	mov    %esp,%ecx
+ 600:	ba 09 06 00 00       	mov    $0x609,%edx
+ 605:	0f 34                	sysenter
+ 607:	cd 40                	int    $0x40
+ 609:	c3                   	ret
+
+0000060a <swapwrite>:
+SYSCALL(swapwrite)
+ 60a:	b8 17 00 00 00       	mov    $0x17,%eax
+ 60f:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 616:	00 00 00 
+ 619:	74 09                	je     624 <swapwrite+0x1a>
+ 61b:	89 e1                	mov    %esp,%ecx
+ 61d:	ba 26 06 00 00       	mov    $0x626,%edx
+ 622:	0f 34                	sysenter
+ 624:	cd 40                	int    $0x40
+ 626:	c3                   	ret
+
+00000627 <setaffinity>:
+SYSCALL(setaffinity)
+ 627:	b8 18 00 00 00       	mov    $0x18,%eax
+ 62c:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 633:	00 00 00 
+ 636:	74 09                	je     641 <setaffinity+0x1a>
+ 638:	89 e1                	mov    %esp,%ecx
+ 63a:	ba 43 06 00 00       	mov    $0x643,%edx
+ 63f:	0f 34                	sysenter
+ 641:	cd 40                	int    $0x40
+ 643:	c3                   	ret
+
+00000644 <getaffinity>:
+SYSCALL(getaffinity)
+ 644:	b8 19 00 00 00       	mov    $0x19,%eax
+ 649:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 650:	00 00 00 
+ 653:	74 09                	je     65e <getaffinity+0x1a>
+ 655:	89 e1                	mov    %esp,%ecx
+ 657:	ba 60 06 00 00       	mov    $0x660,%edx
+ 65c:	0f 34                	sysenter
+ 65e:	cd 40                	int    $0x40
+ 660:	c3                   	ret
+
+00000661 <nanosleep>:
+SYSCALL(nanosleep)
+ 661:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 666:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 66d:	00 00 00 
+ 670:	74 09                	je     67b <nanosleep+0x1a>
+ 672:	89 e1                	mov    %esp,%ecx
+ 674:	ba 7d 06 00 00       	mov    $0x67d,%edx
+ 679:	0f 34                	sysenter
+ 67b:	cd 40                	int    $0x40
+ 67d:	c3                   	ret
+
+0000067e <clocktime>:
+SYSCALL(clocktime)
+ 67e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 683:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 68a:	00 00 00 
+ 68d:	74 09                	je     698 <clocktime+0x1a>
+ 68f:	89 e1                	mov    %esp,%ecx
+ 691:	ba 9a 06 00 00       	mov    $0x69a,%edx
+ 696:	0f 34                	sysenter
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <batch>:
+SYSCALL(batch)
+ 69b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6a0:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6a7:	00 00 00 
+ 6aa:	74 09                	je     6b5 <batch+0x1a>
+ 6ac:	89 e1                	mov    %esp,%ecx
+ 6ae:	ba b7 06 00 00       	mov    $0x6b7,%edx
+ 6b3:	0f 34                	sysenter
+ 6b5:	cd 40                	int    $0x40
+ 6b7:	c3                   	ret
+
+000006b8 <aiosetup>:
+SYSCALL(aiosetup)
+ 6b8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6bd:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6c4:	00 00 00 
+ 6c7:	74 09                	je     6d2 <aiosetup+0x1a>
+ 6c9:	89 e1                	mov    %esp,%ecx
+ 6cb:	ba d4 06 00 00       	mov    $0x6d4,%edx
+ 6d0:	0f 34                	sysenter
+ 6d2:	cd 40                	int    $0x40
+ 6d4:	c3                   	ret
+
+000006d5 <aiowait>:
+SYSCALL(aiowait)
+ 6d5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6da:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6e1:	00 00 00 
+ 6e4:	74 09                	je     6ef <aiowait+0x1a>
+ 6e6:	89 e1                	mov    %esp,%ecx
+ 6e8:	ba f1 06 00 00       	mov    $0x6f1,%edx
+ 6ed:	0f 34                	sysenter
+ 6ef:	cd 40                	int    $0x40
+ 6f1:	c3                   	ret
+
+000006f2 <spawn>:
+SYSCALL(spawn)
+ 6f2:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6f7:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6fe:	00 00 00 
+ 701:	74 09                	je     70c <spawn+0x1a>
+ 703:	89 e1                	mov    %esp,%ecx
+ 705:	ba 0e 07 00 00       	mov    $0x70e,%edx
+ 70a:	0f 34                	sysenter
+ 70c:	cd 40                	int    $0x40
+ 70e:	c3                   	ret
+
+0000070f <getprocinfo>:
+SYSCALL(getprocinfo)
+ 70f:	b8 20 00 00 00       	mov    $0x20,%eax
+ 714:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 71b:	00 00 00 
+ 71e:	74 09                	je     729 <getprocinfo+0x1a>
+ 720:	89 e1                	mov    %esp,%ecx
+ 722:	ba 2b 07 00 00       	mov    $0x72b,%edx
+ 727:	0f 34                	sysenter
+ 729:	cd 40                	int    $0x40
+ 72b:	c3                   	ret
+
+0000072c <getlockstat>:
+SYSCALL(getlockstat)
+ 72c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 731:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 738:	00 00 00 
+ 73b:	74 09                	je     746 <getlockstat+0x1a>
+ 73d:	89 e1                	mov    %esp,%ecx
+ 73f:	ba 48 07 00 00       	mov    $0x748,%edx
+ 744:	0f 34                	sysenter
+ 746:	cd 40                	int    $0x40
+ 748:	c3                   	ret
+
+00000749 <lockprof>:
+SYSCALL(lockprof)
+ 749:	b8 22 00 00 00       	mov    $0x22,%eax
+ 74e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 755:	00 00 00 
+ 758:	74 09                	je     763 <lockprof+0x1a>
+ 75a:	89 e1                	mov    %esp,%ecx
+ 75c:	ba 65 07 00 00       	mov    $0x765,%edx
+ 761:	0f 34                	sysenter
+ 763:	cd 40                	int    $0x40
+ 765:	c3                   	ret
+
+00000766 <getlockprof>:
+SYSCALL(getlockprof)
+ 766:	b8 23 00 00 00       	mov    $0x23,%eax
+ 76b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 772:	00 00 00 
+ 775:	74 09                	je     780 <getlockprof+0x1a>
+ 777:	89 e1                	mov    %esp,%ecx
+ 779:	ba 82 07 00 00       	mov    $0x782,%edx
+ 77e:	0f 34                	sysenter
+ 780:	cd 40                	int    $0x40
+ 782:	c3                   	ret
+
+00000783 <diskstat>:
+SYSCALL(diskstat)
+ 783:	b8 24 00 00 00       	mov    $0x24,%eax
+ 788:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 78f:	00 00 00 
+ 792:	74 09                	je     79d <diskstat+0x1a>
+ 794:	89 e1                	mov    %esp,%ecx
+ 796:	ba 9f 07 00 00       	mov    $0x79f,%edx
+ 79b:	0f 34                	sysenter
+ 79d:	cd 40                	int    $0x40
+ 79f:	c3                   	ret
+
+000007a0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 7a0:	55                   	push   %ebp
+ 7a1:	89 e5                	mov    %esp,%ebp
+ 7a3:	57                   	push   %edi
+ 7a4:	56                   	push   %esi
+ 7a5:	53                   	push   %ebx
+ 7a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 7a8:	89 d1                	mov    %edx,%ecx
+{
+ 7aa:	83 ec 3c             	sub    $0x3c,%esp
+ 7ad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 7b0:	85 d2                	test   %edx,%edx
+ 7b2:	0f 89 80 00 00 00    	jns    838 <printint+0x98>
+ 7b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 7bc:	74 7a                	je     838 <printint+0x98>
+    x = -xx;
+ 7be:	f7 d9                	neg    %ecx
+    neg = 1;
+ 7c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 7c5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 7c8:	31 f6                	xor    %esi,%esi
+ 7ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 7d0:	89 c8                	mov    %ecx,%eax
+ 7d2:	31 d2                	xor    %edx,%edx
+ 7d4:	89 f7                	mov    %esi,%edi
+ 7d6:	f7 f3                	div    %ebx
+ 7d8:	8d 76 01             	lea    0x1(%esi),%esi
+ 7db:	0f b6 92 ec 0b 00 00 	movzbl 0xbec(%edx),%edx
+ 7e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 7e6:	89 ca                	mov    %ecx,%edx
+ 7e8:	89 c1                	mov    %eax,%ecx
+ 7ea:	39 da                	cmp    %ebx,%edx
+ 7ec:	73 e2                	jae    7d0 <printint+0x30>
+  if(neg)
+ 7ee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 7f1:	85 c0                	test   %eax,%eax
+ 7f3:	74 07                	je     7fc <printint+0x5c>
+    buf[i++] = '-';
+ 7f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 7fa:	89 f7                	mov    %esi,%edi
+ 7fc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 7ff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 802:	01 df                	add    %ebx,%edi
+ 804:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 808:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 80b:	83 ec 04             	sub    $0x4,%esp
+ 80e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 811:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 814:	6a 01                	push   $0x1
+ 816:	50                   	push   %eax
+ 817:	56                   	push   %esi
+ 818:	e8 00 fc ff ff       	call   41d <write>
+  while(--i >= 0)
+ 81d:	89 f8                	mov    %edi,%eax
+ 81f:	83 c4 10             	add    $0x10,%esp
+ 822:	83 ef 01             	sub    $0x1,%edi
+ 825:	39 d8                	cmp    %ebx,%eax
+ 827:	75 df                	jne    808 <printint+0x68>
+}
+ 829:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 82c:	5b                   	pop    %ebx
+ 82d:	5e                   	pop    %esi
+ 82e:	5f                   	pop    %edi
+ 82f:	5d                   	pop    %ebp
+ 830:	c3                   	ret
+ 831:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 838:	31 c0                	xor    %eax,%eax
+ 83a:	eb 89                	jmp    7c5 <printint+0x25>
+ 83c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000840 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 840:	55                   	push   %ebp
+ 841:	89 e5                	mov    %esp,%ebp
+ 843:	57                   	push   %edi
+ 844:	56                   	push   %esi
+ 845:	53                   	push   %ebx
+ 846:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 849:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 84c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 84f:	0f b6 1e             	movzbl (%esi),%ebx
+ 852:	83 c6 01             	add    $0x1,%esi
+ 855:	84 db                	test   %bl,%bl
+ 857:	74 67                	je     8c0 <printf+0x80>
+ 859:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 85c:	31 d2                	xor    %edx,%edx
+ 85e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 861:	eb 34                	jmp    897 <printf+0x57>
+ 863:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 867:	90                   	nop
+ 868:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 86b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 870:	83 f8 25             	cmp    $0x25,%eax
+ 873:	74 18                	je     88d <printf+0x4d>
+  write(fd, &c, 1);
+ 875:	83 ec 04             	sub    $0x4,%esp
+ 878:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 87b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 87e:	6a 01                	push   $0x1
+ 880:	50                   	push   %eax
+ 881:	57                   	push   %edi
+ 882:	e8 96 fb ff ff       	call   41d <write>
+ 887:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 88a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 88d:	0f b6 1e             	movzbl (%esi),%ebx
+ 890:	83 c6 01             	add    $0x1,%esi
+ 893:	84 db                	test   %bl,%bl
+ 895:	74 29                	je     8c0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 897:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 89a:	85 d2                	test   %edx,%edx
+ 89c:	74 ca                	je     868 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 89e:	83 fa 25             	cmp    $0x25,%edx
+ 8a1:	75 ea                	jne    88d <printf+0x4d>
+      if(c == 'd'){
+ 8a3:	83 f8 25             	cmp    $0x25,%eax
+ 8a6:	0f 84 24 01 00 00    	je     9d0 <printf+0x190>
+ 8ac:	83 e8 63             	sub    $0x63,%eax
+ 8af:	83 f8 15             	cmp    $0x15,%eax
+ 8b2:	77 1c                	ja     8d0 <printf+0x90>
+ 8b4:	ff 24 85 94 0b 00 00 	jmp    *0xb94(,%eax,4)
+ 8bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8bf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 8c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8c3:	5b                   	pop    %ebx
+ 8c4:	5e                   	pop    %esi
+ 8c5:	5f                   	pop    %edi
+ 8c6:	5d                   	pop    %ebp
+ 8c7:	c3                   	ret
+ 8c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8cf:	90                   	nop
+  write(fd, &c, 1);
+ 8d0:	83 ec 04             	sub    $0x4,%esp
+ 8d3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8d6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 8da:	6a 01                	push   $0x1
+ 8dc:	52                   	push   %edx
+ 8dd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 8e0:	57                   	push   %edi
+ 8e1:	e8 37 fb ff ff       	call   41d <write>
+ 8e6:	83 c4 0c             	add    $0xc,%esp
+ 8e9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8ec:	6a 01                	push   $0x1
+ 8ee:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 8f1:	52                   	push   %edx
+ 8f2:	57                   	push   %edi
+ 8f3:	e8 25 fb ff ff       	call   41d <write>
+        putc(fd, c);
+ 8f8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8fb:	31 d2                	xor    %edx,%edx
+ 8fd:	eb 8e                	jmp    88d <printf+0x4d>
+ 8ff:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 900:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 903:	83 ec 0c             	sub    $0xc,%esp
+ 906:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 90b:	8b 13                	mov    (%ebx),%edx
+ 90d:	6a 00                	push   $0x0
+ 90f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 911:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 914:	e8 87 fe ff ff       	call   7a0 <printint>
+        ap++;
+ 919:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 91c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 91f:	31 d2                	xor    %edx,%edx
+ 921:	e9 67 ff ff ff       	jmp    88d <printf+0x4d>
+ 926:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 92d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 930:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 933:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 935:	83 c0 04             	add    $0x4,%eax
+ 938:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 93b:	85 db                	test   %ebx,%ebx
+ 93d:	0f 84 9d 00 00 00    	je     9e0 <printf+0x1a0>
+        while(*s != 0){
+ 943:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 946:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 948:	84 c0                	test   %al,%al
+ 94a:	0f 84 3d ff ff ff    	je     88d <printf+0x4d>
+ 950:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 953:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 956:	89 de                	mov    %ebx,%esi
+ 958:	89 d3                	mov    %edx,%ebx
+ 95a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 960:	83 ec 04             	sub    $0x4,%esp
+ 963:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 966:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 969:	6a 01                	push   $0x1
+ 96b:	53                   	push   %ebx
+ 96c:	57                   	push   %edi
+ 96d:	e8 ab fa ff ff       	call   41d <write>
+        while(*s != 0){
+ 972:	0f b6 06             	movzbl (%esi),%eax
+ 975:	83 c4 10             	add    $0x10,%esp
+ 978:	84 c0                	test   %al,%al
+ 97a:	75 e4                	jne    960 <printf+0x120>
+      state = 0;
+ 97c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 97f:	31 d2                	xor    %edx,%edx
+ 981:	e9 07 ff ff ff       	jmp    88d <printf+0x4d>
+ 986:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 98d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 990:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 993:	83 ec 0c             	sub    $0xc,%esp
+ 996:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 99b:	8b 13                	mov    (%ebx),%edx
+ 99d:	6a 01                	push   $0x1
+ 99f:	e9 6b ff ff ff       	jmp    90f <printf+0xcf>
+ 9a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 9a8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 9ab:	83 ec 04             	sub    $0x4,%esp
+ 9ae:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 9b1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 9b3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 9b6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 9b9:	6a 01                	push   $0x1
+ 9bb:	52                   	push   %edx
+ 9bc:	57                   	push   %edi
+ 9bd:	e8 5b fa ff ff       	call   41d <write>
+        ap++;
+ 9c2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9c5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9c8:	31 d2                	xor    %edx,%edx
+ 9ca:	e9 be fe ff ff       	jmp    88d <printf+0x4d>
+ 9cf:	90                   	nop
+  write(fd, &c, 1);
+ 9d0:	83 ec 04             	sub    $0x4,%esp
+ 9d3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9d6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9d9:	6a 01                	push   $0x1
+ 9db:	e9 11 ff ff ff       	jmp    8f1 <printf+0xb1>
+ 9e0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 9e5:	bb 8a 0b 00 00       	mov    $0xb8a,%ebx
+ 9ea:	e9 61 ff ff ff       	jmp    950 <printf+0x110>
+ 9ef:	90                   	nop
+
+000009f0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 9f0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9f1:	a1 e0 2e 00 00       	mov    0x2ee0,%eax
+{
+ 9f6:	89 e5                	mov    %esp,%ebp
+ 9f8:	57                   	push   %edi
+ 9f9:	56                   	push   %esi
+ 9fa:	53                   	push   %ebx
+ 9fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 9fe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a08:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a0a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a0c:	39 ca                	cmp    %ecx,%edx
+ a0e:	73 30                	jae    a40 <free+0x50>
+ a10:	39 c1                	cmp    %eax,%ecx
+ a12:	72 04                	jb     a18 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a14:	39 c2                	cmp    %eax,%edx
+ a16:	72 f0                	jb     a08 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a18:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ a1b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ a1e:	39 f8                	cmp    %edi,%eax
+ a20:	74 2e                	je     a50 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a22:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a25:	8b 42 04             	mov    0x4(%edx),%eax
+ a28:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a2b:	39 f1                	cmp    %esi,%ecx
+ a2d:	74 38                	je     a67 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a2f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a31:	5b                   	pop    %ebx
+  freep = p;
+ a32:	89 15 e0 2e 00 00    	mov    %edx,0x2ee0
+}
+ a38:	5e                   	pop    %esi
+ a39:	5f                   	pop    %edi
+ a3a:	5d                   	pop    %ebp
+ a3b:	c3                   	ret
+ a3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a40:	39 c1                	cmp    %eax,%ecx
+ a42:	72 d0                	jb     a14 <free+0x24>
+ a44:	eb c2                	jmp    a08 <free+0x18>
+ a46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a4d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ a50:	03 70 04             	add    0x4(%eax),%esi
+ a53:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a56:	8b 02                	mov    (%edx),%eax
+ a58:	8b 00                	mov    (%eax),%eax
+ a5a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ a5d:	8b 42 04             	mov    0x4(%edx),%eax
+ a60:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a63:	39 f1                	cmp    %esi,%ecx
+ a65:	75 c8                	jne    a2f <free+0x3f>
+    p->s.size += bp->s.size;
+ a67:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ a6a:	89 15 e0 2e 00 00    	mov    %edx,0x2ee0
+    p->s.size += bp->s.size;
+ a70:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a73:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ a76:	89 0a                	mov    %ecx,(%edx)
+}
+ a78:	5b                   	pop    %ebx
+ a79:	5e                   	pop    %esi
+ a7a:	5f                   	pop    %edi
+ a7b:	5d                   	pop    %ebp
+ a7c:	c3                   	ret
+ a7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a80 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a80:	55                   	push   %ebp
+ a81:	89 e5                	mov    %esp,%ebp
+ a83:	57                   	push   %edi
+ a84:	56                   	push   %esi
+ a85:	53                   	push   %ebx
+ a86:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a89:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ a8c:	8b 15 e0 2e 00 00    	mov    0x2ee0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a92:	8d 78 07             	lea    0x7(%eax),%edi
+ a95:	c1 ef 03             	shr    $0x3,%edi
+ a98:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a9b:	85 d2                	test   %edx,%edx
+ a9d:	0f 84 8d 00 00 00    	je     b30 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ aa3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ aa5:	8b 48 04             	mov    0x4(%eax),%ecx
+ aa8:	39 f9                	cmp    %edi,%ecx
+ aaa:	73 64                	jae    b10 <malloc+0x90>
+  if(nu < 4096)
+ aac:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ ab1:	39 df                	cmp    %ebx,%edi
+ ab3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ ab6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ abd:	eb 0a                	jmp    ac9 <malloc+0x49>
+ abf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ac0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ac2:	8b 48 04             	mov    0x4(%eax),%ecx
+ ac5:	39 f9                	cmp    %edi,%ecx
+ ac7:	73 47                	jae    b10 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ ac9:	89 c2                	mov    %eax,%edx
+ acb:	39 05 e0 2e 00 00    	cmp    %eax,0x2ee0
+ ad1:	75 ed                	jne    ac0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ ad3:	83 ec 0c             	sub    $0xc,%esp
+ ad6:	56                   	push   %esi
+ ad7:	e8 ba fa ff ff       	call   596 <sbrk>
+  if(p == (char*)-1)
+ adc:	83 c4 10             	add    $0x10,%esp
+ adf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ae2:	74 1c                	je     b00 <malloc+0x80>
+  hp->s.size = nu;
+ ae4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ ae7:	83 ec 0c             	sub    $0xc,%esp
+ aea:	83 c0 08             	add    $0x8,%eax
+ aed:	50                   	push   %eax
+ aee:	e8 fd fe ff ff       	call   9f0 <free>
+  return freep;
+ af3:	8b 15 e0 2e 00 00    	mov    0x2ee0,%edx
+      if((p = morecore(nunits)) == 0)
+ af9:	83 c4 10             	add    $0x10,%esp
+ afc:	85 d2                	test   %edx,%edx
+ afe:	75 c0                	jne    ac0 <malloc+0x40>
+        return 0;
+  }
+}
+ b00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b03:	31 c0                	xor    %eax,%eax
+}
+ b05:	5b                   	pop    %ebx
+ b06:	5e                   	pop    %esi
+ b07:	5f                   	pop    %edi
+ b08:	5d                   	pop    %ebp
+ b09:	c3                   	ret
+ b0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ b10:	39 cf                	cmp    %ecx,%edi
+ b12:	74 4c                	je     b60 <malloc+0xe0>
+        p->s.size -= nunits;
+ b14:	29 f9                	sub    %edi,%ecx
+ b16:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ b19:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ b1c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ b1f:	89 15 e0 2e 00 00    	mov    %edx,0x2ee0
+}
+ b25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ b28:	83 c0 08             	add    $0x8,%eax
+}
+ b2b:	5b                   	pop    %ebx
+ b2c:	5e                   	pop    %esi
+ b2d:	5f                   	pop    %edi
+ b2e:	5d                   	pop    %ebp
+ b2f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ b30:	c7 05 e0 2e 00 00 e4 	movl   $0x2ee4,0x2ee0
+ b37:	2e 00 00 
+    base.s.size = 0;
+ b3a:	b8 e4 2e 00 00       	mov    $0x2ee4,%eax
+    base.s.ptr = freep = prevp = &base;
+ b3f:	c7 05 e4 2e 00 00 e4 	movl   $0x2ee4,0x2ee4
+ b46:	2e 00 00 
+    base.s.size = 0;
+ b49:	c7 05 e8 2e 00 00 00 	movl   $0x0,0x2ee8
+ b50:	00 00 00 
+    if(p->s.size >= nunits){
+ b53:	e9 54 ff ff ff       	jmp    aac <malloc+0x2c>
+ b58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b5f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ b60:	8b 08                	mov    (%eax),%ecx
+ b62:	89 0a                	mov    %ecx,(%edx)
+ b64:	eb b9                	jmp    b1f <malloc+0x9f>
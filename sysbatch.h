@@ -0,0 +1,9 @@
+// One system call in a batch() array.
+struct sysent {
+  int num;          // SYS_ number, from syscall.h
+  int args[6];      // Arguments, in the order they would be passed
+  int ret;          // Return value, filled in by the kernel
+};
+
+#define NBATCH          64   // most calls in one batch()
+#define BATCH_STOPERR  0x1   // stop after the first call that fails
@@ -6,6 +6,7 @@
 #include "proc.h"
 #include "x86.h"
 #include "syscall.h"
+#include "sysbatch.h"
 
 // User code makes a system call with INT T_SYSCALL.
 // System call number in %eax.
@@ -105,6 +106,19 @@ extern int sys_write(void);
 extern int sys_uptime(void);
 extern int sys_swapread(void);
 extern int sys_swapwrite(void);
+extern int sys_setaffinity(void);
+extern int sys_getaffinity(void);
+extern int sys_nanosleep(void);
+extern int sys_clocktime(void);
+extern int sys_aiosetup(void);
+extern int sys_aiowait(void);
+extern int sys_spawn(void);
+extern int sys_getprocinfo(void);
+extern int sys_getlockstat(void);
+extern int sys_lockprof(void);
+extern int sys_getlockprof(void);
+extern int sys_diskstat(void);
+static int sys_batch(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -130,20 +144,86 @@ static int (*syscalls[])(void) = {
 [SYS_close]   sys_close,
 [SYS_swapread]	sys_swapread,
 [SYS_swapwrite] sys_swapwrite,
+[SYS_setaffinity] sys_setaffinity,
+[SYS_getaffinity] sys_getaffinity,
+[SYS_nanosleep] sys_nanosleep,
+[SYS_clocktime] sys_clocktime,
+[SYS_batch]   sys_batch,
+[SYS_aiosetup] sys_aiosetup,
+[SYS_aiowait] sys_aiowait,
+[SYS_spawn]   sys_spawn,
+[SYS_getprocinfo] sys_getprocinfo,
+[SYS_getlockstat] sys_getlockstat,
+[SYS_lockprof] sys_lockprof,
+[SYS_getlockprof] sys_getlockprof,
+[SYS_diskstat] sys_diskstat,
 };
 
+static int
+dispatch(int num)
+{
+  struct proc *curproc = myproc();
+
+  if(num > 0 && num < NELEM(syscalls) && syscalls[num])
+    return syscalls[num]();
+  cprintf("%d %s: unknown sys call %d\n",
+          curproc->pid, curproc->name, num);
+  return -1;
+}
+
 void
 syscall(void)
 {
-  int num;
   struct proc *curproc = myproc();
 
-  num = curproc->tf->eax;
-  if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
-    curproc->tf->eax = syscalls[num]();
-  } else {
-    cprintf("%d %s: unknown sys call %d\n",
-            curproc->pid, curproc->name, num);
-    curproc->tf->eax = -1;
+  curproc->tf->eax = dispatch(curproc->tf->eax);
+}
+
+// Run the n calls in the struct sysent array ents, in order,
+// in one trip into the kernel:
+//   int batch(struct sysent *ents, int n, int flags)
+// Each call finds its arguments the usual way, because tf->esp
+// is pointed at its num field, a word below args[0].  Calls that
+// replace the trap frame or never return are refused.  Returns
+// the number of calls run; with BATCH_STOPERR the last of those
+// is the first one that failed.
+static int
+sys_batch(void)
+{
+  struct proc *curproc = myproc();
+  struct sysent *ents, *e;
+  int n, flags, i, ret;
+  uint esp;
+
+  if(argint(1, &n) < 0 || argint(2, &flags) < 0 || n < 0 || n > NBATCH)
+    return -1;
+  if(argptr(0, (void*)&ents, n*sizeof(*ents)) < 0)
+    return -1;
+
+  esp = curproc->tf->esp;
+  for(i = 0; i < n && !curproc->killed; i++){
+    e = &ents[i];
+    if((uint)(e+1) > curproc->sz)
+      break;
+    switch(e->num){
+    case SYS_fork:
+    case SYS_exec:
+    case SYS_exit:
+    case SYS_batch:
+      ret = -1;
+      break;
+    default:
+      curproc->tf->esp = (uint)&e->num;
+      ret = dispatch(e->num);
+      curproc->tf->esp = esp;
+      break;
+    }
+    // sbrk() may have shrunk the process out from under ents.
+    if((uint)(e+1) > curproc->sz)
+      return i + 1;
+    e->ret = ret;
+    if(ret < 0 && (flags & BATCH_STOPERR))
+      return i + 1;
   }
+  return i;
 }
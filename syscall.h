@@ -22,3 +22,16 @@
 #define SYS_close  21
 #define SYS_swapread	22
 #define SYS_swapwrite	23
+#define SYS_setaffinity 24
+#define SYS_getaffinity 25
+#define SYS_nanosleep 26
+#define SYS_clocktime 27
+#define SYS_batch  28
+#define SYS_aiosetup 29
+#define SYS_aiowait 30
+#define SYS_spawn  31
+#define SYS_getprocinfo 32
+#define SYS_getlockstat 33
+#define SYS_lockprof 34
+#define SYS_getlockprof 35
+#define SYS_diskstat 36
@@ -15,6 +15,7 @@
 #include "sleeplock.h"
 #include "file.h"
 #include "fcntl.h"
+#include "diskstat.h"
 
 // Fetch the nth word-sized system call argument as a file descriptor
 // and return both the descriptor and the corresponding struct file.
@@ -327,6 +328,8 @@ sys_open(void)
   f->type = FD_INODE;
   f->ip = ip;
   f->off = 0;
+  f->raend = 0;
+  f->ra = 0;
   f->readable = !(omode & O_WRONLY);
   f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
   return fd;
@@ -393,19 +396,17 @@ sys_chdir(void)
   return 0;
 }
 
-int
-sys_exec(void)
+// Fetch the null-terminated argument vector at user address
+// uargv into argv[MAXARG].
+static int
+fetchargv(uint uargv, char **argv)
 {
-  char *path, *argv[MAXARG];
   int i;
-  uint uargv, uarg;
+  uint uarg;
 
-  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
-    return -1;
-  }
-  memset(argv, 0, sizeof(argv));
+  memset(argv, 0, MAXARG*sizeof(argv[0]));
   for(i=0;; i++){
-    if(i >= NELEM(argv))
+    if(i >= MAXARG)
       return -1;
     if(fetchint(uargv+4*i, (int*)&uarg) < 0)
       return -1;
@@ -416,9 +417,41 @@ sys_exec(void)
     if(fetchstr(uarg, &argv[i]) < 0)
       return -1;
   }
+  return 0;
+}
+
+int
+sys_exec(void)
+{
+  char *path, *argv[MAXARG];
+  uint uargv;
+
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+    return -1;
+  }
+  if(fetchargv(uargv, argv) < 0)
+    return -1;
   return exec(path, argv);
 }
 
+// int spawn(char *path, char **argv, int *fdmap, int nfd)
+int
+sys_spawn(void)
+{
+  char *path, *argv[MAXARG];
+  int *fdmap, nfd;
+  uint uargv;
+
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0 ||
+     argint(3, &nfd) < 0 || argint(2, (int*)&fdmap) < 0)
+    return -1;
+  if(fdmap && (nfd < 0 || argptr(2, (void*)&fdmap, nfd*sizeof(int)) < 0))
+    return -1;
+  if(fetchargv(uargv, argv) < 0)
+    return -1;
+  return spawn(path, argv, fdmap, nfd);
+}
+
 int
 sys_pipe(void)
 {
@@ -466,3 +499,31 @@ int sys_swapwrite(void)
 	swapwrite(ptr, blkno);
 	return 0;
 }
+
+int
+sys_aiosetup(void)
+{
+  return aiosetup();
+}
+
+int
+sys_aiowait(void)
+{
+  int min;
+
+  if(argint(0, &min) < 0)
+    return -1;
+  return aiowait(min);
+}
+
+// int diskstat(struct diskstat *st)
+int
+sys_diskstat(void)
+{
+  struct diskstat *st;
+
+  if(argptr(0, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  getdiskstat(st);
+  return 0;
+}
@@ -6,6 +6,8 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "procinfo.h"
+#include "lockstat.h"
 
 int
 sys_fork(void)
@@ -59,24 +61,56 @@ sys_sbrk(void)
 int
 sys_sleep(void)
 {
-  int n;
-  uint ticks0;
+  int n, r;
 
   if(argint(0, &n) < 0)
     return -1;
   acquire(&tickslock);
-  ticks0 = ticks;
-  while(ticks - ticks0 < n){
-    if(myproc()->killed){
-      release(&tickslock);
-      return -1;
-    }
-    sleep(&ticks, &tickslock);
-  }
+  r = tsleep(ticks + n);
   release(&tickslock);
+  return r;
+}
+
+// Return the monotonic clock, nanoseconds since boot.
+int
+sys_clocktime(void)
+{
+  struct timespec *ts;
+
+  if(argptr(0, (void*)&ts, sizeof(*ts)) < 0)
+    return -1;
+  clockread(ts);
   return 0;
 }
 
+// Sleep for at least the given struct timespec.  Short
+// sleeps use the one-shot timer; longer ones are rounded
+// up to whole ticks.
+int
+sys_nanosleep(void)
+{
+  struct timespec *ts;
+  uint n, tickns;
+  int r;
+
+  tickns = 1000000000/HZ;
+  if(argptr(0, (void*)&ts, sizeof(*ts)) < 0 || ts->nsec >= 1000000000)
+    return -1;
+  if(ts->sec == 0 && ts->nsec < HRMAX){
+    if(ts->nsec == 0)
+      return 0;
+    return hrsleep(ts->nsec);
+  }
+  if(ts->sec >= 0x10000000/HZ)  // keep the deadline within range
+    n = 0x10000000;
+  else
+    n = ts->sec*HZ + (ts->nsec + tickns - 1)/tickns;
+  acquire(&tickslock);
+  r = tsleep(ticks + n + 1);  // the current tick is partly over
+  release(&tickslock);
+  return r;
+}
+
 // return how many clock tick interrupts have occurred
 // since start.
 int
@@ -89,3 +123,80 @@ sys_uptime(void)
   release(&tickslock);
   return xticks;
 }
+
+// int getprocinfo(struct procinfo *info, int n)
+int
+sys_getprocinfo(void)
+{
+  struct procinfo *info;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0 || n > NPROC ||
+     argptr(0, (void*)&info, n*sizeof(*info)) < 0)
+    return -1;
+  return getprocinfo(info, n);
+}
+
+// int getlockstat(struct lockstat *st, int n)
+int
+sys_getlockstat(void)
+{
+  struct lockstat *st;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0 || n > NLOCKSTAT ||
+     argptr(0, (void*)&st, n*sizeof(*st)) < 0)
+    return -1;
+  return getlockstat(st, n);
+}
+
+// Turn lock profiling on (nonzero) or off.
+int
+sys_lockprof(void)
+{
+  int on;
+
+  if(argint(0, &on) < 0)
+    return -1;
+  lockprof(on != 0);
+  return 0;
+}
+
+// int getlockprof(struct locksite *s, int n)
+int
+sys_getlockprof(void)
+{
+  struct locksite *s;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0 || n > NLOCKSITE ||
+     argptr(0, (void*)&s, n*sizeof(*s)) < 0)
+    return -1;
+  return getlockprof(s, n);
+}
+
+// Restrict a process (pid 0 means the caller) to a mask of CPUs.
+int
+sys_setaffinity(void)
+{
+  int pid, mask;
+
+  if(argint(0, &pid) < 0 || argint(1, &mask) < 0)
+    return -1;
+  if(pid == 0)
+    pid = myproc()->pid;
+  return setaffinity(pid, mask);
+}
+
+// Return the CPU mask of a process (pid 0 means the caller).
+int
+sys_getaffinity(void)
+{
+  int pid;
+
+  if(argint(0, &pid) < 0)
+    return -1;
+  if(pid == 0)
+    pid = myproc()->pid;
+  return getaffinity(pid);
+}
@@ -0,0 +1,22 @@
+// taskset: run a command restricted to a set of CPUs.
+// The mask is a bitmask of cpu numbers, e.g. 1 for cpu0 only.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+  if(argc < 3){
+    printf(2, "usage: taskset mask cmd [args...]\n");
+    exit();
+  }
+  if(setaffinity(0, atoi(argv[1])) < 0){
+    printf(2, "taskset: bad mask %s\n", argv[1]);
+    exit();
+  }
+  exec(argv[2], argv+2);
+  printf(2, "taskset: exec %s failed\n", argv[2]);
+  exit();
+}
@@ -0,0 +1,250 @@
+// Timers.
+//
+// Processes in sleep() wait on a timer wheel: an array of
+// lists indexed by wake-up tick modulo the wheel size.  Each
+// clock tick looks only at the list for that tick, so sleepers
+// are not woken up a hundred times a second just to find that
+// their time has not come yet.  The wheel is driven by ticks,
+// which only CPU 0 advances, and is protected by tickslock.
+//
+// Sleeps shorter than HRMAX (nanosleep) go on a per-CPU queue
+// kept in deadline order instead.  The local APIC timer runs
+// in one-shot mode and is re-armed after each interrupt for
+// whichever comes first: the CPU's next scheduler tick or the
+// earliest deadline on its queue.
+//
+// The monotonic clock read by clocktime() counts nanoseconds
+// since boot from the TSC, scaled by the rate measured against
+// the PIT in lapicinit().  It assumes the CPUs' TSCs run in step.
+// The calibration lives in the page mapped at UCLOCK, so user
+// programs can read the clock without a system call.
+
+#include "types.h"
+#include "date.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "x86.h"
+#include "upage.h"
+
+#define NWHEEL  64   // slots in the timer wheel
+
+struct {
+  struct proc *slot[NWHEEL];
+} wheel;
+
+// Each CPU keeps a clock in LAPIC timer counts, advanced
+// from the timer's current count whenever it is re-armed.
+// Time between the interrupt and the re-arm is lost, so the
+// clock runs slightly slow; it only orders nearby deadlines.
+struct cputimer {
+  struct spinlock lock;
+  uint now;           // Clock when the timer was last armed
+  uint armed;         // Count it was armed with
+  uint nexttick;      // Clock at which the next tick is due
+  struct proc *hrq;   // hrsleep()ers, earliest deadline first
+} cputimer[NCPU];
+
+// Current clock of t.  Caller must hold t->lock
+// and be running on t's CPU.
+static uint
+tnow(struct cputimer *t)
+{
+  return t->now + (t->armed - lapiccount());
+}
+
+// Arm t's CPU's timer for its next event, given the current
+// clock.  Caller must hold t->lock and be running on t's CPU.
+static void
+tarm(struct cputimer *t, uint now)
+{
+  uint next;
+
+  next = t->nexttick;
+  if(t->hrq && (int)(t->hrq->twhen - next) < 0)
+    next = t->hrq->twhen;
+  if((int)(next - now) <= 0)
+    next = now + 1;
+  t->now = now;
+  t->armed = next - now;
+  lapicarm(t->armed);
+}
+
+// Convert ns (less than HRMAX) to LAPIC timer counts.
+static uint
+nstocount(uint ns)
+{
+  uint perus, n;
+
+  perus = lapicperiod / (1000000/HZ);
+  n = (ns/1000)*perus + (ns%1000)*perus/1000;
+  return n ? n : 1;
+}
+
+// The clock page mapped read-only at UCLOCK in every process.
+// It also holds the kernel's own TSC calibration.
+char uclockpage[PGSIZE] __attribute__((aligned(PGSIZE)));
+#define uclock ((struct uclock*)uclockpage)
+
+void
+timerinit(void)
+{
+  struct cputimer *t;
+  uint rem;
+
+  if(cpuid() == 0 && tscperiod > ((uint64)(1000000000/HZ) << TSCSHIFT) >> 32){
+    uclock->tscmult = divl((uint64)(1000000000/HZ) << TSCSHIFT, tscperiod, &rem);
+    uclock->tscbase = rdtsc();
+  }
+
+  t = &cputimer[cpuid()];
+  initlock(&t->lock, "timer");
+  acquire(&t->lock);
+  t->nexttick = lapicperiod;
+  tarm(t, 0);
+  release(&t->lock);
+}
+
+// Read the monotonic clock.  Falls back to ticks
+// if the TSC could not be calibrated.
+void
+clockread(struct timespec *ts)
+{
+  uint t;
+
+  if(uclock->tscmult == 0){
+    acquire(&tickslock);
+    t = ticks;
+    release(&tickslock);
+    ts->sec = t / HZ;
+    ts->nsec = (t % HZ) * (1000000000/HZ);
+    return;
+  }
+  uclockread(uclock, rdtsc(), ts);
+}
+
+// Take p off the list at *pp, if it is there.
+static int
+tremove(struct proc **pp, struct proc *p)
+{
+  for(; *pp; pp = &(*pp)->tnext){
+    if(*pp == p){
+      *pp = p->tnext;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// Sleep until ticks reaches deadline.
+// Caller must hold tickslock.
+// Returns -1 if killed first.
+int
+tsleep(uint deadline)
+{
+  struct proc *p = myproc();
+  struct proc **pp;
+
+  while((int)(deadline - ticks) > 0){
+    if(p->killed)
+      return -1;
+    p->twhen = deadline;
+    pp = &wheel.slot[deadline % NWHEEL];
+    p->tnext = *pp;
+    *pp = p;
+    sleep(&p->twhen, &tickslock);
+    // The clock takes p off the wheel when it wakes it;
+    // a kill() leaves it there.
+    tremove(&wheel.slot[deadline % NWHEEL], p);
+  }
+  return 0;
+}
+
+// Sleep for ns nanoseconds (less than HRMAX) on this
+// CPU's one-shot timer.  Returns -1 if killed first.
+int
+hrsleep(uint ns)
+{
+  struct proc *p = myproc();
+  struct cputimer *t;
+  struct proc **pp;
+
+  pushcli();  // stay on this CPU until the lock is held
+  t = &cputimer[cpuid()];
+  acquire(&t->lock);
+  popcli();
+
+  p->twhen = tnow(t) + nstocount(ns);
+  for(pp = &t->hrq; *pp; pp = &(*pp)->tnext)
+    if((int)((*pp)->twhen - p->twhen) > 0)
+      break;
+  p->tnext = *pp;
+  *pp = p;
+  if(t->hrq == p)
+    tarm(t, tnow(t));
+
+  // timerintr() dequeues p when its time comes.  p may
+  // wake up on another CPU, but t->lock still guards t->hrq.
+  for(;;){
+    if(p->killed){
+      tremove(&t->hrq, p);
+      release(&t->lock);
+      return -1;
+    }
+    for(pp = &t->hrq; *pp && *pp != p; pp = &(*pp)->tnext)
+      ;
+    if(*pp == 0)
+      break;
+    sleep(&p->twhen, &t->lock);
+  }
+  release(&t->lock);
+  return 0;
+}
+
+// Handle this CPU's timer interrupt: run the scheduler tick
+// if one is due, wake expired hrsleep()ers, and re-arm.
+// Returns 1 if this interrupt was a scheduler tick.
+int
+timerintr(void)
+{
+  struct cputimer *t;
+  struct proc *p, **pp;
+  uint now;
+  int tick;
+
+  t = &cputimer[cpuid()];
+  acquire(&t->lock);
+  now = tnow(t);
+  tick = 0;
+  if((int)(now - t->nexttick) >= 0){
+    tick = 1;
+    t->nexttick += lapicperiod;
+    if((int)(now - t->nexttick) >= 0)  // fell behind; don't catch up
+      t->nexttick = now + lapicperiod;
+  }
+  while((p = t->hrq) != 0 && (int)(p->twhen - now) <= 0){
+    t->hrq = p->tnext;
+    wakeproc(p, &p->twhen);
+  }
+  tarm(t, tnow(t));
+  release(&t->lock);
+
+  if(!tick || cpuid() != 0)
+    return tick;
+  acquire(&tickslock);
+  ticks++;
+  uclock->ticks = ticks;
+  pp = &wheel.slot[ticks % NWHEEL];
+  while((p = *pp) != 0){
+    if((int)(p->twhen - ticks) <= 0){
+      *pp = p->tnext;
+      wakeproc(p, &p->twhen);
+    } else
+      pp = &p->tnext;
+  }
+  release(&tickslock);
+  return 1;
+}
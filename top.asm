@@ -0,0 +1,2288 @@
+
+_top:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, " %d", n);
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 38             	sub    $0x38,%esp
+  int i, k, nsample, nold, ncur, t0, t1, dt;
+  uint du, ds;
+  char *state;
+
+  nsample = 3;
+  if(argc > 1)
+      14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+      17:	8b 51 04             	mov    0x4(%ecx),%edx
+  if(argc > 1)
+      1a:	0f 8f ca 05 00 00    	jg     5ea <main+0x5ea>
+    nsample = atoi(argv[1]);
+
+  nold = getprocinfo(old, NINFO);
+      20:	51                   	push   %ecx
+      21:	51                   	push   %ecx
+      22:	68 80 00 00 00       	push   $0x80
+      27:	68 00 34 00 00       	push   $0x3400
+      2c:	e8 1e 0d 00 00       	call   d4f <getprocinfo>
+      31:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  t0 = uptime();
+      34:	e8 d7 0b 00 00       	call   c10 <uptime>
+  nsample = 3;
+      39:	c7 45 b8 03 00 00 00 	movl   $0x3,-0x48(%ebp)
+  t0 = uptime();
+      40:	83 c4 10             	add    $0x10,%esp
+      43:	89 c6                	mov    %eax,%esi
+  for(k = 0; k < nsample; k++){
+      45:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+      4c:	89 f3                	mov    %esi,%ebx
+      4e:	66 90                	xchg   %ax,%ax
+    sleep(100);
+      50:	83 ec 0c             	sub    $0xc,%esp
+      53:	89 de                	mov    %ebx,%esi
+      55:	6a 64                	push   $0x64
+      57:	e8 97 0b 00 00       	call   bf3 <sleep>
+    ncur = getprocinfo(cur, NINFO);
+      5c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+      5f:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+      62:	58                   	pop    %eax
+      63:	5a                   	pop    %edx
+      64:	68 80 00 00 00       	push   $0x80
+      69:	68 00 16 00 00       	push   $0x1600
+      6e:	e8 dc 0c 00 00       	call   d4f <getprocinfo>
+      73:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    t1 = uptime();
+      76:	e8 95 0b 00 00       	call   c10 <uptime>
+    dt = t1 > t0 ? t1 - t0 : 1;
+      7b:	59                   	pop    %ecx
+      7c:	5f                   	pop    %edi
+  for(m = n, w--; m >= 10; m /= 10)
+      7d:	bf cd cc cc cc       	mov    $0xcccccccd,%edi
+    dt = t1 > t0 ? t1 - t0 : 1;
+      82:	89 c2                	mov    %eax,%edx
+    t1 = uptime();
+      84:	89 c3                	mov    %eax,%ebx
+    dt = t1 > t0 ? t1 - t0 : 1;
+      86:	29 f2                	sub    %esi,%edx
+      88:	39 f0                	cmp    %esi,%eax
+      8a:	b8 01 00 00 00       	mov    $0x1,%eax
+      8f:	0f 4f c2             	cmovg  %edx,%eax
+      92:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+    printf(1, "\n   PID  PPID CPU%%  USER   SYS   CSW   FLT   RSS BREAD BWRITE STATE  NAME\n");
+      95:	68 e0 11 00 00       	push   $0x11e0
+      9a:	6a 01                	push   $0x1
+      9c:	e8 df 0d 00 00       	call   e80 <printf>
+    for(i = 0; i < ncur; i++){
+      a1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+      a4:	c7 45 e4 2c 16 00 00 	movl   $0x162c,-0x1c(%ebp)
+      ab:	83 c4 10             	add    $0x10,%esp
+      ae:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+      b5:	85 c0                	test   %eax,%eax
+      b7:	0f 8e ef 04 00 00    	jle    5ac <main+0x5ac>
+      bd:	89 5d bc             	mov    %ebx,-0x44(%ebp)
+      p = &cur[i];
+      du = p->utime;
+      c0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for(i = 0; i < n; i++)
+      c3:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+      du = p->utime;
+      c6:	8b 48 e4             	mov    -0x1c(%eax),%ecx
+      c9:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+      ds = p->stime;
+      cc:	8b 48 e8             	mov    -0x18(%eax),%ecx
+      cf:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+      if((o = lookup(old, nold, p->pid)) != 0){
+      d2:	8b 48 d4             	mov    -0x2c(%eax),%ecx
+      d5:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  for(i = 0; i < n; i++)
+      d8:	85 db                	test   %ebx,%ebx
+      da:	7e 26                	jle    102 <main+0x102>
+      dc:	b8 00 34 00 00       	mov    $0x3400,%eax
+      e1:	31 d2                	xor    %edx,%edx
+      e3:	eb 0d                	jmp    f2 <main+0xf2>
+      e5:	8d 76 00             	lea    0x0(%esi),%esi
+      e8:	83 c2 01             	add    $0x1,%edx
+      eb:	83 c0 3c             	add    $0x3c,%eax
+      ee:	39 da                	cmp    %ebx,%edx
+      f0:	74 10                	je     102 <main+0x102>
+    if(info[i].pid == pid)
+      f2:	3b 08                	cmp    (%eax),%ecx
+      f4:	75 f2                	jne    e8 <main+0xe8>
+        du -= o->utime;
+      f6:	8b 70 10             	mov    0x10(%eax),%esi
+        ds -= o->stime;
+      f9:	8b 40 14             	mov    0x14(%eax),%eax
+        du -= o->utime;
+      fc:	29 75 d8             	sub    %esi,-0x28(%ebp)
+        ds -= o->stime;
+      ff:	29 45 d4             	sub    %eax,-0x2c(%ebp)
+      }
+      if(p->state >= 0 && p->state < sizeof(states)/sizeof(states[0]))
+     102:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+        state = states[p->state];
+      else
+        state = "???";
+     105:	c7 45 d0 ae 11 00 00 	movl   $0x11ae,-0x30(%ebp)
+      if(p->state >= 0 && p->state < sizeof(states)/sizeof(states[0]))
+     10c:	8b 40 dc             	mov    -0x24(%eax),%eax
+     10f:	83 f8 05             	cmp    $0x5,%eax
+     112:	77 0a                	ja     11e <main+0x11e>
+        state = states[p->state];
+     114:	8b 04 85 dc 15 00 00 	mov    0x15dc(,%eax,4),%eax
+     11b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  for(m = n, w--; m >= 10; m /= 10)
+     11e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     121:	83 f8 09             	cmp    $0x9,%eax
+     124:	0f 86 b6 04 00 00    	jbe    5e0 <main+0x5e0>
+     12a:	89 c2                	mov    %eax,%edx
+     12c:	be 04 00 00 00       	mov    $0x4,%esi
+     131:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     138:	89 d0                	mov    %edx,%eax
+     13a:	89 d3                	mov    %edx,%ebx
+     13c:	89 f1                	mov    %esi,%ecx
+    w--;
+     13e:	83 ee 01             	sub    $0x1,%esi
+  for(m = n, w--; m >= 10; m /= 10)
+     141:	f7 e7                	mul    %edi
+     143:	c1 ea 03             	shr    $0x3,%edx
+     146:	83 fb 63             	cmp    $0x63,%ebx
+     149:	77 ed                	ja     138 <main+0x138>
+  while(w-- > 0)
+     14b:	8d 59 fe             	lea    -0x2(%ecx),%ebx
+     14e:	85 f6                	test   %esi,%esi
+     150:	7e 21                	jle    173 <main+0x173>
+     152:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(1, " ");
+     158:	83 ec 08             	sub    $0x8,%esp
+     15b:	68 a8 11 00 00       	push   $0x11a8
+     160:	6a 01                	push   $0x1
+     162:	e8 19 0d 00 00       	call   e80 <printf>
+  while(w-- > 0)
+     167:	89 d8                	mov    %ebx,%eax
+     169:	83 c4 10             	add    $0x10,%esp
+     16c:	83 eb 01             	sub    $0x1,%ebx
+     16f:	85 c0                	test   %eax,%eax
+     171:	7f e5                	jg     158 <main+0x158>
+  printf(1, " %d", n);
+     173:	83 ec 04             	sub    $0x4,%esp
+     176:	ff 75 dc             	push   -0x24(%ebp)
+  for(m = n, w--; m >= 10; m /= 10)
+     179:	be 04 00 00 00       	mov    $0x4,%esi
+  while(w-- > 0)
+     17e:	bb 03 00 00 00       	mov    $0x3,%ebx
+  printf(1, " %d", n);
+     183:	68 aa 11 00 00       	push   $0x11aa
+     188:	6a 01                	push   $0x1
+     18a:	e8 f1 0c 00 00       	call   e80 <printf>
+      col(p->pid, 5);
+      col(p->ppid, 5);
+     18f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for(m = n, w--; m >= 10; m /= 10)
+     192:	83 c4 10             	add    $0x10,%esp
+      col(p->ppid, 5);
+     195:	8b 40 d8             	mov    -0x28(%eax),%eax
+     198:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  for(m = n, w--; m >= 10; m /= 10)
+     19b:	89 c2                	mov    %eax,%edx
+     19d:	83 f8 09             	cmp    $0x9,%eax
+     1a0:	76 26                	jbe    1c8 <main+0x1c8>
+     1a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     1a8:	89 d0                	mov    %edx,%eax
+     1aa:	89 d3                	mov    %edx,%ebx
+     1ac:	89 f1                	mov    %esi,%ecx
+    w--;
+     1ae:	83 ee 01             	sub    $0x1,%esi
+  for(m = n, w--; m >= 10; m /= 10)
+     1b1:	f7 e7                	mul    %edi
+     1b3:	c1 ea 03             	shr    $0x3,%edx
+     1b6:	83 fb 63             	cmp    $0x63,%ebx
+     1b9:	77 ed                	ja     1a8 <main+0x1a8>
+  while(w-- > 0)
+     1bb:	8d 59 fe             	lea    -0x2(%ecx),%ebx
+     1be:	85 f6                	test   %esi,%esi
+     1c0:	7e 21                	jle    1e3 <main+0x1e3>
+     1c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(1, " ");
+     1c8:	83 ec 08             	sub    $0x8,%esp
+     1cb:	68 a8 11 00 00       	push   $0x11a8
+     1d0:	6a 01                	push   $0x1
+     1d2:	e8 a9 0c 00 00       	call   e80 <printf>
+  while(w-- > 0)
+     1d7:	89 d8                	mov    %ebx,%eax
+     1d9:	83 c4 10             	add    $0x10,%esp
+     1dc:	83 eb 01             	sub    $0x1,%ebx
+     1df:	85 c0                	test   %eax,%eax
+     1e1:	7f e5                	jg     1c8 <main+0x1c8>
+  printf(1, " %d", n);
+     1e3:	83 ec 04             	sub    $0x4,%esp
+     1e6:	ff 75 dc             	push   -0x24(%ebp)
+  for(m = n, w--; m >= 10; m /= 10)
+     1e9:	be 03 00 00 00       	mov    $0x3,%esi
+  while(w-- > 0)
+     1ee:	bb 02 00 00 00       	mov    $0x2,%ebx
+  printf(1, " %d", n);
+     1f3:	68 aa 11 00 00       	push   $0x11aa
+     1f8:	6a 01                	push   $0x1
+     1fa:	e8 81 0c 00 00       	call   e80 <printf>
+      col((du + ds) * 100 / dt, 4);
+     1ff:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     202:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     205:	31 d2                	xor    %edx,%edx
+  for(m = n, w--; m >= 10; m /= 10)
+     207:	83 c4 10             	add    $0x10,%esp
+      col((du + ds) * 100 / dt, 4);
+     20a:	01 c8                	add    %ecx,%eax
+     20c:	6b c0 64             	imul   $0x64,%eax,%eax
+     20f:	f7 75 c8             	divl   -0x38(%ebp)
+     212:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  for(m = n, w--; m >= 10; m /= 10)
+     215:	89 c2                	mov    %eax,%edx
+     217:	83 f8 09             	cmp    $0x9,%eax
+     21a:	76 24                	jbe    240 <main+0x240>
+     21c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     220:	89 d0                	mov    %edx,%eax
+     222:	89 d3                	mov    %edx,%ebx
+     224:	89 f1                	mov    %esi,%ecx
+    w--;
+     226:	83 ee 01             	sub    $0x1,%esi
+  for(m = n, w--; m >= 10; m /= 10)
+     229:	f7 e7                	mul    %edi
+     22b:	c1 ea 03             	shr    $0x3,%edx
+     22e:	83 fb 63             	cmp    $0x63,%ebx
+     231:	77 ed                	ja     220 <main+0x220>
+  while(w-- > 0)
+     233:	8d 59 fe             	lea    -0x2(%ecx),%ebx
+     236:	85 f6                	test   %esi,%esi
+     238:	7e 21                	jle    25b <main+0x25b>
+     23a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(1, " ");
+     240:	83 ec 08             	sub    $0x8,%esp
+     243:	68 a8 11 00 00       	push   $0x11a8
+     248:	6a 01                	push   $0x1
+     24a:	e8 31 0c 00 00       	call   e80 <printf>
+  while(w-- > 0)
+     24f:	89 d8                	mov    %ebx,%eax
+     251:	83 c4 10             	add    $0x10,%esp
+     254:	83 eb 01             	sub    $0x1,%ebx
+     257:	85 c0                	test   %eax,%eax
+     259:	7f e5                	jg     240 <main+0x240>
+  printf(1, " %d", n);
+     25b:	83 ec 04             	sub    $0x4,%esp
+     25e:	ff 75 dc             	push   -0x24(%ebp)
+  for(m = n, w--; m >= 10; m /= 10)
+     261:	be 04 00 00 00       	mov    $0x4,%esi
+  while(w-- > 0)
+     266:	bb 03 00 00 00       	mov    $0x3,%ebx
+  printf(1, " %d", n);
+     26b:	68 aa 11 00 00       	push   $0x11aa
+     270:	6a 01                	push   $0x1
+     272:	e8 09 0c 00 00       	call   e80 <printf>
+      col(p->utime, 5);
+     277:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for(m = n, w--; m >= 10; m /= 10)
+     27a:	83 c4 10             	add    $0x10,%esp
+      col(p->utime, 5);
+     27d:	8b 40 e4             	mov    -0x1c(%eax),%eax
+     280:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  for(m = n, w--; m >= 10; m /= 10)
+     283:	89 c2                	mov    %eax,%edx
+     285:	83 f8 09             	cmp    $0x9,%eax
+     288:	76 26                	jbe    2b0 <main+0x2b0>
+     28a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     290:	89 d0                	mov    %edx,%eax
+     292:	89 d3                	mov    %edx,%ebx
+     294:	89 f1                	mov    %esi,%ecx
+    w--;
+     296:	83 ee 01             	sub    $0x1,%esi
+  for(m = n, w--; m >= 10; m /= 10)
+     299:	f7 e7                	mul    %edi
+     29b:	c1 ea 03             	shr    $0x3,%edx
+     29e:	83 fb 63             	cmp    $0x63,%ebx
+     2a1:	77 ed                	ja     290 <main+0x290>
+  while(w-- > 0)
+     2a3:	8d 59 fe             	lea    -0x2(%ecx),%ebx
+     2a6:	85 f6                	test   %esi,%esi
+     2a8:	7e 21                	jle    2cb <main+0x2cb>
+     2aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(1, " ");
+     2b0:	83 ec 08             	sub    $0x8,%esp
+     2b3:	68 a8 11 00 00       	push   $0x11a8
+     2b8:	6a 01                	push   $0x1
+     2ba:	e8 c1 0b 00 00       	call   e80 <printf>
+  while(w-- > 0)
+     2bf:	89 d8                	mov    %ebx,%eax
+     2c1:	83 c4 10             	add    $0x10,%esp
+     2c4:	83 eb 01             	sub    $0x1,%ebx
+     2c7:	85 c0                	test   %eax,%eax
+     2c9:	7f e5                	jg     2b0 <main+0x2b0>
+  printf(1, " %d", n);
+     2cb:	83 ec 04             	sub    $0x4,%esp
+     2ce:	ff 75 dc             	push   -0x24(%ebp)
+  for(m = n, w--; m >= 10; m /= 10)
+     2d1:	be 04 00 00 00       	mov    $0x4,%esi
+  while(w-- > 0)
+     2d6:	bb 03 00 00 00       	mov    $0x3,%ebx
+  printf(1, " %d", n);
+     2db:	68 aa 11 00 00       	push   $0x11aa
+     2e0:	6a 01                	push   $0x1
+     2e2:	e8 99 0b 00 00       	call   e80 <printf>
+      col(p->stime, 5);
+     2e7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for(m = n, w--; m >= 10; m /= 10)
+     2ea:	83 c4 10             	add    $0x10,%esp
+      col(p->stime, 5);
+     2ed:	8b 40 e8             	mov    -0x18(%eax),%eax
+     2f0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  for(m = n, w--; m >= 10; m /= 10)
+     2f3:	89 c2                	mov    %eax,%edx
+     2f5:	83 f8 09             	cmp    $0x9,%eax
+     2f8:	76 26                	jbe    320 <main+0x320>
+     2fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     300:	89 d0                	mov    %edx,%eax
+     302:	89 d3                	mov    %edx,%ebx
+     304:	89 f1                	mov    %esi,%ecx
+    w--;
+     306:	83 ee 01             	sub    $0x1,%esi
+  for(m = n, w--; m >= 10; m /= 10)
+     309:	f7 e7                	mul    %edi
+     30b:	c1 ea 03             	shr    $0x3,%edx
+     30e:	83 fb 63             	cmp    $0x63,%ebx
+     311:	77 ed                	ja     300 <main+0x300>
+  while(w-- > 0)
+     313:	8d 59 fe             	lea    -0x2(%ecx),%ebx
+     316:	85 f6                	test   %esi,%esi
+     318:	7e 21                	jle    33b <main+0x33b>
+     31a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(1, " ");
+     320:	83 ec 08             	sub    $0x8,%esp
+     323:	68 a8 11 00 00       	push   $0x11a8
+     328:	6a 01                	push   $0x1
+     32a:	e8 51 0b 00 00       	call   e80 <printf>
+  while(w-- > 0)
+     32f:	89 d8                	mov    %ebx,%eax
+     331:	83 c4 10             	add    $0x10,%esp
+     334:	83 eb 01             	sub    $0x1,%ebx
+     337:	85 c0                	test   %eax,%eax
+     339:	7f e5                	jg     320 <main+0x320>
+  printf(1, " %d", n);
+     33b:	83 ec 04             	sub    $0x4,%esp
+     33e:	ff 75 dc             	push   -0x24(%ebp)
+  for(m = n, w--; m >= 10; m /= 10)
+     341:	be 04 00 00 00       	mov    $0x4,%esi
+  while(w-- > 0)
+     346:	bb 03 00 00 00       	mov    $0x3,%ebx
+  printf(1, " %d", n);
+     34b:	68 aa 11 00 00       	push   $0x11aa
+     350:	6a 01                	push   $0x1
+     352:	e8 29 0b 00 00       	call   e80 <printf>
+      col(p->nswitch, 5);
+     357:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for(m = n, w--; m >= 10; m /= 10)
+     35a:	83 c4 10             	add    $0x10,%esp
+      col(p->nswitch, 5);
+     35d:	8b 40 ec             	mov    -0x14(%eax),%eax
+     360:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  for(m = n, w--; m >= 10; m /= 10)
+     363:	89 c2                	mov    %eax,%edx
+     365:	83 f8 09             	cmp    $0x9,%eax
+     368:	76 26                	jbe    390 <main+0x390>
+     36a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     370:	89 d0                	mov    %edx,%eax
+     372:	89 d3                	mov    %edx,%ebx
+     374:	89 f1                	mov    %esi,%ecx
+    w--;
+     376:	83 ee 01             	sub    $0x1,%esi
+  for(m = n, w--; m >= 10; m /= 10)
+     379:	f7 e7                	mul    %edi
+     37b:	c1 ea 03             	shr    $0x3,%edx
+     37e:	83 fb 63             	cmp    $0x63,%ebx
+     381:	77 ed                	ja     370 <main+0x370>
+  while(w-- > 0)
+     383:	8d 59 fe             	lea    -0x2(%ecx),%ebx
+     386:	85 f6                	test   %esi,%esi
+     388:	7e 21                	jle    3ab <main+0x3ab>
+     38a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(1, " ");
+     390:	83 ec 08             	sub    $0x8,%esp
+     393:	68 a8 11 00 00       	push   $0x11a8
+     398:	6a 01                	push   $0x1
+     39a:	e8 e1 0a 00 00       	call   e80 <printf>
+  while(w-- > 0)
+     39f:	89 d8                	mov    %ebx,%eax
+     3a1:	83 c4 10             	add    $0x10,%esp
+     3a4:	83 eb 01             	sub    $0x1,%ebx
+     3a7:	85 c0                	test   %eax,%eax
+     3a9:	7f e5                	jg     390 <main+0x390>
+  printf(1, " %d", n);
+     3ab:	83 ec 04             	sub    $0x4,%esp
+     3ae:	ff 75 dc             	push   -0x24(%ebp)
+  for(m = n, w--; m >= 10; m /= 10)
+     3b1:	be 04 00 00 00       	mov    $0x4,%esi
+  while(w-- > 0)
+     3b6:	bb 03 00 00 00       	mov    $0x3,%ebx
+  printf(1, " %d", n);
+     3bb:	68 aa 11 00 00       	push   $0x11aa
+     3c0:	6a 01                	push   $0x1
+     3c2:	e8 b9 0a 00 00       	call   e80 <printf>
+      col(p->nfault, 5);
+     3c7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for(m = n, w--; m >= 10; m /= 10)
+     3ca:	83 c4 10             	add    $0x10,%esp
+      col(p->nfault, 5);
+     3cd:	8b 40 f0             	mov    -0x10(%eax),%eax
+     3d0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  for(m = n, w--; m >= 10; m /= 10)
+     3d3:	89 c2                	mov    %eax,%edx
+     3d5:	83 f8 09             	cmp    $0x9,%eax
+     3d8:	76 26                	jbe    400 <main+0x400>
+     3da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     3e0:	89 d0                	mov    %edx,%eax
+     3e2:	89 d3                	mov    %edx,%ebx
+     3e4:	89 f1                	mov    %esi,%ecx
+    w--;
+     3e6:	83 ee 01             	sub    $0x1,%esi
+  for(m = n, w--; m >= 10; m /= 10)
+     3e9:	f7 e7                	mul    %edi
+     3eb:	c1 ea 03             	shr    $0x3,%edx
+     3ee:	83 fb 63             	cmp    $0x63,%ebx
+     3f1:	77 ed                	ja     3e0 <main+0x3e0>
+  while(w-- > 0)
+     3f3:	8d 59 fe             	lea    -0x2(%ecx),%ebx
+     3f6:	85 f6                	test   %esi,%esi
+     3f8:	7e 21                	jle    41b <main+0x41b>
+     3fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(1, " ");
+     400:	83 ec 08             	sub    $0x8,%esp
+     403:	68 a8 11 00 00       	push   $0x11a8
+     408:	6a 01                	push   $0x1
+     40a:	e8 71 0a 00 00       	call   e80 <printf>
+  while(w-- > 0)
+     40f:	89 d8                	mov    %ebx,%eax
+     411:	83 c4 10             	add    $0x10,%esp
+     414:	83 eb 01             	sub    $0x1,%ebx
+     417:	85 c0                	test   %eax,%eax
+     419:	7f e5                	jg     400 <main+0x400>
+  printf(1, " %d", n);
+     41b:	83 ec 04             	sub    $0x4,%esp
+     41e:	ff 75 dc             	push   -0x24(%ebp)
+  for(m = n, w--; m >= 10; m /= 10)
+     421:	be 04 00 00 00       	mov    $0x4,%esi
+  while(w-- > 0)
+     426:	bb 03 00 00 00       	mov    $0x3,%ebx
+  printf(1, " %d", n);
+     42b:	68 aa 11 00 00       	push   $0x11aa
+     430:	6a 01                	push   $0x1
+     432:	e8 49 0a 00 00       	call   e80 <printf>
+      col(p->rss, 5);
+     437:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for(m = n, w--; m >= 10; m /= 10)
+     43a:	83 c4 10             	add    $0x10,%esp
+      col(p->rss, 5);
+     43d:	8b 40 fc             	mov    -0x4(%eax),%eax
+     440:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  for(m = n, w--; m >= 10; m /= 10)
+     443:	89 c2                	mov    %eax,%edx
+     445:	83 f8 09             	cmp    $0x9,%eax
+     448:	76 26                	jbe    470 <main+0x470>
+     44a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     450:	89 d0                	mov    %edx,%eax
+     452:	89 d3                	mov    %edx,%ebx
+     454:	89 f1                	mov    %esi,%ecx
+    w--;
+     456:	83 ee 01             	sub    $0x1,%esi
+  for(m = n, w--; m >= 10; m /= 10)
+     459:	f7 e7                	mul    %edi
+     45b:	c1 ea 03             	shr    $0x3,%edx
+     45e:	83 fb 63             	cmp    $0x63,%ebx
+     461:	77 ed                	ja     450 <main+0x450>
+  while(w-- > 0)
+     463:	8d 59 fe             	lea    -0x2(%ecx),%ebx
+     466:	85 f6                	test   %esi,%esi
+     468:	7e 21                	jle    48b <main+0x48b>
+     46a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(1, " ");
+     470:	83 ec 08             	sub    $0x8,%esp
+     473:	68 a8 11 00 00       	push   $0x11a8
+     478:	6a 01                	push   $0x1
+     47a:	e8 01 0a 00 00       	call   e80 <printf>
+  while(w-- > 0)
+     47f:	89 d8                	mov    %ebx,%eax
+     481:	83 c4 10             	add    $0x10,%esp
+     484:	83 eb 01             	sub    $0x1,%ebx
+     487:	85 c0                	test   %eax,%eax
+     489:	7f e5                	jg     470 <main+0x470>
+  printf(1, " %d", n);
+     48b:	83 ec 04             	sub    $0x4,%esp
+     48e:	ff 75 dc             	push   -0x24(%ebp)
+  for(m = n, w--; m >= 10; m /= 10)
+     491:	be 04 00 00 00       	mov    $0x4,%esi
+  while(w-- > 0)
+     496:	bb 03 00 00 00       	mov    $0x3,%ebx
+  printf(1, " %d", n);
+     49b:	68 aa 11 00 00       	push   $0x11aa
+     4a0:	6a 01                	push   $0x1
+     4a2:	e8 d9 09 00 00       	call   e80 <printf>
+      col(p->nbread, 5);
+     4a7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for(m = n, w--; m >= 10; m /= 10)
+     4aa:	83 c4 10             	add    $0x10,%esp
+      col(p->nbread, 5);
+     4ad:	8b 40 f4             	mov    -0xc(%eax),%eax
+     4b0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  for(m = n, w--; m >= 10; m /= 10)
+     4b3:	89 c2                	mov    %eax,%edx
+     4b5:	83 f8 09             	cmp    $0x9,%eax
+     4b8:	76 26                	jbe    4e0 <main+0x4e0>
+     4ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     4c0:	89 d0                	mov    %edx,%eax
+     4c2:	89 d3                	mov    %edx,%ebx
+     4c4:	89 f1                	mov    %esi,%ecx
+    w--;
+     4c6:	83 ee 01             	sub    $0x1,%esi
+  for(m = n, w--; m >= 10; m /= 10)
+     4c9:	f7 e7                	mul    %edi
+     4cb:	c1 ea 03             	shr    $0x3,%edx
+     4ce:	83 fb 63             	cmp    $0x63,%ebx
+     4d1:	77 ed                	ja     4c0 <main+0x4c0>
+  while(w-- > 0)
+     4d3:	8d 59 fe             	lea    -0x2(%ecx),%ebx
+     4d6:	85 f6                	test   %esi,%esi
+     4d8:	7e 21                	jle    4fb <main+0x4fb>
+     4da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(1, " ");
+     4e0:	83 ec 08             	sub    $0x8,%esp
+     4e3:	68 a8 11 00 00       	push   $0x11a8
+     4e8:	6a 01                	push   $0x1
+     4ea:	e8 91 09 00 00       	call   e80 <printf>
+  while(w-- > 0)
+     4ef:	89 d8                	mov    %ebx,%eax
+     4f1:	83 c4 10             	add    $0x10,%esp
+     4f4:	83 eb 01             	sub    $0x1,%ebx
+     4f7:	85 c0                	test   %eax,%eax
+     4f9:	7f e5                	jg     4e0 <main+0x4e0>
+  printf(1, " %d", n);
+     4fb:	83 ec 04             	sub    $0x4,%esp
+     4fe:	ff 75 dc             	push   -0x24(%ebp)
+  for(m = n, w--; m >= 10; m /= 10)
+     501:	be 05 00 00 00       	mov    $0x5,%esi
+  while(w-- > 0)
+     506:	bb 04 00 00 00       	mov    $0x4,%ebx
+  printf(1, " %d", n);
+     50b:	68 aa 11 00 00       	push   $0x11aa
+     510:	6a 01                	push   $0x1
+     512:	e8 69 09 00 00       	call   e80 <printf>
+      col(p->nbwrite, 6);
+     517:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for(m = n, w--; m >= 10; m /= 10)
+     51a:	83 c4 10             	add    $0x10,%esp
+      col(p->nbwrite, 6);
+     51d:	8b 40 f8             	mov    -0x8(%eax),%eax
+     520:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  for(m = n, w--; m >= 10; m /= 10)
+     523:	89 c2                	mov    %eax,%edx
+     525:	83 f8 09             	cmp    $0x9,%eax
+     528:	76 26                	jbe    550 <main+0x550>
+     52a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     530:	89 d0                	mov    %edx,%eax
+     532:	89 d3                	mov    %edx,%ebx
+     534:	89 f1                	mov    %esi,%ecx
+    w--;
+     536:	83 ee 01             	sub    $0x1,%esi
+  for(m = n, w--; m >= 10; m /= 10)
+     539:	f7 e7                	mul    %edi
+     53b:	c1 ea 03             	shr    $0x3,%edx
+     53e:	83 fb 63             	cmp    $0x63,%ebx
+     541:	77 ed                	ja     530 <main+0x530>
+  while(w-- > 0)
+     543:	8d 59 fe             	lea    -0x2(%ecx),%ebx
+     546:	85 f6                	test   %esi,%esi
+     548:	7e 21                	jle    56b <main+0x56b>
+     54a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    printf(1, " ");
+     550:	83 ec 08             	sub    $0x8,%esp
+     553:	68 a8 11 00 00       	push   $0x11a8
+     558:	6a 01                	push   $0x1
+     55a:	e8 21 09 00 00       	call   e80 <printf>
+  while(w-- > 0)
+     55f:	89 d8                	mov    %ebx,%eax
+     561:	83 c4 10             	add    $0x10,%esp
+     564:	83 eb 01             	sub    $0x1,%ebx
+     567:	85 c0                	test   %eax,%eax
+     569:	7f e5                	jg     550 <main+0x550>
+  printf(1, " %d", n);
+     56b:	83 ec 04             	sub    $0x4,%esp
+     56e:	ff 75 dc             	push   -0x24(%ebp)
+     571:	68 aa 11 00 00       	push   $0x11aa
+     576:	6a 01                	push   $0x1
+     578:	e8 03 09 00 00       	call   e80 <printf>
+      printf(1, " %s %s\n", state, p->name);
+     57d:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     580:	56                   	push   %esi
+    for(i = 0; i < ncur; i++){
+     581:	83 c6 3c             	add    $0x3c,%esi
+      printf(1, " %s %s\n", state, p->name);
+     584:	ff 75 d0             	push   -0x30(%ebp)
+     587:	68 b2 11 00 00       	push   $0x11b2
+     58c:	6a 01                	push   $0x1
+     58e:	e8 ed 08 00 00       	call   e80 <printf>
+    for(i = 0; i < ncur; i++){
+     593:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+     597:	83 c4 20             	add    $0x20,%esp
+     59a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     59d:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+     5a0:	39 45 cc             	cmp    %eax,-0x34(%ebp)
+     5a3:	0f 85 17 fb ff ff    	jne    c0 <main+0xc0>
+     5a9:	8b 5d bc             	mov    -0x44(%ebp),%ebx
+    }
+    memmove(old, cur, sizeof(old));
+     5ac:	83 ec 04             	sub    $0x4,%esp
+     5af:	68 00 1e 00 00       	push   $0x1e00
+     5b4:	68 00 16 00 00       	push   $0x1600
+     5b9:	68 00 34 00 00       	push   $0x3400
+     5be:	e8 3d 03 00 00       	call   900 <memmove>
+  for(k = 0; k < nsample; k++){
+     5c3:	83 45 c0 01          	addl   $0x1,-0x40(%ebp)
+     5c7:	8b 7d b8             	mov    -0x48(%ebp),%edi
+     5ca:	83 c4 10             	add    $0x10,%esp
+     5cd:	8b 45 c0             	mov    -0x40(%ebp),%eax
+     5d0:	39 f8                	cmp    %edi,%eax
+     5d2:	0f 8c 78 fa ff ff    	jl     50 <main+0x50>
+    nold = ncur;
+    t0 = t1;
+  }
+  exit();
+     5d8:	e8 0c 04 00 00       	call   9e9 <exit>
+     5dd:	8d 76 00             	lea    0x0(%esi),%esi
+  while(w-- > 0)
+     5e0:	bb 03 00 00 00       	mov    $0x3,%ebx
+     5e5:	e9 6e fb ff ff       	jmp    158 <main+0x158>
+    nsample = atoi(argv[1]);
+     5ea:	83 ec 0c             	sub    $0xc,%esp
+     5ed:	ff 72 04             	push   0x4(%edx)
+     5f0:	e8 cb 02 00 00       	call   8c0 <atoi>
+     5f5:	89 45 b8             	mov    %eax,-0x48(%ebp)
+     5f8:	89 c7                	mov    %eax,%edi
+  nold = getprocinfo(old, NINFO);
+     5fa:	58                   	pop    %eax
+     5fb:	5a                   	pop    %edx
+     5fc:	68 80 00 00 00       	push   $0x80
+     601:	68 00 34 00 00       	push   $0x3400
+     606:	e8 44 07 00 00       	call   d4f <getprocinfo>
+     60b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  t0 = uptime();
+     60e:	e8 fd 05 00 00       	call   c10 <uptime>
+  for(k = 0; k < nsample; k++){
+     613:	83 c4 10             	add    $0x10,%esp
+  t0 = uptime();
+     616:	89 c6                	mov    %eax,%esi
+  for(k = 0; k < nsample; k++){
+     618:	85 ff                	test   %edi,%edi
+     61a:	0f 8f 25 fa ff ff    	jg     45 <main+0x45>
+     620:	eb b6                	jmp    5d8 <main+0x5d8>
+     622:	66 90                	xchg   %ax,%ax
+     624:	66 90                	xchg   %ax,%ax
+     626:	66 90                	xchg   %ax,%ax
+     628:	66 90                	xchg   %ax,%ax
+     62a:	66 90                	xchg   %ax,%ax
+     62c:	66 90                	xchg   %ax,%ax
+     62e:	66 90                	xchg   %ax,%ax
+
+00000630 <lookup>:
+{
+     630:	55                   	push   %ebp
+     631:	89 e5                	mov    %esp,%ebp
+     633:	53                   	push   %ebx
+     634:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     637:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  for(i = 0; i < n; i++)
+     63a:	85 c9                	test   %ecx,%ecx
+     63c:	7e 22                	jle    660 <lookup+0x30>
+     63e:	8b 45 08             	mov    0x8(%ebp),%eax
+     641:	31 d2                	xor    %edx,%edx
+     643:	eb 0d                	jmp    652 <lookup+0x22>
+     645:	8d 76 00             	lea    0x0(%esi),%esi
+     648:	83 c2 01             	add    $0x1,%edx
+     64b:	83 c0 3c             	add    $0x3c,%eax
+     64e:	39 d1                	cmp    %edx,%ecx
+     650:	74 0e                	je     660 <lookup+0x30>
+    if(info[i].pid == pid)
+     652:	39 18                	cmp    %ebx,(%eax)
+     654:	75 f2                	jne    648 <lookup+0x18>
+}
+     656:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     659:	c9                   	leave
+     65a:	c3                   	ret
+     65b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     65f:	90                   	nop
+     660:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return 0;
+     663:	31 c0                	xor    %eax,%eax
+}
+     665:	c9                   	leave
+     666:	c3                   	ret
+     667:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     66e:	66 90                	xchg   %ax,%ax
+
+00000670 <col>:
+{
+     670:	55                   	push   %ebp
+     671:	89 e5                	mov    %esp,%ebp
+     673:	57                   	push   %edi
+     674:	56                   	push   %esi
+     675:	53                   	push   %ebx
+     676:	83 ec 0c             	sub    $0xc,%esp
+  for(m = n, w--; m >= 10; m /= 10)
+     679:	8b 45 0c             	mov    0xc(%ebp),%eax
+{
+     67c:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(m = n, w--; m >= 10; m /= 10)
+     67f:	8d 58 ff             	lea    -0x1(%eax),%ebx
+     682:	83 fe 09             	cmp    $0x9,%esi
+     685:	76 1a                	jbe    6a1 <col+0x31>
+     687:	89 f2                	mov    %esi,%edx
+     689:	bf cd cc cc cc       	mov    $0xcccccccd,%edi
+     68e:	66 90                	xchg   %ax,%ax
+     690:	89 d0                	mov    %edx,%eax
+     692:	89 d1                	mov    %edx,%ecx
+    w--;
+     694:	83 eb 01             	sub    $0x1,%ebx
+  for(m = n, w--; m >= 10; m /= 10)
+     697:	f7 e7                	mul    %edi
+     699:	c1 ea 03             	shr    $0x3,%edx
+     69c:	83 f9 63             	cmp    $0x63,%ecx
+     69f:	77 ef                	ja     690 <col+0x20>
+  while(w-- > 0)
+     6a1:	8d 7b ff             	lea    -0x1(%ebx),%edi
+     6a4:	85 db                	test   %ebx,%ebx
+     6a6:	7e 22                	jle    6ca <col+0x5a>
+     6a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6af:	90                   	nop
+    printf(1, " ");
+     6b0:	83 ec 08             	sub    $0x8,%esp
+  while(w-- > 0)
+     6b3:	83 ef 01             	sub    $0x1,%edi
+    printf(1, " ");
+     6b6:	68 a8 11 00 00       	push   $0x11a8
+     6bb:	6a 01                	push   $0x1
+     6bd:	e8 be 07 00 00       	call   e80 <printf>
+  while(w-- > 0)
+     6c2:	83 c4 10             	add    $0x10,%esp
+     6c5:	83 ff ff             	cmp    $0xffffffff,%edi
+     6c8:	75 e6                	jne    6b0 <col+0x40>
+  printf(1, " %d", n);
+     6ca:	83 ec 04             	sub    $0x4,%esp
+     6cd:	56                   	push   %esi
+     6ce:	68 aa 11 00 00       	push   $0x11aa
+     6d3:	6a 01                	push   $0x1
+     6d5:	e8 a6 07 00 00       	call   e80 <printf>
+}
+     6da:	83 c4 10             	add    $0x10,%esp
+     6dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     6e0:	5b                   	pop    %ebx
+     6e1:	5e                   	pop    %esi
+     6e2:	5f                   	pop    %edi
+     6e3:	5d                   	pop    %ebp
+     6e4:	c3                   	ret
+     6e5:	66 90                	xchg   %ax,%ax
+     6e7:	66 90                	xchg   %ax,%ax
+     6e9:	66 90                	xchg   %ax,%ax
+     6eb:	66 90                	xchg   %ax,%ax
+     6ed:	66 90                	xchg   %ax,%ax
+     6ef:	90                   	nop
+
+000006f0 <strcpy>:
+#include "date.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     6f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     6f1:	31 c0                	xor    %eax,%eax
+{
+     6f3:	89 e5                	mov    %esp,%ebp
+     6f5:	53                   	push   %ebx
+     6f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     6f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     6fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     700:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     704:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     707:	83 c0 01             	add    $0x1,%eax
+     70a:	84 d2                	test   %dl,%dl
+     70c:	75 f2                	jne    700 <strcpy+0x10>
+    ;
+  return os;
+}
+     70e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     711:	89 c8                	mov    %ecx,%eax
+     713:	c9                   	leave
+     714:	c3                   	ret
+     715:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     71c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000720 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     720:	55                   	push   %ebp
+     721:	89 e5                	mov    %esp,%ebp
+     723:	53                   	push   %ebx
+     724:	8b 55 08             	mov    0x8(%ebp),%edx
+     727:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     72a:	0f b6 02             	movzbl (%edx),%eax
+     72d:	84 c0                	test   %al,%al
+     72f:	75 17                	jne    748 <strcmp+0x28>
+     731:	eb 3a                	jmp    76d <strcmp+0x4d>
+     733:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     737:	90                   	nop
+     738:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     73c:	83 c2 01             	add    $0x1,%edx
+     73f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     742:	84 c0                	test   %al,%al
+     744:	74 1a                	je     760 <strcmp+0x40>
+    p++, q++;
+     746:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     748:	0f b6 19             	movzbl (%ecx),%ebx
+     74b:	38 c3                	cmp    %al,%bl
+     74d:	74 e9                	je     738 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     74f:	29 d8                	sub    %ebx,%eax
+}
+     751:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     754:	c9                   	leave
+     755:	c3                   	ret
+     756:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     75d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     760:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     764:	31 c0                	xor    %eax,%eax
+     766:	29 d8                	sub    %ebx,%eax
+}
+     768:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     76b:	c9                   	leave
+     76c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     76d:	0f b6 19             	movzbl (%ecx),%ebx
+     770:	31 c0                	xor    %eax,%eax
+     772:	eb db                	jmp    74f <strcmp+0x2f>
+     774:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     77b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     77f:	90                   	nop
+
+00000780 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     780:	55                   	push   %ebp
+     781:	89 e5                	mov    %esp,%ebp
+     783:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     786:	80 3a 00             	cmpb   $0x0,(%edx)
+     789:	74 15                	je     7a0 <strlen+0x20>
+     78b:	31 c0                	xor    %eax,%eax
+     78d:	8d 76 00             	lea    0x0(%esi),%esi
+     790:	83 c0 01             	add    $0x1,%eax
+     793:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     797:	89 c1                	mov    %eax,%ecx
+     799:	75 f5                	jne    790 <strlen+0x10>
+    ;
+  return n;
+}
+     79b:	89 c8                	mov    %ecx,%eax
+     79d:	5d                   	pop    %ebp
+     79e:	c3                   	ret
+     79f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     7a0:	31 c9                	xor    %ecx,%ecx
+}
+     7a2:	5d                   	pop    %ebp
+     7a3:	89 c8                	mov    %ecx,%eax
+     7a5:	c3                   	ret
+     7a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     7b0:	55                   	push   %ebp
+     7b1:	89 e5                	mov    %esp,%ebp
+     7b3:	57                   	push   %edi
+     7b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     7b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     7ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+     7bd:	89 d7                	mov    %edx,%edi
+     7bf:	fc                   	cld
+     7c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     7c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     7c5:	89 d0                	mov    %edx,%eax
+     7c7:	c9                   	leave
+     7c8:	c3                   	ret
+     7c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000007d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     7d0:	55                   	push   %ebp
+     7d1:	89 e5                	mov    %esp,%ebp
+     7d3:	8b 45 08             	mov    0x8(%ebp),%eax
+     7d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     7da:	0f b6 10             	movzbl (%eax),%edx
+     7dd:	84 d2                	test   %dl,%dl
+     7df:	75 12                	jne    7f3 <strchr+0x23>
+     7e1:	eb 1d                	jmp    800 <strchr+0x30>
+     7e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     7e7:	90                   	nop
+     7e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     7ec:	83 c0 01             	add    $0x1,%eax
+     7ef:	84 d2                	test   %dl,%dl
+     7f1:	74 0d                	je     800 <strchr+0x30>
+    if(*s == c)
+     7f3:	38 d1                	cmp    %dl,%cl
+     7f5:	75 f1                	jne    7e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     7f7:	5d                   	pop    %ebp
+     7f8:	c3                   	ret
+     7f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     800:	31 c0                	xor    %eax,%eax
+}
+     802:	5d                   	pop    %ebp
+     803:	c3                   	ret
+     804:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     80b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     80f:	90                   	nop
+
+00000810 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     810:	55                   	push   %ebp
+     811:	89 e5                	mov    %esp,%ebp
+     813:	57                   	push   %edi
+     814:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     815:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     818:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     819:	31 db                	xor    %ebx,%ebx
+{
+     81b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     81e:	eb 27                	jmp    847 <gets+0x37>
+    cc = read(0, &c, 1);
+     820:	83 ec 04             	sub    $0x4,%esp
+     823:	6a 01                	push   $0x1
+     825:	56                   	push   %esi
+     826:	6a 00                	push   $0x0
+     828:	e8 13 02 00 00       	call   a40 <read>
+    if(cc < 1)
+     82d:	83 c4 10             	add    $0x10,%esp
+     830:	85 c0                	test   %eax,%eax
+     832:	7e 1d                	jle    851 <gets+0x41>
+      break;
+    buf[i++] = c;
+     834:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     838:	8b 55 08             	mov    0x8(%ebp),%edx
+     83b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     83f:	3c 0a                	cmp    $0xa,%al
+     841:	74 10                	je     853 <gets+0x43>
+     843:	3c 0d                	cmp    $0xd,%al
+     845:	74 0c                	je     853 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     847:	89 df                	mov    %ebx,%edi
+     849:	83 c3 01             	add    $0x1,%ebx
+     84c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     84f:	7c cf                	jl     820 <gets+0x10>
+     851:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     853:	8b 45 08             	mov    0x8(%ebp),%eax
+     856:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     85a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     85d:	5b                   	pop    %ebx
+     85e:	5e                   	pop    %esi
+     85f:	5f                   	pop    %edi
+     860:	5d                   	pop    %ebp
+     861:	c3                   	ret
+     862:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     869:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000870 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     870:	55                   	push   %ebp
+     871:	89 e5                	mov    %esp,%ebp
+     873:	56                   	push   %esi
+     874:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     875:	83 ec 08             	sub    $0x8,%esp
+     878:	6a 00                	push   $0x0
+     87a:	ff 75 08             	push   0x8(%ebp)
+     87d:	e8 4f 02 00 00       	call   ad1 <open>
+  if(fd < 0)
+     882:	83 c4 10             	add    $0x10,%esp
+     885:	85 c0                	test   %eax,%eax
+     887:	78 27                	js     8b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     889:	83 ec 08             	sub    $0x8,%esp
+     88c:	ff 75 0c             	push   0xc(%ebp)
+     88f:	89 c3                	mov    %eax,%ebx
+     891:	50                   	push   %eax
+     892:	e8 91 02 00 00       	call   b28 <fstat>
+  close(fd);
+     897:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     89a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     89c:	e8 d9 01 00 00       	call   a7a <close>
+  return r;
+     8a1:	83 c4 10             	add    $0x10,%esp
+}
+     8a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     8a7:	89 f0                	mov    %esi,%eax
+     8a9:	5b                   	pop    %ebx
+     8aa:	5e                   	pop    %esi
+     8ab:	5d                   	pop    %ebp
+     8ac:	c3                   	ret
+     8ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     8b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     8b5:	eb ed                	jmp    8a4 <stat+0x34>
+     8b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8be:	66 90                	xchg   %ax,%ax
+
+000008c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     8c0:	55                   	push   %ebp
+     8c1:	89 e5                	mov    %esp,%ebp
+     8c3:	53                   	push   %ebx
+     8c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     8c7:	0f be 02             	movsbl (%edx),%eax
+     8ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     8cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     8d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     8d5:	77 1e                	ja     8f5 <atoi+0x35>
+     8d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     8e0:	83 c2 01             	add    $0x1,%edx
+     8e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     8e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     8ea:	0f be 02             	movsbl (%edx),%eax
+     8ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     8f0:	80 fb 09             	cmp    $0x9,%bl
+     8f3:	76 eb                	jbe    8e0 <atoi+0x20>
+  return n;
+}
+     8f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     8f8:	89 c8                	mov    %ecx,%eax
+     8fa:	c9                   	leave
+     8fb:	c3                   	ret
+     8fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000900 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     900:	55                   	push   %ebp
+     901:	89 e5                	mov    %esp,%ebp
+     903:	57                   	push   %edi
+     904:	56                   	push   %esi
+     905:	8b 45 10             	mov    0x10(%ebp),%eax
+     908:	8b 55 08             	mov    0x8(%ebp),%edx
+     90b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     90e:	85 c0                	test   %eax,%eax
+     910:	7e 13                	jle    925 <memmove+0x25>
+     912:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     914:	89 d7                	mov    %edx,%edi
+     916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     91d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     920:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     921:	39 f8                	cmp    %edi,%eax
+     923:	75 fb                	jne    920 <memmove+0x20>
+  return vdst;
+}
+     925:	5e                   	pop    %esi
+     926:	89 d0                	mov    %edx,%eax
+     928:	5f                   	pop    %edi
+     929:	5d                   	pop    %ebp
+     92a:	c3                   	ret
+     92b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     92f:	90                   	nop
+
+00000930 <ugetpid>:
+// getpid() without a system call, from the page at UPROC.
+int
+ugetpid(void)
+{
+  return ((struct uproc*)UPROC)->pid;
+}
+     930:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+     935:	c3                   	ret
+     936:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     93d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000940 <uclocktime>:
+
+// clocktime() without a system call, from the page at UCLOCK.
+int
+uclocktime(struct timespec *ts)
+{
+     940:	55                   	push   %ebp
+     941:	89 e5                	mov    %esp,%ebp
+     943:	57                   	push   %edi
+     944:	56                   	push   %esi
+     945:	53                   	push   %ebx
+     946:	83 ec 1c             	sub    $0x1c,%esp
+  struct uclock *c = (struct uclock*)UCLOCK;
+
+  if(c->tscmult == 0)
+     949:	8b 0d 08 f0 ff 7f    	mov    0x7ffff008,%ecx
+{
+     94f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(c->tscmult == 0)
+     952:	85 c9                	test   %ecx,%ecx
+     954:	74 6a                	je     9c0 <uclocktime+0x80>
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+     956:	0f 31                	rdtsc
+static inline void
+uclockread(struct uclock *c, uint64 tsc, struct timespec *ts)
+{
+  uint64 d, ns;
+
+  d = tsc - c->tscbase;
+     958:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+     95e:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+     964:	89 c6                	mov    %eax,%esi
+  if((long long)d < 0)  // another CPU's TSC is a little behind
+     966:	85 d2                	test   %edx,%edx
+     968:	78 46                	js     9b0 <uclocktime+0x70>
+    d = 0;
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+     96a:	89 d0                	mov    %edx,%eax
+     96c:	f7 e1                	mul    %ecx
+     96e:	0f a4 c2 08          	shld   $0x8,%eax,%edx
+     972:	c1 e0 08             	shl    $0x8,%eax
+     975:	89 45 e0             	mov    %eax,-0x20(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+     978:	89 f0                	mov    %esi,%eax
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+     97a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+     97d:	f7 e1                	mul    %ecx
+     97f:	0f ac d0 18          	shrd   $0x18,%edx,%eax
+     983:	c1 ea 18             	shr    $0x18,%edx
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+     986:	03 45 e0             	add    -0x20(%ebp),%eax
+     989:	13 55 e4             	adc    -0x1c(%ebp),%edx
+// linked with libgcc, so it cannot use 64-bit '/' or '%'.
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+  asm("divl %4" : "=a" (q), "=d" (r) : "a" ((uint)n), "d" ((uint)(n>>32)), "rm" (d));
+     98c:	89 c7                	mov    %eax,%edi
+     98e:	89 f8                	mov    %edi,%eax
+     990:	b9 00 ca 9a 3b       	mov    $0x3b9aca00,%ecx
+     995:	f7 f1                	div    %ecx
+  ts->sec = divl(ns, 1000000000, &ts->nsec);
+     997:	89 03                	mov    %eax,(%ebx)
+    return clocktime(ts);
+  uclockread(c, rdtsc(), ts);
+  return 0;
+}
+     999:	31 c0                	xor    %eax,%eax
+  *rem = r;
+     99b:	89 53 04             	mov    %edx,0x4(%ebx)
+     99e:	83 c4 1c             	add    $0x1c,%esp
+     9a1:	5b                   	pop    %ebx
+     9a2:	5e                   	pop    %esi
+     9a3:	5f                   	pop    %edi
+     9a4:	5d                   	pop    %ebp
+     9a5:	c3                   	ret
+     9a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9ad:	8d 76 00             	lea    0x0(%esi),%esi
+     9b0:	31 d2                	xor    %edx,%edx
+     9b2:	31 ff                	xor    %edi,%edi
+     9b4:	eb d8                	jmp    98e <uclocktime+0x4e>
+     9b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9bd:	8d 76 00             	lea    0x0(%esi),%esi
+     9c0:	83 c4 1c             	add    $0x1c,%esp
+     9c3:	5b                   	pop    %ebx
+     9c4:	5e                   	pop    %esi
+     9c5:	5f                   	pop    %edi
+     9c6:	5d                   	pop    %ebp
+    return clocktime(ts);
+     9c7:	e9 f2 02 00 00       	jmp    cbe <clocktime>
+
+000009cc <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+     9cc:	b8 01 00 00 00       	mov    $0x1,%eax
+     9d1:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     9d8:	00 00 00 
+     9db:	74 09                	je     9e6 <fork+0x1a>
+     9dd:	89 e1                	mov    %esp,%ecx
+     9df:	ba e8 09 00 00       	mov    $0x9e8,%edx
+     9e4:	0f 34                	sysenter
+     9e6:	cd 40                	int    $0x40
+     9e8:	c3                   	ret
+
+000009e9 <exit>:
+SYSCALL(exit)
+     9e9:	b8 02 00 00 00       	mov    $0x2,%eax
+     9ee:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     9f5:	00 00 00 
+     9f8:	74 09                	je     a03 <exit+0x1a>
+     9fa:	89 e1                	mov    %esp,%ecx
+     9fc:	ba 05 0a 00 00       	mov    $0xa05,%edx
+     a01:	0f 34                	sysenter
+     a03:	cd 40                	int    $0x40
+     a05:	c3                   	ret
+
+00000a06 <wait>:
+SYSCALL(wait)
+     a06:	b8 03 00 00 00       	mov    $0x3,%eax
+     a0b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     a12:	00 00 00 
+     a15:	74 09                	je     a20 <wait+0x1a>
+     a17:	89 e1                	mov    %esp,%ecx
+     a19:	ba 22 0a 00 00       	mov    $0xa22,%edx
+     a1e:	0f 34                	sysenter
+     a20:	cd 40                	int    $0x40
+     a22:	c3                   	ret
+
+00000a23 <pipe>:
+SYSCALL(pipe)
+     a23:	b8 04 00 00 00       	mov    $0x4,%eax
+     a28:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     a2f:	00 00 00 
+     a32:	74 09                	je     a3d <pipe+0x1a>
+     a34:	89 e1                	mov    %esp,%ecx
+     a36:	ba 3f 0a 00 00       	mov    $0xa3f,%edx
+     a3b:	0f 34                	sysenter
+     a3d:	cd 40                	int    $0x40
+     a3f:	c3                   	ret
+
+00000a40 <read>:
+SYSCALL(read)
+     a40:	b8 05 00 00 00       	mov    $0x5,%eax
+     a45:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     a4c:	00 00 00 
+     a4f:	74 09                	je     a5a <read+0x1a>
+     a51:	89 e1                	mov    %esp,%ecx
+     a53:	ba 5c 0a 00 00       	mov    $0xa5c,%edx
+     a58:	0f 34                	sysenter
+     a5a:	cd 40                	int    $0x40
+     a5c:	c3                   	ret
+
+00000a5d <write>:
+SYSCALL(write)
+     a5d:	b8 10 00 00 00       	mov    $0x10,%eax
+     a62:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     a69:	00 00 00 
+     a6c:	74 09                	je     a77 <write+0x1a>
+     a6e:	89 e1                	mov    %esp,%ecx
+     a70:	ba 79 0a 00 00       	mov    $0xa79,%edx
+     a75:	0f 34                	sysenter
+     a77:	cd 40                	int    $0x40
+     a79:	c3                   	ret
+
+00000a7a <close>:
+SYSCALL(close)
+     a7a:	b8 15 00 00 00       	mov    $0x15,%eax
+     a7f:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     a86:	00 00 00 
+     a89:	74 09                	je     a94 <close+0x1a>
+     a8b:	89 e1                	mov    %esp,%ecx
+     a8d:	ba 96 0a 00 00       	mov    $0xa96,%edx
+     a92:	0f 34                	sysenter
+     a94:	cd 40                	int    $0x40
+     a96:	c3                   	ret
+
+00000a97 <kill>:
+SYSCALL(kill)
+     a97:	b8 06 00 00 00       	mov    $0x6,%eax
+     a9c:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     aa3:	00 00 00 
+     aa6:	74 09                	je     ab1 <kill+0x1a>
+     aa8:	89 e1                	mov    %esp,%ecx
+     aaa:	ba b3 0a 00 00       	mov    $0xab3,%edx
+     aaf:	0f 34                	sysenter
+     ab1:	cd 40                	int    $0x40
+     ab3:	c3                   	ret
+
+00000ab4 <exec>:
+SYSCALL(exec)
+     ab4:	b8 07 00 00 00       	mov    $0x7,%eax
+     ab9:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     ac0:	00 00 00 
+     ac3:	74 09                	je     ace <exec+0x1a>
+     ac5:	89 e1                	mov    %esp,%ecx
+     ac7:	ba d0 0a 00 00       	mov    $0xad0,%edx
+     acc:	0f 34                	sysenter
+     ace:	cd 40                	int    $0x40
+     ad0:	c3                   	ret
+
+00000ad1 <open>:
+SYSCALL(open)
+     ad1:	b8 0f 00 00 00       	mov    $0xf,%eax
+     ad6:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     add:	00 00 00 
+     ae0:	74 09                	je     aeb <open+0x1a>
+     ae2:	89 e1                	mov    %esp,%ecx
+     ae4:	ba ed 0a 00 00       	mov    $0xaed,%edx
+     ae9:	0f 34                	sysenter
+     aeb:	cd 40                	int    $0x40
+     aed:	c3                   	ret
+
+00000aee <mknod>:
+SYSCALL(mknod)
+     aee:	b8 11 00 00 00       	mov    $0x11,%eax
+     af3:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     afa:	00 00 00 
+     afd:	74 09                	je     b08 <mknod+0x1a>
+     aff:	89 e1                	mov    %esp,%ecx
+     b01:	ba 0a 0b 00 00       	mov    $0xb0a,%edx
+     b06:	0f 34                	sysenter
+     b08:	cd 40                	int    $0x40
+     b0a:	c3                   	ret
+
+00000b0b <unlink>:
+SYSCALL(unlink)
+     b0b:	b8 12 00 00 00       	mov    $0x12,%eax
+     b10:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     b17:	00 00 00 
+     b1a:	74 09                	je     b25 <unlink+0x1a>
+     b1c:	89 e1                	mov    %esp,%ecx
+     b1e:	ba 27 0b 00 00       	mov    $0xb27,%edx
+     b23:	0f 34                	sysenter
+     b25:	cd 40                	int    $0x40
+     b27:	c3                   	ret
+
+00000b28 <fstat>:
+SYSCALL(fstat)
+     b28:	b8 08 00 00 00       	mov    $0x8,%eax
+     b2d:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     b34:	00 00 00 
+     b37:	74 09                	je     b42 <fstat+0x1a>
+     b39:	89 e1                	mov    %esp,%ecx
+     b3b:	ba 44 0b 00 00       	mov    $0xb44,%edx
+     b40:	0f 34                	sysenter
+     b42:	cd 40                	int    $0x40
+     b44:	c3                   	ret
+
+00000b45 <link>:
+SYSCALL(link)
+     b45:	b8 13 00 00 00       	mov    $0x13,%eax
+     b4a:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     b51:	00 00 00 
+     b54:	74 09                	je     b5f <link+0x1a>
+     b56:	89 e1                	mov    %esp,%ecx
+     b58:	ba 61 0b 00 00       	mov    $0xb61,%edx
+     b5d:	0f 34                	sysenter
+     b5f:	cd 40                	int    $0x40
+     b61:	c3                   	ret
+
+00000b62 <mkdir>:
+SYSCALL(mkdir)
+     b62:	b8 14 00 00 00       	mov    $0x14,%eax
+     b67:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     b6e:	00 00 00 
+     b71:	74 09                	je     b7c <mkdir+0x1a>
+     b73:	89 e1                	mov    %esp,%ecx
+     b75:	ba 7e 0b 00 00       	mov    $0xb7e,%edx
+     b7a:	0f 34                	sysenter
+     b7c:	cd 40                	int    $0x40
+     b7e:	c3                   	ret
+
+00000b7f <chdir>:
+SYSCALL(chdir)
+     b7f:	b8 09 00 00 00       	mov    $0x9,%eax
+     b84:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     b8b:	00 00 00 
+     b8e:	74 09                	je     b99 <chdir+0x1a>
+     b90:	89 e1                	mov    %esp,%ecx
+     b92:	ba 9b 0b 00 00       	mov    $0xb9b,%edx
+     b97:	0f 34                	sysenter
+     b99:	cd 40                	int    $0x40
+     b9b:	c3                   	ret
+
+00000b9c <dup>:
+SYSCALL(dup)
+     b9c:	b8 0a 00 00 00       	mov    $0xa,%eax
+     ba1:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     ba8:	00 00 00 
+     bab:	74 09                	je     bb6 <dup+0x1a>
+     bad:	89 e1                	mov    %esp,%ecx
+     baf:	ba b8 0b 00 00       	mov    $0xbb8,%edx
+     bb4:	0f 34                	sysenter
+     bb6:	cd 40                	int    $0x40
+     bb8:	c3                   	ret
+
+00000bb9 <getpid>:
+SYSCALL(getpid)
+     bb9:	b8 0b 00 00 00       	mov    $0xb,%eax
+     bbe:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     bc5:	00 00 00 
+     bc8:	74 09                	je     bd3 <getpid+0x1a>
+     bca:	89 e1                	mov    %esp,%ecx
+     bcc:	ba d5 0b 00 00       	mov    $0xbd5,%edx
+     bd1:	0f 34                	sysenter
+     bd3:	cd 40                	int    $0x40
+     bd5:	c3                   	ret
+
+00000bd6 <sbrk>:
+SYSCALL(sbrk)
+     bd6:	b8 0c 00 00 00       	mov    $0xc,%eax
+     bdb:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     be2:	00 00 00 
+     be5:	74 09                	je     bf0 <sbrk+0x1a>
+     be7:	89 e1                	mov    %esp,%ecx
+     be9:	ba f2 0b 00 00       	mov    $0xbf2,%edx
+     bee:	0f 34                	sysenter
+     bf0:	cd 40                	int    $0x40
+     bf2:	c3                   	ret
+
+00000bf3 <sleep>:
+SYSCALL(sleep)
+     bf3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     bf8:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     bff:	00 00 00 
+     c02:	74 09                	je     c0d <sleep+0x1a>
+     c04:	89 e1                	mov    %esp,%ecx
+     c06:	ba 0f 0c 00 00       	mov    $0xc0f,%edx
+     c0b:	0f 34                	sysenter
+     c0d:	cd 40                	int    $0x40
+     c0f:	c3                   	ret
+
+00000c10 <uptime>:
+SYSCALL(uptime)
+     c10:	b8 0e 00 00 00       	mov    $0xe,%eax
+     c15:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     c1c:	00 00 00 
+     c1f:	74 09                	je     c2a <uptime+0x1a>
+     c21:	89 e1                	mov    %esp,%ecx
+     c23:	ba 2c 0c 00 00       	mov    $0xc2c,%edx
+     c28:	0f 34                	sysenter
+     c2a:	cd 40                	int    $0x40
+     c2c:	c3                   	ret
+
+00000c2d <swapread>:
+SYSCALL(swapread)
+     c2d:	b8 16 00 00 00       	mov    $0x16,%eax
+     c32:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     c39:	00 00 00 
+     c3c:	74 09                	je     c47 <swapread+0x1a>
+     c3e:	89 e1                	mov    %esp,%ecx
+     c40:	ba 49 0c 00 00       	mov    $0xc49,%edx
+     c45:	0f 34                	sysenter
+     c47:	cd 40                	int    $0x40
+     c49:	c3                   	ret
+
+00000c4a <swapwrite>:
+SYSCALL(swapwrite)
+     c4a:	b8 17 00 00 00       	mov    $0x17,%eax
+     c4f:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     c56:	00 00 00 
+     c59:	74 09                	je     c64 <swapwrite+0x1a>
+     c5b:	89 e1                	mov    %esp,%ecx
+     c5d:	ba 66 0c 00 00       	mov    $0xc66,%edx
+     c62:	0f 34                	sysenter
+     c64:	cd 40                	int    $0x40
+     c66:	c3                   	ret
+
+00000c67 <setaffinity>:
+SYSCALL(setaffinity)
+     c67:	b8 18 00 00 00       	mov    $0x18,%eax
+     c6c:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     c73:	00 00 00 
+     c76:	74 09                	je     c81 <setaffinity+0x1a>
+     c78:	89 e1                	mov    %esp,%ecx
+     c7a:	ba 83 0c 00 00       	mov    $0xc83,%edx
+     c7f:	0f 34                	sysenter
+     c81:	cd 40                	int    $0x40
+     c83:	c3                   	ret
+
+00000c84 <getaffinity>:
+SYSCALL(getaffinity)
+     c84:	b8 19 00 00 00       	mov    $0x19,%eax
+     c89:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     c90:	00 00 00 
+     c93:	74 09                	je     c9e <getaffinity+0x1a>
+     c95:	89 e1                	mov    %esp,%ecx
+     c97:	ba a0 0c 00 00       	mov    $0xca0,%edx
+     c9c:	0f 34                	sysenter
+     c9e:	cd 40                	int    $0x40
+     ca0:	c3                   	ret
+
+00000ca1 <nanosleep>:
+SYSCALL(nanosleep)
+     ca1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     ca6:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     cad:	00 00 00 
+     cb0:	74 09                	je     cbb <nanosleep+0x1a>
+     cb2:	89 e1                	mov    %esp,%ecx
+     cb4:	ba bd 0c 00 00       	mov    $0xcbd,%edx
+     cb9:	0f 34                	sysenter
+     cbb:	cd 40                	int    $0x40
+     cbd:	c3                   	ret
+
+00000cbe <clocktime>:
+SYSCALL(clocktime)
+     cbe:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     cc3:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     cca:	00 00 00 
+     ccd:	74 09                	je     cd8 <clocktime+0x1a>
+     ccf:	89 e1                	mov    %esp,%ecx
+     cd1:	ba da 0c 00 00       	mov    $0xcda,%edx
+     cd6:	0f 34                	sysenter
+     cd8:	cd 40                	int    $0x40
+     cda:	c3                   	ret
+
+00000cdb <batch>:
+SYSCALL(batch)
+     cdb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     ce0:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     ce7:	00 00 00 
+     cea:	74 09                	je     cf5 <batch+0x1a>
+     cec:	89 e1                	mov    %esp,%ecx
+     cee:	ba f7 0c 00 00       	mov    $0xcf7,%edx
+     cf3:	0f 34                	sysenter
+     cf5:	cd 40                	int    $0x40
+     cf7:	c3                   	ret
+
+00000cf8 <aiosetup>:
+SYSCALL(aiosetup)
+     cf8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     cfd:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     d04:	00 00 00 
+     d07:	74 09                	je     d12 <aiosetup+0x1a>
+     d09:	89 e1                	mov    %esp,%ecx
+     d0b:	ba 14 0d 00 00       	mov    $0xd14,%edx
+     d10:	0f 34                	sysenter
+     d12:	cd 40                	int    $0x40
+     d14:	c3                   	ret
+
+00000d15 <aiowait>:
+SYSCALL(aiowait)
+     d15:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     d1a:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     d21:	00 00 00 
+     d24:	74 09                	je     d2f <aiowait+0x1a>
+     d26:	89 e1                	mov    %esp,%ecx
+     d28:	ba 31 0d 00 00       	mov    $0xd31,%edx
+     d2d:	0f 34                	sysenter
+     d2f:	cd 40                	int    $0x40
+     d31:	c3                   	ret
+
+00000d32 <spawn>:
+SYSCALL(spawn)
+     d32:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     d37:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     d3e:	00 00 00 
+     d41:	74 09                	je     d4c <spawn+0x1a>
+     d43:	89 e1                	mov    %esp,%ecx
+     d45:	ba 4e 0d 00 00       	mov    $0xd4e,%edx
+     d4a:	0f 34                	sysenter
+     d4c:	cd 40                	int    $0x40
+     d4e:	c3                   	ret
+
+00000d4f <getprocinfo>:
+SYSCALL(getprocinfo)
+     d4f:	b8 20 00 00 00       	mov    $0x20,%eax
+     d54:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     d5b:	00 00 00 
+     d5e:	74 09                	je     d69 <getprocinfo+0x1a>
+     d60:	89 e1                	mov    %esp,%ecx
+     d62:	ba 6b 0d 00 00       	mov    $0xd6b,%edx
+     d67:	0f 34                	sysenter
+     d69:	cd 40                	int    $0x40
+     d6b:	c3                   	ret
+
+00000d6c <getlockstat>:
+SYSCALL(getlockstat)
+     d6c:	b8 21 00 00 00       	mov    $0x21,%eax
+     d71:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     d78:	00 00 00 
+     d7b:	74 09                	je     d86 <getlockstat+0x1a>
+     d7d:	89 e1                	mov    %esp,%ecx
+     d7f:	ba 88 0d 00 00       	mov    $0xd88,%edx
+     d84:	0f 34                	sysenter
+     d86:	cd 40                	int    $0x40
+     d88:	c3                   	ret
+
+00000d89 <lockprof>:
+SYSCALL(lockprof)
+     d89:	b8 22 00 00 00       	mov    $0x22,%eax
+     d8e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     d95:	00 00 00 
+     d98:	74 09                	je     da3 <lockprof+0x1a>
+     d9a:	89 e1                	mov    %esp,%ecx
+     d9c:	ba a5 0d 00 00       	mov    $0xda5,%edx
+     da1:	0f 34                	sysenter
+     da3:	cd 40                	int    $0x40
+     da5:	c3                   	ret
+
+00000da6 <getlockprof>:
+SYSCALL(getlockprof)
+     da6:	b8 23 00 00 00       	mov    $0x23,%eax
+     dab:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     db2:	00 00 00 
+     db5:	74 09                	je     dc0 <getlockprof+0x1a>
+     db7:	89 e1                	mov    %esp,%ecx
+     db9:	ba c2 0d 00 00       	mov    $0xdc2,%edx
+     dbe:	0f 34                	sysenter
+     dc0:	cd 40                	int    $0x40
+     dc2:	c3                   	ret
+
+00000dc3 <diskstat>:
+SYSCALL(diskstat)
+     dc3:	b8 24 00 00 00       	mov    $0x24,%eax
+     dc8:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+     dcf:	00 00 00 
+     dd2:	74 09                	je     ddd <diskstat+0x1a>
+     dd4:	89 e1                	mov    %esp,%ecx
+     dd6:	ba df 0d 00 00       	mov    $0xddf,%edx
+     ddb:	0f 34                	sysenter
+     ddd:	cd 40                	int    $0x40
+     ddf:	c3                   	ret
+
+00000de0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     de0:	55                   	push   %ebp
+     de1:	89 e5                	mov    %esp,%ebp
+     de3:	57                   	push   %edi
+     de4:	56                   	push   %esi
+     de5:	53                   	push   %ebx
+     de6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     de8:	89 d1                	mov    %edx,%ecx
+{
+     dea:	83 ec 3c             	sub    $0x3c,%esp
+     ded:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     df0:	85 d2                	test   %edx,%edx
+     df2:	0f 89 80 00 00 00    	jns    e78 <printint+0x98>
+     df8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     dfc:	74 7a                	je     e78 <printint+0x98>
+    x = -xx;
+     dfe:	f7 d9                	neg    %ecx
+    neg = 1;
+     e00:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     e05:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     e08:	31 f6                	xor    %esi,%esi
+     e0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     e10:	89 c8                	mov    %ecx,%eax
+     e12:	31 d2                	xor    %edx,%edx
+     e14:	89 f7                	mov    %esi,%edi
+     e16:	f7 f3                	div    %ebx
+     e18:	8d 76 01             	lea    0x1(%esi),%esi
+     e1b:	0f b6 92 8c 12 00 00 	movzbl 0x128c(%edx),%edx
+     e22:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     e26:	89 ca                	mov    %ecx,%edx
+     e28:	89 c1                	mov    %eax,%ecx
+     e2a:	39 da                	cmp    %ebx,%edx
+     e2c:	73 e2                	jae    e10 <printint+0x30>
+  if(neg)
+     e2e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     e31:	85 c0                	test   %eax,%eax
+     e33:	74 07                	je     e3c <printint+0x5c>
+    buf[i++] = '-';
+     e35:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     e3a:	89 f7                	mov    %esi,%edi
+     e3c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     e3f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     e42:	01 df                	add    %ebx,%edi
+     e44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     e48:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     e4b:	83 ec 04             	sub    $0x4,%esp
+     e4e:	88 45 d7             	mov    %al,-0x29(%ebp)
+     e51:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     e54:	6a 01                	push   $0x1
+     e56:	50                   	push   %eax
+     e57:	56                   	push   %esi
+     e58:	e8 00 fc ff ff       	call   a5d <write>
+  while(--i >= 0)
+     e5d:	89 f8                	mov    %edi,%eax
+     e5f:	83 c4 10             	add    $0x10,%esp
+     e62:	83 ef 01             	sub    $0x1,%edi
+     e65:	39 d8                	cmp    %ebx,%eax
+     e67:	75 df                	jne    e48 <printint+0x68>
+}
+     e69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e6c:	5b                   	pop    %ebx
+     e6d:	5e                   	pop    %esi
+     e6e:	5f                   	pop    %edi
+     e6f:	5d                   	pop    %ebp
+     e70:	c3                   	ret
+     e71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     e78:	31 c0                	xor    %eax,%eax
+     e7a:	eb 89                	jmp    e05 <printint+0x25>
+     e7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000e80 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     e80:	55                   	push   %ebp
+     e81:	89 e5                	mov    %esp,%ebp
+     e83:	57                   	push   %edi
+     e84:	56                   	push   %esi
+     e85:	53                   	push   %ebx
+     e86:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     e89:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+     e8c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     e8f:	0f b6 1e             	movzbl (%esi),%ebx
+     e92:	83 c6 01             	add    $0x1,%esi
+     e95:	84 db                	test   %bl,%bl
+     e97:	74 67                	je     f00 <printf+0x80>
+     e99:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     e9c:	31 d2                	xor    %edx,%edx
+     e9e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     ea1:	eb 34                	jmp    ed7 <printf+0x57>
+     ea3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ea7:	90                   	nop
+     ea8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+     eab:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+     eb0:	83 f8 25             	cmp    $0x25,%eax
+     eb3:	74 18                	je     ecd <printf+0x4d>
+  write(fd, &c, 1);
+     eb5:	83 ec 04             	sub    $0x4,%esp
+     eb8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     ebb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     ebe:	6a 01                	push   $0x1
+     ec0:	50                   	push   %eax
+     ec1:	57                   	push   %edi
+     ec2:	e8 96 fb ff ff       	call   a5d <write>
+     ec7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+     eca:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     ecd:	0f b6 1e             	movzbl (%esi),%ebx
+     ed0:	83 c6 01             	add    $0x1,%esi
+     ed3:	84 db                	test   %bl,%bl
+     ed5:	74 29                	je     f00 <printf+0x80>
+    c = fmt[i] & 0xff;
+     ed7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     eda:	85 d2                	test   %edx,%edx
+     edc:	74 ca                	je     ea8 <printf+0x28>
+      }
+    } else if(state == '%'){
+     ede:	83 fa 25             	cmp    $0x25,%edx
+     ee1:	75 ea                	jne    ecd <printf+0x4d>
+      if(c == 'd'){
+     ee3:	83 f8 25             	cmp    $0x25,%eax
+     ee6:	0f 84 24 01 00 00    	je     1010 <printf+0x190>
+     eec:	83 e8 63             	sub    $0x63,%eax
+     eef:	83 f8 15             	cmp    $0x15,%eax
+     ef2:	77 1c                	ja     f10 <printf+0x90>
+     ef4:	ff 24 85 34 12 00 00 	jmp    *0x1234(,%eax,4)
+     efb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     eff:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+     f00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f03:	5b                   	pop    %ebx
+     f04:	5e                   	pop    %esi
+     f05:	5f                   	pop    %edi
+     f06:	5d                   	pop    %ebp
+     f07:	c3                   	ret
+     f08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f0f:	90                   	nop
+  write(fd, &c, 1);
+     f10:	83 ec 04             	sub    $0x4,%esp
+     f13:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     f16:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+     f1a:	6a 01                	push   $0x1
+     f1c:	52                   	push   %edx
+     f1d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     f20:	57                   	push   %edi
+     f21:	e8 37 fb ff ff       	call   a5d <write>
+     f26:	83 c4 0c             	add    $0xc,%esp
+     f29:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     f2c:	6a 01                	push   $0x1
+     f2e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     f31:	52                   	push   %edx
+     f32:	57                   	push   %edi
+     f33:	e8 25 fb ff ff       	call   a5d <write>
+        putc(fd, c);
+     f38:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     f3b:	31 d2                	xor    %edx,%edx
+     f3d:	eb 8e                	jmp    ecd <printf+0x4d>
+     f3f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+     f40:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     f43:	83 ec 0c             	sub    $0xc,%esp
+     f46:	b9 10 00 00 00       	mov    $0x10,%ecx
+     f4b:	8b 13                	mov    (%ebx),%edx
+     f4d:	6a 00                	push   $0x0
+     f4f:	89 f8                	mov    %edi,%eax
+        ap++;
+     f51:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+     f54:	e8 87 fe ff ff       	call   de0 <printint>
+        ap++;
+     f59:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     f5c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     f5f:	31 d2                	xor    %edx,%edx
+     f61:	e9 67 ff ff ff       	jmp    ecd <printf+0x4d>
+     f66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f6d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     f70:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     f73:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     f75:	83 c0 04             	add    $0x4,%eax
+     f78:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+     f7b:	85 db                	test   %ebx,%ebx
+     f7d:	0f 84 9d 00 00 00    	je     1020 <printf+0x1a0>
+        while(*s != 0){
+     f83:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+     f86:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+     f88:	84 c0                	test   %al,%al
+     f8a:	0f 84 3d ff ff ff    	je     ecd <printf+0x4d>
+     f90:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     f93:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+     f96:	89 de                	mov    %ebx,%esi
+     f98:	89 d3                	mov    %edx,%ebx
+     f9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+     fa0:	83 ec 04             	sub    $0x4,%esp
+     fa3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+     fa6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+     fa9:	6a 01                	push   $0x1
+     fab:	53                   	push   %ebx
+     fac:	57                   	push   %edi
+     fad:	e8 ab fa ff ff       	call   a5d <write>
+        while(*s != 0){
+     fb2:	0f b6 06             	movzbl (%esi),%eax
+     fb5:	83 c4 10             	add    $0x10,%esp
+     fb8:	84 c0                	test   %al,%al
+     fba:	75 e4                	jne    fa0 <printf+0x120>
+      state = 0;
+     fbc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     fbf:	31 d2                	xor    %edx,%edx
+     fc1:	e9 07 ff ff ff       	jmp    ecd <printf+0x4d>
+     fc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fcd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+     fd0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     fd3:	83 ec 0c             	sub    $0xc,%esp
+     fd6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     fdb:	8b 13                	mov    (%ebx),%edx
+     fdd:	6a 01                	push   $0x1
+     fdf:	e9 6b ff ff ff       	jmp    f4f <printf+0xcf>
+     fe4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+     fe8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+     feb:	83 ec 04             	sub    $0x4,%esp
+     fee:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+     ff1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+     ff3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+     ff6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+     ff9:	6a 01                	push   $0x1
+     ffb:	52                   	push   %edx
+     ffc:	57                   	push   %edi
+     ffd:	e8 5b fa ff ff       	call   a5d <write>
+        ap++;
+    1002:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1005:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1008:	31 d2                	xor    %edx,%edx
+    100a:	e9 be fe ff ff       	jmp    ecd <printf+0x4d>
+    100f:	90                   	nop
+  write(fd, &c, 1);
+    1010:	83 ec 04             	sub    $0x4,%esp
+    1013:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1016:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1019:	6a 01                	push   $0x1
+    101b:	e9 11 ff ff ff       	jmp    f31 <printf+0xb1>
+    1020:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1025:	bb 2c 12 00 00       	mov    $0x122c,%ebx
+    102a:	e9 61 ff ff ff       	jmp    f90 <printf+0x110>
+    102f:	90                   	nop
+
+00001030 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1030:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1031:	a1 00 52 00 00       	mov    0x5200,%eax
+{
+    1036:	89 e5                	mov    %esp,%ebp
+    1038:	57                   	push   %edi
+    1039:	56                   	push   %esi
+    103a:	53                   	push   %ebx
+    103b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    103e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1041:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1048:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    104a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    104c:	39 ca                	cmp    %ecx,%edx
+    104e:	73 30                	jae    1080 <free+0x50>
+    1050:	39 c1                	cmp    %eax,%ecx
+    1052:	72 04                	jb     1058 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1054:	39 c2                	cmp    %eax,%edx
+    1056:	72 f0                	jb     1048 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1058:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    105b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    105e:	39 f8                	cmp    %edi,%eax
+    1060:	74 2e                	je     1090 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1062:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1065:	8b 42 04             	mov    0x4(%edx),%eax
+    1068:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    106b:	39 f1                	cmp    %esi,%ecx
+    106d:	74 38                	je     10a7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    106f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1071:	5b                   	pop    %ebx
+  freep = p;
+    1072:	89 15 00 52 00 00    	mov    %edx,0x5200
+}
+    1078:	5e                   	pop    %esi
+    1079:	5f                   	pop    %edi
+    107a:	5d                   	pop    %ebp
+    107b:	c3                   	ret
+    107c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1080:	39 c1                	cmp    %eax,%ecx
+    1082:	72 d0                	jb     1054 <free+0x24>
+    1084:	eb c2                	jmp    1048 <free+0x18>
+    1086:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    108d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1090:	03 70 04             	add    0x4(%eax),%esi
+    1093:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1096:	8b 02                	mov    (%edx),%eax
+    1098:	8b 00                	mov    (%eax),%eax
+    109a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    109d:	8b 42 04             	mov    0x4(%edx),%eax
+    10a0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    10a3:	39 f1                	cmp    %esi,%ecx
+    10a5:	75 c8                	jne    106f <free+0x3f>
+    p->s.size += bp->s.size;
+    10a7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    10aa:	89 15 00 52 00 00    	mov    %edx,0x5200
+    p->s.size += bp->s.size;
+    10b0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    10b3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    10b6:	89 0a                	mov    %ecx,(%edx)
+}
+    10b8:	5b                   	pop    %ebx
+    10b9:	5e                   	pop    %esi
+    10ba:	5f                   	pop    %edi
+    10bb:	5d                   	pop    %ebp
+    10bc:	c3                   	ret
+    10bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000010c0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    10c0:	55                   	push   %ebp
+    10c1:	89 e5                	mov    %esp,%ebp
+    10c3:	57                   	push   %edi
+    10c4:	56                   	push   %esi
+    10c5:	53                   	push   %ebx
+    10c6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    10c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    10cc:	8b 15 00 52 00 00    	mov    0x5200,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    10d2:	8d 78 07             	lea    0x7(%eax),%edi
+    10d5:	c1 ef 03             	shr    $0x3,%edi
+    10d8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    10db:	85 d2                	test   %edx,%edx
+    10dd:	0f 84 8d 00 00 00    	je     1170 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    10e3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    10e5:	8b 48 04             	mov    0x4(%eax),%ecx
+    10e8:	39 f9                	cmp    %edi,%ecx
+    10ea:	73 64                	jae    1150 <malloc+0x90>
+  if(nu < 4096)
+    10ec:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    10f1:	39 df                	cmp    %ebx,%edi
+    10f3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    10f6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    10fd:	eb 0a                	jmp    1109 <malloc+0x49>
+    10ff:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1100:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1102:	8b 48 04             	mov    0x4(%eax),%ecx
+    1105:	39 f9                	cmp    %edi,%ecx
+    1107:	73 47                	jae    1150 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1109:	89 c2                	mov    %eax,%edx
+    110b:	39 05 00 52 00 00    	cmp    %eax,0x5200
+    1111:	75 ed                	jne    1100 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1113:	83 ec 0c             	sub    $0xc,%esp
+    1116:	56                   	push   %esi
+    1117:	e8 ba fa ff ff       	call   bd6 <sbrk>
+  if(p == (char*)-1)
+    111c:	83 c4 10             	add    $0x10,%esp
+    111f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1122:	74 1c                	je     1140 <malloc+0x80>
+  hp->s.size = nu;
+    1124:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1127:	83 ec 0c             	sub    $0xc,%esp
+    112a:	83 c0 08             	add    $0x8,%eax
+    112d:	50                   	push   %eax
+    112e:	e8 fd fe ff ff       	call   1030 <free>
+  return freep;
+    1133:	8b 15 00 52 00 00    	mov    0x5200,%edx
+      if((p = morecore(nunits)) == 0)
+    1139:	83 c4 10             	add    $0x10,%esp
+    113c:	85 d2                	test   %edx,%edx
+    113e:	75 c0                	jne    1100 <malloc+0x40>
+        return 0;
+  }
+}
+    1140:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1143:	31 c0                	xor    %eax,%eax
+}
+    1145:	5b                   	pop    %ebx
+    1146:	5e                   	pop    %esi
+    1147:	5f                   	pop    %edi
+    1148:	5d                   	pop    %ebp
+    1149:	c3                   	ret
+    114a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1150:	39 cf                	cmp    %ecx,%edi
+    1152:	74 4c                	je     11a0 <malloc+0xe0>
+        p->s.size -= nunits;
+    1154:	29 f9                	sub    %edi,%ecx
+    1156:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1159:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    115c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    115f:	89 15 00 52 00 00    	mov    %edx,0x5200
+}
+    1165:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1168:	83 c0 08             	add    $0x8,%eax
+}
+    116b:	5b                   	pop    %ebx
+    116c:	5e                   	pop    %esi
+    116d:	5f                   	pop    %edi
+    116e:	5d                   	pop    %ebp
+    116f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1170:	c7 05 00 52 00 00 04 	movl   $0x5204,0x5200
+    1177:	52 00 00 
+    base.s.size = 0;
+    117a:	b8 04 52 00 00       	mov    $0x5204,%eax
+    base.s.ptr = freep = prevp = &base;
+    117f:	c7 05 04 52 00 00 04 	movl   $0x5204,0x5204
+    1186:	52 00 00 
+    base.s.size = 0;
+    1189:	c7 05 08 52 00 00 00 	movl   $0x0,0x5208
+    1190:	00 00 00 
+    if(p->s.size >= nunits){
+    1193:	e9 54 ff ff ff       	jmp    10ec <malloc+0x2c>
+    1198:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    119f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    11a0:	8b 08                	mov    (%eax),%ecx
+    11a2:	89 0a                	mov    %ecx,(%edx)
+    11a4:	eb b9                	jmp    115f <malloc+0x9f>
@@ -0,0 +1,94 @@
+// Show which processes are using the CPU and the disk.
+//
+// usage: top [samples]
+//
+// Takes a sample of every process's counters each second and
+// prints what changed since the previous one.
+
+#include "types.h"
+#include "user.h"
+#include "procinfo.h"
+
+#define NINFO 128
+
+// Index by struct procinfo's state, enum procstate in proc.h.
+char *states[] = { "unused", "embryo", "sleep", "runble", "run", "zombie" };
+
+struct procinfo old[NINFO], cur[NINFO];
+
+struct procinfo*
+lookup(struct procinfo *info, int n, int pid)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+    if(info[i].pid == pid)
+      return &info[i];
+  return 0;
+}
+
+// Print n right-aligned in a column w wide, xv6's printf
+// having no field widths.
+void
+col(uint n, int w)
+{
+  uint m;
+
+  for(m = n, w--; m >= 10; m /= 10)
+    w--;
+  while(w-- > 0)
+    printf(1, " ");
+  printf(1, " %d", n);
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct procinfo *p, *o;
+  int i, k, nsample, nold, ncur, t0, t1, dt;
+  uint du, ds;
+  char *state;
+
+  nsample = 3;
+  if(argc > 1)
+    nsample = atoi(argv[1]);
+
+  nold = getprocinfo(old, NINFO);
+  t0 = uptime();
+  for(k = 0; k < nsample; k++){
+    sleep(100);
+    ncur = getprocinfo(cur, NINFO);
+    t1 = uptime();
+    dt = t1 > t0 ? t1 - t0 : 1;
+
+    printf(1, "\n   PID  PPID CPU%%  USER   SYS   CSW   FLT   RSS BREAD BWRITE STATE  NAME\n");
+    for(i = 0; i < ncur; i++){
+      p = &cur[i];
+      du = p->utime;
+      ds = p->stime;
+      if((o = lookup(old, nold, p->pid)) != 0){
+        du -= o->utime;
+        ds -= o->stime;
+      }
+      if(p->state >= 0 && p->state < sizeof(states)/sizeof(states[0]))
+        state = states[p->state];
+      else
+        state = "???";
+      col(p->pid, 5);
+      col(p->ppid, 5);
+      col((du + ds) * 100 / dt, 4);
+      col(p->utime, 5);
+      col(p->stime, 5);
+      col(p->nswitch, 5);
+      col(p->nfault, 5);
+      col(p->rss, 5);
+      col(p->nbread, 5);
+      col(p->nbwrite, 6);
+      printf(1, " %s %s\n", state, p->name);
+    }
+    memmove(old, cur, sizeof(old));
+    nold = ncur;
+    t0 = t1;
+  }
+  exit();
+}
@@ -0,0 +1,43 @@
+// Pages the kernel maps into processes just below KERNBASE.
+// UCLOCK and UPROC are read-only and in every process, so that
+// user code can read the clock and its own pid without a system
+// call.  UAIO holds the process's asynchronous I/O rings, once
+// it has called aiosetup().
+
+#define UAIO    0x7FFFD000   // struct aioring (aio.h)
+#define UPROC   0x7FFFE000   // struct uproc, one per process
+#define UCLOCK  0x7FFFF000   // struct uclock, shared by all
+#define UTOP    UAIO         // user memory ends here
+
+#define TSCSHIFT  24         // fraction bits in uclock.tscmult
+
+// uclock.flags, at UCLOCK itself so usys.S can test it.
+#define UCLOCK_SYSENTER  0x1  // system calls may use sysenter
+
+#ifndef __ASSEMBLER__
+struct uclock {
+  uint flags;         // UCLOCK_ bits
+  uint ticks;         // Copy of ticks, updated by CPU 0
+  uint tscmult;       // Nanoseconds per TSC count; 0 if uncalibrated
+  uint64 tscbase;     // TSC when the clock read zero
+};
+
+struct uproc {
+  int pid;
+};
+
+// Time since boot at TSC reading tsc, by c's calibration.
+// Needs x86.h for divl(); the kernel and ulib.c both use it.
+static inline void
+uclockread(struct uclock *c, uint64 tsc, struct timespec *ts)
+{
+  uint64 d, ns;
+
+  d = tsc - c->tscbase;
+  if((long long)d < 0)  // another CPU's TSC is a little behind
+    d = 0;
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+  ts->sec = divl(ns, 1000000000, &ts->nsec);
+}
+#endif
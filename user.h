@@ -1,5 +1,12 @@
 struct stat;
 struct rtcdate;
+struct timespec;
+struct sysent;
+struct aioring;
+struct procinfo;
+struct lockstat;
+struct locksite;
+struct diskstat;
 
 // system calls
 int fork(void);
@@ -25,6 +32,19 @@ int sleep(int);
 int uptime(void);
 int swapread(const char*, int);
 int swapwrite(const char*, int);
+int setaffinity(int, int);
+int getaffinity(int);
+int nanosleep(struct timespec*);
+int clocktime(struct timespec*);
+int batch(struct sysent*, int, int);
+struct aioring* aiosetup(void);
+int aiowait(int);
+int spawn(char*, char**, int*, int);
+int getprocinfo(struct procinfo*, int);
+int getlockstat(struct lockstat*, int);
+int lockprof(int);
+int getlockprof(struct locksite*, int);
+int diskstat(struct diskstat*);
 
 // ulib.c
 int stat(const char*, struct stat*);
@@ -39,3 +59,5 @@ void* memset(void*, int, uint);
 void* malloc(uint);
 void free(void*);
 int atoi(const char*);
+int ugetpid(void);
+int uclocktime(struct timespec*);
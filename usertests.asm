@@ -0,0 +1,8036 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return randstate;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+      11:	68 94 5e 00 00       	push   $0x5e94
+      16:	6a 01                	push   $0x1
+      18:	e8 f3 48 00 00       	call   4910 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+      1d:	59                   	pop    %ecx
+      1e:	58                   	pop    %eax
+      1f:	6a 00                	push   $0x0
+      21:	68 a8 5e 00 00       	push   $0x5ea8
+      26:	e8 36 45 00 00       	call   4561 <open>
+      2b:	83 c4 10             	add    $0x10,%esp
+      2e:	85 c0                	test   %eax,%eax
+      30:	78 13                	js     45 <main+0x45>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+      32:	52                   	push   %edx
+      33:	52                   	push   %edx
+      34:	68 84 67 00 00       	push   $0x6784
+      39:	6a 01                	push   $0x1
+      3b:	e8 d0 48 00 00       	call   4910 <printf>
+    exit();
+      40:	e8 34 44 00 00       	call   4479 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+      45:	50                   	push   %eax
+      46:	50                   	push   %eax
+      47:	68 00 02 00 00       	push   $0x200
+      4c:	68 a8 5e 00 00       	push   $0x5ea8
+      51:	e8 0b 45 00 00       	call   4561 <open>
+      56:	89 04 24             	mov    %eax,(%esp)
+      59:	e8 ac 44 00 00       	call   450a <close>
+
+  argptest();
+      5e:	e8 8d 40 00 00       	call   40f0 <argptest>
+  createdelete();
+      63:	e8 d8 11 00 00       	call   1240 <createdelete>
+  linkunlink();
+      68:	e8 73 1a 00 00       	call   1ae0 <linkunlink>
+  concreate();
+      6d:	e8 6e 17 00 00       	call   17e0 <concreate>
+  fourfiles();
+      72:	e8 c9 0f 00 00       	call   1040 <fourfiles>
+  sharedfd();
+      77:	e8 04 0e 00 00       	call   e80 <sharedfd>
+
+  bigargtest();
+      7c:	e8 6f 3a 00 00       	call   3af0 <bigargtest>
+  bigwrite();
+      81:	e8 7a 23 00 00       	call   2400 <bigwrite>
+  bigargtest();
+      86:	e8 65 3a 00 00       	call   3af0 <bigargtest>
+  bsstest();
+      8b:	e8 f0 39 00 00       	call   3a80 <bsstest>
+  sbrktest();
+      90:	e8 eb 34 00 00       	call   3580 <sbrktest>
+  validatetest();
+      95:	e8 36 39 00 00       	call   39d0 <validatetest>
+
+  opentest();
+      9a:	e8 71 03 00 00       	call   410 <opentest>
+  writetest();
+      9f:	e8 fc 03 00 00       	call   4a0 <writetest>
+  writetest1();
+      a4:	e8 d7 05 00 00       	call   680 <writetest1>
+  createtest();
+      a9:	e8 a2 07 00 00       	call   850 <createtest>
+
+  openiputtest();
+      ae:	e8 5d 02 00 00       	call   310 <openiputtest>
+  exitiputtest();
+      b3:	e8 58 01 00 00       	call   210 <exitiputtest>
+  iputtest();
+      b8:	e8 73 00 00 00       	call   130 <iputtest>
+
+  mem();
+      bd:	e8 ee 0c 00 00       	call   db0 <mem>
+  bcachetest();
+      c2:	e8 f9 3d 00 00       	call   3ec0 <bcachetest>
+  pipe1();
+      c7:	e8 64 09 00 00       	call   a30 <pipe1>
+  preempt();
+      cc:	e8 ff 0a 00 00       	call   bd0 <preempt>
+  exitwait();
+      d1:	e8 5a 0c 00 00       	call   d30 <exitwait>
+
+  rmdot();
+      d6:	e8 15 27 00 00       	call   27f0 <rmdot>
+  fourteen();
+      db:	e8 d0 25 00 00       	call   26b0 <fourteen>
+  bigfile();
+      e0:	e8 fb 23 00 00       	call   24e0 <bigfile>
+  subdir();
+      e5:	e8 36 1c 00 00       	call   1d20 <subdir>
+  linktest();
+      ea:	e8 e1 14 00 00       	call   15d0 <linktest>
+  unlinkread();
+      ef:	e8 4c 13 00 00       	call   1440 <unlinkread>
+  dirfile();
+      f4:	e8 77 28 00 00       	call   2970 <dirfile>
+  iref();
+      f9:	e8 72 2a 00 00       	call   2b70 <iref>
+  forktest();
+      fe:	e8 8d 2b 00 00       	call   2c90 <forktest>
+  affinitytest();
+     103:	e8 48 2c 00 00       	call   2d50 <affinitytest>
+  nanosleeptest();
+     108:	e8 c3 2e 00 00       	call   2fd0 <nanosleeptest>
+  clocktest();
+     10d:	e8 ee 2f 00 00       	call   3100 <clocktest>
+  batchtest();
+     112:	e8 a9 31 00 00       	call   32c0 <batchtest>
+  spawntest();
+     117:	e8 44 33 00 00       	call   3460 <spawntest>
+  bigdir(); // slow
+     11c:	e8 cf 1a 00 00       	call   1bf0 <bigdir>
+
+  uio();
+     121:	e8 9a 3c 00 00       	call   3dc0 <uio>
+
+  exectest();
+     126:	e8 b5 08 00 00       	call   9e0 <exectest>
+
+  exit();
+     12b:	e8 49 43 00 00       	call   4479 <exit>
+
+00000130 <iputtest>:
+{
+     130:	55                   	push   %ebp
+     131:	89 e5                	mov    %esp,%ebp
+     133:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+     136:	68 cc 4c 00 00       	push   $0x4ccc
+     13b:	ff 35 98 72 00 00    	push   0x7298
+     141:	e8 ca 47 00 00       	call   4910 <printf>
+  if(mkdir("iputdir") < 0){
+     146:	c7 04 24 5f 4c 00 00 	movl   $0x4c5f,(%esp)
+     14d:	e8 a0 44 00 00       	call   45f2 <mkdir>
+     152:	83 c4 10             	add    $0x10,%esp
+     155:	85 c0                	test   %eax,%eax
+     157:	78 58                	js     1b1 <iputtest+0x81>
+  if(chdir("iputdir") < 0){
+     159:	83 ec 0c             	sub    $0xc,%esp
+     15c:	68 5f 4c 00 00       	push   $0x4c5f
+     161:	e8 a9 44 00 00       	call   460f <chdir>
+     166:	83 c4 10             	add    $0x10,%esp
+     169:	85 c0                	test   %eax,%eax
+     16b:	0f 88 85 00 00 00    	js     1f6 <iputtest+0xc6>
+  if(unlink("../iputdir") < 0){
+     171:	83 ec 0c             	sub    $0xc,%esp
+     174:	68 5c 4c 00 00       	push   $0x4c5c
+     179:	e8 1d 44 00 00       	call   459b <unlink>
+     17e:	83 c4 10             	add    $0x10,%esp
+     181:	85 c0                	test   %eax,%eax
+     183:	78 5a                	js     1df <iputtest+0xaf>
+  if(chdir("/") < 0){
+     185:	83 ec 0c             	sub    $0xc,%esp
+     188:	68 81 4c 00 00       	push   $0x4c81
+     18d:	e8 7d 44 00 00       	call   460f <chdir>
+     192:	83 c4 10             	add    $0x10,%esp
+     195:	85 c0                	test   %eax,%eax
+     197:	78 2f                	js     1c8 <iputtest+0x98>
+  printf(stdout, "iput test ok\n");
+     199:	83 ec 08             	sub    $0x8,%esp
+     19c:	68 f5 4c 00 00       	push   $0x4cf5
+     1a1:	ff 35 98 72 00 00    	push   0x7298
+     1a7:	e8 64 47 00 00       	call   4910 <printf>
+}
+     1ac:	83 c4 10             	add    $0x10,%esp
+     1af:	c9                   	leave
+     1b0:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     1b1:	50                   	push   %eax
+     1b2:	50                   	push   %eax
+     1b3:	68 38 4c 00 00       	push   $0x4c38
+     1b8:	ff 35 98 72 00 00    	push   0x7298
+     1be:	e8 4d 47 00 00       	call   4910 <printf>
+    exit();
+     1c3:	e8 b1 42 00 00       	call   4479 <exit>
+    printf(stdout, "chdir / failed\n");
+     1c8:	50                   	push   %eax
+     1c9:	50                   	push   %eax
+     1ca:	68 83 4c 00 00       	push   $0x4c83
+     1cf:	ff 35 98 72 00 00    	push   0x7298
+     1d5:	e8 36 47 00 00       	call   4910 <printf>
+    exit();
+     1da:	e8 9a 42 00 00       	call   4479 <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+     1df:	52                   	push   %edx
+     1e0:	52                   	push   %edx
+     1e1:	68 67 4c 00 00       	push   $0x4c67
+     1e6:	ff 35 98 72 00 00    	push   0x7298
+     1ec:	e8 1f 47 00 00       	call   4910 <printf>
+    exit();
+     1f1:	e8 83 42 00 00       	call   4479 <exit>
+    printf(stdout, "chdir iputdir failed\n");
+     1f6:	51                   	push   %ecx
+     1f7:	51                   	push   %ecx
+     1f8:	68 46 4c 00 00       	push   $0x4c46
+     1fd:	ff 35 98 72 00 00    	push   0x7298
+     203:	e8 08 47 00 00       	call   4910 <printf>
+    exit();
+     208:	e8 6c 42 00 00       	call   4479 <exit>
+     20d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000210 <exitiputtest>:
+{
+     210:	55                   	push   %ebp
+     211:	89 e5                	mov    %esp,%ebp
+     213:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exitiput test\n");
+     216:	68 93 4c 00 00       	push   $0x4c93
+     21b:	ff 35 98 72 00 00    	push   0x7298
+     221:	e8 ea 46 00 00       	call   4910 <printf>
+  pid = fork();
+     226:	e8 31 42 00 00       	call   445c <fork>
+  if(pid < 0){
+     22b:	83 c4 10             	add    $0x10,%esp
+     22e:	85 c0                	test   %eax,%eax
+     230:	0f 88 8a 00 00 00    	js     2c0 <exitiputtest+0xb0>
+  if(pid == 0){
+     236:	75 50                	jne    288 <exitiputtest+0x78>
+    if(mkdir("iputdir") < 0){
+     238:	83 ec 0c             	sub    $0xc,%esp
+     23b:	68 5f 4c 00 00       	push   $0x4c5f
+     240:	e8 ad 43 00 00       	call   45f2 <mkdir>
+     245:	83 c4 10             	add    $0x10,%esp
+     248:	85 c0                	test   %eax,%eax
+     24a:	0f 88 87 00 00 00    	js     2d7 <exitiputtest+0xc7>
+    if(chdir("iputdir") < 0){
+     250:	83 ec 0c             	sub    $0xc,%esp
+     253:	68 5f 4c 00 00       	push   $0x4c5f
+     258:	e8 b2 43 00 00       	call   460f <chdir>
+     25d:	83 c4 10             	add    $0x10,%esp
+     260:	85 c0                	test   %eax,%eax
+     262:	0f 88 86 00 00 00    	js     2ee <exitiputtest+0xde>
+    if(unlink("../iputdir") < 0){
+     268:	83 ec 0c             	sub    $0xc,%esp
+     26b:	68 5c 4c 00 00       	push   $0x4c5c
+     270:	e8 26 43 00 00       	call   459b <unlink>
+     275:	83 c4 10             	add    $0x10,%esp
+     278:	85 c0                	test   %eax,%eax
+     27a:	78 2c                	js     2a8 <exitiputtest+0x98>
+    exit();
+     27c:	e8 f8 41 00 00       	call   4479 <exit>
+     281:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+     288:	e8 09 42 00 00       	call   4496 <wait>
+  printf(stdout, "exitiput test ok\n");
+     28d:	83 ec 08             	sub    $0x8,%esp
+     290:	68 b6 4c 00 00       	push   $0x4cb6
+     295:	ff 35 98 72 00 00    	push   0x7298
+     29b:	e8 70 46 00 00       	call   4910 <printf>
+}
+     2a0:	83 c4 10             	add    $0x10,%esp
+     2a3:	c9                   	leave
+     2a4:	c3                   	ret
+     2a5:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(stdout, "unlink ../iputdir failed\n");
+     2a8:	83 ec 08             	sub    $0x8,%esp
+     2ab:	68 67 4c 00 00       	push   $0x4c67
+     2b0:	ff 35 98 72 00 00    	push   0x7298
+     2b6:	e8 55 46 00 00       	call   4910 <printf>
+      exit();
+     2bb:	e8 b9 41 00 00       	call   4479 <exit>
+    printf(stdout, "fork failed\n");
+     2c0:	51                   	push   %ecx
+     2c1:	51                   	push   %ecx
+     2c2:	68 77 5d 00 00       	push   $0x5d77
+     2c7:	ff 35 98 72 00 00    	push   0x7298
+     2cd:	e8 3e 46 00 00       	call   4910 <printf>
+    exit();
+     2d2:	e8 a2 41 00 00       	call   4479 <exit>
+      printf(stdout, "mkdir failed\n");
+     2d7:	52                   	push   %edx
+     2d8:	52                   	push   %edx
+     2d9:	68 38 4c 00 00       	push   $0x4c38
+     2de:	ff 35 98 72 00 00    	push   0x7298
+     2e4:	e8 27 46 00 00       	call   4910 <printf>
+      exit();
+     2e9:	e8 8b 41 00 00       	call   4479 <exit>
+      printf(stdout, "child chdir failed\n");
+     2ee:	50                   	push   %eax
+     2ef:	50                   	push   %eax
+     2f0:	68 a2 4c 00 00       	push   $0x4ca2
+     2f5:	ff 35 98 72 00 00    	push   0x7298
+     2fb:	e8 10 46 00 00       	call   4910 <printf>
+      exit();
+     300:	e8 74 41 00 00       	call   4479 <exit>
+     305:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     30c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <openiputtest>:
+{
+     310:	55                   	push   %ebp
+     311:	89 e5                	mov    %esp,%ebp
+     313:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "openiput test\n");
+     316:	68 c8 4c 00 00       	push   $0x4cc8
+     31b:	ff 35 98 72 00 00    	push   0x7298
+     321:	e8 ea 45 00 00       	call   4910 <printf>
+  if(mkdir("oidir") < 0){
+     326:	c7 04 24 d7 4c 00 00 	movl   $0x4cd7,(%esp)
+     32d:	e8 c0 42 00 00       	call   45f2 <mkdir>
+     332:	83 c4 10             	add    $0x10,%esp
+     335:	85 c0                	test   %eax,%eax
+     337:	0f 88 9f 00 00 00    	js     3dc <openiputtest+0xcc>
+  pid = fork();
+     33d:	e8 1a 41 00 00       	call   445c <fork>
+  if(pid < 0){
+     342:	85 c0                	test   %eax,%eax
+     344:	78 7f                	js     3c5 <openiputtest+0xb5>
+  if(pid == 0){
+     346:	75 38                	jne    380 <openiputtest+0x70>
+    int fd = open("oidir", O_RDWR);
+     348:	83 ec 08             	sub    $0x8,%esp
+     34b:	6a 02                	push   $0x2
+     34d:	68 d7 4c 00 00       	push   $0x4cd7
+     352:	e8 0a 42 00 00       	call   4561 <open>
+    if(fd >= 0){
+     357:	83 c4 10             	add    $0x10,%esp
+     35a:	85 c0                	test   %eax,%eax
+     35c:	78 62                	js     3c0 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+     35e:	83 ec 08             	sub    $0x8,%esp
+     361:	68 c8 5e 00 00       	push   $0x5ec8
+     366:	ff 35 98 72 00 00    	push   0x7298
+     36c:	e8 9f 45 00 00       	call   4910 <printf>
+      exit();
+     371:	e8 03 41 00 00       	call   4479 <exit>
+     376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     37d:	8d 76 00             	lea    0x0(%esi),%esi
+  sleep(1);
+     380:	83 ec 0c             	sub    $0xc,%esp
+     383:	6a 01                	push   $0x1
+     385:	e8 f9 42 00 00       	call   4683 <sleep>
+  if(unlink("oidir") != 0){
+     38a:	c7 04 24 d7 4c 00 00 	movl   $0x4cd7,(%esp)
+     391:	e8 05 42 00 00       	call   459b <unlink>
+     396:	83 c4 10             	add    $0x10,%esp
+     399:	85 c0                	test   %eax,%eax
+     39b:	75 56                	jne    3f3 <openiputtest+0xe3>
+  wait();
+     39d:	e8 f4 40 00 00       	call   4496 <wait>
+  printf(stdout, "openiput test ok\n");
+     3a2:	83 ec 08             	sub    $0x8,%esp
+     3a5:	68 f1 4c 00 00       	push   $0x4cf1
+     3aa:	ff 35 98 72 00 00    	push   0x7298
+     3b0:	e8 5b 45 00 00       	call   4910 <printf>
+}
+     3b5:	83 c4 10             	add    $0x10,%esp
+     3b8:	c9                   	leave
+     3b9:	c3                   	ret
+     3ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    exit();
+     3c0:	e8 b4 40 00 00       	call   4479 <exit>
+    printf(stdout, "fork failed\n");
+     3c5:	52                   	push   %edx
+     3c6:	52                   	push   %edx
+     3c7:	68 77 5d 00 00       	push   $0x5d77
+     3cc:	ff 35 98 72 00 00    	push   0x7298
+     3d2:	e8 39 45 00 00       	call   4910 <printf>
+    exit();
+     3d7:	e8 9d 40 00 00       	call   4479 <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     3dc:	51                   	push   %ecx
+     3dd:	51                   	push   %ecx
+     3de:	68 dd 4c 00 00       	push   $0x4cdd
+     3e3:	ff 35 98 72 00 00    	push   0x7298
+     3e9:	e8 22 45 00 00       	call   4910 <printf>
+    exit();
+     3ee:	e8 86 40 00 00       	call   4479 <exit>
+    printf(stdout, "unlink failed\n");
+     3f3:	50                   	push   %eax
+     3f4:	50                   	push   %eax
+     3f5:	68 ae 5b 00 00       	push   $0x5bae
+     3fa:	ff 35 98 72 00 00    	push   0x7298
+     400:	e8 0b 45 00 00       	call   4910 <printf>
+    exit();
+     405:	e8 6f 40 00 00       	call   4479 <exit>
+     40a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000410 <opentest>:
+{
+     410:	55                   	push   %ebp
+     411:	89 e5                	mov    %esp,%ebp
+     413:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "open test\n");
+     416:	68 03 4d 00 00       	push   $0x4d03
+     41b:	ff 35 98 72 00 00    	push   0x7298
+     421:	e8 ea 44 00 00       	call   4910 <printf>
+  fd = open("echo", 0);
+     426:	58                   	pop    %eax
+     427:	5a                   	pop    %edx
+     428:	6a 00                	push   $0x0
+     42a:	68 0e 4d 00 00       	push   $0x4d0e
+     42f:	e8 2d 41 00 00       	call   4561 <open>
+  if(fd < 0){
+     434:	83 c4 10             	add    $0x10,%esp
+     437:	85 c0                	test   %eax,%eax
+     439:	78 36                	js     471 <opentest+0x61>
+  close(fd);
+     43b:	83 ec 0c             	sub    $0xc,%esp
+     43e:	50                   	push   %eax
+     43f:	e8 c6 40 00 00       	call   450a <close>
+  fd = open("doesnotexist", 0);
+     444:	5a                   	pop    %edx
+     445:	59                   	pop    %ecx
+     446:	6a 00                	push   $0x0
+     448:	68 26 4d 00 00       	push   $0x4d26
+     44d:	e8 0f 41 00 00       	call   4561 <open>
+  if(fd >= 0){
+     452:	83 c4 10             	add    $0x10,%esp
+     455:	85 c0                	test   %eax,%eax
+     457:	79 2f                	jns    488 <opentest+0x78>
+  printf(stdout, "open test ok\n");
+     459:	83 ec 08             	sub    $0x8,%esp
+     45c:	68 51 4d 00 00       	push   $0x4d51
+     461:	ff 35 98 72 00 00    	push   0x7298
+     467:	e8 a4 44 00 00       	call   4910 <printf>
+}
+     46c:	83 c4 10             	add    $0x10,%esp
+     46f:	c9                   	leave
+     470:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     471:	50                   	push   %eax
+     472:	50                   	push   %eax
+     473:	68 13 4d 00 00       	push   $0x4d13
+     478:	ff 35 98 72 00 00    	push   0x7298
+     47e:	e8 8d 44 00 00       	call   4910 <printf>
+    exit();
+     483:	e8 f1 3f 00 00       	call   4479 <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     488:	50                   	push   %eax
+     489:	50                   	push   %eax
+     48a:	68 33 4d 00 00       	push   $0x4d33
+     48f:	ff 35 98 72 00 00    	push   0x7298
+     495:	e8 76 44 00 00       	call   4910 <printf>
+    exit();
+     49a:	e8 da 3f 00 00       	call   4479 <exit>
+     49f:	90                   	nop
+
+000004a0 <writetest>:
+{
+     4a0:	55                   	push   %ebp
+     4a1:	89 e5                	mov    %esp,%ebp
+     4a3:	56                   	push   %esi
+     4a4:	53                   	push   %ebx
+  printf(stdout, "small file test\n");
+     4a5:	83 ec 08             	sub    $0x8,%esp
+     4a8:	68 5f 4d 00 00       	push   $0x4d5f
+     4ad:	ff 35 98 72 00 00    	push   0x7298
+     4b3:	e8 58 44 00 00       	call   4910 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     4b8:	58                   	pop    %eax
+     4b9:	5a                   	pop    %edx
+     4ba:	68 02 02 00 00       	push   $0x202
+     4bf:	68 70 4d 00 00       	push   $0x4d70
+     4c4:	e8 98 40 00 00       	call   4561 <open>
+  if(fd >= 0){
+     4c9:	83 c4 10             	add    $0x10,%esp
+     4cc:	85 c0                	test   %eax,%eax
+     4ce:	0f 88 88 01 00 00    	js     65c <writetest+0x1bc>
+    printf(stdout, "creat small succeeded; ok\n");
+     4d4:	83 ec 08             	sub    $0x8,%esp
+     4d7:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+     4d9:	31 db                	xor    %ebx,%ebx
+    printf(stdout, "creat small succeeded; ok\n");
+     4db:	68 76 4d 00 00       	push   $0x4d76
+     4e0:	ff 35 98 72 00 00    	push   0x7298
+     4e6:	e8 25 44 00 00       	call   4910 <printf>
+     4eb:	83 c4 10             	add    $0x10,%esp
+     4ee:	66 90                	xchg   %ax,%ax
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     4f0:	83 ec 04             	sub    $0x4,%esp
+     4f3:	6a 0a                	push   $0xa
+     4f5:	68 ad 4d 00 00       	push   $0x4dad
+     4fa:	56                   	push   %esi
+     4fb:	e8 ed 3f 00 00       	call   44ed <write>
+     500:	83 c4 10             	add    $0x10,%esp
+     503:	83 f8 0a             	cmp    $0xa,%eax
+     506:	0f 85 d9 00 00 00    	jne    5e5 <writetest+0x145>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     50c:	83 ec 04             	sub    $0x4,%esp
+     50f:	6a 0a                	push   $0xa
+     511:	68 b8 4d 00 00       	push   $0x4db8
+     516:	56                   	push   %esi
+     517:	e8 d1 3f 00 00       	call   44ed <write>
+     51c:	83 c4 10             	add    $0x10,%esp
+     51f:	83 f8 0a             	cmp    $0xa,%eax
+     522:	0f 85 d6 00 00 00    	jne    5fe <writetest+0x15e>
+  for(i = 0; i < 100; i++){
+     528:	83 c3 01             	add    $0x1,%ebx
+     52b:	83 fb 64             	cmp    $0x64,%ebx
+     52e:	75 c0                	jne    4f0 <writetest+0x50>
+  printf(stdout, "writes ok\n");
+     530:	83 ec 08             	sub    $0x8,%esp
+     533:	68 c3 4d 00 00       	push   $0x4dc3
+     538:	ff 35 98 72 00 00    	push   0x7298
+     53e:	e8 cd 43 00 00       	call   4910 <printf>
+  close(fd);
+     543:	89 34 24             	mov    %esi,(%esp)
+     546:	e8 bf 3f 00 00       	call   450a <close>
+  fd = open("small", O_RDONLY);
+     54b:	5b                   	pop    %ebx
+     54c:	5e                   	pop    %esi
+     54d:	6a 00                	push   $0x0
+     54f:	68 70 4d 00 00       	push   $0x4d70
+     554:	e8 08 40 00 00       	call   4561 <open>
+  if(fd >= 0){
+     559:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     55c:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     55e:	85 c0                	test   %eax,%eax
+     560:	0f 88 b1 00 00 00    	js     617 <writetest+0x177>
+    printf(stdout, "open small succeeded ok\n");
+     566:	83 ec 08             	sub    $0x8,%esp
+     569:	68 ce 4d 00 00       	push   $0x4dce
+     56e:	ff 35 98 72 00 00    	push   0x7298
+     574:	e8 97 43 00 00       	call   4910 <printf>
+  i = read(fd, buf, 2000);
+     579:	83 c4 0c             	add    $0xc,%esp
+     57c:	68 d0 07 00 00       	push   $0x7d0
+     581:	68 e0 99 00 00       	push   $0x99e0
+     586:	53                   	push   %ebx
+     587:	e8 44 3f 00 00       	call   44d0 <read>
+  if(i == 2000){
+     58c:	83 c4 10             	add    $0x10,%esp
+     58f:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     594:	0f 85 94 00 00 00    	jne    62e <writetest+0x18e>
+    printf(stdout, "read succeeded ok\n");
+     59a:	83 ec 08             	sub    $0x8,%esp
+     59d:	68 02 4e 00 00       	push   $0x4e02
+     5a2:	ff 35 98 72 00 00    	push   0x7298
+     5a8:	e8 63 43 00 00       	call   4910 <printf>
+  close(fd);
+     5ad:	89 1c 24             	mov    %ebx,(%esp)
+     5b0:	e8 55 3f 00 00       	call   450a <close>
+  if(unlink("small") < 0){
+     5b5:	c7 04 24 70 4d 00 00 	movl   $0x4d70,(%esp)
+     5bc:	e8 da 3f 00 00       	call   459b <unlink>
+     5c1:	83 c4 10             	add    $0x10,%esp
+     5c4:	85 c0                	test   %eax,%eax
+     5c6:	78 7d                	js     645 <writetest+0x1a5>
+  printf(stdout, "small file test ok\n");
+     5c8:	83 ec 08             	sub    $0x8,%esp
+     5cb:	68 2a 4e 00 00       	push   $0x4e2a
+     5d0:	ff 35 98 72 00 00    	push   0x7298
+     5d6:	e8 35 43 00 00       	call   4910 <printf>
+}
+     5db:	83 c4 10             	add    $0x10,%esp
+     5de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5e1:	5b                   	pop    %ebx
+     5e2:	5e                   	pop    %esi
+     5e3:	5d                   	pop    %ebp
+     5e4:	c3                   	ret
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     5e5:	83 ec 04             	sub    $0x4,%esp
+     5e8:	53                   	push   %ebx
+     5e9:	68 ec 5e 00 00       	push   $0x5eec
+     5ee:	ff 35 98 72 00 00    	push   0x7298
+     5f4:	e8 17 43 00 00       	call   4910 <printf>
+      exit();
+     5f9:	e8 7b 3e 00 00       	call   4479 <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     5fe:	83 ec 04             	sub    $0x4,%esp
+     601:	53                   	push   %ebx
+     602:	68 10 5f 00 00       	push   $0x5f10
+     607:	ff 35 98 72 00 00    	push   0x7298
+     60d:	e8 fe 42 00 00       	call   4910 <printf>
+      exit();
+     612:	e8 62 3e 00 00       	call   4479 <exit>
+    printf(stdout, "error: open small failed!\n");
+     617:	51                   	push   %ecx
+     618:	51                   	push   %ecx
+     619:	68 e7 4d 00 00       	push   $0x4de7
+     61e:	ff 35 98 72 00 00    	push   0x7298
+     624:	e8 e7 42 00 00       	call   4910 <printf>
+    exit();
+     629:	e8 4b 3e 00 00       	call   4479 <exit>
+    printf(stdout, "read failed\n");
+     62e:	52                   	push   %edx
+     62f:	52                   	push   %edx
+     630:	68 2e 51 00 00       	push   $0x512e
+     635:	ff 35 98 72 00 00    	push   0x7298
+     63b:	e8 d0 42 00 00       	call   4910 <printf>
+    exit();
+     640:	e8 34 3e 00 00       	call   4479 <exit>
+    printf(stdout, "unlink small failed\n");
+     645:	50                   	push   %eax
+     646:	50                   	push   %eax
+     647:	68 15 4e 00 00       	push   $0x4e15
+     64c:	ff 35 98 72 00 00    	push   0x7298
+     652:	e8 b9 42 00 00       	call   4910 <printf>
+    exit();
+     657:	e8 1d 3e 00 00       	call   4479 <exit>
+    printf(stdout, "error: creat small failed!\n");
+     65c:	50                   	push   %eax
+     65d:	50                   	push   %eax
+     65e:	68 91 4d 00 00       	push   $0x4d91
+     663:	ff 35 98 72 00 00    	push   0x7298
+     669:	e8 a2 42 00 00       	call   4910 <printf>
+    exit();
+     66e:	e8 06 3e 00 00       	call   4479 <exit>
+     673:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     67a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000680 <writetest1>:
+{
+     680:	55                   	push   %ebp
+     681:	89 e5                	mov    %esp,%ebp
+     683:	56                   	push   %esi
+     684:	53                   	push   %ebx
+  printf(stdout, "big files test\n");
+     685:	83 ec 08             	sub    $0x8,%esp
+     688:	68 3e 4e 00 00       	push   $0x4e3e
+     68d:	ff 35 98 72 00 00    	push   0x7298
+     693:	e8 78 42 00 00       	call   4910 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     698:	58                   	pop    %eax
+     699:	5a                   	pop    %edx
+     69a:	68 02 02 00 00       	push   $0x202
+     69f:	68 b8 4e 00 00       	push   $0x4eb8
+     6a4:	e8 b8 3e 00 00       	call   4561 <open>
+  if(fd < 0){
+     6a9:	83 c4 10             	add    $0x10,%esp
+     6ac:	85 c0                	test   %eax,%eax
+     6ae:	0f 88 61 01 00 00    	js     815 <writetest1+0x195>
+     6b4:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < MAXFILE; i++){
+     6b6:	31 db                	xor    %ebx,%ebx
+     6b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6bf:	90                   	nop
+    if(write(fd, buf, 512) != 512){
+     6c0:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+     6c3:	89 1d e0 99 00 00    	mov    %ebx,0x99e0
+    if(write(fd, buf, 512) != 512){
+     6c9:	68 00 02 00 00       	push   $0x200
+     6ce:	68 e0 99 00 00       	push   $0x99e0
+     6d3:	56                   	push   %esi
+     6d4:	e8 14 3e 00 00       	call   44ed <write>
+     6d9:	83 c4 10             	add    $0x10,%esp
+     6dc:	3d 00 02 00 00       	cmp    $0x200,%eax
+     6e1:	0f 85 b3 00 00 00    	jne    79a <writetest1+0x11a>
+  for(i = 0; i < MAXFILE; i++){
+     6e7:	83 c3 01             	add    $0x1,%ebx
+     6ea:	81 fb 8c 00 00 00    	cmp    $0x8c,%ebx
+     6f0:	75 ce                	jne    6c0 <writetest1+0x40>
+  close(fd);
+     6f2:	83 ec 0c             	sub    $0xc,%esp
+     6f5:	56                   	push   %esi
+     6f6:	e8 0f 3e 00 00       	call   450a <close>
+  fd = open("big", O_RDONLY);
+     6fb:	5b                   	pop    %ebx
+     6fc:	5e                   	pop    %esi
+     6fd:	6a 00                	push   $0x0
+     6ff:	68 b8 4e 00 00       	push   $0x4eb8
+     704:	e8 58 3e 00 00       	call   4561 <open>
+  if(fd < 0){
+     709:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY);
+     70c:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     70e:	85 c0                	test   %eax,%eax
+     710:	0f 88 e8 00 00 00    	js     7fe <writetest1+0x17e>
+  n = 0;
+     716:	31 f6                	xor    %esi,%esi
+     718:	eb 1d                	jmp    737 <writetest1+0xb7>
+     71a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(i != 512){
+     720:	3d 00 02 00 00       	cmp    $0x200,%eax
+     725:	0f 85 9f 00 00 00    	jne    7ca <writetest1+0x14a>
+    if(((int*)buf)[0] != n){
+     72b:	a1 e0 99 00 00       	mov    0x99e0,%eax
+     730:	39 f0                	cmp    %esi,%eax
+     732:	75 7f                	jne    7b3 <writetest1+0x133>
+    n++;
+     734:	83 c6 01             	add    $0x1,%esi
+    i = read(fd, buf, 512);
+     737:	83 ec 04             	sub    $0x4,%esp
+     73a:	68 00 02 00 00       	push   $0x200
+     73f:	68 e0 99 00 00       	push   $0x99e0
+     744:	53                   	push   %ebx
+     745:	e8 86 3d 00 00       	call   44d0 <read>
+    if(i == 0){
+     74a:	83 c4 10             	add    $0x10,%esp
+     74d:	85 c0                	test   %eax,%eax
+     74f:	75 cf                	jne    720 <writetest1+0xa0>
+      if(n == MAXFILE - 1){
+     751:	81 fe 8b 00 00 00    	cmp    $0x8b,%esi
+     757:	0f 84 86 00 00 00    	je     7e3 <writetest1+0x163>
+  close(fd);
+     75d:	83 ec 0c             	sub    $0xc,%esp
+     760:	53                   	push   %ebx
+     761:	e8 a4 3d 00 00       	call   450a <close>
+  if(unlink("big") < 0){
+     766:	c7 04 24 b8 4e 00 00 	movl   $0x4eb8,(%esp)
+     76d:	e8 29 3e 00 00       	call   459b <unlink>
+     772:	83 c4 10             	add    $0x10,%esp
+     775:	85 c0                	test   %eax,%eax
+     777:	0f 88 af 00 00 00    	js     82c <writetest1+0x1ac>
+  printf(stdout, "big files ok\n");
+     77d:	83 ec 08             	sub    $0x8,%esp
+     780:	68 df 4e 00 00       	push   $0x4edf
+     785:	ff 35 98 72 00 00    	push   0x7298
+     78b:	e8 80 41 00 00       	call   4910 <printf>
+}
+     790:	83 c4 10             	add    $0x10,%esp
+     793:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     796:	5b                   	pop    %ebx
+     797:	5e                   	pop    %esi
+     798:	5d                   	pop    %ebp
+     799:	c3                   	ret
+      printf(stdout, "error: write big file failed\n", i);
+     79a:	83 ec 04             	sub    $0x4,%esp
+     79d:	53                   	push   %ebx
+     79e:	68 68 4e 00 00       	push   $0x4e68
+     7a3:	ff 35 98 72 00 00    	push   0x7298
+     7a9:	e8 62 41 00 00       	call   4910 <printf>
+      exit();
+     7ae:	e8 c6 3c 00 00       	call   4479 <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     7b3:	50                   	push   %eax
+     7b4:	56                   	push   %esi
+     7b5:	68 34 5f 00 00       	push   $0x5f34
+     7ba:	ff 35 98 72 00 00    	push   0x7298
+     7c0:	e8 4b 41 00 00       	call   4910 <printf>
+      exit();
+     7c5:	e8 af 3c 00 00       	call   4479 <exit>
+      printf(stdout, "read failed %d\n", i);
+     7ca:	83 ec 04             	sub    $0x4,%esp
+     7cd:	50                   	push   %eax
+     7ce:	68 bc 4e 00 00       	push   $0x4ebc
+     7d3:	ff 35 98 72 00 00    	push   0x7298
+     7d9:	e8 32 41 00 00       	call   4910 <printf>
+      exit();
+     7de:	e8 96 3c 00 00       	call   4479 <exit>
+        printf(stdout, "read only %d blocks from big", n);
+     7e3:	52                   	push   %edx
+     7e4:	68 8b 00 00 00       	push   $0x8b
+     7e9:	68 9f 4e 00 00       	push   $0x4e9f
+     7ee:	ff 35 98 72 00 00    	push   0x7298
+     7f4:	e8 17 41 00 00       	call   4910 <printf>
+        exit();
+     7f9:	e8 7b 3c 00 00       	call   4479 <exit>
+    printf(stdout, "error: open big failed!\n");
+     7fe:	51                   	push   %ecx
+     7ff:	51                   	push   %ecx
+     800:	68 86 4e 00 00       	push   $0x4e86
+     805:	ff 35 98 72 00 00    	push   0x7298
+     80b:	e8 00 41 00 00       	call   4910 <printf>
+    exit();
+     810:	e8 64 3c 00 00       	call   4479 <exit>
+    printf(stdout, "error: creat big failed!\n");
+     815:	50                   	push   %eax
+     816:	50                   	push   %eax
+     817:	68 4e 4e 00 00       	push   $0x4e4e
+     81c:	ff 35 98 72 00 00    	push   0x7298
+     822:	e8 e9 40 00 00       	call   4910 <printf>
+    exit();
+     827:	e8 4d 3c 00 00       	call   4479 <exit>
+    printf(stdout, "unlink big failed\n");
+     82c:	50                   	push   %eax
+     82d:	50                   	push   %eax
+     82e:	68 cc 4e 00 00       	push   $0x4ecc
+     833:	ff 35 98 72 00 00    	push   0x7298
+     839:	e8 d2 40 00 00       	call   4910 <printf>
+    exit();
+     83e:	e8 36 3c 00 00       	call   4479 <exit>
+     843:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     84a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000850 <createtest>:
+{
+     850:	55                   	push   %ebp
+     851:	89 e5                	mov    %esp,%ebp
+     853:	53                   	push   %ebx
+  name[2] = '\0';
+     854:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+     859:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "many creates, followed by unlink test\n");
+     85c:	68 54 5f 00 00       	push   $0x5f54
+     861:	ff 35 98 72 00 00    	push   0x7298
+     867:	e8 a4 40 00 00       	call   4910 <printf>
+  name[0] = 'a';
+     86c:	c6 05 d0 99 00 00 61 	movb   $0x61,0x99d0
+  name[2] = '\0';
+     873:	83 c4 10             	add    $0x10,%esp
+     876:	c6 05 d2 99 00 00 00 	movb   $0x0,0x99d2
+  for(i = 0; i < 52; i++){
+     87d:	8d 76 00             	lea    0x0(%esi),%esi
+    fd = open(name, O_CREATE|O_RDWR);
+     880:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+     883:	88 1d d1 99 00 00    	mov    %bl,0x99d1
+  for(i = 0; i < 52; i++){
+     889:	83 c3 01             	add    $0x1,%ebx
+    fd = open(name, O_CREATE|O_RDWR);
+     88c:	68 02 02 00 00       	push   $0x202
+     891:	68 d0 99 00 00       	push   $0x99d0
+     896:	e8 c6 3c 00 00       	call   4561 <open>
+    close(fd);
+     89b:	89 04 24             	mov    %eax,(%esp)
+     89e:	e8 67 3c 00 00       	call   450a <close>
+  for(i = 0; i < 52; i++){
+     8a3:	83 c4 10             	add    $0x10,%esp
+     8a6:	80 fb 64             	cmp    $0x64,%bl
+     8a9:	75 d5                	jne    880 <createtest+0x30>
+  name[0] = 'a';
+     8ab:	c6 05 d0 99 00 00 61 	movb   $0x61,0x99d0
+  name[2] = '\0';
+     8b2:	bb 30 00 00 00       	mov    $0x30,%ebx
+     8b7:	c6 05 d2 99 00 00 00 	movb   $0x0,0x99d2
+  for(i = 0; i < 52; i++){
+     8be:	66 90                	xchg   %ax,%ax
+    unlink(name);
+     8c0:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+     8c3:	88 1d d1 99 00 00    	mov    %bl,0x99d1
+  for(i = 0; i < 52; i++){
+     8c9:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+     8cc:	68 d0 99 00 00       	push   $0x99d0
+     8d1:	e8 c5 3c 00 00       	call   459b <unlink>
+  for(i = 0; i < 52; i++){
+     8d6:	83 c4 10             	add    $0x10,%esp
+     8d9:	80 fb 64             	cmp    $0x64,%bl
+     8dc:	75 e2                	jne    8c0 <createtest+0x70>
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     8de:	83 ec 08             	sub    $0x8,%esp
+     8e1:	68 7c 5f 00 00       	push   $0x5f7c
+     8e6:	ff 35 98 72 00 00    	push   0x7298
+     8ec:	e8 1f 40 00 00       	call   4910 <printf>
+}
+     8f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     8f4:	83 c4 10             	add    $0x10,%esp
+     8f7:	c9                   	leave
+     8f8:	c3                   	ret
+     8f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000900 <dirtest>:
+{
+     900:	55                   	push   %ebp
+     901:	89 e5                	mov    %esp,%ebp
+     903:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     906:	68 ed 4e 00 00       	push   $0x4eed
+     90b:	ff 35 98 72 00 00    	push   0x7298
+     911:	e8 fa 3f 00 00       	call   4910 <printf>
+  if(mkdir("dir0") < 0){
+     916:	c7 04 24 f9 4e 00 00 	movl   $0x4ef9,(%esp)
+     91d:	e8 d0 3c 00 00       	call   45f2 <mkdir>
+     922:	83 c4 10             	add    $0x10,%esp
+     925:	85 c0                	test   %eax,%eax
+     927:	78 58                	js     981 <dirtest+0x81>
+  if(chdir("dir0") < 0){
+     929:	83 ec 0c             	sub    $0xc,%esp
+     92c:	68 f9 4e 00 00       	push   $0x4ef9
+     931:	e8 d9 3c 00 00       	call   460f <chdir>
+     936:	83 c4 10             	add    $0x10,%esp
+     939:	85 c0                	test   %eax,%eax
+     93b:	0f 88 85 00 00 00    	js     9c6 <dirtest+0xc6>
+  if(chdir("..") < 0){
+     941:	83 ec 0c             	sub    $0xc,%esp
+     944:	68 9e 54 00 00       	push   $0x549e
+     949:	e8 c1 3c 00 00       	call   460f <chdir>
+     94e:	83 c4 10             	add    $0x10,%esp
+     951:	85 c0                	test   %eax,%eax
+     953:	78 5a                	js     9af <dirtest+0xaf>
+  if(unlink("dir0") < 0){
+     955:	83 ec 0c             	sub    $0xc,%esp
+     958:	68 f9 4e 00 00       	push   $0x4ef9
+     95d:	e8 39 3c 00 00       	call   459b <unlink>
+     962:	83 c4 10             	add    $0x10,%esp
+     965:	85 c0                	test   %eax,%eax
+     967:	78 2f                	js     998 <dirtest+0x98>
+  printf(stdout, "mkdir test ok\n");
+     969:	83 ec 08             	sub    $0x8,%esp
+     96c:	68 36 4f 00 00       	push   $0x4f36
+     971:	ff 35 98 72 00 00    	push   0x7298
+     977:	e8 94 3f 00 00       	call   4910 <printf>
+}
+     97c:	83 c4 10             	add    $0x10,%esp
+     97f:	c9                   	leave
+     980:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     981:	50                   	push   %eax
+     982:	50                   	push   %eax
+     983:	68 38 4c 00 00       	push   $0x4c38
+     988:	ff 35 98 72 00 00    	push   0x7298
+     98e:	e8 7d 3f 00 00       	call   4910 <printf>
+    exit();
+     993:	e8 e1 3a 00 00       	call   4479 <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     998:	50                   	push   %eax
+     999:	50                   	push   %eax
+     99a:	68 22 4f 00 00       	push   $0x4f22
+     99f:	ff 35 98 72 00 00    	push   0x7298
+     9a5:	e8 66 3f 00 00       	call   4910 <printf>
+    exit();
+     9aa:	e8 ca 3a 00 00       	call   4479 <exit>
+    printf(stdout, "chdir .. failed\n");
+     9af:	52                   	push   %edx
+     9b0:	52                   	push   %edx
+     9b1:	68 11 4f 00 00       	push   $0x4f11
+     9b6:	ff 35 98 72 00 00    	push   0x7298
+     9bc:	e8 4f 3f 00 00       	call   4910 <printf>
+    exit();
+     9c1:	e8 b3 3a 00 00       	call   4479 <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     9c6:	51                   	push   %ecx
+     9c7:	51                   	push   %ecx
+     9c8:	68 fe 4e 00 00       	push   $0x4efe
+     9cd:	ff 35 98 72 00 00    	push   0x7298
+     9d3:	e8 38 3f 00 00       	call   4910 <printf>
+    exit();
+     9d8:	e8 9c 3a 00 00       	call   4479 <exit>
+     9dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009e0 <exectest>:
+{
+     9e0:	55                   	push   %ebp
+     9e1:	89 e5                	mov    %esp,%ebp
+     9e3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     9e6:	68 45 4f 00 00       	push   $0x4f45
+     9eb:	ff 35 98 72 00 00    	push   0x7298
+     9f1:	e8 1a 3f 00 00       	call   4910 <printf>
+  if(exec("echo", echoargv) < 0){
+     9f6:	5a                   	pop    %edx
+     9f7:	59                   	pop    %ecx
+     9f8:	68 9c 72 00 00       	push   $0x729c
+     9fd:	68 0e 4d 00 00       	push   $0x4d0e
+     a02:	e8 3d 3b 00 00       	call   4544 <exec>
+     a07:	83 c4 10             	add    $0x10,%esp
+     a0a:	85 c0                	test   %eax,%eax
+     a0c:	78 02                	js     a10 <exectest+0x30>
+}
+     a0e:	c9                   	leave
+     a0f:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     a10:	50                   	push   %eax
+     a11:	50                   	push   %eax
+     a12:	68 50 4f 00 00       	push   $0x4f50
+     a17:	ff 35 98 72 00 00    	push   0x7298
+     a1d:	e8 ee 3e 00 00       	call   4910 <printf>
+    exit();
+     a22:	e8 52 3a 00 00       	call   4479 <exit>
+     a27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a2e:	66 90                	xchg   %ax,%ax
+
+00000a30 <pipe1>:
+{
+     a30:	55                   	push   %ebp
+     a31:	89 e5                	mov    %esp,%ebp
+     a33:	57                   	push   %edi
+     a34:	56                   	push   %esi
+  if(pipe(fds) != 0){
+     a35:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     a38:	53                   	push   %ebx
+     a39:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+     a3c:	50                   	push   %eax
+     a3d:	e8 71 3a 00 00       	call   44b3 <pipe>
+     a42:	83 c4 10             	add    $0x10,%esp
+     a45:	85 c0                	test   %eax,%eax
+     a47:	0f 85 41 01 00 00    	jne    b8e <pipe1+0x15e>
+     a4d:	89 c6                	mov    %eax,%esi
+  pid = fork();
+     a4f:	e8 08 3a 00 00       	call   445c <fork>
+  if(pid == 0){
+     a54:	85 c0                	test   %eax,%eax
+     a56:	0f 84 92 00 00 00    	je     aee <pipe1+0xbe>
+  } else if(pid > 0){
+     a5c:	0f 8e 3f 01 00 00    	jle    ba1 <pipe1+0x171>
+    close(fds[1]);
+     a62:	83 ec 0c             	sub    $0xc,%esp
+     a65:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+     a68:	31 db                	xor    %ebx,%ebx
+    cc = 1;
+     a6a:	bf 01 00 00 00       	mov    $0x1,%edi
+    close(fds[1]);
+     a6f:	e8 96 3a 00 00       	call   450a <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+     a74:	83 c4 10             	add    $0x10,%esp
+     a77:	83 ec 04             	sub    $0x4,%esp
+     a7a:	57                   	push   %edi
+     a7b:	68 e0 99 00 00       	push   $0x99e0
+     a80:	ff 75 e0             	push   -0x20(%ebp)
+     a83:	e8 48 3a 00 00       	call   44d0 <read>
+     a88:	83 c4 10             	add    $0x10,%esp
+     a8b:	89 c1                	mov    %eax,%ecx
+     a8d:	85 c0                	test   %eax,%eax
+     a8f:	0f 8e b8 00 00 00    	jle    b4d <pipe1+0x11d>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     a95:	89 f0                	mov    %esi,%eax
+     a97:	32 05 e0 99 00 00    	xor    0x99e0,%al
+     a9d:	0f b6 c0             	movzbl %al,%eax
+     aa0:	85 c0                	test   %eax,%eax
+     aa2:	75 30                	jne    ad4 <pipe1+0xa4>
+     aa4:	83 c6 01             	add    $0x1,%esi
+     aa7:	eb 0f                	jmp    ab8 <pipe1+0x88>
+     aa9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ab0:	38 90 e0 99 00 00    	cmp    %dl,0x99e0(%eax)
+     ab6:	75 1c                	jne    ad4 <pipe1+0xa4>
+     ab8:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+     abb:	83 c0 01             	add    $0x1,%eax
+     abe:	39 c1                	cmp    %eax,%ecx
+     ac0:	75 ee                	jne    ab0 <pipe1+0x80>
+      cc = cc * 2;
+     ac2:	01 ff                	add    %edi,%edi
+      if(cc > sizeof(buf))
+     ac4:	b8 00 20 00 00       	mov    $0x2000,%eax
+      total += n;
+     ac9:	01 cb                	add    %ecx,%ebx
+      if(cc > sizeof(buf))
+     acb:	89 d6                	mov    %edx,%esi
+     acd:	39 c7                	cmp    %eax,%edi
+     acf:	0f 4f f8             	cmovg  %eax,%edi
+     ad2:	eb a3                	jmp    a77 <pipe1+0x47>
+          printf(1, "pipe1 oops 2\n");
+     ad4:	83 ec 08             	sub    $0x8,%esp
+     ad7:	68 7f 4f 00 00       	push   $0x4f7f
+     adc:	6a 01                	push   $0x1
+     ade:	e8 2d 3e 00 00       	call   4910 <printf>
+     ae3:	83 c4 10             	add    $0x10,%esp
+}
+     ae6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ae9:	5b                   	pop    %ebx
+     aea:	5e                   	pop    %esi
+     aeb:	5f                   	pop    %edi
+     aec:	5d                   	pop    %ebp
+     aed:	c3                   	ret
+    close(fds[0]);
+     aee:	83 ec 0c             	sub    $0xc,%esp
+     af1:	ff 75 e0             	push   -0x20(%ebp)
+  seq = 0;
+     af4:	31 db                	xor    %ebx,%ebx
+    close(fds[0]);
+     af6:	e8 0f 3a 00 00       	call   450a <close>
+     afb:	83 c4 10             	add    $0x10,%esp
+     afe:	66 90                	xchg   %ax,%ax
+      for(i = 0; i < 1033; i++)
+     b00:	31 c0                	xor    %eax,%eax
+     b02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        buf[i] = seq++;
+     b08:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      for(i = 0; i < 1033; i++)
+     b0b:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     b0e:	88 90 df 99 00 00    	mov    %dl,0x99df(%eax)
+      for(i = 0; i < 1033; i++)
+     b14:	3d 09 04 00 00       	cmp    $0x409,%eax
+     b19:	75 ed                	jne    b08 <pipe1+0xd8>
+      if(write(fds[1], buf, 1033) != 1033){
+     b1b:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+     b1e:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+     b24:	68 09 04 00 00       	push   $0x409
+     b29:	68 e0 99 00 00       	push   $0x99e0
+     b2e:	ff 75 e4             	push   -0x1c(%ebp)
+     b31:	e8 b7 39 00 00       	call   44ed <write>
+     b36:	83 c4 10             	add    $0x10,%esp
+     b39:	3d 09 04 00 00       	cmp    $0x409,%eax
+     b3e:	75 74                	jne    bb4 <pipe1+0x184>
+    for(n = 0; n < 5; n++){
+     b40:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     b46:	75 b8                	jne    b00 <pipe1+0xd0>
+    exit();
+     b48:	e8 2c 39 00 00       	call   4479 <exit>
+    if(total != 5 * 1033){
+     b4d:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     b53:	75 26                	jne    b7b <pipe1+0x14b>
+    close(fds[0]);
+     b55:	83 ec 0c             	sub    $0xc,%esp
+     b58:	ff 75 e0             	push   -0x20(%ebp)
+     b5b:	e8 aa 39 00 00       	call   450a <close>
+    wait();
+     b60:	e8 31 39 00 00       	call   4496 <wait>
+  printf(1, "pipe1 ok\n");
+     b65:	5a                   	pop    %edx
+     b66:	59                   	pop    %ecx
+     b67:	68 a4 4f 00 00       	push   $0x4fa4
+     b6c:	6a 01                	push   $0x1
+     b6e:	e8 9d 3d 00 00       	call   4910 <printf>
+     b73:	83 c4 10             	add    $0x10,%esp
+     b76:	e9 6b ff ff ff       	jmp    ae6 <pipe1+0xb6>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     b7b:	56                   	push   %esi
+     b7c:	53                   	push   %ebx
+     b7d:	68 8d 4f 00 00       	push   $0x4f8d
+     b82:	6a 01                	push   $0x1
+     b84:	e8 87 3d 00 00       	call   4910 <printf>
+      exit();
+     b89:	e8 eb 38 00 00       	call   4479 <exit>
+    printf(1, "pipe() failed\n");
+     b8e:	50                   	push   %eax
+     b8f:	50                   	push   %eax
+     b90:	68 62 4f 00 00       	push   $0x4f62
+     b95:	6a 01                	push   $0x1
+     b97:	e8 74 3d 00 00       	call   4910 <printf>
+    exit();
+     b9c:	e8 d8 38 00 00       	call   4479 <exit>
+    printf(1, "fork() failed\n");
+     ba1:	50                   	push   %eax
+     ba2:	50                   	push   %eax
+     ba3:	68 ae 4f 00 00       	push   $0x4fae
+     ba8:	6a 01                	push   $0x1
+     baa:	e8 61 3d 00 00       	call   4910 <printf>
+    exit();
+     baf:	e8 c5 38 00 00       	call   4479 <exit>
+        printf(1, "pipe1 oops 1\n");
+     bb4:	57                   	push   %edi
+     bb5:	57                   	push   %edi
+     bb6:	68 71 4f 00 00       	push   $0x4f71
+     bbb:	6a 01                	push   $0x1
+     bbd:	e8 4e 3d 00 00       	call   4910 <printf>
+        exit();
+     bc2:	e8 b2 38 00 00       	call   4479 <exit>
+     bc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bce:	66 90                	xchg   %ax,%ax
+
+00000bd0 <preempt>:
+{
+     bd0:	55                   	push   %ebp
+     bd1:	89 e5                	mov    %esp,%ebp
+     bd3:	57                   	push   %edi
+     bd4:	56                   	push   %esi
+     bd5:	53                   	push   %ebx
+     bd6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+     bd9:	68 bd 4f 00 00       	push   $0x4fbd
+     bde:	6a 01                	push   $0x1
+     be0:	e8 2b 3d 00 00       	call   4910 <printf>
+  pid1 = fork();
+     be5:	e8 72 38 00 00       	call   445c <fork>
+  if(pid1 == 0)
+     bea:	83 c4 10             	add    $0x10,%esp
+     bed:	85 c0                	test   %eax,%eax
+     bef:	75 07                	jne    bf8 <preempt+0x28>
+    for(;;)
+     bf1:	eb fe                	jmp    bf1 <preempt+0x21>
+     bf3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     bf7:	90                   	nop
+     bf8:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+     bfa:	e8 5d 38 00 00       	call   445c <fork>
+     bff:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+     c01:	85 c0                	test   %eax,%eax
+     c03:	75 0b                	jne    c10 <preempt+0x40>
+    for(;;)
+     c05:	eb fe                	jmp    c05 <preempt+0x35>
+     c07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c0e:	66 90                	xchg   %ax,%ax
+  pipe(pfds);
+     c10:	83 ec 0c             	sub    $0xc,%esp
+     c13:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     c16:	50                   	push   %eax
+     c17:	e8 97 38 00 00       	call   44b3 <pipe>
+  pid3 = fork();
+     c1c:	e8 3b 38 00 00       	call   445c <fork>
+  if(pid3 == 0){
+     c21:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+     c24:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+     c26:	85 c0                	test   %eax,%eax
+     c28:	75 3e                	jne    c68 <preempt+0x98>
+    close(pfds[0]);
+     c2a:	83 ec 0c             	sub    $0xc,%esp
+     c2d:	ff 75 e0             	push   -0x20(%ebp)
+     c30:	e8 d5 38 00 00       	call   450a <close>
+    if(write(pfds[1], "x", 1) != 1)
+     c35:	83 c4 0c             	add    $0xc,%esp
+     c38:	6a 01                	push   $0x1
+     c3a:	68 82 55 00 00       	push   $0x5582
+     c3f:	ff 75 e4             	push   -0x1c(%ebp)
+     c42:	e8 a6 38 00 00       	call   44ed <write>
+     c47:	83 c4 10             	add    $0x10,%esp
+     c4a:	83 f8 01             	cmp    $0x1,%eax
+     c4d:	0f 85 b8 00 00 00    	jne    d0b <preempt+0x13b>
+    close(pfds[1]);
+     c53:	83 ec 0c             	sub    $0xc,%esp
+     c56:	ff 75 e4             	push   -0x1c(%ebp)
+     c59:	e8 ac 38 00 00       	call   450a <close>
+     c5e:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     c61:	eb fe                	jmp    c61 <preempt+0x91>
+     c63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c67:	90                   	nop
+  close(pfds[1]);
+     c68:	83 ec 0c             	sub    $0xc,%esp
+     c6b:	ff 75 e4             	push   -0x1c(%ebp)
+     c6e:	e8 97 38 00 00       	call   450a <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     c73:	83 c4 0c             	add    $0xc,%esp
+     c76:	68 00 20 00 00       	push   $0x2000
+     c7b:	68 e0 99 00 00       	push   $0x99e0
+     c80:	ff 75 e0             	push   -0x20(%ebp)
+     c83:	e8 48 38 00 00       	call   44d0 <read>
+     c88:	83 c4 10             	add    $0x10,%esp
+     c8b:	83 f8 01             	cmp    $0x1,%eax
+     c8e:	75 67                	jne    cf7 <preempt+0x127>
+  close(pfds[0]);
+     c90:	83 ec 0c             	sub    $0xc,%esp
+     c93:	ff 75 e0             	push   -0x20(%ebp)
+     c96:	e8 6f 38 00 00       	call   450a <close>
+  printf(1, "kill... ");
+     c9b:	58                   	pop    %eax
+     c9c:	5a                   	pop    %edx
+     c9d:	68 ee 4f 00 00       	push   $0x4fee
+     ca2:	6a 01                	push   $0x1
+     ca4:	e8 67 3c 00 00       	call   4910 <printf>
+  kill(pid1);
+     ca9:	89 1c 24             	mov    %ebx,(%esp)
+     cac:	e8 76 38 00 00       	call   4527 <kill>
+  kill(pid2);
+     cb1:	89 34 24             	mov    %esi,(%esp)
+     cb4:	e8 6e 38 00 00       	call   4527 <kill>
+  kill(pid3);
+     cb9:	89 3c 24             	mov    %edi,(%esp)
+     cbc:	e8 66 38 00 00       	call   4527 <kill>
+  printf(1, "wait... ");
+     cc1:	59                   	pop    %ecx
+     cc2:	5b                   	pop    %ebx
+     cc3:	68 f7 4f 00 00       	push   $0x4ff7
+     cc8:	6a 01                	push   $0x1
+     cca:	e8 41 3c 00 00       	call   4910 <printf>
+  wait();
+     ccf:	e8 c2 37 00 00       	call   4496 <wait>
+  wait();
+     cd4:	e8 bd 37 00 00       	call   4496 <wait>
+  wait();
+     cd9:	e8 b8 37 00 00       	call   4496 <wait>
+  printf(1, "preempt ok\n");
+     cde:	5e                   	pop    %esi
+     cdf:	5f                   	pop    %edi
+     ce0:	68 00 50 00 00       	push   $0x5000
+     ce5:	6a 01                	push   $0x1
+     ce7:	e8 24 3c 00 00       	call   4910 <printf>
+     cec:	83 c4 10             	add    $0x10,%esp
+}
+     cef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cf2:	5b                   	pop    %ebx
+     cf3:	5e                   	pop    %esi
+     cf4:	5f                   	pop    %edi
+     cf5:	5d                   	pop    %ebp
+     cf6:	c3                   	ret
+    printf(1, "preempt read error");
+     cf7:	83 ec 08             	sub    $0x8,%esp
+     cfa:	68 db 4f 00 00       	push   $0x4fdb
+     cff:	6a 01                	push   $0x1
+     d01:	e8 0a 3c 00 00       	call   4910 <printf>
+     d06:	83 c4 10             	add    $0x10,%esp
+     d09:	eb e4                	jmp    cef <preempt+0x11f>
+      printf(1, "preempt write error");
+     d0b:	83 ec 08             	sub    $0x8,%esp
+     d0e:	68 c7 4f 00 00       	push   $0x4fc7
+     d13:	6a 01                	push   $0x1
+     d15:	e8 f6 3b 00 00       	call   4910 <printf>
+     d1a:	83 c4 10             	add    $0x10,%esp
+     d1d:	e9 31 ff ff ff       	jmp    c53 <preempt+0x83>
+     d22:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000d30 <exitwait>:
+{
+     d30:	55                   	push   %ebp
+     d31:	89 e5                	mov    %esp,%ebp
+     d33:	56                   	push   %esi
+     d34:	be 64 00 00 00       	mov    $0x64,%esi
+     d39:	53                   	push   %ebx
+     d3a:	eb 14                	jmp    d50 <exitwait+0x20>
+     d3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid){
+     d40:	74 68                	je     daa <exitwait+0x7a>
+      if(wait() != pid){
+     d42:	e8 4f 37 00 00       	call   4496 <wait>
+     d47:	39 d8                	cmp    %ebx,%eax
+     d49:	75 2d                	jne    d78 <exitwait+0x48>
+  for(i = 0; i < 100; i++){
+     d4b:	83 ee 01             	sub    $0x1,%esi
+     d4e:	74 41                	je     d91 <exitwait+0x61>
+    pid = fork();
+     d50:	e8 07 37 00 00       	call   445c <fork>
+     d55:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     d57:	85 c0                	test   %eax,%eax
+     d59:	79 e5                	jns    d40 <exitwait+0x10>
+      printf(1, "fork failed\n");
+     d5b:	83 ec 08             	sub    $0x8,%esp
+     d5e:	68 77 5d 00 00       	push   $0x5d77
+     d63:	6a 01                	push   $0x1
+     d65:	e8 a6 3b 00 00       	call   4910 <printf>
+      return;
+     d6a:	83 c4 10             	add    $0x10,%esp
+}
+     d6d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d70:	5b                   	pop    %ebx
+     d71:	5e                   	pop    %esi
+     d72:	5d                   	pop    %ebp
+     d73:	c3                   	ret
+     d74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "wait wrong pid\n");
+     d78:	83 ec 08             	sub    $0x8,%esp
+     d7b:	68 0c 50 00 00       	push   $0x500c
+     d80:	6a 01                	push   $0x1
+     d82:	e8 89 3b 00 00       	call   4910 <printf>
+        return;
+     d87:	83 c4 10             	add    $0x10,%esp
+}
+     d8a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d8d:	5b                   	pop    %ebx
+     d8e:	5e                   	pop    %esi
+     d8f:	5d                   	pop    %ebp
+     d90:	c3                   	ret
+  printf(1, "exitwait ok\n");
+     d91:	83 ec 08             	sub    $0x8,%esp
+     d94:	68 1c 50 00 00       	push   $0x501c
+     d99:	6a 01                	push   $0x1
+     d9b:	e8 70 3b 00 00       	call   4910 <printf>
+     da0:	83 c4 10             	add    $0x10,%esp
+}
+     da3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     da6:	5b                   	pop    %ebx
+     da7:	5e                   	pop    %esi
+     da8:	5d                   	pop    %ebp
+     da9:	c3                   	ret
+      exit();
+     daa:	e8 ca 36 00 00       	call   4479 <exit>
+     daf:	90                   	nop
+
+00000db0 <mem>:
+{
+     db0:	55                   	push   %ebp
+     db1:	89 e5                	mov    %esp,%ebp
+     db3:	56                   	push   %esi
+     db4:	31 f6                	xor    %esi,%esi
+     db6:	53                   	push   %ebx
+  printf(1, "mem test\n");
+     db7:	83 ec 08             	sub    $0x8,%esp
+     dba:	68 29 50 00 00       	push   $0x5029
+     dbf:	6a 01                	push   $0x1
+     dc1:	e8 4a 3b 00 00       	call   4910 <printf>
+  ppid = getpid();
+     dc6:	e8 7e 38 00 00       	call   4649 <getpid>
+     dcb:	89 c3                	mov    %eax,%ebx
+  if((pid = fork()) == 0){
+     dcd:	e8 8a 36 00 00       	call   445c <fork>
+     dd2:	83 c4 10             	add    $0x10,%esp
+     dd5:	85 c0                	test   %eax,%eax
+     dd7:	74 0b                	je     de4 <mem+0x34>
+     dd9:	e9 8a 00 00 00       	jmp    e68 <mem+0xb8>
+     dde:	66 90                	xchg   %ax,%ax
+      *(char**)m2 = m1;
+     de0:	89 30                	mov    %esi,(%eax)
+     de2:	89 c6                	mov    %eax,%esi
+    while((m2 = malloc(10001)) != 0){
+     de4:	83 ec 0c             	sub    $0xc,%esp
+     de7:	68 11 27 00 00       	push   $0x2711
+     dec:	e8 5f 3d 00 00       	call   4b50 <malloc>
+     df1:	83 c4 10             	add    $0x10,%esp
+     df4:	85 c0                	test   %eax,%eax
+     df6:	75 e8                	jne    de0 <mem+0x30>
+    while(m1){
+     df8:	85 f6                	test   %esi,%esi
+     dfa:	74 18                	je     e14 <mem+0x64>
+     dfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      m2 = *(char**)m1;
+     e00:	89 f0                	mov    %esi,%eax
+      free(m1);
+     e02:	83 ec 0c             	sub    $0xc,%esp
+      m2 = *(char**)m1;
+     e05:	8b 36                	mov    (%esi),%esi
+      free(m1);
+     e07:	50                   	push   %eax
+     e08:	e8 b3 3c 00 00       	call   4ac0 <free>
+    while(m1){
+     e0d:	83 c4 10             	add    $0x10,%esp
+     e10:	85 f6                	test   %esi,%esi
+     e12:	75 ec                	jne    e00 <mem+0x50>
+    m1 = malloc(1024*20);
+     e14:	83 ec 0c             	sub    $0xc,%esp
+     e17:	68 00 50 00 00       	push   $0x5000
+     e1c:	e8 2f 3d 00 00       	call   4b50 <malloc>
+    if(m1 == 0){
+     e21:	83 c4 10             	add    $0x10,%esp
+     e24:	85 c0                	test   %eax,%eax
+     e26:	74 20                	je     e48 <mem+0x98>
+    free(m1);
+     e28:	83 ec 0c             	sub    $0xc,%esp
+     e2b:	50                   	push   %eax
+     e2c:	e8 8f 3c 00 00       	call   4ac0 <free>
+    printf(1, "mem ok\n");
+     e31:	58                   	pop    %eax
+     e32:	5a                   	pop    %edx
+     e33:	68 4d 50 00 00       	push   $0x504d
+     e38:	6a 01                	push   $0x1
+     e3a:	e8 d1 3a 00 00       	call   4910 <printf>
+    exit();
+     e3f:	e8 35 36 00 00       	call   4479 <exit>
+     e44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "couldn't allocate mem?!!\n");
+     e48:	83 ec 08             	sub    $0x8,%esp
+     e4b:	68 33 50 00 00       	push   $0x5033
+     e50:	6a 01                	push   $0x1
+     e52:	e8 b9 3a 00 00       	call   4910 <printf>
+      kill(ppid);
+     e57:	89 1c 24             	mov    %ebx,(%esp)
+     e5a:	e8 c8 36 00 00       	call   4527 <kill>
+      exit();
+     e5f:	e8 15 36 00 00       	call   4479 <exit>
+     e64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+     e68:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e6b:	5b                   	pop    %ebx
+     e6c:	5e                   	pop    %esi
+     e6d:	5d                   	pop    %ebp
+    wait();
+     e6e:	e9 23 36 00 00       	jmp    4496 <wait>
+     e73:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000e80 <sharedfd>:
+{
+     e80:	55                   	push   %ebp
+     e81:	89 e5                	mov    %esp,%ebp
+     e83:	57                   	push   %edi
+     e84:	56                   	push   %esi
+     e85:	53                   	push   %ebx
+     e86:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sharedfd test\n");
+     e89:	68 55 50 00 00       	push   $0x5055
+     e8e:	6a 01                	push   $0x1
+     e90:	e8 7b 3a 00 00       	call   4910 <printf>
+  unlink("sharedfd");
+     e95:	c7 04 24 64 50 00 00 	movl   $0x5064,(%esp)
+     e9c:	e8 fa 36 00 00       	call   459b <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+     ea1:	5b                   	pop    %ebx
+     ea2:	5e                   	pop    %esi
+     ea3:	68 02 02 00 00       	push   $0x202
+     ea8:	68 64 50 00 00       	push   $0x5064
+     ead:	e8 af 36 00 00       	call   4561 <open>
+  if(fd < 0){
+     eb2:	83 c4 10             	add    $0x10,%esp
+     eb5:	85 c0                	test   %eax,%eax
+     eb7:	0f 88 2a 01 00 00    	js     fe7 <sharedfd+0x167>
+     ebd:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     ebf:	8d 75 de             	lea    -0x22(%ebp),%esi
+     ec2:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  pid = fork();
+     ec7:	e8 90 35 00 00       	call   445c <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     ecc:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+     ecf:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     ed2:	19 c0                	sbb    %eax,%eax
+     ed4:	83 ec 04             	sub    $0x4,%esp
+     ed7:	83 e0 f3             	and    $0xfffffff3,%eax
+     eda:	6a 0a                	push   $0xa
+     edc:	83 c0 70             	add    $0x70,%eax
+     edf:	50                   	push   %eax
+     ee0:	56                   	push   %esi
+     ee1:	e8 5a 33 00 00       	call   4240 <memset>
+     ee6:	83 c4 10             	add    $0x10,%esp
+     ee9:	eb 0a                	jmp    ef5 <sharedfd+0x75>
+     eeb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     eef:	90                   	nop
+  for(i = 0; i < 1000; i++){
+     ef0:	83 eb 01             	sub    $0x1,%ebx
+     ef3:	74 26                	je     f1b <sharedfd+0x9b>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+     ef5:	83 ec 04             	sub    $0x4,%esp
+     ef8:	6a 0a                	push   $0xa
+     efa:	56                   	push   %esi
+     efb:	57                   	push   %edi
+     efc:	e8 ec 35 00 00       	call   44ed <write>
+     f01:	83 c4 10             	add    $0x10,%esp
+     f04:	83 f8 0a             	cmp    $0xa,%eax
+     f07:	74 e7                	je     ef0 <sharedfd+0x70>
+      printf(1, "fstests: write sharedfd failed\n");
+     f09:	83 ec 08             	sub    $0x8,%esp
+     f0c:	68 d0 5f 00 00       	push   $0x5fd0
+     f11:	6a 01                	push   $0x1
+     f13:	e8 f8 39 00 00       	call   4910 <printf>
+      break;
+     f18:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+     f1b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     f1e:	85 c9                	test   %ecx,%ecx
+     f20:	0f 84 f5 00 00 00    	je     101b <sharedfd+0x19b>
+    wait();
+     f26:	e8 6b 35 00 00       	call   4496 <wait>
+  close(fd);
+     f2b:	83 ec 0c             	sub    $0xc,%esp
+  nc = np = 0;
+     f2e:	31 db                	xor    %ebx,%ebx
+  close(fd);
+     f30:	57                   	push   %edi
+     f31:	8d 7d e8             	lea    -0x18(%ebp),%edi
+     f34:	e8 d1 35 00 00       	call   450a <close>
+  fd = open("sharedfd", 0);
+     f39:	58                   	pop    %eax
+     f3a:	5a                   	pop    %edx
+     f3b:	6a 00                	push   $0x0
+     f3d:	68 64 50 00 00       	push   $0x5064
+     f42:	e8 1a 36 00 00       	call   4561 <open>
+  if(fd < 0){
+     f47:	83 c4 10             	add    $0x10,%esp
+  nc = np = 0;
+     f4a:	31 d2                	xor    %edx,%edx
+  fd = open("sharedfd", 0);
+     f4c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+     f4f:	85 c0                	test   %eax,%eax
+     f51:	0f 88 aa 00 00 00    	js     1001 <sharedfd+0x181>
+     f57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f5e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+     f60:	83 ec 04             	sub    $0x4,%esp
+     f63:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     f66:	6a 0a                	push   $0xa
+     f68:	56                   	push   %esi
+     f69:	ff 75 d0             	push   -0x30(%ebp)
+     f6c:	e8 5f 35 00 00       	call   44d0 <read>
+     f71:	83 c4 10             	add    $0x10,%esp
+     f74:	85 c0                	test   %eax,%eax
+     f76:	7e 28                	jle    fa0 <sharedfd+0x120>
+     f78:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     f7b:	89 f0                	mov    %esi,%eax
+     f7d:	eb 13                	jmp    f92 <sharedfd+0x112>
+     f7f:	90                   	nop
+        np++;
+     f80:	80 f9 70             	cmp    $0x70,%cl
+     f83:	0f 94 c1             	sete   %cl
+     f86:	0f b6 c9             	movzbl %cl,%ecx
+     f89:	01 cb                	add    %ecx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+     f8b:	83 c0 01             	add    $0x1,%eax
+     f8e:	39 f8                	cmp    %edi,%eax
+     f90:	74 ce                	je     f60 <sharedfd+0xe0>
+      if(buf[i] == 'c')
+     f92:	0f b6 08             	movzbl (%eax),%ecx
+     f95:	80 f9 63             	cmp    $0x63,%cl
+     f98:	75 e6                	jne    f80 <sharedfd+0x100>
+        nc++;
+     f9a:	83 c2 01             	add    $0x1,%edx
+      if(buf[i] == 'p')
+     f9d:	eb ec                	jmp    f8b <sharedfd+0x10b>
+     f9f:	90                   	nop
+  close(fd);
+     fa0:	83 ec 0c             	sub    $0xc,%esp
+     fa3:	ff 75 d0             	push   -0x30(%ebp)
+     fa6:	e8 5f 35 00 00       	call   450a <close>
+  unlink("sharedfd");
+     fab:	c7 04 24 64 50 00 00 	movl   $0x5064,(%esp)
+     fb2:	e8 e4 35 00 00       	call   459b <unlink>
+  if(nc == 10000 && np == 10000){
+     fb7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     fba:	83 c4 10             	add    $0x10,%esp
+     fbd:	81 fa 10 27 00 00    	cmp    $0x2710,%edx
+     fc3:	75 5b                	jne    1020 <sharedfd+0x1a0>
+     fc5:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+     fcb:	75 53                	jne    1020 <sharedfd+0x1a0>
+    printf(1, "sharedfd ok\n");
+     fcd:	83 ec 08             	sub    $0x8,%esp
+     fd0:	68 6d 50 00 00       	push   $0x506d
+     fd5:	6a 01                	push   $0x1
+     fd7:	e8 34 39 00 00       	call   4910 <printf>
+     fdc:	83 c4 10             	add    $0x10,%esp
+}
+     fdf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     fe2:	5b                   	pop    %ebx
+     fe3:	5e                   	pop    %esi
+     fe4:	5f                   	pop    %edi
+     fe5:	5d                   	pop    %ebp
+     fe6:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for writing");
+     fe7:	83 ec 08             	sub    $0x8,%esp
+     fea:	68 a4 5f 00 00       	push   $0x5fa4
+     fef:	6a 01                	push   $0x1
+     ff1:	e8 1a 39 00 00       	call   4910 <printf>
+    return;
+     ff6:	83 c4 10             	add    $0x10,%esp
+}
+     ff9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ffc:	5b                   	pop    %ebx
+     ffd:	5e                   	pop    %esi
+     ffe:	5f                   	pop    %edi
+     fff:	5d                   	pop    %ebp
+    1000:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    1001:	83 ec 08             	sub    $0x8,%esp
+    1004:	68 f0 5f 00 00       	push   $0x5ff0
+    1009:	6a 01                	push   $0x1
+    100b:	e8 00 39 00 00       	call   4910 <printf>
+    return;
+    1010:	83 c4 10             	add    $0x10,%esp
+}
+    1013:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1016:	5b                   	pop    %ebx
+    1017:	5e                   	pop    %esi
+    1018:	5f                   	pop    %edi
+    1019:	5d                   	pop    %ebp
+    101a:	c3                   	ret
+    exit();
+    101b:	e8 59 34 00 00       	call   4479 <exit>
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    1020:	53                   	push   %ebx
+    1021:	52                   	push   %edx
+    1022:	68 7a 50 00 00       	push   $0x507a
+    1027:	6a 01                	push   $0x1
+    1029:	e8 e2 38 00 00       	call   4910 <printf>
+    exit();
+    102e:	e8 46 34 00 00       	call   4479 <exit>
+    1033:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    103a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001040 <fourfiles>:
+{
+    1040:	55                   	push   %ebp
+    1041:	89 e5                	mov    %esp,%ebp
+    1043:	57                   	push   %edi
+    1044:	56                   	push   %esi
+    1045:	53                   	push   %ebx
+  for(pi = 0; pi < 4; pi++){
+    1046:	31 db                	xor    %ebx,%ebx
+{
+    1048:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    104b:	c7 45 d8 8f 50 00 00 	movl   $0x508f,-0x28(%ebp)
+    1052:	c7 45 dc d8 51 00 00 	movl   $0x51d8,-0x24(%ebp)
+    1059:	c7 45 e0 dc 51 00 00 	movl   $0x51dc,-0x20(%ebp)
+    1060:	c7 45 e4 92 50 00 00 	movl   $0x5092,-0x1c(%ebp)
+  printf(1, "fourfiles test\n");
+    1067:	68 95 50 00 00       	push   $0x5095
+    106c:	6a 01                	push   $0x1
+    106e:	e8 9d 38 00 00       	call   4910 <printf>
+    1073:	83 c4 10             	add    $0x10,%esp
+    fname = names[pi];
+    1076:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+    107a:	83 ec 0c             	sub    $0xc,%esp
+    107d:	56                   	push   %esi
+    107e:	e8 18 35 00 00       	call   459b <unlink>
+    pid = fork();
+    1083:	e8 d4 33 00 00       	call   445c <fork>
+    if(pid < 0){
+    1088:	83 c4 10             	add    $0x10,%esp
+    108b:	85 c0                	test   %eax,%eax
+    108d:	0f 88 65 01 00 00    	js     11f8 <fourfiles+0x1b8>
+    if(pid == 0){
+    1093:	0f 84 eb 00 00 00    	je     1184 <fourfiles+0x144>
+  for(pi = 0; pi < 4; pi++){
+    1099:	83 c3 01             	add    $0x1,%ebx
+    109c:	83 fb 04             	cmp    $0x4,%ebx
+    109f:	75 d5                	jne    1076 <fourfiles+0x36>
+    wait();
+    10a1:	e8 f0 33 00 00       	call   4496 <wait>
+  for(i = 0; i < 2; i++){
+    10a6:	31 f6                	xor    %esi,%esi
+    wait();
+    10a8:	e8 e9 33 00 00       	call   4496 <wait>
+    10ad:	e8 e4 33 00 00       	call   4496 <wait>
+    10b2:	e8 df 33 00 00       	call   4496 <wait>
+    fname = names[i];
+    10b7:	8b 5c b5 d8          	mov    -0x28(%ebp,%esi,4),%ebx
+    fd = open(fname, 0);
+    10bb:	83 ec 08             	sub    $0x8,%esp
+    total = 0;
+    10be:	31 ff                	xor    %edi,%edi
+    fd = open(fname, 0);
+    10c0:	6a 00                	push   $0x0
+    10c2:	53                   	push   %ebx
+    10c3:	e8 99 34 00 00       	call   4561 <open>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    10c8:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    10cb:	83 c4 10             	add    $0x10,%esp
+    10ce:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    10d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10d8:	83 ec 04             	sub    $0x4,%esp
+    10db:	68 00 20 00 00       	push   $0x2000
+    10e0:	68 e0 99 00 00       	push   $0x99e0
+    10e5:	ff 75 d4             	push   -0x2c(%ebp)
+    10e8:	e8 e3 33 00 00       	call   44d0 <read>
+    10ed:	83 c4 10             	add    $0x10,%esp
+    10f0:	89 c3                	mov    %eax,%ebx
+    10f2:	85 c0                	test   %eax,%eax
+    10f4:	7e 28                	jle    111e <fourfiles+0xde>
+      for(j = 0; j < n; j++){
+    10f6:	31 c0                	xor    %eax,%eax
+    10f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ff:	90                   	nop
+        if(buf[j] != '0'+i){
+    1100:	83 fe 01             	cmp    $0x1,%esi
+    1103:	0f be 88 e0 99 00 00 	movsbl 0x99e0(%eax),%ecx
+    110a:	19 d2                	sbb    %edx,%edx
+    110c:	83 c2 31             	add    $0x31,%edx
+    110f:	39 d1                	cmp    %edx,%ecx
+    1111:	75 5d                	jne    1170 <fourfiles+0x130>
+      for(j = 0; j < n; j++){
+    1113:	83 c0 01             	add    $0x1,%eax
+    1116:	39 c3                	cmp    %eax,%ebx
+    1118:	75 e6                	jne    1100 <fourfiles+0xc0>
+      total += n;
+    111a:	01 df                	add    %ebx,%edi
+    111c:	eb ba                	jmp    10d8 <fourfiles+0x98>
+    close(fd);
+    111e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    1121:	83 ec 0c             	sub    $0xc,%esp
+    1124:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1127:	51                   	push   %ecx
+    1128:	e8 dd 33 00 00       	call   450a <close>
+    if(total != 12*500){
+    112d:	83 c4 10             	add    $0x10,%esp
+    1130:	81 ff 70 17 00 00    	cmp    $0x1770,%edi
+    1136:	0f 85 d0 00 00 00    	jne    120c <fourfiles+0x1cc>
+    unlink(fname);
+    113c:	83 ec 0c             	sub    $0xc,%esp
+    113f:	53                   	push   %ebx
+    1140:	e8 56 34 00 00       	call   459b <unlink>
+  for(i = 0; i < 2; i++){
+    1145:	83 c4 10             	add    $0x10,%esp
+    1148:	85 f6                	test   %esi,%esi
+    114a:	75 0a                	jne    1156 <fourfiles+0x116>
+    114c:	be 01 00 00 00       	mov    $0x1,%esi
+    1151:	e9 61 ff ff ff       	jmp    10b7 <fourfiles+0x77>
+  printf(1, "fourfiles ok\n");
+    1156:	83 ec 08             	sub    $0x8,%esp
+    1159:	68 d3 50 00 00       	push   $0x50d3
+    115e:	6a 01                	push   $0x1
+    1160:	e8 ab 37 00 00       	call   4910 <printf>
+}
+    1165:	83 c4 10             	add    $0x10,%esp
+    1168:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    116b:	5b                   	pop    %ebx
+    116c:	5e                   	pop    %esi
+    116d:	5f                   	pop    %edi
+    116e:	5d                   	pop    %ebp
+    116f:	c3                   	ret
+          printf(1, "wrong char\n");
+    1170:	83 ec 08             	sub    $0x8,%esp
+    1173:	68 b6 50 00 00       	push   $0x50b6
+    1178:	6a 01                	push   $0x1
+    117a:	e8 91 37 00 00       	call   4910 <printf>
+          exit();
+    117f:	e8 f5 32 00 00       	call   4479 <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+    1184:	83 ec 08             	sub    $0x8,%esp
+    1187:	68 02 02 00 00       	push   $0x202
+    118c:	56                   	push   %esi
+    118d:	e8 cf 33 00 00       	call   4561 <open>
+      if(fd < 0){
+    1192:	83 c4 10             	add    $0x10,%esp
+      fd = open(fname, O_CREATE | O_RDWR);
+    1195:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+    1197:	85 c0                	test   %eax,%eax
+    1199:	78 45                	js     11e0 <fourfiles+0x1a0>
+      memset(buf, '0'+pi, 512);
+    119b:	83 ec 04             	sub    $0x4,%esp
+    119e:	83 c3 30             	add    $0x30,%ebx
+    11a1:	68 00 02 00 00       	push   $0x200
+    11a6:	53                   	push   %ebx
+    11a7:	bb 0c 00 00 00       	mov    $0xc,%ebx
+    11ac:	68 e0 99 00 00       	push   $0x99e0
+    11b1:	e8 8a 30 00 00       	call   4240 <memset>
+    11b6:	83 c4 10             	add    $0x10,%esp
+        if((n = write(fd, buf, 500)) != 500){
+    11b9:	83 ec 04             	sub    $0x4,%esp
+    11bc:	68 f4 01 00 00       	push   $0x1f4
+    11c1:	68 e0 99 00 00       	push   $0x99e0
+    11c6:	56                   	push   %esi
+    11c7:	e8 21 33 00 00       	call   44ed <write>
+    11cc:	83 c4 10             	add    $0x10,%esp
+    11cf:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    11d4:	75 49                	jne    121f <fourfiles+0x1df>
+      for(i = 0; i < 12; i++){
+    11d6:	83 eb 01             	sub    $0x1,%ebx
+    11d9:	75 de                	jne    11b9 <fourfiles+0x179>
+      exit();
+    11db:	e8 99 32 00 00       	call   4479 <exit>
+        printf(1, "create failed\n");
+    11e0:	51                   	push   %ecx
+    11e1:	51                   	push   %ecx
+    11e2:	68 7b 5b 00 00       	push   $0x5b7b
+    11e7:	6a 01                	push   $0x1
+    11e9:	e8 22 37 00 00       	call   4910 <printf>
+        exit();
+    11ee:	e8 86 32 00 00       	call   4479 <exit>
+    11f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11f7:	90                   	nop
+      printf(1, "fork failed\n");
+    11f8:	83 ec 08             	sub    $0x8,%esp
+    11fb:	68 77 5d 00 00       	push   $0x5d77
+    1200:	6a 01                	push   $0x1
+    1202:	e8 09 37 00 00       	call   4910 <printf>
+      exit();
+    1207:	e8 6d 32 00 00       	call   4479 <exit>
+      printf(1, "wrong length %d\n", total);
+    120c:	50                   	push   %eax
+    120d:	57                   	push   %edi
+    120e:	68 c2 50 00 00       	push   $0x50c2
+    1213:	6a 01                	push   $0x1
+    1215:	e8 f6 36 00 00       	call   4910 <printf>
+      exit();
+    121a:	e8 5a 32 00 00       	call   4479 <exit>
+          printf(1, "write failed %d\n", n);
+    121f:	52                   	push   %edx
+    1220:	50                   	push   %eax
+    1221:	68 a5 50 00 00       	push   $0x50a5
+    1226:	6a 01                	push   $0x1
+    1228:	e8 e3 36 00 00       	call   4910 <printf>
+          exit();
+    122d:	e8 47 32 00 00       	call   4479 <exit>
+    1232:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1239:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001240 <createdelete>:
+{
+    1240:	55                   	push   %ebp
+    1241:	89 e5                	mov    %esp,%ebp
+    1243:	57                   	push   %edi
+    1244:	56                   	push   %esi
+  for(pi = 0; pi < 4; pi++){
+    1245:	31 f6                	xor    %esi,%esi
+{
+    1247:	53                   	push   %ebx
+    1248:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "createdelete test\n");
+    124b:	68 e1 50 00 00       	push   $0x50e1
+    1250:	6a 01                	push   $0x1
+    1252:	e8 b9 36 00 00       	call   4910 <printf>
+    1257:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    125a:	e8 fd 31 00 00       	call   445c <fork>
+    125f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    1261:	85 c0                	test   %eax,%eax
+    1263:	0f 88 ac 01 00 00    	js     1415 <createdelete+0x1d5>
+    if(pid == 0){
+    1269:	0f 84 01 01 00 00    	je     1370 <createdelete+0x130>
+  for(pi = 0; pi < 4; pi++){
+    126f:	83 c6 01             	add    $0x1,%esi
+    1272:	83 fe 04             	cmp    $0x4,%esi
+    1275:	75 e3                	jne    125a <createdelete+0x1a>
+    wait();
+    1277:	e8 1a 32 00 00       	call   4496 <wait>
+  for(i = 0; i < N; i++){
+    127c:	31 ff                	xor    %edi,%edi
+    127e:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    wait();
+    1281:	e8 10 32 00 00       	call   4496 <wait>
+    1286:	e8 0b 32 00 00       	call   4496 <wait>
+    128b:	e8 06 32 00 00       	call   4496 <wait>
+  name[0] = name[1] = name[2] = 0;
+    1290:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+  for(i = 0; i < N; i++){
+    1294:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if((i == 0 || i >= N/2) && fd < 0){
+    1298:	85 ff                	test   %edi,%edi
+      name[1] = '0' + i;
+    129a:	8d 47 30             	lea    0x30(%edi),%eax
+      if((i == 0 || i >= N/2) && fd < 0){
+    129d:	bb 70 00 00 00       	mov    $0x70,%ebx
+    12a2:	0f 94 c2             	sete   %dl
+    12a5:	83 ff 09             	cmp    $0x9,%edi
+      name[1] = '0' + i;
+    12a8:	88 45 c6             	mov    %al,-0x3a(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    12ab:	0f 9f c0             	setg   %al
+    12ae:	09 c2                	or     %eax,%edx
+    12b0:	88 55 c7             	mov    %dl,-0x39(%ebp)
+      name[1] = '0' + i;
+    12b3:	0f b6 45 c6          	movzbl -0x3a(%ebp),%eax
+      fd = open(name, 0);
+    12b7:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 'p' + pi;
+    12ba:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+    12bd:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    12c0:	6a 00                	push   $0x0
+    12c2:	56                   	push   %esi
+    12c3:	e8 99 32 00 00       	call   4561 <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    12c8:	83 c4 10             	add    $0x10,%esp
+    12cb:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+    12cf:	74 7f                	je     1350 <createdelete+0x110>
+    12d1:	85 c0                	test   %eax,%eax
+    12d3:	0f 88 27 01 00 00    	js     1400 <createdelete+0x1c0>
+        close(fd);
+    12d9:	83 ec 0c             	sub    $0xc,%esp
+    12dc:	50                   	push   %eax
+    12dd:	e8 28 32 00 00       	call   450a <close>
+    12e2:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    12e5:	83 c3 01             	add    $0x1,%ebx
+    12e8:	80 fb 74             	cmp    $0x74,%bl
+    12eb:	75 c6                	jne    12b3 <createdelete+0x73>
+  for(i = 0; i < N; i++){
+    12ed:	83 c7 01             	add    $0x1,%edi
+    12f0:	83 ff 14             	cmp    $0x14,%edi
+    12f3:	75 a3                	jne    1298 <createdelete+0x58>
+    12f5:	bf 70 00 00 00       	mov    $0x70,%edi
+    12fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + i;
+    1300:	8d 47 c0             	lea    -0x40(%edi),%eax
+    1303:	bb 04 00 00 00       	mov    $0x4,%ebx
+    1308:	88 45 c7             	mov    %al,-0x39(%ebp)
+      name[0] = 'p' + i;
+    130b:	89 f8                	mov    %edi,%eax
+      unlink(name);
+    130d:	83 ec 0c             	sub    $0xc,%esp
+      name[0] = 'p' + i;
+    1310:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    1313:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+    1317:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    131a:	56                   	push   %esi
+    131b:	e8 7b 32 00 00       	call   459b <unlink>
+    for(pi = 0; pi < 4; pi++){
+    1320:	83 c4 10             	add    $0x10,%esp
+    1323:	83 eb 01             	sub    $0x1,%ebx
+    1326:	75 e3                	jne    130b <createdelete+0xcb>
+  for(i = 0; i < N; i++){
+    1328:	83 c7 01             	add    $0x1,%edi
+    132b:	89 f8                	mov    %edi,%eax
+    132d:	3c 84                	cmp    $0x84,%al
+    132f:	75 cf                	jne    1300 <createdelete+0xc0>
+  printf(1, "createdelete ok\n");
+    1331:	83 ec 08             	sub    $0x8,%esp
+    1334:	68 f4 50 00 00       	push   $0x50f4
+    1339:	6a 01                	push   $0x1
+    133b:	e8 d0 35 00 00       	call   4910 <printf>
+}
+    1340:	83 c4 10             	add    $0x10,%esp
+    1343:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1346:	5b                   	pop    %ebx
+    1347:	5e                   	pop    %esi
+    1348:	5f                   	pop    %edi
+    1349:	5d                   	pop    %ebp
+    134a:	c3                   	ret
+    134b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    134f:	90                   	nop
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    1350:	85 c0                	test   %eax,%eax
+    1352:	78 91                	js     12e5 <createdelete+0xa5>
+        printf(1, "oops createdelete %s did exist\n", name);
+    1354:	50                   	push   %eax
+    1355:	56                   	push   %esi
+    1356:	68 40 60 00 00       	push   $0x6040
+    135b:	6a 01                	push   $0x1
+    135d:	e8 ae 35 00 00       	call   4910 <printf>
+        exit();
+    1362:	e8 12 31 00 00       	call   4479 <exit>
+    1367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    136e:	66 90                	xchg   %ax,%ax
+      name[0] = 'p' + pi;
+    1370:	8d 46 70             	lea    0x70(%esi),%eax
+      name[2] = '\0';
+    1373:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    1377:	8d 75 c8             	lea    -0x38(%ebp),%esi
+      name[0] = 'p' + pi;
+    137a:	88 45 c8             	mov    %al,-0x38(%ebp)
+      for(i = 0; i < N; i++){
+    137d:	8d 76 00             	lea    0x0(%esi),%esi
+        fd = open(name, O_CREATE | O_RDWR);
+    1380:	83 ec 08             	sub    $0x8,%esp
+        name[1] = '0' + i;
+    1383:	8d 43 30             	lea    0x30(%ebx),%eax
+    1386:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    1389:	68 02 02 00 00       	push   $0x202
+    138e:	56                   	push   %esi
+    138f:	e8 cd 31 00 00       	call   4561 <open>
+        if(fd < 0){
+    1394:	83 c4 10             	add    $0x10,%esp
+    1397:	85 c0                	test   %eax,%eax
+    1399:	0f 88 8a 00 00 00    	js     1429 <createdelete+0x1e9>
+        close(fd);
+    139f:	83 ec 0c             	sub    $0xc,%esp
+    13a2:	50                   	push   %eax
+    13a3:	e8 62 31 00 00       	call   450a <close>
+        if(i > 0 && (i % 2 ) == 0){
+    13a8:	83 c4 10             	add    $0x10,%esp
+    13ab:	85 db                	test   %ebx,%ebx
+    13ad:	74 19                	je     13c8 <createdelete+0x188>
+    13af:	f6 c3 01             	test   $0x1,%bl
+    13b2:	74 1b                	je     13cf <createdelete+0x18f>
+      for(i = 0; i < N; i++){
+    13b4:	83 c3 01             	add    $0x1,%ebx
+    13b7:	83 fb 14             	cmp    $0x14,%ebx
+    13ba:	75 c4                	jne    1380 <createdelete+0x140>
+      exit();
+    13bc:	e8 b8 30 00 00       	call   4479 <exit>
+    13c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      for(i = 0; i < N; i++){
+    13c8:	bb 01 00 00 00       	mov    $0x1,%ebx
+    13cd:	eb b1                	jmp    1380 <createdelete+0x140>
+          name[1] = '0' + (i / 2);
+    13cf:	89 d8                	mov    %ebx,%eax
+          if(unlink(name) < 0){
+    13d1:	83 ec 0c             	sub    $0xc,%esp
+          name[1] = '0' + (i / 2);
+    13d4:	d1 f8                	sar    %eax
+    13d6:	83 c0 30             	add    $0x30,%eax
+    13d9:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    13dc:	56                   	push   %esi
+    13dd:	e8 b9 31 00 00       	call   459b <unlink>
+    13e2:	83 c4 10             	add    $0x10,%esp
+    13e5:	85 c0                	test   %eax,%eax
+    13e7:	79 cb                	jns    13b4 <createdelete+0x174>
+            printf(1, "unlink failed\n");
+    13e9:	52                   	push   %edx
+    13ea:	52                   	push   %edx
+    13eb:	68 ae 5b 00 00       	push   $0x5bae
+    13f0:	6a 01                	push   $0x1
+    13f2:	e8 19 35 00 00       	call   4910 <printf>
+            exit();
+    13f7:	e8 7d 30 00 00       	call   4479 <exit>
+    13fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    1400:	83 ec 04             	sub    $0x4,%esp
+    1403:	56                   	push   %esi
+    1404:	68 1c 60 00 00       	push   $0x601c
+    1409:	6a 01                	push   $0x1
+    140b:	e8 00 35 00 00       	call   4910 <printf>
+        exit();
+    1410:	e8 64 30 00 00       	call   4479 <exit>
+      printf(1, "fork failed\n");
+    1415:	83 ec 08             	sub    $0x8,%esp
+    1418:	68 77 5d 00 00       	push   $0x5d77
+    141d:	6a 01                	push   $0x1
+    141f:	e8 ec 34 00 00       	call   4910 <printf>
+      exit();
+    1424:	e8 50 30 00 00       	call   4479 <exit>
+          printf(1, "create failed\n");
+    1429:	83 ec 08             	sub    $0x8,%esp
+    142c:	68 7b 5b 00 00       	push   $0x5b7b
+    1431:	6a 01                	push   $0x1
+    1433:	e8 d8 34 00 00       	call   4910 <printf>
+          exit();
+    1438:	e8 3c 30 00 00       	call   4479 <exit>
+    143d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001440 <unlinkread>:
+{
+    1440:	55                   	push   %ebp
+    1441:	89 e5                	mov    %esp,%ebp
+    1443:	56                   	push   %esi
+    1444:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+    1445:	83 ec 08             	sub    $0x8,%esp
+    1448:	68 05 51 00 00       	push   $0x5105
+    144d:	6a 01                	push   $0x1
+    144f:	e8 bc 34 00 00       	call   4910 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    1454:	5b                   	pop    %ebx
+    1455:	5e                   	pop    %esi
+    1456:	68 02 02 00 00       	push   $0x202
+    145b:	68 16 51 00 00       	push   $0x5116
+    1460:	e8 fc 30 00 00       	call   4561 <open>
+  if(fd < 0){
+    1465:	83 c4 10             	add    $0x10,%esp
+    1468:	85 c0                	test   %eax,%eax
+    146a:	0f 88 e6 00 00 00    	js     1556 <unlinkread+0x116>
+  write(fd, "hello", 5);
+    1470:	83 ec 04             	sub    $0x4,%esp
+    1473:	89 c3                	mov    %eax,%ebx
+    1475:	6a 05                	push   $0x5
+    1477:	68 3b 51 00 00       	push   $0x513b
+    147c:	50                   	push   %eax
+    147d:	e8 6b 30 00 00       	call   44ed <write>
+  close(fd);
+    1482:	89 1c 24             	mov    %ebx,(%esp)
+    1485:	e8 80 30 00 00       	call   450a <close>
+  fd = open("unlinkread", O_RDWR);
+    148a:	58                   	pop    %eax
+    148b:	5a                   	pop    %edx
+    148c:	6a 02                	push   $0x2
+    148e:	68 16 51 00 00       	push   $0x5116
+    1493:	e8 c9 30 00 00       	call   4561 <open>
+  if(fd < 0){
+    1498:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_RDWR);
+    149b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    149d:	85 c0                	test   %eax,%eax
+    149f:	0f 88 10 01 00 00    	js     15b5 <unlinkread+0x175>
+  if(unlink("unlinkread") != 0){
+    14a5:	83 ec 0c             	sub    $0xc,%esp
+    14a8:	68 16 51 00 00       	push   $0x5116
+    14ad:	e8 e9 30 00 00       	call   459b <unlink>
+    14b2:	83 c4 10             	add    $0x10,%esp
+    14b5:	85 c0                	test   %eax,%eax
+    14b7:	0f 85 e5 00 00 00    	jne    15a2 <unlinkread+0x162>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    14bd:	83 ec 08             	sub    $0x8,%esp
+    14c0:	68 02 02 00 00       	push   $0x202
+    14c5:	68 16 51 00 00       	push   $0x5116
+    14ca:	e8 92 30 00 00       	call   4561 <open>
+  write(fd1, "yyy", 3);
+    14cf:	83 c4 0c             	add    $0xc,%esp
+    14d2:	6a 03                	push   $0x3
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    14d4:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    14d6:	68 73 51 00 00       	push   $0x5173
+    14db:	50                   	push   %eax
+    14dc:	e8 0c 30 00 00       	call   44ed <write>
+  close(fd1);
+    14e1:	89 34 24             	mov    %esi,(%esp)
+    14e4:	e8 21 30 00 00       	call   450a <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    14e9:	83 c4 0c             	add    $0xc,%esp
+    14ec:	68 00 20 00 00       	push   $0x2000
+    14f1:	68 e0 99 00 00       	push   $0x99e0
+    14f6:	53                   	push   %ebx
+    14f7:	e8 d4 2f 00 00       	call   44d0 <read>
+    14fc:	83 c4 10             	add    $0x10,%esp
+    14ff:	83 f8 05             	cmp    $0x5,%eax
+    1502:	0f 85 87 00 00 00    	jne    158f <unlinkread+0x14f>
+  if(buf[0] != 'h'){
+    1508:	80 3d e0 99 00 00 68 	cmpb   $0x68,0x99e0
+    150f:	75 6b                	jne    157c <unlinkread+0x13c>
+  if(write(fd, buf, 10) != 10){
+    1511:	83 ec 04             	sub    $0x4,%esp
+    1514:	6a 0a                	push   $0xa
+    1516:	68 e0 99 00 00       	push   $0x99e0
+    151b:	53                   	push   %ebx
+    151c:	e8 cc 2f 00 00       	call   44ed <write>
+    1521:	83 c4 10             	add    $0x10,%esp
+    1524:	83 f8 0a             	cmp    $0xa,%eax
+    1527:	75 40                	jne    1569 <unlinkread+0x129>
+  close(fd);
+    1529:	83 ec 0c             	sub    $0xc,%esp
+    152c:	53                   	push   %ebx
+    152d:	e8 d8 2f 00 00       	call   450a <close>
+  unlink("unlinkread");
+    1532:	c7 04 24 16 51 00 00 	movl   $0x5116,(%esp)
+    1539:	e8 5d 30 00 00       	call   459b <unlink>
+  printf(1, "unlinkread ok\n");
+    153e:	58                   	pop    %eax
+    153f:	5a                   	pop    %edx
+    1540:	68 be 51 00 00       	push   $0x51be
+    1545:	6a 01                	push   $0x1
+    1547:	e8 c4 33 00 00       	call   4910 <printf>
+}
+    154c:	83 c4 10             	add    $0x10,%esp
+    154f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1552:	5b                   	pop    %ebx
+    1553:	5e                   	pop    %esi
+    1554:	5d                   	pop    %ebp
+    1555:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    1556:	51                   	push   %ecx
+    1557:	51                   	push   %ecx
+    1558:	68 21 51 00 00       	push   $0x5121
+    155d:	6a 01                	push   $0x1
+    155f:	e8 ac 33 00 00       	call   4910 <printf>
+    exit();
+    1564:	e8 10 2f 00 00       	call   4479 <exit>
+    printf(1, "unlinkread write failed\n");
+    1569:	51                   	push   %ecx
+    156a:	51                   	push   %ecx
+    156b:	68 a5 51 00 00       	push   $0x51a5
+    1570:	6a 01                	push   $0x1
+    1572:	e8 99 33 00 00       	call   4910 <printf>
+    exit();
+    1577:	e8 fd 2e 00 00       	call   4479 <exit>
+    printf(1, "unlinkread wrong data\n");
+    157c:	53                   	push   %ebx
+    157d:	53                   	push   %ebx
+    157e:	68 8e 51 00 00       	push   $0x518e
+    1583:	6a 01                	push   $0x1
+    1585:	e8 86 33 00 00       	call   4910 <printf>
+    exit();
+    158a:	e8 ea 2e 00 00       	call   4479 <exit>
+    printf(1, "unlinkread read failed");
+    158f:	56                   	push   %esi
+    1590:	56                   	push   %esi
+    1591:	68 77 51 00 00       	push   $0x5177
+    1596:	6a 01                	push   $0x1
+    1598:	e8 73 33 00 00       	call   4910 <printf>
+    exit();
+    159d:	e8 d7 2e 00 00       	call   4479 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    15a2:	50                   	push   %eax
+    15a3:	50                   	push   %eax
+    15a4:	68 59 51 00 00       	push   $0x5159
+    15a9:	6a 01                	push   $0x1
+    15ab:	e8 60 33 00 00       	call   4910 <printf>
+    exit();
+    15b0:	e8 c4 2e 00 00       	call   4479 <exit>
+    printf(1, "open unlinkread failed\n");
+    15b5:	50                   	push   %eax
+    15b6:	50                   	push   %eax
+    15b7:	68 41 51 00 00       	push   $0x5141
+    15bc:	6a 01                	push   $0x1
+    15be:	e8 4d 33 00 00       	call   4910 <printf>
+    exit();
+    15c3:	e8 b1 2e 00 00       	call   4479 <exit>
+    15c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15cf:	90                   	nop
+
+000015d0 <linktest>:
+{
+    15d0:	55                   	push   %ebp
+    15d1:	89 e5                	mov    %esp,%ebp
+    15d3:	53                   	push   %ebx
+    15d4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    15d7:	68 cd 51 00 00       	push   $0x51cd
+    15dc:	6a 01                	push   $0x1
+    15de:	e8 2d 33 00 00       	call   4910 <printf>
+  unlink("lf1");
+    15e3:	c7 04 24 d7 51 00 00 	movl   $0x51d7,(%esp)
+    15ea:	e8 ac 2f 00 00       	call   459b <unlink>
+  unlink("lf2");
+    15ef:	c7 04 24 db 51 00 00 	movl   $0x51db,(%esp)
+    15f6:	e8 a0 2f 00 00       	call   459b <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    15fb:	58                   	pop    %eax
+    15fc:	5a                   	pop    %edx
+    15fd:	68 02 02 00 00       	push   $0x202
+    1602:	68 d7 51 00 00       	push   $0x51d7
+    1607:	e8 55 2f 00 00       	call   4561 <open>
+  if(fd < 0){
+    160c:	83 c4 10             	add    $0x10,%esp
+    160f:	85 c0                	test   %eax,%eax
+    1611:	0f 88 1e 01 00 00    	js     1735 <linktest+0x165>
+  if(write(fd, "hello", 5) != 5){
+    1617:	83 ec 04             	sub    $0x4,%esp
+    161a:	89 c3                	mov    %eax,%ebx
+    161c:	6a 05                	push   $0x5
+    161e:	68 3b 51 00 00       	push   $0x513b
+    1623:	50                   	push   %eax
+    1624:	e8 c4 2e 00 00       	call   44ed <write>
+    1629:	83 c4 10             	add    $0x10,%esp
+    162c:	83 f8 05             	cmp    $0x5,%eax
+    162f:	0f 85 98 01 00 00    	jne    17cd <linktest+0x1fd>
+  close(fd);
+    1635:	83 ec 0c             	sub    $0xc,%esp
+    1638:	53                   	push   %ebx
+    1639:	e8 cc 2e 00 00       	call   450a <close>
+  if(link("lf1", "lf2") < 0){
+    163e:	5b                   	pop    %ebx
+    163f:	58                   	pop    %eax
+    1640:	68 db 51 00 00       	push   $0x51db
+    1645:	68 d7 51 00 00       	push   $0x51d7
+    164a:	e8 86 2f 00 00       	call   45d5 <link>
+    164f:	83 c4 10             	add    $0x10,%esp
+    1652:	85 c0                	test   %eax,%eax
+    1654:	0f 88 60 01 00 00    	js     17ba <linktest+0x1ea>
+  unlink("lf1");
+    165a:	83 ec 0c             	sub    $0xc,%esp
+    165d:	68 d7 51 00 00       	push   $0x51d7
+    1662:	e8 34 2f 00 00       	call   459b <unlink>
+  if(open("lf1", 0) >= 0){
+    1667:	58                   	pop    %eax
+    1668:	5a                   	pop    %edx
+    1669:	6a 00                	push   $0x0
+    166b:	68 d7 51 00 00       	push   $0x51d7
+    1670:	e8 ec 2e 00 00       	call   4561 <open>
+    1675:	83 c4 10             	add    $0x10,%esp
+    1678:	85 c0                	test   %eax,%eax
+    167a:	0f 89 27 01 00 00    	jns    17a7 <linktest+0x1d7>
+  fd = open("lf2", 0);
+    1680:	83 ec 08             	sub    $0x8,%esp
+    1683:	6a 00                	push   $0x0
+    1685:	68 db 51 00 00       	push   $0x51db
+    168a:	e8 d2 2e 00 00       	call   4561 <open>
+  if(fd < 0){
+    168f:	83 c4 10             	add    $0x10,%esp
+  fd = open("lf2", 0);
+    1692:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1694:	85 c0                	test   %eax,%eax
+    1696:	0f 88 f8 00 00 00    	js     1794 <linktest+0x1c4>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    169c:	83 ec 04             	sub    $0x4,%esp
+    169f:	68 00 20 00 00       	push   $0x2000
+    16a4:	68 e0 99 00 00       	push   $0x99e0
+    16a9:	50                   	push   %eax
+    16aa:	e8 21 2e 00 00       	call   44d0 <read>
+    16af:	83 c4 10             	add    $0x10,%esp
+    16b2:	83 f8 05             	cmp    $0x5,%eax
+    16b5:	0f 85 c6 00 00 00    	jne    1781 <linktest+0x1b1>
+  close(fd);
+    16bb:	83 ec 0c             	sub    $0xc,%esp
+    16be:	53                   	push   %ebx
+    16bf:	e8 46 2e 00 00       	call   450a <close>
+  if(link("lf2", "lf2") >= 0){
+    16c4:	58                   	pop    %eax
+    16c5:	5a                   	pop    %edx
+    16c6:	68 db 51 00 00       	push   $0x51db
+    16cb:	68 db 51 00 00       	push   $0x51db
+    16d0:	e8 00 2f 00 00       	call   45d5 <link>
+    16d5:	83 c4 10             	add    $0x10,%esp
+    16d8:	85 c0                	test   %eax,%eax
+    16da:	0f 89 8e 00 00 00    	jns    176e <linktest+0x19e>
+  unlink("lf2");
+    16e0:	83 ec 0c             	sub    $0xc,%esp
+    16e3:	68 db 51 00 00       	push   $0x51db
+    16e8:	e8 ae 2e 00 00       	call   459b <unlink>
+  if(link("lf2", "lf1") >= 0){
+    16ed:	59                   	pop    %ecx
+    16ee:	5b                   	pop    %ebx
+    16ef:	68 d7 51 00 00       	push   $0x51d7
+    16f4:	68 db 51 00 00       	push   $0x51db
+    16f9:	e8 d7 2e 00 00       	call   45d5 <link>
+    16fe:	83 c4 10             	add    $0x10,%esp
+    1701:	85 c0                	test   %eax,%eax
+    1703:	79 56                	jns    175b <linktest+0x18b>
+  if(link(".", "lf1") >= 0){
+    1705:	83 ec 08             	sub    $0x8,%esp
+    1708:	68 d7 51 00 00       	push   $0x51d7
+    170d:	68 9f 54 00 00       	push   $0x549f
+    1712:	e8 be 2e 00 00       	call   45d5 <link>
+    1717:	83 c4 10             	add    $0x10,%esp
+    171a:	85 c0                	test   %eax,%eax
+    171c:	79 2a                	jns    1748 <linktest+0x178>
+  printf(1, "linktest ok\n");
+    171e:	83 ec 08             	sub    $0x8,%esp
+    1721:	68 75 52 00 00       	push   $0x5275
+    1726:	6a 01                	push   $0x1
+    1728:	e8 e3 31 00 00       	call   4910 <printf>
+}
+    172d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1730:	83 c4 10             	add    $0x10,%esp
+    1733:	c9                   	leave
+    1734:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    1735:	50                   	push   %eax
+    1736:	50                   	push   %eax
+    1737:	68 df 51 00 00       	push   $0x51df
+    173c:	6a 01                	push   $0x1
+    173e:	e8 cd 31 00 00       	call   4910 <printf>
+    exit();
+    1743:	e8 31 2d 00 00       	call   4479 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    1748:	50                   	push   %eax
+    1749:	50                   	push   %eax
+    174a:	68 59 52 00 00       	push   $0x5259
+    174f:	6a 01                	push   $0x1
+    1751:	e8 ba 31 00 00       	call   4910 <printf>
+    exit();
+    1756:	e8 1e 2d 00 00       	call   4479 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    175b:	52                   	push   %edx
+    175c:	52                   	push   %edx
+    175d:	68 88 60 00 00       	push   $0x6088
+    1762:	6a 01                	push   $0x1
+    1764:	e8 a7 31 00 00       	call   4910 <printf>
+    exit();
+    1769:	e8 0b 2d 00 00       	call   4479 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    176e:	50                   	push   %eax
+    176f:	50                   	push   %eax
+    1770:	68 3b 52 00 00       	push   $0x523b
+    1775:	6a 01                	push   $0x1
+    1777:	e8 94 31 00 00       	call   4910 <printf>
+    exit();
+    177c:	e8 f8 2c 00 00       	call   4479 <exit>
+    printf(1, "read lf2 failed\n");
+    1781:	51                   	push   %ecx
+    1782:	51                   	push   %ecx
+    1783:	68 2a 52 00 00       	push   $0x522a
+    1788:	6a 01                	push   $0x1
+    178a:	e8 81 31 00 00       	call   4910 <printf>
+    exit();
+    178f:	e8 e5 2c 00 00       	call   4479 <exit>
+    printf(1, "open lf2 failed\n");
+    1794:	53                   	push   %ebx
+    1795:	53                   	push   %ebx
+    1796:	68 19 52 00 00       	push   $0x5219
+    179b:	6a 01                	push   $0x1
+    179d:	e8 6e 31 00 00       	call   4910 <printf>
+    exit();
+    17a2:	e8 d2 2c 00 00       	call   4479 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    17a7:	50                   	push   %eax
+    17a8:	50                   	push   %eax
+    17a9:	68 60 60 00 00       	push   $0x6060
+    17ae:	6a 01                	push   $0x1
+    17b0:	e8 5b 31 00 00       	call   4910 <printf>
+    exit();
+    17b5:	e8 bf 2c 00 00       	call   4479 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    17ba:	51                   	push   %ecx
+    17bb:	51                   	push   %ecx
+    17bc:	68 04 52 00 00       	push   $0x5204
+    17c1:	6a 01                	push   $0x1
+    17c3:	e8 48 31 00 00       	call   4910 <printf>
+    exit();
+    17c8:	e8 ac 2c 00 00       	call   4479 <exit>
+    printf(1, "write lf1 failed\n");
+    17cd:	50                   	push   %eax
+    17ce:	50                   	push   %eax
+    17cf:	68 f2 51 00 00       	push   $0x51f2
+    17d4:	6a 01                	push   $0x1
+    17d6:	e8 35 31 00 00       	call   4910 <printf>
+    exit();
+    17db:	e8 99 2c 00 00       	call   4479 <exit>
+
+000017e0 <concreate>:
+{
+    17e0:	55                   	push   %ebp
+    17e1:	89 e5                	mov    %esp,%ebp
+    17e3:	57                   	push   %edi
+    17e4:	56                   	push   %esi
+  for(i = 0; i < 40; i++){
+    17e5:	31 f6                	xor    %esi,%esi
+{
+    17e7:	53                   	push   %ebx
+    17e8:	8d 5d ad             	lea    -0x53(%ebp),%ebx
+    17eb:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "concreate test\n");
+    17ee:	68 82 52 00 00       	push   $0x5282
+    17f3:	6a 01                	push   $0x1
+    17f5:	e8 16 31 00 00       	call   4910 <printf>
+  file[0] = 'C';
+    17fa:	c6 45 ad 43          	movb   $0x43,-0x53(%ebp)
+  file[2] = '\0';
+    17fe:	83 c4 10             	add    $0x10,%esp
+    1801:	c6 45 af 00          	movb   $0x0,-0x51(%ebp)
+  for(i = 0; i < 40; i++){
+    1805:	eb 4c                	jmp    1853 <concreate+0x73>
+    1807:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    180e:	66 90                	xchg   %ax,%ax
+    1810:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+    if(pid && (i % 3) == 1){
+    1816:	3d ab aa aa aa       	cmp    $0xaaaaaaab,%eax
+    181b:	0f 83 8f 00 00 00    	jae    18b0 <concreate+0xd0>
+      fd = open(file, O_CREATE | O_RDWR);
+    1821:	83 ec 08             	sub    $0x8,%esp
+    1824:	68 02 02 00 00       	push   $0x202
+    1829:	53                   	push   %ebx
+    182a:	e8 32 2d 00 00       	call   4561 <open>
+      if(fd < 0){
+    182f:	83 c4 10             	add    $0x10,%esp
+    1832:	85 c0                	test   %eax,%eax
+    1834:	78 63                	js     1899 <concreate+0xb9>
+      close(fd);
+    1836:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+    1839:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+    183c:	50                   	push   %eax
+    183d:	e8 c8 2c 00 00       	call   450a <close>
+    1842:	83 c4 10             	add    $0x10,%esp
+      wait();
+    1845:	e8 4c 2c 00 00       	call   4496 <wait>
+  for(i = 0; i < 40; i++){
+    184a:	83 fe 28             	cmp    $0x28,%esi
+    184d:	0f 84 7f 00 00 00    	je     18d2 <concreate+0xf2>
+    unlink(file);
+    1853:	83 ec 0c             	sub    $0xc,%esp
+    file[1] = '0' + i;
+    1856:	8d 46 30             	lea    0x30(%esi),%eax
+    1859:	88 45 ae             	mov    %al,-0x52(%ebp)
+    unlink(file);
+    185c:	53                   	push   %ebx
+    185d:	e8 39 2d 00 00       	call   459b <unlink>
+    pid = fork();
+    1862:	e8 f5 2b 00 00       	call   445c <fork>
+    if(pid && (i % 3) == 1){
+    1867:	83 c4 10             	add    $0x10,%esp
+    186a:	85 c0                	test   %eax,%eax
+    186c:	75 a2                	jne    1810 <concreate+0x30>
+      link("C0", file);
+    186e:	69 f6 cd cc cc cc    	imul   $0xcccccccd,%esi,%esi
+    } else if(pid == 0 && (i % 5) == 1){
+    1874:	81 fe cd cc cc cc    	cmp    $0xcccccccd,%esi
+    187a:	0f 83 d0 00 00 00    	jae    1950 <concreate+0x170>
+      fd = open(file, O_CREATE | O_RDWR);
+    1880:	83 ec 08             	sub    $0x8,%esp
+    1883:	68 02 02 00 00       	push   $0x202
+    1888:	53                   	push   %ebx
+    1889:	e8 d3 2c 00 00       	call   4561 <open>
+      if(fd < 0){
+    188e:	83 c4 10             	add    $0x10,%esp
+    1891:	85 c0                	test   %eax,%eax
+    1893:	0f 89 ea 01 00 00    	jns    1a83 <concreate+0x2a3>
+        printf(1, "concreate create %s failed\n", file);
+    1899:	83 ec 04             	sub    $0x4,%esp
+    189c:	53                   	push   %ebx
+    189d:	68 95 52 00 00       	push   $0x5295
+    18a2:	6a 01                	push   $0x1
+    18a4:	e8 67 30 00 00       	call   4910 <printf>
+        exit();
+    18a9:	e8 cb 2b 00 00       	call   4479 <exit>
+    18ae:	66 90                	xchg   %ax,%ax
+      link("C0", file);
+    18b0:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < 40; i++){
+    18b3:	83 c6 01             	add    $0x1,%esi
+      link("C0", file);
+    18b6:	53                   	push   %ebx
+    18b7:	68 92 52 00 00       	push   $0x5292
+    18bc:	e8 14 2d 00 00       	call   45d5 <link>
+    18c1:	83 c4 10             	add    $0x10,%esp
+      wait();
+    18c4:	e8 cd 2b 00 00       	call   4496 <wait>
+  for(i = 0; i < 40; i++){
+    18c9:	83 fe 28             	cmp    $0x28,%esi
+    18cc:	0f 85 81 ff ff ff    	jne    1853 <concreate+0x73>
+  memset(fa, 0, sizeof(fa));
+    18d2:	83 ec 04             	sub    $0x4,%esp
+    18d5:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    18d8:	6a 28                	push   $0x28
+    18da:	6a 00                	push   $0x0
+    18dc:	50                   	push   %eax
+    18dd:	e8 5e 29 00 00       	call   4240 <memset>
+  fd = open(".", 0);
+    18e2:	5e                   	pop    %esi
+    18e3:	5f                   	pop    %edi
+    18e4:	6a 00                	push   $0x0
+    18e6:	68 9f 54 00 00       	push   $0x549f
+    18eb:	8d 7d b0             	lea    -0x50(%ebp),%edi
+    18ee:	e8 6e 2c 00 00       	call   4561 <open>
+  n = 0;
+    18f3:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    18fa:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    18fd:	89 c6                	mov    %eax,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    18ff:	90                   	nop
+    1900:	83 ec 04             	sub    $0x4,%esp
+    1903:	6a 10                	push   $0x10
+    1905:	57                   	push   %edi
+    1906:	56                   	push   %esi
+    1907:	e8 c4 2b 00 00       	call   44d0 <read>
+    190c:	83 c4 10             	add    $0x10,%esp
+    190f:	85 c0                	test   %eax,%eax
+    1911:	7e 5d                	jle    1970 <concreate+0x190>
+    if(de.inum == 0)
+    1913:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+    1918:	74 e6                	je     1900 <concreate+0x120>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    191a:	80 7d b2 43          	cmpb   $0x43,-0x4e(%ebp)
+    191e:	75 e0                	jne    1900 <concreate+0x120>
+    1920:	80 7d b4 00          	cmpb   $0x0,-0x4c(%ebp)
+    1924:	75 da                	jne    1900 <concreate+0x120>
+      i = de.name[1] - '0';
+    1926:	0f be 45 b3          	movsbl -0x4d(%ebp),%eax
+    192a:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    192d:	83 f8 27             	cmp    $0x27,%eax
+    1930:	0f 87 5e 01 00 00    	ja     1a94 <concreate+0x2b4>
+      if(fa[i]){
+    1936:	80 7c 05 c0 00       	cmpb   $0x0,-0x40(%ebp,%eax,1)
+    193b:	0f 85 7e 01 00 00    	jne    1abf <concreate+0x2df>
+      n++;
+    1941:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      fa[i] = 1;
+    1945:	c6 44 05 c0 01       	movb   $0x1,-0x40(%ebp,%eax,1)
+      n++;
+    194a:	eb b4                	jmp    1900 <concreate+0x120>
+    194c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      link("C0", file);
+    1950:	83 ec 08             	sub    $0x8,%esp
+    1953:	53                   	push   %ebx
+    1954:	68 92 52 00 00       	push   $0x5292
+    1959:	e8 77 2c 00 00       	call   45d5 <link>
+    195e:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1961:	e8 13 2b 00 00       	call   4479 <exit>
+    1966:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    196d:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fd);
+    1970:	83 ec 0c             	sub    $0xc,%esp
+    1973:	56                   	push   %esi
+    1974:	e8 91 2b 00 00       	call   450a <close>
+  if(n != 40){
+    1979:	83 c4 10             	add    $0x10,%esp
+    197c:	83 7d a4 28          	cmpl   $0x28,-0x5c(%ebp)
+    1980:	0f 85 26 01 00 00    	jne    1aac <concreate+0x2cc>
+  for(i = 0; i < 40; i++){
+    1986:	31 f6                	xor    %esi,%esi
+    1988:	eb 48                	jmp    19d2 <concreate+0x1f2>
+    198a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+       ((i % 3) == 1 && pid != 0)){
+    1990:	85 ff                	test   %edi,%edi
+    1992:	74 05                	je     1999 <concreate+0x1b9>
+    1994:	83 f8 01             	cmp    $0x1,%eax
+    1997:	74 68                	je     1a01 <concreate+0x221>
+      unlink(file);
+    1999:	83 ec 0c             	sub    $0xc,%esp
+    199c:	53                   	push   %ebx
+    199d:	e8 f9 2b 00 00       	call   459b <unlink>
+      unlink(file);
+    19a2:	89 1c 24             	mov    %ebx,(%esp)
+    19a5:	e8 f1 2b 00 00       	call   459b <unlink>
+      unlink(file);
+    19aa:	89 1c 24             	mov    %ebx,(%esp)
+    19ad:	e8 e9 2b 00 00       	call   459b <unlink>
+      unlink(file);
+    19b2:	89 1c 24             	mov    %ebx,(%esp)
+    19b5:	e8 e1 2b 00 00       	call   459b <unlink>
+    19ba:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    19bd:	85 ff                	test   %edi,%edi
+    19bf:	74 a0                	je     1961 <concreate+0x181>
+      wait();
+    19c1:	e8 d0 2a 00 00       	call   4496 <wait>
+  for(i = 0; i < 40; i++){
+    19c6:	83 c6 01             	add    $0x1,%esi
+    19c9:	83 fe 28             	cmp    $0x28,%esi
+    19cc:	0f 84 86 00 00 00    	je     1a58 <concreate+0x278>
+    file[1] = '0' + i;
+    19d2:	8d 46 30             	lea    0x30(%esi),%eax
+    19d5:	88 45 ae             	mov    %al,-0x52(%ebp)
+    pid = fork();
+    19d8:	e8 7f 2a 00 00       	call   445c <fork>
+    19dd:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    19df:	85 c0                	test   %eax,%eax
+    19e1:	0f 88 88 00 00 00    	js     1a6f <concreate+0x28f>
+    if(((i % 3) == 0 && pid == 0) ||
+    19e7:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    19ec:	f7 e6                	mul    %esi
+    19ee:	89 d0                	mov    %edx,%eax
+    19f0:	83 e2 fe             	and    $0xfffffffe,%edx
+    19f3:	d1 e8                	shr    %eax
+    19f5:	01 c2                	add    %eax,%edx
+    19f7:	89 f0                	mov    %esi,%eax
+    19f9:	29 d0                	sub    %edx,%eax
+    19fb:	89 c1                	mov    %eax,%ecx
+    19fd:	09 f9                	or     %edi,%ecx
+    19ff:	75 8f                	jne    1990 <concreate+0x1b0>
+      close(open(file, 0));
+    1a01:	83 ec 08             	sub    $0x8,%esp
+    1a04:	6a 00                	push   $0x0
+    1a06:	53                   	push   %ebx
+    1a07:	e8 55 2b 00 00       	call   4561 <open>
+    1a0c:	89 04 24             	mov    %eax,(%esp)
+    1a0f:	e8 f6 2a 00 00       	call   450a <close>
+      close(open(file, 0));
+    1a14:	58                   	pop    %eax
+    1a15:	5a                   	pop    %edx
+    1a16:	6a 00                	push   $0x0
+    1a18:	53                   	push   %ebx
+    1a19:	e8 43 2b 00 00       	call   4561 <open>
+    1a1e:	89 04 24             	mov    %eax,(%esp)
+    1a21:	e8 e4 2a 00 00       	call   450a <close>
+      close(open(file, 0));
+    1a26:	59                   	pop    %ecx
+    1a27:	58                   	pop    %eax
+    1a28:	6a 00                	push   $0x0
+    1a2a:	53                   	push   %ebx
+    1a2b:	e8 31 2b 00 00       	call   4561 <open>
+    1a30:	89 04 24             	mov    %eax,(%esp)
+    1a33:	e8 d2 2a 00 00       	call   450a <close>
+      close(open(file, 0));
+    1a38:	58                   	pop    %eax
+    1a39:	5a                   	pop    %edx
+    1a3a:	6a 00                	push   $0x0
+    1a3c:	53                   	push   %ebx
+    1a3d:	e8 1f 2b 00 00       	call   4561 <open>
+    1a42:	89 04 24             	mov    %eax,(%esp)
+    1a45:	e8 c0 2a 00 00       	call   450a <close>
+    1a4a:	83 c4 10             	add    $0x10,%esp
+    1a4d:	e9 6b ff ff ff       	jmp    19bd <concreate+0x1dd>
+    1a52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  printf(1, "concreate ok\n");
+    1a58:	83 ec 08             	sub    $0x8,%esp
+    1a5b:	68 e7 52 00 00       	push   $0x52e7
+    1a60:	6a 01                	push   $0x1
+    1a62:	e8 a9 2e 00 00       	call   4910 <printf>
+}
+    1a67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a6a:	5b                   	pop    %ebx
+    1a6b:	5e                   	pop    %esi
+    1a6c:	5f                   	pop    %edi
+    1a6d:	5d                   	pop    %ebp
+    1a6e:	c3                   	ret
+      printf(1, "fork failed\n");
+    1a6f:	83 ec 08             	sub    $0x8,%esp
+    1a72:	68 77 5d 00 00       	push   $0x5d77
+    1a77:	6a 01                	push   $0x1
+    1a79:	e8 92 2e 00 00       	call   4910 <printf>
+      exit();
+    1a7e:	e8 f6 29 00 00       	call   4479 <exit>
+      close(fd);
+    1a83:	83 ec 0c             	sub    $0xc,%esp
+    1a86:	50                   	push   %eax
+    1a87:	e8 7e 2a 00 00       	call   450a <close>
+    1a8c:	83 c4 10             	add    $0x10,%esp
+    1a8f:	e9 cd fe ff ff       	jmp    1961 <concreate+0x181>
+        printf(1, "concreate weird file %s\n", de.name);
+    1a94:	83 ec 04             	sub    $0x4,%esp
+    1a97:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1a9a:	50                   	push   %eax
+    1a9b:	68 b1 52 00 00       	push   $0x52b1
+    1aa0:	6a 01                	push   $0x1
+    1aa2:	e8 69 2e 00 00       	call   4910 <printf>
+        exit();
+    1aa7:	e8 cd 29 00 00       	call   4479 <exit>
+    printf(1, "concreate not enough files in directory listing\n");
+    1aac:	51                   	push   %ecx
+    1aad:	51                   	push   %ecx
+    1aae:	68 ac 60 00 00       	push   $0x60ac
+    1ab3:	6a 01                	push   $0x1
+    1ab5:	e8 56 2e 00 00       	call   4910 <printf>
+    exit();
+    1aba:	e8 ba 29 00 00       	call   4479 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    1abf:	83 ec 04             	sub    $0x4,%esp
+    1ac2:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1ac5:	50                   	push   %eax
+    1ac6:	68 ca 52 00 00       	push   $0x52ca
+    1acb:	6a 01                	push   $0x1
+    1acd:	e8 3e 2e 00 00       	call   4910 <printf>
+        exit();
+    1ad2:	e8 a2 29 00 00       	call   4479 <exit>
+    1ad7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ade:	66 90                	xchg   %ax,%ax
+
+00001ae0 <linkunlink>:
+{
+    1ae0:	55                   	push   %ebp
+    1ae1:	89 e5                	mov    %esp,%ebp
+    1ae3:	57                   	push   %edi
+    1ae4:	56                   	push   %esi
+    1ae5:	53                   	push   %ebx
+    1ae6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "linkunlink test\n");
+    1ae9:	68 f5 52 00 00       	push   $0x52f5
+    1aee:	6a 01                	push   $0x1
+    1af0:	e8 1b 2e 00 00       	call   4910 <printf>
+  unlink("x");
+    1af5:	c7 04 24 82 55 00 00 	movl   $0x5582,(%esp)
+    1afc:	e8 9a 2a 00 00       	call   459b <unlink>
+  pid = fork();
+    1b01:	e8 56 29 00 00       	call   445c <fork>
+  if(pid < 0){
+    1b06:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    1b09:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    1b0c:	85 c0                	test   %eax,%eax
+    1b0e:	0f 88 b6 00 00 00    	js     1bca <linkunlink+0xea>
+  unsigned int x = (pid ? 1 : 97);
+    1b14:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    1b18:	bb 64 00 00 00       	mov    $0x64,%ebx
+    if((x % 3) == 0){
+    1b1d:	be ab aa aa aa       	mov    $0xaaaaaaab,%esi
+  unsigned int x = (pid ? 1 : 97);
+    1b22:	19 ff                	sbb    %edi,%edi
+    1b24:	83 e7 60             	and    $0x60,%edi
+    1b27:	83 c7 01             	add    $0x1,%edi
+    1b2a:	eb 1e                	jmp    1b4a <linkunlink+0x6a>
+    1b2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((x % 3) == 1){
+    1b30:	83 f8 01             	cmp    $0x1,%eax
+    1b33:	74 7b                	je     1bb0 <linkunlink+0xd0>
+      unlink("x");
+    1b35:	83 ec 0c             	sub    $0xc,%esp
+    1b38:	68 82 55 00 00       	push   $0x5582
+    1b3d:	e8 59 2a 00 00       	call   459b <unlink>
+    1b42:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1b45:	83 eb 01             	sub    $0x1,%ebx
+    1b48:	74 41                	je     1b8b <linkunlink+0xab>
+    x = x * 1103515245 + 12345;
+    1b4a:	69 cf 6d 4e c6 41    	imul   $0x41c64e6d,%edi,%ecx
+    1b50:	8d b9 39 30 00 00    	lea    0x3039(%ecx),%edi
+    if((x % 3) == 0){
+    1b56:	89 f8                	mov    %edi,%eax
+    1b58:	f7 e6                	mul    %esi
+    1b5a:	89 d0                	mov    %edx,%eax
+    1b5c:	83 e2 fe             	and    $0xfffffffe,%edx
+    1b5f:	d1 e8                	shr    %eax
+    1b61:	01 c2                	add    %eax,%edx
+    1b63:	89 f8                	mov    %edi,%eax
+    1b65:	29 d0                	sub    %edx,%eax
+    1b67:	75 c7                	jne    1b30 <linkunlink+0x50>
+      close(open("x", O_RDWR | O_CREATE));
+    1b69:	83 ec 08             	sub    $0x8,%esp
+    1b6c:	68 02 02 00 00       	push   $0x202
+    1b71:	68 82 55 00 00       	push   $0x5582
+    1b76:	e8 e6 29 00 00       	call   4561 <open>
+    1b7b:	89 04 24             	mov    %eax,(%esp)
+    1b7e:	e8 87 29 00 00       	call   450a <close>
+    1b83:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1b86:	83 eb 01             	sub    $0x1,%ebx
+    1b89:	75 bf                	jne    1b4a <linkunlink+0x6a>
+  if(pid)
+    1b8b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1b8e:	85 c0                	test   %eax,%eax
+    1b90:	74 4b                	je     1bdd <linkunlink+0xfd>
+    wait();
+    1b92:	e8 ff 28 00 00       	call   4496 <wait>
+  printf(1, "linkunlink ok\n");
+    1b97:	83 ec 08             	sub    $0x8,%esp
+    1b9a:	68 0a 53 00 00       	push   $0x530a
+    1b9f:	6a 01                	push   $0x1
+    1ba1:	e8 6a 2d 00 00       	call   4910 <printf>
+}
+    1ba6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1ba9:	5b                   	pop    %ebx
+    1baa:	5e                   	pop    %esi
+    1bab:	5f                   	pop    %edi
+    1bac:	5d                   	pop    %ebp
+    1bad:	c3                   	ret
+    1bae:	66 90                	xchg   %ax,%ax
+      link("cat", "x");
+    1bb0:	83 ec 08             	sub    $0x8,%esp
+    1bb3:	68 82 55 00 00       	push   $0x5582
+    1bb8:	68 06 53 00 00       	push   $0x5306
+    1bbd:	e8 13 2a 00 00       	call   45d5 <link>
+    1bc2:	83 c4 10             	add    $0x10,%esp
+    1bc5:	e9 7b ff ff ff       	jmp    1b45 <linkunlink+0x65>
+    printf(1, "fork failed\n");
+    1bca:	52                   	push   %edx
+    1bcb:	52                   	push   %edx
+    1bcc:	68 77 5d 00 00       	push   $0x5d77
+    1bd1:	6a 01                	push   $0x1
+    1bd3:	e8 38 2d 00 00       	call   4910 <printf>
+    exit();
+    1bd8:	e8 9c 28 00 00       	call   4479 <exit>
+    exit();
+    1bdd:	e8 97 28 00 00       	call   4479 <exit>
+    1be2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1be9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001bf0 <bigdir>:
+{
+    1bf0:	55                   	push   %ebp
+    1bf1:	89 e5                	mov    %esp,%ebp
+    1bf3:	57                   	push   %edi
+    1bf4:	56                   	push   %esi
+    1bf5:	53                   	push   %ebx
+    1bf6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "bigdir test\n");
+    1bf9:	68 19 53 00 00       	push   $0x5319
+    1bfe:	6a 01                	push   $0x1
+    1c00:	e8 0b 2d 00 00       	call   4910 <printf>
+  unlink("bd");
+    1c05:	c7 04 24 26 53 00 00 	movl   $0x5326,(%esp)
+    1c0c:	e8 8a 29 00 00       	call   459b <unlink>
+  fd = open("bd", O_CREATE);
+    1c11:	5a                   	pop    %edx
+    1c12:	59                   	pop    %ecx
+    1c13:	68 00 02 00 00       	push   $0x200
+    1c18:	68 26 53 00 00       	push   $0x5326
+    1c1d:	e8 3f 29 00 00       	call   4561 <open>
+  if(fd < 0){
+    1c22:	83 c4 10             	add    $0x10,%esp
+    1c25:	85 c0                	test   %eax,%eax
+    1c27:	0f 88 de 00 00 00    	js     1d0b <bigdir+0x11b>
+  close(fd);
+    1c2d:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 500; i++){
+    1c30:	31 f6                	xor    %esi,%esi
+    1c32:	8d 7d de             	lea    -0x22(%ebp),%edi
+  close(fd);
+    1c35:	50                   	push   %eax
+    1c36:	e8 cf 28 00 00       	call   450a <close>
+    1c3b:	83 c4 10             	add    $0x10,%esp
+    1c3e:	66 90                	xchg   %ax,%ax
+    name[1] = '0' + (i / 64);
+    1c40:	89 f0                	mov    %esi,%eax
+    if(link("bd", name) != 0){
+    1c42:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+    1c45:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1c49:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1c4c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1c50:	83 c0 30             	add    $0x30,%eax
+    1c53:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1c56:	89 f0                	mov    %esi,%eax
+    1c58:	83 e0 3f             	and    $0x3f,%eax
+    1c5b:	83 c0 30             	add    $0x30,%eax
+    1c5e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(link("bd", name) != 0){
+    1c61:	57                   	push   %edi
+    1c62:	68 26 53 00 00       	push   $0x5326
+    1c67:	e8 69 29 00 00       	call   45d5 <link>
+    1c6c:	83 c4 10             	add    $0x10,%esp
+    1c6f:	89 c3                	mov    %eax,%ebx
+    1c71:	85 c0                	test   %eax,%eax
+    1c73:	75 6e                	jne    1ce3 <bigdir+0xf3>
+  for(i = 0; i < 500; i++){
+    1c75:	83 c6 01             	add    $0x1,%esi
+    1c78:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    1c7e:	75 c0                	jne    1c40 <bigdir+0x50>
+  unlink("bd");
+    1c80:	83 ec 0c             	sub    $0xc,%esp
+    1c83:	68 26 53 00 00       	push   $0x5326
+    1c88:	e8 0e 29 00 00       	call   459b <unlink>
+    1c8d:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + (i / 64);
+    1c90:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    1c92:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'x';
+    1c95:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1c99:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1c9c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1ca0:	83 c0 30             	add    $0x30,%eax
+    1ca3:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1ca6:	89 d8                	mov    %ebx,%eax
+    1ca8:	83 e0 3f             	and    $0x3f,%eax
+    1cab:	83 c0 30             	add    $0x30,%eax
+    1cae:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(unlink(name) != 0){
+    1cb1:	57                   	push   %edi
+    1cb2:	e8 e4 28 00 00       	call   459b <unlink>
+    1cb7:	83 c4 10             	add    $0x10,%esp
+    1cba:	85 c0                	test   %eax,%eax
+    1cbc:	75 39                	jne    1cf7 <bigdir+0x107>
+  for(i = 0; i < 500; i++){
+    1cbe:	83 c3 01             	add    $0x1,%ebx
+    1cc1:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    1cc7:	75 c7                	jne    1c90 <bigdir+0xa0>
+  printf(1, "bigdir ok\n");
+    1cc9:	83 ec 08             	sub    $0x8,%esp
+    1ccc:	68 68 53 00 00       	push   $0x5368
+    1cd1:	6a 01                	push   $0x1
+    1cd3:	e8 38 2c 00 00       	call   4910 <printf>
+    1cd8:	83 c4 10             	add    $0x10,%esp
+}
+    1cdb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1cde:	5b                   	pop    %ebx
+    1cdf:	5e                   	pop    %esi
+    1ce0:	5f                   	pop    %edi
+    1ce1:	5d                   	pop    %ebp
+    1ce2:	c3                   	ret
+      printf(1, "bigdir link failed\n");
+    1ce3:	83 ec 08             	sub    $0x8,%esp
+    1ce6:	68 3f 53 00 00       	push   $0x533f
+    1ceb:	6a 01                	push   $0x1
+    1ced:	e8 1e 2c 00 00       	call   4910 <printf>
+      exit();
+    1cf2:	e8 82 27 00 00       	call   4479 <exit>
+      printf(1, "bigdir unlink failed");
+    1cf7:	83 ec 08             	sub    $0x8,%esp
+    1cfa:	68 53 53 00 00       	push   $0x5353
+    1cff:	6a 01                	push   $0x1
+    1d01:	e8 0a 2c 00 00       	call   4910 <printf>
+      exit();
+    1d06:	e8 6e 27 00 00       	call   4479 <exit>
+    printf(1, "bigdir create failed\n");
+    1d0b:	50                   	push   %eax
+    1d0c:	50                   	push   %eax
+    1d0d:	68 29 53 00 00       	push   $0x5329
+    1d12:	6a 01                	push   $0x1
+    1d14:	e8 f7 2b 00 00       	call   4910 <printf>
+    exit();
+    1d19:	e8 5b 27 00 00       	call   4479 <exit>
+    1d1e:	66 90                	xchg   %ax,%ax
+
+00001d20 <subdir>:
+{
+    1d20:	55                   	push   %ebp
+    1d21:	89 e5                	mov    %esp,%ebp
+    1d23:	53                   	push   %ebx
+    1d24:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    1d27:	68 73 53 00 00       	push   $0x5373
+    1d2c:	6a 01                	push   $0x1
+    1d2e:	e8 dd 2b 00 00       	call   4910 <printf>
+  unlink("ff");
+    1d33:	c7 04 24 fc 53 00 00 	movl   $0x53fc,(%esp)
+    1d3a:	e8 5c 28 00 00       	call   459b <unlink>
+  if(mkdir("dd") != 0){
+    1d3f:	c7 04 24 99 54 00 00 	movl   $0x5499,(%esp)
+    1d46:	e8 a7 28 00 00       	call   45f2 <mkdir>
+    1d4b:	83 c4 10             	add    $0x10,%esp
+    1d4e:	85 c0                	test   %eax,%eax
+    1d50:	0f 85 b3 05 00 00    	jne    2309 <subdir+0x5e9>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1d56:	83 ec 08             	sub    $0x8,%esp
+    1d59:	68 02 02 00 00       	push   $0x202
+    1d5e:	68 d2 53 00 00       	push   $0x53d2
+    1d63:	e8 f9 27 00 00       	call   4561 <open>
+  if(fd < 0){
+    1d68:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1d6b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1d6d:	85 c0                	test   %eax,%eax
+    1d6f:	0f 88 81 05 00 00    	js     22f6 <subdir+0x5d6>
+  write(fd, "ff", 2);
+    1d75:	83 ec 04             	sub    $0x4,%esp
+    1d78:	6a 02                	push   $0x2
+    1d7a:	68 fc 53 00 00       	push   $0x53fc
+    1d7f:	50                   	push   %eax
+    1d80:	e8 68 27 00 00       	call   44ed <write>
+  close(fd);
+    1d85:	89 1c 24             	mov    %ebx,(%esp)
+    1d88:	e8 7d 27 00 00       	call   450a <close>
+  if(unlink("dd") >= 0){
+    1d8d:	c7 04 24 99 54 00 00 	movl   $0x5499,(%esp)
+    1d94:	e8 02 28 00 00       	call   459b <unlink>
+    1d99:	83 c4 10             	add    $0x10,%esp
+    1d9c:	85 c0                	test   %eax,%eax
+    1d9e:	0f 89 3f 05 00 00    	jns    22e3 <subdir+0x5c3>
+  if(mkdir("/dd/dd") != 0){
+    1da4:	83 ec 0c             	sub    $0xc,%esp
+    1da7:	68 ad 53 00 00       	push   $0x53ad
+    1dac:	e8 41 28 00 00       	call   45f2 <mkdir>
+    1db1:	83 c4 10             	add    $0x10,%esp
+    1db4:	85 c0                	test   %eax,%eax
+    1db6:	0f 85 14 05 00 00    	jne    22d0 <subdir+0x5b0>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    1dbc:	83 ec 08             	sub    $0x8,%esp
+    1dbf:	68 02 02 00 00       	push   $0x202
+    1dc4:	68 cf 53 00 00       	push   $0x53cf
+    1dc9:	e8 93 27 00 00       	call   4561 <open>
+  if(fd < 0){
+    1dce:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    1dd1:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1dd3:	85 c0                	test   %eax,%eax
+    1dd5:	0f 88 24 04 00 00    	js     21ff <subdir+0x4df>
+  write(fd, "FF", 2);
+    1ddb:	83 ec 04             	sub    $0x4,%esp
+    1dde:	6a 02                	push   $0x2
+    1de0:	68 f0 53 00 00       	push   $0x53f0
+    1de5:	50                   	push   %eax
+    1de6:	e8 02 27 00 00       	call   44ed <write>
+  close(fd);
+    1deb:	89 1c 24             	mov    %ebx,(%esp)
+    1dee:	e8 17 27 00 00       	call   450a <close>
+  fd = open("dd/dd/../ff", 0);
+    1df3:	58                   	pop    %eax
+    1df4:	5a                   	pop    %edx
+    1df5:	6a 00                	push   $0x0
+    1df7:	68 f3 53 00 00       	push   $0x53f3
+    1dfc:	e8 60 27 00 00       	call   4561 <open>
+  if(fd < 0){
+    1e01:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/../ff", 0);
+    1e04:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1e06:	85 c0                	test   %eax,%eax
+    1e08:	0f 88 de 03 00 00    	js     21ec <subdir+0x4cc>
+  cc = read(fd, buf, sizeof(buf));
+    1e0e:	83 ec 04             	sub    $0x4,%esp
+    1e11:	68 00 20 00 00       	push   $0x2000
+    1e16:	68 e0 99 00 00       	push   $0x99e0
+    1e1b:	50                   	push   %eax
+    1e1c:	e8 af 26 00 00       	call   44d0 <read>
+  if(cc != 2 || buf[0] != 'f'){
+    1e21:	83 c4 10             	add    $0x10,%esp
+    1e24:	83 f8 02             	cmp    $0x2,%eax
+    1e27:	0f 85 3a 03 00 00    	jne    2167 <subdir+0x447>
+    1e2d:	80 3d e0 99 00 00 66 	cmpb   $0x66,0x99e0
+    1e34:	0f 85 2d 03 00 00    	jne    2167 <subdir+0x447>
+  close(fd);
+    1e3a:	83 ec 0c             	sub    $0xc,%esp
+    1e3d:	53                   	push   %ebx
+    1e3e:	e8 c7 26 00 00       	call   450a <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    1e43:	59                   	pop    %ecx
+    1e44:	5b                   	pop    %ebx
+    1e45:	68 33 54 00 00       	push   $0x5433
+    1e4a:	68 cf 53 00 00       	push   $0x53cf
+    1e4f:	e8 81 27 00 00       	call   45d5 <link>
+    1e54:	83 c4 10             	add    $0x10,%esp
+    1e57:	85 c0                	test   %eax,%eax
+    1e59:	0f 85 c6 03 00 00    	jne    2225 <subdir+0x505>
+  if(unlink("dd/dd/ff") != 0){
+    1e5f:	83 ec 0c             	sub    $0xc,%esp
+    1e62:	68 cf 53 00 00       	push   $0x53cf
+    1e67:	e8 2f 27 00 00       	call   459b <unlink>
+    1e6c:	83 c4 10             	add    $0x10,%esp
+    1e6f:	85 c0                	test   %eax,%eax
+    1e71:	0f 85 16 03 00 00    	jne    218d <subdir+0x46d>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    1e77:	83 ec 08             	sub    $0x8,%esp
+    1e7a:	6a 00                	push   $0x0
+    1e7c:	68 cf 53 00 00       	push   $0x53cf
+    1e81:	e8 db 26 00 00       	call   4561 <open>
+    1e86:	83 c4 10             	add    $0x10,%esp
+    1e89:	85 c0                	test   %eax,%eax
+    1e8b:	0f 89 2c 04 00 00    	jns    22bd <subdir+0x59d>
+  if(chdir("dd") != 0){
+    1e91:	83 ec 0c             	sub    $0xc,%esp
+    1e94:	68 99 54 00 00       	push   $0x5499
+    1e99:	e8 71 27 00 00       	call   460f <chdir>
+    1e9e:	83 c4 10             	add    $0x10,%esp
+    1ea1:	85 c0                	test   %eax,%eax
+    1ea3:	0f 85 01 04 00 00    	jne    22aa <subdir+0x58a>
+  if(chdir("dd/../../dd") != 0){
+    1ea9:	83 ec 0c             	sub    $0xc,%esp
+    1eac:	68 67 54 00 00       	push   $0x5467
+    1eb1:	e8 59 27 00 00       	call   460f <chdir>
+    1eb6:	83 c4 10             	add    $0x10,%esp
+    1eb9:	85 c0                	test   %eax,%eax
+    1ebb:	0f 85 b9 02 00 00    	jne    217a <subdir+0x45a>
+  if(chdir("dd/../../../dd") != 0){
+    1ec1:	83 ec 0c             	sub    $0xc,%esp
+    1ec4:	68 8d 54 00 00       	push   $0x548d
+    1ec9:	e8 41 27 00 00       	call   460f <chdir>
+    1ece:	83 c4 10             	add    $0x10,%esp
+    1ed1:	85 c0                	test   %eax,%eax
+    1ed3:	0f 85 a1 02 00 00    	jne    217a <subdir+0x45a>
+  if(chdir("./..") != 0){
+    1ed9:	83 ec 0c             	sub    $0xc,%esp
+    1edc:	68 9c 54 00 00       	push   $0x549c
+    1ee1:	e8 29 27 00 00       	call   460f <chdir>
+    1ee6:	83 c4 10             	add    $0x10,%esp
+    1ee9:	85 c0                	test   %eax,%eax
+    1eeb:	0f 85 21 03 00 00    	jne    2212 <subdir+0x4f2>
+  fd = open("dd/dd/ffff", 0);
+    1ef1:	83 ec 08             	sub    $0x8,%esp
+    1ef4:	6a 00                	push   $0x0
+    1ef6:	68 33 54 00 00       	push   $0x5433
+    1efb:	e8 61 26 00 00       	call   4561 <open>
+  if(fd < 0){
+    1f00:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ffff", 0);
+    1f03:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1f05:	85 c0                	test   %eax,%eax
+    1f07:	0f 88 e0 04 00 00    	js     23ed <subdir+0x6cd>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    1f0d:	83 ec 04             	sub    $0x4,%esp
+    1f10:	68 00 20 00 00       	push   $0x2000
+    1f15:	68 e0 99 00 00       	push   $0x99e0
+    1f1a:	50                   	push   %eax
+    1f1b:	e8 b0 25 00 00       	call   44d0 <read>
+    1f20:	83 c4 10             	add    $0x10,%esp
+    1f23:	83 f8 02             	cmp    $0x2,%eax
+    1f26:	0f 85 ae 04 00 00    	jne    23da <subdir+0x6ba>
+  close(fd);
+    1f2c:	83 ec 0c             	sub    $0xc,%esp
+    1f2f:	53                   	push   %ebx
+    1f30:	e8 d5 25 00 00       	call   450a <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    1f35:	58                   	pop    %eax
+    1f36:	5a                   	pop    %edx
+    1f37:	6a 00                	push   $0x0
+    1f39:	68 cf 53 00 00       	push   $0x53cf
+    1f3e:	e8 1e 26 00 00       	call   4561 <open>
+    1f43:	83 c4 10             	add    $0x10,%esp
+    1f46:	85 c0                	test   %eax,%eax
+    1f48:	0f 89 65 02 00 00    	jns    21b3 <subdir+0x493>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    1f4e:	83 ec 08             	sub    $0x8,%esp
+    1f51:	68 02 02 00 00       	push   $0x202
+    1f56:	68 e7 54 00 00       	push   $0x54e7
+    1f5b:	e8 01 26 00 00       	call   4561 <open>
+    1f60:	83 c4 10             	add    $0x10,%esp
+    1f63:	85 c0                	test   %eax,%eax
+    1f65:	0f 89 35 02 00 00    	jns    21a0 <subdir+0x480>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    1f6b:	83 ec 08             	sub    $0x8,%esp
+    1f6e:	68 02 02 00 00       	push   $0x202
+    1f73:	68 0c 55 00 00       	push   $0x550c
+    1f78:	e8 e4 25 00 00       	call   4561 <open>
+    1f7d:	83 c4 10             	add    $0x10,%esp
+    1f80:	85 c0                	test   %eax,%eax
+    1f82:	0f 89 0f 03 00 00    	jns    2297 <subdir+0x577>
+  if(open("dd", O_CREATE) >= 0){
+    1f88:	83 ec 08             	sub    $0x8,%esp
+    1f8b:	68 00 02 00 00       	push   $0x200
+    1f90:	68 99 54 00 00       	push   $0x5499
+    1f95:	e8 c7 25 00 00       	call   4561 <open>
+    1f9a:	83 c4 10             	add    $0x10,%esp
+    1f9d:	85 c0                	test   %eax,%eax
+    1f9f:	0f 89 df 02 00 00    	jns    2284 <subdir+0x564>
+  if(open("dd", O_RDWR) >= 0){
+    1fa5:	83 ec 08             	sub    $0x8,%esp
+    1fa8:	6a 02                	push   $0x2
+    1faa:	68 99 54 00 00       	push   $0x5499
+    1faf:	e8 ad 25 00 00       	call   4561 <open>
+    1fb4:	83 c4 10             	add    $0x10,%esp
+    1fb7:	85 c0                	test   %eax,%eax
+    1fb9:	0f 89 b2 02 00 00    	jns    2271 <subdir+0x551>
+  if(open("dd", O_WRONLY) >= 0){
+    1fbf:	83 ec 08             	sub    $0x8,%esp
+    1fc2:	6a 01                	push   $0x1
+    1fc4:	68 99 54 00 00       	push   $0x5499
+    1fc9:	e8 93 25 00 00       	call   4561 <open>
+    1fce:	83 c4 10             	add    $0x10,%esp
+    1fd1:	85 c0                	test   %eax,%eax
+    1fd3:	0f 89 85 02 00 00    	jns    225e <subdir+0x53e>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    1fd9:	83 ec 08             	sub    $0x8,%esp
+    1fdc:	68 7b 55 00 00       	push   $0x557b
+    1fe1:	68 e7 54 00 00       	push   $0x54e7
+    1fe6:	e8 ea 25 00 00       	call   45d5 <link>
+    1feb:	83 c4 10             	add    $0x10,%esp
+    1fee:	85 c0                	test   %eax,%eax
+    1ff0:	0f 84 55 02 00 00    	je     224b <subdir+0x52b>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    1ff6:	83 ec 08             	sub    $0x8,%esp
+    1ff9:	68 7b 55 00 00       	push   $0x557b
+    1ffe:	68 0c 55 00 00       	push   $0x550c
+    2003:	e8 cd 25 00 00       	call   45d5 <link>
+    2008:	83 c4 10             	add    $0x10,%esp
+    200b:	85 c0                	test   %eax,%eax
+    200d:	0f 84 25 02 00 00    	je     2238 <subdir+0x518>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    2013:	83 ec 08             	sub    $0x8,%esp
+    2016:	68 33 54 00 00       	push   $0x5433
+    201b:	68 d2 53 00 00       	push   $0x53d2
+    2020:	e8 b0 25 00 00       	call   45d5 <link>
+    2025:	83 c4 10             	add    $0x10,%esp
+    2028:	85 c0                	test   %eax,%eax
+    202a:	0f 84 a9 01 00 00    	je     21d9 <subdir+0x4b9>
+  if(mkdir("dd/ff/ff") == 0){
+    2030:	83 ec 0c             	sub    $0xc,%esp
+    2033:	68 e7 54 00 00       	push   $0x54e7
+    2038:	e8 b5 25 00 00       	call   45f2 <mkdir>
+    203d:	83 c4 10             	add    $0x10,%esp
+    2040:	85 c0                	test   %eax,%eax
+    2042:	0f 84 7e 01 00 00    	je     21c6 <subdir+0x4a6>
+  if(mkdir("dd/xx/ff") == 0){
+    2048:	83 ec 0c             	sub    $0xc,%esp
+    204b:	68 0c 55 00 00       	push   $0x550c
+    2050:	e8 9d 25 00 00       	call   45f2 <mkdir>
+    2055:	83 c4 10             	add    $0x10,%esp
+    2058:	85 c0                	test   %eax,%eax
+    205a:	0f 84 67 03 00 00    	je     23c7 <subdir+0x6a7>
+  if(mkdir("dd/dd/ffff") == 0){
+    2060:	83 ec 0c             	sub    $0xc,%esp
+    2063:	68 33 54 00 00       	push   $0x5433
+    2068:	e8 85 25 00 00       	call   45f2 <mkdir>
+    206d:	83 c4 10             	add    $0x10,%esp
+    2070:	85 c0                	test   %eax,%eax
+    2072:	0f 84 3c 03 00 00    	je     23b4 <subdir+0x694>
+  if(unlink("dd/xx/ff") == 0){
+    2078:	83 ec 0c             	sub    $0xc,%esp
+    207b:	68 0c 55 00 00       	push   $0x550c
+    2080:	e8 16 25 00 00       	call   459b <unlink>
+    2085:	83 c4 10             	add    $0x10,%esp
+    2088:	85 c0                	test   %eax,%eax
+    208a:	0f 84 11 03 00 00    	je     23a1 <subdir+0x681>
+  if(unlink("dd/ff/ff") == 0){
+    2090:	83 ec 0c             	sub    $0xc,%esp
+    2093:	68 e7 54 00 00       	push   $0x54e7
+    2098:	e8 fe 24 00 00       	call   459b <unlink>
+    209d:	83 c4 10             	add    $0x10,%esp
+    20a0:	85 c0                	test   %eax,%eax
+    20a2:	0f 84 e6 02 00 00    	je     238e <subdir+0x66e>
+  if(chdir("dd/ff") == 0){
+    20a8:	83 ec 0c             	sub    $0xc,%esp
+    20ab:	68 d2 53 00 00       	push   $0x53d2
+    20b0:	e8 5a 25 00 00       	call   460f <chdir>
+    20b5:	83 c4 10             	add    $0x10,%esp
+    20b8:	85 c0                	test   %eax,%eax
+    20ba:	0f 84 bb 02 00 00    	je     237b <subdir+0x65b>
+  if(chdir("dd/xx") == 0){
+    20c0:	83 ec 0c             	sub    $0xc,%esp
+    20c3:	68 7e 55 00 00       	push   $0x557e
+    20c8:	e8 42 25 00 00       	call   460f <chdir>
+    20cd:	83 c4 10             	add    $0x10,%esp
+    20d0:	85 c0                	test   %eax,%eax
+    20d2:	0f 84 90 02 00 00    	je     2368 <subdir+0x648>
+  if(unlink("dd/dd/ffff") != 0){
+    20d8:	83 ec 0c             	sub    $0xc,%esp
+    20db:	68 33 54 00 00       	push   $0x5433
+    20e0:	e8 b6 24 00 00       	call   459b <unlink>
+    20e5:	83 c4 10             	add    $0x10,%esp
+    20e8:	85 c0                	test   %eax,%eax
+    20ea:	0f 85 9d 00 00 00    	jne    218d <subdir+0x46d>
+  if(unlink("dd/ff") != 0){
+    20f0:	83 ec 0c             	sub    $0xc,%esp
+    20f3:	68 d2 53 00 00       	push   $0x53d2
+    20f8:	e8 9e 24 00 00       	call   459b <unlink>
+    20fd:	83 c4 10             	add    $0x10,%esp
+    2100:	85 c0                	test   %eax,%eax
+    2102:	0f 85 4d 02 00 00    	jne    2355 <subdir+0x635>
+  if(unlink("dd") == 0){
+    2108:	83 ec 0c             	sub    $0xc,%esp
+    210b:	68 99 54 00 00       	push   $0x5499
+    2110:	e8 86 24 00 00       	call   459b <unlink>
+    2115:	83 c4 10             	add    $0x10,%esp
+    2118:	85 c0                	test   %eax,%eax
+    211a:	0f 84 22 02 00 00    	je     2342 <subdir+0x622>
+  if(unlink("dd/dd") < 0){
+    2120:	83 ec 0c             	sub    $0xc,%esp
+    2123:	68 ae 53 00 00       	push   $0x53ae
+    2128:	e8 6e 24 00 00       	call   459b <unlink>
+    212d:	83 c4 10             	add    $0x10,%esp
+    2130:	85 c0                	test   %eax,%eax
+    2132:	0f 88 f7 01 00 00    	js     232f <subdir+0x60f>
+  if(unlink("dd") < 0){
+    2138:	83 ec 0c             	sub    $0xc,%esp
+    213b:	68 99 54 00 00       	push   $0x5499
+    2140:	e8 56 24 00 00       	call   459b <unlink>
+    2145:	83 c4 10             	add    $0x10,%esp
+    2148:	85 c0                	test   %eax,%eax
+    214a:	0f 88 cc 01 00 00    	js     231c <subdir+0x5fc>
+  printf(1, "subdir ok\n");
+    2150:	83 ec 08             	sub    $0x8,%esp
+    2153:	68 7b 56 00 00       	push   $0x567b
+    2158:	6a 01                	push   $0x1
+    215a:	e8 b1 27 00 00       	call   4910 <printf>
+}
+    215f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2162:	83 c4 10             	add    $0x10,%esp
+    2165:	c9                   	leave
+    2166:	c3                   	ret
+    printf(1, "dd/dd/../ff wrong content\n");
+    2167:	50                   	push   %eax
+    2168:	50                   	push   %eax
+    2169:	68 18 54 00 00       	push   $0x5418
+    216e:	6a 01                	push   $0x1
+    2170:	e8 9b 27 00 00       	call   4910 <printf>
+    exit();
+    2175:	e8 ff 22 00 00       	call   4479 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    217a:	50                   	push   %eax
+    217b:	50                   	push   %eax
+    217c:	68 73 54 00 00       	push   $0x5473
+    2181:	6a 01                	push   $0x1
+    2183:	e8 88 27 00 00       	call   4910 <printf>
+    exit();
+    2188:	e8 ec 22 00 00       	call   4479 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    218d:	50                   	push   %eax
+    218e:	50                   	push   %eax
+    218f:	68 3e 54 00 00       	push   $0x543e
+    2194:	6a 01                	push   $0x1
+    2196:	e8 75 27 00 00       	call   4910 <printf>
+    exit();
+    219b:	e8 d9 22 00 00       	call   4479 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    21a0:	51                   	push   %ecx
+    21a1:	51                   	push   %ecx
+    21a2:	68 f0 54 00 00       	push   $0x54f0
+    21a7:	6a 01                	push   $0x1
+    21a9:	e8 62 27 00 00       	call   4910 <printf>
+    exit();
+    21ae:	e8 c6 22 00 00       	call   4479 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    21b3:	53                   	push   %ebx
+    21b4:	53                   	push   %ebx
+    21b5:	68 50 61 00 00       	push   $0x6150
+    21ba:	6a 01                	push   $0x1
+    21bc:	e8 4f 27 00 00       	call   4910 <printf>
+    exit();
+    21c1:	e8 b3 22 00 00       	call   4479 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    21c6:	51                   	push   %ecx
+    21c7:	51                   	push   %ecx
+    21c8:	68 84 55 00 00       	push   $0x5584
+    21cd:	6a 01                	push   $0x1
+    21cf:	e8 3c 27 00 00       	call   4910 <printf>
+    exit();
+    21d4:	e8 a0 22 00 00       	call   4479 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    21d9:	53                   	push   %ebx
+    21da:	53                   	push   %ebx
+    21db:	68 c0 61 00 00       	push   $0x61c0
+    21e0:	6a 01                	push   $0x1
+    21e2:	e8 29 27 00 00       	call   4910 <printf>
+    exit();
+    21e7:	e8 8d 22 00 00       	call   4479 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    21ec:	50                   	push   %eax
+    21ed:	50                   	push   %eax
+    21ee:	68 ff 53 00 00       	push   $0x53ff
+    21f3:	6a 01                	push   $0x1
+    21f5:	e8 16 27 00 00       	call   4910 <printf>
+    exit();
+    21fa:	e8 7a 22 00 00       	call   4479 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    21ff:	51                   	push   %ecx
+    2200:	51                   	push   %ecx
+    2201:	68 d8 53 00 00       	push   $0x53d8
+    2206:	6a 01                	push   $0x1
+    2208:	e8 03 27 00 00       	call   4910 <printf>
+    exit();
+    220d:	e8 67 22 00 00       	call   4479 <exit>
+    printf(1, "chdir ./.. failed\n");
+    2212:	50                   	push   %eax
+    2213:	50                   	push   %eax
+    2214:	68 a1 54 00 00       	push   $0x54a1
+    2219:	6a 01                	push   $0x1
+    221b:	e8 f0 26 00 00       	call   4910 <printf>
+    exit();
+    2220:	e8 54 22 00 00       	call   4479 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    2225:	52                   	push   %edx
+    2226:	52                   	push   %edx
+    2227:	68 08 61 00 00       	push   $0x6108
+    222c:	6a 01                	push   $0x1
+    222e:	e8 dd 26 00 00       	call   4910 <printf>
+    exit();
+    2233:	e8 41 22 00 00       	call   4479 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    2238:	50                   	push   %eax
+    2239:	50                   	push   %eax
+    223a:	68 9c 61 00 00       	push   $0x619c
+    223f:	6a 01                	push   $0x1
+    2241:	e8 ca 26 00 00       	call   4910 <printf>
+    exit();
+    2246:	e8 2e 22 00 00       	call   4479 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    224b:	50                   	push   %eax
+    224c:	50                   	push   %eax
+    224d:	68 78 61 00 00       	push   $0x6178
+    2252:	6a 01                	push   $0x1
+    2254:	e8 b7 26 00 00       	call   4910 <printf>
+    exit();
+    2259:	e8 1b 22 00 00       	call   4479 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    225e:	50                   	push   %eax
+    225f:	50                   	push   %eax
+    2260:	68 60 55 00 00       	push   $0x5560
+    2265:	6a 01                	push   $0x1
+    2267:	e8 a4 26 00 00       	call   4910 <printf>
+    exit();
+    226c:	e8 08 22 00 00       	call   4479 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    2271:	50                   	push   %eax
+    2272:	50                   	push   %eax
+    2273:	68 47 55 00 00       	push   $0x5547
+    2278:	6a 01                	push   $0x1
+    227a:	e8 91 26 00 00       	call   4910 <printf>
+    exit();
+    227f:	e8 f5 21 00 00       	call   4479 <exit>
+    printf(1, "create dd succeeded!\n");
+    2284:	50                   	push   %eax
+    2285:	50                   	push   %eax
+    2286:	68 31 55 00 00       	push   $0x5531
+    228b:	6a 01                	push   $0x1
+    228d:	e8 7e 26 00 00       	call   4910 <printf>
+    exit();
+    2292:	e8 e2 21 00 00       	call   4479 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    2297:	52                   	push   %edx
+    2298:	52                   	push   %edx
+    2299:	68 15 55 00 00       	push   $0x5515
+    229e:	6a 01                	push   $0x1
+    22a0:	e8 6b 26 00 00       	call   4910 <printf>
+    exit();
+    22a5:	e8 cf 21 00 00       	call   4479 <exit>
+    printf(1, "chdir dd failed\n");
+    22aa:	50                   	push   %eax
+    22ab:	50                   	push   %eax
+    22ac:	68 56 54 00 00       	push   $0x5456
+    22b1:	6a 01                	push   $0x1
+    22b3:	e8 58 26 00 00       	call   4910 <printf>
+    exit();
+    22b8:	e8 bc 21 00 00       	call   4479 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    22bd:	50                   	push   %eax
+    22be:	50                   	push   %eax
+    22bf:	68 2c 61 00 00       	push   $0x612c
+    22c4:	6a 01                	push   $0x1
+    22c6:	e8 45 26 00 00       	call   4910 <printf>
+    exit();
+    22cb:	e8 a9 21 00 00       	call   4479 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    22d0:	53                   	push   %ebx
+    22d1:	53                   	push   %ebx
+    22d2:	68 b4 53 00 00       	push   $0x53b4
+    22d7:	6a 01                	push   $0x1
+    22d9:	e8 32 26 00 00       	call   4910 <printf>
+    exit();
+    22de:	e8 96 21 00 00       	call   4479 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    22e3:	50                   	push   %eax
+    22e4:	50                   	push   %eax
+    22e5:	68 e0 60 00 00       	push   $0x60e0
+    22ea:	6a 01                	push   $0x1
+    22ec:	e8 1f 26 00 00       	call   4910 <printf>
+    exit();
+    22f1:	e8 83 21 00 00       	call   4479 <exit>
+    printf(1, "create dd/ff failed\n");
+    22f6:	50                   	push   %eax
+    22f7:	50                   	push   %eax
+    22f8:	68 98 53 00 00       	push   $0x5398
+    22fd:	6a 01                	push   $0x1
+    22ff:	e8 0c 26 00 00       	call   4910 <printf>
+    exit();
+    2304:	e8 70 21 00 00       	call   4479 <exit>
+    printf(1, "subdir mkdir dd failed\n");
+    2309:	50                   	push   %eax
+    230a:	50                   	push   %eax
+    230b:	68 80 53 00 00       	push   $0x5380
+    2310:	6a 01                	push   $0x1
+    2312:	e8 f9 25 00 00       	call   4910 <printf>
+    exit();
+    2317:	e8 5d 21 00 00       	call   4479 <exit>
+    printf(1, "unlink dd failed\n");
+    231c:	50                   	push   %eax
+    231d:	50                   	push   %eax
+    231e:	68 69 56 00 00       	push   $0x5669
+    2323:	6a 01                	push   $0x1
+    2325:	e8 e6 25 00 00       	call   4910 <printf>
+    exit();
+    232a:	e8 4a 21 00 00       	call   4479 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    232f:	52                   	push   %edx
+    2330:	52                   	push   %edx
+    2331:	68 54 56 00 00       	push   $0x5654
+    2336:	6a 01                	push   $0x1
+    2338:	e8 d3 25 00 00       	call   4910 <printf>
+    exit();
+    233d:	e8 37 21 00 00       	call   4479 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    2342:	51                   	push   %ecx
+    2343:	51                   	push   %ecx
+    2344:	68 e4 61 00 00       	push   $0x61e4
+    2349:	6a 01                	push   $0x1
+    234b:	e8 c0 25 00 00       	call   4910 <printf>
+    exit();
+    2350:	e8 24 21 00 00       	call   4479 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    2355:	53                   	push   %ebx
+    2356:	53                   	push   %ebx
+    2357:	68 3f 56 00 00       	push   $0x563f
+    235c:	6a 01                	push   $0x1
+    235e:	e8 ad 25 00 00       	call   4910 <printf>
+    exit();
+    2363:	e8 11 21 00 00       	call   4479 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    2368:	50                   	push   %eax
+    2369:	50                   	push   %eax
+    236a:	68 27 56 00 00       	push   $0x5627
+    236f:	6a 01                	push   $0x1
+    2371:	e8 9a 25 00 00       	call   4910 <printf>
+    exit();
+    2376:	e8 fe 20 00 00       	call   4479 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    237b:	50                   	push   %eax
+    237c:	50                   	push   %eax
+    237d:	68 0f 56 00 00       	push   $0x560f
+    2382:	6a 01                	push   $0x1
+    2384:	e8 87 25 00 00       	call   4910 <printf>
+    exit();
+    2389:	e8 eb 20 00 00       	call   4479 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    238e:	50                   	push   %eax
+    238f:	50                   	push   %eax
+    2390:	68 f3 55 00 00       	push   $0x55f3
+    2395:	6a 01                	push   $0x1
+    2397:	e8 74 25 00 00       	call   4910 <printf>
+    exit();
+    239c:	e8 d8 20 00 00       	call   4479 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    23a1:	50                   	push   %eax
+    23a2:	50                   	push   %eax
+    23a3:	68 d7 55 00 00       	push   $0x55d7
+    23a8:	6a 01                	push   $0x1
+    23aa:	e8 61 25 00 00       	call   4910 <printf>
+    exit();
+    23af:	e8 c5 20 00 00       	call   4479 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    23b4:	50                   	push   %eax
+    23b5:	50                   	push   %eax
+    23b6:	68 ba 55 00 00       	push   $0x55ba
+    23bb:	6a 01                	push   $0x1
+    23bd:	e8 4e 25 00 00       	call   4910 <printf>
+    exit();
+    23c2:	e8 b2 20 00 00       	call   4479 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    23c7:	52                   	push   %edx
+    23c8:	52                   	push   %edx
+    23c9:	68 9f 55 00 00       	push   $0x559f
+    23ce:	6a 01                	push   $0x1
+    23d0:	e8 3b 25 00 00       	call   4910 <printf>
+    exit();
+    23d5:	e8 9f 20 00 00       	call   4479 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    23da:	51                   	push   %ecx
+    23db:	51                   	push   %ecx
+    23dc:	68 cc 54 00 00       	push   $0x54cc
+    23e1:	6a 01                	push   $0x1
+    23e3:	e8 28 25 00 00       	call   4910 <printf>
+    exit();
+    23e8:	e8 8c 20 00 00       	call   4479 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    23ed:	53                   	push   %ebx
+    23ee:	53                   	push   %ebx
+    23ef:	68 b4 54 00 00       	push   $0x54b4
+    23f4:	6a 01                	push   $0x1
+    23f6:	e8 15 25 00 00       	call   4910 <printf>
+    exit();
+    23fb:	e8 79 20 00 00       	call   4479 <exit>
+
+00002400 <bigwrite>:
+{
+    2400:	55                   	push   %ebp
+    2401:	89 e5                	mov    %esp,%ebp
+    2403:	56                   	push   %esi
+    2404:	53                   	push   %ebx
+  for(sz = 499; sz < 12*512; sz += 471){
+    2405:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+    240a:	83 ec 08             	sub    $0x8,%esp
+    240d:	68 86 56 00 00       	push   $0x5686
+    2412:	6a 01                	push   $0x1
+    2414:	e8 f7 24 00 00       	call   4910 <printf>
+  unlink("bigwrite");
+    2419:	c7 04 24 95 56 00 00 	movl   $0x5695,(%esp)
+    2420:	e8 76 21 00 00       	call   459b <unlink>
+    2425:	83 c4 10             	add    $0x10,%esp
+    2428:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    242f:	90                   	nop
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2430:	83 ec 08             	sub    $0x8,%esp
+    2433:	68 02 02 00 00       	push   $0x202
+    2438:	68 95 56 00 00       	push   $0x5695
+    243d:	e8 1f 21 00 00       	call   4561 <open>
+    if(fd < 0){
+    2442:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2445:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    2447:	85 c0                	test   %eax,%eax
+    2449:	78 7e                	js     24c9 <bigwrite+0xc9>
+      int cc = write(fd, buf, sz);
+    244b:	83 ec 04             	sub    $0x4,%esp
+    244e:	53                   	push   %ebx
+    244f:	68 e0 99 00 00       	push   $0x99e0
+    2454:	50                   	push   %eax
+    2455:	e8 93 20 00 00       	call   44ed <write>
+      if(cc != sz){
+    245a:	83 c4 10             	add    $0x10,%esp
+    245d:	39 d8                	cmp    %ebx,%eax
+    245f:	75 55                	jne    24b6 <bigwrite+0xb6>
+      int cc = write(fd, buf, sz);
+    2461:	83 ec 04             	sub    $0x4,%esp
+    2464:	53                   	push   %ebx
+    2465:	68 e0 99 00 00       	push   $0x99e0
+    246a:	56                   	push   %esi
+    246b:	e8 7d 20 00 00       	call   44ed <write>
+      if(cc != sz){
+    2470:	83 c4 10             	add    $0x10,%esp
+    2473:	39 c3                	cmp    %eax,%ebx
+    2475:	75 3f                	jne    24b6 <bigwrite+0xb6>
+    close(fd);
+    2477:	83 ec 0c             	sub    $0xc,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    247a:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+    2480:	56                   	push   %esi
+    2481:	e8 84 20 00 00       	call   450a <close>
+    unlink("bigwrite");
+    2486:	c7 04 24 95 56 00 00 	movl   $0x5695,(%esp)
+    248d:	e8 09 21 00 00       	call   459b <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    2492:	83 c4 10             	add    $0x10,%esp
+    2495:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    249b:	75 93                	jne    2430 <bigwrite+0x30>
+  printf(1, "bigwrite ok\n");
+    249d:	83 ec 08             	sub    $0x8,%esp
+    24a0:	68 c8 56 00 00       	push   $0x56c8
+    24a5:	6a 01                	push   $0x1
+    24a7:	e8 64 24 00 00       	call   4910 <printf>
+}
+    24ac:	83 c4 10             	add    $0x10,%esp
+    24af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    24b2:	5b                   	pop    %ebx
+    24b3:	5e                   	pop    %esi
+    24b4:	5d                   	pop    %ebp
+    24b5:	c3                   	ret
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    24b6:	50                   	push   %eax
+    24b7:	53                   	push   %ebx
+    24b8:	68 b6 56 00 00       	push   $0x56b6
+    24bd:	6a 01                	push   $0x1
+    24bf:	e8 4c 24 00 00       	call   4910 <printf>
+        exit();
+    24c4:	e8 b0 1f 00 00       	call   4479 <exit>
+      printf(1, "cannot create bigwrite\n");
+    24c9:	83 ec 08             	sub    $0x8,%esp
+    24cc:	68 9e 56 00 00       	push   $0x569e
+    24d1:	6a 01                	push   $0x1
+    24d3:	e8 38 24 00 00       	call   4910 <printf>
+      exit();
+    24d8:	e8 9c 1f 00 00       	call   4479 <exit>
+    24dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000024e0 <bigfile>:
+{
+    24e0:	55                   	push   %ebp
+    24e1:	89 e5                	mov    %esp,%ebp
+    24e3:	57                   	push   %edi
+    24e4:	56                   	push   %esi
+    24e5:	53                   	push   %ebx
+    24e6:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigfile test\n");
+    24e9:	68 d5 56 00 00       	push   $0x56d5
+    24ee:	6a 01                	push   $0x1
+    24f0:	e8 1b 24 00 00       	call   4910 <printf>
+  unlink("bigfile");
+    24f5:	c7 04 24 f1 56 00 00 	movl   $0x56f1,(%esp)
+    24fc:	e8 9a 20 00 00       	call   459b <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    2501:	58                   	pop    %eax
+    2502:	5a                   	pop    %edx
+    2503:	68 02 02 00 00       	push   $0x202
+    2508:	68 f1 56 00 00       	push   $0x56f1
+    250d:	e8 4f 20 00 00       	call   4561 <open>
+  if(fd < 0){
+    2512:	83 c4 10             	add    $0x10,%esp
+    2515:	85 c0                	test   %eax,%eax
+    2517:	0f 88 5e 01 00 00    	js     267b <bigfile+0x19b>
+    251d:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    251f:	31 db                	xor    %ebx,%ebx
+    2521:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 600);
+    2528:	83 ec 04             	sub    $0x4,%esp
+    252b:	68 58 02 00 00       	push   $0x258
+    2530:	53                   	push   %ebx
+    2531:	68 e0 99 00 00       	push   $0x99e0
+    2536:	e8 05 1d 00 00       	call   4240 <memset>
+    if(write(fd, buf, 600) != 600){
+    253b:	83 c4 0c             	add    $0xc,%esp
+    253e:	68 58 02 00 00       	push   $0x258
+    2543:	68 e0 99 00 00       	push   $0x99e0
+    2548:	56                   	push   %esi
+    2549:	e8 9f 1f 00 00       	call   44ed <write>
+    254e:	83 c4 10             	add    $0x10,%esp
+    2551:	3d 58 02 00 00       	cmp    $0x258,%eax
+    2556:	0f 85 f8 00 00 00    	jne    2654 <bigfile+0x174>
+  for(i = 0; i < 20; i++){
+    255c:	83 c3 01             	add    $0x1,%ebx
+    255f:	83 fb 14             	cmp    $0x14,%ebx
+    2562:	75 c4                	jne    2528 <bigfile+0x48>
+  close(fd);
+    2564:	83 ec 0c             	sub    $0xc,%esp
+    2567:	56                   	push   %esi
+    2568:	e8 9d 1f 00 00       	call   450a <close>
+  fd = open("bigfile", 0);
+    256d:	5e                   	pop    %esi
+    256e:	5f                   	pop    %edi
+    256f:	6a 00                	push   $0x0
+    2571:	68 f1 56 00 00       	push   $0x56f1
+    2576:	e8 e6 1f 00 00       	call   4561 <open>
+  if(fd < 0){
+    257b:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+    257e:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    2580:	85 c0                	test   %eax,%eax
+    2582:	0f 88 e0 00 00 00    	js     2668 <bigfile+0x188>
+  total = 0;
+    2588:	31 db                	xor    %ebx,%ebx
+  for(i = 0; ; i++){
+    258a:	31 ff                	xor    %edi,%edi
+    258c:	eb 30                	jmp    25be <bigfile+0xde>
+    258e:	66 90                	xchg   %ax,%ax
+    if(cc != 300){
+    2590:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    2595:	0f 85 91 00 00 00    	jne    262c <bigfile+0x14c>
+    if(buf[0] != i/2 || buf[299] != i/2){
+    259b:	89 fa                	mov    %edi,%edx
+    259d:	0f be 05 e0 99 00 00 	movsbl 0x99e0,%eax
+    25a4:	d1 fa                	sar    %edx
+    25a6:	39 d0                	cmp    %edx,%eax
+    25a8:	75 6e                	jne    2618 <bigfile+0x138>
+    25aa:	0f be 15 0b 9b 00 00 	movsbl 0x9b0b,%edx
+    25b1:	39 d0                	cmp    %edx,%eax
+    25b3:	75 63                	jne    2618 <bigfile+0x138>
+    total += cc;
+    25b5:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+  for(i = 0; ; i++){
+    25bb:	83 c7 01             	add    $0x1,%edi
+    cc = read(fd, buf, 300);
+    25be:	83 ec 04             	sub    $0x4,%esp
+    25c1:	68 2c 01 00 00       	push   $0x12c
+    25c6:	68 e0 99 00 00       	push   $0x99e0
+    25cb:	56                   	push   %esi
+    25cc:	e8 ff 1e 00 00       	call   44d0 <read>
+    if(cc < 0){
+    25d1:	83 c4 10             	add    $0x10,%esp
+    25d4:	85 c0                	test   %eax,%eax
+    25d6:	78 68                	js     2640 <bigfile+0x160>
+    if(cc == 0)
+    25d8:	75 b6                	jne    2590 <bigfile+0xb0>
+  close(fd);
+    25da:	83 ec 0c             	sub    $0xc,%esp
+    25dd:	56                   	push   %esi
+    25de:	e8 27 1f 00 00       	call   450a <close>
+  if(total != 20*600){
+    25e3:	83 c4 10             	add    $0x10,%esp
+    25e6:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+    25ec:	0f 85 9c 00 00 00    	jne    268e <bigfile+0x1ae>
+  unlink("bigfile");
+    25f2:	83 ec 0c             	sub    $0xc,%esp
+    25f5:	68 f1 56 00 00       	push   $0x56f1
+    25fa:	e8 9c 1f 00 00       	call   459b <unlink>
+  printf(1, "bigfile test ok\n");
+    25ff:	58                   	pop    %eax
+    2600:	5a                   	pop    %edx
+    2601:	68 80 57 00 00       	push   $0x5780
+    2606:	6a 01                	push   $0x1
+    2608:	e8 03 23 00 00       	call   4910 <printf>
+}
+    260d:	83 c4 10             	add    $0x10,%esp
+    2610:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2613:	5b                   	pop    %ebx
+    2614:	5e                   	pop    %esi
+    2615:	5f                   	pop    %edi
+    2616:	5d                   	pop    %ebp
+    2617:	c3                   	ret
+      printf(1, "read bigfile wrong data\n");
+    2618:	83 ec 08             	sub    $0x8,%esp
+    261b:	68 4d 57 00 00       	push   $0x574d
+    2620:	6a 01                	push   $0x1
+    2622:	e8 e9 22 00 00       	call   4910 <printf>
+      exit();
+    2627:	e8 4d 1e 00 00       	call   4479 <exit>
+      printf(1, "short read bigfile\n");
+    262c:	83 ec 08             	sub    $0x8,%esp
+    262f:	68 39 57 00 00       	push   $0x5739
+    2634:	6a 01                	push   $0x1
+    2636:	e8 d5 22 00 00       	call   4910 <printf>
+      exit();
+    263b:	e8 39 1e 00 00       	call   4479 <exit>
+      printf(1, "read bigfile failed\n");
+    2640:	83 ec 08             	sub    $0x8,%esp
+    2643:	68 24 57 00 00       	push   $0x5724
+    2648:	6a 01                	push   $0x1
+    264a:	e8 c1 22 00 00       	call   4910 <printf>
+      exit();
+    264f:	e8 25 1e 00 00       	call   4479 <exit>
+      printf(1, "write bigfile failed\n");
+    2654:	83 ec 08             	sub    $0x8,%esp
+    2657:	68 f9 56 00 00       	push   $0x56f9
+    265c:	6a 01                	push   $0x1
+    265e:	e8 ad 22 00 00       	call   4910 <printf>
+      exit();
+    2663:	e8 11 1e 00 00       	call   4479 <exit>
+    printf(1, "cannot open bigfile\n");
+    2668:	53                   	push   %ebx
+    2669:	53                   	push   %ebx
+    266a:	68 0f 57 00 00       	push   $0x570f
+    266f:	6a 01                	push   $0x1
+    2671:	e8 9a 22 00 00       	call   4910 <printf>
+    exit();
+    2676:	e8 fe 1d 00 00       	call   4479 <exit>
+    printf(1, "cannot create bigfile");
+    267b:	50                   	push   %eax
+    267c:	50                   	push   %eax
+    267d:	68 e3 56 00 00       	push   $0x56e3
+    2682:	6a 01                	push   $0x1
+    2684:	e8 87 22 00 00       	call   4910 <printf>
+    exit();
+    2689:	e8 eb 1d 00 00       	call   4479 <exit>
+    printf(1, "read bigfile wrong total\n");
+    268e:	51                   	push   %ecx
+    268f:	51                   	push   %ecx
+    2690:	68 66 57 00 00       	push   $0x5766
+    2695:	6a 01                	push   $0x1
+    2697:	e8 74 22 00 00       	call   4910 <printf>
+    exit();
+    269c:	e8 d8 1d 00 00       	call   4479 <exit>
+    26a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    26a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    26af:	90                   	nop
+
+000026b0 <fourteen>:
+{
+    26b0:	55                   	push   %ebp
+    26b1:	89 e5                	mov    %esp,%ebp
+    26b3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "fourteen test\n");
+    26b6:	68 91 57 00 00       	push   $0x5791
+    26bb:	6a 01                	push   $0x1
+    26bd:	e8 4e 22 00 00       	call   4910 <printf>
+  if(mkdir("12345678901234") != 0){
+    26c2:	c7 04 24 cc 57 00 00 	movl   $0x57cc,(%esp)
+    26c9:	e8 24 1f 00 00       	call   45f2 <mkdir>
+    26ce:	83 c4 10             	add    $0x10,%esp
+    26d1:	85 c0                	test   %eax,%eax
+    26d3:	0f 85 97 00 00 00    	jne    2770 <fourteen+0xc0>
+  if(mkdir("12345678901234/123456789012345") != 0){
+    26d9:	83 ec 0c             	sub    $0xc,%esp
+    26dc:	68 04 62 00 00       	push   $0x6204
+    26e1:	e8 0c 1f 00 00       	call   45f2 <mkdir>
+    26e6:	83 c4 10             	add    $0x10,%esp
+    26e9:	85 c0                	test   %eax,%eax
+    26eb:	0f 85 de 00 00 00    	jne    27cf <fourteen+0x11f>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    26f1:	83 ec 08             	sub    $0x8,%esp
+    26f4:	68 00 02 00 00       	push   $0x200
+    26f9:	68 54 62 00 00       	push   $0x6254
+    26fe:	e8 5e 1e 00 00       	call   4561 <open>
+  if(fd < 0){
+    2703:	83 c4 10             	add    $0x10,%esp
+    2706:	85 c0                	test   %eax,%eax
+    2708:	0f 88 ae 00 00 00    	js     27bc <fourteen+0x10c>
+  close(fd);
+    270e:	83 ec 0c             	sub    $0xc,%esp
+    2711:	50                   	push   %eax
+    2712:	e8 f3 1d 00 00       	call   450a <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    2717:	58                   	pop    %eax
+    2718:	5a                   	pop    %edx
+    2719:	6a 00                	push   $0x0
+    271b:	68 c4 62 00 00       	push   $0x62c4
+    2720:	e8 3c 1e 00 00       	call   4561 <open>
+  if(fd < 0){
+    2725:	83 c4 10             	add    $0x10,%esp
+    2728:	85 c0                	test   %eax,%eax
+    272a:	78 7d                	js     27a9 <fourteen+0xf9>
+  close(fd);
+    272c:	83 ec 0c             	sub    $0xc,%esp
+    272f:	50                   	push   %eax
+    2730:	e8 d5 1d 00 00       	call   450a <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+    2735:	c7 04 24 bd 57 00 00 	movl   $0x57bd,(%esp)
+    273c:	e8 b1 1e 00 00       	call   45f2 <mkdir>
+    2741:	83 c4 10             	add    $0x10,%esp
+    2744:	85 c0                	test   %eax,%eax
+    2746:	74 4e                	je     2796 <fourteen+0xe6>
+  if(mkdir("123456789012345/12345678901234") == 0){
+    2748:	83 ec 0c             	sub    $0xc,%esp
+    274b:	68 60 63 00 00       	push   $0x6360
+    2750:	e8 9d 1e 00 00       	call   45f2 <mkdir>
+    2755:	83 c4 10             	add    $0x10,%esp
+    2758:	85 c0                	test   %eax,%eax
+    275a:	74 27                	je     2783 <fourteen+0xd3>
+  printf(1, "fourteen ok\n");
+    275c:	83 ec 08             	sub    $0x8,%esp
+    275f:	68 db 57 00 00       	push   $0x57db
+    2764:	6a 01                	push   $0x1
+    2766:	e8 a5 21 00 00       	call   4910 <printf>
+}
+    276b:	83 c4 10             	add    $0x10,%esp
+    276e:	c9                   	leave
+    276f:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    2770:	50                   	push   %eax
+    2771:	50                   	push   %eax
+    2772:	68 a0 57 00 00       	push   $0x57a0
+    2777:	6a 01                	push   $0x1
+    2779:	e8 92 21 00 00       	call   4910 <printf>
+    exit();
+    277e:	e8 f6 1c 00 00       	call   4479 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    2783:	50                   	push   %eax
+    2784:	50                   	push   %eax
+    2785:	68 80 63 00 00       	push   $0x6380
+    278a:	6a 01                	push   $0x1
+    278c:	e8 7f 21 00 00       	call   4910 <printf>
+    exit();
+    2791:	e8 e3 1c 00 00       	call   4479 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    2796:	52                   	push   %edx
+    2797:	52                   	push   %edx
+    2798:	68 30 63 00 00       	push   $0x6330
+    279d:	6a 01                	push   $0x1
+    279f:	e8 6c 21 00 00       	call   4910 <printf>
+    exit();
+    27a4:	e8 d0 1c 00 00       	call   4479 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    27a9:	51                   	push   %ecx
+    27aa:	51                   	push   %ecx
+    27ab:	68 f4 62 00 00       	push   $0x62f4
+    27b0:	6a 01                	push   $0x1
+    27b2:	e8 59 21 00 00       	call   4910 <printf>
+    exit();
+    27b7:	e8 bd 1c 00 00       	call   4479 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    27bc:	51                   	push   %ecx
+    27bd:	51                   	push   %ecx
+    27be:	68 84 62 00 00       	push   $0x6284
+    27c3:	6a 01                	push   $0x1
+    27c5:	e8 46 21 00 00       	call   4910 <printf>
+    exit();
+    27ca:	e8 aa 1c 00 00       	call   4479 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    27cf:	50                   	push   %eax
+    27d0:	50                   	push   %eax
+    27d1:	68 24 62 00 00       	push   $0x6224
+    27d6:	6a 01                	push   $0x1
+    27d8:	e8 33 21 00 00       	call   4910 <printf>
+    exit();
+    27dd:	e8 97 1c 00 00       	call   4479 <exit>
+    27e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    27e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000027f0 <rmdot>:
+{
+    27f0:	55                   	push   %ebp
+    27f1:	89 e5                	mov    %esp,%ebp
+    27f3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    27f6:	68 e8 57 00 00       	push   $0x57e8
+    27fb:	6a 01                	push   $0x1
+    27fd:	e8 0e 21 00 00       	call   4910 <printf>
+  if(mkdir("dots") != 0){
+    2802:	c7 04 24 f4 57 00 00 	movl   $0x57f4,(%esp)
+    2809:	e8 e4 1d 00 00       	call   45f2 <mkdir>
+    280e:	83 c4 10             	add    $0x10,%esp
+    2811:	85 c0                	test   %eax,%eax
+    2813:	0f 85 b0 00 00 00    	jne    28c9 <rmdot+0xd9>
+  if(chdir("dots") != 0){
+    2819:	83 ec 0c             	sub    $0xc,%esp
+    281c:	68 f4 57 00 00       	push   $0x57f4
+    2821:	e8 e9 1d 00 00       	call   460f <chdir>
+    2826:	83 c4 10             	add    $0x10,%esp
+    2829:	85 c0                	test   %eax,%eax
+    282b:	0f 85 1d 01 00 00    	jne    294e <rmdot+0x15e>
+  if(unlink(".") == 0){
+    2831:	83 ec 0c             	sub    $0xc,%esp
+    2834:	68 9f 54 00 00       	push   $0x549f
+    2839:	e8 5d 1d 00 00       	call   459b <unlink>
+    283e:	83 c4 10             	add    $0x10,%esp
+    2841:	85 c0                	test   %eax,%eax
+    2843:	0f 84 f2 00 00 00    	je     293b <rmdot+0x14b>
+  if(unlink("..") == 0){
+    2849:	83 ec 0c             	sub    $0xc,%esp
+    284c:	68 9e 54 00 00       	push   $0x549e
+    2851:	e8 45 1d 00 00       	call   459b <unlink>
+    2856:	83 c4 10             	add    $0x10,%esp
+    2859:	85 c0                	test   %eax,%eax
+    285b:	0f 84 c7 00 00 00    	je     2928 <rmdot+0x138>
+  if(chdir("/") != 0){
+    2861:	83 ec 0c             	sub    $0xc,%esp
+    2864:	68 81 4c 00 00       	push   $0x4c81
+    2869:	e8 a1 1d 00 00       	call   460f <chdir>
+    286e:	83 c4 10             	add    $0x10,%esp
+    2871:	85 c0                	test   %eax,%eax
+    2873:	0f 85 9c 00 00 00    	jne    2915 <rmdot+0x125>
+  if(unlink("dots/.") == 0){
+    2879:	83 ec 0c             	sub    $0xc,%esp
+    287c:	68 3c 58 00 00       	push   $0x583c
+    2881:	e8 15 1d 00 00       	call   459b <unlink>
+    2886:	83 c4 10             	add    $0x10,%esp
+    2889:	85 c0                	test   %eax,%eax
+    288b:	74 75                	je     2902 <rmdot+0x112>
+  if(unlink("dots/..") == 0){
+    288d:	83 ec 0c             	sub    $0xc,%esp
+    2890:	68 5a 58 00 00       	push   $0x585a
+    2895:	e8 01 1d 00 00       	call   459b <unlink>
+    289a:	83 c4 10             	add    $0x10,%esp
+    289d:	85 c0                	test   %eax,%eax
+    289f:	74 4e                	je     28ef <rmdot+0xff>
+  if(unlink("dots") != 0){
+    28a1:	83 ec 0c             	sub    $0xc,%esp
+    28a4:	68 f4 57 00 00       	push   $0x57f4
+    28a9:	e8 ed 1c 00 00       	call   459b <unlink>
+    28ae:	83 c4 10             	add    $0x10,%esp
+    28b1:	85 c0                	test   %eax,%eax
+    28b3:	75 27                	jne    28dc <rmdot+0xec>
+  printf(1, "rmdot ok\n");
+    28b5:	83 ec 08             	sub    $0x8,%esp
+    28b8:	68 8f 58 00 00       	push   $0x588f
+    28bd:	6a 01                	push   $0x1
+    28bf:	e8 4c 20 00 00       	call   4910 <printf>
+}
+    28c4:	83 c4 10             	add    $0x10,%esp
+    28c7:	c9                   	leave
+    28c8:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    28c9:	50                   	push   %eax
+    28ca:	50                   	push   %eax
+    28cb:	68 f9 57 00 00       	push   $0x57f9
+    28d0:	6a 01                	push   $0x1
+    28d2:	e8 39 20 00 00       	call   4910 <printf>
+    exit();
+    28d7:	e8 9d 1b 00 00       	call   4479 <exit>
+    printf(1, "unlink dots failed!\n");
+    28dc:	50                   	push   %eax
+    28dd:	50                   	push   %eax
+    28de:	68 7a 58 00 00       	push   $0x587a
+    28e3:	6a 01                	push   $0x1
+    28e5:	e8 26 20 00 00       	call   4910 <printf>
+    exit();
+    28ea:	e8 8a 1b 00 00       	call   4479 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    28ef:	52                   	push   %edx
+    28f0:	52                   	push   %edx
+    28f1:	68 62 58 00 00       	push   $0x5862
+    28f6:	6a 01                	push   $0x1
+    28f8:	e8 13 20 00 00       	call   4910 <printf>
+    exit();
+    28fd:	e8 77 1b 00 00       	call   4479 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    2902:	51                   	push   %ecx
+    2903:	51                   	push   %ecx
+    2904:	68 43 58 00 00       	push   $0x5843
+    2909:	6a 01                	push   $0x1
+    290b:	e8 00 20 00 00       	call   4910 <printf>
+    exit();
+    2910:	e8 64 1b 00 00       	call   4479 <exit>
+    printf(1, "chdir / failed\n");
+    2915:	50                   	push   %eax
+    2916:	50                   	push   %eax
+    2917:	68 83 4c 00 00       	push   $0x4c83
+    291c:	6a 01                	push   $0x1
+    291e:	e8 ed 1f 00 00       	call   4910 <printf>
+    exit();
+    2923:	e8 51 1b 00 00       	call   4479 <exit>
+    printf(1, "rm .. worked!\n");
+    2928:	50                   	push   %eax
+    2929:	50                   	push   %eax
+    292a:	68 2d 58 00 00       	push   $0x582d
+    292f:	6a 01                	push   $0x1
+    2931:	e8 da 1f 00 00       	call   4910 <printf>
+    exit();
+    2936:	e8 3e 1b 00 00       	call   4479 <exit>
+    printf(1, "rm . worked!\n");
+    293b:	50                   	push   %eax
+    293c:	50                   	push   %eax
+    293d:	68 1f 58 00 00       	push   $0x581f
+    2942:	6a 01                	push   $0x1
+    2944:	e8 c7 1f 00 00       	call   4910 <printf>
+    exit();
+    2949:	e8 2b 1b 00 00       	call   4479 <exit>
+    printf(1, "chdir dots failed\n");
+    294e:	50                   	push   %eax
+    294f:	50                   	push   %eax
+    2950:	68 0c 58 00 00       	push   $0x580c
+    2955:	6a 01                	push   $0x1
+    2957:	e8 b4 1f 00 00       	call   4910 <printf>
+    exit();
+    295c:	e8 18 1b 00 00       	call   4479 <exit>
+    2961:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2968:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    296f:	90                   	nop
+
+00002970 <dirfile>:
+{
+    2970:	55                   	push   %ebp
+    2971:	89 e5                	mov    %esp,%ebp
+    2973:	53                   	push   %ebx
+    2974:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dir vs file\n");
+    2977:	68 99 58 00 00       	push   $0x5899
+    297c:	6a 01                	push   $0x1
+    297e:	e8 8d 1f 00 00       	call   4910 <printf>
+  fd = open("dirfile", O_CREATE);
+    2983:	5b                   	pop    %ebx
+    2984:	58                   	pop    %eax
+    2985:	68 00 02 00 00       	push   $0x200
+    298a:	68 a6 58 00 00       	push   $0x58a6
+    298f:	e8 cd 1b 00 00       	call   4561 <open>
+  if(fd < 0){
+    2994:	83 c4 10             	add    $0x10,%esp
+    2997:	85 c0                	test   %eax,%eax
+    2999:	0f 88 43 01 00 00    	js     2ae2 <dirfile+0x172>
+  close(fd);
+    299f:	83 ec 0c             	sub    $0xc,%esp
+    29a2:	50                   	push   %eax
+    29a3:	e8 62 1b 00 00       	call   450a <close>
+  if(chdir("dirfile") == 0){
+    29a8:	c7 04 24 a6 58 00 00 	movl   $0x58a6,(%esp)
+    29af:	e8 5b 1c 00 00       	call   460f <chdir>
+    29b4:	83 c4 10             	add    $0x10,%esp
+    29b7:	85 c0                	test   %eax,%eax
+    29b9:	0f 84 10 01 00 00    	je     2acf <dirfile+0x15f>
+  fd = open("dirfile/xx", 0);
+    29bf:	83 ec 08             	sub    $0x8,%esp
+    29c2:	6a 00                	push   $0x0
+    29c4:	68 df 58 00 00       	push   $0x58df
+    29c9:	e8 93 1b 00 00       	call   4561 <open>
+  if(fd >= 0){
+    29ce:	83 c4 10             	add    $0x10,%esp
+    29d1:	85 c0                	test   %eax,%eax
+    29d3:	0f 89 e3 00 00 00    	jns    2abc <dirfile+0x14c>
+  fd = open("dirfile/xx", O_CREATE);
+    29d9:	83 ec 08             	sub    $0x8,%esp
+    29dc:	68 00 02 00 00       	push   $0x200
+    29e1:	68 df 58 00 00       	push   $0x58df
+    29e6:	e8 76 1b 00 00       	call   4561 <open>
+  if(fd >= 0){
+    29eb:	83 c4 10             	add    $0x10,%esp
+    29ee:	85 c0                	test   %eax,%eax
+    29f0:	0f 89 c6 00 00 00    	jns    2abc <dirfile+0x14c>
+  if(mkdir("dirfile/xx") == 0){
+    29f6:	83 ec 0c             	sub    $0xc,%esp
+    29f9:	68 df 58 00 00       	push   $0x58df
+    29fe:	e8 ef 1b 00 00       	call   45f2 <mkdir>
+    2a03:	83 c4 10             	add    $0x10,%esp
+    2a06:	85 c0                	test   %eax,%eax
+    2a08:	0f 84 46 01 00 00    	je     2b54 <dirfile+0x1e4>
+  if(unlink("dirfile/xx") == 0){
+    2a0e:	83 ec 0c             	sub    $0xc,%esp
+    2a11:	68 df 58 00 00       	push   $0x58df
+    2a16:	e8 80 1b 00 00       	call   459b <unlink>
+    2a1b:	83 c4 10             	add    $0x10,%esp
+    2a1e:	85 c0                	test   %eax,%eax
+    2a20:	0f 84 1b 01 00 00    	je     2b41 <dirfile+0x1d1>
+  if(link("README", "dirfile/xx") == 0){
+    2a26:	83 ec 08             	sub    $0x8,%esp
+    2a29:	68 df 58 00 00       	push   $0x58df
+    2a2e:	68 43 59 00 00       	push   $0x5943
+    2a33:	e8 9d 1b 00 00       	call   45d5 <link>
+    2a38:	83 c4 10             	add    $0x10,%esp
+    2a3b:	85 c0                	test   %eax,%eax
+    2a3d:	0f 84 eb 00 00 00    	je     2b2e <dirfile+0x1be>
+  if(unlink("dirfile") != 0){
+    2a43:	83 ec 0c             	sub    $0xc,%esp
+    2a46:	68 a6 58 00 00       	push   $0x58a6
+    2a4b:	e8 4b 1b 00 00       	call   459b <unlink>
+    2a50:	83 c4 10             	add    $0x10,%esp
+    2a53:	85 c0                	test   %eax,%eax
+    2a55:	0f 85 c0 00 00 00    	jne    2b1b <dirfile+0x1ab>
+  fd = open(".", O_RDWR);
+    2a5b:	83 ec 08             	sub    $0x8,%esp
+    2a5e:	6a 02                	push   $0x2
+    2a60:	68 9f 54 00 00       	push   $0x549f
+    2a65:	e8 f7 1a 00 00       	call   4561 <open>
+  if(fd >= 0){
+    2a6a:	83 c4 10             	add    $0x10,%esp
+    2a6d:	85 c0                	test   %eax,%eax
+    2a6f:	0f 89 93 00 00 00    	jns    2b08 <dirfile+0x198>
+  fd = open(".", 0);
+    2a75:	83 ec 08             	sub    $0x8,%esp
+    2a78:	6a 00                	push   $0x0
+    2a7a:	68 9f 54 00 00       	push   $0x549f
+    2a7f:	e8 dd 1a 00 00       	call   4561 <open>
+  if(write(fd, "x", 1) > 0){
+    2a84:	83 c4 0c             	add    $0xc,%esp
+    2a87:	6a 01                	push   $0x1
+  fd = open(".", 0);
+    2a89:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    2a8b:	68 82 55 00 00       	push   $0x5582
+    2a90:	50                   	push   %eax
+    2a91:	e8 57 1a 00 00       	call   44ed <write>
+    2a96:	83 c4 10             	add    $0x10,%esp
+    2a99:	85 c0                	test   %eax,%eax
+    2a9b:	7f 58                	jg     2af5 <dirfile+0x185>
+  close(fd);
+    2a9d:	83 ec 0c             	sub    $0xc,%esp
+    2aa0:	53                   	push   %ebx
+    2aa1:	e8 64 1a 00 00       	call   450a <close>
+  printf(1, "dir vs file OK\n");
+    2aa6:	58                   	pop    %eax
+    2aa7:	5a                   	pop    %edx
+    2aa8:	68 76 59 00 00       	push   $0x5976
+    2aad:	6a 01                	push   $0x1
+    2aaf:	e8 5c 1e 00 00       	call   4910 <printf>
+}
+    2ab4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2ab7:	83 c4 10             	add    $0x10,%esp
+    2aba:	c9                   	leave
+    2abb:	c3                   	ret
+    printf(1, "create dirfile/xx succeeded!\n");
+    2abc:	50                   	push   %eax
+    2abd:	50                   	push   %eax
+    2abe:	68 ea 58 00 00       	push   $0x58ea
+    2ac3:	6a 01                	push   $0x1
+    2ac5:	e8 46 1e 00 00       	call   4910 <printf>
+    exit();
+    2aca:	e8 aa 19 00 00       	call   4479 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    2acf:	52                   	push   %edx
+    2ad0:	52                   	push   %edx
+    2ad1:	68 c5 58 00 00       	push   $0x58c5
+    2ad6:	6a 01                	push   $0x1
+    2ad8:	e8 33 1e 00 00       	call   4910 <printf>
+    exit();
+    2add:	e8 97 19 00 00       	call   4479 <exit>
+    printf(1, "create dirfile failed\n");
+    2ae2:	51                   	push   %ecx
+    2ae3:	51                   	push   %ecx
+    2ae4:	68 ae 58 00 00       	push   $0x58ae
+    2ae9:	6a 01                	push   $0x1
+    2aeb:	e8 20 1e 00 00       	call   4910 <printf>
+    exit();
+    2af0:	e8 84 19 00 00       	call   4479 <exit>
+    printf(1, "write . succeeded!\n");
+    2af5:	51                   	push   %ecx
+    2af6:	51                   	push   %ecx
+    2af7:	68 62 59 00 00       	push   $0x5962
+    2afc:	6a 01                	push   $0x1
+    2afe:	e8 0d 1e 00 00       	call   4910 <printf>
+    exit();
+    2b03:	e8 71 19 00 00       	call   4479 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    2b08:	53                   	push   %ebx
+    2b09:	53                   	push   %ebx
+    2b0a:	68 d4 63 00 00       	push   $0x63d4
+    2b0f:	6a 01                	push   $0x1
+    2b11:	e8 fa 1d 00 00       	call   4910 <printf>
+    exit();
+    2b16:	e8 5e 19 00 00       	call   4479 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    2b1b:	50                   	push   %eax
+    2b1c:	50                   	push   %eax
+    2b1d:	68 4a 59 00 00       	push   $0x594a
+    2b22:	6a 01                	push   $0x1
+    2b24:	e8 e7 1d 00 00       	call   4910 <printf>
+    exit();
+    2b29:	e8 4b 19 00 00       	call   4479 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    2b2e:	50                   	push   %eax
+    2b2f:	50                   	push   %eax
+    2b30:	68 b4 63 00 00       	push   $0x63b4
+    2b35:	6a 01                	push   $0x1
+    2b37:	e8 d4 1d 00 00       	call   4910 <printf>
+    exit();
+    2b3c:	e8 38 19 00 00       	call   4479 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    2b41:	50                   	push   %eax
+    2b42:	50                   	push   %eax
+    2b43:	68 25 59 00 00       	push   $0x5925
+    2b48:	6a 01                	push   $0x1
+    2b4a:	e8 c1 1d 00 00       	call   4910 <printf>
+    exit();
+    2b4f:	e8 25 19 00 00       	call   4479 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    2b54:	50                   	push   %eax
+    2b55:	50                   	push   %eax
+    2b56:	68 08 59 00 00       	push   $0x5908
+    2b5b:	6a 01                	push   $0x1
+    2b5d:	e8 ae 1d 00 00       	call   4910 <printf>
+    exit();
+    2b62:	e8 12 19 00 00       	call   4479 <exit>
+    2b67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2b6e:	66 90                	xchg   %ax,%ax
+
+00002b70 <iref>:
+{
+    2b70:	55                   	push   %ebp
+    2b71:	89 e5                	mov    %esp,%ebp
+    2b73:	53                   	push   %ebx
+  printf(1, "empty file name\n");
+    2b74:	bb 33 00 00 00       	mov    $0x33,%ebx
+{
+    2b79:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    2b7c:	68 86 59 00 00       	push   $0x5986
+    2b81:	6a 01                	push   $0x1
+    2b83:	e8 88 1d 00 00       	call   4910 <printf>
+    2b88:	83 c4 10             	add    $0x10,%esp
+    2b8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2b8f:	90                   	nop
+    if(mkdir("irefd") != 0){
+    2b90:	83 ec 0c             	sub    $0xc,%esp
+    2b93:	68 97 59 00 00       	push   $0x5997
+    2b98:	e8 55 1a 00 00       	call   45f2 <mkdir>
+    2b9d:	83 c4 10             	add    $0x10,%esp
+    2ba0:	85 c0                	test   %eax,%eax
+    2ba2:	0f 85 bb 00 00 00    	jne    2c63 <iref+0xf3>
+    if(chdir("irefd") != 0){
+    2ba8:	83 ec 0c             	sub    $0xc,%esp
+    2bab:	68 97 59 00 00       	push   $0x5997
+    2bb0:	e8 5a 1a 00 00       	call   460f <chdir>
+    2bb5:	83 c4 10             	add    $0x10,%esp
+    2bb8:	85 c0                	test   %eax,%eax
+    2bba:	0f 85 b7 00 00 00    	jne    2c77 <iref+0x107>
+    mkdir("");
+    2bc0:	83 ec 0c             	sub    $0xc,%esp
+    2bc3:	68 4c 50 00 00       	push   $0x504c
+    2bc8:	e8 25 1a 00 00       	call   45f2 <mkdir>
+    link("README", "");
+    2bcd:	59                   	pop    %ecx
+    2bce:	58                   	pop    %eax
+    2bcf:	68 4c 50 00 00       	push   $0x504c
+    2bd4:	68 43 59 00 00       	push   $0x5943
+    2bd9:	e8 f7 19 00 00       	call   45d5 <link>
+    fd = open("", O_CREATE);
+    2bde:	58                   	pop    %eax
+    2bdf:	5a                   	pop    %edx
+    2be0:	68 00 02 00 00       	push   $0x200
+    2be5:	68 4c 50 00 00       	push   $0x504c
+    2bea:	e8 72 19 00 00       	call   4561 <open>
+    if(fd >= 0)
+    2bef:	83 c4 10             	add    $0x10,%esp
+    2bf2:	85 c0                	test   %eax,%eax
+    2bf4:	78 0c                	js     2c02 <iref+0x92>
+      close(fd);
+    2bf6:	83 ec 0c             	sub    $0xc,%esp
+    2bf9:	50                   	push   %eax
+    2bfa:	e8 0b 19 00 00       	call   450a <close>
+    2bff:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    2c02:	83 ec 08             	sub    $0x8,%esp
+    2c05:	68 00 02 00 00       	push   $0x200
+    2c0a:	68 81 55 00 00       	push   $0x5581
+    2c0f:	e8 4d 19 00 00       	call   4561 <open>
+    if(fd >= 0)
+    2c14:	83 c4 10             	add    $0x10,%esp
+    2c17:	85 c0                	test   %eax,%eax
+    2c19:	78 0c                	js     2c27 <iref+0xb7>
+      close(fd);
+    2c1b:	83 ec 0c             	sub    $0xc,%esp
+    2c1e:	50                   	push   %eax
+    2c1f:	e8 e6 18 00 00       	call   450a <close>
+    2c24:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    2c27:	83 ec 0c             	sub    $0xc,%esp
+    2c2a:	68 81 55 00 00       	push   $0x5581
+    2c2f:	e8 67 19 00 00       	call   459b <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    2c34:	83 c4 10             	add    $0x10,%esp
+    2c37:	83 eb 01             	sub    $0x1,%ebx
+    2c3a:	0f 85 50 ff ff ff    	jne    2b90 <iref+0x20>
+  chdir("/");
+    2c40:	83 ec 0c             	sub    $0xc,%esp
+    2c43:	68 81 4c 00 00       	push   $0x4c81
+    2c48:	e8 c2 19 00 00       	call   460f <chdir>
+  printf(1, "empty file name OK\n");
+    2c4d:	58                   	pop    %eax
+    2c4e:	5a                   	pop    %edx
+    2c4f:	68 c5 59 00 00       	push   $0x59c5
+    2c54:	6a 01                	push   $0x1
+    2c56:	e8 b5 1c 00 00       	call   4910 <printf>
+}
+    2c5b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2c5e:	83 c4 10             	add    $0x10,%esp
+    2c61:	c9                   	leave
+    2c62:	c3                   	ret
+      printf(1, "mkdir irefd failed\n");
+    2c63:	83 ec 08             	sub    $0x8,%esp
+    2c66:	68 9d 59 00 00       	push   $0x599d
+    2c6b:	6a 01                	push   $0x1
+    2c6d:	e8 9e 1c 00 00       	call   4910 <printf>
+      exit();
+    2c72:	e8 02 18 00 00       	call   4479 <exit>
+      printf(1, "chdir irefd failed\n");
+    2c77:	83 ec 08             	sub    $0x8,%esp
+    2c7a:	68 b1 59 00 00       	push   $0x59b1
+    2c7f:	6a 01                	push   $0x1
+    2c81:	e8 8a 1c 00 00       	call   4910 <printf>
+      exit();
+    2c86:	e8 ee 17 00 00       	call   4479 <exit>
+    2c8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2c8f:	90                   	nop
+
+00002c90 <forktest>:
+{
+    2c90:	55                   	push   %ebp
+    2c91:	89 e5                	mov    %esp,%ebp
+    2c93:	53                   	push   %ebx
+  for(n=0; n<NPROC+100; n++){
+    2c94:	31 db                	xor    %ebx,%ebx
+{
+    2c96:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+    2c99:	68 d9 59 00 00       	push   $0x59d9
+    2c9e:	6a 01                	push   $0x1
+    2ca0:	e8 6b 1c 00 00       	call   4910 <printf>
+    2ca5:	83 c4 10             	add    $0x10,%esp
+    2ca8:	eb 13                	jmp    2cbd <forktest+0x2d>
+    2caa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+    2cb0:	74 4d                	je     2cff <forktest+0x6f>
+  for(n=0; n<NPROC+100; n++){
+    2cb2:	83 c3 01             	add    $0x1,%ebx
+    2cb5:	81 fb 64 10 00 00    	cmp    $0x1064,%ebx
+    2cbb:	74 6e                	je     2d2b <forktest+0x9b>
+    pid = fork();
+    2cbd:	e8 9a 17 00 00       	call   445c <fork>
+    if(pid < 0)
+    2cc2:	85 c0                	test   %eax,%eax
+    2cc4:	79 ea                	jns    2cb0 <forktest+0x20>
+  for(; n > 0; n--){
+    2cc6:	85 db                	test   %ebx,%ebx
+    2cc8:	74 14                	je     2cde <forktest+0x4e>
+    2cca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(wait() < 0){
+    2cd0:	e8 c1 17 00 00       	call   4496 <wait>
+    2cd5:	85 c0                	test   %eax,%eax
+    2cd7:	78 2b                	js     2d04 <forktest+0x74>
+  for(; n > 0; n--){
+    2cd9:	83 eb 01             	sub    $0x1,%ebx
+    2cdc:	75 f2                	jne    2cd0 <forktest+0x40>
+  if(wait() != -1){
+    2cde:	e8 b3 17 00 00       	call   4496 <wait>
+    2ce3:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2ce6:	75 30                	jne    2d18 <forktest+0x88>
+  printf(1, "fork test OK\n");
+    2ce8:	83 ec 08             	sub    $0x8,%esp
+    2ceb:	68 0b 5a 00 00       	push   $0x5a0b
+    2cf0:	6a 01                	push   $0x1
+    2cf2:	e8 19 1c 00 00       	call   4910 <printf>
+}
+    2cf7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2cfa:	83 c4 10             	add    $0x10,%esp
+    2cfd:	c9                   	leave
+    2cfe:	c3                   	ret
+      exit();
+    2cff:	e8 75 17 00 00       	call   4479 <exit>
+      printf(1, "wait stopped early\n");
+    2d04:	83 ec 08             	sub    $0x8,%esp
+    2d07:	68 e4 59 00 00       	push   $0x59e4
+    2d0c:	6a 01                	push   $0x1
+    2d0e:	e8 fd 1b 00 00       	call   4910 <printf>
+      exit();
+    2d13:	e8 61 17 00 00       	call   4479 <exit>
+    printf(1, "wait got too many\n");
+    2d18:	50                   	push   %eax
+    2d19:	50                   	push   %eax
+    2d1a:	68 f8 59 00 00       	push   $0x59f8
+    2d1f:	6a 01                	push   $0x1
+    2d21:	e8 ea 1b 00 00       	call   4910 <printf>
+    exit();
+    2d26:	e8 4e 17 00 00       	call   4479 <exit>
+    printf(1, "fork claimed to work %d times!\n", n);
+    2d2b:	52                   	push   %edx
+    2d2c:	68 64 10 00 00       	push   $0x1064
+    2d31:	68 f4 63 00 00       	push   $0x63f4
+    2d36:	6a 01                	push   $0x1
+    2d38:	e8 d3 1b 00 00       	call   4910 <printf>
+    exit();
+    2d3d:	e8 37 17 00 00       	call   4479 <exit>
+    2d42:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2d49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002d50 <affinitytest>:
+{
+    2d50:	55                   	push   %ebp
+    2d51:	89 e5                	mov    %esp,%ebp
+    2d53:	57                   	push   %edi
+    2d54:	56                   	push   %esi
+    2d55:	53                   	push   %ebx
+    2d56:	83 ec 24             	sub    $0x24,%esp
+  printf(stdout, "affinity test\n");
+    2d59:	68 19 5a 00 00       	push   $0x5a19
+    2d5e:	ff 35 98 72 00 00    	push   0x7298
+    2d64:	e8 a7 1b 00 00       	call   4910 <printf>
+  mask = getaffinity(0);
+    2d69:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2d70:	e8 9f 19 00 00       	call   4714 <getaffinity>
+  if(mask <= 0){
+    2d75:	83 c4 10             	add    $0x10,%esp
+    2d78:	85 c0                	test   %eax,%eax
+    2d7a:	0f 8e f7 01 00 00    	jle    2f77 <affinitytest+0x227>
+  if(setaffinity(0, 0) != -1){
+    2d80:	83 ec 08             	sub    $0x8,%esp
+    2d83:	89 c3                	mov    %eax,%ebx
+    2d85:	6a 00                	push   $0x0
+    2d87:	6a 00                	push   $0x0
+    2d89:	e8 69 19 00 00       	call   46f7 <setaffinity>
+    2d8e:	83 c4 10             	add    $0x10,%esp
+    2d91:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2d94:	0f 85 c6 01 00 00    	jne    2f60 <affinitytest+0x210>
+  if(setaffinity(0, 1) < 0 || getaffinity(0) != 1){
+    2d9a:	83 ec 08             	sub    $0x8,%esp
+    2d9d:	6a 01                	push   $0x1
+    2d9f:	6a 00                	push   $0x0
+    2da1:	e8 51 19 00 00       	call   46f7 <setaffinity>
+    2da6:	83 c4 10             	add    $0x10,%esp
+    2da9:	85 c0                	test   %eax,%eax
+    2dab:	0f 88 98 01 00 00    	js     2f49 <affinitytest+0x1f9>
+    2db1:	83 ec 0c             	sub    $0xc,%esp
+    2db4:	6a 00                	push   $0x0
+    2db6:	e8 59 19 00 00       	call   4714 <getaffinity>
+    2dbb:	83 c4 10             	add    $0x10,%esp
+    2dbe:	83 f8 01             	cmp    $0x1,%eax
+    2dc1:	0f 85 82 01 00 00    	jne    2f49 <affinitytest+0x1f9>
+  if(setaffinity(0, mask) < 0 || getaffinity(0) != mask){
+    2dc7:	83 ec 08             	sub    $0x8,%esp
+    2dca:	53                   	push   %ebx
+    2dcb:	6a 00                	push   $0x0
+    2dcd:	e8 25 19 00 00       	call   46f7 <setaffinity>
+    2dd2:	83 c4 10             	add    $0x10,%esp
+    2dd5:	85 c0                	test   %eax,%eax
+    2dd7:	0f 88 55 01 00 00    	js     2f32 <affinitytest+0x1e2>
+    2ddd:	83 ec 0c             	sub    $0xc,%esp
+    2de0:	6a 00                	push   $0x0
+    2de2:	e8 2d 19 00 00       	call   4714 <getaffinity>
+    2de7:	83 c4 10             	add    $0x10,%esp
+    2dea:	39 d8                	cmp    %ebx,%eax
+    2dec:	0f 85 40 01 00 00    	jne    2f32 <affinitytest+0x1e2>
+  if((mask & 3) == 3){
+    2df2:	83 e0 03             	and    $0x3,%eax
+    2df5:	83 f8 03             	cmp    $0x3,%eax
+    2df8:	74 1e                	je     2e18 <affinitytest+0xc8>
+  printf(stdout, "affinity test OK\n");
+    2dfa:	83 ec 08             	sub    $0x8,%esp
+    2dfd:	68 81 5a 00 00       	push   $0x5a81
+    2e02:	ff 35 98 72 00 00    	push   0x7298
+    2e08:	e8 03 1b 00 00       	call   4910 <printf>
+}
+    2e0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2e10:	5b                   	pop    %ebx
+    2e11:	5e                   	pop    %esi
+    2e12:	5f                   	pop    %edi
+    2e13:	5d                   	pop    %ebp
+    2e14:	c3                   	ret
+    2e15:	8d 76 00             	lea    0x0(%esi),%esi
+    spin = fork();
+    2e18:	e8 3f 16 00 00       	call   445c <fork>
+    2e1d:	89 c7                	mov    %eax,%edi
+    if(spin == 0){
+    2e1f:	85 c0                	test   %eax,%eax
+    2e21:	0f 84 c0 00 00 00    	je     2ee7 <affinitytest+0x197>
+    pipe(fds);
+    2e27:	83 ec 0c             	sub    $0xc,%esp
+    2e2a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    2e2d:	50                   	push   %eax
+    2e2e:	e8 80 16 00 00       	call   44b3 <pipe>
+    pid = fork();
+    2e33:	e8 24 16 00 00       	call   445c <fork>
+    if(pid == 0){
+    2e38:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    2e3b:	89 c3                	mov    %eax,%ebx
+    if(pid == 0){
+    2e3d:	85 c0                	test   %eax,%eax
+    2e3f:	0f 84 b3 00 00 00    	je     2ef8 <affinitytest+0x1a8>
+    sleep(2);  // let the child run on cpu0 and block
+    2e45:	83 ec 0c             	sub    $0xc,%esp
+    write(fds[1], "x", 1);
+    2e48:	be 64 00 00 00       	mov    $0x64,%esi
+    sleep(2);  // let the child run on cpu0 and block
+    2e4d:	6a 02                	push   $0x2
+    2e4f:	e8 2f 18 00 00       	call   4683 <sleep>
+    setaffinity(pid, 2);
+    2e54:	58                   	pop    %eax
+    2e55:	5a                   	pop    %edx
+    2e56:	6a 02                	push   $0x2
+    2e58:	53                   	push   %ebx
+    2e59:	e8 99 18 00 00       	call   46f7 <setaffinity>
+    write(fds[1], "x", 1);
+    2e5e:	83 c4 0c             	add    $0xc,%esp
+    2e61:	6a 01                	push   $0x1
+    2e63:	68 82 55 00 00       	push   $0x5582
+    2e68:	ff 75 e4             	push   -0x1c(%ebp)
+    2e6b:	e8 7d 16 00 00       	call   44ed <write>
+    2e70:	83 c4 10             	add    $0x10,%esp
+    2e73:	eb 19                	jmp    2e8e <affinitytest+0x13e>
+    2e75:	8d 76 00             	lea    0x0(%esi),%esi
+      sleep(1);
+    2e78:	83 ec 0c             	sub    $0xc,%esp
+    2e7b:	6a 01                	push   $0x1
+    2e7d:	e8 01 18 00 00       	call   4683 <sleep>
+    for(i = 0; i < 100 && (fd = open("affinity.ran", 0)) < 0; i++)
+    2e82:	83 c4 10             	add    $0x10,%esp
+    2e85:	83 ee 01             	sub    $0x1,%esi
+    2e88:	0f 84 00 01 00 00    	je     2f8e <affinitytest+0x23e>
+    2e8e:	83 ec 08             	sub    $0x8,%esp
+    2e91:	6a 00                	push   $0x0
+    2e93:	68 74 5a 00 00       	push   $0x5a74
+    2e98:	e8 c4 16 00 00       	call   4561 <open>
+    2e9d:	83 c4 10             	add    $0x10,%esp
+    2ea0:	89 c3                	mov    %eax,%ebx
+    2ea2:	85 c0                	test   %eax,%eax
+    2ea4:	78 d2                	js     2e78 <affinitytest+0x128>
+    kill(spin);
+    2ea6:	83 ec 0c             	sub    $0xc,%esp
+    2ea9:	57                   	push   %edi
+    2eaa:	e8 78 16 00 00       	call   4527 <kill>
+    wait();
+    2eaf:	e8 e2 15 00 00       	call   4496 <wait>
+    wait();
+    2eb4:	e8 dd 15 00 00       	call   4496 <wait>
+    close(fds[0]);
+    2eb9:	58                   	pop    %eax
+    2eba:	ff 75 e0             	push   -0x20(%ebp)
+    2ebd:	e8 48 16 00 00       	call   450a <close>
+    close(fds[1]);
+    2ec2:	5a                   	pop    %edx
+    2ec3:	ff 75 e4             	push   -0x1c(%ebp)
+    2ec6:	e8 3f 16 00 00       	call   450a <close>
+    close(fd);
+    2ecb:	89 1c 24             	mov    %ebx,(%esp)
+    2ece:	e8 37 16 00 00       	call   450a <close>
+    unlink("affinity.ran");
+    2ed3:	c7 04 24 74 5a 00 00 	movl   $0x5a74,(%esp)
+    2eda:	e8 bc 16 00 00       	call   459b <unlink>
+    2edf:	83 c4 10             	add    $0x10,%esp
+    2ee2:	e9 13 ff ff ff       	jmp    2dfa <affinitytest+0xaa>
+      setaffinity(0, 2);
+    2ee7:	83 ec 08             	sub    $0x8,%esp
+    2eea:	6a 02                	push   $0x2
+    2eec:	6a 00                	push   $0x0
+    2eee:	e8 04 18 00 00       	call   46f7 <setaffinity>
+    2ef3:	83 c4 10             	add    $0x10,%esp
+      for(;;)
+    2ef6:	eb fe                	jmp    2ef6 <affinitytest+0x1a6>
+      setaffinity(0, 1);
+    2ef8:	51                   	push   %ecx
+    2ef9:	51                   	push   %ecx
+    2efa:	6a 01                	push   $0x1
+    2efc:	6a 00                	push   $0x0
+    2efe:	e8 f4 17 00 00       	call   46f7 <setaffinity>
+      read(fds[0], &c, 1);
+    2f03:	83 c4 0c             	add    $0xc,%esp
+    2f06:	8d 45 df             	lea    -0x21(%ebp),%eax
+    2f09:	6a 01                	push   $0x1
+    2f0b:	50                   	push   %eax
+    2f0c:	ff 75 e0             	push   -0x20(%ebp)
+    2f0f:	e8 bc 15 00 00       	call   44d0 <read>
+      close(open("affinity.ran", O_CREATE));
+    2f14:	5b                   	pop    %ebx
+    2f15:	5e                   	pop    %esi
+    2f16:	68 00 02 00 00       	push   $0x200
+    2f1b:	68 74 5a 00 00       	push   $0x5a74
+    2f20:	e8 3c 16 00 00       	call   4561 <open>
+    2f25:	89 04 24             	mov    %eax,(%esp)
+    2f28:	e8 dd 15 00 00       	call   450a <close>
+      exit();
+    2f2d:	e8 47 15 00 00       	call   4479 <exit>
+    printf(stdout, "setaffinity restore failed\n");
+    2f32:	57                   	push   %edi
+    2f33:	57                   	push   %edi
+    2f34:	68 58 5a 00 00       	push   $0x5a58
+    2f39:	ff 35 98 72 00 00    	push   0x7298
+    2f3f:	e8 cc 19 00 00       	call   4910 <printf>
+    exit();
+    2f44:	e8 30 15 00 00       	call   4479 <exit>
+    printf(stdout, "setaffinity to cpu0 failed\n");
+    2f49:	50                   	push   %eax
+    2f4a:	50                   	push   %eax
+    2f4b:	68 3c 5a 00 00       	push   $0x5a3c
+    2f50:	ff 35 98 72 00 00    	push   0x7298
+    2f56:	e8 b5 19 00 00       	call   4910 <printf>
+    exit();
+    2f5b:	e8 19 15 00 00       	call   4479 <exit>
+    printf(stdout, "setaffinity accepted an empty mask\n");
+    2f60:	50                   	push   %eax
+    2f61:	50                   	push   %eax
+    2f62:	68 14 64 00 00       	push   $0x6414
+    2f67:	ff 35 98 72 00 00    	push   0x7298
+    2f6d:	e8 9e 19 00 00       	call   4910 <printf>
+    exit();
+    2f72:	e8 02 15 00 00       	call   4479 <exit>
+    printf(stdout, "getaffinity failed\n");
+    2f77:	50                   	push   %eax
+    2f78:	50                   	push   %eax
+    2f79:	68 28 5a 00 00       	push   $0x5a28
+    2f7e:	ff 35 98 72 00 00    	push   0x7298
+    2f84:	e8 87 19 00 00       	call   4910 <printf>
+    exit();
+    2f89:	e8 eb 14 00 00       	call   4479 <exit>
+    kill(spin);
+    2f8e:	83 ec 0c             	sub    $0xc,%esp
+    2f91:	57                   	push   %edi
+    2f92:	e8 90 15 00 00       	call   4527 <kill>
+    wait();
+    2f97:	e8 fa 14 00 00       	call   4496 <wait>
+    wait();
+    2f9c:	e8 f5 14 00 00       	call   4496 <wait>
+    close(fds[0]);
+    2fa1:	59                   	pop    %ecx
+    2fa2:	ff 75 e0             	push   -0x20(%ebp)
+    2fa5:	e8 60 15 00 00       	call   450a <close>
+    close(fds[1]);
+    2faa:	5b                   	pop    %ebx
+    2fab:	ff 75 e4             	push   -0x1c(%ebp)
+    2fae:	e8 57 15 00 00       	call   450a <close>
+      printf(stdout, "pinned child starved\n");
+    2fb3:	5e                   	pop    %esi
+    2fb4:	5f                   	pop    %edi
+    2fb5:	68 93 5a 00 00       	push   $0x5a93
+    2fba:	ff 35 98 72 00 00    	push   0x7298
+    2fc0:	e8 4b 19 00 00       	call   4910 <printf>
+      exit();
+    2fc5:	e8 af 14 00 00       	call   4479 <exit>
+    2fca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00002fd0 <nanosleeptest>:
+{
+    2fd0:	55                   	push   %ebp
+    2fd1:	89 e5                	mov    %esp,%ebp
+    2fd3:	57                   	push   %edi
+    2fd4:	56                   	push   %esi
+  if(nanosleep(&ts) != -1){
+    2fd5:	8d 75 e0             	lea    -0x20(%ebp),%esi
+{
+    2fd8:	53                   	push   %ebx
+    2fd9:	83 ec 24             	sub    $0x24,%esp
+  printf(stdout, "nanosleep test\n");
+    2fdc:	68 a9 5a 00 00       	push   $0x5aa9
+    2fe1:	ff 35 98 72 00 00    	push   0x7298
+    2fe7:	e8 24 19 00 00       	call   4910 <printf>
+  ts.sec = 0;
+    2fec:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  ts.nsec = 1000000000;
+    2ff3:	c7 45 e4 00 ca 9a 3b 	movl   $0x3b9aca00,-0x1c(%ebp)
+  if(nanosleep(&ts) != -1){
+    2ffa:	89 34 24             	mov    %esi,(%esp)
+    2ffd:	e8 2f 17 00 00       	call   4731 <nanosleep>
+    3002:	83 c4 10             	add    $0x10,%esp
+    3005:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3008:	0f 85 a6 00 00 00    	jne    30b4 <nanosleeptest+0xe4>
+  t0 = uptime();
+    300e:	e8 8d 16 00 00       	call   46a0 <uptime>
+  ts.nsec = 1000000;
+    3013:	c7 45 e4 40 42 0f 00 	movl   $0xf4240,-0x1c(%ebp)
+    301a:	bb 32 00 00 00       	mov    $0x32,%ebx
+  t0 = uptime();
+    301f:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < 50; i++){
+    3021:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(nanosleep(&ts) < 0){
+    3028:	83 ec 0c             	sub    $0xc,%esp
+    302b:	56                   	push   %esi
+    302c:	e8 00 17 00 00       	call   4731 <nanosleep>
+    3031:	83 c4 10             	add    $0x10,%esp
+    3034:	85 c0                	test   %eax,%eax
+    3036:	78 64                	js     309c <nanosleeptest+0xcc>
+  for(i = 0; i < 50; i++){
+    3038:	83 eb 01             	sub    $0x1,%ebx
+    303b:	75 eb                	jne    3028 <nanosleeptest+0x58>
+  t1 = uptime();
+    303d:	e8 5e 16 00 00       	call   46a0 <uptime>
+  if(t1 - t0 < 4){
+    3042:	29 f8                	sub    %edi,%eax
+    3044:	83 f8 03             	cmp    $0x3,%eax
+    3047:	0f 8e 95 00 00 00    	jle    30e2 <nanosleeptest+0x112>
+  ts.sec = 0;
+    304d:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  ts.nsec = 200000000;
+    3054:	c7 45 e4 00 c2 eb 0b 	movl   $0xbebc200,-0x1c(%ebp)
+  t0 = uptime();
+    305b:	e8 40 16 00 00       	call   46a0 <uptime>
+  if(nanosleep(&ts) < 0 || uptime() - t0 < 20){
+    3060:	83 ec 0c             	sub    $0xc,%esp
+    3063:	56                   	push   %esi
+  t0 = uptime();
+    3064:	89 c3                	mov    %eax,%ebx
+  if(nanosleep(&ts) < 0 || uptime() - t0 < 20){
+    3066:	e8 c6 16 00 00       	call   4731 <nanosleep>
+    306b:	83 c4 10             	add    $0x10,%esp
+    306e:	85 c0                	test   %eax,%eax
+    3070:	78 59                	js     30cb <nanosleeptest+0xfb>
+    3072:	e8 29 16 00 00       	call   46a0 <uptime>
+    3077:	29 d8                	sub    %ebx,%eax
+    3079:	83 f8 13             	cmp    $0x13,%eax
+    307c:	7e 4d                	jle    30cb <nanosleeptest+0xfb>
+  printf(stdout, "nanosleep test OK\n");
+    307e:	83 ec 08             	sub    $0x8,%esp
+    3081:	68 ea 5a 00 00       	push   $0x5aea
+    3086:	ff 35 98 72 00 00    	push   0x7298
+    308c:	e8 7f 18 00 00       	call   4910 <printf>
+}
+    3091:	83 c4 10             	add    $0x10,%esp
+    3094:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3097:	5b                   	pop    %ebx
+    3098:	5e                   	pop    %esi
+    3099:	5f                   	pop    %edi
+    309a:	5d                   	pop    %ebp
+    309b:	c3                   	ret
+      printf(stdout, "nanosleep 1ms failed\n");
+    309c:	83 ec 08             	sub    $0x8,%esp
+    309f:	68 b9 5a 00 00       	push   $0x5ab9
+    30a4:	ff 35 98 72 00 00    	push   0x7298
+    30aa:	e8 61 18 00 00       	call   4910 <printf>
+      exit();
+    30af:	e8 c5 13 00 00       	call   4479 <exit>
+    printf(stdout, "nanosleep accepted nsec >= 1s\n");
+    30b4:	51                   	push   %ecx
+    30b5:	51                   	push   %ecx
+    30b6:	68 38 64 00 00       	push   $0x6438
+    30bb:	ff 35 98 72 00 00    	push   0x7298
+    30c1:	e8 4a 18 00 00       	call   4910 <printf>
+    exit();
+    30c6:	e8 ae 13 00 00       	call   4479 <exit>
+    printf(stdout, "nanosleep 200ms too short\n");
+    30cb:	50                   	push   %eax
+    30cc:	50                   	push   %eax
+    30cd:	68 cf 5a 00 00       	push   $0x5acf
+    30d2:	ff 35 98 72 00 00    	push   0x7298
+    30d8:	e8 33 18 00 00       	call   4910 <printf>
+    exit();
+    30dd:	e8 97 13 00 00       	call   4479 <exit>
+    printf(stdout, "50 x 1ms nanosleep took %d ticks\n", t1 - t0);
+    30e2:	52                   	push   %edx
+    30e3:	50                   	push   %eax
+    30e4:	68 58 64 00 00       	push   $0x6458
+    30e9:	ff 35 98 72 00 00    	push   0x7298
+    30ef:	e8 1c 18 00 00       	call   4910 <printf>
+    exit();
+    30f4:	e8 80 13 00 00       	call   4479 <exit>
+    30f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003100 <clocktest>:
+{
+    3100:	55                   	push   %ebp
+    3101:	89 e5                	mov    %esp,%ebp
+    3103:	57                   	push   %edi
+    3104:	56                   	push   %esi
+  if(clocktime(&a) < 0 || clocktime(&b) < 0){
+    3105:	8d 7d d8             	lea    -0x28(%ebp),%edi
+{
+    3108:	53                   	push   %ebx
+    3109:	83 ec 34             	sub    $0x34,%esp
+  printf(stdout, "clock test\n");
+    310c:	68 fd 5a 00 00       	push   $0x5afd
+    3111:	ff 35 98 72 00 00    	push   0x7298
+    3117:	e8 f4 17 00 00       	call   4910 <printf>
+  t0 = uptime();
+    311c:	e8 7f 15 00 00       	call   46a0 <uptime>
+  if(clocktime(&a) < 0 || clocktime(&b) < 0){
+    3121:	89 3c 24             	mov    %edi,(%esp)
+  t0 = uptime();
+    3124:	89 c3                	mov    %eax,%ebx
+  if(clocktime(&a) < 0 || clocktime(&b) < 0){
+    3126:	e8 23 16 00 00       	call   474e <clocktime>
+    312b:	83 c4 10             	add    $0x10,%esp
+    312e:	85 c0                	test   %eax,%eax
+    3130:	0f 88 1a 01 00 00    	js     3250 <clocktest+0x150>
+    3136:	83 ec 0c             	sub    $0xc,%esp
+    3139:	8d 75 e0             	lea    -0x20(%ebp),%esi
+    313c:	56                   	push   %esi
+    313d:	e8 0c 16 00 00       	call   474e <clocktime>
+    3142:	83 c4 10             	add    $0x10,%esp
+    3145:	85 c0                	test   %eax,%eax
+    3147:	0f 88 03 01 00 00    	js     3250 <clocktest+0x150>
+  if(b.sec < a.sec || (b.sec == a.sec && b.nsec < a.nsec) || a.nsec >= 1000000000){
+    314d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    3150:	39 45 e0             	cmp    %eax,-0x20(%ebp)
+    3153:	0f 82 e0 00 00 00    	jb     3239 <clocktest+0x139>
+    3159:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    315c:	0f 84 ce 00 00 00    	je     3230 <clocktest+0x130>
+    3162:	3d ff c9 9a 3b       	cmp    $0x3b9ac9ff,%eax
+    3167:	0f 87 cc 00 00 00    	ja     3239 <clocktest+0x139>
+  sleep(20);
+    316d:	83 ec 0c             	sub    $0xc,%esp
+    3170:	6a 14                	push   $0x14
+    3172:	e8 0c 15 00 00       	call   4683 <sleep>
+  clocktime(&b);
+    3177:	89 34 24             	mov    %esi,(%esp)
+    317a:	e8 cf 15 00 00       	call   474e <clocktime>
+  ms = (b.sec - a.sec)*1000 + (int)(b.nsec/1000000) - (int)(a.nsec/1000000);
+    317f:	b9 83 de 1b 43       	mov    $0x431bde83,%ecx
+  if(ms < 150 || ms > 20*(uptime() - t0 + 5)){
+    3184:	83 c4 10             	add    $0x10,%esp
+  ms = (b.sec - a.sec)*1000 + (int)(b.nsec/1000000) - (int)(a.nsec/1000000);
+    3187:	89 c8                	mov    %ecx,%eax
+    3189:	f7 65 e4             	mull   -0x1c(%ebp)
+    318c:	89 c8                	mov    %ecx,%eax
+    318e:	c1 ea 12             	shr    $0x12,%edx
+    3191:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    3194:	f7 65 dc             	mull   -0x24(%ebp)
+    3197:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    319a:	c1 ea 12             	shr    $0x12,%edx
+    319d:	29 d0                	sub    %edx,%eax
+    319f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+    31a2:	2b 55 d8             	sub    -0x28(%ebp),%edx
+    31a5:	69 d2 e8 03 00 00    	imul   $0x3e8,%edx,%edx
+    31ab:	01 c2                	add    %eax,%edx
+  if(ms < 150 || ms > 20*(uptime() - t0 + 5)){
+    31ad:	81 fa 95 00 00 00    	cmp    $0x95,%edx
+    31b3:	0f 8e ae 00 00 00    	jle    3267 <clocktest+0x167>
+    31b9:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    31bc:	e8 df 14 00 00       	call   46a0 <uptime>
+    31c1:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    31c4:	29 d8                	sub    %ebx,%eax
+    31c6:	8d 44 80 19          	lea    0x19(%eax,%eax,4),%eax
+    31ca:	c1 e0 02             	shl    $0x2,%eax
+    31cd:	39 d0                	cmp    %edx,%eax
+    31cf:	0f 8c 92 00 00 00    	jl     3267 <clocktest+0x167>
+  if(ugetpid() != getpid()){
+    31d5:	e8 e6 11 00 00       	call   43c0 <ugetpid>
+    31da:	89 c3                	mov    %eax,%ebx
+    31dc:	e8 68 14 00 00       	call   4649 <getpid>
+    31e1:	39 c3                	cmp    %eax,%ebx
+    31e3:	0f 85 ac 00 00 00    	jne    3295 <clocktest+0x195>
+  uclocktime(&a);
+    31e9:	83 ec 0c             	sub    $0xc,%esp
+    31ec:	57                   	push   %edi
+    31ed:	e8 de 11 00 00       	call   43d0 <uclocktime>
+  clocktime(&b);
+    31f2:	89 34 24             	mov    %esi,(%esp)
+    31f5:	e8 54 15 00 00       	call   474e <clocktime>
+  if(b.sec < a.sec || (b.sec == a.sec && b.nsec < a.nsec)){
+    31fa:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    31fd:	83 c4 10             	add    $0x10,%esp
+    3200:	39 45 e0             	cmp    %eax,-0x20(%ebp)
+    3203:	72 79                	jb     327e <clocktest+0x17e>
+    3205:	75 08                	jne    320f <clocktest+0x10f>
+    3207:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    320a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    320d:	72 6f                	jb     327e <clocktest+0x17e>
+  printf(stdout, "clock test OK\n");
+    320f:	83 ec 08             	sub    $0x8,%esp
+    3212:	68 4a 5b 00 00       	push   $0x5b4a
+    3217:	ff 35 98 72 00 00    	push   0x7298
+    321d:	e8 ee 16 00 00       	call   4910 <printf>
+}
+    3222:	83 c4 10             	add    $0x10,%esp
+    3225:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3228:	5b                   	pop    %ebx
+    3229:	5e                   	pop    %esi
+    322a:	5f                   	pop    %edi
+    322b:	5d                   	pop    %ebp
+    322c:	c3                   	ret
+    322d:	8d 76 00             	lea    0x0(%esi),%esi
+  if(b.sec < a.sec || (b.sec == a.sec && b.nsec < a.nsec) || a.nsec >= 1000000000){
+    3230:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    3233:	0f 83 29 ff ff ff    	jae    3162 <clocktest+0x62>
+    printf(stdout, "clock went backwards\n");
+    3239:	53                   	push   %ebx
+    323a:	53                   	push   %ebx
+    323b:	68 1b 5b 00 00       	push   $0x5b1b
+    3240:	ff 35 98 72 00 00    	push   0x7298
+    3246:	e8 c5 16 00 00       	call   4910 <printf>
+    exit();
+    324b:	e8 29 12 00 00       	call   4479 <exit>
+    printf(stdout, "clocktime failed\n");
+    3250:	56                   	push   %esi
+    3251:	56                   	push   %esi
+    3252:	68 09 5b 00 00       	push   $0x5b09
+    3257:	ff 35 98 72 00 00    	push   0x7298
+    325d:	e8 ae 16 00 00       	call   4910 <printf>
+    exit();
+    3262:	e8 12 12 00 00       	call   4479 <exit>
+    printf(stdout, "clock says sleep(20) took %d ms\n", ms);
+    3267:	51                   	push   %ecx
+    3268:	52                   	push   %edx
+    3269:	68 7c 64 00 00       	push   $0x647c
+    326e:	ff 35 98 72 00 00    	push   0x7298
+    3274:	e8 97 16 00 00       	call   4910 <printf>
+    exit();
+    3279:	e8 fb 11 00 00       	call   4479 <exit>
+    printf(stdout, "uclocktime ahead of clocktime\n");
+    327e:	50                   	push   %eax
+    327f:	50                   	push   %eax
+    3280:	68 a0 64 00 00       	push   $0x64a0
+    3285:	ff 35 98 72 00 00    	push   0x7298
+    328b:	e8 80 16 00 00       	call   4910 <printf>
+    exit();
+    3290:	e8 e4 11 00 00       	call   4479 <exit>
+    printf(stdout, "ugetpid %d != getpid %d\n", ugetpid(), getpid());
+    3295:	e8 af 13 00 00       	call   4649 <getpid>
+    329a:	89 c3                	mov    %eax,%ebx
+    329c:	e8 1f 11 00 00       	call   43c0 <ugetpid>
+    32a1:	53                   	push   %ebx
+    32a2:	50                   	push   %eax
+    32a3:	68 31 5b 00 00       	push   $0x5b31
+    32a8:	ff 35 98 72 00 00    	push   0x7298
+    32ae:	e8 5d 16 00 00       	call   4910 <printf>
+    exit();
+    32b3:	e8 c1 11 00 00       	call   4479 <exit>
+    32b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    32bf:	90                   	nop
+
+000032c0 <batchtest>:
+{
+    32c0:	55                   	push   %ebp
+    32c1:	89 e5                	mov    %esp,%ebp
+    32c3:	57                   	push   %edi
+    32c4:	56                   	push   %esi
+    32c5:	53                   	push   %ebx
+    32c6:	81 ec 94 00 00 00    	sub    $0x94,%esp
+  printf(stdout, "batch test\n");
+    32cc:	68 59 5b 00 00       	push   $0x5b59
+    32d1:	ff 35 98 72 00 00    	push   0x7298
+    32d7:	e8 34 16 00 00       	call   4910 <printf>
+  fd = open("batchfile", O_CREATE|O_RDWR);
+    32dc:	58                   	pop    %eax
+    32dd:	5a                   	pop    %edx
+    32de:	68 02 02 00 00       	push   $0x202
+    32e3:	68 65 5b 00 00       	push   $0x5b65
+    32e8:	e8 74 12 00 00       	call   4561 <open>
+  if(fd < 0){
+    32ed:	83 c4 10             	add    $0x10,%esp
+    32f0:	85 c0                	test   %eax,%eax
+    32f2:	0f 88 50 01 00 00    	js     3448 <batchtest+0x188>
+  memset(e, 0, sizeof(e));
+    32f8:	83 ec 04             	sub    $0x4,%esp
+    32fb:	8d b5 68 ff ff ff    	lea    -0x98(%ebp),%esi
+    3301:	89 c3                	mov    %eax,%ebx
+    3303:	68 80 00 00 00       	push   $0x80
+    3308:	6a 00                	push   $0x0
+    330a:	56                   	push   %esi
+    330b:	e8 30 0f 00 00       	call   4240 <memset>
+  if(batch(e, 4, 0) != 4 || e[0].ret != 5 || e[1].ret != getpid() ||
+    3310:	83 c4 0c             	add    $0xc,%esp
+  e[3].args[0] = fd;
+    3313:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+  e[0].num = SYS_write;
+    3316:	c7 85 68 ff ff ff 10 	movl   $0x10,-0x98(%ebp)
+    331d:	00 00 00 
+  e[0].args[0] = fd;
+    3320:	89 9d 6c ff ff ff    	mov    %ebx,-0x94(%ebp)
+  e[0].args[1] = (int)"hello";
+    3326:	c7 85 70 ff ff ff 3b 	movl   $0x513b,-0x90(%ebp)
+    332d:	51 00 00 
+  e[0].args[2] = 5;
+    3330:	c7 85 74 ff ff ff 05 	movl   $0x5,-0x8c(%ebp)
+    3337:	00 00 00 
+  e[1].num = SYS_getpid;
+    333a:	c7 45 88 0b 00 00 00 	movl   $0xb,-0x78(%ebp)
+  e[2].num = SYS_fork;
+    3341:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%ebp)
+  e[3].num = SYS_close;
+    3348:	c7 45 c8 15 00 00 00 	movl   $0x15,-0x38(%ebp)
+  if(batch(e, 4, 0) != 4 || e[0].ret != 5 || e[1].ret != getpid() ||
+    334f:	6a 00                	push   $0x0
+    3351:	6a 04                	push   $0x4
+    3353:	56                   	push   %esi
+    3354:	e8 12 14 00 00       	call   476b <batch>
+    3359:	83 c4 10             	add    $0x10,%esp
+    335c:	83 f8 04             	cmp    $0x4,%eax
+    335f:	0f 85 9d 00 00 00    	jne    3402 <batchtest+0x142>
+    3365:	83 7d 84 05          	cmpl   $0x5,-0x7c(%ebp)
+    3369:	0f 85 93 00 00 00    	jne    3402 <batchtest+0x142>
+    336f:	8b 7d a4             	mov    -0x5c(%ebp),%edi
+    3372:	e8 d2 12 00 00       	call   4649 <getpid>
+    3377:	39 c7                	cmp    %eax,%edi
+    3379:	0f 85 83 00 00 00    	jne    3402 <batchtest+0x142>
+    337f:	83 7d c4 ff          	cmpl   $0xffffffff,-0x3c(%ebp)
+    3383:	75 7d                	jne    3402 <batchtest+0x142>
+     e[2].ret != -1 || e[3].ret != 0){
+    3385:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    3388:	85 ff                	test   %edi,%edi
+    338a:	75 76                	jne    3402 <batchtest+0x142>
+  if(batch(e, 2, BATCH_STOPERR) != 1 || e[0].ret != -1){
+    338c:	83 ec 04             	sub    $0x4,%esp
+  e[0].args[0] = fd;
+    338f:	89 9d 6c ff ff ff    	mov    %ebx,-0x94(%ebp)
+  e[0].num = SYS_close;
+    3395:	c7 85 68 ff ff ff 15 	movl   $0x15,-0x98(%ebp)
+    339c:	00 00 00 
+  e[1].num = SYS_unlink;
+    339f:	c7 45 88 12 00 00 00 	movl   $0x12,-0x78(%ebp)
+  e[1].args[0] = (int)"batchfile";
+    33a6:	c7 45 8c 65 5b 00 00 	movl   $0x5b65,-0x74(%ebp)
+  if(batch(e, 2, BATCH_STOPERR) != 1 || e[0].ret != -1){
+    33ad:	6a 01                	push   $0x1
+    33af:	6a 02                	push   $0x2
+    33b1:	56                   	push   %esi
+    33b2:	e8 b4 13 00 00       	call   476b <batch>
+    33b7:	83 c4 10             	add    $0x10,%esp
+    33ba:	83 f8 01             	cmp    $0x1,%eax
+    33bd:	75 72                	jne    3431 <batchtest+0x171>
+    33bf:	83 7d 84 ff          	cmpl   $0xffffffff,-0x7c(%ebp)
+    33c3:	75 6c                	jne    3431 <batchtest+0x171>
+  if(batch(e + 1, 1, 0) != 1 || e[1].ret != 0){
+    33c5:	83 ec 04             	sub    $0x4,%esp
+    33c8:	8d 45 88             	lea    -0x78(%ebp),%eax
+    33cb:	6a 00                	push   $0x0
+    33cd:	6a 01                	push   $0x1
+    33cf:	50                   	push   %eax
+    33d0:	e8 96 13 00 00       	call   476b <batch>
+    33d5:	83 c4 10             	add    $0x10,%esp
+    33d8:	83 f8 01             	cmp    $0x1,%eax
+    33db:	75 3d                	jne    341a <batchtest+0x15a>
+    33dd:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  printf(stdout, "batch test OK\n");
+    33e0:	a1 98 72 00 00       	mov    0x7298,%eax
+  if(batch(e + 1, 1, 0) != 1 || e[1].ret != 0){
+    33e5:	85 d2                	test   %edx,%edx
+    33e7:	75 31                	jne    341a <batchtest+0x15a>
+  printf(stdout, "batch test OK\n");
+    33e9:	83 ec 08             	sub    $0x8,%esp
+    33ec:	68 bd 5b 00 00       	push   $0x5bbd
+    33f1:	50                   	push   %eax
+    33f2:	e8 19 15 00 00       	call   4910 <printf>
+}
+    33f7:	83 c4 10             	add    $0x10,%esp
+    33fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    33fd:	5b                   	pop    %ebx
+    33fe:	5e                   	pop    %esi
+    33ff:	5f                   	pop    %edi
+    3400:	5d                   	pop    %ebp
+    3401:	c3                   	ret
+    printf(stdout, "batch returned wrong results\n");
+    3402:	83 ec 08             	sub    $0x8,%esp
+    3405:	68 8a 5b 00 00       	push   $0x5b8a
+    340a:	ff 35 98 72 00 00    	push   0x7298
+    3410:	e8 fb 14 00 00       	call   4910 <printf>
+    exit();
+    3415:	e8 5f 10 00 00       	call   4479 <exit>
+    printf(stdout, "batch unlink failed\n");
+    341a:	50                   	push   %eax
+    341b:	50                   	push   %eax
+    341c:	68 a8 5b 00 00       	push   $0x5ba8
+    3421:	ff 35 98 72 00 00    	push   0x7298
+    3427:	e8 e4 14 00 00       	call   4910 <printf>
+    exit();
+    342c:	e8 48 10 00 00       	call   4479 <exit>
+    printf(stdout, "batch did not stop at the error\n");
+    3431:	51                   	push   %ecx
+    3432:	51                   	push   %ecx
+    3433:	68 c0 64 00 00       	push   $0x64c0
+    3438:	ff 35 98 72 00 00    	push   0x7298
+    343e:	e8 cd 14 00 00       	call   4910 <printf>
+    exit();
+    3443:	e8 31 10 00 00       	call   4479 <exit>
+    printf(stdout, "batch test: create failed\n");
+    3448:	50                   	push   %eax
+    3449:	50                   	push   %eax
+    344a:	68 6f 5b 00 00       	push   $0x5b6f
+    344f:	ff 35 98 72 00 00    	push   0x7298
+    3455:	e8 b6 14 00 00       	call   4910 <printf>
+    exit();
+    345a:	e8 1a 10 00 00       	call   4479 <exit>
+    345f:	90                   	nop
+
+00003460 <spawntest>:
+{
+    3460:	55                   	push   %ebp
+    3461:	89 e5                	mov    %esp,%ebp
+    3463:	56                   	push   %esi
+    3464:	53                   	push   %ebx
+  if(spawn("nosuchprog", argv, 0, 0) != -1 || pipe(p) < 0){
+    3465:	8d 5d d0             	lea    -0x30(%ebp),%ebx
+{
+    3468:	83 ec 38             	sub    $0x38,%esp
+  char *argv[] = { "echo", "spawned", 0 };
+    346b:	c7 45 d0 0e 4d 00 00 	movl   $0x4d0e,-0x30(%ebp)
+    3472:	c7 45 d4 cc 5b 00 00 	movl   $0x5bcc,-0x2c(%ebp)
+    3479:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  printf(stdout, "spawn test\n");
+    3480:	68 d4 5b 00 00       	push   $0x5bd4
+    3485:	ff 35 98 72 00 00    	push   0x7298
+    348b:	e8 80 14 00 00       	call   4910 <printf>
+  if(spawn("nosuchprog", argv, 0, 0) != -1 || pipe(p) < 0){
+    3490:	6a 00                	push   $0x0
+    3492:	6a 00                	push   $0x0
+    3494:	53                   	push   %ebx
+    3495:	68 e0 5b 00 00       	push   $0x5be0
+    349a:	e8 23 13 00 00       	call   47c2 <spawn>
+    349f:	83 c4 20             	add    $0x20,%esp
+    34a2:	83 f8 ff             	cmp    $0xffffffff,%eax
+    34a5:	0f 85 b9 00 00 00    	jne    3564 <spawntest+0x104>
+    34ab:	83 ec 0c             	sub    $0xc,%esp
+    34ae:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    34b1:	50                   	push   %eax
+    34b2:	e8 fc 0f 00 00       	call   44b3 <pipe>
+    34b7:	83 c4 10             	add    $0x10,%esp
+    34ba:	85 c0                	test   %eax,%eax
+    34bc:	0f 88 a2 00 00 00    	js     3564 <spawntest+0x104>
+  map[1] = p[1];
+    34c2:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  map[0] = 0;
+    34c5:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  map[2] = 2;
+    34cc:	c7 45 e4 02 00 00 00 	movl   $0x2,-0x1c(%ebp)
+  map[1] = p[1];
+    34d3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  pid = spawn("echo", argv, map, 3);
+    34d6:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    34d9:	6a 03                	push   $0x3
+    34db:	50                   	push   %eax
+    34dc:	53                   	push   %ebx
+    34dd:	68 0e 4d 00 00       	push   $0x4d0e
+    34e2:	e8 db 12 00 00       	call   47c2 <spawn>
+    34e7:	89 c3                	mov    %eax,%ebx
+  close(p[1]);
+    34e9:	58                   	pop    %eax
+    34ea:	ff 75 cc             	push   -0x34(%ebp)
+    34ed:	e8 18 10 00 00       	call   450a <close>
+  n = read(p[0], buf, sizeof(buf));
+    34f2:	83 c4 0c             	add    $0xc,%esp
+    34f5:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    34f8:	6a 10                	push   $0x10
+    34fa:	50                   	push   %eax
+    34fb:	ff 75 c8             	push   -0x38(%ebp)
+    34fe:	e8 cd 0f 00 00       	call   44d0 <read>
+  close(p[0]);
+    3503:	5a                   	pop    %edx
+    3504:	ff 75 c8             	push   -0x38(%ebp)
+  n = read(p[0], buf, sizeof(buf));
+    3507:	89 c6                	mov    %eax,%esi
+  close(p[0]);
+    3509:	e8 fc 0f 00 00       	call   450a <close>
+  if(pid < 0 || wait() != pid || n != 8 || buf[0] != 's' || buf[7] != '\n'){
+    350e:	83 c4 10             	add    $0x10,%esp
+    3511:	85 db                	test   %ebx,%ebx
+    3513:	78 37                	js     354c <spawntest+0xec>
+    3515:	e8 7c 0f 00 00       	call   4496 <wait>
+    351a:	83 fe 08             	cmp    $0x8,%esi
+    351d:	75 2d                	jne    354c <spawntest+0xec>
+    351f:	39 d8                	cmp    %ebx,%eax
+    3521:	75 29                	jne    354c <spawntest+0xec>
+    3523:	80 7d e8 73          	cmpb   $0x73,-0x18(%ebp)
+  printf(stdout, "spawn test OK\n");
+    3527:	a1 98 72 00 00       	mov    0x7298,%eax
+  if(pid < 0 || wait() != pid || n != 8 || buf[0] != 's' || buf[7] != '\n'){
+    352c:	75 1e                	jne    354c <spawntest+0xec>
+    352e:	80 7d ef 0a          	cmpb   $0xa,-0x11(%ebp)
+    3532:	75 18                	jne    354c <spawntest+0xec>
+  printf(stdout, "spawn test OK\n");
+    3534:	83 ec 08             	sub    $0x8,%esp
+    3537:	68 17 5c 00 00       	push   $0x5c17
+    353c:	50                   	push   %eax
+    353d:	e8 ce 13 00 00       	call   4910 <printf>
+}
+    3542:	83 c4 10             	add    $0x10,%esp
+    3545:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3548:	5b                   	pop    %ebx
+    3549:	5e                   	pop    %esi
+    354a:	5d                   	pop    %ebp
+    354b:	c3                   	ret
+    printf(stdout, "spawn echo failed\n");
+    354c:	83 ec 08             	sub    $0x8,%esp
+    354f:	68 04 5c 00 00       	push   $0x5c04
+    3554:	ff 35 98 72 00 00    	push   0x7298
+    355a:	e8 b1 13 00 00       	call   4910 <printf>
+    exit();
+    355f:	e8 15 0f 00 00       	call   4479 <exit>
+    printf(stdout, "spawn test setup failed\n");
+    3564:	51                   	push   %ecx
+    3565:	51                   	push   %ecx
+    3566:	68 eb 5b 00 00       	push   $0x5beb
+    356b:	ff 35 98 72 00 00    	push   0x7298
+    3571:	e8 9a 13 00 00       	call   4910 <printf>
+    exit();
+    3576:	e8 fe 0e 00 00       	call   4479 <exit>
+    357b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    357f:	90                   	nop
+
+00003580 <sbrktest>:
+{
+    3580:	55                   	push   %ebp
+    3581:	89 e5                	mov    %esp,%ebp
+    3583:	57                   	push   %edi
+    3584:	56                   	push   %esi
+  for(i = 0; i < 5000; i++){
+    3585:	31 f6                	xor    %esi,%esi
+{
+    3587:	53                   	push   %ebx
+    3588:	83 ec 64             	sub    $0x64,%esp
+  printf(stdout, "sbrk test\n");
+    358b:	68 26 5c 00 00       	push   $0x5c26
+    3590:	ff 35 98 72 00 00    	push   0x7298
+    3596:	e8 75 13 00 00       	call   4910 <printf>
+  oldbrk = sbrk(0);
+    359b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    35a2:	e8 bf 10 00 00       	call   4666 <sbrk>
+    35a7:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(0);
+    35aa:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    35b1:	e8 b0 10 00 00       	call   4666 <sbrk>
+    35b6:	83 c4 10             	add    $0x10,%esp
+    35b9:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 5000; i++){
+    35bb:	eb 05                	jmp    35c2 <sbrktest+0x42>
+    35bd:	8d 76 00             	lea    0x0(%esi),%esi
+    a = b + 1;
+    35c0:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+    35c2:	83 ec 0c             	sub    $0xc,%esp
+    35c5:	6a 01                	push   $0x1
+    35c7:	e8 9a 10 00 00       	call   4666 <sbrk>
+    if(b != a){
+    35cc:	83 c4 10             	add    $0x10,%esp
+    35cf:	39 d8                	cmp    %ebx,%eax
+    35d1:	0f 85 9c 02 00 00    	jne    3873 <sbrktest+0x2f3>
+  for(i = 0; i < 5000; i++){
+    35d7:	83 c6 01             	add    $0x1,%esi
+    *b = 1;
+    35da:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+    35dd:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){
+    35e0:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+    35e6:	75 d8                	jne    35c0 <sbrktest+0x40>
+  pid = fork();
+    35e8:	e8 6f 0e 00 00       	call   445c <fork>
+    35ed:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    35ef:	85 c0                	test   %eax,%eax
+    35f1:	0f 88 02 03 00 00    	js     38f9 <sbrktest+0x379>
+  c = sbrk(1);
+    35f7:	83 ec 0c             	sub    $0xc,%esp
+  if(c != a + 1){
+    35fa:	83 c3 02             	add    $0x2,%ebx
+  c = sbrk(1);
+    35fd:	6a 01                	push   $0x1
+    35ff:	e8 62 10 00 00       	call   4666 <sbrk>
+  c = sbrk(1);
+    3604:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    360b:	e8 56 10 00 00       	call   4666 <sbrk>
+  if(c != a + 1){
+    3610:	83 c4 10             	add    $0x10,%esp
+    3613:	39 c3                	cmp    %eax,%ebx
+    3615:	0f 85 3b 03 00 00    	jne    3956 <sbrktest+0x3d6>
+  if(pid == 0)
+    361b:	85 f6                	test   %esi,%esi
+    361d:	0f 84 2e 03 00 00    	je     3951 <sbrktest+0x3d1>
+  wait();
+    3623:	e8 6e 0e 00 00       	call   4496 <wait>
+  a = sbrk(0);
+    3628:	83 ec 0c             	sub    $0xc,%esp
+    362b:	6a 00                	push   $0x0
+    362d:	e8 34 10 00 00       	call   4666 <sbrk>
+    3632:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    3634:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3639:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    363b:	89 04 24             	mov    %eax,(%esp)
+    363e:	e8 23 10 00 00       	call   4666 <sbrk>
+  if (p != a) {
+    3643:	83 c4 10             	add    $0x10,%esp
+    3646:	39 c3                	cmp    %eax,%ebx
+    3648:	0f 85 94 02 00 00    	jne    38e2 <sbrktest+0x362>
+  a = sbrk(0);
+    364e:	83 ec 0c             	sub    $0xc,%esp
+  *lastaddr = 99;
+    3651:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+    3658:	6a 00                	push   $0x0
+    365a:	e8 07 10 00 00       	call   4666 <sbrk>
+  c = sbrk(-4096);
+    365f:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+  a = sbrk(0);
+    3666:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    3668:	e8 f9 0f 00 00       	call   4666 <sbrk>
+  if(c == (char*)0xffffffff){
+    366d:	83 c4 10             	add    $0x10,%esp
+    3670:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3673:	0f 84 22 03 00 00    	je     399b <sbrktest+0x41b>
+  c = sbrk(0);
+    3679:	83 ec 0c             	sub    $0xc,%esp
+    367c:	6a 00                	push   $0x0
+    367e:	e8 e3 0f 00 00       	call   4666 <sbrk>
+  if(c != a - 4096){
+    3683:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    3689:	83 c4 10             	add    $0x10,%esp
+    368c:	39 d0                	cmp    %edx,%eax
+    368e:	0f 85 f0 02 00 00    	jne    3984 <sbrktest+0x404>
+  a = sbrk(0);
+    3694:	83 ec 0c             	sub    $0xc,%esp
+    3697:	6a 00                	push   $0x0
+    3699:	e8 c8 0f 00 00       	call   4666 <sbrk>
+  c = sbrk(4096);
+    369e:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  a = sbrk(0);
+    36a5:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    36a7:	e8 ba 0f 00 00       	call   4666 <sbrk>
+  if(c != a || sbrk(0) != a + 4096){
+    36ac:	83 c4 10             	add    $0x10,%esp
+  c = sbrk(4096);
+    36af:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    36b1:	39 c3                	cmp    %eax,%ebx
+    36b3:	0f 85 b4 02 00 00    	jne    396d <sbrktest+0x3ed>
+    36b9:	83 ec 0c             	sub    $0xc,%esp
+    36bc:	6a 00                	push   $0x0
+    36be:	e8 a3 0f 00 00       	call   4666 <sbrk>
+    36c3:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    36c9:	83 c4 10             	add    $0x10,%esp
+    36cc:	39 c2                	cmp    %eax,%edx
+    36ce:	0f 85 99 02 00 00    	jne    396d <sbrktest+0x3ed>
+  if(*lastaddr == 99){
+    36d4:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    36db:	0f 84 2f 02 00 00    	je     3910 <sbrktest+0x390>
+  a = sbrk(0);
+    36e1:	83 ec 0c             	sub    $0xc,%esp
+    36e4:	6a 00                	push   $0x0
+    36e6:	e8 7b 0f 00 00       	call   4666 <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+    36eb:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  a = sbrk(0);
+    36f2:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    36f4:	e8 6d 0f 00 00       	call   4666 <sbrk>
+    36f9:	89 c2                	mov    %eax,%edx
+    36fb:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    36fe:	29 d0                	sub    %edx,%eax
+    3700:	89 04 24             	mov    %eax,(%esp)
+    3703:	e8 5e 0f 00 00       	call   4666 <sbrk>
+  if(c != a){
+    3708:	83 c4 10             	add    $0x10,%esp
+    370b:	39 c3                	cmp    %eax,%ebx
+    370d:	0f 85 b8 01 00 00    	jne    38cb <sbrktest+0x34b>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    3713:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    3718:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    371f:	90                   	nop
+    ppid = getpid();
+    3720:	e8 24 0f 00 00       	call   4649 <getpid>
+    3725:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    3727:	e8 30 0d 00 00       	call   445c <fork>
+    if(pid < 0){
+    372c:	85 c0                	test   %eax,%eax
+    372e:	0f 88 5d 01 00 00    	js     3891 <sbrktest+0x311>
+    if(pid == 0){
+    3734:	0f 84 6f 01 00 00    	je     38a9 <sbrktest+0x329>
+    wait();
+    373a:	e8 57 0d 00 00       	call   4496 <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    373f:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    3745:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    374b:	75 d3                	jne    3720 <sbrktest+0x1a0>
+  if(pipe(fds) != 0){
+    374d:	83 ec 0c             	sub    $0xc,%esp
+    3750:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    3753:	50                   	push   %eax
+    3754:	e8 5a 0d 00 00       	call   44b3 <pipe>
+    3759:	83 c4 10             	add    $0x10,%esp
+    375c:	85 c0                	test   %eax,%eax
+    375e:	0f 85 da 01 00 00    	jne    393e <sbrktest+0x3be>
+    3764:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+    3767:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    376a:	89 df                	mov    %ebx,%edi
+    376c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((pids[i] = fork()) == 0){
+    3770:	e8 e7 0c 00 00       	call   445c <fork>
+    3775:	89 07                	mov    %eax,(%edi)
+    3777:	85 c0                	test   %eax,%eax
+    3779:	0f 84 91 00 00 00    	je     3810 <sbrktest+0x290>
+    if(pids[i] != -1)
+    377f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3782:	74 14                	je     3798 <sbrktest+0x218>
+      read(fds[0], &scratch, 1);
+    3784:	83 ec 04             	sub    $0x4,%esp
+    3787:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    378a:	6a 01                	push   $0x1
+    378c:	50                   	push   %eax
+    378d:	ff 75 b8             	push   -0x48(%ebp)
+    3790:	e8 3b 0d 00 00       	call   44d0 <read>
+    3795:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3798:	83 c7 04             	add    $0x4,%edi
+    379b:	39 f7                	cmp    %esi,%edi
+    379d:	75 d1                	jne    3770 <sbrktest+0x1f0>
+  c = sbrk(4096);
+    379f:	83 ec 0c             	sub    $0xc,%esp
+    37a2:	68 00 10 00 00       	push   $0x1000
+    37a7:	e8 ba 0e 00 00       	call   4666 <sbrk>
+    37ac:	83 c4 10             	add    $0x10,%esp
+    37af:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    37b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pids[i] == -1)
+    37b8:	8b 03                	mov    (%ebx),%eax
+    37ba:	83 f8 ff             	cmp    $0xffffffff,%eax
+    37bd:	74 11                	je     37d0 <sbrktest+0x250>
+    kill(pids[i]);
+    37bf:	83 ec 0c             	sub    $0xc,%esp
+    37c2:	50                   	push   %eax
+    37c3:	e8 5f 0d 00 00       	call   4527 <kill>
+    wait();
+    37c8:	e8 c9 0c 00 00       	call   4496 <wait>
+    37cd:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    37d0:	83 c3 04             	add    $0x4,%ebx
+    37d3:	39 f3                	cmp    %esi,%ebx
+    37d5:	75 e1                	jne    37b8 <sbrktest+0x238>
+  if(c == (char*)0xffffffff){
+    37d7:	83 ff ff             	cmp    $0xffffffff,%edi
+    37da:	0f 84 47 01 00 00    	je     3927 <sbrktest+0x3a7>
+  if(sbrk(0) > oldbrk)
+    37e0:	83 ec 0c             	sub    $0xc,%esp
+    37e3:	6a 00                	push   $0x0
+    37e5:	e8 7c 0e 00 00       	call   4666 <sbrk>
+    37ea:	83 c4 10             	add    $0x10,%esp
+    37ed:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    37f0:	72 60                	jb     3852 <sbrktest+0x2d2>
+  printf(stdout, "sbrk test OK\n");
+    37f2:	83 ec 08             	sub    $0x8,%esp
+    37f5:	68 ce 5c 00 00       	push   $0x5cce
+    37fa:	ff 35 98 72 00 00    	push   0x7298
+    3800:	e8 0b 11 00 00       	call   4910 <printf>
+}
+    3805:	83 c4 10             	add    $0x10,%esp
+    3808:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    380b:	5b                   	pop    %ebx
+    380c:	5e                   	pop    %esi
+    380d:	5f                   	pop    %edi
+    380e:	5d                   	pop    %ebp
+    380f:	c3                   	ret
+      sbrk(BIG - (uint)sbrk(0));
+    3810:	83 ec 0c             	sub    $0xc,%esp
+    3813:	6a 00                	push   $0x0
+    3815:	e8 4c 0e 00 00       	call   4666 <sbrk>
+    381a:	89 c2                	mov    %eax,%edx
+    381c:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3821:	29 d0                	sub    %edx,%eax
+    3823:	89 04 24             	mov    %eax,(%esp)
+    3826:	e8 3b 0e 00 00       	call   4666 <sbrk>
+      write(fds[1], "x", 1);
+    382b:	83 c4 0c             	add    $0xc,%esp
+    382e:	6a 01                	push   $0x1
+    3830:	68 82 55 00 00       	push   $0x5582
+    3835:	ff 75 bc             	push   -0x44(%ebp)
+    3838:	e8 b0 0c 00 00       	call   44ed <write>
+    383d:	83 c4 10             	add    $0x10,%esp
+      for(;;) sleep(1000);
+    3840:	83 ec 0c             	sub    $0xc,%esp
+    3843:	68 e8 03 00 00       	push   $0x3e8
+    3848:	e8 36 0e 00 00       	call   4683 <sleep>
+    384d:	83 c4 10             	add    $0x10,%esp
+    3850:	eb ee                	jmp    3840 <sbrktest+0x2c0>
+    sbrk(-(sbrk(0) - oldbrk));
+    3852:	83 ec 0c             	sub    $0xc,%esp
+    3855:	6a 00                	push   $0x0
+    3857:	e8 0a 0e 00 00       	call   4666 <sbrk>
+    385c:	89 c2                	mov    %eax,%edx
+    385e:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    3861:	29 d0                	sub    %edx,%eax
+    3863:	89 04 24             	mov    %eax,(%esp)
+    3866:	e8 fb 0d 00 00       	call   4666 <sbrk>
+    386b:	83 c4 10             	add    $0x10,%esp
+    386e:	e9 7f ff ff ff       	jmp    37f2 <sbrktest+0x272>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    3873:	83 ec 0c             	sub    $0xc,%esp
+    3876:	50                   	push   %eax
+    3877:	53                   	push   %ebx
+    3878:	56                   	push   %esi
+    3879:	68 31 5c 00 00       	push   $0x5c31
+    387e:	ff 35 98 72 00 00    	push   0x7298
+    3884:	e8 87 10 00 00       	call   4910 <printf>
+      exit();
+    3889:	83 c4 20             	add    $0x20,%esp
+    388c:	e8 e8 0b 00 00       	call   4479 <exit>
+      printf(stdout, "fork failed\n");
+    3891:	83 ec 08             	sub    $0x8,%esp
+    3894:	68 77 5d 00 00       	push   $0x5d77
+    3899:	ff 35 98 72 00 00    	push   0x7298
+    389f:	e8 6c 10 00 00       	call   4910 <printf>
+      exit();
+    38a4:	e8 d0 0b 00 00       	call   4479 <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    38a9:	0f be 03             	movsbl (%ebx),%eax
+    38ac:	50                   	push   %eax
+    38ad:	53                   	push   %ebx
+    38ae:	68 9a 5c 00 00       	push   $0x5c9a
+    38b3:	ff 35 98 72 00 00    	push   0x7298
+    38b9:	e8 52 10 00 00       	call   4910 <printf>
+      kill(ppid);
+    38be:	89 34 24             	mov    %esi,(%esp)
+    38c1:	e8 61 0c 00 00       	call   4527 <kill>
+      exit();
+    38c6:	e8 ae 0b 00 00       	call   4479 <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    38cb:	50                   	push   %eax
+    38cc:	53                   	push   %ebx
+    38cd:	68 b4 65 00 00       	push   $0x65b4
+    38d2:	ff 35 98 72 00 00    	push   0x7298
+    38d8:	e8 33 10 00 00       	call   4910 <printf>
+    exit();
+    38dd:	e8 97 0b 00 00       	call   4479 <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    38e2:	56                   	push   %esi
+    38e3:	56                   	push   %esi
+    38e4:	68 e4 64 00 00       	push   $0x64e4
+    38e9:	ff 35 98 72 00 00    	push   0x7298
+    38ef:	e8 1c 10 00 00       	call   4910 <printf>
+    exit();
+    38f4:	e8 80 0b 00 00       	call   4479 <exit>
+    printf(stdout, "sbrk test fork failed\n");
+    38f9:	50                   	push   %eax
+    38fa:	50                   	push   %eax
+    38fb:	68 4c 5c 00 00       	push   $0x5c4c
+    3900:	ff 35 98 72 00 00    	push   0x7298
+    3906:	e8 05 10 00 00       	call   4910 <printf>
+    exit();
+    390b:	e8 69 0b 00 00       	call   4479 <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    3910:	51                   	push   %ecx
+    3911:	51                   	push   %ecx
+    3912:	68 84 65 00 00       	push   $0x6584
+    3917:	ff 35 98 72 00 00    	push   0x7298
+    391d:	e8 ee 0f 00 00       	call   4910 <printf>
+    exit();
+    3922:	e8 52 0b 00 00       	call   4479 <exit>
+    printf(stdout, "failed sbrk leaked memory\n");
+    3927:	50                   	push   %eax
+    3928:	50                   	push   %eax
+    3929:	68 b3 5c 00 00       	push   $0x5cb3
+    392e:	ff 35 98 72 00 00    	push   0x7298
+    3934:	e8 d7 0f 00 00       	call   4910 <printf>
+    exit();
+    3939:	e8 3b 0b 00 00       	call   4479 <exit>
+    printf(1, "pipe() failed\n");
+    393e:	52                   	push   %edx
+    393f:	52                   	push   %edx
+    3940:	68 62 4f 00 00       	push   $0x4f62
+    3945:	6a 01                	push   $0x1
+    3947:	e8 c4 0f 00 00       	call   4910 <printf>
+    exit();
+    394c:	e8 28 0b 00 00       	call   4479 <exit>
+    exit();
+    3951:	e8 23 0b 00 00       	call   4479 <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    3956:	57                   	push   %edi
+    3957:	57                   	push   %edi
+    3958:	68 63 5c 00 00       	push   $0x5c63
+    395d:	ff 35 98 72 00 00    	push   0x7298
+    3963:	e8 a8 0f 00 00       	call   4910 <printf>
+    exit();
+    3968:	e8 0c 0b 00 00       	call   4479 <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    396d:	56                   	push   %esi
+    396e:	53                   	push   %ebx
+    396f:	68 5c 65 00 00       	push   $0x655c
+    3974:	ff 35 98 72 00 00    	push   0x7298
+    397a:	e8 91 0f 00 00       	call   4910 <printf>
+    exit();
+    397f:	e8 f5 0a 00 00       	call   4479 <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    3984:	50                   	push   %eax
+    3985:	53                   	push   %ebx
+    3986:	68 24 65 00 00       	push   $0x6524
+    398b:	ff 35 98 72 00 00    	push   0x7298
+    3991:	e8 7a 0f 00 00       	call   4910 <printf>
+    exit();
+    3996:	e8 de 0a 00 00       	call   4479 <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    399b:	53                   	push   %ebx
+    399c:	53                   	push   %ebx
+    399d:	68 7f 5c 00 00       	push   $0x5c7f
+    39a2:	ff 35 98 72 00 00    	push   0x7298
+    39a8:	e8 63 0f 00 00       	call   4910 <printf>
+    exit();
+    39ad:	e8 c7 0a 00 00       	call   4479 <exit>
+    39b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    39b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000039c0 <validateint>:
+}
+    39c0:	c3                   	ret
+    39c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    39c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    39cf:	90                   	nop
+
+000039d0 <validatetest>:
+{
+    39d0:	55                   	push   %ebp
+    39d1:	89 e5                	mov    %esp,%ebp
+    39d3:	56                   	push   %esi
+  for(p = 0; p <= (uint)hi; p += 4096){
+    39d4:	31 f6                	xor    %esi,%esi
+{
+    39d6:	53                   	push   %ebx
+  printf(stdout, "validate test\n");
+    39d7:	83 ec 08             	sub    $0x8,%esp
+    39da:	68 dc 5c 00 00       	push   $0x5cdc
+    39df:	ff 35 98 72 00 00    	push   0x7298
+    39e5:	e8 26 0f 00 00       	call   4910 <printf>
+    39ea:	83 c4 10             	add    $0x10,%esp
+    39ed:	8d 76 00             	lea    0x0(%esi),%esi
+    if((pid = fork()) == 0){
+    39f0:	e8 67 0a 00 00       	call   445c <fork>
+    39f5:	89 c3                	mov    %eax,%ebx
+    39f7:	85 c0                	test   %eax,%eax
+    39f9:	74 63                	je     3a5e <validatetest+0x8e>
+    sleep(0);
+    39fb:	83 ec 0c             	sub    $0xc,%esp
+    39fe:	6a 00                	push   $0x0
+    3a00:	e8 7e 0c 00 00       	call   4683 <sleep>
+    sleep(0);
+    3a05:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3a0c:	e8 72 0c 00 00       	call   4683 <sleep>
+    kill(pid);
+    3a11:	89 1c 24             	mov    %ebx,(%esp)
+    3a14:	e8 0e 0b 00 00       	call   4527 <kill>
+    wait();
+    3a19:	e8 78 0a 00 00       	call   4496 <wait>
+    if(link("nosuchfile", (char*)p) != -1){
+    3a1e:	58                   	pop    %eax
+    3a1f:	5a                   	pop    %edx
+    3a20:	56                   	push   %esi
+    3a21:	68 eb 5c 00 00       	push   $0x5ceb
+    3a26:	e8 aa 0b 00 00       	call   45d5 <link>
+    3a2b:	83 c4 10             	add    $0x10,%esp
+    3a2e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3a31:	75 30                	jne    3a63 <validatetest+0x93>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3a33:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    3a39:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    3a3f:	75 af                	jne    39f0 <validatetest+0x20>
+  printf(stdout, "validate ok\n");
+    3a41:	83 ec 08             	sub    $0x8,%esp
+    3a44:	68 0f 5d 00 00       	push   $0x5d0f
+    3a49:	ff 35 98 72 00 00    	push   0x7298
+    3a4f:	e8 bc 0e 00 00       	call   4910 <printf>
+}
+    3a54:	83 c4 10             	add    $0x10,%esp
+    3a57:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3a5a:	5b                   	pop    %ebx
+    3a5b:	5e                   	pop    %esi
+    3a5c:	5d                   	pop    %ebp
+    3a5d:	c3                   	ret
+      exit();
+    3a5e:	e8 16 0a 00 00       	call   4479 <exit>
+      printf(stdout, "link should not succeed\n");
+    3a63:	83 ec 08             	sub    $0x8,%esp
+    3a66:	68 f6 5c 00 00       	push   $0x5cf6
+    3a6b:	ff 35 98 72 00 00    	push   0x7298
+    3a71:	e8 9a 0e 00 00       	call   4910 <printf>
+      exit();
+    3a76:	e8 fe 09 00 00       	call   4479 <exit>
+    3a7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3a7f:	90                   	nop
+
+00003a80 <bsstest>:
+{
+    3a80:	55                   	push   %ebp
+    3a81:	89 e5                	mov    %esp,%ebp
+    3a83:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "bss test\n");
+    3a86:	68 1c 5d 00 00       	push   $0x5d1c
+    3a8b:	ff 35 98 72 00 00    	push   0x7298
+    3a91:	e8 7a 0e 00 00       	call   4910 <printf>
+    3a96:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    3a99:	31 c0                	xor    %eax,%eax
+    3a9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3a9f:	90                   	nop
+    if(uninit[i] != '\0'){
+    3aa0:	80 b8 c0 72 00 00 00 	cmpb   $0x0,0x72c0(%eax)
+    3aa7:	75 22                	jne    3acb <bsstest+0x4b>
+  for(i = 0; i < sizeof(uninit); i++){
+    3aa9:	83 c0 01             	add    $0x1,%eax
+    3aac:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    3ab1:	75 ed                	jne    3aa0 <bsstest+0x20>
+  printf(stdout, "bss test ok\n");
+    3ab3:	83 ec 08             	sub    $0x8,%esp
+    3ab6:	68 37 5d 00 00       	push   $0x5d37
+    3abb:	ff 35 98 72 00 00    	push   0x7298
+    3ac1:	e8 4a 0e 00 00       	call   4910 <printf>
+}
+    3ac6:	83 c4 10             	add    $0x10,%esp
+    3ac9:	c9                   	leave
+    3aca:	c3                   	ret
+      printf(stdout, "bss test failed\n");
+    3acb:	83 ec 08             	sub    $0x8,%esp
+    3ace:	68 26 5d 00 00       	push   $0x5d26
+    3ad3:	ff 35 98 72 00 00    	push   0x7298
+    3ad9:	e8 32 0e 00 00       	call   4910 <printf>
+      exit();
+    3ade:	e8 96 09 00 00       	call   4479 <exit>
+    3ae3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3aea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003af0 <bigargtest>:
+{
+    3af0:	55                   	push   %ebp
+    3af1:	89 e5                	mov    %esp,%ebp
+    3af3:	83 ec 14             	sub    $0x14,%esp
+  unlink("bigarg-ok");
+    3af6:	68 44 5d 00 00       	push   $0x5d44
+    3afb:	e8 9b 0a 00 00       	call   459b <unlink>
+  pid = fork();
+    3b00:	e8 57 09 00 00       	call   445c <fork>
+  if(pid == 0){
+    3b05:	83 c4 10             	add    $0x10,%esp
+    3b08:	85 c0                	test   %eax,%eax
+    3b0a:	74 44                	je     3b50 <bigargtest+0x60>
+  } else if(pid < 0){
+    3b0c:	0f 88 c3 00 00 00    	js     3bd5 <bigargtest+0xe5>
+  wait();
+    3b12:	e8 7f 09 00 00       	call   4496 <wait>
+  fd = open("bigarg-ok", 0);
+    3b17:	83 ec 08             	sub    $0x8,%esp
+    3b1a:	6a 00                	push   $0x0
+    3b1c:	68 44 5d 00 00       	push   $0x5d44
+    3b21:	e8 3b 0a 00 00       	call   4561 <open>
+  if(fd < 0){
+    3b26:	83 c4 10             	add    $0x10,%esp
+    3b29:	85 c0                	test   %eax,%eax
+    3b2b:	0f 88 8d 00 00 00    	js     3bbe <bigargtest+0xce>
+  close(fd);
+    3b31:	83 ec 0c             	sub    $0xc,%esp
+    3b34:	50                   	push   %eax
+    3b35:	e8 d0 09 00 00       	call   450a <close>
+  unlink("bigarg-ok");
+    3b3a:	c7 04 24 44 5d 00 00 	movl   $0x5d44,(%esp)
+    3b41:	e8 55 0a 00 00       	call   459b <unlink>
+}
+    3b46:	83 c4 10             	add    $0x10,%esp
+    3b49:	c9                   	leave
+    3b4a:	c3                   	ret
+    3b4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3b4f:	90                   	nop
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    3b50:	c7 04 85 60 ba 00 00 	movl   $0x65d8,0xba60(,%eax,4)
+    3b57:	d8 65 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    3b5b:	83 c0 01             	add    $0x1,%eax
+    3b5e:	83 f8 1f             	cmp    $0x1f,%eax
+    3b61:	75 ed                	jne    3b50 <bigargtest+0x60>
+    args[MAXARG-1] = 0;
+    3b63:	31 c9                	xor    %ecx,%ecx
+    3b65:	89 0d dc ba 00 00    	mov    %ecx,0xbadc
+    printf(stdout, "bigarg test\n");
+    3b6b:	50                   	push   %eax
+    3b6c:	50                   	push   %eax
+    3b6d:	68 4e 5d 00 00       	push   $0x5d4e
+    3b72:	ff 35 98 72 00 00    	push   0x7298
+    3b78:	e8 93 0d 00 00       	call   4910 <printf>
+    exec("echo", args);
+    3b7d:	58                   	pop    %eax
+    3b7e:	5a                   	pop    %edx
+    3b7f:	68 60 ba 00 00       	push   $0xba60
+    3b84:	68 0e 4d 00 00       	push   $0x4d0e
+    3b89:	e8 b6 09 00 00       	call   4544 <exec>
+    printf(stdout, "bigarg test ok\n");
+    3b8e:	59                   	pop    %ecx
+    3b8f:	58                   	pop    %eax
+    3b90:	68 5b 5d 00 00       	push   $0x5d5b
+    3b95:	ff 35 98 72 00 00    	push   0x7298
+    3b9b:	e8 70 0d 00 00       	call   4910 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    3ba0:	58                   	pop    %eax
+    3ba1:	5a                   	pop    %edx
+    3ba2:	68 00 02 00 00       	push   $0x200
+    3ba7:	68 44 5d 00 00       	push   $0x5d44
+    3bac:	e8 b0 09 00 00       	call   4561 <open>
+    close(fd);
+    3bb1:	89 04 24             	mov    %eax,(%esp)
+    3bb4:	e8 51 09 00 00       	call   450a <close>
+    exit();
+    3bb9:	e8 bb 08 00 00       	call   4479 <exit>
+    printf(stdout, "bigarg test failed!\n");
+    3bbe:	50                   	push   %eax
+    3bbf:	50                   	push   %eax
+    3bc0:	68 84 5d 00 00       	push   $0x5d84
+    3bc5:	ff 35 98 72 00 00    	push   0x7298
+    3bcb:	e8 40 0d 00 00       	call   4910 <printf>
+    exit();
+    3bd0:	e8 a4 08 00 00       	call   4479 <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    3bd5:	52                   	push   %edx
+    3bd6:	52                   	push   %edx
+    3bd7:	68 6b 5d 00 00       	push   $0x5d6b
+    3bdc:	ff 35 98 72 00 00    	push   0x7298
+    3be2:	e8 29 0d 00 00       	call   4910 <printf>
+    exit();
+    3be7:	e8 8d 08 00 00       	call   4479 <exit>
+    3bec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003bf0 <fsfull>:
+{
+    3bf0:	55                   	push   %ebp
+    3bf1:	89 e5                	mov    %esp,%ebp
+    3bf3:	57                   	push   %edi
+    3bf4:	56                   	push   %esi
+  for(nfiles = 0; ; nfiles++){
+    3bf5:	31 f6                	xor    %esi,%esi
+{
+    3bf7:	53                   	push   %ebx
+    3bf8:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    3bfb:	68 99 5d 00 00       	push   $0x5d99
+    3c00:	6a 01                	push   $0x1
+    3c02:	e8 09 0d 00 00       	call   4910 <printf>
+    3c07:	83 c4 10             	add    $0x10,%esp
+    3c0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    3c10:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    3c15:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    printf(1, "writing %s\n", name);
+    3c1a:	83 ec 04             	sub    $0x4,%esp
+    name[0] = 'f';
+    3c1d:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3c21:	f7 e6                	mul    %esi
+    name[5] = '\0';
+    3c23:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3c27:	c1 ea 06             	shr    $0x6,%edx
+    3c2a:	8d 42 30             	lea    0x30(%edx),%eax
+    3c2d:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3c30:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    3c36:	89 f2                	mov    %esi,%edx
+    3c38:	29 c2                	sub    %eax,%edx
+    3c3a:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    3c3f:	f7 e2                	mul    %edx
+    name[3] = '0' + (nfiles % 100) / 10;
+    3c41:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3c46:	c1 ea 05             	shr    $0x5,%edx
+    3c49:	83 c2 30             	add    $0x30,%edx
+    3c4c:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    3c4f:	f7 e6                	mul    %esi
+    3c51:	c1 ea 05             	shr    $0x5,%edx
+    3c54:	6b c2 64             	imul   $0x64,%edx,%eax
+    3c57:	89 f2                	mov    %esi,%edx
+    3c59:	29 c2                	sub    %eax,%edx
+    3c5b:	89 d0                	mov    %edx,%eax
+    3c5d:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    3c5f:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    3c61:	c1 ea 03             	shr    $0x3,%edx
+    3c64:	83 c2 30             	add    $0x30,%edx
+    3c67:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    3c6a:	f7 e1                	mul    %ecx
+    3c6c:	89 f0                	mov    %esi,%eax
+    3c6e:	c1 ea 03             	shr    $0x3,%edx
+    3c71:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    3c74:	01 d2                	add    %edx,%edx
+    3c76:	29 d0                	sub    %edx,%eax
+    3c78:	83 c0 30             	add    $0x30,%eax
+    3c7b:	88 45 ac             	mov    %al,-0x54(%ebp)
+    printf(1, "writing %s\n", name);
+    3c7e:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3c81:	50                   	push   %eax
+    3c82:	68 a6 5d 00 00       	push   $0x5da6
+    3c87:	6a 01                	push   $0x1
+    3c89:	e8 82 0c 00 00       	call   4910 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    3c8e:	58                   	pop    %eax
+    3c8f:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3c92:	5a                   	pop    %edx
+    3c93:	68 02 02 00 00       	push   $0x202
+    3c98:	50                   	push   %eax
+    3c99:	e8 c3 08 00 00       	call   4561 <open>
+    if(fd < 0){
+    3c9e:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    3ca1:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    3ca3:	85 c0                	test   %eax,%eax
+    3ca5:	78 4f                	js     3cf6 <fsfull+0x106>
+    int total = 0;
+    3ca7:	31 db                	xor    %ebx,%ebx
+    3ca9:	eb 07                	jmp    3cb2 <fsfull+0xc2>
+    3cab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3caf:	90                   	nop
+      total += cc;
+    3cb0:	01 c3                	add    %eax,%ebx
+      int cc = write(fd, buf, 512);
+    3cb2:	83 ec 04             	sub    $0x4,%esp
+    3cb5:	68 00 02 00 00       	push   $0x200
+    3cba:	68 e0 99 00 00       	push   $0x99e0
+    3cbf:	57                   	push   %edi
+    3cc0:	e8 28 08 00 00       	call   44ed <write>
+      if(cc < 512)
+    3cc5:	83 c4 10             	add    $0x10,%esp
+    3cc8:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    3ccd:	7f e1                	jg     3cb0 <fsfull+0xc0>
+    printf(1, "wrote %d bytes\n", total);
+    3ccf:	83 ec 04             	sub    $0x4,%esp
+    3cd2:	53                   	push   %ebx
+    3cd3:	68 c2 5d 00 00       	push   $0x5dc2
+    3cd8:	6a 01                	push   $0x1
+    3cda:	e8 31 0c 00 00       	call   4910 <printf>
+    close(fd);
+    3cdf:	89 3c 24             	mov    %edi,(%esp)
+    3ce2:	e8 23 08 00 00       	call   450a <close>
+    if(total == 0)
+    3ce7:	83 c4 10             	add    $0x10,%esp
+    3cea:	85 db                	test   %ebx,%ebx
+    3cec:	74 1e                	je     3d0c <fsfull+0x11c>
+  for(nfiles = 0; ; nfiles++){
+    3cee:	83 c6 01             	add    $0x1,%esi
+    3cf1:	e9 1a ff ff ff       	jmp    3c10 <fsfull+0x20>
+      printf(1, "open %s failed\n", name);
+    3cf6:	83 ec 04             	sub    $0x4,%esp
+    3cf9:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3cfc:	50                   	push   %eax
+    3cfd:	68 b2 5d 00 00       	push   $0x5db2
+    3d02:	6a 01                	push   $0x1
+    3d04:	e8 07 0c 00 00       	call   4910 <printf>
+      break;
+    3d09:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + nfiles / 1000;
+    3d0c:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3d11:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+    3d16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3d1d:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    3d20:	89 f0                	mov    %esi,%eax
+    unlink(name);
+    3d22:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+    3d25:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3d29:	f7 e7                	mul    %edi
+    name[5] = '\0';
+    3d2b:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3d2f:	c1 ea 06             	shr    $0x6,%edx
+    3d32:	8d 42 30             	lea    0x30(%edx),%eax
+    3d35:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3d38:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    3d3e:	89 f2                	mov    %esi,%edx
+    3d40:	29 c2                	sub    %eax,%edx
+    3d42:	89 d0                	mov    %edx,%eax
+    3d44:	f7 e3                	mul    %ebx
+    name[3] = '0' + (nfiles % 100) / 10;
+    3d46:	89 f0                	mov    %esi,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3d48:	c1 ea 05             	shr    $0x5,%edx
+    3d4b:	83 c2 30             	add    $0x30,%edx
+    3d4e:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    3d51:	f7 e3                	mul    %ebx
+    3d53:	c1 ea 05             	shr    $0x5,%edx
+    3d56:	6b ca 64             	imul   $0x64,%edx,%ecx
+    3d59:	89 f2                	mov    %esi,%edx
+    3d5b:	29 ca                	sub    %ecx,%edx
+    3d5d:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    3d62:	89 d0                	mov    %edx,%eax
+    3d64:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    3d66:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    3d68:	c1 ea 03             	shr    $0x3,%edx
+    3d6b:	83 c2 30             	add    $0x30,%edx
+    3d6e:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    3d71:	f7 e1                	mul    %ecx
+    3d73:	89 f0                	mov    %esi,%eax
+    nfiles--;
+    3d75:	83 ee 01             	sub    $0x1,%esi
+    name[4] = '0' + (nfiles % 10);
+    3d78:	c1 ea 03             	shr    $0x3,%edx
+    3d7b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    3d7e:	01 d2                	add    %edx,%edx
+    3d80:	29 d0                	sub    %edx,%eax
+    3d82:	83 c0 30             	add    $0x30,%eax
+    3d85:	88 45 ac             	mov    %al,-0x54(%ebp)
+    unlink(name);
+    3d88:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3d8b:	50                   	push   %eax
+    3d8c:	e8 0a 08 00 00       	call   459b <unlink>
+  while(nfiles >= 0){
+    3d91:	83 c4 10             	add    $0x10,%esp
+    3d94:	83 fe ff             	cmp    $0xffffffff,%esi
+    3d97:	75 87                	jne    3d20 <fsfull+0x130>
+  printf(1, "fsfull test finished\n");
+    3d99:	83 ec 08             	sub    $0x8,%esp
+    3d9c:	68 d2 5d 00 00       	push   $0x5dd2
+    3da1:	6a 01                	push   $0x1
+    3da3:	e8 68 0b 00 00       	call   4910 <printf>
+}
+    3da8:	83 c4 10             	add    $0x10,%esp
+    3dab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3dae:	5b                   	pop    %ebx
+    3daf:	5e                   	pop    %esi
+    3db0:	5f                   	pop    %edi
+    3db1:	5d                   	pop    %ebp
+    3db2:	c3                   	ret
+    3db3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3dba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003dc0 <uio>:
+{
+    3dc0:	55                   	push   %ebp
+    3dc1:	89 e5                	mov    %esp,%ebp
+    3dc3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "uio test\n");
+    3dc6:	68 e8 5d 00 00       	push   $0x5de8
+    3dcb:	6a 01                	push   $0x1
+    3dcd:	e8 3e 0b 00 00       	call   4910 <printf>
+  pid = fork();
+    3dd2:	e8 85 06 00 00       	call   445c <fork>
+  if(pid == 0){
+    3dd7:	83 c4 10             	add    $0x10,%esp
+    3dda:	85 c0                	test   %eax,%eax
+    3ddc:	74 1b                	je     3df9 <uio+0x39>
+  } else if(pid < 0){
+    3dde:	78 3d                	js     3e1d <uio+0x5d>
+  wait();
+    3de0:	e8 b1 06 00 00       	call   4496 <wait>
+  printf(1, "uio test done\n");
+    3de5:	83 ec 08             	sub    $0x8,%esp
+    3de8:	68 f2 5d 00 00       	push   $0x5df2
+    3ded:	6a 01                	push   $0x1
+    3def:	e8 1c 0b 00 00       	call   4910 <printf>
+}
+    3df4:	83 c4 10             	add    $0x10,%esp
+    3df7:	c9                   	leave
+    3df8:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    3df9:	b8 09 00 00 00       	mov    $0x9,%eax
+    3dfe:	ba 70 00 00 00       	mov    $0x70,%edx
+    3e03:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    3e04:	ba 71 00 00 00       	mov    $0x71,%edx
+    3e09:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    3e0a:	52                   	push   %edx
+    3e0b:	52                   	push   %edx
+    3e0c:	68 b8 66 00 00       	push   $0x66b8
+    3e11:	6a 01                	push   $0x1
+    3e13:	e8 f8 0a 00 00       	call   4910 <printf>
+    exit();
+    3e18:	e8 5c 06 00 00       	call   4479 <exit>
+    printf (1, "fork failed\n");
+    3e1d:	50                   	push   %eax
+    3e1e:	50                   	push   %eax
+    3e1f:	68 77 5d 00 00       	push   $0x5d77
+    3e24:	6a 01                	push   $0x1
+    3e26:	e8 e5 0a 00 00       	call   4910 <printf>
+    exit();
+    3e2b:	e8 49 06 00 00       	call   4479 <exit>
+
+00003e30 <bcachecheck>:
+{
+    3e30:	55                   	push   %ebp
+    3e31:	89 e5                	mov    %esp,%ebp
+    3e33:	56                   	push   %esi
+    3e34:	53                   	push   %ebx
+  for(i = 0; i < 80; i++){
+    3e35:	31 db                	xor    %ebx,%ebx
+  fd = open("bcfile", 0);
+    3e37:	83 ec 08             	sub    $0x8,%esp
+    3e3a:	6a 00                	push   $0x0
+    3e3c:	68 01 5e 00 00       	push   $0x5e01
+    3e41:	e8 1b 07 00 00       	call   4561 <open>
+    3e46:	83 c4 10             	add    $0x10,%esp
+    3e49:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 80; i++){
+    3e4b:	eb 21                	jmp    3e6e <bcachecheck+0x3e>
+    3e4d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(read(fd, buf, BSIZE) != BSIZE || buf[0] != i || buf[BSIZE-1] != i){
+    3e50:	0f be 05 e0 99 00 00 	movsbl 0x99e0,%eax
+    3e57:	39 d8                	cmp    %ebx,%eax
+    3e59:	75 30                	jne    3e8b <bcachecheck+0x5b>
+    3e5b:	0f be 05 df 9b 00 00 	movsbl 0x9bdf,%eax
+    3e62:	39 d8                	cmp    %ebx,%eax
+    3e64:	75 25                	jne    3e8b <bcachecheck+0x5b>
+  for(i = 0; i < 80; i++){
+    3e66:	83 c3 01             	add    $0x1,%ebx
+    3e69:	83 fb 50             	cmp    $0x50,%ebx
+    3e6c:	74 3a                	je     3ea8 <bcachecheck+0x78>
+    if(read(fd, buf, BSIZE) != BSIZE || buf[0] != i || buf[BSIZE-1] != i){
+    3e6e:	83 ec 04             	sub    $0x4,%esp
+    3e71:	68 00 02 00 00       	push   $0x200
+    3e76:	68 e0 99 00 00       	push   $0x99e0
+    3e7b:	56                   	push   %esi
+    3e7c:	e8 4f 06 00 00       	call   44d0 <read>
+    3e81:	83 c4 10             	add    $0x10,%esp
+    3e84:	3d 00 02 00 00       	cmp    $0x200,%eax
+    3e89:	74 c5                	je     3e50 <bcachecheck+0x20>
+      close(fd);
+    3e8b:	83 ec 0c             	sub    $0xc,%esp
+    3e8e:	56                   	push   %esi
+    3e8f:	e8 76 06 00 00       	call   450a <close>
+      return -1;
+    3e94:	83 c4 10             	add    $0x10,%esp
+}
+    3e97:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return -1;
+    3e9a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    3e9f:	5b                   	pop    %ebx
+    3ea0:	5e                   	pop    %esi
+    3ea1:	5d                   	pop    %ebp
+    3ea2:	c3                   	ret
+    3ea3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3ea7:	90                   	nop
+  close(fd);
+    3ea8:	83 ec 0c             	sub    $0xc,%esp
+    3eab:	56                   	push   %esi
+    3eac:	e8 59 06 00 00       	call   450a <close>
+  return 0;
+    3eb1:	83 c4 10             	add    $0x10,%esp
+}
+    3eb4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  return 0;
+    3eb7:	31 c0                	xor    %eax,%eax
+}
+    3eb9:	5b                   	pop    %ebx
+    3eba:	5e                   	pop    %esi
+    3ebb:	5d                   	pop    %ebp
+    3ebc:	c3                   	ret
+    3ebd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003ec0 <bcachetest>:
+{
+    3ec0:	55                   	push   %ebp
+    3ec1:	89 e5                	mov    %esp,%ebp
+    3ec3:	56                   	push   %esi
+    3ec4:	53                   	push   %ebx
+  for(i = 0; i < 80; i++){
+    3ec5:	31 db                	xor    %ebx,%ebx
+{
+    3ec7:	83 ec 18             	sub    $0x18,%esp
+  printf(stdout, "bcache test\n");
+    3eca:	68 08 5e 00 00       	push   $0x5e08
+    3ecf:	ff 35 98 72 00 00    	push   0x7298
+    3ed5:	e8 36 0a 00 00       	call   4910 <printf>
+  fd = open("bcfile", O_CREATE|O_RDWR);
+    3eda:	58                   	pop    %eax
+    3edb:	5a                   	pop    %edx
+    3edc:	68 02 02 00 00       	push   $0x202
+    3ee1:	68 01 5e 00 00       	push   $0x5e01
+    3ee6:	e8 76 06 00 00       	call   4561 <open>
+    3eeb:	83 c4 10             	add    $0x10,%esp
+    3eee:	89 c6                	mov    %eax,%esi
+    memset(buf, i, BSIZE);
+    3ef0:	83 ec 04             	sub    $0x4,%esp
+    3ef3:	68 00 02 00 00       	push   $0x200
+    3ef8:	53                   	push   %ebx
+    3ef9:	68 e0 99 00 00       	push   $0x99e0
+    3efe:	e8 3d 03 00 00       	call   4240 <memset>
+    if(write(fd, buf, BSIZE) != BSIZE){
+    3f03:	83 c4 0c             	add    $0xc,%esp
+    3f06:	68 00 02 00 00       	push   $0x200
+    3f0b:	68 e0 99 00 00       	push   $0x99e0
+    3f10:	56                   	push   %esi
+    3f11:	e8 d7 05 00 00       	call   44ed <write>
+    3f16:	83 c4 10             	add    $0x10,%esp
+    3f19:	3d 00 02 00 00       	cmp    $0x200,%eax
+    3f1e:	0f 85 c2 00 00 00    	jne    3fe6 <bcachetest+0x126>
+  for(i = 0; i < 80; i++){
+    3f24:	83 c3 01             	add    $0x1,%ebx
+    3f27:	83 fb 50             	cmp    $0x50,%ebx
+    3f2a:	75 c4                	jne    3ef0 <bcachetest+0x30>
+  close(fd);
+    3f2c:	83 ec 0c             	sub    $0xc,%esp
+    3f2f:	56                   	push   %esi
+    3f30:	e8 d5 05 00 00       	call   450a <close>
+  diskstat(&ds);
+    3f35:	c7 04 24 e0 b9 00 00 	movl   $0xb9e0,(%esp)
+    3f3c:	e8 12 09 00 00       	call   4853 <diskstat>
+  grown = ds.nbuf;
+    3f41:	8b 1d 5c ba 00 00    	mov    0xba5c,%ebx
+  if(grown <= NBUF){
+    3f47:	83 c4 10             	add    $0x10,%esp
+    3f4a:	83 fb 28             	cmp    $0x28,%ebx
+    3f4d:	0f 8e 7f 01 00 00    	jle    40d2 <bcachetest+0x212>
+  if(pipe(fds) != 0){
+    3f53:	83 ec 0c             	sub    $0xc,%esp
+    3f56:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    3f59:	50                   	push   %eax
+    3f5a:	e8 54 05 00 00       	call   44b3 <pipe>
+    3f5f:	83 c4 10             	add    $0x10,%esp
+    3f62:	85 c0                	test   %eax,%eax
+    3f64:	0f 85 51 01 00 00    	jne    40bb <bcachetest+0x1fb>
+  pid = fork();
+    3f6a:	e8 ed 04 00 00       	call   445c <fork>
+  if(pid < 0){
+    3f6f:	85 c0                	test   %eax,%eax
+    3f71:	0f 88 18 01 00 00    	js     408f <bcachetest+0x1cf>
+  if(pid == 0){
+    3f77:	0f 84 af 00 00 00    	je     402c <bcachetest+0x16c>
+  close(fds[1]);
+    3f7d:	83 ec 0c             	sub    $0xc,%esp
+    3f80:	ff 75 f4             	push   -0xc(%ebp)
+    3f83:	e8 82 05 00 00       	call   450a <close>
+  if(read(fds[0], &c, 1) != 1){
+    3f88:	83 c4 0c             	add    $0xc,%esp
+    3f8b:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    3f8e:	6a 01                	push   $0x1
+    3f90:	50                   	push   %eax
+    3f91:	ff 75 f0             	push   -0x10(%ebp)
+    3f94:	e8 37 05 00 00       	call   44d0 <read>
+    3f99:	83 c4 10             	add    $0x10,%esp
+    3f9c:	83 f8 01             	cmp    $0x1,%eax
+    3f9f:	75 74                	jne    4015 <bcachetest+0x155>
+  close(fds[0]);
+    3fa1:	83 ec 0c             	sub    $0xc,%esp
+    3fa4:	ff 75 f0             	push   -0x10(%ebp)
+    3fa7:	e8 5e 05 00 00       	call   450a <close>
+  wait();
+    3fac:	e8 e5 04 00 00       	call   4496 <wait>
+  if(bcachecheck() < 0){
+    3fb1:	e8 7a fe ff ff       	call   3e30 <bcachecheck>
+    3fb6:	83 c4 10             	add    $0x10,%esp
+    3fb9:	85 c0                	test   %eax,%eax
+    3fbb:	78 41                	js     3ffe <bcachetest+0x13e>
+  unlink("bcfile");
+    3fbd:	83 ec 0c             	sub    $0xc,%esp
+    3fc0:	68 01 5e 00 00       	push   $0x5e01
+    3fc5:	e8 d1 05 00 00       	call   459b <unlink>
+  printf(stdout, "bcache test OK\n");
+    3fca:	58                   	pop    %eax
+    3fcb:	5a                   	pop    %edx
+    3fcc:	68 61 5e 00 00       	push   $0x5e61
+    3fd1:	ff 35 98 72 00 00    	push   0x7298
+    3fd7:	e8 34 09 00 00       	call   4910 <printf>
+}
+    3fdc:	83 c4 10             	add    $0x10,%esp
+    3fdf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3fe2:	5b                   	pop    %ebx
+    3fe3:	5e                   	pop    %esi
+    3fe4:	5d                   	pop    %ebp
+    3fe5:	c3                   	ret
+      printf(stdout, "bcache test write failed\n");
+    3fe6:	83 ec 08             	sub    $0x8,%esp
+    3fe9:	68 15 5e 00 00       	push   $0x5e15
+    3fee:	ff 35 98 72 00 00    	push   0x7298
+    3ff4:	e8 17 09 00 00       	call   4910 <printf>
+      exit();
+    3ff9:	e8 7b 04 00 00       	call   4479 <exit>
+    printf(stdout, "bcache test failed after memory was freed\n");
+    3ffe:	51                   	push   %ecx
+    3fff:	51                   	push   %ecx
+    4000:	68 58 67 00 00       	push   $0x6758
+    4005:	ff 35 98 72 00 00    	push   0x7298
+    400b:	e8 00 09 00 00       	call   4910 <printf>
+    exit();
+    4010:	e8 64 04 00 00       	call   4479 <exit>
+    printf(stdout, "bcache test failed with memory full\n");
+    4015:	53                   	push   %ebx
+    4016:	53                   	push   %ebx
+    4017:	68 30 67 00 00       	push   $0x6730
+    401c:	ff 35 98 72 00 00    	push   0x7298
+    4022:	e8 e9 08 00 00       	call   4910 <printf>
+    exit();
+    4027:	e8 4d 04 00 00       	call   4479 <exit>
+    close(fds[0]);
+    402c:	83 ec 0c             	sub    $0xc,%esp
+    402f:	ff 75 f0             	push   -0x10(%ebp)
+    4032:	e8 d3 04 00 00       	call   450a <close>
+    while(sbrk(4096) != (char*)-1)
+    4037:	83 c4 10             	add    $0x10,%esp
+    403a:	83 ec 0c             	sub    $0xc,%esp
+    403d:	68 00 10 00 00       	push   $0x1000
+    4042:	e8 1f 06 00 00       	call   4666 <sbrk>
+    4047:	83 c4 10             	add    $0x10,%esp
+    404a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    404d:	75 eb                	jne    403a <bcachetest+0x17a>
+    diskstat(&ds);
+    404f:	83 ec 0c             	sub    $0xc,%esp
+    4052:	68 e0 b9 00 00       	push   $0xb9e0
+    4057:	e8 f7 07 00 00       	call   4853 <diskstat>
+    if(ds.nbuf < grown && bcachecheck() == 0)
+    405c:	83 c4 10             	add    $0x10,%esp
+    405f:	39 1d 5c ba 00 00    	cmp    %ebx,0xba5c
+    4065:	73 09                	jae    4070 <bcachetest+0x1b0>
+    4067:	e8 c4 fd ff ff       	call   3e30 <bcachecheck>
+    406c:	85 c0                	test   %eax,%eax
+    406e:	74 36                	je     40a6 <bcachetest+0x1e6>
+      printf(stdout, "bcache %d buffers with memory full, %d before\n", ds.nbuf, grown);
+    4070:	53                   	push   %ebx
+    4071:	ff 35 5c ba 00 00    	push   0xba5c
+    4077:	68 00 67 00 00       	push   $0x6700
+    407c:	ff 35 98 72 00 00    	push   0x7298
+    4082:	e8 89 08 00 00       	call   4910 <printf>
+    4087:	83 c4 10             	add    $0x10,%esp
+    exit();
+    408a:	e8 ea 03 00 00       	call   4479 <exit>
+    printf(stdout, "bcache test fork failed\n");
+    408f:	50                   	push   %eax
+    4090:	50                   	push   %eax
+    4091:	68 48 5e 00 00       	push   $0x5e48
+    4096:	ff 35 98 72 00 00    	push   0x7298
+    409c:	e8 6f 08 00 00       	call   4910 <printf>
+    exit();
+    40a1:	e8 d3 03 00 00       	call   4479 <exit>
+      write(fds[1], "x", 1);
+    40a6:	56                   	push   %esi
+    40a7:	6a 01                	push   $0x1
+    40a9:	68 82 55 00 00       	push   $0x5582
+    40ae:	ff 75 f4             	push   -0xc(%ebp)
+    40b1:	e8 37 04 00 00       	call   44ed <write>
+    40b6:	83 c4 10             	add    $0x10,%esp
+    40b9:	eb cf                	jmp    408a <bcachetest+0x1ca>
+    printf(stdout, "bcache test pipe failed\n");
+    40bb:	50                   	push   %eax
+    40bc:	50                   	push   %eax
+    40bd:	68 2f 5e 00 00       	push   $0x5e2f
+    40c2:	ff 35 98 72 00 00    	push   0x7298
+    40c8:	e8 43 08 00 00       	call   4910 <printf>
+    exit();
+    40cd:	e8 a7 03 00 00       	call   4479 <exit>
+    printf(stdout, "bcache did not grow: %d buffers\n", grown);
+    40d2:	50                   	push   %eax
+    40d3:	53                   	push   %ebx
+    40d4:	68 dc 66 00 00       	push   $0x66dc
+    40d9:	ff 35 98 72 00 00    	push   0x7298
+    40df:	e8 2c 08 00 00       	call   4910 <printf>
+    exit();
+    40e4:	e8 90 03 00 00       	call   4479 <exit>
+    40e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000040f0 <argptest>:
+{
+    40f0:	55                   	push   %ebp
+    40f1:	89 e5                	mov    %esp,%ebp
+    40f3:	53                   	push   %ebx
+    40f4:	83 ec 0c             	sub    $0xc,%esp
+  fd = open("init", O_RDONLY);
+    40f7:	6a 00                	push   $0x0
+    40f9:	68 71 5e 00 00       	push   $0x5e71
+    40fe:	e8 5e 04 00 00       	call   4561 <open>
+  if (fd < 0) {
+    4103:	83 c4 10             	add    $0x10,%esp
+    4106:	85 c0                	test   %eax,%eax
+    4108:	78 39                	js     4143 <argptest+0x53>
+  read(fd, sbrk(0) - 1, -1);
+    410a:	83 ec 0c             	sub    $0xc,%esp
+    410d:	89 c3                	mov    %eax,%ebx
+    410f:	6a 00                	push   $0x0
+    4111:	e8 50 05 00 00       	call   4666 <sbrk>
+    4116:	83 c4 0c             	add    $0xc,%esp
+    4119:	83 e8 01             	sub    $0x1,%eax
+    411c:	6a ff                	push   $0xffffffff
+    411e:	50                   	push   %eax
+    411f:	53                   	push   %ebx
+    4120:	e8 ab 03 00 00       	call   44d0 <read>
+  close(fd);
+    4125:	89 1c 24             	mov    %ebx,(%esp)
+    4128:	e8 dd 03 00 00       	call   450a <close>
+  printf(1, "arg test passed\n");
+    412d:	58                   	pop    %eax
+    412e:	5a                   	pop    %edx
+    412f:	68 83 5e 00 00       	push   $0x5e83
+    4134:	6a 01                	push   $0x1
+    4136:	e8 d5 07 00 00       	call   4910 <printf>
+}
+    413b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    413e:	83 c4 10             	add    $0x10,%esp
+    4141:	c9                   	leave
+    4142:	c3                   	ret
+    printf(2, "open failed\n");
+    4143:	51                   	push   %ecx
+    4144:	51                   	push   %ecx
+    4145:	68 76 5e 00 00       	push   $0x5e76
+    414a:	6a 02                	push   $0x2
+    414c:	e8 bf 07 00 00       	call   4910 <printf>
+    exit();
+    4151:	e8 23 03 00 00       	call   4479 <exit>
+    4156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    415d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004160 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+    4160:	69 05 94 72 00 00 0d 	imul   $0x19660d,0x7294,%eax
+    4167:	66 19 00 
+    416a:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    416f:	a3 94 72 00 00       	mov    %eax,0x7294
+}
+    4174:	c3                   	ret
+    4175:	66 90                	xchg   %ax,%ax
+    4177:	66 90                	xchg   %ax,%ax
+    4179:	66 90                	xchg   %ax,%ax
+    417b:	66 90                	xchg   %ax,%ax
+    417d:	66 90                	xchg   %ax,%ax
+    417f:	90                   	nop
+
+00004180 <strcpy>:
+#include "date.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    4180:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    4181:	31 c0                	xor    %eax,%eax
+{
+    4183:	89 e5                	mov    %esp,%ebp
+    4185:	53                   	push   %ebx
+    4186:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    4189:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    418c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    4190:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    4194:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    4197:	83 c0 01             	add    $0x1,%eax
+    419a:	84 d2                	test   %dl,%dl
+    419c:	75 f2                	jne    4190 <strcpy+0x10>
+    ;
+  return os;
+}
+    419e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    41a1:	89 c8                	mov    %ecx,%eax
+    41a3:	c9                   	leave
+    41a4:	c3                   	ret
+    41a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    41ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000041b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    41b0:	55                   	push   %ebp
+    41b1:	89 e5                	mov    %esp,%ebp
+    41b3:	53                   	push   %ebx
+    41b4:	8b 55 08             	mov    0x8(%ebp),%edx
+    41b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    41ba:	0f b6 02             	movzbl (%edx),%eax
+    41bd:	84 c0                	test   %al,%al
+    41bf:	75 17                	jne    41d8 <strcmp+0x28>
+    41c1:	eb 3a                	jmp    41fd <strcmp+0x4d>
+    41c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    41c7:	90                   	nop
+    41c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    41cc:	83 c2 01             	add    $0x1,%edx
+    41cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    41d2:	84 c0                	test   %al,%al
+    41d4:	74 1a                	je     41f0 <strcmp+0x40>
+    p++, q++;
+    41d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    41d8:	0f b6 19             	movzbl (%ecx),%ebx
+    41db:	38 c3                	cmp    %al,%bl
+    41dd:	74 e9                	je     41c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    41df:	29 d8                	sub    %ebx,%eax
+}
+    41e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    41e4:	c9                   	leave
+    41e5:	c3                   	ret
+    41e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    41ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    41f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    41f4:	31 c0                	xor    %eax,%eax
+    41f6:	29 d8                	sub    %ebx,%eax
+}
+    41f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    41fb:	c9                   	leave
+    41fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    41fd:	0f b6 19             	movzbl (%ecx),%ebx
+    4200:	31 c0                	xor    %eax,%eax
+    4202:	eb db                	jmp    41df <strcmp+0x2f>
+    4204:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    420b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    420f:	90                   	nop
+
+00004210 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    4210:	55                   	push   %ebp
+    4211:	89 e5                	mov    %esp,%ebp
+    4213:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    4216:	80 3a 00             	cmpb   $0x0,(%edx)
+    4219:	74 15                	je     4230 <strlen+0x20>
+    421b:	31 c0                	xor    %eax,%eax
+    421d:	8d 76 00             	lea    0x0(%esi),%esi
+    4220:	83 c0 01             	add    $0x1,%eax
+    4223:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    4227:	89 c1                	mov    %eax,%ecx
+    4229:	75 f5                	jne    4220 <strlen+0x10>
+    ;
+  return n;
+}
+    422b:	89 c8                	mov    %ecx,%eax
+    422d:	5d                   	pop    %ebp
+    422e:	c3                   	ret
+    422f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    4230:	31 c9                	xor    %ecx,%ecx
+}
+    4232:	5d                   	pop    %ebp
+    4233:	89 c8                	mov    %ecx,%eax
+    4235:	c3                   	ret
+    4236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    423d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004240 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    4240:	55                   	push   %ebp
+    4241:	89 e5                	mov    %esp,%ebp
+    4243:	57                   	push   %edi
+    4244:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    4247:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    424a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    424d:	89 d7                	mov    %edx,%edi
+    424f:	fc                   	cld
+    4250:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    4252:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    4255:	89 d0                	mov    %edx,%eax
+    4257:	c9                   	leave
+    4258:	c3                   	ret
+    4259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00004260 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    4260:	55                   	push   %ebp
+    4261:	89 e5                	mov    %esp,%ebp
+    4263:	8b 45 08             	mov    0x8(%ebp),%eax
+    4266:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    426a:	0f b6 10             	movzbl (%eax),%edx
+    426d:	84 d2                	test   %dl,%dl
+    426f:	75 12                	jne    4283 <strchr+0x23>
+    4271:	eb 1d                	jmp    4290 <strchr+0x30>
+    4273:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4277:	90                   	nop
+    4278:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    427c:	83 c0 01             	add    $0x1,%eax
+    427f:	84 d2                	test   %dl,%dl
+    4281:	74 0d                	je     4290 <strchr+0x30>
+    if(*s == c)
+    4283:	38 d1                	cmp    %dl,%cl
+    4285:	75 f1                	jne    4278 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    4287:	5d                   	pop    %ebp
+    4288:	c3                   	ret
+    4289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    4290:	31 c0                	xor    %eax,%eax
+}
+    4292:	5d                   	pop    %ebp
+    4293:	c3                   	ret
+    4294:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    429b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    429f:	90                   	nop
+
+000042a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    42a0:	55                   	push   %ebp
+    42a1:	89 e5                	mov    %esp,%ebp
+    42a3:	57                   	push   %edi
+    42a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    42a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    42a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    42a9:	31 db                	xor    %ebx,%ebx
+{
+    42ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    42ae:	eb 27                	jmp    42d7 <gets+0x37>
+    cc = read(0, &c, 1);
+    42b0:	83 ec 04             	sub    $0x4,%esp
+    42b3:	6a 01                	push   $0x1
+    42b5:	56                   	push   %esi
+    42b6:	6a 00                	push   $0x0
+    42b8:	e8 13 02 00 00       	call   44d0 <read>
+    if(cc < 1)
+    42bd:	83 c4 10             	add    $0x10,%esp
+    42c0:	85 c0                	test   %eax,%eax
+    42c2:	7e 1d                	jle    42e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+    42c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    42c8:	8b 55 08             	mov    0x8(%ebp),%edx
+    42cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    42cf:	3c 0a                	cmp    $0xa,%al
+    42d1:	74 10                	je     42e3 <gets+0x43>
+    42d3:	3c 0d                	cmp    $0xd,%al
+    42d5:	74 0c                	je     42e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    42d7:	89 df                	mov    %ebx,%edi
+    42d9:	83 c3 01             	add    $0x1,%ebx
+    42dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    42df:	7c cf                	jl     42b0 <gets+0x10>
+    42e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    42e3:	8b 45 08             	mov    0x8(%ebp),%eax
+    42e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    42ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    42ed:	5b                   	pop    %ebx
+    42ee:	5e                   	pop    %esi
+    42ef:	5f                   	pop    %edi
+    42f0:	5d                   	pop    %ebp
+    42f1:	c3                   	ret
+    42f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    42f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00004300 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    4300:	55                   	push   %ebp
+    4301:	89 e5                	mov    %esp,%ebp
+    4303:	56                   	push   %esi
+    4304:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    4305:	83 ec 08             	sub    $0x8,%esp
+    4308:	6a 00                	push   $0x0
+    430a:	ff 75 08             	push   0x8(%ebp)
+    430d:	e8 4f 02 00 00       	call   4561 <open>
+  if(fd < 0)
+    4312:	83 c4 10             	add    $0x10,%esp
+    4315:	85 c0                	test   %eax,%eax
+    4317:	78 27                	js     4340 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    4319:	83 ec 08             	sub    $0x8,%esp
+    431c:	ff 75 0c             	push   0xc(%ebp)
+    431f:	89 c3                	mov    %eax,%ebx
+    4321:	50                   	push   %eax
+    4322:	e8 91 02 00 00       	call   45b8 <fstat>
+  close(fd);
+    4327:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    432a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    432c:	e8 d9 01 00 00       	call   450a <close>
+  return r;
+    4331:	83 c4 10             	add    $0x10,%esp
+}
+    4334:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    4337:	89 f0                	mov    %esi,%eax
+    4339:	5b                   	pop    %ebx
+    433a:	5e                   	pop    %esi
+    433b:	5d                   	pop    %ebp
+    433c:	c3                   	ret
+    433d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    4340:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    4345:	eb ed                	jmp    4334 <stat+0x34>
+    4347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    434e:	66 90                	xchg   %ax,%ax
+
+00004350 <atoi>:
+
+int
+atoi(const char *s)
+{
+    4350:	55                   	push   %ebp
+    4351:	89 e5                	mov    %esp,%ebp
+    4353:	53                   	push   %ebx
+    4354:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    4357:	0f be 02             	movsbl (%edx),%eax
+    435a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    435d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    4360:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    4365:	77 1e                	ja     4385 <atoi+0x35>
+    4367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    436e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    4370:	83 c2 01             	add    $0x1,%edx
+    4373:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    4376:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    437a:	0f be 02             	movsbl (%edx),%eax
+    437d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    4380:	80 fb 09             	cmp    $0x9,%bl
+    4383:	76 eb                	jbe    4370 <atoi+0x20>
+  return n;
+}
+    4385:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4388:	89 c8                	mov    %ecx,%eax
+    438a:	c9                   	leave
+    438b:	c3                   	ret
+    438c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004390 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    4390:	55                   	push   %ebp
+    4391:	89 e5                	mov    %esp,%ebp
+    4393:	57                   	push   %edi
+    4394:	56                   	push   %esi
+    4395:	8b 45 10             	mov    0x10(%ebp),%eax
+    4398:	8b 55 08             	mov    0x8(%ebp),%edx
+    439b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    439e:	85 c0                	test   %eax,%eax
+    43a0:	7e 13                	jle    43b5 <memmove+0x25>
+    43a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    43a4:	89 d7                	mov    %edx,%edi
+    43a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    43ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    43b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    43b1:	39 f8                	cmp    %edi,%eax
+    43b3:	75 fb                	jne    43b0 <memmove+0x20>
+  return vdst;
+}
+    43b5:	5e                   	pop    %esi
+    43b6:	89 d0                	mov    %edx,%eax
+    43b8:	5f                   	pop    %edi
+    43b9:	5d                   	pop    %ebp
+    43ba:	c3                   	ret
+    43bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    43bf:	90                   	nop
+
+000043c0 <ugetpid>:
+// getpid() without a system call, from the page at UPROC.
+int
+ugetpid(void)
+{
+  return ((struct uproc*)UPROC)->pid;
+}
+    43c0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+    43c5:	c3                   	ret
+    43c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    43cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000043d0 <uclocktime>:
+
+// clocktime() without a system call, from the page at UCLOCK.
+int
+uclocktime(struct timespec *ts)
+{
+    43d0:	55                   	push   %ebp
+    43d1:	89 e5                	mov    %esp,%ebp
+    43d3:	57                   	push   %edi
+    43d4:	56                   	push   %esi
+    43d5:	53                   	push   %ebx
+    43d6:	83 ec 1c             	sub    $0x1c,%esp
+  struct uclock *c = (struct uclock*)UCLOCK;
+
+  if(c->tscmult == 0)
+    43d9:	8b 0d 08 f0 ff 7f    	mov    0x7ffff008,%ecx
+{
+    43df:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(c->tscmult == 0)
+    43e2:	85 c9                	test   %ecx,%ecx
+    43e4:	74 6a                	je     4450 <uclocktime+0x80>
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+    43e6:	0f 31                	rdtsc
+static inline void
+uclockread(struct uclock *c, uint64 tsc, struct timespec *ts)
+{
+  uint64 d, ns;
+
+  d = tsc - c->tscbase;
+    43e8:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+    43ee:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+    43f4:	89 c6                	mov    %eax,%esi
+  if((long long)d < 0)  // another CPU's TSC is a little behind
+    43f6:	85 d2                	test   %edx,%edx
+    43f8:	78 46                	js     4440 <uclocktime+0x70>
+    d = 0;
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+    43fa:	89 d0                	mov    %edx,%eax
+    43fc:	f7 e1                	mul    %ecx
+    43fe:	0f a4 c2 08          	shld   $0x8,%eax,%edx
+    4402:	c1 e0 08             	shl    $0x8,%eax
+    4405:	89 45 e0             	mov    %eax,-0x20(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+    4408:	89 f0                	mov    %esi,%eax
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+    440a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+    440d:	f7 e1                	mul    %ecx
+    440f:	0f ac d0 18          	shrd   $0x18,%edx,%eax
+    4413:	c1 ea 18             	shr    $0x18,%edx
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+    4416:	03 45 e0             	add    -0x20(%ebp),%eax
+    4419:	13 55 e4             	adc    -0x1c(%ebp),%edx
+// linked with libgcc, so it cannot use 64-bit '/' or '%'.
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+  asm("divl %4" : "=a" (q), "=d" (r) : "a" ((uint)n), "d" ((uint)(n>>32)), "rm" (d));
+    441c:	89 c7                	mov    %eax,%edi
+    441e:	89 f8                	mov    %edi,%eax
+    4420:	b9 00 ca 9a 3b       	mov    $0x3b9aca00,%ecx
+    4425:	f7 f1                	div    %ecx
+  ts->sec = divl(ns, 1000000000, &ts->nsec);
+    4427:	89 03                	mov    %eax,(%ebx)
+    return clocktime(ts);
+  uclockread(c, rdtsc(), ts);
+  return 0;
+}
+    4429:	31 c0                	xor    %eax,%eax
+  *rem = r;
+    442b:	89 53 04             	mov    %edx,0x4(%ebx)
+    442e:	83 c4 1c             	add    $0x1c,%esp
+    4431:	5b                   	pop    %ebx
+    4432:	5e                   	pop    %esi
+    4433:	5f                   	pop    %edi
+    4434:	5d                   	pop    %ebp
+    4435:	c3                   	ret
+    4436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    443d:	8d 76 00             	lea    0x0(%esi),%esi
+    4440:	31 d2                	xor    %edx,%edx
+    4442:	31 ff                	xor    %edi,%edi
+    4444:	eb d8                	jmp    441e <uclocktime+0x4e>
+    4446:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    444d:	8d 76 00             	lea    0x0(%esi),%esi
+    4450:	83 c4 1c             	add    $0x1c,%esp
+    4453:	5b                   	pop    %ebx
+    4454:	5e                   	pop    %esi
+    4455:	5f                   	pop    %edi
+    4456:	5d                   	pop    %ebp
+    return clocktime(ts);
+    4457:	e9 f2 02 00 00       	jmp    474e <clocktime>
+
+0000445c <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+    445c:	b8 01 00 00 00       	mov    $0x1,%eax
+    4461:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    4468:	00 00 00 
+    446b:	74 09                	je     4476 <fork+0x1a>
+    446d:	89 e1                	mov    %esp,%ecx
+    446f:	ba 78 44 00 00       	mov    $0x4478,%edx
+    4474:	0f 34                	sysenter
+    4476:	cd 40                	int    $0x40
+    4478:	c3                   	ret
+
+00004479 <exit>:
+SYSCALL(exit)
+    4479:	b8 02 00 00 00       	mov    $0x2,%eax
+    447e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    4485:	00 00 00 
+    4488:	74 09                	je     4493 <exit+0x1a>
+    448a:	89 e1                	mov    %esp,%ecx
+    448c:	ba 95 44 00 00       	mov    $0x4495,%edx
+    4491:	0f 34                	sysenter
+    4493:	cd 40                	int    $0x40
+    4495:	c3                   	ret
+
+00004496 <wait>:
+SYSCALL(wait)
+    4496:	b8 03 00 00 00       	mov    $0x3,%eax
+    449b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    44a2:	00 00 00 
+    44a5:	74 09                	je     44b0 <wait+0x1a>
+    44a7:	89 e1                	mov    %esp,%ecx
+    44a9:	ba b2 44 00 00       	mov    $0x44b2,%edx
+    44ae:	0f 34                	sysenter
+    44b0:	cd 40                	int    $0x40
+    44b2:	c3                   	ret
+
+000044b3 <pipe>:
+SYSCALL(pipe)
+    44b3:	b8 04 00 00 00       	mov    $0x4,%eax
+    44b8:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    44bf:	00 00 00 
+    44c2:	74 09                	je     44cd <pipe+0x1a>
+    44c4:	89 e1                	mov    %esp,%ecx
+    44c6:	ba cf 44 00 00       	mov    $0x44cf,%edx
+    44cb:	0f 34                	sysenter
+    44cd:	cd 40                	int    $0x40
+    44cf:	c3                   	ret
+
+000044d0 <read>:
+SYSCALL(read)
+    44d0:	b8 05 00 00 00       	mov    $0x5,%eax
+    44d5:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    44dc:	00 00 00 
+    44df:	74 09                	je     44ea <read+0x1a>
+    44e1:	89 e1                	mov    %esp,%ecx
+    44e3:	ba ec 44 00 00       	mov    $0x44ec,%edx
+    44e8:	0f 34                	sysenter
+    44ea:	cd 40                	int    $0x40
+    44ec:	c3                   	ret
+
+000044ed <write>:
+SYSCALL(write)
+    44ed:	b8 10 00 00 00       	mov    $0x10,%eax
+    44f2:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    44f9:	00 00 00 
+    44fc:	74 09                	je     4507 <write+0x1a>
+    44fe:	89 e1                	mov    %esp,%ecx
+    4500:	ba 09 45 00 00       	mov    $0x4509,%edx
+    4505:	0f 34                	sysenter
+    4507:	cd 40                	int    $0x40
+    4509:	c3                   	ret
+
+0000450a <close>:
+SYSCALL(close)
+    450a:	b8 15 00 00 00       	mov    $0x15,%eax
+    450f:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    4516:	00 00 00 
+    4519:	74 09                	je     4524 <close+0x1a>
+    451b:	89 e1                	mov    %esp,%ecx
+    451d:	ba 26 45 00 00       	mov    $0x4526,%edx
+    4522:	0f 34                	sysenter
+    4524:	cd 40                	int    $0x40
+    4526:	c3                   	ret
+
+00004527 <kill>:
+SYSCALL(kill)
+    4527:	b8 06 00 00 00       	mov    $0x6,%eax
+    452c:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    4533:	00 00 00 
+    4536:	74 09                	je     4541 <kill+0x1a>
+    4538:	89 e1                	mov    %esp,%ecx
+    453a:	ba 43 45 00 00       	mov    $0x4543,%edx
+    453f:	0f 34                	sysenter
+    4541:	cd 40                	int    $0x40
+    4543:	c3                   	ret
+
+00004544 <exec>:
+SYSCALL(exec)
+    4544:	b8 07 00 00 00       	mov    $0x7,%eax
+    4549:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    4550:	00 00 00 
+    4553:	74 09                	je     455e <exec+0x1a>
+    4555:	89 e1                	mov    %esp,%ecx
+    4557:	ba 60 45 00 00       	mov    $0x4560,%edx
+    455c:	0f 34                	sysenter
+    455e:	cd 40                	int    $0x40
+    4560:	c3                   	ret
+
+00004561 <open>:
+SYSCALL(open)
+    4561:	b8 0f 00 00 00       	mov    $0xf,%eax
+    4566:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    456d:	00 00 00 
+    4570:	74 09                	je     457b <open+0x1a>
+    4572:	89 e1                	mov    %esp,%ecx
+    4574:	ba 7d 45 00 00       	mov    $0x457d,%edx
+    4579:	0f 34                	sysenter
+    457b:	cd 40                	int    $0x40
+    457d:	c3                   	ret
+
+0000457e <mknod>:
+SYSCALL(mknod)
+    457e:	b8 11 00 00 00       	mov    $0x11,%eax
+    4583:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    458a:	00 00 00 
+    458d:	74 09                	je     4598 <mknod+0x1a>
+    458f:	89 e1                	mov    %esp,%ecx
+    4591:	ba 9a 45 00 00       	mov    $0x459a,%edx
+    4596:	0f 34                	sysenter
+    4598:	cd 40                	int    $0x40
+    459a:	c3                   	ret
+
+0000459b <unlink>:
+SYSCALL(unlink)
+    459b:	b8 12 00 00 00       	mov    $0x12,%eax
+    45a0:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    45a7:	00 00 00 
+    45aa:	74 09                	je     45b5 <unlink+0x1a>
+    45ac:	89 e1                	mov    %esp,%ecx
+    45ae:	ba b7 45 00 00       	mov    $0x45b7,%edx
+    45b3:	0f 34                	sysenter
+    45b5:	cd 40                	int    $0x40
+    45b7:	c3                   	ret
+
+000045b8 <fstat>:
+SYSCALL(fstat)
+    45b8:	b8 08 00 00 00       	mov    $0x8,%eax
+    45bd:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    45c4:	00 00 00 
+    45c7:	74 09                	je     45d2 <fstat+0x1a>
+    45c9:	89 e1                	mov    %esp,%ecx
+    45cb:	ba d4 45 00 00       	mov    $0x45d4,%edx
+    45d0:	0f 34                	sysenter
+    45d2:	cd 40                	int    $0x40
+    45d4:	c3                   	ret
+
+000045d5 <link>:
+SYSCALL(link)
+    45d5:	b8 13 00 00 00       	mov    $0x13,%eax
+    45da:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    45e1:	00 00 00 
+    45e4:	74 09                	je     45ef <link+0x1a>
+    45e6:	89 e1                	mov    %esp,%ecx
+    45e8:	ba f1 45 00 00       	mov    $0x45f1,%edx
+    45ed:	0f 34                	sysenter
+    45ef:	cd 40                	int    $0x40
+    45f1:	c3                   	ret
+
+000045f2 <mkdir>:
+SYSCALL(mkdir)
+    45f2:	b8 14 00 00 00       	mov    $0x14,%eax
+    45f7:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    45fe:	00 00 00 
+    4601:	74 09                	je     460c <mkdir+0x1a>
+    4603:	89 e1                	mov    %esp,%ecx
+    4605:	ba 0e 46 00 00       	mov    $0x460e,%edx
+    460a:	0f 34                	sysenter
+    460c:	cd 40                	int    $0x40
+    460e:	c3                   	ret
+
+0000460f <chdir>:
+SYSCALL(chdir)
+    460f:	b8 09 00 00 00       	mov    $0x9,%eax
+    4614:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    461b:	00 00 00 
+    461e:	74 09                	je     4629 <chdir+0x1a>
+    4620:	89 e1                	mov    %esp,%ecx
+    4622:	ba 2b 46 00 00       	mov    $0x462b,%edx
+    4627:	0f 34                	sysenter
+    4629:	cd 40                	int    $0x40
+    462b:	c3                   	ret
+
+0000462c <dup>:
+SYSCALL(dup)
+    462c:	b8 0a 00 00 00       	mov    $0xa,%eax
+    4631:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    4638:	00 00 00 
+    463b:	74 09                	je     4646 <dup+0x1a>
+    463d:	89 e1                	mov    %esp,%ecx
+    463f:	ba 48 46 00 00       	mov    $0x4648,%edx
+    4644:	0f 34                	sysenter
+    4646:	cd 40                	int    $0x40
+    4648:	c3                   	ret
+
+00004649 <getpid>:
+SYSCALL(getpid)
+    4649:	b8 0b 00 00 00       	mov    $0xb,%eax
+    464e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    4655:	00 00 00 
+    4658:	74 09                	je     4663 <getpid+0x1a>
+    465a:	89 e1                	mov    %esp,%ecx
+    465c:	ba 65 46 00 00       	mov    $0x4665,%edx
+    4661:	0f 34                	sysenter
+    4663:	cd 40                	int    $0x40
+    4665:	c3                   	ret
+
+00004666 <sbrk>:
+SYSCALL(sbrk)
+    4666:	b8 0c 00 00 00       	mov    $0xc,%eax
+    466b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    4672:	00 00 00 
+    4675:	74 09                	je     4680 <sbrk+0x1a>
+    4677:	89 e1                	mov    %esp,%ecx
+    4679:	ba 82 46 00 00       	mov    $0x4682,%edx
+    467e:	0f 34                	sysenter
+    4680:	cd 40                	int    $0x40
+    4682:	c3                   	ret
+
+00004683 <sleep>:
+SYSCALL(sleep)
+    4683:	b8 0d 00 00 00       	mov    $0xd,%eax
+    4688:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    468f:	00 00 00 
+    4692:	74 09                	je     469d <sleep+0x1a>
+    4694:	89 e1                	mov    %esp,%ecx
+    4696:	ba 9f 46 00 00       	mov    $0x469f,%edx
+    469b:	0f 34                	sysenter
+    469d:	cd 40                	int    $0x40
+    469f:	c3                   	ret
+
+000046a0 <uptime>:
+SYSCALL(uptime)
+    46a0:	b8 0e 00 00 00       	mov    $0xe,%eax
+    46a5:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    46ac:	00 00 00 
+    46af:	74 09                	je     46ba <uptime+0x1a>
+    46b1:	89 e1                	mov    %esp,%ecx
+    46b3:	ba bc 46 00 00       	mov    $0x46bc,%edx
+    46b8:	0f 34                	sysenter
+    46ba:	cd 40                	int    $0x40
+    46bc:	c3                   	ret
+
+000046bd <swapread>:
+SYSCALL(swapread)
+    46bd:	b8 16 00 00 00       	mov    $0x16,%eax
+    46c2:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    46c9:	00 00 00 
+    46cc:	74 09                	je     46d7 <swapread+0x1a>
+    46ce:	89 e1                	mov    %esp,%ecx
+    46d0:	ba d9 46 00 00       	mov    $0x46d9,%edx
+    46d5:	0f 34                	sysenter
+    46d7:	cd 40                	int    $0x40
+    46d9:	c3                   	ret
+
+000046da <swapwrite>:
+SYSCALL(swapwrite)
+    46da:	b8 17 00 00 00       	mov    $0x17,%eax
+    46df:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    46e6:	00 00 00 
+    46e9:	74 09                	je     46f4 <swapwrite+0x1a>
+    46eb:	89 e1                	mov    %esp,%ecx
+    46ed:	ba f6 46 00 00       	mov    $0x46f6,%edx
+    46f2:	0f 34                	sysenter
+    46f4:	cd 40                	int    $0x40
+    46f6:	c3                   	ret
+
+000046f7 <setaffinity>:
+SYSCALL(setaffinity)
+    46f7:	b8 18 00 00 00       	mov    $0x18,%eax
+    46fc:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    4703:	00 00 00 
+    4706:	74 09                	je     4711 <setaffinity+0x1a>
+    4708:	89 e1                	mov    %esp,%ecx
+    470a:	ba 13 47 00 00       	mov    $0x4713,%edx
+    470f:	0f 34                	sysenter
+    4711:	cd 40                	int    $0x40
+    4713:	c3                   	ret
+
+00004714 <getaffinity>:
+SYSCALL(getaffinity)
+    4714:	b8 19 00 00 00       	mov    $0x19,%eax
+    4719:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    4720:	00 00 00 
+    4723:	74 09                	je     472e <getaffinity+0x1a>
+    4725:	89 e1                	mov    %esp,%ecx
+    4727:	ba 30 47 00 00       	mov    $0x4730,%edx
+    472c:	0f 34                	sysenter
+    472e:	cd 40                	int    $0x40
+    4730:	c3                   	ret
+
+00004731 <nanosleep>:
+SYSCALL(nanosleep)
+    4731:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    4736:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    473d:	00 00 00 
+    4740:	74 09                	je     474b <nanosleep+0x1a>
+    4742:	89 e1                	mov    %esp,%ecx
+    4744:	ba 4d 47 00 00       	mov    $0x474d,%edx
+    4749:	0f 34                	sysenter
+    474b:	cd 40                	int    $0x40
+    474d:	c3                   	ret
+
+0000474e <clocktime>:
+SYSCALL(clocktime)
+    474e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    4753:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    475a:	00 00 00 
+    475d:	74 09                	je     4768 <clocktime+0x1a>
+    475f:	89 e1                	mov    %esp,%ecx
+    4761:	ba 6a 47 00 00       	mov    $0x476a,%edx
+    4766:	0f 34                	sysenter
+    4768:	cd 40                	int    $0x40
+    476a:	c3                   	ret
+
+0000476b <batch>:
+SYSCALL(batch)
+    476b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    4770:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    4777:	00 00 00 
+    477a:	74 09                	je     4785 <batch+0x1a>
+    477c:	89 e1                	mov    %esp,%ecx
+    477e:	ba 87 47 00 00       	mov    $0x4787,%edx
+    4783:	0f 34                	sysenter
+    4785:	cd 40                	int    $0x40
+    4787:	c3                   	ret
+
+00004788 <aiosetup>:
+SYSCALL(aiosetup)
+    4788:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    478d:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    4794:	00 00 00 
+    4797:	74 09                	je     47a2 <aiosetup+0x1a>
+    4799:	89 e1                	mov    %esp,%ecx
+    479b:	ba a4 47 00 00       	mov    $0x47a4,%edx
+    47a0:	0f 34                	sysenter
+    47a2:	cd 40                	int    $0x40
+    47a4:	c3                   	ret
+
+000047a5 <aiowait>:
+SYSCALL(aiowait)
+    47a5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    47aa:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    47b1:	00 00 00 
+    47b4:	74 09                	je     47bf <aiowait+0x1a>
+    47b6:	89 e1                	mov    %esp,%ecx
+    47b8:	ba c1 47 00 00       	mov    $0x47c1,%edx
+    47bd:	0f 34                	sysenter
+    47bf:	cd 40                	int    $0x40
+    47c1:	c3                   	ret
+
+000047c2 <spawn>:
+SYSCALL(spawn)
+    47c2:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    47c7:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    47ce:	00 00 00 
+    47d1:	74 09                	je     47dc <spawn+0x1a>
+    47d3:	89 e1                	mov    %esp,%ecx
+    47d5:	ba de 47 00 00       	mov    $0x47de,%edx
+    47da:	0f 34                	sysenter
+    47dc:	cd 40                	int    $0x40
+    47de:	c3                   	ret
+
+000047df <getprocinfo>:
+SYSCALL(getprocinfo)
+    47df:	b8 20 00 00 00       	mov    $0x20,%eax
+    47e4:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    47eb:	00 00 00 
+    47ee:	74 09                	je     47f9 <getprocinfo+0x1a>
+    47f0:	89 e1                	mov    %esp,%ecx
+    47f2:	ba fb 47 00 00       	mov    $0x47fb,%edx
+    47f7:	0f 34                	sysenter
+    47f9:	cd 40                	int    $0x40
+    47fb:	c3                   	ret
+
+000047fc <getlockstat>:
+SYSCALL(getlockstat)
+    47fc:	b8 21 00 00 00       	mov    $0x21,%eax
+    4801:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    4808:	00 00 00 
+    480b:	74 09                	je     4816 <getlockstat+0x1a>
+    480d:	89 e1                	mov    %esp,%ecx
+    480f:	ba 18 48 00 00       	mov    $0x4818,%edx
+    4814:	0f 34                	sysenter
+    4816:	cd 40                	int    $0x40
+    4818:	c3                   	ret
+
+00004819 <lockprof>:
+SYSCALL(lockprof)
+    4819:	b8 22 00 00 00       	mov    $0x22,%eax
+    481e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    4825:	00 00 00 
+    4828:	74 09                	je     4833 <lockprof+0x1a>
+    482a:	89 e1                	mov    %esp,%ecx
+    482c:	ba 35 48 00 00       	mov    $0x4835,%edx
+    4831:	0f 34                	sysenter
+    4833:	cd 40                	int    $0x40
+    4835:	c3                   	ret
+
+00004836 <getlockprof>:
+SYSCALL(getlockprof)
+    4836:	b8 23 00 00 00       	mov    $0x23,%eax
+    483b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    4842:	00 00 00 
+    4845:	74 09                	je     4850 <getlockprof+0x1a>
+    4847:	89 e1                	mov    %esp,%ecx
+    4849:	ba 52 48 00 00       	mov    $0x4852,%edx
+    484e:	0f 34                	sysenter
+    4850:	cd 40                	int    $0x40
+    4852:	c3                   	ret
+
+00004853 <diskstat>:
+SYSCALL(diskstat)
+    4853:	b8 24 00 00 00       	mov    $0x24,%eax
+    4858:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+    485f:	00 00 00 
+    4862:	74 09                	je     486d <diskstat+0x1a>
+    4864:	89 e1                	mov    %esp,%ecx
+    4866:	ba 6f 48 00 00       	mov    $0x486f,%edx
+    486b:	0f 34                	sysenter
+    486d:	cd 40                	int    $0x40
+    486f:	c3                   	ret
+
+00004870 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    4870:	55                   	push   %ebp
+    4871:	89 e5                	mov    %esp,%ebp
+    4873:	57                   	push   %edi
+    4874:	56                   	push   %esi
+    4875:	53                   	push   %ebx
+    4876:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    4878:	89 d1                	mov    %edx,%ecx
+{
+    487a:	83 ec 3c             	sub    $0x3c,%esp
+    487d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    4880:	85 d2                	test   %edx,%edx
+    4882:	0f 89 80 00 00 00    	jns    4908 <printint+0x98>
+    4888:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    488c:	74 7a                	je     4908 <printint+0x98>
+    x = -xx;
+    488e:	f7 d9                	neg    %ecx
+    neg = 1;
+    4890:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    4895:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    4898:	31 f6                	xor    %esi,%esi
+    489a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    48a0:	89 c8                	mov    %ecx,%eax
+    48a2:	31 d2                	xor    %edx,%edx
+    48a4:	89 f7                	mov    %esi,%edi
+    48a6:	f7 f3                	div    %ebx
+    48a8:	8d 76 01             	lea    0x1(%esi),%esi
+    48ab:	0f b6 92 10 68 00 00 	movzbl 0x6810(%edx),%edx
+    48b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    48b6:	89 ca                	mov    %ecx,%edx
+    48b8:	89 c1                	mov    %eax,%ecx
+    48ba:	39 da                	cmp    %ebx,%edx
+    48bc:	73 e2                	jae    48a0 <printint+0x30>
+  if(neg)
+    48be:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    48c1:	85 c0                	test   %eax,%eax
+    48c3:	74 07                	je     48cc <printint+0x5c>
+    buf[i++] = '-';
+    48c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    48ca:	89 f7                	mov    %esi,%edi
+    48cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    48cf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    48d2:	01 df                	add    %ebx,%edi
+    48d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    48d8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    48db:	83 ec 04             	sub    $0x4,%esp
+    48de:	88 45 d7             	mov    %al,-0x29(%ebp)
+    48e1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    48e4:	6a 01                	push   $0x1
+    48e6:	50                   	push   %eax
+    48e7:	56                   	push   %esi
+    48e8:	e8 00 fc ff ff       	call   44ed <write>
+  while(--i >= 0)
+    48ed:	89 f8                	mov    %edi,%eax
+    48ef:	83 c4 10             	add    $0x10,%esp
+    48f2:	83 ef 01             	sub    $0x1,%edi
+    48f5:	39 d8                	cmp    %ebx,%eax
+    48f7:	75 df                	jne    48d8 <printint+0x68>
+}
+    48f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    48fc:	5b                   	pop    %ebx
+    48fd:	5e                   	pop    %esi
+    48fe:	5f                   	pop    %edi
+    48ff:	5d                   	pop    %ebp
+    4900:	c3                   	ret
+    4901:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    4908:	31 c0                	xor    %eax,%eax
+    490a:	eb 89                	jmp    4895 <printint+0x25>
+    490c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004910 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    4910:	55                   	push   %ebp
+    4911:	89 e5                	mov    %esp,%ebp
+    4913:	57                   	push   %edi
+    4914:	56                   	push   %esi
+    4915:	53                   	push   %ebx
+    4916:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    4919:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    491c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    491f:	0f b6 1e             	movzbl (%esi),%ebx
+    4922:	83 c6 01             	add    $0x1,%esi
+    4925:	84 db                	test   %bl,%bl
+    4927:	74 67                	je     4990 <printf+0x80>
+    4929:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    492c:	31 d2                	xor    %edx,%edx
+    492e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    4931:	eb 34                	jmp    4967 <printf+0x57>
+    4933:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4937:	90                   	nop
+    4938:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    493b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    4940:	83 f8 25             	cmp    $0x25,%eax
+    4943:	74 18                	je     495d <printf+0x4d>
+  write(fd, &c, 1);
+    4945:	83 ec 04             	sub    $0x4,%esp
+    4948:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    494b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    494e:	6a 01                	push   $0x1
+    4950:	50                   	push   %eax
+    4951:	57                   	push   %edi
+    4952:	e8 96 fb ff ff       	call   44ed <write>
+    4957:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    495a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    495d:	0f b6 1e             	movzbl (%esi),%ebx
+    4960:	83 c6 01             	add    $0x1,%esi
+    4963:	84 db                	test   %bl,%bl
+    4965:	74 29                	je     4990 <printf+0x80>
+    c = fmt[i] & 0xff;
+    4967:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    496a:	85 d2                	test   %edx,%edx
+    496c:	74 ca                	je     4938 <printf+0x28>
+      }
+    } else if(state == '%'){
+    496e:	83 fa 25             	cmp    $0x25,%edx
+    4971:	75 ea                	jne    495d <printf+0x4d>
+      if(c == 'd'){
+    4973:	83 f8 25             	cmp    $0x25,%eax
+    4976:	0f 84 24 01 00 00    	je     4aa0 <printf+0x190>
+    497c:	83 e8 63             	sub    $0x63,%eax
+    497f:	83 f8 15             	cmp    $0x15,%eax
+    4982:	77 1c                	ja     49a0 <printf+0x90>
+    4984:	ff 24 85 b8 67 00 00 	jmp    *0x67b8(,%eax,4)
+    498b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    498f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    4990:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4993:	5b                   	pop    %ebx
+    4994:	5e                   	pop    %esi
+    4995:	5f                   	pop    %edi
+    4996:	5d                   	pop    %ebp
+    4997:	c3                   	ret
+    4998:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    499f:	90                   	nop
+  write(fd, &c, 1);
+    49a0:	83 ec 04             	sub    $0x4,%esp
+    49a3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    49a6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    49aa:	6a 01                	push   $0x1
+    49ac:	52                   	push   %edx
+    49ad:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    49b0:	57                   	push   %edi
+    49b1:	e8 37 fb ff ff       	call   44ed <write>
+    49b6:	83 c4 0c             	add    $0xc,%esp
+    49b9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    49bc:	6a 01                	push   $0x1
+    49be:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    49c1:	52                   	push   %edx
+    49c2:	57                   	push   %edi
+    49c3:	e8 25 fb ff ff       	call   44ed <write>
+        putc(fd, c);
+    49c8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    49cb:	31 d2                	xor    %edx,%edx
+    49cd:	eb 8e                	jmp    495d <printf+0x4d>
+    49cf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    49d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    49d3:	83 ec 0c             	sub    $0xc,%esp
+    49d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    49db:	8b 13                	mov    (%ebx),%edx
+    49dd:	6a 00                	push   $0x0
+    49df:	89 f8                	mov    %edi,%eax
+        ap++;
+    49e1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    49e4:	e8 87 fe ff ff       	call   4870 <printint>
+        ap++;
+    49e9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    49ec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    49ef:	31 d2                	xor    %edx,%edx
+    49f1:	e9 67 ff ff ff       	jmp    495d <printf+0x4d>
+    49f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    49fd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    4a00:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    4a03:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    4a05:	83 c0 04             	add    $0x4,%eax
+    4a08:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    4a0b:	85 db                	test   %ebx,%ebx
+    4a0d:	0f 84 9d 00 00 00    	je     4ab0 <printf+0x1a0>
+        while(*s != 0){
+    4a13:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    4a16:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    4a18:	84 c0                	test   %al,%al
+    4a1a:	0f 84 3d ff ff ff    	je     495d <printf+0x4d>
+    4a20:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4a23:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    4a26:	89 de                	mov    %ebx,%esi
+    4a28:	89 d3                	mov    %edx,%ebx
+    4a2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    4a30:	83 ec 04             	sub    $0x4,%esp
+    4a33:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    4a36:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    4a39:	6a 01                	push   $0x1
+    4a3b:	53                   	push   %ebx
+    4a3c:	57                   	push   %edi
+    4a3d:	e8 ab fa ff ff       	call   44ed <write>
+        while(*s != 0){
+    4a42:	0f b6 06             	movzbl (%esi),%eax
+    4a45:	83 c4 10             	add    $0x10,%esp
+    4a48:	84 c0                	test   %al,%al
+    4a4a:	75 e4                	jne    4a30 <printf+0x120>
+      state = 0;
+    4a4c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    4a4f:	31 d2                	xor    %edx,%edx
+    4a51:	e9 07 ff ff ff       	jmp    495d <printf+0x4d>
+    4a56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4a5d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    4a60:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    4a63:	83 ec 0c             	sub    $0xc,%esp
+    4a66:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    4a6b:	8b 13                	mov    (%ebx),%edx
+    4a6d:	6a 01                	push   $0x1
+    4a6f:	e9 6b ff ff ff       	jmp    49df <printf+0xcf>
+    4a74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    4a78:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    4a7b:	83 ec 04             	sub    $0x4,%esp
+    4a7e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    4a81:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    4a83:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    4a86:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    4a89:	6a 01                	push   $0x1
+    4a8b:	52                   	push   %edx
+    4a8c:	57                   	push   %edi
+    4a8d:	e8 5b fa ff ff       	call   44ed <write>
+        ap++;
+    4a92:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    4a95:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    4a98:	31 d2                	xor    %edx,%edx
+    4a9a:	e9 be fe ff ff       	jmp    495d <printf+0x4d>
+    4a9f:	90                   	nop
+  write(fd, &c, 1);
+    4aa0:	83 ec 04             	sub    $0x4,%esp
+    4aa3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    4aa6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4aa9:	6a 01                	push   $0x1
+    4aab:	e9 11 ff ff ff       	jmp    49c1 <printf+0xb1>
+    4ab0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    4ab5:	bb ae 67 00 00       	mov    $0x67ae,%ebx
+    4aba:	e9 61 ff ff ff       	jmp    4a20 <printf+0x110>
+    4abf:	90                   	nop
+
+00004ac0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    4ac0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4ac1:	a1 e0 ba 00 00       	mov    0xbae0,%eax
+{
+    4ac6:	89 e5                	mov    %esp,%ebp
+    4ac8:	57                   	push   %edi
+    4ac9:	56                   	push   %esi
+    4aca:	53                   	push   %ebx
+    4acb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    4ace:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4ad1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4ad8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4ada:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4adc:	39 ca                	cmp    %ecx,%edx
+    4ade:	73 30                	jae    4b10 <free+0x50>
+    4ae0:	39 c1                	cmp    %eax,%ecx
+    4ae2:	72 04                	jb     4ae8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4ae4:	39 c2                	cmp    %eax,%edx
+    4ae6:	72 f0                	jb     4ad8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    4ae8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    4aeb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    4aee:	39 f8                	cmp    %edi,%eax
+    4af0:	74 2e                	je     4b20 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    4af2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    4af5:	8b 42 04             	mov    0x4(%edx),%eax
+    4af8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    4afb:	39 f1                	cmp    %esi,%ecx
+    4afd:	74 38                	je     4b37 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    4aff:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    4b01:	5b                   	pop    %ebx
+  freep = p;
+    4b02:	89 15 e0 ba 00 00    	mov    %edx,0xbae0
+}
+    4b08:	5e                   	pop    %esi
+    4b09:	5f                   	pop    %edi
+    4b0a:	5d                   	pop    %ebp
+    4b0b:	c3                   	ret
+    4b0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4b10:	39 c1                	cmp    %eax,%ecx
+    4b12:	72 d0                	jb     4ae4 <free+0x24>
+    4b14:	eb c2                	jmp    4ad8 <free+0x18>
+    4b16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4b1d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    4b20:	03 70 04             	add    0x4(%eax),%esi
+    4b23:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    4b26:	8b 02                	mov    (%edx),%eax
+    4b28:	8b 00                	mov    (%eax),%eax
+    4b2a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    4b2d:	8b 42 04             	mov    0x4(%edx),%eax
+    4b30:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    4b33:	39 f1                	cmp    %esi,%ecx
+    4b35:	75 c8                	jne    4aff <free+0x3f>
+    p->s.size += bp->s.size;
+    4b37:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    4b3a:	89 15 e0 ba 00 00    	mov    %edx,0xbae0
+    p->s.size += bp->s.size;
+    4b40:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    4b43:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    4b46:	89 0a                	mov    %ecx,(%edx)
+}
+    4b48:	5b                   	pop    %ebx
+    4b49:	5e                   	pop    %esi
+    4b4a:	5f                   	pop    %edi
+    4b4b:	5d                   	pop    %ebp
+    4b4c:	c3                   	ret
+    4b4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004b50 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    4b50:	55                   	push   %ebp
+    4b51:	89 e5                	mov    %esp,%ebp
+    4b53:	57                   	push   %edi
+    4b54:	56                   	push   %esi
+    4b55:	53                   	push   %ebx
+    4b56:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4b59:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    4b5c:	8b 15 e0 ba 00 00    	mov    0xbae0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4b62:	8d 78 07             	lea    0x7(%eax),%edi
+    4b65:	c1 ef 03             	shr    $0x3,%edi
+    4b68:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    4b6b:	85 d2                	test   %edx,%edx
+    4b6d:	0f 84 8d 00 00 00    	je     4c00 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4b73:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    4b75:	8b 48 04             	mov    0x4(%eax),%ecx
+    4b78:	39 f9                	cmp    %edi,%ecx
+    4b7a:	73 64                	jae    4be0 <malloc+0x90>
+  if(nu < 4096)
+    4b7c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    4b81:	39 df                	cmp    %ebx,%edi
+    4b83:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    4b86:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    4b8d:	eb 0a                	jmp    4b99 <malloc+0x49>
+    4b8f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4b90:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    4b92:	8b 48 04             	mov    0x4(%eax),%ecx
+    4b95:	39 f9                	cmp    %edi,%ecx
+    4b97:	73 47                	jae    4be0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    4b99:	89 c2                	mov    %eax,%edx
+    4b9b:	39 05 e0 ba 00 00    	cmp    %eax,0xbae0
+    4ba1:	75 ed                	jne    4b90 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    4ba3:	83 ec 0c             	sub    $0xc,%esp
+    4ba6:	56                   	push   %esi
+    4ba7:	e8 ba fa ff ff       	call   4666 <sbrk>
+  if(p == (char*)-1)
+    4bac:	83 c4 10             	add    $0x10,%esp
+    4baf:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4bb2:	74 1c                	je     4bd0 <malloc+0x80>
+  hp->s.size = nu;
+    4bb4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    4bb7:	83 ec 0c             	sub    $0xc,%esp
+    4bba:	83 c0 08             	add    $0x8,%eax
+    4bbd:	50                   	push   %eax
+    4bbe:	e8 fd fe ff ff       	call   4ac0 <free>
+  return freep;
+    4bc3:	8b 15 e0 ba 00 00    	mov    0xbae0,%edx
+      if((p = morecore(nunits)) == 0)
+    4bc9:	83 c4 10             	add    $0x10,%esp
+    4bcc:	85 d2                	test   %edx,%edx
+    4bce:	75 c0                	jne    4b90 <malloc+0x40>
+        return 0;
+  }
+}
+    4bd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    4bd3:	31 c0                	xor    %eax,%eax
+}
+    4bd5:	5b                   	pop    %ebx
+    4bd6:	5e                   	pop    %esi
+    4bd7:	5f                   	pop    %edi
+    4bd8:	5d                   	pop    %ebp
+    4bd9:	c3                   	ret
+    4bda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    4be0:	39 cf                	cmp    %ecx,%edi
+    4be2:	74 4c                	je     4c30 <malloc+0xe0>
+        p->s.size -= nunits;
+    4be4:	29 f9                	sub    %edi,%ecx
+    4be6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    4be9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    4bec:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    4bef:	89 15 e0 ba 00 00    	mov    %edx,0xbae0
+}
+    4bf5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    4bf8:	83 c0 08             	add    $0x8,%eax
+}
+    4bfb:	5b                   	pop    %ebx
+    4bfc:	5e                   	pop    %esi
+    4bfd:	5f                   	pop    %edi
+    4bfe:	5d                   	pop    %ebp
+    4bff:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    4c00:	c7 05 e0 ba 00 00 e4 	movl   $0xbae4,0xbae0
+    4c07:	ba 00 00 
+    base.s.size = 0;
+    4c0a:	b8 e4 ba 00 00       	mov    $0xbae4,%eax
+    base.s.ptr = freep = prevp = &base;
+    4c0f:	c7 05 e4 ba 00 00 e4 	movl   $0xbae4,0xbae4
+    4c16:	ba 00 00 
+    base.s.size = 0;
+    4c19:	c7 05 e8 ba 00 00 00 	movl   $0x0,0xbae8
+    4c20:	00 00 00 
+    if(p->s.size >= nunits){
+    4c23:	e9 54 ff ff ff       	jmp    4b7c <malloc+0x2c>
+    4c28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4c2f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    4c30:	8b 08                	mov    (%eax),%ecx
+    4c32:	89 0a                	mov    %ecx,(%edx)
+    4c34:	eb b9                	jmp    4bef <malloc+0x9f>
@@ -4,9 +4,12 @@
 #include "user.h"
 #include "fs.h"
 #include "fcntl.h"
+#include "date.h"
+#include "sysbatch.h"
 #include "syscall.h"
 #include "traps.h"
 #include "memlayout.h"
+#include "diskstat.h"
 
 char buf[8192];
 char name[3];
@@ -1383,7 +1386,7 @@ forktest(void)
 
   printf(1, "fork test\n");
 
-  for(n=0; n<1000; n++){
+  for(n=0; n<NPROC+100; n++){
     pid = fork();
     if(pid < 0)
       break;
@@ -1391,8 +1394,8 @@ forktest(void)
       exit();
   }
 
-  if(n == 1000){
-    printf(1, "fork claimed to work 1000 times!\n");
+  if(n == NPROC+100){
+    printf(1, "fork claimed to work %d times!\n", n);
     exit();
   }
 
@@ -1411,6 +1414,214 @@ forktest(void)
   printf(1, "fork test OK\n");
 }
 
+// can a process pin itself to one CPU and read the mask back?
+void
+affinitytest(void)
+{
+  int mask, spin, pid, fd, fds[2], i;
+  char c;
+
+  printf(stdout, "affinity test\n");
+  mask = getaffinity(0);
+  if(mask <= 0){
+    printf(stdout, "getaffinity failed\n");
+    exit();
+  }
+  if(setaffinity(0, 0) != -1){
+    printf(stdout, "setaffinity accepted an empty mask\n");
+    exit();
+  }
+  if(setaffinity(0, 1) < 0 || getaffinity(0) != 1){
+    printf(stdout, "setaffinity to cpu0 failed\n");
+    exit();
+  }
+  if(setaffinity(0, mask) < 0 || getaffinity(0) != mask){
+    printf(stdout, "setaffinity restore failed\n");
+    exit();
+  }
+
+  // A process pinned away from the CPU it last ran on must
+  // still get to run, even with its new CPU busy.
+  if((mask & 3) == 3){
+    spin = fork();
+    if(spin == 0){
+      setaffinity(0, 2);
+      for(;;)
+        ;
+    }
+    pipe(fds);
+    pid = fork();
+    if(pid == 0){
+      setaffinity(0, 1);
+      read(fds[0], &c, 1);
+      close(open("affinity.ran", O_CREATE));
+      exit();
+    }
+    sleep(2);  // let the child run on cpu0 and block
+    setaffinity(pid, 2);
+    write(fds[1], "x", 1);
+    for(i = 0; i < 100 && (fd = open("affinity.ran", 0)) < 0; i++)
+      sleep(1);
+    kill(spin);
+    wait();
+    wait();
+    close(fds[0]);
+    close(fds[1]);
+    if(fd < 0){
+      printf(stdout, "pinned child starved\n");
+      exit();
+    }
+    close(fd);
+    unlink("affinity.ran");
+  }
+  printf(stdout, "affinity test OK\n");
+}
+
+// does nanosleep() reject bad arguments and sleep for
+// about as long as asked?
+void
+nanosleeptest(void)
+{
+  struct timespec ts;
+  int i, t0, t1;
+
+  printf(stdout, "nanosleep test\n");
+  ts.sec = 0;
+  ts.nsec = 1000000000;
+  if(nanosleep(&ts) != -1){
+    printf(stdout, "nanosleep accepted nsec >= 1s\n");
+    exit();
+  }
+  t0 = uptime();
+  ts.nsec = 1000000;
+  for(i = 0; i < 50; i++){
+    if(nanosleep(&ts) < 0){
+      printf(stdout, "nanosleep 1ms failed\n");
+      exit();
+    }
+  }
+  t1 = uptime();
+  if(t1 - t0 < 4){
+    printf(stdout, "50 x 1ms nanosleep took %d ticks\n", t1 - t0);
+    exit();
+  }
+  ts.sec = 0;
+  ts.nsec = 200000000;
+  t0 = uptime();
+  if(nanosleep(&ts) < 0 || uptime() - t0 < 20){
+    printf(stdout, "nanosleep 200ms too short\n");
+    exit();
+  }
+  printf(stdout, "nanosleep test OK\n");
+}
+
+// does clocktime() move forward, and agree with uptime()?
+void
+clocktest(void)
+{
+  struct timespec a, b;
+  int t0, ms;
+
+  printf(stdout, "clock test\n");
+  t0 = uptime();
+  if(clocktime(&a) < 0 || clocktime(&b) < 0){
+    printf(stdout, "clocktime failed\n");
+    exit();
+  }
+  if(b.sec < a.sec || (b.sec == a.sec && b.nsec < a.nsec) || a.nsec >= 1000000000){
+    printf(stdout, "clock went backwards\n");
+    exit();
+  }
+  sleep(20);
+  clocktime(&b);
+  ms = (b.sec - a.sec)*1000 + (int)(b.nsec/1000000) - (int)(a.nsec/1000000);
+  if(ms < 150 || ms > 20*(uptime() - t0 + 5)){
+    printf(stdout, "clock says sleep(20) took %d ms\n", ms);
+    exit();
+  }
+  if(ugetpid() != getpid()){
+    printf(stdout, "ugetpid %d != getpid %d\n", ugetpid(), getpid());
+    exit();
+  }
+  uclocktime(&a);
+  clocktime(&b);
+  if(b.sec < a.sec || (b.sec == a.sec && b.nsec < a.nsec)){
+    printf(stdout, "uclocktime ahead of clocktime\n");
+    exit();
+  }
+  printf(stdout, "clock test OK\n");
+}
+
+// can batch() run several calls, refuse the ones it must,
+// and stop at the first error when asked?
+void
+batchtest(void)
+{
+  struct sysent e[4];
+  int fd;
+
+  printf(stdout, "batch test\n");
+  fd = open("batchfile", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(stdout, "batch test: create failed\n");
+    exit();
+  }
+  memset(e, 0, sizeof(e));
+  e[0].num = SYS_write;
+  e[0].args[0] = fd;
+  e[0].args[1] = (int)"hello";
+  e[0].args[2] = 5;
+  e[1].num = SYS_getpid;
+  e[2].num = SYS_fork;
+  e[3].num = SYS_close;
+  e[3].args[0] = fd;
+  if(batch(e, 4, 0) != 4 || e[0].ret != 5 || e[1].ret != getpid() ||
+     e[2].ret != -1 || e[3].ret != 0){
+    printf(stdout, "batch returned wrong results\n");
+    exit();
+  }
+  e[0].num = SYS_close;
+  e[0].args[0] = fd;
+  e[1].num = SYS_unlink;
+  e[1].args[0] = (int)"batchfile";
+  if(batch(e, 2, BATCH_STOPERR) != 1 || e[0].ret != -1){
+    printf(stdout, "batch did not stop at the error\n");
+    exit();
+  }
+  if(batch(e + 1, 1, 0) != 1 || e[1].ret != 0){
+    printf(stdout, "batch unlink failed\n");
+    exit();
+  }
+  printf(stdout, "batch test OK\n");
+}
+
+// can spawn() start a program with its stdout on a pipe?
+void
+spawntest(void)
+{
+  char *argv[] = { "echo", "spawned", 0 };
+  int p[2], map[3], pid, n;
+  char buf[16];
+
+  printf(stdout, "spawn test\n");
+  if(spawn("nosuchprog", argv, 0, 0) != -1 || pipe(p) < 0){
+    printf(stdout, "spawn test setup failed\n");
+    exit();
+  }
+  map[0] = 0;
+  map[1] = p[1];
+  map[2] = 2;
+  pid = spawn("echo", argv, map, 3);
+  close(p[1]);
+  n = read(p[0], buf, sizeof(buf));
+  close(p[0]);
+  if(pid < 0 || wait() != pid || n != 8 || buf[0] != 's' || buf[7] != '\n'){
+    printf(stdout, "spawn echo failed\n");
+    exit();
+  }
+  printf(stdout, "spawn test OK\n");
+}
+
 void
 sbrktest(void)
 {
@@ -1724,6 +1935,89 @@ uio()
   printf(1, "uio test done\n");
 }
 
+// Read back bcachetest's file.  Returns -1 if it is wrong.
+int
+bcachecheck(void)
+{
+  int fd, i;
+
+  fd = open("bcfile", 0);
+  for(i = 0; i < 80; i++){
+    if(read(fd, buf, BSIZE) != BSIZE || buf[0] != i || buf[BSIZE-1] != i){
+      close(fd);
+      return -1;
+    }
+  }
+  close(fd);
+  return 0;
+}
+
+// The buffer cache grows past NBUF while memory is plentiful
+// and gives pages back to the allocator when memory runs out.
+// File data must read back the same while memory is full and
+// after it has been freed again.
+void
+bcachetest(void)
+{
+  static struct diskstat ds;
+  int fd, i, pid, fds[2], grown;
+  char c;
+
+  printf(stdout, "bcache test\n");
+  fd = open("bcfile", O_CREATE|O_RDWR);
+  for(i = 0; i < 80; i++){
+    memset(buf, i, BSIZE);
+    if(write(fd, buf, BSIZE) != BSIZE){
+      printf(stdout, "bcache test write failed\n");
+      exit();
+    }
+  }
+  close(fd);
+  diskstat(&ds);
+  grown = ds.nbuf;
+  if(grown <= NBUF){
+    printf(stdout, "bcache did not grow: %d buffers\n", grown);
+    exit();
+  }
+
+  // The child takes all free memory, which makes the kernel
+  // shrink the cache, and reports through the pipe.
+  if(pipe(fds) != 0){
+    printf(stdout, "bcache test pipe failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "bcache test fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    close(fds[0]);
+    while(sbrk(4096) != (char*)-1)
+      ;
+    diskstat(&ds);
+    if(ds.nbuf < grown && bcachecheck() == 0)
+      write(fds[1], "x", 1);
+    else
+      printf(stdout, "bcache %d buffers with memory full, %d before\n", ds.nbuf, grown);
+    exit();
+  }
+  close(fds[1]);
+  if(read(fds[0], &c, 1) != 1){
+    printf(stdout, "bcache test failed with memory full\n");
+    exit();
+  }
+  close(fds[0]);
+  wait();
+
+  if(bcachecheck() < 0){
+    printf(stdout, "bcache test failed after memory was freed\n");
+    exit();
+  }
+  unlink("bcfile");
+  printf(stdout, "bcache test OK\n");
+}
+
 void argptest()
 {
   int fd;
@@ -1780,6 +2074,7 @@ main(int argc, char *argv[])
   iputtest();
 
   mem();
+  bcachetest();
   pipe1();
   preempt();
   exitwait();
@@ -1793,6 +2088,11 @@ main(int argc, char *argv[])
   dirfile();
   iref();
   forktest();
+  affinitytest();
+  nanosleeptest();
+  clocktest();
+  batchtest();
+  spawntest();
   bigdir(); // slow
 
   uio();
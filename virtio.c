@@ -0,0 +1,203 @@
+// Virtio block device driver, for the legacy PCI interface.
+//
+// If QEMU provides a virtio-blk device (make qemu VIRTIO=1),
+// it holds the file system disk, dev 1, and bio.c sends that
+// disk's requests here instead of to ide.c.
+//
+// Each request is a chain of three descriptors: a header, the
+// buffer's data, and a status byte.  Requests from any number
+// of processes can be in flight at once, up to a third of the
+// queue size, and the device may complete them in any order.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "traps.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "pci.h"
+#include "virtio.h"
+#include "diskstat.h"
+
+#define NVDESC  256  // Largest queue supported
+
+struct vreq {
+  struct vblkhdr hdr;
+  uchar status;
+  struct buf *b;
+};
+
+static struct {
+  struct spinlock lock;
+  ushort iobase;
+  int n;                   // Descriptors in the queue
+  struct vqdesc *desc;
+  struct vqavail *avail;
+  struct vqused *used;
+  ushort lastused;         // used->idx already handled
+  char free[NVDESC];       // Is the descriptor free?
+  int nfree;
+  struct vreq req[NVDESC]; // By chain's first descriptor
+} vblk;
+
+static char vqmem[VQSIZE(NVDESC)] __attribute__((aligned(PGSIZE)));
+
+int virtioirq = -1;  // IRQ of the device, or -1 if there is none
+
+void
+virtioinit(void)
+{
+  struct pcidev *d;
+  ushort base;
+  int i, n;
+
+  if((d = pcifindid(0x1af4, 0x1001)) == 0 || !(d->bar[0] & PCI_BAR_IO))
+    return;
+  initlock(&vblk.lock, "virtio");
+  base = d->bar[0] & PCI_BAR_IOMASK;
+  pcibusmaster(d);
+
+  outb(base+VIRTIO_STATUS, 0);  // reset
+  outb(base+VIRTIO_STATUS, VIRTIO_ACK);
+  outb(base+VIRTIO_STATUS, VIRTIO_ACK|VIRTIO_DRIVER);
+  outl(base+VIRTIO_GUESTFEAT, 0);  // no optional features
+
+  outw(base+VIRTIO_QSEL, 0);
+  n = inw(base+VIRTIO_QSIZE);
+  if(n < 3 || n > NVDESC){
+    outb(base+VIRTIO_STATUS, VIRTIO_FAILED);
+    return;
+  }
+  memset(vqmem, 0, sizeof(vqmem));
+  vblk.n = n;
+  vblk.desc = (struct vqdesc*)vqmem;
+  vblk.avail = (struct vqavail*)(vqmem + 16*n);
+  vblk.used = (struct vqused*)(vqmem + PGROUNDUP(VQAVAILSZ(n)));
+  for(i = 0; i < n; i++)
+    vblk.free[i] = 1;
+  vblk.nfree = n;
+  outl(base+VIRTIO_QADDR, V2P(vqmem) / PGSIZE);
+
+  outb(base+VIRTIO_STATUS, VIRTIO_ACK|VIRTIO_DRIVER|VIRTIO_DRIVER_OK);
+  vblk.iobase = base;
+  virtioirq = d->irq;
+  ioapicenable(virtioirq, ncpu - 1);
+}
+
+// Is there a virtio disk to use?
+int
+virtioready(void)
+{
+  return vblk.iobase != 0;
+}
+
+// Take a free descriptor.  Caller must hold vblk.lock
+// and have checked vblk.nfree.
+static int
+allocdesc(void)
+{
+  int i;
+
+  for(i = 0; i < vblk.n; i++){
+    if(vblk.free[i]){
+      vblk.free[i] = 0;
+      vblk.nfree--;
+      return i;
+    }
+  }
+  panic("virtio: no desc");
+}
+
+static void
+freechain(int i)
+{
+  for(;;){
+    vblk.free[i] = 1;
+    vblk.nfree++;
+    if(!(vblk.desc[i].flags & VQ_NEXT))
+      break;
+    i = vblk.desc[i].next;
+  }
+  wakeup(&vblk.free);
+}
+
+// Start syncing buf with disk, like iderw().
+void
+virtiorw(struct buf *b)
+{
+  struct vreq *r;
+  int d0, d1, d2;
+
+  if(!holdingsleep(&b->lock))
+    panic("virtiorw: buf not locked");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+    panic("virtiorw: nothing to do");
+
+  acquire(&vblk.lock);
+  while(vblk.nfree < 3)
+    sleep(&vblk.free, &vblk.lock);
+  d0 = allocdesc();
+  d1 = allocdesc();
+  d2 = allocdesc();
+
+  r = &vblk.req[d0];
+  r->hdr.type = (b->flags & B_DIRTY) ? VBLK_OUT : VBLK_IN;
+  r->hdr.reserved = 0;
+  r->hdr.sector = (uint64)b->blockno * (BSIZE/512);
+  r->status = 0xff;
+  r->b = b;
+
+  vblk.desc[d0].addr = V2P(&r->hdr);
+  vblk.desc[d0].len = sizeof(r->hdr);
+  vblk.desc[d0].flags = VQ_NEXT;
+  vblk.desc[d0].next = d1;
+  vblk.desc[d1].addr = V2P(b->data);
+  vblk.desc[d1].len = BSIZE;
+  vblk.desc[d1].flags = VQ_NEXT | ((b->flags & B_DIRTY) ? 0 : VQ_WRITE);
+  vblk.desc[d1].next = d2;
+  vblk.desc[d2].addr = V2P(&r->status);
+  vblk.desc[d2].len = 1;
+  vblk.desc[d2].flags = VQ_WRITE;
+  vblk.desc[d2].next = 0;
+
+  // The device must see the chain before the new index.
+  vblk.avail->ring[vblk.avail->idx % vblk.n] = d0;
+  __sync_synchronize();
+  vblk.avail->idx++;
+  __sync_synchronize();
+  outw(vblk.iobase+VIRTIO_QNOTIFY, 0);
+  xadd(&diskstat.ncmd, 1);
+  release(&vblk.lock);
+}
+
+// Interrupt handler.
+void
+virtiointr(void)
+{
+  struct vreq *r;
+  struct buf *b;
+  int id;
+
+  acquire(&vblk.lock);
+  // Reading the ISR lowers the interrupt, so completions
+  // after this point raise a new one.
+  inb(vblk.iobase+VIRTIO_ISR);
+  __sync_synchronize();
+  while(vblk.lastused != *(volatile ushort*)&vblk.used->idx){
+    id = vblk.used->ring[vblk.lastused % vblk.n].id;
+    r = &vblk.req[id];
+    if(r->status != 0)
+      panic("virtio: I/O error");
+    b = r->b;
+    freechain(id);
+    biodone(b);
+    vblk.lastused++;
+  }
+  release(&vblk.lock);
+}
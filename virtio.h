@@ -0,0 +1,61 @@
+// Virtio devices, legacy PCI interface.
+
+// Registers, at the I/O base in PCI BAR 0.
+#define VIRTIO_HOSTFEAT   0x00  // Device features (32 bits)
+#define VIRTIO_GUESTFEAT  0x04  // Features the driver accepts
+#define VIRTIO_QADDR      0x08  // Page number of the selected queue
+#define VIRTIO_QSIZE      0x0c  // Size of the selected queue (16 bits)
+#define VIRTIO_QSEL       0x0e  // Queue select
+#define VIRTIO_QNOTIFY    0x10  // Write a queue's number to kick it
+#define VIRTIO_STATUS     0x12  // Device status (8 bits)
+#define VIRTIO_ISR        0x13  // Interrupt status; reading clears it
+#define VIRTIO_CONFIG     0x14  // Device-specific configuration
+
+// VIRTIO_STATUS bits.
+#define VIRTIO_ACK        0x1
+#define VIRTIO_DRIVER     0x2
+#define VIRTIO_DRIVER_OK  0x4
+#define VIRTIO_FAILED     0x80
+
+// A virtqueue: a descriptor table, the ring of descriptor
+// chains the driver makes available, and the ring of chains
+// the device has used.  The used ring starts on a new page.
+struct vqdesc {
+  uint64 addr;       // Physical address
+  uint len;
+  ushort flags;
+  ushort next;       // Next descriptor if VQ_NEXT
+};
+#define VQ_NEXT   0x1  // Chain continues at next
+#define VQ_WRITE  0x2  // Device writes (rather than reads) the buffer
+
+struct vqavail {
+  ushort flags;
+  ushort idx;        // Where the driver puts the next entry
+  ushort ring[];
+};
+
+struct vqusedelem {
+  uint id;           // Head of the chain
+  uint len;          // Bytes written into it
+};
+
+struct vqused {
+  ushort flags;
+  ushort idx;        // Where the device puts the next entry
+  struct vqusedelem ring[];
+};
+
+// Bytes taken by a queue of n descriptors.
+#define VQAVAILSZ(n)  (16*(n) + 6 + 2*(n))
+#define VQSIZE(n)     (PGROUNDUP(VQAVAILSZ(n)) + PGROUNDUP(6 + 8*(n)))
+
+// Virtio block device request header, followed by the
+// data and then a status byte written by the device.
+struct vblkhdr {
+  uint type;
+  uint reserved;
+  uint64 sector;     // In 512-byte sectors
+};
+#define VBLK_IN   0  // Read
+#define VBLK_OUT  1  // Write
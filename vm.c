@@ -6,6 +6,8 @@
 #include "mmu.h"
 #include "proc.h"
 #include "elf.h"
+#include "date.h"
+#include "upage.h"
 
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // for use in scheduler()
@@ -15,18 +17,53 @@ pde_t *kpgdir;  // for use in scheduler()
 void
 seginit(void)
 {
+  extern char uclockpage[];
+  extern void sysentry(void);
   struct cpu *c;
+  int apicid;
+  uint edx;
+
+  // %gs is not set up yet, so find this CPU the slow way.
+  // APIC IDs are not guaranteed to be contiguous.
+  apicid = lapicid();
+  for(c = cpus; c < cpus+ncpu; c++)
+    if(c->apicid == apicid)
+      break;
+  if(c == cpus+ncpu)
+    panic("seginit: unknown apicid");
 
   // Map "logical" addresses to virtual addresses using identity map.
   // Cannot share a CODE descriptor for both kernel and user
   // because it would have to have DPL_USR, but the CPU forbids
   // an interrupt from CPL=0 to DPL=3.
-  c = &cpus[cpuid()];
   c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
   c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
   c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
   c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+
+  // Map cpu-local storage: %gs:0 is c->self and %gs:4 is c->proc.
+  // The segment is DPL 0, so user code cannot load it; alltraps
+  // reloads %gs on every entry into the kernel.
+  c->gdt[SEG_KCPU] = SEG(STA_W, c, sizeof(*c) - 1, 0);
   lgdt(c->gdt, sizeof(c->gdt));
+  loadgs(SEG_KCPU << 3);
+
+  c->self = c;
+  c->proc = 0;
+
+  // Let system calls enter through sysenter, if the CPU has it
+  // (CPUID.1:EDX.SEP).  sysenter loads %cs from the MSR and %ss
+  // from the next descriptor, and sysexit uses the two after
+  // that, which is the order of SEG_KCODE..SEG_UDATA.  The stack
+  // MSR points at this CPU's taskstate: sysentry in trapasm.S
+  // loads the kernel stack from ts.esp0, kept by switchuvm().
+  getcpuid(1, 0, 0, 0, &edx);
+  if(edx & CPUID_SEP){
+    wrmsr(MSR_SYSENTER_CS, SEG_KCODE << 3);
+    wrmsr(MSR_SYSENTER_ESP, (uint)&c->ts);
+    wrmsr(MSR_SYSENTER_EIP, (uint)sysentry);
+    ((struct uclock*)uclockpage)->flags |= UCLOCK_SYSENTER;
+  }
 }
 
 // Return the address of the PTE in page table pgdir
@@ -57,7 +94,7 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
 // Create PTEs for virtual addresses starting at va that refer to
 // physical addresses starting at pa. va and size might not
 // be page-aligned.
-static int
+int
 mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
 {
   char *a, *last;
@@ -124,6 +161,17 @@ setupkvm(void)
   if((pgdir = (pde_t*)kalloc()) == 0)
     return 0;
   memset(pgdir, 0, PGSIZE);
+
+  // The kernel half is identical in every address space, so once
+  // kpgdir exists share its page-table pages rather than building a
+  // private copy; mapping PHYSTOP takes over 50 pages per process.
+  // freevm() leaves these shared pages alone.
+  if(kpgdir){
+    memmove(&pgdir[PDX(KERNBASE)], &kpgdir[PDX(KERNBASE)],
+            (NPDENTRIES - PDX(KERNBASE)) * sizeof(pde_t));
+    return pgdir;
+  }
+
   if (P2V(PHYSTOP) > (void*)DEVSPACE)
     panic("PHYSTOP too high");
   for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
@@ -192,6 +240,28 @@ inituvm(pde_t *pgdir, char *init, uint sz)
   memmove(mem, init, sz);
 }
 
+// Map the shared clock page at UCLOCK and a new page holding
+// struct uproc for process pid at UPROC, both read-only to the
+// user.  freevm() frees the UPROC page with the rest of user memory.
+int
+mapupages(pde_t *pgdir, int pid)
+{
+  extern char uclockpage[];
+  char *mem;
+
+  if((mem = kalloc()) == 0)
+    return -1;
+  memset(mem, 0, PGSIZE);
+  ((struct uproc*)mem)->pid = pid;
+  if(mappages(pgdir, (char*)UPROC, PGSIZE, V2P(mem), PTE_U) < 0){
+    kfree(mem);
+    return -1;
+  }
+  if(mappages(pgdir, (char*)UCLOCK, PGSIZE, V2P(uclockpage), PTE_U|PTE_SHARED) < 0)
+    return -1;
+  return 0;
+}
+
 // Load a program segment into pgdir.  addr must be page-aligned
 // and the pages from addr to addr+sz must already be mapped.
 int
@@ -224,7 +294,7 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
   char *mem;
   uint a;
 
-  if(newsz >= KERNBASE)
+  if(newsz > UTOP)
     return 0;
   if(newsz < oldsz)
     return oldsz;
@@ -271,7 +341,8 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
       if(pa == 0)
         panic("kfree");
       char *v = P2V(pa);
-      kfree(v);
+      if(!(*pte & PTE_SHARED))
+        kfree(v);
       *pte = 0;
     }
   }
@@ -279,7 +350,8 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 }
 
 // Free a page table and all the physical memory pages
-// in the user part.
+// in the user part.  The kernel part's page-table pages
+// are shared with kpgdir (see setupkvm) and are kept.
 void
 freevm(pde_t *pgdir)
 {
@@ -288,7 +360,7 @@ freevm(pde_t *pgdir)
   if(pgdir == 0)
     panic("freevm: no pgdir");
   deallocuvm(pgdir, KERNBASE, 0);
-  for(i = 0; i < NPDENTRIES; i++){
+  for(i = 0; i < PDX(KERNBASE); i++){
     if(pgdir[i] & PTE_P){
       char * v = P2V(PTE_ADDR(pgdir[i]));
       kfree(v);
@@ -361,9 +433,37 @@ uva2ka(pde_t *pgdir, char *uva)
 
 // Copy len bytes from p to user address va in page table pgdir.
 // Most useful when pgdir is not the current page table.
-// uva2ka ensures this only works for PTE_U pages.
+// Only works for pages the user could write itself: PTE_U and
+// PTE_W, so not the read-only pages shared with the kernel.
 int
 copyout(pde_t *pgdir, uint va, void *p, uint len)
+{
+  char *buf, *pa0;
+  uint n, va0;
+  pte_t *pte;
+
+  buf = (char*)p;
+  while(len > 0){
+    va0 = (uint)PGROUNDDOWN(va);
+    pte = walkpgdir(pgdir, (char*)va0, 0);
+    if(pte == 0 || (*pte & (PTE_P|PTE_U|PTE_W)) != (PTE_P|PTE_U|PTE_W))
+      return -1;
+    pa0 = (char*)P2V(PTE_ADDR(*pte));
+    n = PGSIZE - (va - va0);
+    if(n > len)
+      n = len;
+    memmove(pa0 + (va - va0), buf, n);
+    len -= n;
+    buf += n;
+    va = va0 + PGSIZE;
+  }
+  return 0;
+}
+
+// Copy len bytes to p from user address va in page table pgdir.
+// The counterpart of copyout, for pgdirs other than the current one.
+int
+copyin(pde_t *pgdir, void *p, uint va, uint len)
 {
   char *buf, *pa0;
   uint n, va0;
@@ -377,7 +477,7 @@ copyout(pde_t *pgdir, uint va, void *p, uint len)
     n = PGSIZE - (va - va0);
     if(n > len)
       n = len;
-    memmove(pa0 + (va - va0), buf, n);
+    memmove(buf, pa0 + (va - va0), n);
     len -= n;
     buf += n;
     va = va0 + PGSIZE;
@@ -0,0 +1,1682 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 01 00 00 00       	mov    $0x1,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7f 28                	jg     51 <main+0x51>
+  29:	eb 54                	jmp    7f <main+0x7f>
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "wc: cannot open %s\n", argv[i]);
+      exit();
+    }
+    wc(fd, argv[i]);
+  30:	83 ec 08             	sub    $0x8,%esp
+  33:	ff 33                	push   (%ebx)
+  for(i = 1; i < argc; i++){
+  35:	83 c6 01             	add    $0x1,%esi
+  38:	83 c3 04             	add    $0x4,%ebx
+    wc(fd, argv[i]);
+  3b:	50                   	push   %eax
+  3c:	e8 5f 00 00 00       	call   a0 <wc>
+    close(fd);
+  41:	89 3c 24             	mov    %edi,(%esp)
+  44:	e8 c1 04 00 00       	call   50a <close>
+  for(i = 1; i < argc; i++){
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  4f:	74 29                	je     7a <main+0x7a>
+    if((fd = open(argv[i], 0)) < 0){
+  51:	83 ec 08             	sub    $0x8,%esp
+  54:	6a 00                	push   $0x0
+  56:	ff 33                	push   (%ebx)
+  58:	e8 04 05 00 00       	call   561 <open>
+  5d:	83 c4 10             	add    $0x10,%esp
+  60:	89 c7                	mov    %eax,%edi
+  62:	85 c0                	test   %eax,%eax
+  64:	79 ca                	jns    30 <main+0x30>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+  66:	50                   	push   %eax
+  67:	ff 33                	push   (%ebx)
+  69:	68 5b 0c 00 00       	push   $0xc5b
+  6e:	6a 01                	push   $0x1
+  70:	e8 9b 08 00 00       	call   910 <printf>
+      exit();
+  75:	e8 ff 03 00 00       	call   479 <exit>
+  }
+  exit();
+  7a:	e8 fa 03 00 00       	call   479 <exit>
+    wc(0, "");
+  7f:	52                   	push   %edx
+  80:	52                   	push   %edx
+  81:	68 4d 0c 00 00       	push   $0xc4d
+  86:	6a 00                	push   $0x0
+  88:	e8 13 00 00 00       	call   a0 <wc>
+    exit();
+  8d:	e8 e7 03 00 00       	call   479 <exit>
+  92:	66 90                	xchg   %ax,%ax
+  94:	66 90                	xchg   %ax,%ax
+  96:	66 90                	xchg   %ax,%ax
+  98:	66 90                	xchg   %ax,%ax
+  9a:	66 90                	xchg   %ax,%ax
+  9c:	66 90                	xchg   %ax,%ax
+  9e:	66 90                	xchg   %ax,%ax
+
+000000a0 <wc>:
+{
+  a0:	55                   	push   %ebp
+  l = w = c = 0;
+  a1:	31 d2                	xor    %edx,%edx
+{
+  a3:	89 e5                	mov    %esp,%ebp
+  a5:	57                   	push   %edi
+  a6:	56                   	push   %esi
+  inword = 0;
+  a7:	31 f6                	xor    %esi,%esi
+{
+  a9:	53                   	push   %ebx
+  l = w = c = 0;
+  aa:	31 db                	xor    %ebx,%ebx
+{
+  ac:	83 ec 1c             	sub    $0x1c,%esp
+  l = w = c = 0;
+  af:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  b6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  c0:	83 ec 04             	sub    $0x4,%esp
+  c3:	68 00 02 00 00       	push   $0x200
+  c8:	68 00 10 00 00       	push   $0x1000
+  cd:	ff 75 08             	push   0x8(%ebp)
+  d0:	e8 fb 03 00 00       	call   4d0 <read>
+  d5:	83 c4 10             	add    $0x10,%esp
+  d8:	89 c1                	mov    %eax,%ecx
+  da:	85 c0                	test   %eax,%eax
+  dc:	7e 62                	jle    140 <wc+0xa0>
+    for(i=0; i<n; i++){
+  de:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  e1:	31 ff                	xor    %edi,%edi
+  e3:	eb 0d                	jmp    f2 <wc+0x52>
+  e5:	8d 76 00             	lea    0x0(%esi),%esi
+        inword = 0;
+  e8:	31 f6                	xor    %esi,%esi
+    for(i=0; i<n; i++){
+  ea:	83 c7 01             	add    $0x1,%edi
+  ed:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  f0:	74 3e                	je     130 <wc+0x90>
+      if(buf[i] == '\n')
+  f2:	0f be 87 00 10 00 00 	movsbl 0x1000(%edi),%eax
+        l++;
+  f9:	31 c9                	xor    %ecx,%ecx
+  fb:	3c 0a                	cmp    $0xa,%al
+  fd:	0f 94 c1             	sete   %cl
+      if(strchr(" \r\t\n\v", buf[i]))
+ 100:	83 ec 08             	sub    $0x8,%esp
+ 103:	50                   	push   %eax
+        l++;
+ 104:	01 cb                	add    %ecx,%ebx
+      if(strchr(" \r\t\n\v", buf[i]))
+ 106:	68 38 0c 00 00       	push   $0xc38
+ 10b:	e8 50 01 00 00       	call   260 <strchr>
+ 110:	83 c4 10             	add    $0x10,%esp
+ 113:	85 c0                	test   %eax,%eax
+ 115:	75 d1                	jne    e8 <wc+0x48>
+      else if(!inword){
+ 117:	85 f6                	test   %esi,%esi
+ 119:	75 cf                	jne    ea <wc+0x4a>
+        w++;
+ 11b:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+        inword = 1;
+ 11f:	be 01 00 00 00       	mov    $0x1,%esi
+    for(i=0; i<n; i++){
+ 124:	83 c7 01             	add    $0x1,%edi
+ 127:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+ 12a:	75 c6                	jne    f2 <wc+0x52>
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      c++;
+ 130:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 133:	01 4d dc             	add    %ecx,-0x24(%ebp)
+ 136:	eb 88                	jmp    c0 <wc+0x20>
+ 138:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13f:	90                   	nop
+  if(n < 0){
+ 140:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 143:	75 22                	jne    167 <wc+0xc7>
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+ 145:	83 ec 08             	sub    $0x8,%esp
+ 148:	ff 75 0c             	push   0xc(%ebp)
+ 14b:	52                   	push   %edx
+ 14c:	ff 75 e0             	push   -0x20(%ebp)
+ 14f:	53                   	push   %ebx
+ 150:	68 4e 0c 00 00       	push   $0xc4e
+ 155:	6a 01                	push   $0x1
+ 157:	e8 b4 07 00 00       	call   910 <printf>
+}
+ 15c:	83 c4 20             	add    $0x20,%esp
+ 15f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 162:	5b                   	pop    %ebx
+ 163:	5e                   	pop    %esi
+ 164:	5f                   	pop    %edi
+ 165:	5d                   	pop    %ebp
+ 166:	c3                   	ret
+    printf(1, "wc: read error\n");
+ 167:	50                   	push   %eax
+ 168:	50                   	push   %eax
+ 169:	68 3e 0c 00 00       	push   $0xc3e
+ 16e:	6a 01                	push   $0x1
+ 170:	e8 9b 07 00 00       	call   910 <printf>
+    exit();
+ 175:	e8 ff 02 00 00       	call   479 <exit>
+ 17a:	66 90                	xchg   %ax,%ax
+ 17c:	66 90                	xchg   %ax,%ax
+ 17e:	66 90                	xchg   %ax,%ax
+
+00000180 <strcpy>:
+#include "date.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 180:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 181:	31 c0                	xor    %eax,%eax
+{
+ 183:	89 e5                	mov    %esp,%ebp
+ 185:	53                   	push   %ebx
+ 186:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 189:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 18c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 190:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 194:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 197:	83 c0 01             	add    $0x1,%eax
+ 19a:	84 d2                	test   %dl,%dl
+ 19c:	75 f2                	jne    190 <strcpy+0x10>
+    ;
+  return os;
+}
+ 19e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1a1:	89 c8                	mov    %ecx,%eax
+ 1a3:	c9                   	leave
+ 1a4:	c3                   	ret
+ 1a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	53                   	push   %ebx
+ 1b4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1ba:	0f b6 02             	movzbl (%edx),%eax
+ 1bd:	84 c0                	test   %al,%al
+ 1bf:	75 17                	jne    1d8 <strcmp+0x28>
+ 1c1:	eb 3a                	jmp    1fd <strcmp+0x4d>
+ 1c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1c7:	90                   	nop
+ 1c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1cc:	83 c2 01             	add    $0x1,%edx
+ 1cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1d2:	84 c0                	test   %al,%al
+ 1d4:	74 1a                	je     1f0 <strcmp+0x40>
+    p++, q++;
+ 1d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1d8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1db:	38 c3                	cmp    %al,%bl
+ 1dd:	74 e9                	je     1c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1df:	29 d8                	sub    %ebx,%eax
+}
+ 1e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1e4:	c9                   	leave
+ 1e5:	c3                   	ret
+ 1e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1f4:	31 c0                	xor    %eax,%eax
+ 1f6:	29 d8                	sub    %ebx,%eax
+}
+ 1f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1fb:	c9                   	leave
+ 1fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 200:	31 c0                	xor    %eax,%eax
+ 202:	eb db                	jmp    1df <strcmp+0x2f>
+ 204:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 20f:	90                   	nop
+
+00000210 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 216:	80 3a 00             	cmpb   $0x0,(%edx)
+ 219:	74 15                	je     230 <strlen+0x20>
+ 21b:	31 c0                	xor    %eax,%eax
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+ 220:	83 c0 01             	add    $0x1,%eax
+ 223:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 227:	89 c1                	mov    %eax,%ecx
+ 229:	75 f5                	jne    220 <strlen+0x10>
+    ;
+  return n;
+}
+ 22b:	89 c8                	mov    %ecx,%eax
+ 22d:	5d                   	pop    %ebp
+ 22e:	c3                   	ret
+ 22f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 230:	31 c9                	xor    %ecx,%ecx
+}
+ 232:	5d                   	pop    %ebp
+ 233:	89 c8                	mov    %ecx,%eax
+ 235:	c3                   	ret
+ 236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000240 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 247:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 24a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 24d:	89 d7                	mov    %edx,%edi
+ 24f:	fc                   	cld
+ 250:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 252:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 255:	89 d0                	mov    %edx,%eax
+ 257:	c9                   	leave
+ 258:	c3                   	ret
+ 259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	8b 45 08             	mov    0x8(%ebp),%eax
+ 266:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 26a:	0f b6 10             	movzbl (%eax),%edx
+ 26d:	84 d2                	test   %dl,%dl
+ 26f:	75 12                	jne    283 <strchr+0x23>
+ 271:	eb 1d                	jmp    290 <strchr+0x30>
+ 273:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 277:	90                   	nop
+ 278:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 27c:	83 c0 01             	add    $0x1,%eax
+ 27f:	84 d2                	test   %dl,%dl
+ 281:	74 0d                	je     290 <strchr+0x30>
+    if(*s == c)
+ 283:	38 d1                	cmp    %dl,%cl
+ 285:	75 f1                	jne    278 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 287:	5d                   	pop    %ebp
+ 288:	c3                   	ret
+ 289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 290:	31 c0                	xor    %eax,%eax
+}
+ 292:	5d                   	pop    %ebp
+ 293:	c3                   	ret
+ 294:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 29f:	90                   	nop
+
+000002a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	57                   	push   %edi
+ 2a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2a9:	31 db                	xor    %ebx,%ebx
+{
+ 2ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2ae:	eb 27                	jmp    2d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2b0:	83 ec 04             	sub    $0x4,%esp
+ 2b3:	6a 01                	push   $0x1
+ 2b5:	56                   	push   %esi
+ 2b6:	6a 00                	push   $0x0
+ 2b8:	e8 13 02 00 00       	call   4d0 <read>
+    if(cc < 1)
+ 2bd:	83 c4 10             	add    $0x10,%esp
+ 2c0:	85 c0                	test   %eax,%eax
+ 2c2:	7e 1d                	jle    2e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 2c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2cf:	3c 0a                	cmp    $0xa,%al
+ 2d1:	74 10                	je     2e3 <gets+0x43>
+ 2d3:	3c 0d                	cmp    $0xd,%al
+ 2d5:	74 0c                	je     2e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2d7:	89 df                	mov    %ebx,%edi
+ 2d9:	83 c3 01             	add    $0x1,%ebx
+ 2dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2df:	7c cf                	jl     2b0 <gets+0x10>
+ 2e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 2e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 2ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2ed:	5b                   	pop    %ebx
+ 2ee:	5e                   	pop    %esi
+ 2ef:	5f                   	pop    %edi
+ 2f0:	5d                   	pop    %ebp
+ 2f1:	c3                   	ret
+ 2f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	56                   	push   %esi
+ 304:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 305:	83 ec 08             	sub    $0x8,%esp
+ 308:	6a 00                	push   $0x0
+ 30a:	ff 75 08             	push   0x8(%ebp)
+ 30d:	e8 4f 02 00 00       	call   561 <open>
+  if(fd < 0)
+ 312:	83 c4 10             	add    $0x10,%esp
+ 315:	85 c0                	test   %eax,%eax
+ 317:	78 27                	js     340 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 319:	83 ec 08             	sub    $0x8,%esp
+ 31c:	ff 75 0c             	push   0xc(%ebp)
+ 31f:	89 c3                	mov    %eax,%ebx
+ 321:	50                   	push   %eax
+ 322:	e8 91 02 00 00       	call   5b8 <fstat>
+  close(fd);
+ 327:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 32a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 32c:	e8 d9 01 00 00       	call   50a <close>
+  return r;
+ 331:	83 c4 10             	add    $0x10,%esp
+}
+ 334:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 337:	89 f0                	mov    %esi,%eax
+ 339:	5b                   	pop    %ebx
+ 33a:	5e                   	pop    %esi
+ 33b:	5d                   	pop    %ebp
+ 33c:	c3                   	ret
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 340:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 345:	eb ed                	jmp    334 <stat+0x34>
+ 347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34e:	66 90                	xchg   %ax,%ax
+
+00000350 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	53                   	push   %ebx
+ 354:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 357:	0f be 02             	movsbl (%edx),%eax
+ 35a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 35d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 360:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 365:	77 1e                	ja     385 <atoi+0x35>
+ 367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 370:	83 c2 01             	add    $0x1,%edx
+ 373:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 376:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 37a:	0f be 02             	movsbl (%edx),%eax
+ 37d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 380:	80 fb 09             	cmp    $0x9,%bl
+ 383:	76 eb                	jbe    370 <atoi+0x20>
+  return n;
+}
+ 385:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 388:	89 c8                	mov    %ecx,%eax
+ 38a:	c9                   	leave
+ 38b:	c3                   	ret
+ 38c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	57                   	push   %edi
+ 394:	56                   	push   %esi
+ 395:	8b 45 10             	mov    0x10(%ebp),%eax
+ 398:	8b 55 08             	mov    0x8(%ebp),%edx
+ 39b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 39e:	85 c0                	test   %eax,%eax
+ 3a0:	7e 13                	jle    3b5 <memmove+0x25>
+ 3a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3a4:	89 d7                	mov    %edx,%edi
+ 3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3b1:	39 f8                	cmp    %edi,%eax
+ 3b3:	75 fb                	jne    3b0 <memmove+0x20>
+  return vdst;
+}
+ 3b5:	5e                   	pop    %esi
+ 3b6:	89 d0                	mov    %edx,%eax
+ 3b8:	5f                   	pop    %edi
+ 3b9:	5d                   	pop    %ebp
+ 3ba:	c3                   	ret
+ 3bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3bf:	90                   	nop
+
+000003c0 <ugetpid>:
+// getpid() without a system call, from the page at UPROC.
+int
+ugetpid(void)
+{
+  return ((struct uproc*)UPROC)->pid;
+}
+ 3c0:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+ 3c5:	c3                   	ret
+ 3c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003d0 <uclocktime>:
+
+// clocktime() without a system call, from the page at UCLOCK.
+int
+uclocktime(struct timespec *ts)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	57                   	push   %edi
+ 3d4:	56                   	push   %esi
+ 3d5:	53                   	push   %ebx
+ 3d6:	83 ec 1c             	sub    $0x1c,%esp
+  struct uclock *c = (struct uclock*)UCLOCK;
+
+  if(c->tscmult == 0)
+ 3d9:	8b 0d 08 f0 ff 7f    	mov    0x7ffff008,%ecx
+{
+ 3df:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(c->tscmult == 0)
+ 3e2:	85 c9                	test   %ecx,%ecx
+ 3e4:	74 6a                	je     450 <uclocktime+0x80>
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+ 3e6:	0f 31                	rdtsc
+static inline void
+uclockread(struct uclock *c, uint64 tsc, struct timespec *ts)
+{
+  uint64 d, ns;
+
+  d = tsc - c->tscbase;
+ 3e8:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 3ee:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+ 3f4:	89 c6                	mov    %eax,%esi
+  if((long long)d < 0)  // another CPU's TSC is a little behind
+ 3f6:	85 d2                	test   %edx,%edx
+ 3f8:	78 46                	js     440 <uclocktime+0x70>
+    d = 0;
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 3fa:	89 d0                	mov    %edx,%eax
+ 3fc:	f7 e1                	mul    %ecx
+ 3fe:	0f a4 c2 08          	shld   $0x8,%eax,%edx
+ 402:	c1 e0 08             	shl    $0x8,%eax
+ 405:	89 45 e0             	mov    %eax,-0x20(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+ 408:	89 f0                	mov    %esi,%eax
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 40a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+ 40d:	f7 e1                	mul    %ecx
+ 40f:	0f ac d0 18          	shrd   $0x18,%edx,%eax
+ 413:	c1 ea 18             	shr    $0x18,%edx
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 416:	03 45 e0             	add    -0x20(%ebp),%eax
+ 419:	13 55 e4             	adc    -0x1c(%ebp),%edx
+// linked with libgcc, so it cannot use 64-bit '/' or '%'.
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+  asm("divl %4" : "=a" (q), "=d" (r) : "a" ((uint)n), "d" ((uint)(n>>32)), "rm" (d));
+ 41c:	89 c7                	mov    %eax,%edi
+ 41e:	89 f8                	mov    %edi,%eax
+ 420:	b9 00 ca 9a 3b       	mov    $0x3b9aca00,%ecx
+ 425:	f7 f1                	div    %ecx
+  ts->sec = divl(ns, 1000000000, &ts->nsec);
+ 427:	89 03                	mov    %eax,(%ebx)
+    return clocktime(ts);
+  uclockread(c, rdtsc(), ts);
+  return 0;
+}
+ 429:	31 c0                	xor    %eax,%eax
+  *rem = r;
+ 42b:	89 53 04             	mov    %edx,0x4(%ebx)
+ 42e:	83 c4 1c             	add    $0x1c,%esp
+ 431:	5b                   	pop    %ebx
+ 432:	5e                   	pop    %esi
+ 433:	5f                   	pop    %edi
+ 434:	5d                   	pop    %ebp
+ 435:	c3                   	ret
+ 436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+ 440:	31 d2                	xor    %edx,%edx
+ 442:	31 ff                	xor    %edi,%edi
+ 444:	eb d8                	jmp    41e <uclocktime+0x4e>
+ 446:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44d:	8d 76 00             	lea    0x0(%esi),%esi
+ 450:	83 c4 1c             	add    $0x1c,%esp
+ 453:	5b                   	pop    %ebx
+ 454:	5e                   	pop    %esi
+ 455:	5f                   	pop    %edi
+ 456:	5d                   	pop    %ebp
+    return clocktime(ts);
+ 457:	e9 f2 02 00 00       	jmp    74e <clocktime>
+
+0000045c <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+ 45c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 461:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 468:	00 00 00 
+ 46b:	74 09                	je     476 <fork+0x1a>
+ 46d:	89 e1                	mov    %esp,%ecx
+ 46f:	ba 78 04 00 00       	mov    $0x478,%edx
+ 474:	0f 34                	sysenter
+ 476:	cd 40                	int    $0x40
+ 478:	c3                   	ret
+
+00000479 <exit>:
+SYSCALL(exit)
+ 479:	b8 02 00 00 00       	mov    $0x2,%eax
+ 47e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 485:	00 00 00 
+ 488:	74 09                	je     493 <exit+0x1a>
+ 48a:	89 e1                	mov    %esp,%ecx
+ 48c:	ba 95 04 00 00       	mov    $0x495,%edx
+ 491:	0f 34                	sysenter
+ 493:	cd 40                	int    $0x40
+ 495:	c3                   	ret
+
+00000496 <wait>:
+SYSCALL(wait)
+ 496:	b8 03 00 00 00       	mov    $0x3,%eax
+ 49b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4a2:	00 00 00 
+ 4a5:	74 09                	je     4b0 <wait+0x1a>
+ 4a7:	89 e1                	mov    %esp,%ecx
+ 4a9:	ba b2 04 00 00       	mov    $0x4b2,%edx
+ 4ae:	0f 34                	sysenter
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <pipe>:
+SYSCALL(pipe)
+ 4b3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4b8:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4bf:	00 00 00 
+ 4c2:	74 09                	je     4cd <pipe+0x1a>
+ 4c4:	89 e1                	mov    %esp,%ecx
+ 4c6:	ba cf 04 00 00       	mov    $0x4cf,%edx
+ 4cb:	0f 34                	sysenter
+ 4cd:	cd 40                	int    $0x40
+ 4cf:	c3                   	ret
+
+000004d0 <read>:
+SYSCALL(read)
+ 4d0:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4d5:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4dc:	00 00 00 
+ 4df:	74 09                	je     4ea <read+0x1a>
+ 4e1:	89 e1                	mov    %esp,%ecx
+ 4e3:	ba ec 04 00 00       	mov    $0x4ec,%edx
+ 4e8:	0f 34                	sysenter
+ 4ea:	cd 40                	int    $0x40
+ 4ec:	c3                   	ret
+
+000004ed <write>:
+SYSCALL(write)
+ 4ed:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4f2:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4f9:	00 00 00 
+ 4fc:	74 09                	je     507 <write+0x1a>
+ 4fe:	89 e1                	mov    %esp,%ecx
+ 500:	ba 09 05 00 00       	mov    $0x509,%edx
+ 505:	0f 34                	sysenter
+ 507:	cd 40                	int    $0x40
+ 509:	c3                   	ret
+
+0000050a <close>:
+SYSCALL(close)
+ 50a:	b8 15 00 00 00       	mov    $0x15,%eax
+ 50f:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 516:	00 00 00 
+ 519:	74 09                	je     524 <close+0x1a>
+ 51b:	89 e1                	mov    %esp,%ecx
+ 51d:	ba 26 05 00 00       	mov    $0x526,%edx
+ 522:	0f 34                	sysenter
+ 524:	cd 40                	int    $0x40
+ 526:	c3                   	ret
+
+00000527 <kill>:
+SYSCALL(kill)
+ 527:	b8 06 00 00 00       	mov    $0x6,%eax
+ 52c:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 533:	00 00 00 
+ 536:	74 09                	je     541 <kill+0x1a>
+ 538:	89 e1                	mov    %esp,%ecx
+ 53a:	ba 43 05 00 00       	mov    $0x543,%edx
+ 53f:	0f 34                	sysenter
+ 541:	cd 40                	int    $0x40
+ 543:	c3                   	ret
+
+00000544 <exec>:
+SYSCALL(exec)
+ 544:	b8 07 00 00 00       	mov    $0x7,%eax
+ 549:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 550:	00 00 00 
+ 553:	74 09                	je     55e <exec+0x1a>
+ 555:	89 e1                	mov    %esp,%ecx
+ 557:	ba 60 05 00 00       	mov    $0x560,%edx
+ 55c:	0f 34                	sysenter
+ 55e:	cd 40                	int    $0x40
+ 560:	c3                   	ret
+
+00000561 <open>:
+SYSCALL(open)
+ 561:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 566:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 56d:	00 00 00 
+ 570:	74 09                	je     57b <open+0x1a>
+ 572:	89 e1                	mov    %esp,%ecx
+ 574:	ba 7d 05 00 00       	mov    $0x57d,%edx
+ 579:	0f 34                	sysenter
+ 57b:	cd 40                	int    $0x40
+ 57d:	c3                   	ret
+
+0000057e <mknod>:
+SYSCALL(mknod)
+ 57e:	b8 11 00 00 00       	mov    $0x11,%eax
+ 583:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 58a:	00 00 00 
+ 58d:	74 09                	je     598 <mknod+0x1a>
+ 58f:	89 e1                	mov    %esp,%ecx
+ 591:	ba 9a 05 00 00       	mov    $0x59a,%edx
+ 596:	0f 34                	sysenter
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <unlink>:
+SYSCALL(unlink)
+ 59b:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5a0:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5a7:	00 00 00 
+ 5aa:	74 09                	je     5b5 <unlink+0x1a>
+ 5ac:	89 e1                	mov    %esp,%ecx
+ 5ae:	ba b7 05 00 00       	mov    $0x5b7,%edx
+ 5b3:	0f 34                	sysenter
+ 5b5:	cd 40                	int    $0x40
+ 5b7:	c3                   	ret
+
+000005b8 <fstat>:
+SYSCALL(fstat)
+ 5b8:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5bd:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5c4:	00 00 00 
+ 5c7:	74 09                	je     5d2 <fstat+0x1a>
+ 5c9:	89 e1                	mov    %esp,%ecx
+ 5cb:	ba d4 05 00 00       	mov    $0x5d4,%edx
+ 5d0:	0f 34                	sysenter
+ 5d2:	cd 40                	int    $0x40
+ 5d4:	c3                   	ret
+
+000005d5 <link>:
+SYSCALL(link)
+ 5d5:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5da:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5e1:	00 00 00 
+ 5e4:	74 09                	je     5ef <link+0x1a>
+ 5e6:	89 e1                	mov    %esp,%ecx
+ 5e8:	ba f1 05 00 00       	mov    $0x5f1,%edx
+ 5ed:	0f 34                	sysenter
+ 5ef:	cd 40                	int    $0x40
+ 5f1:	c3                   	ret
+
+000005f2 <mkdir>:
+SYSCALL(mkdir)
+ 5f2:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5f7:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5fe:	00 00 00 
+ 601:	74 09                	je     60c <mkdir+0x1a>
+ 603:	89 e1                	mov    %esp,%ecx
+ 605:	ba 0e 06 00 00       	mov    $0x60e,%edx
+ 60a:	0f 34                	sysenter
+ 60c:	cd 40                	int    $0x40
+ 60e:	c3                   	ret
+
+0000060f <chdir>:
+SYSCALL(chdir)
+ 60f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 614:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 61b:	00 00 00 
+ 61e:	74 09                	je     629 <chdir+0x1a>
+ 620:	89 e1                	mov    %esp,%ecx
+ 622:	ba 2b 06 00 00       	mov    $0x62b,%edx
+ 627:	0f 34                	sysenter
+ 629:	cd 40                	int    $0x40
+ 62b:	c3                   	ret
+
+0000062c <dup>:
+SYSCALL(dup)
+ 62c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 631:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 638:	00 00 00 
+ 63b:	74 09                	je     646 <dup+0x1a>
+ 63d:	89 e1                	mov    %esp,%ecx
+ 63f:	ba 48 06 00 00       	mov    $0x648,%edx
+ 644:	0f 34                	sysenter
+ 646:	cd 40                	int    $0x40
+ 648:	c3                   	ret
+
+00000649 <getpid>:
+SYSCALL(getpid)
+ 649:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 64e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 655:	00 00 00 
+ 658:	74 09                	je     663 <getpid+0x1a>
+ 65a:	89 e1                	mov    %esp,%ecx
+ 65c:	ba 65 06 00 00       	mov    $0x665,%edx
+ 661:	0f 34                	sysenter
+ 663:	cd 40                	int    $0x40
+ 665:	c3                   	ret
+
+00000666 <sbrk>:
+SYSCALL(sbrk)
+ 666:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 66b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 672:	00 00 00 
+ 675:	74 09                	je     680 <sbrk+0x1a>
+ 677:	89 e1                	mov    %esp,%ecx
+ 679:	ba 82 06 00 00       	mov    $0x682,%edx
+ 67e:	0f 34                	sysenter
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <sleep>:
+SYSCALL(sleep)
+ 683:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 688:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 68f:	00 00 00 
+ 692:	74 09                	je     69d <sleep+0x1a>
+ 694:	89 e1                	mov    %esp,%ecx
+ 696:	ba 9f 06 00 00       	mov    $0x69f,%edx
+ 69b:	0f 34                	sysenter
+ 69d:	cd 40                	int    $0x40
+ 69f:	c3                   	ret
+
+000006a0 <uptime>:
+SYSCALL(uptime)
+ 6a0:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 6a5:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6ac:	00 00 00 
+ 6af:	74 09                	je     6ba <uptime+0x1a>
+ 6b1:	89 e1                	mov    %esp,%ecx
+ 6b3:	ba bc 06 00 00       	mov    $0x6bc,%edx
+ 6b8:	0f 34                	sysenter
+ 6ba:	cd 40                	int    $0x40
+ 6bc:	c3                   	ret
+
+000006bd <swapread>:
+SYSCALL(swapread)
+ 6bd:	b8 16 00 00 00       	mov    $0x16,%eax
+ 6c2:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6c9:	00 00 00 
+ 6cc:	74 09                	je     6d7 <swapread+0x1a>
+ 6ce:	89 e1                	mov    %esp,%ecx
+ 6d0:	ba d9 06 00 00       	mov    $0x6d9,%edx
+ 6d5:	0f 34                	sysenter
+ 6d7:	cd 40                	int    $0x40
+ 6d9:	c3                   	ret
+
+000006da <swapwrite>:
+SYSCALL(swapwrite)
+ 6da:	b8 17 00 00 00       	mov    $0x17,%eax
+ 6df:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6e6:	00 00 00 
+ 6e9:	74 09                	je     6f4 <swapwrite+0x1a>
+ 6eb:	89 e1                	mov    %esp,%ecx
+ 6ed:	ba f6 06 00 00       	mov    $0x6f6,%edx
+ 6f2:	0f 34                	sysenter
+ 6f4:	cd 40                	int    $0x40
+ 6f6:	c3                   	ret
+
+000006f7 <setaffinity>:
+SYSCALL(setaffinity)
+ 6f7:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6fc:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 703:	00 00 00 
+ 706:	74 09                	je     711 <setaffinity+0x1a>
+ 708:	89 e1                	mov    %esp,%ecx
+ 70a:	ba 13 07 00 00       	mov    $0x713,%edx
+ 70f:	0f 34                	sysenter
+ 711:	cd 40                	int    $0x40
+ 713:	c3                   	ret
+
+00000714 <getaffinity>:
+SYSCALL(getaffinity)
+ 714:	b8 19 00 00 00       	mov    $0x19,%eax
+ 719:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 720:	00 00 00 
+ 723:	74 09                	je     72e <getaffinity+0x1a>
+ 725:	89 e1                	mov    %esp,%ecx
+ 727:	ba 30 07 00 00       	mov    $0x730,%edx
+ 72c:	0f 34                	sysenter
+ 72e:	cd 40                	int    $0x40
+ 730:	c3                   	ret
+
+00000731 <nanosleep>:
+SYSCALL(nanosleep)
+ 731:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 736:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 73d:	00 00 00 
+ 740:	74 09                	je     74b <nanosleep+0x1a>
+ 742:	89 e1                	mov    %esp,%ecx
+ 744:	ba 4d 07 00 00       	mov    $0x74d,%edx
+ 749:	0f 34                	sysenter
+ 74b:	cd 40                	int    $0x40
+ 74d:	c3                   	ret
+
+0000074e <clocktime>:
+SYSCALL(clocktime)
+ 74e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 753:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 75a:	00 00 00 
+ 75d:	74 09                	je     768 <clocktime+0x1a>
+ 75f:	89 e1                	mov    %esp,%ecx
+ 761:	ba 6a 07 00 00       	mov    $0x76a,%edx
+ 766:	0f 34                	sysenter
+ 768:	cd 40                	int    $0x40
+ 76a:	c3                   	ret
+
+0000076b <batch>:
+SYSCALL(batch)
+ 76b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 770:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 777:	00 00 00 
+ 77a:	74 09                	je     785 <batch+0x1a>
+ 77c:	89 e1                	mov    %esp,%ecx
+ 77e:	ba 87 07 00 00       	mov    $0x787,%edx
+ 783:	0f 34                	sysenter
+ 785:	cd 40                	int    $0x40
+ 787:	c3                   	ret
+
+00000788 <aiosetup>:
+SYSCALL(aiosetup)
+ 788:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 78d:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 794:	00 00 00 
+ 797:	74 09                	je     7a2 <aiosetup+0x1a>
+ 799:	89 e1                	mov    %esp,%ecx
+ 79b:	ba a4 07 00 00       	mov    $0x7a4,%edx
+ 7a0:	0f 34                	sysenter
+ 7a2:	cd 40                	int    $0x40
+ 7a4:	c3                   	ret
+
+000007a5 <aiowait>:
+SYSCALL(aiowait)
+ 7a5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 7aa:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 7b1:	00 00 00 
+ 7b4:	74 09                	je     7bf <aiowait+0x1a>
+ 7b6:	89 e1                	mov    %esp,%ecx
+ 7b8:	ba c1 07 00 00       	mov    $0x7c1,%edx
+ 7bd:	0f 34                	sysenter
+ 7bf:	cd 40                	int    $0x40
+ 7c1:	c3                   	ret
+
+000007c2 <spawn>:
+SYSCALL(spawn)
+ 7c2:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 7c7:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 7ce:	00 00 00 
+ 7d1:	74 09                	je     7dc <spawn+0x1a>
+ 7d3:	89 e1                	mov    %esp,%ecx
+ 7d5:	ba de 07 00 00       	mov    $0x7de,%edx
+ 7da:	0f 34                	sysenter
+ 7dc:	cd 40                	int    $0x40
+ 7de:	c3                   	ret
+
+000007df <getprocinfo>:
+SYSCALL(getprocinfo)
+ 7df:	b8 20 00 00 00       	mov    $0x20,%eax
+ 7e4:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 7eb:	00 00 00 
+ 7ee:	74 09                	je     7f9 <getprocinfo+0x1a>
+ 7f0:	89 e1                	mov    %esp,%ecx
+ 7f2:	ba fb 07 00 00       	mov    $0x7fb,%edx
+ 7f7:	0f 34                	sysenter
+ 7f9:	cd 40                	int    $0x40
+ 7fb:	c3                   	ret
+
+000007fc <getlockstat>:
+SYSCALL(getlockstat)
+ 7fc:	b8 21 00 00 00       	mov    $0x21,%eax
+ 801:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 808:	00 00 00 
+ 80b:	74 09                	je     816 <getlockstat+0x1a>
+ 80d:	89 e1                	mov    %esp,%ecx
+ 80f:	ba 18 08 00 00       	mov    $0x818,%edx
+ 814:	0f 34                	sysenter
+ 816:	cd 40                	int    $0x40
+ 818:	c3                   	ret
+
+00000819 <lockprof>:
+SYSCALL(lockprof)
+ 819:	b8 22 00 00 00       	mov    $0x22,%eax
+ 81e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 825:	00 00 00 
+ 828:	74 09                	je     833 <lockprof+0x1a>
+ 82a:	89 e1                	mov    %esp,%ecx
+ 82c:	ba 35 08 00 00       	mov    $0x835,%edx
+ 831:	0f 34                	sysenter
+ 833:	cd 40                	int    $0x40
+ 835:	c3                   	ret
+
+00000836 <getlockprof>:
+SYSCALL(getlockprof)
+ 836:	b8 23 00 00 00       	mov    $0x23,%eax
+ 83b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 842:	00 00 00 
+ 845:	74 09                	je     850 <getlockprof+0x1a>
+ 847:	89 e1                	mov    %esp,%ecx
+ 849:	ba 52 08 00 00       	mov    $0x852,%edx
+ 84e:	0f 34                	sysenter
+ 850:	cd 40                	int    $0x40
+ 852:	c3                   	ret
+
+00000853 <diskstat>:
+SYSCALL(diskstat)
+ 853:	b8 24 00 00 00       	mov    $0x24,%eax
+ 858:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 85f:	00 00 00 
+ 862:	74 09                	je     86d <diskstat+0x1a>
+ 864:	89 e1                	mov    %esp,%ecx
+ 866:	ba 6f 08 00 00       	mov    $0x86f,%edx
+ 86b:	0f 34                	sysenter
+ 86d:	cd 40                	int    $0x40
+ 86f:	c3                   	ret
+
+00000870 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 870:	55                   	push   %ebp
+ 871:	89 e5                	mov    %esp,%ebp
+ 873:	57                   	push   %edi
+ 874:	56                   	push   %esi
+ 875:	53                   	push   %ebx
+ 876:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 878:	89 d1                	mov    %edx,%ecx
+{
+ 87a:	83 ec 3c             	sub    $0x3c,%esp
+ 87d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 880:	85 d2                	test   %edx,%edx
+ 882:	0f 89 80 00 00 00    	jns    908 <printint+0x98>
+ 888:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 88c:	74 7a                	je     908 <printint+0x98>
+    x = -xx;
+ 88e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 890:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 895:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 898:	31 f6                	xor    %esi,%esi
+ 89a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 8a0:	89 c8                	mov    %ecx,%eax
+ 8a2:	31 d2                	xor    %edx,%edx
+ 8a4:	89 f7                	mov    %esi,%edi
+ 8a6:	f7 f3                	div    %ebx
+ 8a8:	8d 76 01             	lea    0x1(%esi),%esi
+ 8ab:	0f b6 92 d0 0c 00 00 	movzbl 0xcd0(%edx),%edx
+ 8b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 8b6:	89 ca                	mov    %ecx,%edx
+ 8b8:	89 c1                	mov    %eax,%ecx
+ 8ba:	39 da                	cmp    %ebx,%edx
+ 8bc:	73 e2                	jae    8a0 <printint+0x30>
+  if(neg)
+ 8be:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 8c1:	85 c0                	test   %eax,%eax
+ 8c3:	74 07                	je     8cc <printint+0x5c>
+    buf[i++] = '-';
+ 8c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 8ca:	89 f7                	mov    %esi,%edi
+ 8cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 8cf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 8d2:	01 df                	add    %ebx,%edi
+ 8d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 8d8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 8db:	83 ec 04             	sub    $0x4,%esp
+ 8de:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 8e1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 8e4:	6a 01                	push   $0x1
+ 8e6:	50                   	push   %eax
+ 8e7:	56                   	push   %esi
+ 8e8:	e8 00 fc ff ff       	call   4ed <write>
+  while(--i >= 0)
+ 8ed:	89 f8                	mov    %edi,%eax
+ 8ef:	83 c4 10             	add    $0x10,%esp
+ 8f2:	83 ef 01             	sub    $0x1,%edi
+ 8f5:	39 d8                	cmp    %ebx,%eax
+ 8f7:	75 df                	jne    8d8 <printint+0x68>
+}
+ 8f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8fc:	5b                   	pop    %ebx
+ 8fd:	5e                   	pop    %esi
+ 8fe:	5f                   	pop    %edi
+ 8ff:	5d                   	pop    %ebp
+ 900:	c3                   	ret
+ 901:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 908:	31 c0                	xor    %eax,%eax
+ 90a:	eb 89                	jmp    895 <printint+0x25>
+ 90c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000910 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 910:	55                   	push   %ebp
+ 911:	89 e5                	mov    %esp,%ebp
+ 913:	57                   	push   %edi
+ 914:	56                   	push   %esi
+ 915:	53                   	push   %ebx
+ 916:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 919:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 91c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 91f:	0f b6 1e             	movzbl (%esi),%ebx
+ 922:	83 c6 01             	add    $0x1,%esi
+ 925:	84 db                	test   %bl,%bl
+ 927:	74 67                	je     990 <printf+0x80>
+ 929:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 92c:	31 d2                	xor    %edx,%edx
+ 92e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 931:	eb 34                	jmp    967 <printf+0x57>
+ 933:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 937:	90                   	nop
+ 938:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 93b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 940:	83 f8 25             	cmp    $0x25,%eax
+ 943:	74 18                	je     95d <printf+0x4d>
+  write(fd, &c, 1);
+ 945:	83 ec 04             	sub    $0x4,%esp
+ 948:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 94b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 94e:	6a 01                	push   $0x1
+ 950:	50                   	push   %eax
+ 951:	57                   	push   %edi
+ 952:	e8 96 fb ff ff       	call   4ed <write>
+ 957:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 95a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 95d:	0f b6 1e             	movzbl (%esi),%ebx
+ 960:	83 c6 01             	add    $0x1,%esi
+ 963:	84 db                	test   %bl,%bl
+ 965:	74 29                	je     990 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 967:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 96a:	85 d2                	test   %edx,%edx
+ 96c:	74 ca                	je     938 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 96e:	83 fa 25             	cmp    $0x25,%edx
+ 971:	75 ea                	jne    95d <printf+0x4d>
+      if(c == 'd'){
+ 973:	83 f8 25             	cmp    $0x25,%eax
+ 976:	0f 84 24 01 00 00    	je     aa0 <printf+0x190>
+ 97c:	83 e8 63             	sub    $0x63,%eax
+ 97f:	83 f8 15             	cmp    $0x15,%eax
+ 982:	77 1c                	ja     9a0 <printf+0x90>
+ 984:	ff 24 85 78 0c 00 00 	jmp    *0xc78(,%eax,4)
+ 98b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 98f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 990:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 993:	5b                   	pop    %ebx
+ 994:	5e                   	pop    %esi
+ 995:	5f                   	pop    %edi
+ 996:	5d                   	pop    %ebp
+ 997:	c3                   	ret
+ 998:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 99f:	90                   	nop
+  write(fd, &c, 1);
+ 9a0:	83 ec 04             	sub    $0x4,%esp
+ 9a3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9a6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 9aa:	6a 01                	push   $0x1
+ 9ac:	52                   	push   %edx
+ 9ad:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 9b0:	57                   	push   %edi
+ 9b1:	e8 37 fb ff ff       	call   4ed <write>
+ 9b6:	83 c4 0c             	add    $0xc,%esp
+ 9b9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9bc:	6a 01                	push   $0x1
+ 9be:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 9c1:	52                   	push   %edx
+ 9c2:	57                   	push   %edi
+ 9c3:	e8 25 fb ff ff       	call   4ed <write>
+        putc(fd, c);
+ 9c8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9cb:	31 d2                	xor    %edx,%edx
+ 9cd:	eb 8e                	jmp    95d <printf+0x4d>
+ 9cf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 9d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 9d3:	83 ec 0c             	sub    $0xc,%esp
+ 9d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 9db:	8b 13                	mov    (%ebx),%edx
+ 9dd:	6a 00                	push   $0x0
+ 9df:	89 f8                	mov    %edi,%eax
+        ap++;
+ 9e1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 9e4:	e8 87 fe ff ff       	call   870 <printint>
+        ap++;
+ 9e9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9ec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9ef:	31 d2                	xor    %edx,%edx
+ 9f1:	e9 67 ff ff ff       	jmp    95d <printf+0x4d>
+ 9f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9fd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ a00:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ a03:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ a05:	83 c0 04             	add    $0x4,%eax
+ a08:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ a0b:	85 db                	test   %ebx,%ebx
+ a0d:	0f 84 9d 00 00 00    	je     ab0 <printf+0x1a0>
+        while(*s != 0){
+ a13:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ a16:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ a18:	84 c0                	test   %al,%al
+ a1a:	0f 84 3d ff ff ff    	je     95d <printf+0x4d>
+ a20:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a23:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ a26:	89 de                	mov    %ebx,%esi
+ a28:	89 d3                	mov    %edx,%ebx
+ a2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ a30:	83 ec 04             	sub    $0x4,%esp
+ a33:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ a36:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ a39:	6a 01                	push   $0x1
+ a3b:	53                   	push   %ebx
+ a3c:	57                   	push   %edi
+ a3d:	e8 ab fa ff ff       	call   4ed <write>
+        while(*s != 0){
+ a42:	0f b6 06             	movzbl (%esi),%eax
+ a45:	83 c4 10             	add    $0x10,%esp
+ a48:	84 c0                	test   %al,%al
+ a4a:	75 e4                	jne    a30 <printf+0x120>
+      state = 0;
+ a4c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ a4f:	31 d2                	xor    %edx,%edx
+ a51:	e9 07 ff ff ff       	jmp    95d <printf+0x4d>
+ a56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a5d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ a60:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a63:	83 ec 0c             	sub    $0xc,%esp
+ a66:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a6b:	8b 13                	mov    (%ebx),%edx
+ a6d:	6a 01                	push   $0x1
+ a6f:	e9 6b ff ff ff       	jmp    9df <printf+0xcf>
+ a74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ a78:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ a7b:	83 ec 04             	sub    $0x4,%esp
+ a7e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ a81:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ a83:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ a86:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ a89:	6a 01                	push   $0x1
+ a8b:	52                   	push   %edx
+ a8c:	57                   	push   %edi
+ a8d:	e8 5b fa ff ff       	call   4ed <write>
+        ap++;
+ a92:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a95:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a98:	31 d2                	xor    %edx,%edx
+ a9a:	e9 be fe ff ff       	jmp    95d <printf+0x4d>
+ a9f:	90                   	nop
+  write(fd, &c, 1);
+ aa0:	83 ec 04             	sub    $0x4,%esp
+ aa3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ aa6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ aa9:	6a 01                	push   $0x1
+ aab:	e9 11 ff ff ff       	jmp    9c1 <printf+0xb1>
+ ab0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ ab5:	bb 6f 0c 00 00       	mov    $0xc6f,%ebx
+ aba:	e9 61 ff ff ff       	jmp    a20 <printf+0x110>
+ abf:	90                   	nop
+
+00000ac0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ ac0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ac1:	a1 00 12 00 00       	mov    0x1200,%eax
+{
+ ac6:	89 e5                	mov    %esp,%ebp
+ ac8:	57                   	push   %edi
+ ac9:	56                   	push   %esi
+ aca:	53                   	push   %ebx
+ acb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ ace:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ad1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ad8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ada:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ adc:	39 ca                	cmp    %ecx,%edx
+ ade:	73 30                	jae    b10 <free+0x50>
+ ae0:	39 c1                	cmp    %eax,%ecx
+ ae2:	72 04                	jb     ae8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ae4:	39 c2                	cmp    %eax,%edx
+ ae6:	72 f0                	jb     ad8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ ae8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ aeb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ aee:	39 f8                	cmp    %edi,%eax
+ af0:	74 2e                	je     b20 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ af2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ af5:	8b 42 04             	mov    0x4(%edx),%eax
+ af8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ afb:	39 f1                	cmp    %esi,%ecx
+ afd:	74 38                	je     b37 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ aff:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ b01:	5b                   	pop    %ebx
+  freep = p;
+ b02:	89 15 00 12 00 00    	mov    %edx,0x1200
+}
+ b08:	5e                   	pop    %esi
+ b09:	5f                   	pop    %edi
+ b0a:	5d                   	pop    %ebp
+ b0b:	c3                   	ret
+ b0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b10:	39 c1                	cmp    %eax,%ecx
+ b12:	72 d0                	jb     ae4 <free+0x24>
+ b14:	eb c2                	jmp    ad8 <free+0x18>
+ b16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b1d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ b20:	03 70 04             	add    0x4(%eax),%esi
+ b23:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b26:	8b 02                	mov    (%edx),%eax
+ b28:	8b 00                	mov    (%eax),%eax
+ b2a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ b2d:	8b 42 04             	mov    0x4(%edx),%eax
+ b30:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b33:	39 f1                	cmp    %esi,%ecx
+ b35:	75 c8                	jne    aff <free+0x3f>
+    p->s.size += bp->s.size;
+ b37:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ b3a:	89 15 00 12 00 00    	mov    %edx,0x1200
+    p->s.size += bp->s.size;
+ b40:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ b43:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ b46:	89 0a                	mov    %ecx,(%edx)
+}
+ b48:	5b                   	pop    %ebx
+ b49:	5e                   	pop    %esi
+ b4a:	5f                   	pop    %edi
+ b4b:	5d                   	pop    %ebp
+ b4c:	c3                   	ret
+ b4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b50 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ b50:	55                   	push   %ebp
+ b51:	89 e5                	mov    %esp,%ebp
+ b53:	57                   	push   %edi
+ b54:	56                   	push   %esi
+ b55:	53                   	push   %ebx
+ b56:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b59:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ b5c:	8b 15 00 12 00 00    	mov    0x1200,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b62:	8d 78 07             	lea    0x7(%eax),%edi
+ b65:	c1 ef 03             	shr    $0x3,%edi
+ b68:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ b6b:	85 d2                	test   %edx,%edx
+ b6d:	0f 84 8d 00 00 00    	je     c00 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b73:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b75:	8b 48 04             	mov    0x4(%eax),%ecx
+ b78:	39 f9                	cmp    %edi,%ecx
+ b7a:	73 64                	jae    be0 <malloc+0x90>
+  if(nu < 4096)
+ b7c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ b81:	39 df                	cmp    %ebx,%edi
+ b83:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ b86:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ b8d:	eb 0a                	jmp    b99 <malloc+0x49>
+ b8f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b90:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b92:	8b 48 04             	mov    0x4(%eax),%ecx
+ b95:	39 f9                	cmp    %edi,%ecx
+ b97:	73 47                	jae    be0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ b99:	89 c2                	mov    %eax,%edx
+ b9b:	39 05 00 12 00 00    	cmp    %eax,0x1200
+ ba1:	75 ed                	jne    b90 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ ba3:	83 ec 0c             	sub    $0xc,%esp
+ ba6:	56                   	push   %esi
+ ba7:	e8 ba fa ff ff       	call   666 <sbrk>
+  if(p == (char*)-1)
+ bac:	83 c4 10             	add    $0x10,%esp
+ baf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ bb2:	74 1c                	je     bd0 <malloc+0x80>
+  hp->s.size = nu;
+ bb4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ bb7:	83 ec 0c             	sub    $0xc,%esp
+ bba:	83 c0 08             	add    $0x8,%eax
+ bbd:	50                   	push   %eax
+ bbe:	e8 fd fe ff ff       	call   ac0 <free>
+  return freep;
+ bc3:	8b 15 00 12 00 00    	mov    0x1200,%edx
+      if((p = morecore(nunits)) == 0)
+ bc9:	83 c4 10             	add    $0x10,%esp
+ bcc:	85 d2                	test   %edx,%edx
+ bce:	75 c0                	jne    b90 <malloc+0x40>
+        return 0;
+  }
+}
+ bd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ bd3:	31 c0                	xor    %eax,%eax
+}
+ bd5:	5b                   	pop    %ebx
+ bd6:	5e                   	pop    %esi
+ bd7:	5f                   	pop    %edi
+ bd8:	5d                   	pop    %ebp
+ bd9:	c3                   	ret
+ bda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ be0:	39 cf                	cmp    %ecx,%edi
+ be2:	74 4c                	je     c30 <malloc+0xe0>
+        p->s.size -= nunits;
+ be4:	29 f9                	sub    %edi,%ecx
+ be6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ be9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ bec:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ bef:	89 15 00 12 00 00    	mov    %edx,0x1200
+}
+ bf5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ bf8:	83 c0 08             	add    $0x8,%eax
+}
+ bfb:	5b                   	pop    %ebx
+ bfc:	5e                   	pop    %esi
+ bfd:	5f                   	pop    %edi
+ bfe:	5d                   	pop    %ebp
+ bff:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ c00:	c7 05 00 12 00 00 04 	movl   $0x1204,0x1200
+ c07:	12 00 00 
+    base.s.size = 0;
+ c0a:	b8 04 12 00 00       	mov    $0x1204,%eax
+    base.s.ptr = freep = prevp = &base;
+ c0f:	c7 05 04 12 00 00 04 	movl   $0x1204,0x1204
+ c16:	12 00 00 
+    base.s.size = 0;
+ c19:	c7 05 08 12 00 00 00 	movl   $0x0,0x1208
+ c20:	00 00 00 
+    if(p->s.size >= nunits){
+ c23:	e9 54 ff ff ff       	jmp    b7c <malloc+0x2c>
+ c28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c2f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ c30:	8b 08                	mov    (%eax),%ecx
+ c32:	89 0a                	mov    %ecx,(%edx)
+ c34:	eb b9                	jmp    bef <malloc+0x9f>
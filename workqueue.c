@@ -0,0 +1,67 @@
+// Workqueues.
+//
+// Code that must not sleep or should not take long, such as
+// an interrupt handler, can fill in a struct work and queue it
+// with queuework().  One of the queue's kernel threads later
+// calls work->fn(work->arg) in process context, where it may
+// sleep.  A struct work may be queued again as soon as its
+// function has started, and queueing it while it is still
+// pending does nothing.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "spinlock.h"
+#include "workqueue.h"
+
+struct workqueue syswq;  // General-purpose queue, one thread
+
+static void
+wqthread(void *arg)
+{
+  struct workqueue *wq = arg;
+  struct work *w;
+
+  acquire(&wq->lock);
+  for(;;){
+    while((w = wq->head) == 0)
+      sleep(wq, &wq->lock);
+    wq->head = w->next;
+    w->pending = 0;
+    release(&wq->lock);
+    w->fn(w->arg);
+    acquire(&wq->lock);
+  }
+}
+
+// Set up wq, served by nthread kernel threads called name.
+void
+wqinit(struct workqueue *wq, char *name, int nthread)
+{
+  int i;
+
+  initlock(&wq->lock, name);
+  wq->head = 0;
+  for(i = 0; i < nthread; i++)
+    if(kthread_create(wqthread, wq, name) == 0)
+      panic("wqinit");
+}
+
+// Queue w on wq, unless it is already pending.
+// Safe to call from interrupt handlers.
+void
+queuework(struct workqueue *wq, struct work *w)
+{
+  acquire(&wq->lock);
+  if(!w->pending){
+    w->pending = 1;
+    w->next = 0;
+    if(wq->head)
+      wq->tail->next = w;
+    else
+      wq->head = w;
+    wq->tail = w;
+    wakeup(wq);
+  }
+  release(&wq->lock);
+}
@@ -0,0 +1,14 @@
+// Work to be done later by a workqueue's kernel threads.
+// Needs spinlock.h.
+struct work {
+  void (*fn)(void*);     // Called as fn(arg)
+  void *arg;
+  int pending;           // Queued and not yet started?
+  struct work *next;
+};
+
+struct workqueue {
+  struct spinlock lock;  // Protects the list and work.pending
+  struct work *head;
+  struct work *tail;
+};
@@ -0,0 +1,1514 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 f6 02 00 00       	call   30c <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7e 0d                	jle    27 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+  1a:	83 ec 0c             	sub    $0xc,%esp
+  1d:	6a 05                	push   $0x5
+  1f:	e8 0f 05 00 00       	call   533 <sleep>
+  24:	83 c4 10             	add    $0x10,%esp
+  exit();
+  27:	e8 fd 02 00 00       	call   329 <exit>
+  2c:	66 90                	xchg   %ax,%ax
+  2e:	66 90                	xchg   %ax,%ax
+
+00000030 <strcpy>:
+#include "date.h"
+#include "upage.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  30:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  31:	31 c0                	xor    %eax,%eax
+{
+  33:	89 e5                	mov    %esp,%ebp
+  35:	53                   	push   %ebx
+  36:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  40:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  44:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  47:	83 c0 01             	add    $0x1,%eax
+  4a:	84 d2                	test   %dl,%dl
+  4c:	75 f2                	jne    40 <strcpy+0x10>
+    ;
+  return os;
+}
+  4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  51:	89 c8                	mov    %ecx,%eax
+  53:	c9                   	leave
+  54:	c3                   	ret
+  55:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000060 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	53                   	push   %ebx
+  64:	8b 55 08             	mov    0x8(%ebp),%edx
+  67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  6a:	0f b6 02             	movzbl (%edx),%eax
+  6d:	84 c0                	test   %al,%al
+  6f:	75 17                	jne    88 <strcmp+0x28>
+  71:	eb 3a                	jmp    ad <strcmp+0x4d>
+  73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  77:	90                   	nop
+  78:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  7c:	83 c2 01             	add    $0x1,%edx
+  7f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  82:	84 c0                	test   %al,%al
+  84:	74 1a                	je     a0 <strcmp+0x40>
+    p++, q++;
+  86:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  88:	0f b6 19             	movzbl (%ecx),%ebx
+  8b:	38 c3                	cmp    %al,%bl
+  8d:	74 e9                	je     78 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  8f:	29 d8                	sub    %ebx,%eax
+}
+  91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  94:	c9                   	leave
+  95:	c3                   	ret
+  96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  a4:	31 c0                	xor    %eax,%eax
+  a6:	29 d8                	sub    %ebx,%eax
+}
+  a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  ab:	c9                   	leave
+  ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  ad:	0f b6 19             	movzbl (%ecx),%ebx
+  b0:	31 c0                	xor    %eax,%eax
+  b2:	eb db                	jmp    8f <strcmp+0x2f>
+  b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  bf:	90                   	nop
+
+000000c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  c6:	80 3a 00             	cmpb   $0x0,(%edx)
+  c9:	74 15                	je     e0 <strlen+0x20>
+  cb:	31 c0                	xor    %eax,%eax
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+  d0:	83 c0 01             	add    $0x1,%eax
+  d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  d7:	89 c1                	mov    %eax,%ecx
+  d9:	75 f5                	jne    d0 <strlen+0x10>
+    ;
+  return n;
+}
+  db:	89 c8                	mov    %ecx,%eax
+  dd:	5d                   	pop    %ebp
+  de:	c3                   	ret
+  df:	90                   	nop
+  for(n = 0; s[n]; n++)
+  e0:	31 c9                	xor    %ecx,%ecx
+}
+  e2:	5d                   	pop    %ebp
+  e3:	89 c8                	mov    %ecx,%eax
+  e5:	c3                   	ret
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	57                   	push   %edi
+  f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fd:	89 d7                	mov    %edx,%edi
+  ff:	fc                   	cld
+ 100:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 102:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 105:	89 d0                	mov    %edx,%eax
+ 107:	c9                   	leave
+ 108:	c3                   	ret
+ 109:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000110 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	8b 45 08             	mov    0x8(%ebp),%eax
+ 116:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 11a:	0f b6 10             	movzbl (%eax),%edx
+ 11d:	84 d2                	test   %dl,%dl
+ 11f:	75 12                	jne    133 <strchr+0x23>
+ 121:	eb 1d                	jmp    140 <strchr+0x30>
+ 123:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 127:	90                   	nop
+ 128:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 12c:	83 c0 01             	add    $0x1,%eax
+ 12f:	84 d2                	test   %dl,%dl
+ 131:	74 0d                	je     140 <strchr+0x30>
+    if(*s == c)
+ 133:	38 d1                	cmp    %dl,%cl
+ 135:	75 f1                	jne    128 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 137:	5d                   	pop    %ebp
+ 138:	c3                   	ret
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 140:	31 c0                	xor    %eax,%eax
+}
+ 142:	5d                   	pop    %ebp
+ 143:	c3                   	ret
+ 144:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 14f:	90                   	nop
+
+00000150 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	57                   	push   %edi
+ 154:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 155:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 158:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 159:	31 db                	xor    %ebx,%ebx
+{
+ 15b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 15e:	eb 27                	jmp    187 <gets+0x37>
+    cc = read(0, &c, 1);
+ 160:	83 ec 04             	sub    $0x4,%esp
+ 163:	6a 01                	push   $0x1
+ 165:	56                   	push   %esi
+ 166:	6a 00                	push   $0x0
+ 168:	e8 13 02 00 00       	call   380 <read>
+    if(cc < 1)
+ 16d:	83 c4 10             	add    $0x10,%esp
+ 170:	85 c0                	test   %eax,%eax
+ 172:	7e 1d                	jle    191 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 174:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 178:	8b 55 08             	mov    0x8(%ebp),%edx
+ 17b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 17f:	3c 0a                	cmp    $0xa,%al
+ 181:	74 10                	je     193 <gets+0x43>
+ 183:	3c 0d                	cmp    $0xd,%al
+ 185:	74 0c                	je     193 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 187:	89 df                	mov    %ebx,%edi
+ 189:	83 c3 01             	add    $0x1,%ebx
+ 18c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 18f:	7c cf                	jl     160 <gets+0x10>
+ 191:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 193:	8b 45 08             	mov    0x8(%ebp),%eax
+ 196:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 19a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 19d:	5b                   	pop    %ebx
+ 19e:	5e                   	pop    %esi
+ 19f:	5f                   	pop    %edi
+ 1a0:	5d                   	pop    %ebp
+ 1a1:	c3                   	ret
+ 1a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001b0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	56                   	push   %esi
+ 1b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1b5:	83 ec 08             	sub    $0x8,%esp
+ 1b8:	6a 00                	push   $0x0
+ 1ba:	ff 75 08             	push   0x8(%ebp)
+ 1bd:	e8 4f 02 00 00       	call   411 <open>
+  if(fd < 0)
+ 1c2:	83 c4 10             	add    $0x10,%esp
+ 1c5:	85 c0                	test   %eax,%eax
+ 1c7:	78 27                	js     1f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1c9:	83 ec 08             	sub    $0x8,%esp
+ 1cc:	ff 75 0c             	push   0xc(%ebp)
+ 1cf:	89 c3                	mov    %eax,%ebx
+ 1d1:	50                   	push   %eax
+ 1d2:	e8 91 02 00 00       	call   468 <fstat>
+  close(fd);
+ 1d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 1da:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1dc:	e8 d9 01 00 00       	call   3ba <close>
+  return r;
+ 1e1:	83 c4 10             	add    $0x10,%esp
+}
+ 1e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1e7:	89 f0                	mov    %esi,%eax
+ 1e9:	5b                   	pop    %ebx
+ 1ea:	5e                   	pop    %esi
+ 1eb:	5d                   	pop    %ebp
+ 1ec:	c3                   	ret
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 1f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1f5:	eb ed                	jmp    1e4 <stat+0x34>
+ 1f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fe:	66 90                	xchg   %ax,%ax
+
+00000200 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	53                   	push   %ebx
+ 204:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 207:	0f be 02             	movsbl (%edx),%eax
+ 20a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 20d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 210:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 215:	77 1e                	ja     235 <atoi+0x35>
+ 217:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 220:	83 c2 01             	add    $0x1,%edx
+ 223:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 226:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 22a:	0f be 02             	movsbl (%edx),%eax
+ 22d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 230:	80 fb 09             	cmp    $0x9,%bl
+ 233:	76 eb                	jbe    220 <atoi+0x20>
+  return n;
+}
+ 235:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 238:	89 c8                	mov    %ecx,%eax
+ 23a:	c9                   	leave
+ 23b:	c3                   	ret
+ 23c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+ 245:	8b 45 10             	mov    0x10(%ebp),%eax
+ 248:	8b 55 08             	mov    0x8(%ebp),%edx
+ 24b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 24e:	85 c0                	test   %eax,%eax
+ 250:	7e 13                	jle    265 <memmove+0x25>
+ 252:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 254:	89 d7                	mov    %edx,%edi
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 260:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 261:	39 f8                	cmp    %edi,%eax
+ 263:	75 fb                	jne    260 <memmove+0x20>
+  return vdst;
+}
+ 265:	5e                   	pop    %esi
+ 266:	89 d0                	mov    %edx,%eax
+ 268:	5f                   	pop    %edi
+ 269:	5d                   	pop    %ebp
+ 26a:	c3                   	ret
+ 26b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 26f:	90                   	nop
+
+00000270 <ugetpid>:
+// getpid() without a system call, from the page at UPROC.
+int
+ugetpid(void)
+{
+  return ((struct uproc*)UPROC)->pid;
+}
+ 270:	a1 00 e0 ff 7f       	mov    0x7fffe000,%eax
+ 275:	c3                   	ret
+ 276:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000280 <uclocktime>:
+
+// clocktime() without a system call, from the page at UCLOCK.
+int
+uclocktime(struct timespec *ts)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+ 284:	56                   	push   %esi
+ 285:	53                   	push   %ebx
+ 286:	83 ec 1c             	sub    $0x1c,%esp
+  struct uclock *c = (struct uclock*)UCLOCK;
+
+  if(c->tscmult == 0)
+ 289:	8b 0d 08 f0 ff 7f    	mov    0x7ffff008,%ecx
+{
+ 28f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(c->tscmult == 0)
+ 292:	85 c9                	test   %ecx,%ecx
+ 294:	74 6a                	je     300 <uclocktime+0x80>
+// Read the time-stamp counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 tsc;
+  asm volatile("rdtsc" : "=A" (tsc));
+ 296:	0f 31                	rdtsc
+static inline void
+uclockread(struct uclock *c, uint64 tsc, struct timespec *ts)
+{
+  uint64 d, ns;
+
+  d = tsc - c->tscbase;
+ 298:	2b 05 0c f0 ff 7f    	sub    0x7ffff00c,%eax
+ 29e:	1b 15 10 f0 ff 7f    	sbb    0x7ffff010,%edx
+ 2a4:	89 c6                	mov    %eax,%esi
+  if((long long)d < 0)  // another CPU's TSC is a little behind
+ 2a6:	85 d2                	test   %edx,%edx
+ 2a8:	78 46                	js     2f0 <uclocktime+0x70>
+    d = 0;
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 2aa:	89 d0                	mov    %edx,%eax
+ 2ac:	f7 e1                	mul    %ecx
+ 2ae:	0f a4 c2 08          	shld   $0x8,%eax,%edx
+ 2b2:	c1 e0 08             	shl    $0x8,%eax
+ 2b5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+ 2b8:	89 f0                	mov    %esi,%eax
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 2ba:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+       (((uint)d * (uint64)c->tscmult) >> TSCSHIFT);
+ 2bd:	f7 e1                	mul    %ecx
+ 2bf:	0f ac d0 18          	shrd   $0x18,%edx,%eax
+ 2c3:	c1 ea 18             	shr    $0x18,%edx
+  ns = ((uint64)((uint)(d >> 32) * (uint64)c->tscmult) << (32 - TSCSHIFT)) +
+ 2c6:	03 45 e0             	add    -0x20(%ebp),%eax
+ 2c9:	13 55 e4             	adc    -0x1c(%ebp),%edx
+// linked with libgcc, so it cannot use 64-bit '/' or '%'.
+static inline uint
+divl(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+  asm("divl %4" : "=a" (q), "=d" (r) : "a" ((uint)n), "d" ((uint)(n>>32)), "rm" (d));
+ 2cc:	89 c7                	mov    %eax,%edi
+ 2ce:	89 f8                	mov    %edi,%eax
+ 2d0:	b9 00 ca 9a 3b       	mov    $0x3b9aca00,%ecx
+ 2d5:	f7 f1                	div    %ecx
+  ts->sec = divl(ns, 1000000000, &ts->nsec);
+ 2d7:	89 03                	mov    %eax,(%ebx)
+    return clocktime(ts);
+  uclockread(c, rdtsc(), ts);
+  return 0;
+}
+ 2d9:	31 c0                	xor    %eax,%eax
+  *rem = r;
+ 2db:	89 53 04             	mov    %edx,0x4(%ebx)
+ 2de:	83 c4 1c             	add    $0x1c,%esp
+ 2e1:	5b                   	pop    %ebx
+ 2e2:	5e                   	pop    %esi
+ 2e3:	5f                   	pop    %edi
+ 2e4:	5d                   	pop    %ebp
+ 2e5:	c3                   	ret
+ 2e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 2f0:	31 d2                	xor    %edx,%edx
+ 2f2:	31 ff                	xor    %edi,%edi
+ 2f4:	eb d8                	jmp    2ce <uclocktime+0x4e>
+ 2f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 300:	83 c4 1c             	add    $0x1c,%esp
+ 303:	5b                   	pop    %ebx
+ 304:	5e                   	pop    %esi
+ 305:	5f                   	pop    %edi
+ 306:	5d                   	pop    %ebp
+    return clocktime(ts);
+ 307:	e9 f2 02 00 00       	jmp    5fe <clocktime>
+
+0000030c <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+ 30c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 311:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 318:	00 00 00 
+ 31b:	74 09                	je     326 <fork+0x1a>
+ 31d:	89 e1                	mov    %esp,%ecx
+ 31f:	ba 28 03 00 00       	mov    $0x328,%edx
+ 324:	0f 34                	sysenter
+ 326:	cd 40                	int    $0x40
+ 328:	c3                   	ret
+
+00000329 <exit>:
+SYSCALL(exit)
+ 329:	b8 02 00 00 00       	mov    $0x2,%eax
+ 32e:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 335:	00 00 00 
+ 338:	74 09                	je     343 <exit+0x1a>
+ 33a:	89 e1                	mov    %esp,%ecx
+ 33c:	ba 45 03 00 00       	mov    $0x345,%edx
+ 341:	0f 34                	sysenter
+ 343:	cd 40                	int    $0x40
+ 345:	c3                   	ret
+
+00000346 <wait>:
+SYSCALL(wait)
+ 346:	b8 03 00 00 00       	mov    $0x3,%eax
+ 34b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 352:	00 00 00 
+ 355:	74 09                	je     360 <wait+0x1a>
+ 357:	89 e1                	mov    %esp,%ecx
+ 359:	ba 62 03 00 00       	mov    $0x362,%edx
+ 35e:	0f 34                	sysenter
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <pipe>:
+SYSCALL(pipe)
+ 363:	b8 04 00 00 00       	mov    $0x4,%eax
+ 368:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 36f:	00 00 00 
+ 372:	74 09                	je     37d <pipe+0x1a>
+ 374:	89 e1                	mov    %esp,%ecx
+ 376:	ba 7f 03 00 00       	mov    $0x37f,%edx
+ 37b:	0f 34                	sysenter
+ 37d:	cd 40                	int    $0x40
+ 37f:	c3                   	ret
+
+00000380 <read>:
+SYSCALL(read)
+ 380:	b8 05 00 00 00       	mov    $0x5,%eax
+ 385:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 38c:	00 00 00 
+ 38f:	74 09                	je     39a <read+0x1a>
+ 391:	89 e1                	mov    %esp,%ecx
+ 393:	ba 9c 03 00 00       	mov    $0x39c,%edx
+ 398:	0f 34                	sysenter
+ 39a:	cd 40                	int    $0x40
+ 39c:	c3                   	ret
+
+0000039d <write>:
+SYSCALL(write)
+ 39d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3a2:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 3a9:	00 00 00 
+ 3ac:	74 09                	je     3b7 <write+0x1a>
+ 3ae:	89 e1                	mov    %esp,%ecx
+ 3b0:	ba b9 03 00 00       	mov    $0x3b9,%edx
+ 3b5:	0f 34                	sysenter
+ 3b7:	cd 40                	int    $0x40
+ 3b9:	c3                   	ret
+
+000003ba <close>:
+SYSCALL(close)
+ 3ba:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3bf:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 3c6:	00 00 00 
+ 3c9:	74 09                	je     3d4 <close+0x1a>
+ 3cb:	89 e1                	mov    %esp,%ecx
+ 3cd:	ba d6 03 00 00       	mov    $0x3d6,%edx
+ 3d2:	0f 34                	sysenter
+ 3d4:	cd 40                	int    $0x40
+ 3d6:	c3                   	ret
+
+000003d7 <kill>:
+SYSCALL(kill)
+ 3d7:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3dc:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 3e3:	00 00 00 
+ 3e6:	74 09                	je     3f1 <kill+0x1a>
+ 3e8:	89 e1                	mov    %esp,%ecx
+ 3ea:	ba f3 03 00 00       	mov    $0x3f3,%edx
+ 3ef:	0f 34                	sysenter
+ 3f1:	cd 40                	int    $0x40
+ 3f3:	c3                   	ret
+
+000003f4 <exec>:
+SYSCALL(exec)
+ 3f4:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3f9:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 400:	00 00 00 
+ 403:	74 09                	je     40e <exec+0x1a>
+ 405:	89 e1                	mov    %esp,%ecx
+ 407:	ba 10 04 00 00       	mov    $0x410,%edx
+ 40c:	0f 34                	sysenter
+ 40e:	cd 40                	int    $0x40
+ 410:	c3                   	ret
+
+00000411 <open>:
+SYSCALL(open)
+ 411:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 416:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 41d:	00 00 00 
+ 420:	74 09                	je     42b <open+0x1a>
+ 422:	89 e1                	mov    %esp,%ecx
+ 424:	ba 2d 04 00 00       	mov    $0x42d,%edx
+ 429:	0f 34                	sysenter
+ 42b:	cd 40                	int    $0x40
+ 42d:	c3                   	ret
+
+0000042e <mknod>:
+SYSCALL(mknod)
+ 42e:	b8 11 00 00 00       	mov    $0x11,%eax
+ 433:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 43a:	00 00 00 
+ 43d:	74 09                	je     448 <mknod+0x1a>
+ 43f:	89 e1                	mov    %esp,%ecx
+ 441:	ba 4a 04 00 00       	mov    $0x44a,%edx
+ 446:	0f 34                	sysenter
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <unlink>:
+SYSCALL(unlink)
+ 44b:	b8 12 00 00 00       	mov    $0x12,%eax
+ 450:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 457:	00 00 00 
+ 45a:	74 09                	je     465 <unlink+0x1a>
+ 45c:	89 e1                	mov    %esp,%ecx
+ 45e:	ba 67 04 00 00       	mov    $0x467,%edx
+ 463:	0f 34                	sysenter
+ 465:	cd 40                	int    $0x40
+ 467:	c3                   	ret
+
+00000468 <fstat>:
+SYSCALL(fstat)
+ 468:	b8 08 00 00 00       	mov    $0x8,%eax
+ 46d:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 474:	00 00 00 
+ 477:	74 09                	je     482 <fstat+0x1a>
+ 479:	89 e1                	mov    %esp,%ecx
+ 47b:	ba 84 04 00 00       	mov    $0x484,%edx
+ 480:	0f 34                	sysenter
+ 482:	cd 40                	int    $0x40
+ 484:	c3                   	ret
+
+00000485 <link>:
+SYSCALL(link)
+ 485:	b8 13 00 00 00       	mov    $0x13,%eax
+ 48a:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 491:	00 00 00 
+ 494:	74 09                	je     49f <link+0x1a>
+ 496:	89 e1                	mov    %esp,%ecx
+ 498:	ba a1 04 00 00       	mov    $0x4a1,%edx
+ 49d:	0f 34                	sysenter
+ 49f:	cd 40                	int    $0x40
+ 4a1:	c3                   	ret
+
+000004a2 <mkdir>:
+SYSCALL(mkdir)
+ 4a2:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4a7:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4ae:	00 00 00 
+ 4b1:	74 09                	je     4bc <mkdir+0x1a>
+ 4b3:	89 e1                	mov    %esp,%ecx
+ 4b5:	ba be 04 00 00       	mov    $0x4be,%edx
+ 4ba:	0f 34                	sysenter
+ 4bc:	cd 40                	int    $0x40
+ 4be:	c3                   	ret
+
+000004bf <chdir>:
+SYSCALL(chdir)
+ 4bf:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4c4:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4cb:	00 00 00 
+ 4ce:	74 09                	je     4d9 <chdir+0x1a>
+ 4d0:	89 e1                	mov    %esp,%ecx
+ 4d2:	ba db 04 00 00       	mov    $0x4db,%edx
+ 4d7:	0f 34                	sysenter
+ 4d9:	cd 40                	int    $0x40
+ 4db:	c3                   	ret
+
+000004dc <dup>:
+SYSCALL(dup)
+ 4dc:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4e1:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 4e8:	00 00 00 
+ 4eb:	74 09                	je     4f6 <dup+0x1a>
+ 4ed:	89 e1                	mov    %esp,%ecx
+ 4ef:	ba f8 04 00 00       	mov    $0x4f8,%edx
+ 4f4:	0f 34                	sysenter
+ 4f6:	cd 40                	int    $0x40
+ 4f8:	c3                   	ret
+
+000004f9 <getpid>:
+SYSCALL(getpid)
+ 4f9:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4fe:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 505:	00 00 00 
+ 508:	74 09                	je     513 <getpid+0x1a>
+ 50a:	89 e1                	mov    %esp,%ecx
+ 50c:	ba 15 05 00 00       	mov    $0x515,%edx
+ 511:	0f 34                	sysenter
+ 513:	cd 40                	int    $0x40
+ 515:	c3                   	ret
+
+00000516 <sbrk>:
+SYSCALL(sbrk)
+ 516:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 51b:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 522:	00 00 00 
+ 525:	74 09                	je     530 <sbrk+0x1a>
+ 527:	89 e1                	mov    %esp,%ecx
+ 529:	ba 32 05 00 00       	mov    $0x532,%edx
+ 52e:	0f 34                	sysenter
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <sleep>:
+SYSCALL(sleep)
+ 533:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 538:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 53f:	00 00 00 
+ 542:	74 09                	je     54d <sleep+0x1a>
+ 544:	89 e1                	mov    %esp,%ecx
+ 546:	ba 4f 05 00 00       	mov    $0x54f,%edx
+ 54b:	0f 34                	sysenter
+ 54d:	cd 40                	int    $0x40
+ 54f:	c3                   	ret
+
+00000550 <uptime>:
+SYSCALL(uptime)
+ 550:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 555:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 55c:	00 00 00 
+ 55f:	74 09                	je     56a <uptime+0x1a>
+ 561:	89 e1                	mov    %esp,%ecx
+ 563:	ba 6c 05 00 00       	mov    $0x56c,%edx
+ 568:	0f 34                	sysenter
+ 56a:	cd 40                	int    $0x40
+ 56c:	c3                   	ret
+
+0000056d <swapread>:
+SYSCALL(swapread)
+ 56d:	b8 16 00 00 00       	mov    $0x16,%eax
+ 572:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 579:	00 00 00 
+ 57c:	74 09                	je     587 <swapread+0x1a>
+ 57e:	89 e1                	mov    %esp,%ecx
+ 580:	ba 89 05 00 00       	mov    $0x589,%edx
+ 585:	0f 34                	sysenter
+ 587:	cd 40                	int    $0x40
+ 589:	c3                   	ret
+
+0000058a <swapwrite>:
+SYSCALL(swapwrite)
+ 58a:	b8 17 00 00 00       	mov    $0x17,%eax
+ 58f:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 596:	00 00 00 
+ 599:	74 09                	je     5a4 <swapwrite+0x1a>
+ 59b:	89 e1                	mov    %esp,%ecx
+ 59d:	ba a6 05 00 00       	mov    $0x5a6,%edx
+ 5a2:	0f 34                	sysenter
+ 5a4:	cd 40                	int    $0x40
+ 5a6:	c3                   	ret
+
+000005a7 <setaffinity>:
+SYSCALL(setaffinity)
+ 5a7:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5ac:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5b3:	00 00 00 
+ 5b6:	74 09                	je     5c1 <setaffinity+0x1a>
+ 5b8:	89 e1                	mov    %esp,%ecx
+ 5ba:	ba c3 05 00 00       	mov    $0x5c3,%edx
+ 5bf:	0f 34                	sysenter
+ 5c1:	cd 40                	int    $0x40
+ 5c3:	c3                   	ret
+
+000005c4 <getaffinity>:
+SYSCALL(getaffinity)
+ 5c4:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5c9:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5d0:	00 00 00 
+ 5d3:	74 09                	je     5de <getaffinity+0x1a>
+ 5d5:	89 e1                	mov    %esp,%ecx
+ 5d7:	ba e0 05 00 00       	mov    $0x5e0,%edx
+ 5dc:	0f 34                	sysenter
+ 5de:	cd 40                	int    $0x40
+ 5e0:	c3                   	ret
+
+000005e1 <nanosleep>:
+SYSCALL(nanosleep)
+ 5e1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5e6:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 5ed:	00 00 00 
+ 5f0:	74 09                	je     5fb <nanosleep+0x1a>
+ 5f2:	89 e1                	mov    %esp,%ecx
+ 5f4:	ba fd 05 00 00       	mov    $0x5fd,%edx
+ 5f9:	0f 34                	sysenter
+ 5fb:	cd 40                	int    $0x40
+ 5fd:	c3                   	ret
+
+000005fe <clocktime>:
+SYSCALL(clocktime)
+ 5fe:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 603:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 60a:	00 00 00 
+ 60d:	74 09                	je     618 <clocktime+0x1a>
+ 60f:	89 e1                	mov    %esp,%ecx
+ 611:	ba 1a 06 00 00       	mov    $0x61a,%edx
+ 616:	0f 34                	sysenter
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <batch>:
+SYSCALL(batch)
+ 61b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 620:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 627:	00 00 00 
+ 62a:	74 09                	je     635 <batch+0x1a>
+ 62c:	89 e1                	mov    %esp,%ecx
+ 62e:	ba 37 06 00 00       	mov    $0x637,%edx
+ 633:	0f 34                	sysenter
+ 635:	cd 40                	int    $0x40
+ 637:	c3                   	ret
+
+00000638 <aiosetup>:
+SYSCALL(aiosetup)
+ 638:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 63d:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 644:	00 00 00 
+ 647:	74 09                	je     652 <aiosetup+0x1a>
+ 649:	89 e1                	mov    %esp,%ecx
+ 64b:	ba 54 06 00 00       	mov    $0x654,%edx
+ 650:	0f 34                	sysenter
+ 652:	cd 40                	int    $0x40
+ 654:	c3                   	ret
+
+00000655 <aiowait>:
+SYSCALL(aiowait)
+ 655:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 65a:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 661:	00 00 00 
+ 664:	74 09                	je     66f <aiowait+0x1a>
+ 666:	89 e1                	mov    %esp,%ecx
+ 668:	ba 71 06 00 00       	mov    $0x671,%edx
+ 66d:	0f 34                	sysenter
+ 66f:	cd 40                	int    $0x40
+ 671:	c3                   	ret
+
+00000672 <spawn>:
+SYSCALL(spawn)
+ 672:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 677:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 67e:	00 00 00 
+ 681:	74 09                	je     68c <spawn+0x1a>
+ 683:	89 e1                	mov    %esp,%ecx
+ 685:	ba 8e 06 00 00       	mov    $0x68e,%edx
+ 68a:	0f 34                	sysenter
+ 68c:	cd 40                	int    $0x40
+ 68e:	c3                   	ret
+
+0000068f <getprocinfo>:
+SYSCALL(getprocinfo)
+ 68f:	b8 20 00 00 00       	mov    $0x20,%eax
+ 694:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 69b:	00 00 00 
+ 69e:	74 09                	je     6a9 <getprocinfo+0x1a>
+ 6a0:	89 e1                	mov    %esp,%ecx
+ 6a2:	ba ab 06 00 00       	mov    $0x6ab,%edx
+ 6a7:	0f 34                	sysenter
+ 6a9:	cd 40                	int    $0x40
+ 6ab:	c3                   	ret
+
+000006ac <getlockstat>:
+SYSCALL(getlockstat)
+ 6ac:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6b1:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6b8:	00 00 00 
+ 6bb:	74 09                	je     6c6 <getlockstat+0x1a>
+ 6bd:	89 e1                	mov    %esp,%ecx
+ 6bf:	ba c8 06 00 00       	mov    $0x6c8,%edx
+ 6c4:	0f 34                	sysenter
+ 6c6:	cd 40                	int    $0x40
+ 6c8:	c3                   	ret
+
+000006c9 <lockprof>:
+SYSCALL(lockprof)
+ 6c9:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6ce:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6d5:	00 00 00 
+ 6d8:	74 09                	je     6e3 <lockprof+0x1a>
+ 6da:	89 e1                	mov    %esp,%ecx
+ 6dc:	ba e5 06 00 00       	mov    $0x6e5,%edx
+ 6e1:	0f 34                	sysenter
+ 6e3:	cd 40                	int    $0x40
+ 6e5:	c3                   	ret
+
+000006e6 <getlockprof>:
+SYSCALL(getlockprof)
+ 6e6:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6eb:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 6f2:	00 00 00 
+ 6f5:	74 09                	je     700 <getlockprof+0x1a>
+ 6f7:	89 e1                	mov    %esp,%ecx
+ 6f9:	ba 02 07 00 00       	mov    $0x702,%edx
+ 6fe:	0f 34                	sysenter
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <diskstat>:
+SYSCALL(diskstat)
+ 703:	b8 24 00 00 00       	mov    $0x24,%eax
+ 708:	f7 05 00 f0 ff 7f 01 	testl  $0x1,0x7ffff000
+ 70f:	00 00 00 
+ 712:	74 09                	je     71d <diskstat+0x1a>
+ 714:	89 e1                	mov    %esp,%ecx
+ 716:	ba 1f 07 00 00       	mov    $0x71f,%edx
+ 71b:	0f 34                	sysenter
+ 71d:	cd 40                	int    $0x40
+ 71f:	c3                   	ret
+
+00000720 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 720:	55                   	push   %ebp
+ 721:	89 e5                	mov    %esp,%ebp
+ 723:	57                   	push   %edi
+ 724:	56                   	push   %esi
+ 725:	53                   	push   %ebx
+ 726:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 728:	89 d1                	mov    %edx,%ecx
+{
+ 72a:	83 ec 3c             	sub    $0x3c,%esp
+ 72d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 730:	85 d2                	test   %edx,%edx
+ 732:	0f 89 80 00 00 00    	jns    7b8 <printint+0x98>
+ 738:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 73c:	74 7a                	je     7b8 <printint+0x98>
+    x = -xx;
+ 73e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 740:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 745:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 748:	31 f6                	xor    %esi,%esi
+ 74a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 750:	89 c8                	mov    %ecx,%eax
+ 752:	31 d2                	xor    %edx,%edx
+ 754:	89 f7                	mov    %esi,%edi
+ 756:	f7 f3                	div    %ebx
+ 758:	8d 76 01             	lea    0x1(%esi),%esi
+ 75b:	0f b6 92 48 0b 00 00 	movzbl 0xb48(%edx),%edx
+ 762:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 766:	89 ca                	mov    %ecx,%edx
+ 768:	89 c1                	mov    %eax,%ecx
+ 76a:	39 da                	cmp    %ebx,%edx
+ 76c:	73 e2                	jae    750 <printint+0x30>
+  if(neg)
+ 76e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 771:	85 c0                	test   %eax,%eax
+ 773:	74 07                	je     77c <printint+0x5c>
+    buf[i++] = '-';
+ 775:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 77a:	89 f7                	mov    %esi,%edi
+ 77c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 77f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 782:	01 df                	add    %ebx,%edi
+ 784:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 788:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 78b:	83 ec 04             	sub    $0x4,%esp
+ 78e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 791:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 794:	6a 01                	push   $0x1
+ 796:	50                   	push   %eax
+ 797:	56                   	push   %esi
+ 798:	e8 00 fc ff ff       	call   39d <write>
+  while(--i >= 0)
+ 79d:	89 f8                	mov    %edi,%eax
+ 79f:	83 c4 10             	add    $0x10,%esp
+ 7a2:	83 ef 01             	sub    $0x1,%edi
+ 7a5:	39 d8                	cmp    %ebx,%eax
+ 7a7:	75 df                	jne    788 <printint+0x68>
+}
+ 7a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7ac:	5b                   	pop    %ebx
+ 7ad:	5e                   	pop    %esi
+ 7ae:	5f                   	pop    %edi
+ 7af:	5d                   	pop    %ebp
+ 7b0:	c3                   	ret
+ 7b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 7b8:	31 c0                	xor    %eax,%eax
+ 7ba:	eb 89                	jmp    745 <printint+0x25>
+ 7bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007c0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 7c0:	55                   	push   %ebp
+ 7c1:	89 e5                	mov    %esp,%ebp
+ 7c3:	57                   	push   %edi
+ 7c4:	56                   	push   %esi
+ 7c5:	53                   	push   %ebx
+ 7c6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 7cc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 7cf:	0f b6 1e             	movzbl (%esi),%ebx
+ 7d2:	83 c6 01             	add    $0x1,%esi
+ 7d5:	84 db                	test   %bl,%bl
+ 7d7:	74 67                	je     840 <printf+0x80>
+ 7d9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 7dc:	31 d2                	xor    %edx,%edx
+ 7de:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 7e1:	eb 34                	jmp    817 <printf+0x57>
+ 7e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7e7:	90                   	nop
+ 7e8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 7eb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 7f0:	83 f8 25             	cmp    $0x25,%eax
+ 7f3:	74 18                	je     80d <printf+0x4d>
+  write(fd, &c, 1);
+ 7f5:	83 ec 04             	sub    $0x4,%esp
+ 7f8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 7fb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7fe:	6a 01                	push   $0x1
+ 800:	50                   	push   %eax
+ 801:	57                   	push   %edi
+ 802:	e8 96 fb ff ff       	call   39d <write>
+ 807:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 80a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 80d:	0f b6 1e             	movzbl (%esi),%ebx
+ 810:	83 c6 01             	add    $0x1,%esi
+ 813:	84 db                	test   %bl,%bl
+ 815:	74 29                	je     840 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 817:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 81a:	85 d2                	test   %edx,%edx
+ 81c:	74 ca                	je     7e8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 81e:	83 fa 25             	cmp    $0x25,%edx
+ 821:	75 ea                	jne    80d <printf+0x4d>
+      if(c == 'd'){
+ 823:	83 f8 25             	cmp    $0x25,%eax
+ 826:	0f 84 24 01 00 00    	je     950 <printf+0x190>
+ 82c:	83 e8 63             	sub    $0x63,%eax
+ 82f:	83 f8 15             	cmp    $0x15,%eax
+ 832:	77 1c                	ja     850 <printf+0x90>
+ 834:	ff 24 85 f0 0a 00 00 	jmp    *0xaf0(,%eax,4)
+ 83b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 83f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 840:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 843:	5b                   	pop    %ebx
+ 844:	5e                   	pop    %esi
+ 845:	5f                   	pop    %edi
+ 846:	5d                   	pop    %ebp
+ 847:	c3                   	ret
+ 848:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 84f:	90                   	nop
+  write(fd, &c, 1);
+ 850:	83 ec 04             	sub    $0x4,%esp
+ 853:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 856:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 85a:	6a 01                	push   $0x1
+ 85c:	52                   	push   %edx
+ 85d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 860:	57                   	push   %edi
+ 861:	e8 37 fb ff ff       	call   39d <write>
+ 866:	83 c4 0c             	add    $0xc,%esp
+ 869:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 86c:	6a 01                	push   $0x1
+ 86e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 871:	52                   	push   %edx
+ 872:	57                   	push   %edi
+ 873:	e8 25 fb ff ff       	call   39d <write>
+        putc(fd, c);
+ 878:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 87b:	31 d2                	xor    %edx,%edx
+ 87d:	eb 8e                	jmp    80d <printf+0x4d>
+ 87f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 880:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 883:	83 ec 0c             	sub    $0xc,%esp
+ 886:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 88b:	8b 13                	mov    (%ebx),%edx
+ 88d:	6a 00                	push   $0x0
+ 88f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 891:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 894:	e8 87 fe ff ff       	call   720 <printint>
+        ap++;
+ 899:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 89c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 89f:	31 d2                	xor    %edx,%edx
+ 8a1:	e9 67 ff ff ff       	jmp    80d <printf+0x4d>
+ 8a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 8b0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 8b3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 8b5:	83 c0 04             	add    $0x4,%eax
+ 8b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 8bb:	85 db                	test   %ebx,%ebx
+ 8bd:	0f 84 9d 00 00 00    	je     960 <printf+0x1a0>
+        while(*s != 0){
+ 8c3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 8c6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 8c8:	84 c0                	test   %al,%al
+ 8ca:	0f 84 3d ff ff ff    	je     80d <printf+0x4d>
+ 8d0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8d3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 8d6:	89 de                	mov    %ebx,%esi
+ 8d8:	89 d3                	mov    %edx,%ebx
+ 8da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 8e0:	83 ec 04             	sub    $0x4,%esp
+ 8e3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 8e6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 8e9:	6a 01                	push   $0x1
+ 8eb:	53                   	push   %ebx
+ 8ec:	57                   	push   %edi
+ 8ed:	e8 ab fa ff ff       	call   39d <write>
+        while(*s != 0){
+ 8f2:	0f b6 06             	movzbl (%esi),%eax
+ 8f5:	83 c4 10             	add    $0x10,%esp
+ 8f8:	84 c0                	test   %al,%al
+ 8fa:	75 e4                	jne    8e0 <printf+0x120>
+      state = 0;
+ 8fc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 8ff:	31 d2                	xor    %edx,%edx
+ 901:	e9 07 ff ff ff       	jmp    80d <printf+0x4d>
+ 906:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 910:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 913:	83 ec 0c             	sub    $0xc,%esp
+ 916:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 91b:	8b 13                	mov    (%ebx),%edx
+ 91d:	6a 01                	push   $0x1
+ 91f:	e9 6b ff ff ff       	jmp    88f <printf+0xcf>
+ 924:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 928:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 92b:	83 ec 04             	sub    $0x4,%esp
+ 92e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 931:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 933:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 936:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 939:	6a 01                	push   $0x1
+ 93b:	52                   	push   %edx
+ 93c:	57                   	push   %edi
+ 93d:	e8 5b fa ff ff       	call   39d <write>
+        ap++;
+ 942:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 945:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 948:	31 d2                	xor    %edx,%edx
+ 94a:	e9 be fe ff ff       	jmp    80d <printf+0x4d>
+ 94f:	90                   	nop
+  write(fd, &c, 1);
+ 950:	83 ec 04             	sub    $0x4,%esp
+ 953:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 956:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 959:	6a 01                	push   $0x1
+ 95b:	e9 11 ff ff ff       	jmp    871 <printf+0xb1>
+ 960:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 965:	bb e8 0a 00 00       	mov    $0xae8,%ebx
+ 96a:	e9 61 ff ff ff       	jmp    8d0 <printf+0x110>
+ 96f:	90                   	nop
+
+00000970 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 970:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 971:	a1 34 0e 00 00       	mov    0xe34,%eax
+{
+ 976:	89 e5                	mov    %esp,%ebp
+ 978:	57                   	push   %edi
+ 979:	56                   	push   %esi
+ 97a:	53                   	push   %ebx
+ 97b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 97e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 981:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 988:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 98a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 98c:	39 ca                	cmp    %ecx,%edx
+ 98e:	73 30                	jae    9c0 <free+0x50>
+ 990:	39 c1                	cmp    %eax,%ecx
+ 992:	72 04                	jb     998 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 994:	39 c2                	cmp    %eax,%edx
+ 996:	72 f0                	jb     988 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 998:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 99b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 99e:	39 f8                	cmp    %edi,%eax
+ 9a0:	74 2e                	je     9d0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9a2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 9a5:	8b 42 04             	mov    0x4(%edx),%eax
+ 9a8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9ab:	39 f1                	cmp    %esi,%ecx
+ 9ad:	74 38                	je     9e7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 9af:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 9b1:	5b                   	pop    %ebx
+  freep = p;
+ 9b2:	89 15 34 0e 00 00    	mov    %edx,0xe34
+}
+ 9b8:	5e                   	pop    %esi
+ 9b9:	5f                   	pop    %edi
+ 9ba:	5d                   	pop    %ebp
+ 9bb:	c3                   	ret
+ 9bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9c0:	39 c1                	cmp    %eax,%ecx
+ 9c2:	72 d0                	jb     994 <free+0x24>
+ 9c4:	eb c2                	jmp    988 <free+0x18>
+ 9c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9cd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 9d0:	03 70 04             	add    0x4(%eax),%esi
+ 9d3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9d6:	8b 02                	mov    (%edx),%eax
+ 9d8:	8b 00                	mov    (%eax),%eax
+ 9da:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 9dd:	8b 42 04             	mov    0x4(%edx),%eax
+ 9e0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9e3:	39 f1                	cmp    %esi,%ecx
+ 9e5:	75 c8                	jne    9af <free+0x3f>
+    p->s.size += bp->s.size;
+ 9e7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 9ea:	89 15 34 0e 00 00    	mov    %edx,0xe34
+    p->s.size += bp->s.size;
+ 9f0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 9f3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 9f6:	89 0a                	mov    %ecx,(%edx)
+}
+ 9f8:	5b                   	pop    %ebx
+ 9f9:	5e                   	pop    %esi
+ 9fa:	5f                   	pop    %edi
+ 9fb:	5d                   	pop    %ebp
+ 9fc:	c3                   	ret
+ 9fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a00 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a00:	55                   	push   %ebp
+ a01:	89 e5                	mov    %esp,%ebp
+ a03:	57                   	push   %edi
+ a04:	56                   	push   %esi
+ a05:	53                   	push   %ebx
+ a06:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a09:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ a0c:	8b 15 34 0e 00 00    	mov    0xe34,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a12:	8d 78 07             	lea    0x7(%eax),%edi
+ a15:	c1 ef 03             	shr    $0x3,%edi
+ a18:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a1b:	85 d2                	test   %edx,%edx
+ a1d:	0f 84 8d 00 00 00    	je     ab0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a23:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a25:	8b 48 04             	mov    0x4(%eax),%ecx
+ a28:	39 f9                	cmp    %edi,%ecx
+ a2a:	73 64                	jae    a90 <malloc+0x90>
+  if(nu < 4096)
+ a2c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a31:	39 df                	cmp    %ebx,%edi
+ a33:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a36:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a3d:	eb 0a                	jmp    a49 <malloc+0x49>
+ a3f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a40:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a42:	8b 48 04             	mov    0x4(%eax),%ecx
+ a45:	39 f9                	cmp    %edi,%ecx
+ a47:	73 47                	jae    a90 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ a49:	89 c2                	mov    %eax,%edx
+ a4b:	39 05 34 0e 00 00    	cmp    %eax,0xe34
+ a51:	75 ed                	jne    a40 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ a53:	83 ec 0c             	sub    $0xc,%esp
+ a56:	56                   	push   %esi
+ a57:	e8 ba fa ff ff       	call   516 <sbrk>
+  if(p == (char*)-1)
+ a5c:	83 c4 10             	add    $0x10,%esp
+ a5f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a62:	74 1c                	je     a80 <malloc+0x80>
+  hp->s.size = nu;
+ a64:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ a67:	83 ec 0c             	sub    $0xc,%esp
+ a6a:	83 c0 08             	add    $0x8,%eax
+ a6d:	50                   	push   %eax
+ a6e:	e8 fd fe ff ff       	call   970 <free>
+  return freep;
+ a73:	8b 15 34 0e 00 00    	mov    0xe34,%edx
+      if((p = morecore(nunits)) == 0)
+ a79:	83 c4 10             	add    $0x10,%esp
+ a7c:	85 d2                	test   %edx,%edx
+ a7e:	75 c0                	jne    a40 <malloc+0x40>
+        return 0;
+  }
+}
+ a80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a83:	31 c0                	xor    %eax,%eax
+}
+ a85:	5b                   	pop    %ebx
+ a86:	5e                   	pop    %esi
+ a87:	5f                   	pop    %edi
+ a88:	5d                   	pop    %ebp
+ a89:	c3                   	ret
+ a8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ a90:	39 cf                	cmp    %ecx,%edi
+ a92:	74 4c                	je     ae0 <malloc+0xe0>
+        p->s.size -= nunits;
+ a94:	29 f9                	sub    %edi,%ecx
+ a96:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ a99:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ a9c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ a9f:	89 15 34 0e 00 00    	mov    %edx,0xe34
+}
+ aa5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ aa8:	83 c0 08             	add    $0x8,%eax
+}
+ aab:	5b                   	pop    %ebx
+ aac:	5e                   	pop    %esi
+ aad:	5f                   	pop    %edi
+ aae:	5d                   	pop    %ebp
+ aaf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ ab0:	c7 05 34 0e 00 00 38 	movl   $0xe38,0xe34
+ ab7:	0e 00 00 
+    base.s.size = 0;
+ aba:	b8 38 0e 00 00       	mov    $0xe38,%eax
+    base.s.ptr = freep = prevp = &base;
+ abf:	c7 05 38 0e 00 00 38 	movl   $0xe38,0xe38
+ ac6:	0e 00 00 
+    base.s.size = 0;
+ ac9:	c7 05 3c 0e 00 00 00 	movl   $0x0,0xe3c
+ ad0:	00 00 00 
+    if(p->s.size >= nunits){
+ ad3:	e9 54 ff ff ff       	jmp    a2c <malloc+0x2c>
+ ad8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ adf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ ae0:	8b 08                	mov    (%eax),%ecx
+ ae2:	89 0a                	mov    %ecx,(%edx)
+ ae4:	eb b9                	jmp    a9f <malloc+0x9f>